@@ -0,0 +1,37 @@
+/*!
+    \file algorithms_keyed_token_bucket.cpp
+    \brief Keyed token bucket rate limit algorithm example
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "algorithms/keyed_token_bucket.h"
+
+#include "threads/thread.h"
+#include "time/timestamp.h"
+
+#include <iostream>
+#include <string>
+
+int main(int argc, char** argv)
+{
+    std::cout << "Please enter a client name to consume its token (empty line to exit)..." << std::endl;
+
+    // Keyed token bucket with one token per second rate and five burst tokens for each client
+    CppCommon::KeyedTokenBucket<std::string> tb(1, 5);
+
+    std::string line;
+    while (getline(std::cin, line))
+    {
+        if (line.empty())
+            break;
+
+        if (tb.Consume(line))
+            std::cout << (CppCommon::UtcTimestamp().seconds() % 60) << " - " << line << ": token consumed" << std::endl;
+        else
+            std::cout << (CppCommon::UtcTimestamp().seconds() % 60) << " - " << line << ": rate limited" << std::endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,38 @@
+/*!
+    \file algorithms_parallel.cpp
+    \brief Parallel algorithms example
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "algorithms/parallel.h"
+
+#include <iostream>
+#include <numeric>
+#include <vector>
+
+int main(int argc, char** argv)
+{
+    CppCommon::ThreadPool pool;
+
+    std::vector<int> items(1000000);
+    std::iota(items.rbegin(), items.rend(), 0);
+
+    // Parallel transform and reduce
+    CppCommon::ParallelFor(pool, items.begin(), items.end(), [](int& item) { item %= 1000; });
+    int64_t sum = CppCommon::ParallelReduce(pool, items.begin(), items.end(), (int64_t)0, [](int64_t value, int item) { return value + item; });
+    std::cout << "Sum: " << sum << std::endl;
+
+    // Parallel sort
+    CppCommon::ParallelSort(pool, items.begin(), items.end());
+    std::cout << "Sorted: " << (std::is_sorted(items.begin(), items.end()) ? "true" : "false") << std::endl;
+
+    // Parallel build of the flat map
+    std::vector<std::pair<int, int>> pairs(items.size());
+    CppCommon::ParallelTransform(pool, items.begin(), items.end(), pairs.begin(), [](int item) { return std::make_pair(item, item * 2); });
+    auto flatmap = CppCommon::ParallelFlatMap<CppCommon::FlatMap<int, int>>(pool, pairs.begin(), pairs.end());
+    std::cout << "Flat map size: " << flatmap.size() << std::endl;
+
+    return 0;
+}
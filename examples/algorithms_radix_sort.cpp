@@ -0,0 +1,49 @@
+/*!
+    \file algorithms_radix_sort.cpp
+    \brief Radix sort algorithm example
+    \author Ivan Shynkarenka
+    \date 15.10.2026
+    \copyright MIT License
+*/
+
+#include "algorithms/parallel.h"
+#include "algorithms/radix_sort.h"
+#include "time/timestamp.h"
+
+#include <iostream>
+#include <vector>
+
+struct Event
+{
+    CppCommon::Timestamp time;
+    int id;
+};
+
+int main(int argc, char** argv)
+{
+    // Radix sort integers
+    std::vector<int> items = { 5, -3, 8, 0, -7, 2 };
+    CppCommon::RadixSort(items.begin(), items.end());
+    std::cout << "Sorted:";
+    for (auto item : items)
+        std::cout << " " << item;
+    std::cout << std::endl;
+
+    // Radix sort events by timestamp
+    std::vector<Event> events;
+    for (int i = 0; i < 5; ++i)
+        events.push_back(Event{ CppCommon::Timestamp(1000 - i * 100), i });
+    CppCommon::RadixSort(events.begin(), events.end(), [](const Event& event) { return event.time.total(); });
+    for (const auto& event : events)
+        std::cout << "Event " << event.id << " at " << event.time.total() << std::endl;
+
+    // Parallel radix sort
+    CppCommon::ThreadPool pool;
+    std::vector<uint64_t> ids(1000000);
+    for (size_t i = 0; i < ids.size(); ++i)
+        ids[i] = (i * 0x9E3779B97F4A7C15ull) >> 16;
+    CppCommon::ParallelRadixSort(pool, ids.begin(), ids.end());
+    std::cout << "Parallel sorted: " << (std::is_sorted(ids.begin(), ids.end()) ? "true" : "false") << std::endl;
+
+    return 0;
+}
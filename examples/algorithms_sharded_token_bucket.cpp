@@ -0,0 +1,65 @@
+/*!
+    \file algorithms_sharded_token_bucket.cpp
+    \brief Sharded token bucket rate limit algorithm example
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "algorithms/sharded_token_bucket.h"
+
+#include "threads/thread.h"
+#include "time/timestamp.h"
+
+#include <atomic>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+int main(int argc, char** argv)
+{
+    std::cout << "Press Enter to stop..." << std::endl;
+
+    // Sharded token bucket with ten tokens per second rate, hundred burst tokens and four tokens tolerance
+    CppCommon::ShardedTokenBucket tb(10, 100, 4, 4);
+
+    std::atomic<bool> stop(false);
+    std::atomic<uint64_t> consumed(0);
+    std::vector<std::thread> workers;
+    for (int i = 0; i < 4; ++i)
+    {
+        workers.emplace_back([&stop, &tb, &consumed]()
+        {
+            while (!stop)
+            {
+                if (tb.Consume())
+                    ++consumed;
+                else
+                    CppCommon::Thread::Yield();
+            }
+        });
+    }
+
+    // Show the count of consumed tokens each second
+    std::thread monitor = std::thread([&stop, &consumed]()
+    {
+        while (!stop)
+        {
+            CppCommon::Thread::Sleep(1000);
+            std::cout << (CppCommon::UtcTimestamp().seconds() % 60) << " - Tokens consumed: " << consumed << std::endl;
+        }
+    });
+
+    // Wait for input
+    std::cin.get();
+
+    // Stop worker threads
+    stop = true;
+
+    // Wait for worker threads
+    for (auto& worker : workers)
+        worker.join();
+    monitor.join();
+
+    return 0;
+}
@@ -26,10 +26,9 @@ int main(int argc, char** argv)
     {
         while (!stop)
         {
-            if (tb.Consume())
+            // Sleep exactly until the next token is available instead of spinning
+            if (tb.ConsumeOrWaitFor(1, CppCommon::Timespan::seconds(1)))
                 std::cout << (CppCommon::UtcTimestamp().seconds() % 60) << " - Token consumed" << std::endl;
-            else
-                CppCommon::Thread::Yield();
         }
     });
 
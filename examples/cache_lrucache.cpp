@@ -0,0 +1,31 @@
+/*!
+    \file cache_lrucache.cpp
+    \brief LRU cache example
+    \author Ivan Shynkarenka
+    \date 15.10.2026
+    \copyright MIT License
+*/
+
+#include "cache/lrucache.h"
+
+#include <iostream>
+#include <string>
+
+int main(int argc, char** argv)
+{
+    CppCommon::LruCache<std::string, int> cache(2);
+
+    cache.insert("item1", 1);
+    cache.insert("item2", 2);
+
+    // Touch the first item, so the second one is evicted
+    cache.find("item1");
+    cache.insert("item3", 3);
+
+    int value;
+    std::cout << "item1: " << (cache.find("item1", value) ? std::to_string(value) : "evicted") << std::endl;
+    std::cout << "item2: " << (cache.find("item2", value) ? std::to_string(value) : "evicted") << std::endl;
+    std::cout << "item3: " << (cache.find("item3", value) ? std::to_string(value) : "evicted") << std::endl;
+
+    return 0;
+}
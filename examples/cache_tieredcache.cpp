@@ -0,0 +1,51 @@
+/*!
+    \file cache_tieredcache.cpp
+    \brief Tiered cache example
+    \author Ivan Shynkarenka
+    \date 15.10.2026
+    \copyright MIT License
+*/
+
+#include "cache/tieredcache.h"
+#include "filesystem/directory.h"
+
+#include <iostream>
+#include <string>
+
+int main(int argc, char** argv)
+{
+    CppCommon::Path path = CppCommon::Path::current() / "tiered";
+    CppCommon::Path snapshot = path / "snapshot";
+
+    {
+        // Memory tier keeps only two hot cache values
+        CppCommon::TieredCache<std::string, std::string> cache(path / "disk", 1, 2);
+
+        // Warm start from the previous snapshot
+        std::cout << "Loaded: " << cache.Load(snapshot) << std::endl;
+
+        // Fill the tiered cache, cold cache values spill to disk
+        cache.insert("/", "index");
+        cache.insert("/about", "about");
+        cache.insert("/contacts", "contacts");
+        cache.insert("/news", "news");
+
+        std::cout << "Memory tier: " << cache.memory().size() << std::endl;
+        std::cout << "Disk tier: " << cache.disk().size() << std::endl;
+
+        // Find the cold cache value, it is promoted back into memory
+        std::string result;
+        if (cache.find("/", result))
+            std::cout << "Found: " << result << std::endl;
+
+        std::cout << "Demotions: " << cache.demotions() << std::endl;
+        std::cout << "Promotions: " << cache.promotions() << std::endl;
+
+        // Save the memory tier before the shutdown
+        std::cout << "Saved: " << cache.Save(snapshot) << std::endl;
+    }
+
+    CppCommon::Directory::RemoveAll(path);
+
+    return 0;
+}
@@ -0,0 +1,66 @@
+/*!
+    \file common_binary_serializer.cpp
+    \brief Binary serializer example
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "common/binary_serializer.h"
+#include "common/buffered_writer.h"
+#include "filesystem/file.h"
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+struct Trade
+{
+    uint64_t id;
+    std::string_view symbol;
+    int64_t price;
+    uint32_t quantity;
+};
+
+template <>
+struct CppCommon::BinarySchema<Trade>
+{
+    typedef std::tuple<
+        CppCommon::BinaryField<&Trade::id, CppCommon::BinaryEncoding::VARINT>,
+        CppCommon::BinaryField<&Trade::symbol>,
+        CppCommon::BinaryField<&Trade::price, CppCommon::BinaryEncoding::VARINT>,
+        CppCommon::BinaryField<&Trade::quantity>> fields;
+};
+
+int main(int argc, char** argv)
+{
+    // Serialize trades into the file
+    {
+        CppCommon::File file("example.bin");
+        file.OpenOrCreate(false, true, true);
+        CppCommon::BufferedWriter writer(file);
+
+        CppCommon::BinarySerializer::Serialize(Trade{ 1, "EUR/USD", 108250, 100 }, writer);
+        CppCommon::BinarySerializer::Serialize(Trade{ 2, "GBP/USD", 126410, 250 }, writer);
+
+        writer.Flush();
+        file.Close();
+    }
+
+    // Deserialize trades from the file content without copying symbols
+    std::vector<uint8_t> content = CppCommon::File::ReadAllBytes("example.bin");
+    std::span<const uint8_t> input(content);
+    while (!input.empty())
+    {
+        Trade trade;
+        size_t size = CppCommon::BinarySerializer::Deserialize(input, trade);
+        if (size == 0)
+            break;
+        std::cout << "Trade " << trade.id << ": " << trade.symbol << " " << trade.quantity << " @ " << trade.price << std::endl;
+        input = input.subspan(size);
+    }
+
+    CppCommon::File::Remove("example.bin");
+
+    return 0;
+}
@@ -0,0 +1,53 @@
+/*!
+    \file common_compression.cpp
+    \brief Compressing writer and decompressing reader example
+    \author Ivan Shynkarenka
+    \date 15.10.2026
+    \copyright MIT License
+*/
+
+#include "common/compressing_writer.h"
+#include "common/decompressing_reader.h"
+#include "filesystem/file.h"
+#include "threads/thread_pool.h"
+
+#include <iostream>
+#include <string>
+
+int main(int argc, char** argv)
+{
+    CppCommon::ThreadPool pool;
+
+    // Write the compressed file with blocks compressed in the thread pool
+    {
+        CppCommon::File file("example.lz4");
+        file.Create(false, true);
+
+        CppCommon::CompressingWriter writer(file, CppCommon::CompressingWriter::DEFAULT_BLOCK, &pool);
+        for (int i = 0; i < 100000; ++i)
+            writer.Write("Line " + std::to_string(i) + " of the compressed file\n");
+        writer.Finish();
+
+        std::cout << "Written bytes: " << writer.total() << std::endl;
+        std::cout << "Compressed bytes: " << writer.compressed() << std::endl;
+
+        file.Close();
+    }
+
+    // Read the compressed file (could be also decompressed with 'lz4 -d example.lz4')
+    {
+        CppCommon::File file("example.lz4");
+        file.Open(true, false);
+
+        CppCommon::DecompressingReader reader(file);
+        std::string text = reader.ReadAllText();
+        std::cout << "Read bytes: " << text.size() << std::endl;
+        std::cout << "Last line: " << text.substr(text.rfind('\n', text.size() - 2) + 1);
+
+        file.Close();
+    }
+
+    CppCommon::File::Remove("example.lz4");
+
+    return 0;
+}
@@ -0,0 +1,46 @@
+/*!
+    \file common_line_reader.cpp
+    \brief Streaming line reader example
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "common/line_reader.h"
+#include "filesystem/file.h"
+#include "filesystem/mapped_file.h"
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+int main(int argc, char** argv)
+{
+    CppCommon::File::WriteAllText("example.csv", "name,price\napple,1.20\nbanana,0.50\ncherry,4.75\n");
+
+    // Read CSV records from the file stream
+    {
+        CppCommon::File file("example.csv");
+        file.Open(true, false);
+
+        CppCommon::LineReader reader(file);
+        std::vector<std::string_view> fields;
+        while (reader.ReadRecord(fields, ','))
+            std::cout << "Record: " << fields[0] << " = " << fields[1] << std::endl;
+
+        file.Close();
+    }
+
+    // Read lines from the memory-mapped file without copying
+    {
+        CppCommon::MappedFile file("example.csv");
+
+        CppCommon::LineReader reader(file.view());
+        for (auto line : reader)
+            std::cout << "Line " << reader.lines() << ": " << line << std::endl;
+    }
+
+    CppCommon::File::Remove("example.csv");
+
+    return 0;
+}
@@ -0,0 +1,39 @@
+/*!
+    \file containers_arena_map.cpp
+    \brief Arena hash map and flat map containers example
+    \author Ivan Shynkarenka
+    \date 15.10.2026
+    \copyright MIT License
+*/
+
+#include "containers/arena_map.h"
+
+#include <iostream>
+
+int main(int argc, char** argv)
+{
+    CppCommon::DefaultMemoryManager auxiliary;
+    CppCommon::ArenaMemoryManager<CppCommon::DefaultMemoryManager> arena(auxiliary);
+
+    // Process requests with scratch maps allocated from the arena
+    for (int request = 0; request < 3; ++request)
+    {
+        {
+            auto counters = CppCommon::MakeArenaHashMap<int, int>(arena, 16, -1);
+            auto ordered = CppCommon::MakeArenaFlatMap<int, int>(arena);
+
+            for (int i = 0; i < 100; ++i)
+            {
+                ++counters[i % 10];
+                ordered[100 - i] = i;
+            }
+
+            std::cout << "Request " << request << ": counters = " << counters.size() << ", first ordered key = " << ordered.begin()->first << ", arena allocated = " << arena.allocated() << std::endl;
+        }
+
+        // Drop all request memory at once
+        arena.reset();
+    }
+
+    return 0;
+}
@@ -0,0 +1,28 @@
+/*!
+    \file containers_bloom_filter.cpp
+    \brief Bloom filter container example
+    \author Ivan Shynkarenka
+    \date 15.10.2026
+    \copyright MIT License
+*/
+
+#include "containers/bloom_filter.h"
+
+#include <iostream>
+#include <string>
+
+int main(int argc, char** argv)
+{
+    CppCommon::BloomFilter filter(1000, 0.01);
+
+    filter.Add(std::string("item1"));
+    filter.Add(std::string("item2"));
+    filter.Add(std::string("item3"));
+
+    std::cout << "Bloom filter size: " << filter.bytes() << " bytes" << std::endl;
+    std::cout << "item1: " << (filter.Contains(std::string("item1")) ? "possibly added" : "not added") << std::endl;
+    std::cout << "item2: " << (filter.Contains(std::string("item2")) ? "possibly added" : "not added") << std::endl;
+    std::cout << "item9: " << (filter.Contains(std::string("item9")) ? "possibly added" : "not added") << std::endl;
+
+    return 0;
+}
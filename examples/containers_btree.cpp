@@ -0,0 +1,35 @@
+/*!
+    \file containers_btree.cpp
+    \brief B+ tree container example
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "containers/btree.h"
+
+#include <iostream>
+
+int main(int argc, char** argv)
+{
+    CppCommon::BTree<int> btree;
+
+    btree.insert(6);
+    btree.insert(3);
+    btree.insert(7);
+    btree.insert(2);
+    btree.insert(8);
+    btree.insert(1);
+    btree.insert(4);
+    btree.insert(9);
+    btree.insert(5);
+
+    std::cout << "btree:" << std::endl;
+    for (const auto& item : btree)
+        std::cout << item << std::endl;
+
+    std::cout << "btree.lower_bound(5): " << *btree.lower_bound(5) << std::endl;
+    std::cout << "btree.upper_bound(5): " << *btree.upper_bound(5) << std::endl;
+
+    return 0;
+}
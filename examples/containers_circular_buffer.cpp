@@ -0,0 +1,34 @@
+/*!
+    \file containers_circular_buffer.cpp
+    \brief Circular buffer container example
+    \author Ivan Shynkarenka
+    \date 15.10.2026
+    \copyright MIT License
+*/
+
+#include "containers/circular_buffer.h"
+
+#include <iostream>
+#include <numeric>
+
+int main(int argc, char** argv)
+{
+    // Sliding window of the last 8 prices
+    CppCommon::CircularBuffer<double> window(8, true);
+
+    for (int i = 0; i < 20; ++i)
+    {
+        window.push_back(100.0 + (i % 5));
+
+        // Sum both contiguous parts of the window
+        auto spans = window.as_spans();
+        double sum = std::accumulate(spans.first.begin(), spans.first.end(), 0.0) + std::accumulate(spans.second.begin(), spans.second.end(), 0.0);
+        std::cout << "tick " << i << ": size=" << window.size() << " average=" << (sum / window.size()) << std::endl;
+    }
+
+    std::cout << "window:";
+    for (auto price : window)
+        std::cout << " " << price;
+    std::cout << std::endl;
+    return 0;
+}
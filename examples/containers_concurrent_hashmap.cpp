@@ -0,0 +1,40 @@
+/*!
+    \file containers_concurrent_hashmap.cpp
+    \brief Concurrent hash map container example
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "containers/concurrent_hashmap.h"
+
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+int main(int argc, char** argv)
+{
+    CppCommon::ConcurrentHashMap<std::string, int> hashmap;
+
+    // Fill the concurrent hash map from several threads
+    std::vector<std::thread> threads;
+    for (int thread = 0; thread < 3; ++thread)
+    {
+        threads.emplace_back([&hashmap, thread]()
+        {
+            for (int i = 0; i < 3; ++i)
+                hashmap.insert_or_assign("item" + std::to_string(thread * 3 + i + 1), thread * 3 + i + 1);
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+
+    // Increment the value under the shard lock
+    hashmap.visit("item5", [](int& value) { value *= 10; });
+
+    std::cout << "hashmap:" << std::endl;
+    hashmap.visit_all([](const std::string& key, int value) { std::cout << key << " => " << value << std::endl; });
+
+    return 0;
+}
@@ -0,0 +1,65 @@
+/*!
+    \file containers_concurrent_queue.cpp
+    \brief Intrusive lock-free multiple producers / single consumer concurrent queue container example
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "containers/concurrent_queue.h"
+
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+struct MyQueueNode : public CppCommon::ConcurrentQueue<MyQueueNode>::Node
+{
+    int value;
+
+    explicit MyQueueNode(int v) : value(v) {}
+};
+
+int main(int argc, char** argv)
+{
+    std::cout << "Please enter some integer numbers. Enter '0' to exit..." << std::endl;
+
+    // Create intrusive multiple producers / single consumer concurrent queue
+    CppCommon::ConcurrentQueue<MyQueueNode> queue;
+
+    // Start consumer thread
+    auto consumer = std::thread([&queue]()
+    {
+        MyQueueNode* item;
+
+        do
+        {
+            // Pop using yield waiting strategy
+            while ((item = queue.pop()) == nullptr)
+                std::this_thread::yield();
+
+            // Consume the item
+            std::cout << "Your entered number: " << item->value << std::endl;
+        } while (item->value != 0);
+    });
+
+    // Items must stay alive while they are in the queue
+    std::vector<MyQueueNode> items;
+    items.reserve(1024);
+
+    // Perform text input
+    std::string line;
+    while (getline(std::cin, line) && (items.size() < items.capacity()))
+    {
+        items.emplace_back(std::stoi(line));
+        queue.push(items.back());
+
+        if (items.back().value == 0)
+            break;
+    }
+
+    // Wait for the consumer thread
+    consumer.join();
+
+    return 0;
+}
@@ -0,0 +1,47 @@
+/*!
+    \file containers_concurrent_skiplist.cpp
+    \brief Concurrent lock-free skip list container example
+    \author Ivan Shynkarenka
+    \date 15.10.2026
+    \copyright MIT License
+*/
+
+#include "containers/concurrent_skiplist.h"
+
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+int main(int argc, char** argv)
+{
+    // Price levels of the order book ordered by the price
+    CppCommon::ConcurrentSkipList<int, std::string> book;
+
+    // Fill the concurrent skip list from several threads
+    std::vector<std::thread> threads;
+    for (int thread = 0; thread < 3; ++thread)
+    {
+        threads.emplace_back([&book, thread]()
+        {
+            for (int i = 0; i < 3; ++i)
+            {
+                int price = 100 + i * 3 + thread;
+                book.insert(price, "level" + std::to_string(price));
+            }
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+
+    book.erase(104);
+
+    std::pair<int, std::string> best;
+    if (book.lower_bound(103, best))
+        std::cout << "lower_bound(103) => " << best.first << " " << best.second << std::endl;
+
+    std::cout << "range [102, 107):" << std::endl;
+    book.visit_range(102, 107, [](int price, const std::string& level) { std::cout << price << " => " << level << std::endl; });
+
+    return 0;
+}
@@ -0,0 +1,44 @@
+/*!
+    \file containers_concurrent_stack.cpp
+    \brief Intrusive lock-free concurrent stack container example
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "containers/concurrent_stack.h"
+
+#include <iostream>
+#include <thread>
+
+struct MyStackNode : public CppCommon::ConcurrentStack<MyStackNode>::Node
+{
+    int value;
+
+    explicit MyStackNode(int v) : value(v) {}
+};
+
+int main(int argc, char** argv)
+{
+    CppCommon::ConcurrentStack<MyStackNode> stack;
+
+    MyStackNode item1(123);
+    MyStackNode item2(456);
+    MyStackNode item3(789);
+
+    // Push items from the producer thread
+    auto producer = std::thread([&]()
+    {
+        stack.push(item1);
+        stack.push(item2);
+        stack.push(item3);
+    });
+    producer.join();
+
+    // Pop all items into the single-threaded stack
+    CppCommon::Stack<MyStackNode> local = stack.pop_all();
+    while (local)
+        std::cout << "stack.pop() = " << local.pop()->value << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,29 @@
+/*!
+    \file containers_cuckoo_filter.cpp
+    \brief Cuckoo filter container example
+    \author Ivan Shynkarenka
+    \date 15.10.2026
+    \copyright MIT License
+*/
+
+#include "containers/cuckoo_filter.h"
+
+#include <iostream>
+#include <string>
+
+int main(int argc, char** argv)
+{
+    CppCommon::CuckooFilter filter(1000);
+
+    filter.Add(std::string("item1"));
+    filter.Add(std::string("item2"));
+    filter.Add(std::string("item3"));
+    filter.Remove(std::string("item2"));
+
+    std::cout << "Cuckoo filter size: " << filter.bytes() << " bytes" << std::endl;
+    std::cout << "item1: " << (filter.Contains(std::string("item1")) ? "possibly added" : "not added") << std::endl;
+    std::cout << "item2: " << (filter.Contains(std::string("item2")) ? "possibly added" : "not added") << std::endl;
+    std::cout << "item9: " << (filter.Contains(std::string("item9")) ? "possibly added" : "not added") << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,58 @@
+/*!
+    \file containers_hashset.cpp
+    \brief Intrusive hash set container example
+    \author Ivan Shynkarenka
+    \date 15.10.2026
+    \copyright MIT License
+*/
+
+#include "containers/hashset.h"
+
+#include <iostream>
+#include <string>
+
+struct MyHashSetNode : public CppCommon::HashSetNode<MyHashSetNode>
+{
+    int id;
+    std::string name;
+
+    MyHashSetNode(int i, const std::string& n) : id(i), name(n) {}
+};
+
+struct MyHashSetHash
+{
+    size_t operator()(int id) const noexcept { return (size_t)id; }
+    size_t operator()(const MyHashSetNode& node) const noexcept { return (size_t)node.id; }
+};
+
+struct MyHashSetEqual
+{
+    bool operator()(const MyHashSetNode& node, int id) const noexcept { return node.id == id; }
+    bool operator()(const MyHashSetNode& node1, const MyHashSetNode& node2) const noexcept { return node1.id == node2.id; }
+};
+
+int main(int argc, char** argv)
+{
+    MyHashSetNode* buckets[4];
+    CppCommon::HashSet<MyHashSetNode, MyHashSetHash, MyHashSetEqual> hashset(buckets, 4);
+
+    MyHashSetNode item1(1, "one");
+    MyHashSetNode item2(2, "two");
+    MyHashSetNode item3(3, "three");
+
+    hashset.insert(item1);
+    hashset.insert(item2);
+    hashset.insert(item3);
+
+    // Grow the hash set into the larger bucket array
+    MyHashSetNode* larger[16];
+    hashset.rehash(larger, 16);
+    hashset.migrate();
+
+    std::cout << "hashset.find(2) = " << hashset.find(2)->name << std::endl;
+
+    for (const auto& item : hashset)
+        std::cout << item.id << " = " << item.name << std::endl;
+
+    return 0;
+}
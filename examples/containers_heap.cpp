@@ -0,0 +1,42 @@
+/*!
+    \file containers_heap.cpp
+    \brief Intrusive bounded d-ary heap container example
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "containers/heap.h"
+
+#include <iostream>
+
+struct MyHeapNode : public CppCommon::Heap<MyHeapNode>::Node
+{
+    int value;
+
+    explicit MyHeapNode(int v) : value(v) {}
+    friend bool operator<(const MyHeapNode& node1, const MyHeapNode& node2)
+    { return node1.value < node2.value; }
+};
+
+int main(int argc, char** argv)
+{
+    CppCommon::Heap<MyHeapNode> heap(16);
+
+    MyHeapNode item1(456);
+    MyHeapNode item2(123);
+    MyHeapNode item3(789);
+
+    heap.push(item1);
+    heap.push(item2);
+    heap.push(item3);
+
+    // Decrease the key of the item
+    item3.value = 100;
+    heap.update(item3);
+
+    while (heap)
+        std::cout << "heap.pop() = " << heap.pop()->value << std::endl;
+
+    return 0;
+}
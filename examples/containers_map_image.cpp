@@ -0,0 +1,42 @@
+/*!
+    \file containers_map_image.cpp
+    \brief Hash map and flat map persistent image containers example
+    \author Ivan Shynkarenka
+    \date 15.10.2026
+    \copyright MIT License
+*/
+
+#include "containers/hashmap.h"
+#include "containers/map_image.h"
+
+#include <iostream>
+
+int main(int argc, char** argv)
+{
+    // Build the hash map and save its image into the file
+    CppCommon::HashMap<int, double> prices(128, -1);
+    prices[1] = 1.0825;
+    prices[2] = 1.2710;
+    prices[3] = 151.32;
+    CppCommon::HashMapImage<int, double>::Save("prices.image", prices);
+
+    // Warm restart: map the image file and query it in place
+    {
+        CppCommon::MappedFile file("prices.image");
+        CppCommon::HashMapImage<int, double> image(file.data(), file.size());
+
+        std::cout << "Image size: " << image.size() << std::endl;
+        for (const auto& item : image)
+            std::cout << item.first << " => " << item.second << std::endl;
+        std::cout << "Price of 2: " << image.at(2) << std::endl;
+        std::cout << "Price of 4: " << image.value(4, 0.0) << std::endl;
+    }
+
+    // Load the image with a single bulk read
+    auto loaded = CppCommon::HashMapImage<int, double>::Load("prices.image");
+    std::cout << "Loaded price of 3: " << loaded[3] << std::endl;
+
+    CppCommon::File::Remove("prices.image");
+
+    return 0;
+}
@@ -0,0 +1,41 @@
+/*!
+    \file containers_roaring_bitmap.cpp
+    \brief Roaring bitmap container example
+    \author Ivan Shynkarenka
+    \date 15.10.2026
+    \copyright MIT License
+*/
+
+#include "containers/roaring_bitmap.h"
+
+#include <iostream>
+
+int main(int argc, char** argv)
+{
+    CppCommon::RoaringBitmap active;
+    CppCommon::RoaringBitmap premium;
+
+    // Active users are clustered, premium users are sparse
+    for (uint64_t id = 1000; id < 200000; ++id)
+        active.insert(id);
+    for (uint64_t id = 0; id < 1000000; id += 97)
+        premium.insert(id);
+    active.optimize();
+
+    CppCommon::RoaringBitmap result = active & premium;
+
+    std::cout << "Active users: " << active.size() << " (" << active.bytes() << " bytes)" << std::endl;
+    std::cout << "Premium users: " << premium.size() << " (" << premium.bytes() << " bytes)" << std::endl;
+    std::cout << "Active premium users: " << result.size() << std::endl;
+    std::cout << "First active premium users:";
+    int count = 0;
+    for (auto id : result)
+    {
+        if (++count > 5)
+            break;
+        std::cout << " " << id;
+    }
+    std::cout << std::endl;
+
+    return 0;
+}
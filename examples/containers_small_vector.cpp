@@ -0,0 +1,35 @@
+/*!
+    \file containers_small_vector.cpp
+    \brief Small vector container example
+    \author Ivan Shynkarenka
+    \date 15.10.2026
+    \copyright MIT License
+*/
+
+#include "containers/inplace_vector.h"
+#include "containers/small_vector.h"
+#include "string/static_string.h"
+
+#include <iostream>
+
+int main(int argc, char** argv)
+{
+    CppCommon::SmallVector<int, 4> small;
+    for (int i = 0; i < 6; ++i)
+    {
+        small.push_back(i);
+        std::cout << "small: size=" << small.size() << " capacity=" << small.capacity() << " inlined=" << small.inlined() << std::endl;
+    }
+
+    CppCommon::InplaceVector<CppCommon::StaticString<15>, 3> names;
+    names.push_back("first");
+    names.push_back("second");
+    names.push_back("third");
+    if (names.try_push_back("fourth") == nullptr)
+        std::cout << "names: inplace vector is full" << std::endl;
+
+    for (const auto& name : names)
+        std::cout << "name: " << name << std::endl;
+
+    return 0;
+}
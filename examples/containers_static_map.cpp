@@ -0,0 +1,30 @@
+/*!
+    \file containers_static_map.cpp
+    \brief Static map container example
+    \author Ivan Shynkarenka
+    \date 15.10.2026
+    \copyright MIT License
+*/
+
+#include "containers/static_map.h"
+
+#include <iostream>
+
+// Perfect hash function of the static map is built at compile time
+static constexpr auto methods = CppCommon::MakeStaticMap<std::string_view, int>({
+    { "GET", 1 }, { "HEAD", 2 }, { "POST", 3 }, { "PUT", 4 }, { "DELETE", 5 }
+});
+
+static_assert(methods.at("POST") == 3, "Static map lookup is constexpr!");
+
+int main(int argc, char** argv)
+{
+    std::cout << "methods:" << std::endl;
+    for (const auto& item : methods)
+        std::cout << item.first << " => " << item.second << std::endl;
+
+    for (auto method : { "PUT", "PATCH" })
+        std::cout << method << (methods.contains(method) ? " is found" : " is not found") << std::endl;
+
+    return 0;
+}
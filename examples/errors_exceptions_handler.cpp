@@ -225,9 +225,14 @@ int main(int argc, char** argv)
 {
     // Generate all exceptions from separate thread
     const bool thread = true;
+    // Write async-signal-safe crash reports into the standard error output
+    const bool emergency = false;
 
     // Initialize stack trace manager of the current process
     CppCommon::StackTraceManager::Initialize();
+    // Setup emergency crash reporting mode of the current process
+    if (emergency)
+        CppCommon::ExceptionsHandler::SetupEmergency();
     // Setup exceptions handler for the current process
     CppCommon::ExceptionsHandler::SetupProcess();
 
@@ -0,0 +1,57 @@
+/*!
+    \file filesystem_async_file.cpp
+    \brief Filesystem asynchronous file example
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "filesystem/async_file.h"
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+int main(int argc, char** argv)
+{
+    std::vector<std::string> records = { "The quick brown fox ", "jumps over ", "the lazy dog" };
+
+    // Open the asynchronous file for writing and reading
+    CppCommon::AsyncFile file("example.txt");
+    file.OpenOrCreate(true, true, true);
+
+    // Queue record writes followed by the flush
+    uint64_t offset = 0;
+    for (const auto& record : records)
+    {
+        file.WriteAsync(offset, record.data(), record.size(), [](const CppCommon::AsyncFileResult& result)
+        {
+            std::cout << "Record written: offset = " << result.offset << ", size = " << result.size << std::endl;
+        });
+        offset += record.size();
+    }
+    file.FlushAsync([](const CppCommon::AsyncFileResult& result)
+    {
+        std::cout << "File flushed: " << (result ? "success" : "failure") << std::endl;
+    });
+
+    // Submit all queued operations in one batch and wait for their completion
+    file.Submit();
+    file.WaitAll();
+
+    // Read the whole file content back
+    std::string content(offset, 0);
+    file.ReadAsync(0, content.data(), content.size(), [&content](const CppCommon::AsyncFileResult& result)
+    {
+        content.resize(result.size);
+    });
+    file.WaitAll();
+
+    std::cout << "File content: " << content << std::endl;
+
+    // Close and remove the file
+    file.Close();
+    CppCommon::File::Remove(file.path());
+
+    return 0;
+}
@@ -0,0 +1,52 @@
+/*!
+    \file filesystem_async_logger.cpp
+    \brief Filesystem asynchronous logger example
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "filesystem/filesystem.h"
+
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+int main(int argc, char** argv)
+{
+    CppCommon::Path path("example.log");
+    {
+        // Rotate the log file every 1 MiB and keep 3 backups
+        CppCommon::AsyncLogger logger(path, 1024 * 1024, 3);
+
+        logger.Info("Application started");
+
+        std::vector<std::thread> threads;
+        for (int thread = 0; thread < 4; ++thread)
+        {
+            threads.emplace_back([&logger, thread]()
+            {
+                std::string name = "worker-" + std::to_string(thread);
+                for (int i = 0; i < 10; ++i)
+                    logger.Debug("{} processed item {} with price {:.2f}", name, i, 1.08 + i / 100.0);
+            });
+        }
+        for (auto& thread : threads)
+            thread.join();
+
+        logger.Warn("Application stopped");
+
+        // Wait for all messages to be written
+        logger.Flush();
+        std::cout << "Logged messages: " << logger.logged() << std::endl;
+        std::cout << "Dropped messages: " << logger.dropped() << std::endl;
+    }
+
+    // Show the log file
+    for (const auto& line : CppCommon::File::ReadAllLines(path))
+        std::cout << line << std::endl;
+
+    CppCommon::File::Remove(path);
+    return 0;
+}
@@ -0,0 +1,43 @@
+/*!
+    \file filesystem_directory_walker.cpp
+    \brief Filesystem parallel directory walker example
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "filesystem/directory_walker.h"
+
+#include <atomic>
+#include <iostream>
+
+int main(int argc, char** argv)
+{
+    CppCommon::Path root = (argc > 1) ? CppCommon::Path(argv[1]) : CppCommon::Path::current();
+
+    std::atomic<uint64_t> files(0);
+    std::atomic<uint64_t> directories(0);
+    std::atomic<uint64_t> symlinks(0);
+
+    // Count entries of the directory tree with all logical processors
+    CppCommon::DirectoryWalker walker;
+    uint64_t entries = walker.Walk(root, [&](const CppCommon::Path& path, CppCommon::FileType type)
+    {
+        if (type == CppCommon::FileType::DIRECTORY)
+            ++directories;
+        else if (type == CppCommon::FileType::SYMLINK)
+            ++symlinks;
+        else
+            ++files;
+        return true;
+    });
+
+    std::cout << "Root: " << root << std::endl;
+    std::cout << "Walker threads: " << walker.threads() << std::endl;
+    std::cout << "Entries: " << entries << std::endl;
+    std::cout << "Directories: " << directories << std::endl;
+    std::cout << "Files: " << files << std::endl;
+    std::cout << "Symlinks: " << symlinks << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,56 @@
+/*!
+    \file filesystem_journal.cpp
+    \brief Filesystem group commit journal example
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "filesystem/file.h"
+#include "filesystem/journal.h"
+
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+int main(int argc, char** argv)
+{
+    const int producers = 4;
+    const int records = 100;
+
+    {
+        CppCommon::Journal journal("example.journal");
+        journal.Open();
+
+        // Append records from several producer threads
+        std::vector<std::thread> threads;
+        for (int producer = 0; producer < producers; ++producer)
+        {
+            threads.emplace_back([&journal, producer]()
+            {
+                for (int i = 0; i < records; ++i)
+                    journal.Append("Producer " + std::to_string(producer) + " record " + std::to_string(i));
+            });
+        }
+        for (auto& thread : threads)
+            thread.join();
+
+        std::cout << "Durable records: " << journal.records() << std::endl;
+        std::cout << "Group commits: " << journal.commits() << std::endl;
+        std::cout << "Journal size: " << journal.size() << std::endl;
+
+        journal.Close();
+    }
+
+    // Read the first records back
+    CppCommon::Journal::Read("example.journal", [](uint64_t offset, const uint8_t* data, size_t size)
+    {
+        std::cout << offset << ": " << std::string((const char*)data, size) << std::endl;
+        return (offset < 200);
+    });
+
+    CppCommon::File::Remove("example.journal");
+
+    return 0;
+}
@@ -0,0 +1,39 @@
+/*!
+    \file filesystem_mapped_file.cpp
+    \brief Filesystem memory-mapped file example
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "filesystem/file.h"
+#include "filesystem/mapped_file.h"
+
+#include <cstring>
+#include <iostream>
+
+int main(int argc, char** argv)
+{
+    const char buffer[] = "The quick brown fox jumps over the lazy dog";
+
+    {
+        // Create the read-write mapped file and write the buffer into its content
+        CppCommon::MappedFile file("example.txt", CppCommon::MappedFileMode::READ_WRITE, sizeof(buffer) - 1);
+        std::memcpy(file.mutable_data(), buffer, sizeof(buffer) - 1);
+
+        // Flush the mapped content into the file
+        file.Flush();
+    }
+
+    // Map the file for sequential reading
+    CppCommon::MappedFile file("example.txt");
+    file.Advise(CppCommon::FileAdvice::SEQUENTIAL);
+
+    std::cout << "Mapped file size: " << file.size() << std::endl;
+    std::cout << "Mapped file content: " << file.view() << std::endl;
+
+    // Remove file
+    CppCommon::File::Remove(file.path());
+
+    return 0;
+}
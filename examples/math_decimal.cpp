@@ -0,0 +1,35 @@
+/*!
+    \file math_decimal.cpp
+    \brief Fixed-point decimal example
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "math/decimal.h"
+
+#include <cstring>
+#include <iostream>
+
+int main(int argc, char** argv)
+{
+    typedef CppCommon::Decimal<8> Price;
+
+    // Parse price and quantity without allocations
+    const char* text = "65000.12345678";
+    Price price;
+    Price::from_chars(text, text + std::strlen(text), price);
+    Price quantity(3);
+
+    std::cout << "Price: " << price << std::endl;
+    std::cout << "Quantity: " << quantity << std::endl;
+    std::cout << "Notional: " << price * quantity << std::endl;
+    std::cout << "Average: " << Price::MulDiv(price, quantity, Price(7)) << std::endl;
+
+    // Round the price to the tick size
+    std::cout << "Rounded (HALF_EVEN): " << price.Round(2) << std::endl;
+    std::cout << "Rounded (FLOOR): " << price.Round(2, CppCommon::RoundingMode::FLOOR) << std::endl;
+    std::cout << "Rescaled: " << price.Rescale<4>(CppCommon::RoundingMode::HALF_UP) << std::endl;
+
+    return 0;
+}
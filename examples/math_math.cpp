@@ -9,6 +9,7 @@
 #include "math/math.h"
 
 #include <iostream>
+#include <vector>
 
 int main(int argc, char** argv)
 {
@@ -16,5 +17,11 @@ int main(int argc, char** argv)
     uint64_t b = 6132198419878046132;
     uint64_t c = 9156498145135109843;
     std::cout << "Math::MulDiv64(" << a << " * " << b << " / " << c << ") = " << CppCommon::Math::MulDiv64(a, b, c) << std::endl;
+
+    std::vector<double> prices = { 101.5, 101.7, 101.6, 101.9, 102.0 };
+    std::vector<double> volumes = { 300, 100, 200, 500, 400 };
+    auto moments = CppCommon::Math::MeanVariance(prices);
+    std::cout << "Mean price: " << moments.mean << ", variance: " << moments.variance << std::endl;
+    std::cout << "VWAP: " << CppCommon::Math::WeightedAverage(prices, volumes) << std::endl;
     return 0;
 }
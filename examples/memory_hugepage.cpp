@@ -0,0 +1,35 @@
+/*!
+    \file memory_hugepage.cpp
+    \brief Huge page memory allocator example
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "memory/allocator_arena.h"
+#include "memory/allocator_hugepage.h"
+
+#include <iostream>
+
+int main(int argc, char** argv)
+{
+    // Bind huge pages to the first NUMA node
+    CppCommon::HugePageMemoryManager auxiliary(CppCommon::HugePageMemoryManager::HUGE_PAGE_2MB, 0);
+
+    // Arena page capacity is a bit less than the huge page size to fit the page header
+    CppCommon::ArenaMemoryManager<CppCommon::HugePageMemoryManager> manger(auxiliary, CppCommon::HugePageMemoryManager::HUGE_PAGE_2MB - 1024);
+    CppCommon::ArenaAllocator<int, CppCommon::HugePageMemoryManager> alloc(manger);
+
+    int* a = alloc.CreateArray(3, 123);
+    std::cout << "a[0] = " << a[0] << std::endl;
+    std::cout << "a[1] = " << a[1] << std::endl;
+    std::cout << "a[2] = " << a[2] << std::endl;
+    alloc.ReleaseArray(a);
+
+    std::cout << "Huge pages allocated: " << auxiliary.allocated() << std::endl;
+    std::cout << "Ordinary pages fallbacks: " << auxiliary.fallbacks() << std::endl;
+
+    manger.reset();
+
+    return 0;
+}
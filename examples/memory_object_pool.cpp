@@ -0,0 +1,45 @@
+/*!
+    \file memory_object_pool.cpp
+    \brief Lock-free object pool example
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "memory/object_pool.h"
+
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+struct Message
+{
+    int id;
+    std::string text;
+
+    Message(int i, const std::string& t) : id(i), text(t) {}
+};
+
+int main(int argc, char** argv)
+{
+    CppCommon::DefaultMemoryManager auxiliary;
+    CppCommon::ObjectPool<Message> pool(auxiliary);
+
+    // Create messages in the current thread
+    std::vector<Message*> messages;
+    for (int i = 0; i < 3; ++i)
+        messages.push_back(pool.Create(i, "message " + std::to_string(i)));
+
+    // Release messages in another thread
+    std::thread([&pool, &messages]()
+    {
+        for (auto message : messages)
+            std::cout << "Release " << message->id << ": " << message->text << std::endl;
+        pool.Release(messages.begin(), messages.end());
+    }).join();
+
+    std::cout << "Object pool capacity: " << pool.capacity() << std::endl;
+
+    return 0;
+}
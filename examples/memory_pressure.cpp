@@ -0,0 +1,49 @@
+/*!
+    \file memory_pressure.cpp
+    \brief Memory pressure notifier example
+    \author Ivan Shynkarenka
+    \date 15.10.2026
+    \copyright MIT License
+*/
+
+#include "cache/memcache.h"
+#include "memory/memory.h"
+#include "memory/memory_pressure.h"
+
+#include <iostream>
+#include <string>
+
+int main(int argc, char** argv)
+{
+    std::cout << "RAM total: " << CppCommon::Memory::RamTotal() << std::endl;
+    std::cout << "Cgroup limit: " << CppCommon::Memory::CgroupLimit() << std::endl;
+    std::cout << "Cgroup usage: " << CppCommon::Memory::CgroupUsage() << std::endl;
+
+    CppCommon::MemoryUsage usage = CppCommon::MemoryUsage::Current();
+    std::cout << "Memory usage: " << usage.usage << " of " << usage.limit << (usage.cgroup ? " (cgroup)" : " (host)") << std::endl;
+
+    // Notify with the usage over 80% of the limit
+    CppCommon::MemoryPressure pressure(0.8);
+    std::cout << "PSI trigger: " << (pressure.psi() ? "registered" : "not supported") << std::endl;
+
+    CppCommon::MemCache<int, std::string> cache(4);
+    for (int i = 0; i < 1000; ++i)
+        cache.insert(i, std::string(1024, 'x'));
+
+    // Shed a quarter of the cache on each memory pressure notification
+    cache.shrink_on_pressure(&pressure, 0.25);
+    pressure.Subscribe([](const CppCommon::MemoryUsage& usage)
+    {
+        std::cout << "Memory pressure! Usage ratio = " << usage.ratio() << std::endl;
+    });
+
+    pressure.Start();
+    std::cout << "Press Enter to stop..." << std::endl;
+    std::string line;
+    std::getline(std::cin, line);
+    pressure.Stop();
+
+    std::cout << "Cache size: " << cache.size() << std::endl;
+    cache.shrink_on_pressure(nullptr);
+    return 0;
+}
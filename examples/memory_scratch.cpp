@@ -0,0 +1,52 @@
+/*!
+    \file memory_scratch.cpp
+    \brief Thread-local scratch memory example
+    \author Ivan Shynkarenka
+    \date 15.10.2026
+    \copyright MIT License
+*/
+
+#include "memory/scratch.h"
+
+#include <iostream>
+#include <thread>
+
+// Hot function with temporaries allocated from the scratch stack of the current thread
+size_t Tokenize(const std::string& text)
+{
+    CppCommon::ScratchScope scope;
+
+    CppCommon::ScratchVector<CppCommon::ScratchString> tokens;
+    CppCommon::ScratchString token;
+    for (char ch : text)
+    {
+        if (ch == ' ')
+        {
+            if (!token.empty())
+                tokens.push_back(token);
+            token.clear();
+        }
+        else
+            token += ch;
+    }
+    if (!token.empty())
+        tokens.push_back(token);
+
+    return tokens.size();
+}
+
+int main(int argc, char** argv)
+{
+    // Configure the scratch stack capacity of new threads
+    CppCommon::Scratch::capacity(64 * 1024);
+
+    std::thread worker([]()
+    {
+        std::cout << "Tokens: " << Tokenize("scratch memory is released at the end of the scope") << std::endl;
+        std::cout << "Scratch capacity: " << CppCommon::Scratch::manager().capacity() << std::endl;
+        std::cout << "Scratch allocations: " << CppCommon::Scratch::manager().allocations() << std::endl;
+    });
+    worker.join();
+
+    return 0;
+}
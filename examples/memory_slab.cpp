@@ -0,0 +1,30 @@
+/*!
+    \file memory_slab.cpp
+    \brief Slab memory allocator example
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "memory/allocator_slab.h"
+
+#include <iostream>
+
+int main(int argc, char** argv)
+{
+    CppCommon::DefaultMemoryManager auxiliary;
+    CppCommon::SlabMemoryManager<CppCommon::DefaultMemoryManager> manger(auxiliary);
+    CppCommon::SlabAllocator<int, CppCommon::DefaultMemoryManager> alloc(manger);
+
+    int* v = alloc.Create(123);
+    std::cout << "v = " << *v << std::endl;
+    alloc.Release(v);
+
+    int* a = alloc.CreateArray(3, 123);
+    std::cout << "a[0] = " << a[0] << std::endl;
+    std::cout << "a[1] = " << a[1] << std::endl;
+    std::cout << "a[2] = " << a[2] << std::endl;
+    alloc.ReleaseArray(a);
+
+    return 0;
+}
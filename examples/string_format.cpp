@@ -7,6 +7,7 @@
 */
 
 #include "string/format.h"
+#include "string/formatter.h"
 
 #include <iostream>
 
@@ -57,5 +58,7 @@ int main(int argc, char** argv)
     SHOW(CppCommon::format("int: {0:d};  hex: {0:#x};  oct: {0:#o};  bin: {0:#b}", 42));
     SHOW(CppCommon::format("The date is {}", Date(2012, 12, 9)));
     SHOW(CppCommon::format("Elapsed time: {s:.2f} seconds", "s"_a = 1.23));
+    SHOW(CppCommon::format_compiled<"{:*^30}">("compiled"));
+    SHOW(CppCommon::Formatter("[{}] {:>10}").format("pattern", "from config"));
     return 0;
 }
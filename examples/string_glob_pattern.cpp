@@ -0,0 +1,26 @@
+/*!
+    \file string_glob_pattern.cpp
+    \brief Glob pattern example
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "string/glob_pattern.h"
+
+#include <iostream>
+
+int main(int argc, char** argv)
+{
+    CppCommon::GlobPattern pattern("*.txt;*.log");
+    std::cout << pattern.Match("readme.txt") << std::endl;
+    std::cout << pattern.Match("server.log") << std::endl;
+    std::cout << pattern.Match("image.png") << std::endl;
+
+    CppCommon::GlobPattern negative("!debug*;!*.tmp");
+    std::cout << negative.Match("debug.log") << std::endl;
+    std::cout << negative.Match("server.tmp") << std::endl;
+    std::cout << negative.Match("server.log") << std::endl;
+
+    return 0;
+}
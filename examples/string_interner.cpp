@@ -0,0 +1,28 @@
+/*!
+    \file string_interner.cpp
+    \brief String interner example
+    \author Ivan Shynkarenka
+    \date 15.10.2026
+    \copyright MIT License
+*/
+
+#include "string/string_interner.h"
+
+#include <iostream>
+
+int main(int argc, char** argv)
+{
+    CppCommon::StringInterner interner;
+
+    const char* words[] = { "GET", "POST", "GET", "PUT", "POST", "GET" };
+    for (auto word : words)
+    {
+        uint32_t id = interner.intern(word);
+        std::cout << word << " => " << id << " => " << interner[id] << std::endl;
+    }
+
+    std::cout << "Interned strings: " << interner.size() << std::endl;
+    std::cout << "Interned memory: " << interner.memory() << std::endl;
+
+    return 0;
+}
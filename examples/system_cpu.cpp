@@ -18,5 +18,21 @@ int main(int argc, char** argv)
     std::cout << "CPU physical cores: " << CppCommon::CPU::PhysicalCores() << std::endl;
     std::cout << "CPU clock speed: " << CppCommon::CPU::ClockSpeed() << " Hz" << std::endl;
     std::cout << "CPU Hyper-Threading: " << (CppCommon::CPU::HyperThreading() ? "enabled" : "disabled") << std::endl;
+    std::cout << "CPU features: " << CppCommon::CPU::Features() << std::endl;
+
+    // Show CPU topology
+    const CppCommon::CPUTopology& topology = CppCommon::CPU::Topology();
+    std::cout << "CPU topology: " << topology.sockets() << " sockets, " << topology.nodes() << " NUMA nodes, " << topology.cores() << " cores, " << topology.processors().size() << " logical processors" << std::endl;
+    for (const auto& processor : topology.processors())
+        std::cout << "CPU " << processor.cpu << ": core " << processor.core << ", socket " << processor.socket << ", node " << processor.node << ", SMT siblings " << topology.Domain(processor.cpu, CppCommon::CPUDomain::CORE).count() << std::endl;
+    for (const auto& cache : topology.caches())
+        std::cout << "CPU L" << cache.level << " cache: " << cache.size << " bytes, " << cache.line << " bytes line, shared by " << cache.cpus.count() << " logical processors" << std::endl;
+
+    // Show producer / consumer pairs sharing L3 cache
+    for (int node = 0; node < topology.nodes(); ++node)
+        std::cout << "NUMA node " << node << " CPUs: " << topology.NodeCPUs(node) << std::endl;
+    for (const auto& pair : topology.Pairs(CppCommon::CPUDomain::L3))
+        std::cout << "L3 pair: " << pair.first << " - " << pair.second << std::endl;
+
     return 0;
 }
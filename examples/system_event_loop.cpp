@@ -0,0 +1,68 @@
+/*!
+    \file system_event_loop.cpp
+    \brief Event loop example
+    \author Ivan Shynkarenka
+    \date 15.10.2026
+    \copyright MIT License
+*/
+
+#include "system/event_loop.h"
+#include "threads/thread.h"
+
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+int main(int argc, char** argv)
+{
+    const int processes = 4;
+
+    CppCommon::EventLoop loop;
+
+    // Execute child processes and read their output pipes from the single thread
+    std::vector<std::unique_ptr<CppCommon::Pipe>> pipes;
+    for (int i = 0; i < processes; ++i)
+    {
+        CppCommon::Pipe* pipe = pipes.emplace_back(std::make_unique<CppCommon::Pipe>()).get();
+#if defined(_WIN32) || defined(_WIN64)
+        std::vector<std::string> arguments = { "/c", "echo", "Hello from the child process " + std::to_string(i) };
+        CppCommon::Process process = CppCommon::Process::Execute("cmd.exe", &arguments, nullptr, nullptr, nullptr, pipe);
+#else
+        std::vector<std::string> arguments = { "-c", "echo Hello from the child process " + std::to_string(i) + "; exit " + std::to_string(i) };
+        CppCommon::Process process = CppCommon::Process::Execute("sh", &arguments, nullptr, nullptr, nullptr, pipe);
+#endif
+        pipe->SetBlocking(false);
+
+        loop.WatchRead(*pipe, [&loop, pipe](uint64_t id)
+        {
+            char buffer[1024];
+            size_t size = pipe->Read(buffer, sizeof(buffer));
+            if (size > 0)
+                std::cout << std::string(buffer, size);
+            else
+            {
+                // Ready pipe without data is closed by the child process
+                loop.Cancel(id);
+            }
+        });
+
+        loop.WatchProcess(process, [](uint64_t pid, int result)
+        {
+            std::cout << "Process " << pid << " exited with result " << result << std::endl;
+        });
+    }
+
+    // Show heartbeats every 100 milliseconds
+    for (int i = 1; i < 10; ++i)
+        loop.Schedule(CppCommon::Timespan::milliseconds(i * 100), [&loop]() { std::cout << "Heartbeat, watches left: " << loop.size() << std::endl; });
+
+    // Stop the event loop from another thread after one second
+    std::thread stopper([&loop]() { CppCommon::Thread::Sleep(1000); loop.Post([&loop]() { std::cout << "Stop the event loop" << std::endl; loop.Stop(); }); });
+
+    loop.Run();
+    stopper.join();
+
+    return 0;
+}
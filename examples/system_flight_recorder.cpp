@@ -0,0 +1,54 @@
+/*!
+    \file system_flight_recorder.cpp
+    \brief Flight recorder example
+    \author Ivan Shynkarenka
+    \date 15.10.2026
+    \copyright MIT License
+*/
+
+#include "system/flight_recorder.h"
+#include "threads/thread.h"
+#include "time/timestamp.h"
+
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+int main(int argc, char** argv)
+{
+    // Read events of the crashed process
+    if ((argc > 1) && (std::string(argv[1]) == "read"))
+    {
+        CppCommon::FlightRecorderReader reader("flight_recorder_example");
+        std::cout << "Process: " << reader.pid() << std::endl;
+        std::cout << "Dropped events: " << reader.dropped() << std::endl;
+        for (const auto& thread : reader.ReadThreads())
+            std::cout << "Thread " << thread.index << ": tid = " << thread.tid << ", name = " << thread.name << ", recorded = " << thread.recorded << std::endl;
+        for (const auto& event : reader.ReadEvents())
+            std::cout << CppCommon::UtcTimestamp(event.timestamp).nanoseconds() << " [" << event.tid << "] event " << event.id << ": " << event.data[0] << ", " << event.data[1] << std::endl;
+        return 0;
+    }
+
+    // Record events of the current process
+    CppCommon::FlightRecorder recorder("flight_recorder_example");
+    CppCommon::Thread::SetName("main");
+
+    // Show help message
+    std::cout << "Please enter anything to record into the flight recorder. Enter 'crash' to crash the process or '0' to exit..." << std::endl;
+    std::cout << "Run '" << argv[0] << " read' to read recorded events after the crash" << std::endl;
+
+    // Perform text input
+    uint32_t id = 0;
+    std::string line;
+    while (getline(std::cin, line))
+    {
+        if (line == "0")
+            break;
+        if (line == "crash")
+            std::abort();
+
+        recorder.Record(++id, line.size());
+    }
+
+    return 0;
+}
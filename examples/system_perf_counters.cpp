@@ -0,0 +1,43 @@
+/*!
+    \file system_perf_counters.cpp
+    \brief Hardware performance counters example
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "system/perf_counters.h"
+
+#include <iostream>
+#include <vector>
+
+int main(int argc, char** argv)
+{
+    CppCommon::PerfCounters counters;
+    if (!counters.IsAvailable())
+        std::cout << "Hardware performance counters are not available!" << std::endl;
+
+    // Measure the code region with random memory accesses
+    CppCommon::PerfSample sample;
+    std::vector<uint64_t> data(1 << 22, 1);
+    uint64_t crc = 0;
+    {
+        CppCommon::PerfRegion region(counters, sample);
+        uint64_t index = 0;
+        for (size_t i = 0; i < data.size(); ++i)
+        {
+            index = (index * 6364136223846793005ull + 1442695040888963407ull) % data.size();
+            crc += data[index];
+        }
+    }
+
+    std::cout << "CRC: " << crc << std::endl;
+    std::cout << "Cycles: " << sample.cycles() << std::endl;
+    std::cout << "Instructions: " << sample.instructions() << std::endl;
+    std::cout << "IPC: " << sample.ipc() << std::endl;
+    std::cout << "Cache references: " << sample.cache_references() << std::endl;
+    std::cout << "Cache misses: " << sample.cache_misses() << std::endl;
+    std::cout << "Branches: " << sample.branches() << std::endl;
+    std::cout << "Branch misses: " << sample.branch_misses() << std::endl;
+    return 0;
+}
@@ -0,0 +1,45 @@
+/*!
+    \file system_process_monitor.cpp
+    \brief Process monitor example
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "system/process_monitor.h"
+#include "threads/latch.h"
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+int main(int argc, char** argv)
+{
+    const int children = 8;
+
+    CppCommon::ProcessMonitor monitor;
+    CppCommon::Latch latch(children);
+
+    // Watch all child processes with the single monitor thread
+    monitor.Start();
+    for (int i = 0; i < children; ++i)
+    {
+#if defined(_WIN32) || defined(_WIN64)
+        std::vector<std::string> arguments = { "/c", "exit", std::to_string(i) };
+        CppCommon::Process child = CppCommon::Process::Execute("cmd.exe", &arguments);
+#else
+        std::vector<std::string> arguments = { "-c", "sleep 0.1; exit " + std::to_string(i) };
+        CppCommon::Process child = CppCommon::Process::Execute("sh", &arguments);
+#endif
+        monitor.Watch(child, [&latch](uint64_t pid, int result)
+        {
+            std::cout << "Child process " << pid << " exited! Result = " << result << std::endl;
+            latch.CountDown();
+        });
+    }
+
+    // Wait for all child processes to exit
+    latch.Wait();
+    monitor.Stop();
+    return 0;
+}
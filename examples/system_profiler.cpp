@@ -0,0 +1,52 @@
+/*!
+    \file system_profiler.cpp
+    \brief Sampling CPU profiler example
+    \author Ivan Shynkarenka
+    \date 15.10.2026
+    \copyright MIT License
+*/
+
+#include "system/profiler.h"
+#include "time/timestamp.h"
+
+#include <cmath>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+double Compute(uint64_t milliseconds)
+{
+    double result = 0.0;
+    uint64_t finish = CppCommon::Timestamp::nano() + milliseconds * 1000000;
+    for (int i = 1; CppCommon::Timestamp::nano() < finish; ++i)
+        result += std::sqrt((double)i);
+    return result;
+}
+
+int main(int argc, char** argv)
+{
+    if (!CppCommon::Profiler::IsSupported())
+    {
+        std::cout << "Sampling CPU profiler is not supported on this platform!" << std::endl;
+        return -1;
+    }
+
+    CppCommon::Profiler::Start(CppCommon::Timespan::milliseconds(1));
+
+    std::vector<std::thread> threads;
+    for (int thread = 0; thread < 4; ++thread)
+        threads.emplace_back([]() { Compute(500); });
+
+    for (auto& thread : threads)
+        thread.join();
+
+    CppCommon::Profiler::Stop();
+
+    // Render the flame graph with "flamegraph.pl profile.folded > profile.svg"
+    CppCommon::Profiler::WriteFolded("profile.folded");
+
+    std::cout << "Collected samples: " << CppCommon::Profiler::samples() << std::endl;
+    std::cout << "Dropped samples: " << CppCommon::Profiler::dropped() << std::endl;
+
+    return 0;
+}
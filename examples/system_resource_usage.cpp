@@ -0,0 +1,40 @@
+/*!
+    \file system_resource_usage.cpp
+    \brief Resource usage example
+    \author Ivan Shynkarenka
+    \date 15.10.2026
+    \copyright MIT License
+*/
+
+#include "system/resource_usage.h"
+#include "threads/thread.h"
+
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+int main(int argc, char** argv)
+{
+    CppCommon::ResourceUsageSampler sampler;
+
+    std::vector<std::vector<uint8_t>> memory;
+    for (int i = 0; i < 5; ++i)
+    {
+        // Allocate and touch some memory
+        memory.emplace_back(16 * 1024 * 1024);
+        std::memset(memory.back().data(), 0xFF, memory.back().size());
+
+        CppCommon::Thread::Sleep(1000);
+
+        // Sample the resource usage of the current process every second
+        const CppCommon::ResourceUsage& delta = sampler.Sample();
+        std::cout << "CPU utilization: " << (sampler.utilization() * 100.0) << "%" << std::endl;
+        std::cout << "CPU time: user " << delta.user_time.milliseconds() << " ms, system " << delta.system_time.milliseconds() << " ms" << std::endl;
+        std::cout << "RSS: " << (delta.rss / 1024) << " KiB (peak " << (delta.peak_rss / 1024) << " KiB)" << std::endl;
+        std::cout << "Page faults: minor " << delta.minor_faults << ", major " << delta.major_faults << std::endl;
+        std::cout << "Context switches: voluntary " << delta.voluntary_switches << ", involuntary " << delta.involuntary_switches << std::endl;
+        std::cout << std::endl;
+    }
+
+    return 0;
+}
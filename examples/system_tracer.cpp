@@ -0,0 +1,55 @@
+/*!
+    \file system_tracer.cpp
+    \brief Scoped tracing spans example
+    \author Ivan Shynkarenka
+    \date 15.10.2026
+    \copyright MIT License
+*/
+
+#include "system/tracer.h"
+#include "threads/thread.h"
+
+#include <iostream>
+#include <thread>
+#include <vector>
+
+void Handle(int request)
+{
+    // Trace only every tenth request
+    TRACE_SCOPE_IF((request % 10) == 0, "Handle");
+
+    {
+        TRACE_SCOPE("Parse");
+        CppCommon::Thread::SleepFor(CppCommon::Timespan::microseconds(10));
+    }
+    {
+        TRACE_SCOPE("Execute");
+        CppCommon::Thread::SleepFor(CppCommon::Timespan::microseconds(50));
+    }
+}
+
+int main(int argc, char** argv)
+{
+    // Open the trace file in chrome://tracing or https://ui.perfetto.dev
+    CppCommon::Tracer::Start("trace.json");
+
+    std::vector<std::thread> threads;
+    for (int thread = 0; thread < 4; ++thread)
+    {
+        threads.emplace_back([]()
+        {
+            for (int request = 0; request < 100; ++request)
+                Handle(request);
+        });
+    }
+
+    for (auto& thread : threads)
+        thread.join();
+
+    CppCommon::Tracer::Stop();
+
+    std::cout << "Written spans: " << CppCommon::Tracer::written() << std::endl;
+    std::cout << "Dropped spans: " << CppCommon::Tracer::dropped() << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,57 @@
+/*!
+    \file threads_actor.cpp
+    \brief Actor runtime example
+    \author Ivan Shynkarenka
+    \date 15.10.2026
+    \copyright MIT License
+*/
+
+#include "threads/actor.h"
+
+#include <iostream>
+#include <memory>
+#include <string>
+
+class Greeter : public CppCommon::Actor<std::string>
+{
+public:
+    using CppCommon::Actor<std::string>::Actor;
+
+protected:
+    void OnMessage(std::string& name) override
+    {
+        // Greeter state is never accessed concurrently
+        ++_greetings;
+        std::cout << "Hello, " << name << "! Greetings count: " << _greetings << std::endl;
+    }
+
+private:
+    int _greetings = 0;
+};
+
+int main(int argc, char** argv)
+{
+    // Create the actor system on the thread pool
+    auto pool = std::make_unique<CppCommon::ThreadPool>();
+    CppCommon::ActorSystem<std::string> system(*pool);
+
+    Greeter greeter(system);
+
+    std::cout << "Please enter your name. Enter '0' to exit..." << std::endl;
+
+    // Perform text input
+    std::string line;
+    while (getline(std::cin, line))
+    {
+        if (line == "0")
+            break;
+
+        // Send the message to the greeter actor
+        greeter.Send(line);
+    }
+
+    // Process all pending messages before the greeter is destroyed
+    pool.reset();
+
+    return 0;
+}
@@ -0,0 +1,47 @@
+/*!
+    \file threads_adaptive_lock.cpp
+    \brief Adaptive lock synchronization primitive example
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "threads/adaptive_lock.h"
+
+#include <iostream>
+#include <thread>
+#include <vector>
+
+int main(int argc, char** argv)
+{
+    CppCommon::AdaptiveLock lock;
+
+    std::cout << "Spin iterations before park: " << lock.spins() << std::endl;
+
+    // Start some threads
+    int counter = 0;
+    std::vector<std::thread> threads;
+    for (int thread = 0; thread < 4; ++thread)
+    {
+        threads.emplace_back([&lock, &counter]()
+        {
+            for (int i = 0; i < 100000; ++i)
+            {
+                // Use locker with adaptive lock to protect the counter
+                CppCommon::Locker<CppCommon::AdaptiveLock> locker(lock);
+                ++counter;
+            }
+        });
+    }
+
+    // Wait for all threads
+    for (auto& thread : threads)
+        thread.join();
+
+    std::cout << "Counter: " << counter << std::endl;
+    std::cout << "Contentions: " << lock.contentions() << std::endl;
+    std::cout << "Spinned: " << lock.spinned() << std::endl;
+    std::cout << "Parks: " << lock.parks() << std::endl;
+
+    return 0;
+}
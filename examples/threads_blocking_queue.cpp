@@ -0,0 +1,61 @@
+/*!
+    \file threads_blocking_queue.cpp
+    \brief Blocking wrapper of lock-free queues example
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "threads/blocking_queue.h"
+#include "threads/mpmc_ring_queue.h"
+
+#include <iostream>
+#include <string>
+#include <thread>
+
+int main(int argc, char** argv)
+{
+    std::cout << "Please enter some integer numbers. Enter '0' to exit..." << std::endl;
+
+    // Create blocking multiple producers / multiple consumers wait-free ring queue
+    CppCommon::BlockingQueue<CppCommon::MPMCRingQueue<int>> queue(1024);
+
+    // Start consumer thread
+    auto consumer = std::thread([&queue]()
+    {
+        int item;
+
+        do
+        {
+            // Dequeue the item or end consume
+            if (!queue.Dequeue(item))
+                break;
+
+            // Consume the item
+            std::cout << "Your entered number: " << item << std::endl;
+        } while (item != 0);
+    });
+
+    // Perform text input
+    std::string line;
+    while (getline(std::cin, line))
+    {
+        int item = std::stoi(line);
+
+        // Enqueue the item or end produce
+        if (!queue.Enqueue(item))
+            break;
+
+        if (item == 0)
+        {
+            // Close the blocking queue
+            queue.Close();
+            break;
+        }
+    }
+
+    // Wait for the consumer thread
+    consumer.join();
+
+    return 0;
+}
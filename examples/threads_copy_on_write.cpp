@@ -0,0 +1,59 @@
+/*!
+    \file threads_copy_on_write.cpp
+    \brief Copy-on-write published snapshot synchronization primitive example
+    \author Ivan Shynkarenka
+    \date 15.10.2026
+    \copyright MIT License
+*/
+
+#include "containers/hashmap.h"
+#include "threads/copy_on_write.h"
+
+#include <atomic>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+typedef CppCommon::HashMap<std::string, int> Routes;
+
+int main(int argc, char** argv)
+{
+    // Routing table which readers never wait for
+    CppCommon::CopyOnWrite<Routes> routes(16, "");
+    routes.Modify([](Routes& table) { table["/orders"] = 1; table["/quotes"] = 2; });
+
+    std::atomic<bool> stop(false);
+
+    // Start some readers threads
+    std::vector<std::thread> readers;
+    for (int reader = 0; reader < 4; ++reader)
+    {
+        readers.emplace_back([&routes, &stop]()
+        {
+            uint64_t hits = 0;
+            while (!stop)
+            {
+                // Keep the snapshot while resolving several routes
+                CppCommon::CopyOnWrite<Routes>::Reader snapshot(routes);
+                hits += snapshot->count("/orders") + snapshot->count("/quotes");
+            }
+        });
+    }
+
+    // Publish a few routing table updates
+    for (int i = 0; i < 100; ++i)
+        routes.Modify([i](Routes& table) { table["/quotes"] = 2 + i; });
+
+    // Stop threads
+    stop = true;
+
+    // Wait for all threads
+    for (auto& reader : readers)
+        reader.join();
+
+    std::cout << "Routing table version: " << routes.version() << std::endl;
+    std::cout << "/quotes: " << routes.Read()["/quotes"] << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,70 @@
+/*!
+    \file threads_coroutine.cpp
+    \brief Coroutine wait queue consumers example
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "threads/coroutine.h"
+#include "threads/latch.h"
+#include "threads/thread_pool.h"
+#include "threads/wait_queue.h"
+
+#include <iostream>
+#include <string>
+
+#if defined(CPPCOMMON_COROUTINES)
+
+CppCommon::CoroutineTask<> Consume(int consumer, CppCommon::WaitQueue<std::string>& queue, CppCommon::ThreadPool& pool, CppCommon::Latch& latch)
+{
+    // Suspend the coroutine until the next line arrives
+    std::string line;
+    while (co_await queue.DequeueAsync(line, pool))
+        std::cout << "Consumer " << consumer << " received: " << line << std::endl;
+
+    latch.CountDown();
+}
+
+int main(int argc, char** argv)
+{
+    std::string help = "Please enter any string to send it to one of 1000 coroutine consumers. Enter '0' to exit...";
+
+    // Show help message
+    std::cout << help << std::endl;
+
+    int consumers = 1000;
+
+    // Wait queue consumed by coroutines in two worker threads
+    CppCommon::WaitQueue<std::string> queue;
+    CppCommon::ThreadPool pool(2);
+    CppCommon::Latch latch(consumers);
+
+    for (int consumer = 0; consumer < consumers; ++consumer)
+        Consume(consumer, queue, pool, latch).Spawn(pool);
+
+    // Perform text input
+    std::string line;
+    while (getline(std::cin, line))
+    {
+        if (line == "0")
+            break;
+        queue.Enqueue(line);
+    }
+
+    // Close the wait queue and wait for all consumers
+    queue.Close();
+    latch.Wait();
+
+    return 0;
+}
+
+#else
+
+int main(int argc, char** argv)
+{
+    std::cout << "Coroutines are not supported by the compiler!" << std::endl;
+    return 0;
+}
+
+#endif
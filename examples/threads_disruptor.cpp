@@ -0,0 +1,67 @@
+/*!
+    \file threads_disruptor.cpp
+    \brief Disruptor multicast ring example
+    \author Ivan Shynkarenka
+    \date 15.10.2026
+    \copyright MIT License
+*/
+
+#include "threads/disruptor.h"
+
+#include <iostream>
+#include <string>
+#include <thread>
+
+int main(int argc, char** argv)
+{
+    std::cout << "Please enter some integer numbers. Enter '0' to exit..." << std::endl;
+
+    // Create disruptor with the business logic consumer gated on the journaler
+    CppCommon::Disruptor<int, CppCommon::DisruptorProducer::SINGLE> disruptor(1024);
+    auto& journaler = disruptor.AddConsumer();
+    auto& logic = disruptor.AddConsumer({ &journaler });
+
+    // Start journaler thread
+    auto journal = std::thread([&disruptor, &journaler]()
+    {
+        while (disruptor.Consume(journaler, [](int& item, uint64_t sequence, bool end_of_batch)
+        {
+            std::cout << "Journaled number #" << sequence << ": " << item << std::endl;
+        }) > 0);
+    });
+
+    // Start business logic thread
+    auto business = std::thread([&disruptor, &logic]()
+    {
+        while (disruptor.Consume(logic, [](int& item, uint64_t sequence, bool end_of_batch)
+        {
+            std::cout << "Processed number #" << sequence << ": " << item << std::endl;
+        }) > 0);
+    });
+
+    // Perform text input
+    std::string line;
+    while (getline(std::cin, line))
+    {
+        int item = std::stoi(line);
+
+        // Claim the slot, fill it in place and publish it
+        uint64_t sequence;
+        if (!disruptor.Claim(sequence))
+            break;
+        disruptor[sequence] = item;
+        disruptor.Publish(sequence);
+
+        if (item == 0)
+            break;
+    }
+
+    // Close the disruptor
+    disruptor.Close();
+
+    // Wait for consumers threads
+    journal.join();
+    business.join();
+
+    return 0;
+}
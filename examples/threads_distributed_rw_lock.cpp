@@ -0,0 +1,84 @@
+/*!
+    \file threads_distributed_rw_lock.cpp
+    \brief Distributed read/write lock synchronization primitive example
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "threads/distributed_rw_lock.h"
+#include "threads/thread.h"
+
+#include <atomic>
+#include <iostream>
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+
+int main(int argc, char** argv)
+{
+    std::cout << "Press Enter to stop..." << std::endl;
+
+    // Read mostly configuration table
+    CppCommon::DistributedRWLock lock;
+    std::map<std::string, int> config = { { "timeout", 100 } };
+
+    std::cout << "Reader slots: " << lock.slots() << std::endl;
+
+    std::atomic<bool> stop(false);
+
+    // Start the producer thread which rarely updates the configuration
+    std::thread producer([&lock, &stop, &config]()
+    {
+        while (!stop)
+        {
+            // Use a write locker to update the configuration
+            {
+                CppCommon::WriteLocker<CppCommon::DistributedRWLock> locker(lock);
+
+                config["timeout"] = rand() % 1000;
+                std::cout << "Update timeout: " << config["timeout"] << std::endl;
+            }
+
+            // Sleep for a while...
+            CppCommon::Thread::SleepFor(CppCommon::Timespan::seconds(1));
+        }
+    });
+
+    // Start some consumers threads which frequently read the configuration
+    std::vector<std::thread> consumers;
+    for (int consumer = 0; consumer < 4; ++consumer)
+    {
+        consumers.emplace_back([&lock, &stop, &config, consumer]()
+        {
+            while (!stop)
+            {
+                // Use a read locker to read the configuration
+                {
+                    CppCommon::ReadLocker<CppCommon::DistributedRWLock> locker(lock);
+
+                    std::cout << "Read timeout in thread " << consumer << ": " << config.at("timeout") << std::endl;
+                }
+
+                // Sleep for a while...
+                CppCommon::Thread::SleepFor(CppCommon::Timespan::milliseconds(100));
+            }
+        });
+    }
+
+    // Wait for input
+    std::cin.get();
+
+    // Stop threads
+    stop = true;
+
+    // Wait for the producer thread
+    producer.join();
+
+    // Wait for all consumers threads
+    for (auto& consumer : consumers)
+        consumer.join();
+
+    return 0;
+}
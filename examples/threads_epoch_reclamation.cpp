@@ -0,0 +1,69 @@
+/*!
+    \file threads_epoch_reclamation.cpp
+    \brief Epoch-based memory reclamation example
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "threads/epoch_reclamation.h"
+
+#include <atomic>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+struct Config
+{
+    std::string host;
+    int port;
+};
+
+int main(int argc, char** argv)
+{
+    CppCommon::EpochReclamation domain;
+
+    // Reader-safe config pointer
+    std::atomic<Config*> config(new Config{ "localhost", 1000 });
+
+    std::atomic<bool> stop(false);
+
+    // Start some readers threads
+    std::vector<std::thread> readers;
+    for (int reader = 0; reader < 4; ++reader)
+    {
+        readers.emplace_back([&domain, &config, &stop]()
+        {
+            uint64_t ports = 0;
+            while (!stop)
+            {
+                // Config snapshot is not deleted while the guard is alive
+                CppCommon::EpochReclamation::Guard guard(domain);
+                Config* current = config.load(std::memory_order_acquire);
+                ports += current->port;
+            }
+        });
+    }
+
+    // Swap config snapshots and retire previous ones
+    for (int i = 1; i <= 1000; ++i)
+        domain.Retire(config.exchange(new Config{ "localhost", 1000 + i }, std::memory_order_acq_rel));
+
+    // Stop threads
+    stop = true;
+
+    // Wait for all threads
+    for (auto& reader : readers)
+        reader.join();
+
+    // Delete all retired snapshots
+    domain.Synchronize();
+
+    std::cout << "Current port: " << config.load()->port << std::endl;
+    std::cout << "Retired snapshots: " << domain.retired() << std::endl;
+    std::cout << "Reclaimed snapshots: " << domain.reclaimed() << std::endl;
+
+    delete config.load();
+    return 0;
+}
@@ -0,0 +1,59 @@
+/*!
+    \file threads_instrumentation.cpp
+    \brief Instrumentation counters of queues and locks example
+    \author Ivan Shynkarenka
+    \date 15.10.2026
+    \copyright MIT License
+*/
+
+#include "threads/instrumentation.h"
+#include "threads/mpmc_ring_queue.h"
+#include "threads/spin_lock.h"
+
+#include <iostream>
+#include <thread>
+#include <vector>
+
+int main(int argc, char** argv)
+{
+    if (!CppCommon::InstrumentationRegistry::IsEnabled())
+        std::cout << "Build with CPPCOMMON_INSTRUMENTATION option to instrument queues and locks!" << std::endl;
+
+    CppCommon::MPMCRingQueue<int> queue(1024);
+    CppCommon::SpinLock lock;
+    uint64_t crc = 0;
+
+    // Start producer and consumer threads
+    std::vector<std::thread> threads;
+    for (int thread = 0; thread < 4; ++thread)
+    {
+        threads.emplace_back([&queue, &lock, &crc, thread]()
+        {
+            for (int i = 0; i < 100000; ++i)
+            {
+                int item;
+                if ((thread % 2) == 0)
+                    queue.Enqueue(i);
+                else if (queue.Dequeue(item))
+                {
+                    CppCommon::Locker<CppCommon::SpinLock> locker(lock);
+                    crc += item;
+                }
+            }
+        });
+    }
+
+    for (auto& thread : threads)
+        thread.join();
+
+    // Show instrumentation totals
+    for (const auto& sample : CppCommon::InstrumentationRegistry::Totals())
+    {
+        std::cout << sample.name << ": full = " << sample.full() << ", empty = " << sample.empty()
+                  << ", contended = " << sample.contended() << ", spins = " << sample.spins() << std::endl;
+    }
+
+    std::cout << "CRC = " << crc << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,54 @@
+/*!
+    \file threads_left_right.cpp
+    \brief Left-Right synchronization primitive example
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "threads/left_right.h"
+
+#include <atomic>
+#include <iostream>
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+
+int main(int argc, char** argv)
+{
+    // Quotes snapshot which readers never wait for
+    CppCommon::LeftRight<std::map<std::string, double>> quotes;
+
+    std::atomic<bool> stop(false);
+
+    // Start some readers threads
+    std::vector<std::thread> readers;
+    for (int reader = 0; reader < 4; ++reader)
+    {
+        readers.emplace_back([&quotes, &stop]()
+        {
+            uint64_t reads = 0;
+            while (!stop)
+            {
+                // Read the snapshot in place without copying
+                quotes.Visit([&reads](const std::map<std::string, double>& snapshot) { reads += snapshot.size(); });
+            }
+        });
+    }
+
+    // Update quotes in burst
+    for (int i = 0; i < 10000; ++i)
+        quotes.Modify([i](std::map<std::string, double>& snapshot) { snapshot["EURUSD"] = 1.1 + i * 0.00001; });
+
+    // Stop threads
+    stop = true;
+
+    // Wait for all threads
+    for (auto& reader : readers)
+        reader.join();
+
+    std::cout << "EURUSD: " << quotes.Read().at("EURUSD") << std::endl;
+
+    return 0;
+}
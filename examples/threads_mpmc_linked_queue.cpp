@@ -0,0 +1,65 @@
+/*!
+    \file threads_mpmc_linked_queue.cpp
+    \brief Multiple producers / multiple consumers lock-free linked queue example
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "threads/mpmc_linked_queue.h"
+
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+int main(int argc, char** argv)
+{
+    std::cout << "Please enter some integer numbers. Enter '0' to exit..." << std::endl;
+
+    // Create multiple producers / multiple consumers lock-free linked queue
+    CppCommon::DefaultMemoryManager auxiliary;
+    CppCommon::MPMCLinkedQueue<int> queue(auxiliary);
+
+    // Start consumer threads
+    std::vector<std::thread> consumers;
+    for (int consumer = 0; consumer < 4; ++consumer)
+    {
+        consumers.emplace_back([&queue, consumer]()
+        {
+            int item;
+
+            do
+            {
+                // Dequeue using yield waiting strategy
+                while (!queue.Dequeue(item))
+                    std::this_thread::yield();
+
+                // Consume the item
+                std::cout << "Consumer " << consumer << " got your entered number: " << item << std::endl;
+            } while (item != 0);
+        });
+    }
+
+    // Perform text input
+    std::string line;
+    while (getline(std::cin, line))
+    {
+        int item = std::stoi(line);
+
+        // Enqueue the item or stop all consumers
+        if (item == 0)
+        {
+            for (size_t i = 0; i < consumers.size(); ++i)
+                queue.Enqueue(0);
+            break;
+        }
+        queue.Enqueue(item);
+    }
+
+    // Wait for all consumer threads
+    for (auto& consumer : consumers)
+        consumer.join();
+
+    return 0;
+}
@@ -0,0 +1,70 @@
+/*!
+    \file threads_mpmc_ring_buffer.cpp
+    \brief Multiple producers / multiple consumers lock-free ring buffer example
+    \author Ivan Shynkarenka
+    \date 15.10.2026
+    \copyright MIT License
+*/
+
+#include "threads/mpmc_ring_buffer.h"
+
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+int main(int argc, char** argv)
+{
+    std::cout << "Please enter some text. Enter '#' to exit..." << std::endl;
+
+    // Create multiple producers / multiple consumers lock-free ring buffer
+    CppCommon::MPMCRingBuffer buffer(1024);
+
+    // Start consumer threads
+    std::vector<std::thread> consumers;
+    for (int consumer = 0; consumer < 2; ++consumer)
+    {
+        consumers.emplace_back([&buffer, consumer]()
+        {
+            for (;;)
+            {
+                // Claim with yield waiting strategy
+                CppCommon::MPMCRingBuffer::Record record;
+                while (!(record = buffer.Claim()))
+                    std::this_thread::yield();
+
+                // Consume the record in place
+                std::string line((const char*)record.data, record.size);
+                buffer.Release(record);
+
+                // Empty line stops the consumer
+                if (line.empty())
+                    break;
+
+                // Output the whole message at once, consumers print concurrently
+                std::cout << ("Consumer " + std::to_string(consumer) + " received: " + line + "\n") << std::flush;
+            }
+        });
+    }
+
+    // Perform text input
+    std::string line;
+    while (getline(std::cin, line))
+    {
+        if (line.find('#') != std::string::npos)
+            break;
+
+        // Enqueue using yield waiting strategy
+        while (!line.empty() && !buffer.Enqueue(line.data(), line.size()))
+            std::this_thread::yield();
+    }
+
+    // Stop consumer threads with empty records
+    for (size_t i = 0; i < consumers.size(); ++i)
+        while (!buffer.Enqueue(nullptr, 0))
+            std::this_thread::yield();
+    for (auto& consumer : consumers)
+        consumer.join();
+
+    return 0;
+}
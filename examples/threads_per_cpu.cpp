@@ -0,0 +1,52 @@
+/*!
+    \file threads_per_cpu.cpp
+    \brief Per-CPU data and sharded counter example
+    \author Ivan Shynkarenka
+    \date 15.10.2026
+    \copyright MIT License
+*/
+
+#include "threads/per_cpu.h"
+#include "threads/sharded_counter.h"
+
+#include <algorithm>
+#include <atomic>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+int main(int argc, char** argv)
+{
+    // Requests counter updated from all worker threads
+    CppCommon::ShardedCounter requests;
+    // Per-CPU maximal request size
+    CppCommon::PerCpu<std::atomic<int>> sizes;
+
+    std::cout << "Shards: " << requests.shards() << std::endl;
+
+    std::vector<std::thread> workers;
+    for (int worker = 0; worker < 4; ++worker)
+    {
+        workers.emplace_back([&requests, &sizes, worker]()
+        {
+            for (int i = 0; i < 1000000; ++i)
+            {
+                requests.Add();
+
+                int size = (i * 7 + worker) % 1000;
+                auto& max = sizes.local();
+                int current = max.load(std::memory_order_relaxed);
+                while ((size > current) && !max.compare_exchange_weak(current, size, std::memory_order_relaxed));
+            }
+        });
+    }
+    for (auto& worker : workers)
+        worker.join();
+
+    int max = 0;
+    sizes.ForEach([&max](const std::atomic<int>& size) { max = std::max(max, size.load()); });
+
+    std::cout << "Requests: " << requests.Sum() << std::endl;
+    std::cout << "Maximal request size: " << max << std::endl;
+    return 0;
+}
@@ -0,0 +1,70 @@
+/*!
+    \file threads_pipeline.cpp
+    \brief Staged threads pipeline example
+    \author Ivan Shynkarenka
+    \date 15.10.2026
+    \copyright MIT License
+*/
+
+#include "threads/pipeline.h"
+
+#include <iostream>
+#include <string>
+
+struct Order
+{
+    std::string line;
+    int quantity = 0;
+    int price = 0;
+    std::string venue;
+};
+
+int main(int argc, char** argv)
+{
+    std::cout << "Please enter orders as '<quantity> <price>'. Enter '0' to exit..." << std::endl;
+
+    // Build "parse -> enrich -> route" pipeline
+    CppCommon::Pipeline<Order> pipeline;
+    pipeline.AddStage("parse", [](Order& order)
+    {
+        // Drop malformed orders
+        try
+        {
+            size_t offset = 0;
+            order.quantity = std::stoi(order.line, &offset);
+            order.price = (offset < order.line.size()) ? std::stoi(order.line.substr(offset)) : 0;
+            return (order.quantity > 0);
+        }
+        catch (const std::exception&)
+        {
+            return false;
+        }
+    });
+    pipeline.AddStage("enrich", [](Order& order) { order.venue = (order.quantity * order.price > 1000) ? "block" : "lit"; });
+    pipeline.AddStage("route", [](Order& order) { std::cout << "Routed " << order.quantity << " @ " << order.price << " to " << order.venue << std::endl; });
+
+    // Start pipeline threads pinned to logical processors
+    pipeline.Start();
+    std::cout << "Pipeline threads: " << pipeline.threads() << std::endl;
+
+    // Perform text input
+    std::string line;
+    while (getline(std::cin, line))
+    {
+        if (line == "0")
+            break;
+
+        Order order;
+        order.line = line;
+        pipeline.Enqueue(std::move(order));
+    }
+
+    // Stop the pipeline
+    pipeline.Stop();
+
+    // Show stages statistics
+    for (const auto& stage : pipeline.statistics())
+        std::cout << "Stage '" << stage.name << "' thread " << stage.thread << ": " << stage.items << " items, " << stage.dropped << " dropped, p99 latency " << stage.latency.p99() << " ns" << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,68 @@
+/*!
+    \file threads_shared_ring_buffer.cpp
+    \brief Shared memory ring buffer example
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "threads/shared_spsc_ring_buffer.h"
+
+#include <iostream>
+#include <string>
+#include <thread>
+
+int main(int argc, char** argv)
+{
+    std::string help = "Please enter any string to send it to the consumer (several processes support). Enter '0' to exit...";
+
+    // Show help message
+    std::cout << help << std::endl;
+
+    // Shared memory ring buffer master (created by the first process)
+    CppCommon::SharedSPSCRingBuffer producer("shared_ring_buffer_example", 1024);
+
+    // Start consumer thread
+    auto consumer = std::thread([]()
+    {
+        // Shared memory ring buffer slave (could be opened in another process)
+        CppCommon::SharedSPSCRingBuffer buffer("shared_ring_buffer_example", 1024);
+
+        char message[1024];
+        for (;;)
+        {
+            // Wait for the data in the ring buffer
+            buffer.Wait();
+
+            // Dequeue the message
+            size_t size = sizeof(message);
+            if (buffer.Dequeue(message, size))
+            {
+                std::string text(message, size);
+                if (text == "0")
+                    break;
+                std::cout << "Received: " << text << std::endl;
+            }
+        }
+    });
+
+    // Perform text input
+    std::string line;
+    while (getline(std::cin, line))
+    {
+        if (line.empty())
+            continue;
+
+        // Enqueue the message
+        while (!producer.Enqueue(line.data(), line.size()))
+            std::this_thread::yield();
+
+        if (line == "0")
+            break;
+    }
+
+    // Wait for the consumer thread
+    consumer.join();
+
+    return 0;
+}
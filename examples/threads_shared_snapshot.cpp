@@ -0,0 +1,73 @@
+/*!
+    \file threads_shared_snapshot.cpp
+    \brief Shared memory snapshot example
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "threads/shared_snapshot.h"
+
+#include <iostream>
+#include <string>
+#include <thread>
+
+struct TopOfBook
+{
+    uint64_t bid;
+    uint64_t ask;
+};
+
+int main(int argc, char** argv)
+{
+    std::string help = "Please enter the bid price to publish it to the reader (several processes support). Enter '0' to exit...";
+
+    // Show help message
+    std::cout << help << std::endl;
+
+    // Shared memory snapshot publisher (created by the first process)
+    CppCommon::SharedSnapshot<TopOfBook> publisher("shared_snapshot_example");
+
+    // Start reader thread
+    auto reader = std::thread([]()
+    {
+        // Shared memory snapshot reader (could be opened in another process)
+        CppCommon::SharedSnapshot<TopOfBook> snapshot("shared_snapshot_example");
+
+        uint64_t version = 0;
+        TopOfBook book;
+        for (;;)
+        {
+            // Wait for the newer version of the snapshot
+            snapshot.Wait(version);
+
+            // Read the latest snapshot
+            if (snapshot.TryRead(book, version))
+            {
+                if (book.bid == 0)
+                    break;
+                std::cout << "Version " << version << ": " << book.bid << " / " << book.ask << std::endl;
+            }
+        }
+    });
+
+    // Perform text input
+    std::string line;
+    while (getline(std::cin, line))
+    {
+        if (line.empty())
+            continue;
+
+        // Publish the top of book snapshot
+        uint64_t bid = std::stoull(line);
+        publisher.Publish(TopOfBook{ bid, bid + 1 });
+
+        if (bid == 0)
+            break;
+    }
+
+    // Wait for the reader thread
+    reader.join();
+
+    return 0;
+}
@@ -14,6 +14,7 @@
 
 #include <atomic>
 #include <iostream>
+#include <string>
 #include <thread>
 #include <vector>
 
@@ -40,12 +41,17 @@ int main(int argc, char** argv)
         // Start thread with an exception handler registered
         std::thread thrd = CppCommon::Thread::Start([&lock, &stop, thread]()
         {
+            // Set the current thread name visible in debuggers, perf and top
+            CppCommon::Thread::SetName("worker-" + std::to_string(thread));
+
             while (!stop)
             {
                 // Use locker with critical section to protect the output
                 {
                     CppCommon::Locker<CppCommon::CriticalSection> locker(lock);
+                    const CppCommon::ThreadInfo& info = CppCommon::Thread::CurrentThreadInfo();
                     std::cout << "Thread Number: " << thread << ", Thread Id: " << CppCommon::Thread::CurrentThreadId() << ", Thread CPU affinity: " << CppCommon::Thread::CurrentThreadAffinity() << std::endl;
+                    std::cout << "Thread Name: " << info.name << ", Thread Index: " << info.index << ", Thread OS Id: " << info.tid << std::endl;
                 }
 
                 // Sleep for one second...
@@ -0,0 +1,44 @@
+/*!
+    \file threads_thread_pool.cpp
+    \brief Work-stealing thread pool example
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "threads/latch.h"
+#include "threads/thread_pool.h"
+
+#include <atomic>
+#include <iostream>
+
+int main(int argc, char** argv)
+{
+    int tasks = 100;
+    std::atomic<int> sum(0);
+
+    // Work-stealing thread pool with workers pinned to physical cores
+    CppCommon::ThreadPool pool(0, CppCommon::ThreadPoolAffinity::PHYSICAL_CORES);
+
+    std::cout << "Thread pool workers: " << pool.threads() << std::endl;
+
+    // Submit some tasks and wait for them
+    CppCommon::Latch latch(tasks);
+    for (int i = 0; i < tasks; ++i)
+    {
+        pool.Submit([&sum, &latch, &pool, i]()
+        {
+            // Nested task is pushed into the worker own deque
+            pool.Submit([&sum, &latch, i]()
+            {
+                sum += i;
+                latch.CountDown();
+            });
+        });
+    }
+    latch.Wait();
+
+    std::cout << "Sum: " << sum << std::endl;
+
+    return 0;
+}
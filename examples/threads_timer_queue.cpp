@@ -0,0 +1,42 @@
+/*!
+    \file threads_timer_queue.cpp
+    \brief Timer queue example
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "cache/memcache.h"
+#include "threads/thread.h"
+#include "threads/timer_queue.h"
+
+#include <iostream>
+
+int main(int argc, char** argv)
+{
+    CppCommon::MemCache<std::string, int> cache;
+    cache.insert("123", 123);
+    cache.insert("456", 456, CppCommon::Timespan::milliseconds(100));
+
+    // Timer queue with the dedicated timer thread
+    CppCommon::TimerQueue timers;
+    timers.Start();
+
+    // Watchdog the memory cache periodically
+    timers.SchedulePeriodic(CppCommon::Timespan::milliseconds(50), [&cache]() { cache.watchdog(); });
+
+    // Schedule one-shot timers and cancel one of them
+    timers.ScheduleAfter(CppCommon::Timespan::milliseconds(100), []() { std::cout << "Timer 100 ms" << std::endl; });
+    auto handle = timers.ScheduleAfter(CppCommon::Timespan::milliseconds(150), []() { std::cout << "Timer 150 ms" << std::endl; });
+    timers.ScheduleAfter(CppCommon::Timespan::milliseconds(200), []() { std::cout << "Timer 200 ms" << std::endl; });
+    timers.Cancel(handle);
+
+    // Sleep for a while...
+    CppCommon::Thread::Sleep(300);
+
+    timers.Stop();
+
+    std::cout << "Memory cache size: " << cache.size() << std::endl;
+
+    return 0;
+}
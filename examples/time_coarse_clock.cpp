@@ -0,0 +1,31 @@
+/*!
+    \file time_coarse_clock.cpp
+    \brief Coarse cached clock example
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "time/coarse_clock.h"
+
+#include <iostream>
+#include <thread>
+
+int main(int argc, char** argv)
+{
+    std::cout << "Coarse system clock UTC value: " << CppCommon::CoarseClock::utc() << std::endl;
+    std::cout << "Coarse system clock monotonic value: " << CppCommon::CoarseClock::nano() << std::endl;
+
+    // Start the coarse clock ticker with 100 microseconds resolution
+    CppCommon::CoarseClock::Start(CppCommon::Timespan::microseconds(100));
+
+    for (int i = 0; i < 10; ++i)
+    {
+        std::cout << "Coarse clock UTC value: " << CppCommon::CoarseClock::utc() << ", UTC value: " << CppCommon::Timestamp::utc() << std::endl;
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+
+    CppCommon::CoarseClock::Stop();
+
+    return 0;
+}
@@ -0,0 +1,49 @@
+/*!
+    \file time_latency_histogram.cpp
+    \brief High dynamic range latency histogram example
+    \author Ivan Shynkarenka
+    \date 15.10.2026
+    \copyright MIT License
+*/
+
+#include "time/latency_histogram.h"
+#include "time/timestamp.h"
+
+#include <iostream>
+#include <thread>
+#include <vector>
+
+int main(int argc, char** argv)
+{
+    CppCommon::ConcurrentLatencyHistogram histogram;
+
+    // Measure the latency of the current thread yield
+    std::vector<std::thread> threads;
+    for (int thread = 0; thread < 4; ++thread)
+    {
+        threads.emplace_back([&histogram]()
+        {
+            for (int i = 0; i < 100000; ++i)
+            {
+                uint64_t start = CppCommon::Timestamp::nano();
+                std::this_thread::yield();
+                histogram.Record(CppCommon::Timestamp::nano() - start);
+            }
+        });
+    }
+
+    for (auto& thread : threads)
+        thread.join();
+
+    CppCommon::LatencyHistogram snapshot = histogram.Snapshot();
+    std::cout << "count = " << snapshot.count() << std::endl;
+    std::cout << "min = " << snapshot.min() << " ns" << std::endl;
+    std::cout << "mean = " << snapshot.mean() << " ns" << std::endl;
+    std::cout << "p50 = " << snapshot.p50() << " ns" << std::endl;
+    std::cout << "p99 = " << snapshot.p99() << " ns" << std::endl;
+    std::cout << "p99.9 = " << snapshot.p999() << " ns" << std::endl;
+    std::cout << "max = " << snapshot.max() << " ns" << std::endl;
+    std::cout << "serialized = " << snapshot.Serialize().size() << " bytes" << std::endl;
+
+    return 0;
+}
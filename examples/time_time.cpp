@@ -7,6 +7,7 @@
 */
 
 #include "time/time.h"
+#include "time/timezone.h"
 
 #include <iostream>
 
@@ -38,5 +39,12 @@ int main(int argc, char** argv)
     std::cout << "Max time:" << std::endl;
     show(CppCommon::UtcTime(CppCommon::Timestamp(0xFFFFFFFFFFFFFFFF)));
 
+    char buffer[CppCommon::ISO8601_BUFFER_SIZE];
+    CppCommon::UtcTimestamp timestamp;
+    std::string iso8601(buffer, CppCommon::FormatISO8601(buffer, timestamp));
+    std::cout << "ISO-8601 UTC time: " << iso8601 << std::endl;
+    std::cout << "ISO-8601 local time: " << std::string(buffer, CppCommon::FormatISO8601(buffer, timestamp, CppCommon::Timezone::LocalOffset(timestamp), 3)) << std::endl;
+    std::cout << "ISO-8601 parsed time: " << CppCommon::ParseISO8601(iso8601).total() << std::endl;
+
     return 0;
 }
@@ -0,0 +1,28 @@
+/*!
+    \file time_tsc_clock.cpp
+    \brief Calibrated TSC clock example
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "time/tsc_clock.h"
+
+#include <iostream>
+#include <thread>
+
+int main(int argc, char** argv)
+{
+    std::cout << "Invariant TSC: " << (CppCommon::TscClock::IsInvariant() ? "yes" : "no") << std::endl;
+    std::cout << "TSC frequency: " << CppCommon::TscClock::frequency() << " Hz" << std::endl;
+
+    for (int i = 0; i < 10; ++i)
+    {
+        uint64_t tsc = CppCommon::TscClock::utc();
+        uint64_t utc = CppCommon::Timestamp::utc();
+        std::cout << "TSC clock value: " << tsc << ", UTC value: " << utc << ", difference: " << ((int64_t)(tsc - utc)) << " ns" << std::endl;
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    }
+
+    return 0;
+}
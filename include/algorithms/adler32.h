@@ -0,0 +1,95 @@
+/*!
+    \file adler32.h
+    \brief Adler-32 checksum algorithm definition
+    \author Ivan Shynkarenka
+    \date 15.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_ALGORITHMS_ADLER32_H
+#define CPPCOMMON_ALGORITHMS_ADLER32_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace CppCommon {
+
+//! Adler-32 checksum algorithm
+/*!
+    Adler-32 checksum is used by zlib streams. It is faster than table based
+    CRC algorithms, but detects errors of short buffers worse, so CRC32C is
+    preferred for new formats. Modulo reduction is deferred for 5552 bytes,
+    so the inner loop contains only additions.
+
+    Checksum could be calculated at once with static Calculate() method or in
+    the streaming mode with the checksum instance Update() method.
+
+    Not thread-safe (checksum instance), thread-safe (static methods).
+
+    https://en.wikipedia.org/wiki/Adler-32
+*/
+class Adler32
+{
+public:
+    //! Initialize the streaming checksum
+    /*!
+        \param adler - Checksum of the previous buffers (default is 1)
+    */
+    explicit Adler32(uint32_t adler = 1) noexcept : _adler(adler) {}
+    Adler32(const Adler32&) noexcept = default;
+    Adler32(Adler32&&) noexcept = default;
+    ~Adler32() noexcept = default;
+
+    Adler32& operator=(const Adler32&) noexcept = default;
+    Adler32& operator=(Adler32&&) noexcept = default;
+
+    //! Get the checksum of all updated buffers
+    uint32_t value() const noexcept { return _adler; }
+
+    //! Update the streaming checksum with the given buffer
+    /*!
+        \param buffer - Buffer to checksum
+        \param size - Buffer size
+        \return Streaming checksum reference
+    */
+    Adler32& Update(const void* buffer, size_t size) noexcept
+    { _adler = Calculate(buffer, size, _adler); return *this; }
+    //! Update the streaming checksum with the given string
+    /*!
+        \param str - String to checksum
+        \return Streaming checksum reference
+    */
+    Adler32& Update(std::string_view str) noexcept
+    { return Update(str.data(), str.size()); }
+
+    //! Reset the streaming checksum
+    void Reset() noexcept { _adler = 1; }
+
+    //! Calculate Adler-32 checksum of the given buffer
+    /*!
+        Checksum of the sequence of buffers could be calculated by passing the
+        checksum of the previous buffers as the initial value.
+
+        \param buffer - Buffer to checksum
+        \param size - Buffer size
+        \param adler - Checksum of the previous buffers (default is 1)
+        \return Adler-32 checksum
+    */
+    static uint32_t Calculate(const void* buffer, size_t size, uint32_t adler = 1) noexcept;
+    //! Calculate Adler-32 checksum of the given string
+    /*!
+        \param str - String to checksum
+        \param adler - Checksum of the previous buffers (default is 1)
+        \return Adler-32 checksum
+    */
+    static uint32_t Calculate(std::string_view str, uint32_t adler = 1) noexcept
+    { return Calculate(str.data(), str.size(), adler); }
+
+private:
+    uint32_t _adler;
+};
+
+} // namespace CppCommon
+
+#endif // CPPCOMMON_ALGORITHMS_ADLER32_H
@@ -0,0 +1,102 @@
+/*!
+    \file crc32c.h
+    \brief CRC-32C (Castagnoli) checksum algorithm definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_ALGORITHMS_CRC32C_H
+#define CPPCOMMON_ALGORITHMS_CRC32C_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace CppCommon {
+
+//! CRC-32C (Castagnoli) checksum algorithm
+/*!
+    CRC-32C checksum is used to detect corrupted or torn records of files and
+    network messages (iSCSI, SCTP, ext4, RocksDB). It is calculated with SSE
+    4.2 CRC32 instruction on x86 processors which support it (detected in the
+    runtime), with ARMv8 CRC32 instructions on ARM processors compiled with
+    the CRC extension, and with the portable slicing-by-8 table algorithm on
+    all other processors. Large buffers are processed by the hardware in three
+    interleaved streams to hide the latency of the CRC32 instruction, and the
+    streams are combined with the precomputed zero shift tables.
+
+    Checksum could be calculated at once with static Calculate() method or in
+    the streaming mode with the checksum instance Update() method.
+
+    Not thread-safe (checksum instance), thread-safe (static methods).
+
+    https://en.wikipedia.org/wiki/Cyclic_redundancy_check
+*/
+class CRC32C
+{
+public:
+    //! Initialize the streaming checksum
+    /*!
+        \param crc - Checksum of the previous buffers (default is 0)
+    */
+    explicit CRC32C(uint32_t crc = 0) noexcept : _crc(crc) {}
+    CRC32C(const CRC32C&) noexcept = default;
+    CRC32C(CRC32C&&) noexcept = default;
+    ~CRC32C() noexcept = default;
+
+    CRC32C& operator=(const CRC32C&) noexcept = default;
+    CRC32C& operator=(CRC32C&&) noexcept = default;
+
+    //! Get the checksum of all updated buffers
+    uint32_t value() const noexcept { return _crc; }
+
+    //! Update the streaming checksum with the given buffer
+    /*!
+        \param buffer - Buffer to checksum
+        \param size - Buffer size
+        \return Streaming checksum reference
+    */
+    CRC32C& Update(const void* buffer, size_t size) noexcept
+    { _crc = Calculate(buffer, size, _crc); return *this; }
+    //! Update the streaming checksum with the given string
+    /*!
+        \param str - String to checksum
+        \return Streaming checksum reference
+    */
+    CRC32C& Update(std::string_view str) noexcept
+    { return Update(str.data(), str.size()); }
+
+    //! Reset the streaming checksum
+    void Reset() noexcept { _crc = 0; }
+
+    //! Is the hardware accelerated CRC-32C calculation supported?
+    static bool IsHardwareSupported() noexcept;
+
+    //! Calculate CRC-32C checksum of the given buffer
+    /*!
+        Checksum of the sequence of buffers could be calculated by passing the
+        checksum of the previous buffers as the initial value.
+
+        \param buffer - Buffer to checksum
+        \param size - Buffer size
+        \param crc - Checksum of the previous buffers (default is 0)
+        \return CRC-32C checksum
+    */
+    static uint32_t Calculate(const void* buffer, size_t size, uint32_t crc = 0) noexcept;
+    //! Calculate CRC-32C checksum of the given string
+    /*!
+        \param str - String to checksum
+        \param crc - Checksum of the previous buffers (default is 0)
+        \return CRC-32C checksum
+    */
+    static uint32_t Calculate(std::string_view str, uint32_t crc = 0) noexcept
+    { return Calculate(str.data(), str.size(), crc); }
+
+private:
+    uint32_t _crc;
+};
+
+} // namespace CppCommon
+
+#endif // CPPCOMMON_ALGORITHMS_CRC32C_H
@@ -0,0 +1,173 @@
+/*!
+    \file hash.h
+    \brief Fast non-cryptographic hash functions definition
+    \author Ivan Shynkarenka
+    \date 15.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_ALGORITHMS_HASH_H
+#define CPPCOMMON_ALGORITHMS_HASH_H
+
+#include "utility/endian.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace CppCommon {
+
+//! Fast non-cryptographic hash functions
+/*!
+    Buffers are hashed with wyhash algorithm, which processes 48 bytes per
+    iteration with 64x64->128 bit multiplications and has the short path
+    for keys up to 16 bytes. Integers are hashed with the strong bijective
+    64-bit mixer (SplitMix64 finalizer), so sequential keys are spread over
+    all bits and do not cluster in open addressing hash tables, unlike the
+    identity std::hash of the standard library.
+
+    Hash values depend on the seed only and are the same on all platforms,
+    but they are not cryptographic and must not be exposed to untrusted
+    clients which could choose colliding keys.
+
+    Thread-safe.
+
+    https://github.com/wangyi-fudan/wyhash
+    https://prng.di.unimi.it/splitmix64.c
+*/
+class Hash
+{
+public:
+    Hash() = delete;
+    Hash(const Hash&) = delete;
+    Hash(Hash&&) = delete;
+    ~Hash() = delete;
+
+    Hash& operator=(const Hash&) = delete;
+    Hash& operator=(Hash&&) = delete;
+
+    //! Calculate the hash of the given buffer
+    /*!
+        \param buffer - Buffer to hash
+        \param size - Buffer size
+        \param seed - Hash seed (default is 0)
+        \return 64-bit hash value
+    */
+    static uint64_t Calculate(const void* buffer, size_t size, uint64_t seed = 0) noexcept;
+    //! Calculate the hash of the given string
+    /*!
+        \param str - String to hash
+        \param seed - Hash seed (default is 0)
+        \return 64-bit hash value
+    */
+    static uint64_t Calculate(std::string_view str, uint64_t seed = 0) noexcept
+    { return Calculate(str.data(), str.size(), seed); }
+
+    //! Mix bits of the given integer value
+    /*!
+        Mixer is bijective, so different values never collide.
+
+        \param value - Integer value
+        \return 64-bit hash value
+    */
+    static constexpr uint64_t Mix(uint64_t value) noexcept;
+    //! Mix bits of the given pair of integer values
+    /*!
+        Mixer is not symmetric, so swapped values produce different hashes.
+
+        \param value1 - First integer value
+        \param value2 - Second integer value
+        \return 64-bit hash value
+    */
+    static uint64_t Mix(uint64_t value1, uint64_t value2) noexcept;
+
+private:
+    static void Multiply(uint64_t& low, uint64_t& high) noexcept;
+    static uint64_t Fold(uint64_t value1, uint64_t value2) noexcept;
+};
+
+//! Fast hasher
+/*!
+    std::hash compatible hasher based on fast non-cryptographic hash functions.
+    Integers, enums and pointers are hashed with Hash::Mix(), strings are hashed
+    with Hash::Calculate(). All other types are hashed with std::hash and mixed
+    with Hash::Mix(), so any type with std::hash specialization is supported.
+
+    Fast hasher is the default hasher of HashMap and ConcurrentHashMap.
+
+    Thread-safe.
+*/
+template <typename T, typename = void>
+struct FastHash
+{
+    size_t operator()(const T& value) const noexcept(noexcept(std::hash<T>()(value)))
+    { return (size_t)Hash::Mix((uint64_t)std::hash<T>()(value)); }
+};
+
+//! \cond DOXYGEN_SKIP
+//! Fast hasher of integers and enums (specialization)
+template <typename T>
+struct FastHash<T, std::enable_if_t<std::is_integral_v<T> || std::is_enum_v<T>>>
+{
+    size_t operator()(T value) const noexcept
+    { return (size_t)Hash::Mix((uint64_t)value); }
+};
+
+//! Fast hasher of pointers (specialization)
+template <typename T>
+struct FastHash<T*>
+{
+    size_t operator()(T* value) const noexcept
+    { return (size_t)Hash::Mix((uint64_t)(uintptr_t)value); }
+};
+//! \endcond
+
+//! Fast transparent string hasher
+/*!
+    Calculates the same hash value for std::string, std::string_view and C-string
+    with the same content.
+
+    Thread-safe.
+*/
+struct FastStringHash
+{
+    typedef void is_transparent;
+
+    size_t operator()(std::string_view str) const noexcept { return (size_t)Hash::Calculate(str); }
+    size_t operator()(const std::string& str) const noexcept { return (size_t)Hash::Calculate(str); }
+    size_t operator()(const char* str) const noexcept { return (size_t)Hash::Calculate(std::string_view(str)); }
+};
+
+//! \cond DOXYGEN_SKIP
+//! Fast hasher of strings (specialization)
+template <>
+struct FastHash<std::string> : FastStringHash {};
+
+//! Fast hasher of string views (specialization)
+template <>
+struct FastHash<std::string_view> : FastStringHash {};
+//! \endcond
+
+//! Combine the given hash seed with the hash of the given value
+/*!
+    Used to hash composite keys field by field:
+    \code{.cpp}
+    size_t seed = 0;
+    HashCombine(seed, key.id);
+    HashCombine(seed, key.name);
+    \endcode
+
+    \param seed - Hash seed to combine with
+    \param value - Value to hash with FastHash
+*/
+template <typename T>
+void HashCombine(size_t& seed, const T& value) noexcept(noexcept(FastHash<T>()(value)));
+
+} // namespace CppCommon
+
+#include "hash.inl"
+
+#endif // CPPCOMMON_ALGORITHMS_HASH_H
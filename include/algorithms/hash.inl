@@ -0,0 +1,133 @@
+/*!
+    \file hash.inl
+    \brief Fast non-cryptographic hash functions inline implementation
+    \author Ivan Shynkarenka
+    \date 15.10.2026
+    \copyright MIT License
+*/
+
+#if !defined(__SIZEOF_INT128__) && defined(_MSC_VER) && defined(_M_X64)
+#include <intrin.h>
+#endif
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+namespace Internals {
+
+// wyhash default secret
+constexpr uint64_t WYHASH_SECRET[4] = { 0x2D358DCCAA6C78A5ull, 0x8BB84B93962EACC9ull, 0x4B33A62ED433D4A3ull, 0x4D5A2DA51DE1AA47ull };
+
+} // namespace Internals
+//! @endcond
+
+inline void Hash::Multiply(uint64_t& low, uint64_t& high) noexcept
+{
+#if defined(__SIZEOF_INT128__)
+    __extension__ unsigned __int128 result = (unsigned __int128)low * high;
+    low = (uint64_t)result;
+    high = (uint64_t)(result >> 64);
+#elif defined(_MSC_VER) && defined(_M_X64)
+    low = _umul128(low, high, &high);
+#else
+    uint64_t hh = (low >> 32) * (high >> 32);
+    uint64_t hl = (low >> 32) * (uint32_t)high;
+    uint64_t lh = (uint32_t)low * (high >> 32);
+    uint64_t ll = (uint64_t)(uint32_t)low * (uint32_t)high;
+    uint64_t middle = (ll >> 32) + (uint32_t)hl + (uint32_t)lh;
+    low = (middle << 32) | (uint32_t)ll;
+    high = hh + (hl >> 32) + (lh >> 32) + (middle >> 32);
+#endif
+}
+
+inline uint64_t Hash::Fold(uint64_t value1, uint64_t value2) noexcept
+{
+    Multiply(value1, value2);
+    return value1 ^ value2;
+}
+
+constexpr uint64_t Hash::Mix(uint64_t value) noexcept
+{
+    value ^= value >> 30;
+    value *= 0xBF58476D1CE4E5B9ull;
+    value ^= value >> 27;
+    value *= 0x94D049BB133111EBull;
+    value ^= value >> 31;
+    return value;
+}
+
+inline uint64_t Hash::Mix(uint64_t value1, uint64_t value2) noexcept
+{
+    return Fold(value1 ^ Internals::WYHASH_SECRET[0], value2 ^ Internals::WYHASH_SECRET[1]);
+}
+
+inline uint64_t Hash::Calculate(const void* buffer, size_t size, uint64_t seed) noexcept
+{
+    const uint64_t* secret = Internals::WYHASH_SECRET;
+    const uint8_t* data = (const uint8_t*)buffer;
+
+    seed ^= Fold(seed ^ secret[0], secret[1]);
+
+    uint64_t a, b;
+    if (size <= 16)
+    {
+        if (size >= 4)
+        {
+            // Two overlapping pairs of 32-bit words cover keys from 4 to 16 bytes
+            size_t offset = (size >> 3) << 2;
+            a = ((uint64_t)Endian::LoadLittleEndian<uint32_t>(data) << 32) | Endian::LoadLittleEndian<uint32_t>(data + offset);
+            b = ((uint64_t)Endian::LoadLittleEndian<uint32_t>(data + size - 4) << 32) | Endian::LoadLittleEndian<uint32_t>(data + size - 4 - offset);
+        }
+        else if (size > 0)
+        {
+            a = ((uint64_t)data[0] << 16) | ((uint64_t)data[size >> 1] << 8) | data[size - 1];
+            b = 0;
+        }
+        else
+            a = b = 0;
+    }
+    else
+    {
+        size_t remain = size;
+
+        // Three independent lanes of 16 bytes
+        if (remain > 48)
+        {
+            uint64_t seed1 = seed;
+            uint64_t seed2 = seed;
+            do
+            {
+                seed = Fold(Endian::LoadLittleEndian<uint64_t>(data) ^ secret[1], Endian::LoadLittleEndian<uint64_t>(data + 8) ^ seed);
+                seed1 = Fold(Endian::LoadLittleEndian<uint64_t>(data + 16) ^ secret[2], Endian::LoadLittleEndian<uint64_t>(data + 24) ^ seed1);
+                seed2 = Fold(Endian::LoadLittleEndian<uint64_t>(data + 32) ^ secret[3], Endian::LoadLittleEndian<uint64_t>(data + 40) ^ seed2);
+                data += 48;
+                remain -= 48;
+            } while (remain > 48);
+            seed ^= seed1 ^ seed2;
+        }
+
+        while (remain > 16)
+        {
+            seed = Fold(Endian::LoadLittleEndian<uint64_t>(data) ^ secret[1], Endian::LoadLittleEndian<uint64_t>(data + 8) ^ seed);
+            data += 16;
+            remain -= 16;
+        }
+
+        // Last 16 bytes might overlap already processed ones
+        a = Endian::LoadLittleEndian<uint64_t>(data + remain - 16);
+        b = Endian::LoadLittleEndian<uint64_t>(data + remain - 8);
+    }
+
+    a ^= secret[1];
+    b ^= seed;
+    Multiply(a, b);
+    return Fold(a ^ secret[0] ^ size, b ^ secret[1]);
+}
+
+template <typename T>
+inline void HashCombine(size_t& seed, const T& value) noexcept(noexcept(FastHash<T>()(value)))
+{
+    seed = (size_t)Hash::Mix((uint64_t)seed, (uint64_t)FastHash<T>()(value));
+}
+
+} // namespace CppCommon
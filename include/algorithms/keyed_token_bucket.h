@@ -0,0 +1,146 @@
+/*!
+    \file keyed_token_bucket.h
+    \brief Keyed token bucket rate limit algorithm definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_ALGORITHMS_KEYED_TOKEN_BUCKET_H
+#define CPPCOMMON_ALGORITHMS_KEYED_TOKEN_BUCKET_H
+
+#include "containers/hashmap.h"
+#include "threads/locker.h"
+#include "threads/spin_lock.h"
+#include "time/timestamp.h"
+#include "utility/cache_aligned.h"
+#include "utility/shard_selector.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace CppCommon {
+
+//! Keyed token bucket rate limit algorithm
+/*!
+    Keyed token bucket limits the rate of tokens independently for each key
+    (e.g. client IP address or API key) with the same rate and burst.
+
+    State of each key bucket is a single 64-bit time value like TokenBucket,
+    and it is stored in the open-addressing hash map of one of shards selected
+    by the key hash. Each shard is guarded by its own lock, so consumers of
+    keys from different shards do not contend with each other.
+
+    Idle keys expire lazily: the bucket of the key that has accumulated all
+    burst tokens is equal to the new one, so it is removed from the shard when
+    the shard grows over its limit, without changing rate limit results.
+
+    Batch ConsumeMany() groups keys by shards, so each shard is locked once
+    per batch and the current time is read once for all keys.
+
+    Key equal to the blank key value must not be used.
+
+    Thread-safe.
+
+    https://en.wikipedia.org/wiki/Token_bucket
+*/
+template <typename TKey, typename THash = std::hash<TKey>, typename TEqual = std::equal_to<TKey>, class TLock = SpinLock>
+class KeyedTokenBucket
+{
+public:
+    //! Initialize the keyed token bucket
+    /*!
+        \param rate - Rate of tokens per second to accumulate in each key bucket
+        \param burst - Maximum of burst tokens in each key bucket
+        \param shards - Shards count (will be rounded up to the power of two, default is 64)
+        \param capacity - Initial capacity of each shard (default is 128)
+        \param blank - Blank key value (default is TKey())
+        \param hash - Key hasher (default is THash())
+        \param equal - Key comparator (default is TEqual())
+    */
+    explicit KeyedTokenBucket(uint64_t rate, uint64_t burst, size_t shards = 64, size_t capacity = 128, const TKey& blank = TKey(), const THash& hash = THash(), const TEqual& equal = TEqual());
+    KeyedTokenBucket(const KeyedTokenBucket&) = delete;
+    KeyedTokenBucket(KeyedTokenBucket&&) = delete;
+    ~KeyedTokenBucket() = default;
+
+    KeyedTokenBucket& operator=(const KeyedTokenBucket&) = delete;
+    KeyedTokenBucket& operator=(KeyedTokenBucket&&) = delete;
+
+    //! Get the count of tracked keys
+    /*!
+        Tracked keys include idle keys which were not expired yet. Keys are
+        counted per shard, so concurrent consumers may add keys to the shards
+        which were already counted.
+    */
+    size_t size() const;
+    //! Get the shards count
+    size_t shards() const noexcept { return _selector.count(); }
+
+    //! Try to consume the given count of tokens from the key bucket
+    /*!
+        \param key - Key of the bucket
+        \param tokens - Tokens to consume (default is 1)
+        \return 'true' if all tokens were successfully consumed, 'false' if the key bucket is lack of required count of tokens
+    */
+    bool Consume(const TKey& key, uint64_t tokens = 1);
+
+    //! Try to consume the given count of tokens from buckets of the given keys
+    /*!
+        \param keys - Keys of buckets
+        \param count - Count of keys
+        \param results - Results of consuming tokens for each key (could be nullptr)
+        \param tokens - Tokens to consume from each key bucket (default is 1)
+        \return Count of keys which tokens were successfully consumed
+    */
+    size_t ConsumeMany(const TKey* keys, size_t count, bool* results = nullptr, uint64_t tokens = 1);
+    //! Try to consume the given count of tokens from buckets of the given keys
+    /*!
+        \param keys - Keys of buckets
+        \param results - Results of consuming tokens for each key
+        \param tokens - Tokens to consume from each key bucket (default is 1)
+        \return Count of keys which tokens were successfully consumed
+    */
+    size_t ConsumeMany(const std::vector<TKey>& keys, std::vector<bool>& results, uint64_t tokens = 1);
+
+    //! Remove all idle keys
+    /*!
+        \return Count of removed idle keys
+    */
+    size_t Expire();
+
+    //! Clear all key buckets
+    void clear();
+
+private:
+    struct Shard
+    {
+        TLock lock;
+        HashMap<TKey, uint64_t, THash, TEqual> buckets;
+        size_t limit;
+
+        Shard(size_t capacity, const TKey& blank, const THash& hash, const TEqual& equal)
+            : buckets(capacity, blank, hash, equal), limit(capacity)
+        {}
+    };
+
+    THash _hash;
+    uint64_t _time_per_token;
+    uint64_t _time_per_burst;
+    size_t _capacity;
+    ShardSelector _selector;
+    std::vector<std::unique_ptr<CacheAligned<Shard>>> _shards;
+
+    size_t shard(const TKey& key) const noexcept;
+    bool ConsumeInternal(Shard& shard, const TKey& key, uint64_t delay, uint64_t now);
+    size_t ExpireInternal(Shard& shard, uint64_t now);
+};
+
+/*! \example algorithms_keyed_token_bucket.cpp Keyed token bucket rate limit algorithm example */
+
+} // namespace CppCommon
+
+#include "keyed_token_bucket.inl"
+
+#endif // CPPCOMMON_ALGORITHMS_KEYED_TOKEN_BUCKET_H
@@ -0,0 +1,182 @@
+/*!
+    \file keyed_token_bucket.inl
+    \brief Keyed token bucket rate limit algorithm inline implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+template <typename TKey, typename THash, typename TEqual, class TLock>
+inline KeyedTokenBucket<TKey, THash, TEqual, TLock>::KeyedTokenBucket(uint64_t rate, uint64_t burst, size_t shards, size_t capacity, const TKey& blank, const THash& hash, const TEqual& equal)
+    : _hash(hash),
+      _time_per_token(1000000000 / rate),
+      _time_per_burst(burst * _time_per_token),
+      _capacity(capacity),
+      _selector(shards)
+{
+    _shards.reserve(_selector.count());
+    for (size_t i = 0; i < _selector.count(); ++i)
+        _shards.emplace_back(std::make_unique<CacheAligned<Shard>>(std::in_place, capacity, blank, hash, equal));
+}
+
+template <typename TKey, typename THash, typename TEqual, class TLock>
+inline size_t KeyedTokenBucket<TKey, THash, TEqual, TLock>::size() const
+{
+    size_t result = 0;
+    for (const auto& current : _shards)
+    {
+        Locker<TLock> locker((*current)->lock);
+        result += (*current)->buckets.size();
+    }
+    return result;
+}
+
+template <typename TKey, typename THash, typename TEqual, class TLock>
+inline bool KeyedTokenBucket<TKey, THash, TEqual, TLock>::Consume(const TKey& key, uint64_t tokens)
+{
+    // Shift the current time with the burst time like TokenBucket does
+    uint64_t now = Timestamp::nano() + _time_per_burst;
+
+    Shard& current = _shards[shard(key)]->value();
+    Locker<TLock> locker(current.lock);
+    return ConsumeInternal(current, key, tokens * _time_per_token, now);
+}
+
+template <typename TKey, typename THash, typename TEqual, class TLock>
+inline size_t KeyedTokenBucket<TKey, THash, TEqual, TLock>::ConsumeMany(const TKey* keys, size_t count, bool* results, uint64_t tokens)
+{
+    // Shift the current time with the burst time like TokenBucket does
+    uint64_t now = Timestamp::nano() + _time_per_burst;
+    uint64_t delay = tokens * _time_per_token;
+
+    // Group keys by shards with the counting sort
+    thread_local std::vector<size_t> indexes;
+    thread_local std::vector<size_t> order;
+    thread_local std::vector<size_t> offsets;
+    indexes.resize(count);
+    order.resize(count);
+    offsets.assign(_selector.count() + 1, 0);
+    for (size_t i = 0; i < count; ++i)
+    {
+        indexes[i] = shard(keys[i]);
+        ++offsets[indexes[i] + 1];
+    }
+    for (size_t i = 0; i < _selector.count(); ++i)
+        offsets[i + 1] += offsets[i];
+    for (size_t i = 0; i < count; ++i)
+        order[offsets[indexes[i]]++] = i;
+
+    // Consume tokens locking each shard once
+    size_t result = 0;
+    size_t i = 0;
+    while (i < count)
+    {
+        size_t index = indexes[order[i]];
+        Shard& current = _shards[index]->value();
+        Locker<TLock> locker(current.lock);
+        for (; (i < count) && (indexes[order[i]] == index); ++i)
+        {
+            bool consumed = ConsumeInternal(current, keys[order[i]], delay, now);
+            if (results != nullptr)
+                results[order[i]] = consumed;
+            if (consumed)
+                ++result;
+        }
+    }
+    return result;
+}
+
+template <typename TKey, typename THash, typename TEqual, class TLock>
+inline size_t KeyedTokenBucket<TKey, THash, TEqual, TLock>::ConsumeMany(const std::vector<TKey>& keys, std::vector<bool>& results, uint64_t tokens)
+{
+    std::unique_ptr<bool[]> consumed = std::make_unique<bool[]>(keys.size());
+    size_t result = ConsumeMany(keys.data(), keys.size(), consumed.get(), tokens);
+    results.assign(consumed.get(), consumed.get() + keys.size());
+    return result;
+}
+
+template <typename TKey, typename THash, typename TEqual, class TLock>
+inline size_t KeyedTokenBucket<TKey, THash, TEqual, TLock>::Expire()
+{
+    uint64_t now = Timestamp::nano() + _time_per_burst;
+
+    size_t result = 0;
+    for (auto& current : _shards)
+    {
+        Locker<TLock> locker((*current)->lock);
+        result += ExpireInternal(**current, now);
+    }
+    return result;
+}
+
+template <typename TKey, typename THash, typename TEqual, class TLock>
+inline void KeyedTokenBucket<TKey, THash, TEqual, TLock>::clear()
+{
+    for (auto& current : _shards)
+    {
+        Locker<TLock> locker((*current)->lock);
+        (*current)->buckets.clear();
+        (*current)->limit = _capacity;
+    }
+}
+
+template <typename TKey, typename THash, typename TEqual, class TLock>
+inline size_t KeyedTokenBucket<TKey, THash, TEqual, TLock>::shard(const TKey& key) const noexcept
+{
+    return _selector(_hash(key));
+}
+
+template <typename TKey, typename THash, typename TEqual, class TLock>
+inline bool KeyedTokenBucket<TKey, THash, TEqual, TLock>::ConsumeInternal(Shard& shard, const TKey& key, uint64_t delay, uint64_t now)
+{
+    uint64_t minTime = now - _time_per_burst;
+
+    auto it = shard.buckets.find(key);
+    if (it == shard.buckets.end())
+    {
+        // New key bucket is full of burst tokens
+        if ((minTime + delay) > now)
+            return false;
+
+        // Lazy expire idle keys when the shard grows over its limit
+        if (shard.buckets.size() >= shard.limit)
+        {
+            ExpireInternal(shard, now);
+            shard.limit = std::max(_capacity, shard.buckets.size() * 2);
+        }
+
+        shard.buckets.emplace(key, minTime + delay);
+        return true;
+    }
+
+    // Previous consume performed long time ago... Shift the new time to the start of a new burst.
+    uint64_t newTime = std::max(it->second, minTime) + delay;
+
+    // No more tokens left in the bucket
+    if (newTime > now)
+        return false;
+
+    it->second = newTime;
+    return true;
+}
+
+template <typename TKey, typename THash, typename TEqual, class TLock>
+inline size_t KeyedTokenBucket<TKey, THash, TEqual, TLock>::ExpireInternal(Shard& shard, uint64_t now)
+{
+    uint64_t minTime = now - _time_per_burst;
+
+    // Idle key buckets are full of burst tokens, so they are equal to new ones
+    std::vector<TKey> idle;
+    for (const auto& bucket : shard.buckets)
+        if (bucket.second <= minTime)
+            idle.push_back(bucket.first);
+
+    for (const auto& key : idle)
+        shard.buckets.erase(key);
+
+    return idle.size();
+}
+
+} // namespace CppCommon
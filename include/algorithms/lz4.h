@@ -0,0 +1,81 @@
+/*!
+    \file lz4.h
+    \brief LZ4 block compression algorithm definition
+    \author Ivan Shynkarenka
+    \date 15.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_ALGORITHMS_LZ4_H
+#define CPPCOMMON_ALGORITHMS_LZ4_H
+
+#include <cstddef>
+#include <cstdint>
+
+namespace CppCommon {
+
+//! LZ4 block compression algorithm
+/*!
+    LZ4 is the fast lossless compression algorithm with the decompression
+    speed of several gigabytes per second. Compressed blocks are compatible
+    with the reference LZ4 block format, so they could be decompressed by
+    other LZ4 implementations and vice versa.
+
+    Compression is the single pass greedy matching with the hash table of
+    4096 entries, which gives the compression ratio close to the reference
+    fast compression level.
+
+    Decompression validates the compressed block and never reads or writes
+    out of the given buffers, so it is safe for the untrusted input.
+
+    Thread-safe.
+
+    https://github.com/lz4/lz4/blob/dev/doc/lz4_Block_format.md
+*/
+class LZ4
+{
+public:
+    LZ4() = delete;
+    LZ4(const LZ4&) = delete;
+    LZ4(LZ4&&) = delete;
+    ~LZ4() = delete;
+
+    LZ4& operator=(const LZ4&) = delete;
+    LZ4& operator=(LZ4&&) = delete;
+
+    //! Get the maximal compressed size of the given count of bytes
+    /*!
+        \param size - Count of bytes to compress
+        \return Maximal compressed size
+    */
+    static size_t Bound(size_t size) noexcept { return size + (size / 255) + 16; }
+
+    //! Compress the given buffer into the LZ4 block
+    /*!
+        \param source - Buffer to compress
+        \param size - Buffer size
+        \param destination - Destination buffer
+        \param capacity - Destination buffer capacity (must not be less than Bound(size))
+        \return Compressed block size or 0 if the destination buffer capacity is less than Bound(size)
+    */
+    static size_t Compress(const void* source, size_t size, void* destination, size_t capacity) noexcept;
+
+    //! Decompress the given LZ4 block
+    /*!
+        Linked blocks (e.g. LZ4 frames with dependent blocks) refer the data
+        of previous blocks, which must be placed in the given count of bytes
+        just before the destination buffer.
+
+        \param source - Compressed block
+        \param size - Compressed block size
+        \param destination - Destination buffer
+        \param capacity - Destination buffer capacity
+        \param prefix - Count of bytes of previous blocks before the destination buffer (default is 0)
+        \return Decompressed size or -1 if the compressed block is malformed or does not fit into the destination buffer
+    */
+    static size_t Decompress(const void* source, size_t size, void* destination, size_t capacity, size_t prefix = 0) noexcept;
+};
+
+} // namespace CppCommon
+
+#endif // CPPCOMMON_ALGORITHMS_LZ4_H
@@ -0,0 +1,205 @@
+/*!
+    \file parallel.h
+    \brief Parallel algorithms definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_ALGORITHMS_PARALLEL_H
+#define CPPCOMMON_ALGORITHMS_PARALLEL_H
+
+#include "algorithms/radix_sort.h"
+#include "containers/flatmap.h"
+#include "threads/thread_pool.h"
+#include "threads/wait_strategy.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <exception>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace CppCommon {
+
+/*!
+    Parallel algorithms split the given random access range into chunks of the
+    grain size and process chunks in workers of the thread pool. The calling
+    thread processes chunks as well, so parallel algorithms could be called from
+    the thread pool tasks without the risk of deadlock.
+
+    If the grain size is not given it is adapted to the range size and workers
+    count: the range is split into several chunks per worker, but each chunk is
+    not less than PARALLEL_MIN_GRAIN items. Ranges which fit into a single chunk
+    are processed inline in the calling thread without the thread pool.
+
+    If the function throws an exception the rest of chunks are skipped and the
+    first exception is rethrown in the calling thread.
+*/
+
+//! Minimal adaptive grain size of parallel algorithms
+const size_t PARALLEL_MIN_GRAIN = 1024;
+
+//! Parallel for each item of the given range
+/*!
+    Function is called as fn(item) for each item of the range.
+
+    \param pool - Thread pool
+    \param first - The first iterator of the range
+    \param last - The last iterator of the range
+    \param fn - Function to call
+    \param grain - Grain size (default is 0 - adaptive)
+*/
+template <class TIterator, class TFunction>
+void ParallelFor(ThreadPool& pool, TIterator first, TIterator last, TFunction&& fn, size_t grain = 0);
+
+//! Parallel transform items of the given range into the output range
+/*!
+    Function is called as fn(item) for each item of the range and the result
+    is assigned to the corresponding item of the output range.
+
+    \param pool - Thread pool
+    \param first - The first iterator of the range
+    \param last - The last iterator of the range
+    \param output - The first random access iterator of the output range
+    \param fn - Transform function
+    \param grain - Grain size (default is 0 - adaptive)
+    \return Iterator to the end of the output range
+*/
+template <class TIterator, class TOutputIterator, class TFunction>
+TOutputIterator ParallelTransform(ThreadPool& pool, TIterator first, TIterator last, TOutputIterator output, TFunction&& fn, size_t grain = 0);
+
+//! Parallel reduce items of the given range
+/*!
+    Each chunk is reduced in its worker and chunk results are reduced with the
+    initial value in the calling thread in the order of chunks. Reduce function
+    is called as reduce(value, item) and must be associative.
+
+    \param pool - Thread pool
+    \param first - The first iterator of the range
+    \param last - The last iterator of the range
+    \param init - Initial value
+    \param reduce - Reduce function
+    \param grain - Grain size (default is 0 - adaptive)
+    \return Reduced value
+*/
+template <class TIterator, typename T, class TReduce>
+T ParallelReduce(ThreadPool& pool, TIterator first, TIterator last, T init, TReduce&& reduce, size_t grain = 0);
+
+//! Parallel stable sort items of the given range
+/*!
+    Parallel merge sort: chunks are sorted in workers and then merged pairwise
+    in log2(chunks) parallel rounds. Equal items keep their relative order.
+
+    \param pool - Thread pool
+    \param first - The first iterator of the range
+    \param last - The last iterator of the range
+    \param compare - Items comparator (default is std::less)
+    \param grain - Grain size (default is 0 - adaptive)
+*/
+template <class TIterator, class TCompare = std::less<>>
+void ParallelSort(ThreadPool& pool, TIterator first, TIterator last, TCompare compare = TCompare(), size_t grain = 0);
+
+//! Parallel radix sort integral items of the given range
+/*!
+    Parallel MSD radix sort: items are scattered into 256 buckets by the most
+    significant byte which differs between keys with parallel histograms  and
+    parallel stable scatter of chunks. Then buckets are sorted by lower bytes
+    with LSD radix sort in workers. Equal items keep their relative order.
+
+    Buckets are sorted independently, so heavily skewed keys which fall into a
+    few buckets are sorted with lower parallelism.
+
+    \param pool - Thread pool
+    \param first - The first iterator of the range
+    \param last - The last iterator of the range
+    \param grain - Grain size (default is 0 - adaptive)
+*/
+template <class TIterator>
+void ParallelRadixSort(ThreadPool& pool, TIterator first, TIterator last, size_t grain = 0);
+
+//! Parallel radix sort items of the given range by the extracted integral key
+/*!
+    Key function is called as key(item) from several threads and must return
+    an integer or enum.
+
+    \param pool - Thread pool
+    \param first - The first iterator of the range
+    \param last - The last iterator of the range
+    \param key - Key function
+    \param grain - Grain size (default is 0 - adaptive)
+*/
+template <class TIterator, class TKey, typename = std::enable_if_t<std::is_invocable_v<TKey&, typename std::iterator_traits<TIterator>::reference>>>
+void ParallelRadixSort(ThreadPool& pool, TIterator first, TIterator last, TKey&& key, size_t grain = 0);
+
+//! Parallel build of the flat map from the given range of key/value pairs
+/*!
+    Items are parallel sorted by keys and passed into the flat map with a single
+    sorted bulk insert. If some key is repeated in the range only the first item
+    with the key is inserted. Integral keys ordered with std::less are sorted
+    with parallel radix sort.
+
+    \param pool - Thread pool
+    \param first - The first iterator of the key/value pairs range
+    \param last - The last iterator of the key/value pairs range
+    \param grain - Grain size (default is 0 - adaptive)
+    \return Flat map with inserted items
+*/
+template <class TFlatMap, class TIterator>
+TFlatMap ParallelFlatMap(ThreadPool& pool, TIterator first, TIterator last, size_t grain = 0);
+
+//! @cond INTERNALS
+namespace Internals {
+
+//! Calculate the grain size of the parallel algorithm
+size_t ParallelGrain(const ThreadPool& pool, size_t size, size_t grain) noexcept;
+
+//! Parallel job of processing chunks
+template <class TChunk>
+class ParallelJob
+{
+public:
+    ParallelJob(size_t size, size_t grain, size_t chunks, TChunk&& chunk);
+
+    //! Process chunks until all of them are taken
+    void Process();
+    //! Wait until all chunks are processed and rethrow the first exception
+    void Wait();
+
+private:
+    std::atomic<size_t> _next;
+    std::atomic<size_t> _done;
+    std::atomic<bool> _failed;
+    size_t _size;
+    size_t _grain;
+    size_t _chunks;
+    TChunk _chunk;
+    std::mutex _lock;
+    std::exception_ptr _exception;
+    WaitStrategy _finished;
+};
+
+//! Process chunks of the given size in parallel
+/*!
+    Chunk function is called as chunk(index, begin, end) for each chunk.
+*/
+template <class TChunk>
+void ParallelChunks(ThreadPool& pool, size_t size, size_t grain, TChunk&& chunk);
+
+} // namespace Internals
+//! @endcond
+
+/*! \example algorithms_parallel.cpp Parallel algorithms example */
+
+} // namespace CppCommon
+
+#include "parallel.inl"
+
+#endif // CPPCOMMON_ALGORITHMS_PARALLEL_H
@@ -0,0 +1,310 @@
+/*!
+    \file parallel.inl
+    \brief Parallel algorithms inline implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+namespace Internals {
+
+inline size_t ParallelGrain(const ThreadPool& pool, size_t size, size_t grain) noexcept
+{
+    if (grain > 0)
+        return grain;
+
+    // Split the range into several chunks per worker to balance uneven chunks
+    return std::max(size / (std::max(pool.threads(), (size_t)1) * 4), PARALLEL_MIN_GRAIN);
+}
+
+template <class TChunk>
+inline ParallelJob<TChunk>::ParallelJob(size_t size, size_t grain, size_t chunks, TChunk&& chunk)
+    : _next(0), _done(0), _failed(false), _size(size), _grain(grain), _chunks(chunks), _chunk(std::forward<TChunk>(chunk))
+{
+}
+
+template <class TChunk>
+inline void ParallelJob<TChunk>::Process()
+{
+    for (;;)
+    {
+        // Late helpers exit here without touching the chunk function
+        size_t index = _next.fetch_add(1, std::memory_order_relaxed);
+        if (index >= _chunks)
+            return;
+
+        if (!_failed.load(std::memory_order_relaxed))
+        {
+            size_t begin = index * _grain;
+            size_t end = std::min(begin + _grain, _size);
+            try
+            {
+                _chunk(index, begin, end);
+            }
+            catch (...)
+            {
+                std::scoped_lock locker(_lock);
+                if (!_exception)
+                    _exception = std::current_exception();
+                _failed.store(true, std::memory_order_relaxed);
+            }
+        }
+
+        if ((_done.fetch_add(1, std::memory_order_acq_rel) + 1) == _chunks)
+            _finished.Notify();
+    }
+}
+
+template <class TChunk>
+inline void ParallelJob<TChunk>::Wait()
+{
+    _finished.Wait([this]() { return (_done.load(std::memory_order_acquire) == _chunks); });
+
+    if (_exception)
+        std::rethrow_exception(_exception);
+}
+
+template <class TChunk>
+inline void ParallelChunks(ThreadPool& pool, size_t size, size_t grain, TChunk&& chunk)
+{
+    if (size == 0)
+        return;
+
+    grain = ParallelGrain(pool, size, grain);
+    size_t chunks = (size + grain - 1) / grain;
+
+    // Process the single chunk inline
+    if (chunks == 1)
+    {
+        chunk(0, 0, size);
+        return;
+    }
+
+    // Job is shared with helper tasks which could start after the algorithm is finished
+    auto job = std::make_shared<ParallelJob<std::decay_t<TChunk>>>(size, grain, chunks, std::decay_t<TChunk>(std::forward<TChunk>(chunk)));
+
+    size_t helpers = std::min(chunks - 1, pool.threads());
+    for (size_t i = 0; i < helpers; ++i)
+        pool.Submit([job]() { job->Process(); });
+
+    // Process chunks in the calling thread as well
+    job->Process();
+    job->Wait();
+}
+
+} // namespace Internals
+//! @endcond
+
+template <class TIterator, class TFunction>
+inline void ParallelFor(ThreadPool& pool, TIterator first, TIterator last, TFunction&& fn, size_t grain)
+{
+    size_t size = (size_t)std::distance(first, last);
+    Internals::ParallelChunks(pool, size, grain, [first, &fn](size_t, size_t begin, size_t end)
+    {
+        TIterator it = first + begin;
+        for (size_t i = begin; i < end; ++i, ++it)
+            fn(*it);
+    });
+}
+
+template <class TIterator, class TOutputIterator, class TFunction>
+inline TOutputIterator ParallelTransform(ThreadPool& pool, TIterator first, TIterator last, TOutputIterator output, TFunction&& fn, size_t grain)
+{
+    size_t size = (size_t)std::distance(first, last);
+    Internals::ParallelChunks(pool, size, grain, [first, output, &fn](size_t, size_t begin, size_t end)
+    {
+        TIterator it = first + begin;
+        TOutputIterator result = output + begin;
+        for (size_t i = begin; i < end; ++i, ++it, ++result)
+            *result = fn(*it);
+    });
+    return output + size;
+}
+
+template <class TIterator, typename T, class TReduce>
+inline T ParallelReduce(ThreadPool& pool, TIterator first, TIterator last, T init, TReduce&& reduce, size_t grain)
+{
+    size_t size = (size_t)std::distance(first, last);
+    if (size == 0)
+        return init;
+
+    grain = Internals::ParallelGrain(pool, size, grain);
+    size_t chunks = (size + grain - 1) / grain;
+
+    // Reduce each chunk starting with its first item
+    std::vector<std::optional<T>> partials(chunks);
+    Internals::ParallelChunks(pool, size, grain, [first, &partials, &reduce](size_t index, size_t begin, size_t end)
+    {
+        TIterator it = first + begin;
+        T result(*it);
+        for (size_t i = begin + 1; i < end; ++i)
+            result = reduce(std::move(result), *++it);
+        partials[index].emplace(std::move(result));
+    });
+
+    // Reduce chunks results in order
+    for (auto& partial : partials)
+        init = reduce(std::move(init), std::move(*partial));
+    return init;
+}
+
+template <class TIterator, class TCompare>
+inline void ParallelSort(ThreadPool& pool, TIterator first, TIterator last, TCompare compare, size_t grain)
+{
+    size_t size = (size_t)std::distance(first, last);
+    if (size == 0)
+        return;
+
+    grain = Internals::ParallelGrain(pool, size, grain);
+
+    // Sort chunks
+    Internals::ParallelChunks(pool, size, grain, [first, &compare](size_t, size_t begin, size_t end)
+    {
+        std::stable_sort(first + begin, first + end, compare);
+    });
+
+    // Merge pairs of sorted runs doubling the run width each round
+    for (size_t width = grain; width < size; width *= 2)
+    {
+        size_t pairs = (size + 2 * width - 1) / (2 * width);
+        Internals::ParallelChunks(pool, pairs, 1, [first, &compare, size, width](size_t, size_t begin, size_t end)
+        {
+            for (size_t pair = begin; pair < end; ++pair)
+            {
+                size_t low = pair * 2 * width;
+                size_t middle = std::min(low + width, size);
+                size_t high = std::min(low + 2 * width, size);
+                if (middle < high)
+                    std::inplace_merge(first + low, first + middle, first + high, compare);
+            }
+        });
+    }
+}
+
+template <class TIterator>
+inline void ParallelRadixSort(ThreadPool& pool, TIterator first, TIterator last, size_t grain)
+{
+    ParallelRadixSort(pool, first, last, Internals::RadixIdentity(), grain);
+}
+
+template <class TIterator, class TKey, typename>
+inline void ParallelRadixSort(ThreadPool& pool, TIterator first, TIterator last, TKey&& key, size_t grain)
+{
+    typedef typename std::iterator_traits<TIterator>::value_type T;
+    typedef Internals::RadixKeyType<TIterator, TKey> K;
+
+    size_t size = (size_t)std::distance(first, last);
+    grain = Internals::ParallelGrain(pool, size, grain);
+
+    // Sort the single chunk inline
+    if (size <= grain)
+    {
+        RadixSort(first, last, key);
+        return;
+    }
+
+    size_t chunks = (size + grain - 1) / grain;
+
+    // Find bits which differ between keys
+    K head = Internals::RadixKey(key(*first));
+    std::vector<K> diffs(chunks);
+    Internals::ParallelChunks(pool, size, grain, [first, &key, &diffs, head](size_t index, size_t begin, size_t end)
+    {
+        K diff = 0;
+        for (size_t i = begin; i < end; ++i)
+            diff |= Internals::RadixKey(key(first[i])) ^ head;
+        diffs[index] = diff;
+    });
+    K diff = 0;
+    for (auto value : diffs)
+        diff |= value;
+
+    // All keys are equal, so the stable sort keeps the range as is
+    if (diff == 0)
+        return;
+
+    // The most significant byte which differs between keys
+    size_t bytes = (size_t)((std::bit_width(diff) - 1) / 8);
+    size_t shift = bytes * 8;
+
+    // Count histograms of chunks
+    std::vector<std::array<size_t, 256>> counts(chunks);
+    Internals::ParallelChunks(pool, size, grain, [first, &key, &counts, shift](size_t index, size_t begin, size_t end)
+    {
+        auto& histogram = counts[index];
+        histogram.fill(0);
+        for (size_t i = begin; i < end; ++i)
+            ++histogram[(size_t)((Internals::RadixKey(key(first[i])) >> shift) & 0xFF)];
+    });
+
+    // Calculate bucket bounds and scatter offsets of chunks inside buckets
+    std::array<size_t, 257> bounds;
+    size_t sum = 0;
+    for (size_t d = 0; d < 256; ++d)
+    {
+        bounds[d] = sum;
+        for (auto& histogram : counts)
+        {
+            size_t count = histogram[d];
+            histogram[d] = sum;
+            sum += count;
+        }
+    }
+    bounds[256] = sum;
+
+    // Scatter chunks into buckets keeping the order of equal keys
+    std::unique_ptr<T[]> buffer(new T[size]);
+    T* scratch = buffer.get();
+    Internals::ParallelChunks(pool, size, grain, [first, &key, &counts, scratch, shift](size_t index, size_t begin, size_t end)
+    {
+        auto& offsets = counts[index];
+        for (size_t i = begin; i < end; ++i)
+            scratch[offsets[(size_t)((Internals::RadixKey(key(first[i])) >> shift) & 0xFF)]++] = std::move(first[i]);
+    });
+
+    // Sort buckets by lower bytes and move them back into the range
+    Internals::ParallelChunks(pool, 256, 1, [first, &key, &bounds, scratch, bytes](size_t, size_t begin, size_t end)
+    {
+        for (size_t d = begin; d < end; ++d)
+        {
+            size_t low = bounds[d];
+            size_t count = bounds[d + 1] - low;
+            if (count == 0)
+                continue;
+
+            bool sorted = false;
+            if (count < RADIX_SORT_MIN_SIZE)
+                std::stable_sort(scratch + low, scratch + low + count, [&key](const T& item1, const T& item2) { return Internals::RadixKey(key(item1)) < Internals::RadixKey(key(item2)); });
+            else
+                sorted = Internals::RadixSortPasses(scratch + low, first + low, count, key, bytes);
+
+            if (!sorted)
+                std::move(scratch + low, scratch + low + count, first + low);
+        }
+    });
+}
+
+template <class TFlatMap, class TIterator>
+inline TFlatMap ParallelFlatMap(ThreadPool& pool, TIterator first, TIterator last, size_t grain)
+{
+    typedef typename TFlatMap::key_type K;
+
+    TFlatMap result;
+
+    // Stable sort keeps the first item of repeated keys before others
+    std::vector<typename TFlatMap::value_type> items(first, last);
+    if constexpr ((std::is_integral_v<K> || std::is_enum_v<K>) && !std::is_same_v<K, bool> && std::is_same_v<typename TFlatMap::key_compare, std::less<K>>)
+        ParallelRadixSort(pool, items.begin(), items.end(), [](const auto& item) { return item.first; }, grain);
+    else
+        ParallelSort(pool, items.begin(), items.end(), [&result](const auto& item1, const auto& item2) { return result.compare(item1, item2); }, grain);
+    auto end = std::unique(items.begin(), items.end(), [&result](const auto& item1, const auto& item2) { return !result.compare(item1, item2); });
+
+    result.reserve(std::distance(items.begin(), end));
+    result.insert(sorted_unique, std::make_move_iterator(items.begin()), std::make_move_iterator(end));
+    return result;
+}
+
+} // namespace CppCommon
@@ -0,0 +1,104 @@
+/*!
+    \file radix_sort.h
+    \brief Radix sort algorithm definition
+    \author Ivan Shynkarenka
+    \date 15.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_ALGORITHMS_RADIX_SORT_H
+#define CPPCOMMON_ALGORITHMS_RADIX_SORT_H
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace CppCommon {
+
+/*!
+    Radix sort is a stable LSD (least significant digit first) sort of items
+    by integral keys with 8-bit digits. Histograms of all digits are counted
+    in a single pass over the range, digits which are the same for all keys
+    (e.g. high bytes of timestamps or small identifiers) are skipped, so the
+    range is scattered only once per significant byte of keys.
+
+    Keys are integers or enums. Signed keys are sorted in the natural order.
+    Items could be sorted by the key extracted with the given key function,
+    e.g. by Timestamp::total() or by the integer field of the struct.
+
+    Radix sort uses the temporary buffer of the range size, so items must be
+    default constructible and move assignable. Short ranges are sorted with
+    std::stable_sort.
+
+    Parallel MSD variant ParallelRadixSort() is declared in parallel.h.
+
+    Not thread-safe.
+
+    https://en.wikipedia.org/wiki/Radix_sort
+*/
+
+//! Minimal range size to be sorted with radix sort instead of std::stable_sort
+const size_t RADIX_SORT_MIN_SIZE = 256;
+
+//! Radix sort integral items of the given range
+/*!
+    \param first - The first random access iterator of the range
+    \param last - The last random access iterator of the range
+*/
+template <class TIterator>
+void RadixSort(TIterator first, TIterator last);
+
+//! Radix sort items of the given range by the extracted integral key
+/*!
+    Key function is called as key(item) and must return an integer or enum.
+
+    \param first - The first random access iterator of the range
+    \param last - The last random access iterator of the range
+    \param key - Key function
+*/
+template <class TIterator, class TKey>
+void RadixSort(TIterator first, TIterator last, TKey&& key);
+
+//! @cond INTERNALS
+namespace Internals {
+
+//! Convert the integral key into the unsigned key with the same order
+template <typename T>
+constexpr auto RadixKey(T value) noexcept;
+
+//! Radix key type of the given key function
+template <class TIterator, class TKey>
+using RadixKeyType = decltype(RadixKey(std::declval<TKey&>()(*std::declval<TIterator>())));
+
+//! Identity key function of radix sort
+struct RadixIdentity
+{
+    template <typename T>
+    constexpr const T& operator()(const T& value) const noexcept { return value; }
+};
+
+//! Radix sort the given data by the given count of low key bytes using the scratch buffer
+/*!
+    \param data - The first random access iterator of the data
+    \param scratch - The first random access iterator of the scratch buffer
+    \param size - Size of the data
+    \param key - Key function
+    \param bytes - Count of low key bytes to sort
+    \return 'true' if sorted items are placed into the scratch buffer, 'false' if into the data
+*/
+template <class TData, class TScratch, class TKey>
+bool RadixSortPasses(TData data, TScratch scratch, size_t size, TKey& key, size_t bytes);
+
+} // namespace Internals
+//! @endcond
+
+/*! \example algorithms_radix_sort.cpp Radix sort algorithm example */
+
+} // namespace CppCommon
+
+#include "radix_sort.inl"
+
+#endif // CPPCOMMON_ALGORITHMS_RADIX_SORT_H
@@ -0,0 +1,118 @@
+/*!
+    \file radix_sort.inl
+    \brief Radix sort algorithm inline implementation
+    \author Ivan Shynkarenka
+    \date 15.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+namespace Internals {
+
+template <typename T>
+constexpr auto RadixKey(T value) noexcept
+{
+    if constexpr (std::is_enum_v<T>)
+        return RadixKey((std::underlying_type_t<T>)value);
+    else
+    {
+        static_assert(std::is_integral_v<T> && !std::is_same_v<T, bool>, "Radix sort key must be an integer or enum!");
+
+        typedef std::make_unsigned_t<T> U;
+        if constexpr (std::is_signed_v<T>)
+        {
+            // Flip the sign bit, so negative keys are ordered before positive ones
+            return (U)((U)value ^ ((U)1 << (sizeof(U) * 8 - 1)));
+        }
+        else
+            return (U)value;
+    }
+}
+
+template <class TData, class TScratch, class TKey>
+inline bool RadixSortPasses(TData data, TScratch scratch, size_t size, TKey& key, size_t bytes)
+{
+    typedef decltype(RadixKey(key(*data))) K;
+
+    if ((size < 2) || (bytes == 0))
+        return false;
+
+    // Count histograms of all digits in a single pass
+    size_t counts[sizeof(K)][256] = {};
+    for (size_t i = 0; i < size; ++i)
+    {
+        K value = RadixKey(key(data[i]));
+        for (size_t b = 0; b < bytes; ++b)
+            ++counts[b][(size_t)((value >> (b * 8)) & 0xFF)];
+    }
+
+    bool swapped = false;
+    for (size_t b = 0; b < bytes; ++b)
+    {
+        size_t shift = b * 8;
+
+        // Skip the digit which is the same for all keys
+        K any = swapped ? RadixKey(key(scratch[0])) : RadixKey(key(data[0]));
+        if (counts[b][(size_t)((any >> shift) & 0xFF)] == size)
+            continue;
+
+        size_t offsets[256];
+        size_t sum = 0;
+        for (size_t d = 0; d < 256; ++d)
+        {
+            offsets[d] = sum;
+            sum += counts[b][d];
+        }
+
+        // Scatter items by the digit keeping the order of equal digits
+        if (swapped)
+        {
+            for (size_t i = 0; i < size; ++i)
+                data[offsets[(size_t)((RadixKey(key(scratch[i])) >> shift) & 0xFF)]++] = std::move(scratch[i]);
+        }
+        else
+        {
+            for (size_t i = 0; i < size; ++i)
+                scratch[offsets[(size_t)((RadixKey(key(data[i])) >> shift) & 0xFF)]++] = std::move(data[i]);
+        }
+
+        swapped = !swapped;
+    }
+
+    return swapped;
+}
+
+} // namespace Internals
+//! @endcond
+
+template <class TIterator>
+inline void RadixSort(TIterator first, TIterator last)
+{
+    RadixSort(first, last, Internals::RadixIdentity());
+}
+
+template <class TIterator, class TKey>
+inline void RadixSort(TIterator first, TIterator last, TKey&& key)
+{
+    typedef typename std::iterator_traits<TIterator>::value_type T;
+    typedef Internals::RadixKeyType<TIterator, TKey> K;
+
+    size_t size = (size_t)std::distance(first, last);
+    if (size < 2)
+        return;
+
+    if (size < RADIX_SORT_MIN_SIZE)
+    {
+        std::stable_sort(first, last, [&key](const T& item1, const T& item2) { return Internals::RadixKey(key(item1)) < Internals::RadixKey(key(item2)); });
+        return;
+    }
+
+    // Default initialized buffer avoids zeroing of trivial items
+    std::unique_ptr<T[]> buffer(new T[size]);
+    if (Internals::RadixSortPasses(first, buffer.get(), size, key, sizeof(K)))
+        std::move(buffer.get(), buffer.get() + size, first);
+}
+
+} // namespace CppCommon
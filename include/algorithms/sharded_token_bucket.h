@@ -0,0 +1,96 @@
+/*!
+    \file sharded_token_bucket.h
+    \brief Sharded token bucket rate limit algorithm definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_ALGORITHMS_SHARDED_TOKEN_BUCKET_H
+#define CPPCOMMON_ALGORITHMS_SHARDED_TOKEN_BUCKET_H
+
+#include "algorithms/token_bucket.h"
+#include "utility/cache_aligned.h"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+namespace CppCommon {
+
+//! Sharded token bucket rate limit algorithm
+/*!
+    Lock-free hierarchical implementation of the token bucket rate limit
+    algorithm for highly contended global limits.
+
+    Each thread consumes tokens from its local sub-bucket (shard), which is
+    shared only with a few other threads. When the shard runs out of tokens,
+    the thread refills it in bulk with a batch of tokens from the global token
+    bucket. So most of consumers modify only their shard cache line, and the
+    global token bucket is contended once per batch.
+
+    Tokens drawn into shards but not consumed yet are still counted by the
+    global token bucket, so the rate limit could be exceeded by at most the
+    given tolerance (count of shards multiplied by the batch size). Zero
+    tolerance makes the sharded token bucket as accurate as TokenBucket.
+
+    Thread-safe.
+
+    https://en.wikipedia.org/wiki/Token_bucket
+*/
+class ShardedTokenBucket
+{
+public:
+    //! Initialize the sharded token bucket
+    /*!
+        Initializes the sharded token bucket to accumulate the given count of
+        tokens per second, with a maximum of burst tokens and the given tolerance.
+
+        \param rate - Rate of tokens per second to accumulate in the token bucket
+        \param burst - Maximum of burst tokens in the token bucket
+        \param tolerance - Maximum of tokens which could be consumed over the rate limit (default is 1% of the rate)
+        \param shards - Count of shards (default is 0 for the count of hardware threads)
+    */
+    ShardedTokenBucket(uint64_t rate, uint64_t burst, uint64_t tolerance = (uint64_t)-1, size_t shards = 0);
+    ShardedTokenBucket(const ShardedTokenBucket&) = delete;
+    ShardedTokenBucket(ShardedTokenBucket&&) = delete;
+    ~ShardedTokenBucket() = default;
+
+    ShardedTokenBucket& operator=(const ShardedTokenBucket&) = delete;
+    ShardedTokenBucket& operator=(ShardedTokenBucket&&) = delete;
+
+    //! Get the count of shards
+    size_t shards() const noexcept { return _shards; }
+    //! Get the count of tokens to refill the shard from the global token bucket
+    uint64_t batch() const noexcept { return _batch; }
+    //! Get the maximum of tokens which could be consumed over the rate limit
+    uint64_t tolerance() const noexcept { return (_batch > 1) ? (_shards * _batch) : 0; }
+
+    //! Try to consume the given count of tokens
+    /*!
+        \param tokens - Tokens to consume (default is 1)
+        \return 'true' if all tokens were successfully consumed, 'false' if the token bucket is lack of required count of tokens
+    */
+    bool Consume(uint64_t tokens = 1);
+
+private:
+    struct Shard
+    {
+        std::atomic<uint64_t> tokens;
+
+        Shard() : tokens(0) {}
+    };
+
+    // Global token bucket and shards are cache aligned, so refills of the
+    // global token bucket do not invalidate cache lines of shard consumers
+    CacheAligned<TokenBucket> _global;
+    size_t _shards;
+    uint64_t _batch;
+    std::unique_ptr<CacheAligned<Shard>[]> _buckets;
+};
+
+/*! \example algorithms_sharded_token_bucket.cpp Sharded token bucket rate limit algorithm example */
+
+} // namespace CppCommon
+
+#endif // CPPCOMMON_ALGORITHMS_SHARDED_TOKEN_BUCKET_H
@@ -9,6 +9,8 @@
 #ifndef CPPCOMMON_ALGORITHMS_TOKEN_BUCKET_H
 #define CPPCOMMON_ALGORITHMS_TOKEN_BUCKET_H
 
+#include "time/timespan.h"
+
 #include <atomic>
 #include <cstdint>
 
@@ -56,10 +58,48 @@ public:
     */
     bool Consume(uint64_t tokens = 1);
 
+    //! Predict the wait time until the given count of tokens becomes available
+    /*!
+        Tokens are not consumed, so the prediction could be outdated by other
+        consumers of the token bucket.
+
+        \param tokens - Tokens to wait for (default is 1)
+        \return Wait timespan (zero if tokens are available right now)
+    */
+    Timespan WaitTime(uint64_t tokens = 1) const;
+
+    //! Reserve the given count of tokens
+    /*!
+        Tokens are always consumed, even if they are not accumulated yet. The
+        caller must wait for the returned timespan before using reserved tokens.
+        Following consumers of the token bucket wait for reserved tokens too,
+        so the rate limit is kept exactly without spinning on Consume().
+
+        \param tokens - Tokens to reserve (default is 1)
+        \return Wait timespan until reserved tokens become available (zero if they are available right now)
+    */
+    Timespan Reserve(uint64_t tokens = 1);
+
+    //! Try to consume the given count of tokens or wait for them for the given timeout
+    /*!
+        If the tokens become available within the given timeout, they are
+        reserved and the calling thread sleeps exactly until they are
+        accumulated. Otherwise tokens are not consumed and the method returns
+        immediately without sleeping.
+
+        \param tokens - Tokens to consume
+        \param timeout - Wait timeout
+        \return 'true' if all tokens were successfully consumed, 'false' if the token bucket will be lack of required count of tokens after the given timeout
+    */
+    bool ConsumeOrWaitFor(uint64_t tokens, const Timespan& timeout);
+
 private:
     std::atomic<uint64_t> _time;
     std::atomic<uint64_t> _time_per_token;
     std::atomic<uint64_t> _time_per_burst;
+
+    //! Consume tokens which become available within the given wait limit in nanoseconds (returns the wait time or UINT64_MAX)
+    uint64_t Acquire(uint64_t tokens, uint64_t limit);
 };
 
 /*! \example algorithms_token_bucket.cpp Token bucket rate limit algorithm example */
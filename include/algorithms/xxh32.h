@@ -0,0 +1,98 @@
+/*!
+    \file xxh32.h
+    \brief XXH32 checksum algorithm definition
+    \author Ivan Shynkarenka
+    \date 15.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_ALGORITHMS_XXH32_H
+#define CPPCOMMON_ALGORITHMS_XXH32_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace CppCommon {
+
+//! XXH32 checksum algorithm
+/*!
+    XXH32 is the fast 32-bit non-cryptographic checksum, which processes 16
+    bytes per iteration in four independent lanes. It is used by LZ4 frames
+    for header, block and content checksums. Values are the same on all
+    platforms and compatible with the reference implementation.
+
+    Checksum could be calculated at once with static Calculate() method or in
+    the streaming mode with the checksum instance Update() method.
+
+    Not thread-safe (checksum instance), thread-safe (static methods).
+
+    https://github.com/Cyan4973/xxHash/blob/dev/doc/xxhash_spec.md
+*/
+class XXH32
+{
+public:
+    //! Initialize the streaming checksum with the given seed
+    /*!
+        \param seed - Checksum seed (default is 0)
+    */
+    explicit XXH32(uint32_t seed = 0) noexcept { Reset(seed); }
+    XXH32(const XXH32&) noexcept = default;
+    XXH32(XXH32&&) noexcept = default;
+    ~XXH32() noexcept = default;
+
+    XXH32& operator=(const XXH32&) noexcept = default;
+    XXH32& operator=(XXH32&&) noexcept = default;
+
+    //! Get the checksum of all updated buffers
+    uint32_t value() const noexcept;
+
+    //! Update the streaming checksum with the given buffer
+    /*!
+        \param buffer - Buffer to checksum
+        \param size - Buffer size
+        \return Streaming checksum reference
+    */
+    XXH32& Update(const void* buffer, size_t size) noexcept;
+    //! Update the streaming checksum with the given string
+    /*!
+        \param str - String to checksum
+        \return Streaming checksum reference
+    */
+    XXH32& Update(std::string_view str) noexcept
+    { return Update(str.data(), str.size()); }
+
+    //! Reset the streaming checksum with the given seed
+    /*!
+        \param seed - Checksum seed (default is 0)
+    */
+    void Reset(uint32_t seed = 0) noexcept;
+
+    //! Calculate XXH32 checksum of the given buffer
+    /*!
+        \param buffer - Buffer to checksum
+        \param size - Buffer size
+        \param seed - Checksum seed (default is 0)
+        \return XXH32 checksum
+    */
+    static uint32_t Calculate(const void* buffer, size_t size, uint32_t seed = 0) noexcept;
+    //! Calculate XXH32 checksum of the given string
+    /*!
+        \param str - String to checksum
+        \param seed - Checksum seed (default is 0)
+        \return XXH32 checksum
+    */
+    static uint32_t Calculate(std::string_view str, uint32_t seed = 0) noexcept
+    { return Calculate(str.data(), str.size(), seed); }
+
+private:
+    uint32_t _seed;
+    uint64_t _total;
+    uint32_t _lanes[4];
+    uint8_t _buffer[16];
+    size_t _buffered;
+};
+
+} // namespace CppCommon
+
+#endif // CPPCOMMON_ALGORITHMS_XXH32_H
@@ -0,0 +1,99 @@
+/*!
+    \file xxh64.h
+    \brief XXH64 checksum algorithm definition
+    \author Ivan Shynkarenka
+    \date 15.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_ALGORITHMS_XXH64_H
+#define CPPCOMMON_ALGORITHMS_XXH64_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace CppCommon {
+
+//! XXH64 checksum algorithm
+/*!
+    XXH64 is the fast 64-bit non-cryptographic checksum, which processes 32
+    bytes per iteration in four independent lanes. It is used by LZ4 and
+    Zstandard frames and is a good choice for checksums of large files and
+    messages where 64-bit values are required. Values are the same on all
+    platforms and compatible with the reference implementation.
+
+    Checksum could be calculated at once with static Calculate() method or in
+    the streaming mode with the checksum instance Update() method.
+
+    Not thread-safe (checksum instance), thread-safe (static methods).
+
+    https://github.com/Cyan4973/xxHash/blob/dev/doc/xxhash_spec.md
+*/
+class XXH64
+{
+public:
+    //! Initialize the streaming checksum with the given seed
+    /*!
+        \param seed - Checksum seed (default is 0)
+    */
+    explicit XXH64(uint64_t seed = 0) noexcept { Reset(seed); }
+    XXH64(const XXH64&) noexcept = default;
+    XXH64(XXH64&&) noexcept = default;
+    ~XXH64() noexcept = default;
+
+    XXH64& operator=(const XXH64&) noexcept = default;
+    XXH64& operator=(XXH64&&) noexcept = default;
+
+    //! Get the checksum of all updated buffers
+    uint64_t value() const noexcept;
+
+    //! Update the streaming checksum with the given buffer
+    /*!
+        \param buffer - Buffer to checksum
+        \param size - Buffer size
+        \return Streaming checksum reference
+    */
+    XXH64& Update(const void* buffer, size_t size) noexcept;
+    //! Update the streaming checksum with the given string
+    /*!
+        \param str - String to checksum
+        \return Streaming checksum reference
+    */
+    XXH64& Update(std::string_view str) noexcept
+    { return Update(str.data(), str.size()); }
+
+    //! Reset the streaming checksum with the given seed
+    /*!
+        \param seed - Checksum seed (default is 0)
+    */
+    void Reset(uint64_t seed = 0) noexcept;
+
+    //! Calculate XXH64 checksum of the given buffer
+    /*!
+        \param buffer - Buffer to checksum
+        \param size - Buffer size
+        \param seed - Checksum seed (default is 0)
+        \return XXH64 checksum
+    */
+    static uint64_t Calculate(const void* buffer, size_t size, uint64_t seed = 0) noexcept;
+    //! Calculate XXH64 checksum of the given string
+    /*!
+        \param str - String to checksum
+        \param seed - Checksum seed (default is 0)
+        \return XXH64 checksum
+    */
+    static uint64_t Calculate(std::string_view str, uint64_t seed = 0) noexcept
+    { return Calculate(str.data(), str.size(), seed); }
+
+private:
+    uint64_t _seed;
+    uint64_t _total;
+    uint64_t _lanes[4];
+    uint8_t _buffer[32];
+    size_t _buffered;
+};
+
+} // namespace CppCommon
+
+#endif // CPPCOMMON_ALGORITHMS_XXH64_H
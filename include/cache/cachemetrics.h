@@ -0,0 +1,97 @@
+/*!
+    \file cachemetrics.h
+    \brief Cache metrics definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_CACHE_CACHEMETRICS_H
+#define CPPCOMMON_CACHE_CACHEMETRICS_H
+
+#include "time/timespan.h"
+
+#include <atomic>
+#include <cstdint>
+
+namespace CppCommon {
+
+//! Cache metrics snapshot
+/*!
+    Cache metrics are accumulated from the cache creation. Counters are updated
+    independently with relaxed atomics, so the snapshot taken under concurrent
+    modifications is approximate.
+*/
+struct CacheMetrics
+{
+    uint64_t hits;              //!< Count of found cache values
+    uint64_t misses;            //!< Count of not found cache values
+    uint64_t inserts;           //!< Count of inserted cache values
+    uint64_t removes;           //!< Count of removed cache values
+    uint64_t expired;           //!< Count of cache values erased by timeouts
+    uint64_t evictions;         //!< Count of cache values evicted by the capacity bound
+    uint64_t size;              //!< Current count of cache values
+    uint64_t weight;            //!< Current weight of cache values (weigher units for the memory cache, bytes for the file cache)
+    uint64_t watchdog_calls;    //!< Count of watchdog calls
+    Timespan watchdog_time;     //!< Total duration of watchdog calls
+    Timespan watchdog_max_time; //!< Maximal duration of a single watchdog call
+
+    CacheMetrics() : hits(0), misses(0), inserts(0), removes(0), expired(0), evictions(0), size(0), weight(0), watchdog_calls(0) {}
+
+    //! Get the cache hit ratio
+    double hit_ratio() const noexcept { return ((hits + misses) > 0) ? ((double)hits / (double)(hits + misses)) : 0.0; }
+};
+
+//! @cond INTERNALS
+namespace Internals {
+
+//! Cache counters updated with relaxed atomics
+struct CacheCounters
+{
+    std::atomic<uint64_t> hits;
+    std::atomic<uint64_t> misses;
+    std::atomic<uint64_t> inserts;
+    std::atomic<uint64_t> removes;
+    std::atomic<uint64_t> expired;
+    std::atomic<uint64_t> evictions;
+    std::atomic<uint64_t> watchdog_calls;
+    std::atomic<uint64_t> watchdog_time;
+    std::atomic<uint64_t> watchdog_max_time;
+
+    CacheCounters() : hits(0), misses(0), inserts(0), removes(0), expired(0), evictions(0), watchdog_calls(0), watchdog_time(0), watchdog_max_time(0) {}
+
+    static void Increment(std::atomic<uint64_t>& counter, uint64_t value = 1) noexcept
+    { counter.fetch_add(value, std::memory_order_relaxed); }
+
+    //! Account the watchdog call with the given duration in nanoseconds
+    void Watchdog(uint64_t duration) noexcept
+    {
+        Increment(watchdog_calls);
+        Increment(watchdog_time, duration);
+        uint64_t current = watchdog_max_time.load(std::memory_order_relaxed);
+        while ((current < duration) && !watchdog_max_time.compare_exchange_weak(current, duration, std::memory_order_relaxed));
+    }
+
+    //! Accumulate counters into the given metrics snapshot
+    void Accumulate(CacheMetrics& metrics) const noexcept
+    {
+        metrics.hits += hits.load(std::memory_order_relaxed);
+        metrics.misses += misses.load(std::memory_order_relaxed);
+        metrics.inserts += inserts.load(std::memory_order_relaxed);
+        metrics.removes += removes.load(std::memory_order_relaxed);
+        metrics.expired += expired.load(std::memory_order_relaxed);
+        metrics.evictions += evictions.load(std::memory_order_relaxed);
+        metrics.watchdog_calls += watchdog_calls.load(std::memory_order_relaxed);
+        metrics.watchdog_time += Timespan(watchdog_time.load(std::memory_order_relaxed));
+        uint64_t watchdog_max = watchdog_max_time.load(std::memory_order_relaxed);
+        if (metrics.watchdog_max_time.total() < (int64_t)watchdog_max)
+            metrics.watchdog_max_time = Timespan(watchdog_max);
+    }
+};
+
+} // namespace Internals
+//! @endcond
+
+} // namespace CppCommon
+
+#endif // CPPCOMMON_CACHE_CACHEMETRICS_H
@@ -9,20 +9,27 @@
 #ifndef CPPCOMMON_CACHE_FILECACHE_H
 #define CPPCOMMON_CACHE_FILECACHE_H
 
+#include "cache/cachemetrics.h"
+#include "cache/timerwheel.h"
 #include "filesystem/directory.h"
+#include "filesystem/directory_watcher.h"
 #include "filesystem/file.h"
+#include "filesystem/mapped_file.h"
 #include "filesystem/path.h"
+#include "memory/memory_pressure.h"
 #include "time/timespan.h"
 #include "time/timestamp.h"
 
 #include <functional>
 #include <map>
+#include <memory>
 #include <mutex>
 #include <shared_mutex>
 #include <string>
 #include <string_view>
 #include <tuple>
 #include <unordered_map>
+#include <vector>
 
 namespace CppCommon {
 
@@ -30,6 +37,24 @@ namespace CppCommon {
 /*!
     File cache is used to cache files in memory with optional timeouts.
 
+    Cache paths could be inserted with file contents read into memory or with
+    memory-mapped files. Mapped cache values are views into the mapped files,
+    so their pages are loaded lazily on the first access and shared through the
+    system page cache with other processes serving the same files. Views  of
+    mapped cache values stay valid while the value is kept in the file cache.
+
+    Cache paths could be watched for filesystem changes, so only changed files
+    are reloaded with refresh() instead of reloading whole cache paths by the
+    timeout in watchdog().
+
+    Cache paths could be loaded with precomputed encoded variants of files
+    (e.g. compressed with gzip, brotli or zstd by the given encoders), so
+    serving the accepted content encoding is a lookup instead of compression.
+
+    Cache keys are additionally indexed in the sorted order, so enumeration
+    and removal of all keys with the given prefix (e.g. "/static/js/") visit
+    only the matched keys instead of the whole file cache.
+
     Thread-safe.
 */
 class FileCache
@@ -37,11 +62,17 @@ class FileCache
 public:
     //! File cache insert handler type
     typedef std::function<bool (FileCache& cache, const std::string& key, const std::string& value, const Timespan& timeout)> InsertHandler;
-
-    FileCache() = default;
+    //! File cache mapped insert handler type
+    typedef std::function<bool (FileCache& cache, const std::string& key, const std::shared_ptr<MappedFile>& file, const Timespan& timeout)> MappedInsertHandler;
+    //! File cache encoder type (encodes the content into the output, returns 'false' to skip the encoded variant)
+    typedef std::function<bool (std::string_view content, std::string& output)> Encoder;
+    //! File cache encoders by content encoding name (e.g. "gzip", "br", "zstd")
+    typedef std::vector<std::pair<std::string, Encoder>> Encoders;
+
+    FileCache() : _bytes(0), _pressure(nullptr), _pressure_id(0) {}
     FileCache(const FileCache&) = delete;
     FileCache(FileCache&&) = delete;
-    ~FileCache() = default;
+    ~FileCache();
 
     FileCache& operator=(const FileCache&) = delete;
     FileCache& operator=(FileCache&&) = delete;
@@ -55,6 +86,9 @@ public:
     //! Get the file cache size
     size_t size() const;
 
+    //! Get the file cache metrics snapshot
+    CacheMetrics metrics() const;
+
     //! Emplace a new cache value with the given timeout into the file cache
     /*!
         \param key - Key to emplace
@@ -72,6 +106,16 @@ public:
         \return 'true' if the cache value was inserted, 'false' if the given key was not inserted
     */
     bool insert(const std::string& key, const std::string& value, const Timespan& timeout = Timespan(0));
+    //! Insert a new memory-mapped cache value with the given timeout into the file cache
+    /*!
+        Cache value is the view of the whole mapped file content.
+
+        \param key - Key to insert
+        \param file - Mapped file to insert
+        \param timeout - Cache timeout (default is 0 - no timeout)
+        \return 'true' if the cache value was inserted, 'false' if the given key was not inserted
+    */
+    bool insert(const std::string& key, const std::shared_ptr<MappedFile>& file, const Timespan& timeout = Timespan(0));
 
     //! Try to find the cache value by the given key
     /*!
@@ -86,6 +130,41 @@ public:
         \return 'true' if the cache value was found, 'false' if the given key was not found
     */
     std::pair<bool, std::string_view> find(const std::string& key, Timestamp& timeout);
+    //! Try to find the best encoded variant of the cache value by the given key
+    /*!
+        The smallest variant with one of the accepted content encodings is
+        returned. If there is no such variant, the original cache value  is
+        returned with the empty encoding.
+
+        \param key - Key to find
+        \param accepted - Accepted content encodings (e.g. "gzip", "br", "zstd")
+        \param encoding - Content encoding of the found variant (empty for the original cache value)
+        \return 'true' if the cache value was found, 'false' if the given key was not found
+    */
+    std::pair<bool, std::string_view> find(const std::string& key, const std::vector<std::string_view>& accepted, std::string_view& encoding);
+
+    //! Find the cache value of the longest route matching the given path
+    /*!
+        Route is a cache key which is equal to the given path or to one of its
+        parent prefixes ending at the '/' separator. E.g. for the path
+        "/app/users/42" the keys "/app/users/42", "/app/users/", "/app/users",
+        "/app/", "/app" and "/" are checked in this order.
+
+        \param path - Path to match
+        \param key - Matched cache key
+        \return 'true' if the route cache value was found, 'false' if no cache key matches the given path
+    */
+    std::pair<bool, std::string_view> find_route(std::string_view path, std::string& key);
+
+    //! Find all cache keys with the given prefix
+    /*!
+        Prefix is matched as a raw string, so use the trailing '/' separator
+        to match only keys under the given directory.
+
+        \param prefix - Prefix to find
+        \return Sorted cache keys with the given prefix
+    */
+    std::vector<std::string> find_prefix(std::string_view prefix) const;
 
     //! Remove the cache value with the given key from the file cache
     /*!
@@ -93,16 +172,58 @@ public:
         \return 'true' if the cache value was removed, 'false' if the given key was not found
     */
     bool remove(const std::string& key);
+    //! Remove all cache values with the given prefix from the file cache
+    /*!
+        Prefix is matched as a raw string, so use the trailing '/' separator
+        to remove only keys under the given directory.
+
+        \param prefix - Prefix to remove
+        \return Count of removed cache values
+    */
+    size_t remove_prefix(std::string_view prefix);
 
     //! Insert a new cache path with the given timeout into the file cache
     /*!
+        If several threads are given, directory is walked first and files  are
+        read by the pool of worker threads. Without the insert handler loaded
+        cache values are merged into the file cache in batches, so the file cache
+        lock is taken once per batch instead of once per file. Custom insert
+        handler is called concurrently from worker threads.
+
+        \param path - Path to insert
+        \param prefix - Cache prefix (default is "/")
+        \param timeout - Cache timeout (default is 0 - no timeout)
+        \param handler - Cache insert handler (default is nullptr - insert cache values with 'cache.insert(key, value, timeout)')
+        Encoders precompute encoded variants of each loaded file (in worker threads
+        together with reading files). Variants which are not smaller than  the
+        original file are skipped. Encoded variants are stored only without the
+        custom insert handler.
+
+        \param path - Path to insert
+        \param prefix - Cache prefix (default is "/")
+        \param timeout - Cache timeout (default is 0 - no timeout)
+        \param handler - Cache insert handler (default is nullptr - insert cache values with 'cache.insert(key, value, timeout)')
+        \param threads - Count of worker threads to read files (default is 1 - read files in the calling thread)
+        \param encoders - Encoders of precomputed variants (default is no encoders)
+        \return 'true' if the cache path was setup, 'false' if failed to setup the cache path
+    */
+    bool insert_path(const CppCommon::Path& path, const std::string& prefix = "/", const Timespan& timeout = Timespan(0), const InsertHandler& handler = nullptr, size_t threads = 1, const Encoders& encoders = Encoders());
+    //! Insert a new memory-mapped cache path with the given timeout into the file cache
+    /*!
+        Files of the cache path are memory-mapped instead of reading them into
+        memory. Mapping is cheap, so the cache path setup does not depend on the
+        files size. Worker threads, insert handler and encoders work the same way
+        as in insert_path().
+
         \param path - Path to insert
         \param prefix - Cache prefix (default is "/")
         \param timeout - Cache timeout (default is 0 - no timeout)
-        \param handler - Cache insert handler (default is 'return cache.insert(key, value, timeout)')
+        \param handler - Cache mapped insert handler (default is nullptr - insert cache values with 'cache.insert(key, file, timeout)')
+        \param threads - Count of worker threads to map files (default is 1 - map files in the calling thread)
+        \param encoders - Encoders of precomputed variants (default is no encoders, variants are kept in memory)
         \return 'true' if the cache path was setup, 'false' if failed to setup the cache path
     */
-    bool insert_path(const CppCommon::Path& path, const std::string& prefix = "/", const Timespan& timeout = Timespan(0), const InsertHandler& handler = [](FileCache& cache, const std::string& key, const std::string& value, const Timespan& timeout){ return cache.insert(key, value, timeout); });
+    bool insert_mapped_path(const CppCommon::Path& path, const std::string& prefix = "/", const Timespan& timeout = Timespan(0), const MappedInsertHandler& handler = nullptr, size_t threads = 1, const Encoders& encoders = Encoders());
 
     //! Try to find the cache path
     /*!
@@ -118,8 +239,34 @@ public:
     */
     bool find_path(const CppCommon::Path& path, Timestamp& timeout);
 
+    //! Watch the cache path for filesystem changes
+    /*!
+        Cache path must be inserted before watching. Changes are accumulated by
+        the filesystem change notifications and applied with refresh(). Watch
+        follows the cache path directory tree, but not targets of symlinks.
+
+        \param path - Path to watch
+        \return 'true' if the cache path is watched, 'false' if the given path was not found
+    */
+    bool watch_path(const CppCommon::Path& path);
+
+    //! Refresh watched cache paths with accumulated filesystem changes
+    /*!
+        Changed files are reloaded with the cache path insert handler, removed
+        files and directories are removed from the file cache. If the change
+        notifications were lost, the whole cache path is reloaded.
+
+        Call refresh() periodically together with watchdog(), it does not block
+        if there are no changes.
+
+        \return Count of applied filesystem changes
+    */
+    size_t refresh();
+
     //! Remove the cache path from the file cache
     /*!
+        Removed cache path is not watched any more.
+
         \param path - Path to remove
         \return 'true' if the cache path was removed, 'false' if the given path was not found
     */
@@ -128,47 +275,128 @@ public:
     //! Clear the memory cache
     void clear();
 
+    //! Shrink the file cache
+    /*!
+        Sheds the given fraction of cache values which hold the most of process
+        memory (file contents read into memory and encoded variants). Mapped
+        cache values without encoded variants are not shed, because their pages
+        belong to the system page cache which is reclaimed by the kernel. Shed
+        cache values are counted as evictions and are loaded again only when
+        their cache path is reloaded by refresh() or watchdog().
+
+        \param fraction - Fraction of cache values to shed (0.0 - 1.0)
+        \return Count of shed cache values
+    */
+    size_t shrink(double fraction);
+
+    //! Shrink the file cache on memory pressure
+    /*!
+        Subscribes the file cache to the given memory pressure notifier, so the
+        given fraction of cache values is shed on each memory pressure
+        notification. The memory pressure notifier must outlive the file cache
+        or the subscription must be reset with nullptr.
+
+        Not thread-safe, setup the subscription before the file cache is used.
+
+        \param pressure - Memory pressure notifier (default is nullptr - unsubscribe)
+        \param fraction - Fraction of cache values to shed (default is 0.25)
+    */
+    void shrink_on_pressure(MemoryPressure* pressure = nullptr, double fraction = 0.25);
+
     //! Watchdog the file cache
-    void watchdog(const UtcTimestamp& utc = UtcTimestamp());
+    /*!
+        Erase cache values and reload cache paths with expired timeouts. Timeouts
+        are scheduled in timer wheels, so the watchdog only visits expired items
+        and stale timers of removed or replaced items.
+
+        If the limit is given, the watchdog processes no more than the given
+        count of timers per call and continues with the next call, so its
+        latency impact on the calling thread is bounded.
+
+        \param utc - Current timestamp (default is UtcTimestamp())
+        \param limit - Processed timers limit (default is 0 - unlimited)
+        \return Count of erased cache values and reloaded cache paths
+    */
+    size_t watchdog(const UtcTimestamp& utc = UtcTimestamp(), size_t limit = 0);
 
     //! Swap two instances
+    /*!
+        Memory pressure subscriptions are not swapped.
+    */
     void swap(FileCache& cache) noexcept;
     friend void swap(FileCache& cache1, FileCache& cache2) noexcept;
 
 private:
     mutable std::shared_mutex _lock;
     Timestamp _timestamp;
+    size_t _bytes;
+    Internals::CacheCounters _counters;
 
     struct MemCacheEntry
     {
         std::string value;
+        std::shared_ptr<MappedFile> file;
+        std::vector<std::pair<std::string, std::string>> variants;
         Timestamp timestamp;
         Timespan timespan;
 
         MemCacheEntry() = default;
         MemCacheEntry(const std::string& v, const Timestamp& ts = Timestamp(), const Timespan& tp = Timespan()) : value(v), timestamp(ts), timespan(tp) {}
-        MemCacheEntry(std::string&& v, const Timestamp& ts = Timestamp(), const Timespan& tp = Timespan()) : value(v), timestamp(ts), timespan(tp) {}
+        MemCacheEntry(std::string&& v, const Timestamp& ts = Timestamp(), const Timespan& tp = Timespan()) : value(std::move(v)), timestamp(ts), timespan(tp) {}
+        MemCacheEntry(const std::shared_ptr<MappedFile>& f, const Timestamp& ts = Timestamp(), const Timespan& tp = Timespan()) : file(f), timestamp(ts), timespan(tp) {}
+
+        std::string_view view() const noexcept { return file ? file->view() : std::string_view(value); }
+        size_t bytes() const noexcept;
     };
 
     struct FileCacheEntry
     {
         std::string prefix;
+        bool mapped;
         InsertHandler handler;
+        MappedInsertHandler mapped_handler;
+        size_t threads;
+        Encoders encoders;
         Timestamp timestamp;
         Timespan timespan;
 
-        FileCacheEntry() = default;
-        FileCacheEntry(const std::string& pfx, const InsertHandler& h, const Timestamp& ts = Timestamp(), const Timespan& tp = Timespan()) : prefix(pfx), handler(h), timestamp(ts), timespan(tp) {}
+        FileCacheEntry() : mapped(false), threads(1) {}
+        FileCacheEntry(const std::string& pfx, const InsertHandler& h, size_t t, const Encoders& e, const Timestamp& ts = Timestamp(), const Timespan& tp = Timespan()) : prefix(pfx), mapped(false), handler(h), threads(t), encoders(e), timestamp(ts), timespan(tp) {}
+        FileCacheEntry(const std::string& pfx, const MappedInsertHandler& h, size_t t, const Encoders& e, const Timestamp& ts = Timestamp(), const Timespan& tp = Timespan()) : prefix(pfx), mapped(true), mapped_handler(h), threads(t), encoders(e), timestamp(ts), timespan(tp) {}
     };
 
-    std::unordered_map<std::string, MemCacheEntry> _entries_by_key;
-    std::map<Timestamp, std::string> _entries_by_timestamp;
+    typedef std::vector<std::pair<std::string, CppCommon::Path>> FileList;
+    typedef std::vector<std::pair<std::string, MemCacheEntry>> EntryBatch;
+    // File loader either calls the insert handler or appends the loaded cache entry to the batch
+    typedef std::function<bool (const std::string& key, const CppCommon::Path& file, EntryBatch& batch)> FileLoader;
+
+    typedef std::unordered_map<std::string, MemCacheEntry> EntryMap;
+
+    EntryMap _entries_by_key;
+    // Sorted index of cache entries (nodes of the unordered map are stable)
+    std::map<std::string_view, EntryMap::value_type*> _entries_by_prefix;
+    TimerWheel<std::string> _entries_by_timeout;
     std::map<CppCommon::Path, FileCacheEntry> _paths_by_key;
-    std::map<Timestamp, CppCommon::Path> _paths_by_timestamp;
+    TimerWheel<CppCommon::Path> _paths_by_timeout;
+    std::mutex _watcher_lock;
+    std::unique_ptr<DirectoryWatcher> _watcher;
+    MemoryPressure* _pressure;
+    uint64_t _pressure_id;
 
+    bool insert_internal(const std::string& key, MemCacheEntry&& entry, const Timespan& timeout);
     bool remove_internal(const std::string& key);
-    bool insert_path_internal(const CppCommon::Path& path, const std::string& prefix, const Timespan& timeout, const InsertHandler& handler);
+    EntryMap::iterator erase_internal(EntryMap::iterator it);
+    size_t remove_prefix_internal(std::string_view prefix);
+    void insert_batch_internal(EntryBatch& batch, const Timespan& timeout);
+    bool collect_path_internal(const CppCommon::Path& path, const std::string& prefix, FileList& files);
+    bool load_path_internal(const FileList& files, const Timespan& timeout, const FileLoader& loader, size_t threads);
+    bool insert_path_internal(const CppCommon::Path& path, FileCacheEntry&& entry);
+    FileLoader loader_internal(const FileCacheEntry& entry);
+    static void encode_internal(const Encoders& encoders, MemCacheEntry& entry);
+    void insert_path_entry(const CppCommon::Path& path, FileCacheEntry&& entry);
     bool remove_path_internal(const CppCommon::Path& path);
+    bool refresh_internal(const DirectoryEvent& event, const FileCacheEntry& entry);
+    static std::string key_internal(const FileCacheEntry& entry, const CppCommon::Path& root, const CppCommon::Path& path);
 };
 
 /*! \example cache_filecache.cpp File cache example */
@@ -20,6 +20,14 @@ inline size_t FileCache::size() const
     return _entries_by_key.size();
 }
 
+inline size_t FileCache::MemCacheEntry::bytes() const noexcept
+{
+    size_t result = view().size();
+    for (const auto& variant : variants)
+        result += variant.second.size();
+    return result;
+}
+
 inline void swap(FileCache& cache1, FileCache& cache2) noexcept
 {
     cache1.swap(cache2);
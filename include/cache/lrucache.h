@@ -0,0 +1,193 @@
+/*!
+    \file lrucache.h
+    \brief LRU cache definition
+    \author Ivan Shynkarenka
+    \date 15.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_CACHE_LRUCACHE_H
+#define CPPCOMMON_CACHE_LRUCACHE_H
+
+#include "cache/cachemetrics.h"
+#include "containers/hashmap.h"
+#include "containers/list.h"
+#include "memory/allocator_pool.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <new>
+#include <utility>
+
+namespace CppCommon {
+
+//! LRU cache replacement policy
+enum class LruCachePolicy
+{
+    LRU,    //!< Evict the least recently used cache value
+    TWO_Q   //!< Scan-resistant 2Q: new values are admitted into the main LRU queue on the second access
+};
+
+//! LRU cache
+/*!
+    LRU cache is a capacity bounded cache of values with O(1) find, insert and
+    evict operations and without timeouts (see MemCache for the thread-safe
+    cache with timeouts). Cache entries are indexed by the open address HashMap
+    and linked into intrusive usage lists. Entries are allocated from the pool
+    memory manager, so there is no heap allocation per cache value.
+
+    LRU policy keeps all cache values in the single usage list and evicts the
+    least recently used one. A single scan of many keys (e.g. batch job) flushes
+    the whole working set from such cache.
+
+    2Q policy admits new cache values into the FIFO queue of recent values (25%
+    of the capacity). Values evicted from the recent queue leave their keys in
+    the ghost queue (50% of the capacity, keys only). A value found again in
+    the recent queue or inserted again while its key is still in the ghost
+    queue is admitted into the main LRU queue. Values accessed only once never
+    enter the main queue, so scans do not flush the working set.
+
+    HashMap requires the blank key value which must never be inserted into the
+    cache (TKey() by default).
+
+    Not thread-safe.
+
+    https://www.vldb.org/conf/1994/P439.PDF
+*/
+template <typename TKey, typename TValue, typename THash = FastHash<TKey>, typename TEqual = std::equal_to<TKey>>
+class LruCache
+{
+public:
+    //! Initialize the LRU cache with a given capacity and replacement policy
+    /*!
+        \param capacity - LRU cache capacity in cache values
+        \param policy - LRU cache replacement policy (default is LruCachePolicy::LRU)
+        \param blank - Blank key value (default is TKey())
+    */
+    explicit LruCache(size_t capacity, LruCachePolicy policy = LruCachePolicy::LRU, const TKey& blank = TKey());
+    LruCache(const LruCache&) = delete;
+    LruCache(LruCache&&) = delete;
+    ~LruCache() { clear(); }
+
+    LruCache& operator=(const LruCache&) = delete;
+    LruCache& operator=(LruCache&&) = delete;
+
+    //! Check if the LRU cache is not empty
+    explicit operator bool() const noexcept { return !empty(); }
+
+    //! Is the LRU cache empty?
+    bool empty() const noexcept { return (_size == 0); }
+
+    //! Get the LRU cache size
+    size_t size() const noexcept { return _size; }
+    //! Get the LRU cache capacity
+    size_t capacity() const noexcept { return _capacity; }
+    //! Get the LRU cache replacement policy
+    LruCachePolicy policy() const noexcept { return _policy; }
+
+    //! Get the LRU cache metrics snapshot
+    CacheMetrics metrics() const noexcept;
+
+    //! Emplace a new cache value into the LRU cache
+    /*!
+        Previous cache value with the same key is replaced.
+
+        \param key - Key to emplace
+        \param value - Value to emplace
+        \return 'true' if the new cache value was emplaced, 'false' if the previous cache value was replaced
+    */
+    bool emplace(TKey&& key, TValue&& value);
+    //! Insert a new cache value into the LRU cache
+    /*!
+        Previous cache value with the same key is replaced.
+
+        \param key - Key to insert
+        \param value - Value to insert
+        \return 'true' if the new cache value was inserted, 'false' if the previous cache value was replaced
+    */
+    bool insert(const TKey& key, const TValue& value);
+
+    //! Try to find the cache value by the given key and update its usage
+    /*!
+        \param key - Key to find
+        \return Pointer to the cache value or nullptr if the given key was not found
+    */
+    TValue* find(const TKey& key);
+    //! Try to find the cache value by the given key and update its usage
+    /*!
+        \param key - Key to find
+        \param value - Value to find
+        \return 'true' if the cache value was found, 'false' if the given key was not found
+    */
+    bool find(const TKey& key, TValue& value);
+
+    //! Check if the cache value with the given key is cached without updating its usage
+    bool contains(const TKey& key) const noexcept;
+
+    //! Remove the cache value with the given key from the LRU cache
+    /*!
+        \param key - Key to remove
+        \return 'true' if the cache value was removed, 'false' if the given key was not found
+    */
+    bool remove(const TKey& key);
+
+    //! Clear the LRU cache
+    void clear();
+
+private:
+    // Cache entry queue
+    enum class Queue : uint8_t
+    {
+        RECENT,     // FIFO queue of recent values (2Q only)
+        FREQUENT,   // LRU queue of values
+        GHOST       // FIFO queue of keys evicted from the recent queue (2Q only)
+    };
+
+    struct Entry
+    {
+        Entry* next;
+        Entry* prev;
+        TKey key;
+        Queue queue;
+        // Value storage is released for ghost entries
+        alignas(TValue) unsigned char storage[sizeof(TValue)];
+
+        template <typename UKey>
+        explicit Entry(UKey&& k) : next(nullptr), prev(nullptr), key(std::forward<UKey>(k)), queue(Queue::FREQUENT) {}
+
+        TValue& value() noexcept { return *std::launder(reinterpret_cast<TValue*>(storage)); }
+    };
+
+    size_t _capacity;
+    size_t _recent_capacity;
+    size_t _ghost_capacity;
+    size_t _size;
+    LruCachePolicy _policy;
+    CacheMetrics _metrics;
+    DefaultMemoryManager _auxiliary;
+    PoolMemoryManager<DefaultMemoryManager> _pool;
+    HashMap<TKey, Entry*, THash, TEqual> _entries;
+    List<Entry> _recent;
+    List<Entry> _frequent;
+    List<Entry> _ghost;
+
+    List<Entry>& queue(const Entry* entry) noexcept;
+
+    template <typename UKey, typename UValue>
+    bool insert_internal(UKey&& key, UValue&& value);
+    void evict_internal();
+
+    template <typename UKey>
+    Entry* allocate(UKey&& key);
+    void release(Entry* entry) noexcept;
+};
+
+/*! \example cache_lrucache.cpp LRU cache example */
+
+} // namespace CppCommon
+
+#include "lrucache.inl"
+
+#endif // CPPCOMMON_CACHE_LRUCACHE_H
@@ -0,0 +1,261 @@
+/*!
+    \file lrucache.inl
+    \brief LRU cache inline implementation
+    \author Ivan Shynkarenka
+    \date 15.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+template <typename TKey, typename TValue, typename THash, typename TEqual>
+inline LruCache<TKey, TValue, THash, TEqual>::LruCache(size_t capacity, LruCachePolicy policy, const TKey& blank)
+    : _capacity(capacity),
+      _recent_capacity((policy == LruCachePolicy::TWO_Q) ? std::max(capacity / 4, (size_t)1) : 0),
+      _ghost_capacity((policy == LruCachePolicy::TWO_Q) ? std::max(capacity / 2, (size_t)1) : 0),
+      _size(0),
+      _policy(policy),
+      _pool(_auxiliary, std::max((size_t)65536, sizeof(Entry) * 64)),
+      _entries(std::max((capacity + _ghost_capacity) * 2, (size_t)128), blank)
+{
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual>
+inline CacheMetrics LruCache<TKey, TValue, THash, TEqual>::metrics() const noexcept
+{
+    CacheMetrics result = _metrics;
+    result.size = _size;
+    result.weight = _size;
+    return result;
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual>
+inline bool LruCache<TKey, TValue, THash, TEqual>::emplace(TKey&& key, TValue&& value)
+{
+    return insert_internal(std::move(key), std::move(value));
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual>
+inline bool LruCache<TKey, TValue, THash, TEqual>::insert(const TKey& key, const TValue& value)
+{
+    return insert_internal(key, value);
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual>
+inline TValue* LruCache<TKey, TValue, THash, TEqual>::find(const TKey& key)
+{
+    auto it = _entries.find(key);
+    if ((it == _entries.end()) || (it->second->queue == Queue::GHOST))
+    {
+        ++_metrics.misses;
+        return nullptr;
+    }
+
+    // Move the entry to the front of the LRU queue. Recent entries are
+    // promoted into the LRU queue on the second access.
+    Entry* entry = it->second;
+    queue(entry).pop_current(*entry);
+    entry->queue = Queue::FREQUENT;
+    _frequent.push_front(*entry);
+
+    ++_metrics.hits;
+    return &entry->value();
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual>
+inline bool LruCache<TKey, TValue, THash, TEqual>::find(const TKey& key, TValue& value)
+{
+    TValue* result = find(key);
+    if (result == nullptr)
+        return false;
+
+    value = *result;
+    return true;
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual>
+inline bool LruCache<TKey, TValue, THash, TEqual>::contains(const TKey& key) const noexcept
+{
+    auto it = _entries.find(key);
+    return ((it != _entries.end()) && (it->second->queue != Queue::GHOST));
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual>
+inline bool LruCache<TKey, TValue, THash, TEqual>::remove(const TKey& key)
+{
+    auto it = _entries.find(key);
+    if (it == _entries.end())
+        return false;
+
+    Entry* entry = it->second;
+    bool ghost = (entry->queue == Queue::GHOST);
+    queue(entry).pop_current(*entry);
+    _entries.erase(it);
+    release(entry);
+
+    // Ghost entries are not cache values
+    if (ghost)
+        return false;
+
+    --_size;
+    ++_metrics.removes;
+    return true;
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual>
+inline void LruCache<TKey, TValue, THash, TEqual>::clear()
+{
+    for (List<Entry>* list : { &_recent, &_frequent, &_ghost })
+        while (!list->empty())
+            release(list->pop_front());
+
+    _entries.clear();
+    _size = 0;
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual>
+inline List<typename LruCache<TKey, TValue, THash, TEqual>::Entry>& LruCache<TKey, TValue, THash, TEqual>::queue(const Entry* entry) noexcept
+{
+    switch (entry->queue)
+    {
+        case Queue::RECENT:
+            return _recent;
+        case Queue::GHOST:
+            return _ghost;
+        default:
+            return _frequent;
+    }
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual>
+template <typename UKey, typename UValue>
+inline bool LruCache<TKey, TValue, THash, TEqual>::insert_internal(UKey&& key, UValue&& value)
+{
+    if (_capacity == 0)
+        return false;
+
+    ++_metrics.inserts;
+
+    auto it = _entries.find(key);
+    if (it != _entries.end())
+    {
+        Entry* entry = it->second;
+        if (entry->queue != Queue::GHOST)
+        {
+            // Replace the cached value and update its usage
+            entry->value() = std::forward<UValue>(value);
+            if (entry->queue == Queue::FREQUENT)
+            {
+                _frequent.pop_current(*entry);
+                _frequent.push_front(*entry);
+            }
+            return false;
+        }
+
+        // Key was recently evicted from the recent queue, so admit it into the main queue
+        new (entry->storage) TValue(std::forward<UValue>(value));
+        _ghost.pop_current(*entry);
+        entry->queue = Queue::FREQUENT;
+        _frequent.push_front(*entry);
+    }
+    else
+    {
+        Entry* entry = allocate(std::forward<UKey>(key));
+        try
+        {
+            new (entry->storage) TValue(std::forward<UValue>(value));
+        }
+        catch (...)
+        {
+            entry->~Entry();
+            _pool.free(entry, sizeof(Entry));
+            throw;
+        }
+
+        try
+        {
+            _entries.insert(std::make_pair(entry->key, entry));
+        }
+        catch (...)
+        {
+            release(entry);
+            throw;
+        }
+
+        if (_policy == LruCachePolicy::TWO_Q)
+        {
+            entry->queue = Queue::RECENT;
+            _recent.push_front(*entry);
+        }
+        else
+            _frequent.push_front(*entry);
+    }
+
+    ++_size;
+
+    // Evict cache values to fit the capacity
+    while (_size > _capacity)
+        evict_internal();
+
+    return true;
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual>
+inline void LruCache<TKey, TValue, THash, TEqual>::evict_internal()
+{
+    ++_metrics.evictions;
+    --_size;
+
+    if ((_policy == LruCachePolicy::TWO_Q) && ((_recent.size() > _recent_capacity) || _frequent.empty()))
+    {
+        // Evict the oldest recent value and remember its key in the ghost queue
+        Entry* entry = _recent.pop_back();
+        entry->value().~TValue();
+        entry->queue = Queue::GHOST;
+        _ghost.push_front(*entry);
+
+        if (_ghost.size() > _ghost_capacity)
+        {
+            Entry* ghost = _ghost.pop_back();
+            _entries.erase(ghost->key);
+            release(ghost);
+        }
+    }
+    else
+    {
+        // Evict the least recently used value
+        Entry* entry = _frequent.pop_back();
+        _entries.erase(entry->key);
+        release(entry);
+    }
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual>
+template <typename UKey>
+inline typename LruCache<TKey, TValue, THash, TEqual>::Entry* LruCache<TKey, TValue, THash, TEqual>::allocate(UKey&& key)
+{
+    void* ptr = _pool.malloc(sizeof(Entry), alignof(Entry));
+    if (ptr == nullptr)
+        throw std::bad_alloc();
+
+    try
+    {
+        return new (ptr) Entry(std::forward<UKey>(key));
+    }
+    catch (...)
+    {
+        _pool.free(ptr, sizeof(Entry));
+        throw;
+    }
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual>
+inline void LruCache<TKey, TValue, THash, TEqual>::release(Entry* entry) noexcept
+{
+    if (entry->queue != Queue::GHOST)
+        entry->value().~TValue();
+    entry->~Entry();
+    _pool.free(entry, sizeof(Entry));
+}
+
+} // namespace CppCommon
@@ -9,30 +9,85 @@
 #ifndef CPPCOMMON_CACHE_MEMCACHE_H
 #define CPPCOMMON_CACHE_MEMCACHE_H
 
+#include "cache/cachemetrics.h"
+#include "cache/timerwheel.h"
+#include "containers/list.h"
+#include "memory/memory_pressure.h"
 #include "time/timespan.h"
 #include "time/timestamp.h"
+#include "utility/cache_aligned.h"
+#include "utility/shard_selector.h"
 
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cmath>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <memory>
 #include <mutex>
-#include <map>
 #include <shared_mutex>
 #include <unordered_map>
+#include <vector>
 
 namespace CppCommon {
 
+//! Memory cache eviction policy
+enum class MemCacheEviction
+{
+    LRU,    //!< Evict the least recently used cache value
+    CLOCK   //!< Evict the first cache value without the recent access reference (second chance)
+};
+
+//! Memory cache default weigher
+/*!
+    Weights each cache value as 1, so the memory cache capacity bounds  the
+    count of cache values. Provide custom weigher returning the size of the
+    key and value in bytes to bound the memory cache by bytes.
+*/
+template <typename TKey, typename TValue>
+struct MemCacheWeigher
+{
+    size_t operator()(const TKey&, const TValue&) const noexcept { return 1; }
+};
+
 //! Memory cache
 /*!
     Memory cache is used to cache data in memory with optional timeouts.
 
+    Cache values are striped between several shards by the key hash.  Each
+    shard is guarded by its own lock, so operations with keys from different
+    shards do not contend with each other.
+
+    Memory cache could be bounded with the capacity measured by the weigher
+    (count of cache values by default). Capacity is split evenly  between
+    shards and exceeding cache values are evicted from the given shard with
+    the selected eviction policy. LRU eviction updates the usage  order  on
+    each hit, so bounded LRU memory cache locks shards exclusively on find.
+    CLOCK eviction only marks cache values as referenced, so find keeps the
+    shard lock shared.
+
     Thread-safe.
 */
-template <typename TKey, typename TValue>
+template <typename TKey, typename TValue, typename TWeigher = MemCacheWeigher<TKey, TValue>>
 class MemCache
 {
 public:
-    MemCache() = default;
+    //! Memory cache eviction handler type
+    typedef std::function<void (const TKey& key, TValue&& value)> EvictionHandler;
+
+    //! Initialize the memory cache with a given shards count, capacity and eviction policy
+    /*!
+        \param shards - Shards count (will be rounded up to the power of two, default is 1)
+        \param capacity - Memory cache capacity in weigher units (default is 0 - unbounded)
+        \param eviction - Memory cache eviction policy (default is MemCacheEviction::LRU)
+        \param weigher - Cache value weigher (default is TWeigher())
+    */
+    explicit MemCache(size_t shards = 1, size_t capacity = 0, MemCacheEviction eviction = MemCacheEviction::LRU, const TWeigher& weigher = TWeigher());
     MemCache(const MemCache&) = delete;
     MemCache(MemCache&&) = delete;
-    ~MemCache() = default;
+    ~MemCache();
 
     MemCache& operator=(const MemCache&) = delete;
     MemCache& operator=(MemCache&&) = delete;
@@ -41,10 +96,43 @@ public:
     explicit operator bool() const { return !empty(); }
 
     //! Is the memory cache empty?
-    bool empty() const;
+    bool empty() const { return size() == 0; }
 
     //! Get the memory cache size
+    /*!
+        Entries are counted shard after shard without a global lock, so values
+        inserted, expired or evicted during the call may be missed.
+    */
     size_t size() const;
+    //! Get the memory cache weight (total weight of all cache values)
+    size_t weight() const;
+    //! Get the memory cache capacity (0 - unbounded)
+    size_t capacity() const noexcept { return _capacity; }
+    //! Get the memory cache shards count
+    size_t shards() const noexcept { return _selector.count(); }
+    //! Get the memory cache eviction policy
+    MemCacheEviction eviction() const noexcept { return _eviction; }
+
+    //! Get the memory cache metrics snapshot
+    /*!
+        Counters are kept per shard and updated with relaxed atomics, so they do
+        not add any contention between shards.
+    */
+    CacheMetrics metrics() const;
+
+    //! Setup the eviction handler
+    /*!
+        Eviction handler is called with the key and the moved value of each cache
+        value evicted by the capacity bound (e.g. to demote it into the slower
+        cache tier). Handler is called with the shard locked, so it must not
+        access the memory cache. Removed and expired cache values are not passed
+        to the handler.
+
+        Not thread-safe, setup the handler before the memory cache is used.
+
+        \param handler - Eviction handler (default is nullptr - drop evicted values)
+    */
+    void eviction_handler(const EvictionHandler& handler = nullptr) { _eviction_handler = handler; }
 
     //! Emplace a new cache value with the given timeout into the memory cache
     /*!
@@ -86,6 +174,51 @@ public:
     */
     bool find(const TKey& key, TValue& value, Timestamp& timeout);
 
+    //! Visit the cache value with the given key without copying it
+    /*!
+        Visitor is called as visitor(const TValue& value) with the  shard  locked,
+        so it may read the cached value in place, but must not access the memory
+        cache. Keep the visitor short, because it blocks writers of the shard.
+        To keep large cache values outside of the lock cache them as
+        std::shared_ptr<const T> and copy the handle.
+
+        \param key - Key to visit
+        \param visitor - Visitor function
+        \return 'true' if the cache value was found and visited, 'false' if the given key was not found
+    */
+    template <class TVisitor>
+    bool visit(const TKey& key, TVisitor&& visitor);
+
+    //! Get the cache value by the given key or load and insert it on miss
+    /*!
+        Loader is called as loader(const TKey& key, TValue& value) without any
+        memory cache lock and returns 'true' if the value was loaded. Concurrent
+        misses of the same key are collapsed into a single load (single flight):
+        other callers wait for the loading one and receive its  result.  If the
+        loader throws, the exception is rethrown in all waiting callers.
+
+        \param key - Key to get
+        \param value - Value to get
+        \param loader - Value loader
+        \param timeout - Cache timeout of the loaded value (default is 0 - no timeout)
+        \return 'true' if the cache value was found or loaded, 'false' if the loader failed
+    */
+    template <class TLoader>
+    bool get_or_insert(const TKey& key, TValue& value, TLoader&& loader, const Timespan& timeout = Timespan(0));
+
+    //! Visit all cache values without copying them
+    /*!
+        Visitor is called as visitor(const TKey& key, const TValue& value) with
+        the visited shard locked, so it must not access the memory cache. Shards
+        are visited one by one, so the result is approximate under  concurrent
+        modifications. Visiting does not update the usage order.
+
+        \param visitor - Visitor function
+        \return Count of visited cache values
+    */
+    template <class TVisitor>
+    size_t visit_all(TVisitor&& visitor) const;
+
     //! Remove the cache value with the given key from the memory cache
     /*!
         \param key - Key to remove
@@ -96,33 +229,121 @@ public:
     //! Clear the memory cache
     void clear();
 
+    //! Shrink the memory cache
+    /*!
+        Sheds the given fraction of cache values from each shard in the order of
+        the eviction policy. Shed cache values are counted as evictions, but they
+        are not passed to the eviction handler, because the goal is to release
+        memory and not to move values into another cache tier.
+
+        \param fraction - Fraction of cache values to shed (0.0 - 1.0)
+        \return Count of shed cache values
+    */
+    size_t shrink(double fraction);
+
+    //! Shrink the memory cache on memory pressure
+    /*!
+        Subscribes the memory cache to the given memory pressure notifier, so
+        the given fraction of cache values is shed on each memory pressure
+        notification. The memory pressure notifier must outlive the memory cache
+        or the subscription must be reset with nullptr.
+
+        Not thread-safe, setup the subscription before the memory cache is used.
+
+        \param pressure - Memory pressure notifier (default is nullptr - unsubscribe)
+        \param fraction - Fraction of cache values to shed (default is 0.25)
+    */
+    void shrink_on_pressure(MemoryPressure* pressure = nullptr, double fraction = 0.25);
+
     //! Watchdog the memory cache
-    void watchdog(const UtcTimestamp& utc = UtcTimestamp());
+    /*!
+        Erase cache values with expired timeouts. Timeouts are scheduled in the
+        timer wheel of each shard, so the watchdog only visits expired  values
+        and stale timers of removed or replaced values.
+
+        If the limit is given, the watchdog processes no more than the given
+        count of timers per call and continues with the next call, so its
+        latency impact on the calling thread is bounded.
+
+        \param utc - Current timestamp (default is UtcTimestamp())
+        \param limit - Processed timers limit (default is 0 - unlimited)
+        \return Count of erased cache values
+    */
+    size_t watchdog(const UtcTimestamp& utc = UtcTimestamp(), size_t limit = 0);
 
     //! Swap two instances
+    /*!
+        Both memory caches must have the same shards count. Eviction handlers and
+        memory pressure subscriptions are not swapped.
+    */
     void swap(MemCache& cache) noexcept;
-    template <typename UKey, typename UValue>
-    friend void swap(MemCache<UKey, UValue>& cache1, MemCache<UKey, UValue>& cache2) noexcept;
+    template <typename UKey, typename UValue, typename UWeigher>
+    friend void swap(MemCache<UKey, UValue, UWeigher>& cache1, MemCache<UKey, UValue, UWeigher>& cache2) noexcept;
 
 private:
-    mutable std::shared_mutex _lock;
-    Timestamp _timestamp;
-
     struct MemCacheEntry
     {
+        MemCacheEntry* next;
+        MemCacheEntry* prev;
+        const TKey* key;
         TValue value;
         Timestamp timestamp;
         Timespan timespan;
+        size_t weight;
+        mutable std::atomic<bool> referenced;
+
+        MemCacheEntry(const TValue& v, size_t w, const Timestamp& ts = Timestamp(), const Timespan& tp = Timespan()) : next(nullptr), prev(nullptr), key(nullptr), value(v), timestamp(ts), timespan(tp), weight(w), referenced(false) {}
+        MemCacheEntry(TValue&& v, size_t w, const Timestamp& ts = Timestamp(), const Timespan& tp = Timespan()) : next(nullptr), prev(nullptr), key(nullptr), value(std::move(v)), timestamp(ts), timespan(tp), weight(w), referenced(false) {}
+    };
+
+    struct MemCacheLoad
+    {
+        std::mutex lock;
+        std::condition_variable cv;
+        bool done;
+        bool success;
+        TValue value;
+        std::exception_ptr exception;
+
+        MemCacheLoad() : done(false), success(false) {}
+    };
+
+    struct Shard
+    {
+        mutable std::shared_mutex lock;
+        Timestamp timestamp;
+        size_t capacity;
+        size_t weight;
+        std::unordered_map<TKey, MemCacheEntry> entries_by_key;
+        TimerWheel<TKey> entries_by_timeout;
+        List<MemCacheEntry> entries_by_usage;
+        std::unordered_map<TKey, std::shared_ptr<MemCacheLoad>> loads_by_key;
+        Internals::CacheCounters counters;
 
-        MemCacheEntry() = default;
-        MemCacheEntry(const TValue& v, const Timestamp& ts = Timestamp(), const Timespan& tp = Timespan()) : value(v), timestamp(ts), timespan(tp) {}
-        MemCacheEntry(TValue&& v, const Timestamp& ts = Timestamp(), const Timespan& tp = Timespan()) : value(v), timestamp(ts), timespan(tp) {}
+        explicit Shard(size_t c) : capacity(c), weight(0) {}
     };
 
-    std::unordered_map<TKey, MemCacheEntry> _entries_by_key;
-    std::map<Timestamp, TKey> _entries_by_timestamp;
+    TWeigher _weigher;
+    EvictionHandler _eviction_handler;
+    size_t _capacity;
+    MemCacheEviction _eviction;
+    ShardSelector _selector;
+    std::vector<std::unique_ptr<CacheAligned<Shard>>> _shards;
+    std::atomic<size_t> _watchdog_shard;
+    Internals::CacheCounters _counters;
+    MemoryPressure* _pressure;
+    uint64_t _pressure_id;
 
-    bool remove_internal(const TKey& key);
+    Shard& shard(const TKey& key) const noexcept;
+    bool bounded_lru() const noexcept { return (_capacity > 0) && (_eviction == MemCacheEviction::LRU); }
+
+    template <typename UKey, typename UValue>
+    bool insert_internal(Shard& shard, UKey&& key, UValue&& value, const Timespan& timeout);
+    template <class TVisitor>
+    bool find_internal(const TKey& key, TVisitor&& visitor);
+    bool remove_internal(Shard& shard, const TKey& key);
+    void remove_internal(Shard& shard, typename std::unordered_map<TKey, MemCacheEntry>::iterator it);
+    void evict_internal(Shard& shard, bool handler = true);
 };
 
 /*! \example cache_memcache.cpp Memory cache example */
@@ -8,180 +8,494 @@
 
 namespace CppCommon {
 
-template <typename TKey, typename TValue>
-inline bool MemCache<TKey, TValue>::empty() const
+template <typename TKey, typename TValue, typename TWeigher>
+inline MemCache<TKey, TValue, TWeigher>::MemCache(size_t shards, size_t capacity, MemCacheEviction eviction, const TWeigher& weigher)
+    : _weigher(weigher), _capacity(capacity), _eviction(eviction), _selector(shards), _watchdog_shard(0), _pressure(nullptr), _pressure_id(0)
 {
-    std::shared_lock<std::shared_mutex> locker(_lock);
-    return _entries_by_key.empty();
+    // Split the capacity evenly between shards
+    size_t shard_capacity = (capacity + _selector.count() - 1) / _selector.count();
+
+    _shards.reserve(_selector.count());
+    for (size_t i = 0; i < _selector.count(); ++i)
+        _shards.emplace_back(std::make_unique<CacheAligned<Shard>>(std::in_place, shard_capacity));
 }
 
-template <typename TKey, typename TValue>
-inline size_t MemCache<TKey, TValue>::size() const
+template <typename TKey, typename TValue, typename TWeigher>
+inline MemCache<TKey, TValue, TWeigher>::~MemCache()
 {
-    std::shared_lock<std::shared_mutex> locker(_lock);
-    return _entries_by_key.size();
+    // Unsubscribe from the memory pressure notifier (waits for the running shrink)
+    shrink_on_pressure(nullptr);
 }
 
-template <typename TKey, typename TValue>
-inline bool MemCache<TKey, TValue>::emplace(TKey&& key, TValue&& value, const Timespan& timeout)
+template <typename TKey, typename TValue, typename TWeigher>
+inline size_t MemCache<TKey, TValue, TWeigher>::size() const
 {
-    std::unique_lock<std::shared_mutex> locker(_lock);
+    size_t result = 0;
+    for (const auto& current : _shards)
+    {
+        std::shared_lock<std::shared_mutex> locker((*current)->lock);
+        result += (*current)->entries_by_key.size();
+    }
+    return result;
+}
 
-    // Try to find and remove the previous key
-    remove_internal(key);
+template <typename TKey, typename TValue, typename TWeigher>
+inline size_t MemCache<TKey, TValue, TWeigher>::weight() const
+{
+    size_t result = 0;
+    for (const auto& current : _shards)
+    {
+        std::shared_lock<std::shared_mutex> locker((*current)->lock);
+        result += (*current)->weight;
+    }
+    return result;
+}
 
-    // Update the cache entry
-    if (timeout.total() > 0)
+template <typename TKey, typename TValue, typename TWeigher>
+inline CacheMetrics MemCache<TKey, TValue, TWeigher>::metrics() const
+{
+    CacheMetrics result;
+    for (const auto& current : _shards)
     {
-        Timestamp current = UtcTimestamp();
-        _timestamp = (current <= _timestamp) ? _timestamp + 1 : current;
-        _entries_by_key.insert(std::make_pair(key, MemCacheEntry(std::move(value), _timestamp, timeout)));
-        _entries_by_timestamp.insert(std::make_pair(_timestamp, key));
+        std::shared_lock<std::shared_mutex> locker((*current)->lock);
+        result.size += (*current)->entries_by_key.size();
+        result.weight += (*current)->weight;
+        (*current)->counters.Accumulate(result);
     }
-    else
-        _entries_by_key.emplace(std::make_pair(std::move(key), MemCacheEntry(std::move(value))));
+    _counters.Accumulate(result);
+    return result;
+}
 
-    return true;
+template <typename TKey, typename TValue, typename TWeigher>
+inline bool MemCache<TKey, TValue, TWeigher>::emplace(TKey&& key, TValue&& value, const Timespan& timeout)
+{
+    Shard& current = shard(key);
+    std::unique_lock<std::shared_mutex> locker(current.lock);
+
+    return insert_internal(current, std::move(key), std::move(value), timeout);
+}
+
+template <typename TKey, typename TValue, typename TWeigher>
+inline bool MemCache<TKey, TValue, TWeigher>::insert(const TKey& key, const TValue& value, const Timespan& timeout)
+{
+    Shard& current = shard(key);
+    std::unique_lock<std::shared_mutex> locker(current.lock);
+
+    return insert_internal(current, key, value, timeout);
 }
 
-template <typename TKey, typename TValue>
-inline bool MemCache<TKey, TValue>::insert(const TKey& key, const TValue& value, const Timespan& timeout)
+template <typename TKey, typename TValue, typename TWeigher>
+template <typename UKey, typename UValue>
+inline bool MemCache<TKey, TValue, TWeigher>::insert_internal(Shard& shard, UKey&& key, UValue&& value, const Timespan& timeout)
 {
-    std::unique_lock<std::shared_mutex> locker(_lock);
+    // Check the cache value weight against the shard capacity
+    size_t weight = _weigher(key, value);
+    if ((shard.capacity > 0) && (weight > shard.capacity))
+        return false;
 
     // Try to find and remove the previous key
-    remove_internal(key);
+    remove_internal(shard, key);
+
+    // Evict cache values to fit the shard capacity
+    while ((shard.capacity > 0) && ((shard.weight + weight) > shard.capacity) && !shard.entries_by_usage.empty())
+        evict_internal(shard);
 
     // Update the cache entry
+    typename std::unordered_map<TKey, MemCacheEntry>::iterator it;
     if (timeout.total() > 0)
     {
         Timestamp current = UtcTimestamp();
-        _timestamp = (current <= _timestamp) ? _timestamp + 1 : current;
-        _entries_by_key.insert(std::make_pair(key, MemCacheEntry(value, _timestamp, timeout)));
-        _entries_by_timestamp.insert(std::make_pair(_timestamp, key));
+        shard.timestamp = (current <= shard.timestamp) ? shard.timestamp + 1 : current;
+        it = shard.entries_by_key.try_emplace(std::forward<UKey>(key), std::forward<UValue>(value), weight, shard.timestamp, timeout).first;
+        shard.entries_by_timeout.insert(shard.timestamp + timeout, it->first);
     }
     else
-        _entries_by_key.insert(std::make_pair(key, MemCacheEntry(value)));
+        it = shard.entries_by_key.try_emplace(std::forward<UKey>(key), std::forward<UValue>(value), weight).first;
+
+    // Register the cache entry in the usage order
+    MemCacheEntry& entry = it->second;
+    entry.key = &it->first;
+    if (_eviction == MemCacheEviction::LRU)
+        shard.entries_by_usage.push_front(entry);
+    else
+        shard.entries_by_usage.push_back(entry);
+    shard.weight += weight;
+    Internals::CacheCounters::Increment(shard.counters.inserts);
 
     return true;
 }
 
-template <typename TKey, typename TValue>
-inline bool MemCache<TKey, TValue>::find(const TKey& key)
+template <typename TKey, typename TValue, typename TWeigher>
+inline bool MemCache<TKey, TValue, TWeigher>::find(const TKey& key)
+{
+    return find_internal(key, [](const MemCacheEntry&) {});
+}
+
+template <typename TKey, typename TValue, typename TWeigher>
+inline bool MemCache<TKey, TValue, TWeigher>::find(const TKey& key, TValue& value)
 {
-    std::shared_lock<std::shared_mutex> locker(_lock);
+    return find_internal(key, [&value](const MemCacheEntry& entry) { value = entry.value; });
+}
+
+template <typename TKey, typename TValue, typename TWeigher>
+inline bool MemCache<TKey, TValue, TWeigher>::find(const TKey& key, TValue& value, Timestamp& timeout)
+{
+    return find_internal(key, [&value, &timeout](const MemCacheEntry& entry)
+    {
+        value = entry.value;
+        timeout = entry.timestamp + entry.timespan;
+    });
+}
+
+template <typename TKey, typename TValue, typename TWeigher>
+template <class TVisitor>
+inline bool MemCache<TKey, TValue, TWeigher>::visit(const TKey& key, TVisitor&& visitor)
+{
+    return find_internal(key, [&visitor](const MemCacheEntry& entry) { visitor(entry.value); });
+}
+
+template <typename TKey, typename TValue, typename TWeigher>
+template <class TLoader>
+inline bool MemCache<TKey, TValue, TWeigher>::get_or_insert(const TKey& key, TValue& value, TLoader&& loader, const Timespan& timeout)
+{
+    // Fast path for the cache hit
+    if (find(key, value))
+        return true;
+
+    Shard& current = shard(key);
+    std::shared_ptr<MemCacheLoad> load;
+
+    {
+        std::unique_lock<std::shared_mutex> locker(current.lock);
+
+        // Check the cache value inserted concurrently
+        auto it = current.entries_by_key.find(key);
+        if (it != current.entries_by_key.end())
+        {
+            value = it->second.value;
+            return true;
+        }
+
+        // Join the load of the same key in progress
+        auto it_load = current.loads_by_key.find(key);
+        if (it_load != current.loads_by_key.end())
+        {
+            load = it_load->second;
+            locker.unlock();
+
+            std::unique_lock<std::mutex> load_locker(load->lock);
+            load->cv.wait(load_locker, [&load]() { return load->done; });
+            if (load->exception)
+                std::rethrow_exception(load->exception);
+            if (load->success)
+                value = load->value;
+            return load->success;
+        }
+
+        // Register a new load of the given key
+        load = std::make_shared<MemCacheLoad>();
+        current.loads_by_key.emplace(key, load);
+    }
+
+    // Load the value without the memory cache lock
+    bool success = false;
+    std::exception_ptr exception;
+    try
+    {
+        success = loader(key, load->value);
+    }
+    catch (...)
+    {
+        exception = std::current_exception();
+    }
+
+    {
+        std::unique_lock<std::shared_mutex> locker(current.lock);
+
+        // Insert the loaded value and unregister the load
+        if (success)
+            insert_internal(current, key, load->value, timeout);
+        current.loads_by_key.erase(key);
+    }
+
+    // Wake up all waiting callers
+    {
+        std::unique_lock<std::mutex> load_locker(load->lock);
+        load->done = true;
+        load->success = success;
+        load->exception = exception;
+    }
+    load->cv.notify_all();
+
+    if (exception)
+        std::rethrow_exception(exception);
+    if (success)
+        value = load->value;
+    return success;
+}
+
+template <typename TKey, typename TValue, typename TWeigher>
+template <class TVisitor>
+inline bool MemCache<TKey, TValue, TWeigher>::find_internal(const TKey& key, TVisitor&& visitor)
+{
+    Shard& current = shard(key);
+
+    // Bounded LRU memory cache must update the usage order under the exclusive lock
+    if (bounded_lru())
+    {
+        std::unique_lock<std::shared_mutex> locker(current.lock);
+
+        // Try to find the given key
+        auto it = current.entries_by_key.find(key);
+        if (it == current.entries_by_key.end())
+        {
+            Internals::CacheCounters::Increment(current.counters.misses);
+            return false;
+        }
+        Internals::CacheCounters::Increment(current.counters.hits);
+
+        // Move the cache entry to the front of the usage order
+        MemCacheEntry& entry = it->second;
+        current.entries_by_usage.pop_current(entry);
+        current.entries_by_usage.push_front(entry);
+
+        visitor(entry);
+        return true;
+    }
+
+    std::shared_lock<std::shared_mutex> locker(current.lock);
 
     // Try to find the given key
-    auto it = _entries_by_key.find(key);
-    if (it == _entries_by_key.end())
+    auto it = current.entries_by_key.find(key);
+    if (it == current.entries_by_key.end())
+    {
+        Internals::CacheCounters::Increment(current.counters.misses);
         return false;
+    }
+    Internals::CacheCounters::Increment(current.counters.hits);
 
+    // Mark the cache entry as referenced for CLOCK eviction
+    const MemCacheEntry& entry = it->second;
+    if ((_capacity > 0) && !entry.referenced.load(std::memory_order_relaxed))
+        entry.referenced.store(true, std::memory_order_relaxed);
+
+    visitor(entry);
     return true;
 }
 
-template <typename TKey, typename TValue>
-inline bool MemCache<TKey, TValue>::find(const TKey& key, TValue& value)
+template <typename TKey, typename TValue, typename TWeigher>
+template <class TVisitor>
+inline size_t MemCache<TKey, TValue, TWeigher>::visit_all(TVisitor&& visitor) const
+{
+    size_t result = 0;
+    for (const auto& current : _shards)
+    {
+        std::shared_lock<std::shared_mutex> locker((*current)->lock);
+        for (const auto& entry : (*current)->entries_by_key)
+            visitor((const TKey&)entry.first, (const TValue&)entry.second.value);
+        result += (*current)->entries_by_key.size();
+    }
+    return result;
+}
+
+template <typename TKey, typename TValue, typename TWeigher>
+inline bool MemCache<TKey, TValue, TWeigher>::remove(const TKey& key)
 {
-    std::shared_lock<std::shared_mutex> locker(_lock);
+    Shard& current = shard(key);
+    std::unique_lock<std::shared_mutex> locker(current.lock);
 
-    // Try to find the given key
-    auto it = _entries_by_key.find(key);
-    if (it == _entries_by_key.end())
+    if (!remove_internal(current, key))
         return false;
 
-    value = it->second.value;
+    Internals::CacheCounters::Increment(current.counters.removes);
     return true;
 }
 
-template <typename TKey, typename TValue>
-inline bool MemCache<TKey, TValue>::find(const TKey& key, TValue& value, Timestamp& timeout)
+template <typename TKey, typename TValue, typename TWeigher>
+inline bool MemCache<TKey, TValue, TWeigher>::remove_internal(Shard& shard, const TKey& key)
 {
-    std::shared_lock<std::shared_mutex> locker(_lock);
-
     // Try to find the given key
-    auto it = _entries_by_key.find(key);
-    if (it == _entries_by_key.end())
+    auto it = shard.entries_by_key.find(key);
+    if (it == shard.entries_by_key.end())
         return false;
 
-    value = it->second.value;
-    timeout = it->second.timestamp + it->second.timespan;
+    remove_internal(shard, it);
     return true;
 }
 
-template <typename TKey, typename TValue>
-inline bool MemCache<TKey, TValue>::remove(const TKey& key)
+template <typename TKey, typename TValue, typename TWeigher>
+inline void MemCache<TKey, TValue, TWeigher>::remove_internal(Shard& shard, typename std::unordered_map<TKey, MemCacheEntry>::iterator it)
 {
-    std::unique_lock<std::shared_mutex> locker(_lock);
+    MemCacheEntry& entry = it->second;
 
-    return remove_internal(key);
+    // Erase cache entry from the usage order
+    shard.entries_by_usage.pop_current(entry);
+    shard.weight -= entry.weight;
+
+    // Erase cache entry
+    shard.entries_by_key.erase(it);
 }
 
-template <typename TKey, typename TValue>
-inline bool MemCache<TKey, TValue>::remove_internal(const TKey& key)
+template <typename TKey, typename TValue, typename TWeigher>
+inline void MemCache<TKey, TValue, TWeigher>::evict_internal(Shard& shard, bool handler)
 {
-    // Try to find the given key
-    auto it = _entries_by_key.find(key);
-    if (it == _entries_by_key.end())
-        return false;
+    MemCacheEntry* victim;
+    if (_eviction == MemCacheEviction::LRU)
+        victim = shard.entries_by_usage.back();
+    else
+    {
+        // Give the second chance to referenced cache entries
+        victim = shard.entries_by_usage.front();
+        while (victim->referenced.load(std::memory_order_relaxed))
+        {
+            victim->referenced.store(false, std::memory_order_relaxed);
+            shard.entries_by_usage.pop_front();
+            shard.entries_by_usage.push_back(*victim);
+            victim = shard.entries_by_usage.front();
+        }
+    }
 
-    // Try to erase cache entry by timestamp
-    if (it->second.timestamp.total() > 0)
-        _entries_by_timestamp.erase(it->second.timestamp);
+    auto it = shard.entries_by_key.find(*victim->key);
 
-    // Erase cache entry
-    _entries_by_key.erase(it);
+    // Pass the evicted cache value to the eviction handler
+    if (handler && _eviction_handler)
+        _eviction_handler(it->first, std::move(it->second.value));
 
-    return true;
+    remove_internal(shard, it);
+    Internals::CacheCounters::Increment(shard.counters.evictions);
+}
+
+template <typename TKey, typename TValue, typename TWeigher>
+inline void MemCache<TKey, TValue, TWeigher>::clear()
+{
+    for (auto& current : _shards)
+    {
+        std::unique_lock<std::shared_mutex> locker((*current)->lock);
+
+        // Clear all cache entries
+        (*current)->entries_by_usage.clear();
+        (*current)->entries_by_key.clear();
+        (*current)->entries_by_timeout.clear();
+        (*current)->weight = 0;
+    }
+}
+
+template <typename TKey, typename TValue, typename TWeigher>
+inline size_t MemCache<TKey, TValue, TWeigher>::shrink(double fraction)
+{
+    fraction = std::min(std::max(fraction, 0.0), 1.0);
+
+    size_t result = 0;
+    for (auto& current : _shards)
+    {
+        std::unique_lock<std::shared_mutex> locker((*current)->lock);
+
+        // Shed at least one cache value from each non-empty shard
+        size_t count = (size_t)std::ceil((*current)->entries_by_key.size() * fraction);
+        for (size_t i = 0; (i < count) && !(*current)->entries_by_usage.empty(); ++i)
+        {
+            evict_internal(**current, false);
+            ++result;
+        }
+    }
+    return result;
 }
 
-template <typename TKey, typename TValue>
-inline void MemCache<TKey, TValue>::clear()
+template <typename TKey, typename TValue, typename TWeigher>
+inline void MemCache<TKey, TValue, TWeigher>::shrink_on_pressure(MemoryPressure* pressure, double fraction)
 {
-    std::unique_lock<std::shared_mutex> locker(_lock);
+    if (_pressure != nullptr)
+    {
+        _pressure->Unsubscribe(_pressure_id);
+        _pressure = nullptr;
+        _pressure_id = 0;
+    }
 
-    // Clear all cache entries
-    _entries_by_key.clear();
-    _entries_by_timestamp.clear();
+    if (pressure != nullptr)
+    {
+        _pressure_id = pressure->Subscribe([this, fraction](const MemoryUsage&) { shrink(fraction); });
+        _pressure = pressure;
+    }
 }
 
-template <typename TKey, typename TValue>
-inline void MemCache<TKey, TValue>::watchdog(const UtcTimestamp& utc)
+template <typename TKey, typename TValue, typename TWeigher>
+inline size_t MemCache<TKey, TValue, TWeigher>::watchdog(const UtcTimestamp& utc, size_t limit)
 {
-    std::unique_lock<std::shared_mutex> locker(_lock);
+    uint64_t start_time = Timestamp::nano();
+    size_t result = 0;
+    size_t processed = 0;
 
-    // Watchdog for cache entries
-    auto it_entry_by_timestamp = _entries_by_timestamp.begin();
-    while (it_entry_by_timestamp != _entries_by_timestamp.end())
+    // Start from the shard where the previous limited watchdog stopped
+    size_t start = _watchdog_shard.load(std::memory_order_relaxed);
+    for (size_t i = 0; i < _selector.count(); ++i)
     {
-        // Check for the cache entry timeout
-        auto it_entry_by_key = _entries_by_key.find(it_entry_by_timestamp->second);
-        if ((it_entry_by_key->second.timestamp + it_entry_by_key->second.timespan) <= utc)
+        size_t index = (start + i) & (_selector.count() - 1);
+        Shard& current = _shards[index]->value();
+
+        std::unique_lock<std::shared_mutex> locker(current.lock);
+
+        // Watchdog for cache entries
+        processed += current.entries_by_timeout.expire(utc, [this, &current, &result](const Timestamp& expire, const TKey& key)
         {
+            // Skip stale timers of removed or replaced cache entries
+            auto it = current.entries_by_key.find(key);
+            if ((it == current.entries_by_key.end()) || ((it->second.timestamp + it->second.timespan) != expire))
+                return;
+
             // Erase the cache entry with timeout
-            _entries_by_key.erase(it_entry_by_key);
-            _entries_by_timestamp.erase(it_entry_by_timestamp);
-            it_entry_by_timestamp = _entries_by_timestamp.begin();
-            continue;
-        }
-        else
+            remove_internal(current, it);
+            Internals::CacheCounters::Increment(current.counters.expired);
+            ++result;
+        }, (limit > 0) ? (limit - processed) : 0);
+
+        if ((limit > 0) && (processed >= limit))
+        {
+            _watchdog_shard.store(index, std::memory_order_relaxed);
             break;
+        }
     }
+
+    _counters.Watchdog(Timestamp::nano() - start_time);
+    return result;
 }
 
-template <typename TKey, typename TValue>
-inline void MemCache<TKey, TValue>::swap(MemCache& cache) noexcept
+template <typename TKey, typename TValue, typename TWeigher>
+inline void MemCache<TKey, TValue, TWeigher>::swap(MemCache& cache) noexcept
 {
-    std::unique_lock<std::shared_mutex> locker1(_lock);
-    std::unique_lock<std::shared_mutex> locker2(cache._lock);
+    assert((_selector.count() == cache._selector.count()) && "Swapped memory caches must have the same shards count!");
+    if ((this == &cache) || (_selector.count() != cache._selector.count()))
+        return;
 
     using std::swap;
-    swap(_timestamp, cache._timestamp);
-    swap(_entries_by_key, cache._entries_by_key);
-    swap(_entries_by_timestamp, cache._entries_by_timestamp);
+    swap(_weigher, cache._weigher);
+    swap(_capacity, cache._capacity);
+    swap(_eviction, cache._eviction);
+
+    for (size_t i = 0; i < _selector.count(); ++i)
+    {
+        Shard& shard1 = _shards[i]->value();
+        Shard& shard2 = cache._shards[i]->value();
+
+        std::unique_lock<std::shared_mutex> locker1(shard1.lock);
+        std::unique_lock<std::shared_mutex> locker2(shard2.lock);
+
+        swap(shard1.timestamp, shard2.timestamp);
+        swap(shard1.capacity, shard2.capacity);
+        swap(shard1.weight, shard2.weight);
+        swap(shard1.entries_by_key, shard2.entries_by_key);
+        swap(shard1.entries_by_timeout, shard2.entries_by_timeout);
+        swap(shard1.entries_by_usage, shard2.entries_by_usage);
+    }
+}
+
+template <typename TKey, typename TValue, typename TWeigher>
+inline typename MemCache<TKey, TValue, TWeigher>::Shard& MemCache<TKey, TValue, TWeigher>::shard(const TKey& key) const noexcept
+{
+    return _shards[_selector(std::hash<TKey>()(key))]->value();
 }
 
-template <typename TKey, typename TValue>
-inline void swap(MemCache<TKey, TValue>& cache1, MemCache<TKey, TValue>& cache2) noexcept
+template <typename TKey, typename TValue, typename TWeigher>
+inline void swap(MemCache<TKey, TValue, TWeigher>& cache1, MemCache<TKey, TValue, TWeigher>& cache2) noexcept
 {
     cache1.swap(cache2);
 }
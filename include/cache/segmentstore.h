@@ -0,0 +1,181 @@
+/*!
+    \file segmentstore.h
+    \brief Segment store definition
+    \author Ivan Shynkarenka
+    \date 15.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_CACHE_SEGMENTSTORE_H
+#define CPPCOMMON_CACHE_SEGMENTSTORE_H
+
+#include "filesystem/file.h"
+#include "filesystem/path.h"
+#include "utility/transparent.h"
+
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace CppCommon {
+
+//! Segment store
+/*!
+    Segment store is an on-disk key-value store of byte strings made of
+    append-only segment files in the given directory and the in-memory index
+    of record locations. Each insert or remove appends one record  into  the
+    active segment with a single positioned write, so the store never rewrites
+    data in place. When the active segment grows over the segment size a new
+    one is started.
+
+    Each record is framed with 12 bytes header: little-endian 32-bit key size,
+    32-bit value size (0xFFFFFFFF for the remove record) and CRC-32C checksum
+    of the size fields, key and value. Open() method scans existing segments
+    to rebuild the index and truncates the torn or corrupted tail of the last
+    segment left by the crash.
+
+    Replaced and removed records become garbage, Compact() method rewrites
+    live records into new segments and deletes old ones.
+
+    Thread-safe.
+*/
+class SegmentStore
+{
+public:
+    //! Record header size (12 bytes)
+    static const size_t HEADER_SIZE;
+    //! Default segment size (64 MiB)
+    static const size_t DEFAULT_SEGMENT_SIZE;
+
+    //! Initialize the segment store with a given directory path and segment size
+    /*!
+        \param path - Segment store directory path
+        \param segment_size - Segment size in bytes (default is SegmentStore::DEFAULT_SEGMENT_SIZE)
+    */
+    explicit SegmentStore(const Path& path, size_t segment_size = DEFAULT_SEGMENT_SIZE);
+    SegmentStore(const SegmentStore&) = delete;
+    SegmentStore(SegmentStore&&) = delete;
+    ~SegmentStore();
+
+    SegmentStore& operator=(const SegmentStore&) = delete;
+    SegmentStore& operator=(SegmentStore&&) = delete;
+
+    //! Check if the segment store is not empty
+    explicit operator bool() const { return !empty(); }
+
+    //! Is the segment store empty?
+    bool empty() const { return size() == 0; }
+
+    //! Get the segment store directory path
+    const Path& path() const noexcept { return _path; }
+    //! Get the segment size
+    size_t segment_size() const noexcept { return _segment_size; }
+
+    //! Get the count of stored values
+    size_t size() const;
+    //! Get the count of segment files
+    size_t segments() const;
+    //! Get the total size of segment files in bytes
+    uint64_t bytes() const;
+    //! Get the size of replaced and removed records in bytes
+    uint64_t garbage() const;
+
+    //! Is the segment store opened?
+    bool IsOpened() const;
+
+    //! Open the segment store
+    /*!
+        Creates the segment store directory if it does not exist, scans existing
+        segments and rebuilds the index.
+    */
+    void Open();
+    //! Close the segment store
+    void Close();
+
+    //! Insert the value with the given key into the segment store
+    /*!
+        Replaces the previous value with the same key.
+
+        \param key - Key to insert
+        \param value - Value to insert
+    */
+    void insert(std::string_view key, std::string_view value);
+
+    //! Check if the value with the given key is stored
+    /*!
+        \param key - Key to find
+        \return 'true' if the value was found, 'false' if the given key was not found
+    */
+    bool find(std::string_view key) const;
+    //! Try to read the value with the given key
+    /*!
+        \param key - Key to find
+        \param value - Value to read
+        \return 'true' if the value was found, 'false' if the given key was not found
+    */
+    bool find(std::string_view key, std::string& value) const;
+
+    //! Remove the value with the given key from the segment store
+    /*!
+        \param key - Key to remove
+        \return 'true' if the value was removed, 'false' if the given key was not found
+    */
+    bool remove(std::string_view key);
+
+    //! Clear the segment store and delete all its segments
+    void clear();
+
+    //! Flush the active segment to the disk
+    void Flush();
+
+    //! Compact the segment store
+    /*!
+        Rewrites live records into new segments and deletes all old segments.
+        Blocks all other operations of the segment store until completion.
+
+        \return Count of reclaimed bytes
+    */
+    uint64_t Compact();
+
+private:
+    struct Segment
+    {
+        File file;
+        uint64_t size;
+        uint64_t garbage;
+
+        explicit Segment(const Path& path) : file(path), size(0), garbage(0) {}
+    };
+
+    struct Location
+    {
+        uint32_t segment;
+        uint32_t key_size;
+        uint32_t value_size;
+        uint64_t offset;
+    };
+
+    mutable std::shared_mutex _lock;
+    Path _path;
+    size_t _segment_size;
+    bool _opened;
+    uint32_t _active;
+    std::map<uint32_t, std::unique_ptr<Segment>> _segments;
+    std::unordered_map<std::string, Location, TransparentStringHash, std::equal_to<>> _index;
+
+    Path SegmentPath(uint32_t id) const;
+    Segment& CreateSegment(uint32_t id);
+    void ScanSegment(uint32_t id, Segment& segment, bool last);
+    Location Append(std::string_view key, std::string_view value, bool removed);
+    void Discard(const Location& location);
+    static void CloseSegments(std::map<uint32_t, std::unique_ptr<Segment>>& segments, bool remove);
+};
+
+} // namespace CppCommon
+
+#endif // CPPCOMMON_CACHE_SEGMENTSTORE_H
@@ -0,0 +1,223 @@
+/*!
+    \file tieredcache.h
+    \brief Tiered cache definition
+    \author Ivan Shynkarenka
+    \date 15.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_CACHE_TIEREDCACHE_H
+#define CPPCOMMON_CACHE_TIEREDCACHE_H
+
+#include "algorithms/crc32c.h"
+#include "cache/memcache.h"
+#include "cache/segmentstore.h"
+#include "filesystem/exceptions.h"
+#include "filesystem/mapped_file.h"
+#include "utility/endian.h"
+
+#include <atomic>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace CppCommon {
+
+//! Tiered cache codec
+/*!
+    Tiered cache codec encodes keys and values of the tiered cache into bytes
+    of the disk tier and snapshots. It is provided for std::string and
+    trivially copyable types (encoded as their object representation, so the
+    disk tier and snapshots are bound to the platform). Specialize it for
+    other types with the following static methods:
+    \code
+    template <>
+    struct CppCommon::TieredCacheCodec<Order>
+    {
+        static void Encode(const Order& value, std::string& output);
+        static bool Decode(std::string_view input, Order& value);
+    };
+    \endcode
+*/
+template <typename T, typename = void>
+struct TieredCacheCodec;
+
+//! \cond DOXYGEN_SKIP
+//! Tiered cache codec (std::string specialization)
+template <>
+struct TieredCacheCodec<std::string>
+{
+    static void Encode(const std::string& value, std::string& output) { output.assign(value); }
+    static bool Decode(std::string_view input, std::string& value) { value.assign(input); return true; }
+};
+
+//! Tiered cache codec (trivially copyable specialization)
+template <typename T>
+struct TieredCacheCodec<T, std::enable_if_t<std::is_trivially_copyable_v<T>>>
+{
+    static void Encode(const T& value, std::string& output) { output.assign((const char*)&value, sizeof(T)); }
+    static bool Decode(std::string_view input, T& value)
+    {
+        if (input.size() != sizeof(T))
+            return false;
+        std::memcpy(&value, input.data(), sizeof(T));
+        return true;
+    }
+};
+//! \endcond
+
+//! Tiered cache
+/*!
+    Tiered cache combines the memory cache of hot values with the on-disk
+    segment store of cold values. Cache values evicted from the memory tier by
+    its capacity bound are demoted into the disk tier instead of being
+    dropped. Cache values found in the disk tier are promoted back into the
+    memory tier (which might demote other ones). Concurrent misses of the same
+    key are collapsed into a single disk read.
+
+    Memory tier could be saved into the snapshot file and loaded back from it
+    after the restart, so the cache starts warm instead of missing into the
+    database. Snapshot is loaded through the memory-mapped file. Disk tier is
+    kept in its directory between restarts.
+
+    Tiered cache does not support timeouts. Concurrent insert and promotion of
+    the same key might keep any of both values.
+
+    Thread-safe.
+*/
+template <typename TKey, typename TValue, typename TWeigher = MemCacheWeigher<TKey, TValue>, typename TKeyCodec = TieredCacheCodec<TKey>, typename TValueCodec = TieredCacheCodec<TValue>>
+class TieredCache
+{
+public:
+    //! Initialize the tiered cache and open its disk tier
+    /*!
+        \param path - Disk tier directory path
+        \param shards - Memory tier shards count (default is 1)
+        \param capacity - Memory tier capacity in weigher units (default is 0 - unbounded)
+        \param eviction - Memory tier eviction policy (default is MemCacheEviction::LRU)
+        \param weigher - Cache value weigher (default is TWeigher())
+        \param segment_size - Disk tier segment size (default is SegmentStore::DEFAULT_SEGMENT_SIZE)
+    */
+    explicit TieredCache(const Path& path, size_t shards = 1, size_t capacity = 0, MemCacheEviction eviction = MemCacheEviction::LRU, const TWeigher& weigher = TWeigher(), size_t segment_size = SegmentStore::DEFAULT_SEGMENT_SIZE);
+    TieredCache(const TieredCache&) = delete;
+    TieredCache(TieredCache&&) = delete;
+    ~TieredCache() = default;
+
+    TieredCache& operator=(const TieredCache&) = delete;
+    TieredCache& operator=(TieredCache&&) = delete;
+
+    //! Check if the tiered cache is not empty
+    explicit operator bool() const { return !empty(); }
+
+    //! Is the tiered cache empty?
+    bool empty() const { return size() == 0; }
+
+    //! Get the tiered cache size (count of cache values in both tiers)
+    size_t size() const { return _memory.size() + _disk.size(); }
+
+    //! Get the memory tier
+    MemCache<TKey, TValue, TWeigher>& memory() noexcept { return _memory; }
+    const MemCache<TKey, TValue, TWeigher>& memory() const noexcept { return _memory; }
+    //! Get the disk tier
+    SegmentStore& disk() noexcept { return _disk; }
+    const SegmentStore& disk() const noexcept { return _disk; }
+
+    //! Get the count of cache values demoted into the disk tier
+    uint64_t demotions() const noexcept { return _demotions.load(std::memory_order_relaxed); }
+    //! Get the count of cache values promoted into the memory tier
+    uint64_t promotions() const noexcept { return _promotions.load(std::memory_order_relaxed); }
+
+    //! Insert a new cache value into the memory tier
+    /*!
+        Cache value which is heavier than the memory tier shard capacity is
+        inserted directly into the disk tier.
+
+        \param key - Key to insert
+        \param value - Value to insert
+    */
+    void insert(const TKey& key, const TValue& value);
+
+    //! Try to find the cache value by the given key in both tiers
+    /*!
+        \param key - Key to find
+        \param value - Value to find
+        \return 'true' if the cache value was found, 'false' if the given key was not found
+    */
+    bool find(const TKey& key, TValue& value);
+
+    //! Get the cache value by the given key or load and insert it on miss in both tiers
+    /*!
+        Loader is called as loader(const TKey& key, TValue& value) without any
+        tiered cache lock and returns 'true' if the value was loaded (see
+        MemCache::get_or_insert()).
+
+        \param key - Key to get
+        \param value - Value to get
+        \param loader - Value loader
+        \return 'true' if the cache value was found or loaded, 'false' if the loader failed
+    */
+    template <class TLoader>
+    bool get_or_insert(const TKey& key, TValue& value, TLoader&& loader);
+
+    //! Remove the cache value with the given key from both tiers
+    /*!
+        \param key - Key to remove
+        \return 'true' if the cache value was removed, 'false' if the given key was not found
+    */
+    bool remove(const TKey& key);
+
+    //! Clear both tiers
+    void clear();
+
+    //! Flush the disk tier
+    void Flush() { _disk.Flush(); }
+    //! Compact the disk tier (see SegmentStore::Compact())
+    uint64_t Compact() { return _disk.Compact(); }
+
+    //! Save the snapshot of the memory tier into the given file
+    /*!
+        Snapshot is written into the temporary file which replaces the given
+        one when it is completely written. Shards are saved one by one with
+        the shard locked, so the snapshot is approximate under concurrent
+        modifications.
+
+        \param path - Snapshot file path
+        \return Count of saved cache values
+    */
+    size_t Save(const Path& path) const;
+
+    //! Load the snapshot of the memory tier from the given file
+    /*!
+        Snapshot file is mapped into memory and its cache values are inserted
+        into the memory tier. Missing snapshot file is treated as the empty one.
+
+        Will raise std::invalid_argument exception if the snapshot is truncated
+        or corrupted!
+
+        \param path - Snapshot file path
+        \return Count of loaded cache values
+    */
+    size_t Load(const Path& path);
+
+private:
+    static const char MAGIC[8];
+
+    TWeigher _weigher;
+    MemCache<TKey, TValue, TWeigher> _memory;
+    SegmentStore _disk;
+    std::atomic<uint64_t> _demotions;
+    std::atomic<uint64_t> _promotions;
+
+    void Demote(const TKey& key, const TValue& value);
+    bool Promote(const TKey& key, TValue& value);
+};
+
+/*! \example cache_tieredcache.cpp Tiered cache example */
+
+} // namespace CppCommon
+
+#include "tieredcache.inl"
+
+#endif // CPPCOMMON_CACHE_TIEREDCACHE_H
@@ -0,0 +1,202 @@
+/*!
+    \file tieredcache.inl
+    \brief Tiered cache inline implementation
+    \author Ivan Shynkarenka
+    \date 15.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+template <typename TKey, typename TValue, typename TWeigher, typename TKeyCodec, typename TValueCodec>
+const char TieredCache<TKey, TValue, TWeigher, TKeyCodec, TValueCodec>::MAGIC[8] = { 'C', 'C', 'T', 'C', 'A', 'C', 'H', 'E' };
+
+template <typename TKey, typename TValue, typename TWeigher, typename TKeyCodec, typename TValueCodec>
+inline TieredCache<TKey, TValue, TWeigher, TKeyCodec, TValueCodec>::TieredCache(const Path& path, size_t shards, size_t capacity, MemCacheEviction eviction, const TWeigher& weigher, size_t segment_size)
+    : _weigher(weigher), _memory(shards, capacity, eviction, weigher), _disk(path, segment_size), _demotions(0), _promotions(0)
+{
+    _disk.Open();
+
+    // Demote cache values evicted from the memory tier into the disk tier
+    _memory.eviction_handler([this](const TKey& key, TValue&& value) { Demote(key, value); });
+}
+
+template <typename TKey, typename TValue, typename TWeigher, typename TKeyCodec, typename TValueCodec>
+inline void TieredCache<TKey, TValue, TWeigher, TKeyCodec, TValueCodec>::insert(const TKey& key, const TValue& value)
+{
+    // Remove the previous value from the disk tier
+    std::string buffer;
+    TKeyCodec::Encode(key, buffer);
+    if (_disk.find(buffer))
+        _disk.remove(buffer);
+
+    if (!_memory.insert(key, value))
+        Demote(key, value);
+}
+
+template <typename TKey, typename TValue, typename TWeigher, typename TKeyCodec, typename TValueCodec>
+inline bool TieredCache<TKey, TValue, TWeigher, TKeyCodec, TValueCodec>::find(const TKey& key, TValue& value)
+{
+    return _memory.get_or_insert(key, value, [this](const TKey& k, TValue& v) { return Promote(k, v); });
+}
+
+template <typename TKey, typename TValue, typename TWeigher, typename TKeyCodec, typename TValueCodec>
+template <class TLoader>
+inline bool TieredCache<TKey, TValue, TWeigher, TKeyCodec, TValueCodec>::get_or_insert(const TKey& key, TValue& value, TLoader&& loader)
+{
+    return _memory.get_or_insert(key, value, [this, &loader](const TKey& k, TValue& v) { return Promote(k, v) || loader(k, v); });
+}
+
+template <typename TKey, typename TValue, typename TWeigher, typename TKeyCodec, typename TValueCodec>
+inline bool TieredCache<TKey, TValue, TWeigher, TKeyCodec, TValueCodec>::remove(const TKey& key)
+{
+    std::string buffer;
+    TKeyCodec::Encode(key, buffer);
+
+    bool memory = _memory.remove(key);
+    bool disk = _disk.remove(buffer);
+    return memory || disk;
+}
+
+template <typename TKey, typename TValue, typename TWeigher, typename TKeyCodec, typename TValueCodec>
+inline void TieredCache<TKey, TValue, TWeigher, TKeyCodec, TValueCodec>::clear()
+{
+    _memory.clear();
+    _disk.clear();
+}
+
+template <typename TKey, typename TValue, typename TWeigher, typename TKeyCodec, typename TValueCodec>
+inline size_t TieredCache<TKey, TValue, TWeigher, TKeyCodec, TValueCodec>::Save(const Path& path) const
+{
+    Path temp = path + ".tmp";
+
+    File file(temp);
+    file.OpenOrCreate(false, true, true);
+
+    // Header is written when all cache values are saved
+    uint8_t header[24] = { 0 };
+    file.Write(header, sizeof(header));
+
+    size_t count = 0;
+    uint32_t crc = 0;
+    std::string key;
+    std::string value;
+    _memory.visit_all([&](const TKey& k, const TValue& v)
+    {
+        TKeyCodec::Encode(k, key);
+        TValueCodec::Encode(v, value);
+
+        uint8_t sizes[8];
+        Endian::WriteLittleEndian(sizes, (uint32_t)key.size());
+        Endian::WriteLittleEndian(sizes + 4, (uint32_t)value.size());
+        crc = CRC32C::Calculate(sizes, sizeof(sizes), crc);
+        crc = CRC32C::Calculate(key, crc);
+        crc = CRC32C::Calculate(value, crc);
+
+        file.Write(sizes, sizeof(sizes));
+        file.Write(key.data(), key.size());
+        file.Write(value.data(), value.size());
+        ++count;
+    });
+    file.Flush();
+
+    std::memcpy(header, MAGIC, sizeof(MAGIC));
+    Endian::WriteLittleEndian(header + 8, (uint64_t)count);
+    Endian::WriteLittleEndian(header + 16, crc);
+    if (file.WriteAt(0, header, sizeof(header)) != sizeof(header))
+        throwex FileSystemException("Cannot write the tiered cache snapshot header!").Attach(file);
+    file.FlushData();
+    file.Close();
+
+    // Replace the previous snapshot at once
+    Path::Rename(temp, path);
+
+    return count;
+}
+
+template <typename TKey, typename TValue, typename TWeigher, typename TKeyCodec, typename TValueCodec>
+inline size_t TieredCache<TKey, TValue, TWeigher, TKeyCodec, TValueCodec>::Load(const Path& path)
+{
+    if (!path.IsExists())
+        return 0;
+
+    MappedFile file(path);
+    const uint8_t* data = (const uint8_t*)file.data();
+    const size_t size = file.size();
+
+    if (size < 24)
+        throw std::invalid_argument("Tiered cache snapshot is too small!");
+    if (std::memcmp(data, MAGIC, sizeof(MAGIC)) != 0)
+        throw std::invalid_argument("Tiered cache snapshot has invalid format!");
+
+    uint64_t count;
+    uint32_t crc;
+    Endian::ReadLittleEndian(data + 8, count);
+    Endian::ReadLittleEndian(data + 16, crc);
+    if (CRC32C::Calculate(data + 24, size - 24) != crc)
+        throw std::invalid_argument("Tiered cache snapshot is corrupted!");
+
+    // Snapshot is sequentially read once
+    file.Advise(FileAdvice::SEQUENTIAL);
+
+    size_t offset = 24;
+    TKey key;
+    TValue value;
+    for (uint64_t i = 0; i < count; ++i)
+    {
+        if ((size - offset) < 8)
+            throw std::invalid_argument("Tiered cache snapshot is truncated!");
+
+        uint32_t key_size;
+        uint32_t value_size;
+        Endian::ReadLittleEndian(data + offset, key_size);
+        Endian::ReadLittleEndian(data + offset + 4, value_size);
+        offset += 8;
+
+        if (((uint64_t)key_size + value_size) > (size - offset))
+            throw std::invalid_argument("Tiered cache snapshot is truncated!");
+
+        std::string_view key_bytes((const char*)data + offset, key_size);
+        std::string_view value_bytes((const char*)data + offset + key_size, value_size);
+        offset += key_size + value_size;
+
+        if (!TKeyCodec::Decode(key_bytes, key) || !TValueCodec::Decode(value_bytes, value))
+            throw std::invalid_argument("Tiered cache snapshot has invalid cache value!");
+
+        insert(key, value);
+    }
+
+    return (size_t)count;
+}
+
+template <typename TKey, typename TValue, typename TWeigher, typename TKeyCodec, typename TValueCodec>
+inline void TieredCache<TKey, TValue, TWeigher, TKeyCodec, TValueCodec>::Demote(const TKey& key, const TValue& value)
+{
+    std::string key_buffer;
+    std::string value_buffer;
+    TKeyCodec::Encode(key, key_buffer);
+    TValueCodec::Encode(value, value_buffer);
+
+    _disk.insert(key_buffer, value_buffer);
+    _demotions.fetch_add(1, std::memory_order_relaxed);
+}
+
+template <typename TKey, typename TValue, typename TWeigher, typename TKeyCodec, typename TValueCodec>
+inline bool TieredCache<TKey, TValue, TWeigher, TKeyCodec, TValueCodec>::Promote(const TKey& key, TValue& value)
+{
+    std::string key_buffer;
+    std::string value_buffer;
+    TKeyCodec::Encode(key, key_buffer);
+    if (!_disk.find(key_buffer, value_buffer) || !TValueCodec::Decode(value_buffer, value))
+        return false;
+
+    // Keep the cache value in the disk tier if it does not fit into the memory tier shard
+    size_t capacity = (_memory.capacity() + _memory.shards() - 1) / _memory.shards();
+    if ((capacity == 0) || (_weigher(key, value) <= capacity))
+        _disk.remove(key_buffer);
+
+    _promotions.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+} // namespace CppCommon
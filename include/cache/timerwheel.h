@@ -0,0 +1,149 @@
+/*!
+    \file timerwheel.h
+    \brief Hierarchical timer wheel definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_CACHE_TIMERWHEEL_H
+#define CPPCOMMON_CACHE_TIMERWHEEL_H
+
+#include "time/timespan.h"
+#include "time/timestamp.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace CppCommon {
+
+//! Hierarchical timer wheel
+/*!
+    Hierarchical timer wheel schedules items by their expiration timestamps
+    and returns them back when their time comes. Timer wheel consists of four
+    levels of 256 slots, each slot of the next level covers the whole previous
+    level. Insert is O(1), expiration is amortized O(1) per item  with  items
+    of far levels cascaded into near levels when the time passes.
+
+    Time is measured in ticks of the given resolution, so items are grouped in
+    the same slot if their expiration timestamps are within one tick. Items
+    beyond the range of all levels (2^32 ticks) are kept in the farthest slot
+    and cascaded again until their time comes.
+
+    Timer wheel does not support removing of scheduled items. Owners  should
+    validate expired items (e.g. compare the expiration timestamp with  the
+    actual one) and ignore stale items.
+
+    Not thread-safe.
+*/
+template <typename T>
+class TimerWheel
+{
+public:
+    //! Initialize the timer wheel with a given resolution
+    /*!
+        \param resolution - Timer wheel tick resolution (default is 1 millisecond)
+        \param start - Timer wheel start timestamp (default is UtcTimestamp())
+    */
+    explicit TimerWheel(const Timespan& resolution = Timespan::milliseconds(1), const Timestamp& start = UtcTimestamp());
+    TimerWheel(const TimerWheel&) = default;
+    TimerWheel(TimerWheel&&) = default;
+    ~TimerWheel() = default;
+
+    TimerWheel& operator=(const TimerWheel&) = default;
+    TimerWheel& operator=(TimerWheel&&) = default;
+
+    //! Check if the timer wheel is not empty
+    explicit operator bool() const noexcept { return !empty(); }
+
+    //! Is the timer wheel empty?
+    bool empty() const noexcept { return (_size == 0); }
+
+    //! Get the timer wheel size (count of scheduled items)
+    size_t size() const noexcept { return _size; }
+    //! Get the timer wheel resolution
+    Timespan resolution() const noexcept { return Timespan(_resolution); }
+
+    //! Get the earliest timestamp when some scheduled items could expire
+    /*!
+        Timestamp is exact for items of the nearest level and is the lower
+        bound for items of far levels, so the caller (e.g. an event loop) could
+        sleep until it and call expire() without missing any item.
+
+        \return Earliest expiration timestamp or the maximal timestamp if the timer wheel is empty
+    */
+    Timestamp next() const noexcept;
+
+    //! Schedule the given item with the given expiration timestamp
+    /*!
+        \param expire - Expiration timestamp
+        \param item - Item to schedule
+    */
+    void insert(const Timestamp& expire, const T& item);
+    //! Schedule the given item with the given expiration timestamp
+    /*!
+        \param expire - Expiration timestamp
+        \param item - Item to schedule
+    */
+    void insert(const Timestamp& expire, T&& item);
+
+    //! Expire all items with expiration timestamps not greater than the given one
+    /*!
+        Handler is called as handler(const Timestamp& expire, T& item) for each
+        expired item. Handler must not modify the timer wheel.
+
+        If the limit is given, expiration stops after the given count of  items
+        and continues with the next call.
+
+        \param utc - Current timestamp
+        \param handler - Expiration handler
+        \param limit - Expired items limit (default is 0 - unlimited)
+        \return Count of expired items
+    */
+    template <class THandler>
+    size_t expire(const Timestamp& utc, THandler&& handler, size_t limit = 0);
+
+    //! Clear the timer wheel
+    void clear();
+
+    //! Swap two instances
+    void swap(TimerWheel& wheel) noexcept;
+    template <typename U>
+    friend void swap(TimerWheel<U>& wheel1, TimerWheel<U>& wheel2) noexcept;
+
+private:
+    static const size_t LEVELS = 4;
+    static const size_t SLOT_BITS = 8;
+    static const size_t SLOTS = 1 << SLOT_BITS;
+    static const size_t SLOT_MASK = SLOTS - 1;
+
+    struct Timer
+    {
+        uint64_t tick;
+        Timestamp expire;
+        T item;
+
+        Timer(uint64_t t, const Timestamp& e, const T& i) : tick(t), expire(e), item(i) {}
+        Timer(uint64_t t, const Timestamp& e, T&& i) : tick(t), expire(e), item(std::move(i)) {}
+    };
+
+    uint64_t _resolution;
+    uint64_t _current;
+    size_t _size;
+    size_t _counts[LEVELS];
+    std::vector<std::vector<Timer>> _slots;
+
+    uint64_t ticks(const Timestamp& timestamp) const noexcept { return timestamp.total() / _resolution; }
+    std::vector<Timer>& slot(uint64_t tick);
+    void cascade();
+};
+
+} // namespace CppCommon
+
+#include "timerwheel.inl"
+
+#endif // CPPCOMMON_CACHE_TIMERWHEEL_H
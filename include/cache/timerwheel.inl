@@ -0,0 +1,208 @@
+/*!
+    \file timerwheel.inl
+    \brief Hierarchical timer wheel inline implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+template <typename T>
+inline TimerWheel<T>::TimerWheel(const Timespan& resolution, const Timestamp& start)
+    : _resolution((resolution.total() > 0) ? (uint64_t)resolution.total() : 1),
+      _current(0),
+      _size(0),
+      _counts(),
+      _slots(LEVELS * SLOTS)
+{
+    _current = ticks(start);
+}
+
+template <typename T>
+inline void TimerWheel<T>::insert(const Timestamp& expire, const T& item)
+{
+    uint64_t tick = std::max(ticks(expire), _current);
+    slot(tick).emplace_back(tick, expire, item);
+    ++_size;
+}
+
+template <typename T>
+inline void TimerWheel<T>::insert(const Timestamp& expire, T&& item)
+{
+    uint64_t tick = std::max(ticks(expire), _current);
+    slot(tick).emplace_back(tick, expire, std::move(item));
+    ++_size;
+}
+
+template <typename T>
+inline Timestamp TimerWheel<T>::next() const noexcept
+{
+    uint64_t result = std::numeric_limits<uint64_t>::max();
+    if (_size == 0)
+        return Timestamp(result);
+
+    // Find the earliest expiration timestamp of the first non empty slot of the nearest level
+    if (_counts[0] > 0)
+    {
+        for (uint64_t tick = _current; tick < (_current + SLOTS); ++tick)
+        {
+            const std::vector<Timer>& timers = _slots[tick & SLOT_MASK];
+            if (!timers.empty())
+            {
+                for (const auto& timer : timers)
+                    result = std::min(result, timer.expire.total());
+                break;
+            }
+        }
+    }
+
+    // Find the start tick of the first non empty slot of each far level
+    for (size_t level = 1; level < LEVELS; ++level)
+    {
+        if (_counts[level] == 0)
+            continue;
+
+        uint64_t base = _current >> (SLOT_BITS * level);
+        for (uint64_t index = base + 1; index <= (base + SLOTS); ++index)
+        {
+            if (!_slots[level * SLOTS + (index & SLOT_MASK)].empty())
+            {
+                result = std::min(result, (index << (SLOT_BITS * level)) * _resolution);
+                break;
+            }
+        }
+    }
+
+    return Timestamp(result);
+}
+
+template <typename T>
+inline std::vector<typename TimerWheel<T>::Timer>& TimerWheel<T>::slot(uint64_t tick)
+{
+    // Find the nearest level which covers the given tick
+    uint64_t delta = tick - _current;
+    for (size_t level = 0; level < LEVELS; ++level)
+    {
+        if (delta < ((uint64_t)1 << (SLOT_BITS * (level + 1))))
+        {
+            ++_counts[level];
+            return _slots[level * SLOTS + ((tick >> (SLOT_BITS * level)) & SLOT_MASK)];
+        }
+    }
+
+    // Keep the tick beyond all levels in the farthest slot of the last level
+    ++_counts[LEVELS - 1];
+    tick = _current + ((uint64_t)1 << (SLOT_BITS * LEVELS)) - 1;
+    return _slots[(LEVELS - 1) * SLOTS + ((tick >> (SLOT_BITS * (LEVELS - 1))) & SLOT_MASK)];
+}
+
+template <typename T>
+inline void TimerWheel<T>::cascade()
+{
+    // Redistribute timers of far levels which slots are reached by the current tick
+    for (size_t level = 1; level < LEVELS; ++level)
+    {
+        size_t index = (size_t)((_current >> (SLOT_BITS * level)) & SLOT_MASK);
+        std::vector<Timer> timers;
+        timers.swap(_slots[level * SLOTS + index]);
+        _counts[level] -= timers.size();
+        for (auto& timer : timers)
+            slot(std::max(timer.tick, _current)).emplace_back(std::move(timer));
+        if (index != 0)
+            break;
+    }
+}
+
+template <typename T>
+template <class THandler>
+inline size_t TimerWheel<T>::expire(const Timestamp& utc, THandler&& handler, size_t limit)
+{
+    size_t result = 0;
+    uint64_t target = ticks(utc);
+
+    while (_size > 0)
+    {
+        // Process timers of the current slot
+        std::vector<Timer>& timers = _slots[_current & SLOT_MASK];
+        size_t index = 0;
+        while (index < timers.size())
+        {
+            if ((limit > 0) && (result >= limit))
+                break;
+
+            Timer& timer = timers[index];
+            if (timer.expire <= utc)
+            {
+                handler(timer.expire, timer.item);
+                if (index != (timers.size() - 1))
+                    timer = std::move(timers.back());
+                timers.pop_back();
+                --_counts[0];
+                --_size;
+                ++result;
+            }
+            else
+                ++index;
+        }
+
+        // Stop with the current slot if the limit is reached or the target tick is reached
+        if (((limit > 0) && (result >= limit)) || (_current >= target))
+            break;
+
+        // Skip empty levels up to the next cascade of the first non empty level or the target tick
+        size_t level = 0;
+        while ((level < (LEVELS - 1)) && (_counts[level] == 0))
+            ++level;
+        if (level > 0)
+        {
+            uint64_t next = ((_current >> (SLOT_BITS * level)) + 1) << (SLOT_BITS * level);
+            if (next > target)
+            {
+                _current = target;
+                break;
+            }
+            _current = next;
+        }
+        else
+            ++_current;
+
+        // Cascade timers of far levels
+        if ((_current & SLOT_MASK) == 0)
+            cascade();
+    }
+
+    // Move the current tick forward for the empty timer wheel
+    if ((_size == 0) && (_current < target))
+        _current = target;
+
+    return result;
+}
+
+template <typename T>
+inline void TimerWheel<T>::clear()
+{
+    for (auto& timers : _slots)
+        timers.clear();
+    _size = 0;
+    std::fill(std::begin(_counts), std::end(_counts), 0);
+}
+
+template <typename T>
+inline void TimerWheel<T>::swap(TimerWheel& wheel) noexcept
+{
+    using std::swap;
+    swap(_resolution, wheel._resolution);
+    swap(_current, wheel._current);
+    swap(_size, wheel._size);
+    swap(_counts, wheel._counts);
+    swap(_slots, wheel._slots);
+}
+
+template <typename T>
+inline void swap(TimerWheel<T>& wheel1, TimerWheel<T>& wheel2) noexcept
+{
+    wheel1.swap(wheel2);
+}
+
+} // namespace CppCommon
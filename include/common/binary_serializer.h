@@ -0,0 +1,160 @@
+/*!
+    \file binary_serializer.h
+    \brief Binary serializer definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_BINARY_SERIALIZER_H
+#define CPPCOMMON_BINARY_SERIALIZER_H
+
+#include "common/writer.h"
+#include "utility/endian.h"
+
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <span>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+namespace CppCommon {
+
+//! Binary encoding of the integer field
+enum class BinaryEncoding : uint8_t
+{
+    FIXED,          //!< Little-endian fixed size value
+    VARINT          //!< Variable length value (LEB128, signed values are zigzag encoded)
+};
+
+//! Binary field description
+/*!
+    \tparam Member - Pointer to the serialized class member
+    \tparam Encoding - Binary encoding of the integer member (default is BinaryEncoding::FIXED)
+*/
+template <auto Member, BinaryEncoding Encoding = BinaryEncoding::FIXED>
+struct BinaryField
+{
+    static constexpr auto member = Member;
+    static constexpr BinaryEncoding encoding = Encoding;
+};
+
+//! Binary schema of the serialized class
+/*!
+    Binary schema should be specialized for each serialized class with the
+    'fields' type which is the tuple of its binary fields in the serialized
+    order:
+
+    \code
+    template <>
+    struct CppCommon::BinarySchema<Order>
+    {
+        typedef std::tuple<
+            BinaryField<&Order::id, BinaryEncoding::VARINT>,
+            BinaryField<&Order::symbol>,
+            BinaryField<&Order::price>> fields;
+    };
+    \endcode
+*/
+template <typename T>
+struct BinarySchema;
+
+//! Binary serializer
+/*!
+    Binary serializer encodes classes described with BinarySchema into the
+    compact binary format without any field tags:
+    - bool and 8-bit integers are encoded as one byte;
+    - integers and enums are encoded as little-endian fixed values or as
+      variable length values (signed ones are zigzag encoded);
+    - float and double are encoded as little-endian fixed values;
+    - std::string, std::string_view, std::vector<uint8_t> and
+      std::span<const uint8_t> are encoded as the variable length size
+      followed by bytes;
+    - nested classes with binary schemas are encoded field by field.
+
+    The field list is resolved in compile time, so serialization is compiled
+    into the plain sequence of stores without virtual calls or allocations.
+    Serialization into the buffer (e.g. the ring buffer reservation) writes
+    the exact size calculated with Size() without bounds checks of separate
+    fields. Serialization into the writer collects small fields in the stack
+    buffer and writes big strings directly.
+
+    Deserialization checks the input bounds and never allocates memory for
+    std::string_view and std::span<const uint8_t> fields, they are views of
+    the deserialized input buffer.
+
+    Thread-safe.
+*/
+class BinarySerializer
+{
+public:
+    BinarySerializer() = delete;
+    BinarySerializer(const BinarySerializer&) = delete;
+    BinarySerializer(BinarySerializer&&) = delete;
+    ~BinarySerializer() = delete;
+
+    BinarySerializer& operator=(const BinarySerializer&) = delete;
+    BinarySerializer& operator=(BinarySerializer&&) = delete;
+
+    //! Calculate the serialized size of the given value
+    /*!
+        \param value - Value to serialize
+        \return Serialized size in bytes
+    */
+    template <typename T>
+    static size_t Size(const T& value) noexcept;
+
+    //! Serialize the given value into the given buffer
+    /*!
+        \param value - Value to serialize
+        \param buffer - Buffer to serialize
+        \return Serialized size in bytes or 0 if the buffer is too small
+    */
+    template <typename T>
+    static size_t Serialize(const T& value, std::span<uint8_t> buffer) noexcept;
+    //! Serialize the given value into the given writer
+    /*!
+        \param value - Value to serialize
+        \param writer - Writer to serialize
+        \return Count of written bytes (less than the serialized size if the writer is full)
+    */
+    template <typename T>
+    static size_t Serialize(const T& value, Writer& writer);
+
+    //! Serialize the given value into the reserved region of the given ring buffer
+    /*!
+        Ring buffer should provide std::span<uint8_t> Reserve(size_t) and Commit(size_t)
+        methods (e.g. SPSCRingBuffer or SharedSPSCRingBuffer).
+
+        \param buffer - Ring buffer
+        \param value - Value to serialize
+        \return 'true' if the value was successfully serialized, 'false' if the ring buffer is full
+    */
+    template <class TRingBuffer, typename T>
+    static bool Enqueue(TRingBuffer& buffer, const T& value);
+
+    //! Deserialize the value from the given buffer
+    /*!
+        String views and byte spans of the deserialized value point into the
+        given buffer and are valid while the buffer is valid.
+
+        \param buffer - Buffer to deserialize
+        \param value - Deserialized value
+        \return Count of deserialized bytes or 0 if the buffer is truncated or malformed
+    */
+    template <typename T>
+    static size_t Deserialize(std::span<const uint8_t> buffer, T& value);
+};
+
+/*! \example common_binary_serializer.cpp Binary serializer example */
+
+} // namespace CppCommon
+
+#include "binary_serializer.inl"
+
+#endif // CPPCOMMON_BINARY_SERIALIZER_H
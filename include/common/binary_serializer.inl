@@ -0,0 +1,463 @@
+/*!
+    \file binary_serializer.inl
+    \brief Binary serializer inline implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+namespace Internals {
+
+template <typename T>
+constexpr bool BinaryUnsupported = false;
+
+template <typename T, typename = void>
+constexpr bool HasBinarySchema = false;
+
+template <typename T>
+constexpr bool HasBinarySchema<T, std::void_t<typename BinarySchema<T>::fields>> = true;
+
+template <typename T>
+constexpr bool IsBinaryBytes = std::is_same_v<T, std::string> || std::is_same_v<T, std::string_view> ||
+                               std::is_same_v<T, std::vector<uint8_t>> || std::is_same_v<T, std::span<const uint8_t>>;
+
+constexpr size_t VarintSize(uint64_t value) noexcept
+{
+    return ((size_t)std::bit_width(value | 1) + 6) / 7;
+}
+
+template <typename T>
+constexpr uint64_t ToVarint(T value) noexcept
+{
+    if constexpr (std::is_signed_v<T>)
+        return ((uint64_t)(int64_t)value << 1) ^ (uint64_t)((int64_t)value >> 63);
+    else
+        return (uint64_t)value;
+}
+
+template <typename T>
+constexpr bool FromVarint(uint64_t varint, T& value) noexcept
+{
+    if constexpr (std::is_signed_v<T>)
+    {
+        int64_t result = (int64_t)(varint >> 1) ^ -(int64_t)(varint & 1);
+        if ((result < (int64_t)std::numeric_limits<T>::min()) || (result > (int64_t)std::numeric_limits<T>::max()))
+            return false;
+        value = (T)result;
+    }
+    else
+    {
+        if (varint > (uint64_t)std::numeric_limits<T>::max())
+            return false;
+        value = (T)varint;
+    }
+    return true;
+}
+
+// Floating point values are encoded as integers of the same size
+template <typename T>
+using BinaryFloatBits = std::conditional_t<sizeof(T) == 4, uint32_t, uint64_t>;
+
+// Output into the buffer of the precalculated size
+class BinaryBufferOutput
+{
+public:
+    explicit BinaryBufferOutput(uint8_t* data) noexcept : _data(data) {}
+
+    uint8_t* data() const noexcept { return _data; }
+
+    void Byte(uint8_t value) noexcept { *_data++ = value; }
+
+    template <typename T>
+    void Fixed(T value) noexcept
+    {
+        Endian::StoreLittleEndian(_data, value);
+        _data += sizeof(T);
+    }
+
+    void Varint(uint64_t value) noexcept
+    {
+        while (value >= 0x80)
+        {
+            *_data++ = (uint8_t)(value | 0x80);
+            value >>= 7;
+        }
+        *_data++ = (uint8_t)value;
+    }
+
+    void Bytes(const void* data, size_t size) noexcept
+    {
+        if (size > 0)
+            std::memcpy(_data, data, size);
+        _data += size;
+    }
+
+private:
+    uint8_t* _data;
+};
+
+// Output into the writer through the stack buffer
+class BinaryWriterOutput
+{
+public:
+    static constexpr size_t CHUNK = 512;
+
+    explicit BinaryWriterOutput(Writer& writer) noexcept : _writer(writer), _size(0), _written(0), _failed(false) {}
+
+    void Byte(uint8_t value) { Reserve(1); _buffer[_size++] = value; }
+
+    template <typename T>
+    void Fixed(T value)
+    {
+        Reserve(sizeof(T));
+        Endian::StoreLittleEndian(_buffer + _size, value);
+        _size += sizeof(T);
+    }
+
+    void Varint(uint64_t value)
+    {
+        Reserve(10);
+        BinaryBufferOutput output(_buffer + _size);
+        output.Varint(value);
+        _size = (size_t)(output.data() - _buffer);
+    }
+
+    void Bytes(const void* data, size_t size)
+    {
+        if (size > (CHUNK - _size))
+        {
+            Flush();
+
+            // Write big buffers directly into the writer
+            if (size >= CHUNK)
+            {
+                if (!_failed)
+                {
+                    size_t written = _writer.Write(data, size);
+                    _written += written;
+                    _failed = (written < size);
+                }
+                return;
+            }
+        }
+
+        if (size > 0)
+            std::memcpy(_buffer + _size, data, size);
+        _size += size;
+    }
+
+    size_t Finish()
+    {
+        Flush();
+        return _written;
+    }
+
+private:
+    Writer& _writer;
+    uint8_t _buffer[CHUNK];
+    size_t _size;
+    size_t _written;
+    bool _failed;
+
+    void Reserve(size_t size)
+    {
+        if ((CHUNK - _size) < size)
+            Flush();
+    }
+
+    void Flush()
+    {
+        if ((_size > 0) && !_failed)
+        {
+            size_t written = _writer.Write(_buffer, _size);
+            _written += written;
+            _failed = (written < _size);
+        }
+        _size = 0;
+    }
+};
+
+// Bounds checked input of the deserialized buffer
+class BinaryInput
+{
+public:
+    BinaryInput(const uint8_t* data, size_t size) noexcept : _data(data), _end(data + size) {}
+
+    const uint8_t* data() const noexcept { return _data; }
+
+    bool Byte(uint8_t& value) noexcept
+    {
+        if (_data == _end)
+            return false;
+        value = *_data++;
+        return true;
+    }
+
+    template <typename T>
+    bool Fixed(T& value) noexcept
+    {
+        if ((size_t)(_end - _data) < sizeof(T))
+            return false;
+        value = Endian::LoadLittleEndian<T>(_data);
+        _data += sizeof(T);
+        return true;
+    }
+
+    bool Varint(uint64_t& value) noexcept
+    {
+        uint64_t result = 0;
+        for (size_t shift = 0; shift < 64; shift += 7)
+        {
+            if (_data == _end)
+                return false;
+            uint8_t byte = *_data++;
+            // The last byte of 64-bit value has the only significant bit
+            if ((shift == 63) && (byte > 1))
+                return false;
+            result |= (uint64_t)(byte & 0x7F) << shift;
+            if (byte < 0x80)
+            {
+                value = result;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool Bytes(size_t size, const uint8_t*& data) noexcept
+    {
+        if ((size_t)(_end - _data) < size)
+            return false;
+        data = _data;
+        _data += size;
+        return true;
+    }
+
+private:
+    const uint8_t* _data;
+    const uint8_t* _end;
+};
+
+template <typename T>
+constexpr size_t BinaryStructSize(const T& value) noexcept;
+template <typename TOutput, typename T>
+void BinaryStructEncode(TOutput& output, const T& value);
+template <typename T>
+bool BinaryStructDecode(BinaryInput& input, T& value);
+
+template <BinaryEncoding Encoding, typename T>
+constexpr size_t BinaryFieldSize(const T& value) noexcept
+{
+    if constexpr (std::is_enum_v<T>)
+        return BinaryFieldSize<Encoding>((std::underlying_type_t<T>)value);
+    else if constexpr (std::is_same_v<T, bool> || (std::is_integral_v<T> && (sizeof(T) == 1)))
+        return 1;
+    else if constexpr (std::is_integral_v<T>)
+    {
+        if constexpr (Encoding == BinaryEncoding::VARINT)
+            return VarintSize(ToVarint(value));
+        else
+            return sizeof(T);
+    }
+    else if constexpr (std::is_floating_point_v<T>)
+    {
+        static_assert((sizeof(T) == 4) || (sizeof(T) == 8), "Only float and double values are supported!");
+        return sizeof(T);
+    }
+    else if constexpr (IsBinaryBytes<T>)
+        return VarintSize(value.size()) + value.size();
+    else if constexpr (HasBinarySchema<T>)
+        return BinaryStructSize(value);
+    else
+        static_assert(BinaryUnsupported<T>, "Unsupported binary field type!");
+}
+
+template <BinaryEncoding Encoding, typename TOutput, typename T>
+void BinaryFieldEncode(TOutput& output, const T& value)
+{
+    if constexpr (std::is_enum_v<T>)
+        BinaryFieldEncode<Encoding>(output, (std::underlying_type_t<T>)value);
+    else if constexpr (std::is_same_v<T, bool>)
+        output.Byte(value ? 1 : 0);
+    else if constexpr (std::is_integral_v<T> && (sizeof(T) == 1))
+        output.Byte((uint8_t)value);
+    else if constexpr (std::is_integral_v<T>)
+    {
+        if constexpr (Encoding == BinaryEncoding::VARINT)
+            output.Varint(ToVarint(value));
+        else
+            output.Fixed(value);
+    }
+    else if constexpr (std::is_floating_point_v<T>)
+        output.Fixed(std::bit_cast<BinaryFloatBits<T>>(value));
+    else if constexpr (IsBinaryBytes<T>)
+    {
+        output.Varint(value.size());
+        output.Bytes(value.data(), value.size());
+    }
+    else if constexpr (HasBinarySchema<T>)
+        BinaryStructEncode(output, value);
+    else
+        static_assert(BinaryUnsupported<T>, "Unsupported binary field type!");
+}
+
+template <BinaryEncoding Encoding, typename T>
+bool BinaryFieldDecode(BinaryInput& input, T& value)
+{
+    if constexpr (std::is_enum_v<T>)
+    {
+        std::underlying_type_t<T> result;
+        if (!BinaryFieldDecode<Encoding>(input, result))
+            return false;
+        value = (T)result;
+        return true;
+    }
+    else if constexpr (std::is_same_v<T, bool>)
+    {
+        uint8_t result;
+        if (!input.Byte(result) || (result > 1))
+            return false;
+        value = (result != 0);
+        return true;
+    }
+    else if constexpr (std::is_integral_v<T> && (sizeof(T) == 1))
+    {
+        uint8_t result;
+        if (!input.Byte(result))
+            return false;
+        value = (T)result;
+        return true;
+    }
+    else if constexpr (std::is_integral_v<T>)
+    {
+        if constexpr (Encoding == BinaryEncoding::VARINT)
+        {
+            uint64_t varint;
+            return input.Varint(varint) && FromVarint(varint, value);
+        }
+        else
+            return input.Fixed(value);
+    }
+    else if constexpr (std::is_floating_point_v<T>)
+    {
+        BinaryFloatBits<T> bits;
+        if (!input.Fixed(bits))
+            return false;
+        value = std::bit_cast<T>(bits);
+        return true;
+    }
+    else if constexpr (IsBinaryBytes<T>)
+    {
+        uint64_t size;
+        const uint8_t* data;
+        if (!input.Varint(size) || (size > SIZE_MAX) || !input.Bytes((size_t)size, data))
+            return false;
+        if constexpr (std::is_same_v<T, std::string> || std::is_same_v<T, std::string_view>)
+            value = T((const char*)data, (size_t)size);
+        else
+            value = T(data, data + size);
+        return true;
+    }
+    else if constexpr (HasBinarySchema<T>)
+        return BinaryStructDecode(input, value);
+    else
+        static_assert(BinaryUnsupported<T>, "Unsupported binary field type!");
+}
+
+template <typename T, typename... TFields>
+constexpr size_t BinaryFieldsSize(const T& value, std::tuple<TFields...>*) noexcept
+{
+    return (BinaryFieldSize<TFields::encoding>(value.*TFields::member) + ... + 0);
+}
+
+template <typename TOutput, typename T, typename... TFields>
+void BinaryFieldsEncode(TOutput& output, const T& value, std::tuple<TFields...>*)
+{
+    (BinaryFieldEncode<TFields::encoding>(output, value.*TFields::member), ...);
+}
+
+template <typename T, typename... TFields>
+bool BinaryFieldsDecode(BinaryInput& input, T& value, std::tuple<TFields...>*)
+{
+    return (BinaryFieldDecode<TFields::encoding>(input, value.*TFields::member) && ...);
+}
+
+template <typename T>
+constexpr size_t BinaryStructSize(const T& value) noexcept
+{
+    return BinaryFieldsSize(value, (typename BinarySchema<T>::fields*)nullptr);
+}
+
+template <typename TOutput, typename T>
+void BinaryStructEncode(TOutput& output, const T& value)
+{
+    BinaryFieldsEncode(output, value, (typename BinarySchema<T>::fields*)nullptr);
+}
+
+template <typename T>
+bool BinaryStructDecode(BinaryInput& input, T& value)
+{
+    return BinaryFieldsDecode(input, value, (typename BinarySchema<T>::fields*)nullptr);
+}
+
+} // namespace Internals
+//! @endcond
+
+template <typename T>
+inline size_t BinarySerializer::Size(const T& value) noexcept
+{
+    static_assert(Internals::HasBinarySchema<T>, "Serialized type must have the binary schema!");
+    return Internals::BinaryStructSize(value);
+}
+
+template <typename T>
+inline size_t BinarySerializer::Serialize(const T& value, std::span<uint8_t> buffer) noexcept
+{
+    size_t size = Size(value);
+    if (size > buffer.size())
+        return 0;
+
+    Internals::BinaryBufferOutput output(buffer.data());
+    Internals::BinaryStructEncode(output, value);
+    return size;
+}
+
+template <typename T>
+inline size_t BinarySerializer::Serialize(const T& value, Writer& writer)
+{
+    static_assert(Internals::HasBinarySchema<T>, "Serialized type must have the binary schema!");
+
+    Internals::BinaryWriterOutput output(writer);
+    Internals::BinaryStructEncode(output, value);
+    return output.Finish();
+}
+
+template <class TRingBuffer, typename T>
+inline bool BinarySerializer::Enqueue(TRingBuffer& buffer, const T& value)
+{
+    size_t size = Size(value);
+    std::span<uint8_t> data = buffer.Reserve(size);
+    if (data.empty())
+        return false;
+
+    Internals::BinaryBufferOutput output(data.data());
+    Internals::BinaryStructEncode(output, value);
+    buffer.Commit(size);
+    return true;
+}
+
+template <typename T>
+inline size_t BinarySerializer::Deserialize(std::span<const uint8_t> buffer, T& value)
+{
+    static_assert(Internals::HasBinarySchema<T>, "Deserialized type must have the binary schema!");
+
+    Internals::BinaryInput input(buffer.data(), buffer.size());
+    if (!Internals::BinaryStructDecode(input, value))
+        return 0;
+    return (size_t)(input.data() - buffer.data());
+}
+
+} // namespace CppCommon
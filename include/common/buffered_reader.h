@@ -0,0 +1,105 @@
+/*!
+    \file buffered_reader.h
+    \brief Buffered reader definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_BUFFERED_READER_H
+#define CPPCOMMON_BUFFERED_READER_H
+
+#include "common/reader.h"
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace CppCommon {
+
+//! Buffered reader
+/*!
+    Buffered reader reads the underlying reader (e.g. File, Pipe or StdInput)
+    by big blocks into the internal buffer and exposes buffered bytes as the
+    span, so records might be parsed in place without copying them:
+
+    \code
+    auto header = reader.Peek(sizeof(Header));
+    if (header.size() < sizeof(Header))
+        return false;
+    ...
+    reader.Consume(sizeof(Header));
+    \endcode
+
+    Read() copies buffered bytes and reads big buffers directly from the
+    underlying reader bypassing the internal buffer.
+
+    Not thread-safe.
+*/
+class BufferedReader : public Reader
+{
+public:
+    //! Default read buffer size (64 kilobytes)
+    static const size_t DEFAULT_BUFFER;
+
+    //! Initialize buffered reader with a given reader
+    /*!
+        \param reader - Underlying reader
+        \param buffer - Initial read buffer size (default is BufferedReader::DEFAULT_BUFFER)
+    */
+    explicit BufferedReader(Reader& reader, size_t buffer = DEFAULT_BUFFER);
+    BufferedReader(const BufferedReader&) = delete;
+    BufferedReader(BufferedReader&&) = delete;
+    ~BufferedReader() = default;
+
+    BufferedReader& operator=(const BufferedReader&) = delete;
+    BufferedReader& operator=(BufferedReader&&) = delete;
+
+    //! Get the read buffer capacity
+    size_t capacity() const noexcept { return _buffer.size(); }
+    //! Get the count of buffered bytes
+    size_t buffered() const noexcept { return _end - _begin; }
+
+    //! Peek buffered bytes without consuming them
+    /*!
+        Reads the underlying reader until at least the given count of bytes
+        is buffered or the reader is exhausted. The read buffer grows if the
+        requested size is greater than its capacity.
+
+        Peeked bytes are valid until the next read, peek or consume operation.
+
+        \param size - Required count of bytes (default is 1)
+        \return Span of all buffered bytes (less than the required size only at the end of the reader)
+    */
+    std::span<const uint8_t> Peek(size_t size = 1);
+    //! Consume the given count of peeked bytes
+    /*!
+        \param size - Count of bytes to consume (must not be greater than the count of buffered bytes)
+    */
+    void Consume(size_t size) noexcept;
+
+    //! Read a bytes buffer
+    /*!
+        \param buffer - Buffer to read
+        \param size - Buffer size
+        \return Count of read bytes
+    */
+    size_t Read(void* buffer, size_t size) override;
+
+    //! Get the count of bytes remaining to read if it is known
+    uint64_t remaining() const override;
+
+    using Reader::ReadAllBytes;
+    using Reader::ReadAllText;
+    using Reader::ReadAllLines;
+
+private:
+    Reader* _reader;
+    std::vector<uint8_t> _buffer;
+    size_t _begin;
+    size_t _end;
+};
+
+} // namespace CppCommon
+
+#endif // CPPCOMMON_BUFFERED_READER_H
@@ -0,0 +1,119 @@
+/*!
+    \file buffered_writer.h
+    \brief Buffered writer definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_BUFFERED_WRITER_H
+#define CPPCOMMON_BUFFERED_WRITER_H
+
+#include "common/writer.h"
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace CppCommon {
+
+//! Buffered writer
+/*!
+    Buffered writer collects small writes in the internal buffer and writes
+    them into the underlying writer (e.g. File, Pipe or StdOutput) by big
+    blocks. The internal buffer is exposed as the span, so records might be
+    serialized in place without copying them:
+
+    \code
+    auto buffer = writer.Prepare(sizeof(Header));
+    Header* header = new (buffer.data()) Header();
+    ...
+    writer.Commit(sizeof(Header));
+    \endcode
+
+    Big buffers are written directly into the underlying writer bypassing
+    the internal buffer. Buffered bytes are written into the underlying
+    writer on flush and on destruction.
+
+    Not thread-safe.
+*/
+class BufferedWriter : public Writer
+{
+public:
+    //! Default write buffer size (64 kilobytes)
+    static const size_t DEFAULT_BUFFER;
+
+    //! Initialize buffered writer with a given writer
+    /*!
+        \param writer - Underlying writer
+        \param buffer - Initial write buffer size (default is BufferedWriter::DEFAULT_BUFFER)
+    */
+    explicit BufferedWriter(Writer& writer, size_t buffer = DEFAULT_BUFFER);
+    BufferedWriter(const BufferedWriter&) = delete;
+    BufferedWriter(BufferedWriter&&) = delete;
+    ~BufferedWriter();
+
+    BufferedWriter& operator=(const BufferedWriter&) = delete;
+    BufferedWriter& operator=(BufferedWriter&&) = delete;
+
+    //! Get the write buffer capacity
+    size_t capacity() const noexcept { return _buffer.size(); }
+    //! Get the count of buffered bytes
+    size_t buffered() const noexcept { return _size; }
+
+    //! Prepare the free space of the write buffer
+    /*!
+        Writes buffered bytes into the underlying writer if the free space
+        is not enough. The write buffer grows if the required size is greater
+        than its capacity.
+
+        Prepared span is valid until the next write, prepare or flush operation.
+
+        \param size - Required count of bytes
+        \return Span of the free space of the write buffer (not less than the required size)
+    */
+    std::span<uint8_t> Prepare(size_t size);
+    //! Commit the given count of bytes written into the prepared span
+    /*!
+        \param size - Count of bytes to commit (must not be greater than the prepared span size)
+    */
+    void Commit(size_t size) noexcept;
+
+    //! Write a byte buffer
+    /*!
+        \param buffer - Buffer to write
+        \param size - Buffer size
+        \return Count of written bytes
+    */
+    size_t Write(const void* buffer, size_t size) override;
+    //! Write bytes buffers
+    /*!
+        Small buffers are copied into the write buffer, big ones are written
+        with one vectored write of the underlying writer.
+
+        \param buffers - Buffers to write
+        \return Count of written bytes
+    */
+    size_t WriteV(std::span<const WriteBuffer> buffers) override;
+
+    using Writer::Write;
+    using Writer::WriteV;
+
+    //! Write buffered bytes and flush the underlying writer
+    void Flush() override;
+
+private:
+    Writer* _writer;
+    std::vector<uint8_t> _buffer;
+    size_t _size;
+
+    //! Write buffered bytes into the underlying writer
+    /*!
+        \return 'true' if all buffered bytes were written, 'false' if the underlying writer is full
+    */
+    bool FlushBuffer();
+};
+
+} // namespace CppCommon
+
+#endif // CPPCOMMON_BUFFERED_WRITER_H
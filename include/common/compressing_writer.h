@@ -0,0 +1,137 @@
+/*!
+    \file compressing_writer.h
+    \brief Compressing writer definition
+    \author Ivan Shynkarenka
+    \date 15.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_COMPRESSING_WRITER_H
+#define CPPCOMMON_COMPRESSING_WRITER_H
+
+#include "algorithms/xxh32.h"
+#include "common/writer.h"
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace CppCommon {
+
+class ThreadPool;
+
+//! Compressing writer
+/*!
+    Compressing writer collects written bytes into blocks, compresses them
+    with LZ4 and writes them into the underlying writer (e.g. File, Pipe or
+    StdOutput) in the LZ4 frame format with independent blocks and the
+    content checksum. Written frames could be read with DecompressingReader
+    or decompressed with the reference lz4 tool.
+
+    If the thread pool is given, full blocks are compressed in parallel by
+    the thread pool workers and written into the underlying writer in the
+    original order. This is useful for big snapshots where the compression
+    is slower than the underlying storage.
+
+    Flush() compresses buffered bytes into the short block and flushes the
+    underlying writer, so the frame could be read up to the last flushed
+    block (e.g. journals). Finish() writes the end of the frame, the next
+    write starts a new frame. Unfinished frame is finished on destruction.
+
+    Not thread-safe.
+
+    https://github.com/lz4/lz4/blob/dev/doc/lz4_Frame_format.md
+*/
+class CompressingWriter : public Writer
+{
+public:
+    //! Default block size (256 kilobytes)
+    static const size_t DEFAULT_BLOCK;
+
+    //! Initialize compressing writer with a given writer
+    /*!
+        Block size is rounded up to one of LZ4 frame block sizes: 64 kilobytes,
+        256 kilobytes, 1 megabyte or 4 megabytes.
+
+        \param writer - Underlying writer
+        \param block - Block size (default is CompressingWriter::DEFAULT_BLOCK)
+        \param pool - Thread pool to compress blocks in parallel (default is nullptr)
+    */
+    explicit CompressingWriter(Writer& writer, size_t block = DEFAULT_BLOCK, ThreadPool* pool = nullptr);
+    CompressingWriter(const CompressingWriter&) = delete;
+    CompressingWriter(CompressingWriter&&) = delete;
+    ~CompressingWriter();
+
+    CompressingWriter& operator=(const CompressingWriter&) = delete;
+    CompressingWriter& operator=(CompressingWriter&&) = delete;
+
+    //! Get the block size
+    size_t block() const noexcept { return _block; }
+    //! Get the total count of written bytes
+    uint64_t total() const noexcept { return _total; }
+    //! Get the total count of compressed bytes written into the underlying writer
+    uint64_t compressed() const noexcept { return _compressed; }
+
+    //! Write a byte buffer
+    /*!
+        \param buffer - Buffer to write
+        \param size - Buffer size
+        \return Count of written bytes
+    */
+    size_t Write(const void* buffer, size_t size) override;
+
+    using Writer::Write;
+
+    //! Compress buffered bytes, write all compressed blocks and flush the underlying writer
+    void Flush() override;
+    //! Flush and write the end of the frame
+    void Finish();
+
+private:
+    // Compressed block
+    struct Block
+    {
+        std::vector<uint8_t> raw;
+        std::vector<uint8_t> compressed;
+        size_t size{0};
+        size_t length{0};
+        bool stored{false};
+        bool done{false};
+    };
+
+    Writer* _writer;
+    size_t _block;
+    ThreadPool* _pool;
+    size_t _inflight;
+    uint64_t _total;
+    uint64_t _compressed;
+    bool _started;
+    XXH32 _checksum;
+
+    std::unique_ptr<Block> _current;
+    std::deque<std::unique_ptr<Block>> _pending;
+    std::vector<std::unique_ptr<Block>> _free;
+    std::mutex _lock;
+    std::condition_variable _cv;
+
+    //! Write the frame header into the underlying writer
+    void WriteHeader();
+    //! Compress the current block and queue it to write
+    void Submit();
+    //! Wait for the first pending block and write it into the underlying writer
+    void WritePending();
+    //! Write all bytes of the given buffers into the underlying writer
+    void WriteAll(std::span<const WriteBuffer> buffers);
+
+    //! Compress the given block
+    static void Compress(Block& block);
+};
+
+/*! \example common_compression.cpp Compressing writer and decompressing reader example */
+
+} // namespace CppCommon
+
+#endif // CPPCOMMON_COMPRESSING_WRITER_H
@@ -0,0 +1,103 @@
+/*!
+    \file decompressing_reader.h
+    \brief Decompressing reader definition
+    \author Ivan Shynkarenka
+    \date 15.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_DECOMPRESSING_READER_H
+#define CPPCOMMON_DECOMPRESSING_READER_H
+
+#include "algorithms/xxh32.h"
+#include "common/reader.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace CppCommon {
+
+//! Decompressing reader
+/*!
+    Decompressing reader reads LZ4 frames from the underlying reader (e.g.
+    File, Pipe or StdInput) and provides decompressed bytes. Frames written
+    by CompressingWriter or by the reference lz4 tool are supported: linked
+    and independent blocks, block and content checksums, content size and
+    concatenated frames. Skippable frames are skipped.
+
+    The end of the underlying reader at the block boundary is treated as the
+    end of the stream, so unfinished frames (e.g. journals of the crashed
+    process flushed with CompressingWriter::Flush()) are read up to the last
+    complete block.
+
+    Throws std::invalid_argument if the compressed stream is malformed or
+    its checksum does not match.
+
+    Not thread-safe.
+
+    https://github.com/lz4/lz4/blob/dev/doc/lz4_Frame_format.md
+*/
+class DecompressingReader : public Reader
+{
+public:
+    //! Initialize decompressing reader with a given reader
+    /*!
+        \param reader - Underlying reader
+    */
+    explicit DecompressingReader(Reader& reader);
+    DecompressingReader(const DecompressingReader&) = delete;
+    DecompressingReader(DecompressingReader&&) = delete;
+    ~DecompressingReader() = default;
+
+    DecompressingReader& operator=(const DecompressingReader&) = delete;
+    DecompressingReader& operator=(DecompressingReader&&) = delete;
+
+    //! Get the total count of read decompressed bytes
+    uint64_t total() const noexcept { return _total; }
+
+    //! Read a bytes buffer
+    /*!
+        \param buffer - Buffer to read
+        \param size - Buffer size
+        \return Count of read bytes (0 at the end of the stream)
+    */
+    size_t Read(void* buffer, size_t size) override;
+
+    using Reader::Read;
+
+private:
+    Reader* _reader;
+    uint64_t _total;
+    bool _frame;
+    bool _linked;
+    bool _block_checksum;
+    bool _content_checksum;
+    size_t _block;
+    XXH32 _checksum;
+
+    std::vector<uint8_t> _input;
+    std::vector<uint8_t> _output;
+    size_t _history;
+    size_t _offset;
+    size_t _size;
+
+    //! Read the next frame header
+    /*!
+        \return 'true' if the frame header was read, 'false' at the end of the stream
+    */
+    bool ReadHeader();
+    //! Read and decompress the next block of the current frame
+    /*!
+        \return 'true' if the block was read, 'false' at the end of the frame or the stream
+    */
+    bool ReadBlock();
+    //! Read exactly the given count of bytes from the underlying reader
+    /*!
+        \return Count of read bytes (less than the given size at the end of the stream)
+    */
+    size_t ReadExact(void* buffer, size_t size);
+};
+
+} // namespace CppCommon
+
+#endif // CPPCOMMON_DECOMPRESSING_READER_H
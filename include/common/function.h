@@ -11,6 +11,8 @@
 
 #include <functional>
 #include <memory>
+#include <new>
+#include <type_traits>
 
 namespace CppCommon {
 
@@ -18,6 +20,14 @@ namespace CppCommon {
 template <class, size_t Capacity = 1024>
 class Function;
 
+//! Move-only function stub
+template <class, size_t Capacity = 1024>
+class UniqueFunction;
+
+//! Non-owning function reference stub
+template <class>
+class FunctionRef;
+
 //! Allocation free function
 /*!
     Allocation free function uses internal stack-based buffer to keep
@@ -34,14 +44,14 @@ public:
     Function(std::nullptr_t) noexcept;
     Function(const Function& function) noexcept;
     Function(Function&& function) noexcept;
-    template <class TFunction>
+    template <class TFunction, class = std::enable_if_t<!std::is_same_v<std::decay_t<TFunction>, Function>>>
     Function(TFunction&& function) noexcept;
     ~Function() noexcept;
 
     Function& operator=(std::nullptr_t) noexcept;
     Function& operator=(const Function& function) noexcept;
     Function& operator=(Function&& function) noexcept;
-    template <typename TFunction>
+    template <typename TFunction, class = std::enable_if_t<!std::is_same_v<std::decay_t<TFunction>, Function>>>
     Function& operator=(TFunction&& function) noexcept;
     template <typename TFunction>
     Function& operator=(std::reference_wrapper<TFunction> function) noexcept;
@@ -58,7 +68,7 @@ public:
     friend void swap(Function<UR(UArgs...), UCapacity>& function1, Function<UR(UArgs...), UCapacity>& function2) noexcept;
 
 private:
-    enum class Operation { Clone, Destroy };
+    enum class Operation { Clone, Move, Destroy };
 
     using Invoker = R (*)(void*, Args&&...);
     using Manager = void (*)(void*, void*, Operation);
@@ -77,6 +87,142 @@ private:
     static void Manage(void* dst, void* src, Operation op) noexcept;
 };
 
+//! Move-only function
+/*!
+    Move-only function keeps the closure in the internal stack-based buffer
+    as Function does, but requires the closure to be only move constructible.
+    So it could keep closures with move-only captures (e.g. std::unique_ptr).
+
+    Oversized closures are rejected at compile time, unless a memory manager
+    is provided in the constructor. In this case closures which don't fit the
+    internal buffer are spilled into the memory block allocated by the given
+    memory manager, which must outlive the function.
+
+    Invocation overhead is similar to std::function implementation.
+*/
+template <class R, class... Args, size_t Capacity>
+class UniqueFunction<R(Args...), Capacity>
+{
+public:
+    UniqueFunction() noexcept;
+    UniqueFunction(std::nullptr_t) noexcept;
+    UniqueFunction(const UniqueFunction&) = delete;
+    UniqueFunction(UniqueFunction&& function) noexcept;
+    template <class TFunction, class = std::enable_if_t<!std::is_same_v<std::decay_t<TFunction>, UniqueFunction>>>
+    UniqueFunction(TFunction&& function) noexcept;
+    //! Initialize the function with the given closure spilled into the memory manager if it doesn't fit the internal buffer
+    /*!
+        \param function - Closure
+        \param manager - Memory manager to allocate oversized closures
+    */
+    template <class TFunction, class TMemoryManager>
+    UniqueFunction(TFunction&& function, TMemoryManager& manager);
+    ~UniqueFunction() noexcept;
+
+    UniqueFunction& operator=(std::nullptr_t) noexcept;
+    UniqueFunction& operator=(const UniqueFunction&) = delete;
+    UniqueFunction& operator=(UniqueFunction&& function) noexcept;
+    template <typename TFunction, class = std::enable_if_t<!std::is_same_v<std::decay_t<TFunction>, UniqueFunction>>>
+    UniqueFunction& operator=(TFunction&& function) noexcept;
+
+    //! Check if the function is valid
+    explicit operator bool() const noexcept { return (_manager != nullptr); }
+
+    //! Is the closure spilled into the memory manager?
+    bool IsSpilled() const noexcept { return _spilled; }
+
+    //! Invoke the function
+    R operator()(Args... args);
+
+    //! Swap two instances
+    void swap(UniqueFunction& function) noexcept;
+    template <class UR, class... UArgs, size_t UCapacity>
+    friend void swap(UniqueFunction<UR(UArgs...), UCapacity>& function1, UniqueFunction<UR(UArgs...), UCapacity>& function2) noexcept;
+
+private:
+    enum class Operation { Move, Destroy };
+
+    using Invoker = R (*)(void*, Args&&...);
+    using Manager = void (*)(void*, void*, Operation);
+
+    static const size_t StorageSize = Capacity - sizeof(Invoker) - sizeof(Manager) - sizeof(bool);
+    static const size_t StorageAlign = 8;
+
+    //! Spilled closure
+    template <class TFunction, class TMemoryManager>
+    struct Spilled
+    {
+        TFunction* function;
+        TMemoryManager* manager;
+    };
+
+    template <typename TFunction>
+    static constexpr bool IsInline = (sizeof(TFunction) <= StorageSize) && ((StorageAlign % alignof(TFunction)) == 0);
+
+    alignas(StorageAlign) std::byte _data[StorageSize];
+    Invoker _invoker;
+    Manager _manager;
+    bool _spilled;
+
+    template <typename TFunction>
+    static R Invoke(void* data, Args&&... args) noexcept;
+    template <typename TFunction>
+    static void Manage(void* dst, void* src, Operation op) noexcept;
+
+    template <typename TSpilled>
+    static R InvokeSpilled(void* data, Args&&... args) noexcept;
+    template <typename TSpilled>
+    static void ManageSpilled(void* dst, void* src, Operation op) noexcept;
+};
+
+//! Non-owning function reference
+/*!
+    Function reference is a lightweight non-owning view of any callable
+    (function, closure or functor). It never allocates memory and could be
+    passed by value, so it fits well for callback parameters of functions
+    which don't store the callback. The referenced callable must outlive
+    the function reference.
+
+    Invocation overhead is one indirect call.
+*/
+template <class R, class... Args>
+class FunctionRef<R(Args...)>
+{
+public:
+    FunctionRef() = delete;
+    FunctionRef(const FunctionRef&) noexcept = default;
+    FunctionRef(FunctionRef&&) noexcept = default;
+    //! Reference the given function
+    FunctionRef(R (*function)(Args...)) noexcept;
+    //! Reference the given callable
+    template <class TFunction, class = std::enable_if_t<!std::is_same_v<std::decay_t<TFunction>, FunctionRef> && !std::is_function_v<std::remove_reference_t<TFunction>> && std::is_invocable_r_v<R, TFunction&, Args...>>>
+    FunctionRef(TFunction&& function) noexcept;
+    ~FunctionRef() noexcept = default;
+
+    FunctionRef& operator=(const FunctionRef&) noexcept = default;
+    FunctionRef& operator=(FunctionRef&&) noexcept = default;
+
+    //! Invoke the referenced function
+    R operator()(Args... args) const { return _invoker(_object, std::forward<Args>(args)...); }
+
+    //! Swap two instances
+    void swap(FunctionRef& function) noexcept;
+    template <class UR, class... UArgs>
+    friend void swap(FunctionRef<UR(UArgs...)>& function1, FunctionRef<UR(UArgs...)>& function2) noexcept;
+
+private:
+    union Object
+    {
+        void* callable;
+        R (*function)(Args...);
+    };
+
+    using Invoker = R (*)(Object, Args&&...);
+
+    Object _object;
+    Invoker _invoker;
+};
+
 /*! \example common_function.cpp Allocation free function example */
 
 } // namespace CppCommon
@@ -28,7 +28,7 @@ inline Function<R(Args...), Capacity>::Function(const Function& function) noexce
 {
     if (function)
     {
-        function._manager(&_data, &function._data, Operation::Clone);
+        function._manager(&_data, (void*)&function._data, Operation::Clone);
         _invoker = function._invoker;
         _manager = function._manager;
     }
@@ -38,11 +38,18 @@ template <class R, class... Args, size_t Capacity>
 inline Function<R(Args...), Capacity>::Function(Function&& function) noexcept
     : Function<R(Args...), Capacity>()
 {
-    function.swap(*this);
+    if (function)
+    {
+        function._manager(&_data, &function._data, Operation::Move);
+        _invoker = function._invoker;
+        _manager = function._manager;
+        function._invoker = nullptr;
+        function._manager = nullptr;
+    }
 }
 
 template <class R, class... Args, size_t Capacity>
-template <class TFunction>
+template <class TFunction, class>
 inline Function<R(Args...), Capacity>::Function(TFunction&& function) noexcept
     : Function<R(Args...), Capacity>()
 {
@@ -81,22 +88,33 @@ inline Function<R(Args...), Capacity>& Function<R(Args...), Capacity>::operator=
 template <class R, class... Args, size_t Capacity>
 inline Function<R(Args...), Capacity>& Function<R(Args...), Capacity>::operator=(const Function& function) noexcept
 {
-    Function(function).swap(*this);
+    *this = Function(function);
     return *this;
 }
 
 template <class R, class... Args, size_t Capacity>
 inline Function<R(Args...), Capacity>& Function<R(Args...), Capacity>::operator=(Function&& function) noexcept
 {
-    Function(std::move(function)).swap(*this);
+    if (this != &function)
+    {
+        *this = nullptr;
+        if (function)
+        {
+            function._manager(&_data, &function._data, Operation::Move);
+            _invoker = function._invoker;
+            _manager = function._manager;
+            function._invoker = nullptr;
+            function._manager = nullptr;
+        }
+    }
     return *this;
 }
 
 template <class R, class... Args, size_t Capacity>
-template <typename TFunction>
+template <typename TFunction, class>
 inline Function<R(Args...), Capacity>& Function<R(Args...), Capacity>::operator=(TFunction&& function) noexcept
 {
-    Function(std::forward<TFunction>(function)).swap(*this);
+    *this = Function(std::forward<TFunction>(function));
     return *this;
 }
 
@@ -104,7 +122,7 @@ template <class R, class... Args, size_t Capacity>
 template <typename TFunction>
 inline Function<R(Args...), Capacity>& Function<R(Args...), Capacity>::operator=(std::reference_wrapper<TFunction> function) noexcept
 {
-    Function(function).swap(*this);
+    *this = Function(function);
     return *this;
 }
 
@@ -134,6 +152,10 @@ inline void Function<R(Args...), Capacity>::Manage(void* dst, void* src, Operati
         case Operation::Clone:
             new (dst) TFunction(*static_cast<TFunction*>(src));
             break;
+        case Operation::Move:
+            new (dst) TFunction(std::move(*static_cast<TFunction*>(src)));
+            static_cast<TFunction*>(src)->~TFunction();
+            break;
         case Operation::Destroy:
             static_cast<TFunction*>(dst)->~TFunction();
             break;
@@ -143,10 +165,10 @@ inline void Function<R(Args...), Capacity>::Manage(void* dst, void* src, Operati
 template <class R, class... Args, size_t Capacity>
 inline void Function<R(Args...), Capacity>::swap(Function& function) noexcept
 {
-    using std::swap;
-    swap(_data, function._data);
-    swap(_manager, function._manager);
-    swap(_invoker, function._invoker);
+    // Closures are moved with their move constructors, because they might be not trivially relocatable
+    Function temp(std::move(function));
+    function = std::move(*this);
+    *this = std::move(temp);
 }
 
 template <class R, class... Args, size_t Capacity>
@@ -155,4 +177,259 @@ void swap(Function<R(Args...), Capacity>& function1, Function<R(Args...), Capaci
     function1.swap(function2);
 }
 
+template <class R, class... Args, size_t Capacity>
+inline UniqueFunction<R(Args...), Capacity>::UniqueFunction() noexcept
+    : _data(),
+      _invoker(nullptr),
+      _manager(nullptr),
+      _spilled(false)
+{
+}
+
+template <class R, class... Args, size_t Capacity>
+inline UniqueFunction<R(Args...), Capacity>::UniqueFunction(std::nullptr_t) noexcept
+    : UniqueFunction<R(Args...), Capacity>()
+{
+}
+
+template <class R, class... Args, size_t Capacity>
+inline UniqueFunction<R(Args...), Capacity>::UniqueFunction(UniqueFunction&& function) noexcept
+    : UniqueFunction<R(Args...), Capacity>()
+{
+    if (function)
+    {
+        function._manager(&_data, &function._data, Operation::Move);
+        _invoker = function._invoker;
+        _manager = function._manager;
+        _spilled = function._spilled;
+        function._invoker = nullptr;
+        function._manager = nullptr;
+        function._spilled = false;
+    }
+}
+
+template <class R, class... Args, size_t Capacity>
+template <class TFunction, class>
+inline UniqueFunction<R(Args...), Capacity>::UniqueFunction(TFunction&& function) noexcept
+    : UniqueFunction<R(Args...), Capacity>()
+{
+    using function_type = typename std::decay<TFunction>::type;
+
+    // Check implementation storage parameters
+    static_assert((StorageSize >= sizeof(function_type)), "UniqueFunction::StorageSize must be increased or the memory manager must be provided!");
+    static_assert(((StorageAlign % alignof(function_type)) == 0), "UniqueFunction::StorageAlign must be adjusted or the memory manager must be provided!");
+    static_assert(std::is_move_constructible_v<function_type>, "UniqueFunction closure must be move constructible!");
+
+    // Create the implementation instance
+    new (&_data) function_type(std::forward<TFunction>(function));
+
+    _invoker = &Invoke<function_type>;
+    _manager = &Manage<function_type>;
+}
+
+template <class R, class... Args, size_t Capacity>
+template <class TFunction, class TMemoryManager>
+inline UniqueFunction<R(Args...), Capacity>::UniqueFunction(TFunction&& function, TMemoryManager& manager)
+    : UniqueFunction<R(Args...), Capacity>()
+{
+    using function_type = typename std::decay<TFunction>::type;
+
+    if constexpr (IsInline<function_type>)
+    {
+        // Create the implementation instance in the internal buffer
+        new (&_data) function_type(std::forward<TFunction>(function));
+
+        _invoker = &Invoke<function_type>;
+        _manager = &Manage<function_type>;
+    }
+    else
+    {
+        using spilled_type = Spilled<function_type, TMemoryManager>;
+
+        static_assert((StorageSize >= sizeof(spilled_type)), "UniqueFunction::StorageSize must be increased!");
+
+        // Spill the implementation instance into the memory manager
+        void* ptr = manager.malloc(sizeof(function_type), alignof(function_type));
+        if (ptr == nullptr)
+            throw std::bad_alloc();
+
+        try
+        {
+            new (ptr) function_type(std::forward<TFunction>(function));
+        }
+        catch (...)
+        {
+            manager.free(ptr, sizeof(function_type));
+            throw;
+        }
+
+        new (&_data) spilled_type{ static_cast<function_type*>(ptr), &manager };
+
+        _invoker = &InvokeSpilled<spilled_type>;
+        _manager = &ManageSpilled<spilled_type>;
+        _spilled = true;
+    }
+}
+
+template <class R, class... Args, size_t Capacity>
+inline UniqueFunction<R(Args...), Capacity>::~UniqueFunction() noexcept
+{
+    if (_manager)
+        _manager(&_data, nullptr, Operation::Destroy);
+}
+
+template <class R, class... Args, size_t Capacity>
+inline UniqueFunction<R(Args...), Capacity>& UniqueFunction<R(Args...), Capacity>::operator=(std::nullptr_t) noexcept
+{
+    if (_manager)
+    {
+        _manager(&_data, nullptr, Operation::Destroy);
+        _manager = nullptr;
+        _invoker = nullptr;
+        _spilled = false;
+    }
+    return *this;
+}
+
+template <class R, class... Args, size_t Capacity>
+inline UniqueFunction<R(Args...), Capacity>& UniqueFunction<R(Args...), Capacity>::operator=(UniqueFunction&& function) noexcept
+{
+    if (this != &function)
+    {
+        *this = nullptr;
+        if (function)
+        {
+            function._manager(&_data, &function._data, Operation::Move);
+            _invoker = function._invoker;
+            _manager = function._manager;
+            _spilled = function._spilled;
+            function._invoker = nullptr;
+            function._manager = nullptr;
+            function._spilled = false;
+        }
+    }
+    return *this;
+}
+
+template <class R, class... Args, size_t Capacity>
+template <typename TFunction, class>
+inline UniqueFunction<R(Args...), Capacity>& UniqueFunction<R(Args...), Capacity>::operator=(TFunction&& function) noexcept
+{
+    *this = UniqueFunction(std::forward<TFunction>(function));
+    return *this;
+}
+
+template <class R, class... Args, size_t Capacity>
+inline R UniqueFunction<R(Args...), Capacity>::operator()(Args... args)
+{
+    if (!_invoker)
+        throw std::bad_function_call();
+
+    return _invoker(&_data, std::forward<Args>(args)...);
+}
+
+template <class R, class... Args, size_t Capacity>
+template <typename TFunction>
+inline R UniqueFunction<R(Args...), Capacity>::Invoke(void* data, Args&&... args) noexcept
+{
+    TFunction& function = *static_cast<TFunction*>(data);
+    return function(std::forward<Args>(args)...);
+}
+
+template <class R, class... Args, size_t Capacity>
+template <typename TFunction>
+inline void UniqueFunction<R(Args...), Capacity>::Manage(void* dst, void* src, Operation op) noexcept
+{
+    switch (op)
+    {
+        case Operation::Move:
+            new (dst) TFunction(std::move(*static_cast<TFunction*>(src)));
+            static_cast<TFunction*>(src)->~TFunction();
+            break;
+        case Operation::Destroy:
+            static_cast<TFunction*>(dst)->~TFunction();
+            break;
+    }
+}
+
+template <class R, class... Args, size_t Capacity>
+template <typename TSpilled>
+inline R UniqueFunction<R(Args...), Capacity>::InvokeSpilled(void* data, Args&&... args) noexcept
+{
+    TSpilled& spilled = *static_cast<TSpilled*>(data);
+    return (*spilled.function)(std::forward<Args>(args)...);
+}
+
+template <class R, class... Args, size_t Capacity>
+template <typename TSpilled>
+inline void UniqueFunction<R(Args...), Capacity>::ManageSpilled(void* dst, void* src, Operation op) noexcept
+{
+    switch (op)
+    {
+        case Operation::Move:
+            // Spilled closure is moved with its pointer
+            new (dst) TSpilled(*static_cast<TSpilled*>(src));
+            break;
+        case Operation::Destroy:
+        {
+            TSpilled& spilled = *static_cast<TSpilled*>(dst);
+            using function_type = typename std::remove_pointer<decltype(spilled.function)>::type;
+            spilled.function->~function_type();
+            spilled.manager->free(spilled.function, sizeof(function_type));
+            break;
+        }
+    }
+}
+
+template <class R, class... Args, size_t Capacity>
+inline void UniqueFunction<R(Args...), Capacity>::swap(UniqueFunction& function) noexcept
+{
+    UniqueFunction temp(std::move(function));
+    function = std::move(*this);
+    *this = std::move(temp);
+}
+
+template <class R, class... Args, size_t Capacity>
+void swap(UniqueFunction<R(Args...), Capacity>& function1, UniqueFunction<R(Args...), Capacity>& function2) noexcept
+{
+    function1.swap(function2);
+}
+
+template <class R, class... Args>
+inline FunctionRef<R(Args...)>::FunctionRef(R (*function)(Args...)) noexcept
+{
+    _object.function = function;
+    _invoker = [](Object object, Args&&... args) -> R
+    {
+        return object.function(std::forward<Args>(args)...);
+    };
+}
+
+template <class R, class... Args>
+template <class TFunction, class>
+inline FunctionRef<R(Args...)>::FunctionRef(TFunction&& function) noexcept
+{
+    using function_type = typename std::remove_reference<TFunction>::type;
+
+    _object.callable = (void*)std::addressof(function);
+    _invoker = [](Object object, Args&&... args) -> R
+    {
+        return (*static_cast<function_type*>(object.callable))(std::forward<Args>(args)...);
+    };
+}
+
+template <class R, class... Args>
+inline void FunctionRef<R(Args...)>::swap(FunctionRef& function) noexcept
+{
+    using std::swap;
+    swap(_object, function._object);
+    swap(_invoker, function._invoker);
+}
+
+template <class R, class... Args>
+void swap(FunctionRef<R(Args...)>& function1, FunctionRef<R(Args...)>& function2) noexcept
+{
+    function1.swap(function2);
+}
+
 } // namespace CppCommon
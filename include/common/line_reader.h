@@ -0,0 +1,156 @@
+/*!
+    \file line_reader.h
+    \brief Streaming line reader definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_LINE_READER_H
+#define CPPCOMMON_LINE_READER_H
+
+#include "common/reader.h"
+
+#include <cstddef>
+#include <iterator>
+#include <string_view>
+#include <vector>
+
+namespace CppCommon {
+
+//! Streaming line reader
+/*!
+    Line reader splits the content of a reader (e.g. File) or of the memory
+    buffer (e.g. MappedFile::view()) into text lines without copying them
+    into separate strings. Lines are returned as string views of the memory
+    buffer or the internal read buffer. The internal read buffer grows to
+    fit the longest line only, so the memory use does not depend on the
+    reader size. Newline characters are searched with AVX2 instructions on
+    x86 processors which support them (detected in the runtime) or with
+    memchr() on other processors.
+
+    Lines are terminated with LF or CR LF sequence, terminating characters
+    are not included into lines. The last line might have no terminator.
+
+    Lines read from the reader are valid until the next read operation. Lines
+    read from the memory buffer are valid while the buffer is valid.
+
+    Not thread-safe.
+*/
+class LineReader
+{
+public:
+    //! Default read buffer size (64 kilobytes)
+    static const size_t DEFAULT_BUFFER;
+
+    //! Line input iterator
+    class Iterator
+    {
+    public:
+        typedef std::input_iterator_tag iterator_category;
+        typedef std::string_view value_type;
+        typedef ptrdiff_t difference_type;
+        typedef const std::string_view* pointer;
+        typedef const std::string_view& reference;
+
+        Iterator() noexcept : _reader(nullptr), _line() {}
+        explicit Iterator(LineReader* reader) : _reader(reader), _line() { ++*this; }
+
+        Iterator& operator++()
+        { if (!_reader->ReadLine(_line)) _reader = nullptr; return *this; }
+
+        reference operator*() const noexcept { return _line; }
+        pointer operator->() const noexcept { return &_line; }
+
+        friend bool operator==(const Iterator& it1, const Iterator& it2) noexcept { return (it1._reader == it2._reader); }
+        friend bool operator!=(const Iterator& it1, const Iterator& it2) noexcept { return (it1._reader != it2._reader); }
+
+    private:
+        LineReader* _reader;
+        std::string_view _line;
+    };
+
+    //! Initialize line reader with a given reader
+    /*!
+        \param reader - Reader to read lines from
+        \param buffer - Initial read buffer size (default is LineReader::DEFAULT_BUFFER)
+    */
+    explicit LineReader(Reader& reader, size_t buffer = DEFAULT_BUFFER);
+    //! Initialize line reader with a given memory buffer
+    /*!
+        \param content - Memory buffer to read lines from
+    */
+    explicit LineReader(std::string_view content) noexcept;
+    LineReader(const LineReader&) = delete;
+    LineReader(LineReader&&) = delete;
+    ~LineReader() = default;
+
+    LineReader& operator=(const LineReader&) = delete;
+    LineReader& operator=(LineReader&&) = delete;
+
+    //! Get the count of read lines
+    size_t lines() const noexcept { return _lines; }
+
+    //! Read the next line
+    /*!
+        \param line - Read line
+        \return 'true' if the line was read, 'false' if there are no more lines
+    */
+    bool ReadLine(std::string_view& line);
+
+    //! Read the next line and split it into fields by the given delimiter character
+    /*!
+        Fields are split with StringUtils::Split() semantics.
+
+        \param fields - Fields of the read line (cleared before split)
+        \param delimiter - Delimiter character
+        \param skip_empty - Skip empty fields flag (default is false)
+        \return 'true' if the line was read, 'false' if there are no more lines
+    */
+    bool ReadRecord(std::vector<std::string_view>& fields, char delimiter, bool skip_empty = false);
+    //! Read the next line and split it into fields by the given delimiter string
+    /*!
+        Fields are split with StringUtils::Split() semantics.
+
+        \param fields - Fields of the read line (cleared before split)
+        \param delimiter - Delimiter string
+        \param skip_empty - Skip empty fields flag (default is false)
+        \return 'true' if the line was read, 'false' if there are no more lines
+    */
+    bool ReadRecord(std::vector<std::string_view>& fields, std::string_view delimiter, bool skip_empty = false);
+
+    //! Get the begin line iterator
+    Iterator begin() { return Iterator(this); }
+    //! Get the end line iterator
+    Iterator end() noexcept { return Iterator(); }
+
+    //! Find the first newline character in the given memory range
+    /*!
+        \param first - Pointer to the first character
+        \param last - Pointer to the character after the last one
+        \return Pointer to the first newline character or the last pointer if it was not found
+    */
+    static const char* FindNewline(const char* first, const char* last) noexcept;
+
+private:
+    Reader* _reader;
+    std::vector<char> _buffer;
+    const char* _data;
+    size_t _begin;
+    size_t _scan;
+    size_t _end;
+    bool _eof;
+    size_t _lines;
+
+    //! Read more data from the reader into the read buffer
+    /*!
+        \return 'true' if some data was read, 'false' if the reader is exhausted
+    */
+    bool Fill();
+};
+
+/*! \example common_line_reader.cpp Streaming line reader example */
+
+} // namespace CppCommon
+
+#endif // CPPCOMMON_LINE_READER_H
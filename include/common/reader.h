@@ -39,6 +39,14 @@ public:
     */
     virtual size_t Read(void* buffer, size_t size) = 0;
 
+    //! Get the count of bytes remaining to read if it is known
+    /*!
+        Read all methods use it to allocate the result buffer at once.
+
+        \return Count of remaining bytes or 0 if it is unknown
+    */
+    virtual uint64_t remaining() const { return 0; }
+
     //! Read all bytes
     /*!
         \return Bytes buffer
@@ -9,8 +9,10 @@
 #ifndef CPPCOMMON_UINT128_H
 #define CPPCOMMON_UINT128_H
 
+#include "algorithms/hash.h"
 #include "string/format.h"
 
+#include <bit>
 #include <cstdint>
 #include <iostream>
 #include <stdexcept>
@@ -18,249 +20,261 @@
 #include <type_traits>
 #include <utility>
 
+#if defined(__SIZEOF_INT128__)
+#define CPPCOMMON_UINT128_NATIVE
+#elif defined(_MSC_VER) && defined(_M_X64)
+#include <intrin.h>
+#define CPPCOMMON_UINT128_INTRINSICS
+#endif
+
 namespace CppCommon {
 
 //! Unsigned 128-bit integer type
 /*!
     Represents unsigned 128-bit integer type and provides basic arithmetic operations.
+
+    All operators are inline and constexpr. Multiplication, division and
+    shifts are selected at compile time: native unsigned __int128 arithmetic
+    with GCC and Clang, _umul128/_udiv128 and 128-bit shift intrinsics with
+    MSVC x64, and portable 64-bit limbs arithmetic otherwise.
 */
 class uint128_t
 {
 public:
-    uint128_t() noexcept;
-    uint128_t(int8_t value) noexcept;
-    uint128_t(uint8_t value) noexcept;
-    uint128_t(int16_t value) noexcept;
-    uint128_t(uint16_t value) noexcept;
-    uint128_t(int32_t value) noexcept;
-    uint128_t(uint32_t value) noexcept;
-    uint128_t(int64_t value) noexcept;
-    uint128_t(uint64_t value) noexcept;
-    template <typename T>
-    explicit uint128_t(const T& value) noexcept;
+    constexpr uint128_t() noexcept;
+    constexpr uint128_t(int8_t value) noexcept;
+    constexpr uint128_t(uint8_t value) noexcept;
+    constexpr uint128_t(int16_t value) noexcept;
+    constexpr uint128_t(uint16_t value) noexcept;
+    constexpr uint128_t(int32_t value) noexcept;
+    constexpr uint128_t(uint32_t value) noexcept;
+    constexpr uint128_t(int64_t value) noexcept;
+    constexpr uint128_t(uint64_t value) noexcept;
+    template <typename T>
+    explicit constexpr uint128_t(const T& value) noexcept;
     template <typename TUpper, typename TLower>
-    uint128_t(const TUpper& upper, const TLower& lower) noexcept;
-    uint128_t(const uint128_t& value) noexcept = default;
-    uint128_t(uint128_t&& value) noexcept = default;
+    constexpr uint128_t(const TUpper& upper, const TLower& lower) noexcept;
+    constexpr uint128_t(const uint128_t& value) noexcept = default;
+    constexpr uint128_t(uint128_t&& value) noexcept = default;
     ~uint128_t() noexcept = default;
 
     template <typename T>
-    uint128_t& operator=(const T& value) noexcept;
-    uint128_t& operator=(const uint128_t& value) noexcept = default;
-    uint128_t& operator=(uint128_t&& value) noexcept = default;
+    constexpr uint128_t& operator=(const T& value) noexcept;
+    constexpr uint128_t& operator=(const uint128_t& value) noexcept = default;
+    constexpr uint128_t& operator=(uint128_t&& value) noexcept = default;
 
     // Arithmetic operators
-    uint128_t operator+() const noexcept { return *this; }
-    uint128_t operator-() const noexcept { return ~*this + 1; }
+    constexpr uint128_t operator+() const noexcept { return *this; }
+    constexpr uint128_t operator-() const noexcept { return ~*this + 1; }
 
-    uint128_t& operator++() noexcept { return *this += 1; }
-    uint128_t operator++(int) noexcept { uint128_t temp(*this); ++*this; return temp; }
-    uint128_t& operator--() noexcept { return *this -= 1; }
-    uint128_t operator--(int) noexcept { uint128_t temp(*this); --*this; return temp; }
+    constexpr uint128_t& operator++() noexcept { return *this += 1; }
+    constexpr uint128_t operator++(int) noexcept { uint128_t temp(*this); ++*this; return temp; }
+    constexpr uint128_t& operator--() noexcept { return *this -= 1; }
+    constexpr uint128_t operator--(int) noexcept { uint128_t temp(*this); --*this; return temp; }
 
-    uint128_t& operator+=(const uint128_t& value) noexcept { return *this = *this + value; }
-    uint128_t& operator-=(const uint128_t& value) noexcept { return *this = *this - value; }
-    uint128_t& operator*=(const uint128_t& value) noexcept { return *this = *this * value; }
-    uint128_t& operator/=(const uint128_t& value) { return *this = *this / value; }
-    uint128_t& operator%=(const uint128_t& value) { return *this = *this % value; }
+    constexpr uint128_t& operator+=(const uint128_t& value) noexcept { return *this = *this + value; }
+    constexpr uint128_t& operator-=(const uint128_t& value) noexcept { return *this = *this - value; }
+    constexpr uint128_t& operator*=(const uint128_t& value) noexcept { return *this = *this * value; }
+    constexpr uint128_t& operator/=(const uint128_t& value) { return *this = *this / value; }
+    constexpr uint128_t& operator%=(const uint128_t& value) { return *this = *this % value; }
 
     template <typename T>
-    uint128_t& operator+=(const T& value) noexcept { return *this = *this + uint128_t(value); }
+    constexpr uint128_t& operator+=(const T& value) noexcept { return *this = *this + uint128_t(value); }
     template <typename T>
-    uint128_t& operator-=(const T& value) noexcept { return *this = *this - uint128_t(value); }
+    constexpr uint128_t& operator-=(const T& value) noexcept { return *this = *this - uint128_t(value); }
     template <typename T>
-    uint128_t& operator*=(const T& value) noexcept { return *this = *this * uint128_t(value); }
+    constexpr uint128_t& operator*=(const T& value) noexcept { return *this = *this * uint128_t(value); }
     template <typename T>
-    uint128_t& operator/=(const T& value) { return *this = *this / uint128_t(value); }
+    constexpr uint128_t& operator/=(const T& value) { return *this = *this / uint128_t(value); }
     template <typename T>
-    uint128_t& operator%=(const T& value) { return *this = *this % uint128_t(value); }
+    constexpr uint128_t& operator%=(const T& value) { return *this = *this % uint128_t(value); }
 
     template <typename T>
-    friend T& operator+=(T& value1, const uint128_t& value2) noexcept { return value1 = (T)(uint128_t(value1) + value2); }
+    friend constexpr T& operator+=(T& value1, const uint128_t& value2) noexcept { return value1 = (T)(uint128_t(value1) + value2); }
     template <typename T>
-    friend T& operator-=(T& value1, const uint128_t& value2) noexcept { return value1 = (T)(uint128_t(value1) - value2); }
+    friend constexpr T& operator-=(T& value1, const uint128_t& value2) noexcept { return value1 = (T)(uint128_t(value1) - value2); }
     template <typename T>
-    friend T& operator*=(T& value1, const uint128_t& value2) noexcept { return value1 = (T)(uint128_t(value1) * value2); }
+    friend constexpr T& operator*=(T& value1, const uint128_t& value2) noexcept { return value1 = (T)(uint128_t(value1) * value2); }
     template <typename T>
-    friend T& operator/=(T& value1, const uint128_t& value2) { return value1 = (T)(uint128_t(value1) / value2); }
+    friend constexpr T& operator/=(T& value1, const uint128_t& value2) { return value1 = (T)(uint128_t(value1) / value2); }
     template <typename T>
-    friend T& operator%=(T& value1, const uint128_t& value2) { return value1 = (T)(uint128_t(value1) % value2); }
+    friend constexpr T& operator%=(T& value1, const uint128_t& value2) { return value1 = (T)(uint128_t(value1) % value2); }
 
     template <typename T>
-    friend uint128_t operator+(const T& value1, const uint128_t& value2) noexcept { return uint128_t(value1) + value2; }
+    friend constexpr uint128_t operator+(const T& value1, const uint128_t& value2) noexcept { return uint128_t(value1) + value2; }
     template <typename T>
-    friend uint128_t operator+(const uint128_t& value1, const T& value2) noexcept { return value1 + uint128_t(value2); }
-    friend uint128_t operator+(const uint128_t& value1, const uint128_t& value2) noexcept;
+    friend constexpr uint128_t operator+(const uint128_t& value1, const T& value2) noexcept { return value1 + uint128_t(value2); }
+    friend constexpr uint128_t operator+(const uint128_t& value1, const uint128_t& value2) noexcept;
 
     template <typename T>
-    friend uint128_t operator-(const T& value1, const uint128_t& value2) noexcept { return uint128_t(value1) - value2; }
+    friend constexpr uint128_t operator-(const T& value1, const uint128_t& value2) noexcept { return uint128_t(value1) - value2; }
     template <typename T>
-    friend uint128_t operator-(const uint128_t& value1, const T& value2) noexcept { return value1 - uint128_t(value2); }
-    friend uint128_t operator-(const uint128_t& value1, const uint128_t& value2) noexcept;
+    friend constexpr uint128_t operator-(const uint128_t& value1, const T& value2) noexcept { return value1 - uint128_t(value2); }
+    friend constexpr uint128_t operator-(const uint128_t& value1, const uint128_t& value2) noexcept;
 
     template <typename T>
-    friend uint128_t operator*(const T& value1, const uint128_t& value2) noexcept { return uint128_t(value1) * value2; }
+    friend constexpr uint128_t operator*(const T& value1, const uint128_t& value2) noexcept { return uint128_t(value1) * value2; }
     template <typename T>
-    friend uint128_t operator*(const uint128_t& value1, const T& value2) noexcept { return value1 * uint128_t(value2); }
-    friend uint128_t operator*(const uint128_t& value1, const uint128_t& value2) noexcept;
+    friend constexpr uint128_t operator*(const uint128_t& value1, const T& value2) noexcept { return value1 * uint128_t(value2); }
+    friend constexpr uint128_t operator*(const uint128_t& value1, const uint128_t& value2) noexcept;
 
     template <typename T>
-    friend uint128_t operator/(const T& value1, const uint128_t& value2) { return uint128_t(value1) / value2; }
+    friend constexpr uint128_t operator/(const T& value1, const uint128_t& value2) { return uint128_t(value1) / value2; }
     template <typename T>
-    friend uint128_t operator/(const uint128_t& value1, const T& value2) { return value1 / uint128_t(value2); }
-    friend uint128_t operator/(const uint128_t& value1, const uint128_t& value2);
+    friend constexpr uint128_t operator/(const uint128_t& value1, const T& value2) { return value1 / uint128_t(value2); }
+    friend constexpr uint128_t operator/(const uint128_t& value1, const uint128_t& value2);
 
     template <typename T>
-    friend uint128_t operator%(const T& value1, const uint128_t& value2) { return uint128_t(value1) % value2; }
+    friend constexpr uint128_t operator%(const T& value1, const uint128_t& value2) { return uint128_t(value1) % value2; }
     template <typename T>
-    friend uint128_t operator%(const uint128_t& value1, const T& value2) { return value1 % uint128_t(value2); }
-    friend uint128_t operator%(const uint128_t& value1, const uint128_t& value2);
+    friend constexpr uint128_t operator%(const uint128_t& value1, const T& value2) { return value1 % uint128_t(value2); }
+    friend constexpr uint128_t operator%(const uint128_t& value1, const uint128_t& value2);
 
     // Bit operators
-    uint128_t operator~() const noexcept { return uint128_t(~_upper, ~_lower); }
+    constexpr uint128_t operator~() const noexcept { return uint128_t(~_upper, ~_lower); }
 
-    uint128_t& operator&=(const uint128_t& value) noexcept { return *this = *this & value; }
-    uint128_t& operator|=(const uint128_t& value) noexcept { return *this = *this | value; }
-    uint128_t& operator^=(const uint128_t& value) noexcept { return *this = *this ^ value; }
+    constexpr uint128_t& operator&=(const uint128_t& value) noexcept { return *this = *this & value; }
+    constexpr uint128_t& operator|=(const uint128_t& value) noexcept { return *this = *this | value; }
+    constexpr uint128_t& operator^=(const uint128_t& value) noexcept { return *this = *this ^ value; }
 
     template <typename T>
-    uint128_t& operator&=(const T& value) noexcept { return *this = *this & uint128_t(value); }
+    constexpr uint128_t& operator&=(const T& value) noexcept { return *this = *this & uint128_t(value); }
     template <typename T>
-    uint128_t& operator|=(const T& value) noexcept { return *this = *this | uint128_t(value); }
+    constexpr uint128_t& operator|=(const T& value) noexcept { return *this = *this | uint128_t(value); }
     template <typename T>
-    uint128_t& operator^=(const T& value) noexcept { return *this = *this ^ uint128_t(value); }
+    constexpr uint128_t& operator^=(const T& value) noexcept { return *this = *this ^ uint128_t(value); }
 
     template <typename T>
-    friend T& operator&=(T& value1, const uint128_t& value2) noexcept { return value1 = (T)(uint128_t(value1) & value2); }
+    friend constexpr T& operator&=(T& value1, const uint128_t& value2) noexcept { return value1 = (T)(uint128_t(value1) & value2); }
     template <typename T>
-    friend T& operator|=(T& value1, const uint128_t& value2) noexcept { return value1 = (T)(uint128_t(value1) | value2); }
+    friend constexpr T& operator|=(T& value1, const uint128_t& value2) noexcept { return value1 = (T)(uint128_t(value1) | value2); }
     template <typename T>
-    friend T& operator^=(T& value1, const uint128_t& value2) noexcept { return value1 = (T)(uint128_t(value1) ^ value2); }
+    friend constexpr T& operator^=(T& value1, const uint128_t& value2) noexcept { return value1 = (T)(uint128_t(value1) ^ value2); }
 
     template <typename T>
-    friend uint128_t operator&(const T& value1, const uint128_t& value2) noexcept { return uint128_t(value1) & value2; }
+    friend constexpr uint128_t operator&(const T& value1, const uint128_t& value2) noexcept { return uint128_t(value1) & value2; }
     template <typename T>
-    friend uint128_t operator&(const uint128_t& value1, const T& value2) noexcept { return value1 & uint128_t(value2); }
-    friend uint128_t operator&(const uint128_t& value1, const uint128_t& value2) noexcept;
+    friend constexpr uint128_t operator&(const uint128_t& value1, const T& value2) noexcept { return value1 & uint128_t(value2); }
+    friend constexpr uint128_t operator&(const uint128_t& value1, const uint128_t& value2) noexcept;
 
     template <typename T>
-    friend uint128_t operator|(const T& value1, const uint128_t& value2) noexcept { return uint128_t(value1) | value2; }
+    friend constexpr uint128_t operator|(const T& value1, const uint128_t& value2) noexcept { return uint128_t(value1) | value2; }
     template <typename T>
-    friend uint128_t operator|(const uint128_t& value1, const T& value2) noexcept { return value1 | uint128_t(value2); }
-    friend uint128_t operator|(const uint128_t& value1, const uint128_t& value2) noexcept;
+    friend constexpr uint128_t operator|(const uint128_t& value1, const T& value2) noexcept { return value1 | uint128_t(value2); }
+    friend constexpr uint128_t operator|(const uint128_t& value1, const uint128_t& value2) noexcept;
 
     template <typename T>
-    friend uint128_t operator^(const T& value1, const uint128_t& value2) noexcept { return uint128_t(value1) ^ value2; }
+    friend constexpr uint128_t operator^(const T& value1, const uint128_t& value2) noexcept { return uint128_t(value1) ^ value2; }
     template <typename T>
-    friend uint128_t operator^(const uint128_t& value1, const T& value2) noexcept { return value1 ^ uint128_t(value2); }
-    friend uint128_t operator^(const uint128_t& value1, const uint128_t& value2) noexcept;
+    friend constexpr uint128_t operator^(const uint128_t& value1, const T& value2) noexcept { return value1 ^ uint128_t(value2); }
+    friend constexpr uint128_t operator^(const uint128_t& value1, const uint128_t& value2) noexcept;
 
     // Comparison operators
     template <typename T>
-    friend bool operator==(const T& value1, const uint128_t& value2) noexcept { return uint128_t(value1) == value2; }
+    friend constexpr bool operator==(const T& value1, const uint128_t& value2) noexcept { return uint128_t(value1) == value2; }
     template <typename T>
-    friend bool operator==(const uint128_t& value1, const T& value2) noexcept { return value1 == uint128_t(value2); }
-    friend bool operator==(const uint128_t& value1, const uint128_t& value2) noexcept;
+    friend constexpr bool operator==(const uint128_t& value1, const T& value2) noexcept { return value1 == uint128_t(value2); }
+    friend constexpr bool operator==(const uint128_t& value1, const uint128_t& value2) noexcept;
 
     template <typename T>
-    friend bool operator!=(const T& value1, const uint128_t& value2) noexcept { return uint128_t(value1) != value2; }
+    friend constexpr bool operator!=(const T& value1, const uint128_t& value2) noexcept { return uint128_t(value1) != value2; }
     template <typename T>
-    friend bool operator!=(const uint128_t& value1, const T& value2) noexcept { return value1 != uint128_t(value2); }
-    friend bool operator!=(const uint128_t& value1, const uint128_t& value2) noexcept;
+    friend constexpr bool operator!=(const uint128_t& value1, const T& value2) noexcept { return value1 != uint128_t(value2); }
+    friend constexpr bool operator!=(const uint128_t& value1, const uint128_t& value2) noexcept;
 
     template <typename T>
-    friend bool operator<(const T& value1, const uint128_t& value2) noexcept { return uint128_t(value1) < value2; }
+    friend constexpr bool operator<(const T& value1, const uint128_t& value2) noexcept { return uint128_t(value1) < value2; }
     template <typename T>
-    friend bool operator<(const uint128_t& value1, const T& value2) noexcept { return value1 < uint128_t(value2); }
-    friend bool operator<(const uint128_t& value1, const uint128_t& value2) noexcept;
+    friend constexpr bool operator<(const uint128_t& value1, const T& value2) noexcept { return value1 < uint128_t(value2); }
+    friend constexpr bool operator<(const uint128_t& value1, const uint128_t& value2) noexcept;
 
     template <typename T>
-    friend bool operator>(const T& value1, const uint128_t& value2) noexcept { return uint128_t(value1) > value2; }
+    friend constexpr bool operator>(const T& value1, const uint128_t& value2) noexcept { return uint128_t(value1) > value2; }
     template <typename T>
-    friend bool operator>(const uint128_t& value1, const T& value2) noexcept { return value1 > uint128_t(value2); }
-    friend bool operator>(const uint128_t& value1, const uint128_t& value2) noexcept;
+    friend constexpr bool operator>(const uint128_t& value1, const T& value2) noexcept { return value1 > uint128_t(value2); }
+    friend constexpr bool operator>(const uint128_t& value1, const uint128_t& value2) noexcept;
 
     template <typename T>
-    friend bool operator<=(const T& value1, const uint128_t& value2) noexcept { return uint128_t(value1) <= value2; }
+    friend constexpr bool operator<=(const T& value1, const uint128_t& value2) noexcept { return uint128_t(value1) <= value2; }
     template <typename T>
-    friend bool operator<=(const uint128_t& value1, const T& value2) noexcept { return value1 <= uint128_t(value2); }
-    friend bool operator<=(const uint128_t& value1, const uint128_t& value2) noexcept;
+    friend constexpr bool operator<=(const uint128_t& value1, const T& value2) noexcept { return value1 <= uint128_t(value2); }
+    friend constexpr bool operator<=(const uint128_t& value1, const uint128_t& value2) noexcept;
 
     template <typename T>
-    friend bool operator>=(const T& value1, const uint128_t& value2) noexcept { return uint128_t(value1) >= value2; }
+    friend constexpr bool operator>=(const T& value1, const uint128_t& value2) noexcept { return uint128_t(value1) >= value2; }
     template <typename T>
-    friend bool operator>=(const uint128_t& value1, const T& value2) noexcept { return value1 >= uint128_t(value2); }
-    friend bool operator>=(const uint128_t& value1, const uint128_t& value2) noexcept;
+    friend constexpr bool operator>=(const uint128_t& value1, const T& value2) noexcept { return value1 >= uint128_t(value2); }
+    friend constexpr bool operator>=(const uint128_t& value1, const uint128_t& value2) noexcept;
 
     // Logical operators
-    bool operator!() const noexcept { return !(bool)(_upper | _lower); }
+    constexpr bool operator!() const noexcept { return !(bool)(_upper | _lower); }
 
     template <typename T>
-    friend bool operator&&(const T& value1, const uint128_t& value2) noexcept { return uint128_t(value1) && value2; }
+    friend constexpr bool operator&&(const T& value1, const uint128_t& value2) noexcept { return uint128_t(value1) && value2; }
     template <typename T>
-    friend bool operator&&(const uint128_t& value1, const T& value2) noexcept { return value1 && uint128_t(value2); }
-    friend bool operator&&(const uint128_t& value1, const uint128_t& value2) noexcept;
+    friend constexpr bool operator&&(const uint128_t& value1, const T& value2) noexcept { return value1 && uint128_t(value2); }
+    friend constexpr bool operator&&(const uint128_t& value1, const uint128_t& value2) noexcept;
 
     template <typename T>
-    friend bool operator||(const T& value1, const uint128_t& value2) noexcept { return uint128_t(value1) || value2; }
+    friend constexpr bool operator||(const T& value1, const uint128_t& value2) noexcept { return uint128_t(value1) || value2; }
     template <typename T>
-    friend bool operator||(const uint128_t& value1, const T& value2) noexcept { return value1 || uint128_t(value2); }
-    friend bool operator||(const uint128_t& value1, const uint128_t& value2) noexcept;
+    friend constexpr bool operator||(const uint128_t& value1, const T& value2) noexcept { return value1 || uint128_t(value2); }
+    friend constexpr bool operator||(const uint128_t& value1, const uint128_t& value2) noexcept;
 
     // Shift operators
-    uint128_t& operator<<=(const uint128_t& value) noexcept { return *this = *this << value; }
-    uint128_t& operator>>=(const uint128_t& value) noexcept { return *this = *this >> value; }
+    constexpr uint128_t& operator<<=(const uint128_t& value) noexcept { return *this = *this << value; }
+    constexpr uint128_t& operator>>=(const uint128_t& value) noexcept { return *this = *this >> value; }
 
     template <typename T>
-    uint128_t& operator<<=(const T& value) noexcept { return *this = *this << uint128_t(value); }
+    constexpr uint128_t& operator<<=(const T& value) noexcept { return *this = *this << uint128_t(value); }
     template <typename T>
-    uint128_t& operator>>=(const T& value) noexcept { return *this = *this >> uint128_t(value); }
+    constexpr uint128_t& operator>>=(const T& value) noexcept { return *this = *this >> uint128_t(value); }
 
     template <typename T>
-    friend T& operator<<=(T& value1, const uint128_t& value2) noexcept { return value1 = (T)(uint128_t(value1) << value2); }
+    friend constexpr T& operator<<=(T& value1, const uint128_t& value2) noexcept { return value1 = (T)(uint128_t(value1) << value2); }
     template <typename T>
-    friend T& operator>>=(T& value1, const uint128_t& value2) noexcept { return value1 = (T)(uint128_t(value1) >> value2); }
+    friend constexpr T& operator>>=(T& value1, const uint128_t& value2) noexcept { return value1 = (T)(uint128_t(value1) >> value2); }
 
     template <typename T>
-    friend uint128_t operator<<(const uint128_t& value1, const T& value2) noexcept { return value1 << uint128_t(value2); }
-    friend uint128_t operator<<(bool value1, const uint128_t& value2) noexcept { return uint128_t(value1) << value2; }
-    friend uint128_t operator<<(int8_t value1, const uint128_t& value2) noexcept { return uint128_t(value1) << value2; }
-    friend uint128_t operator<<(int16_t value1, const uint128_t& value2) noexcept { return uint128_t(value1) << value2; }
-    friend uint128_t operator<<(int32_t value1, const uint128_t& value2) noexcept { return uint128_t(value1) << value2; }
-    friend uint128_t operator<<(int64_t value1, const uint128_t& value2) noexcept { return uint128_t(value1) << value2; }
-    friend uint128_t operator<<(uint8_t value1, const uint128_t& value2) noexcept { return uint128_t(value1) << value2; }
-    friend uint128_t operator<<(uint16_t value1, const uint128_t& value2) noexcept { return uint128_t(value1) << value2; }
-    friend uint128_t operator<<(uint32_t value1, const uint128_t& value2) noexcept { return uint128_t(value1) << value2; }
-    friend uint128_t operator<<(uint64_t value1, const uint128_t& value2) noexcept { return uint128_t(value1) << value2; }
-    friend uint128_t operator<<(const uint128_t& value1, const uint128_t& value2) noexcept;
+    friend constexpr uint128_t operator<<(const uint128_t& value1, const T& value2) noexcept { return value1 << uint128_t(value2); }
+    friend constexpr uint128_t operator<<(bool value1, const uint128_t& value2) noexcept { return uint128_t(value1) << value2; }
+    friend constexpr uint128_t operator<<(int8_t value1, const uint128_t& value2) noexcept { return uint128_t(value1) << value2; }
+    friend constexpr uint128_t operator<<(int16_t value1, const uint128_t& value2) noexcept { return uint128_t(value1) << value2; }
+    friend constexpr uint128_t operator<<(int32_t value1, const uint128_t& value2) noexcept { return uint128_t(value1) << value2; }
+    friend constexpr uint128_t operator<<(int64_t value1, const uint128_t& value2) noexcept { return uint128_t(value1) << value2; }
+    friend constexpr uint128_t operator<<(uint8_t value1, const uint128_t& value2) noexcept { return uint128_t(value1) << value2; }
+    friend constexpr uint128_t operator<<(uint16_t value1, const uint128_t& value2) noexcept { return uint128_t(value1) << value2; }
+    friend constexpr uint128_t operator<<(uint32_t value1, const uint128_t& value2) noexcept { return uint128_t(value1) << value2; }
+    friend constexpr uint128_t operator<<(uint64_t value1, const uint128_t& value2) noexcept { return uint128_t(value1) << value2; }
+    friend constexpr uint128_t operator<<(const uint128_t& value1, const uint128_t& value2) noexcept;
 
     template <typename T>
-    friend uint128_t operator>>(const uint128_t& value1, const T& value2) noexcept { return value1 >> uint128_t(value2); }
-    friend uint128_t operator>>(bool value1, const uint128_t& value2) noexcept { return uint128_t(value1) >> value2; }
-    friend uint128_t operator>>(int8_t value1, const uint128_t& value2) noexcept { return uint128_t(value1) >> value2; }
-    friend uint128_t operator>>(int16_t value1, const uint128_t& value2) noexcept { return uint128_t(value1) >> value2; }
-    friend uint128_t operator>>(int32_t value1, const uint128_t& value2) noexcept { return uint128_t(value1) >> value2; }
-    friend uint128_t operator>>(int64_t value1, const uint128_t& value2) noexcept { return uint128_t(value1) >> value2; }
-    friend uint128_t operator>>(uint8_t value1, const uint128_t& value2) noexcept { return uint128_t(value1) >> value2; }
-    friend uint128_t operator>>(uint16_t value1, const uint128_t& value2) noexcept { return uint128_t(value1) >> value2; }
-    friend uint128_t operator>>(uint32_t value1, const uint128_t& value2) noexcept { return uint128_t(value1) >> value2; }
-    friend uint128_t operator>>(uint64_t value1, const uint128_t& value2) noexcept { return uint128_t(value1) >> value2; }
-    friend uint128_t operator>>(const uint128_t& value1, const uint128_t& value2) noexcept;
+    friend constexpr uint128_t operator>>(const uint128_t& value1, const T& value2) noexcept { return value1 >> uint128_t(value2); }
+    friend constexpr uint128_t operator>>(bool value1, const uint128_t& value2) noexcept { return uint128_t(value1) >> value2; }
+    friend constexpr uint128_t operator>>(int8_t value1, const uint128_t& value2) noexcept { return uint128_t(value1) >> value2; }
+    friend constexpr uint128_t operator>>(int16_t value1, const uint128_t& value2) noexcept { return uint128_t(value1) >> value2; }
+    friend constexpr uint128_t operator>>(int32_t value1, const uint128_t& value2) noexcept { return uint128_t(value1) >> value2; }
+    friend constexpr uint128_t operator>>(int64_t value1, const uint128_t& value2) noexcept { return uint128_t(value1) >> value2; }
+    friend constexpr uint128_t operator>>(uint8_t value1, const uint128_t& value2) noexcept { return uint128_t(value1) >> value2; }
+    friend constexpr uint128_t operator>>(uint16_t value1, const uint128_t& value2) noexcept { return uint128_t(value1) >> value2; }
+    friend constexpr uint128_t operator>>(uint32_t value1, const uint128_t& value2) noexcept { return uint128_t(value1) >> value2; }
+    friend constexpr uint128_t operator>>(uint64_t value1, const uint128_t& value2) noexcept { return uint128_t(value1) >> value2; }
+    friend constexpr uint128_t operator>>(const uint128_t& value1, const uint128_t& value2) noexcept;
 
     // Type cast
-    operator bool() const noexcept { return (bool)(_upper | _lower); }
-    operator uint8_t() const noexcept { return (uint8_t)_lower; }
-    operator uint16_t() const noexcept { return (uint16_t)_lower; }
-    operator uint32_t() const noexcept { return (uint32_t)_lower; }
-    operator uint64_t() const noexcept { return (uint64_t)_lower; }
+    constexpr operator bool() const noexcept { return (bool)(_upper | _lower); }
+    constexpr operator uint8_t() const noexcept { return (uint8_t)_lower; }
+    constexpr operator uint16_t() const noexcept { return (uint16_t)_lower; }
+    constexpr operator uint32_t() const noexcept { return (uint32_t)_lower; }
+    constexpr operator uint64_t() const noexcept { return (uint64_t)_lower; }
 
     //! Get the upper part of the 128-bit integer
-    uint64_t upper() const noexcept { return _upper; }
+    constexpr uint64_t upper() const noexcept { return _upper; }
     //! Get the lower part of the 128-bit integer
-    uint64_t lower() const noexcept { return _lower; }
+    constexpr uint64_t lower() const noexcept { return _lower; }
 
     //! Get the count of bits
-    size_t bits() const noexcept;
+    constexpr size_t bits() const noexcept;
 
     //! Get string from the current 128-bit integer
     /*!
@@ -283,7 +297,7 @@ public:
         \param y - Y value
         \return Quotient and remainder pair
     */
-    static std::pair<uint128_t, uint128_t> divmod(const uint128_t& x, const uint128_t& y);
+    static constexpr std::pair<uint128_t, uint128_t> divmod(const uint128_t& x, const uint128_t& y);
 
     //! Input instance from the given input stream
     friend std::istream& operator>>(std::istream& is, uint128_t& value)
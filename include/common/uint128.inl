@@ -8,67 +8,160 @@
 
 namespace CppCommon {
 
-inline uint128_t::uint128_t() noexcept
+//! @cond INTERNALS
+namespace Internals {
+
+#if defined(CPPCOMMON_UINT128_NATIVE)
+__extension__ typedef unsigned __int128 native_uint128_t;
+#endif
+
+//! Multiply two 64-bit values into the 128-bit product
+constexpr uint64_t Multiply64(uint64_t x, uint64_t y, uint64_t& upper) noexcept
+{
+#if defined(CPPCOMMON_UINT128_NATIVE)
+    native_uint128_t result = (native_uint128_t)x * y;
+    upper = (uint64_t)(result >> 64);
+    return (uint64_t)result;
+#else
+#if defined(CPPCOMMON_UINT128_INTRINSICS)
+    if (!std::is_constant_evaluated())
+        return _umul128(x, y, &upper);
+#endif
+    // Multiply 32-bit parts and accumulate carries
+    uint64_t x0 = x & 0xFFFFFFFF, x1 = x >> 32;
+    uint64_t y0 = y & 0xFFFFFFFF, y1 = y >> 32;
+    uint64_t p00 = x0 * y0;
+    uint64_t p01 = x0 * y1;
+    uint64_t p10 = x1 * y0;
+    uint64_t p11 = x1 * y1;
+    uint64_t middle = (p00 >> 32) + (p01 & 0xFFFFFFFF) + (p10 & 0xFFFFFFFF);
+    upper = p11 + (p01 >> 32) + (p10 >> 32) + (middle >> 32);
+    return (middle << 32) | (p00 & 0xFFFFFFFF);
+#endif
+}
+
+//! Divide the 128-bit value by the 64-bit divisor, the upper part must be less than the divisor
+constexpr uint64_t Divide128(uint64_t upper, uint64_t lower, uint64_t divisor, uint64_t& remainder) noexcept
+{
+#if defined(CPPCOMMON_UINT128_NATIVE)
+#if defined(__x86_64__)
+    // Single 128-bit by 64-bit division instruction instead of the generic 128-bit division call
+    if (!std::is_constant_evaluated())
+    {
+        uint64_t quotient;
+        __asm__("divq %[divisor]" : "=a"(quotient), "=d"(remainder) : [divisor] "rm"(divisor), "a"(lower), "d"(upper));
+        return quotient;
+    }
+#endif
+    native_uint128_t dividend = ((native_uint128_t)upper << 64) | lower;
+    remainder = (uint64_t)(dividend % divisor);
+    return (uint64_t)(dividend / divisor);
+#else
+#if defined(CPPCOMMON_UINT128_INTRINSICS)
+    if (!std::is_constant_evaluated())
+        return _udiv128(upper, lower, divisor, &remainder);
+#endif
+    // Divide normalized 32-bit digits (Hacker's Delight, divlu)
+    const uint64_t base = 0x100000000ull;
+    const int shift = std::countl_zero(divisor);
+    divisor <<= shift;
+    uint64_t u32 = (upper << shift) | ((shift > 0) ? (lower >> (64 - shift)) : 0);
+    uint64_t u10 = lower << shift;
+    uint64_t v1 = divisor >> 32;
+    uint64_t v0 = divisor & 0xFFFFFFFF;
+    uint64_t u1 = u10 >> 32;
+    uint64_t u0 = u10 & 0xFFFFFFFF;
+
+    uint64_t q1 = u32 / v1;
+    uint64_t rhat = u32 - q1 * v1;
+    while ((q1 >= base) || ((q1 * v0) > ((rhat << 32) + u1)))
+    {
+        --q1;
+        rhat += v1;
+        if (rhat >= base)
+            break;
+    }
+
+    uint64_t u21 = (u32 << 32) + u1 - q1 * divisor;
+    uint64_t q0 = u21 / v1;
+    rhat = u21 - q0 * v1;
+    while ((q0 >= base) || ((q0 * v0) > ((rhat << 32) + u0)))
+    {
+        --q0;
+        rhat += v1;
+        if (rhat >= base)
+            break;
+    }
+
+    remainder = ((u21 << 32) + u0 - q0 * divisor) >> shift;
+    return (q1 << 32) + q0;
+#endif
+}
+
+} // namespace Internals
+//! @endcond
+
+constexpr uint128_t::uint128_t() noexcept
     : _upper(0), _lower(0)
 {
 }
 
-inline uint128_t::uint128_t(int8_t value) noexcept
+constexpr uint128_t::uint128_t(int8_t value) noexcept
     : _upper(0), _lower(value)
 {
 }
 
-inline uint128_t::uint128_t(uint8_t value) noexcept
+constexpr uint128_t::uint128_t(uint8_t value) noexcept
     : _upper(0), _lower(value)
 {
 }
 
-inline uint128_t::uint128_t(int16_t value) noexcept
+constexpr uint128_t::uint128_t(int16_t value) noexcept
     : _upper(0), _lower(value)
 {
 }
 
-inline uint128_t::uint128_t(uint16_t value) noexcept
+constexpr uint128_t::uint128_t(uint16_t value) noexcept
     : _upper(0), _lower(value)
 {
 }
 
-inline uint128_t::uint128_t(int32_t value) noexcept
+constexpr uint128_t::uint128_t(int32_t value) noexcept
     : _upper(0), _lower(value)
 {
 }
 
-inline uint128_t::uint128_t(uint32_t value) noexcept
+constexpr uint128_t::uint128_t(uint32_t value) noexcept
     : _upper(0), _lower(value)
 {
 }
 
-inline uint128_t::uint128_t(int64_t value) noexcept
+constexpr uint128_t::uint128_t(int64_t value) noexcept
     : _upper(0), _lower(value)
 {
 }
 
-inline uint128_t::uint128_t(uint64_t value) noexcept
+constexpr uint128_t::uint128_t(uint64_t value) noexcept
     : _upper(0), _lower(value)
 {
 }
 
 template <typename T>
-inline uint128_t::uint128_t(const T& value) noexcept
+constexpr uint128_t::uint128_t(const T& value) noexcept
     : _upper(0), _lower(value)
 {
     static_assert((std::is_integral<T>::value || std::is_same<T, uint128_t>::value), "Input argument type must be an integer!");
 }
 
 template <typename TUpper, typename TLower>
-inline uint128_t::uint128_t(const TUpper& upper, const TLower& lower) noexcept
+constexpr uint128_t::uint128_t(const TUpper& upper, const TLower& lower) noexcept
     : _upper(upper), _lower(lower)
 {
     static_assert(((std::is_integral<TUpper>::value || std::is_same<TUpper, uint128_t>::value) && (std::is_integral<TLower>::value || std::is_same<TLower, uint128_t>::value)), "Input argument types must be integers!");
 }
 
 template <typename T>
-inline uint128_t& uint128_t::operator=(const T& value) noexcept
+constexpr uint128_t& uint128_t::operator=(const T& value) noexcept
 {
     static_assert((std::is_integral<T>::value || std::is_same<T, uint128_t>::value), "Input argument type must be an integer!");
 
@@ -77,81 +170,192 @@ inline uint128_t& uint128_t::operator=(const T& value) noexcept
     return *this;
 }
 
-inline uint128_t operator+(const uint128_t& value1, const uint128_t& value2) noexcept
+constexpr uint128_t operator+(const uint128_t& value1, const uint128_t& value2) noexcept
 {
     return uint128_t(value1._upper + value2._upper + (((value1._lower + value2._lower) < value1._lower) ? 1 : 0), value1._lower + value2._lower);
 }
 
-inline uint128_t operator-(const uint128_t& value1, const uint128_t& value2) noexcept
+constexpr uint128_t operator-(const uint128_t& value1, const uint128_t& value2) noexcept
 {
     return uint128_t(value1._upper - value2._upper - (((value1._lower - value2._lower) > value1._lower) ? 1 : 0), value1._lower - value2._lower);
 }
 
-inline uint128_t operator/(const uint128_t& value1, const uint128_t& value2)
+constexpr uint128_t operator*(const uint128_t& value1, const uint128_t& value2) noexcept
+{
+#if defined(CPPCOMMON_UINT128_NATIVE)
+    Internals::native_uint128_t result = (((Internals::native_uint128_t)value1._upper << 64) | value1._lower) * (((Internals::native_uint128_t)value2._upper << 64) | value2._lower);
+    return uint128_t((uint64_t)(result >> 64), (uint64_t)result);
+#else
+    // Cross products contribute only to the upper part, their overflow is discarded
+    uint64_t upper = 0;
+    uint64_t lower = Internals::Multiply64(value1._lower, value2._lower, upper);
+    return uint128_t(upper + value1._upper * value2._lower + value1._lower * value2._upper, lower);
+#endif
+}
+
+constexpr uint128_t operator/(const uint128_t& value1, const uint128_t& value2)
 {
     return uint128_t::divmod(value1, value2).first;
 }
 
-inline uint128_t operator%(const uint128_t& value1, const uint128_t& value2)
+constexpr uint128_t operator%(const uint128_t& value1, const uint128_t& value2)
 {
     return uint128_t::divmod(value1, value2).second;
 }
 
-inline uint128_t operator&(const uint128_t& value1, const uint128_t& value2) noexcept
+constexpr uint128_t operator&(const uint128_t& value1, const uint128_t& value2) noexcept
 {
     return uint128_t(value1._upper & value2._upper, value1._lower & value2._lower);
 }
 
-inline uint128_t operator|(const uint128_t& value1, const uint128_t& value2) noexcept
+constexpr uint128_t operator|(const uint128_t& value1, const uint128_t& value2) noexcept
 {
     return uint128_t(value1._upper | value2._upper, value1._lower | value2._lower);
 }
 
-inline uint128_t operator^(const uint128_t& value1, const uint128_t& value2) noexcept
+constexpr uint128_t operator^(const uint128_t& value1, const uint128_t& value2) noexcept
 {
     return uint128_t(value1._upper ^ value2._upper, value1._lower ^ value2._lower);
 }
 
-inline bool operator==(const uint128_t& value1, const uint128_t& value2) noexcept
+constexpr bool operator==(const uint128_t& value1, const uint128_t& value2) noexcept
 {
     return ((value1._upper == value2._upper) && (value1._lower == value2._lower));
 }
 
-inline bool operator!=(const uint128_t& value1, const uint128_t& value2) noexcept
+constexpr bool operator!=(const uint128_t& value1, const uint128_t& value2) noexcept
 {
     return ((value1._upper != value2._upper) || (value1._lower != value2._lower));
 }
 
-inline bool operator<(const uint128_t& value1, const uint128_t& value2) noexcept
+constexpr bool operator<(const uint128_t& value1, const uint128_t& value2) noexcept
 {
     return (value1._upper == value2._upper) ? (value1._lower < value2._lower) : (value1._upper < value2._upper);
 }
 
-inline bool operator>(const uint128_t& value1, const uint128_t& value2) noexcept
+constexpr bool operator>(const uint128_t& value1, const uint128_t& value2) noexcept
 {
     return (value1._upper == value2._upper) ? (value1._lower > value2._lower) : (value1._upper > value2._upper);
 }
 
-inline bool operator<=(const uint128_t& value1, const uint128_t& value2) noexcept
+constexpr bool operator<=(const uint128_t& value1, const uint128_t& value2) noexcept
 {
     return ((value1 < value2) || (value1 == value2));
 }
 
-inline bool operator>=(const uint128_t& value1, const uint128_t& value2) noexcept
+constexpr bool operator>=(const uint128_t& value1, const uint128_t& value2) noexcept
 {
     return ((value1 > value2) || (value1 == value2));
 }
 
-inline bool operator&&(const uint128_t& value1, const uint128_t& value2) noexcept
+constexpr uint128_t operator<<(const uint128_t& value1, const uint128_t& value2) noexcept
+{
+    if (((bool)value2._upper) || (value2._lower >= 128))
+        return 0;
+
+    const unsigned shift = (unsigned)value2._lower;
+
+#if defined(CPPCOMMON_UINT128_NATIVE)
+    Internals::native_uint128_t result = (((Internals::native_uint128_t)value1._upper << 64) | value1._lower) << shift;
+    return uint128_t((uint64_t)(result >> 64), (uint64_t)result);
+#else
+    if (shift >= 64)
+        return uint128_t(value1._lower << (shift - 64), 0);
+#if defined(CPPCOMMON_UINT128_INTRINSICS)
+    if (!std::is_constant_evaluated())
+        return uint128_t(__shiftleft128(value1._lower, value1._upper, (unsigned char)shift), value1._lower << shift);
+#endif
+    if (shift == 0)
+        return value1;
+    return uint128_t((value1._upper << shift) | (value1._lower >> (64 - shift)), value1._lower << shift);
+#endif
+}
+
+constexpr uint128_t operator>>(const uint128_t& value1, const uint128_t& value2) noexcept
+{
+    if (((bool)value2._upper) || (value2._lower >= 128))
+        return 0;
+
+    const unsigned shift = (unsigned)value2._lower;
+
+#if defined(CPPCOMMON_UINT128_NATIVE)
+    Internals::native_uint128_t result = (((Internals::native_uint128_t)value1._upper << 64) | value1._lower) >> shift;
+    return uint128_t((uint64_t)(result >> 64), (uint64_t)result);
+#else
+    if (shift >= 64)
+        return uint128_t(0, value1._upper >> (shift - 64));
+#if defined(CPPCOMMON_UINT128_INTRINSICS)
+    if (!std::is_constant_evaluated())
+        return uint128_t(value1._upper >> shift, __shiftright128(value1._lower, value1._upper, (unsigned char)shift));
+#endif
+    if (shift == 0)
+        return value1;
+    return uint128_t(value1._upper >> shift, (value1._upper << (64 - shift)) | (value1._lower >> shift));
+#endif
+}
+
+constexpr bool operator&&(const uint128_t& value1, const uint128_t& value2) noexcept
 {
     return ((bool)value1 && (bool)value2);
 }
 
-inline bool operator||(const uint128_t& value1, const uint128_t& value2) noexcept
+constexpr bool operator||(const uint128_t& value1, const uint128_t& value2) noexcept
 {
     return ((bool)value1 || (bool)value2);
 }
 
+constexpr size_t uint128_t::bits() const noexcept
+{
+    return (size_t)(_upper ? (64 + std::bit_width(_upper)) : std::bit_width(_lower));
+}
+
+constexpr std::pair<uint128_t, uint128_t> uint128_t::divmod(const uint128_t& x, const uint128_t& y)
+{
+    if (y == 0)
+        throw std::domain_error("Division by 0");
+
+#if defined(CPPCOMMON_UINT128_NATIVE)
+    Internals::native_uint128_t dividend = ((Internals::native_uint128_t)x._upper << 64) | x._lower;
+    Internals::native_uint128_t divisor = ((Internals::native_uint128_t)y._upper << 64) | y._lower;
+    Internals::native_uint128_t quotient = dividend / divisor;
+    Internals::native_uint128_t remainder = dividend % divisor;
+    return std::pair<uint128_t, uint128_t>(uint128_t((uint64_t)(quotient >> 64), (uint64_t)quotient), uint128_t((uint64_t)(remainder >> 64), (uint64_t)remainder));
+#else
+    if (x < y)
+        return std::pair<uint128_t, uint128_t>(0, x);
+
+    // 64-bit division
+    if (x._upper == 0)
+        return std::pair<uint128_t, uint128_t>(x._lower / y._lower, x._lower % y._lower);
+
+    // 128-bit by 64-bit division in two steps, the first remainder is always less than the divisor
+    if (y._upper == 0)
+    {
+        uint64_t upper = x._upper / y._lower;
+        uint64_t remainder = 0;
+        uint64_t lower = Internals::Divide128(x._upper % y._lower, x._lower, y._lower, remainder);
+        return std::pair<uint128_t, uint128_t>(uint128_t(upper, lower), remainder);
+    }
+
+    // Shift-subtract division starting from the aligned highest bits
+    size_t shift = x.bits() - y.bits();
+    uint128_t divisor = y << shift;
+    uint128_t quotient = 0;
+    uint128_t remainder = x;
+    for (size_t i = 0; i <= shift; ++i)
+    {
+        quotient <<= 1;
+        if (remainder >= divisor)
+        {
+            remainder -= divisor;
+            quotient |= 1;
+        }
+        divisor >>= 1;
+    }
+    return std::pair<uint128_t, uint128_t>(quotient, remainder);
+#endif
+}
+
 inline std::ostream& operator<<(std::ostream& os, const uint128_t& value)
 {
     if (os.flags() & os.oct)
@@ -216,4 +420,11 @@ struct std::hash<CppCommon::uint128_t>
         return result;
     }
 };
+
+template <>
+struct CppCommon::FastHash<CppCommon::uint128_t>
+{
+    size_t operator()(const CppCommon::uint128_t& value) const noexcept
+    { return (size_t)CppCommon::Hash::Mix(value.upper(), value.lower()); }
+};
 //! \endcond
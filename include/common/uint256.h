@@ -306,14 +306,14 @@ public:
     //! Get the count of bits
     size_t bits() const noexcept;
 
-    //! Get string from the current 128-bit integer
+    //! Get string from the current 256-bit integer
     /*!
         \param base - Conversion base in range [2, 16] (default is 10)
         \param length - Minimal string length (default is 0)
         \return Result string
     */
     std::string string(size_t base = 10, size_t length = 0) const;
-    //! Get wide string from the current 128-bit integer
+    //! Get wide string from the current 256-bit integer
     /*!
         \param base - Conversion base in range [2, 16] (default is 10)
         \param length - Minimal string length (default is 0)
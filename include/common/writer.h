@@ -9,6 +9,9 @@
 #ifndef CPPCOMMON_WRITER_H
 #define CPPCOMMON_WRITER_H
 
+#include <cstddef>
+#include <initializer_list>
+#include <span>
 #include <string>
 #include <vector>
 
@@ -22,6 +25,13 @@ namespace CppCommon {
 class Writer
 {
 public:
+    //! Gather buffer of vectored write operations
+    struct WriteBuffer
+    {
+        const void* data;   //!< Buffer to write
+        size_t size;        //!< Buffer size
+    };
+
     Writer() noexcept = default;
     Writer(const Writer&) noexcept = default;
     Writer(Writer&&) noexcept = default;
@@ -38,6 +48,21 @@ public:
     */
     virtual size_t Write(const void* buffer, size_t size) = 0;
 
+    //! Write bytes buffers with one vectored operation
+    /*!
+        Base method writes buffers one by one and stops at the first
+        incomplete write. Writers override it with the vectored system
+        call (e.g. writev) to write a record header and its payload
+        without copying them into one buffer.
+
+        \param buffers - Buffers to write
+        \return Count of written bytes
+    */
+    virtual size_t WriteV(std::span<const WriteBuffer> buffers);
+    //! Write bytes buffers with one vectored operation
+    size_t WriteV(std::initializer_list<WriteBuffer> buffers)
+    { return WriteV(std::span<const WriteBuffer>(buffers.begin(), buffers.size())); }
+
     //! Write a text string
     /*!
         \param text - Text string
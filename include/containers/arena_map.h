@@ -0,0 +1,73 @@
+/*!
+    \file arena_map.h
+    \brief Arena hash map and flat map containers definition
+    \author Ivan Shynkarenka
+    \date 15.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_CONTAINERS_ARENA_MAP_H
+#define CPPCOMMON_CONTAINERS_ARENA_MAP_H
+
+#include "containers/flatmap.h"
+#include "containers/hashmap.h"
+#include "memory/allocator_arena.h"
+
+namespace CppCommon {
+
+//! Arena hash map container
+/*!
+    Hash map which allocates its buckets from the arena memory manager. Arena
+    deallocation only updates statistics and trivially destructible items are
+    not destroyed one by one, so the per-request scratch hash map is released
+    in O(1) and all its memory is returned to the arena at once with a single
+    ArenaMemoryManager::reset() or ArenaScope rewind.
+
+    Arena hash map must be destroyed before the arena is reset or rewound.
+
+    Not thread-safe.
+*/
+template <typename TKey, typename TValue, typename THash = FastHash<TKey>, typename TEqual = std::equal_to<TKey>, class TAuxMemoryManager = DefaultMemoryManager, class TProbing = HashMapLinearProbing>
+using ArenaHashMap = HashMap<TKey, TValue, THash, TEqual, ArenaAllocator<std::pair<TKey, TValue>, TAuxMemoryManager>, TProbing>;
+
+//! Arena flat map container
+/*!
+    Flat map which allocates its items from the arena memory manager. Arena
+    deallocation only updates statistics and trivially destructible items are
+    not destroyed one by one, so the per-request scratch flat map is released
+    in O(1) and all its memory is returned to the arena at once with a single
+    ArenaMemoryManager::reset() or ArenaScope rewind.
+
+    Arena flat map must be destroyed before the arena is reset or rewound.
+
+    Not thread-safe.
+*/
+template <typename TKey, typename TValue, typename TCompare = std::less<TKey>, class TAuxMemoryManager = DefaultMemoryManager>
+using ArenaFlatMap = FlatMap<TKey, TValue, TCompare, ArenaAllocator<std::pair<TKey, TValue>, TAuxMemoryManager>>;
+
+//! Make the arena hash map on top of the given arena memory manager
+/*!
+    \param arena - Arena memory manager
+    \param capacity - Hash map capacity (default is 128)
+    \param blank - Blank key value (default is TKey())
+    \return Arena hash map
+*/
+template <typename TKey, typename TValue, typename THash = FastHash<TKey>, typename TEqual = std::equal_to<TKey>, class TAuxMemoryManager = DefaultMemoryManager, class TProbing = HashMapLinearProbing>
+ArenaHashMap<TKey, TValue, THash, TEqual, TAuxMemoryManager, TProbing> MakeArenaHashMap(ArenaMemoryManager<TAuxMemoryManager>& arena, size_t capacity = 128, const TKey& blank = TKey())
+{ return ArenaHashMap<TKey, TValue, THash, TEqual, TAuxMemoryManager, TProbing>(capacity, blank, THash(), TEqual(), ArenaAllocator<std::pair<TKey, TValue>, TAuxMemoryManager>(arena)); }
+
+//! Make the arena flat map on top of the given arena memory manager
+/*!
+    \param arena - Arena memory manager
+    \param capacity - Flat map capacity (default is 128)
+    \return Arena flat map
+*/
+template <typename TKey, typename TValue, typename TCompare = std::less<TKey>, class TAuxMemoryManager = DefaultMemoryManager>
+ArenaFlatMap<TKey, TValue, TCompare, TAuxMemoryManager> MakeArenaFlatMap(ArenaMemoryManager<TAuxMemoryManager>& arena, size_t capacity = 128)
+{ return ArenaFlatMap<TKey, TValue, TCompare, TAuxMemoryManager>(capacity, TCompare(), ArenaAllocator<std::pair<TKey, TValue>, TAuxMemoryManager>(arena)); }
+
+/*! \example containers_arena_map.cpp Arena hash map and flat map containers example */
+
+} // namespace CppCommon
+
+#endif // CPPCOMMON_CONTAINERS_ARENA_MAP_H
@@ -9,10 +9,14 @@
 #ifndef CPPCOMMON_CONTAINERS_BINTREE_H
 #define CPPCOMMON_CONTAINERS_BINTREE_H
 
+#include "memory/memory.h"
+
+#include <algorithm>
 #include <cassert>
 #include <cstddef>
 #include <functional>
 #include <iterator>
+#include <type_traits>
 #include <utility>
 
 namespace CppCommon {
@@ -26,6 +30,48 @@ class BinTreeReverseIterator;
 template <class TContainer, typename T>
 class BinTreeConstReverseIterator;
 
+//! @cond INTERNALS
+namespace Internals {
+
+// Detect the optional subtree size field of the intrusive binary tree item
+template <typename T, typename = void>
+struct BinTreeHasSubtree : std::false_type {};
+template <typename T>
+struct BinTreeHasSubtree<T, std::void_t<decltype(std::declval<T&>().subtree)>> : std::true_type {};
+
+// Order statistics helpers for intrusive binary trees with subtree sizes
+template <typename T>
+size_t BinTreeSubtree(const T* node) noexcept;
+template <typename T>
+void BinTreeUpdateSubtree(T* node) noexcept;
+template <typename T>
+void BinTreeAdjustSubtree(T* node, bool increment) noexcept;
+template <class TContainer, typename T>
+size_t BinTreeRank(const TContainer& container, const T* root, const T& item) noexcept;
+template <typename T>
+const T* BinTreeSelect(const T* root, size_t index) noexcept;
+
+// Linear time rebuild helpers for intrusive binary trees
+template <typename T>
+T* BinTreeFlatten(T* root) noexcept;
+template <typename T, class TVisitor>
+T* BinTreeBuild(T*& head, size_t count, size_t depth, size_t& height, const TVisitor& visitor) noexcept;
+template <class TContainer, typename T>
+T* BinTreeSplitList(const TContainer& container, T* head, const T& item, size_t& count) noexcept;
+template <class TContainer, typename T>
+T* BinTreeMergeList(const TContainer& container, T* head1, T* head2, T*& duplicates, size_t& count, size_t& duplicates_count) noexcept;
+
+// Software prefetch helpers for intrusive binary trees
+template <typename T>
+T* BinTreeLeftmostPrefetch(T* node) noexcept;
+template <typename T, class TFunction>
+void BinTreeForEachPrefetch(T* root, TFunction&& fn);
+template <typename TResult, class TContainer, typename T, class InputIterator, class OutputIterator>
+OutputIterator BinTreeFindBatch(const TContainer& container, const T* root, InputIterator first, InputIterator last, OutputIterator result) noexcept;
+
+} // namespace Internals
+//! @endcond
+
 //! Intrusive non balanced binary tree container
 /*!
     Binary trees are the good structures for associative searching. They  keep
@@ -223,6 +269,40 @@ public:
     iterator upper_bound(const T& item) noexcept;
     const_iterator upper_bound(const T& item) const noexcept;
 
+    //! Find multiple items with interleaved lookups and software prefetch
+    /*!
+        Lookups are walked in groups of 16 items in an interleaved way: each
+        round moves every lookup of the group one level down and prefetches
+        its next node, so cache misses of independent lookups overlap instead
+        of being paid one after another.
+
+        \param first - The first iterator of items to find (forward iterator)
+        \param last - The last iterator of items to find
+        \param result - Output iterator of pointers to the first equal items (nullptr if the item is not found)
+        \return Output iterator past the last written pointer
+    */
+    template <class InputIterator, class OutputIterator>
+    OutputIterator find_batch(InputIterator first, InputIterator last, OutputIterator result) noexcept;
+    template <class InputIterator, class OutputIterator>
+    OutputIterator find_batch(InputIterator first, InputIterator last, OutputIterator result) const noexcept;
+
+    //! Call the given function for each binary tree item in order with software prefetch
+    /*!
+        Each descent to the leftmost node of a subtree prefetches right
+        children of passed nodes, which are visited after their left subtrees.
+        So cache misses of different subtrees overlap instead of being paid
+        one after another. The next in-order item is found before the function
+        call for the current one.
+
+        The function must not modify the binary tree.
+
+        \param fn - Function to call as fn(item)
+    */
+    template <class TFunction>
+    void for_each_prefetch(TFunction&& fn);
+    template <class TFunction>
+    void for_each_prefetch(TFunction&& fn) const;
+
     //! Insert a new item into the binary tree
     /*!
         \param item - Item to insert
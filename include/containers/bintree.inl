@@ -231,6 +231,34 @@ inline typename BinTree<T, TCompare>::const_iterator BinTree<T, TCompare>::upper
     return const_iterator(this, InternalUpperBound(item));
 }
 
+template <typename T, typename TCompare>
+template <class InputIterator, class OutputIterator>
+inline OutputIterator BinTree<T, TCompare>::find_batch(InputIterator first, InputIterator last, OutputIterator result) noexcept
+{
+    return Internals::BinTreeFindBatch<T*>(*this, _root, first, last, result);
+}
+
+template <typename T, typename TCompare>
+template <class InputIterator, class OutputIterator>
+inline OutputIterator BinTree<T, TCompare>::find_batch(InputIterator first, InputIterator last, OutputIterator result) const noexcept
+{
+    return Internals::BinTreeFindBatch<const T*>(*this, _root, first, last, result);
+}
+
+template <typename T, typename TCompare>
+template <class TFunction>
+inline void BinTree<T, TCompare>::for_each_prefetch(TFunction&& fn)
+{
+    Internals::BinTreeForEachPrefetch(_root, fn);
+}
+
+template <typename T, typename TCompare>
+template <class TFunction>
+inline void BinTree<T, TCompare>::for_each_prefetch(TFunction&& fn) const
+{
+    Internals::BinTreeForEachPrefetch((const T*)_root, fn);
+}
+
 template <typename T, typename TCompare>
 inline const T* BinTree<T, TCompare>::InternalUpperBound(const T& item) const noexcept
 {
@@ -645,4 +673,284 @@ void swap(BinTreeConstReverseIterator<TContainer, T>& it1, BinTreeConstReverseIt
     it1.swap(it2);
 }
 
+//! @cond INTERNALS
+namespace Internals {
+
+template <typename T>
+inline size_t BinTreeSubtree(const T* node) noexcept
+{
+    return (node != nullptr) ? node->subtree : 0;
+}
+
+template <typename T>
+inline void BinTreeUpdateSubtree(T* node) noexcept
+{
+    if constexpr (BinTreeHasSubtree<T>::value)
+        node->subtree = BinTreeSubtree(node->left) + BinTreeSubtree(node->right) + 1;
+}
+
+template <typename T>
+inline void BinTreeAdjustSubtree(T* node, bool increment) noexcept
+{
+    if constexpr (BinTreeHasSubtree<T>::value)
+    {
+        for (; node != nullptr; node = node->parent)
+        {
+            if (increment)
+                ++node->subtree;
+            else
+                --node->subtree;
+        }
+    }
+}
+
+template <class TContainer, typename T>
+inline size_t BinTreeRank(const TContainer& container, const T* root, const T& item) noexcept
+{
+    size_t result = 0;
+    const T* node = root;
+    while (node != nullptr)
+    {
+        if (container.compare(*node, item))
+        {
+            result += BinTreeSubtree(node->left) + 1;
+            node = node->right;
+        }
+        else
+            node = node->left;
+    }
+    return result;
+}
+
+template <typename T>
+inline const T* BinTreeSelect(const T* root, size_t index) noexcept
+{
+    const T* node = root;
+    while (node != nullptr)
+    {
+        size_t left = BinTreeSubtree(node->left);
+        if (index < left)
+            node = node->left;
+        else if (index == left)
+            return node;
+        else
+        {
+            index -= left + 1;
+            node = node->right;
+        }
+    }
+    return nullptr;
+}
+
+template <typename T>
+inline T* BinTreeFlatten(T* root) noexcept
+{
+    // Convert the tree into the sorted list linked by right pointers with right rotations
+    T* head = nullptr;
+    T** link = &head;
+    T* rest = root;
+    while (rest != nullptr)
+    {
+        if (rest->left != nullptr)
+        {
+            T* left = rest->left;
+            rest->left = left->right;
+            left->right = rest;
+            rest = left;
+        }
+        else
+        {
+            *link = rest;
+            link = &rest->right;
+            rest = rest->right;
+        }
+    }
+    return head;
+}
+
+template <typename T, class TVisitor>
+inline T* BinTreeBuild(T*& head, size_t count, size_t depth, size_t& height, const TVisitor& visitor) noexcept
+{
+    if (count == 0)
+    {
+        height = 0;
+        return nullptr;
+    }
+
+    // Build the left subtree, take the middle item and build the right subtree from the sorted list
+    size_t left_height;
+    size_t right_height;
+    T* left = BinTreeBuild(head, count / 2, depth + 1, left_height, visitor);
+    T* root = head;
+    head = head->right;
+    T* right = BinTreeBuild(head, count - count / 2 - 1, depth + 1, right_height, visitor);
+
+    root->parent = nullptr;
+    root->left = left;
+    root->right = right;
+    if (left != nullptr)
+        left->parent = root;
+    if (right != nullptr)
+        right->parent = root;
+
+    BinTreeUpdateSubtree(root);
+    visitor(root, depth, left_height, right_height);
+
+    height = std::max(left_height, right_height) + 1;
+    return root;
+}
+
+template <class TContainer, typename T>
+inline T* BinTreeSplitList(const TContainer& container, T* head, const T& item, size_t& count) noexcept
+{
+    // Cut the sorted list before the first item that not less than the given one
+    count = 0;
+    T** link = &head;
+    while ((*link != nullptr) && container.compare(**link, item))
+    {
+        link = &(*link)->right;
+        ++count;
+    }
+    T* result = *link;
+    *link = nullptr;
+    return result;
+}
+
+template <class TContainer, typename T>
+inline T* BinTreeMergeList(const TContainer& container, T* head1, T* head2, T*& duplicates, size_t& count, size_t& duplicates_count) noexcept
+{
+    // Merge two sorted lists, equal items from the second list are collected into the duplicates list
+    T* head = nullptr;
+    T** link = &head;
+    T** duplicates_link = &duplicates;
+    count = 0;
+    duplicates_count = 0;
+    while ((head1 != nullptr) || (head2 != nullptr))
+    {
+        T** source;
+        if (head1 == nullptr)
+            source = &head2;
+        else if (head2 == nullptr)
+            source = &head1;
+        else if (container.compare(*head2, *head1))
+            source = &head2;
+        else if (container.compare(*head1, *head2))
+            source = &head1;
+        else
+        {
+            T* duplicate = head2;
+            head2 = head2->right;
+            *duplicates_link = duplicate;
+            duplicates_link = &duplicate->right;
+            ++duplicates_count;
+            continue;
+        }
+
+        T* node = *source;
+        *source = node->right;
+        *link = node;
+        link = &node->right;
+        ++count;
+    }
+    *link = nullptr;
+    *duplicates_link = nullptr;
+    return head;
+}
+
+template <typename T>
+inline T* BinTreeLeftmostPrefetch(T* node) noexcept
+{
+    // Right subtrees of passed nodes are visited after their left subtrees
+    while (node->left != nullptr)
+    {
+        Memory::Prefetch(node->right);
+        node = node->left;
+    }
+    return node;
+}
+
+template <typename T, class TFunction>
+inline void BinTreeForEachPrefetch(T* root, TFunction&& fn)
+{
+    T* node = (root != nullptr) ? BinTreeLeftmostPrefetch(root) : nullptr;
+    while (node != nullptr)
+    {
+        // Find the next in-order node before the function call
+        T* next;
+        if (node->right != nullptr)
+            next = BinTreeLeftmostPrefetch<T>(node->right);
+        else
+        {
+            T* child = node;
+            next = node->parent;
+            while ((next != nullptr) && (next->right == child))
+            {
+                child = next;
+                next = next->parent;
+            }
+        }
+        fn(*node);
+        node = next;
+    }
+}
+
+template <typename TResult, class TContainer, typename T, class InputIterator, class OutputIterator>
+inline OutputIterator BinTreeFindBatch(const TContainer& container, const T* root, InputIterator first, InputIterator last, OutputIterator result) noexcept
+{
+    const size_t GROUP = 16;
+    const T* items[GROUP];
+    const T* nodes[GROUP];
+    const T* found[GROUP];
+
+    while (first != last)
+    {
+        // Start the next group of lookups from the root node
+        size_t count = 0;
+        for (; (count < GROUP) && (first != last); ++first, ++count)
+        {
+            items[count] = &*first;
+            nodes[count] = root;
+            found[count] = nullptr;
+        }
+
+        // Move each active lookup one level down per round and prefetch its next node
+        size_t active = count;
+        while (active > 0)
+        {
+            active = 0;
+            for (size_t i = 0; i < count; ++i)
+            {
+                const T* node = nodes[i];
+                if (node == nullptr)
+                    continue;
+
+                if (container.compare(*items[i], *node))
+                    node = node->left;
+                else if (container.compare(*node, *items[i]))
+                    node = node->right;
+                else
+                {
+                    found[i] = node;
+                    node = nullptr;
+                }
+
+                nodes[i] = node;
+                if (node != nullptr)
+                {
+                    Memory::Prefetch(node);
+                    ++active;
+                }
+            }
+        }
+
+        for (size_t i = 0; i < count; ++i)
+            *result++ = (TResult)found[i];
+    }
+
+    return result;
+}
+
+} // namespace Internals
+//! @endcond
+
 } // namespace CppCommon
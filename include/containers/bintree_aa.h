@@ -149,6 +149,40 @@ public:
     iterator upper_bound(const T& item) noexcept;
     const_iterator upper_bound(const T& item) const noexcept;
 
+    //! Find multiple items with interleaved lookups and software prefetch
+    /*!
+        Lookups are walked in groups of 16 items in an interleaved way: each
+        round moves every lookup of the group one level down and prefetches
+        its next node, so cache misses of independent lookups overlap instead
+        of being paid one after another.
+
+        \param first - The first iterator of items to find (forward iterator)
+        \param last - The last iterator of items to find
+        \param result - Output iterator of pointers to the first equal items (nullptr if the item is not found)
+        \return Output iterator past the last written pointer
+    */
+    template <class InputIterator, class OutputIterator>
+    OutputIterator find_batch(InputIterator first, InputIterator last, OutputIterator result) noexcept;
+    template <class InputIterator, class OutputIterator>
+    OutputIterator find_batch(InputIterator first, InputIterator last, OutputIterator result) const noexcept;
+
+    //! Call the given function for each binary tree item in order with software prefetch
+    /*!
+        Each descent to the leftmost node of a subtree prefetches right
+        children of passed nodes, which are visited after their left subtrees.
+        So cache misses of different subtrees overlap instead of being paid
+        one after another. The next in-order item is found before the function
+        call for the current one.
+
+        The function must not modify the binary tree.
+
+        \param fn - Function to call as fn(item)
+    */
+    template <class TFunction>
+    void for_each_prefetch(TFunction&& fn);
+    template <class TFunction>
+    void for_each_prefetch(TFunction&& fn) const;
+
     //! Insert a new item into the binary tree
     /*!
         \param item - Item to insert
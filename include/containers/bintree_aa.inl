@@ -231,6 +231,34 @@ inline typename BinTreeAA<T, TCompare>::const_iterator BinTreeAA<T, TCompare>::u
     return const_iterator(this, InternalUpperBound(item));
 }
 
+template <typename T, typename TCompare>
+template <class InputIterator, class OutputIterator>
+inline OutputIterator BinTreeAA<T, TCompare>::find_batch(InputIterator first, InputIterator last, OutputIterator result) noexcept
+{
+    return Internals::BinTreeFindBatch<T*>(*this, _root, first, last, result);
+}
+
+template <typename T, typename TCompare>
+template <class InputIterator, class OutputIterator>
+inline OutputIterator BinTreeAA<T, TCompare>::find_batch(InputIterator first, InputIterator last, OutputIterator result) const noexcept
+{
+    return Internals::BinTreeFindBatch<const T*>(*this, _root, first, last, result);
+}
+
+template <typename T, typename TCompare>
+template <class TFunction>
+inline void BinTreeAA<T, TCompare>::for_each_prefetch(TFunction&& fn)
+{
+    Internals::BinTreeForEachPrefetch(_root, fn);
+}
+
+template <typename T, typename TCompare>
+template <class TFunction>
+inline void BinTreeAA<T, TCompare>::for_each_prefetch(TFunction&& fn) const
+{
+    Internals::BinTreeForEachPrefetch((const T*)_root, fn);
+}
+
 template <typename T, typename TCompare>
 inline const T* BinTreeAA<T, TCompare>::InternalUpperBound(const T& item) const noexcept
 {
@@ -124,6 +124,18 @@ public:
         Node() : parent(nullptr), left(nullptr), right(nullptr), balance(0) {}
     };
 
+    //! AVL binary tree node with order statistics
+    /*!
+        Items with the subtree field get rank() and select() operations in O(log n).
+        Subtree sizes are maintained by inserts, erases and rotations.
+    */
+    struct RankNode : public Node
+    {
+        size_t subtree; //!< Count of nodes in the subtree rooted at this node
+
+        RankNode() : subtree(0) {}
+    };
+
     explicit BinTreeAVL(const TCompare& compare = TCompare()) noexcept
         : _compare(compare),
           _size(0),
@@ -189,6 +201,58 @@ public:
     iterator upper_bound(const T& item) noexcept;
     const_iterator upper_bound(const T& item) const noexcept;
 
+    //! Find multiple items with interleaved lookups and software prefetch
+    /*!
+        Lookups are walked in groups of 16 items in an interleaved way: each
+        round moves every lookup of the group one level down and prefetches
+        its next node, so cache misses of independent lookups overlap instead
+        of being paid one after another.
+
+        \param first - The first iterator of items to find (forward iterator)
+        \param last - The last iterator of items to find
+        \param result - Output iterator of pointers to the first equal items (nullptr if the item is not found)
+        \return Output iterator past the last written pointer
+    */
+    template <class InputIterator, class OutputIterator>
+    OutputIterator find_batch(InputIterator first, InputIterator last, OutputIterator result) noexcept;
+    template <class InputIterator, class OutputIterator>
+    OutputIterator find_batch(InputIterator first, InputIterator last, OutputIterator result) const noexcept;
+
+    //! Call the given function for each binary tree item in order with software prefetch
+    /*!
+        Each descent to the leftmost node of a subtree prefetches right
+        children of passed nodes, which are visited after their left subtrees.
+        So cache misses of different subtrees overlap instead of being paid
+        one after another. The next in-order item is found before the function
+        call for the current one.
+
+        The function must not modify the binary tree.
+
+        \param fn - Function to call as fn(item)
+    */
+    template <class TFunction>
+    void for_each_prefetch(TFunction&& fn);
+    template <class TFunction>
+    void for_each_prefetch(TFunction&& fn) const;
+
+    //! Get the rank of the given item (count of items less than the given one)
+    /*!
+        Available only for items with the subtree field (see RankNode).
+
+        \param item - Item to rank
+        \return Count of items in the binary tree less than the given one
+    */
+    size_t rank(const T& item) const noexcept;
+    //! Select the item with the given index in the sort order or return end iterator
+    /*!
+        Available only for items with the subtree field (see RankNode).
+
+        \param index - Zero-based index of the item in the sort order
+        \return Iterator to the selected item
+    */
+    iterator select(size_t index) noexcept;
+    const_iterator select(size_t index) const noexcept;
+
     //! Insert a new item into the binary tree
     /*!
         \param item - Item to insert
@@ -219,6 +283,35 @@ public:
     //! Clear the binary tree
     void clear() noexcept;
 
+    //! Build the binary tree from the sorted range of items
+    /*!
+        Previous items of the binary tree are forgotten like with clear().
+        Items in the range must be sorted in strictly increasing order.
+        The balanced binary tree is built in O(n) time without any rotations.
+
+        \param first - First item iterator
+        \param last - Last item iterator
+    */
+    template <class InputIterator>
+    void build_sorted(InputIterator first, InputIterator last) noexcept;
+
+    //! Split the binary tree moving all items not less than the given one into another binary tree
+    /*!
+        Another binary tree must be empty. Both binary trees are rebuilt in O(n) time.
+
+        \param item - Split item
+        \param bintree - Binary tree to receive items not less than the given one
+    */
+    void split(const T& item, BinTreeAVL& bintree) noexcept;
+    //! Join all items of another binary tree into the current one
+    /*!
+        Items equal to the existing ones are left in another binary tree.
+        The joined binary tree is rebuilt in O(n + m) time.
+
+        \param bintree - Binary tree to join
+    */
+    void join(BinTreeAVL& bintree) noexcept;
+
     //! Swap two instances
     void swap(BinTreeAVL& bintree) noexcept;
     template <typename U, typename UCompare>
@@ -241,6 +334,7 @@ private:
     static void RotateRightRight(T* node);
     static void Unlink(T* node);
     static void Swap(T*& node1, T*& node2);
+    void Rebuild(T* head, size_t count) noexcept;
 };
 
 } // namespace CppCommon
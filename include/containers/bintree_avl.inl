@@ -11,7 +11,7 @@ namespace CppCommon {
 template <typename T, typename TCompare>
 template <class InputIterator>
 inline BinTreeAVL<T, TCompare>::BinTreeAVL(InputIterator first, InputIterator last, const TCompare& compare) noexcept
-    : _compare(compare)
+    : _compare(compare), _size(0), _root(nullptr)
 {
     for (auto it = first; it != last; ++it)
         insert(*it);
@@ -231,6 +231,34 @@ inline typename BinTreeAVL<T, TCompare>::const_iterator BinTreeAVL<T, TCompare>:
     return const_iterator(this, InternalUpperBound(item));
 }
 
+template <typename T, typename TCompare>
+template <class InputIterator, class OutputIterator>
+inline OutputIterator BinTreeAVL<T, TCompare>::find_batch(InputIterator first, InputIterator last, OutputIterator result) noexcept
+{
+    return Internals::BinTreeFindBatch<T*>(*this, _root, first, last, result);
+}
+
+template <typename T, typename TCompare>
+template <class InputIterator, class OutputIterator>
+inline OutputIterator BinTreeAVL<T, TCompare>::find_batch(InputIterator first, InputIterator last, OutputIterator result) const noexcept
+{
+    return Internals::BinTreeFindBatch<const T*>(*this, _root, first, last, result);
+}
+
+template <typename T, typename TCompare>
+template <class TFunction>
+inline void BinTreeAVL<T, TCompare>::for_each_prefetch(TFunction&& fn)
+{
+    Internals::BinTreeForEachPrefetch(_root, fn);
+}
+
+template <typename T, typename TCompare>
+template <class TFunction>
+inline void BinTreeAVL<T, TCompare>::for_each_prefetch(TFunction&& fn) const
+{
+    Internals::BinTreeForEachPrefetch((const T*)_root, fn);
+}
+
 template <typename T, typename TCompare>
 inline const T* BinTreeAVL<T, TCompare>::InternalUpperBound(const T& item) const noexcept
 {
@@ -256,6 +284,30 @@ inline const T* BinTreeAVL<T, TCompare>::InternalUpperBound(const T& item) const
     return previous;
 }
 
+template <typename T, typename TCompare>
+inline size_t BinTreeAVL<T, TCompare>::rank(const T& item) const noexcept
+{
+    static_assert(Internals::BinTreeHasSubtree<T>::value, "Binary tree item must have the subtree field to use order statistics!");
+
+    return Internals::BinTreeRank(*this, (const T*)_root, item);
+}
+
+template <typename T, typename TCompare>
+inline typename BinTreeAVL<T, TCompare>::iterator BinTreeAVL<T, TCompare>::select(size_t index) noexcept
+{
+    static_assert(Internals::BinTreeHasSubtree<T>::value, "Binary tree item must have the subtree field to use order statistics!");
+
+    return iterator(this, (T*)Internals::BinTreeSelect((const T*)_root, index));
+}
+
+template <typename T, typename TCompare>
+inline typename BinTreeAVL<T, TCompare>::const_iterator BinTreeAVL<T, TCompare>::select(size_t index) const noexcept
+{
+    static_assert(Internals::BinTreeHasSubtree<T>::value, "Binary tree item must have the subtree field to use order statistics!");
+
+    return const_iterator(this, Internals::BinTreeSelect((const T*)_root, index));
+}
+
 template <typename T, typename TCompare>
 inline std::pair<typename BinTreeAVL<T, TCompare>::iterator, bool> BinTreeAVL<T, TCompare>::insert(T& item) noexcept
 {
@@ -313,6 +365,10 @@ inline std::pair<typename BinTreeAVL<T, TCompare>::iterator, bool> BinTreeAVL<T,
         _root = &item;
     ++_size;
 
+    // Update subtree sizes of all ancestors before rebalancing
+    Internals::BinTreeUpdateSubtree(&item);
+    Internals::BinTreeAdjustSubtree(current, true);
+
     // Balance the binary tree
     T* node = &item;
     node->balance = 0;
@@ -460,6 +516,9 @@ inline typename BinTreeAVL<T, TCompare>::iterator BinTreeAVL<T, TCompare>::erase
         }
     }
 
+    // Update subtree sizes of all ancestors before rebalancing
+    Internals::BinTreeAdjustSubtree(start, false);
+
     // Unlink the removed node
     if (start != nullptr)
         Unlink(start);
@@ -502,6 +561,10 @@ inline void BinTreeAVL<T, TCompare>::RotateLeft(T* node)
     if (node->right != nullptr)
         node->right->parent = node;
 
+    // Update subtree sizes of rotated nodes
+    Internals::BinTreeUpdateSubtree(node);
+    Internals::BinTreeUpdateSubtree(current);
+
     if (current->balance == 0)
     {
         node->balance = 1;
@@ -538,6 +601,10 @@ inline void BinTreeAVL<T, TCompare>::RotateRight(T* node)
     if (node->left != nullptr)
         node->left->parent = node;
 
+    // Update subtree sizes of rotated nodes
+    Internals::BinTreeUpdateSubtree(node);
+    Internals::BinTreeUpdateSubtree(current);
+
     if (current->balance == 0)
     {
         node->balance = -1;
@@ -578,6 +645,11 @@ inline void BinTreeAVL<T, TCompare>::RotateLeftLeft(T* node)
     if (node->left != nullptr)
         node->left->parent = node;
 
+    // Update subtree sizes of rotated nodes
+    Internals::BinTreeUpdateSubtree(node);
+    Internals::BinTreeUpdateSubtree(current);
+    Internals::BinTreeUpdateSubtree(next);
+
     switch (next->balance)
     {
         case -1:
@@ -624,6 +696,11 @@ inline void BinTreeAVL<T, TCompare>::RotateRightRight(T* node)
     if (current->left != nullptr)
         current->left->parent = current;
 
+    // Update subtree sizes of rotated nodes
+    Internals::BinTreeUpdateSubtree(node);
+    Internals::BinTreeUpdateSubtree(current);
+    Internals::BinTreeUpdateSubtree(next);
+
     switch (next->balance)
     {
         case -1:
@@ -785,6 +862,8 @@ inline void BinTreeAVL<T, TCompare>::Swap(T*& node1, T*& node2)
     std::swap(node1->left, node2->left);
     std::swap(node1->right, node2->right);
     std::swap(node1->balance, node2->balance);
+    if constexpr (Internals::BinTreeHasSubtree<T>::value)
+        std::swap(node1->subtree, node2->subtree);
 
     // Swap nodes
     std::swap(node1, node2);
@@ -797,6 +876,73 @@ inline void BinTreeAVL<T, TCompare>::clear() noexcept
     _root = nullptr;
 }
 
+template <typename T, typename TCompare>
+template <class InputIterator>
+inline void BinTreeAVL<T, TCompare>::build_sorted(InputIterator first, InputIterator last) noexcept
+{
+    // Link items into the sorted list by right pointers
+    T* head = nullptr;
+    T** link = &head;
+    T* previous = nullptr;
+    size_t count = 0;
+    for (auto it = first; it != last; ++it)
+    {
+        T* node = &(*it);
+        assert(((previous == nullptr) || compare(*previous, *node)) && "Items must be sorted in strictly increasing order!");
+        *link = node;
+        link = &node->right;
+        previous = node;
+        ++count;
+    }
+    *link = nullptr;
+
+    Rebuild(head, count);
+}
+
+template <typename T, typename TCompare>
+inline void BinTreeAVL<T, TCompare>::split(const T& item, BinTreeAVL& bintree) noexcept
+{
+    assert(bintree.empty() && "Binary tree to receive split items must be empty!");
+    if (!bintree.empty())
+        return;
+
+    size_t count;
+    size_t size = _size;
+    T* head = Internals::BinTreeFlatten(_root);
+    T* tail = Internals::BinTreeSplitList(*this, head, item, count);
+
+    Rebuild(head, count);
+    bintree.Rebuild(tail, size - count);
+}
+
+template <typename T, typename TCompare>
+inline void BinTreeAVL<T, TCompare>::join(BinTreeAVL& bintree) noexcept
+{
+    if ((this == &bintree) || bintree.empty())
+        return;
+
+    size_t count;
+    size_t duplicates_count;
+    T* duplicates = nullptr;
+    T* head1 = Internals::BinTreeFlatten(_root);
+    T* head2 = Internals::BinTreeFlatten(bintree._root);
+    T* head = Internals::BinTreeMergeList(*this, head1, head2, duplicates, count, duplicates_count);
+
+    Rebuild(head, count);
+    bintree.Rebuild(duplicates, duplicates_count);
+}
+
+template <typename T, typename TCompare>
+inline void BinTreeAVL<T, TCompare>::Rebuild(T* head, size_t count) noexcept
+{
+    size_t height;
+    _size = count;
+    _root = Internals::BinTreeBuild(head, count, 0, height, [](T* node, size_t, size_t left_height, size_t right_height)
+    {
+        node->balance = (signed char)((int)right_height - (int)left_height);
+    });
+}
+
 template <typename T, typename TCompare>
 inline void BinTreeAVL<T, TCompare>::swap(BinTreeAVL& bintree) noexcept
 {
@@ -11,7 +11,7 @@ namespace CppCommon {
 template <typename T, typename TCompare>
 template <class InputIterator>
 inline BinTreeRB<T, TCompare>::BinTreeRB(InputIterator first, InputIterator last, const TCompare& compare) noexcept
-    : _compare(compare)
+    : _compare(compare), _size(0), _root(nullptr)
 {
     for (auto it = first; it != last; ++it)
         insert(*it);
@@ -231,6 +231,34 @@ inline typename BinTreeRB<T, TCompare>::const_iterator BinTreeRB<T, TCompare>::u
     return const_iterator(this, InternalUpperBound(item));
 }
 
+template <typename T, typename TCompare>
+template <class InputIterator, class OutputIterator>
+inline OutputIterator BinTreeRB<T, TCompare>::find_batch(InputIterator first, InputIterator last, OutputIterator result) noexcept
+{
+    return Internals::BinTreeFindBatch<T*>(*this, _root, first, last, result);
+}
+
+template <typename T, typename TCompare>
+template <class InputIterator, class OutputIterator>
+inline OutputIterator BinTreeRB<T, TCompare>::find_batch(InputIterator first, InputIterator last, OutputIterator result) const noexcept
+{
+    return Internals::BinTreeFindBatch<const T*>(*this, _root, first, last, result);
+}
+
+template <typename T, typename TCompare>
+template <class TFunction>
+inline void BinTreeRB<T, TCompare>::for_each_prefetch(TFunction&& fn)
+{
+    Internals::BinTreeForEachPrefetch(_root, fn);
+}
+
+template <typename T, typename TCompare>
+template <class TFunction>
+inline void BinTreeRB<T, TCompare>::for_each_prefetch(TFunction&& fn) const
+{
+    Internals::BinTreeForEachPrefetch((const T*)_root, fn);
+}
+
 template <typename T, typename TCompare>
 inline const T* BinTreeRB<T, TCompare>::InternalUpperBound(const T& item) const noexcept
 {
@@ -256,6 +284,30 @@ inline const T* BinTreeRB<T, TCompare>::InternalUpperBound(const T& item) const
     return previous;
 }
 
+template <typename T, typename TCompare>
+inline size_t BinTreeRB<T, TCompare>::rank(const T& item) const noexcept
+{
+    static_assert(Internals::BinTreeHasSubtree<T>::value, "Binary tree item must have the subtree field to use order statistics!");
+
+    return Internals::BinTreeRank(*this, (const T*)_root, item);
+}
+
+template <typename T, typename TCompare>
+inline typename BinTreeRB<T, TCompare>::iterator BinTreeRB<T, TCompare>::select(size_t index) noexcept
+{
+    static_assert(Internals::BinTreeHasSubtree<T>::value, "Binary tree item must have the subtree field to use order statistics!");
+
+    return iterator(this, (T*)Internals::BinTreeSelect((const T*)_root, index));
+}
+
+template <typename T, typename TCompare>
+inline typename BinTreeRB<T, TCompare>::const_iterator BinTreeRB<T, TCompare>::select(size_t index) const noexcept
+{
+    static_assert(Internals::BinTreeHasSubtree<T>::value, "Binary tree item must have the subtree field to use order statistics!");
+
+    return const_iterator(this, Internals::BinTreeSelect((const T*)_root, index));
+}
+
 template <typename T, typename TCompare>
 inline std::pair<typename BinTreeRB<T, TCompare>::iterator, bool> BinTreeRB<T, TCompare>::insert(T& item) noexcept
 {
@@ -313,6 +365,10 @@ inline std::pair<typename BinTreeRB<T, TCompare>::iterator, bool> BinTreeRB<T, T
         _root = &item;
     ++_size;
 
+    // Update subtree sizes of all ancestors before rebalancing
+    Internals::BinTreeUpdateSubtree(&item);
+    Internals::BinTreeAdjustSubtree(current, true);
+
     // Balance the binary tree
     T* node = &item;
     // Set red color for new red-black balanced binary tree node
@@ -438,6 +494,9 @@ inline typename BinTreeRB<T, TCompare>::iterator BinTreeRB<T, TCompare>::erase(c
     else
         _root = x;
 
+    // Update subtree sizes of all ancestors before rebalancing
+    Internals::BinTreeAdjustSubtree(y->parent, false);
+
     // Unlink given node
     if (!y->rb)
         Unlink(x, y->parent);
@@ -474,6 +533,9 @@ inline void BinTreeRB<T, TCompare>::RotateLeft(T* node)
     // Link node and current
     current->left = node;
     node->parent = current;
+    // Update subtree sizes of rotated nodes
+    Internals::BinTreeUpdateSubtree(node);
+    Internals::BinTreeUpdateSubtree(current);
 }
 
 template <typename T, typename TCompare>
@@ -501,6 +563,9 @@ inline void BinTreeRB<T, TCompare>::RotateRight(T* node)
     // Link node and current
     current->right = node;
     node->parent = current;
+    // Update subtree sizes of rotated nodes
+    Internals::BinTreeUpdateSubtree(node);
+    Internals::BinTreeUpdateSubtree(current);
 }
 
 template <typename T, typename TCompare>
@@ -638,7 +703,9 @@ inline void BinTreeRB<T, TCompare>::Swap(T*& node1, T*& node2)
     std::swap(node1->parent, node2->parent);
     std::swap(node1->left, node2->left);
     std::swap(node1->right, node2->right);
-    std::swap(node1->balance, node2->balance);
+    std::swap(node1->rb, node2->rb);
+    if constexpr (Internals::BinTreeHasSubtree<T>::value)
+        std::swap(node1->subtree, node2->subtree);
 
     // Swap nodes
     std::swap(node1, node2);
@@ -651,6 +718,78 @@ inline void BinTreeRB<T, TCompare>::clear() noexcept
     _root = nullptr;
 }
 
+template <typename T, typename TCompare>
+template <class InputIterator>
+inline void BinTreeRB<T, TCompare>::build_sorted(InputIterator first, InputIterator last) noexcept
+{
+    // Link items into the sorted list by right pointers
+    T* head = nullptr;
+    T** link = &head;
+    T* previous = nullptr;
+    size_t count = 0;
+    for (auto it = first; it != last; ++it)
+    {
+        T* node = &(*it);
+        assert(((previous == nullptr) || compare(*previous, *node)) && "Items must be sorted in strictly increasing order!");
+        *link = node;
+        link = &node->right;
+        previous = node;
+        ++count;
+    }
+    *link = nullptr;
+
+    Rebuild(head, count);
+}
+
+template <typename T, typename TCompare>
+inline void BinTreeRB<T, TCompare>::split(const T& item, BinTreeRB& bintree) noexcept
+{
+    assert(bintree.empty() && "Binary tree to receive split items must be empty!");
+    if (!bintree.empty())
+        return;
+
+    size_t count;
+    size_t size = _size;
+    T* head = Internals::BinTreeFlatten(_root);
+    T* tail = Internals::BinTreeSplitList(*this, head, item, count);
+
+    Rebuild(head, count);
+    bintree.Rebuild(tail, size - count);
+}
+
+template <typename T, typename TCompare>
+inline void BinTreeRB<T, TCompare>::join(BinTreeRB& bintree) noexcept
+{
+    if ((this == &bintree) || bintree.empty())
+        return;
+
+    size_t count;
+    size_t duplicates_count;
+    T* duplicates = nullptr;
+    T* head1 = Internals::BinTreeFlatten(_root);
+    T* head2 = Internals::BinTreeFlatten(bintree._root);
+    T* head = Internals::BinTreeMergeList(*this, head1, head2, duplicates, count, duplicates_count);
+
+    Rebuild(head, count);
+    bintree.Rebuild(duplicates, duplicates_count);
+}
+
+template <typename T, typename TCompare>
+inline void BinTreeRB<T, TCompare>::Rebuild(T* head, size_t count) noexcept
+{
+    // Nodes of the last incomplete level are red, all others are black
+    size_t red = 0;
+    while (((size_t)1 << (red + 1)) <= (count + 1))
+        ++red;
+
+    size_t height;
+    _size = count;
+    _root = Internals::BinTreeBuild(head, count, 0, height, [red](T* node, size_t depth, size_t, size_t)
+    {
+        node->rb = (depth == red);
+    });
+}
+
 template <typename T, typename TCompare>
 inline void BinTreeRB<T, TCompare>::swap(BinTreeRB& bintree) noexcept
 {
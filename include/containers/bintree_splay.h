@@ -286,6 +286,23 @@ public:
     iterator upper_bound(const T& item) noexcept;
     const_iterator upper_bound(const T& item) const noexcept;
 
+    //! Call the given function for each binary tree item in order with software prefetch
+    /*!
+        Each descent to the leftmost node of a subtree prefetches right
+        children of passed nodes, which are visited after their left subtrees.
+        So cache misses of different subtrees overlap instead of being paid
+        one after another. The next in-order item is found before the function
+        call for the current one.
+
+        The function must not modify the binary tree.
+
+        \param fn - Function to call as fn(item)
+    */
+    template <class TFunction>
+    void for_each_prefetch(TFunction&& fn);
+    template <class TFunction>
+    void for_each_prefetch(TFunction&& fn) const;
+
     //! Insert a new item into the binary tree
     /*!
         \param item - Item to insert
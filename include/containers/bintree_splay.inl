@@ -250,6 +250,20 @@ inline typename BinTreeSplay<T, TCompare>::const_iterator BinTreeSplay<T, TCompa
     return const_iterator(this, InternalUpperBound(item));
 }
 
+template <typename T, typename TCompare>
+template <class TFunction>
+inline void BinTreeSplay<T, TCompare>::for_each_prefetch(TFunction&& fn)
+{
+    Internals::BinTreeForEachPrefetch(_root, fn);
+}
+
+template <typename T, typename TCompare>
+template <class TFunction>
+inline void BinTreeSplay<T, TCompare>::for_each_prefetch(TFunction&& fn) const
+{
+    Internals::BinTreeForEachPrefetch((const T*)_root, fn);
+}
+
 template <typename T, typename TCompare>
 inline const T* BinTreeSplay<T, TCompare>::InternalUpperBound(const T& item) const noexcept
 {
@@ -0,0 +1,162 @@
+/*!
+    \file bloom_filter.h
+    \brief Blocked Bloom filter container definition
+    \author Ivan Shynkarenka
+    \date 15.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_CONTAINERS_BLOOM_FILTER_H
+#define CPPCOMMON_CONTAINERS_BLOOM_FILTER_H
+
+#include "algorithms/hash.h"
+#include "common/writer.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace CppCommon {
+
+//! Blocked Bloom filter container
+/*!
+    Bloom filter answers whether the key was possibly added or was definitely
+    not added, so expensive lookups of missing keys (disk, network, caches)
+    could be skipped. False positives are possible, false negatives are not.
+
+    Blocked Bloom filter keeps all bits of the key in the single cache line
+    sized block (8 x 64-bit words, one bit per word), so each operation costs
+    a single cache miss. Bit masks are calculated and tested with AVX2 when it
+    is supported by the CPU. Blocked layout costs slightly more bits than the
+    classic Bloom filter for the same false positive probability.
+
+    Keys are hashed with THash (FastHash by default), the hash is additionally
+    mixed, so weak hashers are also supported.
+
+    Filter could be serialized into File (or any other Writer) and deserialized
+    from the memory buffer (e.g. MappedFile::bytes()) with a single copy of its
+    blocks.
+
+    Not thread-safe, except AddConcurrent() and ContainsConcurrent() methods
+    which could be called from several threads at once.
+
+    https://en.wikipedia.org/wiki/Bloom_filter
+*/
+class BloomFilter
+{
+public:
+    //! Block size in bytes
+    static const size_t BLOCK_SIZE = 64;
+
+    //! Initialize the Bloom filter for the given count of keys
+    /*!
+        \param capacity - Expected count of keys (default is 1024)
+        \param probability - Desired false positive probability (default is 0.01)
+    */
+    explicit BloomFilter(size_t capacity = 1024, double probability = 0.01);
+    BloomFilter(const BloomFilter& filter);
+    BloomFilter(BloomFilter&& filter) noexcept;
+    ~BloomFilter() = default;
+
+    BloomFilter& operator=(const BloomFilter& filter);
+    BloomFilter& operator=(BloomFilter&& filter) noexcept;
+
+    //! Check if the Bloom filter is not empty
+    explicit operator bool() const noexcept { return !empty(); }
+
+    //! Is the Bloom filter empty?
+    bool empty() const noexcept { return (count() == 0); }
+
+    //! Get the count of blocks
+    size_t blocks() const noexcept { return _blocks.size(); }
+    //! Get the Bloom filter size in bytes
+    size_t bytes() const noexcept { return _blocks.size() * BLOCK_SIZE; }
+    //! Get the count of added keys (including duplicates)
+    uint64_t count() const noexcept { return _count.load(std::memory_order_relaxed); }
+
+    //! Add the given key
+    template <typename TKey, typename THash = FastHash<TKey>>
+    void Add(const TKey& key, const THash& hash = THash()) noexcept
+    { AddHash((uint64_t)hash(key)); }
+    //! Add the given key (thread-safe)
+    template <typename TKey, typename THash = FastHash<TKey>>
+    void AddConcurrent(const TKey& key, const THash& hash = THash()) noexcept
+    { AddHashConcurrent((uint64_t)hash(key)); }
+
+    //! Check if the given key was possibly added
+    /*!
+        \param key - Key to check
+        \param hash - Key hasher (default is THash())
+        \return 'false' if the key was definitely not added, 'true' if it was possibly added
+    */
+    template <typename TKey, typename THash = FastHash<TKey>>
+    bool Contains(const TKey& key, const THash& hash = THash()) const noexcept
+    { return ContainsHash((uint64_t)hash(key)); }
+    //! Check if the given key was possibly added (thread-safe)
+    template <typename TKey, typename THash = FastHash<TKey>>
+    bool ContainsConcurrent(const TKey& key, const THash& hash = THash()) const noexcept
+    { return ContainsHashConcurrent((uint64_t)hash(key)); }
+
+    //! Add the key with the given hash value
+    void AddHash(uint64_t hash) noexcept;
+    //! Add the key with the given hash value (thread-safe)
+    void AddHashConcurrent(uint64_t hash) noexcept;
+    //! Check if the key with the given hash value was possibly added
+    bool ContainsHash(uint64_t hash) const noexcept;
+    //! Check if the key with the given hash value was possibly added (thread-safe)
+    bool ContainsHashConcurrent(uint64_t hash) const noexcept;
+
+    //! Merge keys of the given Bloom filter
+    /*!
+        \param filter - Bloom filter to merge
+        \return 'true' if the Bloom filter was merged, 'false' if it has the different count of blocks
+    */
+    bool Merge(const BloomFilter& filter) noexcept;
+
+    //! Clear all keys
+    void Clear() noexcept;
+
+    //! Serialize the Bloom filter
+    /*!
+        \return Serialized bytes
+    */
+    std::vector<uint8_t> Serialize() const;
+    //! Serialize the Bloom filter into the given writer (e.g. File)
+    /*!
+        \param writer - Writer to serialize into
+    */
+    void Serialize(Writer& writer) const;
+    //! Deserialize the Bloom filter
+    /*!
+        \param buffer - Buffer to deserialize (e.g. MappedFile::bytes())
+        \param filter - Deserialized Bloom filter
+        \return Count of deserialized bytes or 0 if the buffer is truncated or malformed
+    */
+    static size_t Deserialize(std::span<const uint8_t> buffer, BloomFilter& filter);
+
+    //! Swap two instances
+    void swap(BloomFilter& filter) noexcept;
+    friend void swap(BloomFilter& filter1, BloomFilter& filter2) noexcept
+    { filter1.swap(filter2); }
+
+private:
+    struct alignas(BLOCK_SIZE) Block
+    {
+        uint64_t words[8];
+    };
+
+    std::vector<Block> _blocks;
+    std::atomic<uint64_t> _count;
+
+    //! Get the block of the given hash value
+    size_t Index(uint64_t hash) const noexcept
+    { return (size_t)(((hash >> 32) * (uint64_t)_blocks.size()) >> 32); }
+};
+
+/*! \example containers_bloom_filter.cpp Bloom filter container example */
+
+} // namespace CppCommon
+
+#endif // CPPCOMMON_CONTAINERS_BLOOM_FILTER_H
@@ -0,0 +1,506 @@
+/*!
+    \file btree.h
+    \brief B+ tree container definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_CONTAINERS_BTREE_H
+#define CPPCOMMON_CONTAINERS_BTREE_H
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <utility>
+
+namespace CppCommon {
+
+template <class TContainer, typename T>
+class BTreeIterator;
+template <class TContainer, typename T>
+class BTreeConstIterator;
+template <class TContainer, typename T>
+class BTreeReverseIterator;
+template <class TContainer, typename T>
+class BTreeConstReverseIterator;
+
+//! B+ tree container
+/*!
+    B+ tree is a cache-friendly alternative to node-per-element binary trees for
+    ordered sets of items. Items are stored by value in leaf nodes sized to a few
+    cache lines, so each lookup touches only O(log(B, N)) nodes and in-order
+    iteration walks contiguous arrays of items through the linked list of leaves.
+
+    Inner nodes keep copies of separator items, so T must be copyable. Nodes are
+    allocated with the given allocator rebound to the node types, so the tree is
+    compatible with Allocator<T, TMemoryManager> from the memory module.
+
+    Unlike intrusive binary trees any insert or erase operation may  invalidate
+    iterators and pointers to items of the B+ tree.
+
+    Not thread-safe.
+
+    <b>Taken from:</b>\n
+    B+ tree from Wikipedia, the free encyclopedia
+    https://en.wikipedia.org/wiki/B%2B_tree
+*/
+template <typename T, typename TCompare = std::less<T>, typename TAllocator = std::allocator<T>>
+class BTree
+{
+    friend BTreeIterator<BTree<T, TCompare, TAllocator>, T>;
+    friend BTreeConstIterator<BTree<T, TCompare, TAllocator>, T>;
+    friend BTreeReverseIterator<BTree<T, TCompare, TAllocator>, T>;
+    friend BTreeConstReverseIterator<BTree<T, TCompare, TAllocator>, T>;
+
+public:
+    // Standard container type definitions
+    typedef T value_type;
+    typedef TCompare value_compare;
+    typedef TAllocator allocator_type;
+    typedef value_type& reference;
+    typedef const value_type& const_reference;
+    typedef value_type* pointer;
+    typedef const value_type* const_pointer;
+    typedef ptrdiff_t difference_type;
+    typedef size_t size_type;
+    typedef BTreeIterator<BTree<T, TCompare, TAllocator>, T> iterator;
+    typedef BTreeConstIterator<BTree<T, TCompare, TAllocator>, T> const_iterator;
+    typedef BTreeReverseIterator<BTree<T, TCompare, TAllocator>, T> reverse_iterator;
+    typedef BTreeConstReverseIterator<BTree<T, TCompare, TAllocator>, T> const_reverse_iterator;
+
+    //! Target size of the B+ tree node in bytes
+    static constexpr size_t NODE_SIZE = 256;
+
+    //! Initialize the B+ tree with a given comparator and allocator
+    /*!
+        \param compare - Items comparator (default is TCompare())
+        \param allocator - Allocator (default is TAllocator())
+    */
+    explicit BTree(const TCompare& compare = TCompare(), const TAllocator& allocator = TAllocator());
+    template <class InputIterator>
+    BTree(InputIterator first, InputIterator last, const TCompare& compare = TCompare(), const TAllocator& allocator = TAllocator());
+    BTree(const BTree& btree);
+    BTree(BTree&& btree) noexcept;
+    ~BTree() { clear(); }
+
+    BTree& operator=(const BTree& btree);
+    BTree& operator=(BTree&& btree) noexcept;
+
+    //! Check if the B+ tree is not empty
+    explicit operator bool() const noexcept { return !empty(); }
+
+    //! Is the B+ tree empty?
+    bool empty() const noexcept { return _size == 0; }
+
+    //! Get the B+ tree size
+    size_t size() const noexcept { return _size; }
+    //! Get the B+ tree height (0 for the empty tree, 1 for the single leaf)
+    size_t height() const noexcept { return _height; }
+
+    //! Get the lowest B+ tree item
+    T* lowest() noexcept;
+    const T* lowest() const noexcept;
+    //! Get the highest B+ tree item
+    T* highest() noexcept;
+    const T* highest() const noexcept;
+
+    //! Compare two items: if the first item is less than the second one?
+    bool compare(const T& item1, const T& item2) const noexcept { return _compare(item1, item2); }
+
+    //! Get the begin B+ tree iterator
+    iterator begin() noexcept;
+    const_iterator begin() const noexcept;
+    const_iterator cbegin() const noexcept;
+    //! Get the end B+ tree iterator
+    iterator end() noexcept;
+    const_iterator end() const noexcept;
+    const_iterator cend() const noexcept;
+
+    //! Get the reverse begin B+ tree iterator
+    reverse_iterator rbegin() noexcept;
+    const_reverse_iterator rbegin() const noexcept;
+    const_reverse_iterator crbegin() const noexcept;
+    //! Get the reverse end B+ tree iterator
+    reverse_iterator rend() noexcept;
+    const_reverse_iterator rend() const noexcept;
+    const_reverse_iterator crend() const noexcept;
+
+    //! Find the iterator which points to the first equal item in the B+ tree or return end iterator
+    iterator find(const T& item) noexcept;
+    const_iterator find(const T& item) const noexcept;
+
+    //! Find the iterator which points to the first item that not less than the given item in the B+ tree or return end iterator
+    iterator lower_bound(const T& item) noexcept;
+    const_iterator lower_bound(const T& item) const noexcept;
+    //! Find the iterator which points to the first item that greater than the given item in the B+ tree or return end iterator
+    iterator upper_bound(const T& item) noexcept;
+    const_iterator upper_bound(const T& item) const noexcept;
+
+    //! Insert a new item into the B+ tree
+    /*!
+        \param item - Item to insert
+        \return Pair with the iterator to the inserted item and success flag
+    */
+    std::pair<iterator, bool> insert(const T& item);
+    //! Insert a new item into the B+ tree
+    /*!
+        \param item - Item to insert
+        \return Pair with the iterator to the inserted item and success flag
+    */
+    std::pair<iterator, bool> insert(T&& item);
+
+    //! Emplace a new item into the B+ tree
+    /*!
+        \param args - Arguments to emplace
+        \return Pair with the iterator to the emplaced item and success flag
+    */
+    template <typename... Args>
+    std::pair<iterator, bool> emplace(Args&&... args);
+
+    //! Erase the given item from the B+ tree
+    /*!
+        \param item - Item to erase
+        \return Number of erased items (0 or 1 for the B+ tree)
+    */
+    size_t erase(const T& item);
+    //! Erase the item by its iterator from the B+ tree
+    /*!
+        \param it - Iterator to the erased item
+        \return Iterator pointing to the item following the erased one
+    */
+    iterator erase(const const_iterator& it);
+
+    //! Clear the B+ tree
+    void clear() noexcept;
+
+    //! Swap two instances
+    void swap(BTree& btree) noexcept;
+    template <typename U, typename UCompare, typename UAllocator>
+    friend void swap(BTree<U, UCompare, UAllocator>& btree1, BTree<U, UCompare, UAllocator>& btree2) noexcept;
+
+private:
+    // B+ tree node capacities calculated from the target node size
+    static constexpr size_t LEAF_CAPACITY = std::max<size_t>(4, (NODE_SIZE - 4 * sizeof(void*)) / sizeof(T));
+    static constexpr size_t INNER_CAPACITY = std::max<size_t>(4, (NODE_SIZE - 2 * sizeof(void*)) / (sizeof(T) + sizeof(void*)));
+    static constexpr size_t LEAF_MIN = LEAF_CAPACITY / 2;
+    static constexpr size_t INNER_MIN = INNER_CAPACITY / 2;
+    static constexpr size_t MAX_HEIGHT = 64;
+
+    // B+ tree node
+    struct Node
+    {
+        size_t count;
+        bool leaf;
+
+        explicit Node(bool is_leaf) noexcept : count(0), leaf(is_leaf) {}
+    };
+
+    // B+ tree leaf node with items and links to sibling leaves
+    struct Leaf : public Node
+    {
+        Leaf* prev;
+        Leaf* next;
+        alignas(T) unsigned char storage[LEAF_CAPACITY * sizeof(T)];
+
+        Leaf() noexcept : Node(true), prev(nullptr), next(nullptr) {}
+        T* items() noexcept { return reinterpret_cast<T*>(storage); }
+        const T* items() const noexcept { return reinterpret_cast<const T*>(storage); }
+    };
+
+    // B+ tree inner node with separator items and children
+    struct Inner : public Node
+    {
+        Node* children[INNER_CAPACITY + 1];
+        alignas(T) unsigned char storage[INNER_CAPACITY * sizeof(T)];
+
+        Inner() noexcept : Node(false) {}
+        T* keys() noexcept { return reinterpret_cast<T*>(storage); }
+        const T* keys() const noexcept { return reinterpret_cast<const T*>(storage); }
+    };
+
+    // B+ tree path step from the root to the leaf
+    struct Step
+    {
+        Inner* node;
+        size_t index;
+    };
+
+    typedef typename std::allocator_traits<TAllocator>::template rebind_alloc<Leaf> leaf_allocator;
+    typedef typename std::allocator_traits<TAllocator>::template rebind_alloc<Inner> inner_allocator;
+
+    TCompare _compare;      // B+ tree items comparator
+    TAllocator _allocator;  // B+ tree allocator
+    size_t _size;           // B+ tree size
+    size_t _height;         // B+ tree height
+    Node* _root;            // B+ tree root node
+    Leaf* _first;           // B+ tree first leaf
+    Leaf* _last;            // B+ tree last leaf
+
+    Leaf* CreateLeaf();
+    Inner* CreateInner();
+    void ReleaseLeaf(Leaf* leaf) noexcept;
+    void ReleaseInner(Inner* inner) noexcept;
+    void ReleaseNode(Node* node) noexcept;
+
+    size_t LeafLowerBound(const Leaf* leaf, const T& item) const noexcept;
+    size_t LeafUpperBound(const Leaf* leaf, const T& item) const noexcept;
+    size_t InnerUpperBound(const Inner* inner, const T& item) const noexcept;
+    const Leaf* FindLeaf(const T& item, Step* path) const noexcept;
+
+    std::pair<const Leaf*, size_t> InternalLowerBound(const T& item) const noexcept;
+    std::pair<const Leaf*, size_t> InternalUpperBound(const T& item) const noexcept;
+    std::pair<iterator, bool> InternalInsert(T&& item);
+    void InternalInsertParent(Step* path, size_t depth, T&& key, Node* child);
+    void InternalRebalanceLeaf(Step* path, size_t depth, Leaf* leaf) noexcept;
+    void InternalRebalanceInner(Step* path, size_t depth, Inner* inner) noexcept;
+
+    static void InsertAt(T* items, size_t count, size_t index, T&& item);
+    static void RemoveAt(T* items, size_t count, size_t index) noexcept;
+    static void MoveTo(T* source, size_t count, T* destination) noexcept;
+};
+
+//! B+ tree iterator
+/*!
+    Not thread-safe.
+*/
+template <class TContainer, typename T>
+class BTreeIterator
+{
+    friend TContainer;
+    friend BTreeConstIterator<TContainer, T>;
+
+public:
+    // Standard iterator type definitions
+    typedef T value_type;
+    typedef value_type& reference;
+    typedef const value_type& const_reference;
+    typedef value_type* pointer;
+    typedef const value_type* const_pointer;
+    typedef ptrdiff_t difference_type;
+    typedef size_t size_type;
+    typedef std::forward_iterator_tag iterator_category;
+
+    BTreeIterator() noexcept : _container(nullptr), _node(nullptr), _index(0) {}
+    explicit BTreeIterator(TContainer* container, typename TContainer::Leaf* node, size_t index) noexcept : _container(container), _node(node), _index(index) {}
+    BTreeIterator(const BTreeIterator& it) noexcept = default;
+    BTreeIterator(BTreeIterator&& it) noexcept = default;
+    ~BTreeIterator() noexcept = default;
+
+    BTreeIterator& operator=(const BTreeIterator& it) noexcept = default;
+    BTreeIterator& operator=(BTreeIterator&& it) noexcept = default;
+
+    friend bool operator==(const BTreeIterator& it1, const BTreeIterator& it2) noexcept
+    { return (it1._container == it2._container) && (it1._node == it2._node) && (it1._index == it2._index); }
+    friend bool operator!=(const BTreeIterator& it1, const BTreeIterator& it2) noexcept
+    { return !(it1 == it2); }
+
+    BTreeIterator& operator++() noexcept;
+    BTreeIterator operator++(int) noexcept;
+
+    reference operator*() noexcept;
+    pointer operator->() noexcept;
+
+    //! Check if the iterator is valid
+    explicit operator bool() const noexcept { return (_container != nullptr) && (_node != nullptr); }
+
+    //! Compare two items: if the first item is less than the second one?
+    bool compare(const T& item1, const T& item2) const noexcept { return (_container != nullptr) ? _container->compare(item1, item2) : false; }
+
+    //! Swap two instances
+    void swap(BTreeIterator& it) noexcept;
+    template <class UContainer, typename U>
+    friend void swap(BTreeIterator<UContainer, U>& it1, BTreeIterator<UContainer, U>& it2) noexcept;
+
+private:
+    TContainer* _container;
+    typename TContainer::Leaf* _node;
+    size_t _index;
+};
+
+//! B+ tree constant iterator
+/*!
+    Not thread-safe.
+*/
+template <class TContainer, typename T>
+class BTreeConstIterator
+{
+    friend TContainer;
+
+public:
+    // Standard iterator type definitions
+    typedef T value_type;
+    typedef value_type& reference;
+    typedef const value_type& const_reference;
+    typedef value_type* pointer;
+    typedef const value_type* const_pointer;
+    typedef ptrdiff_t difference_type;
+    typedef size_t size_type;
+    typedef std::forward_iterator_tag iterator_category;
+
+    BTreeConstIterator() noexcept : _container(nullptr), _node(nullptr), _index(0) {}
+    explicit BTreeConstIterator(const TContainer* container, const typename TContainer::Leaf* node, size_t index) noexcept : _container(container), _node(node), _index(index) {}
+    BTreeConstIterator(const BTreeIterator<TContainer, T>& it) noexcept : _container(it._container), _node(it._node), _index(it._index) {}
+    BTreeConstIterator(const BTreeConstIterator& it) noexcept = default;
+    BTreeConstIterator(BTreeConstIterator&& it) noexcept = default;
+    ~BTreeConstIterator() noexcept = default;
+
+    BTreeConstIterator& operator=(const BTreeIterator<TContainer, T>& it) noexcept
+    { _container = it._container; _node = it._node; _index = it._index; return *this; }
+    BTreeConstIterator& operator=(const BTreeConstIterator& it) noexcept = default;
+    BTreeConstIterator& operator=(BTreeConstIterator&& it) noexcept = default;
+
+    friend bool operator==(const BTreeConstIterator& it1, const BTreeConstIterator& it2) noexcept
+    { return (it1._container == it2._container) && (it1._node == it2._node) && (it1._index == it2._index); }
+    friend bool operator!=(const BTreeConstIterator& it1, const BTreeConstIterator& it2) noexcept
+    { return !(it1 == it2); }
+
+    BTreeConstIterator& operator++() noexcept;
+    BTreeConstIterator operator++(int) noexcept;
+
+    const_reference operator*() const noexcept;
+    const_pointer operator->() const noexcept;
+
+    //! Check if the iterator is valid
+    explicit operator bool() const noexcept { return (_container != nullptr) && (_node != nullptr); }
+
+    //! Compare two items: if the first item is less than the second one?
+    bool compare(const T& item1, const T& item2) const noexcept { return (_container != nullptr) ? _container->compare(item1, item2) : false; }
+
+    //! Swap two instances
+    void swap(BTreeConstIterator& it) noexcept;
+    template <class UContainer, typename U>
+    friend void swap(BTreeConstIterator<UContainer, U>& it1, BTreeConstIterator<UContainer, U>& it2) noexcept;
+
+private:
+    const TContainer* _container;
+    const typename TContainer::Leaf* _node;
+    size_t _index;
+};
+
+//! B+ tree reverse iterator
+/*!
+    Not thread-safe.
+*/
+template <class TContainer, typename T>
+class BTreeReverseIterator
+{
+    friend BTreeConstReverseIterator<TContainer, T>;
+
+public:
+    // Standard iterator type definitions
+    typedef T value_type;
+    typedef value_type& reference;
+    typedef const value_type& const_reference;
+    typedef value_type* pointer;
+    typedef const value_type* const_pointer;
+    typedef ptrdiff_t difference_type;
+    typedef size_t size_type;
+    typedef std::forward_iterator_tag iterator_category;
+
+    BTreeReverseIterator() noexcept : _container(nullptr), _node(nullptr), _index(0) {}
+    explicit BTreeReverseIterator(TContainer* container, typename TContainer::Leaf* node, size_t index) noexcept : _container(container), _node(node), _index(index) {}
+    BTreeReverseIterator(const BTreeReverseIterator& it) noexcept = default;
+    BTreeReverseIterator(BTreeReverseIterator&& it) noexcept = default;
+    ~BTreeReverseIterator() noexcept = default;
+
+    BTreeReverseIterator& operator=(const BTreeReverseIterator& it) noexcept = default;
+    BTreeReverseIterator& operator=(BTreeReverseIterator&& it) noexcept = default;
+
+    friend bool operator==(const BTreeReverseIterator& it1, const BTreeReverseIterator& it2) noexcept
+    { return (it1._container == it2._container) && (it1._node == it2._node) && (it1._index == it2._index); }
+    friend bool operator!=(const BTreeReverseIterator& it1, const BTreeReverseIterator& it2) noexcept
+    { return !(it1 == it2); }
+
+    BTreeReverseIterator& operator++() noexcept;
+    BTreeReverseIterator operator++(int) noexcept;
+
+    reference operator*() noexcept;
+    pointer operator->() noexcept;
+
+    //! Check if the iterator is valid
+    explicit operator bool() const noexcept { return (_container != nullptr) && (_node != nullptr); }
+
+    //! Compare two items: if the first item is less than the second one?
+    bool compare(const T& item1, const T& item2) const noexcept { return (_container != nullptr) ? _container->compare(item1, item2) : false; }
+
+    //! Swap two instances
+    void swap(BTreeReverseIterator& it) noexcept;
+    template <class UContainer, typename U>
+    friend void swap(BTreeReverseIterator<UContainer, U>& it1, BTreeReverseIterator<UContainer, U>& it2) noexcept;
+
+private:
+    TContainer* _container;
+    typename TContainer::Leaf* _node;
+    size_t _index;
+};
+
+//! B+ tree constant reverse iterator
+/*!
+    Not thread-safe.
+*/
+template <class TContainer, typename T>
+class BTreeConstReverseIterator
+{
+public:
+    // Standard iterator type definitions
+    typedef T value_type;
+    typedef value_type& reference;
+    typedef const value_type& const_reference;
+    typedef value_type* pointer;
+    typedef const value_type* const_pointer;
+    typedef ptrdiff_t difference_type;
+    typedef size_t size_type;
+    typedef std::forward_iterator_tag iterator_category;
+
+    BTreeConstReverseIterator() noexcept : _container(nullptr), _node(nullptr), _index(0) {}
+    explicit BTreeConstReverseIterator(const TContainer* container, const typename TContainer::Leaf* node, size_t index) noexcept : _container(container), _node(node), _index(index) {}
+    BTreeConstReverseIterator(const BTreeReverseIterator<TContainer, T>& it) noexcept : _container(it._container), _node(it._node), _index(it._index) {}
+    BTreeConstReverseIterator(const BTreeConstReverseIterator& it) noexcept = default;
+    BTreeConstReverseIterator(BTreeConstReverseIterator&& it) noexcept = default;
+    ~BTreeConstReverseIterator() noexcept = default;
+
+    BTreeConstReverseIterator& operator=(const BTreeReverseIterator<TContainer, T>& it) noexcept
+    { _container = it._container; _node = it._node; _index = it._index; return *this; }
+    BTreeConstReverseIterator& operator=(const BTreeConstReverseIterator& it) noexcept = default;
+    BTreeConstReverseIterator& operator=(BTreeConstReverseIterator&& it) noexcept = default;
+
+    friend bool operator==(const BTreeConstReverseIterator& it1, const BTreeConstReverseIterator& it2) noexcept
+    { return (it1._container == it2._container) && (it1._node == it2._node) && (it1._index == it2._index); }
+    friend bool operator!=(const BTreeConstReverseIterator& it1, const BTreeConstReverseIterator& it2) noexcept
+    { return !(it1 == it2); }
+
+    BTreeConstReverseIterator& operator++() noexcept;
+    BTreeConstReverseIterator operator++(int) noexcept;
+
+    const_reference operator*() const noexcept;
+    const_pointer operator->() const noexcept;
+
+    //! Check if the iterator is valid
+    explicit operator bool() const noexcept { return (_container != nullptr) && (_node != nullptr); }
+
+    //! Compare two items: if the first item is less than the second one?
+    bool compare(const T& item1, const T& item2) const noexcept { return (_container != nullptr) ? _container->compare(item1, item2) : false; }
+
+    //! Swap two instances
+    void swap(BTreeConstReverseIterator& it) noexcept;
+    template <class UContainer, typename U>
+    friend void swap(BTreeConstReverseIterator<UContainer, U>& it1, BTreeConstReverseIterator<UContainer, U>& it2) noexcept;
+
+private:
+    const TContainer* _container;
+    const typename TContainer::Leaf* _node;
+    size_t _index;
+};
+
+/*! \example containers_btree.cpp B+ tree container example */
+
+} // namespace CppCommon
+
+#include "btree.inl"
+
+#endif // CPPCOMMON_CONTAINERS_BTREE_H
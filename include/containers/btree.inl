@@ -0,0 +1,898 @@
+/*!
+    \file btree.inl
+    \brief B+ tree container inline implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+template <typename T, typename TCompare, typename TAllocator>
+inline BTree<T, TCompare, TAllocator>::BTree(const TCompare& compare, const TAllocator& allocator)
+    : _compare(compare), _allocator(allocator), _size(0), _height(0), _root(nullptr), _first(nullptr), _last(nullptr)
+{
+}
+
+template <typename T, typename TCompare, typename TAllocator>
+template <class InputIterator>
+inline BTree<T, TCompare, TAllocator>::BTree(InputIterator first, InputIterator last, const TCompare& compare, const TAllocator& allocator)
+    : BTree(compare, allocator)
+{
+    for (auto it = first; it != last; ++it)
+        insert(*it);
+}
+
+template <typename T, typename TCompare, typename TAllocator>
+inline BTree<T, TCompare, TAllocator>::BTree(const BTree& btree)
+    : BTree(btree._compare, btree._allocator)
+{
+    for (const auto& item : btree)
+        insert(item);
+}
+
+template <typename T, typename TCompare, typename TAllocator>
+inline BTree<T, TCompare, TAllocator>::BTree(BTree&& btree) noexcept
+    : _compare(std::move(btree._compare)), _allocator(btree._allocator),
+      _size(btree._size), _height(btree._height), _root(btree._root), _first(btree._first), _last(btree._last)
+{
+    btree._size = 0;
+    btree._height = 0;
+    btree._root = nullptr;
+    btree._first = nullptr;
+    btree._last = nullptr;
+}
+
+template <typename T, typename TCompare, typename TAllocator>
+inline BTree<T, TCompare, TAllocator>& BTree<T, TCompare, TAllocator>::operator=(const BTree& btree)
+{
+    if (&btree == this)
+        return *this;
+
+    clear();
+    _compare = btree._compare;
+    for (const auto& item : btree)
+        insert(item);
+    return *this;
+}
+
+template <typename T, typename TCompare, typename TAllocator>
+inline BTree<T, TCompare, TAllocator>& BTree<T, TCompare, TAllocator>::operator=(BTree&& btree) noexcept
+{
+    if (&btree == this)
+        return *this;
+
+    // Allocators are expected to be equal, so only the tree structure is moved
+    clear();
+    swap(btree);
+    return *this;
+}
+
+template <typename T, typename TCompare, typename TAllocator>
+inline T* BTree<T, TCompare, TAllocator>::lowest() noexcept
+{
+    return (T*)((const BTree*)this)->lowest();
+}
+
+template <typename T, typename TCompare, typename TAllocator>
+inline const T* BTree<T, TCompare, TAllocator>::lowest() const noexcept
+{
+    return (_first != nullptr) ? _first->items() : nullptr;
+}
+
+template <typename T, typename TCompare, typename TAllocator>
+inline T* BTree<T, TCompare, TAllocator>::highest() noexcept
+{
+    return (T*)((const BTree*)this)->highest();
+}
+
+template <typename T, typename TCompare, typename TAllocator>
+inline const T* BTree<T, TCompare, TAllocator>::highest() const noexcept
+{
+    return (_last != nullptr) ? (_last->items() + _last->count - 1) : nullptr;
+}
+
+template <typename T, typename TCompare, typename TAllocator>
+inline typename BTree<T, TCompare, TAllocator>::iterator BTree<T, TCompare, TAllocator>::begin() noexcept
+{
+    return iterator(this, _first, 0);
+}
+
+template <typename T, typename TCompare, typename TAllocator>
+inline typename BTree<T, TCompare, TAllocator>::const_iterator BTree<T, TCompare, TAllocator>::begin() const noexcept
+{
+    return const_iterator(this, _first, 0);
+}
+
+template <typename T, typename TCompare, typename TAllocator>
+inline typename BTree<T, TCompare, TAllocator>::const_iterator BTree<T, TCompare, TAllocator>::cbegin() const noexcept
+{
+    return const_iterator(this, _first, 0);
+}
+
+template <typename T, typename TCompare, typename TAllocator>
+inline typename BTree<T, TCompare, TAllocator>::iterator BTree<T, TCompare, TAllocator>::end() noexcept
+{
+    return iterator(this, nullptr, 0);
+}
+
+template <typename T, typename TCompare, typename TAllocator>
+inline typename BTree<T, TCompare, TAllocator>::const_iterator BTree<T, TCompare, TAllocator>::end() const noexcept
+{
+    return const_iterator(this, nullptr, 0);
+}
+
+template <typename T, typename TCompare, typename TAllocator>
+inline typename BTree<T, TCompare, TAllocator>::const_iterator BTree<T, TCompare, TAllocator>::cend() const noexcept
+{
+    return const_iterator(this, nullptr, 0);
+}
+
+template <typename T, typename TCompare, typename TAllocator>
+inline typename BTree<T, TCompare, TAllocator>::reverse_iterator BTree<T, TCompare, TAllocator>::rbegin() noexcept
+{
+    return reverse_iterator(this, _last, (_last != nullptr) ? (_last->count - 1) : 0);
+}
+
+template <typename T, typename TCompare, typename TAllocator>
+inline typename BTree<T, TCompare, TAllocator>::const_reverse_iterator BTree<T, TCompare, TAllocator>::rbegin() const noexcept
+{
+    return const_reverse_iterator(this, _last, (_last != nullptr) ? (_last->count - 1) : 0);
+}
+
+template <typename T, typename TCompare, typename TAllocator>
+inline typename BTree<T, TCompare, TAllocator>::const_reverse_iterator BTree<T, TCompare, TAllocator>::crbegin() const noexcept
+{
+    return const_reverse_iterator(this, _last, (_last != nullptr) ? (_last->count - 1) : 0);
+}
+
+template <typename T, typename TCompare, typename TAllocator>
+inline typename BTree<T, TCompare, TAllocator>::reverse_iterator BTree<T, TCompare, TAllocator>::rend() noexcept
+{
+    return reverse_iterator(this, nullptr, 0);
+}
+
+template <typename T, typename TCompare, typename TAllocator>
+inline typename BTree<T, TCompare, TAllocator>::const_reverse_iterator BTree<T, TCompare, TAllocator>::rend() const noexcept
+{
+    return const_reverse_iterator(this, nullptr, 0);
+}
+
+template <typename T, typename TCompare, typename TAllocator>
+inline typename BTree<T, TCompare, TAllocator>::const_reverse_iterator BTree<T, TCompare, TAllocator>::crend() const noexcept
+{
+    return const_reverse_iterator(this, nullptr, 0);
+}
+
+template <typename T, typename TCompare, typename TAllocator>
+inline typename BTree<T, TCompare, TAllocator>::iterator BTree<T, TCompare, TAllocator>::find(const T& item) noexcept
+{
+    auto result = InternalLowerBound(item);
+    if ((result.first == nullptr) || compare(item, result.first->items()[result.second]))
+        return end();
+    return iterator(this, (Leaf*)result.first, result.second);
+}
+
+template <typename T, typename TCompare, typename TAllocator>
+inline typename BTree<T, TCompare, TAllocator>::const_iterator BTree<T, TCompare, TAllocator>::find(const T& item) const noexcept
+{
+    auto result = InternalLowerBound(item);
+    if ((result.first == nullptr) || compare(item, result.first->items()[result.second]))
+        return end();
+    return const_iterator(this, result.first, result.second);
+}
+
+template <typename T, typename TCompare, typename TAllocator>
+inline typename BTree<T, TCompare, TAllocator>::iterator BTree<T, TCompare, TAllocator>::lower_bound(const T& item) noexcept
+{
+    auto result = InternalLowerBound(item);
+    return iterator(this, (Leaf*)result.first, result.second);
+}
+
+template <typename T, typename TCompare, typename TAllocator>
+inline typename BTree<T, TCompare, TAllocator>::const_iterator BTree<T, TCompare, TAllocator>::lower_bound(const T& item) const noexcept
+{
+    auto result = InternalLowerBound(item);
+    return const_iterator(this, result.first, result.second);
+}
+
+template <typename T, typename TCompare, typename TAllocator>
+inline typename BTree<T, TCompare, TAllocator>::iterator BTree<T, TCompare, TAllocator>::upper_bound(const T& item) noexcept
+{
+    auto result = InternalUpperBound(item);
+    return iterator(this, (Leaf*)result.first, result.second);
+}
+
+template <typename T, typename TCompare, typename TAllocator>
+inline typename BTree<T, TCompare, TAllocator>::const_iterator BTree<T, TCompare, TAllocator>::upper_bound(const T& item) const noexcept
+{
+    auto result = InternalUpperBound(item);
+    return const_iterator(this, result.first, result.second);
+}
+
+template <typename T, typename TCompare, typename TAllocator>
+inline std::pair<typename BTree<T, TCompare, TAllocator>::iterator, bool> BTree<T, TCompare, TAllocator>::insert(const T& item)
+{
+    return InternalInsert(T(item));
+}
+
+template <typename T, typename TCompare, typename TAllocator>
+inline std::pair<typename BTree<T, TCompare, TAllocator>::iterator, bool> BTree<T, TCompare, TAllocator>::insert(T&& item)
+{
+    return InternalInsert(std::move(item));
+}
+
+template <typename T, typename TCompare, typename TAllocator>
+template <typename... Args>
+inline std::pair<typename BTree<T, TCompare, TAllocator>::iterator, bool> BTree<T, TCompare, TAllocator>::emplace(Args&&... args)
+{
+    return InternalInsert(T(std::forward<Args>(args)...));
+}
+
+template <typename T, typename TCompare, typename TAllocator>
+inline size_t BTree<T, TCompare, TAllocator>::erase(const T& item)
+{
+    if (_root == nullptr)
+        return 0;
+
+    Step path[MAX_HEIGHT];
+    Leaf* leaf = (Leaf*)FindLeaf(item, path);
+    size_t index = LeafLowerBound(leaf, item);
+    if ((index == leaf->count) || compare(item, leaf->items()[index]))
+        return 0;
+
+    // The given item might be the erased one, so it must not be used after removal
+    RemoveAt(leaf->items(), leaf->count--, index);
+    --_size;
+
+    InternalRebalanceLeaf(path, _height - 1, leaf);
+    return 1;
+}
+
+template <typename T, typename TCompare, typename TAllocator>
+inline typename BTree<T, TCompare, TAllocator>::iterator BTree<T, TCompare, TAllocator>::erase(const const_iterator& it)
+{
+    if (it._node == nullptr)
+        return end();
+
+    // Rebalancing may move items between leaves, so the next item is found by its value
+    T item(*it);
+    erase(item);
+    return lower_bound(item);
+}
+
+template <typename T, typename TCompare, typename TAllocator>
+inline void BTree<T, TCompare, TAllocator>::clear() noexcept
+{
+    if (_root != nullptr)
+        ReleaseNode(_root);
+
+    _size = 0;
+    _height = 0;
+    _root = nullptr;
+    _first = nullptr;
+    _last = nullptr;
+}
+
+template <typename T, typename TCompare, typename TAllocator>
+inline typename BTree<T, TCompare, TAllocator>::Leaf* BTree<T, TCompare, TAllocator>::CreateLeaf()
+{
+    leaf_allocator allocator(_allocator);
+    Leaf* leaf = std::allocator_traits<leaf_allocator>::allocate(allocator, 1);
+    return new (leaf) Leaf();
+}
+
+template <typename T, typename TCompare, typename TAllocator>
+inline typename BTree<T, TCompare, TAllocator>::Inner* BTree<T, TCompare, TAllocator>::CreateInner()
+{
+    inner_allocator allocator(_allocator);
+    Inner* inner = std::allocator_traits<inner_allocator>::allocate(allocator, 1);
+    return new (inner) Inner();
+}
+
+template <typename T, typename TCompare, typename TAllocator>
+inline void BTree<T, TCompare, TAllocator>::ReleaseLeaf(Leaf* leaf) noexcept
+{
+    for (size_t i = 0; i < leaf->count; ++i)
+        leaf->items()[i].~T();
+    leaf->~Leaf();
+    leaf_allocator allocator(_allocator);
+    std::allocator_traits<leaf_allocator>::deallocate(allocator, leaf, 1);
+}
+
+template <typename T, typename TCompare, typename TAllocator>
+inline void BTree<T, TCompare, TAllocator>::ReleaseInner(Inner* inner) noexcept
+{
+    for (size_t i = 0; i < inner->count; ++i)
+        inner->keys()[i].~T();
+    inner->~Inner();
+    inner_allocator allocator(_allocator);
+    std::allocator_traits<inner_allocator>::deallocate(allocator, inner, 1);
+}
+
+template <typename T, typename TCompare, typename TAllocator>
+inline void BTree<T, TCompare, TAllocator>::ReleaseNode(Node* node) noexcept
+{
+    if (node->leaf)
+        ReleaseLeaf((Leaf*)node);
+    else
+    {
+        Inner* inner = (Inner*)node;
+        for (size_t i = 0; i <= inner->count; ++i)
+            ReleaseNode(inner->children[i]);
+        ReleaseInner(inner);
+    }
+}
+
+template <typename T, typename TCompare, typename TAllocator>
+inline size_t BTree<T, TCompare, TAllocator>::LeafLowerBound(const Leaf* leaf, const T& item) const noexcept
+{
+    const T* items = leaf->items();
+    return std::lower_bound(items, items + leaf->count, item, [this](const T& item1, const T& item2) { return compare(item1, item2); }) - items;
+}
+
+template <typename T, typename TCompare, typename TAllocator>
+inline size_t BTree<T, TCompare, TAllocator>::LeafUpperBound(const Leaf* leaf, const T& item) const noexcept
+{
+    const T* items = leaf->items();
+    return std::upper_bound(items, items + leaf->count, item, [this](const T& item1, const T& item2) { return compare(item1, item2); }) - items;
+}
+
+template <typename T, typename TCompare, typename TAllocator>
+inline size_t BTree<T, TCompare, TAllocator>::InnerUpperBound(const Inner* inner, const T& item) const noexcept
+{
+    const T* keys = inner->keys();
+    return std::upper_bound(keys, keys + inner->count, item, [this](const T& item1, const T& item2) { return compare(item1, item2); }) - keys;
+}
+
+template <typename T, typename TCompare, typename TAllocator>
+inline const typename BTree<T, TCompare, TAllocator>::Leaf* BTree<T, TCompare, TAllocator>::FindLeaf(const T& item, Step* path) const noexcept
+{
+    assert((_root != nullptr) && "B+ tree must not be empty!");
+
+    // Separator key i is the lowest item of the child i + 1
+    const Node* node = _root;
+    size_t depth = 0;
+    while (!node->leaf)
+    {
+        const Inner* inner = (const Inner*)node;
+        size_t index = InnerUpperBound(inner, item);
+        if (path != nullptr)
+        {
+            path[depth].node = (Inner*)inner;
+            path[depth].index = index;
+        }
+        node = inner->children[index];
+        ++depth;
+    }
+    return (const Leaf*)node;
+}
+
+template <typename T, typename TCompare, typename TAllocator>
+inline std::pair<const typename BTree<T, TCompare, TAllocator>::Leaf*, size_t> BTree<T, TCompare, TAllocator>::InternalLowerBound(const T& item) const noexcept
+{
+    if (_root == nullptr)
+        return std::make_pair(nullptr, 0);
+
+    const Leaf* leaf = FindLeaf(item, nullptr);
+    size_t index = LeafLowerBound(leaf, item);
+    if (index == leaf->count)
+        return std::make_pair(leaf->next, 0);
+    return std::make_pair(leaf, index);
+}
+
+template <typename T, typename TCompare, typename TAllocator>
+inline std::pair<const typename BTree<T, TCompare, TAllocator>::Leaf*, size_t> BTree<T, TCompare, TAllocator>::InternalUpperBound(const T& item) const noexcept
+{
+    if (_root == nullptr)
+        return std::make_pair(nullptr, 0);
+
+    const Leaf* leaf = FindLeaf(item, nullptr);
+    size_t index = LeafUpperBound(leaf, item);
+    if (index == leaf->count)
+        return std::make_pair(leaf->next, 0);
+    return std::make_pair(leaf, index);
+}
+
+template <typename T, typename TCompare, typename TAllocator>
+inline std::pair<typename BTree<T, TCompare, TAllocator>::iterator, bool> BTree<T, TCompare, TAllocator>::InternalInsert(T&& item)
+{
+    // Create the root leaf for the empty tree
+    if (_root == nullptr)
+    {
+        Leaf* leaf = CreateLeaf();
+        new (leaf->items()) T(std::move(item));
+        leaf->count = 1;
+        _root = _first = _last = leaf;
+        _height = 1;
+        _size = 1;
+        return std::make_pair(iterator(this, leaf, 0), true);
+    }
+
+    Step path[MAX_HEIGHT];
+    Leaf* leaf = (Leaf*)FindLeaf(item, path);
+    size_t index = LeafLowerBound(leaf, item);
+    if ((index < leaf->count) && !compare(item, leaf->items()[index]))
+        return std::make_pair(iterator(this, leaf, index), false);
+
+    // Insert into the leaf with a free space
+    if (leaf->count < LEAF_CAPACITY)
+    {
+        InsertAt(leaf->items(), leaf->count++, index, std::move(item));
+        ++_size;
+        return std::make_pair(iterator(this, leaf, index), true);
+    }
+
+    // Split the full leaf. Appending to the last leaf keeps it full and starts
+    // a new one, so sorted inserts build densely packed leaves.
+    size_t middle = ((leaf == _last) && (index == leaf->count)) ? leaf->count : (LEAF_CAPACITY / 2);
+    Leaf* right = CreateLeaf();
+    MoveTo(leaf->items() + middle, leaf->count - middle, right->items());
+    right->count = leaf->count - middle;
+    leaf->count = middle;
+
+    right->prev = leaf;
+    right->next = leaf->next;
+    if (leaf->next != nullptr)
+        leaf->next->prev = right;
+    else
+        _last = right;
+    leaf->next = right;
+
+    Leaf* target = leaf;
+    if ((index > middle) || (middle == LEAF_CAPACITY))
+    {
+        target = right;
+        index -= middle;
+    }
+    InsertAt(target->items(), target->count++, index, std::move(item));
+    ++_size;
+
+    iterator result(this, target, index);
+    InternalInsertParent(path, _height - 1, T(right->items()[0]), right);
+    return std::make_pair(result, true);
+}
+
+template <typename T, typename TCompare, typename TAllocator>
+inline void BTree<T, TCompare, TAllocator>::InternalInsertParent(Step* path, size_t depth, T&& key, Node* child)
+{
+    for (;;)
+    {
+        // Grow the tree with a new root
+        if (depth == 0)
+        {
+            Inner* root = CreateInner();
+            new (root->keys()) T(std::move(key));
+            root->children[0] = _root;
+            root->children[1] = child;
+            root->count = 1;
+            _root = root;
+            ++_height;
+            return;
+        }
+
+        Inner* inner = path[depth - 1].node;
+        size_t index = path[depth - 1].index;
+
+        // Insert into the inner node with a free space
+        if (inner->count < INNER_CAPACITY)
+        {
+            InsertAt(inner->keys(), inner->count, index, std::move(key));
+            std::copy_backward(inner->children + index + 1, inner->children + inner->count + 1, inner->children + inner->count + 2);
+            inner->children[index + 1] = child;
+            ++inner->count;
+            return;
+        }
+
+        // Split the full inner node and promote its middle key
+        size_t middle = INNER_CAPACITY / 2;
+        Inner* right = CreateInner();
+        T promoted(std::move(inner->keys()[middle]));
+        MoveTo(inner->keys() + middle + 1, inner->count - middle - 1, right->keys());
+        std::copy(inner->children + middle + 1, inner->children + inner->count + 1, right->children);
+        right->count = inner->count - middle - 1;
+        inner->keys()[middle].~T();
+        inner->count = middle;
+
+        Inner* target = inner;
+        if (index > middle)
+        {
+            target = right;
+            index -= middle + 1;
+        }
+        InsertAt(target->keys(), target->count, index, std::move(key));
+        std::copy_backward(target->children + index + 1, target->children + target->count + 1, target->children + target->count + 2);
+        target->children[index + 1] = child;
+        ++target->count;
+
+        key = std::move(promoted);
+        child = right;
+        --depth;
+    }
+}
+
+template <typename T, typename TCompare, typename TAllocator>
+inline void BTree<T, TCompare, TAllocator>::InternalRebalanceLeaf(Step* path, size_t depth, Leaf* leaf) noexcept
+{
+    // Release the empty root leaf
+    if (depth == 0)
+    {
+        if (leaf->count == 0)
+        {
+            ReleaseLeaf(leaf);
+            _root = _first = _last = nullptr;
+            _height = 0;
+        }
+        return;
+    }
+
+    if (leaf->count >= LEAF_MIN)
+        return;
+
+    Inner* parent = path[depth - 1].node;
+    size_t index = path[depth - 1].index;
+    Leaf* left = (index > 0) ? (Leaf*)parent->children[index - 1] : nullptr;
+    Leaf* right = (index < parent->count) ? (Leaf*)parent->children[index + 1] : nullptr;
+
+    // Borrow the highest item from the left sibling
+    if ((left != nullptr) && (left->count > LEAF_MIN))
+    {
+        InsertAt(leaf->items(), leaf->count++, 0, std::move(left->items()[left->count - 1]));
+        left->items()[--left->count].~T();
+        parent->keys()[index - 1] = leaf->items()[0];
+        return;
+    }
+
+    // Borrow the lowest item from the right sibling
+    if ((right != nullptr) && (right->count > LEAF_MIN))
+    {
+        new (leaf->items() + leaf->count++) T(std::move(right->items()[0]));
+        RemoveAt(right->items(), right->count--, 0);
+        parent->keys()[index] = right->items()[0];
+        return;
+    }
+
+    // Merge with one of siblings
+    if (left != nullptr)
+    {
+        right = leaf;
+        leaf = left;
+        --index;
+    }
+    MoveTo(right->items(), right->count, leaf->items() + leaf->count);
+    leaf->count += right->count;
+    right->count = 0;
+    leaf->next = right->next;
+    if (right->next != nullptr)
+        right->next->prev = leaf;
+    else
+        _last = leaf;
+    ReleaseLeaf(right);
+
+    RemoveAt(parent->keys(), parent->count, index);
+    std::copy(parent->children + index + 2, parent->children + parent->count + 1, parent->children + index + 1);
+    --parent->count;
+
+    InternalRebalanceInner(path, depth - 1, parent);
+}
+
+template <typename T, typename TCompare, typename TAllocator>
+inline void BTree<T, TCompare, TAllocator>::InternalRebalanceInner(Step* path, size_t depth, Inner* inner) noexcept
+{
+    // Shrink the tree if the root has a single child
+    if (depth == 0)
+    {
+        if (inner->count == 0)
+        {
+            _root = inner->children[0];
+            ReleaseInner(inner);
+            --_height;
+        }
+        return;
+    }
+
+    if (inner->count >= INNER_MIN)
+        return;
+
+    Inner* parent = path[depth - 1].node;
+    size_t index = path[depth - 1].index;
+    Inner* left = (index > 0) ? (Inner*)parent->children[index - 1] : nullptr;
+    Inner* right = (index < parent->count) ? (Inner*)parent->children[index + 1] : nullptr;
+
+    // Rotate the highest child from the left sibling through the parent
+    if ((left != nullptr) && (left->count > INNER_MIN))
+    {
+        InsertAt(inner->keys(), inner->count, 0, std::move(parent->keys()[index - 1]));
+        std::copy_backward(inner->children, inner->children + inner->count + 1, inner->children + inner->count + 2);
+        inner->children[0] = left->children[left->count];
+        ++inner->count;
+        parent->keys()[index - 1] = std::move(left->keys()[left->count - 1]);
+        left->keys()[--left->count].~T();
+        return;
+    }
+
+    // Rotate the lowest child from the right sibling through the parent
+    if ((right != nullptr) && (right->count > INNER_MIN))
+    {
+        new (inner->keys() + inner->count) T(std::move(parent->keys()[index]));
+        inner->children[inner->count + 1] = right->children[0];
+        ++inner->count;
+        parent->keys()[index] = std::move(right->keys()[0]);
+        RemoveAt(right->keys(), right->count, 0);
+        std::copy(right->children + 1, right->children + right->count + 1, right->children);
+        --right->count;
+        return;
+    }
+
+    // Merge with one of siblings pulling down the separator key
+    if (left != nullptr)
+    {
+        right = inner;
+        inner = left;
+        --index;
+    }
+    new (inner->keys() + inner->count) T(std::move(parent->keys()[index]));
+    MoveTo(right->keys(), right->count, inner->keys() + inner->count + 1);
+    std::copy(right->children, right->children + right->count + 1, inner->children + inner->count + 1);
+    inner->count += right->count + 1;
+    right->count = 0;
+    ReleaseInner(right);
+
+    RemoveAt(parent->keys(), parent->count, index);
+    std::copy(parent->children + index + 2, parent->children + parent->count + 1, parent->children + index + 1);
+    --parent->count;
+
+    InternalRebalanceInner(path, depth - 1, parent);
+}
+
+template <typename T, typename TCompare, typename TAllocator>
+inline void BTree<T, TCompare, TAllocator>::InsertAt(T* items, size_t count, size_t index, T&& item)
+{
+    if (index < count)
+    {
+        new (items + count) T(std::move(items[count - 1]));
+        std::move_backward(items + index, items + count - 1, items + count);
+        items[index] = std::move(item);
+    }
+    else
+        new (items + count) T(std::move(item));
+}
+
+template <typename T, typename TCompare, typename TAllocator>
+inline void BTree<T, TCompare, TAllocator>::RemoveAt(T* items, size_t count, size_t index) noexcept
+{
+    std::move(items + index + 1, items + count, items + index);
+    items[count - 1].~T();
+}
+
+template <typename T, typename TCompare, typename TAllocator>
+inline void BTree<T, TCompare, TAllocator>::MoveTo(T* source, size_t count, T* destination) noexcept
+{
+    for (size_t i = 0; i < count; ++i)
+    {
+        new (destination + i) T(std::move(source[i]));
+        source[i].~T();
+    }
+}
+
+template <typename T, typename TCompare, typename TAllocator>
+inline void BTree<T, TCompare, TAllocator>::swap(BTree& btree) noexcept
+{
+    using std::swap;
+    swap(_compare, btree._compare);
+    swap(_size, btree._size);
+    swap(_height, btree._height);
+    swap(_root, btree._root);
+    swap(_first, btree._first);
+    swap(_last, btree._last);
+}
+
+template <typename T, typename TCompare, typename TAllocator>
+inline void swap(BTree<T, TCompare, TAllocator>& btree1, BTree<T, TCompare, TAllocator>& btree2) noexcept
+{
+    btree1.swap(btree2);
+}
+
+template <class TContainer, typename T>
+BTreeIterator<TContainer, T>& BTreeIterator<TContainer, T>::operator++() noexcept
+{
+    if ((_node != nullptr) && (++_index >= _node->count))
+    {
+        _node = _node->next;
+        _index = 0;
+    }
+    return *this;
+}
+
+template <class TContainer, typename T>
+inline BTreeIterator<TContainer, T> BTreeIterator<TContainer, T>::operator++(int) noexcept
+{
+    BTreeIterator<TContainer, T> result(*this);
+    operator++();
+    return result;
+}
+
+template <class TContainer, typename T>
+typename BTreeIterator<TContainer, T>::reference BTreeIterator<TContainer, T>::operator*() noexcept
+{
+    assert((_node != nullptr) && "Iterator must be valid!");
+
+    return _node->items()[_index];
+}
+
+template <class TContainer, typename T>
+typename BTreeIterator<TContainer, T>::pointer BTreeIterator<TContainer, T>::operator->() noexcept
+{
+    return (_node != nullptr) ? (_node->items() + _index) : nullptr;
+}
+
+template <class TContainer, typename T>
+void BTreeIterator<TContainer, T>::swap(BTreeIterator& it) noexcept
+{
+    using std::swap;
+    swap(_container, it._container);
+    swap(_node, it._node);
+    swap(_index, it._index);
+}
+
+template <class TContainer, typename T>
+void swap(BTreeIterator<TContainer, T>& it1, BTreeIterator<TContainer, T>& it2) noexcept
+{
+    it1.swap(it2);
+}
+
+template <class TContainer, typename T>
+BTreeConstIterator<TContainer, T>& BTreeConstIterator<TContainer, T>::operator++() noexcept
+{
+    if ((_node != nullptr) && (++_index >= _node->count))
+    {
+        _node = _node->next;
+        _index = 0;
+    }
+    return *this;
+}
+
+template <class TContainer, typename T>
+inline BTreeConstIterator<TContainer, T> BTreeConstIterator<TContainer, T>::operator++(int) noexcept
+{
+    BTreeConstIterator<TContainer, T> result(*this);
+    operator++();
+    return result;
+}
+
+template <class TContainer, typename T>
+typename BTreeConstIterator<TContainer, T>::const_reference BTreeConstIterator<TContainer, T>::operator*() const noexcept
+{
+    assert((_node != nullptr) && "Iterator must be valid!");
+
+    return _node->items()[_index];
+}
+
+template <class TContainer, typename T>
+typename BTreeConstIterator<TContainer, T>::const_pointer BTreeConstIterator<TContainer, T>::operator->() const noexcept
+{
+    return (_node != nullptr) ? (_node->items() + _index) : nullptr;
+}
+
+template <class TContainer, typename T>
+void BTreeConstIterator<TContainer, T>::swap(BTreeConstIterator& it) noexcept
+{
+    using std::swap;
+    swap(_container, it._container);
+    swap(_node, it._node);
+    swap(_index, it._index);
+}
+
+template <class TContainer, typename T>
+void swap(BTreeConstIterator<TContainer, T>& it1, BTreeConstIterator<TContainer, T>& it2) noexcept
+{
+    it1.swap(it2);
+}
+
+template <class TContainer, typename T>
+BTreeReverseIterator<TContainer, T>& BTreeReverseIterator<TContainer, T>::operator++() noexcept
+{
+    if (_node != nullptr)
+    {
+        if (_index == 0)
+        {
+            _node = _node->prev;
+            _index = (_node != nullptr) ? (_node->count - 1) : 0;
+        }
+        else
+            --_index;
+    }
+    return *this;
+}
+
+template <class TContainer, typename T>
+inline BTreeReverseIterator<TContainer, T> BTreeReverseIterator<TContainer, T>::operator++(int) noexcept
+{
+    BTreeReverseIterator<TContainer, T> result(*this);
+    operator++();
+    return result;
+}
+
+template <class TContainer, typename T>
+typename BTreeReverseIterator<TContainer, T>::reference BTreeReverseIterator<TContainer, T>::operator*() noexcept
+{
+    assert((_node != nullptr) && "Iterator must be valid!");
+
+    return _node->items()[_index];
+}
+
+template <class TContainer, typename T>
+typename BTreeReverseIterator<TContainer, T>::pointer BTreeReverseIterator<TContainer, T>::operator->() noexcept
+{
+    return (_node != nullptr) ? (_node->items() + _index) : nullptr;
+}
+
+template <class TContainer, typename T>
+void BTreeReverseIterator<TContainer, T>::swap(BTreeReverseIterator& it) noexcept
+{
+    using std::swap;
+    swap(_container, it._container);
+    swap(_node, it._node);
+    swap(_index, it._index);
+}
+
+template <class TContainer, typename T>
+void swap(BTreeReverseIterator<TContainer, T>& it1, BTreeReverseIterator<TContainer, T>& it2) noexcept
+{
+    it1.swap(it2);
+}
+
+template <class TContainer, typename T>
+BTreeConstReverseIterator<TContainer, T>& BTreeConstReverseIterator<TContainer, T>::operator++() noexcept
+{
+    if (_node != nullptr)
+    {
+        if (_index == 0)
+        {
+            _node = _node->prev;
+            _index = (_node != nullptr) ? (_node->count - 1) : 0;
+        }
+        else
+            --_index;
+    }
+    return *this;
+}
+
+template <class TContainer, typename T>
+inline BTreeConstReverseIterator<TContainer, T> BTreeConstReverseIterator<TContainer, T>::operator++(int) noexcept
+{
+    BTreeConstReverseIterator<TContainer, T> result(*this);
+    operator++();
+    return result;
+}
+
+template <class TContainer, typename T>
+typename BTreeConstReverseIterator<TContainer, T>::const_reference BTreeConstReverseIterator<TContainer, T>::operator*() const noexcept
+{
+    assert((_node != nullptr) && "Iterator must be valid!");
+
+    return _node->items()[_index];
+}
+
+template <class TContainer, typename T>
+typename BTreeConstReverseIterator<TContainer, T>::const_pointer BTreeConstReverseIterator<TContainer, T>::operator->() const noexcept
+{
+    return (_node != nullptr) ? (_node->items() + _index) : nullptr;
+}
+
+template <class TContainer, typename T>
+void BTreeConstReverseIterator<TContainer, T>::swap(BTreeConstReverseIterator& it) noexcept
+{
+    using std::swap;
+    swap(_container, it._container);
+    swap(_node, it._node);
+    swap(_index, it._index);
+}
+
+template <class TContainer, typename T>
+void swap(BTreeConstReverseIterator<TContainer, T>& it1, BTreeConstReverseIterator<TContainer, T>& it2) noexcept
+{
+    it1.swap(it2);
+}
+
+} // namespace CppCommon
@@ -0,0 +1,313 @@
+/*!
+    \file circular_buffer.h
+    \brief Circular buffer container definition
+    \author Ivan Shynkarenka
+    \date 15.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_CONTAINERS_CIRCULAR_BUFFER_H
+#define CPPCOMMON_CONTAINERS_CIRCULAR_BUFFER_H
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace CppCommon {
+
+template <class TContainer, typename T>
+class CircularBufferIterator;
+
+//! Circular buffer container
+/*!
+    Circular buffer is a double-ended queue with random access stored in the
+    single contiguous ring of the fixed capacity (rounded up to the power of
+    two), so indexing is a mask instead of a division. Ring storage  is
+    allocated once with the given allocator, so sliding windows (e.g. of the
+    last ticks) push into the back and pop from the front without  any
+    allocations, unlike std::deque which allocates blocks constantly.
+
+    If the circular buffer is full, pushing throws std::length_error, unless
+    the overwrite mode is enabled: then the oldest item on the opposite side
+    is dropped. try_push_back() and try_emplace_back() methods never
+    overwrite and return nullptr instead.
+
+    Items are stored in at most two contiguous parts of the ring, which are
+    returned by as_spans() for bulk processing (e.g. SIMD kernels) without
+    copying. Iterators stay valid while their items are kept in the circular
+    buffer (pushing into the full circular buffer in the overwrite mode
+    invalidates iterators of the dropped items).
+
+    Not thread-safe.
+*/
+template <typename T, typename TAllocator = std::allocator<T>>
+class CircularBuffer
+{
+    friend class CircularBufferIterator<CircularBuffer<T, TAllocator>, T>;
+    friend class CircularBufferIterator<const CircularBuffer<T, TAllocator>, const T>;
+
+public:
+    // Standard container type definitions
+    typedef T value_type;
+    typedef value_type& reference;
+    typedef const value_type& const_reference;
+    typedef value_type* pointer;
+    typedef const value_type* const_pointer;
+    typedef ptrdiff_t difference_type;
+    typedef size_t size_type;
+    typedef TAllocator allocator_type;
+    typedef CircularBufferIterator<CircularBuffer<T, TAllocator>, T> iterator;
+    typedef CircularBufferIterator<const CircularBuffer<T, TAllocator>, const T> const_iterator;
+    typedef std::reverse_iterator<iterator> reverse_iterator;
+    typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+
+    //! Initialize the circular buffer with a given capacity
+    /*!
+        \param capacity - Circular buffer capacity (will be rounded up to the power of two)
+        \param overwrite - Overwrite the oldest item when the circular buffer is full (default is false)
+        \param allocator - Allocator (default is TAllocator())
+    */
+    explicit CircularBuffer(size_t capacity, bool overwrite = false, const TAllocator& allocator = TAllocator());
+    CircularBuffer(std::initializer_list<T> list, bool overwrite = false, const TAllocator& allocator = TAllocator());
+    CircularBuffer(const CircularBuffer& buffer);
+    CircularBuffer(CircularBuffer&& buffer) noexcept;
+    ~CircularBuffer() noexcept;
+
+    CircularBuffer& operator=(const CircularBuffer& buffer);
+    CircularBuffer& operator=(CircularBuffer&& buffer) noexcept;
+
+    //! Check if the circular buffer is not empty
+    explicit operator bool() const noexcept { return !empty(); }
+
+    //! Access to the item with the given index (0 - the front item)
+    reference operator[](size_t index) noexcept { assert((index < size()) && "Index out of bounds!"); return _buffer[(_head + index) & _mask]; }
+    const_reference operator[](size_t index) const noexcept { assert((index < size()) && "Index out of bounds!"); return _buffer[(_head + index) & _mask]; }
+
+    //! Is the circular buffer empty?
+    bool empty() const noexcept { return (_head == _tail); }
+    //! Is the circular buffer full?
+    bool full() const noexcept { return (size() == _capacity); }
+    //! Get the circular buffer size
+    size_t size() const noexcept { return _tail - _head; }
+    //! Get the circular buffer capacity
+    size_t capacity() const noexcept { return _capacity; }
+    //! Get the circular buffer maximum size
+    size_t max_size() const noexcept { return _capacity; }
+    //! Is the overwrite mode enabled?
+    bool overwrite() const noexcept { return _overwrite; }
+
+    //! Get the circular buffer allocator
+    allocator_type get_allocator() const noexcept { return _allocator; }
+
+    //! Access to the item with the given index or throw std::out_of_range exception
+    reference at(size_t index);
+    const_reference at(size_t index) const;
+
+    //! Get the front item
+    reference front() noexcept { assert(!empty() && "Circular buffer is empty!"); return _buffer[_head & _mask]; }
+    const_reference front() const noexcept { assert(!empty() && "Circular buffer is empty!"); return _buffer[_head & _mask]; }
+    //! Get the back item
+    reference back() noexcept { assert(!empty() && "Circular buffer is empty!"); return _buffer[(_tail - 1) & _mask]; }
+    const_reference back() const noexcept { assert(!empty() && "Circular buffer is empty!"); return _buffer[(_tail - 1) & _mask]; }
+
+    //! Get the begin circular buffer iterator
+    iterator begin() noexcept { return iterator(this, _head); }
+    const_iterator begin() const noexcept { return const_iterator(this, _head); }
+    const_iterator cbegin() const noexcept { return const_iterator(this, _head); }
+    //! Get the end circular buffer iterator
+    iterator end() noexcept { return iterator(this, _tail); }
+    const_iterator end() const noexcept { return const_iterator(this, _tail); }
+    const_iterator cend() const noexcept { return const_iterator(this, _tail); }
+
+    //! Get the reverse begin circular buffer iterator
+    reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
+    const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(end()); }
+    const_reverse_iterator crbegin() const noexcept { return const_reverse_iterator(end()); }
+    //! Get the reverse end circular buffer iterator
+    reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
+    const_reverse_iterator rend() const noexcept { return const_reverse_iterator(begin()); }
+    const_reverse_iterator crend() const noexcept { return const_reverse_iterator(begin()); }
+
+    //! Get two contiguous parts of the circular buffer
+    /*!
+        Items of the first span are followed by items of the second one. The
+        second span is empty if items are not wrapped around the ring end.
+
+        \return Pair of contiguous spans of the circular buffer items
+    */
+    std::pair<std::span<T>, std::span<T>> as_spans() noexcept;
+    std::pair<std::span<const T>, std::span<const T>> as_spans() const noexcept;
+
+    //! Push a new item into the back of the circular buffer
+    void push_back(const T& value) { emplace_back(value); }
+    void push_back(T&& value) { emplace_back(std::move(value)); }
+    //! Emplace a new item into the back of the circular buffer
+    /*!
+        If the circular buffer is full, the front item is dropped in the overwrite
+        mode, otherwise std::length_error exception is thrown.
+
+        \param args - Arguments to construct the item
+        \return Reference to the emplaced item
+    */
+    template <typename... Args>
+    reference emplace_back(Args&&... args);
+    //! Try to push a new item into the back of the circular buffer
+    /*!
+        \param value - Item to push
+        \return Pointer to the pushed item or nullptr if the circular buffer is full
+    */
+    pointer try_push_back(const T& value) { return try_emplace_back(value); }
+    pointer try_push_back(T&& value) { return try_emplace_back(std::move(value)); }
+    //! Try to emplace a new item into the back of the circular buffer
+    /*!
+        \param args - Arguments to construct the item
+        \return Pointer to the emplaced item or nullptr if the circular buffer is full
+    */
+    template <typename... Args>
+    pointer try_emplace_back(Args&&... args);
+
+    //! Push a new item into the front of the circular buffer
+    void push_front(const T& value) { emplace_front(value); }
+    void push_front(T&& value) { emplace_front(std::move(value)); }
+    //! Emplace a new item into the front of the circular buffer
+    /*!
+        If the circular buffer is full, the back item is dropped in the overwrite
+        mode, otherwise std::length_error exception is thrown.
+
+        \param args - Arguments to construct the item
+        \return Reference to the emplaced item
+    */
+    template <typename... Args>
+    reference emplace_front(Args&&... args);
+
+    //! Pop the front item from the circular buffer
+    void pop_front() noexcept;
+    //! Pop the given count of front items from the circular buffer
+    void pop_front(size_t count) noexcept;
+    //! Pop the back item from the circular buffer
+    void pop_back() noexcept;
+    //! Pop the given count of back items from the circular buffer
+    void pop_back(size_t count) noexcept;
+
+    //! Clear the circular buffer
+    void clear() noexcept;
+
+    //! Swap two instances
+    void swap(CircularBuffer& buffer) noexcept;
+    template <typename U, typename UAllocator>
+    friend void swap(CircularBuffer<U, UAllocator>& buffer1, CircularBuffer<U, UAllocator>& buffer2) noexcept;
+
+private:
+    [[no_unique_address]] TAllocator _allocator;
+    T* _buffer;
+    size_t _capacity;
+    size_t _mask;
+    size_t _head;
+    size_t _tail;
+    bool _overwrite;
+
+    //! Allocate the ring storage of the given capacity
+    void allocate(size_t capacity);
+    //! Deallocate the ring storage
+    void deallocate() noexcept;
+};
+
+//! Circular buffer iterator
+/*!
+    Random access iterator addresses the item by its position in the circular
+    buffer, which is not changed by pushing and popping other items.
+
+    Not thread-safe.
+*/
+template <class TContainer, typename T>
+class CircularBufferIterator
+{
+    friend TContainer;
+    template <class UContainer, typename U>
+    friend class CircularBufferIterator;
+
+public:
+    // Standard iterator type definitions
+    typedef std::remove_const_t<T> value_type;
+    typedef T& reference;
+    typedef T* pointer;
+    typedef ptrdiff_t difference_type;
+    typedef size_t size_type;
+    typedef std::random_access_iterator_tag iterator_category;
+
+    CircularBufferIterator() noexcept : _container(nullptr), _position(0) {}
+    explicit CircularBufferIterator(TContainer* container, size_t position) noexcept : _container(container), _position(position) {}
+    template <class UContainer, typename U, typename = std::enable_if_t<std::is_const_v<T> && !std::is_const_v<U>>>
+    CircularBufferIterator(const CircularBufferIterator<UContainer, U>& it) noexcept : _container(it._container), _position(it._position) {}
+    CircularBufferIterator(const CircularBufferIterator& it) noexcept = default;
+    CircularBufferIterator(CircularBufferIterator&& it) noexcept = default;
+    ~CircularBufferIterator() noexcept = default;
+
+    CircularBufferIterator& operator=(const CircularBufferIterator& it) noexcept = default;
+    CircularBufferIterator& operator=(CircularBufferIterator&& it) noexcept = default;
+
+    friend bool operator==(const CircularBufferIterator& it1, const CircularBufferIterator& it2) noexcept
+    { return (it1._container == it2._container) && (it1._position == it2._position); }
+    friend bool operator!=(const CircularBufferIterator& it1, const CircularBufferIterator& it2) noexcept
+    { return !(it1 == it2); }
+    friend bool operator<(const CircularBufferIterator& it1, const CircularBufferIterator& it2) noexcept
+    { return (it1 - it2) < 0; }
+    friend bool operator>(const CircularBufferIterator& it1, const CircularBufferIterator& it2) noexcept
+    { return (it1 - it2) > 0; }
+    friend bool operator<=(const CircularBufferIterator& it1, const CircularBufferIterator& it2) noexcept
+    { return (it1 - it2) <= 0; }
+    friend bool operator>=(const CircularBufferIterator& it1, const CircularBufferIterator& it2) noexcept
+    { return (it1 - it2) >= 0; }
+
+    CircularBufferIterator& operator++() noexcept { ++_position; return *this; }
+    CircularBufferIterator operator++(int) noexcept { CircularBufferIterator result(*this); ++_position; return result; }
+    CircularBufferIterator& operator--() noexcept { --_position; return *this; }
+    CircularBufferIterator operator--(int) noexcept { CircularBufferIterator result(*this); --_position; return result; }
+
+    CircularBufferIterator& operator+=(difference_type offset) noexcept { _position += (size_t)offset; return *this; }
+    CircularBufferIterator& operator-=(difference_type offset) noexcept { _position -= (size_t)offset; return *this; }
+    friend CircularBufferIterator operator+(CircularBufferIterator it, difference_type offset) noexcept { return it += offset; }
+    friend CircularBufferIterator operator+(difference_type offset, CircularBufferIterator it) noexcept { return it += offset; }
+    friend CircularBufferIterator operator-(CircularBufferIterator it, difference_type offset) noexcept { return it -= offset; }
+    friend difference_type operator-(const CircularBufferIterator& it1, const CircularBufferIterator& it2) noexcept
+    { return (difference_type)(it1._position - it2._position); }
+
+    reference operator*() const noexcept
+    {
+        assert(((_position - _container->_head) < _container->size()) && "Iterator must be valid!");
+        return _container->_buffer[_position & _container->_mask];
+    }
+    pointer operator->() const noexcept { return &operator*(); }
+    reference operator[](difference_type offset) const noexcept { return *(*this + offset); }
+
+    //! Check if the iterator is valid
+    explicit operator bool() const noexcept { return _container != nullptr; }
+
+    //! Swap two instances
+    void swap(CircularBufferIterator& it) noexcept;
+    template <class UContainer, typename U>
+    friend void swap(CircularBufferIterator<UContainer, U>& it1, CircularBufferIterator<UContainer, U>& it2) noexcept;
+
+private:
+    TContainer* _container;
+    size_t _position;
+};
+
+//! Compare circular buffers for equality
+template <typename T, typename TAllocator, typename UAllocator>
+bool operator==(const CircularBuffer<T, TAllocator>& buffer1, const CircularBuffer<T, UAllocator>& buffer2);
+
+/*! \example containers_circular_buffer.cpp Circular buffer container example */
+
+} // namespace CppCommon
+
+#include "circular_buffer.inl"
+
+#endif // CPPCOMMON_CONTAINERS_CIRCULAR_BUFFER_H
@@ -0,0 +1,277 @@
+/*!
+    \file circular_buffer.inl
+    \brief Circular buffer container inline implementation
+    \author Ivan Shynkarenka
+    \date 15.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+template <typename T, typename TAllocator>
+inline CircularBuffer<T, TAllocator>::CircularBuffer(size_t capacity, bool overwrite, const TAllocator& allocator)
+    : _allocator(allocator), _buffer(nullptr), _capacity(0), _mask(0), _head(0), _tail(0), _overwrite(overwrite)
+{
+    allocate(capacity);
+}
+
+template <typename T, typename TAllocator>
+inline CircularBuffer<T, TAllocator>::CircularBuffer(std::initializer_list<T> list, bool overwrite, const TAllocator& allocator)
+    : CircularBuffer(list.size(), overwrite, allocator)
+{
+    for (const auto& item : list)
+        emplace_back(item);
+}
+
+template <typename T, typename TAllocator>
+inline CircularBuffer<T, TAllocator>::CircularBuffer(const CircularBuffer& buffer)
+    : _allocator(std::allocator_traits<TAllocator>::select_on_container_copy_construction(buffer._allocator)), _buffer(nullptr), _capacity(0), _mask(0), _head(0), _tail(0), _overwrite(buffer._overwrite)
+{
+    allocate(buffer._capacity);
+    for (const auto& item : buffer)
+        emplace_back(item);
+}
+
+template <typename T, typename TAllocator>
+inline CircularBuffer<T, TAllocator>::CircularBuffer(CircularBuffer&& buffer) noexcept
+    : _allocator(std::move(buffer._allocator)), _buffer(buffer._buffer), _capacity(buffer._capacity), _mask(buffer._mask), _head(buffer._head), _tail(buffer._tail), _overwrite(buffer._overwrite)
+{
+    buffer._buffer = nullptr;
+    buffer._capacity = 0;
+    buffer._mask = 0;
+    buffer._head = 0;
+    buffer._tail = 0;
+}
+
+template <typename T, typename TAllocator>
+inline CircularBuffer<T, TAllocator>::~CircularBuffer() noexcept
+{
+    deallocate();
+}
+
+template <typename T, typename TAllocator>
+inline CircularBuffer<T, TAllocator>& CircularBuffer<T, TAllocator>::operator=(const CircularBuffer& buffer)
+{
+    if (this == &buffer)
+        return *this;
+
+    CircularBuffer copy(buffer);
+    swap(copy);
+    return *this;
+}
+
+template <typename T, typename TAllocator>
+inline CircularBuffer<T, TAllocator>& CircularBuffer<T, TAllocator>::operator=(CircularBuffer&& buffer) noexcept
+{
+    if (this == &buffer)
+        return *this;
+
+    CircularBuffer temp(std::move(buffer));
+    swap(temp);
+    return *this;
+}
+
+template <typename T, typename TAllocator>
+inline typename CircularBuffer<T, TAllocator>::reference CircularBuffer<T, TAllocator>::at(size_t index)
+{
+    if (index >= size())
+        throw std::out_of_range("Index out of bounds!");
+    return _buffer[(_head + index) & _mask];
+}
+
+template <typename T, typename TAllocator>
+inline typename CircularBuffer<T, TAllocator>::const_reference CircularBuffer<T, TAllocator>::at(size_t index) const
+{
+    if (index >= size())
+        throw std::out_of_range("Index out of bounds!");
+    return _buffer[(_head + index) & _mask];
+}
+
+template <typename T, typename TAllocator>
+inline std::pair<std::span<T>, std::span<T>> CircularBuffer<T, TAllocator>::as_spans() noexcept
+{
+    size_t offset = _head & _mask;
+    size_t first = std::min(size(), _capacity - offset);
+    return std::make_pair(std::span<T>(_buffer + offset, first), std::span<T>(_buffer, size() - first));
+}
+
+template <typename T, typename TAllocator>
+inline std::pair<std::span<const T>, std::span<const T>> CircularBuffer<T, TAllocator>::as_spans() const noexcept
+{
+    size_t offset = _head & _mask;
+    size_t first = std::min(size(), _capacity - offset);
+    return std::make_pair(std::span<const T>(_buffer + offset, first), std::span<const T>(_buffer, size() - first));
+}
+
+template <typename T, typename TAllocator>
+template <typename... Args>
+inline typename CircularBuffer<T, TAllocator>::reference CircularBuffer<T, TAllocator>::emplace_back(Args&&... args)
+{
+    if (full())
+    {
+        if (!_overwrite || (_capacity == 0))
+            throw std::length_error("Circular buffer capacity exceeded!");
+
+        // Construct the new item before dropping the front one, so the
+        // circular buffer is not changed if the constructor throws
+        T item(std::forward<Args>(args)...);
+        T& front = _buffer[_head & _mask];
+        front = std::move(item);
+        ++_head;
+        ++_tail;
+        return front;
+    }
+
+    T* item = std::construct_at(_buffer + (_tail & _mask), std::forward<Args>(args)...);
+    ++_tail;
+    return *item;
+}
+
+template <typename T, typename TAllocator>
+template <typename... Args>
+inline typename CircularBuffer<T, TAllocator>::pointer CircularBuffer<T, TAllocator>::try_emplace_back(Args&&... args)
+{
+    if (full())
+        return nullptr;
+
+    T* item = std::construct_at(_buffer + (_tail & _mask), std::forward<Args>(args)...);
+    ++_tail;
+    return item;
+}
+
+template <typename T, typename TAllocator>
+template <typename... Args>
+inline typename CircularBuffer<T, TAllocator>::reference CircularBuffer<T, TAllocator>::emplace_front(Args&&... args)
+{
+    if (full())
+    {
+        if (!_overwrite || (_capacity == 0))
+            throw std::length_error("Circular buffer capacity exceeded!");
+
+        // Reuse the slot of the back item which is the one before the front item in the full ring
+        T item(std::forward<Args>(args)...);
+        T& back = _buffer[(_tail - 1) & _mask];
+        back = std::move(item);
+        --_head;
+        --_tail;
+        return back;
+    }
+
+    T* item = std::construct_at(_buffer + ((_head - 1) & _mask), std::forward<Args>(args)...);
+    --_head;
+    return *item;
+}
+
+template <typename T, typename TAllocator>
+inline void CircularBuffer<T, TAllocator>::pop_front() noexcept
+{
+    assert(!empty() && "Circular buffer is empty!");
+    std::destroy_at(_buffer + (_head & _mask));
+    ++_head;
+}
+
+template <typename T, typename TAllocator>
+inline void CircularBuffer<T, TAllocator>::pop_front(size_t count) noexcept
+{
+    assert((count <= size()) && "Circular buffer has not enough items!");
+    if constexpr (!std::is_trivially_destructible_v<T>)
+        for (size_t i = 0; i < count; ++i)
+            std::destroy_at(_buffer + ((_head + i) & _mask));
+    _head += count;
+}
+
+template <typename T, typename TAllocator>
+inline void CircularBuffer<T, TAllocator>::pop_back() noexcept
+{
+    assert(!empty() && "Circular buffer is empty!");
+    --_tail;
+    std::destroy_at(_buffer + (_tail & _mask));
+}
+
+template <typename T, typename TAllocator>
+inline void CircularBuffer<T, TAllocator>::pop_back(size_t count) noexcept
+{
+    assert((count <= size()) && "Circular buffer has not enough items!");
+    if constexpr (!std::is_trivially_destructible_v<T>)
+        for (size_t i = 1; i <= count; ++i)
+            std::destroy_at(_buffer + ((_tail - i) & _mask));
+    _tail -= count;
+}
+
+template <typename T, typename TAllocator>
+inline void CircularBuffer<T, TAllocator>::clear() noexcept
+{
+    pop_front(size());
+    _head = _tail = 0;
+}
+
+template <typename T, typename TAllocator>
+inline void CircularBuffer<T, TAllocator>::swap(CircularBuffer& buffer) noexcept
+{
+    using std::swap;
+    if constexpr (std::allocator_traits<TAllocator>::propagate_on_container_swap::value)
+        swap(_allocator, buffer._allocator);
+    swap(_buffer, buffer._buffer);
+    swap(_capacity, buffer._capacity);
+    swap(_mask, buffer._mask);
+    swap(_head, buffer._head);
+    swap(_tail, buffer._tail);
+    swap(_overwrite, buffer._overwrite);
+}
+
+template <typename T, typename TAllocator>
+inline void swap(CircularBuffer<T, TAllocator>& buffer1, CircularBuffer<T, TAllocator>& buffer2) noexcept
+{
+    buffer1.swap(buffer2);
+}
+
+template <typename T, typename TAllocator>
+inline void CircularBuffer<T, TAllocator>::allocate(size_t capacity)
+{
+    if (capacity == 0)
+        return;
+
+    // Round up the capacity to the power of two
+    size_t result = 1;
+    while (result < capacity)
+        result <<= 1;
+
+    _buffer = std::allocator_traits<TAllocator>::allocate(_allocator, result);
+    _capacity = result;
+    _mask = result - 1;
+}
+
+template <typename T, typename TAllocator>
+inline void CircularBuffer<T, TAllocator>::deallocate() noexcept
+{
+    if (_buffer == nullptr)
+        return;
+
+    clear();
+    std::allocator_traits<TAllocator>::deallocate(_allocator, _buffer, _capacity);
+    _buffer = nullptr;
+    _capacity = 0;
+    _mask = 0;
+}
+
+template <class TContainer, typename T>
+inline void CircularBufferIterator<TContainer, T>::swap(CircularBufferIterator& it) noexcept
+{
+    using std::swap;
+    swap(_container, it._container);
+    swap(_position, it._position);
+}
+
+template <class TContainer, typename T>
+inline void swap(CircularBufferIterator<TContainer, T>& it1, CircularBufferIterator<TContainer, T>& it2) noexcept
+{
+    it1.swap(it2);
+}
+
+template <typename T, typename TAllocator, typename UAllocator>
+inline bool operator==(const CircularBuffer<T, TAllocator>& buffer1, const CircularBuffer<T, UAllocator>& buffer2)
+{
+    return std::equal(buffer1.begin(), buffer1.end(), buffer2.begin(), buffer2.end());
+}
+
+} // namespace CppCommon
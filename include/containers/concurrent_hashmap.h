@@ -0,0 +1,178 @@
+/*!
+    \file concurrent_hashmap.h
+    \brief Concurrent hash map container definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_CONTAINERS_CONCURRENT_HASHMAP_H
+#define CPPCOMMON_CONTAINERS_CONCURRENT_HASHMAP_H
+
+#include "containers/hashmap.h"
+#include "threads/rw_lock.h"
+#include "threads/spin_lock.h"
+#include "utility/cache_aligned.h"
+#include "utility/shard_selector.h"
+
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace CppCommon {
+
+//! Concurrent hash map container
+/*!
+    Concurrent hash map stripes items between  several  hash  map  shards  by
+    the key hash. Each shard is guarded by its own lock, so operations with keys
+    from different shards do not contend with each other.
+
+    Shard lock type is selectable: RWLock (default) allows concurrent readers of
+    the same shard, SpinLock is cheaper for short critical sections  with  low
+    contention. Any lock type with Lock()/Unlock() methods is supported,  shared
+    locking is used if the lock type also provides LockRead()/UnlockRead().
+
+    Items are accessed by copy or with visitors called under the shard lock,
+    because references and iterators cannot be safely kept outside of the lock.
+
+    Thread-safe.
+*/
+template <typename TKey, typename TValue, typename THash = FastHash<TKey>, typename TEqual = std::equal_to<TKey>, class TLock = RWLock, typename TAllocator = std::allocator<std::pair<TKey, TValue>>>
+class ConcurrentHashMap
+{
+public:
+    // Standard container type definitions
+    typedef TKey key_type;
+    typedef TValue mapped_type;
+    typedef std::pair<TKey, TValue> value_type;
+    typedef size_t size_type;
+    typedef HashMap<TKey, TValue, THash, TEqual, TAllocator> shard_type;
+
+    //! Initialize the concurrent hash map with a given shards count, capacity and blank key value
+    /*!
+        \param shards - Shards count (will be rounded up to the power of two, default is 16)
+        \param capacity - Initial capacity of each shard (default is 128)
+        \param blank - Blank key value (default is TKey())
+        \param hash - Key hasher (default is THash())
+        \param equal - Key comparator (default is TEqual())
+        \param allocator - Allocator (default is TAllocator())
+    */
+    explicit ConcurrentHashMap(size_t shards = 16, size_t capacity = 128, const TKey& blank = TKey(), const THash& hash = THash(), const TEqual& equal = TEqual(), const TAllocator& allocator = TAllocator());
+    ConcurrentHashMap(const ConcurrentHashMap&) = delete;
+    ConcurrentHashMap(ConcurrentHashMap&&) = delete;
+    ~ConcurrentHashMap() = default;
+
+    ConcurrentHashMap& operator=(const ConcurrentHashMap&) = delete;
+    ConcurrentHashMap& operator=(ConcurrentHashMap&&) = delete;
+
+    //! Check if the concurrent hash map is not empty
+    explicit operator bool() const { return !empty(); }
+
+    //! Is the concurrent hash map empty?
+    bool empty() const { return size() == 0; }
+
+    //! Get the concurrent hash map size
+    /*!
+        Shard map sizes are summed under per-shard read locks, so the result is
+        not a snapshot when items are inserted or erased concurrently.
+    */
+    size_t size() const;
+    //! Get the concurrent hash map shards count
+    size_t shards() const noexcept { return _selector.count(); }
+
+    //! Find the item with the given key and copy its value
+    /*!
+        \param key - Key of the item
+        \param value - Value of the found item
+        \return 'true' if the item was found, 'false' if the item was not found
+    */
+    bool find(const TKey& key, TValue& value) const;
+    //! Check if the concurrent hash map contains the item with the given key
+    /*!
+        \param key - Key of the item
+        \return 'true' if the item was found, 'false' if the item was not found
+    */
+    bool contains(const TKey& key) const;
+
+    //! Insert a new item into the concurrent hash map if its key is not present
+    /*!
+        \param key - Key of the item
+        \param value - Value of the item
+        \return 'true' if the item was inserted, 'false' if the item with the given key is already present
+    */
+    bool insert(const TKey& key, const TValue& value);
+    //! Insert a new item into the concurrent hash map or assign the value of already present item
+    /*!
+        \param key - Key of the item
+        \param value - Value of the item
+        \return 'true' if the item was inserted, 'false' if the value of present item was assigned
+    */
+    bool insert_or_assign(const TKey& key, const TValue& value);
+
+    //! Erase the item with the given key from the concurrent hash map
+    /*!
+        \param key - Key of the item to erase
+        \return 'true' if the item was erased, 'false' if the item was not found
+    */
+    bool erase(const TKey& key);
+
+    //! Visit the item with the given key
+    /*!
+        Visitor is called as visitor(TValue& value) with the shard locked exclusively,
+        so it may modify the value, but must not access the concurrent hash map.
+
+        \param key - Key of the item to visit
+        \param visitor - Visitor function
+        \return 'true' if the item was found and visited, 'false' if the item was not found
+    */
+    template <class TVisitor>
+    bool visit(const TKey& key, TVisitor&& visitor);
+    //! Visit the constant item with the given key
+    /*!
+        Visitor is called as visitor(const TValue& value) with the shard locked for read.
+
+        \param key - Key of the item to visit
+        \param visitor - Visitor function
+        \return 'true' if the item was found and visited, 'false' if the item was not found
+    */
+    template <class TVisitor>
+    bool visit(const TKey& key, TVisitor&& visitor) const;
+    //! Visit all items of the concurrent hash map
+    /*!
+        Visitor is called as visitor(const TKey& key, const TValue& value) for each item.
+        Shards are visited one by one with the shard locked for read.
+
+        \param visitor - Visitor function
+    */
+    template <class TVisitor>
+    void visit_all(TVisitor&& visitor) const;
+
+    //! Clear the concurrent hash map
+    void clear();
+
+private:
+    struct Shard
+    {
+        mutable TLock lock;
+        shard_type map;
+
+        Shard(size_t capacity, const TKey& blank, const THash& hash, const TEqual& equal, const TAllocator& allocator)
+            : map(capacity, blank, hash, equal, allocator)
+        {}
+    };
+
+    THash _hash;
+    ShardSelector _selector;
+    std::vector<std::unique_ptr<CacheAligned<Shard>>> _shards;
+
+    Shard& shard(const TKey& key) const noexcept;
+};
+
+/*! \example containers_concurrent_hashmap.cpp Concurrent hash map container example */
+
+} // namespace CppCommon
+
+#include "concurrent_hashmap.inl"
+
+#endif // CPPCOMMON_CONTAINERS_CONCURRENT_HASHMAP_H
@@ -0,0 +1,198 @@
+/*!
+    \file concurrent_hashmap.inl
+    \brief Concurrent hash map container inline implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+namespace Internals {
+
+//! Does the given lock type provide shared (read) locking?
+template <class TLock, typename = void>
+struct IsSharedLock : std::false_type {};
+
+template <class TLock>
+struct IsSharedLock<TLock, std::void_t<decltype(std::declval<TLock&>().LockRead()), decltype(std::declval<TLock&>().UnlockRead())>> : std::true_type {};
+
+//! Shard locker for read (shared lock if the lock type supports it, exclusive lock otherwise)
+template <class TLock>
+class ConcurrentHashMapReadLocker
+{
+public:
+    explicit ConcurrentHashMapReadLocker(TLock& lock) : _lock(lock)
+    {
+        if constexpr (IsSharedLock<TLock>::value)
+            _lock.LockRead();
+        else
+            _lock.Lock();
+    }
+    ConcurrentHashMapReadLocker(const ConcurrentHashMapReadLocker&) = delete;
+    ConcurrentHashMapReadLocker(ConcurrentHashMapReadLocker&&) = delete;
+    ~ConcurrentHashMapReadLocker()
+    {
+        if constexpr (IsSharedLock<TLock>::value)
+            _lock.UnlockRead();
+        else
+            _lock.Unlock();
+    }
+
+    ConcurrentHashMapReadLocker& operator=(const ConcurrentHashMapReadLocker&) = delete;
+    ConcurrentHashMapReadLocker& operator=(ConcurrentHashMapReadLocker&&) = delete;
+
+private:
+    TLock& _lock;
+};
+
+//! Shard locker for write (always exclusive lock)
+template <class TLock>
+class ConcurrentHashMapWriteLocker
+{
+public:
+    explicit ConcurrentHashMapWriteLocker(TLock& lock) : _lock(lock)
+    {
+        if constexpr (IsSharedLock<TLock>::value)
+            _lock.LockWrite();
+        else
+            _lock.Lock();
+    }
+    ConcurrentHashMapWriteLocker(const ConcurrentHashMapWriteLocker&) = delete;
+    ConcurrentHashMapWriteLocker(ConcurrentHashMapWriteLocker&&) = delete;
+    ~ConcurrentHashMapWriteLocker()
+    {
+        if constexpr (IsSharedLock<TLock>::value)
+            _lock.UnlockWrite();
+        else
+            _lock.Unlock();
+    }
+
+    ConcurrentHashMapWriteLocker& operator=(const ConcurrentHashMapWriteLocker&) = delete;
+    ConcurrentHashMapWriteLocker& operator=(ConcurrentHashMapWriteLocker&&) = delete;
+
+private:
+    TLock& _lock;
+};
+
+} // namespace Internals
+//! @endcond
+
+template <typename TKey, typename TValue, typename THash, typename TEqual, class TLock, typename TAllocator>
+inline ConcurrentHashMap<TKey, TValue, THash, TEqual, TLock, TAllocator>::ConcurrentHashMap(size_t shards, size_t capacity, const TKey& blank, const THash& hash, const TEqual& equal, const TAllocator& allocator)
+    : _hash(hash), _selector(shards)
+{
+    _shards.reserve(_selector.count());
+    for (size_t i = 0; i < _selector.count(); ++i)
+        _shards.emplace_back(std::make_unique<CacheAligned<Shard>>(std::in_place, capacity, blank, hash, equal, allocator));
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual, class TLock, typename TAllocator>
+inline size_t ConcurrentHashMap<TKey, TValue, THash, TEqual, TLock, TAllocator>::size() const
+{
+    size_t result = 0;
+    for (const auto& current : _shards)
+    {
+        Internals::ConcurrentHashMapReadLocker<TLock> locker((*current)->lock);
+        result += (*current)->map.size();
+    }
+    return result;
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual, class TLock, typename TAllocator>
+inline bool ConcurrentHashMap<TKey, TValue, THash, TEqual, TLock, TAllocator>::find(const TKey& key, TValue& value) const
+{
+    return visit(key, [&value](const TValue& item) { value = item; });
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual, class TLock, typename TAllocator>
+inline bool ConcurrentHashMap<TKey, TValue, THash, TEqual, TLock, TAllocator>::contains(const TKey& key) const
+{
+    return visit(key, [](const TValue&) {});
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual, class TLock, typename TAllocator>
+inline bool ConcurrentHashMap<TKey, TValue, THash, TEqual, TLock, TAllocator>::insert(const TKey& key, const TValue& value)
+{
+    Shard& current = shard(key);
+    Internals::ConcurrentHashMapWriteLocker<TLock> locker(current.lock);
+    return current.map.emplace(key, value).second;
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual, class TLock, typename TAllocator>
+inline bool ConcurrentHashMap<TKey, TValue, THash, TEqual, TLock, TAllocator>::insert_or_assign(const TKey& key, const TValue& value)
+{
+    Shard& current = shard(key);
+    Internals::ConcurrentHashMapWriteLocker<TLock> locker(current.lock);
+    auto result = current.map.emplace(key, value);
+    if (!result.second)
+        result.first->second = value;
+    return result.second;
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual, class TLock, typename TAllocator>
+inline bool ConcurrentHashMap<TKey, TValue, THash, TEqual, TLock, TAllocator>::erase(const TKey& key)
+{
+    Shard& current = shard(key);
+    Internals::ConcurrentHashMapWriteLocker<TLock> locker(current.lock);
+    return current.map.erase(key) > 0;
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual, class TLock, typename TAllocator>
+template <class TVisitor>
+inline bool ConcurrentHashMap<TKey, TValue, THash, TEqual, TLock, TAllocator>::visit(const TKey& key, TVisitor&& visitor)
+{
+    Shard& current = shard(key);
+    Internals::ConcurrentHashMapWriteLocker<TLock> locker(current.lock);
+    auto it = current.map.find(key);
+    if (it == current.map.end())
+        return false;
+
+    visitor(it->second);
+    return true;
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual, class TLock, typename TAllocator>
+template <class TVisitor>
+inline bool ConcurrentHashMap<TKey, TValue, THash, TEqual, TLock, TAllocator>::visit(const TKey& key, TVisitor&& visitor) const
+{
+    const Shard& current = shard(key);
+    Internals::ConcurrentHashMapReadLocker<TLock> locker(current.lock);
+    auto it = current.map.find(key);
+    if (it == current.map.end())
+        return false;
+
+    visitor(it->second);
+    return true;
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual, class TLock, typename TAllocator>
+template <class TVisitor>
+inline void ConcurrentHashMap<TKey, TValue, THash, TEqual, TLock, TAllocator>::visit_all(TVisitor&& visitor) const
+{
+    for (const auto& current : _shards)
+    {
+        Internals::ConcurrentHashMapReadLocker<TLock> locker((*current)->lock);
+        for (const auto& item : (*current)->map)
+            visitor(item.first, item.second);
+    }
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual, class TLock, typename TAllocator>
+inline void ConcurrentHashMap<TKey, TValue, THash, TEqual, TLock, TAllocator>::clear()
+{
+    for (auto& current : _shards)
+    {
+        Internals::ConcurrentHashMapWriteLocker<TLock> locker((*current)->lock);
+        (*current)->map.clear();
+    }
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual, class TLock, typename TAllocator>
+inline typename ConcurrentHashMap<TKey, TValue, THash, TEqual, TLock, TAllocator>::Shard& ConcurrentHashMap<TKey, TValue, THash, TEqual, TLock, TAllocator>::shard(const TKey& key) const noexcept
+{
+    return _shards[_selector(_hash(key))]->value();
+}
+
+} // namespace CppCommon
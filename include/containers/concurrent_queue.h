@@ -0,0 +1,115 @@
+/*!
+    \file concurrent_queue.h
+    \brief Intrusive lock-free multiple producers / single consumer concurrent queue container definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_CONTAINERS_CONCURRENT_QUEUE_H
+#define CPPCOMMON_CONTAINERS_CONCURRENT_QUEUE_H
+
+#include "containers/queue.h"
+
+#include <atomic>
+
+namespace CppCommon {
+
+//! Intrusive lock-free multiple producers / single consumer concurrent queue container
+/*!
+    Concurrent queue is the Vyukov's intrusive MPSC queue of items with the
+    same T::next node convention as Queue<T>, so items could be moved from
+    single-threaded queues of producer threads to the consumer thread without
+    any allocation.
+
+    Producers are wait-free: push() is a single atomic exchange of the queue
+    tail followed by linking the previous tail item. The original algorithm
+    keeps a stub node in the empty queue, which is impossible for items of
+    arbitrary type T, so the empty queue is marked with the null tail and
+    the consumer detaches the last item with CAS instead.
+
+    The consumer could see the queue empty while a producer is between the
+    tail exchange and linking of its item, so pop() could return nullptr
+    even if the queue is not empty. The next pop() will return the item.
+
+    FIFO order is guaranteed for items of the same producer!
+
+    Thread-safe (multiple producers threads, single consumer thread).
+
+    C++ implementation of Dmitry Vyukov's intrusive lock free unbound MPSC queue
+    http://www.1024cores.net/home/lock-free-algorithms/queues/intrusive-mpsc-node-based-queue
+*/
+template <typename T>
+class ConcurrentQueue
+{
+public:
+    // Standard container type definitions
+    typedef T value_type;
+    typedef value_type& reference;
+    typedef const value_type& const_reference;
+    typedef value_type* pointer;
+    typedef const value_type* const_pointer;
+    typedef size_t size_type;
+
+    //! Concurrent queue node (the same as the queue node)
+    typedef typename Queue<T>::Node Node;
+
+    ConcurrentQueue() noexcept : _head(nullptr), _tail(nullptr) {}
+    ConcurrentQueue(const ConcurrentQueue&) = delete;
+    ConcurrentQueue(ConcurrentQueue&&) = delete;
+    ~ConcurrentQueue() noexcept = default;
+
+    ConcurrentQueue& operator=(const ConcurrentQueue&) = delete;
+    ConcurrentQueue& operator=(ConcurrentQueue&&) = delete;
+
+    //! Check if the queue is not empty
+    explicit operator bool() const noexcept { return !empty(); }
+
+    //! Is the queue empty?
+    bool empty() const noexcept { return _tail.load(std::memory_order_acquire) == nullptr; }
+
+    //! Push a new item into the back of the queue (multiple producers threads method)
+    /*!
+        Will not block.
+
+        \param item - Pushed item
+    */
+    void push(T& item) noexcept;
+    //! Push all items of the given queue into the back of the concurrent queue (multiple producers threads method)
+    /*!
+        Items are pushed with a single atomic exchange and keep their order.
+
+        Will not block.
+
+        \param queue - Queue of pushed items (will be cleared)
+    */
+    void push(Queue<T>& queue) noexcept;
+
+    //! Pop the item from the front of the queue (single consumer thread method)
+    /*!
+        Will not block.
+
+        \return The front item popped from the queue or nullptr if the queue is empty or the next item is not linked yet
+    */
+    T* pop() noexcept;
+
+private:
+    typedef char cache_line_pad[128];
+
+    cache_line_pad _pad0;
+    std::atomic<T*> _head;
+    cache_line_pad _pad1;
+    std::atomic<T*> _tail;
+    cache_line_pad _pad2;
+
+    //! Link the given items chain after the previous queue tail
+    void Link(T* first, T* last) noexcept;
+};
+
+/*! \example containers_concurrent_queue.cpp Intrusive lock-free multiple producers / single consumer concurrent queue container example */
+
+} // namespace CppCommon
+
+#include "concurrent_queue.inl"
+
+#endif // CPPCOMMON_CONTAINERS_CONCURRENT_QUEUE_H
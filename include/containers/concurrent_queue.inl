@@ -0,0 +1,72 @@
+/*!
+    \file concurrent_queue.inl
+    \brief Intrusive lock-free multiple producers / single consumer concurrent queue container inline implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+template <typename T>
+inline void ConcurrentQueue<T>::push(T& item) noexcept
+{
+    Link(&item, &item);
+}
+
+template <typename T>
+inline void ConcurrentQueue<T>::push(Queue<T>& queue) noexcept
+{
+    T* first = queue.front();
+    if (first == nullptr)
+        return;
+
+    Link(first, queue.back());
+    queue.clear();
+}
+
+template <typename T>
+inline void ConcurrentQueue<T>::Link(T* first, T* last) noexcept
+{
+    std::atomic_ref<T*>(last->next).store(nullptr, std::memory_order_relaxed);
+
+    // Publish the chain as the new queue tail and link it after the previous one
+    T* prev = _tail.exchange(last, std::memory_order_acq_rel);
+    if (prev != nullptr)
+        std::atomic_ref<T*>(prev->next).store(first, std::memory_order_release);
+    else
+        _head.store(first, std::memory_order_release);
+}
+
+template <typename T>
+inline T* ConcurrentQueue<T>::pop() noexcept
+{
+    T* head = _head.load(std::memory_order_acquire);
+    if (head == nullptr)
+        return nullptr;
+
+    T* next = std::atomic_ref<T*>(head->next).load(std::memory_order_acquire);
+    if (next == nullptr)
+    {
+        // Try to detach the last item from the queue tail
+        T* last = head;
+        if (_tail.compare_exchange_strong(last, nullptr, std::memory_order_acq_rel, std::memory_order_acquire))
+        {
+            // The producer which found the empty queue could already publish the new head
+            T* front = head;
+            _head.compare_exchange_strong(front, nullptr, std::memory_order_acq_rel, std::memory_order_relaxed);
+            return head;
+        }
+
+        // The producer has exchanged the queue tail, but has not linked its item yet
+        next = std::atomic_ref<T*>(head->next).load(std::memory_order_acquire);
+        if (next == nullptr)
+            return nullptr;
+    }
+
+    _head.store(next, std::memory_order_relaxed);
+    std::atomic_ref<T*>(head->next).store(nullptr, std::memory_order_relaxed);
+    return head;
+}
+
+} // namespace CppCommon
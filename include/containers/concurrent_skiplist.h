@@ -0,0 +1,217 @@
+/*!
+    \file concurrent_skiplist.h
+    \brief Concurrent lock-free skip list container definition
+    \author Ivan Shynkarenka
+    \date 15.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_CONTAINERS_CONCURRENT_SKIPLIST_H
+#define CPPCOMMON_CONTAINERS_CONCURRENT_SKIPLIST_H
+
+#include "threads/epoch_reclamation.h"
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <new>
+#include <utility>
+
+namespace CppCommon {
+
+//! Concurrent lock-free skip list container
+/*!
+    Concurrent skip list is an ordered map with lock-free insert and erase
+    operations and wait-free lookups. Ordered iteration, lower bound searches
+    and range scans are safe alongside concurrent inserts and erases.
+
+    Each node is linked into several levels of sorted linked lists. Erased
+    node is first logically deleted by marking its links (top level first,
+    the bottom level last), then it is physically unlinked by any following
+    search. Lookups and scans never modify the skip list and skip marked
+    nodes. Unlinked nodes are retired into the epoch reclamation domain, so
+    concurrent readers never access the deleted memory.
+
+    Item values are immutable once inserted. Items are accessed by copy or
+    with visitors called inside the epoch critical section, because
+    references cannot be safely kept outside of it. Scans observe each item
+    which is present during the whole scan and may or may not observe items
+    inserted or erased concurrently.
+
+    Thread-safe.
+
+    Lock-free linked list by Timothy L. Harris and lock-free skip list by
+    Maurice Herlihy and Nir Shavit
+    https://www.microsoft.com/en-us/research/wp-content/uploads/2001/10/2001-disc.pdf
+*/
+template <typename TKey, typename TValue, typename TCompare = std::less<TKey>>
+class ConcurrentSkipList
+{
+public:
+    // Standard container type definitions
+    typedef TKey key_type;
+    typedef TValue mapped_type;
+    typedef std::pair<TKey, TValue> value_type;
+    typedef size_t size_type;
+    typedef TCompare key_compare;
+
+    //! Max height of the skip list
+    static constexpr size_t MAX_HEIGHT = 32;
+
+    //! Initialize the concurrent skip list with a given key comparator
+    /*!
+        \param compare - Key comparator (default is TCompare())
+    */
+    explicit ConcurrentSkipList(const TCompare& compare = TCompare());
+    ConcurrentSkipList(const ConcurrentSkipList&) = delete;
+    ConcurrentSkipList(ConcurrentSkipList&&) = delete;
+    ~ConcurrentSkipList();
+
+    ConcurrentSkipList& operator=(const ConcurrentSkipList&) = delete;
+    ConcurrentSkipList& operator=(ConcurrentSkipList&&) = delete;
+
+    //! Check if the concurrent skip list is not empty
+    explicit operator bool() const noexcept { return !empty(); }
+
+    //! Is the concurrent skip list empty?
+    bool empty() const noexcept { return (size() == 0); }
+
+    //! Get the concurrent skip list size
+    /*!
+        The result is approximate under concurrent modifications.
+    */
+    size_t size() const noexcept { return _size.load(std::memory_order_relaxed); }
+
+    //! Get the key comparator
+    key_compare compare() const { return _compare; }
+    //! Get the epoch reclamation domain of the skip list nodes
+    EpochReclamation& reclamation() noexcept { return _reclamation; }
+
+    //! Find the item with the given key and copy its value
+    /*!
+        \param key - Key of the item
+        \param value - Value of the found item
+        \return 'true' if the item was found, 'false' if the item was not found
+    */
+    bool find(const TKey& key, TValue& value) const;
+    //! Check if the concurrent skip list contains the item with the given key
+    /*!
+        \param key - Key of the item
+        \return 'true' if the item was found, 'false' if the item was not found
+    */
+    bool contains(const TKey& key) const;
+
+    //! Find the first item which key is not less than the given key and copy it
+    /*!
+        \param key - Key to search
+        \param item - Found item
+        \return 'true' if the item was found, 'false' if all keys are less than the given key
+    */
+    bool lower_bound(const TKey& key, value_type& item) const;
+
+    //! Insert a new item into the concurrent skip list if its key is not present
+    /*!
+        \param key - Key of the item
+        \param value - Value of the item
+        \return 'true' if the item was inserted, 'false' if the item with the given key is already present
+    */
+    bool insert(const TKey& key, const TValue& value);
+
+    //! Erase the item with the given key from the concurrent skip list
+    /*!
+        \param key - Key of the item to erase
+        \return 'true' if the item was erased, 'false' if the item was not found
+    */
+    bool erase(const TKey& key);
+
+    //! Visit the item with the given key
+    /*!
+        Visitor is called as visitor(const TValue& value) inside the epoch critical section.
+
+        \param key - Key of the item to visit
+        \param visitor - Visitor function
+        \return 'true' if the item was found and visited, 'false' if the item was not found
+    */
+    template <class TVisitor>
+    bool visit(const TKey& key, TVisitor&& visitor) const;
+    //! Visit items in the given range of keys in the key order
+    /*!
+        Visitor is called as visitor(const TKey& key, const TValue& value) for each
+        item which key is in [first, last) range inside the epoch critical section.
+
+        \param first - First key of the range
+        \param last - Last key of the range (excluded)
+        \param visitor - Visitor function
+        \return Count of visited items
+    */
+    template <class TVisitor>
+    size_t visit_range(const TKey& first, const TKey& last, TVisitor&& visitor) const;
+    //! Visit all items of the concurrent skip list in the key order
+    /*!
+        Visitor is called as visitor(const TKey& key, const TValue& value) for each
+        item inside the epoch critical section.
+
+        \param visitor - Visitor function
+        \return Count of visited items
+    */
+    template <class TVisitor>
+    size_t visit_all(TVisitor&& visitor) const;
+
+    //! Clear the concurrent skip list
+    /*!
+        Items are erased one by one, so items inserted concurrently may remain.
+    */
+    void clear();
+
+private:
+    // Node is followed by its links of all levels, each link is tagged
+    // with the lowest bit when the node is logically deleted
+    struct Node
+    {
+        std::atomic<size_t> refs;
+        size_t height;
+        union { value_type item; };
+
+        explicit Node(size_t h) noexcept : refs(2), height(h) {}
+        ~Node() {}
+
+        std::atomic<uintptr_t>& next(size_t level) noexcept { return reinterpret_cast<std::atomic<uintptr_t>*>(this + 1)[level]; }
+    };
+
+    TCompare _compare;
+    Node* _head;
+    std::atomic<size_t> _size;
+    mutable EpochReclamation _reclamation;
+
+    static bool marked(uintptr_t link) noexcept { return (link & 1) != 0; }
+    static Node* unmarked(uintptr_t link) noexcept { return (Node*)(link & ~(uintptr_t)1); }
+
+    //! Get the random height of a new node
+    static size_t RandomHeight() noexcept;
+
+    //! Create a new node with the given height
+    static Node* CreateNode(size_t height);
+    //! Destroy the node
+    static void DestroyNode(Node* node, bool item) noexcept;
+
+    //! Find predecessors and successors of the given key on all levels and unlink marked nodes
+    /*!
+        \return 'true' if the bottom level successor has the given key
+    */
+    bool Search(const TKey& key, Node** preds, Node** succs);
+    //! Find the first not marked node which key is not less than the given key (no modifications)
+    Node* LowerBound(const TKey& key) const noexcept;
+    //! Find the next not marked node on the bottom level (no modifications)
+    static Node* Next(Node* node) noexcept;
+
+    //! Release the node reference by the inserting or erasing thread and retire the node by the last one
+    void Release(Node* node);
+};
+
+/*! \example containers_concurrent_skiplist.cpp Concurrent lock-free skip list container example */
+
+} // namespace CppCommon
+
+#include "concurrent_skiplist.inl"
+
+#endif // CPPCOMMON_CONTAINERS_CONCURRENT_SKIPLIST_H
@@ -0,0 +1,367 @@
+/*!
+    \file concurrent_skiplist.inl
+    \brief Concurrent lock-free skip list container inline implementation
+    \author Ivan Shynkarenka
+    \date 15.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+template <typename TKey, typename TValue, typename TCompare>
+inline ConcurrentSkipList<TKey, TValue, TCompare>::ConcurrentSkipList(const TCompare& compare)
+    : _compare(compare), _head(CreateNode(MAX_HEIGHT)), _size(0), _reclamation(0, 64)
+{
+}
+
+template <typename TKey, typename TValue, typename TCompare>
+inline ConcurrentSkipList<TKey, TValue, TCompare>::~ConcurrentSkipList()
+{
+    // Destroy all linked nodes
+    Node* node = unmarked(_head->next(0).load(std::memory_order_relaxed));
+    while (node != nullptr)
+    {
+        Node* next = unmarked(node->next(0).load(std::memory_order_relaxed));
+        DestroyNode(node, true);
+        node = next;
+    }
+    DestroyNode(_head, false);
+
+    // Destroy all retired nodes
+    _reclamation.Synchronize();
+}
+
+template <typename TKey, typename TValue, typename TCompare>
+inline bool ConcurrentSkipList<TKey, TValue, TCompare>::find(const TKey& key, TValue& value) const
+{
+    return visit(key, [&value](const TValue& item) { value = item; });
+}
+
+template <typename TKey, typename TValue, typename TCompare>
+inline bool ConcurrentSkipList<TKey, TValue, TCompare>::contains(const TKey& key) const
+{
+    return visit(key, [](const TValue&) {});
+}
+
+template <typename TKey, typename TValue, typename TCompare>
+inline bool ConcurrentSkipList<TKey, TValue, TCompare>::lower_bound(const TKey& key, value_type& item) const
+{
+    EpochReclamation::Guard guard(_reclamation);
+
+    Node* node = LowerBound(key);
+    if (node == nullptr)
+        return false;
+
+    item = node->item;
+    return true;
+}
+
+template <typename TKey, typename TValue, typename TCompare>
+inline bool ConcurrentSkipList<TKey, TValue, TCompare>::insert(const TKey& key, const TValue& value)
+{
+    Node* preds[MAX_HEIGHT];
+    Node* succs[MAX_HEIGHT];
+
+    const size_t height = RandomHeight();
+    Node* node = nullptr;
+
+    EpochReclamation::Guard guard(_reclamation);
+
+    // Link the node into the bottom level, which makes it present in the skip list
+    for (;;)
+    {
+        if (Search(key, preds, succs))
+        {
+            // Not published node is destroyed immediately
+            if (node != nullptr)
+                DestroyNode(node, true);
+            return false;
+        }
+
+        if (node == nullptr)
+        {
+            node = CreateNode(height);
+            try
+            {
+                new (&node->item) value_type(key, value);
+            }
+            catch (...)
+            {
+                DestroyNode(node, false);
+                throw;
+            }
+        }
+
+        for (size_t level = 0; level < height; ++level)
+            node->next(level).store((uintptr_t)succs[level], std::memory_order_relaxed);
+
+        uintptr_t expected = (uintptr_t)succs[0];
+        if (preds[0]->next(0).compare_exchange_strong(expected, (uintptr_t)node, std::memory_order_release, std::memory_order_relaxed))
+            break;
+    }
+
+    _size.fetch_add(1, std::memory_order_relaxed);
+
+    // Link upper levels one by one until the node is erased
+    bool erased = false;
+    for (size_t level = 1; (level < height) && !erased; ++level)
+    {
+        for (;;)
+        {
+            uintptr_t succ = node->next(level).load(std::memory_order_acquire);
+            if (marked(succ))
+            {
+                erased = true;
+                break;
+            }
+
+            // Point the node to the current successor
+            if ((succ != (uintptr_t)succs[level]) && !node->next(level).compare_exchange_strong(succ, (uintptr_t)succs[level], std::memory_order_acq_rel, std::memory_order_acquire))
+                continue;
+
+            uintptr_t expected = (uintptr_t)succs[level];
+            if (preds[level]->next(level).compare_exchange_strong(expected, (uintptr_t)node, std::memory_order_release, std::memory_order_relaxed))
+                break;
+
+            // Predecessors were changed, so find them again
+            Search(key, preds, succs);
+            if (succs[0] != node)
+            {
+                erased = true;
+                break;
+            }
+        }
+    }
+
+    Release(node);
+    return true;
+}
+
+template <typename TKey, typename TValue, typename TCompare>
+inline bool ConcurrentSkipList<TKey, TValue, TCompare>::erase(const TKey& key)
+{
+    Node* preds[MAX_HEIGHT];
+    Node* succs[MAX_HEIGHT];
+
+    EpochReclamation::Guard guard(_reclamation);
+
+    for (;;)
+    {
+        if (!Search(key, preds, succs))
+            return false;
+
+        Node* node = succs[0];
+
+        // Mark upper levels from the top one
+        for (size_t level = node->height - 1; level > 0; --level)
+        {
+            uintptr_t succ = node->next(level).load(std::memory_order_acquire);
+            while (!marked(succ))
+                node->next(level).compare_exchange_weak(succ, succ | 1, std::memory_order_acq_rel, std::memory_order_acquire);
+        }
+
+        // Mark the bottom level, the thread which marks it erases the item
+        uintptr_t succ = node->next(0).load(std::memory_order_acquire);
+        while (!marked(succ))
+        {
+            if (node->next(0).compare_exchange_weak(succ, succ | 1, std::memory_order_acq_rel, std::memory_order_acquire))
+            {
+                _size.fetch_sub(1, std::memory_order_relaxed);
+                Release(node);
+                return true;
+            }
+        }
+
+        // The item was erased by another thread, so search for the key again
+    }
+}
+
+template <typename TKey, typename TValue, typename TCompare>
+template <class TVisitor>
+inline bool ConcurrentSkipList<TKey, TValue, TCompare>::visit(const TKey& key, TVisitor&& visitor) const
+{
+    EpochReclamation::Guard guard(_reclamation);
+
+    Node* node = LowerBound(key);
+    if ((node == nullptr) || _compare(key, node->item.first))
+        return false;
+
+    visitor((const TValue&)node->item.second);
+    return true;
+}
+
+template <typename TKey, typename TValue, typename TCompare>
+template <class TVisitor>
+inline size_t ConcurrentSkipList<TKey, TValue, TCompare>::visit_range(const TKey& first, const TKey& last, TVisitor&& visitor) const
+{
+    EpochReclamation::Guard guard(_reclamation);
+
+    size_t count = 0;
+    for (Node* node = LowerBound(first); (node != nullptr) && _compare(node->item.first, last); node = Next(node), ++count)
+        visitor((const TKey&)node->item.first, (const TValue&)node->item.second);
+    return count;
+}
+
+template <typename TKey, typename TValue, typename TCompare>
+template <class TVisitor>
+inline size_t ConcurrentSkipList<TKey, TValue, TCompare>::visit_all(TVisitor&& visitor) const
+{
+    EpochReclamation::Guard guard(_reclamation);
+
+    size_t count = 0;
+    for (Node* node = Next(_head); node != nullptr; node = Next(node), ++count)
+        visitor((const TKey&)node->item.first, (const TValue&)node->item.second);
+    return count;
+}
+
+template <typename TKey, typename TValue, typename TCompare>
+inline void ConcurrentSkipList<TKey, TValue, TCompare>::clear()
+{
+    for (;;)
+    {
+        EpochReclamation::Guard guard(_reclamation);
+
+        Node* node = Next(_head);
+        if (node == nullptr)
+            return;
+
+        erase(node->item.first);
+    }
+}
+
+template <typename TKey, typename TValue, typename TCompare>
+inline size_t ConcurrentSkipList<TKey, TValue, TCompare>::RandomHeight() noexcept
+{
+    // Each next level is taken with 1/2 probability
+    thread_local uint64_t random = (uint64_t)(uintptr_t)&random | 1;
+    random ^= random << 13;
+    random ^= random >> 7;
+    random ^= random << 17;
+
+    size_t height = 1;
+    for (uint64_t bits = random; ((bits & 1) != 0) && (height < MAX_HEIGHT); bits >>= 1)
+        ++height;
+    return height;
+}
+
+template <typename TKey, typename TValue, typename TCompare>
+inline typename ConcurrentSkipList<TKey, TValue, TCompare>::Node* ConcurrentSkipList<TKey, TValue, TCompare>::CreateNode(size_t height)
+{
+    void* memory = ::operator new(sizeof(Node) + height * sizeof(std::atomic<uintptr_t>));
+    Node* node = new (memory) Node(height);
+    for (size_t level = 0; level < height; ++level)
+        new (&node->next(level)) std::atomic<uintptr_t>(0);
+    return node;
+}
+
+template <typename TKey, typename TValue, typename TCompare>
+inline void ConcurrentSkipList<TKey, TValue, TCompare>::DestroyNode(Node* node, bool item) noexcept
+{
+    if (item)
+        node->item.~value_type();
+    node->~Node();
+    ::operator delete(node);
+}
+
+template <typename TKey, typename TValue, typename TCompare>
+inline bool ConcurrentSkipList<TKey, TValue, TCompare>::Search(const TKey& key, Node** preds, Node** succs)
+{
+    bool retry;
+    do
+    {
+        retry = false;
+
+        Node* pred = _head;
+        for (size_t level = MAX_HEIGHT; (level-- > 0) && !retry;)
+        {
+            Node* curr = unmarked(pred->next(level).load(std::memory_order_acquire));
+            while (curr != nullptr)
+            {
+                uintptr_t succ = curr->next(level).load(std::memory_order_acquire);
+
+                // Unlink the marked node, restart if the predecessor was changed
+                if (marked(succ))
+                {
+                    uintptr_t expected = (uintptr_t)curr;
+                    if (!pred->next(level).compare_exchange_strong(expected, succ & ~(uintptr_t)1, std::memory_order_acq_rel, std::memory_order_acquire))
+                    {
+                        retry = true;
+                        break;
+                    }
+                    curr = unmarked(succ);
+                    continue;
+                }
+
+                if (!_compare(curr->item.first, key))
+                    break;
+
+                pred = curr;
+                curr = unmarked(succ);
+            }
+
+            preds[level] = pred;
+            succs[level] = curr;
+        }
+    } while (retry);
+
+    return (succs[0] != nullptr) && !_compare(key, succs[0]->item.first);
+}
+
+template <typename TKey, typename TValue, typename TCompare>
+inline typename ConcurrentSkipList<TKey, TValue, TCompare>::Node* ConcurrentSkipList<TKey, TValue, TCompare>::LowerBound(const TKey& key) const noexcept
+{
+    Node* pred = _head;
+    Node* curr = nullptr;
+    for (size_t level = MAX_HEIGHT; level-- > 0;)
+    {
+        curr = unmarked(pred->next(level).load(std::memory_order_acquire));
+        while (curr != nullptr)
+        {
+            uintptr_t succ = curr->next(level).load(std::memory_order_acquire);
+
+            // Skip the marked node
+            if (marked(succ))
+            {
+                curr = unmarked(succ);
+                continue;
+            }
+
+            if (!_compare(curr->item.first, key))
+                break;
+
+            pred = curr;
+            curr = unmarked(succ);
+        }
+    }
+    return curr;
+}
+
+template <typename TKey, typename TValue, typename TCompare>
+inline typename ConcurrentSkipList<TKey, TValue, TCompare>::Node* ConcurrentSkipList<TKey, TValue, TCompare>::Next(Node* node) noexcept
+{
+    Node* curr = unmarked(node->next(0).load(std::memory_order_acquire));
+    while (curr != nullptr)
+    {
+        uintptr_t succ = curr->next(0).load(std::memory_order_acquire);
+        if (!marked(succ))
+            return curr;
+        curr = unmarked(succ);
+    }
+    return nullptr;
+}
+
+template <typename TKey, typename TValue, typename TCompare>
+inline void ConcurrentSkipList<TKey, TValue, TCompare>::Release(Node* node)
+{
+    if (node->refs.fetch_sub(1, std::memory_order_acq_rel) != 1)
+        return;
+
+    // Insertion and erasing are finished, so the last search unlinks the node from all levels
+    Node* preds[MAX_HEIGHT];
+    Node* succs[MAX_HEIGHT];
+    Search(node->item.first, preds, succs);
+
+    _reclamation.Retire(node, [](Node* n) { DestroyNode(n, true); });
+}
+
+} // namespace CppCommon
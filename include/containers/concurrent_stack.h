@@ -0,0 +1,130 @@
+/*!
+    \file concurrent_stack.h
+    \brief Intrusive lock-free concurrent stack container definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_CONTAINERS_CONCURRENT_STACK_H
+#define CPPCOMMON_CONTAINERS_CONCURRENT_STACK_H
+
+#include "containers/stack.h"
+
+#include <atomic>
+#include <cstdint>
+
+namespace CppCommon {
+
+//! Intrusive lock-free concurrent stack container
+/*!
+    Concurrent stack is the Treiber stack of intrusive items with the same
+    T::next node convention as Stack<T>, so items could be moved between
+    single-threaded stacks of different threads through the concurrent stack
+    without any allocation.
+
+    The stack head packs the top item pointer together with the modification
+    tag into a single 64-bit word, so pop() detects ABA problem with an
+    ordinary 64-bit CAS. On 64-bit platforms pointers occupy lower 48 bits of
+    the canonical user space address and the tag takes the remaining 16 bits.
+
+    Popping threads could read the next pointer of the item which is already
+    popped by the other thread, so memory of items must stay valid while the
+    stack is used (e.g. items from object pools or long-lived items). Such a
+    stale read always fails the following CAS. The stack links and reads next
+    pointers through std::atomic_ref, so the stale read is not a data race.
+
+    Thread-safe.
+
+    https://en.wikipedia.org/wiki/Treiber_stack
+*/
+template <typename T>
+class ConcurrentStack
+{
+public:
+    // Standard container type definitions
+    typedef T value_type;
+    typedef value_type& reference;
+    typedef const value_type& const_reference;
+    typedef value_type* pointer;
+    typedef const value_type* const_pointer;
+    typedef size_t size_type;
+
+    //! Concurrent stack node (the same as the stack node)
+    typedef typename Stack<T>::Node Node;
+
+    ConcurrentStack() noexcept : _head(0) {}
+    ConcurrentStack(const ConcurrentStack&) = delete;
+    ConcurrentStack(ConcurrentStack&&) = delete;
+    ~ConcurrentStack() noexcept = default;
+
+    ConcurrentStack& operator=(const ConcurrentStack&) = delete;
+    ConcurrentStack& operator=(ConcurrentStack&&) = delete;
+
+    //! Check if the stack is not empty
+    explicit operator bool() const noexcept { return !empty(); }
+
+    //! Is the stack empty?
+    bool empty() const noexcept { return Pointer(_head.load(std::memory_order_acquire)) == nullptr; }
+
+    //! Push a new item into the top of the stack
+    /*!
+        Will not block.
+
+        \param item - Pushed item
+    */
+    void push(T& item) noexcept;
+    //! Push all items of the given stack into the top of the concurrent stack
+    /*!
+        Items are pushed with a single CAS and keep their order, so the top
+        item of the given stack becomes the top item of the concurrent stack.
+
+        Will not block.
+
+        \param stack - Stack of pushed items (will be cleared)
+    */
+    void push(Stack<T>& stack) noexcept;
+
+    //! Pop the item from the top of the stack
+    /*!
+        Will not block.
+
+        \return The top item popped from the stack or nullptr if the stack is empty
+    */
+    T* pop() noexcept;
+    //! Pop all items from the stack
+    /*!
+        Items are popped with a CAS loop which also bumps the modification
+        tag of the stack head, and keep their order.
+
+        Will not block.
+
+        \return Stack of popped items
+    */
+    Stack<T> pop_all() noexcept;
+
+private:
+    static constexpr unsigned POINTER_BITS = (sizeof(void*) == 8) ? 48 : 32;
+    static constexpr uint64_t POINTER_MASK = (((uint64_t)1) << POINTER_BITS) - 1;
+
+    typedef char cache_line_pad[128];
+
+    std::atomic<uint64_t> _head;
+    cache_line_pad _pad;
+
+    //! Unpack the top item pointer from the stack head
+    static T* Pointer(uint64_t head) noexcept { return (T*)(uintptr_t)(head & POINTER_MASK); }
+    //! Pack the stack head with the next modification tag and the given top item pointer
+    static uint64_t Head(uint64_t head, T* top) noexcept { return (((head >> POINTER_BITS) + 1) << POINTER_BITS) | ((uint64_t)(uintptr_t)top & POINTER_MASK); }
+
+    //! Link the given item to the next one
+    static void Link(T* item, T* next) noexcept { std::atomic_ref<T*>(item->next).store(next, std::memory_order_relaxed); }
+};
+
+/*! \example containers_concurrent_stack.cpp Intrusive lock-free concurrent stack container example */
+
+} // namespace CppCommon
+
+#include "concurrent_stack.inl"
+
+#endif // CPPCOMMON_CONTAINERS_CONCURRENT_STACK_H
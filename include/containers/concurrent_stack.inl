@@ -0,0 +1,84 @@
+/*!
+    \file concurrent_stack.inl
+    \brief Intrusive lock-free concurrent stack container inline implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+template <typename T>
+inline void ConcurrentStack<T>::push(T& item) noexcept
+{
+    assert((((uint64_t)(uintptr_t)&item) & ~POINTER_MASK) == 0 && "Item address does not fit into the stack head!");
+
+    uint64_t head = _head.load(std::memory_order_relaxed);
+    do
+    {
+        Link(&item, Pointer(head));
+    } while (!_head.compare_exchange_weak(head, Head(head, &item), std::memory_order_release, std::memory_order_relaxed));
+}
+
+template <typename T>
+inline void ConcurrentStack<T>::push(Stack<T>& stack) noexcept
+{
+    T* first = stack.top();
+    if (first == nullptr)
+        return;
+
+    // Find the bottom item of the given stack
+    T* last = first;
+    while (last->next != nullptr)
+        last = last->next;
+
+    uint64_t head = _head.load(std::memory_order_relaxed);
+    do
+    {
+        Link(last, Pointer(head));
+    } while (!_head.compare_exchange_weak(head, Head(head, first), std::memory_order_release, std::memory_order_relaxed));
+
+    stack.clear();
+}
+
+template <typename T>
+inline T* ConcurrentStack<T>::pop() noexcept
+{
+    uint64_t head = _head.load(std::memory_order_acquire);
+    for (;;)
+    {
+        T* top = Pointer(head);
+        if (top == nullptr)
+            return nullptr;
+
+        // The top item could be concurrently popped and pushed again,
+        // the modification tag will fail CAS with the stale next pointer
+        T* next = std::atomic_ref<T*>(top->next).load(std::memory_order_relaxed);
+        if (_head.compare_exchange_weak(head, Head(head, next), std::memory_order_acquire, std::memory_order_acquire))
+        {
+            Link(top, nullptr);
+            return top;
+        }
+    }
+}
+
+template <typename T>
+inline Stack<T> ConcurrentStack<T>::pop_all() noexcept
+{
+    uint64_t head = _head.load(std::memory_order_relaxed);
+    while (!_head.compare_exchange_weak(head, Head(head, nullptr), std::memory_order_acquire, std::memory_order_relaxed));
+
+    // Collect popped items in the reversed order and restore it
+    Stack<T> result;
+    T* current = Pointer(head);
+    while (current != nullptr)
+    {
+        T* next = current->next;
+        result.push(*current);
+        current = next;
+    }
+    result.reverse();
+    return result;
+}
+
+} // namespace CppCommon
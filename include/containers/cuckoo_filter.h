@@ -0,0 +1,192 @@
+/*!
+    \file cuckoo_filter.h
+    \brief Cuckoo filter container definition
+    \author Ivan Shynkarenka
+    \date 15.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_CONTAINERS_CUCKOO_FILTER_H
+#define CPPCOMMON_CONTAINERS_CUCKOO_FILTER_H
+
+#include "algorithms/hash.h"
+#include "common/writer.h"
+#include "threads/rw_lock.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace CppCommon {
+
+//! Cuckoo filter container
+/*!
+    Cuckoo filter answers whether the key was possibly added or was definitely
+    not added like the Bloom filter, but also supports removing of previously
+    added keys. It stores 16-bit fingerprints of keys in the cuckoo hash table
+    of 4-slot buckets (one 64-bit word per bucket), so each key could be found
+    in one of two buckets. Both buckets are searched without branches with
+    SWAR (SIMD within a register) comparison of all 4 slots at once.
+
+    False positive probability is about 8 / 65536 = 0.012% regardless of the
+    load factor. Filter is considered full when a new fingerprint could not be
+    placed after MAX_KICKS relocations, typically at 95% load factor.
+
+    Removing of the key which was never added might remove the fingerprint of
+    another key and lead to false negatives, so only added keys must be removed.
+    Adding the same key more than 8 times fills both of its buckets.
+
+    Filter could be serialized into File (or any other Writer) and deserialized
+    from the memory buffer (e.g. MappedFile::bytes()).
+
+    Not thread-safe, except AddConcurrent(), RemoveConcurrent() and
+    ContainsConcurrent() methods which are synchronized with the internal
+    read/write lock.
+
+    https://www.cs.cmu.edu/~dga/papers/cuckoo-conext2014.pdf
+*/
+class CuckooFilter
+{
+public:
+    //! Count of fingerprints in the bucket
+    static const size_t BUCKET_SIZE = 4;
+    //! Maximal count of fingerprint relocations before the filter is full
+    static const size_t MAX_KICKS = 500;
+
+    //! Initialize the cuckoo filter for the given count of keys
+    /*!
+        \param capacity - Expected count of keys (default is 1024)
+    */
+    explicit CuckooFilter(size_t capacity = 1024);
+    CuckooFilter(const CuckooFilter& filter);
+    CuckooFilter(CuckooFilter&& filter) noexcept;
+    ~CuckooFilter() = default;
+
+    CuckooFilter& operator=(const CuckooFilter& filter);
+    CuckooFilter& operator=(CuckooFilter&& filter) noexcept;
+
+    //! Check if the cuckoo filter is not empty
+    explicit operator bool() const noexcept { return !empty(); }
+
+    //! Is the cuckoo filter empty?
+    bool empty() const noexcept { return (_size == 0); }
+
+    //! Get the count of buckets
+    size_t buckets() const noexcept { return _buckets.size(); }
+    //! Get the cuckoo filter size in bytes
+    size_t bytes() const noexcept { return _buckets.size() * sizeof(uint64_t); }
+    //! Get the maximal count of fingerprints
+    size_t capacity() const noexcept { return _buckets.size() * BUCKET_SIZE; }
+    //! Get the count of stored fingerprints
+    size_t size() const noexcept { return _size; }
+    //! Get the load factor
+    double load_factor() const noexcept { return (double)_size / (double)capacity(); }
+
+    //! Add the given key
+    /*!
+        \param key - Key to add
+        \param hash - Key hasher (default is THash())
+        \return 'true' if the key was added, 'false' if the cuckoo filter is full
+    */
+    template <typename TKey, typename THash = FastHash<TKey>>
+    bool Add(const TKey& key, const THash& hash = THash()) noexcept
+    { return AddHash((uint64_t)hash(key)); }
+    //! Add the given key (thread-safe)
+    template <typename TKey, typename THash = FastHash<TKey>>
+    bool AddConcurrent(const TKey& key, const THash& hash = THash())
+    { return AddHashConcurrent((uint64_t)hash(key)); }
+
+    //! Remove the given key
+    /*!
+        \param key - Key to remove
+        \param hash - Key hasher (default is THash())
+        \return 'true' if the key was removed, 'false' if the key was not found
+    */
+    template <typename TKey, typename THash = FastHash<TKey>>
+    bool Remove(const TKey& key, const THash& hash = THash()) noexcept
+    { return RemoveHash((uint64_t)hash(key)); }
+    //! Remove the given key (thread-safe)
+    template <typename TKey, typename THash = FastHash<TKey>>
+    bool RemoveConcurrent(const TKey& key, const THash& hash = THash())
+    { return RemoveHashConcurrent((uint64_t)hash(key)); }
+
+    //! Check if the given key was possibly added
+    /*!
+        \param key - Key to check
+        \param hash - Key hasher (default is THash())
+        \return 'false' if the key was definitely not added, 'true' if it was possibly added
+    */
+    template <typename TKey, typename THash = FastHash<TKey>>
+    bool Contains(const TKey& key, const THash& hash = THash()) const noexcept
+    { return ContainsHash((uint64_t)hash(key)); }
+    //! Check if the given key was possibly added (thread-safe)
+    template <typename TKey, typename THash = FastHash<TKey>>
+    bool ContainsConcurrent(const TKey& key, const THash& hash = THash()) const
+    { return ContainsHashConcurrent((uint64_t)hash(key)); }
+
+    //! Add the key with the given hash value
+    bool AddHash(uint64_t hash) noexcept;
+    //! Add the key with the given hash value (thread-safe)
+    bool AddHashConcurrent(uint64_t hash);
+    //! Remove the key with the given hash value
+    bool RemoveHash(uint64_t hash) noexcept;
+    //! Remove the key with the given hash value (thread-safe)
+    bool RemoveHashConcurrent(uint64_t hash);
+    //! Check if the key with the given hash value was possibly added
+    bool ContainsHash(uint64_t hash) const noexcept;
+    //! Check if the key with the given hash value was possibly added (thread-safe)
+    bool ContainsHashConcurrent(uint64_t hash) const;
+
+    //! Clear all keys
+    void Clear() noexcept;
+
+    //! Serialize the cuckoo filter
+    /*!
+        \return Serialized bytes
+    */
+    std::vector<uint8_t> Serialize() const;
+    //! Serialize the cuckoo filter into the given writer (e.g. File)
+    /*!
+        \param writer - Writer to serialize into
+    */
+    void Serialize(Writer& writer) const;
+    //! Deserialize the cuckoo filter
+    /*!
+        \param buffer - Buffer to deserialize (e.g. MappedFile::bytes())
+        \param filter - Deserialized cuckoo filter
+        \return Count of deserialized bytes or 0 if the buffer is truncated or malformed
+    */
+    static size_t Deserialize(std::span<const uint8_t> buffer, CuckooFilter& filter);
+
+    //! Swap two instances
+    void swap(CuckooFilter& filter) noexcept;
+    friend void swap(CuckooFilter& filter1, CuckooFilter& filter2) noexcept
+    { filter1.swap(filter2); }
+
+private:
+    std::vector<uint64_t> _buckets;
+    size_t _mask;
+    size_t _size;
+    uint64_t _random;
+    // Victim fingerprint which was evicted from the full table
+    bool _victim;
+    uint16_t _victim_fingerprint;
+    size_t _victim_index;
+    // Lock of concurrent methods (not copied or moved)
+    mutable RWLock _lock;
+
+    size_t AltIndex(size_t index, uint16_t fingerprint) const noexcept
+    { return (index ^ (size_t)Hash::Mix(fingerprint)) & _mask; }
+
+    bool Insert(size_t index, uint16_t fingerprint) noexcept;
+    void Place(size_t index, uint16_t fingerprint) noexcept;
+    bool Erase(size_t index, uint16_t fingerprint) noexcept;
+    bool Find(size_t index, uint16_t fingerprint) const noexcept;
+};
+
+/*! \example containers_cuckoo_filter.cpp Cuckoo filter container example */
+
+} // namespace CppCommon
+
+#endif // CPPCOMMON_CONTAINERS_CUCKOO_FILTER_H
@@ -15,10 +15,22 @@
 #include <iterator>
 #include <limits>
 #include <stdexcept>
+#include <type_traits>
 #include <vector>
 
+#include "utility/transparent.h"
+
 namespace CppCommon {
 
+//! Sorted unique range tag
+/*!
+    Tag to mark that the inserted range is already sorted by the key comparator
+    and contains no duplicate keys, so the flat map could skip its sorting.
+*/
+struct sorted_unique_t { explicit sorted_unique_t() = default; };
+//! Sorted unique range tag instance
+inline constexpr sorted_unique_t sorted_unique{};
+
 //! Flat map container
 /*!
     Flat map is an efficient  structure  for  associative  keys/value  storing  and
@@ -26,6 +38,11 @@ namespace CppCommon {
     array container with using binary search algorithm to  find  the  item  by  the
     given key.
 
+    Mostly-read flat maps could be frozen to  build  a  separate  contiguous  array
+    of keys  in  Eytzinger (BFS) order and  use  a  branchless  cache-friendly  search
+    instead of  the binary search over key/value pairs. Any modification  of  keys
+    thaws the flat map back to the regular search mode.
+
     Not thread-safe.
 */
 template <typename TKey, typename TValue, typename TCompare = std::less<TKey>, typename TAllocator = std::allocator<std::pair<TKey, TValue>>>
@@ -36,6 +53,7 @@ public:
     typedef TKey key_type;
     typedef TValue mapped_type;
     typedef std::pair<TKey, TValue> value_type;
+    typedef TCompare key_compare;
     typedef value_type& reference;
     typedef const value_type& const_reference;
     typedef value_type* pointer;
@@ -47,6 +65,13 @@ public:
     typedef typename std::vector<value_type, TAllocator>::reverse_iterator reverse_iterator;
     typedef typename std::vector<value_type, TAllocator>::const_reverse_iterator const_reverse_iterator;
 
+private:
+    // Compatible key type for heterogeneous lookup with transparent key comparator
+    template <typename K>
+    using transparent_key = typename std::enable_if<IsTransparent<TCompare>::value && !std::is_convertible<K, iterator>::value && !std::is_convertible<K, const_iterator>::value, K>::type;
+
+public:
+
     //! Initialize the flat map with a given capacity
     /*!
         \param capacity - Flat map capacity (default is 128)
@@ -56,6 +81,8 @@ public:
     explicit FlatMap(size_t capacity = 128, const TCompare& compare = TCompare(), const TAllocator& allocator = TAllocator());
     template <class InputIterator>
     FlatMap(InputIterator first, InputIterator last, bool unused, size_t capacity = 128, const TCompare& compare = TCompare(), const TAllocator& allocator = TAllocator());
+    template <class InputIterator>
+    FlatMap(sorted_unique_t, InputIterator first, InputIterator last, size_t capacity = 128, const TCompare& compare = TCompare(), const TAllocator& allocator = TAllocator());
     FlatMap(const FlatMap& flatmap);
     FlatMap(const FlatMap& flatmap, size_t capacity);
     FlatMap(FlatMap&&) noexcept = default;
@@ -80,6 +107,9 @@ public:
     //! Get the flat map maximum size
     size_t max_size() const noexcept { return _container.max_size(); }
 
+    //! Is the flat map frozen for read-optimized search?
+    bool frozen() const noexcept { return _frozen; }
+
     //! Compare two items: if the first key is less than the second one?
     bool compare(const TKey& key1, const TKey& key2) const noexcept { return _compare(key1, key2); }
     bool compare(const TKey& key1, const value_type& key2) const noexcept { return _compare(key1, key2.first); }
@@ -107,20 +137,43 @@ public:
     //! Find the iterator which points to the first item with the given key in the flat map or return end iterator
     iterator find(const TKey& key) noexcept;
     const_iterator find(const TKey& key) const noexcept;
+    //! Find the iterator which points to the first item with the given compatible key in the flat map or return end iterator
+    /*!
+        Heterogeneous lookup is available only for transparent key comparator.
+    */
+    template <typename K, typename = transparent_key<K>>
+    iterator find(const K& key) noexcept;
+    template <typename K, typename = transparent_key<K>>
+    const_iterator find(const K& key) const noexcept;
 
     //! Find the iterator which points to the first item with the given key that not less than the given key in the flat map or return end iterator
     iterator lower_bound(const TKey& key) noexcept;
     const_iterator lower_bound(const TKey& key) const noexcept;
+    template <typename K, typename = transparent_key<K>>
+    iterator lower_bound(const K& key) noexcept;
+    template <typename K, typename = transparent_key<K>>
+    const_iterator lower_bound(const K& key) const noexcept;
     //! Find the iterator which points to the first item with the given key that greater than the given key in the flat map or return end iterator
     iterator upper_bound(const TKey& key) noexcept;
     const_iterator upper_bound(const TKey& key) const noexcept;
+    template <typename K, typename = transparent_key<K>>
+    iterator upper_bound(const K& key) noexcept;
+    template <typename K, typename = transparent_key<K>>
+    const_iterator upper_bound(const K& key) const noexcept;
 
     //! Find the bounds of a range that includes all the elements in the hash map with the given key
     std::pair<iterator, iterator> equal_range(const TKey& key) noexcept;
     std::pair<const_iterator, const_iterator> equal_range(const TKey& key) const noexcept;
+    template <typename K, typename = transparent_key<K>>
+    std::pair<iterator, iterator> equal_range(const K& key) noexcept { return std::make_pair(lower_bound(key), upper_bound(key)); }
+    template <typename K, typename = transparent_key<K>>
+    std::pair<const_iterator, const_iterator> equal_range(const K& key) const noexcept { return std::make_pair(lower_bound(key), upper_bound(key)); }
 
     //! Find the count of items with the given key
     size_t count(const TKey& key) const noexcept { return (find(key) == end()) ? 0 : 1; }
+    //! Find the count of items with the given compatible key
+    template <typename K, typename = transparent_key<K>>
+    size_t count(const K& key) const noexcept { return (find(key) == end()) ? 0 : 1; }
 
     //! Access to the item with the given key or throw std::out_of_range exception
     /*!
@@ -163,11 +216,27 @@ public:
     iterator insert(const const_iterator& position, value_type&& item);
     //! Insert all items into the flat map from the given iterators range
     /*!
+        All items are appended to the flat map container at once, then sorted and
+        merged with existing ones in a single pass, so the complexity is O(M*log(M) + N)
+        instead of O(M*N) for item by item insertion. Items with keys that are already
+        present in the flat map (or repeated in the given range) are not inserted.
+
         \param first - The first iterator of the inserted range
         \param last - The last iterator of the inserted range
     */
     template <class InputIterator>
     void insert(InputIterator first, InputIterator last);
+    //! Insert all items into the flat map from the given sorted unique iterators range
+    /*!
+        The given range must be sorted by the key comparator and contain no duplicate
+        keys. Sorting is skipped, so the complexity is O(M + N).
+
+        \param tag - Sorted unique range tag
+        \param first - The first iterator of the inserted range
+        \param last - The last iterator of the inserted range
+    */
+    template <class InputIterator>
+    void insert(sorted_unique_t tag, InputIterator first, InputIterator last);
 
     //! Emplace a new item into the flat map
     /*!
@@ -191,6 +260,13 @@ public:
         \return Number of erased elements (0 or 1 for the hash map)
     */
     size_t erase(const TKey& key);
+    //! Erase the item with the given compatible key from the flat map
+    /*!
+        \param key - Compatible key of the item to erase
+        \return Number of erased elements (0 or 1 for the flat map)
+    */
+    template <typename K, typename = transparent_key<K>>
+    size_t erase(const K& key);
     //! Erase the item by its iterator from the flat map
     /*!
         \param position - Iterator position to the erased item
@@ -205,6 +281,20 @@ public:
     */
     iterator erase(const const_iterator& first, const const_iterator& last);
 
+    //! Merge all items from the given flat map with a linear complexity
+    /*!
+        Items with keys that are already present in the current flat map are kept
+        in the given flat map, all other items are moved into the current one.
+
+        \param flatmap - Flat map to merge
+    */
+    void merge(FlatMap& flatmap);
+    //! Merge all items from the given flat map with a linear complexity
+    /*!
+        \param flatmap - Flat map to merge
+    */
+    void merge(FlatMap&& flatmap) { merge(flatmap); }
+
     //! Reserve the flat map capacity to fit the given count of items
     /*!
         \param count - Count of items to fit
@@ -216,8 +306,18 @@ public:
     */
     void shrink_to_fit() { _container.shrink_to_fit(); }
 
+    //! Freeze the flat map for read-optimized search
+    /*!
+        Build a separate contiguous array of keys in Eytzinger order which is used
+        by find(), lower_bound() and upper_bound() with a branchless search. Keys are
+        copied, so the flat map memory usage grows by the size of keys and indexes.
+    */
+    void freeze();
+    //! Thaw the flat map back to the regular binary search mode
+    void thaw() noexcept;
+
     //! Clear the flat map
-    void clear() noexcept { _container.clear(); }
+    void clear() noexcept { thaw(); _container.clear(); }
 
     //! Swap two instances
     void swap(FlatMap& flatmap) noexcept;
@@ -225,13 +325,27 @@ public:
     friend void swap(FlatMap<UKey, UValue, UCompare, UAllocator>& flatmap1, FlatMap<UKey, UValue, UCompare, UAllocator>& flatmap2) noexcept;
 
 private:
+    typedef typename std::allocator_traits<TAllocator>::template rebind_alloc<TKey> key_allocator;
+    typedef typename std::allocator_traits<TAllocator>::template rebind_alloc<size_t> index_allocator;
+
     TCompare _compare;                              // Flat map key comparator
     std::vector<value_type, TAllocator> _container; // Flat map container
+    bool _frozen{false};                            // Flat map frozen flag
+    std::vector<TKey, key_allocator> _keys;         // Flat map frozen keys in Eytzinger order (1-based)
+    std::vector<size_t, index_allocator> _indexes;  // Flat map frozen key indexes in the container
+
+    void freeze_internal(size_t& index, size_t node);
+    template <typename K>
+    size_t lower_bound_frozen(const K& key) const noexcept;
+    template <typename K>
+    size_t upper_bound_frozen(const K& key) const noexcept;
+    size_t search_frozen(size_t node) const noexcept;
 
     template <typename... Args>
     std::pair<iterator, bool> emplace_internal(const TKey& key, Args&&... args);
     template <typename... Args>
     iterator emplace_hint_internal(const const_iterator& position, const TKey& key, Args&&... args);
+    void merge_internal(size_t middle, bool sorted);
 };
 
 /*! \example containers_flatmap.cpp Flat map container example */
@@ -10,7 +10,7 @@ namespace CppCommon {
 
 template <typename TKey, typename TValue, typename TCompare, typename TAllocator>
 inline FlatMap<TKey, TValue, TCompare, TAllocator>::FlatMap(size_t capacity, const TCompare& compare, const TAllocator& allocator)
-    : _compare(compare), _container(allocator)
+    : _compare(compare), _container(allocator), _keys(key_allocator(allocator)), _indexes(index_allocator(allocator))
 {
     reserve(capacity);
 }
@@ -23,6 +23,14 @@ inline FlatMap<TKey, TValue, TCompare, TAllocator>::FlatMap(InputIterator first,
     insert(first, last);
 }
 
+template <typename TKey, typename TValue, typename TCompare, typename TAllocator>
+template <class InputIterator>
+inline FlatMap<TKey, TValue, TCompare, TAllocator>::FlatMap(sorted_unique_t, InputIterator first, InputIterator last, size_t capacity, const TCompare& compare, const TAllocator& allocator)
+    : FlatMap(capacity, compare, allocator)
+{
+    insert(sorted_unique, first, last);
+}
+
 template <typename TKey, typename TValue, typename TCompare, typename TAllocator>
 inline FlatMap<TKey, TValue, TCompare, TAllocator>::FlatMap(const FlatMap& flatmap)
     : FlatMap(flatmap.capacity(), flatmap._compare, flatmap._container.get_allocator())
@@ -67,39 +75,107 @@ inline typename FlatMap<TKey, TValue, TCompare, TAllocator>::const_iterator Flat
     return it;
 }
 
+template <typename TKey, typename TValue, typename TCompare, typename TAllocator>
+template <typename K, typename>
+inline typename FlatMap<TKey, TValue, TCompare, TAllocator>::iterator FlatMap<TKey, TValue, TCompare, TAllocator>::find(const K& key) noexcept
+{
+    iterator it = lower_bound(key);
+    if ((it != end()) && _compare(key, it->first))
+        return end();
+    return it;
+}
+
+template <typename TKey, typename TValue, typename TCompare, typename TAllocator>
+template <typename K, typename>
+inline typename FlatMap<TKey, TValue, TCompare, TAllocator>::const_iterator FlatMap<TKey, TValue, TCompare, TAllocator>::find(const K& key) const noexcept
+{
+    const_iterator it = lower_bound(key);
+    if ((it != end()) && _compare(key, it->first))
+        return end();
+    return it;
+}
+
 template <typename TKey, typename TValue, typename TCompare, typename TAllocator>
 inline typename FlatMap<TKey, TValue, TCompare, TAllocator>::iterator FlatMap<TKey, TValue, TCompare, TAllocator>::lower_bound(const TKey& key) noexcept
 {
+    if (_frozen)
+        return begin() + lower_bound_frozen(key);
     return std::lower_bound(begin(), end(), key, [this](auto key1, auto key2) { return this->compare(key1, key2); });
 }
 
 template <typename TKey, typename TValue, typename TCompare, typename TAllocator>
 inline typename FlatMap<TKey, TValue, TCompare, TAllocator>::const_iterator FlatMap<TKey, TValue, TCompare, TAllocator>::lower_bound(const TKey& key) const noexcept
 {
+    if (_frozen)
+        return begin() + lower_bound_frozen(key);
     return std::lower_bound(begin(), end(), key, [this](auto key1, auto key2) { return this->compare(key1, key2); });
 }
 
+template <typename TKey, typename TValue, typename TCompare, typename TAllocator>
+template <typename K, typename>
+inline typename FlatMap<TKey, TValue, TCompare, TAllocator>::iterator FlatMap<TKey, TValue, TCompare, TAllocator>::lower_bound(const K& key) noexcept
+{
+    if (_frozen)
+        return begin() + lower_bound_frozen(key);
+    return std::lower_bound(begin(), end(), key, [this](const value_type& item, const K& k) { return this->_compare(item.first, k); });
+}
+
+template <typename TKey, typename TValue, typename TCompare, typename TAllocator>
+template <typename K, typename>
+inline typename FlatMap<TKey, TValue, TCompare, TAllocator>::const_iterator FlatMap<TKey, TValue, TCompare, TAllocator>::lower_bound(const K& key) const noexcept
+{
+    if (_frozen)
+        return begin() + lower_bound_frozen(key);
+    return std::lower_bound(begin(), end(), key, [this](const value_type& item, const K& k) { return this->_compare(item.first, k); });
+}
+
 template <typename TKey, typename TValue, typename TCompare, typename TAllocator>
 inline typename FlatMap<TKey, TValue, TCompare, TAllocator>::iterator FlatMap<TKey, TValue, TCompare, TAllocator>::upper_bound(const TKey& key) noexcept
 {
+    if (_frozen)
+        return begin() + upper_bound_frozen(key);
     return std::upper_bound(begin(), end(), key, [this](auto key1, auto key2) { return this->compare(key1, key2); });
 }
 
 template <typename TKey, typename TValue, typename TCompare, typename TAllocator>
 inline typename FlatMap<TKey, TValue, TCompare, TAllocator>::const_iterator FlatMap<TKey, TValue, TCompare, TAllocator>::upper_bound(const TKey& key) const noexcept
 {
+    if (_frozen)
+        return begin() + upper_bound_frozen(key);
     return std::upper_bound(begin(), end(), key, [this](auto key1, auto key2) { return this->compare(key1, key2); });
 }
 
+template <typename TKey, typename TValue, typename TCompare, typename TAllocator>
+template <typename K, typename>
+inline typename FlatMap<TKey, TValue, TCompare, TAllocator>::iterator FlatMap<TKey, TValue, TCompare, TAllocator>::upper_bound(const K& key) noexcept
+{
+    if (_frozen)
+        return begin() + upper_bound_frozen(key);
+    return std::upper_bound(begin(), end(), key, [this](const K& k, const value_type& item) { return this->_compare(k, item.first); });
+}
+
+template <typename TKey, typename TValue, typename TCompare, typename TAllocator>
+template <typename K, typename>
+inline typename FlatMap<TKey, TValue, TCompare, TAllocator>::const_iterator FlatMap<TKey, TValue, TCompare, TAllocator>::upper_bound(const K& key) const noexcept
+{
+    if (_frozen)
+        return begin() + upper_bound_frozen(key);
+    return std::upper_bound(begin(), end(), key, [this](const K& k, const value_type& item) { return this->_compare(k, item.first); });
+}
+
 template <typename TKey, typename TValue, typename TCompare, typename TAllocator>
 inline std::pair<typename FlatMap<TKey, TValue, TCompare, TAllocator>::iterator, typename FlatMap<TKey, TValue, TCompare, TAllocator>::iterator> FlatMap<TKey, TValue, TCompare, TAllocator>::equal_range(const TKey& key) noexcept
 {
+    if (_frozen)
+        return std::make_pair(lower_bound(key), upper_bound(key));
     return std::equal_range(begin(), end(), key, [this](auto key1, auto key2) { return this->compare(key1, key2); });
 }
 
 template <typename TKey, typename TValue, typename TCompare, typename TAllocator>
 inline std::pair<typename FlatMap<TKey, TValue, TCompare, TAllocator>::const_iterator, typename FlatMap<TKey, TValue, TCompare, TAllocator>::const_iterator> FlatMap<TKey, TValue, TCompare, TAllocator>::equal_range(const TKey& key) const noexcept
 {
+    if (_frozen)
+        return std::make_pair(lower_bound(key), upper_bound(key));
     return std::equal_range(begin(), end(), key, [this](auto key1, auto key2) { return this->compare(key1, key2); });
 }
 
@@ -151,8 +227,20 @@ template <typename TKey, typename TValue, typename TCompare, typename TAllocator
 template <class InputIterator>
 inline void FlatMap<TKey, TValue, TCompare, TAllocator>::insert(InputIterator first, InputIterator last)
 {
-    for (auto it = first; it != last; ++it)
-        insert(*it);
+    thaw();
+    size_t middle = _container.size();
+    _container.insert(_container.end(), first, last);
+    merge_internal(middle, false);
+}
+
+template <typename TKey, typename TValue, typename TCompare, typename TAllocator>
+template <class InputIterator>
+inline void FlatMap<TKey, TValue, TCompare, TAllocator>::insert(sorted_unique_t, InputIterator first, InputIterator last)
+{
+    thaw();
+    size_t middle = _container.size();
+    _container.insert(_container.end(), first, last);
+    merge_internal(middle, true);
 }
 
 template <typename TKey, typename TValue, typename TCompare, typename TAllocator>
@@ -176,6 +264,20 @@ inline size_t FlatMap<TKey, TValue, TCompare, TAllocator>::erase(const TKey& key
     if (it == end())
         return 0;
 
+    thaw();
+    _container.erase(it);
+    return 1;
+}
+
+template <typename TKey, typename TValue, typename TCompare, typename TAllocator>
+template <typename K, typename>
+inline size_t FlatMap<TKey, TValue, TCompare, TAllocator>::erase(const K& key)
+{
+    auto it = find(key);
+    if (it == end())
+        return 0;
+
+    thaw();
     _container.erase(it);
     return 1;
 }
@@ -183,18 +285,15 @@ inline size_t FlatMap<TKey, TValue, TCompare, TAllocator>::erase(const TKey& key
 template <typename TKey, typename TValue, typename TCompare, typename TAllocator>
 inline typename FlatMap<TKey, TValue, TCompare, TAllocator>::iterator FlatMap<TKey, TValue, TCompare, TAllocator>::erase(const const_iterator& position)
 {
-    iterator result(position);
-    ++result;
-    _container.erase(position);
-    return result;
+    thaw();
+    return _container.erase(position);
 }
 
 template <typename TKey, typename TValue, typename TCompare, typename TAllocator>
 inline typename FlatMap<TKey, TValue, TCompare, TAllocator>::iterator FlatMap<TKey, TValue, TCompare, TAllocator>::erase(const const_iterator& first, const const_iterator& last)
 {
-    iterator result(last);
-    _container.erase(first, last);
-    return result;
+    thaw();
+    return _container.erase(first, last);
 }
 
 template <typename TKey, typename TValue, typename TCompare, typename TAllocator>
@@ -205,6 +304,7 @@ inline std::pair<typename FlatMap<TKey, TValue, TCompare, TAllocator>::iterator,
     iterator it = lower_bound(key);
     if ((it == end()) || compare(key, it->first))
     {
+        thaw();
         it = _container.emplace(it, std::make_pair(key, TValue(std::forward<Args>(args)...)));
         found = false;
     }
@@ -215,17 +315,160 @@ template <typename TKey, typename TValue, typename TCompare, typename TAllocator
 template <typename... Args>
 inline typename FlatMap<TKey, TValue, TCompare, TAllocator>::iterator FlatMap<TKey, TValue, TCompare, TAllocator>::emplace_hint_internal(const const_iterator& position, const TKey& key, Args&&... args)
 {
-    if (((position == begin()) || compare((position - 1)->first, key)) && ((position == end()) || compare(key, position.first)))
+    if (((position == begin()) || compare((position - 1)->first, key)) && ((position == end()) || compare(key, position->first)))
+    {
+        thaw();
         return _container.emplace(position, std::make_pair(key, TValue(std::forward<Args>(args)...)));
+    }
     return emplace_internal(key, std::forward<Args>(args)...).first;
 }
 
+template <typename TKey, typename TValue, typename TCompare, typename TAllocator>
+inline void FlatMap<TKey, TValue, TCompare, TAllocator>::merge_internal(size_t middle, bool sorted)
+{
+    auto equal = [this](const value_type& item1, const value_type& item2) { return !this->compare(item1, item2); };
+    auto less = [this](const value_type& item1, const value_type& item2) { return this->compare(item1, item2); };
+
+    auto mid = _container.begin() + middle;
+
+    // Sort the appended items and keep only the first one of each equal keys
+    if (!sorted)
+    {
+        std::stable_sort(mid, _container.end(), less);
+        _container.erase(std::unique(mid, _container.end(), equal), _container.end());
+    }
+
+    // Nothing to merge if all appended items are greater than the existing ones
+    if ((middle == 0) || (mid == _container.end()) || compare(*(mid - 1), *mid))
+        return;
+
+    // Merge appended items with existing ones, existing items are placed first and win
+    std::inplace_merge(_container.begin(), mid, _container.end(), less);
+    _container.erase(std::unique(_container.begin(), _container.end(), equal), _container.end());
+}
+
+template <typename TKey, typename TValue, typename TCompare, typename TAllocator>
+inline void FlatMap<TKey, TValue, TCompare, TAllocator>::merge(FlatMap& flatmap)
+{
+    if ((&flatmap == this) || flatmap.empty())
+        return;
+
+    thaw();
+    flatmap.thaw();
+
+    std::vector<value_type, TAllocator> result(_container.get_allocator());
+    std::vector<value_type, TAllocator> rest(flatmap._container.get_allocator());
+    result.reserve(_container.size() + flatmap._container.size());
+
+    // Linear merge of two sorted containers
+    auto it1 = _container.begin();
+    auto it2 = flatmap._container.begin();
+    while ((it1 != _container.end()) && (it2 != flatmap._container.end()))
+    {
+        if (compare(*it1, *it2))
+            result.emplace_back(std::move(*it1++));
+        else if (compare(*it2, *it1))
+            result.emplace_back(std::move(*it2++));
+        else
+        {
+            result.emplace_back(std::move(*it1++));
+            rest.emplace_back(std::move(*it2++));
+        }
+    }
+    std::move(it1, _container.end(), std::back_inserter(result));
+    std::move(it2, flatmap._container.end(), std::back_inserter(result));
+
+    _container.swap(result);
+    flatmap._container.swap(rest);
+}
+
+template <typename TKey, typename TValue, typename TCompare, typename TAllocator>
+inline void FlatMap<TKey, TValue, TCompare, TAllocator>::freeze()
+{
+    if (_frozen)
+        return;
+
+    _keys.clear();
+    _indexes.clear();
+
+    if (!_container.empty())
+    {
+        // Eytzinger layout is 1-based, the first slot is never used
+        _keys.resize(_container.size() + 1, _container.front().first);
+        _indexes.resize(_container.size() + 1, _container.size());
+
+        size_t index = 0;
+        freeze_internal(index, 1);
+    }
+
+    _frozen = true;
+}
+
+template <typename TKey, typename TValue, typename TCompare, typename TAllocator>
+inline void FlatMap<TKey, TValue, TCompare, TAllocator>::thaw() noexcept
+{
+    if (!_frozen)
+        return;
+
+    _frozen = false;
+    _keys.clear();
+    _indexes.clear();
+}
+
+template <typename TKey, typename TValue, typename TCompare, typename TAllocator>
+inline void FlatMap<TKey, TValue, TCompare, TAllocator>::freeze_internal(size_t& index, size_t node)
+{
+    // In-order traversal of the implicit binary tree assigns sorted keys to Eytzinger nodes
+    if (node < _keys.size())
+    {
+        freeze_internal(index, 2 * node);
+        _keys[node] = _container[index].first;
+        _indexes[node] = index++;
+        freeze_internal(index, 2 * node + 1);
+    }
+}
+
+template <typename TKey, typename TValue, typename TCompare, typename TAllocator>
+template <typename K>
+inline size_t FlatMap<TKey, TValue, TCompare, TAllocator>::lower_bound_frozen(const K& key) const noexcept
+{
+    size_t node = 1;
+    size_t size = _keys.size();
+    while (node < size)
+        node = 2 * node + (size_t)_compare(_keys[node], key);
+    return search_frozen(node);
+}
+
+template <typename TKey, typename TValue, typename TCompare, typename TAllocator>
+template <typename K>
+inline size_t FlatMap<TKey, TValue, TCompare, TAllocator>::upper_bound_frozen(const K& key) const noexcept
+{
+    size_t node = 1;
+    size_t size = _keys.size();
+    while (node < size)
+        node = 2 * node + (size_t)!_compare(key, _keys[node]);
+    return search_frozen(node);
+}
+
+template <typename TKey, typename TValue, typename TCompare, typename TAllocator>
+inline size_t FlatMap<TKey, TValue, TCompare, TAllocator>::search_frozen(size_t node) const noexcept
+{
+    // Drop all trailing right turns and the last left turn to find the answer node
+    while (node & 1)
+        node >>= 1;
+    node >>= 1;
+    return (node == 0) ? _container.size() : _indexes[node];
+}
+
 template <typename TKey, typename TValue, typename TCompare, typename TAllocator>
 inline void FlatMap<TKey, TValue, TCompare, TAllocator>::swap(FlatMap& flatmap) noexcept
 {
     using std::swap;
     swap(_compare, flatmap._compare);
     swap(_container, flatmap._container);
+    swap(_frozen, flatmap._frozen);
+    swap(_keys, flatmap._keys);
+    swap(_indexes, flatmap._indexes);
 }
 
 template <typename TKey, typename TValue, typename TCompare, typename TAllocator>
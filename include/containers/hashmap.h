@@ -11,15 +11,59 @@
 
 #include <algorithm>
 #include <cassert>
+#include <cmath>
 #include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <iterator>
 #include <limits>
+#include <span>
 #include <stdexcept>
+#include <type_traits>
 #include <vector>
 
+#include "algorithms/hash.h"
+#include "memory/memory.h"
+#include "utility/transparent.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#include <emmintrin.h>
+#define CPPCOMMON_HASHMAP_SSE2
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#define CPPCOMMON_HASHMAP_NEON
+#endif
+
 namespace CppCommon {
 
+//! Hash map linear probing policy
+/*!
+    Buckets are probed one by one (step 1) comparing each bucket key with the
+    searched key and with the blank key.
+*/
+struct HashMapLinearProbing
+{
+    //! Is group probing used?
+    static constexpr bool group = false;
+};
+
+//! Hash map group probing policy
+/*!
+    Each bucket is accompanied with a control byte which contains  7-bit  hash
+    fragment of the bucket key or empty mark. Control bytes are probed by groups
+    of 16 with a single SSE2/NEON compare (scalar fallback on other platforms),
+    so keys are compared only for buckets with the matched hash fragment.
+
+    Group probing is faster for expensive to compare keys and for crowded clusters.
+*/
+struct HashMapGroupProbing
+{
+    //! Is group probing used?
+    static constexpr bool group = true;
+    //! Count of control bytes probed at once
+    static constexpr size_t GROUP_SIZE = 16;
+};
+
 template <class TContainer, typename TKey, typename TValue>
 class HashMapIterator;
 template <class TContainer, typename TKey, typename TValue>
@@ -38,15 +82,22 @@ class HashMapConstReverseIterator;
     Open  address  hash map resolves collisions of the  same  hash  values  by
     inserting new item into the next free place (probing with step 1).
 
+    Probing policy selects the way buckets are looked up: HashMapLinearProbing
+    (default) compares keys one by one, HashMapGroupProbing compares  16  hash
+    fragments at once before comparing keys.
+
+    Default hasher is FastHash, because identity std::hash of integers clusters
+    sequential keys into long probing chains.
+
     Not thread-safe.
 */
-template <typename TKey, typename TValue, typename THash = std::hash<TKey>, typename TEqual = std::equal_to<TKey>, typename TAllocator = std::allocator<std::pair<TKey, TValue>>>
+template <typename TKey, typename TValue, typename THash = FastHash<TKey>, typename TEqual = std::equal_to<TKey>, typename TAllocator = std::allocator<std::pair<TKey, TValue>>, class TProbing = HashMapLinearProbing>
 class HashMap
 {
-    friend class HashMapIterator<HashMap<TKey, TValue, THash, TEqual, TAllocator>, TKey, TValue>;
-    friend class HashMapConstIterator<HashMap<TKey, TValue, THash, TEqual, TAllocator>, TKey, TValue>;
-    friend class HashMapReverseIterator<HashMap<TKey, TValue, THash, TEqual, TAllocator>, TKey, TValue>;
-    friend class HashMapConstReverseIterator<HashMap<TKey, TValue, THash, TEqual, TAllocator>, TKey, TValue>;
+    friend class HashMapIterator<HashMap<TKey, TValue, THash, TEqual, TAllocator, TProbing>, TKey, TValue>;
+    friend class HashMapConstIterator<HashMap<TKey, TValue, THash, TEqual, TAllocator, TProbing>, TKey, TValue>;
+    friend class HashMapReverseIterator<HashMap<TKey, TValue, THash, TEqual, TAllocator, TProbing>, TKey, TValue>;
+    friend class HashMapConstReverseIterator<HashMap<TKey, TValue, THash, TEqual, TAllocator, TProbing>, TKey, TValue>;
 
 public:
     // Standard container type definitions
@@ -59,10 +110,17 @@ public:
     typedef const value_type* const_pointer;
     typedef ptrdiff_t difference_type;
     typedef size_t size_type;
-    typedef HashMapIterator<HashMap<TKey, TValue, THash, TEqual, TAllocator>, TKey, TValue> iterator;
-    typedef HashMapConstIterator<HashMap<TKey, TValue, THash, TEqual, TAllocator>, TKey, TValue> const_iterator;
-    typedef HashMapReverseIterator<HashMap<TKey, TValue, THash, TEqual, TAllocator>, TKey, TValue> reverse_iterator;
-    typedef HashMapConstReverseIterator<HashMap<TKey, TValue, THash, TEqual, TAllocator>, TKey, TValue> const_reverse_iterator;
+    typedef HashMapIterator<HashMap<TKey, TValue, THash, TEqual, TAllocator, TProbing>, TKey, TValue> iterator;
+    typedef HashMapConstIterator<HashMap<TKey, TValue, THash, TEqual, TAllocator, TProbing>, TKey, TValue> const_iterator;
+    typedef HashMapReverseIterator<HashMap<TKey, TValue, THash, TEqual, TAllocator, TProbing>, TKey, TValue> reverse_iterator;
+    typedef HashMapConstReverseIterator<HashMap<TKey, TValue, THash, TEqual, TAllocator, TProbing>, TKey, TValue> const_reverse_iterator;
+
+private:
+    // Compatible key type for heterogeneous lookup with transparent key hasher and key comparator
+    template <typename K>
+    using transparent_key = typename std::enable_if<IsTransparent<THash>::value && IsTransparent<TEqual>::value && !std::is_convertible<K, iterator>::value && !std::is_convertible<K, const_iterator>::value, K>::type;
+
+public:
 
     //! Initialize the hash map with a given capacity and blank key value
     /*!
@@ -101,6 +159,53 @@ public:
     //! Get the hash map maximum bucket count
     size_t max_bucket_count() const noexcept { return std::numeric_limits<size_type>::max(); }
 
+    //! Get the hash map load factor
+    float load_factor() const noexcept { return (float)_size / (float)_buckets.size(); }
+    //! Get the hash map maximum load factor
+    float max_load_factor() const noexcept { return _max_load_factor; }
+    //! Set the hash map maximum load factor
+    /*!
+        Hash map will grow when the given load factor is exceeded. Lower values keep
+        probe chains shorter at the cost of memory.
+
+        \param ml - Maximum load factor in range (0, 1) (default is 0.5)
+    */
+    void max_load_factor(float ml);
+
+    //! Get the maximal displacement of items from their hash positions
+    /*!
+        Displacement is a count of probes required to reach the item from its hash
+        position. The method scans all buckets and takes O(bucket_count()) time.
+
+        \return Maximal displacement
+    */
+    size_t max_displacement() const noexcept;
+    //! Get the average displacement of items from their hash positions
+    /*!
+        The method scans all buckets and takes O(bucket_count()) time.
+
+        \return Average displacement
+    */
+    double avg_displacement() const noexcept;
+
+    //! Get the hash map incremental rehash step
+    size_t incremental_rehash() const noexcept { return _rehash_step; }
+    //! Set the hash map incremental rehash step
+    /*!
+        In incremental rehash mode growing hash map keeps old and new buckets  at
+        the same time. Each insert or erase operation migrates at least the given
+        count of old buckets (and the rest of the current cluster) into  the  new
+        ones, so the rehash cost is amortized and there are no latency spikes.
+
+        Setting zero step disables incremental rehash mode and completes the
+        pending incremental rehash.
+
+        \param step - Count of old buckets to migrate per operation (default is 0)
+    */
+    void incremental_rehash(size_t step);
+    //! Is the incremental rehash in progress?
+    bool rehashing() const noexcept { return !_old_buckets.empty(); }
+
     //! Calculate hash of the given key
     size_t key_hash(const TKey& key) const noexcept { return _hash(key); }
     //! Compare two keys: if the first key equals to the second one?
@@ -127,13 +232,44 @@ public:
     //! Find the iterator which points to the first item with the given key in the hash map or return end iterator
     iterator find(const TKey& key) noexcept;
     const_iterator find(const TKey& key) const noexcept;
+    //! Find the iterator which points to the first item with the given compatible key in the hash map or return end iterator
+    /*!
+        Heterogeneous lookup is available only for transparent key hasher and key comparator.
+    */
+    template <typename K, typename = transparent_key<K>>
+    iterator find(const K& key) noexcept;
+    template <typename K, typename = transparent_key<K>>
+    const_iterator find(const K& key) const noexcept;
+
+    //! Find items with the given keys in the hash map in a batch
+    /*!
+        Keys are processed in groups: all keys of the group are hashed first and
+        their home buckets are prefetched, then buckets are probed. Cache misses
+        of the group overlap each other instead of stalling each lookup, so the
+        batched lookup is much faster than serial find() calls for hash maps
+        which do not fit into the CPU cache.
+
+        \param keys - Keys to find
+        \param results - Iterators to found items or end iterators (must have at least keys.size() items)
+        \return Count of found items
+    */
+    size_t find_batch(std::span<const TKey> keys, std::span<iterator> results) noexcept;
+    size_t find_batch(std::span<const TKey> keys, std::span<const_iterator> results) const noexcept;
 
     //! Find the bounds of a range that includes all the elements in the hash map with the given key
     std::pair<iterator, iterator> equal_range(const TKey& key) noexcept;
     std::pair<const_iterator, const_iterator> equal_range(const TKey& key) const noexcept;
+    //! Find the bounds of a range that includes all the elements in the hash map with the given compatible key
+    template <typename K, typename = transparent_key<K>>
+    std::pair<iterator, iterator> equal_range(const K& key) noexcept { return std::make_pair(find(key), end()); }
+    template <typename K, typename = transparent_key<K>>
+    std::pair<const_iterator, const_iterator> equal_range(const K& key) const noexcept { return std::make_pair(find(key), end()); }
 
     //! Find the count of items with the given key
     size_t count(const TKey& key) const noexcept { return (find(key) == end()) ? 0 : 1; }
+    //! Find the count of items with the given compatible key
+    template <typename K, typename = transparent_key<K>>
+    size_t count(const K& key) const noexcept { return (find(key) == end()) ? 0 : 1; }
 
     //! Access to the item with the given key or throw std::out_of_range exception
     /*!
@@ -175,6 +311,13 @@ public:
         \return Number of erased elements (0 or 1 for the hash map)
     */
     size_t erase(const TKey& key);
+    //! Erase the item with the given compatible key from the hash map
+    /*!
+        \param key - Compatible key of the item to erase
+        \return Number of erased elements (0 or 1 for the hash map)
+    */
+    template <typename K, typename = transparent_key<K>>
+    size_t erase(const K& key);
     //! Erase the item by its iterator from the hash map
     /*!
         \param position - Iterator position to the erased item
@@ -191,28 +334,57 @@ public:
         \param count - Count of items to fit
     */
     void reserve(size_t count);
+    //! Shrink the hash map capacity to the minimal one which fits its current size
+    void shrink_to_fit();
 
     //! Clear the hash map
     void clear() noexcept;
 
     //! Swap two instances
     void swap(HashMap& hashmap) noexcept;
-    template <typename UKey, typename UValue, typename UHash, typename UEqual, typename UAllocator>
-    friend void swap(HashMap<UKey, UValue, UHash, UEqual, UAllocator>& hashmap1, HashMap<UKey, UValue, UHash, UEqual, UAllocator>& hashmap2) noexcept;
+    template <typename UKey, typename UValue, typename UHash, typename UEqual, typename UAllocator, class UProbing>
+    friend void swap(HashMap<UKey, UValue, UHash, UEqual, UAllocator, UProbing>& hashmap1, HashMap<UKey, UValue, UHash, UEqual, UAllocator, UProbing>& hashmap2) noexcept;
 
 private:
+    typedef typename std::allocator_traits<TAllocator>::template rebind_alloc<uint8_t> control_allocator;
+
     THash _hash;    // Hash map key hasher
     TEqual _equal;  // Hash map key comparator
     TKey _blank;    // Hash map blank key
     size_t _size;   // Hash map size
-    std::vector<value_type, TAllocator> _buckets; // Hash map buckets
+    float _max_load_factor; // Hash map maximum load factor
+    size_t _rehash_step;    // Hash map incremental rehash step
+    size_t _rehash_index;   // Hash map incremental rehash position in old buckets
+    std::vector<value_type, TAllocator> _buckets;          // Hash map buckets
+    std::vector<uint8_t, control_allocator> _controls;     // Hash map control bytes (group probing only)
+    std::vector<value_type, TAllocator> _old_buckets;      // Hash map old buckets (incremental rehash only)
+    std::vector<uint8_t, control_allocator> _old_controls; // Hash map old control bytes (incremental rehash only)
+
+    // Buckets are indexed through the new ones followed by the old ones
+    size_t buckets_internal() const noexcept { return _buckets.size() + _old_buckets.size(); }
+    value_type& bucket_internal(size_t index) noexcept { return (index < _buckets.size()) ? _buckets[index] : _old_buckets[index - _buckets.size()]; }
+    const value_type& bucket_internal(size_t index) const noexcept { return (index < _buckets.size()) ? _buckets[index] : _old_buckets[index - _buckets.size()]; }
+    bool blank_internal(size_t index) const noexcept { return key_equal(bucket_internal(index).first, _blank); }
 
     template <typename... Args>
     std::pair<iterator, bool> emplace_internal(const TKey& key, Args&&... args);
     void erase_internal(size_t index);
-    size_t key_to_index(const TKey& key) const noexcept;
-    size_t next_index(size_t index) const noexcept;
-    size_t diff(size_t index1, size_t index2) const noexcept;
+    void erase_bucket(std::vector<value_type, TAllocator>& buckets, std::vector<uint8_t, control_allocator>& controls, size_t index);
+    template <typename K>
+    size_t find_internal(const K& key) const noexcept { return find_internal(key, _hash(key)); }
+    template <typename K>
+    size_t find_internal(const K& key, size_t hash) const noexcept;
+    template <class TIterator, class TContainer>
+    static size_t find_batch_internal(TContainer* container, std::span<const TKey> keys, std::span<TIterator> results) noexcept;
+    template <typename K>
+    size_t probe_internal(const std::vector<value_type, TAllocator>& buckets, const std::vector<uint8_t, control_allocator>& controls, const K& key, size_t hash, bool& found) const noexcept;
+    static void set_control(std::vector<uint8_t, control_allocator>& controls, size_t count, size_t index, uint8_t control) noexcept;
+    size_t key_to_index(const TKey& key, size_t count) const noexcept;
+    size_t next_index(size_t index, size_t count) const noexcept;
+    size_t diff(size_t index1, size_t index2, size_t count) const noexcept;
+    size_t capacity_for(size_t count) const noexcept;
+    void grow(size_t count);
+    void rehash_internal(size_t step);
 };
 
 //! Hash map iterator
@@ -8,165 +8,340 @@
 
 namespace CppCommon {
 
-template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator>
-inline HashMap<TKey, TValue, THash, TEqual, TAllocator>::HashMap(size_t capacity, const TKey& blank, const THash& hash, const TEqual& equal, const TAllocator& allocator)
-    : _hash(hash), _equal(equal), _blank(blank), _size(0), _buckets(allocator)
+//! @cond INTERNALS
+namespace Internals {
+
+//! Control byte of the empty hash map bucket
+constexpr uint8_t HASHMAP_CONTROL_EMPTY = 0x80;
+
+//! Get 7-bit hash fragment stored in the hash map control byte
+inline uint8_t HashMapFragment(size_t hash) noexcept
+{
+    // Mix all hash bits into the top ones, because low bits are used for the bucket index
+    return (uint8_t)((((uint64_t)hash) * 0x9E3779B97F4A7C15ull) >> 57);
+}
+
+//! Get the bit mask of control bytes in the group which are equal to the given value
+inline uint32_t HashMapGroupMatch(const uint8_t* group, uint8_t value) noexcept
+{
+#if defined(CPPCOMMON_HASHMAP_SSE2)
+    __m128i controls = _mm_loadu_si128((const __m128i*)group);
+    return (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(controls, _mm_set1_epi8((char)value)));
+#elif defined(CPPCOMMON_HASHMAP_NEON)
+    static const uint8_t weights[16] = { 1, 2, 4, 8, 16, 32, 64, 128, 1, 2, 4, 8, 16, 32, 64, 128 };
+    uint8x16_t bits = vandq_u8(vceqq_u8(vld1q_u8(group), vdupq_n_u8(value)), vld1q_u8(weights));
+    return (uint32_t)vaddv_u8(vget_low_u8(bits)) | ((uint32_t)vaddv_u8(vget_high_u8(bits)) << 8);
+#else
+    uint32_t result = 0;
+    for (size_t i = 0; i < HashMapGroupProbing::GROUP_SIZE; ++i)
+        if (group[i] == value)
+            result |= (1u << i);
+    return result;
+#endif
+}
+
+//! Get the index of the lowest set bit in the non zero mask
+inline size_t HashMapLowestBit(uint32_t mask) noexcept
+{
+#if defined(__GNUC__)
+    return (size_t)__builtin_ctz(mask);
+#else
+    size_t result = 0;
+    while ((mask & 1) == 0)
+    {
+        mask >>= 1;
+        ++result;
+    }
+    return result;
+#endif
+}
+
+} // namespace Internals
+//! @endcond
+
+template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator, class TProbing>
+inline HashMap<TKey, TValue, THash, TEqual, TAllocator, TProbing>::HashMap(size_t capacity, const TKey& blank, const THash& hash, const TEqual& equal, const TAllocator& allocator)
+    : _hash(hash), _equal(equal), _blank(blank), _size(0), _max_load_factor(0.5f), _rehash_step(0), _rehash_index(0), _buckets(allocator), _controls(control_allocator(allocator)), _old_buckets(allocator), _old_controls(control_allocator(allocator))
 {
     size_t reserve = 1;
     while (reserve < capacity)
         reserve <<= 1;
     _buckets.resize(reserve, std::make_pair(_blank, TValue()));
+
+    // Control bytes are extended with the group size tail to probe groups without wrapping
+    if constexpr (TProbing::group)
+        _controls.resize(reserve + TProbing::GROUP_SIZE - 1, Internals::HASHMAP_CONTROL_EMPTY);
 }
 
-template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator>
+template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator, class TProbing>
 template <class InputIterator>
-inline HashMap<TKey, TValue, THash, TEqual, TAllocator>::HashMap(InputIterator first, InputIterator last, bool unused, size_t capacity, const TKey& blank, const THash& hash, const TEqual& equal, const TAllocator& allocator)
+inline HashMap<TKey, TValue, THash, TEqual, TAllocator, TProbing>::HashMap(InputIterator first, InputIterator last, bool unused, size_t capacity, const TKey& blank, const THash& hash, const TEqual& equal, const TAllocator& allocator)
     : HashMap(capacity, blank, hash, equal, allocator)
 {
     for (auto it = first; it != last; ++it)
         insert(*it);
 }
 
-template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator>
-inline HashMap<TKey, TValue, THash, TEqual, TAllocator>::HashMap(const HashMap& hashmap)
+template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator, class TProbing>
+inline HashMap<TKey, TValue, THash, TEqual, TAllocator, TProbing>::HashMap(const HashMap& hashmap)
     : HashMap(hashmap.bucket_count(), hashmap._blank, hashmap._hash, hashmap._equal, hashmap._buckets.get_allocator())
 {
+    _max_load_factor = hashmap._max_load_factor;
     for (const auto& item : hashmap)
         insert(item);
+    _rehash_step = hashmap._rehash_step;
 }
 
-template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator>
-inline HashMap<TKey, TValue, THash, TEqual, TAllocator>::HashMap(const HashMap& hashmap, size_t capacity)
+template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator, class TProbing>
+inline HashMap<TKey, TValue, THash, TEqual, TAllocator, TProbing>::HashMap(const HashMap& hashmap, size_t capacity)
     : HashMap(capacity, hashmap._blank, hashmap._hash, hashmap._equal, hashmap._buckets.get_allocator())
 {
+    _max_load_factor = hashmap._max_load_factor;
     for (const auto& item : hashmap)
         insert(item);
+    _rehash_step = hashmap._rehash_step;
 }
 
-template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator>
-inline HashMap<TKey, TValue, THash, TEqual, TAllocator>& HashMap<TKey, TValue, THash, TEqual, TAllocator>::operator=(const HashMap& hashmap)
+template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator, class TProbing>
+inline HashMap<TKey, TValue, THash, TEqual, TAllocator, TProbing>& HashMap<TKey, TValue, THash, TEqual, TAllocator, TProbing>::operator=(const HashMap& hashmap)
 {
     clear();
+    _max_load_factor = hashmap._max_load_factor;
+    _rehash_step = hashmap._rehash_step;
     reserve(hashmap.size());
     for (const auto& item : hashmap)
         insert(item);
     return *this;
 }
 
-template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator>
-inline typename HashMap<TKey, TValue, THash, TEqual, TAllocator>::iterator HashMap<TKey, TValue, THash, TEqual, TAllocator>::begin() noexcept
+template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator, class TProbing>
+inline void HashMap<TKey, TValue, THash, TEqual, TAllocator, TProbing>::max_load_factor(float ml)
+{
+    if ((ml <= 0.0f) || (ml >= 1.0f))
+        throw std::invalid_argument("Hash map maximum load factor must be in range (0, 1)!");
+
+    _max_load_factor = ml;
+    reserve(_size);
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator, class TProbing>
+inline size_t HashMap<TKey, TValue, THash, TEqual, TAllocator, TProbing>::max_displacement() const noexcept
+{
+    size_t result = 0;
+    for (size_t i = 0; i < _buckets.size(); ++i)
+        if (!key_equal(_buckets[i].first, _blank))
+            result = std::max(result, diff(i, key_to_index(_buckets[i].first, _buckets.size()), _buckets.size()));
+    for (size_t i = _rehash_index; i < _old_buckets.size(); ++i)
+        if (!key_equal(_old_buckets[i].first, _blank))
+            result = std::max(result, diff(i, key_to_index(_old_buckets[i].first, _old_buckets.size()), _old_buckets.size()));
+    return result;
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator, class TProbing>
+inline double HashMap<TKey, TValue, THash, TEqual, TAllocator, TProbing>::avg_displacement() const noexcept
+{
+    if (_size == 0)
+        return 0.0;
+
+    size_t total = 0;
+    for (size_t i = 0; i < _buckets.size(); ++i)
+        if (!key_equal(_buckets[i].first, _blank))
+            total += diff(i, key_to_index(_buckets[i].first, _buckets.size()), _buckets.size());
+    for (size_t i = _rehash_index; i < _old_buckets.size(); ++i)
+        if (!key_equal(_old_buckets[i].first, _blank))
+            total += diff(i, key_to_index(_old_buckets[i].first, _old_buckets.size()), _old_buckets.size());
+    return (double)total / (double)_size;
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator, class TProbing>
+inline void HashMap<TKey, TValue, THash, TEqual, TAllocator, TProbing>::incremental_rehash(size_t step)
+{
+    _rehash_step = step;
+
+    // Complete the pending incremental rehash when it is disabled
+    if (_rehash_step == 0)
+        rehash_internal(_old_buckets.size());
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator, class TProbing>
+inline typename HashMap<TKey, TValue, THash, TEqual, TAllocator, TProbing>::iterator HashMap<TKey, TValue, THash, TEqual, TAllocator, TProbing>::begin() noexcept
 {
     return iterator(this);
 }
 
-template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator>
-inline typename HashMap<TKey, TValue, THash, TEqual, TAllocator>::const_iterator HashMap<TKey, TValue, THash, TEqual, TAllocator>::begin() const noexcept
+template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator, class TProbing>
+inline typename HashMap<TKey, TValue, THash, TEqual, TAllocator, TProbing>::const_iterator HashMap<TKey, TValue, THash, TEqual, TAllocator, TProbing>::begin() const noexcept
 {
     return const_iterator(this);
 }
 
-template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator>
-inline typename HashMap<TKey, TValue, THash, TEqual, TAllocator>::const_iterator HashMap<TKey, TValue, THash, TEqual, TAllocator>::cbegin() const noexcept
+template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator, class TProbing>
+inline typename HashMap<TKey, TValue, THash, TEqual, TAllocator, TProbing>::const_iterator HashMap<TKey, TValue, THash, TEqual, TAllocator, TProbing>::cbegin() const noexcept
 {
     return const_iterator(this);
 }
 
-template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator>
-inline typename HashMap<TKey, TValue, THash, TEqual, TAllocator>::iterator HashMap<TKey, TValue, THash, TEqual, TAllocator>::end() noexcept
+template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator, class TProbing>
+inline typename HashMap<TKey, TValue, THash, TEqual, TAllocator, TProbing>::iterator HashMap<TKey, TValue, THash, TEqual, TAllocator, TProbing>::end() noexcept
 {
     return iterator(nullptr);
 }
 
-template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator>
-inline typename HashMap<TKey, TValue, THash, TEqual, TAllocator>::const_iterator HashMap<TKey, TValue, THash, TEqual, TAllocator>::end() const noexcept
+template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator, class TProbing>
+inline typename HashMap<TKey, TValue, THash, TEqual, TAllocator, TProbing>::const_iterator HashMap<TKey, TValue, THash, TEqual, TAllocator, TProbing>::end() const noexcept
 {
     return const_iterator(nullptr);
 }
 
-template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator>
-inline typename HashMap<TKey, TValue, THash, TEqual, TAllocator>::const_iterator HashMap<TKey, TValue, THash, TEqual, TAllocator>::cend() const noexcept
+template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator, class TProbing>
+inline typename HashMap<TKey, TValue, THash, TEqual, TAllocator, TProbing>::const_iterator HashMap<TKey, TValue, THash, TEqual, TAllocator, TProbing>::cend() const noexcept
 {
     return const_iterator(nullptr);
 }
 
-template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator>
-inline typename HashMap<TKey, TValue, THash, TEqual, TAllocator>::reverse_iterator HashMap<TKey, TValue, THash, TEqual, TAllocator>::rbegin() noexcept
+template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator, class TProbing>
+inline typename HashMap<TKey, TValue, THash, TEqual, TAllocator, TProbing>::reverse_iterator HashMap<TKey, TValue, THash, TEqual, TAllocator, TProbing>::rbegin() noexcept
 {
     return reverse_iterator(this);
 }
 
-template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator>
-inline typename HashMap<TKey, TValue, THash, TEqual, TAllocator>::const_reverse_iterator HashMap<TKey, TValue, THash, TEqual, TAllocator>::rbegin() const noexcept
+template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator, class TProbing>
+inline typename HashMap<TKey, TValue, THash, TEqual, TAllocator, TProbing>::const_reverse_iterator HashMap<TKey, TValue, THash, TEqual, TAllocator, TProbing>::rbegin() const noexcept
 {
     return const_reverse_iterator(this);
 }
 
-template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator>
-inline typename HashMap<TKey, TValue, THash, TEqual, TAllocator>::const_reverse_iterator HashMap<TKey, TValue, THash, TEqual, TAllocator>::crbegin() const noexcept
+template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator, class TProbing>
+inline typename HashMap<TKey, TValue, THash, TEqual, TAllocator, TProbing>::const_reverse_iterator HashMap<TKey, TValue, THash, TEqual, TAllocator, TProbing>::crbegin() const noexcept
 {
     return const_reverse_iterator(this);
 }
 
-template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator>
-inline typename HashMap<TKey, TValue, THash, TEqual, TAllocator>::reverse_iterator HashMap<TKey, TValue, THash, TEqual, TAllocator>::rend() noexcept
+template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator, class TProbing>
+inline typename HashMap<TKey, TValue, THash, TEqual, TAllocator, TProbing>::reverse_iterator HashMap<TKey, TValue, THash, TEqual, TAllocator, TProbing>::rend() noexcept
 {
     return reverse_iterator(nullptr);
 }
 
-template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator>
-inline typename HashMap<TKey, TValue, THash, TEqual, TAllocator>::const_reverse_iterator HashMap<TKey, TValue, THash, TEqual, TAllocator>::rend() const noexcept
+template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator, class TProbing>
+inline typename HashMap<TKey, TValue, THash, TEqual, TAllocator, TProbing>::const_reverse_iterator HashMap<TKey, TValue, THash, TEqual, TAllocator, TProbing>::rend() const noexcept
 {
     return const_reverse_iterator(nullptr);
 }
 
-template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator>
-inline typename HashMap<TKey, TValue, THash, TEqual, TAllocator>::const_reverse_iterator HashMap<TKey, TValue, THash, TEqual, TAllocator>::crend() const noexcept
+template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator, class TProbing>
+inline typename HashMap<TKey, TValue, THash, TEqual, TAllocator, TProbing>::const_reverse_iterator HashMap<TKey, TValue, THash, TEqual, TAllocator, TProbing>::crend() const noexcept
 {
     return const_reverse_iterator(nullptr);
 }
 
-template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator>
-inline typename HashMap<TKey, TValue, THash, TEqual, TAllocator>::iterator HashMap<TKey, TValue, THash, TEqual, TAllocator>::find(const TKey& key) noexcept
+template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator, class TProbing>
+inline typename HashMap<TKey, TValue, THash, TEqual, TAllocator, TProbing>::iterator HashMap<TKey, TValue, THash, TEqual, TAllocator, TProbing>::find(const TKey& key) noexcept
 {
-    assert(!key_equal(key, _blank) && "Cannot find a blank key!");
+    size_t index = find_internal(key);
+    return (index < buckets_internal()) ? iterator(this, index) : end();
+}
 
-    for (size_t index = key_to_index(key);; index = next_index(index))
-    {
-        if (key_equal(_buckets[index].first, key))
-            return iterator(this, index);
-        if (key_equal(_buckets[index].first, _blank))
-            return end();
-    }
+template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator, class TProbing>
+inline typename HashMap<TKey, TValue, THash, TEqual, TAllocator, TProbing>::const_iterator HashMap<TKey, TValue, THash, TEqual, TAllocator, TProbing>::find(const TKey& key) const noexcept
+{
+    size_t index = find_internal(key);
+    return (index < buckets_internal()) ? const_iterator(this, index) : end();
 }
 
-template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator>
-inline typename HashMap<TKey, TValue, THash, TEqual, TAllocator>::const_iterator HashMap<TKey, TValue, THash, TEqual, TAllocator>::find(const TKey& key) const noexcept
+template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator, class TProbing>
+template <typename K, typename>
+inline typename HashMap<TKey, TValue, THash, TEqual, TAllocator, TProbing>::iterator HashMap<TKey, TValue, THash, TEqual, TAllocator, TProbing>::find(const K& key) noexcept
 {
-    assert(!key_equal(key, _blank) && "Cannot find a blank key!");
+    size_t index = find_internal(key);
+    return (index < buckets_internal()) ? iterator(this, index) : end();
+}
 
-    for (size_t index = key_to_index(key);; index = next_index(index))
+template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator, class TProbing>
+template <typename K, typename>
+inline typename HashMap<TKey, TValue, THash, TEqual, TAllocator, TProbing>::const_iterator HashMap<TKey, TValue, THash, TEqual, TAllocator, TProbing>::find(const K& key) const noexcept
+{
+    size_t index = find_internal(key);
+    return (index < buckets_internal()) ? const_iterator(this, index) : end();
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator, class TProbing>
+inline size_t HashMap<TKey, TValue, THash, TEqual, TAllocator, TProbing>::find_batch(std::span<const TKey> keys, std::span<iterator> results) noexcept
+{
+    return find_batch_internal(this, keys, results);
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator, class TProbing>
+inline size_t HashMap<TKey, TValue, THash, TEqual, TAllocator, TProbing>::find_batch(std::span<const TKey> keys, std::span<const_iterator> results) const noexcept
+{
+    return find_batch_internal(this, keys, results);
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator, class TProbing>
+template <class TIterator, class TContainer>
+inline size_t HashMap<TKey, TValue, THash, TEqual, TAllocator, TProbing>::find_batch_internal(TContainer* container, std::span<const TKey> keys, std::span<TIterator> results) noexcept
+{
+    assert((results.size() >= keys.size()) && "Not enough results to find the given keys!");
+
+    // Count of keys with prefetched buckets in flight (bounded by the count of line fill buffers)
+    constexpr size_t BATCH = 16;
+
+    size_t hashes[BATCH];
+    size_t result = 0;
+    const size_t count = std::min(keys.size(), results.size());
+    for (size_t offset = 0; offset < count; offset += BATCH)
     {
-        if (key_equal(_buckets[index].first, key))
-            return const_iterator(this, index);
-        if (key_equal(_buckets[index].first, _blank))
-            return end();
+        const size_t batch = std::min(BATCH, count - offset);
+
+        // Hash all keys of the batch and prefetch their home buckets
+        for (size_t i = 0; i < batch; ++i)
+        {
+            hashes[i] = container->_hash(keys[offset + i]);
+
+            size_t index = hashes[i] & (container->_buckets.size() - 1);
+            if constexpr (TProbing::group)
+                Memory::Prefetch(&container->_controls[index]);
+            Memory::Prefetch(&container->_buckets[index]);
+
+            if (container->rehashing())
+            {
+                index = hashes[i] & (container->_old_buckets.size() - 1);
+                if constexpr (TProbing::group)
+                    Memory::Prefetch(&container->_old_controls[index]);
+                Memory::Prefetch(&container->_old_buckets[index]);
+            }
+        }
+
+        // Probe buckets of the batch
+        for (size_t i = 0; i < batch; ++i)
+        {
+            size_t index = container->find_internal(keys[offset + i], hashes[i]);
+            if (index < container->buckets_internal())
+            {
+                results[offset + i] = TIterator(container, index);
+                ++result;
+            }
+            else
+                results[offset + i] = container->end();
+        }
     }
+    return result;
 }
 
-template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator>
-inline std::pair<typename HashMap<TKey, TValue, THash, TEqual, TAllocator>::iterator, typename HashMap<TKey, TValue, THash, TEqual, TAllocator>::iterator> HashMap<TKey, TValue, THash, TEqual, TAllocator>::equal_range(const TKey& key) noexcept
+template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator, class TProbing>
+inline std::pair<typename HashMap<TKey, TValue, THash, TEqual, TAllocator, TProbing>::iterator, typename HashMap<TKey, TValue, THash, TEqual, TAllocator, TProbing>::iterator> HashMap<TKey, TValue, THash, TEqual, TAllocator, TProbing>::equal_range(const TKey& key) noexcept
 {
     return std::make_pair(find(key), end());
 }
 
-template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator>
-inline std::pair<typename HashMap<TKey, TValue, THash, TEqual, TAllocator>::const_iterator, typename HashMap<TKey, TValue, THash, TEqual, TAllocator>::const_iterator> HashMap<TKey, TValue, THash, TEqual, TAllocator>::equal_range(const TKey& key) const noexcept
+template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator, class TProbing>
+inline std::pair<typename HashMap<TKey, TValue, THash, TEqual, TAllocator, TProbing>::const_iterator, typename HashMap<TKey, TValue, THash, TEqual, TAllocator, TProbing>::const_iterator> HashMap<TKey, TValue, THash, TEqual, TAllocator, TProbing>::equal_range(const TKey& key) const noexcept
 {
     return std::make_pair(find(key), end());
 }
 
-template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator>
-inline typename HashMap<TKey, TValue, THash, TEqual, TAllocator>::mapped_type& HashMap<TKey, TValue, THash, TEqual, TAllocator>::at(const TKey& key) noexcept
+template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator, class TProbing>
+inline typename HashMap<TKey, TValue, THash, TEqual, TAllocator, TProbing>::mapped_type& HashMap<TKey, TValue, THash, TEqual, TAllocator, TProbing>::at(const TKey& key) noexcept
 {
     auto it = find(key);
     if (it == end())
@@ -175,8 +350,8 @@ inline typename HashMap<TKey, TValue, THash, TEqual, TAllocator>::mapped_type& H
     return it->second;
 }
 
-template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator>
-inline const typename HashMap<TKey, TValue, THash, TEqual, TAllocator>::mapped_type& HashMap<TKey, TValue, THash, TEqual, TAllocator>::at(const TKey& key) const noexcept
+template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator, class TProbing>
+inline const typename HashMap<TKey, TValue, THash, TEqual, TAllocator, TProbing>::mapped_type& HashMap<TKey, TValue, THash, TEqual, TAllocator, TProbing>::at(const TKey& key) const noexcept
 {
     auto it = find(key);
     if (it == end())
@@ -185,28 +360,32 @@ inline const typename HashMap<TKey, TValue, THash, TEqual, TAllocator>::mapped_t
     return it->second;
 }
 
-template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator>
-inline std::pair<typename HashMap<TKey, TValue, THash, TEqual, TAllocator>::iterator, bool> HashMap<TKey, TValue, THash, TEqual, TAllocator>::insert(const value_type& item)
+template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator, class TProbing>
+inline std::pair<typename HashMap<TKey, TValue, THash, TEqual, TAllocator, TProbing>::iterator, bool> HashMap<TKey, TValue, THash, TEqual, TAllocator, TProbing>::insert(const value_type& item)
 {
     return emplace_internal(item.first, item.second);
 }
 
-template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator>
-inline std::pair<typename HashMap<TKey, TValue, THash, TEqual, TAllocator>::iterator, bool> HashMap<TKey, TValue, THash, TEqual, TAllocator>::insert(value_type&& item)
+template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator, class TProbing>
+inline std::pair<typename HashMap<TKey, TValue, THash, TEqual, TAllocator, TProbing>::iterator, bool> HashMap<TKey, TValue, THash, TEqual, TAllocator, TProbing>::insert(value_type&& item)
 {
     return emplace_internal(item.first, std::move(item.second));
 }
 
-template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator>
+template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator, class TProbing>
 template <typename... Args>
-inline std::pair<typename HashMap<TKey, TValue, THash, TEqual, TAllocator>::iterator, bool> HashMap<TKey, TValue, THash, TEqual, TAllocator>::emplace(Args&&... args)
+inline std::pair<typename HashMap<TKey, TValue, THash, TEqual, TAllocator, TProbing>::iterator, bool> HashMap<TKey, TValue, THash, TEqual, TAllocator, TProbing>::emplace(Args&&... args)
 {
     return emplace_internal(std::forward<Args>(args)...);
 }
 
-template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator>
-inline size_t HashMap<TKey, TValue, THash, TEqual, TAllocator>::erase(const TKey& key)
+template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator, class TProbing>
+inline size_t HashMap<TKey, TValue, THash, TEqual, TAllocator, TProbing>::erase(const TKey& key)
 {
+    // Migrate a bounded count of old buckets during the incremental rehash
+    if (rehashing())
+        rehash_internal(_rehash_step);
+
     auto it = find(key);
     if (it == end())
         return 0;
@@ -215,114 +394,339 @@ inline size_t HashMap<TKey, TValue, THash, TEqual, TAllocator>::erase(const TKey
     return 1;
 }
 
-template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator>
-inline void HashMap<TKey, TValue, THash, TEqual, TAllocator>::erase(const const_iterator& position)
+template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator, class TProbing>
+template <typename K, typename>
+inline size_t HashMap<TKey, TValue, THash, TEqual, TAllocator, TProbing>::erase(const K& key)
+{
+    // Migrate a bounded count of old buckets during the incremental rehash
+    if (rehashing())
+        rehash_internal(_rehash_step);
+
+    auto it = find(key);
+    if (it == end())
+        return 0;
+
+    erase_internal(it._index);
+    return 1;
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator, class TProbing>
+inline void HashMap<TKey, TValue, THash, TEqual, TAllocator, TProbing>::erase(const const_iterator& position)
 {
     erase_internal(position._index);
 }
 
-template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator>
+template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator, class TProbing>
 template <typename... Args>
-inline std::pair<typename HashMap<TKey, TValue, THash, TEqual, TAllocator>::iterator, bool> HashMap<TKey, TValue, THash, TEqual, TAllocator>::emplace_internal(const TKey& key, Args&&... args)
+inline std::pair<typename HashMap<TKey, TValue, THash, TEqual, TAllocator, TProbing>::iterator, bool> HashMap<TKey, TValue, THash, TEqual, TAllocator, TProbing>::emplace_internal(const TKey& key, Args&&... args)
 {
     assert(!key_equal(key, _blank) && "Cannot emplace a blank key!");
 
-    reserve(_size + 1);
+    grow(_size + 1);
+
+    // Migrate a bounded count of old buckets during the incremental rehash
+    if (rehashing())
+        rehash_internal(_rehash_step);
+
+    bool found;
+    size_t hash = _hash(key);
+    size_t index = probe_internal(_buckets, _controls, key, hash, found);
+    if (found)
+        return std::make_pair(iterator(this, index), false);
+
+    if (rehashing())
+    {
+        bool found_old;
+        size_t index_old = probe_internal(_old_buckets, _old_controls, key, hash, found_old);
+        if (found_old)
+            return std::make_pair(iterator(this, _buckets.size() + index_old), false);
+    }
+
+    _buckets[index].first = key;
+    _buckets[index].second = TValue(std::forward<Args>(args)...);
+    if constexpr (TProbing::group)
+        set_control(_controls, _buckets.size(), index, Internals::HashMapFragment(hash));
+    ++_size;
+    return std::make_pair(iterator(this, index), true);
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator, class TProbing>
+template <typename K>
+inline size_t HashMap<TKey, TValue, THash, TEqual, TAllocator, TProbing>::find_internal(const K& key, size_t hash) const noexcept
+{
+    assert(!_equal(_blank, key) && "Cannot find a blank key!");
+
+    bool found;
+    size_t index = probe_internal(_buckets, _controls, key, hash, found);
+    if (found)
+        return index;
+
+    if (rehashing())
+    {
+        index = probe_internal(_old_buckets, _old_controls, key, hash, found);
+        if (found)
+            return _buckets.size() + index;
+    }
+
+    return buckets_internal();
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator, class TProbing>
+template <typename K>
+inline size_t HashMap<TKey, TValue, THash, TEqual, TAllocator, TProbing>::probe_internal(const std::vector<value_type, TAllocator>& buckets, const std::vector<uint8_t, control_allocator>& controls, const K& key, size_t hash, bool& found) const noexcept
+{
+    size_t mask = buckets.size() - 1;
+
+    if constexpr (TProbing::group)
+    {
+        uint8_t fragment = Internals::HashMapFragment(hash);
+
+        for (size_t index = hash & mask;; index = (index + TProbing::GROUP_SIZE) & mask)
+        {
+            const uint8_t* group = &controls[index];
+            uint32_t empty = Internals::HashMapGroupMatch(group, Internals::HASHMAP_CONTROL_EMPTY);
+            uint32_t match = Internals::HashMapGroupMatch(group, fragment);
 
-    for (size_t index = key_to_index(key);; index = next_index(index))
+            // Keys of the cluster are placed before its first empty bucket
+            if (empty != 0)
+                match &= (empty & (0 - empty)) - 1;
+
+            for (; match != 0; match &= match - 1)
+            {
+                size_t position = (index + Internals::HashMapLowestBit(match)) & mask;
+                if (_equal(buckets[position].first, key))
+                {
+                    found = true;
+                    return position;
+                }
+            }
+
+            if (empty != 0)
+            {
+                found = false;
+                return (index + Internals::HashMapLowestBit(empty)) & mask;
+            }
+        }
+    }
+    else
     {
-        if (key_equal(_buckets[index].first, key))
-            return std::make_pair(iterator(this, index), false);
-        if (key_equal(_buckets[index].first, _blank))
+        for (size_t index = hash & mask;; index = (index + 1) & mask)
         {
-            _buckets[index].first = key;
-            _buckets[index].second = TValue(std::forward<Args>(args)...);
-            ++_size;
-            return std::make_pair(iterator(this, index), true);
+            if (_equal(buckets[index].first, key))
+            {
+                found = true;
+                return index;
+            }
+            if (key_equal(buckets[index].first, _blank))
+            {
+                found = false;
+                return index;
+            }
         }
     }
 }
 
-template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator>
-inline void HashMap<TKey, TValue, THash, TEqual, TAllocator>::erase_internal(size_t index)
+template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator, class TProbing>
+inline void HashMap<TKey, TValue, THash, TEqual, TAllocator, TProbing>::set_control(std::vector<uint8_t, control_allocator>& controls, size_t count, size_t index, uint8_t control) noexcept
 {
+    // Update the control byte and all its copies in the group size tail
+    for (size_t i = index; i < controls.size(); i += count)
+        controls[i] = control;
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator, class TProbing>
+inline void HashMap<TKey, TValue, THash, TEqual, TAllocator, TProbing>::erase_internal(size_t index)
+{
+    if (index < _buckets.size())
+        erase_bucket(_buckets, _controls, index);
+    else
+        erase_bucket(_old_buckets, _old_controls, index - _buckets.size());
+    --_size;
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator, class TProbing>
+inline void HashMap<TKey, TValue, THash, TEqual, TAllocator, TProbing>::erase_bucket(std::vector<value_type, TAllocator>& buckets, std::vector<uint8_t, control_allocator>& controls, size_t index)
+{
+    size_t count = buckets.size();
     size_t current = index;
-    for (index = next_index(current);; index = next_index(index))
+    for (index = next_index(current, count);; index = next_index(index, count))
     {
-        if (key_equal(_buckets[index].first, _blank))
+        if (key_equal(buckets[index].first, _blank))
         {
-            _buckets[current].first = _blank;
-            --_size;
+            buckets[current].first = _blank;
+            if constexpr (TProbing::group)
+                set_control(controls, count, current, Internals::HASHMAP_CONTROL_EMPTY);
             return;
         }
 
         // Move buckets with the same key hash closer to the first suitable position in the hash map
-        size_t base = key_to_index(_buckets[index].first);
-        if (diff(current, base) < diff(index, base))
+        size_t base = key_to_index(buckets[index].first, count);
+        if (diff(current, base, count) < diff(index, base, count))
         {
-            _buckets[current] = _buckets[index];
+            buckets[current] = buckets[index];
+            if constexpr (TProbing::group)
+                set_control(controls, count, current, controls[index]);
             current = index;
         }
     }
 }
 
-template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator>
-inline size_t HashMap<TKey, TValue, THash, TEqual, TAllocator>::key_to_index(const TKey& key) const noexcept
+template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator, class TProbing>
+inline size_t HashMap<TKey, TValue, THash, TEqual, TAllocator, TProbing>::key_to_index(const TKey& key, size_t count) const noexcept
 {
-    size_t mask = _buckets.size() - 1;
+    size_t mask = count - 1;
     return _hash(key) & mask;
 }
 
-template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator>
-inline size_t HashMap<TKey, TValue, THash, TEqual, TAllocator>::next_index(size_t index) const noexcept
+template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator, class TProbing>
+inline size_t HashMap<TKey, TValue, THash, TEqual, TAllocator, TProbing>::next_index(size_t index, size_t count) const noexcept
 {
-    size_t mask = _buckets.size() - 1;
+    size_t mask = count - 1;
     return (index + 1) & mask;
 }
 
-template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator>
-inline size_t HashMap<TKey, TValue, THash, TEqual, TAllocator>::diff(size_t index1, size_t index2) const noexcept
+template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator, class TProbing>
+inline size_t HashMap<TKey, TValue, THash, TEqual, TAllocator, TProbing>::diff(size_t index1, size_t index2, size_t count) const noexcept
 {
-    size_t mask = _buckets.size() - 1;
-    return (_buckets.size() + (index1 - index2)) & mask;
+    size_t mask = count - 1;
+    return (count + (index1 - index2)) & mask;
 }
 
-template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator>
-inline void HashMap<TKey, TValue, THash, TEqual, TAllocator>::rehash(size_t capacity)
+template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator, class TProbing>
+inline void HashMap<TKey, TValue, THash, TEqual, TAllocator, TProbing>::rehash(size_t capacity)
 {
-    capacity = std::max(capacity, 2 * size());
-    HashMap<TKey, TValue, THash, TEqual, TAllocator> temp(*this, capacity);
+    capacity = std::max(capacity, capacity_for(size()));
+    HashMap<TKey, TValue, THash, TEqual, TAllocator, TProbing> temp(*this, capacity);
     swap(temp);
 }
 
-template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator>
-inline void HashMap<TKey, TValue, THash, TEqual, TAllocator>::reserve(size_t count)
+template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator, class TProbing>
+inline void HashMap<TKey, TValue, THash, TEqual, TAllocator, TProbing>::reserve(size_t count)
+{
+    size_t capacity = capacity_for(count);
+    if (_buckets.size() < capacity)
+        rehash(capacity);
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator, class TProbing>
+inline void HashMap<TKey, TValue, THash, TEqual, TAllocator, TProbing>::shrink_to_fit()
+{
+    // Rehash into the minimal power of two bucket count which fits the current size
+    size_t capacity = 1;
+    while (capacity < capacity_for(size()))
+        capacity <<= 1;
+    if (rehashing() || (capacity < _buckets.size()))
+        rehash(capacity);
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator, class TProbing>
+inline size_t HashMap<TKey, TValue, THash, TEqual, TAllocator, TProbing>::capacity_for(size_t count) const noexcept
+{
+    // Always keep at least one blank bucket to terminate probing
+    return std::max(count + 1, (size_t)std::ceil((double)count / _max_load_factor));
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator, class TProbing>
+inline void HashMap<TKey, TValue, THash, TEqual, TAllocator, TProbing>::grow(size_t count)
 {
-    if (_buckets.size() < 2 * count)
-        rehash(2 * count);
+    size_t capacity = capacity_for(count);
+    if (_buckets.size() >= capacity)
+        return;
+
+    if (_rehash_step == 0)
+    {
+        rehash(capacity);
+        return;
+    }
+
+    // Complete the previous incremental rehash before starting the next one
+    rehash_internal(_old_buckets.size());
+
+    size_t reserve = 1;
+    while (reserve < std::max(capacity, 2 * _buckets.size()))
+        reserve <<= 1;
+
+    // Keep the current buckets as old ones and migrate them to the new buckets step by step
+    std::swap(_buckets, _old_buckets);
+    std::swap(_controls, _old_controls);
+    _buckets.assign(reserve, std::make_pair(_blank, TValue()));
+    if constexpr (TProbing::group)
+        _controls.assign(reserve + TProbing::GROUP_SIZE - 1, Internals::HASHMAP_CONTROL_EMPTY);
+    _rehash_index = 0;
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator, class TProbing>
+inline void HashMap<TKey, TValue, THash, TEqual, TAllocator, TProbing>::rehash_internal(size_t step)
+{
+    if (!rehashing())
+        return;
+
+    for (size_t migrated = 0; _rehash_index < _old_buckets.size(); ++migrated, ++_rehash_index)
+    {
+        auto& bucket = _old_buckets[_rehash_index];
+        bool blank = key_equal(bucket.first, _blank);
+
+        // Stop on blank buckets only to migrate whole clusters of old buckets,
+        // so the rest of old buckets is still a valid open address hash table
+        if (blank)
+        {
+            if (migrated >= step)
+                break;
+            continue;
+        }
+
+        bool found;
+        size_t hash = _hash(bucket.first);
+        size_t index = probe_internal(_buckets, _controls, bucket.first, hash, found);
+        _buckets[index] = std::move(bucket);
+        bucket.first = _blank;
+        if constexpr (TProbing::group)
+        {
+            set_control(_controls, _buckets.size(), index, Internals::HashMapFragment(hash));
+            set_control(_old_controls, _old_buckets.size(), _rehash_index, Internals::HASHMAP_CONTROL_EMPTY);
+        }
+    }
+
+    // Release old buckets when all of them are migrated
+    if (_rehash_index >= _old_buckets.size())
+    {
+        std::vector<value_type, TAllocator>(_old_buckets.get_allocator()).swap(_old_buckets);
+        std::vector<uint8_t, control_allocator>(_old_controls.get_allocator()).swap(_old_controls);
+        _rehash_index = 0;
+    }
 }
 
-template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator>
-inline void HashMap<TKey, TValue, THash, TEqual, TAllocator>::clear() noexcept
+template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator, class TProbing>
+inline void HashMap<TKey, TValue, THash, TEqual, TAllocator, TProbing>::clear() noexcept
 {
     _size = 0;
     for (auto& bucket : _buckets)
         bucket.first = _blank;
+    std::fill(_controls.begin(), _controls.end(), Internals::HASHMAP_CONTROL_EMPTY);
+    std::vector<value_type, TAllocator>(_old_buckets.get_allocator()).swap(_old_buckets);
+    std::vector<uint8_t, control_allocator>(_old_controls.get_allocator()).swap(_old_controls);
+    _rehash_index = 0;
 }
 
-template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator>
-inline void HashMap<TKey, TValue, THash, TEqual, TAllocator>::swap(HashMap& hashmap) noexcept
+template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator, class TProbing>
+inline void HashMap<TKey, TValue, THash, TEqual, TAllocator, TProbing>::swap(HashMap& hashmap) noexcept
 {
     using std::swap;
     swap(_hash, hashmap._hash);
     swap(_equal, hashmap._equal);
     swap(_blank, hashmap._blank);
     swap(_size, hashmap._size);
+    swap(_max_load_factor, hashmap._max_load_factor);
+    swap(_rehash_step, hashmap._rehash_step);
+    swap(_rehash_index, hashmap._rehash_index);
     swap(_buckets, hashmap._buckets);
+    swap(_controls, hashmap._controls);
+    swap(_old_buckets, hashmap._old_buckets);
+    swap(_old_controls, hashmap._old_controls);
 }
 
-template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator>
-inline void swap(HashMap<TKey, TValue, THash, TEqual, TAllocator>& hashmap1, HashMap<TKey, TValue, THash, TEqual, TAllocator>& hashmap2) noexcept
+template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator, class TProbing>
+inline void swap(HashMap<TKey, TValue, THash, TEqual, TAllocator, TProbing>& hashmap1, HashMap<TKey, TValue, THash, TEqual, TAllocator, TProbing>& hashmap2) noexcept
 {
     hashmap1.swap(hashmap2);
 }
@@ -341,9 +745,9 @@ inline HashMapIterator<TContainer, TKey, TValue>::HashMapIterator(TContainer* co
         }
         else
         {
-            for (size_t i = 0; i < _container->_buckets.size(); ++i)
+            for (size_t i = 0; i < _container->buckets_internal(); ++i)
             {
-                if (!_container->key_equal(_container->_buckets[i].first, _container->_blank))
+                if (!_container->blank_internal(i))
                 {
                     _index = i;
                     return;
@@ -360,9 +764,9 @@ HashMapIterator<TContainer, TKey, TValue>& HashMapIterator<TContainer, TKey, TVa
 {
     if (_container != nullptr)
     {
-        for (size_t i = _index + 1; i < _container->_buckets.size(); ++i)
+        for (size_t i = _index + 1; i < _container->buckets_internal(); ++i)
         {
-            if (!_container->key_equal(_container->_buckets[i].first, _container->_blank))
+            if (!_container->blank_internal(i))
             {
                 _index = i;
                 return *this;
@@ -388,15 +792,15 @@ inline HashMapIterator<TContainer, TKey, TValue> HashMapIterator<TContainer, TKe
 template <class TContainer, typename TKey, typename TValue>
 typename HashMapIterator<TContainer, TKey, TValue>::reference HashMapIterator<TContainer, TKey, TValue>::operator*() noexcept
 {
-    assert(((_container != nullptr) && (_index < _container->_buckets.size())) && "Iterator must be valid!");
+    assert(((_container != nullptr) && (_index < _container->buckets_internal())) && "Iterator must be valid!");
 
-    return _container->_buckets[_index];
+    return _container->bucket_internal(_index);
 }
 
 template <class TContainer, typename TKey, typename TValue>
 typename HashMapIterator<TContainer, TKey, TValue>::pointer HashMapIterator<TContainer, TKey, TValue>::operator->() noexcept
 {
-    return ((_container != nullptr) && (_index < _container->_buckets.size())) ? &_container->_buckets[_index] : nullptr;
+    return ((_container != nullptr) && (_index < _container->buckets_internal())) ? &_container->bucket_internal(_index) : nullptr;
 }
 
 template <class TContainer, typename TKey, typename TValue>
@@ -427,9 +831,9 @@ inline HashMapConstIterator<TContainer, TKey, TValue>::HashMapConstIterator(cons
         }
         else
         {
-            for (size_t i = 0; i < _container->_buckets.size(); ++i)
+            for (size_t i = 0; i < _container->buckets_internal(); ++i)
             {
-                if (!_container->key_equal(_container->_buckets[i].first, _container->_blank))
+                if (!_container->blank_internal(i))
                 {
                     _index = i;
                     return;
@@ -446,9 +850,9 @@ HashMapConstIterator<TContainer, TKey, TValue>& HashMapConstIterator<TContainer,
 {
     if (_container != nullptr)
     {
-        for (size_t i = _index + 1; i < _container->_buckets.size(); ++i)
+        for (size_t i = _index + 1; i < _container->buckets_internal(); ++i)
         {
-            if (!_container->key_equal(_container->_buckets[i].first, _container->_blank))
+            if (!_container->blank_internal(i))
             {
                 _index = i;
                 return *this;
@@ -474,15 +878,15 @@ inline HashMapConstIterator<TContainer, TKey, TValue> HashMapConstIterator<TCont
 template <class TContainer, typename TKey, typename TValue>
 typename HashMapConstIterator<TContainer, TKey, TValue>::const_reference HashMapConstIterator<TContainer, TKey, TValue>::operator*() const noexcept
 {
-    assert(((_container != nullptr) && (_index < _container->_buckets.size())) && "Iterator must be valid!");
+    assert(((_container != nullptr) && (_index < _container->buckets_internal())) && "Iterator must be valid!");
 
-    return _container->_buckets[_index];
+    return _container->bucket_internal(_index);
 }
 
 template <class TContainer, typename TKey, typename TValue>
 typename HashMapConstIterator<TContainer, TKey, TValue>::const_pointer HashMapConstIterator<TContainer, TKey, TValue>::operator->() const noexcept
 {
-    return ((_container != nullptr) && (_index < _container->_buckets.size())) ? &_container->_buckets[_index] : nullptr;
+    return ((_container != nullptr) && (_index < _container->buckets_internal())) ? &_container->bucket_internal(_index) : nullptr;
 }
 
 template <class TContainer, typename TKey, typename TValue>
@@ -513,9 +917,9 @@ inline HashMapReverseIterator<TContainer, TKey, TValue>::HashMapReverseIterator(
         }
         else
         {
-            for (size_t i = _container->_buckets.size(); i-- > 0;)
+            for (size_t i = _container->buckets_internal(); i-- > 0;)
             {
-                if (!_container->key_equal(_container->_buckets[i].first, _container->_blank))
+                if (!_container->blank_internal(i))
                 {
                     _index = i;
                     return;
@@ -534,7 +938,7 @@ HashMapReverseIterator<TContainer, TKey, TValue>& HashMapReverseIterator<TContai
     {
         for (size_t i = _index; i-- > 0;)
         {
-            if (!_container->key_equal(_container->_buckets[i].first, _container->_blank))
+            if (!_container->blank_internal(i))
             {
                 _index = i;
                 return *this;
@@ -560,15 +964,15 @@ inline HashMapReverseIterator<TContainer, TKey, TValue> HashMapReverseIterator<T
 template <class TContainer, typename TKey, typename TValue>
 typename HashMapReverseIterator<TContainer, TKey, TValue>::reference HashMapReverseIterator<TContainer, TKey, TValue>::operator*() noexcept
 {
-    assert(((_container != nullptr) && (_index < _container->_buckets.size())) && "Iterator must be valid!");
+    assert(((_container != nullptr) && (_index < _container->buckets_internal())) && "Iterator must be valid!");
 
-    return _container->_buckets[_index];
+    return _container->bucket_internal(_index);
 }
 
 template <class TContainer, typename TKey, typename TValue>
 typename HashMapReverseIterator<TContainer, TKey, TValue>::pointer HashMapReverseIterator<TContainer, TKey, TValue>::operator->() noexcept
 {
-    return ((_container != nullptr) && (_index < _container->_buckets.size())) ? &_container->_buckets[_index] : nullptr;
+    return ((_container != nullptr) && (_index < _container->buckets_internal())) ? &_container->bucket_internal(_index) : nullptr;
 }
 
 template <class TContainer, typename TKey, typename TValue>
@@ -599,9 +1003,9 @@ inline HashMapConstReverseIterator<TContainer, TKey, TValue>::HashMapConstRevers
         }
         else
         {
-            for (size_t i = _container->_buckets.size(); i-- > 0;)
+            for (size_t i = _container->buckets_internal(); i-- > 0;)
             {
-                if (!_container->key_equal(_container->_buckets[i].first, _container->_blank))
+                if (!_container->blank_internal(i))
                 {
                     _index = i;
                     return;
@@ -620,7 +1024,7 @@ HashMapConstReverseIterator<TContainer, TKey, TValue>& HashMapConstReverseIterat
     {
         for (size_t i = _index; i-- > 0;)
         {
-            if (!_container->key_equal(_container->_buckets[i].first, _container->_blank))
+            if (!_container->blank_internal(i))
             {
                 _index = i;
                 return *this;
@@ -646,15 +1050,15 @@ inline HashMapConstReverseIterator<TContainer, TKey, TValue> HashMapConstReverse
 template <class TContainer, typename TKey, typename TValue>
 typename HashMapConstReverseIterator<TContainer, TKey, TValue>::const_reference HashMapConstReverseIterator<TContainer, TKey, TValue>::operator*() const noexcept
 {
-    assert(((_container != nullptr) && (_index < _container->_buckets.size())) && "Iterator must be valid!");
+    assert(((_container != nullptr) && (_index < _container->buckets_internal())) && "Iterator must be valid!");
 
-    return _container->_buckets[_index];
+    return _container->bucket_internal(_index);
 }
 
 template <class TContainer, typename TKey, typename TValue>
 typename HashMapConstReverseIterator<TContainer, TKey, TValue>::const_pointer HashMapConstReverseIterator<TContainer, TKey, TValue>::operator->() const noexcept
 {
-    return ((_container != nullptr) && (_index < _container->_buckets.size())) ? &_container->_buckets[_index] : nullptr;
+    return ((_container != nullptr) && (_index < _container->buckets_internal())) ? &_container->bucket_internal(_index) : nullptr;
 }
 
 template <class TContainer, typename TKey, typename TValue>
@@ -0,0 +1,362 @@
+/*!
+    \file hashset.h
+    \brief Intrusive hash set container definition
+    \author Ivan Shynkarenka
+    \date 15.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_CONTAINERS_HASHSET_H
+#define CPPCOMMON_CONTAINERS_HASHSET_H
+
+#include <cassert>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <utility>
+
+namespace CppCommon {
+
+template <class TContainer, typename T>
+class HashSetIterator;
+template <class TContainer, typename T>
+class HashSetConstIterator;
+
+//! Intrusive hash set node
+/*!
+    Same as HashSet<T, THash, TEqual>::Node, but could be used as the item
+    base class when the key hasher and comparator are declared after the item.
+*/
+template <typename T>
+struct HashSetNode
+{
+    T* hash_next;   //!< Pointer to the next hash set node in the bucket chain
+
+    HashSetNode() : hash_next(nullptr) {}
+};
+
+//! Intrusive hash set container
+/*!
+    Hash set indexes items by their hash with separate chaining  (open  hashing).
+    Each item embeds the bucket chain link (T::hash_next), so  the  same  item
+    could be also linked into other intrusive containers (lists, trees)  at  the
+    same time. Bucket array is supplied by the user, so the  hash  set  never
+    allocates memory and items could live in pools or arenas.
+
+    \code
+    Buckets
+    +-----+     +-----+     +-----+
+    |  0  |---->|  A  |---->|  D  |----> NULL
+    +-----+     +-----+     +-----+
+    |  1  |----> NULL
+    +-----+     +-----+
+    |  2  |---->|  B  |----> NULL
+    +-----+     +-----+
+    |  3  |---->|  C  |----> NULL
+    +-----+     +-----+
+    \endcode
+
+    Resizing is incremental: rehash() switches the hash set to the new bucket
+    array and each following insert() and erase() moves a few chains of  the
+    old bucket array into the new one, so there is no latency spike of moving
+    all items at once. The old bucket array is still used until resizing() is
+    'false' (or migrate() is called) and only then could be reused or freed.
+
+    Bucket count must be a power of two. Item hashes are not cached and  are
+    recalculated on moving chains between bucket arrays.
+
+    Insert and erase operations invalidate iterators, except erase() with the
+    iterator, which does not move chains and returns the next valid iterator.
+
+    Not thread-safe.
+
+    <b>Overview</b>\n
+    In computing, a hash table (hash map) is a  data  structure  used  to
+    implement an associative array, a structure that can map keys to values.
+    A hash table uses a hash function to compute an index into an array of
+    buckets or slots, from which the desired value can be found. In separate
+    chaining each bucket is independent and has some sort of list of entries
+    with the same index. The time for hash table operations is the time  to
+    find the bucket (which is constant) plus the time for the list operation.
+
+    <b>Taken from:</b>\n
+    Hash table from Wikipedia, the free encyclopedia
+    https://en.wikipedia.org/wiki/Hash_table#Separate_chaining
+*/
+template <typename T, typename THash = std::hash<T>, typename TEqual = std::equal_to<T>>
+class HashSet
+{
+    friend class HashSetIterator<HashSet<T, THash, TEqual>, T>;
+    friend class HashSetConstIterator<HashSet<T, THash, TEqual>, T>;
+
+public:
+    // Standard container type definitions
+    typedef T value_type;
+    typedef THash hasher;
+    typedef TEqual key_equal;
+    typedef value_type& reference;
+    typedef const value_type& const_reference;
+    typedef value_type* pointer;
+    typedef const value_type* const_pointer;
+    typedef ptrdiff_t difference_type;
+    typedef size_t size_type;
+    typedef HashSetIterator<HashSet<T, THash, TEqual>, T> iterator;
+    typedef HashSetConstIterator<HashSet<T, THash, TEqual>, T> const_iterator;
+
+    //! Hash set node
+    typedef HashSetNode<T> Node;
+
+    //! Initialize the hash set with the given bucket array
+    /*!
+        \param buckets - Bucket array (will be cleared, must live until the hash set is switched to another one)
+        \param bucket_count - Bucket count (must be a power of two)
+        \param hash - Key hasher (default is THash())
+        \param equal - Key comparator (default is TEqual())
+    */
+    HashSet(T** buckets, size_t bucket_count, const THash& hash = THash(), const TEqual& equal = TEqual()) noexcept;
+    template <class InputIterator>
+    HashSet(InputIterator first, InputIterator last, T** buckets, size_t bucket_count, const THash& hash = THash(), const TEqual& equal = TEqual()) noexcept;
+    HashSet(const HashSet&) = delete;
+    HashSet(HashSet&&) = delete;
+    ~HashSet() noexcept = default;
+
+    HashSet& operator=(const HashSet&) = delete;
+    HashSet& operator=(HashSet&&) = delete;
+
+    //! Check if the hash set is not empty
+    explicit operator bool() const noexcept { return !empty(); }
+
+    //! Is the hash set empty?
+    bool empty() const noexcept { return _size == 0; }
+
+    //! Get the hash set size
+    size_t size() const noexcept { return _size; }
+
+    //! Get the bucket array
+    T** buckets() const noexcept { return _buckets; }
+    //! Get the bucket count
+    size_t bucket_count() const noexcept { return _mask + 1; }
+    //! Get the hash set load factor
+    double load_factor() const noexcept { return (double)_size / bucket_count(); }
+
+    //! Is the hash set resizing (the old bucket array is still in use)?
+    bool resizing() const noexcept { return _old_buckets != nullptr; }
+
+    //! Get the begin hash set iterator
+    iterator begin() noexcept;
+    const_iterator begin() const noexcept;
+    const_iterator cbegin() const noexcept;
+    //! Get the end hash set iterator
+    iterator end() noexcept;
+    const_iterator end() const noexcept;
+    const_iterator cend() const noexcept;
+
+    //! Find the iterator which points to the item with the given key or return end iterator
+    /*!
+        Key could be any type supported by the key hasher and comparator
+        (e.g. the key field of the item with the transparent functors).
+
+        \param key - Key to find
+        \return Iterator to the found item or end iterator
+    */
+    template <typename TKey>
+    iterator find(const TKey& key) noexcept;
+    template <typename TKey>
+    const_iterator find(const TKey& key) const noexcept;
+
+    //! Is the item with the given key in the hash set?
+    template <typename TKey>
+    bool contains(const TKey& key) const noexcept { return find(key) != end(); }
+
+    //! Insert a new item into the hash set
+    /*!
+        \param item - Item to insert
+        \return Pair with the iterator to the inserted or already existing equal item and success flag
+    */
+    std::pair<iterator, bool> insert(T& item) noexcept;
+
+    //! Erase the item with the given key from the hash set
+    /*!
+        \param key - Key of the item to erase
+        \return Erased item or nullptr if the item is not found
+    */
+    template <typename TKey>
+    T* erase(const TKey& key) noexcept;
+    //! Erase the item by the given iterator from the hash set
+    /*!
+        \param it - Iterator to the erased item
+        \return Iterator to the next item
+    */
+    iterator erase(const iterator& it) noexcept { return erase(const_iterator(it)); }
+    iterator erase(const const_iterator& it) noexcept;
+
+    //! Start resizing the hash set into the new bucket array
+    /*!
+        Unfinished resizing is completed before the new one is started.
+
+        \param buckets - New bucket array (will be cleared)
+        \param bucket_count - New bucket count (must be a power of two)
+    */
+    void rehash(T** buckets, size_t bucket_count) noexcept;
+
+    //! Move chains of the old bucket array into the new one
+    /*!
+        \param steps - Count of old buckets to move (default is all)
+        \return 'true' if resizing is finished and the old bucket array is released, 'false' otherwise
+    */
+    bool migrate(size_t steps = (size_t)-1) noexcept;
+
+    //! Clear the hash set
+    /*!
+        Finishes resizing and releases the old bucket array.
+    */
+    void clear() noexcept;
+
+    //! Swap two instances
+    void swap(HashSet& hashset) noexcept;
+    template <typename U, typename UHash, typename UEqual>
+    friend void swap(HashSet<U, UHash, UEqual>& hashset1, HashSet<U, UHash, UEqual>& hashset2) noexcept;
+
+private:
+    // Count of old buckets moved by each insert or erase operation
+    static const size_t MIGRATION_STEPS = 2;
+
+    THash _hash;            // Hash set key hasher
+    TEqual _equal;          // Hash set key comparator
+    size_t _size;           // Hash set size
+    T** _buckets;           // Bucket array
+    size_t _mask;           // Bucket array mask
+    T** _old_buckets;       // Old bucket array while resizing
+    size_t _old_mask;       // Old bucket array mask
+    size_t _migrated;       // Count of moved old buckets
+
+    // Get the bucket of the given hash: old buckets are used until their chains are moved
+    T** bucket(size_t hash, bool& old, size_t& index) const noexcept;
+    // Find the first item starting from the given bucket (old buckets are visited before new ones)
+    T* first(bool& old, size_t& index) const noexcept;
+    // Find the item with the given key
+    template <typename TKey>
+    T* find_internal(const TKey& key, bool& old, size_t& index) const noexcept;
+};
+
+//! Intrusive hash set iterator
+/*!
+    Not thread-safe.
+*/
+template <class TContainer, typename T>
+class HashSetIterator
+{
+    friend TContainer;
+    friend HashSetConstIterator<TContainer, T>;
+
+public:
+    // Standard iterator type definitions
+    typedef T value_type;
+    typedef value_type& reference;
+    typedef const value_type& const_reference;
+    typedef value_type* pointer;
+    typedef const value_type* const_pointer;
+    typedef ptrdiff_t difference_type;
+    typedef size_t size_type;
+    typedef std::forward_iterator_tag iterator_category;
+
+    HashSetIterator() noexcept : _container(nullptr), _node(nullptr), _old(false), _index(0) {}
+    explicit HashSetIterator(TContainer* container, T* node, bool old, size_t index) noexcept : _container(container), _node(node), _old(old), _index(index) {}
+    HashSetIterator(const HashSetIterator& it) noexcept = default;
+    HashSetIterator(HashSetIterator&& it) noexcept = default;
+    ~HashSetIterator() noexcept = default;
+
+    HashSetIterator& operator=(const HashSetIterator& it) noexcept = default;
+    HashSetIterator& operator=(HashSetIterator&& it) noexcept = default;
+
+    friend bool operator==(const HashSetIterator& it1, const HashSetIterator& it2) noexcept
+    { return it1._node == it2._node; }
+    friend bool operator!=(const HashSetIterator& it1, const HashSetIterator& it2) noexcept
+    { return it1._node != it2._node; }
+
+    HashSetIterator& operator++() noexcept;
+    HashSetIterator operator++(int) noexcept;
+
+    reference operator*() noexcept;
+    pointer operator->() noexcept;
+
+    //! Check if the iterator is valid
+    explicit operator bool() const noexcept { return _node != nullptr; }
+
+    //! Swap two instances
+    void swap(HashSetIterator& it) noexcept;
+    template <class UContainer, typename U>
+    friend void swap(HashSetIterator<UContainer, U>& it1, HashSetIterator<UContainer, U>& it2) noexcept;
+
+private:
+    TContainer* _container;
+    T* _node;
+    bool _old;
+    size_t _index;
+};
+
+//! Intrusive hash set constant iterator
+/*!
+    Not thread-safe.
+*/
+template <class TContainer, typename T>
+class HashSetConstIterator
+{
+    friend TContainer;
+
+public:
+    // Standard iterator type definitions
+    typedef T value_type;
+    typedef value_type& reference;
+    typedef const value_type& const_reference;
+    typedef value_type* pointer;
+    typedef const value_type* const_pointer;
+    typedef ptrdiff_t difference_type;
+    typedef size_t size_type;
+    typedef std::forward_iterator_tag iterator_category;
+
+    HashSetConstIterator() noexcept : _container(nullptr), _node(nullptr), _old(false), _index(0) {}
+    explicit HashSetConstIterator(const TContainer* container, const T* node, bool old, size_t index) noexcept : _container(container), _node(node), _old(old), _index(index) {}
+    HashSetConstIterator(const HashSetIterator<TContainer, T>& it) noexcept : _container(it._container), _node(it._node), _old(it._old), _index(it._index) {}
+    HashSetConstIterator(const HashSetConstIterator& it) noexcept = default;
+    HashSetConstIterator(HashSetConstIterator&& it) noexcept = default;
+    ~HashSetConstIterator() noexcept = default;
+
+    HashSetConstIterator& operator=(const HashSetIterator<TContainer, T>& it) noexcept
+    { _container = it._container; _node = it._node; _old = it._old; _index = it._index; return *this; }
+    HashSetConstIterator& operator=(const HashSetConstIterator& it) noexcept = default;
+    HashSetConstIterator& operator=(HashSetConstIterator&& it) noexcept = default;
+
+    friend bool operator==(const HashSetConstIterator& it1, const HashSetConstIterator& it2) noexcept
+    { return it1._node == it2._node; }
+    friend bool operator!=(const HashSetConstIterator& it1, const HashSetConstIterator& it2) noexcept
+    { return it1._node != it2._node; }
+
+    HashSetConstIterator& operator++() noexcept;
+    HashSetConstIterator operator++(int) noexcept;
+
+    const_reference operator*() const noexcept;
+    const_pointer operator->() const noexcept;
+
+    //! Check if the iterator is valid
+    explicit operator bool() const noexcept { return _node != nullptr; }
+
+    //! Swap two instances
+    void swap(HashSetConstIterator& it) noexcept;
+    template <class UContainer, typename U>
+    friend void swap(HashSetConstIterator<UContainer, U>& it1, HashSetConstIterator<UContainer, U>& it2) noexcept;
+
+private:
+    const TContainer* _container;
+    const T* _node;
+    bool _old;
+    size_t _index;
+};
+
+/*! \example containers_hashset.cpp Intrusive hash set container example */
+
+} // namespace CppCommon
+
+#include "hashset.inl"
+
+#endif // CPPCOMMON_CONTAINERS_HASHSET_H
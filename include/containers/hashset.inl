@@ -0,0 +1,398 @@
+/*!
+    \file hashset.inl
+    \brief Intrusive hash set container inline implementation
+    \author Ivan Shynkarenka
+    \date 15.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+template <typename T, typename THash, typename TEqual>
+inline HashSet<T, THash, TEqual>::HashSet(T** buckets, size_t bucket_count, const THash& hash, const TEqual& equal) noexcept
+    : _hash(hash), _equal(equal), _size(0), _buckets(buckets), _mask(bucket_count - 1), _old_buckets(nullptr), _old_mask(0), _migrated(0)
+{
+    assert((buckets != nullptr) && "Bucket array must be valid!");
+    assert((bucket_count > 0) && ((bucket_count & (bucket_count - 1)) == 0) && "Bucket count must be a power of two!");
+
+    for (size_t i = 0; i <= _mask; ++i)
+        _buckets[i] = nullptr;
+}
+
+template <typename T, typename THash, typename TEqual>
+template <class InputIterator>
+inline HashSet<T, THash, TEqual>::HashSet(InputIterator first, InputIterator last, T** buckets, size_t bucket_count, const THash& hash, const TEqual& equal) noexcept
+    : HashSet(buckets, bucket_count, hash, equal)
+{
+    for (auto it = first; it != last; ++it)
+        insert(*it);
+}
+
+template <typename T, typename THash, typename TEqual>
+inline typename HashSet<T, THash, TEqual>::iterator HashSet<T, THash, TEqual>::begin() noexcept
+{
+    bool old = resizing();
+    size_t index = old ? _migrated : 0;
+    T* node = first(old, index);
+    return iterator(this, node, old, index);
+}
+
+template <typename T, typename THash, typename TEqual>
+inline typename HashSet<T, THash, TEqual>::const_iterator HashSet<T, THash, TEqual>::begin() const noexcept
+{
+    bool old = resizing();
+    size_t index = old ? _migrated : 0;
+    T* node = first(old, index);
+    return const_iterator(this, node, old, index);
+}
+
+template <typename T, typename THash, typename TEqual>
+inline typename HashSet<T, THash, TEqual>::const_iterator HashSet<T, THash, TEqual>::cbegin() const noexcept
+{
+    return begin();
+}
+
+template <typename T, typename THash, typename TEqual>
+inline typename HashSet<T, THash, TEqual>::iterator HashSet<T, THash, TEqual>::end() noexcept
+{
+    return iterator(this, nullptr, false, 0);
+}
+
+template <typename T, typename THash, typename TEqual>
+inline typename HashSet<T, THash, TEqual>::const_iterator HashSet<T, THash, TEqual>::end() const noexcept
+{
+    return const_iterator(this, nullptr, false, 0);
+}
+
+template <typename T, typename THash, typename TEqual>
+inline typename HashSet<T, THash, TEqual>::const_iterator HashSet<T, THash, TEqual>::cend() const noexcept
+{
+    return end();
+}
+
+template <typename T, typename THash, typename TEqual>
+template <typename TKey>
+inline typename HashSet<T, THash, TEqual>::iterator HashSet<T, THash, TEqual>::find(const TKey& key) noexcept
+{
+    bool old;
+    size_t index;
+    T* node = find_internal(key, old, index);
+    return (node != nullptr) ? iterator(this, node, old, index) : end();
+}
+
+template <typename T, typename THash, typename TEqual>
+template <typename TKey>
+inline typename HashSet<T, THash, TEqual>::const_iterator HashSet<T, THash, TEqual>::find(const TKey& key) const noexcept
+{
+    bool old;
+    size_t index;
+    T* node = find_internal(key, old, index);
+    return (node != nullptr) ? const_iterator(this, node, old, index) : end();
+}
+
+template <typename T, typename THash, typename TEqual>
+inline std::pair<typename HashSet<T, THash, TEqual>::iterator, bool> HashSet<T, THash, TEqual>::insert(T& item) noexcept
+{
+    migrate(MIGRATION_STEPS);
+
+    bool old;
+    size_t index;
+    T** chain = bucket(_hash(item), old, index);
+
+    // Check for the equal item in the bucket chain
+    for (T* node = *chain; node != nullptr; node = node->hash_next)
+        if (_equal(*node, item))
+            return std::make_pair(iterator(this, node, old, index), false);
+
+    // Link the new item at the head of the bucket chain
+    item.hash_next = *chain;
+    *chain = &item;
+    ++_size;
+
+    return std::make_pair(iterator(this, &item, old, index), true);
+}
+
+template <typename T, typename THash, typename TEqual>
+template <typename TKey>
+inline T* HashSet<T, THash, TEqual>::erase(const TKey& key) noexcept
+{
+    migrate(MIGRATION_STEPS);
+
+    bool old;
+    size_t index;
+    for (T** link = bucket(_hash(key), old, index); *link != nullptr; link = &(*link)->hash_next)
+    {
+        T* node = *link;
+        if (_equal(*node, key))
+        {
+            // Unlink the item from the bucket chain
+            *link = node->hash_next;
+            node->hash_next = nullptr;
+            --_size;
+            return node;
+        }
+    }
+
+    return nullptr;
+}
+
+template <typename T, typename THash, typename TEqual>
+inline typename HashSet<T, THash, TEqual>::iterator HashSet<T, THash, TEqual>::erase(const const_iterator& it) noexcept
+{
+    assert((it._container == this) && (it._node != nullptr) && "Iterator must be valid!");
+
+    T* node = const_cast<T*>(it._node);
+
+    // Find the next item before unlinking
+    iterator next(this, node, it._old, it._index);
+    ++next;
+
+    // Unlink the item from the bucket chain
+    T** link = it._old ? &_old_buckets[it._index] : &_buckets[it._index];
+    while (*link != node)
+        link = &(*link)->hash_next;
+    *link = node->hash_next;
+    node->hash_next = nullptr;
+    --_size;
+
+    return next;
+}
+
+template <typename T, typename THash, typename TEqual>
+inline void HashSet<T, THash, TEqual>::rehash(T** buckets, size_t bucket_count) noexcept
+{
+    assert((buckets != nullptr) && "Bucket array must be valid!");
+    assert((bucket_count > 0) && ((bucket_count & (bucket_count - 1)) == 0) && "Bucket count must be a power of two!");
+
+    // Finish the previous resizing
+    migrate();
+
+    for (size_t i = 0; i < bucket_count; ++i)
+        buckets[i] = nullptr;
+
+    _old_buckets = _buckets;
+    _old_mask = _mask;
+    _migrated = 0;
+    _buckets = buckets;
+    _mask = bucket_count - 1;
+}
+
+template <typename T, typename THash, typename TEqual>
+inline bool HashSet<T, THash, TEqual>::migrate(size_t steps) noexcept
+{
+    for (; (_old_buckets != nullptr) && (steps > 0); --steps)
+    {
+        // Move the chain of the next old bucket into the new bucket array
+        T* node = _old_buckets[_migrated];
+        _old_buckets[_migrated] = nullptr;
+        while (node != nullptr)
+        {
+            T* next = node->hash_next;
+            T** chain = &_buckets[_hash(*node) & _mask];
+            node->hash_next = *chain;
+            *chain = node;
+            node = next;
+        }
+
+        // Release the old bucket array when all chains are moved
+        if (++_migrated > _old_mask)
+        {
+            _old_buckets = nullptr;
+            _old_mask = 0;
+            _migrated = 0;
+        }
+    }
+
+    return (_old_buckets == nullptr);
+}
+
+template <typename T, typename THash, typename TEqual>
+inline void HashSet<T, THash, TEqual>::clear() noexcept
+{
+    for (size_t i = 0; i <= _mask; ++i)
+        _buckets[i] = nullptr;
+
+    _size = 0;
+    _old_buckets = nullptr;
+    _old_mask = 0;
+    _migrated = 0;
+}
+
+template <typename T, typename THash, typename TEqual>
+inline void HashSet<T, THash, TEqual>::swap(HashSet& hashset) noexcept
+{
+    using std::swap;
+    swap(_hash, hashset._hash);
+    swap(_equal, hashset._equal);
+    swap(_size, hashset._size);
+    swap(_buckets, hashset._buckets);
+    swap(_mask, hashset._mask);
+    swap(_old_buckets, hashset._old_buckets);
+    swap(_old_mask, hashset._old_mask);
+    swap(_migrated, hashset._migrated);
+}
+
+template <typename T, typename THash, typename TEqual>
+inline void swap(HashSet<T, THash, TEqual>& hashset1, HashSet<T, THash, TEqual>& hashset2) noexcept
+{
+    hashset1.swap(hashset2);
+}
+
+template <typename T, typename THash, typename TEqual>
+inline T** HashSet<T, THash, TEqual>::bucket(size_t hash, bool& old, size_t& index) const noexcept
+{
+    if (_old_buckets != nullptr)
+    {
+        index = hash & _old_mask;
+        if (index >= _migrated)
+        {
+            old = true;
+            return &_old_buckets[index];
+        }
+    }
+
+    old = false;
+    index = hash & _mask;
+    return &_buckets[index];
+}
+
+template <typename T, typename THash, typename TEqual>
+inline T* HashSet<T, THash, TEqual>::first(bool& old, size_t& index) const noexcept
+{
+    if (old)
+    {
+        for (; index <= _old_mask; ++index)
+            if (_old_buckets[index] != nullptr)
+                return _old_buckets[index];
+
+        old = false;
+        index = 0;
+    }
+
+    for (; index <= _mask; ++index)
+        if (_buckets[index] != nullptr)
+            return _buckets[index];
+
+    return nullptr;
+}
+
+template <typename T, typename THash, typename TEqual>
+template <typename TKey>
+inline T* HashSet<T, THash, TEqual>::find_internal(const TKey& key, bool& old, size_t& index) const noexcept
+{
+    for (T* node = *bucket(_hash(key), old, index); node != nullptr; node = node->hash_next)
+        if (_equal(*node, key))
+            return node;
+
+    return nullptr;
+}
+
+template <class TContainer, typename T>
+HashSetIterator<TContainer, T>& HashSetIterator<TContainer, T>::operator++() noexcept
+{
+    if (_node != nullptr)
+    {
+        if (_node->hash_next != nullptr)
+            _node = _node->hash_next;
+        else
+        {
+            ++_index;
+            _node = _container->first(_old, _index);
+        }
+    }
+    return *this;
+}
+
+template <class TContainer, typename T>
+inline HashSetIterator<TContainer, T> HashSetIterator<TContainer, T>::operator++(int) noexcept
+{
+    HashSetIterator<TContainer, T> result(*this);
+    operator++();
+    return result;
+}
+
+template <class TContainer, typename T>
+typename HashSetIterator<TContainer, T>::reference HashSetIterator<TContainer, T>::operator*() noexcept
+{
+    assert((_node != nullptr) && "Iterator must be valid!");
+
+    return *_node;
+}
+
+template <class TContainer, typename T>
+typename HashSetIterator<TContainer, T>::pointer HashSetIterator<TContainer, T>::operator->() noexcept
+{
+    return _node;
+}
+
+template <class TContainer, typename T>
+void HashSetIterator<TContainer, T>::swap(HashSetIterator& it) noexcept
+{
+    using std::swap;
+    swap(_container, it._container);
+    swap(_node, it._node);
+    swap(_old, it._old);
+    swap(_index, it._index);
+}
+
+template <class TContainer, typename T>
+void swap(HashSetIterator<TContainer, T>& it1, HashSetIterator<TContainer, T>& it2) noexcept
+{
+    it1.swap(it2);
+}
+
+template <class TContainer, typename T>
+HashSetConstIterator<TContainer, T>& HashSetConstIterator<TContainer, T>::operator++() noexcept
+{
+    if (_node != nullptr)
+    {
+        if (_node->hash_next != nullptr)
+            _node = _node->hash_next;
+        else
+        {
+            ++_index;
+            _node = _container->first(_old, _index);
+        }
+    }
+    return *this;
+}
+
+template <class TContainer, typename T>
+inline HashSetConstIterator<TContainer, T> HashSetConstIterator<TContainer, T>::operator++(int) noexcept
+{
+    HashSetConstIterator<TContainer, T> result(*this);
+    operator++();
+    return result;
+}
+
+template <class TContainer, typename T>
+typename HashSetConstIterator<TContainer, T>::const_reference HashSetConstIterator<TContainer, T>::operator*() const noexcept
+{
+    assert((_node != nullptr) && "Iterator must be valid!");
+
+    return *_node;
+}
+
+template <class TContainer, typename T>
+typename HashSetConstIterator<TContainer, T>::const_pointer HashSetConstIterator<TContainer, T>::operator->() const noexcept
+{
+    return _node;
+}
+
+template <class TContainer, typename T>
+void HashSetConstIterator<TContainer, T>::swap(HashSetConstIterator& it) noexcept
+{
+    using std::swap;
+    swap(_container, it._container);
+    swap(_node, it._node);
+    swap(_old, it._old);
+    swap(_index, it._index);
+}
+
+template <class TContainer, typename T>
+void swap(HashSetConstIterator<TContainer, T>& it1, HashSetConstIterator<TContainer, T>& it2) noexcept
+{
+    it1.swap(it2);
+}
+
+} // namespace CppCommon
@@ -0,0 +1,167 @@
+/*!
+    \file heap.h
+    \brief Intrusive bounded d-ary heap container definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_CONTAINERS_HEAP_H
+#define CPPCOMMON_CONTAINERS_HEAP_H
+
+#include "memory/memory.h"
+
+#include <cassert>
+#include <cstddef>
+#include <functional>
+#include <new>
+
+namespace CppCommon {
+
+//! Intrusive bounded d-ary heap container
+/*!
+    Heap is the priority queue of intrusive items. Each item stores its index
+    in the heap, so besides push() and pop() of the top item the heap supports
+    update() of the item priority (both decrease and increase key) and erase()
+    of an arbitrary item in O(log n) time.
+
+    The top item is the least one in terms of the comparator, so the heap
+    with std::less<T> comparator is the min-heap (e.g. the earliest deadline
+    on the top of the heap of timers).
+
+    The heap is bounded: the array of item pointers is allocated once with the
+    given capacity, so push() never allocates memory and fails if the heap is
+    full.
+
+    Each heap node has D children (4 by default), so the heap is half as deep
+    as the binary one and sift down compares children which are adjacent in
+    memory. The array is aligned to the cache line and shifted by D - 1 slots,
+    so all children of each node share the same cache line (for power of two
+    D up to 8 on 64-bit platforms). Items of all children are prefetched
+    before comparisons to overlap their cache misses. pop() moves the hole of
+    the top item down to the leaf and sifts the last item up from there, which
+    saves one comparison per level, because the last item usually belongs to
+    the bottom of the heap.
+
+    Not thread-safe.
+
+    https://en.wikipedia.org/wiki/D-ary_heap
+*/
+template <typename T, typename TCompare = std::less<T>, size_t D = 4>
+class Heap
+{
+    static_assert(D >= 2, "Heap arity must be at least 2!");
+
+public:
+    // Standard container type definitions
+    typedef T value_type;
+    typedef TCompare value_compare;
+    typedef value_type& reference;
+    typedef const value_type& const_reference;
+    typedef value_type* pointer;
+    typedef const value_type* const_pointer;
+    typedef ptrdiff_t difference_type;
+    typedef size_t size_type;
+
+    //! Invalid heap index of the item which is not in the heap
+    static constexpr size_t npos = (size_t)-1;
+
+    //! Heap node
+    struct Node
+    {
+        size_t index;   //!< Index of the item in the heap (npos if the item is not in the heap)
+
+        Node() : index(npos) {}
+    };
+
+    //! Initialize the heap with a given capacity
+    /*!
+        \param capacity - Heap capacity
+        \param compare - Heap item comparator (default is TCompare())
+    */
+    explicit Heap(size_t capacity, const TCompare& compare = TCompare());
+    Heap(const Heap&) = delete;
+    Heap(Heap&& heap) noexcept;
+    ~Heap() noexcept;
+
+    Heap& operator=(const Heap&) = delete;
+    Heap& operator=(Heap&& heap) noexcept;
+
+    //! Check if the heap is not empty
+    explicit operator bool() const noexcept { return !empty(); }
+
+    //! Is the heap empty?
+    bool empty() const noexcept { return _size == 0; }
+    //! Is the heap full?
+    bool full() const noexcept { return _size == _capacity; }
+
+    //! Get the heap size
+    size_t size() const noexcept { return _size; }
+    //! Get the heap capacity
+    size_t capacity() const noexcept { return _capacity; }
+
+    //! Get the top heap item
+    T* top() noexcept { return (_size > 0) ? _heap[0] : nullptr; }
+    const T* top() const noexcept { return (_size > 0) ? _heap[0] : nullptr; }
+
+    //! Compare two items: if the first item is less than the second one?
+    bool compare(const T& item1, const T& item2) const noexcept { return _compare(item1, item2); }
+
+    //! Is the given item in the heap?
+    bool contains(const T& item) const noexcept { return (item.index < _size) && (_heap[item.index] == &item); }
+
+    //! Push a new item into the heap
+    /*!
+        \param item - Pushed item
+        \return 'true' if the item was successfully pushed, 'false' if the heap is full
+    */
+    bool push(T& item) noexcept;
+
+    //! Pop the top item from the heap
+    /*!
+        \return The top item popped from the heap or nullptr if the heap is empty
+    */
+    T* pop() noexcept;
+
+    //! Restore the heap order after the priority of the given item was changed
+    /*!
+        \param item - Updated item (must be in the heap)
+    */
+    void update(T& item) noexcept;
+
+    //! Erase the given item from the heap
+    /*!
+        \param item - Item to erase
+        \return Erased item or nullptr if the item is not in the heap
+    */
+    T* erase(T& item) noexcept;
+
+    //! Clear the heap
+    void clear() noexcept;
+
+    //! Swap two instances
+    void swap(Heap& heap) noexcept;
+    template <typename U, typename UCompare, size_t UD>
+    friend void swap(Heap<U, UCompare, UD>& heap1, Heap<U, UCompare, UD>& heap2) noexcept;
+
+private:
+    static constexpr size_t ALIGNMENT = 64;
+
+    TCompare _compare;  // Heap item comparator
+    size_t _capacity;   // Heap capacity
+    size_t _size;       // Heap size
+    T** _storage;       // Heap storage aligned to the cache line
+    T** _heap;          // Heap array shifted to align children of each node
+
+    void SiftUp(size_t index) noexcept;
+    void SiftDown(size_t index) noexcept;
+    void Restore(size_t index) noexcept;
+};
+
+/*! \example containers_heap.cpp Intrusive bounded d-ary heap container example */
+
+} // namespace CppCommon
+
+#include "heap.inl"
+
+#endif // CPPCOMMON_CONTAINERS_HEAP_H
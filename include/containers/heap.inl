@@ -0,0 +1,201 @@
+/*!
+    \file heap.inl
+    \brief Intrusive bounded d-ary heap container inline implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+template <typename T, typename TCompare, size_t D>
+inline Heap<T, TCompare, D>::Heap(size_t capacity, const TCompare& compare)
+    : _compare(compare), _capacity(capacity), _size(0)
+{
+    // Children of the node with index i start from the index D * i + 1, so
+    // the shift by D - 1 slots places each children group at D * (i + 1) slot
+    _storage = (T**)::operator new((capacity + D - 1) * sizeof(T*), std::align_val_t(ALIGNMENT));
+    _heap = _storage + (D - 1);
+}
+
+template <typename T, typename TCompare, size_t D>
+inline Heap<T, TCompare, D>::Heap(Heap&& heap) noexcept
+    : _compare(heap._compare), _capacity(0), _size(0), _storage(nullptr), _heap(nullptr)
+{
+    swap(heap);
+}
+
+template <typename T, typename TCompare, size_t D>
+inline Heap<T, TCompare, D>::~Heap() noexcept
+{
+    clear();
+    if (_storage != nullptr)
+        ::operator delete(_storage, std::align_val_t(ALIGNMENT));
+}
+
+template <typename T, typename TCompare, size_t D>
+inline Heap<T, TCompare, D>& Heap<T, TCompare, D>::operator=(Heap&& heap) noexcept
+{
+    swap(heap);
+    return *this;
+}
+
+template <typename T, typename TCompare, size_t D>
+inline bool Heap<T, TCompare, D>::push(T& item) noexcept
+{
+    assert(!contains(item) && "Item is already in the heap!");
+    if (full())
+        return false;
+
+    _heap[_size] = &item;
+    SiftUp(_size++);
+    return true;
+}
+
+template <typename T, typename TCompare, size_t D>
+inline T* Heap<T, TCompare, D>::pop() noexcept
+{
+    if (_size == 0)
+        return nullptr;
+
+    T* result = _heap[0];
+    if (--_size > 0)
+    {
+        // Move the hole down to the leaf through the least children and fill it with the last item
+        size_t index = 0;
+        for (;;)
+        {
+            size_t first = D * index + 1;
+            if (first >= _size)
+                break;
+            size_t last = std::min(first + D, _size);
+            for (size_t i = first; i < last; ++i)
+                Memory::Prefetch(_heap[i]);
+            size_t child = first;
+            for (size_t i = first + 1; i < last; ++i)
+                if (compare(*_heap[i], *_heap[child]))
+                    child = i;
+            _heap[index] = _heap[child];
+            _heap[index]->index = index;
+            index = child;
+        }
+        _heap[index] = _heap[_size];
+        SiftUp(index);
+    }
+    result->index = npos;
+    return result;
+}
+
+template <typename T, typename TCompare, size_t D>
+inline void Heap<T, TCompare, D>::update(T& item) noexcept
+{
+    assert(contains(item) && "Item is not in the heap!");
+    if (!contains(item))
+        return;
+
+    Restore(item.index);
+}
+
+template <typename T, typename TCompare, size_t D>
+inline T* Heap<T, TCompare, D>::erase(T& item) noexcept
+{
+    if (!contains(item))
+        return nullptr;
+
+    // Replace the erased item with the last one
+    size_t index = item.index;
+    if (index != --_size)
+    {
+        _heap[index] = _heap[_size];
+        Restore(index);
+    }
+    item.index = npos;
+    return &item;
+}
+
+template <typename T, typename TCompare, size_t D>
+inline void Heap<T, TCompare, D>::clear() noexcept
+{
+    for (size_t i = 0; i < _size; ++i)
+        _heap[i]->index = npos;
+    _size = 0;
+}
+
+template <typename T, typename TCompare, size_t D>
+inline void Heap<T, TCompare, D>::swap(Heap& heap) noexcept
+{
+    using std::swap;
+    swap(_compare, heap._compare);
+    swap(_capacity, heap._capacity);
+    swap(_size, heap._size);
+    swap(_storage, heap._storage);
+    swap(_heap, heap._heap);
+}
+
+template <typename T, typename TCompare, size_t D>
+inline void swap(Heap<T, TCompare, D>& heap1, Heap<T, TCompare, D>& heap2) noexcept
+{
+    heap1.swap(heap2);
+}
+
+template <typename T, typename TCompare, size_t D>
+inline void Heap<T, TCompare, D>::SiftUp(size_t index) noexcept
+{
+    T* item = _heap[index];
+    while (index > 0)
+    {
+        size_t parent = (index - 1) / D;
+        T* current = _heap[parent];
+        if (!compare(*item, *current))
+            break;
+
+        _heap[index] = current;
+        current->index = index;
+        index = parent;
+    }
+    _heap[index] = item;
+    item->index = index;
+}
+
+template <typename T, typename TCompare, size_t D>
+inline void Heap<T, TCompare, D>::SiftDown(size_t index) noexcept
+{
+    T* item = _heap[index];
+    for (;;)
+    {
+        size_t first = D * index + 1;
+        if (first >= _size)
+            break;
+        size_t last = std::min(first + D, _size);
+
+        // Prefetch all children items to overlap their cache misses
+        for (size_t i = first; i < last; ++i)
+            Memory::Prefetch(_heap[i]);
+
+        // Find the least child
+        size_t child = first;
+        for (size_t i = first + 1; i < last; ++i)
+            if (compare(*_heap[i], *_heap[child]))
+                child = i;
+
+        if (!compare(*_heap[child], *item))
+            break;
+
+        _heap[index] = _heap[child];
+        _heap[index]->index = index;
+        index = child;
+    }
+    _heap[index] = item;
+    item->index = index;
+}
+
+template <typename T, typename TCompare, size_t D>
+inline void Heap<T, TCompare, D>::Restore(size_t index) noexcept
+{
+    if ((index > 0) && compare(*_heap[index], *_heap[(index - 1) / D]))
+        SiftUp(index);
+    else
+        SiftDown(index);
+}
+
+} // namespace CppCommon
@@ -0,0 +1,221 @@
+/*!
+    \file inplace_vector.h
+    \brief Inplace vector container definition
+    \author Ivan Shynkarenka
+    \date 15.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_CONTAINERS_INPLACE_VECTOR_H
+#define CPPCOMMON_CONTAINERS_INPLACE_VECTOR_H
+
+#include <algorithm>
+#include <cassert>
+#include <compare>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace CppCommon {
+
+//! Inplace vector container
+/*!
+    Inplace vector is a std::vector compatible container with the fixed capacity
+    N and all items stored inside the container itself. It never allocates memory,
+    so it could be used inside message structs and shared memory. Inplace vector
+    of trivially copyable items is trivially copyable itself.
+
+    Operations which exceed the capacity throw std::length_error, try_push_back()
+    and try_emplace_back() methods return nullptr instead.
+
+    Not thread-safe.
+*/
+template <typename T, size_t N>
+class InplaceVector
+{
+public:
+    // Standard container type definitions
+    typedef T value_type;
+    typedef value_type& reference;
+    typedef const value_type& const_reference;
+    typedef value_type* pointer;
+    typedef const value_type* const_pointer;
+    typedef ptrdiff_t difference_type;
+    typedef size_t size_type;
+    typedef pointer iterator;
+    typedef const_pointer const_iterator;
+    typedef std::reverse_iterator<iterator> reverse_iterator;
+    typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+
+    InplaceVector() noexcept : _size(0) {}
+    explicit InplaceVector(size_t count);
+    InplaceVector(size_t count, const T& value);
+    template <class InputIterator, typename = std::enable_if_t<!std::is_integral_v<InputIterator>>>
+    InplaceVector(InputIterator first, InputIterator last);
+    InplaceVector(std::initializer_list<T> list);
+    InplaceVector(const InplaceVector& vector) requires std::is_trivially_copy_constructible_v<T> = default;
+    InplaceVector(const InplaceVector& vector);
+    InplaceVector(InplaceVector&& vector) noexcept requires std::is_trivially_move_constructible_v<T> = default;
+    InplaceVector(InplaceVector&& vector) noexcept(std::is_nothrow_move_constructible_v<T>);
+    ~InplaceVector() requires std::is_trivially_destructible_v<T> = default;
+    ~InplaceVector() noexcept { clear(); }
+
+    InplaceVector& operator=(const InplaceVector& vector) requires std::is_trivially_copyable_v<T> = default;
+    InplaceVector& operator=(const InplaceVector& vector);
+    InplaceVector& operator=(InplaceVector&& vector) noexcept requires std::is_trivially_copyable_v<T> = default;
+    InplaceVector& operator=(InplaceVector&& vector) noexcept(std::is_nothrow_move_constructible_v<T> && std::is_nothrow_move_assignable_v<T>);
+    InplaceVector& operator=(std::initializer_list<T> list);
+
+    //! Check if the inplace vector is not empty
+    explicit operator bool() const noexcept { return !empty(); }
+
+    //! Access to the item with the given index
+    reference operator[](size_t index) noexcept { assert((index < _size) && "Index out of bounds!"); return data()[index]; }
+    const_reference operator[](size_t index) const noexcept { assert((index < _size) && "Index out of bounds!"); return data()[index]; }
+
+    //! Is the inplace vector empty?
+    bool empty() const noexcept { return (_size == 0); }
+    //! Is the inplace vector full?
+    bool full() const noexcept { return (_size == N); }
+    //! Get the inplace vector size
+    size_t size() const noexcept { return _size; }
+    //! Get the inplace vector capacity
+    static constexpr size_t capacity() noexcept { return N; }
+    //! Get the inplace vector maximum size
+    static constexpr size_t max_size() noexcept { return N; }
+
+    //! Get the inplace vector data
+    T* data() noexcept { return reinterpret_cast<T*>(_buffer); }
+    const T* data() const noexcept { return reinterpret_cast<const T*>(_buffer); }
+
+    //! Access to the item with the given index or throw std::out_of_range exception
+    reference at(size_t index);
+    const_reference at(size_t index) const;
+
+    //! Get the front item
+    reference front() noexcept { assert(!empty() && "Inplace vector is empty!"); return data()[0]; }
+    const_reference front() const noexcept { assert(!empty() && "Inplace vector is empty!"); return data()[0]; }
+    //! Get the back item
+    reference back() noexcept { assert(!empty() && "Inplace vector is empty!"); return data()[_size - 1]; }
+    const_reference back() const noexcept { assert(!empty() && "Inplace vector is empty!"); return data()[_size - 1]; }
+
+    //! Get the begin inplace vector iterator
+    iterator begin() noexcept { return data(); }
+    const_iterator begin() const noexcept { return data(); }
+    const_iterator cbegin() const noexcept { return data(); }
+    //! Get the end inplace vector iterator
+    iterator end() noexcept { return data() + _size; }
+    const_iterator end() const noexcept { return data() + _size; }
+    const_iterator cend() const noexcept { return data() + _size; }
+
+    //! Get the reverse begin inplace vector iterator
+    reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
+    const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(end()); }
+    const_reverse_iterator crbegin() const noexcept { return const_reverse_iterator(end()); }
+    //! Get the reverse end inplace vector iterator
+    reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
+    const_reverse_iterator rend() const noexcept { return const_reverse_iterator(begin()); }
+    const_reverse_iterator crend() const noexcept { return const_reverse_iterator(begin()); }
+
+    //! Resize the inplace vector with default initialized items
+    void resize(size_t size);
+    //! Resize the inplace vector with copies of the given item
+    void resize(size_t size, const T& value);
+
+    //! Assign the given count of item copies
+    void assign(size_t count, const T& value);
+    //! Assign items of the given range
+    template <class InputIterator, typename = std::enable_if_t<!std::is_integral_v<InputIterator>>>
+    void assign(InputIterator first, InputIterator last);
+    //! Assign items of the given initializer list
+    void assign(std::initializer_list<T> list) { assign(list.begin(), list.end()); }
+
+    //! Push a new item into the back of the inplace vector
+    void push_back(const T& value) { emplace_back(value); }
+    void push_back(T&& value) { emplace_back(std::move(value)); }
+    //! Emplace a new item into the back of the inplace vector or throw std::length_error exception
+    /*!
+        \param args - Arguments to construct the item
+        \return Reference to the emplaced item
+    */
+    template <typename... Args>
+    reference emplace_back(Args&&... args);
+    //! Try to push a new item into the back of the inplace vector
+    /*!
+        \param value - Item to push
+        \return Pointer to the pushed item or nullptr if the inplace vector is full
+    */
+    pointer try_push_back(const T& value) { return try_emplace_back(value); }
+    pointer try_push_back(T&& value) { return try_emplace_back(std::move(value)); }
+    //! Try to emplace a new item into the back of the inplace vector
+    /*!
+        \param args - Arguments to construct the item
+        \return Pointer to the emplaced item or nullptr if the inplace vector is full
+    */
+    template <typename... Args>
+    pointer try_emplace_back(Args&&... args);
+    //! Pop the back item from the inplace vector
+    void pop_back() noexcept;
+
+    //! Insert a new item before the given position
+    /*!
+        \param position - Insert position
+        \param value - Item to insert
+        \return Iterator to the inserted item
+    */
+    iterator insert(const_iterator position, const T& value) { return emplace(position, value); }
+    iterator insert(const_iterator position, T&& value) { return emplace(position, std::move(value)); }
+    //! Insert the given count of item copies before the given position
+    iterator insert(const_iterator position, size_t count, const T& value);
+    //! Insert items of the given range before the given position
+    template <class InputIterator, typename = std::enable_if_t<!std::is_integral_v<InputIterator>>>
+    iterator insert(const_iterator position, InputIterator first, InputIterator last);
+    //! Insert items of the given initializer list before the given position
+    iterator insert(const_iterator position, std::initializer_list<T> list) { return insert(position, list.begin(), list.end()); }
+    //! Emplace a new item before the given position
+    template <typename... Args>
+    iterator emplace(const_iterator position, Args&&... args);
+
+    //! Erase the item at the given position
+    /*!
+        \param position - Erase position
+        \return Iterator to the item following the erased one
+    */
+    iterator erase(const_iterator position);
+    //! Erase items of the given range
+    iterator erase(const_iterator first, const_iterator last);
+
+    //! Clear the inplace vector
+    void clear() noexcept;
+
+    //! Swap two instances
+    void swap(InplaceVector& vector);
+    template <typename U, size_t M>
+    friend void swap(InplaceVector<U, M>& vector1, InplaceVector<U, M>& vector2);
+
+private:
+    size_t _size;
+    alignas(T) unsigned char _buffer[(N > 0) ? (N * sizeof(T)) : 1];
+
+    //! Check the capacity for the given size
+    static void check(size_t size);
+};
+
+//! Compare inplace vectors for equality
+template <typename T, size_t N, size_t M>
+bool operator==(const InplaceVector<T, N>& vector1, const InplaceVector<T, M>& vector2);
+//! Compare inplace vectors lexicographically
+template <typename T, size_t N, size_t M>
+auto operator<=>(const InplaceVector<T, N>& vector1, const InplaceVector<T, M>& vector2);
+
+/*! \example containers_small_vector.cpp Small vector container example */
+
+} // namespace CppCommon
+
+#include "inplace_vector.inl"
+
+#endif // CPPCOMMON_CONTAINERS_INPLACE_VECTOR_H
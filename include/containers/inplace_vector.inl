@@ -0,0 +1,279 @@
+/*!
+    \file inplace_vector.inl
+    \brief Inplace vector container inline implementation
+    \author Ivan Shynkarenka
+    \date 15.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+template <typename T, size_t N>
+inline InplaceVector<T, N>::InplaceVector(size_t count) : _size(0)
+{
+    resize(count);
+}
+
+template <typename T, size_t N>
+inline InplaceVector<T, N>::InplaceVector(size_t count, const T& value) : _size(0)
+{
+    assign(count, value);
+}
+
+template <typename T, size_t N>
+template <class InputIterator, typename>
+inline InplaceVector<T, N>::InplaceVector(InputIterator first, InputIterator last) : _size(0)
+{
+    assign(first, last);
+}
+
+template <typename T, size_t N>
+inline InplaceVector<T, N>::InplaceVector(std::initializer_list<T> list) : _size(0)
+{
+    assign(list.begin(), list.end());
+}
+
+template <typename T, size_t N>
+inline InplaceVector<T, N>::InplaceVector(const InplaceVector& vector) : _size(0)
+{
+    std::uninitialized_copy(vector.begin(), vector.end(), data());
+    _size = vector._size;
+}
+
+template <typename T, size_t N>
+inline InplaceVector<T, N>::InplaceVector(InplaceVector&& vector) noexcept(std::is_nothrow_move_constructible_v<T>) : _size(0)
+{
+    std::uninitialized_move(vector.begin(), vector.end(), data());
+    _size = vector._size;
+    vector.clear();
+}
+
+template <typename T, size_t N>
+inline InplaceVector<T, N>& InplaceVector<T, N>::operator=(const InplaceVector& vector)
+{
+    if (this != &vector)
+        assign(vector.begin(), vector.end());
+    return *this;
+}
+
+template <typename T, size_t N>
+inline InplaceVector<T, N>& InplaceVector<T, N>::operator=(InplaceVector&& vector) noexcept(std::is_nothrow_move_constructible_v<T> && std::is_nothrow_move_assignable_v<T>)
+{
+    if (this == &vector)
+        return *this;
+
+    clear();
+    std::uninitialized_move(vector.begin(), vector.end(), data());
+    _size = vector._size;
+    vector.clear();
+    return *this;
+}
+
+template <typename T, size_t N>
+inline InplaceVector<T, N>& InplaceVector<T, N>::operator=(std::initializer_list<T> list)
+{
+    assign(list.begin(), list.end());
+    return *this;
+}
+
+template <typename T, size_t N>
+inline typename InplaceVector<T, N>::reference InplaceVector<T, N>::at(size_t index)
+{
+    if (index >= _size)
+        throw std::out_of_range("Index out of bounds!");
+    return data()[index];
+}
+
+template <typename T, size_t N>
+inline typename InplaceVector<T, N>::const_reference InplaceVector<T, N>::at(size_t index) const
+{
+    if (index >= _size)
+        throw std::out_of_range("Index out of bounds!");
+    return data()[index];
+}
+
+template <typename T, size_t N>
+inline void InplaceVector<T, N>::resize(size_t size)
+{
+    check(size);
+    if (size > _size)
+        std::uninitialized_value_construct(data() + _size, data() + size);
+    else
+        std::destroy(data() + size, data() + _size);
+    _size = size;
+}
+
+template <typename T, size_t N>
+inline void InplaceVector<T, N>::resize(size_t size, const T& value)
+{
+    check(size);
+    if (size > _size)
+        std::uninitialized_fill(data() + _size, data() + size, value);
+    else
+        std::destroy(data() + size, data() + _size);
+    _size = size;
+}
+
+template <typename T, size_t N>
+inline void InplaceVector<T, N>::assign(size_t count, const T& value)
+{
+    check(count);
+    T copy(value);
+    clear();
+    std::uninitialized_fill(data(), data() + count, copy);
+    _size = count;
+}
+
+template <typename T, size_t N>
+template <class InputIterator, typename>
+inline void InplaceVector<T, N>::assign(InputIterator first, InputIterator last)
+{
+    clear();
+    if constexpr (std::is_base_of_v<std::forward_iterator_tag, typename std::iterator_traits<InputIterator>::iterator_category>)
+    {
+        size_t count = (size_t)std::distance(first, last);
+        check(count);
+        std::uninitialized_copy(first, last, data());
+        _size = count;
+    }
+    else
+    {
+        for (; first != last; ++first)
+            emplace_back(*first);
+    }
+}
+
+template <typename T, size_t N>
+template <typename... Args>
+inline typename InplaceVector<T, N>::reference InplaceVector<T, N>::emplace_back(Args&&... args)
+{
+    check(_size + 1);
+    T* item = std::construct_at(data() + _size, std::forward<Args>(args)...);
+    ++_size;
+    return *item;
+}
+
+template <typename T, size_t N>
+template <typename... Args>
+inline typename InplaceVector<T, N>::pointer InplaceVector<T, N>::try_emplace_back(Args&&... args)
+{
+    if (_size >= N)
+        return nullptr;
+
+    T* item = std::construct_at(data() + _size, std::forward<Args>(args)...);
+    ++_size;
+    return item;
+}
+
+template <typename T, size_t N>
+inline void InplaceVector<T, N>::pop_back() noexcept
+{
+    assert(!empty() && "Inplace vector is empty!");
+    std::destroy_at(data() + --_size);
+}
+
+template <typename T, size_t N>
+inline typename InplaceVector<T, N>::iterator InplaceVector<T, N>::insert(const_iterator position, size_t count, const T& value)
+{
+    size_t index = (size_t)(position - data());
+    size_t size = _size;
+
+    check(_size + count);
+    T copy(value);
+    for (size_t i = 0; i < count; ++i)
+        emplace_back(copy);
+
+    std::rotate(data() + index, data() + size, data() + _size);
+    return data() + index;
+}
+
+template <typename T, size_t N>
+template <class InputIterator, typename>
+inline typename InplaceVector<T, N>::iterator InplaceVector<T, N>::insert(const_iterator position, InputIterator first, InputIterator last)
+{
+    size_t index = (size_t)(position - data());
+    size_t size = _size;
+
+    if constexpr (std::is_base_of_v<std::forward_iterator_tag, typename std::iterator_traits<InputIterator>::iterator_category>)
+        check(_size + (size_t)std::distance(first, last));
+    for (; first != last; ++first)
+        emplace_back(*first);
+
+    std::rotate(data() + index, data() + size, data() + _size);
+    return data() + index;
+}
+
+template <typename T, size_t N>
+template <typename... Args>
+inline typename InplaceVector<T, N>::iterator InplaceVector<T, N>::emplace(const_iterator position, Args&&... args)
+{
+    size_t index = (size_t)(position - data());
+    emplace_back(std::forward<Args>(args)...);
+    std::rotate(data() + index, data() + _size - 1, data() + _size);
+    return data() + index;
+}
+
+template <typename T, size_t N>
+inline typename InplaceVector<T, N>::iterator InplaceVector<T, N>::erase(const_iterator position)
+{
+    return erase(position, position + 1);
+}
+
+template <typename T, size_t N>
+inline typename InplaceVector<T, N>::iterator InplaceVector<T, N>::erase(const_iterator first, const_iterator last)
+{
+    T* from = data() + (first - data());
+    T* to = data() + (last - data());
+    if (from != to)
+    {
+        T* tail = std::move(to, end(), from);
+        std::destroy(tail, end());
+        _size = (size_t)(tail - data());
+    }
+    return from;
+}
+
+template <typename T, size_t N>
+inline void InplaceVector<T, N>::clear() noexcept
+{
+    std::destroy(data(), data() + _size);
+    _size = 0;
+}
+
+template <typename T, size_t N>
+inline void InplaceVector<T, N>::swap(InplaceVector& vector)
+{
+    if (this == &vector)
+        return;
+
+    InplaceVector temp(std::move(vector));
+    vector = std::move(*this);
+    *this = std::move(temp);
+}
+
+template <typename T, size_t N>
+inline void swap(InplaceVector<T, N>& vector1, InplaceVector<T, N>& vector2)
+{
+    vector1.swap(vector2);
+}
+
+template <typename T, size_t N>
+inline void InplaceVector<T, N>::check(size_t size)
+{
+    if (size > N)
+        throw std::length_error("Inplace vector capacity exceeded!");
+}
+
+template <typename T, size_t N, size_t M>
+inline bool operator==(const InplaceVector<T, N>& vector1, const InplaceVector<T, M>& vector2)
+{
+    return std::equal(vector1.begin(), vector1.end(), vector2.begin(), vector2.end());
+}
+
+template <typename T, size_t N, size_t M>
+inline auto operator<=>(const InplaceVector<T, N>& vector1, const InplaceVector<T, M>& vector2)
+{
+    return std::lexicographical_compare_three_way(vector1.begin(), vector1.end(), vector2.begin(), vector2.end());
+}
+
+} // namespace CppCommon
@@ -9,6 +9,8 @@
 #ifndef CPPCOMMON_CONTAINERS_LIST_H
 #define CPPCOMMON_CONTAINERS_LIST_H
 
+#include "memory/memory.h"
+
 #include <cassert>
 #include <cstddef>
 #include <iterator>
@@ -273,6 +275,24 @@ public:
     */
     T* pop_prev(T& base) noexcept;
 
+    //! Call the given function for each list item with software prefetch
+    /*!
+        The lookahead cursor runs the given distance ahead of the current item
+        and prefetches the next node it will chase, so cache misses of the
+        pointer chasing overlap with function calls for current items instead
+        of stalling the traversal on each node.
+
+        The function may pop the current item, but must not modify other items
+        of the list.
+
+        \param fn - Function to call as fn(item)
+        \param distance - Prefetch distance in items (default is 8)
+    */
+    template <class TFunction>
+    void for_each_prefetch(TFunction&& fn, size_t distance = 8);
+    template <class TFunction>
+    void for_each_prefetch(TFunction&& fn, size_t distance = 8) const;
+
     //! Reverse the list
     void reverse() noexcept;
 
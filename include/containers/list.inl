@@ -249,6 +249,52 @@ inline void List<T>::reverse() noexcept
     _front = prev;
 }
 
+template <typename T>
+template <class TFunction>
+inline void List<T>::for_each_prefetch(TFunction&& fn, size_t distance)
+{
+    // Move the lookahead cursor to the prefetch distance
+    T* ahead = _front;
+    for (size_t i = 0; (i < distance) && (ahead != nullptr); ++i)
+        ahead = ahead->next;
+
+    T* current = _front;
+    while (current != nullptr)
+    {
+        if (ahead != nullptr)
+        {
+            ahead = ahead->next;
+            Memory::Prefetch(ahead);
+        }
+        T* next = current->next;
+        fn(*current);
+        current = next;
+    }
+}
+
+template <typename T>
+template <class TFunction>
+inline void List<T>::for_each_prefetch(TFunction&& fn, size_t distance) const
+{
+    // Move the lookahead cursor to the prefetch distance
+    const T* ahead = _front;
+    for (size_t i = 0; (i < distance) && (ahead != nullptr); ++i)
+        ahead = ahead->next;
+
+    const T* current = _front;
+    while (current != nullptr)
+    {
+        if (ahead != nullptr)
+        {
+            ahead = ahead->next;
+            Memory::Prefetch(ahead);
+        }
+        const T* next = current->next;
+        fn(*current);
+        current = next;
+    }
+}
+
 template <typename T>
 inline void List<T>::clear() noexcept
 {
@@ -0,0 +1,431 @@
+/*!
+    \file map_image.h
+    \brief Hash map and flat map persistent image containers definition
+    \author Ivan Shynkarenka
+    \date 15.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_CONTAINERS_MAP_IMAGE_H
+#define CPPCOMMON_CONTAINERS_MAP_IMAGE_H
+
+#include "algorithms/hash.h"
+#include "filesystem/file.h"
+#include "filesystem/mapped_file.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+
+namespace CppCommon {
+
+//! Map image item
+/*!
+    Trivially copyable key/value pair stored in the map image.
+*/
+template <typename TKey, typename TValue>
+struct MapImageItem
+{
+    TKey first;     //!< Item key
+    TValue second;  //!< Item value
+};
+
+//! @cond INTERNALS
+namespace Internals {
+
+// Map image header is placed at the beginning of the image
+struct MapImageHeader
+{
+    char magic[8];          // Image format magic
+    uint32_t endian;        // Byte order mark
+    uint32_t item_size;     // Size of the image item
+    uint32_t item_align;    // Alignment of the image item
+    uint32_t reserved0;
+    uint64_t size;          // Count of items
+    uint64_t buckets;       // Count of buckets (hash map image only)
+    uint64_t items;         // Offset of items from the image beginning
+    uint64_t image;         // Total image size
+    uint64_t reserved1;
+};
+
+static_assert(sizeof(MapImageHeader) == 64, "Map image header size must be 64 bytes!");
+
+// Owned map image memory is released with the aligned delete
+struct MapImageDeleter
+{
+    void operator()(char* buffer) const noexcept { ::operator delete(buffer, std::align_val_t(64)); }
+};
+
+typedef std::unique_ptr<char, MapImageDeleter> MapImageBuffer;
+
+// Empty map image header is shared by all empty images
+inline const MapImageHeader& MapImageEmpty() noexcept
+{
+    static const MapImageHeader empty{};
+    return empty;
+}
+
+} // namespace Internals
+//! @endcond
+
+//! Hash map image container
+/*!
+    Hash map image is a read-only hash map stored in a flat relocatable memory
+    image: the header, control bytes of all buckets and the buckets array. The
+    image contains no pointers, so it could be written into the file once and
+    then queried in place from the memory-mapped file (pages are loaded on the
+    first access) or loaded with a single bulk read. Warm restarts of huge maps
+    take the page fault time instead of rebuilding the map item by item.
+
+    Buckets are probed linearly from the key hash position. Each bucket has a
+    control byte which contains 7-bit fragment of the key hash or zero for an
+    empty bucket, so keys are compared only for buckets with the matched hash
+    fragment. Image capacity is a power of two with the load factor not more
+    than 0.5.
+
+    Keys and values must be trivially copyable. Key hasher must be stable
+    between processes (FastHash of integers is, std::hash is not required to
+    be), because the image keeps buckets placed by hashes of the writer.
+    Images are not portable between platforms with different byte order or
+    different item layout, such images are rejected with throwing
+    std::invalid_argument exception.
+
+    Thread-safe.
+*/
+template <typename TKey, typename TValue, typename THash = FastHash<TKey>, typename TEqual = std::equal_to<TKey>>
+class HashMapImage
+{
+    static_assert(std::is_trivially_copyable<TKey>::value && std::is_trivially_copyable<TValue>::value, "Hash map image key and value must be trivially copyable!");
+
+public:
+    // Standard container type definitions
+    typedef TKey key_type;
+    typedef TValue mapped_type;
+    typedef MapImageItem<TKey, TValue> value_type;
+    typedef const value_type& const_reference;
+    typedef const value_type* const_pointer;
+    typedef size_t size_type;
+
+    //! Hash map image iterator
+    class const_iterator
+    {
+    public:
+        // Standard iterator type definitions
+        typedef MapImageItem<TKey, TValue> value_type;
+        typedef const value_type& reference;
+        typedef const value_type* pointer;
+        typedef ptrdiff_t difference_type;
+        typedef std::forward_iterator_tag iterator_category;
+
+        const_iterator() noexcept : _image(nullptr), _index(0) {}
+        const_iterator(const HashMapImage* image, size_t index) noexcept : _image(image), _index(index) {}
+
+        friend bool operator==(const const_iterator& it1, const const_iterator& it2) noexcept
+        { return (it1._image == it2._image) && (it1._index == it2._index); }
+        friend bool operator!=(const const_iterator& it1, const const_iterator& it2) noexcept
+        { return (it1._image != it2._image) || (it1._index != it2._index); }
+
+        const_iterator& operator++() noexcept { _index = _image->next(_index + 1); return *this; }
+        const_iterator operator++(int) noexcept { const_iterator result(*this); ++*this; return result; }
+
+        reference operator*() const noexcept { return _image->_items[_index]; }
+        pointer operator->() const noexcept { return &_image->_items[_index]; }
+
+    private:
+        const HashMapImage* _image;
+        size_t _index;
+    };
+
+    typedef const_iterator iterator;
+
+    //! Initialize an empty hash map image
+    explicit HashMapImage(const THash& hash = THash(), const TEqual& equal = TEqual()) noexcept;
+    //! Initialize the hash map image in place of the given memory
+    /*!
+        Memory is not copied and must be alive while the image is used (e.g. the
+        content of the memory-mapped file). The method will raise  std::invalid_argument
+        exception if the memory does not contain a valid hash map image.
+
+        \param data - Image data (aligned to the item alignment)
+        \param size - Image data size
+        \param hash - Key hasher (default is THash())
+        \param equal - Key comparator (default is TEqual())
+    */
+    HashMapImage(const void* data, size_t size, const THash& hash = THash(), const TEqual& equal = TEqual());
+    HashMapImage(const HashMapImage&) = delete;
+    HashMapImage(HashMapImage&& image) noexcept;
+    ~HashMapImage() = default;
+
+    HashMapImage& operator=(const HashMapImage&) = delete;
+    HashMapImage& operator=(HashMapImage&& image) noexcept;
+
+    //! Check if the hash map image is not empty
+    explicit operator bool() const noexcept { return !empty(); }
+
+    //! Access to the item value with the given key or throw std::out_of_range exception
+    const TValue& operator[](const TKey& key) const { return at(key); }
+
+    //! Is the hash map image empty?
+    bool empty() const noexcept { return (size() == 0); }
+    //! Get the hash map image size
+    size_t size() const noexcept { return (size_t)_header->size; }
+    //! Get the hash map image bucket count
+    size_t bucket_count() const noexcept { return (size_t)_header->buckets; }
+
+    //! Get the image data
+    const void* data() const noexcept { return _header; }
+    //! Get the image data size
+    size_t image_size() const noexcept { return (size_t)_header->image; }
+
+    //! Get the begin hash map image iterator
+    const_iterator begin() const noexcept { return const_iterator(this, next(0)); }
+    const_iterator cbegin() const noexcept { return begin(); }
+    //! Get the end hash map image iterator
+    const_iterator end() const noexcept { return const_iterator(this, bucket_count()); }
+    const_iterator cend() const noexcept { return end(); }
+
+    //! Find the item with the given key
+    /*!
+        \param key - Key of the item
+        \return Iterator to the found item or end iterator
+    */
+    const_iterator find(const TKey& key) const noexcept;
+    //! Check if the hash map image contains the item with the given key
+    bool contains(const TKey& key) const noexcept { return (find(key) != end()); }
+    //! Count items with the given key
+    size_t count(const TKey& key) const noexcept { return contains(key) ? 1 : 0; }
+
+    //! Access to the item value with the given key or throw std::out_of_range exception
+    const TValue& at(const TKey& key) const;
+    //! Get the item value with the given key or the default value
+    TValue value(const TKey& key, const TValue& defaults = TValue()) const;
+
+    //! Calculate the image size for the given count of items
+    static size_t ImageSize(size_t count) noexcept;
+
+    //! Build the hash map image of the given items range into the given memory
+    /*!
+        The method will raise std::invalid_argument exception if the memory  is
+        too small or misaligned, or if the range contains duplicate keys.
+
+        \param first - First item of the range (pair-like item with 'first' and 'second' members)
+        \param last - Last item of the range
+        \param data - Image data (aligned to the item alignment)
+        \param size - Image data size (at least ImageSize(std::distance(first, last)))
+        \param hash - Key hasher (default is THash())
+        \param equal - Key comparator (default is TEqual())
+        \return Size of the built image
+    */
+    template <class InputIterator>
+    static size_t Build(InputIterator first, InputIterator last, void* data, size_t size, const THash& hash = THash(), const TEqual& equal = TEqual());
+
+    //! Save the hash map image of the given map (e.g. HashMap) into the file
+    /*!
+        Image is built directly in the memory-mapped file, so huge maps are  saved
+        without an intermediate buffer.
+
+        \param path - File path
+        \param map - Map to save
+        \param hash - Key hasher (default is THash())
+        \param equal - Key comparator (default is TEqual())
+    */
+    template <class TMap>
+    static void Save(const Path& path, const TMap& map, const THash& hash = THash(), const TEqual& equal = TEqual());
+    //! Load the hash map image from the file with a single bulk read
+    /*!
+        \param path - File path
+        \param hash - Key hasher (default is THash())
+        \param equal - Key comparator (default is TEqual())
+        \return Hash map image which owns the loaded memory
+    */
+    static HashMapImage Load(const Path& path, const THash& hash = THash(), const TEqual& equal = TEqual());
+
+    //! Swap two instances
+    void swap(HashMapImage& image) noexcept;
+    template <typename UKey, typename UValue, typename UHash, typename UEqual>
+    friend void swap(HashMapImage<UKey, UValue, UHash, UEqual>& image1, HashMapImage<UKey, UValue, UHash, UEqual>& image2) noexcept;
+
+private:
+    static constexpr char MAGIC[8] = { 'C', 'C', 'H', 'M', 'A', 'P', '0', '1' };
+
+    THash _hash;
+    TEqual _equal;
+    const Internals::MapImageHeader* _header;
+    const uint8_t* _controls;
+    const value_type* _items;
+    Internals::MapImageBuffer _buffer;
+
+    static size_t Buckets(size_t count) noexcept;
+    static size_t ItemsOffset(size_t buckets) noexcept;
+    static uint8_t Control(size_t hash) noexcept { return (uint8_t)(0x80 | (hash >> (sizeof(size_t) * 8 - 7))); }
+
+    size_t next(size_t index) const noexcept;
+};
+
+//! Flat map image container
+/*!
+    Flat map image is a read-only flat map stored in a flat relocatable memory
+    image: the header followed by the array of items sorted by the key. The
+    image contains no pointers, so it could be written into the file once and
+    then queried in place from the memory-mapped file (pages are loaded on the
+    first access) or loaded with a single bulk read.
+
+    Items are found with the binary search and iterated in the key order, so
+    the image supports range queries with lower_bound() and upper_bound().
+
+    Keys and values must be trivially copyable. Images are not portable between
+    platforms with different byte order or different item layout, such images
+    are rejected with throwing std::invalid_argument exception.
+
+    Thread-safe.
+*/
+template <typename TKey, typename TValue, typename TCompare = std::less<TKey>>
+class FlatMapImage
+{
+    static_assert(std::is_trivially_copyable<TKey>::value && std::is_trivially_copyable<TValue>::value, "Flat map image key and value must be trivially copyable!");
+
+public:
+    // Standard container type definitions
+    typedef TKey key_type;
+    typedef TValue mapped_type;
+    typedef MapImageItem<TKey, TValue> value_type;
+    typedef TCompare key_compare;
+    typedef const value_type& const_reference;
+    typedef const value_type* const_pointer;
+    typedef const value_type* const_iterator;
+    typedef const_iterator iterator;
+    typedef size_t size_type;
+
+    //! Initialize an empty flat map image
+    explicit FlatMapImage(const TCompare& compare = TCompare()) noexcept;
+    //! Initialize the flat map image in place of the given memory
+    /*!
+        Memory is not copied and must be alive while the image is used (e.g. the
+        content of the memory-mapped file). The method will raise  std::invalid_argument
+        exception if the memory does not contain a valid flat map image.
+
+        \param data - Image data (aligned to the item alignment)
+        \param size - Image data size
+        \param compare - Key comparator (default is TCompare())
+    */
+    FlatMapImage(const void* data, size_t size, const TCompare& compare = TCompare());
+    FlatMapImage(const FlatMapImage&) = delete;
+    FlatMapImage(FlatMapImage&& image) noexcept;
+    ~FlatMapImage() = default;
+
+    FlatMapImage& operator=(const FlatMapImage&) = delete;
+    FlatMapImage& operator=(FlatMapImage&& image) noexcept;
+
+    //! Check if the flat map image is not empty
+    explicit operator bool() const noexcept { return !empty(); }
+
+    //! Access to the item value with the given key or throw std::out_of_range exception
+    const TValue& operator[](const TKey& key) const { return at(key); }
+
+    //! Is the flat map image empty?
+    bool empty() const noexcept { return (size() == 0); }
+    //! Get the flat map image size
+    size_t size() const noexcept { return (size_t)_header->size; }
+
+    //! Get the image data
+    const void* data() const noexcept { return _header; }
+    //! Get the image data size
+    size_t image_size() const noexcept { return (size_t)_header->image; }
+
+    //! Get the begin flat map image iterator
+    const_iterator begin() const noexcept { return _items; }
+    const_iterator cbegin() const noexcept { return _items; }
+    //! Get the end flat map image iterator
+    const_iterator end() const noexcept { return _items + size(); }
+    const_iterator cend() const noexcept { return _items + size(); }
+
+    //! Find the item with the given key
+    /*!
+        \param key - Key of the item
+        \return Iterator to the found item or end iterator
+    */
+    const_iterator find(const TKey& key) const noexcept;
+    //! Check if the flat map image contains the item with the given key
+    bool contains(const TKey& key) const noexcept { return (find(key) != end()); }
+    //! Count items with the given key
+    size_t count(const TKey& key) const noexcept { return contains(key) ? 1 : 0; }
+
+    //! Find the first item which key is not less than the given key
+    const_iterator lower_bound(const TKey& key) const noexcept;
+    //! Find the first item which key is greater than the given key
+    const_iterator upper_bound(const TKey& key) const noexcept;
+    //! Find the bounds of a range that includes all the items with the given key
+    std::pair<const_iterator, const_iterator> equal_range(const TKey& key) const noexcept { return std::make_pair(lower_bound(key), upper_bound(key)); }
+
+    //! Access to the item value with the given key or throw std::out_of_range exception
+    const TValue& at(const TKey& key) const;
+    //! Get the item value with the given key or the default value
+    TValue value(const TKey& key, const TValue& defaults = TValue()) const;
+
+    //! Calculate the image size for the given count of items
+    static size_t ImageSize(size_t count) noexcept;
+
+    //! Build the flat map image of the given sorted items range into the given memory
+    /*!
+        The method will raise std::invalid_argument exception if the memory  is
+        too small or misaligned, or if the range is not sorted by the key or
+        contains duplicate keys.
+
+        \param first - First item of the range (pair-like item with 'first' and 'second' members)
+        \param last - Last item of the range
+        \param data - Image data (aligned to the item alignment)
+        \param size - Image data size (at least ImageSize(std::distance(first, last)))
+        \param compare - Key comparator (default is TCompare())
+        \return Size of the built image
+    */
+    template <class InputIterator>
+    static size_t Build(InputIterator first, InputIterator last, void* data, size_t size, const TCompare& compare = TCompare());
+
+    //! Save the flat map image of the given sorted map (e.g. FlatMap) into the file
+    /*!
+        Image is built directly in the memory-mapped file, so huge maps are  saved
+        without an intermediate buffer.
+
+        \param path - File path
+        \param map - Map to save
+        \param compare - Key comparator (default is TCompare())
+    */
+    template <class TMap>
+    static void Save(const Path& path, const TMap& map, const TCompare& compare = TCompare());
+    //! Load the flat map image from the file with a single bulk read
+    /*!
+        \param path - File path
+        \param compare - Key comparator (default is TCompare())
+        \return Flat map image which owns the loaded memory
+    */
+    static FlatMapImage Load(const Path& path, const TCompare& compare = TCompare());
+
+    //! Swap two instances
+    void swap(FlatMapImage& image) noexcept;
+    template <typename UKey, typename UValue, typename UCompare>
+    friend void swap(FlatMapImage<UKey, UValue, UCompare>& image1, FlatMapImage<UKey, UValue, UCompare>& image2) noexcept;
+
+private:
+    static constexpr char MAGIC[8] = { 'C', 'C', 'F', 'M', 'A', 'P', '0', '1' };
+
+    TCompare _compare;
+    const Internals::MapImageHeader* _header;
+    const value_type* _items;
+    Internals::MapImageBuffer _buffer;
+
+    static size_t ItemsOffset() noexcept;
+};
+
+/*! \example containers_map_image.cpp Hash map and flat map persistent image containers example */
+
+} // namespace CppCommon
+
+#include "map_image.inl"
+
+#endif // CPPCOMMON_CONTAINERS_MAP_IMAGE_H
@@ -0,0 +1,406 @@
+/*!
+    \file map_image.inl
+    \brief Hash map and flat map persistent image containers inline implementation
+    \author Ivan Shynkarenka
+    \date 15.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+namespace Internals {
+
+const uint32_t MAP_IMAGE_ENDIAN = 0x01020304;
+
+inline size_t MapImageAlign(size_t offset, size_t alignment) noexcept
+{
+    return (offset + alignment - 1) & ~(alignment - 1);
+}
+
+// Validate the map image header and return it
+inline const MapImageHeader* MapImageValidate(const void* data, size_t size, const char* magic, size_t item_size, size_t item_align)
+{
+    if ((data == nullptr) || (size < sizeof(MapImageHeader)))
+        throw std::invalid_argument("Map image is too small!");
+    if ((((uintptr_t)data) % std::max(item_align, alignof(MapImageHeader))) != 0)
+        throw std::invalid_argument("Map image is misaligned!");
+
+    const MapImageHeader* header = (const MapImageHeader*)data;
+    if (std::memcmp(header->magic, magic, sizeof(header->magic)) != 0)
+        throw std::invalid_argument("Map image has invalid format!");
+    if ((header->endian != MAP_IMAGE_ENDIAN) || (header->item_size != item_size) || (header->item_align != item_align))
+        throw std::invalid_argument("Map image was built for the different platform or item type!");
+    if ((header->image > size) || (header->items > header->image) || (header->size > ((header->image - header->items) / item_size)))
+        throw std::invalid_argument("Map image is truncated!");
+
+    return header;
+}
+
+// Initialize the map image header in the given memory (magic is written when the image is completely built)
+inline MapImageHeader* MapImageInitialize(void* data, size_t size, size_t image, size_t item_size, size_t item_align)
+{
+    if ((data == nullptr) || (size < image))
+        throw std::invalid_argument("Map image buffer is too small!");
+    if ((((uintptr_t)data) % std::max(item_align, alignof(MapImageHeader))) != 0)
+        throw std::invalid_argument("Map image buffer is misaligned!");
+
+    std::memset(data, 0, image);
+
+    MapImageHeader* header = (MapImageHeader*)data;
+    header->endian = MAP_IMAGE_ENDIAN;
+    header->item_size = (uint32_t)item_size;
+    header->item_align = (uint32_t)item_align;
+    header->image = image;
+    return header;
+}
+
+// Load the whole map image file into the aligned buffer
+inline MapImageBuffer MapImageLoad(const Path& path, size_t& size)
+{
+    File file(path);
+    file.Open(true, false);
+    size = (size_t)file.size();
+
+    MapImageBuffer buffer((char*)::operator new(std::max(size, (size_t)1), std::align_val_t(64)));
+    size = file.Read(buffer.get(), size);
+    file.Close();
+    return buffer;
+}
+
+// Save the map image file built by the given builder directly into the mapped file
+template <class TBuilder>
+inline void MapImageSave(const Path& path, size_t image, TBuilder&& builder)
+{
+    MappedFile file(path, MappedFileMode::READ_WRITE, image);
+    if (file.size() != image)
+        file.Resize(image);
+    builder(file.mutable_data(), file.size());
+    file.Flush();
+}
+
+} // namespace Internals
+//! @endcond
+
+template <typename TKey, typename TValue, typename THash, typename TEqual>
+inline HashMapImage<TKey, TValue, THash, TEqual>::HashMapImage(const THash& hash, const TEqual& equal) noexcept
+    : _hash(hash), _equal(equal), _header(&Internals::MapImageEmpty()), _controls(nullptr), _items(nullptr)
+{
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual>
+inline HashMapImage<TKey, TValue, THash, TEqual>::HashMapImage(const void* data, size_t size, const THash& hash, const TEqual& equal)
+    : _hash(hash), _equal(equal), _header(nullptr), _controls(nullptr), _items(nullptr)
+{
+    _header = Internals::MapImageValidate(data, size, MAGIC, sizeof(value_type), alignof(value_type));
+
+    // Bucket count must be a power of two and all buckets must fit into the image
+    const uint64_t buckets = _header->buckets;
+    if ((buckets == 0) || ((buckets & (buckets - 1)) != 0) || (_header->size > (buckets / 2)) ||
+        (_header->items != ItemsOffset((size_t)buckets)) || (_header->image != ImageSize((size_t)_header->size)))
+        throw std::invalid_argument("Hash map image is corrupted!");
+
+    _controls = (const uint8_t*)data + sizeof(Internals::MapImageHeader);
+    _items = (const value_type*)((const char*)data + _header->items);
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual>
+inline HashMapImage<TKey, TValue, THash, TEqual>::HashMapImage(HashMapImage&& image) noexcept
+    : _hash(std::move(image._hash)), _equal(std::move(image._equal)),
+      _header(image._header), _controls(image._controls), _items(image._items), _buffer(std::move(image._buffer))
+{
+    image._header = &Internals::MapImageEmpty();
+    image._controls = nullptr;
+    image._items = nullptr;
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual>
+inline HashMapImage<TKey, TValue, THash, TEqual>& HashMapImage<TKey, TValue, THash, TEqual>::operator=(HashMapImage&& image) noexcept
+{
+    HashMapImage(std::move(image)).swap(*this);
+    return *this;
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual>
+inline typename HashMapImage<TKey, TValue, THash, TEqual>::const_iterator HashMapImage<TKey, TValue, THash, TEqual>::find(const TKey& key) const noexcept
+{
+    const size_t buckets = bucket_count();
+    if (buckets == 0)
+        return end();
+
+    const size_t hash = _hash(key);
+    const uint8_t control = Control(hash);
+    const size_t mask = buckets - 1;
+
+    // Load factor guarantees at least one empty bucket in the probing chain
+    for (size_t index = hash & mask;; index = (index + 1) & mask)
+    {
+        const uint8_t current = _controls[index];
+        if (current == 0)
+            return end();
+        if ((current == control) && _equal(_items[index].first, key))
+            return const_iterator(this, index);
+    }
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual>
+inline const TValue& HashMapImage<TKey, TValue, THash, TEqual>::at(const TKey& key) const
+{
+    const_iterator it = find(key);
+    if (it == end())
+        throw std::out_of_range("Item with the given key was not found in the hash map image!");
+    return it->second;
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual>
+inline TValue HashMapImage<TKey, TValue, THash, TEqual>::value(const TKey& key, const TValue& defaults) const
+{
+    const_iterator it = find(key);
+    return (it != end()) ? it->second : defaults;
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual>
+inline size_t HashMapImage<TKey, TValue, THash, TEqual>::Buckets(size_t count) noexcept
+{
+    size_t buckets = 2;
+    while (buckets < (count * 2))
+        buckets <<= 1;
+    return buckets;
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual>
+inline size_t HashMapImage<TKey, TValue, THash, TEqual>::ItemsOffset(size_t buckets) noexcept
+{
+    return Internals::MapImageAlign(sizeof(Internals::MapImageHeader) + buckets, alignof(value_type));
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual>
+inline size_t HashMapImage<TKey, TValue, THash, TEqual>::ImageSize(size_t count) noexcept
+{
+    const size_t buckets = Buckets(count);
+    return ItemsOffset(buckets) + buckets * sizeof(value_type);
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual>
+template <class InputIterator>
+inline size_t HashMapImage<TKey, TValue, THash, TEqual>::Build(InputIterator first, InputIterator last, void* data, size_t size, const THash& hash, const TEqual& equal)
+{
+    const size_t count = (size_t)std::distance(first, last);
+    const size_t buckets = Buckets(count);
+    const size_t image = ImageSize(count);
+
+    Internals::MapImageHeader* header = Internals::MapImageInitialize(data, size, image, sizeof(value_type), alignof(value_type));
+    header->buckets = buckets;
+    header->items = ItemsOffset(buckets);
+
+    uint8_t* controls = (uint8_t*)data + sizeof(Internals::MapImageHeader);
+    value_type* items = (value_type*)((char*)data + header->items);
+    const size_t mask = buckets - 1;
+
+    // Place each item into the first empty bucket of its probing chain
+    for (; first != last; ++first)
+    {
+        const size_t key_hash = hash(first->first);
+        const uint8_t control = Control(key_hash);
+
+        size_t index = key_hash & mask;
+        for (; controls[index] != 0; index = (index + 1) & mask)
+            if ((controls[index] == control) && equal(items[index].first, first->first))
+                throw std::invalid_argument("Hash map image items contain duplicate keys!");
+
+        controls[index] = control;
+        std::memcpy((void*)&items[index].first, &first->first, sizeof(TKey));
+        std::memcpy((void*)&items[index].second, &first->second, sizeof(TValue));
+        ++header->size;
+    }
+
+    std::memcpy(header->magic, MAGIC, sizeof(header->magic));
+    return image;
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual>
+template <class TMap>
+inline void HashMapImage<TKey, TValue, THash, TEqual>::Save(const Path& path, const TMap& map, const THash& hash, const TEqual& equal)
+{
+    Internals::MapImageSave(path, ImageSize(map.size()), [&](void* data, size_t size) { Build(map.begin(), map.end(), data, size, hash, equal); });
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual>
+inline HashMapImage<TKey, TValue, THash, TEqual> HashMapImage<TKey, TValue, THash, TEqual>::Load(const Path& path, const THash& hash, const TEqual& equal)
+{
+    size_t size;
+    Internals::MapImageBuffer buffer = Internals::MapImageLoad(path, size);
+
+    HashMapImage image(buffer.get(), size, hash, equal);
+    image._buffer = std::move(buffer);
+    return image;
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual>
+inline size_t HashMapImage<TKey, TValue, THash, TEqual>::next(size_t index) const noexcept
+{
+    const size_t buckets = bucket_count();
+    while ((index < buckets) && (_controls[index] == 0))
+        ++index;
+    return index;
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual>
+inline void HashMapImage<TKey, TValue, THash, TEqual>::swap(HashMapImage& image) noexcept
+{
+    using std::swap;
+    swap(_hash, image._hash);
+    swap(_equal, image._equal);
+    swap(_header, image._header);
+    swap(_controls, image._controls);
+    swap(_items, image._items);
+    swap(_buffer, image._buffer);
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual>
+inline void swap(HashMapImage<TKey, TValue, THash, TEqual>& image1, HashMapImage<TKey, TValue, THash, TEqual>& image2) noexcept
+{
+    image1.swap(image2);
+}
+
+template <typename TKey, typename TValue, typename TCompare>
+inline FlatMapImage<TKey, TValue, TCompare>::FlatMapImage(const TCompare& compare) noexcept
+    : _compare(compare), _header(&Internals::MapImageEmpty()), _items(nullptr)
+{
+}
+
+template <typename TKey, typename TValue, typename TCompare>
+inline FlatMapImage<TKey, TValue, TCompare>::FlatMapImage(const void* data, size_t size, const TCompare& compare)
+    : _compare(compare), _header(nullptr), _items(nullptr)
+{
+    _header = Internals::MapImageValidate(data, size, MAGIC, sizeof(value_type), alignof(value_type));
+
+    if ((_header->items != ItemsOffset()) || (_header->image != ImageSize((size_t)_header->size)))
+        throw std::invalid_argument("Flat map image is corrupted!");
+
+    _items = (const value_type*)((const char*)data + _header->items);
+}
+
+template <typename TKey, typename TValue, typename TCompare>
+inline FlatMapImage<TKey, TValue, TCompare>::FlatMapImage(FlatMapImage&& image) noexcept
+    : _compare(std::move(image._compare)), _header(image._header), _items(image._items), _buffer(std::move(image._buffer))
+{
+    image._header = &Internals::MapImageEmpty();
+    image._items = nullptr;
+}
+
+template <typename TKey, typename TValue, typename TCompare>
+inline FlatMapImage<TKey, TValue, TCompare>& FlatMapImage<TKey, TValue, TCompare>::operator=(FlatMapImage&& image) noexcept
+{
+    FlatMapImage(std::move(image)).swap(*this);
+    return *this;
+}
+
+template <typename TKey, typename TValue, typename TCompare>
+inline typename FlatMapImage<TKey, TValue, TCompare>::const_iterator FlatMapImage<TKey, TValue, TCompare>::find(const TKey& key) const noexcept
+{
+    const_iterator it = lower_bound(key);
+    return ((it != end()) && !_compare(key, it->first)) ? it : end();
+}
+
+template <typename TKey, typename TValue, typename TCompare>
+inline typename FlatMapImage<TKey, TValue, TCompare>::const_iterator FlatMapImage<TKey, TValue, TCompare>::lower_bound(const TKey& key) const noexcept
+{
+    return std::lower_bound(begin(), end(), key, [this](const value_type& item, const TKey& k) { return _compare(item.first, k); });
+}
+
+template <typename TKey, typename TValue, typename TCompare>
+inline typename FlatMapImage<TKey, TValue, TCompare>::const_iterator FlatMapImage<TKey, TValue, TCompare>::upper_bound(const TKey& key) const noexcept
+{
+    return std::upper_bound(begin(), end(), key, [this](const TKey& k, const value_type& item) { return _compare(k, item.first); });
+}
+
+template <typename TKey, typename TValue, typename TCompare>
+inline const TValue& FlatMapImage<TKey, TValue, TCompare>::at(const TKey& key) const
+{
+    const_iterator it = find(key);
+    if (it == end())
+        throw std::out_of_range("Item with the given key was not found in the flat map image!");
+    return it->second;
+}
+
+template <typename TKey, typename TValue, typename TCompare>
+inline TValue FlatMapImage<TKey, TValue, TCompare>::value(const TKey& key, const TValue& defaults) const
+{
+    const_iterator it = find(key);
+    return (it != end()) ? it->second : defaults;
+}
+
+template <typename TKey, typename TValue, typename TCompare>
+inline size_t FlatMapImage<TKey, TValue, TCompare>::ItemsOffset() noexcept
+{
+    return Internals::MapImageAlign(sizeof(Internals::MapImageHeader), alignof(value_type));
+}
+
+template <typename TKey, typename TValue, typename TCompare>
+inline size_t FlatMapImage<TKey, TValue, TCompare>::ImageSize(size_t count) noexcept
+{
+    return ItemsOffset() + count * sizeof(value_type);
+}
+
+template <typename TKey, typename TValue, typename TCompare>
+template <class InputIterator>
+inline size_t FlatMapImage<TKey, TValue, TCompare>::Build(InputIterator first, InputIterator last, void* data, size_t size, const TCompare& compare)
+{
+    const size_t count = (size_t)std::distance(first, last);
+    const size_t image = ImageSize(count);
+
+    Internals::MapImageHeader* header = Internals::MapImageInitialize(data, size, image, sizeof(value_type), alignof(value_type));
+    header->items = ItemsOffset();
+
+    value_type* items = (value_type*)((char*)data + header->items);
+
+    // Items are copied in the given order, which must be strictly ascending by the key
+    for (size_t index = 0; first != last; ++first, ++index)
+    {
+        std::memcpy((void*)&items[index].first, &first->first, sizeof(TKey));
+        std::memcpy((void*)&items[index].second, &first->second, sizeof(TValue));
+        if ((index > 0) && !compare(items[index - 1].first, items[index].first))
+            throw std::invalid_argument("Flat map image items must be sorted by the key without duplicates!");
+        ++header->size;
+    }
+
+    std::memcpy(header->magic, MAGIC, sizeof(header->magic));
+    return image;
+}
+
+template <typename TKey, typename TValue, typename TCompare>
+template <class TMap>
+inline void FlatMapImage<TKey, TValue, TCompare>::Save(const Path& path, const TMap& map, const TCompare& compare)
+{
+    Internals::MapImageSave(path, ImageSize(map.size()), [&](void* data, size_t size) { Build(map.begin(), map.end(), data, size, compare); });
+}
+
+template <typename TKey, typename TValue, typename TCompare>
+inline FlatMapImage<TKey, TValue, TCompare> FlatMapImage<TKey, TValue, TCompare>::Load(const Path& path, const TCompare& compare)
+{
+    size_t size;
+    Internals::MapImageBuffer buffer = Internals::MapImageLoad(path, size);
+
+    FlatMapImage image(buffer.get(), size, compare);
+    image._buffer = std::move(buffer);
+    return image;
+}
+
+template <typename TKey, typename TValue, typename TCompare>
+inline void FlatMapImage<TKey, TValue, TCompare>::swap(FlatMapImage& image) noexcept
+{
+    using std::swap;
+    swap(_compare, image._compare);
+    swap(_header, image._header);
+    swap(_items, image._items);
+    swap(_buffer, image._buffer);
+}
+
+template <typename TKey, typename TValue, typename TCompare>
+inline void swap(FlatMapImage<TKey, TValue, TCompare>& image1, FlatMapImage<TKey, TValue, TCompare>& image2) noexcept
+{
+    image1.swap(image2);
+}
+
+} // namespace CppCommon
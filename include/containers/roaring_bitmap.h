@@ -0,0 +1,236 @@
+/*!
+    \file roaring_bitmap.h
+    \brief Roaring bitmap container definition
+    \author Ivan Shynkarenka
+    \date 15.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_CONTAINERS_ROARING_BITMAP_H
+#define CPPCOMMON_CONTAINERS_ROARING_BITMAP_H
+
+#include "common/writer.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <span>
+#include <vector>
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+namespace Internals {
+
+enum class RoaringContainerType : uint8_t { ARRAY, BITMAP, RUN };
+
+//! Roaring bitmap container of 16-bit low values
+struct RoaringContainer
+{
+    RoaringContainerType type;
+    uint32_t cardinality;
+    // Sorted low values of array container or (start, length - 1) pairs of run container
+    std::vector<uint16_t> values;
+    // 1024 words of bitmap container
+    std::vector<uint64_t> words;
+
+    RoaringContainer() noexcept : type(RoaringContainerType::ARRAY), cardinality(0) {}
+};
+
+} // namespace Internals
+//! @endcond
+
+//! Roaring bitmap container
+/*!
+    Roaring bitmap is a compressed set of 64-bit integers (e.g. identifiers).
+    Values are split into chunks of 65536 values by their high 48 bits,  and
+    each non-empty chunk is stored in one of the containers:
+    - array container keeps up to 4096 sorted 16-bit low values (2 bytes per value);
+    - bitmap container keeps 65536 bits (8 KB) for dense chunks;
+    - run container keeps sorted runs of consecutive values after optimize().
+
+    Dense and clustered sets cost a few bits per value instead of  tens  of
+    bytes per value of hash sets. Set algebra is done container by container,
+    bitmap containers are combined with AVX2 when it is supported by the CPU.
+    Modified run containers are converted back into array or bitmap ones.
+
+    Roaring bitmap could be serialized into File (or any other Writer)  and
+    deserialized from the memory buffer (e.g. MappedFile::bytes() or
+    SharedMemory::ptr()).
+
+    Not thread-safe.
+
+    https://roaringbitmap.org
+*/
+class RoaringBitmap
+{
+public:
+    //! Roaring bitmap constant iterator
+    class iterator
+    {
+        friend class RoaringBitmap;
+
+    public:
+        // Standard iterator type definitions
+        typedef ptrdiff_t difference_type;
+        typedef uint64_t value_type;
+        typedef const uint64_t* pointer;
+        typedef uint64_t reference;
+        typedef std::forward_iterator_tag iterator_category;
+
+        iterator() noexcept : _bitmap(nullptr), _container(0), _index(0), _word(0), _value(0) {}
+        iterator(const iterator&) noexcept = default;
+        iterator(iterator&&) noexcept = default;
+        ~iterator() noexcept = default;
+
+        iterator& operator=(const iterator&) noexcept = default;
+        iterator& operator=(iterator&&) noexcept = default;
+
+        friend bool operator==(const iterator& it1, const iterator& it2) noexcept
+        { return (it1._bitmap == it2._bitmap) && (it1._container == it2._container) && (it1._value == it2._value); }
+        friend bool operator!=(const iterator& it1, const iterator& it2) noexcept
+        { return !(it1 == it2); }
+
+        iterator& operator++() noexcept;
+        iterator operator++(int) noexcept { iterator result(*this); ++*this; return result; }
+
+        uint64_t operator*() const noexcept { return _value; }
+        const uint64_t* operator->() const noexcept { return &_value; }
+
+    private:
+        const RoaringBitmap* _bitmap;
+        size_t _container;
+        size_t _index;
+        uint64_t _word;
+        uint64_t _value;
+
+        iterator(const RoaringBitmap* bitmap, size_t container) noexcept;
+
+        //! Load the first value of the current container
+        void First() noexcept;
+    };
+
+    typedef iterator const_iterator;
+    typedef uint64_t value_type;
+    typedef size_t size_type;
+
+    //! Maximal cardinality of the array container
+    static constexpr size_t ARRAY_MAX_SIZE = 4096;
+
+    RoaringBitmap() = default;
+    RoaringBitmap(std::initializer_list<uint64_t> values);
+    RoaringBitmap(const RoaringBitmap&) = default;
+    RoaringBitmap(RoaringBitmap&&) noexcept = default;
+    ~RoaringBitmap() = default;
+
+    RoaringBitmap& operator=(const RoaringBitmap&) = default;
+    RoaringBitmap& operator=(RoaringBitmap&&) noexcept = default;
+
+    //! Check if the roaring bitmap is not empty
+    explicit operator bool() const noexcept { return !empty(); }
+
+    //! Is the roaring bitmap empty?
+    bool empty() const noexcept { return _keys.empty(); }
+    //! Get the count of values (cardinality)
+    uint64_t size() const noexcept;
+    //! Get the count of containers
+    size_t containers() const noexcept { return _keys.size(); }
+    //! Get the memory size of containers in bytes
+    size_t bytes() const noexcept;
+
+    //! Get the minimal value
+    uint64_t min() const noexcept;
+    //! Get the maximal value
+    uint64_t max() const noexcept;
+
+    //! Get the begin roaring bitmap iterator
+    iterator begin() const noexcept { return iterator(this, 0); }
+    iterator cbegin() const noexcept { return begin(); }
+    //! Get the end roaring bitmap iterator
+    iterator end() const noexcept { return iterator(this, _keys.size()); }
+    iterator cend() const noexcept { return end(); }
+
+    //! Check if the roaring bitmap contains the given value
+    bool contains(uint64_t value) const noexcept;
+
+    //! Insert the given value
+    /*!
+        \param value - Value to insert
+        \return 'true' if the value was inserted, 'false' if the value is already present
+    */
+    bool insert(uint64_t value);
+    //! Insert values of the given range
+    template <class InputIterator>
+    void insert(InputIterator first, InputIterator last)
+    { for (; first != last; ++first) insert((uint64_t)*first); }
+
+    //! Erase the given value
+    /*!
+        \param value - Value to erase
+        \return 'true' if the value was erased, 'false' if the value is not present
+    */
+    bool erase(uint64_t value);
+
+    //! Convert containers into run containers where it saves memory
+    /*!
+        \return 'true' if any container was converted, 'false' otherwise
+    */
+    bool optimize();
+
+    //! Clear the roaring bitmap
+    void clear() noexcept;
+
+    //! Intersect with the given roaring bitmap
+    RoaringBitmap& operator&=(const RoaringBitmap& bitmap);
+    //! Unite with the given roaring bitmap
+    RoaringBitmap& operator|=(const RoaringBitmap& bitmap);
+    //! Subtract the given roaring bitmap
+    RoaringBitmap& operator-=(const RoaringBitmap& bitmap);
+
+    friend RoaringBitmap operator&(const RoaringBitmap& bitmap1, const RoaringBitmap& bitmap2);
+    friend RoaringBitmap operator|(const RoaringBitmap& bitmap1, const RoaringBitmap& bitmap2);
+    friend RoaringBitmap operator-(const RoaringBitmap& bitmap1, const RoaringBitmap& bitmap2);
+
+    //! Compare roaring bitmaps by values
+    friend bool operator==(const RoaringBitmap& bitmap1, const RoaringBitmap& bitmap2) noexcept;
+    friend bool operator!=(const RoaringBitmap& bitmap1, const RoaringBitmap& bitmap2) noexcept
+    { return !(bitmap1 == bitmap2); }
+
+    //! Serialize the roaring bitmap
+    /*!
+        \return Serialized bytes
+    */
+    std::vector<uint8_t> Serialize() const;
+    //! Serialize the roaring bitmap into the given writer (e.g. File)
+    /*!
+        \param writer - Writer to serialize into
+    */
+    void Serialize(Writer& writer) const;
+    //! Deserialize the roaring bitmap
+    /*!
+        \param buffer - Buffer to deserialize (e.g. MappedFile::bytes())
+        \param bitmap - Deserialized roaring bitmap
+        \return Count of deserialized bytes or 0 if the buffer is truncated or malformed
+    */
+    static size_t Deserialize(std::span<const uint8_t> buffer, RoaringBitmap& bitmap);
+
+    //! Swap two instances
+    void swap(RoaringBitmap& bitmap) noexcept;
+    friend void swap(RoaringBitmap& bitmap1, RoaringBitmap& bitmap2) noexcept
+    { bitmap1.swap(bitmap2); }
+
+private:
+    // High 48 bits of values and containers of low 16 bits sorted by keys
+    std::vector<uint64_t> _keys;
+    std::vector<Internals::RoaringContainer> _containers;
+
+    //! Find the container index of the given key
+    size_t Find(uint64_t key) const noexcept;
+};
+
+/*! \example containers_roaring_bitmap.cpp Roaring bitmap container example */
+
+} // namespace CppCommon
+
+#endif // CPPCOMMON_CONTAINERS_ROARING_BITMAP_H
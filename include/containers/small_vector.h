@@ -0,0 +1,235 @@
+/*!
+    \file small_vector.h
+    \brief Small vector container definition
+    \author Ivan Shynkarenka
+    \date 15.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_CONTAINERS_SMALL_VECTOR_H
+#define CPPCOMMON_CONTAINERS_SMALL_VECTOR_H
+
+#include <algorithm>
+#include <cassert>
+#include <compare>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace CppCommon {
+
+//! Small vector container
+/*!
+    Small vector is a std::vector compatible container which keeps up to N
+    items in the inline storage inside the container itself, so short vectors
+    do not allocate memory at all and their items are located next to other
+    fields of the enclosing structure. Once the size exceeds N, items are moved
+    into the storage allocated with the given allocator (e.g. Allocator with
+    PoolMemoryManager).
+
+    Inline storage makes the small vector N * sizeof(T) bytes larger and makes
+    its move operations linear for inline items. Iterators are invalidated by
+    the move of the inline small vector.
+
+    Not thread-safe.
+*/
+template <typename T, size_t N, typename TAllocator = std::allocator<T>>
+class SmallVector
+{
+    static_assert(N > 0, "Small vector inline capacity must be greater than zero!");
+
+public:
+    // Standard container type definitions
+    typedef T value_type;
+    typedef value_type& reference;
+    typedef const value_type& const_reference;
+    typedef value_type* pointer;
+    typedef const value_type* const_pointer;
+    typedef ptrdiff_t difference_type;
+    typedef size_t size_type;
+    typedef TAllocator allocator_type;
+    typedef pointer iterator;
+    typedef const_pointer const_iterator;
+    typedef std::reverse_iterator<iterator> reverse_iterator;
+    typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+
+    //! Inline capacity of the small vector
+    static constexpr size_t INLINE_CAPACITY = N;
+
+    SmallVector() noexcept(noexcept(TAllocator())) requires std::is_default_constructible_v<TAllocator> : SmallVector(TAllocator()) {}
+    explicit SmallVector(const TAllocator& allocator) noexcept;
+    explicit SmallVector(size_t count, const TAllocator& allocator = TAllocator());
+    SmallVector(size_t count, const T& value, const TAllocator& allocator = TAllocator());
+    template <class InputIterator, typename = std::enable_if_t<!std::is_integral_v<InputIterator>>>
+    SmallVector(InputIterator first, InputIterator last, const TAllocator& allocator = TAllocator());
+    SmallVector(std::initializer_list<T> list, const TAllocator& allocator = TAllocator());
+    SmallVector(const SmallVector& vector);
+    SmallVector(SmallVector&& vector) noexcept(std::is_nothrow_move_constructible_v<T>);
+    ~SmallVector() noexcept;
+
+    SmallVector& operator=(const SmallVector& vector);
+    SmallVector& operator=(SmallVector&& vector) noexcept(std::is_nothrow_move_constructible_v<T> && std::is_nothrow_move_assignable_v<T>);
+    SmallVector& operator=(std::initializer_list<T> list);
+
+    //! Check if the small vector is not empty
+    explicit operator bool() const noexcept { return !empty(); }
+
+    //! Access to the item with the given index
+    reference operator[](size_t index) noexcept { assert((index < _size) && "Index out of bounds!"); return _data[index]; }
+    const_reference operator[](size_t index) const noexcept { assert((index < _size) && "Index out of bounds!"); return _data[index]; }
+
+    //! Is the small vector empty?
+    bool empty() const noexcept { return (_size == 0); }
+    //! Get the small vector size
+    size_t size() const noexcept { return _size; }
+    //! Get the small vector capacity
+    size_t capacity() const noexcept { return _capacity; }
+    //! Get the small vector maximum size
+    size_t max_size() const noexcept { return std::allocator_traits<TAllocator>::max_size(_allocator); }
+    //! Are items stored in the inline storage?
+    bool inlined() const noexcept { return (_data == inline_data()); }
+
+    //! Get the small vector allocator
+    allocator_type get_allocator() const noexcept { return _allocator; }
+
+    //! Get the small vector data
+    T* data() noexcept { return _data; }
+    const T* data() const noexcept { return _data; }
+
+    //! Access to the item with the given index or throw std::out_of_range exception
+    reference at(size_t index);
+    const_reference at(size_t index) const;
+
+    //! Get the front item
+    reference front() noexcept { assert(!empty() && "Small vector is empty!"); return _data[0]; }
+    const_reference front() const noexcept { assert(!empty() && "Small vector is empty!"); return _data[0]; }
+    //! Get the back item
+    reference back() noexcept { assert(!empty() && "Small vector is empty!"); return _data[_size - 1]; }
+    const_reference back() const noexcept { assert(!empty() && "Small vector is empty!"); return _data[_size - 1]; }
+
+    //! Get the begin small vector iterator
+    iterator begin() noexcept { return _data; }
+    const_iterator begin() const noexcept { return _data; }
+    const_iterator cbegin() const noexcept { return _data; }
+    //! Get the end small vector iterator
+    iterator end() noexcept { return _data + _size; }
+    const_iterator end() const noexcept { return _data + _size; }
+    const_iterator cend() const noexcept { return _data + _size; }
+
+    //! Get the reverse begin small vector iterator
+    reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
+    const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(end()); }
+    const_reverse_iterator crbegin() const noexcept { return const_reverse_iterator(end()); }
+    //! Get the reverse end small vector iterator
+    reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
+    const_reverse_iterator rend() const noexcept { return const_reverse_iterator(begin()); }
+    const_reverse_iterator crend() const noexcept { return const_reverse_iterator(begin()); }
+
+    //! Reserve the small vector capacity for the given count of items
+    void reserve(size_t capacity);
+    //! Move items back into the inline storage or shrink the allocated storage to fit the size
+    void shrink_to_fit();
+
+    //! Resize the small vector with default initialized items
+    void resize(size_t size);
+    //! Resize the small vector with copies of the given item
+    void resize(size_t size, const T& value);
+
+    //! Assign the given count of item copies
+    void assign(size_t count, const T& value);
+    //! Assign items of the given range
+    template <class InputIterator, typename = std::enable_if_t<!std::is_integral_v<InputIterator>>>
+    void assign(InputIterator first, InputIterator last);
+    //! Assign items of the given initializer list
+    void assign(std::initializer_list<T> list) { assign(list.begin(), list.end()); }
+
+    //! Push a new item into the back of the small vector
+    void push_back(const T& value) { emplace_back(value); }
+    void push_back(T&& value) { emplace_back(std::move(value)); }
+    //! Emplace a new item into the back of the small vector
+    /*!
+        \param args - Arguments to construct the item
+        \return Reference to the emplaced item
+    */
+    template <typename... Args>
+    reference emplace_back(Args&&... args);
+    //! Pop the back item from the small vector
+    void pop_back() noexcept;
+
+    //! Insert a new item before the given position
+    /*!
+        \param position - Insert position
+        \param value - Item to insert
+        \return Iterator to the inserted item
+    */
+    iterator insert(const_iterator position, const T& value) { return emplace(position, value); }
+    iterator insert(const_iterator position, T&& value) { return emplace(position, std::move(value)); }
+    //! Insert the given count of item copies before the given position
+    iterator insert(const_iterator position, size_t count, const T& value);
+    //! Insert items of the given range before the given position
+    template <class InputIterator, typename = std::enable_if_t<!std::is_integral_v<InputIterator>>>
+    iterator insert(const_iterator position, InputIterator first, InputIterator last);
+    //! Insert items of the given initializer list before the given position
+    iterator insert(const_iterator position, std::initializer_list<T> list) { return insert(position, list.begin(), list.end()); }
+    //! Emplace a new item before the given position
+    template <typename... Args>
+    iterator emplace(const_iterator position, Args&&... args);
+
+    //! Erase the item at the given position
+    /*!
+        \param position - Erase position
+        \return Iterator to the item following the erased one
+    */
+    iterator erase(const_iterator position);
+    //! Erase items of the given range
+    iterator erase(const_iterator first, const_iterator last);
+
+    //! Clear the small vector
+    /*!
+        Allocated storage is kept, use shrink_to_fit() to release it.
+    */
+    void clear() noexcept;
+
+    //! Swap two instances
+    void swap(SmallVector& vector);
+    template <typename U, size_t M, typename UAllocator>
+    friend void swap(SmallVector<U, M, UAllocator>& vector1, SmallVector<U, M, UAllocator>& vector2);
+
+private:
+    T* _data;
+    size_t _size;
+    size_t _capacity;
+    [[no_unique_address]] TAllocator _allocator;
+    alignas(T) unsigned char _buffer[N * sizeof(T)];
+
+    T* inline_data() noexcept { return reinterpret_cast<T*>(_buffer); }
+    const T* inline_data() const noexcept { return reinterpret_cast<const T*>(_buffer); }
+
+    //! Calculate the grown capacity to fit the given size
+    size_t grow_capacity(size_t size) const;
+    //! Move items into the new storage of the given capacity
+    void reallocate(size_t capacity);
+    //! Release the allocated storage
+    void deallocate() noexcept;
+    //! Move items of the given small vector into the empty inline small vector
+    void move_from(SmallVector& vector);
+};
+
+//! Compare small vectors for equality
+template <typename T, size_t N, typename TAllocator, size_t M, typename UAllocator>
+bool operator==(const SmallVector<T, N, TAllocator>& vector1, const SmallVector<T, M, UAllocator>& vector2);
+//! Compare small vectors lexicographically
+template <typename T, size_t N, typename TAllocator, size_t M, typename UAllocator>
+auto operator<=>(const SmallVector<T, N, TAllocator>& vector1, const SmallVector<T, M, UAllocator>& vector2);
+
+/*! \example containers_small_vector.cpp Small vector container example */
+
+} // namespace CppCommon
+
+#include "small_vector.inl"
+
+#endif // CPPCOMMON_CONTAINERS_SMALL_VECTOR_H
@@ -0,0 +1,439 @@
+/*!
+    \file small_vector.inl
+    \brief Small vector container inline implementation
+    \author Ivan Shynkarenka
+    \date 15.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+template <typename T, size_t N, typename TAllocator>
+inline SmallVector<T, N, TAllocator>::SmallVector(const TAllocator& allocator) noexcept
+    : _data(inline_data()), _size(0), _capacity(N), _allocator(allocator)
+{
+}
+
+template <typename T, size_t N, typename TAllocator>
+inline SmallVector<T, N, TAllocator>::SmallVector(size_t count, const TAllocator& allocator)
+    : SmallVector(allocator)
+{
+    resize(count);
+}
+
+template <typename T, size_t N, typename TAllocator>
+inline SmallVector<T, N, TAllocator>::SmallVector(size_t count, const T& value, const TAllocator& allocator)
+    : SmallVector(allocator)
+{
+    assign(count, value);
+}
+
+template <typename T, size_t N, typename TAllocator>
+template <class InputIterator, typename>
+inline SmallVector<T, N, TAllocator>::SmallVector(InputIterator first, InputIterator last, const TAllocator& allocator)
+    : SmallVector(allocator)
+{
+    assign(first, last);
+}
+
+template <typename T, size_t N, typename TAllocator>
+inline SmallVector<T, N, TAllocator>::SmallVector(std::initializer_list<T> list, const TAllocator& allocator)
+    : SmallVector(allocator)
+{
+    assign(list.begin(), list.end());
+}
+
+template <typename T, size_t N, typename TAllocator>
+inline SmallVector<T, N, TAllocator>::SmallVector(const SmallVector& vector)
+    : SmallVector(std::allocator_traits<TAllocator>::select_on_container_copy_construction(vector._allocator))
+{
+    assign(vector.begin(), vector.end());
+}
+
+template <typename T, size_t N, typename TAllocator>
+inline SmallVector<T, N, TAllocator>::SmallVector(SmallVector&& vector) noexcept(std::is_nothrow_move_constructible_v<T>)
+    : SmallVector(vector._allocator)
+{
+    move_from(vector);
+}
+
+template <typename T, size_t N, typename TAllocator>
+inline SmallVector<T, N, TAllocator>::~SmallVector() noexcept
+{
+    clear();
+    deallocate();
+}
+
+template <typename T, size_t N, typename TAllocator>
+inline SmallVector<T, N, TAllocator>& SmallVector<T, N, TAllocator>::operator=(const SmallVector& vector)
+{
+    if (this == &vector)
+        return *this;
+
+    if constexpr (std::allocator_traits<TAllocator>::propagate_on_container_copy_assignment::value)
+    {
+        if (_allocator != vector._allocator)
+        {
+            clear();
+            deallocate();
+        }
+        _allocator = vector._allocator;
+    }
+
+    assign(vector.begin(), vector.end());
+    return *this;
+}
+
+template <typename T, size_t N, typename TAllocator>
+inline SmallVector<T, N, TAllocator>& SmallVector<T, N, TAllocator>::operator=(SmallVector&& vector) noexcept(std::is_nothrow_move_constructible_v<T> && std::is_nothrow_move_assignable_v<T>)
+{
+    if (this == &vector)
+        return *this;
+
+    constexpr bool propagate = std::allocator_traits<TAllocator>::propagate_on_container_move_assignment::value;
+
+    // Steal the allocated storage if both small vectors share the allocator
+    if (!vector.inlined() && (propagate || (_allocator == vector._allocator)))
+    {
+        clear();
+        deallocate();
+        if constexpr (propagate)
+            _allocator = std::move(vector._allocator);
+        move_from(vector);
+        return *this;
+    }
+
+    // Otherwise move items one by one
+    clear();
+    reserve(vector._size);
+    std::uninitialized_move(vector.begin(), vector.end(), _data);
+    _size = vector._size;
+    vector.clear();
+    return *this;
+}
+
+template <typename T, size_t N, typename TAllocator>
+inline SmallVector<T, N, TAllocator>& SmallVector<T, N, TAllocator>::operator=(std::initializer_list<T> list)
+{
+    assign(list.begin(), list.end());
+    return *this;
+}
+
+template <typename T, size_t N, typename TAllocator>
+inline typename SmallVector<T, N, TAllocator>::reference SmallVector<T, N, TAllocator>::at(size_t index)
+{
+    if (index >= _size)
+        throw std::out_of_range("Index out of bounds!");
+    return _data[index];
+}
+
+template <typename T, size_t N, typename TAllocator>
+inline typename SmallVector<T, N, TAllocator>::const_reference SmallVector<T, N, TAllocator>::at(size_t index) const
+{
+    if (index >= _size)
+        throw std::out_of_range("Index out of bounds!");
+    return _data[index];
+}
+
+template <typename T, size_t N, typename TAllocator>
+inline void SmallVector<T, N, TAllocator>::reserve(size_t capacity)
+{
+    if (capacity > _capacity)
+        reallocate(capacity);
+}
+
+template <typename T, size_t N, typename TAllocator>
+inline void SmallVector<T, N, TAllocator>::shrink_to_fit()
+{
+    if (inlined() || (_size == _capacity))
+        return;
+
+    if (_size <= N)
+    {
+        // Move items back into the inline storage
+        T* data = _data;
+        size_t capacity = _capacity;
+        std::uninitialized_move(data, data + _size, inline_data());
+        std::destroy(data, data + _size);
+        std::allocator_traits<TAllocator>::deallocate(_allocator, data, capacity);
+        _data = inline_data();
+        _capacity = N;
+    }
+    else
+        reallocate(_size);
+}
+
+template <typename T, size_t N, typename TAllocator>
+inline void SmallVector<T, N, TAllocator>::resize(size_t size)
+{
+    if (size > _size)
+    {
+        if (size > _capacity)
+            reserve(grow_capacity(size));
+        std::uninitialized_value_construct(_data + _size, _data + size);
+    }
+    else
+        std::destroy(_data + size, _data + _size);
+    _size = size;
+}
+
+template <typename T, size_t N, typename TAllocator>
+inline void SmallVector<T, N, TAllocator>::resize(size_t size, const T& value)
+{
+    if (size > _size)
+    {
+        if (size > _capacity)
+        {
+            // Keep the copy of the value which might be an item of the small vector
+            T copy(value);
+            reserve(grow_capacity(size));
+            std::uninitialized_fill(_data + _size, _data + size, copy);
+        }
+        else
+            std::uninitialized_fill(_data + _size, _data + size, value);
+    }
+    else
+        std::destroy(_data + size, _data + _size);
+    _size = size;
+}
+
+template <typename T, size_t N, typename TAllocator>
+inline void SmallVector<T, N, TAllocator>::assign(size_t count, const T& value)
+{
+    T copy(value);
+    clear();
+    reserve(count);
+    std::uninitialized_fill(_data, _data + count, copy);
+    _size = count;
+}
+
+template <typename T, size_t N, typename TAllocator>
+template <class InputIterator, typename>
+inline void SmallVector<T, N, TAllocator>::assign(InputIterator first, InputIterator last)
+{
+    clear();
+    if constexpr (std::is_base_of_v<std::forward_iterator_tag, typename std::iterator_traits<InputIterator>::iterator_category>)
+    {
+        size_t count = (size_t)std::distance(first, last);
+        reserve(count);
+        std::uninitialized_copy(first, last, _data);
+        _size = count;
+    }
+    else
+    {
+        for (; first != last; ++first)
+            emplace_back(*first);
+    }
+}
+
+template <typename T, size_t N, typename TAllocator>
+template <typename... Args>
+inline typename SmallVector<T, N, TAllocator>::reference SmallVector<T, N, TAllocator>::emplace_back(Args&&... args)
+{
+    if (_size < _capacity)
+    {
+        T* item = std::construct_at(_data + _size, std::forward<Args>(args)...);
+        ++_size;
+        return *item;
+    }
+
+    // Construct the new item before moving old ones, because arguments
+    // might refer to items of the small vector
+    size_t capacity = grow_capacity(_size + 1);
+    T* data = std::allocator_traits<TAllocator>::allocate(_allocator, capacity);
+    try
+    {
+        std::construct_at(data + _size, std::forward<Args>(args)...);
+    }
+    catch (...)
+    {
+        std::allocator_traits<TAllocator>::deallocate(_allocator, data, capacity);
+        throw;
+    }
+    std::uninitialized_move(_data, _data + _size, data);
+    std::destroy(_data, _data + _size);
+    deallocate();
+    _data = data;
+    _capacity = capacity;
+    return _data[_size++];
+}
+
+template <typename T, size_t N, typename TAllocator>
+inline void SmallVector<T, N, TAllocator>::pop_back() noexcept
+{
+    assert(!empty() && "Small vector is empty!");
+    std::destroy_at(_data + --_size);
+}
+
+template <typename T, size_t N, typename TAllocator>
+inline typename SmallVector<T, N, TAllocator>::iterator SmallVector<T, N, TAllocator>::insert(const_iterator position, size_t count, const T& value)
+{
+    size_t index = (size_t)(position - _data);
+    size_t size = _size;
+
+    T copy(value);
+    if ((_size + count) > _capacity)
+        reserve(grow_capacity(_size + count));
+    for (size_t i = 0; i < count; ++i)
+        emplace_back(copy);
+
+    std::rotate(_data + index, _data + size, _data + _size);
+    return _data + index;
+}
+
+template <typename T, size_t N, typename TAllocator>
+template <class InputIterator, typename>
+inline typename SmallVector<T, N, TAllocator>::iterator SmallVector<T, N, TAllocator>::insert(const_iterator position, InputIterator first, InputIterator last)
+{
+    size_t index = (size_t)(position - _data);
+    size_t size = _size;
+
+    if constexpr (std::is_base_of_v<std::forward_iterator_tag, typename std::iterator_traits<InputIterator>::iterator_category>)
+    {
+        size_t count = (size_t)std::distance(first, last);
+        if ((_size + count) > _capacity)
+            reserve(grow_capacity(_size + count));
+    }
+    for (; first != last; ++first)
+        emplace_back(*first);
+
+    std::rotate(_data + index, _data + size, _data + _size);
+    return _data + index;
+}
+
+template <typename T, size_t N, typename TAllocator>
+template <typename... Args>
+inline typename SmallVector<T, N, TAllocator>::iterator SmallVector<T, N, TAllocator>::emplace(const_iterator position, Args&&... args)
+{
+    size_t index = (size_t)(position - _data);
+    emplace_back(std::forward<Args>(args)...);
+    std::rotate(_data + index, _data + _size - 1, _data + _size);
+    return _data + index;
+}
+
+template <typename T, size_t N, typename TAllocator>
+inline typename SmallVector<T, N, TAllocator>::iterator SmallVector<T, N, TAllocator>::erase(const_iterator position)
+{
+    return erase(position, position + 1);
+}
+
+template <typename T, size_t N, typename TAllocator>
+inline typename SmallVector<T, N, TAllocator>::iterator SmallVector<T, N, TAllocator>::erase(const_iterator first, const_iterator last)
+{
+    T* from = _data + (first - _data);
+    T* to = _data + (last - _data);
+    if (from != to)
+    {
+        T* tail = std::move(to, end(), from);
+        std::destroy(tail, end());
+        _size = (size_t)(tail - _data);
+    }
+    return from;
+}
+
+template <typename T, size_t N, typename TAllocator>
+inline void SmallVector<T, N, TAllocator>::clear() noexcept
+{
+    std::destroy(_data, _data + _size);
+    _size = 0;
+}
+
+template <typename T, size_t N, typename TAllocator>
+inline void SmallVector<T, N, TAllocator>::swap(SmallVector& vector)
+{
+    if (this == &vector)
+        return;
+
+    // Swap allocated storages without moving items
+    if (!inlined() && !vector.inlined())
+    {
+        using std::swap;
+        swap(_data, vector._data);
+        swap(_size, vector._size);
+        swap(_capacity, vector._capacity);
+        if constexpr (std::allocator_traits<TAllocator>::propagate_on_container_swap::value)
+            swap(_allocator, vector._allocator);
+        return;
+    }
+
+    SmallVector temp(std::move(vector));
+    vector = std::move(*this);
+    *this = std::move(temp);
+}
+
+template <typename T, size_t N, typename TAllocator>
+inline void swap(SmallVector<T, N, TAllocator>& vector1, SmallVector<T, N, TAllocator>& vector2)
+{
+    vector1.swap(vector2);
+}
+
+template <typename T, size_t N, typename TAllocator>
+inline size_t SmallVector<T, N, TAllocator>::grow_capacity(size_t size) const
+{
+    if (size > max_size())
+        throw std::length_error("Small vector is too large!");
+
+    return std::max(size, std::min(_capacity * 2, max_size()));
+}
+
+template <typename T, size_t N, typename TAllocator>
+inline void SmallVector<T, N, TAllocator>::reallocate(size_t capacity)
+{
+    T* data = std::allocator_traits<TAllocator>::allocate(_allocator, capacity);
+    try
+    {
+        std::uninitialized_move(_data, _data + _size, data);
+    }
+    catch (...)
+    {
+        std::allocator_traits<TAllocator>::deallocate(_allocator, data, capacity);
+        throw;
+    }
+    std::destroy(_data, _data + _size);
+    deallocate();
+    _data = data;
+    _capacity = capacity;
+}
+
+template <typename T, size_t N, typename TAllocator>
+inline void SmallVector<T, N, TAllocator>::deallocate() noexcept
+{
+    if (!inlined())
+        std::allocator_traits<TAllocator>::deallocate(_allocator, _data, _capacity);
+    _data = inline_data();
+    _capacity = N;
+}
+
+template <typename T, size_t N, typename TAllocator>
+inline void SmallVector<T, N, TAllocator>::move_from(SmallVector& vector)
+{
+    if (vector.inlined())
+    {
+        std::uninitialized_move(vector.begin(), vector.end(), inline_data());
+        _size = vector._size;
+        vector.clear();
+    }
+    else
+    {
+        _data = vector._data;
+        _size = vector._size;
+        _capacity = vector._capacity;
+        vector._data = vector.inline_data();
+        vector._size = 0;
+        vector._capacity = N;
+    }
+}
+
+template <typename T, size_t N, typename TAllocator, size_t M, typename UAllocator>
+inline bool operator==(const SmallVector<T, N, TAllocator>& vector1, const SmallVector<T, M, UAllocator>& vector2)
+{
+    return std::equal(vector1.begin(), vector1.end(), vector2.begin(), vector2.end());
+}
+
+template <typename T, size_t N, typename TAllocator, size_t M, typename UAllocator>
+inline auto operator<=>(const SmallVector<T, N, TAllocator>& vector1, const SmallVector<T, M, UAllocator>& vector2)
+{
+    return std::lexicographical_compare_three_way(vector1.begin(), vector1.end(), vector2.begin(), vector2.end());
+}
+
+} // namespace CppCommon
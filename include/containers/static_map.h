@@ -0,0 +1,185 @@
+/*!
+    \file static_map.h
+    \brief Static map container definition
+    \author Ivan Shynkarenka
+    \date 15.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_CONTAINERS_STATIC_MAP_H
+#define CPPCOMMON_CONTAINERS_STATIC_MAP_H
+
+#include "algorithms/hash.h"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+namespace CppCommon {
+
+//! Static hasher
+/*!
+    constexpr hasher of static map keys. Integers and enums are hashed with
+    Hash::Mix(), string views are hashed with FNV-1a and mixed with Hash::Mix().
+    Other key types require a custom constexpr hasher which returns uint64_t.
+*/
+template <typename T, typename = void>
+struct StaticHash;
+
+//! @cond DOXYGEN_SKIP
+template <typename T>
+struct StaticHash<T, std::enable_if_t<std::is_integral_v<T> || std::is_enum_v<T>>>
+{
+    constexpr uint64_t operator()(T value) const noexcept
+    { return Hash::Mix((uint64_t)value); }
+};
+
+template <>
+struct StaticHash<std::string_view>
+{
+    constexpr uint64_t operator()(std::string_view value) const noexcept
+    {
+        uint64_t hash = 0xCBF29CE484222325ull;
+        for (char ch : value)
+            hash = (hash ^ (uint8_t)ch) * 0x00000100000001B3ull;
+        return Hash::Mix(hash);
+    }
+};
+//! @endcond
+
+//! Static map container
+/*!
+    Static map is an immutable map of N items with a minimal perfect hash
+    function built at compile time from the literal initializer list, so it
+    could be used for fixed vocabularies (protocol tags, HTTP methods, enum
+    names) without any startup cost and with all data placed in .rodata when
+    declared as 'static constexpr'.
+
+    Perfect hash function is built with PTHash algorithm: keys are split into
+    buckets by the key hash, then each bucket (from the largest one) gets the
+    pilot value which places all bucket keys into free table slots. Lookup
+    calculates a single key hash, reads the bucket pilot and compares the key
+    in the only possible slot.
+
+    Duplicate keys or failed perfect hash search are reported with throwing
+    std::invalid_argument exception, which is a compile error in constexpr
+    context.
+
+    Items are iterated in the order of table slots, not in the initializer
+    list order.
+
+    Thread-safe.
+
+    https://arxiv.org/abs/2104.10402
+*/
+template <typename TKey, typename TValue, size_t N, typename THash = StaticHash<TKey>, typename TEqual = std::equal_to<TKey>>
+class StaticMap
+{
+public:
+    // Standard container type definitions
+    typedef TKey key_type;
+    typedef TValue mapped_type;
+    typedef std::pair<TKey, TValue> value_type;
+    typedef const value_type& const_reference;
+    typedef const value_type* const_pointer;
+    typedef const value_type* const_iterator;
+    typedef const_iterator iterator;
+    typedef size_t size_type;
+
+    //! Build the static map from the given items
+    /*!
+        Array size is a separate template parameter, so the empty static map
+        never forms a zero-size array type and is built from std::array only.
+
+        \param items - Items array
+        \param hash - Key hasher (default is THash())
+        \param equal - Key comparator (default is TEqual())
+    */
+    template <size_t M> requires ((M == N) && (M > 0))
+    constexpr StaticMap(const value_type (&items)[M], const THash& hash = THash(), const TEqual& equal = TEqual());
+    //! Build the static map from the given items
+    constexpr StaticMap(const std::array<value_type, N>& items, const THash& hash = THash(), const TEqual& equal = TEqual());
+    constexpr StaticMap(const StaticMap&) = default;
+    constexpr StaticMap(StaticMap&&) = default;
+    ~StaticMap() = default;
+
+    constexpr StaticMap& operator=(const StaticMap&) = default;
+    constexpr StaticMap& operator=(StaticMap&&) = default;
+
+    //! Access to the item value with the given key or throw std::out_of_range exception
+    constexpr const TValue& operator[](const TKey& key) const { return at(key); }
+
+    //! Is the static map empty?
+    static constexpr bool empty() noexcept { return (N == 0); }
+    //! Get the static map size
+    static constexpr size_t size() noexcept { return N; }
+    //! Get the static map buckets count
+    static constexpr size_t buckets() noexcept { return BUCKETS; }
+
+    //! Get the begin static map iterator
+    constexpr const_iterator begin() const noexcept { return _items.data(); }
+    constexpr const_iterator cbegin() const noexcept { return _items.data(); }
+    //! Get the end static map iterator
+    constexpr const_iterator end() const noexcept { return _items.data() + N; }
+    constexpr const_iterator cend() const noexcept { return _items.data() + N; }
+
+    //! Find the item with the given key
+    /*!
+        \param key - Key of the item
+        \return Iterator to the found item or end iterator
+    */
+    constexpr const_iterator find(const TKey& key) const noexcept;
+    //! Check if the static map contains the item with the given key
+    constexpr bool contains(const TKey& key) const noexcept { return (find(key) != end()); }
+    //! Count items with the given key
+    constexpr size_t count(const TKey& key) const noexcept { return contains(key) ? 1 : 0; }
+
+    //! Access to the item value with the given key or throw std::out_of_range exception
+    constexpr const TValue& at(const TKey& key) const;
+    //! Get the item value with the given key or the default value
+    constexpr TValue value(const TKey& key, const TValue& defaults = TValue()) const;
+
+private:
+    // Average bucket size is 2 keys, so the pilot search is short even at compile time
+    static constexpr size_t BUCKETS = (N > 1) ? ((N + 1) / 2) : 1;
+    static constexpr uint32_t MAX_PILOT = 1u << 20;
+
+    THash _hash;
+    TEqual _equal;
+    std::array<uint32_t, BUCKETS> _pilots;
+    std::array<value_type, N> _items;
+
+    constexpr void build(const value_type* items);
+
+    static constexpr size_t bucket(uint64_t hash) noexcept
+    { return (size_t)((hash >> 32) % BUCKETS); }
+    static constexpr size_t slot(uint64_t hash, uint32_t pilot) noexcept
+    { return (N > 0) ? (size_t)(Hash::Mix(hash ^ (pilot * 0x9E3779B97F4A7C15ull)) % N) : 0; }
+};
+
+//! Make the static map from the given items
+/*!
+    Items count is deduced from the initializer list:
+    \code{.cpp}
+    static constexpr auto methods = MakeStaticMap<std::string_view, int>({ { "GET", 1 }, { "POST", 2 } });
+    \endcode
+
+    \param items - Items array
+    \return Static map of the given items
+*/
+template <typename TKey, typename TValue, size_t N>
+constexpr StaticMap<TKey, TValue, N> MakeStaticMap(const std::pair<TKey, TValue> (&items)[N])
+{ return StaticMap<TKey, TValue, N>(items); }
+
+/*! \example containers_static_map.cpp Static map container example */
+
+} // namespace CppCommon
+
+#include "static_map.inl"
+
+#endif // CPPCOMMON_CONTAINERS_STATIC_MAP_H
@@ -0,0 +1,133 @@
+/*!
+    \file static_map.inl
+    \brief Static map container inline implementation
+    \author Ivan Shynkarenka
+    \date 15.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+template <typename TKey, typename TValue, size_t N, typename THash, typename TEqual>
+template <size_t M> requires ((M == N) && (M > 0))
+constexpr StaticMap<TKey, TValue, N, THash, TEqual>::StaticMap(const value_type (&items)[M], const THash& hash, const TEqual& equal)
+    : _hash(hash), _equal(equal), _pilots{}, _items{}
+{
+    build(items);
+}
+
+template <typename TKey, typename TValue, size_t N, typename THash, typename TEqual>
+constexpr StaticMap<TKey, TValue, N, THash, TEqual>::StaticMap(const std::array<value_type, N>& items, const THash& hash, const TEqual& equal)
+    : _hash(hash), _equal(equal), _pilots{}, _items{}
+{
+    build(items.data());
+}
+
+template <typename TKey, typename TValue, size_t N, typename THash, typename TEqual>
+constexpr typename StaticMap<TKey, TValue, N, THash, TEqual>::const_iterator StaticMap<TKey, TValue, N, THash, TEqual>::find(const TKey& key) const noexcept
+{
+    if constexpr (N == 0)
+        return end();
+    else
+    {
+        uint64_t hash = _hash(key);
+        const value_type& item = _items[slot(hash, _pilots[bucket(hash)])];
+        return _equal(item.first, key) ? &item : end();
+    }
+}
+
+template <typename TKey, typename TValue, size_t N, typename THash, typename TEqual>
+constexpr const TValue& StaticMap<TKey, TValue, N, THash, TEqual>::at(const TKey& key) const
+{
+    const_iterator it = find(key);
+    if (it == end())
+        throw std::out_of_range("Item with the given key was not found in the static map!");
+    return it->second;
+}
+
+template <typename TKey, typename TValue, size_t N, typename THash, typename TEqual>
+constexpr TValue StaticMap<TKey, TValue, N, THash, TEqual>::value(const TKey& key, const TValue& defaults) const
+{
+    const_iterator it = find(key);
+    return (it != end()) ? it->second : defaults;
+}
+
+template <typename TKey, typename TValue, size_t N, typename THash, typename TEqual>
+constexpr void StaticMap<TKey, TValue, N, THash, TEqual>::build(const value_type* items)
+{
+    if constexpr (N > 0)
+    {
+        std::array<uint64_t, N> hashes{};
+        std::array<size_t, BUCKETS + 1> starts{};
+        std::array<size_t, N> members{};
+        std::array<size_t, N> positions{};
+        std::array<bool, N> taken{};
+
+        // Calculate key hashes and group keys by buckets
+        for (size_t i = 0; i < N; ++i)
+        {
+            hashes[i] = _hash(items[i].first);
+            ++starts[bucket(hashes[i]) + 1];
+        }
+        size_t largest = 0;
+        for (size_t i = 0; i < BUCKETS; ++i)
+        {
+            largest = std::max(largest, starts[i + 1]);
+            starts[i + 1] += starts[i];
+        }
+        std::array<size_t, BUCKETS> fill{};
+        for (size_t i = 0; i < N; ++i)
+        {
+            size_t index = bucket(hashes[i]);
+            members[starts[index] + fill[index]++] = i;
+        }
+
+        // Place buckets from the largest one, while there are many free slots
+        for (size_t size = largest; size > 0; --size)
+        {
+            for (size_t index = 0; index < BUCKETS; ++index)
+            {
+                size_t first = starts[index];
+                if ((starts[index + 1] - first) != size)
+                    continue;
+
+                // Keys with the same hash could not be separated with any pilot
+                for (size_t i = 0; i < size; ++i)
+                    for (size_t j = i + 1; j < size; ++j)
+                        if (hashes[members[first + i]] == hashes[members[first + j]])
+                            throw std::invalid_argument(_equal(items[members[first + i]].first, items[members[first + j]].first) ? "Duplicate static map key!" : "Static map key hash collision!");
+
+                // Search the pilot which places all bucket keys into free slots
+                bool found = false;
+                for (uint32_t pilot = 0; !found && (pilot < MAX_PILOT); ++pilot)
+                {
+                    found = true;
+                    for (size_t i = 0; found && (i < size); ++i)
+                    {
+                        positions[i] = slot(hashes[members[first + i]], pilot);
+                        if (taken[positions[i]])
+                            found = false;
+                        for (size_t j = 0; found && (j < i); ++j)
+                            if (positions[j] == positions[i])
+                                found = false;
+                    }
+
+                    if (found)
+                    {
+                        _pilots[index] = pilot;
+                        for (size_t i = 0; i < size; ++i)
+                        {
+                            taken[positions[i]] = true;
+                            _items[positions[i]] = items[members[first + i]];
+                        }
+                    }
+                }
+
+                if (!found)
+                    throw std::invalid_argument("Static map perfect hash function was not found!");
+            }
+        }
+    }
+}
+
+} // namespace CppCommon
@@ -27,6 +27,11 @@ namespace CppCommon {
     handler function (default one will print the exception in std::cerr with a full stack-trace)
     and the dump file will be created.
 
+    Emergency mode (Unix only) makes signals handling async-signal-safe: the handler function
+    is not called, raw stack frames are captured into the preallocated emergency buffer and the
+    crash report is written with write() system call only. Signal handlers run on preallocated
+    alternate signal stacks, so stack overflows are reported as well.
+
     Not thread-safe.
 */
 class ExceptionsHandler : public CppCommon::Singleton<ExceptionsHandler>
@@ -59,8 +64,33 @@ public:
     /*!
         This method should be called once for the current thread.
         It is recommended to call the method just after the current thread start!
+
+        In emergency mode the method also installs the preallocated alternate
+        signal stack for the current thread.
     */
     static void SetupThread();
+    //! Setup emergency crash reporting mode for the current process
+    /*!
+        In emergency mode signal handlers don't call the exceptions handler
+        function, because SystemException and StackTrace allocate memory and
+        take locks, which could lose the crash report or deadlock in the signal
+        context. Instead raw stack frames are captured into the preallocated
+        emergency buffer and the crash report with the signal information, raw
+        frame addresses and the executable modules map (Linux) is written with
+        write() system call only. Frame addresses could be symbolized offline
+        (e.g. with addr2line) using the modules map.
+
+        The method also installs the preallocated alternate signal stack for the
+        current thread. Other threads get their alternate signal stacks with
+        SetupThread() method.
+
+        This method should be called once for the current process.
+        It is recommended to call the method just after the current process start!
+        The method does nothing on non Unix platforms.
+
+        \param directory - Directory of crash report files "crash.<pid>.<timestamp>.txt" (default is empty path, which means the standard error output)
+    */
+    static void SetupEmergency(const Path& directory = Path());
 
 private:
     class Impl;
@@ -0,0 +1,217 @@
+/*!
+    \file async_file.h
+    \brief Filesystem asynchronous file definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_FILESYSTEM_ASYNC_FILE_H
+#define CPPCOMMON_FILESYSTEM_ASYNC_FILE_H
+
+#include "common/function.h"
+#include "filesystem/file.h"
+
+#include <cstdint>
+#include <memory>
+#include <utility>
+
+namespace CppCommon {
+
+//! Asynchronous file operation type
+enum class AsyncFileOperation
+{
+    READ,           //!< Read operation
+    WRITE,          //!< Write operation
+    FLUSH           //!< Flush operation
+};
+
+//! Asynchronous file I/O backend
+enum class AsyncFileBackend
+{
+    AUTO,           //!< Best available backend of the current platform
+    THREAD,         //!< Dedicated I/O thread with synchronous operations (all platforms)
+    IO_URING,       //!< Linux io_uring
+    IOCP            //!< Windows overlapped I/O with I/O completion port
+};
+
+//! Asynchronous file operation result
+struct AsyncFileResult
+{
+    AsyncFileOperation operation;   //!< Operation type
+    uint64_t offset;                //!< Operation file offset
+    size_t size;                    //!< Count of transferred bytes (less than requested only at the end of the file or on error)
+    int error;                      //!< System error code (0 on success)
+
+    //! Is the operation succeed?
+    explicit operator bool() const noexcept { return (error == 0); }
+};
+
+//! Filesystem asynchronous file
+/*!
+    Asynchronous file queues read, write and flush operations with  completion
+    callbacks, submits queued operations to the operating system in one batch
+    with Submit() method and calls completion callbacks of finished operations
+    in the caller thread with Poll() or Wait() methods. So the caller thread
+    (e.g. the journaling thread) is never blocked by disk I/O and  could  keep
+    many outstanding operations up to the file queue depth.
+
+    Backends:
+    Linux: io_uring (raw system calls, no additional library is required).
+    Flush operation drains all operations submitted before it.
+    Windows: overlapped I/O with I/O completion port. Flush operation starts
+    after all operations submitted before it are completed.
+    Other platforms (or Linux kernels without io_uring): dedicated I/O thread,
+    which performs operations one by one in the submission order.
+
+    Short transfers are resubmitted internally, so callbacks get the requested
+    size unless the end of the file is reached or an error occurs. Buffers  of
+    operations must stay valid until their callbacks are called. Callbacks may
+    queue new operations and must not throw.
+
+    Not thread-safe.
+*/
+class AsyncFile
+{
+public:
+    //! Completion callback
+    typedef Function<void(const AsyncFileResult&), 256> Callback;
+
+    //! Default queue depth (256)
+    static const size_t DEFAULT_DEPTH;
+
+    //! Initialize asynchronous file with a given path
+    /*!
+        \param path - File path
+        \param depth - Maximal count of outstanding operations (default is AsyncFile::DEFAULT_DEPTH)
+        \param backend - I/O backend (default is AsyncFileBackend::AUTO)
+    */
+    explicit AsyncFile(const Path& path, size_t depth = DEFAULT_DEPTH, AsyncFileBackend backend = AsyncFileBackend::AUTO);
+    AsyncFile(const AsyncFile&) = delete;
+    AsyncFile(AsyncFile&& file) noexcept;
+    ~AsyncFile();
+
+    AsyncFile& operator=(const AsyncFile&) = delete;
+    AsyncFile& operator=(AsyncFile&& file) noexcept;
+
+    //! Check if the file opened
+    explicit operator bool() const noexcept { return IsFileOpened(); }
+
+    //! Get the file path
+    const Path& path() const noexcept;
+    //! Get the I/O backend
+    AsyncFileBackend backend() const noexcept;
+    //! Get the maximal count of outstanding operations
+    size_t depth() const noexcept;
+    //! Get the count of outstanding operations (queued, submitted and not yet completed)
+    size_t pending() const noexcept;
+    //! Get the count of queued and not yet submitted operations
+    size_t queued() const noexcept;
+
+    //! Is the file opened?
+    bool IsFileOpened() const noexcept;
+
+    //! Open an existing file
+    /*!
+        \param read - Read mode
+        \param write - Write mode
+        \param truncate - Truncate mode (default is false)
+    */
+    void Open(bool read, bool write, bool truncate = false);
+    //! Open or create a new file
+    /*!
+        \param read - Read mode
+        \param write - Write mode
+        \param truncate - Truncate mode (default is false)
+        \param permissions - File permissions of the created file (default is File::DEFAULT_PERMISSIONS)
+    */
+    void OpenOrCreate(bool read, bool write, bool truncate = false, const Flags<FilePermissions>& permissions = File::DEFAULT_PERMISSIONS);
+
+    //! Queue the read operation
+    /*!
+        \param offset - File offset
+        \param buffer - Buffer to read into
+        \param size - Buffer size
+        \param callback - Completion callback
+        \return 'true' if the operation was queued, 'false' if the queue depth is exhausted
+    */
+    template <class TCallback>
+    bool ReadAsync(uint64_t offset, void* buffer, size_t size, TCallback&& callback)
+    { return Enqueue(AsyncFileOperation::READ, offset, (char*)buffer, size, Callback(std::forward<TCallback>(callback))); }
+    //! Queue the write operation
+    /*!
+        \param offset - File offset
+        \param buffer - Buffer to write
+        \param size - Buffer size
+        \param callback - Completion callback
+        \return 'true' if the operation was queued, 'false' if the queue depth is exhausted
+    */
+    template <class TCallback>
+    bool WriteAsync(uint64_t offset, const void* buffer, size_t size, TCallback&& callback)
+    { return Enqueue(AsyncFileOperation::WRITE, offset, (char*)buffer, size, Callback(std::forward<TCallback>(callback))); }
+    //! Queue the flush operation
+    /*!
+        Flush operation writes all file data written by operations submitted
+        before it to the disk.
+
+        \param callback - Completion callback
+        \return 'true' if the operation was queued, 'false' if the queue depth is exhausted
+    */
+    template <class TCallback>
+    bool FlushAsync(TCallback&& callback)
+    { return Enqueue(AsyncFileOperation::FLUSH, 0, nullptr, 0, Callback(std::forward<TCallback>(callback))); }
+
+    //! Submit all queued operations in one batch
+    /*!
+        Will not block.
+
+        \return Count of submitted operations
+    */
+    size_t Submit();
+    //! Call completion callbacks of all finished operations
+    /*!
+        Will not block.
+
+        \return Count of called completion callbacks
+    */
+    size_t Poll();
+    //! Submit queued operations and wait for the given count of completed operations
+    /*!
+        Will block.
+
+        \param count - Minimal count of completion callbacks to call (default is 1)
+        \return Count of called completion callbacks
+    */
+    size_t Wait(size_t count = 1);
+    //! Submit queued operations and wait for all outstanding operations
+    /*!
+        Will block.
+
+        \return Count of called completion callbacks
+    */
+    size_t WaitAll() { return Wait(pending()); }
+
+    //! Close the file
+    /*!
+        Waits for all outstanding operations before closing the file.
+    */
+    void Close();
+
+    //! Swap two instances
+    void swap(AsyncFile& file) noexcept;
+    friend void swap(AsyncFile& file1, AsyncFile& file2) noexcept;
+
+private:
+    class Impl;
+    std::unique_ptr<Impl> _pimpl;
+
+    bool Enqueue(AsyncFileOperation operation, uint64_t offset, char* buffer, size_t size, Callback&& callback);
+};
+
+/*! \example filesystem_async_file.cpp Filesystem asynchronous file example */
+
+} // namespace CppCommon
+
+#include "async_file.inl"
+
+#endif // CPPCOMMON_FILESYSTEM_ASYNC_FILE_H
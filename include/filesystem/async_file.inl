@@ -0,0 +1,22 @@
+/*!
+    \file async_file.inl
+    \brief Filesystem asynchronous file inline implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+inline void AsyncFile::swap(AsyncFile& file) noexcept
+{
+    using std::swap;
+    swap(_pimpl, file._pimpl);
+}
+
+inline void swap(AsyncFile& file1, AsyncFile& file2) noexcept
+{
+    file1.swap(file2);
+}
+
+} // namespace CppCommon
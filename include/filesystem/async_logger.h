@@ -0,0 +1,251 @@
+/*!
+    \file async_logger.h
+    \brief Filesystem asynchronous logger definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_FILESYSTEM_ASYNC_LOGGER_H
+#define CPPCOMMON_FILESYSTEM_ASYNC_LOGGER_H
+
+#include "filesystem/file.h"
+#include "string/format.h"
+#include "threads/condition_variable.h"
+#include "threads/critical_section.h"
+#include "threads/spsc_ring_buffer.h"
+#include "time/tsc_clock.h"
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+namespace CppCommon {
+
+//! Log level
+enum class LogLevel : uint8_t
+{
+    DEBUG,          //!< Debug messages
+    INFO,           //!< Information messages
+    WARN,           //!< Warning messages
+    ERROR,          //!< Error messages
+    FATAL,          //!< Fatal error messages
+    NONE            //!< No messages (logger level only)
+};
+
+//! Stream output: Log level
+/*!
+    \param stream - Output stream
+    \param level - Log level
+    \return Output stream
+*/
+template <class TOutputStream>
+TOutputStream& operator<<(TOutputStream& stream, LogLevel level);
+
+//! Filesystem asynchronous logger
+/*!
+    Asynchronous logger defers formatting of log messages to the background
+    thread. Logging thread copies only the format string pointer, the raw
+    arguments and the timestamp (TscClock) into its own wait-free single
+    producer / single consumer ring buffer, so logging a message costs tens
+    of nanoseconds and never calls the operating system.
+
+    Background thread merges messages of all thread ring buffers by their
+    timestamps, formats them with {fmt} library and writes them into the log
+    file in batches. The log file is rotated when its size exceeds the given
+    rotation size: "log.txt" is renamed to "log.txt.1", "log.txt.1" to
+    "log.txt.2" and so on up to the given count of backups.
+
+    Each log line has the following format:
+    "2026-10-14 12:34:56.123456789 [12345] INFO  Message"
+    with UTC timestamp, thread Id and log level.
+
+    Format string must be a string literal as only its pointer is stored.
+    String arguments (std::string, std::string_view, C-strings) are copied by
+    content, other arguments must be trivially copyable values and are copied
+    by bytes. So pointer-like arguments other than strings must stay valid
+    until the message is formatted.
+
+    If the ring buffer of the logging thread is full, the message is dropped
+    and the logging thread is never blocked. Count of dropped messages is
+    reported in the log file and by dropped() method.
+
+    Thread-safe.
+*/
+class AsyncLogger
+{
+public:
+    //! Default capacity of the ring buffer of each logging thread (1 MiB)
+    static const size_t DEFAULT_CAPACITY;
+
+    //! Initialize asynchronous logger with a given log file path
+    /*!
+        Log file is opened for appending and the background thread is started.
+
+        \param path - Log file path
+        \param rotation_size - Log file size to rotate the log file (default is 0 - no rotation)
+        \param rotation_backups - Count of rotated log files to keep (default is 0 - log file is truncated on rotation)
+        \param capacity - Capacity of the ring buffer of each logging thread (must be a power of two, default is AsyncLogger::DEFAULT_CAPACITY)
+    */
+    explicit AsyncLogger(const Path& path, uint64_t rotation_size = 0, size_t rotation_backups = 0, size_t capacity = DEFAULT_CAPACITY);
+    AsyncLogger(const AsyncLogger&) = delete;
+    AsyncLogger(AsyncLogger&&) = delete;
+    //! Write all logged messages, stop the background thread and close the log file
+    ~AsyncLogger();
+
+    AsyncLogger& operator=(const AsyncLogger&) = delete;
+    AsyncLogger& operator=(AsyncLogger&&) = delete;
+
+    //! Get the log file path
+    const Path& path() const noexcept { return _path; }
+    //! Get the logger level
+    LogLevel level() const noexcept { return _level.load(std::memory_order_relaxed); }
+    //! Get the count of written messages
+    uint64_t logged() const noexcept { return _logged.load(std::memory_order_relaxed); }
+    //! Get the count of dropped messages
+    uint64_t dropped() const noexcept { return _dropped.load(std::memory_order_relaxed); }
+
+    //! Set the logger level
+    /*!
+        Messages with the lower level are skipped.
+
+        \param level - Logger level
+    */
+    void SetLevel(LogLevel level) noexcept { _level.store(level, std::memory_order_relaxed); }
+
+    //! Is the given log level enabled?
+    bool IsEnabled(LogLevel level) const noexcept { return (level >= this->level()); }
+
+    //! Log the message with the given level
+    /*!
+        Will not block.
+
+        \param level - Log level
+        \param pattern - Format string pattern (string literal)
+        \param args - Format arguments
+    */
+    template <typename... T>
+    void Log(LogLevel level, fmt::format_string<T...> pattern, T&&... args);
+
+    //! Log the debug message
+    template <typename... T>
+    void Debug(fmt::format_string<T...> pattern, T&&... args) { Log(LogLevel::DEBUG, pattern, std::forward<T>(args)...); }
+    //! Log the information message
+    template <typename... T>
+    void Info(fmt::format_string<T...> pattern, T&&... args) { Log(LogLevel::INFO, pattern, std::forward<T>(args)...); }
+    //! Log the warning message
+    template <typename... T>
+    void Warn(fmt::format_string<T...> pattern, T&&... args) { Log(LogLevel::WARN, pattern, std::forward<T>(args)...); }
+    //! Log the error message
+    template <typename... T>
+    void Error(fmt::format_string<T...> pattern, T&&... args) { Log(LogLevel::ERROR, pattern, std::forward<T>(args)...); }
+    //! Log the fatal error message
+    template <typename... T>
+    void Fatal(fmt::format_string<T...> pattern, T&&... args) { Log(LogLevel::FATAL, pattern, std::forward<T>(args)...); }
+
+    //! Flush the logger
+    /*!
+        Waits until all messages logged before the call are written and flushes
+        the log file.
+
+        Will block.
+    */
+    void Flush();
+
+private:
+    // Message formatter of the given arguments types
+    typedef void (*Formatter)(fmt::memory_buffer& buffer, fmt::string_view pattern, const uint8_t* data);
+
+    // Message record header followed by the encoded arguments
+    struct Record
+    {
+        uint32_t size;
+        LogLevel level;
+        uint64_t timestamp;
+        const char* pattern;
+        size_t pattern_size;
+        Formatter formatter;
+    };
+
+    // Ring buffer of the logging thread
+    struct Producer
+    {
+        std::unique_ptr<SPSCRingBuffer> buffer;
+        size_t limit;
+        uint64_t thread;
+        std::atomic<uint64_t> dropped;
+        std::atomic<bool> closed;
+        std::atomic<bool> detached;
+        uint64_t reported;
+
+        Producer(size_t capacity);
+    };
+
+    // Last used logger of the current thread
+    struct Cache
+    {
+        uint64_t id;
+        Producer* producer;
+    };
+
+    static inline thread_local Cache _cache = { 0, nullptr };
+
+    const uint64_t _id;
+    const Path _path;
+    const uint64_t _rotation_size;
+    const size_t _rotation_backups;
+    const size_t _capacity;
+    std::atomic<LogLevel> _level;
+    std::atomic<uint64_t> _logged;
+    std::atomic<uint64_t> _dropped;
+
+    // Registered producers
+    CriticalSection _producers_cs;
+    std::vector<std::shared_ptr<Producer>> _producers;
+    std::atomic<uint64_t> _producers_version;
+
+    // Background thread state
+    CriticalSection _cs;
+    ConditionVariable _cv;
+    bool _stop;
+    uint64_t _flush_request;
+    uint64_t _flush_done;
+    std::thread _thread;
+
+    // Background thread data
+    File _file;
+    uint64_t _written;
+    std::vector<std::shared_ptr<Producer>> _active;
+    uint64_t _active_version;
+    fmt::memory_buffer _output;
+    size_t _output_messages;
+    uint64_t _second;
+    char _prefix[32];
+
+    Producer* Register();
+
+    void Run();
+    size_t Drain();
+    void Format(const Record& record, uint64_t thread);
+    void Write();
+    void Rotate();
+
+    template <typename... T>
+    static void FormatArguments(fmt::memory_buffer& buffer, fmt::string_view pattern, const uint8_t* data);
+};
+
+/*! \example filesystem_async_logger.cpp Filesystem asynchronous logger example */
+
+} // namespace CppCommon
+
+#include "async_logger.inl"
+
+#endif // CPPCOMMON_FILESYSTEM_ASYNC_LOGGER_H
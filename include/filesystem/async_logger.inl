@@ -0,0 +1,149 @@
+/*!
+    \file async_logger.inl
+    \brief Filesystem asynchronous logger inline implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+template <class TOutputStream>
+inline TOutputStream& operator<<(TOutputStream& stream, LogLevel level)
+{
+    switch (level)
+    {
+        case LogLevel::DEBUG:
+            stream << "DEBUG";
+            break;
+        case LogLevel::INFO:
+            stream << "INFO";
+            break;
+        case LogLevel::WARN:
+            stream << "WARN";
+            break;
+        case LogLevel::ERROR:
+            stream << "ERROR";
+            break;
+        case LogLevel::FATAL:
+            stream << "FATAL";
+            break;
+        case LogLevel::NONE:
+            stream << "NONE";
+            break;
+        default:
+            stream << "<unknown>";
+            break;
+    }
+    return stream;
+}
+
+//! @cond INTERNALS
+namespace Internals {
+
+// Encoded arguments are aligned to 8 bytes
+constexpr size_t LogAlign(size_t size) noexcept { return (size + 7) & ~(size_t)7; }
+
+// String arguments are copied by content
+template <typename T>
+constexpr bool IsLogString = std::is_same_v<T, std::string> || std::is_same_v<T, std::string_view> || std::is_same_v<T, const char*> || std::is_same_v<T, char*>;
+
+template <typename T, typename = void>
+struct LogArgument
+{
+    static_assert(std::is_trivially_copyable_v<T>, "Asynchronous logger arguments must be strings or trivially copyable values!");
+
+    static size_t Size(const T&) noexcept { return LogAlign(sizeof(T)); }
+
+    static uint8_t* Encode(uint8_t* data, const T& value) noexcept
+    {
+        std::memcpy(data, &value, sizeof(T));
+        return data + LogAlign(sizeof(T));
+    }
+
+    static T Decode(const uint8_t*& data) noexcept
+    {
+        alignas(T) unsigned char storage[sizeof(T)];
+        std::memcpy(storage, data, sizeof(T));
+        data += LogAlign(sizeof(T));
+        return *std::launder(reinterpret_cast<T*>(storage));
+    }
+};
+
+template <typename T>
+struct LogArgument<T, std::enable_if_t<IsLogString<T>>>
+{
+    static std::string_view View(const T& value) noexcept
+    {
+        if constexpr (std::is_pointer_v<T>)
+            return (value != nullptr) ? std::string_view(value) : std::string_view("(null)");
+        else
+            return std::string_view(value);
+    }
+
+    static size_t Size(const T& value) noexcept { return LogAlign(sizeof(size_t) + View(value).size()); }
+
+    static uint8_t* Encode(uint8_t* data, const T& value) noexcept
+    {
+        std::string_view str = View(value);
+        size_t size = str.size();
+        std::memcpy(data, &size, sizeof(size_t));
+        std::memcpy(data + sizeof(size_t), str.data(), size);
+        return data + LogAlign(sizeof(size_t) + size);
+    }
+
+    static std::string_view Decode(const uint8_t*& data) noexcept
+    {
+        size_t size;
+        std::memcpy(&size, data, sizeof(size_t));
+        std::string_view str((const char*)data + sizeof(size_t), size);
+        data += LogAlign(sizeof(size_t) + size);
+        return str;
+    }
+};
+
+} // namespace Internals
+//! @endcond
+
+template <typename... T>
+inline void AsyncLogger::Log(LogLevel level, fmt::format_string<T...> pattern, T&&... args)
+{
+    if (level < _level.load(std::memory_order_relaxed))
+        return;
+
+    // Find the ring buffer of the current thread
+    Producer* producer = (_cache.id == _id) ? _cache.producer : Register();
+
+    size_t size = sizeof(Record) + (Internals::LogArgument<std::decay_t<T>>::Size(args) + ... + 0);
+    uint8_t* data = (size <= producer->limit) ? producer->buffer->Reserve(size).data() : nullptr;
+    if (data == nullptr)
+    {
+        // Drop the message instead of blocking the logging thread
+        producer->dropped.store(producer->dropped.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        return;
+    }
+
+    fmt::string_view str = pattern;
+    Record* record = new (data) Record;
+    record->size = (uint32_t)size;
+    record->level = level;
+    record->timestamp = TscClock::utc();
+    record->pattern = str.data();
+    record->pattern_size = str.size();
+    record->formatter = &FormatArguments<std::decay_t<T>...>;
+
+    [[maybe_unused]] uint8_t* output = data + sizeof(Record);
+    ((output = Internals::LogArgument<std::decay_t<T>>::Encode(output, args)), ...);
+
+    producer->buffer->Commit();
+}
+
+template <typename... T>
+inline void AsyncLogger::FormatArguments(fmt::memory_buffer& buffer, fmt::string_view pattern, [[maybe_unused]] const uint8_t* data)
+{
+    // Braced initialization decodes arguments in order
+    std::tuple<decltype(Internals::LogArgument<T>::Decode(data))...> args{ Internals::LogArgument<T>::Decode(data)... };
+    std::apply([&buffer, pattern](const auto&... values) { fmt::vformat_to(fmt::appender(buffer), pattern, fmt::make_format_args(values...)); }, args);
+}
+
+} // namespace CppCommon
@@ -50,6 +50,12 @@ public:
 
     //! Is the directory exists?
     bool IsDirectoryExists() const;
+    //! Is the directory exists? (without raising a filesystem exception)
+    /*!
+        \param ec - Error code of the failed status request
+        \return 'true' if the directory exists, 'false' if it does not exist or on error
+    */
+    bool IsDirectoryExists(std::error_code& ec) const noexcept;
     //! Is the directory empty?
     bool IsDirectoryEmpty() const;
 
@@ -131,6 +137,15 @@ public:
         \return Created full directory tree
     */
     static Directory CreateTree(const Path& path, const Flags<FileAttributes>& attributes = Directory::DEFAULT_ATTRIBUTES, const Flags<FilePermissions>& permissions = Directory::DEFAULT_PERMISSIONS);
+    //! Try to create directory from the given path without raising a filesystem exception
+    /*!
+        \param path - Directory path
+        \param ec - Error code of the failed directory creation
+        \param attributes - Directory attributes (default is Directory::DEFAULT_ATTRIBUTES)
+        \param permissions - Directory permissions (default is Directory::DEFAULT_PERMISSIONS)
+        \return 'true' if the directory was created or already exists, 'false' on error
+    */
+    static bool TryCreate(const Path& path, std::error_code& ec, const Flags<FileAttributes>& attributes = Directory::DEFAULT_ATTRIBUTES, const Flags<FilePermissions>& permissions = Directory::DEFAULT_PERMISSIONS) noexcept;
 
     //! Swap two instances
     void swap(Directory& directory) noexcept;
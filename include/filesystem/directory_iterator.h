@@ -15,11 +15,85 @@
 
 namespace CppCommon {
 
+//! Filesystem directory entry
+/*!
+    Directory entry is a path produced by the directory iterator, which carries
+    the file type taken from the directory listing (d_type of readdir() on Unix,
+    WIN32_FIND_DATA attributes on Windows). Therefore type checks of the entry
+    do not require any system call. If the directory listing does not provide
+    the entry type (DT_UNKNOWN on some file systems) it will be requested with
+    the path status on the first use.
+
+    Entry size and modified timestamp are requested with a single stat() call
+    on the first use and cached. On Windows they are taken from the directory
+    listing for all entries except of symbolic links.
+
+    Cached metadata is a snapshot of the iteration time and it is not updated
+    when the file is changed later. Use Refresh() method to reset it.
+
+    Not thread-safe.
+*/
+class DirectoryEntry : public Path
+{
+    friend class DirectoryIterator;
+
+public:
+    DirectoryEntry() : Path(), _type(FileType::UNKNOWN), _status(false), _size(0), _modified(Timestamp(0)) {}
+    //! Initialize the directory entry with a given path and file type
+    /*!
+        \param path - Entry path
+        \param type - Entry file type (default is FileType::UNKNOWN to request it on the first use)
+    */
+    explicit DirectoryEntry(const Path& path, FileType type = FileType::UNKNOWN) : Path(path), _type(type), _status(false), _size(0), _modified(Timestamp(0)) {}
+    DirectoryEntry(const DirectoryEntry&) = default;
+    DirectoryEntry(DirectoryEntry&&) = default;
+    ~DirectoryEntry() = default;
+
+    DirectoryEntry& operator=(const DirectoryEntry&) = default;
+    DirectoryEntry& operator=(DirectoryEntry&&) = default;
+
+    //! Get the cached entry file type (symbolic links are not followed)
+    FileType type() const;
+    //! Get the cached entry size in bytes (symbolic links are followed)
+    uint64_t size() const;
+    //! Get the cached entry modified timestamp (symbolic links are followed)
+    UtcTimestamp modified() const;
+
+    //! Is the entry exists?
+    bool IsExists() const { return type() != FileType::NONE; }
+    //! Is the entry points to a regular file?
+    bool IsRegularFile() const { return type() == FileType::REGULAR; }
+    //! Is the entry points to a directory?
+    bool IsDirectory() const { return type() == FileType::DIRECTORY; }
+    //! Is the entry points to a symbolic link?
+    bool IsSymlink() const { return type() == FileType::SYMLINK; }
+
+    //! Reset the cached metadata, so it will be requested again on the next use
+    void Refresh() noexcept { _type = FileType::UNKNOWN; _status = false; }
+
+    //! Swap two instances
+    void swap(DirectoryEntry& entry) noexcept;
+    friend void swap(DirectoryEntry& entry1, DirectoryEntry& entry2) noexcept;
+
+private:
+    mutable FileType _type;
+    mutable bool _status;
+    mutable uint64_t _size;
+    mutable UtcTimestamp _modified;
+
+    //! Request and cache the entry status
+    void Status() const;
+};
+
 //! Filesystem directory iterator
 /*!
     Filesystem directory iterator is used to iterate through directory
     content (directories, files, symlinks).
 
+    Iterator produces directory entries with the file type taken from the
+    directory listing, so walking through the directory tree does not require
+    additional stat() calls to check entries types.
+
     No sort order is guarantied!
 
     Not thread-safe.
@@ -31,9 +105,9 @@ class DirectoryIterator
 public:
     // Standard constant iterator type definitions
     typedef std::ptrdiff_t difference_type;
-    typedef Path value_type;
-    typedef const Path& reference;
-    typedef const Path* pointer;
+    typedef DirectoryEntry value_type;
+    typedef const DirectoryEntry& reference;
+    typedef const DirectoryEntry* pointer;
     typedef std::forward_iterator_tag iterator_category;
 
     DirectoryIterator();
@@ -50,8 +124,8 @@ public:
     DirectoryIterator& operator++();
     DirectoryIterator operator++(int);
 
-    const Path& operator*() const noexcept;
-    const Path* operator->() const noexcept;
+    const DirectoryEntry& operator*() const noexcept;
+    const DirectoryEntry* operator->() const noexcept;
 
     //! Swap two instances
     void swap(DirectoryIterator& it) noexcept;
@@ -62,9 +136,9 @@ private:
     class SimpleImpl;
     class RecursiveImpl;
     std::unique_ptr<Impl> _pimpl;
-    Path _current;
+    DirectoryEntry _current;
 
-    DirectoryIterator(const Path& current);
+    DirectoryIterator(const DirectoryEntry& current);
     DirectoryIterator(const Path& parent, bool recursive);
 };
 
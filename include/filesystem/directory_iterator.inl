@@ -8,6 +8,21 @@
 
 namespace CppCommon {
 
+inline void DirectoryEntry::swap(DirectoryEntry& entry) noexcept
+{
+    using std::swap;
+    Path::swap(entry);
+    swap(_type, entry._type);
+    swap(_status, entry._status);
+    swap(_size, entry._size);
+    swap(_modified, entry._modified);
+}
+
+inline void swap(DirectoryEntry& entry1, DirectoryEntry& entry2) noexcept
+{
+    entry1.swap(entry2);
+}
+
 inline bool operator==(const DirectoryIterator& it1, const DirectoryIterator& it2) noexcept
 {
     return it1._current == it2._current;
@@ -18,12 +33,12 @@ inline bool operator!=(const DirectoryIterator& it1, const DirectoryIterator& it
     return it1._current != it2._current;
 }
 
-inline const Path& DirectoryIterator::operator*() const noexcept
+inline const DirectoryEntry& DirectoryIterator::operator*() const noexcept
 {
     return _current;
 }
 
-inline const Path* DirectoryIterator::operator->() const noexcept
+inline const DirectoryEntry* DirectoryIterator::operator->() const noexcept
 {
     return &_current;
 }
@@ -0,0 +1,109 @@
+/*!
+    \file directory_walker.h
+    \brief Filesystem parallel directory walker definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_FILESYSTEM_DIRECTORY_WALKER_H
+#define CPPCOMMON_FILESYSTEM_DIRECTORY_WALKER_H
+
+#include "filesystem/path.h"
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+
+namespace CppCommon {
+
+class ThreadPool;
+
+//! Filesystem parallel directory walker
+/*!
+    Directory walker recursively traverses the directory tree and streams all
+    entries (directories, files, symlinks) into the given handler. Each  sub
+    directory is listed by a separate task of the thread pool, so  different
+    parts of the tree are listed concurrently and  the  work-stealing  thread
+    pool balances wide and deep trees between its workers.
+
+    Entry types are taken from the directory listing (d_type of readdir() on
+    Unix, attributes of FindFirstFileEx() with large fetch on Windows), so no
+    additional stat() call is made for an entry unless the filesystem does not
+    report its type. Symbolic links are reported, but never followed.
+
+    Enter handler is called for each entry once it is listed (parent directory
+    is always entered before its content). Leave handler is called for each
+    entered sub-directory after all its content is handled, so it could be
+    used to process directories in post-order (e.g. to remove them).
+
+    Handlers are called concurrently from thread pool workers and must be
+    thread-safe! No order of sibling entries is guarantied. If any handler
+    throws an exception the walk is stopped and the first exception is
+    rethrown from the Walk() method.
+
+    Not thread-safe.
+*/
+class DirectoryWalker
+{
+public:
+    //! Enter handler
+    /*!
+        Handler is called with the entry path and its type. Handler returns
+        'false' to skip the content of the entered directory.
+    */
+    typedef std::function<bool (const Path& path, FileType type)> EnterHandler;
+    //! Leave handler
+    /*!
+        Handler is called with the path of the sub-directory which content
+        was completely handled.
+    */
+    typedef std::function<void (const Path& path)> LeaveHandler;
+
+    //! Initialize directory walker with a given count of threads
+    /*!
+        Single thread walker lists all directories in the calling thread.
+
+        \param threads - Walker threads count (default is 0 - CPU::LogicalCores())
+    */
+    explicit DirectoryWalker(size_t threads = 0);
+    //! Initialize directory walker with a given thread pool
+    /*!
+        Walk() method of such walker must not be called from workers of the
+        given thread pool.
+
+        \param pool - Thread pool to list directories
+    */
+    explicit DirectoryWalker(ThreadPool& pool);
+    DirectoryWalker(const DirectoryWalker&) = delete;
+    DirectoryWalker(DirectoryWalker&&) = delete;
+    ~DirectoryWalker();
+
+    DirectoryWalker& operator=(const DirectoryWalker&) = delete;
+    DirectoryWalker& operator=(DirectoryWalker&&) = delete;
+
+    //! Get walker threads count
+    size_t threads() const noexcept;
+
+    //! Walk the given directory tree
+    /*!
+        Will block until all entries are handled.
+
+        \param root - Root directory path (not passed into handlers)
+        \param enter - Enter handler
+        \param leave - Leave handler (default is nullptr)
+        \return Count of handled entries
+    */
+    uint64_t Walk(const Path& root, const EnterHandler& enter, const LeaveHandler& leave = nullptr);
+
+private:
+    std::unique_ptr<ThreadPool> _owned;
+    ThreadPool* _pool;
+    size_t _threads;
+};
+
+/*! \example filesystem_directory_walker.cpp Filesystem parallel directory walker example */
+
+} // namespace CppCommon
+
+#endif // CPPCOMMON_FILESYSTEM_DIRECTORY_WALKER_H
@@ -0,0 +1,90 @@
+/*!
+    \file directory_watcher.h
+    \brief Filesystem directory watcher definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_FILESYSTEM_DIRECTORY_WATCHER_H
+#define CPPCOMMON_FILESYSTEM_DIRECTORY_WATCHER_H
+
+#include "filesystem/path.h"
+
+#include <memory>
+#include <vector>
+
+namespace CppCommon {
+
+//! Directory change type
+enum class DirectoryChange
+{
+    MODIFIED,   //!< File was created, written or moved into the watched directory
+    REMOVED,    //!< File or directory was removed or moved out of the watched directory
+    RESCAN      //!< Change notifications were lost, the watched directory should be rescanned
+};
+
+//! Directory change event
+struct DirectoryEvent
+{
+    DirectoryChange change; //!< Directory change type
+    Path root;              //!< Watched root directory
+    Path path;              //!< Changed path (equals to the root for rescan events)
+
+    DirectoryEvent(DirectoryChange c, const Path& r, const Path& p) : change(c), root(r), path(p) {}
+};
+
+//! Filesystem directory watcher
+/*!
+    Directory watcher subscribes to filesystem change notifications of several
+    directory trees (inotify for Linux, ReadDirectoryChangesW for Windows) and
+    returns accumulated changes on each poll without blocking.
+
+    Directory watcher is not supported for other platforms and throws  the
+    filesystem exception on watching a directory.
+
+    Not thread-safe.
+*/
+class DirectoryWatcher
+{
+public:
+    DirectoryWatcher();
+    DirectoryWatcher(const DirectoryWatcher&) = delete;
+    DirectoryWatcher(DirectoryWatcher&& watcher) noexcept;
+    ~DirectoryWatcher();
+
+    DirectoryWatcher& operator=(const DirectoryWatcher&) = delete;
+    DirectoryWatcher& operator=(DirectoryWatcher&& watcher) noexcept;
+
+    //! Watch the given directory tree recursively
+    /*!
+        \param path - Directory path to watch
+    */
+    void Watch(const Path& path);
+    //! Stop watching the given directory tree
+    /*!
+        \param path - Directory path to unwatch
+        \return 'true' if the directory was watched, 'false' if the given directory was not watched
+    */
+    bool Unwatch(const Path& path);
+
+    //! Poll accumulated directory changes without blocking
+    /*!
+        \return Directory change events in the order of their occurrence
+    */
+    std::vector<DirectoryEvent> Poll();
+
+    //! Swap two instances
+    void swap(DirectoryWatcher& watcher) noexcept;
+    friend void swap(DirectoryWatcher& watcher1, DirectoryWatcher& watcher2) noexcept;
+
+private:
+    class Impl;
+    std::unique_ptr<Impl> _pimpl;
+};
+
+} // namespace CppCommon
+
+#include "directory_watcher.inl"
+
+#endif // CPPCOMMON_FILESYSTEM_DIRECTORY_WATCHER_H
@@ -0,0 +1,22 @@
+/*!
+    \file directory_watcher.inl
+    \brief Filesystem directory watcher inline implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+inline void DirectoryWatcher::swap(DirectoryWatcher& watcher) noexcept
+{
+    using std::swap;
+    swap(_pimpl, watcher._pimpl);
+}
+
+inline void swap(DirectoryWatcher& watcher1, DirectoryWatcher& watcher2) noexcept
+{
+    watcher1.swap(watcher2);
+}
+
+} // namespace CppCommon
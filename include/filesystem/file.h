@@ -13,15 +13,31 @@
 #include "common/writer.h"
 #include "filesystem/path.h"
 
+#include <initializer_list>
 #include <memory>
+#include <span>
 #include <vector>
 
 namespace CppCommon {
 
+//! File access pattern advice
+enum class FileAdvice
+{
+    NORMAL,         //!< No special access pattern (default read-ahead)
+    SEQUENTIAL,     //!< Sequential access (aggressive read-ahead)
+    RANDOM,         //!< Random access (no read-ahead)
+    WILLNEED,       //!< Data will be accessed soon (prefetch it)
+    DONTNEED        //!< Data will not be accessed soon (release it from the cache)
+};
+
 //! Filesystem file
 /*!
     Filesystem file wraps file management operations (create, open, read, write, flush, close).
 
+    Files opened with FileAttributes::DIRECT bypass the system page cache and
+    are always unbuffered. Their buffers, offsets and sizes of all operations
+    must be aligned with File::DIRECT_ALIGNMENT (see File::DirectBuffer).
+
     Not thread-safe.
 */
 class File : public Path, public Reader, public Writer
@@ -33,6 +49,58 @@ public:
     static const Flags<FilePermissions> DEFAULT_PERMISSIONS;
     //! Default file buffer size (8192)
     static const size_t DEFAULT_BUFFER;
+    //! Alignment of buffers, offsets and sizes of direct I/O operations (4096)
+    static const size_t DIRECT_ALIGNMENT;
+
+    //! Aligned buffer for direct I/O operations
+    /*!
+        Buffer memory is aligned with Memory::Align() and the buffer size is
+        rounded up to the alignment, so it could be used  to  read  or write
+        files opened with FileAttributes::DIRECT.
+
+        Not thread-safe.
+    */
+    class DirectBuffer
+    {
+    public:
+        //! Allocate aligned buffer of the given size
+        /*!
+            \param size - Buffer size (rounded up to the alignment)
+            \param alignment - Buffer alignment. Must be a power of two (default is File::DIRECT_ALIGNMENT)
+        */
+        explicit DirectBuffer(size_t size, size_t alignment = File::DIRECT_ALIGNMENT);
+        DirectBuffer(const DirectBuffer&) = delete;
+        DirectBuffer(DirectBuffer&&) noexcept = default;
+        ~DirectBuffer() = default;
+
+        DirectBuffer& operator=(const DirectBuffer&) = delete;
+        DirectBuffer& operator=(DirectBuffer&&) noexcept = default;
+
+        //! Get the buffer data
+        uint8_t* data() noexcept { return _data; }
+        const uint8_t* data() const noexcept { return _data; }
+        //! Get the buffer size
+        size_t size() const noexcept { return _size; }
+        //! Get the buffer alignment
+        size_t alignment() const noexcept { return _alignment; }
+
+        //! Round up the given size to the given alignment
+        static size_t AlignSize(size_t size, size_t alignment = File::DIRECT_ALIGNMENT) noexcept
+        { return (size + alignment - 1) & ~(alignment - 1); }
+
+    private:
+        std::unique_ptr<uint8_t[]> _storage;
+        uint8_t* _data;
+        size_t _size;
+        size_t _alignment;
+    };
+
+    //! Scatter buffer of vectored read operations
+    struct ReadBuffer
+    {
+        void* data;     //!< Buffer to read
+        size_t size;    //!< Buffer size
+    };
 
     //! Initialize file with an empty path
     File();
@@ -53,10 +121,14 @@ public:
     //! Check if the file opened
     explicit operator bool() const noexcept { return IsFileOpened(); }
 
+    //! Get the native file handler (-1 or INVALID_HANDLE_VALUE if the file is not opened)
+    void* handle() const noexcept;
     //! Get the current read/write offset of the opened file
     uint64_t offset() const;
     //! Get the current file size
     uint64_t size() const;
+    //! Get the count of bytes remaining to read from the current offset of the opened file
+    uint64_t remaining() const override;
 
     //! Is the file exists?
     bool IsFileExists() const;
@@ -105,6 +177,33 @@ public:
         \param buffer - File buffer size (default is File::DEFAULT_BUFFER)
     */
     void OpenOrCreate(bool read, bool write, bool truncate = false, const Flags<FileAttributes>& attributes = File::DEFAULT_ATTRIBUTES, const Flags<FilePermissions>& permissions = File::DEFAULT_PERMISSIONS, size_t buffer = File::DEFAULT_BUFFER);
+    //! Try to open an existing file without raising a filesystem exception
+    /*!
+        Failed open (e.g. missing file in a probing loop) is reported with the
+        system error code instead of the filesystem exception.
+
+        \param read - Read mode
+        \param write - Write mode
+        \param ec - Error code of the failed open
+        \param truncate - Truncate file (default is false)
+        \param attributes - File attributes (default is File::DEFAULT_ATTRIBUTES)
+        \param permissions - File permissions (default is File::DEFAULT_PERMISSIONS)
+        \param buffer - File buffer size (default is File::DEFAULT_BUFFER)
+        \return 'true' if the file was opened, 'false' on error
+    */
+    bool TryOpen(bool read, bool write, std::error_code& ec, bool truncate = false, const Flags<FileAttributes>& attributes = File::DEFAULT_ATTRIBUTES, const Flags<FilePermissions>& permissions = File::DEFAULT_PERMISSIONS, size_t buffer = File::DEFAULT_BUFFER);
+    //! Try to open or create file without raising a filesystem exception
+    /*!
+        \param read - Read mode
+        \param write - Write mode
+        \param ec - Error code of the failed open
+        \param truncate - Truncate file (default is false)
+        \param attributes - File attributes (default is File::DEFAULT_ATTRIBUTES)
+        \param permissions - File permissions (default is File::DEFAULT_PERMISSIONS)
+        \param buffer - File buffer size (default is File::DEFAULT_BUFFER)
+        \return 'true' if the file was opened, 'false' on error
+    */
+    bool TryOpenOrCreate(bool read, bool write, std::error_code& ec, bool truncate = false, const Flags<FileAttributes>& attributes = File::DEFAULT_ATTRIBUTES, const Flags<FilePermissions>& permissions = File::DEFAULT_PERMISSIONS, size_t buffer = File::DEFAULT_BUFFER);
 
     //! Read a bytes buffer from the opened file
     /*!
@@ -116,6 +215,17 @@ public:
         \return Count of read bytes
     */
     size_t Read(void* buffer, size_t size) override;
+    //! Try to read a bytes buffer from the opened file without raising a filesystem exception
+    /*!
+        If the file is not opened for reading the method fails with
+        std::errc::bad_file_descriptor error code.
+
+        \param buffer - Buffer to read
+        \param size - Buffer size
+        \param ec - Error code of the failed read
+        \return Count of read bytes before the error
+    */
+    size_t TryRead(void* buffer, size_t size, std::error_code& ec);
 
     using Reader::ReadAllBytes;
     using Reader::ReadAllText;
@@ -134,6 +244,92 @@ public:
 
     using Writer::Write;
 
+    //! Read bytes buffers from the opened file with one vectored read (readv)
+    /*!
+        Buffers are filled in order from the current file offset. Unbuffered
+        files (opened with zero buffer size) read all buffers  with  vectored
+        system calls, buffered files read them through the file read buffer.
+
+        If the file is not opened for reading the method will raise
+        a filesystem exception!
+
+        \param buffers - Buffers to read
+        \return Count of read bytes (less than total buffers size only at the end of the file)
+    */
+    size_t ReadV(std::span<const ReadBuffer> buffers);
+    //! Read bytes buffers from the opened file with one vectored read (readv)
+    size_t ReadV(std::initializer_list<ReadBuffer> buffers)
+    { return ReadV(std::span<const ReadBuffer>(buffers.begin(), buffers.size())); }
+    //! Write bytes buffers into the opened file with one vectored write (writev)
+    /*!
+        Buffers are written in order from the current file offset. Unbuffered
+        files (opened with zero buffer size) write all buffers  with  one
+        vectored system call (e.g. record header and payload), buffered files
+        write them through the file write buffer.
+
+        If the file is not opened for writing the method will raise
+        a filesystem exception!
+
+        \param buffers - Buffers to write
+        \return Count of written bytes
+    */
+    size_t WriteV(std::span<const WriteBuffer> buffers) override;
+
+    using Writer::WriteV;
+
+    //! Read a bytes buffer from the given offset of the opened file (pread)
+    /*!
+        Positional operations bypass file buffers and do not change the current
+        file offset on Unix platforms, so several threads could read different
+        parts of the file concurrently. On Windows positional operations move
+        the current file offset.
+
+        If the file is not opened for reading the method will raise
+        a filesystem exception!
+
+        \param offset - File offset
+        \param buffer - Buffer to read
+        \param size - Buffer size
+        \return Count of read bytes (less than the buffer size only at the end of the file)
+    */
+    size_t ReadAt(uint64_t offset, void* buffer, size_t size) const;
+    //! Read bytes buffers from the given offset of the opened file (preadv)
+    /*!
+        \param offset - File offset
+        \param buffers - Buffers to read
+        \return Count of read bytes (less than total buffers size only at the end of the file)
+    */
+    size_t ReadAt(uint64_t offset, std::span<const ReadBuffer> buffers) const;
+    //! Read bytes buffers from the given offset of the opened file (preadv)
+    size_t ReadAt(uint64_t offset, std::initializer_list<ReadBuffer> buffers) const
+    { return ReadAt(offset, std::span<const ReadBuffer>(buffers.begin(), buffers.size())); }
+    //! Write a bytes buffer into the given offset of the opened file (pwrite)
+    /*!
+        Positional operations bypass file buffers and do not change the current
+        file offset on Unix platforms, so several threads could write different
+        parts of the file concurrently. Buffered writes should be flushed before
+        writing the same part of the file.
+
+        If the file is not opened for writing the method will raise
+        a filesystem exception!
+
+        \param offset - File offset
+        \param buffer - Buffer to write
+        \param size - Buffer size
+        \return Count of written bytes
+    */
+    size_t WriteAt(uint64_t offset, const void* buffer, size_t size);
+    //! Write bytes buffers into the given offset of the opened file (pwritev)
+    /*!
+        \param offset - File offset
+        \param buffers - Buffers to write
+        \return Count of written bytes
+    */
+    size_t WriteAt(uint64_t offset, std::span<const WriteBuffer> buffers);
+    //! Write bytes buffers into the given offset of the opened file (pwritev)
+    size_t WriteAt(uint64_t offset, std::initializer_list<WriteBuffer> buffers)
+    { return WriteAt(offset, std::span<const WriteBuffer>(buffers.begin(), buffers.size())); }
+
     //! Seek into the opened file
     /*!
         If the file is not opened for writing the method will raise
@@ -155,6 +351,32 @@ public:
     */
     void Resize(uint64_t size);
 
+    //! Preallocate the disk space of the opened file
+    /*!
+        Allocates disk extents up to the given size without changing the file
+        size (fallocate() with FALLOC_FL_KEEP_SIZE on Linux, F_PREALLOCATE on
+        Apple, allocation size of the file on Windows), so  following  appends
+        do not allocate extents one by one. Platforms without preallocation
+        support ignore the request.
+
+        If the file is not opened for writing the method will raise
+        a filesystem exception!
+
+        \param size - Size of the preallocated file space
+    */
+    void Preallocate(uint64_t size);
+
+    //! Advise the access pattern of the opened file
+    /*!
+        Advice is only a hint for the system page cache (posix_fadvise()). It
+        is ignored on platforms without the advice support (e.g. Windows).
+
+        \param advice - Access pattern advice
+        \param offset - Offset of the advised range (default is 0)
+        \param size - Size of the advised range (default is 0 - till the end of the file)
+    */
+    void Advise(FileAdvice advice, uint64_t offset = 0, uint64_t size = 0);
+
     //! Flush the file
     /*!
         Flush any unwritten data of the opened file to the physical file
@@ -162,6 +384,16 @@ public:
         raise a filesystem exception!
     */
     void Flush() override;
+    //! Flush the file data
+    /*!
+        Flush any unwritten data of the opened file to the physical file on
+        a disk, but skip the file metadata (e.g. modification time) which is
+        not required to read the data back (fdatasync() on Linux). It saves
+        one disk write per flush of the appended file in comparison with the
+        Flush() method. If the file is not opened for writing the method will
+        raise a filesystem exception!
+    */
+    void FlushData();
 
     //! Close the file
     /*!
@@ -9,9 +9,15 @@
 #ifndef CPPCOMMON_FILESYSTEM_H
 #define CPPCOMMON_FILESYSTEM_H
 
+#include "filesystem/async_file.h"
+#include "filesystem/async_logger.h"
 #include "filesystem/directory.h"
+#include "filesystem/directory_walker.h"
+#include "filesystem/directory_watcher.h"
 #include "filesystem/exceptions.h"
 #include "filesystem/file.h"
+#include "filesystem/journal.h"
+#include "filesystem/mapped_file.h"
 #include "filesystem/path.h"
 #include "filesystem/symlink.h"
 
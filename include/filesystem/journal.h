@@ -0,0 +1,140 @@
+/*!
+    \file journal.h
+    \brief Filesystem group commit journal definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_FILESYSTEM_JOURNAL_H
+#define CPPCOMMON_FILESYSTEM_JOURNAL_H
+
+#include "filesystem/file.h"
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string_view>
+
+namespace CppCommon {
+
+//! Filesystem group commit journal
+/*!
+    Journal is a durable append-only log of records. Many producer threads
+    append records concurrently and a dedicated writer thread takes all
+    records appended since its previous commit from the wait batcher and
+    commits them as one group: one write of all framed records followed by
+    one data flush (fdatasync() on Linux). All appending threads of the group
+    are woken together when the group is durable. So the cost of the disk
+    flush is shared by all records of the group and the journal throughput
+    grows with the count of concurrent producers instead of being limited by
+    one flush per record.
+
+    Each record is framed with 8 bytes header: little-endian 32-bit record
+    size and CRC-32C checksum of the size and the record content. Journal
+    Open() method scans existing records and truncates the torn or corrupted
+    tail left by the crash, so only complete records are read back.
+
+    Append() method is thread-safe. Open() and Close() methods must not be
+    called concurrently with other methods.
+*/
+class Journal
+{
+public:
+    //! Record header size (8 bytes)
+    static const size_t HEADER_SIZE;
+    //! Maximal record size
+    static const size_t MAX_RECORD_SIZE;
+
+    //! Record handler
+    /*!
+        Handler is called with the record offset in the journal file, the
+        record content and its size. Handler returns 'false' to stop reading.
+    */
+    typedef std::function<bool (uint64_t offset, const uint8_t* data, size_t size)> RecordHandler;
+
+    //! Initialize journal with a given path
+    /*!
+        \param path - Journal file path
+        \param permissions - Journal file permissions of the created file (default is File::DEFAULT_PERMISSIONS)
+    */
+    explicit Journal(const Path& path, const Flags<FilePermissions>& permissions = File::DEFAULT_PERMISSIONS);
+    Journal(const Journal&) = delete;
+    Journal(Journal&&) = delete;
+    ~Journal();
+
+    Journal& operator=(const Journal&) = delete;
+    Journal& operator=(Journal&&) = delete;
+
+    //! Check if the journal is opened
+    explicit operator bool() const noexcept { return IsOpened(); }
+
+    //! Get the journal file path
+    const Path& path() const noexcept;
+    //! Get the durable size of the journal file
+    uint64_t size() const noexcept;
+    //! Get the count of durable records appended since the journal was opened
+    uint64_t records() const noexcept;
+    //! Get the count of group commits since the journal was opened
+    uint64_t commits() const noexcept;
+
+    //! Is the journal opened?
+    bool IsOpened() const noexcept;
+
+    //! Open or create the journal file
+    /*!
+        Scans existing records of the journal file, truncates its invalid tail
+        and starts the writer thread.
+    */
+    void Open();
+
+    //! Append the record into the journal
+    /*!
+        Will block until the record and all records appended before it are
+        durable on the disk.
+
+        If the journal failed to write or flush the file, the method will
+        raise a filesystem exception for the current and all following
+        records!
+
+        \param buffer - Record buffer
+        \param size - Record size (up to Journal::MAX_RECORD_SIZE)
+        \return Record offset in the journal file
+    */
+    uint64_t Append(const void* buffer, size_t size);
+    //! Append the record into the journal
+    /*!
+        \param record - Record content
+        \return Record offset in the journal file
+    */
+    uint64_t Append(std::string_view record)
+    { return Append(record.data(), record.size()); }
+
+    //! Close the journal
+    /*!
+        Waits for all appended records before closing the journal file.
+    */
+    void Close();
+
+    //! Read all valid records of the given journal file
+    /*!
+        Reads records from the beginning of the journal file and stops at the
+        first incomplete or corrupted record, or when the handler returns
+        'false'. Missing journal file is treated as the empty one.
+
+        \param path - Journal file path
+        \param handler - Record handler (might be empty to validate the journal)
+        \return Size of the journal file prefix with all read records
+    */
+    static uint64_t Read(const Path& path, const RecordHandler& handler);
+
+private:
+    class Impl;
+    std::unique_ptr<Impl> _pimpl;
+};
+
+/*! \example filesystem_journal.cpp Filesystem group commit journal example */
+
+} // namespace CppCommon
+
+#endif // CPPCOMMON_FILESYSTEM_JOURNAL_H
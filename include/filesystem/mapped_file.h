@@ -0,0 +1,153 @@
+/*!
+    \file mapped_file.h
+    \brief Filesystem memory-mapped file definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_FILESYSTEM_MAPPED_FILE_H
+#define CPPCOMMON_FILESYSTEM_MAPPED_FILE_H
+
+#include "filesystem/file.h"
+
+#include <cstdint>
+#include <span>
+#include <string_view>
+
+namespace CppCommon {
+
+//! Memory-mapped file mode
+enum class MappedFileMode
+{
+    READ,           //!< Read-only mapping
+    READ_WRITE      //!< Read-write mapping shared with the file
+};
+
+//! Filesystem memory-mapped file
+/*!
+    Memory-mapped file maps the whole file content into the process  address
+    space. Pages are loaded lazily on the first access and  are  shared  through
+    the system page cache with all processes mapping the same file, so  mapped
+    content is accessed without any copy into user buffers.
+
+    Read-only mapping closes the file handle right after mapping, so  read-only
+    mapped files do not consume file descriptors. Remap() follows the file  if
+    it grows (e.g. a journal appended by another process).
+
+    Read-write mapping keeps the file handle opened. Writes into the mapped
+    content are shared with the file, Flush() writes them to the disk, and
+    Resize() changes the size of both the file and the mapping. On Linux the
+    mapping is extended incrementally with mremap(), so already mapped  pages
+    stay mapped.
+
+    Mapped content must not be accessed if the file is truncated by  another
+    process (POSIX mapping raises SIGBUS in such case). Pointers  to  mapped
+    content are invalidated by Resize() and Remap().
+
+    Not thread-safe.
+*/
+class MappedFile
+{
+public:
+    //! Map the given file
+    /*!
+        Read-write mode creates the file if it is not exist and extends it to
+        the given size if it is smaller. Empty files are not mapped and  have
+        empty content.
+
+        \param path - File path
+        \param mode - Mapping mode (default is MappedFileMode::READ)
+        \param size - Minimal file size for the read-write mode (default is 0)
+    */
+    explicit MappedFile(const Path& path, MappedFileMode mode = MappedFileMode::READ, size_t size = 0);
+    MappedFile(const MappedFile&) = delete;
+    MappedFile(MappedFile&& file) noexcept;
+    ~MappedFile();
+
+    MappedFile& operator=(const MappedFile&) = delete;
+    MappedFile& operator=(MappedFile&& file) noexcept;
+
+    //! Get the mapped file path
+    const Path& path() const noexcept { return _path; }
+    //! Get the mapping mode
+    MappedFileMode mode() const noexcept { return _mode; }
+    //! Get the mapped file size
+    size_t size() const noexcept { return _size; }
+    //! Get the mapped file data
+    const char* data() const noexcept { return _data; }
+    //! Get the mapped file data for writing (nullptr for the read-only mapping)
+    char* mutable_data() noexcept { return IsWritable() ? _data : nullptr; }
+    //! Get the mapped file content view
+    std::string_view view() const noexcept { return std::string_view(_data, _size); }
+    //! Get the mapped file content bytes
+    std::span<const uint8_t> bytes() const noexcept { return std::span<const uint8_t>((const uint8_t*)_data, _size); }
+    //! Get the mapped file content bytes for writing (empty for the read-only mapping)
+    std::span<uint8_t> mutable_bytes() noexcept { return IsWritable() ? std::span<uint8_t>((uint8_t*)_data, _size) : std::span<uint8_t>(); }
+
+    //! Is the file mapped for writing?
+    bool IsWritable() const noexcept { return (_mode == MappedFileMode::READ_WRITE); }
+
+    //! Advise the access pattern of the mapped content
+    /*!
+        Advice is only a hint and does not change the mapped content. The given
+        range is extended to the page boundaries and clamped with the  mapped
+        file size.
+
+        \param advice - Access pattern advice
+        \param offset - Offset of the advised range (default is 0)
+        \param size - Size of the advised range (default is the whole file)
+    */
+    void Advise(FileAdvice advice, size_t offset = 0, size_t size = (size_t)-1);
+
+    //! Resize the read-write mapped file
+    /*!
+        Extended content of the file is filled with zeros. The method will raise
+        a filesystem exception for the read-only mapping!
+
+        \param size - New file size
+    */
+    void Resize(size_t size);
+
+    //! Remap the file with its current size
+    /*!
+        Useful to follow the file modified by another process.
+
+        \return 'true' if the mapped file size was changed, 'false' otherwise
+    */
+    bool Remap();
+
+    //! Flush the mapped content written into the file
+    /*!
+        Does nothing for the read-only mapping.
+
+        \param async - Asynchronous flush flag (schedule the write and do not wait for it, default is false)
+    */
+    void Flush(bool async = false);
+
+    //! Swap two instances
+    void swap(MappedFile& file) noexcept;
+    friend void swap(MappedFile& file1, MappedFile& file2) noexcept;
+
+private:
+    Path _path;
+    MappedFileMode _mode;
+    char* _data;
+    size_t _size;
+    intptr_t _file;
+
+    intptr_t OpenFile();
+    bool CloseFile(intptr_t file) noexcept;
+    size_t GetFileSize(intptr_t file);
+    void SetFileSize(intptr_t file, size_t size);
+    void Map(intptr_t file, size_t size);
+    void Unmap();
+};
+
+/*! \example filesystem_mapped_file.cpp Filesystem memory-mapped file example */
+
+} // namespace CppCommon
+
+#include "mapped_file.inl"
+
+#endif // CPPCOMMON_FILESYSTEM_MAPPED_FILE_H
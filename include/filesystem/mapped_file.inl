@@ -0,0 +1,40 @@
+/*!
+    \file mapped_file.inl
+    \brief Filesystem memory-mapped file inline implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+inline MappedFile::MappedFile(MappedFile&& file) noexcept
+    : _path(std::move(file._path)), _mode(file._mode), _data(file._data), _size(file._size), _file(file._file)
+{
+    file._data = nullptr;
+    file._size = 0;
+    file._file = -1;
+}
+
+inline MappedFile& MappedFile::operator=(MappedFile&& file) noexcept
+{
+    MappedFile(std::move(file)).swap(*this);
+    return *this;
+}
+
+inline void MappedFile::swap(MappedFile& file) noexcept
+{
+    using std::swap;
+    swap(_path, file._path);
+    swap(_mode, file._mode);
+    swap(_data, file._data);
+    swap(_size, file._size);
+    swap(_file, file._file);
+}
+
+inline void swap(MappedFile& file1, MappedFile& file2) noexcept
+{
+    file1.swap(file2);
+}
+
+} // namespace CppCommon
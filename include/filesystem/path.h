@@ -9,12 +9,18 @@
 #ifndef CPPCOMMON_FILESYSTEM_PATH_H
 #define CPPCOMMON_FILESYSTEM_PATH_H
 
+#include "algorithms/hash.h"
 #include "common/flags.h"
 #include "string/encoding.h"
 #include "string/format.h"
+#include "string/glob_pattern.h"
 #include "time/timestamp.h"
 
+#include <cstdint>
+#include <functional>
 #include <string>
+#include <string_view>
+#include <system_error>
 
 namespace CppCommon {
 
@@ -32,18 +38,20 @@ enum class FileType
     UNKNOWN             //!< Unknown
 };
 
-//! File attributes (Windows specific)
+//! File attributes (Windows specific, except of DIRECT and WRITETHROUGH open attributes supported by all platforms)
 enum class FileAttributes
 {
-    NONE      = 0x00,   //!< None
-    NORMAL    = 0x01,   //!< Normal
-    ARCHIVED  = 0x02,   //!< Archived
-    HIDDEN    = 0x04,   //!< Hidden
-    INDEXED   = 0x08,   //!< Indexed
-    OFFLINE   = 0x10,   //!< Offline
-    READONLY  = 0x20,   //!< Readonly
-    SYSTEM    = 0x40,   //!< System
-    TEMPORARY = 0x80    //!< Temporary
+    NONE         = 0x000,   //!< None
+    NORMAL       = 0x001,   //!< Normal
+    ARCHIVED     = 0x002,   //!< Archived
+    HIDDEN       = 0x004,   //!< Hidden
+    INDEXED      = 0x008,   //!< Indexed
+    OFFLINE      = 0x010,   //!< Offline
+    READONLY     = 0x020,   //!< Readonly
+    SYSTEM       = 0x040,   //!< System
+    TEMPORARY    = 0x080,   //!< Temporary
+    DIRECT       = 0x100,   //!< Direct I/O bypassing the system page cache (open only, O_DIRECT / FILE_FLAG_NO_BUFFERING)
+    WRITETHROUGH = 0x200    //!< Write through the system cache to the disk (open only, O_DSYNC / FILE_FLAG_WRITE_THROUGH)
 };
 
 //! File permissions (Unix specific)
@@ -89,6 +97,13 @@ struct SpaceInfo
 class Path
 {
 public:
+    //! Copy progress handler
+    /*!
+        Handler is called for each copied entry with its source and destination
+        paths and the count of copied bytes (zero for directories and symlinks).
+    */
+    typedef std::function<void (const Path& src, const Path& dst, uint64_t size)> CopyHandler;
+
     //! Initialize path with an empty value
     Path() : _path() {}
     //! Initialize path with a given C-string value
@@ -101,6 +116,16 @@ public:
         \param path - Path value as string
     */
     Path(const std::string& path) : _path(path) {}
+    //! Initialize path with a given string value
+    /*!
+        \param path - Path value as moved string
+    */
+    Path(std::string&& path) noexcept : _path(std::move(path)) {}
+    //! Initialize path with a given string view value
+    /*!
+        \param path - Path value as string view
+    */
+    Path(std::string_view path) : _path(path) {}
     //! Initialize path with a given wide C-string value
     /*!
         \param path - Path value as wide C-string
@@ -125,13 +150,17 @@ public:
     Path& operator/=(const Path& path)
     { return Append(path); }
     friend Path operator/(const Path& path1, const Path& path2)
-    { return Path(path1).Append(path2); }
+    { Path result; result._path.reserve(path1._path.size() + 1 + path2._path.size()); result._path = path1._path; result.Append(path2); return result; }
+    friend Path operator/(Path&& path1, const Path& path2)
+    { path1.Append(path2); return std::move(path1); }
 
     // Concatenate the given path without a path separator
     Path& operator+=(const Path& path)
     { return Concat(path); }
     friend Path operator+(const Path& path1, const Path& path2)
-    { return Path(path1).Concat(path2); }
+    { Path result; result._path.reserve(path1._path.size() + path2._path.size()); result._path = path1._path; result.Concat(path2); return result; }
+    friend Path operator+(Path&& path1, const Path& path2)
+    { path1.Concat(path2); return std::move(path1); }
 
     // Path comparison
     friend bool operator==(const Path& path1, const Path& path2)
@@ -153,17 +182,34 @@ public:
     std::wstring wstring() const { return Encoding::FromUTF8(_path); }
 
     //! Decompose root path from the current path
-    Path root() const;
+    Path root() const { return Path(root_view()); }
     //! Decompose relative path from the current path
-    Path relative() const;
+    Path relative() const { return Path(relative_view()); }
     //! Decompose parent path from the current path
-    Path parent() const;
+    Path parent() const { return Path(parent_view()); }
     //! Decompose filename from the current path
-    Path filename() const;
+    Path filename() const { return Path(filename_view()); }
     //! Decompose stem from the current path
-    Path stem() const;
+    Path stem() const { return Path(stem_view()); }
     //! Decompose extension from the current path
-    Path extension() const;
+    Path extension() const { return Path(extension_view()); }
+
+    //! Decompose root path from the current path without allocation
+    /*!
+        Decomposition views refer to the current path value, so they are valid
+        until the path is modified or destroyed.
+    */
+    std::string_view root_view() const noexcept;
+    //! Decompose relative path from the current path without allocation
+    std::string_view relative_view() const noexcept;
+    //! Decompose parent path from the current path without allocation
+    std::string_view parent_view() const noexcept;
+    //! Decompose filename from the current path without allocation
+    std::string_view filename_view() const noexcept;
+    //! Decompose stem from the current path without allocation
+    std::string_view stem_view() const noexcept;
+    //! Decompose extension from the current path without allocation
+    std::string_view extension_view() const noexcept;
 
     //! Transform the current path to the real path on a filesystem
     Path absolute() const;
@@ -174,6 +220,15 @@ public:
 
     //! Get the path file type
     FileType type() const;
+    //! Try to get the path file type without raising a filesystem exception
+    /*!
+        Missing path is not an error and returns FileType::NONE with the cleared
+        error code, so the method is suitable for hot probing loops.
+
+        \param ec - Error code of the failed status request
+        \return Path file type (FileType::NONE on error)
+    */
+    FileType TryStatus(std::error_code& ec) const noexcept;
     //! Get the path file attributes
     Flags<FileAttributes> attributes() const;
     //! Get the path file permissions
@@ -229,9 +284,21 @@ public:
     //! Assign the given path to the current one
     Path& Assign(const Path& path);
     //! Append the given path to the current one
-    Path& Append(const Path& path);
+    Path& Append(const Path& path) { return Append(std::string_view(path._path)); }
+    //! Append the given path to the current one
+    /*!
+        Appended path is copied into the current path storage, so appending
+        to the path with enough capacity does not allocate.
+
+        \param path - Path value to append
+    */
+    Path& Append(std::string_view path);
+    Path& Append(const std::string& path) { return Append(std::string_view(path)); }
+    Path& Append(const char* path) { return Append(std::string_view(path)); }
     //! Concatenate the given path to the current one
     Path& Concat(const Path& path);
+    //! Reserve the path storage for the given count of characters
+    Path& Reserve(size_t capacity) { _path.reserve(capacity); return *this; }
     //! Convert all path separators to system ones ('\' for Windows or '/' for Unix)
     Path& MakePreferred();
     //! Replace the current path filename with a given one
@@ -271,6 +338,10 @@ public:
 
     //! Copy the given source path to destination path (file, empty directory, symlink, etc)
     /*!
+        File content is copied inside the kernel whenever it is possible: Linux
+        clones file extents with FICLONE and falls back to copy_file_range() and
+        sendfile(), Apple uses fcopyfile(), Windows uses CopyFileEx().
+
         \param src - Source path
         \param dst - Destination path
         \param overwrite - Overwrite destination path (default is false)
@@ -279,21 +350,48 @@ public:
     static Path Copy(const Path& src, const Path& dst, bool overwrite = false);
     //! Copy all matched files from the the given source path to destination path (files, directories, symlinks, etc)
     /*!
+        Pattern is matched with entries of the source directory. Matched sub
+        directories are copied with all their content.
+
         \param src - Source path
         \param dst - Destination path
         \param pattern - Regular expression pattern (default is "")
         \param overwrite - Overwrite destination path (default is false)
+        \param threads - Copy threads count (default is 1 - copy in the calling thread, 0 - CPU::LogicalCores())
+        \param progress - Copy progress handler (default is nullptr)
         \return Copied path
     */
-    static Path CopyIf(const Path& src, const Path& dst, const std::string& pattern = "", bool overwrite = false);
+    static Path CopyIf(const Path& src, const Path& dst, const std::string& pattern = "", bool overwrite = false, size_t threads = 1, const CopyHandler& progress = nullptr);
+    //! Copy all matched files from the the given source path to destination path (files, directories, symlinks, etc)
+    /*!
+        Compiled glob pattern is matched with entries of the source directory
+        without parsing the pattern for each entry. Matched sub directories are
+        copied with all their content.
+
+        \param src - Source path
+        \param dst - Destination path
+        \param pattern - Glob pattern
+        \param overwrite - Overwrite destination path (default is false)
+        \param threads - Copy threads count (default is 1 - copy in the calling thread, 0 - CPU::LogicalCores())
+        \param progress - Copy progress handler (default is nullptr)
+        \return Copied path
+    */
+    static Path CopyIf(const Path& src, const Path& dst, const GlobPattern& pattern, bool overwrite = false, size_t threads = 1, const CopyHandler& progress = nullptr);
     //! Recursively copy the given source path to destination path (files, directories, symlinks, etc)
     /*!
+        Source directory tree is traversed with DirectoryWalker and files are
+        copied by separate tasks of the thread pool, so several threads could
+        copy different files concurrently. Progress handler is called from
+        copy threads and must be thread-safe!
+
         \param src - Source path
         \param dst - Destination path
         \param overwrite - Overwrite destination path (default is false)
+        \param threads - Copy threads count (default is 1 - copy in the calling thread, 0 - CPU::LogicalCores())
+        \param progress - Copy progress handler (default is nullptr)
         \return Copied path
     */
-    static Path CopyAll(const Path& src, const Path& dst, bool overwrite = false);
+    static Path CopyAll(const Path& src, const Path& dst, bool overwrite = false, size_t threads = 1, const CopyHandler& progress = nullptr);
     //! Rename the given source path to destination path (file, empty directory, symlink, etc)
     /*!
         \param src - Source path
@@ -309,10 +407,15 @@ public:
     static Path Remove(const Path& path);
     //! Recursively remove the given path (file, empty directory, symlink, etc) from the filesystem
     /*!
+        Directory tree is traversed with DirectoryWalker, so several threads
+        could remove different sub-directories concurrently. Symbolic links
+        are removed without removing their targets.
+
         \param path - Path to remove
+        \param threads - Remove threads count (default is 1 - remove in the calling thread, 0 - CPU::LogicalCores())
         \return Parent path
     */
-    static Path RemoveAll(const Path& path);
+    static Path RemoveAll(const Path& path, size_t threads = 1);
     //! Recursively remove the given path matched to the given pattern (file, empty directory, symlink, etc) from the filesystem
     /*!
         All files/symlinks will be matched to the given pattern!
@@ -322,6 +425,15 @@ public:
         \return Parent path
     */
     static Path RemoveIf(const Path& path, const std::string& pattern = "");
+    //! Recursively remove the given path matched to the given glob pattern (file, empty directory, symlink, etc) from the filesystem
+    /*!
+        All files/symlinks will be matched to the given compiled glob pattern!
+
+        \param path - Path to remove
+        \param pattern - Glob pattern
+        \return Parent path
+    */
+    static Path RemoveIf(const Path& path, const GlobPattern& pattern);
 
     //! Set file attributes for the given path
     /*!
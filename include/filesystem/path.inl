@@ -53,3 +53,24 @@ struct fmt::formatter<CppCommon::Path> : formatter<std::string_view>
     }
 };
 #endif
+
+//! \cond DOXYGEN_SKIP
+template <>
+struct CppCommon::FastHash<CppCommon::Path>
+{
+    size_t operator()(const CppCommon::Path& value) const noexcept
+    { return (size_t)CppCommon::Hash::Calculate(value.string()); }
+};
+
+template <>
+struct std::hash<CppCommon::Path>
+{
+    typedef CppCommon::Path argument_type;
+    typedef size_t result_type;
+
+    result_type operator() (const argument_type& value) const
+    {
+        return CppCommon::FastHash<CppCommon::Path>()(value);
+    }
+};
+//! \endcond
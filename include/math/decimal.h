@@ -0,0 +1,270 @@
+/*!
+    \file decimal.h
+    \brief Fixed-point decimal definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_MATH_DECIMAL_H
+#define CPPCOMMON_MATH_DECIMAL_H
+
+#include "common/uint256.h"
+
+#include <charconv>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+
+namespace CppCommon {
+
+//! Rounding mode
+enum class RoundingMode : uint8_t
+{
+    DOWN,           //!< Round towards zero (truncate)
+    UP,             //!< Round away from zero
+    FLOOR,          //!< Round towards negative infinity
+    CEILING,        //!< Round towards positive infinity
+    HALF_UP,        //!< Round to the nearest, ties away from zero
+    HALF_EVEN       //!< Round to the nearest, ties to the even digit (banker's rounding)
+};
+
+//! Stream output: Rounding mode
+/*!
+    \param stream - Output stream
+    \param mode - Rounding mode
+    \return Output stream
+*/
+template <class TOutputStream>
+TOutputStream& operator<<(TOutputStream& stream, RoundingMode mode);
+
+//! @cond INTERNALS
+namespace Internals {
+
+template <typename T>
+struct DecimalTraits;
+
+template <>
+struct DecimalTraits<int64_t>
+{
+    typedef uint64_t unsigned_type;
+    static constexpr bool is_signed = true;
+    static constexpr size_t max_scale = 18;
+    static constexpr uint64_t max_magnitude = 0x7FFFFFFFFFFFFFFFull;
+};
+
+template <>
+struct DecimalTraits<uint64_t>
+{
+    typedef uint64_t unsigned_type;
+    static constexpr bool is_signed = false;
+    static constexpr size_t max_scale = 19;
+    static constexpr uint64_t max_magnitude = 0xFFFFFFFFFFFFFFFFull;
+};
+
+template <>
+struct DecimalTraits<uint128_t>
+{
+    typedef uint128_t unsigned_type;
+    static constexpr bool is_signed = false;
+    static constexpr size_t max_scale = 38;
+    static constexpr uint128_t max_magnitude = uint128_t(0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull);
+};
+
+} // namespace Internals
+//! @endcond
+
+//! Fixed-point decimal
+/*!
+    Fixed-point decimal stores the value multiplied by 10^Scale in the integer
+    of the given type: int64_t (default), uint64_t or uint128_t. For example,
+    Decimal<8> stores price 1.0825 as the raw value 108250000.
+
+    Addition, subtraction and comparison are plain integer operations.
+    Multiplication and division calculate the exact 128-bit (or 256-bit for
+    uint128_t values) intermediate product and round it once with the given
+    rounding mode, so no precision is lost in (price * quantity) expressions.
+    Division by the constant scale factor is compiled into the multiplication
+    and the 128-bit by 64-bit division instruction is used when the product
+    does not fit into 64 bits.
+
+    Text conversion with to_chars() and from_chars() does not allocate memory
+    and does not depend on the current locale. Extra fraction digits of the
+    parsed value are rounded with the given rounding mode.
+
+    Integer overflow of the raw value is not checked except for the parsing.
+
+    Not thread-safe.
+
+    \tparam Scale - Count of decimal fraction digits
+    \tparam T - Raw value type: int64_t, uint64_t or uint128_t (default is int64_t)
+*/
+template <size_t Scale, typename T = int64_t>
+class Decimal
+{
+    typedef Internals::DecimalTraits<T> traits;
+    typedef typename traits::unsigned_type U;
+
+    static_assert(Scale <= traits::max_scale, "Decimal scale is too big for the raw value type!");
+
+public:
+    //! Raw value type
+    typedef T value_type;
+
+    //! Count of decimal fraction digits
+    static constexpr size_t scale = Scale;
+    //! Scale factor (10^Scale)
+    static constexpr U factor = []() { U result = 1; for (size_t i = 0; i < Scale; ++i) result *= 10; return result; }();
+    //! Default rounding mode
+    static constexpr RoundingMode DEFAULT_ROUNDING = RoundingMode::HALF_EVEN;
+    //! Maximal size of the decimal string representation
+    static constexpr size_t MAX_SIZE = traits::max_scale + Scale + 3;
+
+    constexpr Decimal() noexcept : _value(0) {}
+    //! Initialize decimal with the given integer value
+    /*!
+        \param value - Integer value
+    */
+    template <typename TInteger, typename = std::enable_if_t<std::is_integral_v<TInteger> || std::is_same_v<TInteger, T>>>
+    constexpr explicit Decimal(TInteger value) noexcept : _value((T)((T)value * (T)factor)) {}
+    Decimal(const Decimal&) noexcept = default;
+    Decimal(Decimal&&) noexcept = default;
+    ~Decimal() noexcept = default;
+
+    Decimal& operator=(const Decimal&) noexcept = default;
+    Decimal& operator=(Decimal&&) noexcept = default;
+
+    //! Create decimal from the given raw value (value multiplied by 10^Scale)
+    static constexpr Decimal FromRaw(T raw) noexcept { Decimal result; result._value = raw; return result; }
+    //! Create decimal from the given double value
+    /*!
+        \param value - Double value
+        \param mode - Rounding mode (default is RoundingMode::HALF_EVEN)
+        \return Decimal value
+    */
+    static Decimal FromDouble(double value, RoundingMode mode = DEFAULT_ROUNDING) noexcept;
+
+    //! Get the raw value (value multiplied by 10^Scale)
+    constexpr T raw() const noexcept { return _value; }
+    //! Get the double value
+    double ToDouble() const noexcept;
+
+    //! Is the decimal value negative?
+    constexpr bool negative() const noexcept { if constexpr (traits::is_signed) return (_value < 0); else return false; }
+    //! Get the integral part of the decimal magnitude
+    constexpr U integral() const noexcept { return magnitude() / factor; }
+    //! Get the fraction part of the decimal magnitude multiplied by 10^Scale
+    constexpr U fraction() const noexcept { return magnitude() % factor; }
+
+    // Arithmetic operators
+    constexpr Decimal operator+() const noexcept { return *this; }
+    constexpr Decimal operator-() const noexcept { return FromRaw((T)((T)0 - _value)); }
+
+    constexpr Decimal& operator+=(const Decimal& value) noexcept { _value = (T)(_value + value._value); return *this; }
+    constexpr Decimal& operator-=(const Decimal& value) noexcept { _value = (T)(_value - value._value); return *this; }
+    constexpr Decimal& operator*=(const Decimal& value) noexcept { return *this = Multiply(*this, value); }
+    constexpr Decimal& operator/=(const Decimal& value) { return *this = Divide(*this, value); }
+
+    friend constexpr Decimal operator+(const Decimal& value1, const Decimal& value2) noexcept { return FromRaw((T)(value1._value + value2._value)); }
+    friend constexpr Decimal operator-(const Decimal& value1, const Decimal& value2) noexcept { return FromRaw((T)(value1._value - value2._value)); }
+    friend constexpr Decimal operator*(const Decimal& value1, const Decimal& value2) noexcept { return Multiply(value1, value2); }
+    friend constexpr Decimal operator/(const Decimal& value1, const Decimal& value2) { return Divide(value1, value2); }
+
+    // Comparison operators
+    friend constexpr bool operator==(const Decimal& value1, const Decimal& value2) noexcept { return value1._value == value2._value; }
+    friend constexpr bool operator!=(const Decimal& value1, const Decimal& value2) noexcept { return value1._value != value2._value; }
+    friend constexpr bool operator<(const Decimal& value1, const Decimal& value2) noexcept { return value1._value < value2._value; }
+    friend constexpr bool operator>(const Decimal& value1, const Decimal& value2) noexcept { return value1._value > value2._value; }
+    friend constexpr bool operator<=(const Decimal& value1, const Decimal& value2) noexcept { return value1._value <= value2._value; }
+    friend constexpr bool operator>=(const Decimal& value1, const Decimal& value2) noexcept { return value1._value >= value2._value; }
+
+    //! Multiply two decimal values with the given rounding mode
+    static constexpr Decimal Multiply(const Decimal& value1, const Decimal& value2, RoundingMode mode = DEFAULT_ROUNDING) noexcept;
+    //! Divide two decimal values with the given rounding mode
+    /*!
+        Throws std::domain_error on division by zero.
+    */
+    static constexpr Decimal Divide(const Decimal& value1, const Decimal& value2, RoundingMode mode = DEFAULT_ROUNDING);
+
+    //! Calculate (value * multiplier / divider) with the single rounding of the exact result
+    /*!
+        Throws std::domain_error on division by zero.
+
+        \param value - Value
+        \param multiplier - Multiplier
+        \param divider - Divider
+        \param mode - Rounding mode (default is RoundingMode::HALF_EVEN)
+        \return Calculated value of (value * multiplier / divider) expression
+    */
+    static constexpr Decimal MulDiv(const Decimal& value, const Decimal& multiplier, const Decimal& divider, RoundingMode mode = DEFAULT_ROUNDING);
+
+    //! Round the decimal value to the given count of fraction digits
+    /*!
+        \param digits - Count of fraction digits (must not be greater than Scale)
+        \param mode - Rounding mode (default is RoundingMode::HALF_EVEN)
+        \return Rounded decimal value
+    */
+    constexpr Decimal Round(size_t digits, RoundingMode mode = DEFAULT_ROUNDING) const noexcept;
+
+    //! Convert the decimal value to the other scale
+    /*!
+        \param mode - Rounding mode used when the scale is decreased (default is RoundingMode::HALF_EVEN)
+        \return Decimal value with the new scale
+    */
+    template <size_t NewScale>
+    constexpr Decimal<NewScale, T> Rescale(RoundingMode mode = DEFAULT_ROUNDING) const noexcept;
+
+    //! Convert the decimal value into the given characters buffer
+    /*!
+        Trailing zeros of the fraction part are not written.
+
+        \param first - Buffer first character
+        \param last - Buffer last character
+        \return Conversion result (errc::value_too_large if the buffer is too small)
+    */
+    std::to_chars_result to_chars(char* first, char* last) const noexcept;
+
+    //! Parse the decimal value from the given characters range
+    /*!
+        Accepted format is "[-]digits[.digits]" or "[-].digits". Negative values
+        are accepted only for the signed raw value type. Parsing stops at the
+        first character that does not match the format.
+
+        \param first - Range first character
+        \param last - Range last character
+        \param value - Parsed decimal value (not changed on failure)
+        \param mode - Rounding mode of extra fraction digits (default is RoundingMode::HALF_EVEN)
+        \return Parsing result (errc::invalid_argument for no digits, errc::result_out_of_range for the value overflow)
+    */
+    static std::from_chars_result from_chars(const char* first, const char* last, Decimal& value, RoundingMode mode = DEFAULT_ROUNDING) noexcept;
+
+    //! Get string from the current decimal value
+    std::string string() const;
+
+    //! Output instance into the given output stream
+    friend std::ostream& operator<<(std::ostream& os, const Decimal& value)
+    { char buffer[MAX_SIZE]; auto result = value.to_chars(buffer, buffer + sizeof(buffer)); os.write(buffer, result.ptr - buffer); return os; }
+
+    //! Swap two instances
+    void swap(Decimal& value) noexcept { using std::swap; swap(_value, value._value); }
+    friend void swap(Decimal& value1, Decimal& value2) noexcept { value1.swap(value2); }
+
+private:
+    T _value;
+
+    constexpr U magnitude() const noexcept { return negative() ? (U)((U)0 - (U)_value) : (U)_value; }
+    static constexpr T FromMagnitude(U magnitude, bool negative) noexcept { return negative ? (T)((U)0 - magnitude) : (T)magnitude; }
+};
+
+/*! \example math_decimal.cpp Fixed-point decimal example */
+
+} // namespace CppCommon
+
+#include "decimal.inl"
+
+#endif // CPPCOMMON_MATH_DECIMAL_H
@@ -0,0 +1,422 @@
+/*!
+    \file decimal.inl
+    \brief Fixed-point decimal inline implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+template <class TOutputStream>
+inline TOutputStream& operator<<(TOutputStream& stream, RoundingMode mode)
+{
+    switch (mode)
+    {
+        case RoundingMode::DOWN:
+            stream << "DOWN";
+            break;
+        case RoundingMode::UP:
+            stream << "UP";
+            break;
+        case RoundingMode::FLOOR:
+            stream << "FLOOR";
+            break;
+        case RoundingMode::CEILING:
+            stream << "CEILING";
+            break;
+        case RoundingMode::HALF_UP:
+            stream << "HALF_UP";
+            break;
+        case RoundingMode::HALF_EVEN:
+            stream << "HALF_EVEN";
+            break;
+        default:
+            stream << "<unknown>";
+            break;
+    }
+    return stream;
+}
+
+//! @cond INTERNALS
+namespace Internals {
+
+template <typename U>
+constexpr U DecimalPow10(size_t digits) noexcept
+{
+    U result = 1;
+    for (size_t i = 0; i < digits; ++i)
+        result *= 10;
+    return result;
+}
+
+// Should the magnitude of the truncated quotient be increased by one?
+template <typename U>
+constexpr bool DecimalRoundAway(const U& quotient, const U& remainder, const U& divider, bool negative, RoundingMode mode) noexcept
+{
+    if (remainder == 0)
+        return false;
+
+    switch (mode)
+    {
+        case RoundingMode::DOWN:
+            return false;
+        case RoundingMode::UP:
+            return true;
+        case RoundingMode::FLOOR:
+            return negative;
+        case RoundingMode::CEILING:
+            return !negative;
+        case RoundingMode::HALF_UP:
+            return (remainder >= (divider - remainder));
+        case RoundingMode::HALF_EVEN:
+        {
+            U rest = divider - remainder;
+            return ((remainder > rest) || ((remainder == rest) && ((quotient & 1) != 0)));
+        }
+        default:
+            return false;
+    }
+}
+
+// Calculate the rounded magnitude of (value * multiplier / divider) expression
+template <typename U>
+constexpr U DecimalMulDiv(const U& value, const U& multiplier, const U& divider, bool negative, RoundingMode mode) noexcept
+{
+    U quotient = 0;
+    U remainder = 0;
+
+    if constexpr (std::is_same_v<U, uint64_t>)
+    {
+        uint64_t upper = 0;
+        uint64_t lower = Multiply64(value, multiplier, upper);
+        if (upper == 0)
+        {
+            // Division by the constant divider is compiled into the multiplication
+            quotient = lower / divider;
+            remainder = lower % divider;
+        }
+        else if (upper < divider)
+            quotient = Divide128(upper, lower, divider, remainder);
+        else
+        {
+            // Overflowed quotient is truncated to 64 bits
+            auto result = uint128_t::divmod(uint128_t(upper, lower), divider);
+            quotient = result.first.lower();
+            remainder = result.second.lower();
+        }
+    }
+    else
+    {
+        auto result = uint256_t::divmod(uint256_t(value) * uint256_t(multiplier), uint256_t(divider));
+        quotient = result.first.lower();
+        remainder = result.second.lower();
+    }
+
+    return DecimalRoundAway(quotient, remainder, divider, negative, mode) ? (U)(quotient + 1) : quotient;
+}
+
+// Write decimal digits of the given value backwards, returns the first written character
+template <typename U>
+inline char* DecimalDigits(char* last, U value, size_t digits) noexcept
+{
+    for (size_t i = 0; i < digits; ++i)
+    {
+        *--last = (char)('0' + (uint8_t)(value % 10));
+        value /= 10;
+    }
+    return last;
+}
+
+template <typename U>
+inline char* DecimalDigits(char* last, U value) noexcept
+{
+    do
+    {
+        *--last = (char)('0' + (uint8_t)(value % 10));
+        value /= 10;
+    } while (value != 0);
+    return last;
+}
+
+template <typename U>
+inline double DecimalToDouble(const U& value) noexcept
+{
+    if constexpr (std::is_same_v<U, uint64_t>)
+        return (double)value;
+    else
+        return std::ldexp((double)value.upper(), 64) + (double)value.lower();
+}
+
+template <typename U>
+inline U DecimalFromDouble(double value) noexcept
+{
+    if constexpr (std::is_same_v<U, uint64_t>)
+        return (value < 18446744073709551616.0) ? (uint64_t)value : 0xFFFFFFFFFFFFFFFFull;
+    else
+    {
+        double upper = std::floor(std::ldexp(value, -64));
+        if (upper >= 18446744073709551616.0)
+            return uint128_t(0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull);
+        return uint128_t((uint64_t)upper, (uint64_t)(value - std::ldexp(upper, 64)));
+    }
+}
+
+} // namespace Internals
+//! @endcond
+
+template <size_t Scale, typename T>
+inline Decimal<Scale, T> Decimal<Scale, T>::FromDouble(double value, RoundingMode mode) noexcept
+{
+    bool negative = traits::is_signed && (value < 0);
+    double scaled = std::fabs(value) * (double)factor;
+
+    switch (mode)
+    {
+        case RoundingMode::DOWN:
+            scaled = std::trunc(scaled);
+            break;
+        case RoundingMode::UP:
+            scaled = std::ceil(scaled);
+            break;
+        case RoundingMode::FLOOR:
+            scaled = negative ? std::ceil(scaled) : std::floor(scaled);
+            break;
+        case RoundingMode::CEILING:
+            scaled = negative ? std::floor(scaled) : std::ceil(scaled);
+            break;
+        case RoundingMode::HALF_UP:
+            scaled = std::round(scaled);
+            break;
+        case RoundingMode::HALF_EVEN:
+        {
+            double floor = std::floor(scaled);
+            double rest = scaled - floor;
+            scaled = ((rest > 0.5) || ((rest == 0.5) && (std::fmod(floor, 2.0) != 0))) ? (floor + 1) : floor;
+            break;
+        }
+        default:
+            break;
+    }
+
+    if (!traits::is_signed && (value < 0))
+        scaled = 0;
+
+    U magnitude = Internals::DecimalFromDouble<U>(scaled);
+    if (magnitude > traits::max_magnitude)
+        magnitude = traits::max_magnitude;
+    return FromRaw(FromMagnitude(magnitude, negative));
+}
+
+template <size_t Scale, typename T>
+inline double Decimal<Scale, T>::ToDouble() const noexcept
+{
+    // Integral and fraction parts are converted separately to keep the precision of big values
+    double result = Internals::DecimalToDouble(integral()) + Internals::DecimalToDouble(fraction()) / Internals::DecimalToDouble(factor);
+    return negative() ? -result : result;
+}
+
+template <size_t Scale, typename T>
+constexpr Decimal<Scale, T> Decimal<Scale, T>::Multiply(const Decimal& value1, const Decimal& value2, RoundingMode mode) noexcept
+{
+    bool negative = (value1.negative() != value2.negative());
+    return FromRaw(FromMagnitude(Internals::DecimalMulDiv<U>(value1.magnitude(), value2.magnitude(), factor, negative, mode), negative));
+}
+
+template <size_t Scale, typename T>
+constexpr Decimal<Scale, T> Decimal<Scale, T>::Divide(const Decimal& value1, const Decimal& value2, RoundingMode mode)
+{
+    if (value2._value == 0)
+        throw std::domain_error("Division by 0");
+
+    bool negative = (value1.negative() != value2.negative());
+    return FromRaw(FromMagnitude(Internals::DecimalMulDiv<U>(value1.magnitude(), factor, value2.magnitude(), negative, mode), negative));
+}
+
+template <size_t Scale, typename T>
+constexpr Decimal<Scale, T> Decimal<Scale, T>::MulDiv(const Decimal& value, const Decimal& multiplier, const Decimal& divider, RoundingMode mode)
+{
+    if (divider._value == 0)
+        throw std::domain_error("Division by 0");
+
+    bool negative = ((value.negative() != multiplier.negative()) != divider.negative());
+    return FromRaw(FromMagnitude(Internals::DecimalMulDiv<U>(value.magnitude(), multiplier.magnitude(), divider.magnitude(), negative, mode), negative));
+}
+
+template <size_t Scale, typename T>
+constexpr Decimal<Scale, T> Decimal<Scale, T>::Round(size_t digits, RoundingMode mode) const noexcept
+{
+    if (digits >= Scale)
+        return *this;
+
+    const U divider = Internals::DecimalPow10<U>(Scale - digits);
+    const U value = magnitude();
+    const U quotient = value / divider;
+    const U remainder = value % divider;
+    const U result = (Internals::DecimalRoundAway(quotient, remainder, divider, negative(), mode) ? (U)(quotient + 1) : quotient) * divider;
+    return FromRaw(FromMagnitude(result, negative()));
+}
+
+template <size_t Scale, typename T>
+template <size_t NewScale>
+constexpr Decimal<NewScale, T> Decimal<Scale, T>::Rescale(RoundingMode mode) const noexcept
+{
+    const U value = magnitude();
+    U result = value;
+
+    if constexpr (NewScale > Scale)
+        result = value * Internals::DecimalPow10<U>(NewScale - Scale);
+    else if constexpr (NewScale < Scale)
+    {
+        constexpr U divider = Internals::DecimalPow10<U>(Scale - NewScale);
+        const U quotient = value / divider;
+        const U remainder = value % divider;
+        result = Internals::DecimalRoundAway(quotient, remainder, divider, negative(), mode) ? (U)(quotient + 1) : quotient;
+    }
+
+    return Decimal<NewScale, T>::FromRaw(FromMagnitude(result, negative()));
+}
+
+template <size_t Scale, typename T>
+inline std::to_chars_result Decimal<Scale, T>::to_chars(char* first, char* last) const noexcept
+{
+    // Format the value backwards into the local buffer
+    char buffer[MAX_SIZE];
+    char* end = buffer + sizeof(buffer);
+    char* start = end;
+
+    const U value = magnitude();
+    U fraction = value % factor;
+    if (fraction != 0)
+    {
+        // Skip trailing zeros of the fraction part
+        size_t digits = Scale;
+        while ((fraction % 10) == 0)
+        {
+            fraction /= 10;
+            --digits;
+        }
+        start = Internals::DecimalDigits(start, fraction, digits);
+        *--start = '.';
+    }
+    start = Internals::DecimalDigits(start, (U)(value / factor));
+    if (negative())
+        *--start = '-';
+
+    size_t size = (size_t)(end - start);
+    if ((size_t)(last - first) < size)
+        return { last, std::errc::value_too_large };
+
+    std::memcpy(first, start, size);
+    return { first + size, std::errc() };
+}
+
+template <size_t Scale, typename T>
+inline std::from_chars_result Decimal<Scale, T>::from_chars(const char* first, const char* last, Decimal& value, RoundingMode mode) noexcept
+{
+    const char* ptr = first;
+
+    bool negative = false;
+    if (traits::is_signed && (ptr != last) && (*ptr == '-'))
+    {
+        negative = true;
+        ++ptr;
+    }
+
+    const U limit = (U)(traits::max_magnitude + (negative ? 1 : 0));
+    bool overflow = false;
+    size_t digits = 0;
+
+    // Parse the integral part
+    U integral = 0;
+    for (; (ptr != last) && (*ptr >= '0') && (*ptr <= '9'); ++ptr, ++digits)
+    {
+        uint8_t digit = (uint8_t)(*ptr - '0');
+        if (integral > ((limit - digit) / 10))
+            overflow = true;
+        else
+            integral = integral * 10 + digit;
+    }
+
+    // Parse the fraction part, extra digits are kept as the rounding remainder (first digit * 2 + sticky bit) of 20
+    U fraction = 0;
+    size_t fraction_digits = 0;
+    U remainder = 0;
+    if ((ptr != last) && (*ptr == '.') && ((digits > 0) || (((ptr + 1) != last) && (ptr[1] >= '0') && (ptr[1] <= '9'))))
+    {
+        for (++ptr; (ptr != last) && (*ptr >= '0') && (*ptr <= '9'); ++ptr, ++digits)
+        {
+            uint8_t digit = (uint8_t)(*ptr - '0');
+            if (fraction_digits < Scale)
+            {
+                fraction = fraction * 10 + digit;
+                ++fraction_digits;
+            }
+            else if (fraction_digits++ == Scale)
+                remainder = digit * 2;
+            else if (digit != 0)
+                remainder |= 1;
+        }
+    }
+
+    if (digits == 0)
+        return { first, std::errc::invalid_argument };
+    if (overflow || (integral > (limit / factor)))
+        return { ptr, std::errc::result_out_of_range };
+
+    if (fraction_digits < Scale)
+        fraction *= Internals::DecimalPow10<U>(Scale - fraction_digits);
+
+    U magnitude = integral * factor;
+    if (magnitude > (limit - fraction))
+        return { ptr, std::errc::result_out_of_range };
+    magnitude += fraction;
+
+    if (Internals::DecimalRoundAway<U>(magnitude, remainder, 20, negative, mode))
+    {
+        if (magnitude == limit)
+            return { ptr, std::errc::result_out_of_range };
+        ++magnitude;
+    }
+
+    value = FromRaw(FromMagnitude(magnitude, negative));
+    return { ptr, std::errc() };
+}
+
+template <size_t Scale, typename T>
+inline std::string Decimal<Scale, T>::string() const
+{
+    char buffer[MAX_SIZE];
+    auto result = to_chars(buffer, buffer + sizeof(buffer));
+    return std::string(buffer, result.ptr);
+}
+
+} // namespace CppCommon
+
+#if defined(FMT_VERSION)
+template <size_t Scale, typename T>
+struct fmt::formatter<CppCommon::Decimal<Scale, T>> : formatter<std::string_view>
+{
+    template <typename FormatContext>
+    auto format(const CppCommon::Decimal<Scale, T>& value, FormatContext& ctx) const
+    {
+        char buffer[CppCommon::Decimal<Scale, T>::MAX_SIZE];
+        auto result = value.to_chars(buffer, buffer + sizeof(buffer));
+        return formatter<string_view>::format(std::string_view(buffer, result.ptr - buffer), ctx);
+    }
+};
+#endif
+
+//! \cond DOXYGEN_SKIP
+template <size_t Scale, typename T>
+struct std::hash<CppCommon::Decimal<Scale, T>>
+{
+    typedef CppCommon::Decimal<Scale, T> argument_type;
+    typedef size_t result_type;
+
+    result_type operator() (const argument_type& value) const
+    {
+        return std::hash<T>()(value.raw());
+    }
+};
+//! \endcond
@@ -9,13 +9,40 @@
 #ifndef CPPCOMMON_MATH_MATH_H
 #define CPPCOMMON_MATH_MATH_H
 
+#include <cstddef>
 #include <cstdint>
+#include <span>
+#include <utility>
 
 namespace CppCommon {
 
+//! Floating point accumulation methods of Math numeric kernels
+enum class MathAccumulation
+{
+    FAST,           //!< Vectorized accumulation in several lanes (two passes for the variance)
+    KAHAN,          //!< Vectorized Kahan compensated accumulation (two passes for the variance)
+    WELFORD         //!< Single pass Welford online accumulation (the same as KAHAN for sums)
+};
+
+//! Mean and variance of values
+struct MathMoments
+{
+    size_t count{0};        //!< Count of values
+    double mean{0.0};       //!< Mean
+    double variance{0.0};   //!< Population variance (sum of squared deviations divided by the count)
+
+    //! Get the sample variance (sum of squared deviations divided by the count minus one)
+    double sample_variance() const noexcept { return (count > 1) ? (variance * count / (count - 1)) : 0.0; }
+};
+
 //! Math static class
 /*!
-    Contains useful math functions.
+    Contains useful math functions and numeric kernels over arrays of values.
+
+    Numeric kernels are vectorized with AVX2 and selected at runtime for the
+    current CPU. Floating point kernels accumulate values in eight  lanes  in
+    the fixed order, so vectorized and scalar implementations add values  in
+    the same order. Integer kernels wrap around on overflow.
 
     Thread-safe.
 */
@@ -56,6 +83,90 @@ public:
         \return Calculated value of (operant * multiplier / divider) expression
     */
     static uint64_t MulDiv64(uint64_t operant, uint64_t multiplier, uint64_t divider);
+
+    //! Calculate the sum of values
+    /*!
+        \param values - Values
+        \return Sum of values
+    */
+    static int64_t Sum(std::span<const int64_t> values) noexcept;
+    //! Calculate the sum of values
+    /*!
+        \param values - Values
+        \param accumulation - Accumulation method (default is MathAccumulation::FAST)
+        \return Sum of values
+    */
+    static double Sum(std::span<const double> values, MathAccumulation accumulation = MathAccumulation::FAST) noexcept;
+
+    //! Find minimal and maximal values
+    /*!
+        \param values - Values
+        \return Pair of minimal and maximal values (numeric limits max() and lowest() for empty values)
+    */
+    static std::pair<int64_t, int64_t> MinMax(std::span<const int64_t> values) noexcept;
+    //! Find minimal and maximal values
+    /*!
+        Result is unspecified if values contain NaN.
+
+        \param values - Values
+        \return Pair of minimal and maximal values (numeric limits max() and lowest() for empty values)
+    */
+    static std::pair<double, double> MinMax(std::span<const double> values) noexcept;
+
+    //! Calculate the mean and the variance of values
+    /*!
+        Integer values are summed exactly for the mean, the accumulation method
+        is used for squared deviations.
+
+        \param values - Values
+        \param accumulation - Accumulation method (default is MathAccumulation::FAST)
+        \return Mean and variance of values
+    */
+    static MathMoments MeanVariance(std::span<const int64_t> values, MathAccumulation accumulation = MathAccumulation::FAST) noexcept;
+    //! Calculate the mean and the variance of values
+    /*!
+        \param values - Values
+        \param accumulation - Accumulation method (default is MathAccumulation::FAST)
+        \return Mean and variance of values
+    */
+    static MathMoments MeanVariance(std::span<const double> values, MathAccumulation accumulation = MathAccumulation::FAST) noexcept;
+
+    //! Calculate the dot product of two vectors
+    /*!
+        Vectors must have the same size, otherwise the shortest size is used.
+
+        \param a - Vector a
+        \param b - Vector b
+        \return Dot product of vectors
+    */
+    static int64_t Dot(std::span<const int64_t> a, std::span<const int64_t> b) noexcept;
+    //! Calculate the dot product of two vectors
+    /*!
+        Vectors must have the same size, otherwise the shortest size is used.
+
+        \param a - Vector a
+        \param b - Vector b
+        \return Dot product of vectors
+    */
+    static double Dot(std::span<const double> a, std::span<const double> b) noexcept;
+
+    //! Calculate the weighted average of values (e.g. VWAP of prices weighted by volumes)
+    /*!
+        Products and weights are accumulated exactly in 64-bit integers, so they
+        must not overflow.
+
+        \param values - Values
+        \param weights - Weights of values (must have the same size as values)
+        \return Weighted average of values (0 if the sum of weights is 0)
+    */
+    static double WeightedAverage(std::span<const int64_t> values, std::span<const int64_t> weights) noexcept;
+    //! Calculate the weighted average of values (e.g. VWAP of prices weighted by volumes)
+    /*!
+        \param values - Values
+        \param weights - Weights of values (must have the same size as values)
+        \return Weighted average of values (0 if the sum of weights is 0)
+    */
+    static double WeightedAverage(std::span<const double> values, std::span<const double> weights) noexcept;
 };
 
 /*! \example math_math.cpp Math example */
@@ -11,6 +11,10 @@
 
 #include "memory.h"
 
+#include <cstddef>
+#include <memory_resource>
+#include <type_traits>
+
 namespace CppCommon {
 
 //! Memory allocator class
@@ -176,6 +180,71 @@ private:
     TMemoryManager _manager;
 };
 
+//! Memory resource class
+/*!
+    Memory resource implements polymorphic std::pmr::memory_resource interface
+    and wraps the memory manager provided as a template argument,  so  std::pmr
+    containers could allocate their storage from CppCommon memory managers.
+
+    Memory resources are equal only if they are the same object, so std::pmr
+    containers never exchange storage allocated from different managers.
+
+    Some memory managers (DefaultMemoryManager, HeapMemoryManager) ignore the
+    requested alignment, so over-aligned blocks (stricter than the alignment
+    of std::max_align_t) are placed within a bigger block which keeps a pointer
+    to its origin right before the aligned block.
+
+    Thread-safety is the same as of the wrapped memory manager.
+*/
+template <class TMemoryManager>
+class MemoryResource : public std::pmr::memory_resource
+{
+public:
+    //! Initialize memory resource with a given memory manager
+    /*!
+        \param manager - Memory manager
+    */
+    explicit MemoryResource(TMemoryManager& manager) noexcept : _manager(manager) {}
+    MemoryResource(const MemoryResource&) = delete;
+    MemoryResource(MemoryResource&&) = delete;
+    ~MemoryResource() noexcept override = default;
+
+    MemoryResource& operator=(const MemoryResource&) = delete;
+    MemoryResource& operator=(MemoryResource&&) = delete;
+
+    //! Memory manager
+    TMemoryManager& manager() noexcept { return _manager; }
+
+protected:
+    //! Allocate a memory block of the given size and alignment
+    /*!
+        \param bytes - Block size
+        \param alignment - Block alignment
+        \return A pointer to the allocated memory block
+        \throw std::bad_alloc in case of allocation failed
+    */
+    void* do_allocate(size_t bytes, size_t alignment) override;
+    //! Free the previously allocated memory block
+    /*!
+        \param ptr - Pointer to the memory block
+        \param bytes - Block size
+        \param alignment - Block alignment
+    */
+    void do_deallocate(void* ptr, size_t bytes, size_t alignment) override;
+    //! Compare the memory resource with another one
+    /*!
+        \param other - Another memory resource
+        \return 'true' if the given memory resource is the same object, 'false' otherwise
+    */
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return (this == &other); }
+
+private:
+    TMemoryManager& _manager;
+
+    //! Is the given alignment stricter than the fundamental one?
+    static bool IsOverAligned(size_t alignment) noexcept { return alignment > alignof(std::max_align_t); }
+};
+
 //! Default memory manager class
 /*!
     Default memory manager uses malloc() and free() system functions
@@ -229,6 +298,9 @@ private:
 template <typename T, bool nothrow = false>
 using DefaultAllocator = Allocator<T, DefaultMemoryManager, nothrow>;
 
+//! Default memory resource class
+using DefaultMemoryResource = MemoryResource<DefaultMemoryManager>;
+
 } // namespace CppCommon
 
 #include "allocator.inl"
@@ -62,9 +62,10 @@ inline void Allocator<T, TMemoryManager, nothrow>::destroy(U* ptr)
 {
     assert((ptr != nullptr) && "Destroyed element must be valid!");
 
-    // Destroy the element
-    if (ptr != nullptr)
-        ptr->~U();
+    // Destroy the element (trivially destructible elements are skipped, so containers release them in O(1))
+    if constexpr (!std::is_trivially_destructible<U>::value)
+        if (ptr != nullptr)
+            ptr->~U();
 }
 
 template <typename T, class TMemoryManager, bool nothrow>
@@ -145,6 +146,50 @@ inline void Allocator<T, TMemoryManager, nothrow>::ReleaseArray(T* ptr)
     }
 }
 
+template <class TMemoryManager>
+inline void* MemoryResource<TMemoryManager>::do_allocate(size_t bytes, size_t alignment)
+{
+    // Memory managers do not allocate empty blocks
+    bytes = (bytes > 0) ? bytes : 1;
+
+    if (!IsOverAligned(alignment))
+    {
+        void* result = _manager.malloc(bytes, alignment);
+        if (result != nullptr)
+            return result;
+    }
+    else
+    {
+        // Place the over-aligned block within a bigger block with its origin pointer ahead
+        uint8_t* origin = (uint8_t*)_manager.malloc(bytes + alignment + sizeof(void*), alignof(std::max_align_t));
+        if (origin != nullptr)
+        {
+            uint8_t* result = Memory::Align(origin + sizeof(void*), alignment);
+            std::memcpy(result - sizeof(void*), &origin, sizeof(void*));
+            return result;
+        }
+    }
+
+    // Not enough memory...
+    throw std::bad_alloc();
+}
+
+template <class TMemoryManager>
+inline void MemoryResource<TMemoryManager>::do_deallocate(void* ptr, size_t bytes, size_t alignment)
+{
+    bytes = (bytes > 0) ? bytes : 1;
+
+    if (!IsOverAligned(alignment))
+        _manager.free(ptr, bytes);
+    else
+    {
+        // Free the bigger block by its origin pointer
+        uint8_t* origin;
+        std::memcpy(&origin, (uint8_t*)ptr - sizeof(void*), sizeof(void*));
+        _manager.free(origin, bytes + alignment + sizeof(void*));
+    }
+}
+
 inline void* DefaultMemoryManager::malloc(size_t size, size_t alignment)
 {
     assert((size > 0) && "Allocated block size must be greater than zero!");
@@ -29,6 +29,21 @@ template <class TAuxMemoryManager = DefaultMemoryManager>
 class ArenaMemoryManager
 {
 public:
+    //! Arena checkpoint
+    /*!
+        Arena checkpoint is a mark of the arena allocation state,  which  could
+        be used to rewind all allocations made after it at once.
+    */
+    struct Checkpoint
+    {
+        const void* page;
+        size_t size;
+        size_t allocated;
+        size_t allocations;
+
+        Checkpoint() noexcept : page(nullptr), size(0), allocated(0), allocations(0) {}
+    };
+
     //! Initialize arena memory manager with an auxiliary memory manager
     /*!
         Arena page capacity will be 65536.
@@ -88,7 +103,34 @@ public:
     */
     void free(void* ptr, size_t size);
 
+    //! Mark the current arena allocation state
+    /*!
+        \return Arena checkpoint
+    */
+    Checkpoint checkpoint() const noexcept;
+    //! Rewind the arena allocation state to the given checkpoint
+    /*!
+        All memory blocks allocated after the checkpoint are released  at  once
+        and must not be used or freed after rewind. Arena pages allocated after
+        the checkpoint are returned to the auxiliary memory manager. Nested
+        checkpoints must be rewound in the reverse order (inner first). Memory
+        blocks allocated before the checkpoint must not be freed until rewind.
+
+        With an external buffer only the buffer is rewound, blocks allocated
+        from the auxiliary memory manager after the buffer is exhausted must be
+        freed by their owners.
+
+        \param checkpoint - Arena checkpoint
+    */
+    void rewind(const Checkpoint& checkpoint);
+
     //! Reset the memory manager
+    /*!
+        All arena pages are merged into a single one which fits the whole reserved
+        size. Once the arena is warmed up, the single page is reused without any
+        auxiliary allocations, so the per-request reset releases all  memory  at
+        once in O(1).
+    */
     void reset();
     //! Reset the memory manager with a given page capacity
     /*!
@@ -138,10 +180,51 @@ private:
     void ClearArena();
 };
 
+//! Arena scope class
+/*!
+    Arena scope marks the arena allocation state on construction and rewinds
+    the arena to it on destruction, so all temporary memory blocks allocated
+    inside the scope are released at once. Arena scopes could be nested.
+
+    Not thread-safe.
+*/
+template <class TAuxMemoryManager = DefaultMemoryManager>
+class ArenaScope
+{
+public:
+    //! Initialize arena scope with a given arena memory manager
+    /*!
+        \param manager - Arena memory manager
+    */
+    explicit ArenaScope(ArenaMemoryManager<TAuxMemoryManager>& manager) noexcept : _manager(manager), _checkpoint(manager.checkpoint()) {}
+    ArenaScope(const ArenaScope&) = delete;
+    ArenaScope(ArenaScope&&) = delete;
+    ~ArenaScope() { _manager.rewind(_checkpoint); }
+
+    ArenaScope& operator=(const ArenaScope&) = delete;
+    ArenaScope& operator=(ArenaScope&&) = delete;
+
+    //! Arena memory manager
+    ArenaMemoryManager<TAuxMemoryManager>& manager() noexcept { return _manager; }
+    //! Arena checkpoint
+    const typename ArenaMemoryManager<TAuxMemoryManager>::Checkpoint& checkpoint() const noexcept { return _checkpoint; }
+
+    //! Rewind the arena to the scope checkpoint before the scope end
+    void rewind() { _manager.rewind(_checkpoint); }
+
+private:
+    ArenaMemoryManager<TAuxMemoryManager>& _manager;
+    typename ArenaMemoryManager<TAuxMemoryManager>::Checkpoint _checkpoint;
+};
+
 //! Arena memory allocator class
 template <typename T, class TAuxMemoryManager = DefaultMemoryManager, bool nothrow = false>
 using ArenaAllocator = Allocator<T, ArenaMemoryManager<TAuxMemoryManager>, nothrow>;
 
+//! Arena memory resource class
+template <class TAuxMemoryManager = DefaultMemoryManager>
+using ArenaMemoryResource = MemoryResource<ArenaMemoryManager<TAuxMemoryManager>>;
+
 /*! \example memory_arena.cpp Arena memory allocator example */
 
 } // namespace CppCommon
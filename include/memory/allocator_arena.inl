@@ -158,15 +158,72 @@ inline void ArenaMemoryManager<TAuxMemoryManager>::free(void* ptr, size_t size)
     --_allocations;
 }
 
+template <class TAuxMemoryManager>
+inline typename ArenaMemoryManager<TAuxMemoryManager>::Checkpoint ArenaMemoryManager<TAuxMemoryManager>::checkpoint() const noexcept
+{
+    Checkpoint result;
+    if (_external)
+        result.size = _size;
+    else if (_current != nullptr)
+    {
+        result.page = _current;
+        result.size = _current->size;
+    }
+    result.allocated = _allocated;
+    result.allocations = _allocations;
+    return result;
+}
+
+template <class TAuxMemoryManager>
+inline void ArenaMemoryManager<TAuxMemoryManager>::rewind(const Checkpoint& checkpoint)
+{
+    assert((checkpoint.allocated <= _allocated) && "Invalid arena checkpoint! Allocated memory size must not be less than the current one!");
+    assert((checkpoint.allocations <= _allocations) && "Invalid arena checkpoint! Count of active memory allocations must not be less than the current one!");
+
+    if (_external)
+    {
+        assert((checkpoint.size <= _size) && "Invalid arena checkpoint! Arena size must not be greater than the current one!");
+
+        // Rewind the external buffer
+        _size = checkpoint.size;
+    }
+    else
+    {
+        // Free arena pages allocated after the checkpoint
+        while ((_current != nullptr) && (_current != checkpoint.page))
+        {
+            Page* prev = _current->prev;
+            _auxiliary.free(_current, sizeof(Page) + _current->capacity + alignof(std::max_align_t));
+            _current = prev;
+        }
+
+        assert((_current == checkpoint.page) && "Invalid arena checkpoint! Arena page was not found!");
+
+        // Rewind the checkpoint arena page
+        if (_current != nullptr)
+            _current->size = checkpoint.size;
+    }
+
+    // Restore allocation statistics
+    _allocated = checkpoint.allocated;
+    _allocations = checkpoint.allocations;
+}
+
 template <class TAuxMemoryManager>
 inline void ArenaMemoryManager<TAuxMemoryManager>::reset()
 {
     assert((_allocated == 0) && "Memory leak detected! Allocated memory size must be zero!");
     assert((_allocations == 0) && "Memory leak detected! Count of active memory allocations must be zero!");
 
-    // Expand internal arena buffer to fit auxiliary allocated storage
     if (!_external)
-        reset(_reserved);
+    {
+        // Reuse the single arena page which already fits the reserved size
+        if ((_current != nullptr) && (_current->prev == nullptr) && (_current->capacity >= _reserved))
+            _current->size = 0;
+        // Expand internal arena buffer to fit auxiliary allocated storage
+        else
+            reset(_reserved);
+    }
 
     _size = 0;
 }
@@ -0,0 +1,203 @@
+/*!
+    \file allocator_concurrent_pool.h
+    \brief Concurrent memory pool allocator definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_MEMORY_ALLOCATOR_CONCURRENT_POOL_H
+#define CPPCOMMON_MEMORY_ALLOCATOR_CONCURRENT_POOL_H
+
+#include "allocator_pool.h"
+
+#include "threads/mpmc_ring_queue.h"
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace CppCommon {
+
+//! Concurrent memory pool manager class
+/*!
+    Concurrent memory pool manager is a thread-caching front end of the memory
+    pool manager. Small blocks (up to 4096 bytes) are rounded up to power  of
+    two size classes and served from per-thread free lists without any locks.
+    Thread free lists exchange batches of blocks with the central cache  via
+    lock-free ring queues, so blocks freed by one thread are reused by others.
+    Only refilling the central cache with new blocks and big blocks lock the
+    underlying memory pool manager. Huge blocks (greater than the half of the
+    memory pool page) are allocated directly from the auxiliary memory manager.
+
+    Small blocks are never returned to the underlying memory pool, they are
+    cached for reuse until the memory manager is reset or cleared. Blocks
+    cached by finished threads are kept in their thread caches, call flush()
+    before finishing the thread to return them to the central cache.
+
+    Alignment of small blocks must not be greater than their rounded up size
+    (always true for blocks allocated by Allocator<T>).
+
+    Thread-safe.
+*/
+template <class TAuxMemoryManager = DefaultMemoryManager>
+class ConcurrentPoolMemoryManager
+{
+public:
+    //! Initialize concurrent memory pool manager with an auxiliary memory manager
+    /*!
+        Underlying memory pool will have unlimited pages of size 65536.
+
+        \param auxiliary - Auxiliary memory manager
+    */
+    explicit ConcurrentPoolMemoryManager(TAuxMemoryManager& auxiliary) : ConcurrentPoolMemoryManager(auxiliary, 65536, 0) {}
+    //! Initialize concurrent memory pool manager with an auxiliary memory manager, single page size and max pages count
+    /*!
+        \param auxiliary - Auxiliary memory manager
+        \param page - Underlying memory pool page size in bytes
+        \param pages - Underlying memory pool max pages count. Zero value means unlimited count (default is 0)
+    */
+    explicit ConcurrentPoolMemoryManager(TAuxMemoryManager& auxiliary, size_t page, size_t pages = 0);
+    ConcurrentPoolMemoryManager(const ConcurrentPoolMemoryManager&) = delete;
+    ConcurrentPoolMemoryManager(ConcurrentPoolMemoryManager&&) = delete;
+    ~ConcurrentPoolMemoryManager() { clear(); }
+
+    ConcurrentPoolMemoryManager& operator=(const ConcurrentPoolMemoryManager&) = delete;
+    ConcurrentPoolMemoryManager& operator=(ConcurrentPoolMemoryManager&&) = delete;
+
+    //! Allocated memory in bytes
+    /*!
+        Allocation statistics are kept per thread, so the result is approximate
+        under concurrent allocations.
+    */
+    size_t allocated() const;
+    //! Count of active memory allocations
+    size_t allocations() const;
+
+    //! Maximum memory block size, that could be allocated by the memory manager
+    size_t max_size() const noexcept { return _pool.max_size(); }
+
+    //! Auxiliary memory manager
+    TAuxMemoryManager& auxiliary() noexcept { return _pool.auxiliary(); }
+
+    //! Allocate a new memory block of the given size
+    /*!
+        \param size - Block size
+        \param alignment - Block alignment (default is alignof(std::max_align_t))
+        \return A pointer to the allocated memory block or nullptr in case of allocation failed
+    */
+    void* malloc(size_t size, size_t alignment = alignof(std::max_align_t));
+    //! Free the previously allocated memory block
+    /*!
+        \param ptr - Pointer to the memory block
+        \param size - Block size
+    */
+    void free(void* ptr, size_t size);
+
+    //! Return blocks cached by the calling thread to the central cache
+    void flush();
+
+    //! Reset the memory manager
+    /*!
+        All thread and central caches are dropped. Must be called when no
+        other thread uses the memory manager.
+    */
+    void reset();
+
+    //! Clear the memory manager
+    /*!
+        All thread and central caches are dropped and the underlying memory pool
+        is cleared. Must be called when no other thread uses the memory manager.
+    */
+    void clear();
+
+private:
+    static const size_t MIN_SHIFT = 4;
+    static const size_t MAX_SHIFT = 12;
+    static const size_t CLASSES = MAX_SHIFT - MIN_SHIFT + 1;
+    static const size_t QUEUE_CAPACITY = 256;
+
+    // Free block
+    struct Block
+    {
+        Block* next;
+    };
+
+    typedef char cache_line_pad[128];
+
+    // Thread cache of free blocks of each size class
+    struct ThreadCache
+    {
+        Block* blocks[CLASSES];
+        size_t counts[CLASSES];
+        // Allocation statistics of the thread (could wrap around when blocks are freed by other threads)
+        std::atomic<size_t> allocated;
+        std::atomic<size_t> allocations;
+        // Thread cache is padded with cache line to avoid false sharing of neighbour thread caches
+        cache_line_pad pad;
+
+        ThreadCache() noexcept : blocks(), counts(), allocated(0), allocations(0) {}
+    };
+
+    // Central cache of free blocks of the size class
+    struct CentralCache
+    {
+        // Batches of free blocks
+        MPMCRingQueue<Block*> batches;
+        // Free blocks not fit into the batches queue (guarded by the pool lock)
+        Block* blocks;
+        size_t count;
+
+        CentralCache() : batches(QUEUE_CAPACITY), blocks(nullptr), count(0) {}
+    };
+
+    // Allocation statistics of big blocks (guarded by the pool lock)
+    size_t _allocated;
+    size_t _allocations;
+
+    // Underlying memory pool and its lock
+    mutable std::mutex _lock;
+    PoolMemoryManager<TAuxMemoryManager> _pool;
+    std::vector<std::pair<void*, size_t>> _chunks;
+
+    // Central and thread caches
+    uint64_t _id;
+    std::unique_ptr<CentralCache[]> _central;
+    std::vector<std::unique_ptr<ThreadCache>> _threads;
+
+    //! Get the size class of the given size
+    static size_t SizeClass(size_t size) noexcept;
+    //! Get the block size of the given size class
+    static size_t ClassSize(size_t index) noexcept { return (size_t)1 << (index + MIN_SHIFT); }
+    //! Get the batch size of the given size class
+    static size_t BatchSize(size_t index) noexcept;
+
+    //! Is the given big block size huge for the underlying memory pool page (with the room for the alignment and the block header)?
+    bool Huge(size_t size) const noexcept { return (size > (_pool.page() / 2)); }
+    //! Generate a new memory manager identifier
+    static uint64_t GenerateId() noexcept;
+    //! Get the cache of the calling thread
+    ThreadCache& GetThreadCache();
+    //! Refill the thread cache of the given size class
+    bool Refill(ThreadCache& cache, size_t index);
+    //! Release the batch of blocks of the given size class from the thread cache
+    void Release(ThreadCache& cache, size_t index, size_t count);
+    //! Drop all thread and central caches
+    void ClearCaches();
+};
+
+//! Concurrent pool memory allocator class
+template <typename T, class TAuxMemoryManager = DefaultMemoryManager, bool nothrow = false>
+using ConcurrentPoolAllocator = Allocator<T, ConcurrentPoolMemoryManager<TAuxMemoryManager>, nothrow>;
+
+//! Concurrent pool memory resource class
+template <class TAuxMemoryManager = DefaultMemoryManager>
+using ConcurrentPoolMemoryResource = MemoryResource<ConcurrentPoolMemoryManager<TAuxMemoryManager>>;
+
+} // namespace CppCommon
+
+#include "allocator_concurrent_pool.inl"
+
+#endif // CPPCOMMON_MEMORY_ALLOCATOR_CONCURRENT_POOL_H
@@ -0,0 +1,329 @@
+/*!
+    \file allocator_concurrent_pool.inl
+    \brief Concurrent memory pool allocator inline implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+template <class TAuxMemoryManager>
+inline ConcurrentPoolMemoryManager<TAuxMemoryManager>::ConcurrentPoolMemoryManager(TAuxMemoryManager& auxiliary, size_t page, size_t pages)
+    : _allocated(0),
+      _allocations(0),
+      _pool(auxiliary, page, pages),
+      _id(GenerateId()),
+      _central(new CentralCache[CLASSES])
+{
+}
+
+template <class TAuxMemoryManager>
+inline size_t ConcurrentPoolMemoryManager<TAuxMemoryManager>::allocated() const
+{
+    std::scoped_lock locker(_lock);
+
+    size_t result = _allocated;
+    for (const auto& thread : _threads)
+        result += thread->allocated.load(std::memory_order_relaxed);
+    return result;
+}
+
+template <class TAuxMemoryManager>
+inline size_t ConcurrentPoolMemoryManager<TAuxMemoryManager>::allocations() const
+{
+    std::scoped_lock locker(_lock);
+
+    size_t result = _allocations;
+    for (const auto& thread : _threads)
+        result += thread->allocations.load(std::memory_order_relaxed);
+    return result;
+}
+
+template <class TAuxMemoryManager>
+inline void* ConcurrentPoolMemoryManager<TAuxMemoryManager>::malloc(size_t size, size_t alignment)
+{
+    assert((size > 0) && "Allocated block size must be greater than zero!");
+    assert(Memory::IsValidAlignment(alignment) && "Alignment must be valid!");
+
+    // Allocate big blocks using the underlying memory pool
+    if (size > ClassSize(CLASSES - 1))
+    {
+        std::scoped_lock locker(_lock);
+
+        void* result = Huge(size) ? _pool.auxiliary().malloc(size, alignment) : _pool.malloc(size, alignment);
+        if (result != nullptr)
+        {
+            // Update allocation statistics
+            _allocated += size;
+            ++_allocations;
+        }
+        return result;
+    }
+
+    size_t index = SizeClass(size);
+    assert((alignment <= ClassSize(index)) && "Alignment must not be greater than the rounded up block size!");
+
+    // Allocate the block from the thread cache
+    ThreadCache& cache = GetThreadCache();
+    if ((cache.blocks[index] == nullptr) && !Refill(cache, index))
+        return nullptr;
+
+    Block* block = cache.blocks[index];
+    cache.blocks[index] = block->next;
+    --cache.counts[index];
+
+    // Update allocation statistics
+    cache.allocated.store(cache.allocated.load(std::memory_order_relaxed) + size, std::memory_order_relaxed);
+    cache.allocations.store(cache.allocations.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+
+    return block;
+}
+
+template <class TAuxMemoryManager>
+inline void ConcurrentPoolMemoryManager<TAuxMemoryManager>::free(void* ptr, size_t size)
+{
+    assert((ptr != nullptr) && "Deallocated block must be valid!");
+
+    // Deallocate big blocks using the underlying memory pool
+    if (size > ClassSize(CLASSES - 1))
+    {
+        std::scoped_lock locker(_lock);
+
+        if (Huge(size))
+            _pool.auxiliary().free(ptr, size);
+        else
+            _pool.free(ptr, size);
+
+        // Update allocation statistics
+        _allocated -= size;
+        --_allocations;
+
+        return;
+    }
+
+    size_t index = SizeClass(size);
+
+    // Return the block into the thread cache
+    ThreadCache& cache = GetThreadCache();
+    Block* block = (Block*)ptr;
+    block->next = cache.blocks[index];
+    cache.blocks[index] = block;
+    ++cache.counts[index];
+
+    // Update allocation statistics
+    cache.allocated.store(cache.allocated.load(std::memory_order_relaxed) - size, std::memory_order_relaxed);
+    cache.allocations.store(cache.allocations.load(std::memory_order_relaxed) - 1, std::memory_order_relaxed);
+
+    // Release the batch of blocks into the central cache if the thread cache is too big
+    size_t batch = BatchSize(index);
+    if (cache.counts[index] >= (2 * batch))
+        Release(cache, index, batch);
+}
+
+template <class TAuxMemoryManager>
+inline void ConcurrentPoolMemoryManager<TAuxMemoryManager>::flush()
+{
+    ThreadCache& cache = GetThreadCache();
+
+    for (size_t index = 0; index < CLASSES; ++index)
+    {
+        // Release full batches of blocks
+        size_t batch = BatchSize(index);
+        while (cache.counts[index] >= batch)
+            Release(cache, index, batch);
+
+        // Release the rest of blocks
+        if (cache.counts[index] > 0)
+            Release(cache, index, cache.counts[index]);
+    }
+}
+
+template <class TAuxMemoryManager>
+inline void ConcurrentPoolMemoryManager<TAuxMemoryManager>::reset()
+{
+    assert((allocated() == 0) && "Memory leak detected! Allocated memory size must be zero!");
+    assert((allocations() == 0) && "Memory leak detected! Count of active memory allocations must be zero!");
+
+    std::scoped_lock locker(_lock);
+
+    ClearCaches();
+    _pool.reset();
+}
+
+template <class TAuxMemoryManager>
+inline void ConcurrentPoolMemoryManager<TAuxMemoryManager>::clear()
+{
+    assert((allocated() == 0) && "Memory leak detected! Allocated memory size must be zero!");
+    assert((allocations() == 0) && "Memory leak detected! Count of active memory allocations must be zero!");
+
+    std::scoped_lock locker(_lock);
+
+    ClearCaches();
+    _pool.clear();
+}
+
+template <class TAuxMemoryManager>
+inline size_t ConcurrentPoolMemoryManager<TAuxMemoryManager>::SizeClass(size_t size) noexcept
+{
+    size_t index = 0;
+    while (ClassSize(index) < size)
+        ++index;
+    return index;
+}
+
+template <class TAuxMemoryManager>
+inline size_t ConcurrentPoolMemoryManager<TAuxMemoryManager>::BatchSize(size_t index) noexcept
+{
+    // Transfer about 16 KB of blocks in one batch, but not less than 4 and not more than 64 blocks
+    return std::min(std::max((size_t)16384 / ClassSize(index), (size_t)4), (size_t)64);
+}
+
+template <class TAuxMemoryManager>
+inline uint64_t ConcurrentPoolMemoryManager<TAuxMemoryManager>::GenerateId() noexcept
+{
+    static std::atomic<uint64_t> generator(0);
+    return ++generator;
+}
+
+template <class TAuxMemoryManager>
+inline typename ConcurrentPoolMemoryManager<TAuxMemoryManager>::ThreadCache& ConcurrentPoolMemoryManager<TAuxMemoryManager>::GetThreadCache()
+{
+    // Thread caches of memory managers are found by unique identifiers, so caches
+    // of destroyed or cleared memory managers are never reused
+    thread_local uint64_t last_id = 0;
+    thread_local ThreadCache* last_cache = nullptr;
+    thread_local std::vector<std::pair<uint64_t, ThreadCache*>> caches;
+
+    const uint64_t id = _id;
+    if (last_id == id)
+        return *last_cache;
+
+    for (const auto& cache : caches)
+    {
+        if (cache.first == id)
+        {
+            last_id = id;
+            last_cache = cache.second;
+            return *last_cache;
+        }
+    }
+
+    // Create a new thread cache
+    ThreadCache* cache;
+    {
+        std::scoped_lock locker(_lock);
+        _threads.emplace_back(std::make_unique<ThreadCache>());
+        cache = _threads.back().get();
+    }
+
+    caches.emplace_back(id, cache);
+    last_id = id;
+    last_cache = cache;
+    return *cache;
+}
+
+template <class TAuxMemoryManager>
+inline bool ConcurrentPoolMemoryManager<TAuxMemoryManager>::Refill(ThreadCache& cache, size_t index)
+{
+    CentralCache& central = _central[index];
+    const size_t batch = BatchSize(index);
+
+    // Try to get the batch of blocks from the central cache without locking
+    Block* blocks;
+    if (central.batches.Dequeue(blocks))
+    {
+        cache.blocks[index] = blocks;
+        cache.counts[index] = batch;
+        return true;
+    }
+
+    std::scoped_lock locker(_lock);
+
+    // Try to get blocks which are not fit into the batches queue
+    if (central.blocks != nullptr)
+    {
+        Block* tail = central.blocks;
+        size_t count = 1;
+        while ((count < batch) && (tail->next != nullptr))
+        {
+            tail = tail->next;
+            ++count;
+        }
+        cache.blocks[index] = central.blocks;
+        cache.counts[index] = count;
+        central.blocks = tail->next;
+        central.count -= count;
+        tail->next = nullptr;
+        return true;
+    }
+
+    // Allocate a new chunk of blocks aligned to the block size from the underlying memory pool
+    const size_t size = ClassSize(index);
+    uint8_t* chunk = (uint8_t*)(Huge(size * batch) ? _pool.auxiliary().malloc(size * batch, size) : _pool.malloc(size * batch, size));
+    if (chunk == nullptr)
+        return false;
+    _chunks.emplace_back(chunk, size * batch);
+
+    // Split the chunk into free blocks
+    for (size_t i = 0; i < batch; ++i)
+        ((Block*)(chunk + i * size))->next = (i < (batch - 1)) ? (Block*)(chunk + (i + 1) * size) : nullptr;
+    cache.blocks[index] = (Block*)chunk;
+    cache.counts[index] = batch;
+    return true;
+}
+
+template <class TAuxMemoryManager>
+inline void ConcurrentPoolMemoryManager<TAuxMemoryManager>::Release(ThreadCache& cache, size_t index, size_t count)
+{
+    CentralCache& central = _central[index];
+
+    // Detach blocks from the thread cache
+    Block* blocks = cache.blocks[index];
+    Block* tail = blocks;
+    for (size_t i = 1; i < count; ++i)
+        tail = tail->next;
+    cache.blocks[index] = tail->next;
+    cache.counts[index] -= count;
+    tail->next = nullptr;
+
+    // Try to put the full batch of blocks into the central cache without locking
+    if ((count == BatchSize(index)) && central.batches.Enqueue(blocks))
+        return;
+
+    std::scoped_lock locker(_lock);
+
+    // Put blocks into the central cache list
+    tail->next = central.blocks;
+    central.blocks = blocks;
+    central.count += count;
+}
+
+template <class TAuxMemoryManager>
+inline void ConcurrentPoolMemoryManager<TAuxMemoryManager>::ClearCaches()
+{
+    // Drop central caches
+    for (size_t index = 0; index < CLASSES; ++index)
+    {
+        Block* blocks;
+        while (_central[index].batches.Dequeue(blocks)) {}
+        _central[index].blocks = nullptr;
+        _central[index].count = 0;
+    }
+
+    // Drop thread caches, the new identifier invalidates their thread local references
+    _threads.clear();
+    _id = GenerateId();
+
+    // Return all chunks of blocks into the underlying memory pool
+    for (const auto& chunk : _chunks)
+    {
+        if (Huge(chunk.second))
+            _pool.auxiliary().free(chunk.first, chunk.second);
+        else
+            _pool.free(chunk.first, chunk.second);
+    }
+    _chunks.clear();
+}
+
+} // namespace CppCommon
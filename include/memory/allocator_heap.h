@@ -77,6 +77,9 @@ private:
 template <typename T, bool nothrow = false>
 using HeapAllocator = Allocator<T, HeapMemoryManager, nothrow>;
 
+//! Heap memory resource class
+using HeapMemoryResource = MemoryResource<HeapMemoryManager>;
+
 } // namespace CppCommon
 
 #include "allocator_heap.inl"
@@ -0,0 +1,147 @@
+/*!
+    \file allocator_hugepage.h
+    \brief Huge page memory allocator definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_MEMORY_ALLOCATOR_HUGEPAGE_H
+#define CPPCOMMON_MEMORY_ALLOCATOR_HUGEPAGE_H
+
+#include "allocator.h"
+
+#if defined(_WIN32) || defined(_WIN64)
+#include <windows.h>
+#undef DELETE
+#undef ERROR
+#undef Yield
+#undef min
+#undef max
+#undef uuid_t
+#elif defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+#include <sys/mman.h>
+#include <unistd.h>
+#if defined(linux) || defined(__linux) || defined(__linux__)
+#include <linux/mempolicy.h>
+#include <sys/syscall.h>
+#endif
+#endif
+
+namespace CppCommon {
+
+//! Huge page memory manager class
+/*!
+    Huge page memory manager allocates memory blocks directly from the  system
+    virtual memory backed with huge pages (2 MB or 1 GB), so  big  arenas  and
+    pools spend much less TLB entries than with ordinary 4 KB pages. Each block
+    size is rounded up to the huge page size, so the memory manager is supposed
+    to be used as an auxiliary memory manager of arena and pool memory managers
+    with page capacities close to (but less than) multiple of the huge page size.
+
+    If the NUMA node is given, allocated pages are bound to the memory of  the
+    given node, so per-socket arenas stay local to their worker threads.
+
+    If huge pages are not available (not reserved in the system or the process
+    has no privilege to lock pages in memory) the memory manager falls back  to
+    ordinary pages, unless the fallback is disabled.
+    Windows: VirtualAllocExNuma() with MEM_LARGE_PAGES, large page size is limited to GetLargePageMinimum()
+    Linux: mmap() with MAP_HUGETLB, fallback to madvise(MADV_HUGEPAGE), NUMA binding with mbind()
+    Unix: mmap() with ordinary pages
+
+    Not thread-safe.
+*/
+class HugePageMemoryManager
+{
+public:
+    //! Huge page size of 2 megabytes
+    static constexpr size_t HUGE_PAGE_2MB = 2 * 1024 * 1024;
+    //! Huge page size of 1 gigabyte
+    static constexpr size_t HUGE_PAGE_1GB = 1024 * 1024 * 1024;
+
+    //! Initialize huge page memory manager with a given huge page size and NUMA node
+    /*!
+        \param page - Huge page size. Must be a power of two (default is HUGE_PAGE_2MB)
+        \param node - NUMA node to bind allocated pages (default is -1 - no binding)
+        \param fallback - Fallback to ordinary pages if huge pages are not available (default is true)
+    */
+    explicit HugePageMemoryManager(size_t page = HUGE_PAGE_2MB, int node = -1, bool fallback = true) noexcept;
+    HugePageMemoryManager(const HugePageMemoryManager&) = delete;
+    HugePageMemoryManager(HugePageMemoryManager&&) = delete;
+    ~HugePageMemoryManager() noexcept { reset(); }
+
+    HugePageMemoryManager& operator=(const HugePageMemoryManager&) = delete;
+    HugePageMemoryManager& operator=(HugePageMemoryManager&&) = delete;
+
+    //! Allocated memory in bytes (rounded up to the huge page size)
+    size_t allocated() const noexcept { return _allocated; }
+    //! Count of active memory allocations
+    size_t allocations() const noexcept { return _allocations; }
+    //! Total count of memory allocations fallen back to ordinary pages
+    size_t fallbacks() const noexcept { return _fallbacks; }
+
+    //! Huge page size
+    size_t page() const noexcept { return _page; }
+    //! NUMA node (-1 - no binding)
+    int node() const noexcept { return _node; }
+    //! Is fallback to ordinary pages enabled?
+    bool fallback() const noexcept { return _fallback; }
+
+    //! Maximum memory block size, that could be allocated by the memory manager
+    size_t max_size() const noexcept { return std::numeric_limits<size_t>::max() - _page + 1; }
+
+    //! Allocate a new memory block of the given size
+    /*!
+        Memory block is aligned to the system page size at least.
+
+        \param size - Block size
+        \param alignment - Block alignment (default is alignof(std::max_align_t))
+        \return A pointer to the allocated memory block or nullptr in case of allocation failed
+    */
+    void* malloc(size_t size, size_t alignment = alignof(std::max_align_t));
+    //! Free the previously allocated memory block
+    /*!
+        \param ptr - Pointer to the memory block
+        \param size - Block size
+    */
+    void free(void* ptr, size_t size);
+
+    //! Reset the memory manager
+    void reset();
+
+private:
+    // Allocation statistics
+    size_t _allocated;
+    size_t _allocations;
+    size_t _fallbacks;
+
+    // Huge pages settings
+    size_t _page;
+    int _node;
+    bool _fallback;
+
+    //! Round up the given size to the huge page size
+    size_t RoundUp(size_t size) const noexcept { return (size + _page - 1) & ~(_page - 1); }
+
+    //! Allocate virtual memory of the given size
+    void* AllocateMemory(size_t size, bool huge);
+    //! Free virtual memory of the given size
+    void FreeMemory(void* ptr, size_t size);
+    //! Bind virtual memory of the given size to the NUMA node
+    bool BindMemory(void* ptr, size_t size);
+};
+
+//! Huge page memory allocator class
+template <typename T, bool nothrow = false>
+using HugePageAllocator = Allocator<T, HugePageMemoryManager, nothrow>;
+
+//! Huge page memory resource class
+using HugePageMemoryResource = MemoryResource<HugePageMemoryManager>;
+
+/*! \example memory_hugepage.cpp Huge page memory manager example */
+
+} // namespace CppCommon
+
+#include "allocator_hugepage.inl"
+
+#endif // CPPCOMMON_MEMORY_ALLOCATOR_HUGEPAGE_H
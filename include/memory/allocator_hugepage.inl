@@ -0,0 +1,145 @@
+/*!
+    \file allocator_hugepage.inl
+    \brief Huge page memory allocator inline implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+inline HugePageMemoryManager::HugePageMemoryManager(size_t page, int node, bool fallback) noexcept
+    : _allocated(0), _allocations(0), _fallbacks(0),
+      _page(page), _node(node), _fallback(fallback)
+{
+    assert(Memory::IsValidAlignment(page) && "Huge page size must be a power of two!");
+}
+
+inline void* HugePageMemoryManager::malloc(size_t size, size_t alignment)
+{
+    assert((size > 0) && "Allocated block size must be greater than zero!");
+    assert(Memory::IsValidAlignment(alignment) && "Alignment must be valid!");
+    assert((alignment <= 4096) && "Alignment must not be greater than the system page size!");
+
+    if (size > max_size())
+        return nullptr;
+
+    size_t rounded = RoundUp(size);
+
+    // Try to allocate huge pages and fallback to ordinary pages
+    void* result = AllocateMemory(rounded, true);
+    if ((result == nullptr) && _fallback)
+    {
+        result = AllocateMemory(rounded, false);
+        if (result != nullptr)
+            ++_fallbacks;
+    }
+
+    if (result != nullptr)
+    {
+        // Update allocation statistics
+        _allocated += rounded;
+        ++_allocations;
+    }
+    return result;
+}
+
+inline void HugePageMemoryManager::free(void* ptr, size_t size)
+{
+    assert((ptr != nullptr) && "Deallocated block must be valid!");
+
+    if (ptr != nullptr)
+    {
+        size_t rounded = RoundUp(size);
+
+        FreeMemory(ptr, rounded);
+
+        // Update allocation statistics
+        _allocated -= rounded;
+        --_allocations;
+    }
+}
+
+inline void HugePageMemoryManager::reset()
+{
+    assert((_allocated == 0) && "Memory leak detected! Allocated memory size must be zero!");
+    assert((_allocations == 0) && "Memory leak detected! Count of active memory allocations must be zero!");
+}
+
+inline void* HugePageMemoryManager::AllocateMemory(size_t size, bool huge)
+{
+#if defined(_WIN32) || defined(_WIN64)
+    DWORD type = MEM_RESERVE | MEM_COMMIT;
+    if (huge)
+    {
+        // Large pages size must be a multiple of the minimal large page
+        SIZE_T minimum = GetLargePageMinimum();
+        if (minimum == 0)
+            return nullptr;
+        size = ((size + minimum - 1) / minimum) * minimum;
+        type |= MEM_LARGE_PAGES;
+    }
+    if (_node >= 0)
+        return VirtualAllocExNuma(GetCurrentProcess(), nullptr, size, type, PAGE_READWRITE, (DWORD)_node);
+    else
+        return VirtualAlloc(nullptr, size, type, PAGE_READWRITE);
+#elif defined(linux) || defined(__linux) || defined(__linux__)
+    int flags = MAP_PRIVATE | MAP_ANONYMOUS;
+    if (huge)
+    {
+        // Encode the huge page size as log2 of the page size
+        int shift = 0;
+        while (((size_t)1 << shift) < _page)
+            ++shift;
+#if !defined(MAP_HUGE_SHIFT)
+#define MAP_HUGE_SHIFT 26
+#endif
+        flags |= MAP_HUGETLB | (shift << MAP_HUGE_SHIFT);
+    }
+    void* result = mmap(nullptr, size, PROT_READ | PROT_WRITE, flags, -1, 0);
+    if (result == MAP_FAILED)
+        return nullptr;
+    // Ask for transparent huge pages for the ordinary pages mapping
+    if (!huge)
+        madvise(result, size, MADV_HUGEPAGE);
+    // Bind pages to the NUMA node before the first touch
+    if ((_node >= 0) && !BindMemory(result, size))
+    {
+        munmap(result, size);
+        return nullptr;
+    }
+    return result;
+#else
+    // Huge pages are not supported
+    if (huge)
+        return nullptr;
+    void* result = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANON, -1, 0);
+    return (result != MAP_FAILED) ? result : nullptr;
+#endif
+}
+
+inline void HugePageMemoryManager::FreeMemory(void* ptr, size_t size)
+{
+#if defined(_WIN32) || defined(_WIN64)
+    VirtualFree(ptr, 0, MEM_RELEASE);
+#else
+    munmap(ptr, size);
+#endif
+}
+
+inline bool HugePageMemoryManager::BindMemory(void* ptr, size_t size)
+{
+#if defined(linux) || defined(__linux) || defined(__linux__)
+    // Single word node mask supports first 64 NUMA nodes
+    unsigned long mask = 0;
+    if ((size_t)_node >= (sizeof(mask) * 8))
+        return false;
+    mask = 1UL << _node;
+    return (syscall(SYS_mbind, ptr, size, MPOL_BIND, &mask, sizeof(mask) * 8, 0) == 0);
+#else
+    // NUMA node is bound on allocation or ignored
+    return true;
+#endif
+}
+
+} // namespace CppCommon
@@ -66,6 +66,9 @@ private:
 template <typename T, bool nothrow = false>
 using NullAllocator = Allocator<T, NullMemoryManager, nothrow>;
 
+//! Null memory resource class
+using NullMemoryResource = MemoryResource<NullMemoryManager>;
+
 } // namespace CppCommon
 
 #include "allocator_null.inl"
@@ -161,6 +161,10 @@ private:
 template <typename T, class TAuxMemoryManager = DefaultMemoryManager, bool nothrow = false>
 using PoolAllocator = Allocator<T, PoolMemoryManager<TAuxMemoryManager>, nothrow>;
 
+//! Pool memory resource class
+template <class TAuxMemoryManager = DefaultMemoryManager>
+using PoolMemoryResource = MemoryResource<PoolMemoryManager<TAuxMemoryManager>>;
+
 /*! \example memory_pool.cpp Pool memory allocator example */
 
 } // namespace CppCommon
@@ -0,0 +1,197 @@
+/*!
+    \file allocator_profiler.h
+    \brief Sampling profiler memory allocator definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_MEMORY_ALLOCATOR_PROFILER_H
+#define CPPCOMMON_MEMORY_ALLOCATOR_PROFILER_H
+
+#include "allocator.h"
+#include "system/stack_trace.h"
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace CppCommon {
+
+//! Allocation site
+/*!
+    Allocation site is a unique stack trace of sampled memory allocations with
+    their accumulated statistics. Bytes and allocations are estimated from the
+    sampled ones multiplied by the sampling rate.
+*/
+struct AllocationSite
+{
+    StackTrace trace;       //!< Allocation site stack trace
+    uint64_t samples;       //!< Count of sampled allocations
+    uint64_t allocations;   //!< Estimated total count of allocations
+    uint64_t total;         //!< Estimated total allocated bytes
+    uint64_t live;          //!< Estimated live (not yet freed) bytes
+
+    AllocationSite() : trace(nullptr, 0), samples(0), allocations(0), total(0), live(0) {}
+};
+
+//! Sampling profiler memory manager class
+/*!
+    Sampling profiler memory manager wraps another memory manager and records
+    every Nth allocation of each thread with its raw stack trace and size.
+    Samples are kept in fixed lock-free tables, so the profiler could be used
+    under real load: not sampled allocations cost a thread local counter
+    decrement and not sampled frees cost a single atomic load.
+
+    Stack trace symbols are resolved only when the report is requested, which
+    lists top allocation sites by total or live bytes.
+
+    If sample tables are saturated, samples are dropped and counted.
+
+    Thread-safety is the same as of the wrapped memory manager, sample tables
+    are thread-safe.
+*/
+template <class TMemoryManager = DefaultMemoryManager>
+class ProfilerMemoryManager
+{
+public:
+    //! Initialize profiler memory manager with a wrapped memory manager
+    /*!
+        \param manager - Wrapped memory manager
+        \param rate - Sampling rate, every Nth allocation is sampled (default is 1024)
+        \param capacity - Live samples capacity (will be rounded up to the power of two, default is 65536)
+        \param sites - Allocation sites capacity (will be rounded up to the power of two, default is 4096)
+    */
+    explicit ProfilerMemoryManager(TMemoryManager& manager, size_t rate = 1024, size_t capacity = 65536, size_t sites = 4096);
+    ProfilerMemoryManager(const ProfilerMemoryManager&) = delete;
+    ProfilerMemoryManager(ProfilerMemoryManager&&) = delete;
+    ~ProfilerMemoryManager() = default;
+
+    ProfilerMemoryManager& operator=(const ProfilerMemoryManager&) = delete;
+    ProfilerMemoryManager& operator=(ProfilerMemoryManager&&) = delete;
+
+    //! Allocated memory in bytes
+    size_t allocated() const noexcept { return _manager.allocated(); }
+    //! Count of active memory allocations
+    size_t allocations() const noexcept { return _manager.allocations(); }
+
+    //! Sampling rate
+    size_t rate() const noexcept { return _rate; }
+    //! Count of recorded samples
+    uint64_t samples() const noexcept { return _samples.load(std::memory_order_relaxed); }
+    //! Count of dropped samples
+    uint64_t dropped() const noexcept { return _dropped.load(std::memory_order_relaxed); }
+
+    //! Maximum memory block size, that could be allocated by the memory manager
+    size_t max_size() const noexcept { return _manager.max_size(); }
+
+    //! Wrapped memory manager
+    TMemoryManager& auxiliary() noexcept { return _manager; }
+
+    //! Allocate a new memory block of the given size
+    /*!
+        \param size - Block size
+        \param alignment - Block alignment (default is alignof(std::max_align_t))
+        \return A pointer to the allocated memory block or nullptr in case of allocation failed
+    */
+    void* malloc(size_t size, size_t alignment = alignof(std::max_align_t));
+    //! Free the previously allocated memory block
+    /*!
+        \param ptr - Pointer to the memory block
+        \param size - Block size
+    */
+    void free(void* ptr, size_t size);
+
+    //! Reset the memory manager
+    void reset() { _manager.reset(); }
+
+    //! Get top allocation sites
+    /*!
+        \param top - Count of top allocation sites (default is 10)
+        \param live - Sort by live bytes instead of total bytes (default is false)
+        \return Top allocation sites sorted by bytes in descending order
+    */
+    std::vector<AllocationSite> sites(size_t top = 10, bool live = false) const;
+
+    //! Get the report of top allocation sites
+    /*!
+        \param top - Count of top allocation sites (default is 10)
+        \param live - Sort by live bytes instead of total bytes (default is false)
+        \return Report string
+    */
+    std::string report(size_t top = 10, bool live = false) const;
+
+private:
+    static const int DEPTH = 32;
+    static const size_t PROBES = 16;
+
+    // Live sample
+    struct Sample
+    {
+        std::atomic<void*> ptr;
+        size_t size;
+        size_t site;
+
+        Sample() : ptr(nullptr), size(0), site(0) {}
+    };
+
+    // Allocation site
+    struct Site
+    {
+        std::atomic<uint64_t> key;
+        std::atomic<bool> ready;
+        int depth;
+        void* frames[DEPTH];
+        std::atomic<uint64_t> samples;
+        std::atomic<uint64_t> total;
+        std::atomic<uint64_t> live;
+
+        Site() : key(0), ready(false), depth(0), frames(), samples(0), total(0), live(0) {}
+    };
+
+    TMemoryManager& _manager;
+    size_t _rate;
+
+    // Live samples table with counting filter of occupied probe chains
+    size_t _capacity_mask;
+    std::unique_ptr<Sample[]> _live;
+    std::unique_ptr<std::atomic<uint32_t>[]> _filter;
+
+    // Allocation sites table
+    size_t _sites_mask;
+    std::unique_ptr<Site[]> _sites;
+
+    std::atomic<uint64_t> _samples;
+    std::atomic<uint64_t> _dropped;
+
+    //! Tombstone of the freed live sample
+    static void* Tombstone() noexcept { return (void*)(uintptr_t)1; }
+    //! Hash the given pointer
+    static size_t Hash(const void* ptr) noexcept;
+    //! Round up the given value to the power of two
+    static size_t RoundUp(size_t value) noexcept;
+
+    //! Should the current allocation be sampled?
+    bool Sampled() noexcept;
+    //! Record the sample of the given memory block
+    void Record(void* ptr, size_t size);
+    //! Find or insert the allocation site with the given frames
+    Site* FindSite(void* const* frames, int depth);
+};
+
+//! Sampling profiler memory allocator class
+template <typename T, class TMemoryManager = DefaultMemoryManager, bool nothrow = false>
+using ProfilerAllocator = Allocator<T, ProfilerMemoryManager<TMemoryManager>, nothrow>;
+
+//! Sampling profiler memory resource class
+template <class TMemoryManager = DefaultMemoryManager>
+using ProfilerMemoryResource = MemoryResource<ProfilerMemoryManager<TMemoryManager>>;
+
+} // namespace CppCommon
+
+#include "allocator_profiler.inl"
+
+#endif // CPPCOMMON_MEMORY_ALLOCATOR_PROFILER_H
@@ -0,0 +1,226 @@
+/*!
+    \file allocator_profiler.inl
+    \brief Sampling profiler memory allocator inline implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+template <class TMemoryManager>
+inline ProfilerMemoryManager<TMemoryManager>::ProfilerMemoryManager(TMemoryManager& manager, size_t rate, size_t capacity, size_t sites)
+    : _manager(manager),
+      _rate(std::max(rate, (size_t)1)),
+      _capacity_mask(RoundUp(capacity) - 1),
+      _live(new Sample[_capacity_mask + 1]),
+      _filter(new std::atomic<uint32_t>[_capacity_mask + 1]),
+      _sites_mask(RoundUp(sites) - 1),
+      _sites(new Site[_sites_mask + 1]),
+      _samples(0),
+      _dropped(0)
+{
+    for (size_t i = 0; i <= _capacity_mask; ++i)
+        _filter[i].store(0, std::memory_order_relaxed);
+}
+
+template <class TMemoryManager>
+inline void* ProfilerMemoryManager<TMemoryManager>::malloc(size_t size, size_t alignment)
+{
+    void* result = _manager.malloc(size, alignment);
+    if ((result != nullptr) && Sampled())
+        Record(result, size);
+    return result;
+}
+
+template <class TMemoryManager>
+inline void ProfilerMemoryManager<TMemoryManager>::free(void* ptr, size_t size)
+{
+    assert((ptr != nullptr) && "Deallocated block must be valid!");
+
+    // Fast check if there are live samples in the probe chain of the block
+    size_t start = Hash(ptr) & _capacity_mask;
+    if (_filter[start].load(std::memory_order_acquire) > 0)
+    {
+        // Remove the live sample before the block could be reused
+        for (size_t i = 0; i < PROBES; ++i)
+        {
+            Sample& sample = _live[(start + i) & _capacity_mask];
+            void* current = sample.ptr.load(std::memory_order_acquire);
+            if (current == ptr)
+            {
+                _sites[sample.site].live.fetch_sub(sample.size, std::memory_order_relaxed);
+                sample.ptr.store(Tombstone(), std::memory_order_release);
+                _filter[start].fetch_sub(1, std::memory_order_release);
+                break;
+            }
+            if (current == nullptr)
+                break;
+        }
+    }
+
+    _manager.free(ptr, size);
+}
+
+template <class TMemoryManager>
+inline std::vector<AllocationSite> ProfilerMemoryManager<TMemoryManager>::sites(size_t top, bool live) const
+{
+    struct Snapshot
+    {
+        const Site* site;
+        uint64_t samples;
+        uint64_t total;
+        uint64_t live;
+    };
+
+    // Take the snapshot of all ready allocation sites
+    std::vector<Snapshot> snapshots;
+    for (size_t i = 0; i <= _sites_mask; ++i)
+    {
+        const Site& site = _sites[i];
+        if (site.ready.load(std::memory_order_acquire))
+            snapshots.push_back({ &site, site.samples.load(std::memory_order_relaxed), site.total.load(std::memory_order_relaxed), site.live.load(std::memory_order_relaxed) });
+    }
+
+    // Select top allocation sites
+    size_t count = std::min(top, snapshots.size());
+    std::partial_sort(snapshots.begin(), snapshots.begin() + count, snapshots.end(), [live](const Snapshot& s1, const Snapshot& s2)
+    {
+        return live ? (s1.live > s2.live) : (s1.total > s2.total);
+    });
+
+    // Resolve stack traces of top allocation sites only
+    std::vector<AllocationSite> result(count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        const Snapshot& snapshot = snapshots[i];
+        result[i].trace = StackTrace(snapshot.site->frames, snapshot.site->depth);
+        result[i].samples = snapshot.samples;
+        result[i].allocations = snapshot.samples * _rate;
+        result[i].total = snapshot.total * _rate;
+        result[i].live = snapshot.live * _rate;
+    }
+    return result;
+}
+
+template <class TMemoryManager>
+inline std::string ProfilerMemoryManager<TMemoryManager>::report(size_t top, bool live) const
+{
+    std::vector<AllocationSite> top_sites = sites(top, live);
+
+    std::stringstream ss;
+    ss << "Allocation sites: " << top_sites.size() << " (rate: " << _rate << ", samples: " << samples() << ", dropped: " << dropped() << ")" << std::endl;
+    for (size_t i = 0; i < top_sites.size(); ++i)
+    {
+        const AllocationSite& site = top_sites[i];
+        ss << "#" << (i + 1) << " total: " << site.total << " bytes, live: " << site.live << " bytes, allocations: " << site.allocations << std::endl;
+        ss << site.trace;
+    }
+    return ss.str();
+}
+
+template <class TMemoryManager>
+inline size_t ProfilerMemoryManager<TMemoryManager>::Hash(const void* ptr) noexcept
+{
+    uint64_t value = (uint64_t)(uintptr_t)ptr * 0x9E3779B97F4A7C15ull;
+    return (size_t)(value ^ (value >> 32));
+}
+
+template <class TMemoryManager>
+inline size_t ProfilerMemoryManager<TMemoryManager>::RoundUp(size_t value) noexcept
+{
+    size_t result = 1;
+    while (result < value)
+        result <<= 1;
+    return result;
+}
+
+template <class TMemoryManager>
+inline bool ProfilerMemoryManager<TMemoryManager>::Sampled() noexcept
+{
+    // Sampling countdown is kept per thread to avoid contention
+    thread_local size_t countdown = 0;
+    if (countdown > 1)
+    {
+        --countdown;
+        return false;
+    }
+    countdown = _rate;
+    return true;
+}
+
+template <class TMemoryManager>
+inline void ProfilerMemoryManager<TMemoryManager>::Record(void* ptr, size_t size)
+{
+    // Capture raw stack trace frames skipping the profiler ones
+    void* frames[DEPTH];
+    int depth = StackTrace::Capture(frames, DEPTH, 2);
+
+    Site* site = FindSite(frames, depth);
+    if (site == nullptr)
+    {
+        _dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    site->samples.fetch_add(1, std::memory_order_relaxed);
+    site->total.fetch_add(size, std::memory_order_relaxed);
+    _samples.fetch_add(1, std::memory_order_relaxed);
+
+    // Insert the live sample into the first empty or freed slot of the probe chain
+    size_t start = Hash(ptr) & _capacity_mask;
+    for (size_t i = 0; i < PROBES; ++i)
+    {
+        Sample& sample = _live[(start + i) & _capacity_mask];
+        void* current = sample.ptr.load(std::memory_order_relaxed);
+        if (((current == nullptr) || (current == Tombstone())) && sample.ptr.compare_exchange_strong(current, ptr, std::memory_order_acquire))
+        {
+            sample.size = size;
+            sample.site = site - _sites.get();
+            site->live.fetch_add(size, std::memory_order_relaxed);
+            _filter[start].fetch_add(1, std::memory_order_release);
+            return;
+        }
+    }
+
+    // Live samples table is saturated, so the block is not tracked as live
+    _dropped.fetch_add(1, std::memory_order_relaxed);
+}
+
+template <class TMemoryManager>
+inline typename ProfilerMemoryManager<TMemoryManager>::Site* ProfilerMemoryManager<TMemoryManager>::FindSite(void* const* frames, int depth)
+{
+    // FNV-1a hash of frame addresses
+    uint64_t key = 14695981039346656037ull;
+    for (int i = 0; i < depth; ++i)
+    {
+        key ^= (uint64_t)(uintptr_t)frames[i];
+        key *= 1099511628211ull;
+    }
+    if (key == 0)
+        key = 1;
+
+    size_t start = (size_t)key & _sites_mask;
+    for (size_t i = 0; i < PROBES; ++i)
+    {
+        Site& site = _sites[(start + i) & _sites_mask];
+        uint64_t current = site.key.load(std::memory_order_acquire);
+        if (current == key)
+            return &site;
+        if ((current == 0) && site.key.compare_exchange_strong(current, key, std::memory_order_acq_rel))
+        {
+            // Publish frames of the new allocation site
+            site.depth = depth;
+            std::copy(frames, frames + depth, site.frames);
+            site.ready.store(true, std::memory_order_release);
+            return &site;
+        }
+        if (current == key)
+            return &site;
+    }
+
+    // Allocation sites table is saturated
+    return nullptr;
+}
+
+} // namespace CppCommon
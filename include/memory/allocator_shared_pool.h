@@ -0,0 +1,248 @@
+/*!
+    \file allocator_shared_pool.h
+    \brief Shared memory pool allocator definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_MEMORY_ALLOCATOR_SHARED_POOL_H
+#define CPPCOMMON_MEMORY_ALLOCATOR_SHARED_POOL_H
+
+#include "allocator.h"
+#include "offset_ptr.h"
+#include "system/shared_memory.h"
+
+#include <atomic>
+#include <bit>
+#include <new>
+#include <thread>
+
+namespace CppCommon {
+
+//! Shared memory pool manager class
+/*!
+    Shared memory pool manager allocates memory blocks from the memory buffer shared
+    between several processes (e.g. SharedMemory). The manager is placed at the
+    beginning of the buffer and keeps only offsets and atomic counters, so all
+    processes could allocate and free blocks concurrently regardless of the
+    address the buffer is mapped at.
+
+    Blocks are rounded up to power of two size classes (at least 16 bytes) and
+    are carved from the top of the buffer. Released blocks are kept in the
+    lock-free free lists of their size classes for reuse, they are never split
+    or joined, so containers should reserve their capacity up front.
+
+    The manager also keeps the root object pointer which could be used to find
+    the shared data structure (e.g. the hash map) in other processes.
+
+    Alignment of blocks must not be greater than 64 bytes and than their rounded
+    up size (always true for blocks allocated by SharedPoolAllocator<T>).
+
+    Thread-safe and process-safe.
+*/
+class SharedPoolMemoryManager
+{
+public:
+    //! Initialize shared memory manager at the beginning of the buffer of the given capacity
+    /*!
+        \param capacity - Capacity of the buffer including the manager itself
+    */
+    explicit SharedPoolMemoryManager(size_t capacity) noexcept;
+    SharedPoolMemoryManager(const SharedPoolMemoryManager&) = delete;
+    SharedPoolMemoryManager(SharedPoolMemoryManager&&) = delete;
+    ~SharedPoolMemoryManager() noexcept = default;
+
+    SharedPoolMemoryManager& operator=(const SharedPoolMemoryManager&) = delete;
+    SharedPoolMemoryManager& operator=(SharedPoolMemoryManager&&) = delete;
+
+    //! Create or open the shared memory manager in the given buffer
+    /*!
+        Owner creates a new shared memory manager at the beginning of the buffer,
+        other processes wait until it is initialized.
+
+        \param buffer - Buffer
+        \param capacity - Buffer capacity
+        \param owner - Buffer owner flag
+        \return Shared memory pool manager
+    */
+    static SharedPoolMemoryManager& Open(void* buffer, size_t capacity, bool owner);
+    //! Create or open the shared memory manager in the given shared memory
+    /*!
+        \param shared - Shared memory
+        \return Shared memory pool manager
+    */
+    static SharedPoolMemoryManager& Open(SharedMemory& shared) { return Open(shared.ptr(), shared.size(), shared.owner()); }
+
+    //! Capacity of the buffer in bytes
+    size_t capacity() const noexcept { return _capacity; }
+    //! Allocated memory in bytes
+    size_t allocated() const noexcept { return (size_t)_allocated.load(std::memory_order_relaxed); }
+    //! Count of active memory allocations
+    size_t allocations() const noexcept { return (size_t)_allocations.load(std::memory_order_relaxed); }
+
+    //! Maximum memory block size, that could be allocated by the memory manager
+    size_t max_size() const noexcept { return _capacity - sizeof(SharedPoolMemoryManager); }
+
+    //! Get the root object pointer
+    void* root() const noexcept;
+    //! Set the root object pointer
+    /*!
+        \param ptr - Root object pointer allocated by the memory manager (nullptr to reset)
+    */
+    void root(void* ptr) noexcept;
+
+    //! Allocate a new memory block of the given size
+    /*!
+        \param size - Block size
+        \param alignment - Block alignment (default is alignof(std::max_align_t))
+        \return A pointer to the allocated memory block or nullptr in case of allocation failed
+    */
+    void* malloc(size_t size, size_t alignment = alignof(std::max_align_t));
+    //! Free the previously allocated memory block
+    /*!
+        \param ptr - Pointer to the memory block
+        \param size - Block size
+    */
+    void free(void* ptr, size_t size);
+
+    //! Reset the memory manager
+    /*!
+        All blocks and the root object pointer are dropped. Must be called when
+        no other process uses the memory manager.
+    */
+    void reset();
+
+private:
+    static constexpr uint32_t MAGIC = 0x4D4D4853;
+    static constexpr size_t MIN_SHIFT = 4;
+    static constexpr size_t CLASSES = 40;
+    static constexpr size_t MAX_ALIGNMENT = 64;
+    // Free list head contains the block offset in 16-byte units and the tag to avoid ABA problem
+    static constexpr size_t OFFSET_BITS = 40;
+    static constexpr uint64_t OFFSET_MASK = (1ull << OFFSET_BITS) - 1;
+
+    std::atomic<uint32_t> _magic;
+    size_t _capacity;
+    std::atomic<uint64_t> _top;
+    std::atomic<uint64_t> _root;
+    std::atomic<uint64_t> _allocated;
+    std::atomic<uint64_t> _allocations;
+    std::atomic<uint64_t> _free[CLASSES];
+
+    uint8_t* base() noexcept { return (uint8_t*)this; }
+    const uint8_t* base() const noexcept { return (const uint8_t*)this; }
+
+    //! Get the size class of the given size
+    static size_t SizeClass(size_t size) noexcept { return (size <= ((size_t)1 << MIN_SHIFT)) ? 0 : (std::bit_width(size - 1) - MIN_SHIFT); }
+    //! Get the block size of the given size class
+    static size_t ClassSize(size_t index) noexcept { return (size_t)1 << (index + MIN_SHIFT); }
+    //! Get the first block offset
+    static uint64_t FirstOffset() noexcept { return (sizeof(SharedPoolMemoryManager) + MAX_ALIGNMENT - 1) & ~(uint64_t)(MAX_ALIGNMENT - 1); }
+};
+
+//! Shared memory pool allocator class
+/*!
+    Shared memory pool allocator implements standard allocator interface with the
+    offset pointer type, so standard containers and HashMap/FlatMap containers
+    allocated by the shared memory manager could be placed into the shared
+    memory and used from all processes which map it:
+
+    \code
+    typedef HashMap<uint64_t, Symbol, std::hash<uint64_t>, std::equal_to<uint64_t>, SharedPoolAllocator<std::pair<uint64_t, Symbol>>> SymbolMap;
+
+    SharedMemory shared("symbols", 64 * 1024 * 1024);
+    SharedPoolMemoryManager& manager = SharedPoolMemoryManager::Open(shared);
+    SharedPoolAllocator<SymbolMap> allocator(manager);
+    if (shared.owner())
+        manager.root(allocator.Create(100000, 0, std::hash<uint64_t>(), std::equal_to<uint64_t>(), allocator));
+    \endcode
+
+    Container elements must not contain raw pointers to the process memory
+    (e.g. std::string should be replaced with fixed size strings).
+
+    Thread-safe and process-safe.
+*/
+template <typename T, bool nothrow = false>
+class SharedPoolAllocator
+{
+    template <typename U, bool flag>
+    friend class SharedPoolAllocator;
+
+public:
+    //! Element type
+    typedef T value_type;
+    //! Pointer to element
+    typedef OffsetPtr<T> pointer;
+    //! Pointer to constant element
+    typedef OffsetPtr<const T> const_pointer;
+    //! Void pointer
+    typedef OffsetPtr<void> void_pointer;
+    //! Pointer to constant void
+    typedef OffsetPtr<const void> const_void_pointer;
+    //! Quantities of elements
+    typedef size_t size_type;
+    //! Difference between two pointers
+    typedef ptrdiff_t difference_type;
+
+    //! Initialize allocator with a given shared memory manager
+    /*!
+        \param manager - Shared memory pool manager
+    */
+    explicit SharedPoolAllocator(SharedPoolMemoryManager& manager) noexcept : _manager(&manager) {}
+    template <typename U>
+    SharedPoolAllocator(const SharedPoolAllocator<U, nothrow>& alloc) noexcept : _manager(alloc._manager) {}
+    SharedPoolAllocator(const SharedPoolAllocator& alloc) noexcept = default;
+    ~SharedPoolAllocator() noexcept = default;
+
+    template <typename U>
+    SharedPoolAllocator& operator=(const SharedPoolAllocator<U, nothrow>& alloc) noexcept
+    { _manager = alloc._manager; return *this; }
+    SharedPoolAllocator& operator=(const SharedPoolAllocator& alloc) noexcept = default;
+
+    //! Shared memory pool manager
+    SharedPoolMemoryManager& manager() const noexcept { return *_manager; }
+
+    //! Get the maximum number of elements, that could potentially be allocated by the allocator
+    size_type max_size() const noexcept { return _manager->max_size() / sizeof(T); }
+
+    //! Allocate a block of storage suitable to contain the given count of elements
+    /*!
+        \param num - Number of elements to be allocated
+        \return A pointer to the initial element in the block of storage
+    */
+    pointer allocate(size_type num);
+    //! Release a block of storage previously allocated
+    /*!
+        \param ptr - Pointer to a block of storage
+        \param num - Number of releasing elements
+    */
+    void deallocate(pointer ptr, size_type num);
+
+    //! Allocate memory and construct a new element in the shared memory
+    /*!
+        \param args - Arguments to initialize the construced element with
+    */
+    template <class... Args>
+    T* Create(Args&&... args);
+    //! Destroy the element and release it from the shared memory
+    /*!
+        \param ptr - Pointer to the object to be released
+    */
+    void Release(T* ptr);
+
+    template <typename U1, typename U2, bool flag>
+    friend bool operator==(const SharedPoolAllocator<U1, flag>& alloc1, const SharedPoolAllocator<U2, flag>& alloc2) noexcept;
+
+    //! Allocator rebind
+    template <typename TOther> struct rebind { using other = SharedPoolAllocator<TOther, nothrow>; };
+
+private:
+    OffsetPtr<SharedPoolMemoryManager> _manager;
+};
+
+} // namespace CppCommon
+
+#include "allocator_shared_pool.inl"
+
+#endif // CPPCOMMON_MEMORY_ALLOCATOR_SHARED_POOL_H
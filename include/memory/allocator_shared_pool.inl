@@ -0,0 +1,196 @@
+/*!
+    \file allocator_shared_pool.inl
+    \brief Shared memory pool allocator inline implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+inline SharedPoolMemoryManager::SharedPoolMemoryManager(size_t capacity) noexcept
+    : _magic(0),
+      _capacity(capacity),
+      _top(FirstOffset()),
+      _root(0),
+      _allocated(0),
+      _allocations(0)
+{
+    assert((capacity >= FirstOffset()) && "Shared memory buffer is too small for the shared memory manager!");
+    assert((((uintptr_t)this % MAX_ALIGNMENT) == 0) && "Shared memory pool manager must be aligned to 64 bytes!");
+
+    for (auto& head : _free)
+        head.store(0, std::memory_order_relaxed);
+
+    // Publish the initialized memory manager for other processes
+    _magic.store(MAGIC, std::memory_order_release);
+}
+
+inline SharedPoolMemoryManager& SharedPoolMemoryManager::Open(void* buffer, size_t capacity, bool owner)
+{
+    assert((buffer != nullptr) && "Shared memory buffer must be valid!");
+
+    if (owner)
+        return *new (buffer) SharedPoolMemoryManager(capacity);
+
+    // Wait for the owner to initialize the memory manager
+    SharedPoolMemoryManager* manager = (SharedPoolMemoryManager*)buffer;
+    while (manager->_magic.load(std::memory_order_acquire) != MAGIC)
+        std::this_thread::yield();
+
+    assert((manager->_capacity == capacity) && "Shared memory pool manager capacity does not match the shared memory buffer!");
+    return *manager;
+}
+
+inline void* SharedPoolMemoryManager::root() const noexcept
+{
+    uint64_t offset = _root.load(std::memory_order_acquire);
+    return (offset == 0) ? nullptr : (void*)(base() + offset);
+}
+
+inline void SharedPoolMemoryManager::root(void* ptr) noexcept
+{
+    assert(((ptr == nullptr) || (((uint8_t*)ptr >= base()) && ((uint8_t*)ptr < (base() + _capacity)))) && "Root object must be allocated by the memory manager!");
+
+    _root.store((ptr == nullptr) ? 0 : (uint64_t)((uint8_t*)ptr - base()), std::memory_order_release);
+}
+
+inline void* SharedPoolMemoryManager::malloc(size_t size, size_t alignment)
+{
+    assert((size > 0) && "Allocated block size must be greater than zero!");
+    assert(Memory::IsValidAlignment(alignment) && "Alignment must be valid!");
+    assert((alignment <= MAX_ALIGNMENT) && "Alignment must not be greater than 64 bytes!");
+
+    size_t index = SizeClass(size);
+    if (index >= CLASSES)
+        return nullptr;
+
+    size_t block = ClassSize(index);
+    assert((alignment <= block) && "Alignment must not be greater than the rounded up block size!");
+
+    uint64_t offset = 0;
+
+    // Pop the block from the size class free list
+    uint64_t head = _free[index].load(std::memory_order_acquire);
+    while ((head & OFFSET_MASK) != 0)
+    {
+        // Next offset could be read from the block concurrently reused by other process, the tag detects it
+        uint64_t next = ((std::atomic<uint64_t>*)(base() + ((head & OFFSET_MASK) << MIN_SHIFT)))->load(std::memory_order_relaxed);
+        uint64_t tagged = (next >> MIN_SHIFT) | ((head & ~OFFSET_MASK) + (1ull << OFFSET_BITS));
+        if (_free[index].compare_exchange_weak(head, tagged, std::memory_order_acquire, std::memory_order_acquire))
+        {
+            offset = (head & OFFSET_MASK) << MIN_SHIFT;
+            break;
+        }
+    }
+
+    // Carve the block from the top of the buffer aligned to the block size (up to 64 bytes)
+    if (offset == 0)
+    {
+        uint64_t align = std::min(block, MAX_ALIGNMENT);
+        uint64_t top = _top.load(std::memory_order_relaxed);
+        do
+        {
+            offset = (top + align - 1) & ~(align - 1);
+            if ((offset + block) > _capacity)
+                return nullptr;
+        } while (!_top.compare_exchange_weak(top, offset + block, std::memory_order_relaxed));
+    }
+
+    // Update allocation statistics
+    _allocated.fetch_add(size, std::memory_order_relaxed);
+    _allocations.fetch_add(1, std::memory_order_relaxed);
+
+    return base() + offset;
+}
+
+inline void SharedPoolMemoryManager::free(void* ptr, size_t size)
+{
+    assert((ptr != nullptr) && "Deallocated block must be valid!");
+    assert((((uint8_t*)ptr >= base()) && ((uint8_t*)ptr < (base() + _capacity))) && "Deallocated block must be allocated by the memory manager!");
+
+    size_t index = SizeClass(size);
+    uint64_t offset = (uint64_t)((uint8_t*)ptr - base());
+
+    // Push the block into the size class free list
+    std::atomic<uint64_t>* next = (std::atomic<uint64_t>*)ptr;
+    uint64_t head = _free[index].load(std::memory_order_relaxed);
+    uint64_t tagged;
+    do
+    {
+        next->store((head & OFFSET_MASK) << MIN_SHIFT, std::memory_order_relaxed);
+        tagged = (offset >> MIN_SHIFT) | ((head & ~OFFSET_MASK) + (1ull << OFFSET_BITS));
+    } while (!_free[index].compare_exchange_weak(head, tagged, std::memory_order_release, std::memory_order_relaxed));
+
+    // Update allocation statistics
+    _allocated.fetch_sub(size, std::memory_order_relaxed);
+    _allocations.fetch_sub(1, std::memory_order_relaxed);
+}
+
+inline void SharedPoolMemoryManager::reset()
+{
+    assert((allocated() == 0) && "Memory leak detected! Allocated memory size must be zero!");
+    assert((allocations() == 0) && "Memory leak detected! Count of active memory allocations must be zero!");
+
+    for (auto& head : _free)
+        head.store(0, std::memory_order_relaxed);
+    _root.store(0, std::memory_order_relaxed);
+    _top.store(FirstOffset(), std::memory_order_relaxed);
+    _allocated.store(0, std::memory_order_relaxed);
+    _allocations.store(0, std::memory_order_relaxed);
+}
+
+template <typename T, bool nothrow>
+inline typename SharedPoolAllocator<T, nothrow>::pointer SharedPoolAllocator<T, nothrow>::allocate(size_type num)
+{
+    T* result = (T*)_manager->malloc(num * sizeof(T), alignof(T));
+    if (result != nullptr)
+        return pointer(result);
+
+    // Not enough memory...
+    if (nothrow)
+        return pointer();
+    else
+        throw std::bad_alloc();
+}
+
+template <typename T, bool nothrow>
+inline void SharedPoolAllocator<T, nothrow>::deallocate(pointer ptr, size_type num)
+{
+    _manager->free(ptr.get(), num * sizeof(T));
+}
+
+template <typename T, bool nothrow>
+template <class... Args>
+inline T* SharedPoolAllocator<T, nothrow>::Create(Args&&... args)
+{
+    // Allocate memory for the element
+    void* ptr = _manager->malloc(sizeof(T), alignof(T));
+
+    // Construct the element
+    if (ptr != nullptr)
+        new (ptr) T(std::forward<Args>(args)...);
+    else if (!nothrow)
+        throw std::bad_alloc();
+
+    return (T*)ptr;
+}
+
+template <typename T, bool nothrow>
+inline void SharedPoolAllocator<T, nothrow>::Release(T* ptr)
+{
+    // Destroy the element and release the memory
+    if (ptr != nullptr)
+    {
+        ptr->~T();
+        _manager->free(ptr, sizeof(T));
+    }
+}
+
+template <typename U1, typename U2, bool flag>
+inline bool operator==(const SharedPoolAllocator<U1, flag>& alloc1, const SharedPoolAllocator<U2, flag>& alloc2) noexcept
+{
+    return alloc1._manager == alloc2._manager;
+}
+
+} // namespace CppCommon
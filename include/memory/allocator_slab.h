@@ -0,0 +1,171 @@
+/*!
+    \file allocator_slab.h
+    \brief Slab memory allocator definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_MEMORY_ALLOCATOR_SLAB_H
+#define CPPCOMMON_MEMORY_ALLOCATOR_SLAB_H
+
+#include "allocator.h"
+
+#include <vector>
+
+namespace CppCommon {
+
+//! Slab memory manager class
+/*!
+    Slab memory manager serves memory blocks of fixed size classes. Each size
+    class has its own free list of blocks and its own slabs (memory pages  of
+    the same size) allocated in bulk from the auxiliary memory manager. The
+    block is allocated from the smallest fitting size class, so allocation and
+    free are O(1) and containers of mixed-size nodes do not fragment memory.
+
+    Default size classes are 16 to 2048 bytes with four classes per power  of
+    two. Custom size classes could be provided to fit the known object sizes
+    exactly. Blocks greater than the biggest size class are allocated directly
+    from the auxiliary memory manager.
+
+    Slab blocks are aligned to alignof(std::max_align_t), greater alignments
+    are not supported.
+
+    Not thread-safe.
+*/
+template <class TAuxMemoryManager = DefaultMemoryManager>
+class SlabMemoryManager
+{
+public:
+    //! Initialize slab memory manager with an auxiliary memory manager
+    /*!
+        Slab memory manager will have default size classes and slabs of size 65536.
+
+        \param auxiliary - Auxiliary memory manager
+    */
+    explicit SlabMemoryManager(TAuxMemoryManager& auxiliary) : SlabMemoryManager(auxiliary, DefaultClasses(), 65536) {}
+    //! Initialize slab memory manager with an auxiliary memory manager, size classes and a slab size
+    /*!
+        \param auxiliary - Auxiliary memory manager
+        \param classes - Size classes in bytes (will be rounded up to alignof(std::max_align_t))
+        \param slab - Slab size in bytes (must fit the biggest size class, default is 65536)
+    */
+    explicit SlabMemoryManager(TAuxMemoryManager& auxiliary, const std::vector<size_t>& classes, size_t slab = 65536);
+    SlabMemoryManager(const SlabMemoryManager&) = delete;
+    SlabMemoryManager(SlabMemoryManager&&) = delete;
+    ~SlabMemoryManager() { clear(); }
+
+    SlabMemoryManager& operator=(const SlabMemoryManager&) = delete;
+    SlabMemoryManager& operator=(SlabMemoryManager&&) = delete;
+
+    //! Allocated memory in bytes
+    size_t allocated() const noexcept { return _allocated; }
+    //! Count of active memory allocations
+    size_t allocations() const noexcept { return _allocations; }
+
+    //! Slab size in bytes
+    size_t slab() const noexcept { return _slab; }
+    //! Count of allocated slabs
+    size_t slabs() const noexcept { return _slabs; }
+    //! Count of size classes
+    size_t classes() const noexcept { return _classes.size(); }
+    //! Block size of the given size class
+    size_t class_size(size_t index) const noexcept { return _classes[index].size; }
+
+    //! Maximum memory block size, that could be allocated by the memory manager
+    size_t max_size() const noexcept { return _auxiliary.max_size(); }
+
+    //! Auxiliary memory manager
+    TAuxMemoryManager& auxiliary() noexcept { return _auxiliary; }
+
+    //! Allocate a new memory block of the given size
+    /*!
+        \param size - Block size
+        \param alignment - Block alignment (default is alignof(std::max_align_t))
+        \return A pointer to the allocated memory block or nullptr in case of allocation failed
+    */
+    void* malloc(size_t size, size_t alignment = alignof(std::max_align_t));
+    //! Free the previously allocated memory block
+    /*!
+        \param ptr - Pointer to the memory block
+        \param size - Block size
+    */
+    void free(void* ptr, size_t size);
+
+    //! Reset the memory manager
+    /*!
+        Allocated slabs are kept and reused for the next allocations.
+    */
+    void reset();
+
+    //! Clear the memory manager
+    /*!
+        Allocated slabs are returned to the auxiliary memory manager.
+    */
+    void clear();
+
+    //! Get default size classes
+    static std::vector<size_t> DefaultClasses();
+
+private:
+    static const size_t GRANULARITY = alignof(std::max_align_t);
+
+    // Slab page
+    struct Slab
+    {
+        Slab* next;
+    };
+    // Free block
+    struct Block
+    {
+        Block* next;
+    };
+    // Size class
+    struct SizeClass
+    {
+        size_t size;
+        Block* free;
+        uint8_t* current;
+        uint8_t* end;
+        Slab* first;
+        Slab* last;
+        Slab* active;
+
+        explicit SizeClass(size_t s) noexcept : size(s), free(nullptr), current(nullptr), end(nullptr), first(nullptr), last(nullptr), active(nullptr) {}
+    };
+
+    // Allocation statistics
+    size_t _allocated;
+    size_t _allocations;
+
+    // Auxiliary memory manager
+    TAuxMemoryManager& _auxiliary;
+
+    // Size classes
+    size_t _slab;
+    size_t _slabs;
+    std::vector<SizeClass> _classes;
+    // Size class index by the block size in granularity units
+    std::vector<uint8_t> _lookup;
+
+    //! Use the next slab of the given size class
+    bool NextSlab(SizeClass& sc);
+    //! Get the blocks storage of the given slab
+    static uint8_t* SlabBuffer(Slab* slab) noexcept { return (uint8_t*)Memory::Align((uint8_t*)slab + sizeof(Slab), GRANULARITY); }
+};
+
+//! Slab memory allocator class
+template <typename T, class TAuxMemoryManager = DefaultMemoryManager, bool nothrow = false>
+using SlabAllocator = Allocator<T, SlabMemoryManager<TAuxMemoryManager>, nothrow>;
+
+//! Slab memory resource class
+template <class TAuxMemoryManager = DefaultMemoryManager>
+using SlabMemoryResource = MemoryResource<SlabMemoryManager<TAuxMemoryManager>>;
+
+/*! \example memory_slab.cpp Slab memory allocator example */
+
+} // namespace CppCommon
+
+#include "allocator_slab.inl"
+
+#endif // CPPCOMMON_MEMORY_ALLOCATOR_SLAB_H
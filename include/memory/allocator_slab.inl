@@ -0,0 +1,201 @@
+/*!
+    \file allocator_slab.inl
+    \brief Slab memory allocator inline implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+template <class TAuxMemoryManager>
+inline SlabMemoryManager<TAuxMemoryManager>::SlabMemoryManager(TAuxMemoryManager& auxiliary, const std::vector<size_t>& classes, size_t slab)
+    : _allocated(0),
+      _allocations(0),
+      _auxiliary(auxiliary),
+      _slab(slab),
+      _slabs(0)
+{
+    assert(!classes.empty() && "Slab memory manager must have at least one size class!");
+
+    // Prepare sorted unique size classes rounded up to the granularity
+    std::vector<size_t> sizes;
+    for (size_t size : classes)
+    {
+        assert((size > 0) && "Size class must be greater than zero!");
+        sizes.push_back(((size + GRANULARITY - 1) / GRANULARITY) * GRANULARITY);
+    }
+    std::sort(sizes.begin(), sizes.end());
+    sizes.erase(std::unique(sizes.begin(), sizes.end()), sizes.end());
+
+    assert((sizes.size() <= 256) && "Slab memory manager supports up to 256 size classes!");
+    assert((sizes.back() <= slab) && "Slab must fit the biggest size class!");
+
+    for (size_t size : sizes)
+        _classes.emplace_back(size);
+
+    // Fill the size class lookup table
+    _lookup.resize(sizes.back() / GRANULARITY + 1);
+    size_t index = 0;
+    for (size_t i = 0; i < _lookup.size(); ++i)
+    {
+        while (_classes[index].size < (i * GRANULARITY))
+            ++index;
+        _lookup[i] = (uint8_t)index;
+    }
+}
+
+template <class TAuxMemoryManager>
+inline void* SlabMemoryManager<TAuxMemoryManager>::malloc(size_t size, size_t alignment)
+{
+    assert((size > 0) && "Allocated block size must be greater than zero!");
+    assert(Memory::IsValidAlignment(alignment) && "Alignment must be valid!");
+
+    // Allocate huge blocks using the auxiliary memory manager
+    if (size > _classes.back().size)
+    {
+        void* result = _auxiliary.malloc(size, alignment);
+        if (result != nullptr)
+        {
+            // Update allocation statistics
+            _allocated += size;
+            ++_allocations;
+        }
+        return result;
+    }
+
+    assert((alignment <= GRANULARITY) && "Slab blocks alignment must not be greater than alignof(std::max_align_t)!");
+
+    SizeClass& sc = _classes[_lookup[(size + GRANULARITY - 1) / GRANULARITY]];
+
+    void* result;
+    if (sc.free != nullptr)
+    {
+        // Allocate the block from the free list
+        result = sc.free;
+        sc.free = sc.free->next;
+    }
+    else
+    {
+        // Allocate the block from the current slab
+        if (((size_t)(sc.end - sc.current) < sc.size) && !NextSlab(sc))
+            return nullptr;
+        result = sc.current;
+        sc.current += sc.size;
+    }
+
+    // Update allocation statistics
+    _allocated += size;
+    ++_allocations;
+
+    return result;
+}
+
+template <class TAuxMemoryManager>
+inline void SlabMemoryManager<TAuxMemoryManager>::free(void* ptr, size_t size)
+{
+    assert((ptr != nullptr) && "Deallocated block must be valid!");
+
+    // Deallocate huge blocks using the auxiliary memory manager
+    if (size > _classes.back().size)
+    {
+        _auxiliary.free(ptr, size);
+
+        // Update allocation statistics
+        _allocated -= size;
+        --_allocations;
+
+        return;
+    }
+
+    SizeClass& sc = _classes[_lookup[(size + GRANULARITY - 1) / GRANULARITY]];
+
+    // Return the block into the free list
+    Block* block = (Block*)ptr;
+    block->next = sc.free;
+    sc.free = block;
+
+    // Update allocation statistics
+    _allocated -= size;
+    --_allocations;
+}
+
+template <class TAuxMemoryManager>
+inline void SlabMemoryManager<TAuxMemoryManager>::reset()
+{
+    assert((_allocated == 0) && "Memory leak detected! Allocated memory size must be zero!");
+    assert((_allocations == 0) && "Memory leak detected! Count of active memory allocations must be zero!");
+
+    // Rewind all size classes to their first slabs
+    for (auto& sc : _classes)
+    {
+        sc.free = nullptr;
+        sc.active = sc.first;
+        sc.current = (sc.active != nullptr) ? SlabBuffer(sc.active) : nullptr;
+        sc.end = (sc.active != nullptr) ? (sc.current + _slab) : nullptr;
+    }
+}
+
+template <class TAuxMemoryManager>
+inline void SlabMemoryManager<TAuxMemoryManager>::clear()
+{
+    assert((_allocated == 0) && "Memory leak detected! Allocated memory size must be zero!");
+    assert((_allocations == 0) && "Memory leak detected! Count of active memory allocations must be zero!");
+
+    // Return all slabs to the auxiliary memory manager
+    for (auto& sc : _classes)
+    {
+        while (sc.first != nullptr)
+        {
+            Slab* next = sc.first->next;
+            _auxiliary.free(sc.first, sizeof(Slab) + _slab + GRANULARITY);
+            sc.first = next;
+        }
+        sc.free = nullptr;
+        sc.current = nullptr;
+        sc.end = nullptr;
+        sc.last = nullptr;
+        sc.active = nullptr;
+    }
+    _slabs = 0;
+}
+
+template <class TAuxMemoryManager>
+inline std::vector<size_t> SlabMemoryManager<TAuxMemoryManager>::DefaultClasses()
+{
+    // Four size classes for each power of two from 16 to 2048 bytes
+    std::vector<size_t> result = { 16, 32, 48, 64 };
+    for (size_t base = 64; base < 2048; base *= 2)
+        for (size_t i = 1; i <= 4; ++i)
+            result.push_back(base + (base / 4) * i);
+    return result;
+}
+
+template <class TAuxMemoryManager>
+inline bool SlabMemoryManager<TAuxMemoryManager>::NextSlab(SizeClass& sc)
+{
+    // Reuse the next slab kept by the previous reset
+    if ((sc.active != nullptr) && (sc.active->next != nullptr))
+        sc.active = sc.active->next;
+    else
+    {
+        // Allocate a new slab from the auxiliary memory manager
+        Slab* slab = (Slab*)_auxiliary.malloc(sizeof(Slab) + _slab + GRANULARITY);
+        if (slab == nullptr)
+            return false;
+        slab->next = nullptr;
+        if (sc.last != nullptr)
+            sc.last->next = slab;
+        else
+            sc.first = slab;
+        sc.last = slab;
+        sc.active = slab;
+        ++_slabs;
+    }
+
+    sc.current = SlabBuffer(sc.active);
+    sc.end = sc.current + _slab;
+    return true;
+}
+
+} // namespace CppCommon
@@ -86,6 +86,10 @@ private:
 template <typename T, size_t N, bool nothrow = false>
 using StackAllocator = Allocator<T, StackMemoryManager<N>, nothrow>;
 
+//! Stack memory resource class
+template <size_t N>
+using StackMemoryResource = MemoryResource<StackMemoryManager<N>>;
+
 } // namespace CppCommon
 
 #include "allocator_stack.inl"
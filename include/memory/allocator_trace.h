@@ -0,0 +1,224 @@
+/*!
+    \file allocator_trace.h
+    \brief Tracing memory allocator definition
+    \author Ivan Shynkarenka
+    \date 15.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_MEMORY_ALLOCATOR_TRACE_H
+#define CPPCOMMON_MEMORY_ALLOCATOR_TRACE_H
+
+#include "allocator.h"
+#include "filesystem/path.h"
+#include "time/timestamp.h"
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace CppCommon {
+
+//! Allocation trace event
+struct AllocationEvent
+{
+    uint64_t block;         //!< Block Id (index of the block allocation in the trace)
+    uint64_t size;          //!< Block size
+    uint32_t alignment;     //!< Block alignment
+    uint32_t thread;        //!< Dense index of the thread (see Thread::CurrentThreadIndex())
+    bool free;              //!< Free event ('false' for the allocation event)
+};
+
+//! Allocation trace replay result
+struct AllocationReplay
+{
+    uint64_t events{0};         //!< Count of replayed events
+    uint64_t failures{0};       //!< Count of failed allocations
+    Timespan duration;          //!< Replay duration
+    uint64_t peak_live{0};      //!< Peak of live requested bytes
+    uint64_t peak_rss{0};       //!< Peak growth of the process resident set size in bytes
+
+    //! Replayed events per second
+    double throughput() const noexcept { return (duration.total() > 0) ? (events * 1000000000.0 / duration.total()) : 0.0; }
+    //! Fragmentation (share of the resident set size growth not used by live blocks at the peak)
+    double fragmentation() const noexcept { return (peak_rss > peak_live) ? (1.0 - (double)peak_live / (double)peak_rss) : 0.0; }
+};
+
+//! Allocation trace
+/*!
+    Allocation trace records the sequence of memory allocations and frees with
+    their sizes, alignments and threads in the global order. Traces recorded by
+    TraceMemoryManager from real services could be saved into the file, loaded
+    and replayed against different memory managers to choose the best of them
+    by throughput, peak resident set size and fragmentation.
+
+    Thread-safe.
+*/
+class AllocationTrace
+{
+public:
+    AllocationTrace() : _allocations(0), _live(0), _peak(0) {}
+    AllocationTrace(const AllocationTrace&) = delete;
+    AllocationTrace(AllocationTrace&&) = delete;
+    ~AllocationTrace() = default;
+
+    AllocationTrace& operator=(const AllocationTrace&) = delete;
+    AllocationTrace& operator=(AllocationTrace&&) = delete;
+
+    //! Is the allocation trace empty?
+    bool empty() const;
+    //! Get the count of recorded events
+    size_t size() const;
+    //! Get the count of recorded allocations
+    uint64_t allocations() const;
+    //! Get the peak of live requested bytes
+    uint64_t peak() const;
+    //! Get the count of recorded threads
+    size_t threads() const;
+
+    //! Get recorded events
+    /*!
+        Events must not be recorded while the result is in use.
+    */
+    const std::vector<AllocationEvent>& events() const noexcept { return _events; }
+
+    //! Record the allocation of the block in the current thread
+    /*!
+        \param size - Block size
+        \param alignment - Block alignment
+        \return Block Id
+    */
+    uint64_t Allocate(size_t size, size_t alignment);
+    //! Record the free of the block in the current thread
+    /*!
+        \param block - Block Id
+        \param size - Block size
+    */
+    void Free(uint64_t block, size_t size);
+
+    //! Clear all recorded events
+    void Clear();
+
+    //! Save the allocation trace into the given file
+    /*!
+        \param path - File path
+    */
+    void Save(const Path& path) const;
+    //! Load the allocation trace from the given file
+    /*!
+        Throws std::invalid_argument if the file is not the valid allocation trace.
+
+        \param path - File path
+    */
+    void Load(const Path& path);
+
+    //! Replay the allocation trace against the given memory manager
+    /*!
+        In single thread mode all events are replayed in the calling thread in
+        the recorded global order, so any memory manager could be replayed.
+
+        In multiple threads mode events of each recorded thread are replayed in
+        a separate thread. Frees of blocks allocated by other threads wait until
+        the block is allocated, so the memory manager must be thread-safe.
+
+        Resident set size of the process is sampled every 4096 events, so its
+        peak is approximate. Memory freed by previous replays and kept by the
+        process heap is not counted in the resident set size growth.
+
+        \param manager - Memory manager to replay
+        \param threads - Replay threads of the trace in multiple threads (default is false)
+        \return Replay result
+    */
+    template <class TMemoryManager>
+    AllocationReplay Replay(TMemoryManager& manager, bool threads = false) const;
+
+private:
+    mutable std::mutex _lock;
+    std::vector<AllocationEvent> _events;
+    uint64_t _allocations;
+    uint64_t _live;
+    uint64_t _peak;
+
+    //! Get the current resident set size of the process
+    static uint64_t CurrentRSS();
+};
+
+//! Tracing memory manager class
+/*!
+    Tracing memory manager wraps another memory manager and records all its
+    allocations and frees into the allocation trace. Each event takes the
+    trace lock, so the tracing memory manager is intended to capture traces
+    of representative workloads rather than to run in production.
+
+    Thread-safety is the same as of the wrapped memory manager.
+*/
+template <class TMemoryManager = DefaultMemoryManager>
+class TraceMemoryManager
+{
+public:
+    //! Initialize tracing memory manager with a wrapped memory manager and an allocation trace
+    /*!
+        \param manager - Wrapped memory manager
+        \param trace - Allocation trace to record
+    */
+    explicit TraceMemoryManager(TMemoryManager& manager, AllocationTrace& trace) : _manager(manager), _trace(trace) {}
+    TraceMemoryManager(const TraceMemoryManager&) = delete;
+    TraceMemoryManager(TraceMemoryManager&&) = delete;
+    ~TraceMemoryManager() = default;
+
+    TraceMemoryManager& operator=(const TraceMemoryManager&) = delete;
+    TraceMemoryManager& operator=(TraceMemoryManager&&) = delete;
+
+    //! Allocated memory in bytes
+    size_t allocated() const noexcept { return _manager.allocated(); }
+    //! Count of active memory allocations
+    size_t allocations() const noexcept { return _manager.allocations(); }
+
+    //! Maximum memory block size, that could be allocated by the memory manager
+    size_t max_size() const noexcept { return _manager.max_size(); }
+
+    //! Wrapped memory manager
+    TMemoryManager& auxiliary() noexcept { return _manager; }
+    //! Allocation trace
+    AllocationTrace& trace() noexcept { return _trace; }
+
+    //! Allocate a new memory block of the given size
+    /*!
+        \param size - Block size
+        \param alignment - Block alignment (default is alignof(std::max_align_t))
+        \return A pointer to the allocated memory block or nullptr in case of allocation failed
+    */
+    void* malloc(size_t size, size_t alignment = alignof(std::max_align_t));
+    //! Free the previously allocated memory block
+    /*!
+        \param ptr - Pointer to the memory block
+        \param size - Block size
+    */
+    void free(void* ptr, size_t size);
+
+    //! Reset the memory manager
+    void reset() { _manager.reset(); }
+
+private:
+    TMemoryManager& _manager;
+    AllocationTrace& _trace;
+    std::mutex _lock;
+    std::unordered_map<void*, uint64_t> _blocks;
+};
+
+//! Tracing memory allocator class
+template <typename T, class TMemoryManager = DefaultMemoryManager, bool nothrow = false>
+using TraceAllocator = Allocator<T, TraceMemoryManager<TMemoryManager>, nothrow>;
+
+//! Tracing memory resource class
+template <class TMemoryManager = DefaultMemoryManager>
+using TraceMemoryResource = MemoryResource<TraceMemoryManager<TMemoryManager>>;
+
+} // namespace CppCommon
+
+#include "allocator_trace.inl"
+
+#endif // CPPCOMMON_MEMORY_ALLOCATOR_TRACE_H
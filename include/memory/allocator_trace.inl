@@ -0,0 +1,174 @@
+/*!
+    \file allocator_trace.inl
+    \brief Tracing memory allocator inline implementation
+    \author Ivan Shynkarenka
+    \date 15.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+namespace Internals {
+
+// Marker of the failed allocation in the replay
+inline void* ReplayFailed() noexcept { return (void*)(uintptr_t)1; }
+
+// Touch each page of the allocated block to make it resident
+inline void ReplayTouch(void* ptr, size_t size) noexcept
+{
+    volatile uint8_t* data = (volatile uint8_t*)ptr;
+    for (size_t offset = 0; offset < size; offset += 4096)
+        data[offset] = 0;
+}
+
+// Update the peak of the sampled value
+inline void ReplayPeak(std::atomic<uint64_t>& peak, uint64_t value) noexcept
+{
+    uint64_t current = peak.load(std::memory_order_relaxed);
+    while ((value > current) && !peak.compare_exchange_weak(current, value, std::memory_order_relaxed));
+}
+
+} // namespace Internals
+//! @endcond
+
+template <class TMemoryManager>
+inline AllocationReplay AllocationTrace::Replay(TMemoryManager& manager, bool threads) const
+{
+    std::scoped_lock locker(_lock);
+
+    AllocationReplay result;
+    result.events = _events.size();
+    result.peak_live = _peak;
+
+    const uint64_t baseline = CurrentRSS();
+    std::atomic<uint64_t> rss(baseline);
+    std::atomic<uint64_t> failures(0);
+
+    // Replayed blocks and their sizes by block Id
+    std::unique_ptr<std::atomic<void*>[]> blocks(new std::atomic<void*>[_allocations]);
+    std::vector<uint64_t> sizes(_allocations);
+    for (uint64_t i = 0; i < _allocations; ++i)
+        blocks[i].store(nullptr, std::memory_order_relaxed);
+    for (const auto& event : _events)
+        if (!event.free)
+            sizes[event.block] = event.size;
+
+    // Replay the given event
+    auto replay = [&manager, &blocks, &failures](const AllocationEvent& event)
+    {
+        if (!event.free)
+        {
+            void* ptr = manager.malloc((size_t)event.size, (size_t)event.alignment);
+            if (ptr != nullptr)
+                Internals::ReplayTouch(ptr, (size_t)event.size);
+            else
+            {
+                failures.fetch_add(1, std::memory_order_relaxed);
+                ptr = Internals::ReplayFailed();
+            }
+            blocks[event.block].store(ptr, std::memory_order_release);
+        }
+        else
+        {
+            // Wait for the block allocated by another thread
+            void* ptr;
+            while ((ptr = blocks[event.block].load(std::memory_order_acquire)) == nullptr)
+                std::this_thread::yield();
+            if (ptr != Internals::ReplayFailed())
+                manager.free(ptr, (size_t)event.size);
+            blocks[event.block].store(Internals::ReplayFailed(), std::memory_order_relaxed);
+        }
+    };
+
+    uint64_t timestamp = Timestamp::nano();
+
+    if (!threads)
+    {
+        for (size_t i = 0; i < _events.size(); ++i)
+        {
+            replay(_events[i]);
+            if ((i % 4096) == 0)
+                Internals::ReplayPeak(rss, CurrentRSS());
+        }
+    }
+    else
+    {
+        // Split events by recorded threads
+        std::vector<std::vector<const AllocationEvent*>> events;
+        for (const auto& event : _events)
+        {
+            if (event.thread >= events.size())
+                events.resize(event.thread + 1);
+            events[event.thread].push_back(&event);
+        }
+
+        std::vector<std::thread> workers;
+        for (const auto& thread : events)
+        {
+            if (thread.empty())
+                continue;
+
+            workers.emplace_back([&replay, &rss, &thread]()
+            {
+                for (size_t i = 0; i < thread.size(); ++i)
+                {
+                    replay(*thread[i]);
+                    if ((i % 4096) == 0)
+                        Internals::ReplayPeak(rss, CurrentRSS());
+                }
+            });
+        }
+        for (auto& worker : workers)
+            worker.join();
+    }
+
+    Internals::ReplayPeak(rss, CurrentRSS());
+    result.duration = Timespan(Timestamp::nano() - timestamp);
+    result.failures = failures.load();
+    result.peak_rss = rss.load() - baseline;
+
+    // Free blocks which were not freed in the trace
+    for (uint64_t i = 0; i < _allocations; ++i)
+    {
+        void* ptr = blocks[i].load(std::memory_order_relaxed);
+        if ((ptr != nullptr) && (ptr != Internals::ReplayFailed()))
+            manager.free(ptr, (size_t)sizes[i]);
+    }
+
+    return result;
+}
+
+template <class TMemoryManager>
+inline void* TraceMemoryManager<TMemoryManager>::malloc(size_t size, size_t alignment)
+{
+    void* result = _manager.malloc(size, alignment);
+    if (result != nullptr)
+    {
+        std::scoped_lock locker(_lock);
+        _blocks[result] = _trace.Allocate(size, alignment);
+    }
+    return result;
+}
+
+template <class TMemoryManager>
+inline void TraceMemoryManager<TMemoryManager>::free(void* ptr, size_t size)
+{
+    assert((ptr != nullptr) && "Deallocated block must be valid!");
+
+    if (ptr != nullptr)
+    {
+        // Record the free before the block could be reused
+        std::scoped_lock locker(_lock);
+        auto it = _blocks.find(ptr);
+        if (it != _blocks.end())
+        {
+            _trace.Free(it->second, size);
+            _blocks.erase(it);
+        }
+    }
+
+    _manager.free(ptr, size);
+}
+
+} // namespace CppCommon
@@ -44,8 +44,31 @@ public:
     //! Free RAM in bytes
     static int64_t RamFree();
 
+    //! Memory limit of the current process cgroup in bytes
+    /*!
+        Linux cgroup v2 (memory.max) and cgroup v1 (memory.limit_in_bytes)
+        limits are detected. The tightest limit of the process cgroup and its
+        ancestors is returned, because each of them is enforced.
+
+        \return Memory limit in bytes or -1 if the process is not limited by its cgroup (or on other platforms)
+    */
+    static int64_t CgroupLimit();
+    //! Memory usage of the current process cgroup in bytes
+    /*!
+        Usage is the working set of the cgroup: charged memory without inactive
+        file pages, which are reclaimed before the cgroup runs out of memory.
+        The same working set is compared with the limit by the container
+        orchestrators (e.g. Kubernetes) to decide about the OOM kill.
+
+        \return Memory usage in bytes or -1 if it is unknown (or on other platforms)
+    */
+    static int64_t CgroupUsage();
+
     //! Is the given memory buffer filled with zeros?
     /*!
+        Memory buffer is checked with SIMD blocks (AVX2, SSE2 or NEON) or
+        64-bit words and stops at the first non-zero block.
+
         \param buffer - Memory buffer
         \param size - Size of memory buffer in bytes
         \return 'true' if the given memory buffer is filled with zeros, 'false' if the memory buffer is not filled with zeros
@@ -78,18 +101,79 @@ public:
     template <typename T>
     static T* Align(const T* address, size_t alignment = alignof(T), bool upwards = true) noexcept;
 
+    //! Prefetch the cache line of the given address for reading
+    /*!
+        Prefetch is only a hint, the address may be invalid or nullptr.
+
+        \param address - Address
+    */
+    static void Prefetch(const void* address) noexcept;
+
     //! Fill the given memory buffer with zeros
     /*!
+        Zero fill is never optimized away by the compiler, so it could be used
+        to wipe sensitive data which is not read anymore.
+
         \param buffer - Memory buffer to fill
         \param size - Size of memory buffer in bytes
     */
     static void ZeroFill(void* buffer, size_t size);
+    //! Fill the given memory buffer with the given byte using non-temporal stores
+    /*!
+        Non-temporal stores write big buffers directly into the memory and do
+        not evict the hot working set from the CPU cache. Buffers smaller than
+        the CPU cache are still filled with regular stores, because they are
+        likely to be read soon. Platforms without non-temporal stores always
+        use memset().
+
+        \param buffer - Memory buffer to fill
+        \param size - Size of memory buffer in bytes
+        \param value - Byte value to fill (default is 0)
+    */
+    static void StreamFill(void* buffer, size_t size, uint8_t value = 0) noexcept;
+    //! Copy the given memory buffer using non-temporal stores
+    /*!
+        The same as StreamFill() the destination memory buffer is written
+        bypassing the CPU cache if it is big enough. Source and destination
+        memory buffers must not overlap.
+
+        \param destination - Destination memory buffer
+        \param source - Source memory buffer
+        \param size - Size of memory buffers in bytes
+    */
+    static void StreamCopy(void* destination, const void* source, size_t size) noexcept;
     //! Fill the given memory buffer with random bytes
     /*!
+        Random bytes are taken from the operating system random number
+        generator (getrandom() on Linux, arc4random_buf() on Apple platforms,
+        BCryptGenRandom() on Windows and the cached '/dev/urandom' file
+        descriptor on other platforms) with the single system call in most
+        cases.
+
         \param buffer - Memory buffer to fill
         \param size - Size of memory buffer in bytes
     */
     static void RandomFill(void* buffer, size_t size);
+    //! Fill the given memory buffer with fast non-cryptographic random bytes
+    /*!
+        Random bytes are generated in bulk by the per-thread xoshiro256**
+        generator seeded from RandomFill() on the first use in the thread.
+        Do not use it for secrets, use CryptoFill() instead.
+
+        \param buffer - Memory buffer to fill
+        \param size - Size of memory buffer in bytes
+    */
+    static void FastRandomFill(void* buffer, size_t size);
+    //! Fill the given memory buffer with fast non-cryptographic random bytes of the given seed
+    /*!
+        The same seed always generates the same sequence of random bytes, so
+        it could be used to reproduce test data.
+
+        \param buffer - Memory buffer to fill
+        \param size - Size of memory buffer in bytes
+        \param seed - Random seed
+    */
+    static void FastRandomFill(void* buffer, size_t size, uint64_t seed) noexcept;
     //! Fill the given memory buffer with cryptographic strong random bytes
     /*!
         \param buffer - Memory buffer to fill
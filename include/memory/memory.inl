@@ -8,6 +8,10 @@
 
 #include <cstdint>
 
+#if defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+#include <xmmintrin.h>
+#endif
+
 namespace CppCommon {
 
 inline bool Memory::IsValidAlignment(size_t alignment) noexcept
@@ -39,4 +43,15 @@ inline T* Memory::Align(const T* address, size_t alignment, bool upwards) noexce
         return (T*)(ptr & -((int)alignment));
 }
 
+inline void Memory::Prefetch(const void* address) noexcept
+{
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(address, 0, 3);
+#elif defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+    _mm_prefetch((const char*)address, _MM_HINT_T0);
+#else
+    (void)address;
+#endif
+}
+
 } // namespace CppCommon
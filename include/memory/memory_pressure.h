@@ -0,0 +1,145 @@
+/*!
+    \file memory_pressure.h
+    \brief Memory pressure notifier definition
+    \author Ivan Shynkarenka
+    \date 15.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_MEMORY_MEMORY_PRESSURE_H
+#define CPPCOMMON_MEMORY_MEMORY_PRESSURE_H
+
+#include "common/function.h"
+#include "time/timespan.h"
+
+#include <cstdint>
+#include <memory>
+
+namespace CppCommon {
+
+//! Memory usage against the memory limit
+struct MemoryUsage
+{
+    int64_t limit{-1};      //!< Memory limit in bytes (-1 if unknown)
+    int64_t usage{-1};      //!< Memory usage in bytes (-1 if unknown)
+    bool cgroup{false};     //!< Is the memory limit the cgroup one? ('false' for the host RAM)
+
+    //! Get the ratio of the memory usage to the memory limit (0 if unknown)
+    double ratio() const noexcept { return ((limit > 0) && (usage >= 0)) ? ((double)usage / (double)limit) : 0.0; }
+
+    //! Get the current memory usage
+    /*!
+        Cgroup limit and working set usage are used if the process is limited
+        by its cgroup (e.g. a Kubernetes container), otherwise the host RAM.
+    */
+    static MemoryUsage Current();
+};
+
+//! Memory pressure notifier
+/*!
+    Memory pressure notifier calls subscribed callbacks when the process is
+    close to running out of memory, so caches and pools could shed their
+    content instead of the process being killed by the OOM killer.
+
+    Memory pressure is detected:
+    - when the memory usage ratio reaches the given threshold (cgroup limit
+      and usage if the process is limited, host RAM otherwise);
+    - on Linux pressure stall information (PSI) trigger of the process
+      cgroup or of the whole system, which fires when tasks are stalled
+      waiting for memory reclaim (if PSI is supported and permitted).
+
+    Memory pressure notifier could be driven by the caller with Poll() method
+    (e.g. from a timer) or by the dedicated thread started with Start()
+    method. While the pressure lasts subscribers are notified on each check,
+    so they could shed more on the next check if the first shedding was not
+    enough. After callbacks are called free memory of the process heap is
+    returned to the system (glibc malloc_trim), so the cgroup usage drops.
+
+    Callbacks are called with the subscribers lock held, so Unsubscribe()
+    waits for the running callback. Callbacks must not subscribe, unsubscribe
+    and throw.
+
+    Thread-safe.
+*/
+class MemoryPressure
+{
+public:
+    //! Memory pressure callback with the current memory usage
+    typedef Function<void(const MemoryUsage&), 128> Callback;
+
+    //! Initialize memory pressure notifier with the given usage threshold
+    /*!
+        \param threshold - Memory usage ratio threshold (default is 0.9)
+        \param psi - Register pressure stall information trigger if supported (default is true)
+    */
+    explicit MemoryPressure(double threshold = 0.9, bool psi = true);
+    MemoryPressure(const MemoryPressure&) = delete;
+    MemoryPressure(MemoryPressure&&) = delete;
+    ~MemoryPressure();
+
+    MemoryPressure& operator=(const MemoryPressure&) = delete;
+    MemoryPressure& operator=(MemoryPressure&&) = delete;
+
+    //! Get the memory usage ratio threshold
+    double threshold() const noexcept;
+    //! Is pressure stall information trigger registered?
+    bool psi() const noexcept;
+    //! Get the count of memory pressure notifications
+    uint64_t notifications() const noexcept;
+
+    //! Is the dedicated memory pressure thread running?
+    bool IsRunning() const noexcept;
+
+    //! Subscribe to memory pressure notifications
+    /*!
+        \param callback - Memory pressure callback
+        \return Subscription Id
+    */
+    template <class TCallback>
+    uint64_t Subscribe(TCallback&& callback)
+    { return Insert(Callback(std::forward<TCallback>(callback))); }
+    //! Unsubscribe from memory pressure notifications
+    /*!
+        Will block while the callback of the subscription is running.
+
+        \param id - Subscription Id
+        \return 'true' if the subscription was removed, 'false' if it was not found
+    */
+    bool Unsubscribe(uint64_t id);
+
+    //! Wait for the memory pressure and notify subscribers
+    /*!
+        Waits for the pressure stall information trigger up to the given
+        timespan and checks the memory usage ratio.
+
+        Will block for the given timespan in the worst case.
+
+        \param timespan - Timespan to wait for the pressure stall information trigger (default is zero)
+        \return 'true' if subscribers were notified, 'false' if there is no memory pressure
+    */
+    bool Poll(const Timespan& timespan = Timespan::zero());
+
+    //! Start the dedicated memory pressure thread
+    /*!
+        \param interval - Interval of memory usage checks (default is 1 second)
+        \return 'true' if the thread was started, 'false' if it is already running
+    */
+    bool Start(const Timespan& interval = Timespan::seconds(1));
+    //! Stop the dedicated memory pressure thread
+    /*!
+        \return 'true' if the thread was stopped, 'false' if it is not running
+    */
+    bool Stop();
+
+private:
+    class Impl;
+    std::unique_ptr<Impl> _pimpl;
+
+    uint64_t Insert(Callback&& callback);
+};
+
+/*! \example memory_pressure.cpp Memory pressure notifier example */
+
+} // namespace CppCommon
+
+#endif // CPPCOMMON_MEMORY_MEMORY_PRESSURE_H
@@ -0,0 +1,151 @@
+/*!
+    \file object_pool.h
+    \brief Lock-free object pool definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_MEMORY_OBJECT_POOL_H
+#define CPPCOMMON_MEMORY_OBJECT_POOL_H
+
+#include "allocator.h"
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <utility>
+
+namespace CppCommon {
+
+//! Lock-free object pool
+/*!
+    Object pool recycles objects of the fixed type between threads, so objects
+    created in one thread could be released in another one without any lock.
+
+    Free objects are kept in the Treiber stack. Stack nodes are addressed with
+    32-bit indexes, so the stack head packs the node index together with the
+    32-bit modification tag into a single 64-bit word and avoids ABA problem
+    with an ordinary 64-bit CAS. Bulk operations acquire and release the whole
+    chain of objects with a single CAS.
+
+    Objects storage is allocated in chunks of the fixed size from the auxiliary
+    memory manager under the lock, which is taken only when the pool grows.
+    Chunks are never returned until the pool is destroyed.
+
+    All objects must be released before the pool is destroyed.
+
+    Thread-safe.
+*/
+template <typename T, class TAuxMemoryManager = DefaultMemoryManager>
+class ObjectPool
+{
+public:
+    //! Initialize object pool with an auxiliary memory manager
+    /*!
+        \param auxiliary - Auxiliary memory manager
+        \param chunk - Count of objects in a single chunk (will be rounded up to the power of two, default is 256)
+        \param chunks - Max chunks count (default is 4096)
+    */
+    explicit ObjectPool(TAuxMemoryManager& auxiliary, size_t chunk = 256, size_t chunks = 4096);
+    ObjectPool(const ObjectPool&) = delete;
+    ObjectPool(ObjectPool&&) = delete;
+    ~ObjectPool();
+
+    ObjectPool& operator=(const ObjectPool&) = delete;
+    ObjectPool& operator=(ObjectPool&&) = delete;
+
+    //! Count of objects in a single chunk
+    size_t chunk() const noexcept { return _chunk_mask + 1; }
+    //! Count of allocated chunks
+    size_t chunks() const noexcept { return _chunks_count.load(std::memory_order_acquire); }
+    //! Object pool capacity (count of allocated objects storage)
+    size_t capacity() const noexcept { return chunks() * chunk(); }
+    //! Object pool max capacity
+    size_t max_capacity() const noexcept { return _chunks_max * chunk(); }
+
+    //! Auxiliary memory manager
+    TAuxMemoryManager& auxiliary() noexcept { return _auxiliary; }
+
+    //! Create a new object in place
+    /*!
+        \param args - Arguments to initialize the constructed object with
+        \return A pointer to the created object or nullptr if the object pool is exhausted
+    */
+    template <class... Args>
+    T* Create(Args&&... args);
+    //! Release the previously created object
+    /*!
+        \param ptr - Pointer to the object to release
+    */
+    void Release(T* ptr);
+
+    //! Create the given count of objects in place
+    /*!
+        Objects are constructed with copies of the given arguments and written
+        into the output iterator.
+
+        \param count - Count of objects to create
+        \param output - Output iterator
+        \param args - Arguments to initialize constructed objects with
+        \return Count of created objects (less than the given count if the object pool is exhausted)
+    */
+    template <class TOutputIterator, class... Args>
+    size_t Acquire(size_t count, TOutputIterator output, const Args&... args);
+    //! Release the given range of previously created objects
+    /*!
+        \param first - Iterator to the first object to release
+        \param last - Iterator to the end of objects to release
+    */
+    template <class TInputIterator>
+    void Release(TInputIterator first, TInputIterator last);
+
+private:
+    static const uint32_t NIL = 0xFFFFFFFF;
+    static const size_t BATCH = 64;
+
+    // Object node (the object storage must be the first field)
+    struct Node
+    {
+        alignas(T) uint8_t storage[sizeof(T)];
+        std::atomic<uint32_t> next;
+        uint32_t index;
+    };
+
+    typedef char cache_line_pad[128];
+
+    cache_line_pad _pad0;
+    std::atomic<uint64_t> _head;
+    cache_line_pad _pad1;
+
+    TAuxMemoryManager& _auxiliary;
+    std::mutex _lock;
+    size_t _chunk_shift;
+    size_t _chunk_mask;
+    size_t _chunks_max;
+    std::atomic<size_t> _chunks_count;
+    std::unique_ptr<std::atomic<Node*>[]> _chunks;
+
+    //! Pack the stack head with the given modification tag and node index
+    static uint64_t Head(uint64_t tag, uint32_t index) noexcept { return (tag << 32) | index; }
+    //! Get the node by the given index
+    Node* GetNode(uint32_t index) const noexcept
+    { return _chunks[index >> _chunk_shift].load(std::memory_order_acquire) + (index & _chunk_mask); }
+
+    //! Pop up to the given count of nodes from the free stack
+    size_t Pop(Node** nodes, size_t count) noexcept;
+    //! Push the linked chain of nodes into the free stack
+    void Push(Node* first, Node* last) noexcept;
+    //! Allocate a new chunk of nodes
+    bool Grow();
+};
+
+/*! \example memory_object_pool.cpp Lock-free object pool example */
+
+} // namespace CppCommon
+
+#include "object_pool.inl"
+
+#endif // CPPCOMMON_MEMORY_OBJECT_POOL_H
@@ -0,0 +1,220 @@
+/*!
+    \file object_pool.inl
+    \brief Lock-free object pool inline implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+template <typename T, class TAuxMemoryManager>
+inline ObjectPool<T, TAuxMemoryManager>::ObjectPool(TAuxMemoryManager& auxiliary, size_t chunk, size_t chunks)
+    : _head(Head(0, NIL)),
+      _auxiliary(auxiliary),
+      _chunk_shift(0),
+      _chunk_mask(0),
+      _chunks_max(chunks),
+      _chunks_count(0),
+      _chunks(new std::atomic<Node*>[chunks])
+{
+    assert((chunk > 0) && "Object pool chunk must be greater than zero!");
+    assert((chunks > 0) && "Object pool max chunks count must be greater than zero!");
+
+    while (((size_t)1 << _chunk_shift) < chunk)
+        ++_chunk_shift;
+    _chunk_mask = ((size_t)1 << _chunk_shift) - 1;
+
+    assert((((uint64_t)chunks << _chunk_shift) < NIL) && "Object pool max capacity must be less than 2^32 objects!");
+
+    for (size_t i = 0; i < _chunks_max; ++i)
+        _chunks[i].store(nullptr, std::memory_order_relaxed);
+}
+
+template <typename T, class TAuxMemoryManager>
+inline ObjectPool<T, TAuxMemoryManager>::~ObjectPool()
+{
+    size_t count = _chunks_count.load(std::memory_order_acquire);
+    for (size_t i = 0; i < count; ++i)
+        _auxiliary.free(_chunks[i].load(std::memory_order_relaxed), sizeof(Node) * chunk());
+}
+
+template <typename T, class TAuxMemoryManager>
+template <class... Args>
+inline T* ObjectPool<T, TAuxMemoryManager>::Create(Args&&... args)
+{
+    Node* node;
+    while (Pop(&node, 1) == 0)
+        if (!Grow())
+            return nullptr;
+
+    // Construct the object in place
+    try
+    {
+        new (node->storage) T(std::forward<Args>(args)...);
+    }
+    catch (...)
+    {
+        Push(node, node);
+        throw;
+    }
+
+    return (T*)node->storage;
+}
+
+template <typename T, class TAuxMemoryManager>
+inline void ObjectPool<T, TAuxMemoryManager>::Release(T* ptr)
+{
+    assert((ptr != nullptr) && "Released object must be valid!");
+
+    if (ptr != nullptr)
+    {
+        // Destroy the object
+        ptr->~T();
+
+        // Recycle the object node
+        Node* node = (Node*)ptr;
+        Push(node, node);
+    }
+}
+
+template <typename T, class TAuxMemoryManager>
+template <class TOutputIterator, class... Args>
+inline size_t ObjectPool<T, TAuxMemoryManager>::Acquire(size_t count, TOutputIterator output, const Args&... args)
+{
+    size_t result = 0;
+    Node* nodes[BATCH];
+
+    while (result < count)
+    {
+        // Pop the next batch of nodes
+        size_t popped = Pop(nodes, std::min(count - result, BATCH));
+        if (popped == 0)
+        {
+            if (Grow())
+                continue;
+            break;
+        }
+
+        // Construct objects in place
+        for (size_t i = 0; i < popped; ++i)
+        {
+            try
+            {
+                new (nodes[i]->storage) T(args...);
+            }
+            catch (...)
+            {
+                // Return not constructed nodes back to the free stack
+                for (size_t j = i + 1; j < popped; ++j)
+                    nodes[j - 1]->next.store(nodes[j]->index, std::memory_order_relaxed);
+                Push(nodes[i], nodes[popped - 1]);
+                throw;
+            }
+            *output++ = (T*)nodes[i]->storage;
+            ++result;
+        }
+    }
+
+    return result;
+}
+
+template <typename T, class TAuxMemoryManager>
+template <class TInputIterator>
+inline void ObjectPool<T, TAuxMemoryManager>::Release(TInputIterator first, TInputIterator last)
+{
+    Node* head = nullptr;
+    Node* tail = nullptr;
+
+    // Destroy objects and link their nodes into a single chain
+    for (; first != last; ++first)
+    {
+        T* ptr = *first;
+        assert((ptr != nullptr) && "Released object must be valid!");
+        if (ptr == nullptr)
+            continue;
+
+        ptr->~T();
+
+        Node* node = (Node*)ptr;
+        if (tail != nullptr)
+            tail->next.store(node->index, std::memory_order_relaxed);
+        else
+            head = node;
+        tail = node;
+    }
+
+    // Recycle the whole chain with a single CAS
+    if (head != nullptr)
+        Push(head, tail);
+}
+
+template <typename T, class TAuxMemoryManager>
+inline size_t ObjectPool<T, TAuxMemoryManager>::Pop(Node** nodes, size_t count) noexcept
+{
+    uint64_t head = _head.load(std::memory_order_acquire);
+    for (;;)
+    {
+        uint32_t index = (uint32_t)head;
+        if (index == NIL)
+            return 0;
+
+        // Walk the chain of free nodes. It might be changed concurrently, but
+        // any change updates the tag of the stack head and fails the CAS below.
+        size_t result = 0;
+        while ((result < count) && (index != NIL))
+        {
+            Node* node = GetNode(index);
+            nodes[result++] = node;
+            index = node->next.load(std::memory_order_relaxed);
+        }
+
+        if (_head.compare_exchange_weak(head, Head((head >> 32) + 1, index), std::memory_order_acquire, std::memory_order_acquire))
+            return result;
+    }
+}
+
+template <typename T, class TAuxMemoryManager>
+inline void ObjectPool<T, TAuxMemoryManager>::Push(Node* first, Node* last) noexcept
+{
+    uint64_t head = _head.load(std::memory_order_relaxed);
+    do
+    {
+        last->next.store((uint32_t)head, std::memory_order_relaxed);
+    } while (!_head.compare_exchange_weak(head, Head((head >> 32) + 1, first->index), std::memory_order_release, std::memory_order_relaxed));
+}
+
+template <typename T, class TAuxMemoryManager>
+inline bool ObjectPool<T, TAuxMemoryManager>::Grow()
+{
+    std::scoped_lock locker(_lock);
+
+    // Another thread might already grow the object pool
+    if ((uint32_t)_head.load(std::memory_order_acquire) != NIL)
+        return true;
+
+    size_t count = _chunks_count.load(std::memory_order_relaxed);
+    if (count >= _chunks_max)
+        return false;
+
+    Node* nodes = (Node*)_auxiliary.malloc(sizeof(Node) * chunk(), alignof(Node));
+    if (nodes == nullptr)
+        return false;
+
+    // Prepare the chain of chunk nodes
+    uint32_t base = (uint32_t)(count << _chunk_shift);
+    for (size_t i = 0; i < chunk(); ++i)
+    {
+        Node* node = new (&nodes[i]) Node;
+        node->index = base + (uint32_t)i;
+        node->next.store(((i + 1) < chunk()) ? (node->index + 1) : NIL, std::memory_order_relaxed);
+    }
+
+    // Publish the chunk before its nodes become reachable from the free stack
+    _chunks[count].store(nodes, std::memory_order_release);
+    _chunks_count.store(count + 1, std::memory_order_release);
+    Push(&nodes[0], &nodes[chunk() - 1]);
+    return true;
+}
+
+} // namespace CppCommon
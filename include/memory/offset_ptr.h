@@ -0,0 +1,121 @@
+/*!
+    \file offset_ptr.h
+    \brief Offset pointer definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_MEMORY_OFFSET_PTR_H
+#define CPPCOMMON_MEMORY_OFFSET_PTR_H
+
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+
+namespace CppCommon {
+
+//! Offset pointer
+/*!
+    Offset pointer stores the distance from its own address to the pointed
+    object instead of the absolute address. If both the pointer and the object
+    are placed in the same shared memory block, the pointer stays valid in all
+    processes regardless of the address the block is mapped at.
+
+    Offset pointer is a fancy pointer with random access iterator interface,
+    so it could be used as the pointer type of allocators for standard
+    containers (e.g. SharedPoolAllocator<T>).
+
+    Not thread-safe.
+*/
+template <typename T>
+class OffsetPtr
+{
+    template <typename U>
+    friend class OffsetPtr;
+
+public:
+    // Standard pointer type definitions
+    typedef T element_type;
+    typedef std::remove_cv_t<T> value_type;
+    typedef ptrdiff_t difference_type;
+    typedef OffsetPtr<T> pointer;
+    typedef std::add_lvalue_reference_t<T> reference;
+    typedef std::random_access_iterator_tag iterator_category;
+
+    //! Rebind the offset pointer to the other type
+    template <typename U>
+    using rebind = OffsetPtr<U>;
+
+    OffsetPtr() noexcept : _offset(NULL_OFFSET) {}
+    OffsetPtr(std::nullptr_t) noexcept : _offset(NULL_OFFSET) {}
+    OffsetPtr(T* ptr) noexcept { set(ptr); }
+    OffsetPtr(const OffsetPtr& ptr) noexcept { set(ptr.get()); }
+    template <typename U, typename = std::enable_if_t<std::is_convertible_v<U*, T*>>>
+    OffsetPtr(const OffsetPtr<U>& ptr) noexcept { set(ptr.get()); }
+    template <typename U, typename = std::enable_if_t<!std::is_convertible_v<U*, T*>>, typename = decltype(static_cast<T*>(std::declval<U*>()))>
+    explicit OffsetPtr(const OffsetPtr<U>& ptr) noexcept { set(static_cast<T*>(ptr.get())); }
+    ~OffsetPtr() noexcept = default;
+
+    OffsetPtr& operator=(std::nullptr_t) noexcept { _offset = NULL_OFFSET; return *this; }
+    OffsetPtr& operator=(T* ptr) noexcept { set(ptr); return *this; }
+    OffsetPtr& operator=(const OffsetPtr& ptr) noexcept { set(ptr.get()); return *this; }
+    template <typename U, typename = std::enable_if_t<std::is_convertible_v<U*, T*>>>
+    OffsetPtr& operator=(const OffsetPtr<U>& ptr) noexcept { set(ptr.get()); return *this; }
+
+    //! Create the offset pointer to the given object
+    template <typename U = T, typename = std::enable_if_t<!std::is_void_v<U>>>
+    static OffsetPtr pointer_to(U& value) noexcept { return OffsetPtr(std::addressof(value)); }
+
+    //! Check if the offset pointer is not null
+    explicit operator bool() const noexcept { return (_offset != NULL_OFFSET); }
+
+    //! Get the raw pointer
+    T* get() const noexcept { return (_offset == NULL_OFFSET) ? nullptr : (T*)((uintptr_t)this + (uintptr_t)_offset); }
+
+    // Dereference operators
+    template <typename U = T, typename = std::enable_if_t<!std::is_void_v<U>>>
+    U& operator*() const noexcept { return *get(); }
+    T* operator->() const noexcept { return get(); }
+    template <typename U = T, typename = std::enable_if_t<!std::is_void_v<U>>>
+    U& operator[](difference_type index) const noexcept { return get()[index]; }
+
+    // Pointer arithmetic operators
+    OffsetPtr& operator++() noexcept { _offset += sizeof(T); return *this; }
+    OffsetPtr operator++(int) noexcept { OffsetPtr result(*this); ++*this; return result; }
+    OffsetPtr& operator--() noexcept { _offset -= sizeof(T); return *this; }
+    OffsetPtr operator--(int) noexcept { OffsetPtr result(*this); --*this; return result; }
+    OffsetPtr& operator+=(difference_type offset) noexcept { _offset += offset * (difference_type)sizeof(T); return *this; }
+    OffsetPtr& operator-=(difference_type offset) noexcept { _offset -= offset * (difference_type)sizeof(T); return *this; }
+
+    friend OffsetPtr operator+(const OffsetPtr& ptr, difference_type offset) noexcept { return OffsetPtr(ptr.get() + offset); }
+    friend OffsetPtr operator+(difference_type offset, const OffsetPtr& ptr) noexcept { return OffsetPtr(ptr.get() + offset); }
+    friend OffsetPtr operator-(const OffsetPtr& ptr, difference_type offset) noexcept { return OffsetPtr(ptr.get() - offset); }
+    friend difference_type operator-(const OffsetPtr& ptr1, const OffsetPtr& ptr2) noexcept { return ptr1.get() - ptr2.get(); }
+
+    // Comparison operators
+    template <typename U>
+    friend bool operator==(const OffsetPtr& ptr1, const OffsetPtr<U>& ptr2) noexcept { return ptr1.get() == ptr2.get(); }
+    friend bool operator==(const OffsetPtr& ptr, std::nullptr_t) noexcept { return !ptr; }
+    template <typename U>
+    friend std::strong_ordering operator<=>(const OffsetPtr& ptr1, const OffsetPtr<U>& ptr2) noexcept { return std::compare_three_way()(ptr1.get(), ptr2.get()); }
+
+    //! Swap two instances
+    void swap(OffsetPtr& ptr) noexcept { T* temp = get(); set(ptr.get()); ptr.set(temp); }
+    friend void swap(OffsetPtr& ptr1, OffsetPtr& ptr2) noexcept { ptr1.swap(ptr2); }
+
+private:
+    // Offset 1 could never point to the object because the offset pointer itself occupies it
+    static constexpr ptrdiff_t NULL_OFFSET = 1;
+
+    ptrdiff_t _offset;
+
+    void set(T* ptr) noexcept { _offset = (ptr == nullptr) ? NULL_OFFSET : (ptrdiff_t)((uintptr_t)ptr - (uintptr_t)this); }
+};
+
+} // namespace CppCommon
+
+#endif // CPPCOMMON_MEMORY_OFFSET_PTR_H
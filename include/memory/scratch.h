@@ -0,0 +1,141 @@
+/*!
+    \file scratch.h
+    \brief Thread-local scratch memory definition
+    \author Ivan Shynkarenka
+    \date 15.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_MEMORY_SCRATCH_H
+#define CPPCOMMON_MEMORY_SCRATCH_H
+
+#include "allocator_arena.h"
+
+#include <string>
+#include <vector>
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+namespace Internals {
+struct ScratchStack;
+} // namespace Internals
+//! @endcond
+
+//! Thread-local scratch memory
+/*!
+    Scratch memory is a per-thread stack of temporary memory blocks which is
+    lazily created on the first use in each thread with the configured
+    capacity. Blocks are allocated by bumping the stack offset and are
+    released all at once by the enclosing ScratchScope, so temporaries in
+    hot functions get near alloca() speed without passing allocators through
+    every signature.
+
+    When the scratch stack is exhausted blocks are allocated from the heap
+    and freed by their owners (scratch containers do it in destructors).
+
+    Thread-safe.
+*/
+class Scratch
+{
+    friend struct Internals::ScratchStack;
+
+public:
+    //! Default capacity of the scratch stack of each thread (1 MiB)
+    static const size_t DEFAULT_CAPACITY;
+
+    Scratch() = delete;
+    Scratch(const Scratch&) = delete;
+    Scratch(Scratch&&) = delete;
+    ~Scratch() = delete;
+
+    Scratch& operator=(const Scratch&) = delete;
+    Scratch& operator=(Scratch&&) = delete;
+
+    //! Get the capacity of scratch stacks created for new threads
+    static size_t capacity() noexcept;
+    //! Set the capacity of scratch stacks created for new threads
+    /*!
+        Threads which already use their scratch stacks keep the previous capacity.
+
+        \param capacity - Scratch stack capacity in bytes
+    */
+    static void capacity(size_t capacity) noexcept;
+
+    //! Is the scratch stack of the current thread created?
+    static bool created() noexcept { return (_manager != nullptr); }
+
+    //! Get the scratch stack memory manager of the current thread (create it on the first call)
+    static ArenaMemoryManager<DefaultMemoryManager>& manager() { return (_manager != nullptr) ? *_manager : Create(); }
+
+private:
+    static inline thread_local ArenaMemoryManager<DefaultMemoryManager>* _manager = nullptr;
+
+    //! Create the scratch stack of the current thread
+    static ArenaMemoryManager<DefaultMemoryManager>& Create();
+};
+
+//! Scratch scope
+/*!
+    Scratch scope marks the scratch stack of the current thread on construction
+    and pops all memory blocks allocated after it on destruction. Scratch scopes
+    could be nested. Scratch containers must be destroyed before their scope.
+
+    Not thread-safe.
+*/
+class ScratchScope
+{
+public:
+    ScratchScope() : _scope(Scratch::manager()) {}
+    ScratchScope(const ScratchScope&) = delete;
+    ScratchScope(ScratchScope&&) = delete;
+    ~ScratchScope() = default;
+
+    ScratchScope& operator=(const ScratchScope&) = delete;
+    ScratchScope& operator=(ScratchScope&&) = delete;
+
+    //! Pop all memory blocks allocated in the scope before the scope end
+    void rewind() { _scope.rewind(); }
+
+private:
+    ArenaScope<DefaultMemoryManager> _scope;
+};
+
+//! Scratch memory allocator class
+/*!
+    Default constructed scratch allocator allocates from the scratch stack of
+    the current thread. Containers with scratch allocator must be used and
+    destroyed in the same thread.
+
+    Not thread-safe.
+*/
+template <typename T>
+class ScratchAllocator : public Allocator<T, ArenaMemoryManager<DefaultMemoryManager>>
+{
+public:
+    //! Rebind allocator
+    template <typename TOther> struct rebind { using other = ScratchAllocator<TOther>; };
+
+    ScratchAllocator() : Allocator<T, ArenaMemoryManager<DefaultMemoryManager>>(Scratch::manager()) {}
+    template <typename U>
+    ScratchAllocator(const ScratchAllocator<U>& alloc) noexcept : Allocator<T, ArenaMemoryManager<DefaultMemoryManager>>(alloc) {}
+    ScratchAllocator(const ScratchAllocator& alloc) noexcept = default;
+    ScratchAllocator(ScratchAllocator&&) noexcept = default;
+    ~ScratchAllocator() noexcept = default;
+
+    ScratchAllocator& operator=(const ScratchAllocator&) noexcept = default;
+    ScratchAllocator& operator=(ScratchAllocator&&) noexcept = default;
+};
+
+//! Scratch vector
+template <typename T>
+using ScratchVector = std::vector<T, ScratchAllocator<T>>;
+
+//! Scratch string
+using ScratchString = std::basic_string<char, std::char_traits<char>, ScratchAllocator<char>>;
+
+/*! \example memory_scratch.cpp Thread-local scratch memory example */
+
+} // namespace CppCommon
+
+#endif // CPPCOMMON_MEMORY_SCRATCH_H
@@ -14,10 +14,21 @@
 
 namespace CppCommon {
 
+class Writer;
+
 //! Encoding utilities
 /*!
     Encoding utilities contains methods for UTF-8, UTF-16, UTF-32 encoding conversions.
 
+    UTF conversions reject malformed input (invalid or overlong UTF-8 sequences,
+    unpaired surrogates and code points above U+10FFFF). String methods throw
+    ArgumentException for malformed input, buffer methods return std::string::npos.
+
+    Escaping encoders (JSON, HTML, CSV) find runs of characters which are not
+    escaped with SSE2/NEON registers when they are available and copy them at
+    once. Writer methods escape the string in chunks through a local buffer,
+    so the writer is called once per few kilobytes of output.
+
     Thread-safe.
 */
 class Encoding
@@ -39,6 +50,16 @@ public:
         \return UTF-8 encoded string
     */
     static std::string ToUTF8(std::wstring_view wstr);
+    //! Convert system wide-string into the given UTF-8 characters buffer
+    /*!
+        Characters buffer must have space for size * 4 characters. Terminating
+        zero character is not written.
+
+        \param wstr - System wide-string to convert
+        \param output - Output characters buffer
+        \return Count of UTF-8 characters or std::string::npos if the given wide-string is malformed
+    */
+    static size_t ToUTF8(std::wstring_view wstr, char* output) noexcept;
 
     //! Convert UTF-8 encoded string to system wide-string
     /*!
@@ -48,6 +69,27 @@ public:
         \return System wide-string
     */
     static std::wstring FromUTF8(std::string_view str);
+    //! Convert UTF-8 encoded string into the given system wide characters buffer
+    /*!
+        Wide characters buffer must have space for size characters.
+
+        \param str - UTF-8 encoded string to convert
+        \param output - Output wide characters buffer
+        \return Count of wide characters or std::string::npos if the given string is not a valid UTF-8 string
+    */
+    static size_t FromUTF8(std::string_view str, wchar_t* output) noexcept;
+
+    //! Is the given string a valid UTF-8 encoded string?
+    /*!
+        Validates 32 bytes blocks at once with AVX2 (with runtime dispatch) or
+        16 bytes blocks with NEON registers using the lookup algorithm of
+        Keiser & Lemire. Blocks of ASCII characters are skipped with a single
+        check.
+
+        \param str - String to validate
+        \return 'true' if the given string is a valid UTF-8 encoded string, 'false' otherwise
+    */
+    static bool IsUTF8(std::string_view str) noexcept;
 
     //! Convert UTF-8 encoded string to UTF-16 encoded string
     /*!
@@ -61,6 +103,26 @@ public:
         \return UTF-32 encoded string
     */
     static std::u32string UTF8toUTF32(std::string_view str);
+    //! Convert UTF-8 encoded string into the given UTF-16 characters buffer
+    /*!
+        UTF-16 characters buffer must have space for size characters. Blocks of
+        ASCII characters are widened 32 characters at once with AVX2 (with
+        runtime dispatch) or 16 characters with SSE2/NEON registers.
+
+        \param str - UTF-8 encoded string to convert
+        \param output - Output UTF-16 characters buffer
+        \return Count of UTF-16 characters or std::string::npos if the given string is not a valid UTF-8 string
+    */
+    static size_t UTF8toUTF16(std::string_view str, char16_t* output) noexcept;
+    //! Convert UTF-8 encoded string into the given UTF-32 characters buffer
+    /*!
+        UTF-32 characters buffer must have space for size characters.
+
+        \param str - UTF-8 encoded string to convert
+        \param output - Output UTF-32 characters buffer
+        \return Count of UTF-32 characters or std::string::npos if the given string is not a valid UTF-8 string
+    */
+    static size_t UTF8toUTF32(std::string_view str, char32_t* output) noexcept;
 
     //! Convert UTF-16 encoded string to UTF-8 encoded string
     /*!
@@ -68,6 +130,17 @@ public:
         \return UTF-8 encoded string
     */
     static std::string UTF16toUTF8(std::u16string_view str);
+    //! Convert UTF-16 encoded string into the given UTF-8 characters buffer
+    /*!
+        Characters buffer must have space for size * 3 characters. Terminating
+        zero character is not written. Blocks of ASCII characters are narrowed
+        16 characters at once with SSE2/NEON registers.
+
+        \param str - UTF-16 encoded string to convert
+        \param output - Output characters buffer
+        \return Count of UTF-8 characters or std::string::npos if the given string has unpaired surrogates
+    */
+    static size_t UTF16toUTF8(std::u16string_view str, char* output) noexcept;
     //! Convert UTF-16 encoded string to UTF-32 encoded string
     /*!
         \param str - UTF-16 encoded string to convert
@@ -81,6 +154,16 @@ public:
         \return UTF-8 encoded string
     */
     static std::string UTF32toUTF8(std::u32string_view str);
+    //! Convert UTF-32 encoded string into the given UTF-8 characters buffer
+    /*!
+        Characters buffer must have space for size * 4 characters. Terminating
+        zero character is not written.
+
+        \param str - UTF-32 encoded string to convert
+        \param output - Output characters buffer
+        \return Count of UTF-8 characters or std::string::npos if the given string has invalid code points
+    */
+    static size_t UTF32toUTF8(std::u32string_view str, char* output) noexcept;
     //! Convert UTF-32 encoded string to UTF-16 encoded string
     /*!
         \param str - UTF-32 encoded string to convert
@@ -100,6 +183,30 @@ public:
         \return Decoded string
     */
     static std::string Base16Decode(std::string_view str);
+    //! Base16 encode the given buffer into the given characters buffer
+    /*!
+        Characters buffer must have space for size * 2 characters. Terminating
+        zero character is not written. SSE2/NEON registers encode 16 bytes at
+        once when they are available.
+
+        \param buffer - Buffer to encode
+        \param size - Buffer size
+        \param output - Output characters buffer
+        \param lowercase - Lowercase hex digits flag (default is false)
+        \return Pointer to the end of encoded characters
+    */
+    static char* Base16Encode(const void* buffer, size_t size, char* output, bool lowercase = false) noexcept;
+    //! Base16 decode the given characters into the given buffer
+    /*!
+        Buffer must have space for size / 2 bytes. Both uppercase and lowercase
+        hex digits are accepted.
+
+        \param str - Base16 encoded characters
+        \param size - Characters count
+        \param buffer - Output buffer
+        \return 'true' if all characters are decoded, 'false' if the characters count is odd or some character is not a hex digit
+    */
+    static bool Base16Decode(const char* str, size_t size, void* buffer) noexcept;
 
     //! Base32 encode string
     /*!
@@ -113,6 +220,25 @@ public:
         \return Decoded string
     */
     static std::string Base32Decode(std::string_view str);
+    //! Base32 encode the given string into the given characters buffer
+    /*!
+        Characters buffer must have space for ((size + 4) / 5) * 8 characters.
+        Terminating zero character is not written.
+
+        \param str - String to encode
+        \param output - Output characters buffer
+        \return Count of encoded characters
+    */
+    static size_t Base32Encode(std::string_view str, char* output) noexcept;
+    //! Base32 decode the given string into the given buffer
+    /*!
+        Buffer must have space for (size / 8) * 5 bytes.
+
+        \param str - Base32 encoded string
+        \param buffer - Output buffer
+        \return Count of decoded bytes or std::string::npos if the given string is not a valid Base32 string
+    */
+    static size_t Base32Decode(std::string_view str, void* buffer) noexcept;
 
     //! Base64 encode string
     /*!
@@ -126,6 +252,28 @@ public:
         \return Decoded string
     */
     static std::string Base64Decode(std::string_view str);
+    //! Base64 encode the given string into the given characters buffer
+    /*!
+        Characters buffer must have space for ((size + 2) / 3) * 4 characters.
+        Terminating zero character is not written. AVX2 (with runtime dispatch)
+        or NEON registers encode 24/48 bytes at once when they are available.
+
+        \param str - String to encode
+        \param output - Output characters buffer
+        \return Count of encoded characters
+    */
+    static size_t Base64Encode(std::string_view str, char* output) noexcept;
+    //! Base64 decode the given string into the given buffer
+    /*!
+        Buffer must have space for (size / 4) * 3 bytes. AVX2 (with runtime
+        dispatch) or NEON registers decode 32/64 characters at once when they
+        are available.
+
+        \param str - Base64 encoded string
+        \param buffer - Output buffer
+        \return Count of decoded bytes or std::string::npos if the given string is not a valid Base64 string
+    */
+    static size_t Base64Decode(std::string_view str, void* buffer) noexcept;
 
     //! URL encode string
     /*!
@@ -133,12 +281,160 @@ public:
         \return URL encoded string
     */
     static std::string URLEncode(std::string_view str);
+    //! URL encode the given string into the given characters buffer
+    /*!
+        Characters buffer must have space for size * 3 characters. Terminating
+        zero character is not written. Runs of not escaped characters are
+        copied with SSE2/NEON registers when they are available.
+
+        \param str - String to encode
+        \param output - Output characters buffer
+        \return Count of encoded characters
+    */
+    static size_t URLEncode(std::string_view str, char* output) noexcept;
     //! URL decode string
     /*!
         \param str - URL encoded string
         \return Decoded string
     */
     static std::string URLDecode(std::string_view str);
+
+    //! JSON escape string
+    /*!
+        Quotation mark, reverse solidus and control characters are escaped.
+        Other characters (including UTF-8 sequences) are not changed. Quotes
+        around the string are not added.
+
+        \param str - String to escape
+        \return JSON escaped string
+    */
+    static std::string JsonEscape(std::string_view str);
+    //! JSON escape the given string into the given characters buffer
+    /*!
+        Characters buffer must have space for size * 6 characters. Terminating
+        zero character is not written.
+
+        \param str - String to escape
+        \param output - Output characters buffer
+        \return Count of escaped characters
+    */
+    static size_t JsonEscape(std::string_view str, char* output) noexcept;
+    //! JSON escape the given string into the given writer
+    /*!
+        \param str - String to escape
+        \param writer - Writer
+        \return Count of written characters
+    */
+    static size_t JsonEscape(std::string_view str, Writer& writer);
+    //! JSON unescape string
+    /*!
+        \param str - JSON escaped string (without quotes)
+        \return Unescaped UTF-8 string
+    */
+    static std::string JsonUnescape(std::string_view str);
+    //! JSON unescape the given string into the given characters buffer
+    /*!
+        Characters buffer must have space for size characters. Escaped UTF-16
+        surrogate pairs are combined into UTF-8 sequences of code points.
+
+        \param str - JSON escaped string (without quotes)
+        \param output - Output characters buffer
+        \return Count of unescaped characters or std::string::npos if the given string contains invalid escape sequence
+    */
+    static size_t JsonUnescape(std::string_view str, char* output) noexcept;
+
+    //! HTML escape string
+    /*!
+        Characters '&', '<', '>', '"' and apostrophe are replaced with entities, so
+        the result is safe for HTML text and quoted attribute values.
+
+        \param str - String to escape
+        \return HTML escaped string
+    */
+    static std::string HtmlEscape(std::string_view str);
+    //! HTML escape the given string into the given characters buffer
+    /*!
+        Characters buffer must have space for size * 6 characters. Terminating
+        zero character is not written.
+
+        \param str - String to escape
+        \param output - Output characters buffer
+        \return Count of escaped characters
+    */
+    static size_t HtmlEscape(std::string_view str, char* output) noexcept;
+    //! HTML escape the given string into the given writer
+    /*!
+        \param str - String to escape
+        \param writer - Writer
+        \return Count of written characters
+    */
+    static size_t HtmlEscape(std::string_view str, Writer& writer);
+    //! HTML unescape string
+    /*!
+        Named entities of escaped characters ('&amp;', '&lt;', '&gt;', '&quot;',
+        '&apos;') and numeric entities are replaced with characters. Unknown or
+        malformed entities are kept as is.
+
+        \param str - HTML escaped string
+        \return Unescaped UTF-8 string
+    */
+    static std::string HtmlUnescape(std::string_view str);
+    //! HTML unescape the given string into the given characters buffer
+    /*!
+        Characters buffer must have space for size characters.
+
+        \param str - HTML escaped string
+        \param output - Output characters buffer
+        \return Count of unescaped characters
+    */
+    static size_t HtmlUnescape(std::string_view str, char* output) noexcept;
+
+    //! CSV quote field
+    /*!
+        Field which contains the delimiter, quotation mark or line break is
+        enclosed in quotes with doubled inner quotes (RFC 4180). Other fields
+        are not changed.
+
+        \param str - Field to quote
+        \param delimiter - Fields delimiter (default is ',')
+        \return CSV quoted field
+    */
+    static std::string CsvQuote(std::string_view str, char delimiter = ',');
+    //! CSV quote the given field into the given characters buffer
+    /*!
+        Characters buffer must have space for size * 2 + 2 characters.
+        Terminating zero character is not written.
+
+        \param str - Field to quote
+        \param output - Output characters buffer
+        \param delimiter - Fields delimiter (default is ',')
+        \return Count of quoted characters
+    */
+    static size_t CsvQuote(std::string_view str, char* output, char delimiter = ',') noexcept;
+    //! CSV quote the given field into the given writer
+    /*!
+        \param str - Field to quote
+        \param writer - Writer
+        \param delimiter - Fields delimiter (default is ',')
+        \return Count of written characters
+    */
+    static size_t CsvQuote(std::string_view str, Writer& writer, char delimiter = ',');
+    //! CSV unquote field
+    /*!
+        \param str - CSV field
+        \return Unquoted field
+    */
+    static std::string CsvUnquote(std::string_view str);
+    //! CSV unquote the given field into the given characters buffer
+    /*!
+        Characters buffer must have space for size characters. Field which is
+        not enclosed in quotes is copied as is.
+
+        \param str - CSV field
+        \param output - Output characters buffer
+        \return Count of unquoted characters or std::string::npos if the quoted field is not closed or contains not doubled quote
+    */
+    static size_t CsvUnquote(std::string_view str, char* output) noexcept;
 };
 
 /*! \example string_encoding.cpp Encoding utilities example */
@@ -17,13 +17,34 @@
 #pragma system_header
 #endif
 
+#include "common/writer.h"
+
 #include <fmt/args.h>
+#include <fmt/compile.h>
 #include <fmt/format.h>
 #include <fmt/ostream.h>
 #include <fmt/xchar.h>
 
+#include <algorithm>
+#include <cstddef>
+#include <string_view>
+#include <type_traits>
+
 namespace CppCommon {
 
+//! Compile-time format string literal
+/*!
+    Format string literal passed as the template argument of compiled format
+    functions (e.g. format_compiled<"{}: {}">(key, value)).
+*/
+template <size_t N>
+struct FormatLiteral
+{
+    char data[N];
+
+    constexpr FormatLiteral(const char (&pattern)[N]) { std::copy_n(pattern, N, data); }
+};
+
 //! Format string
 /*!
     Format string with the help of {fmt} library (http://fmtlib.net)
@@ -50,6 +71,53 @@ std::string format(fmt::format_string<T...> pattern, T&&... args);
 template <typename... T>
 std::wstring format(fmt::wformat_string<T...> pattern, T&&... args);
 
+//! Format string into the given memory buffer
+/*!
+    Format string with the help of {fmt} library (http://fmtlib.net) and append
+    it to the given memory buffer. Reusing the same buffer avoids allocation of
+    a new string for each formatted string.
+
+    Not thread-safe.
+
+    \param buffer - Memory buffer to append the formatted string
+    \param pattern - Format string pattern
+    \param args - Format arguments
+*/
+template <size_t SIZE, typename... T>
+void format_to(fmt::basic_memory_buffer<char, SIZE>& buffer, fmt::format_string<T...> pattern, T&&... args);
+
+//! Format string into the given fixed size characters buffer
+/*!
+    Format string with the help of {fmt} library (http://fmtlib.net). Formatted
+    string is truncated to the buffer size. Terminating zero character is not
+    written.
+
+    Not thread-safe.
+
+    \param buffer - Fixed size characters buffer
+    \param pattern - Format string pattern
+    \param args - Format arguments
+    \return Formatted (and possibly truncated) string view of the given buffer
+*/
+template <size_t N, typename... T>
+std::string_view format_to(char (&buffer)[N], fmt::format_string<T...> pattern, T&&... args);
+
+//! Format string into the given characters buffer of the given size
+/*!
+    Format string with the help of {fmt} library (http://fmtlib.net). At most
+    size characters are written. Terminating zero character is not written.
+
+    Not thread-safe.
+
+    \param buffer - Characters buffer
+    \param size - Characters buffer size
+    \param pattern - Format string pattern
+    \param args - Format arguments
+    \return Size of the whole formatted string (greater than the buffer size if the formatted string was truncated)
+*/
+template <typename... T>
+size_t format_to_n(char* buffer, size_t size, fmt::format_string<T...> pattern, T&&... args);
+
 //! Format string and print it into the std::cout
 /*!
     Format string with the help of {fmt} library (http://fmtlib.net)
@@ -74,13 +142,17 @@ void print(fmt::format_string<T...> pattern, T&&... args);
 template <typename... T>
 void print(fmt::wformat_string<T...> pattern, T&&... args);
 
-//! Format string and print it into the given std::ostream
+//! Format string and print it into the given std::ostream or Writer
 /*!
     Format string with the help of {fmt} library (http://fmtlib.net)
 
+    Writers (e.g. StdOutput, File, Pipe) get the formatted string with a single
+    Write() call from the stack memory buffer, so formatted strings up to 500
+    characters are printed without heap allocations.
+
     Thread-safe.
 
-    \param stream - Output stream
+    \param stream - Output stream or writer
     \param pattern - Format string pattern
     \param args - Format arguments
 */
@@ -100,6 +172,58 @@ void print(TOutputStream& stream, fmt::format_string<T...> pattern, T&&... args)
 template <typename TOutputStream, typename... T>
 void print(TOutputStream& stream, fmt::wformat_string<T...> pattern, T&&... args);
 
+//! Format string with the compiled pattern
+/*!
+    Format string pattern is parsed and compiled into the sequence of argument
+    formatters in compile time (FMT_COMPILE), so there is no parsing overhead
+    on each call.
+
+    Thread-safe.
+
+    \param args - Format arguments
+    \return Formatted string
+*/
+template <FormatLiteral Pattern, typename... T>
+std::string format_compiled(T&&... args);
+
+//! Format string with the compiled pattern into the given memory buffer
+/*!
+    Not thread-safe.
+
+    \param buffer - Memory buffer to append the formatted string
+    \param args - Format arguments
+*/
+template <FormatLiteral Pattern, size_t SIZE, typename... T>
+void format_compiled_to(fmt::basic_memory_buffer<char, SIZE>& buffer, T&&... args);
+
+//! Format string with the compiled pattern into the given fixed size characters buffer
+/*!
+    Formatted string is truncated to the buffer size. Terminating zero character
+    is not written.
+
+    Not thread-safe.
+
+    \param buffer - Fixed size characters buffer
+    \param args - Format arguments
+    \return Formatted (and possibly truncated) string view of the given buffer
+*/
+template <FormatLiteral Pattern, size_t N, typename... T>
+std::string_view format_compiled_to(char (&buffer)[N], T&&... args);
+
+//! Format string with the compiled pattern into the given characters buffer of the given size
+/*!
+    At most size characters are written. Terminating zero character is not written.
+
+    Not thread-safe.
+
+    \param buffer - Characters buffer
+    \param size - Characters buffer size
+    \param args - Format arguments
+    \return Size of the whole formatted string (greater than the buffer size if the formatted string was truncated)
+*/
+template <FormatLiteral Pattern, typename... T>
+size_t format_compiled_to_n(char* buffer, size_t size, T&&... args);
+
 /*! \example string_format.cpp Format string example */
 
 } // namespace CppCommon
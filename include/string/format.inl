@@ -20,6 +20,25 @@ inline std::wstring format(fmt::wformat_string<T...> pattern, T&&... args)
     return fmt::vformat<wchar_t>(pattern, fmt::make_format_args<fmt::wformat_context>(args...));
 }
 
+template <size_t SIZE, typename... T>
+inline void format_to(fmt::basic_memory_buffer<char, SIZE>& buffer, fmt::format_string<T...> pattern, T&&... args)
+{
+    fmt::vformat_to(fmt::appender(buffer), pattern, fmt::make_format_args(args...));
+}
+
+template <size_t N, typename... T>
+inline std::string_view format_to(char (&buffer)[N], fmt::format_string<T...> pattern, T&&... args)
+{
+    auto result = fmt::vformat_to_n(buffer, N, pattern, fmt::make_format_args(args...));
+    return std::string_view(buffer, (result.size < N) ? result.size : N);
+}
+
+template <typename... T>
+inline size_t format_to_n(char* buffer, size_t size, fmt::format_string<T...> pattern, T&&... args)
+{
+    return fmt::vformat_to_n(buffer, size, pattern, fmt::make_format_args(args...)).size;
+}
+
 template <typename... T>
 inline void print(fmt::format_string<T...> pattern, T&&... args)
 {
@@ -35,7 +54,14 @@ inline void print(fmt::wformat_string<T...> pattern, T&&... args)
 template <typename TOutputStream, typename... T>
 inline void print(TOutputStream& stream, fmt::format_string<T...> pattern, T&&... args)
 {
-    return fmt::vprint(stream, pattern, fmt::make_format_args(args...));
+    if constexpr (std::is_base_of_v<Writer, TOutputStream>)
+    {
+        fmt::memory_buffer buffer;
+        fmt::vformat_to(fmt::appender(buffer), pattern, fmt::make_format_args(args...));
+        stream.Write(buffer.data(), buffer.size());
+    }
+    else
+        return fmt::vprint(stream, pattern, fmt::make_format_args(args...));
 }
 
 template <typename TOutputStream, typename... T>
@@ -44,6 +70,31 @@ inline void print(TOutputStream& stream, fmt::wformat_string<T...> pattern, T&&.
     return fmt::vprint<wchar_t>(stream, pattern, fmt::make_format_args<fmt::wformat_context>(args...));
 }
 
+template <FormatLiteral Pattern, typename... T>
+inline std::string format_compiled(T&&... args)
+{
+    return fmt::format(FMT_COMPILE(Pattern.data), std::forward<T>(args)...);
+}
+
+template <FormatLiteral Pattern, size_t SIZE, typename... T>
+inline void format_compiled_to(fmt::basic_memory_buffer<char, SIZE>& buffer, T&&... args)
+{
+    fmt::format_to(fmt::appender(buffer), FMT_COMPILE(Pattern.data), std::forward<T>(args)...);
+}
+
+template <FormatLiteral Pattern, size_t N, typename... T>
+inline std::string_view format_compiled_to(char (&buffer)[N], T&&... args)
+{
+    auto result = fmt::format_to_n(buffer, N, FMT_COMPILE(Pattern.data), std::forward<T>(args)...);
+    return std::string_view(buffer, (result.size < N) ? result.size : N);
+}
+
+template <FormatLiteral Pattern, typename... T>
+inline size_t format_compiled_to_n(char* buffer, size_t size, T&&... args)
+{
+    return fmt::format_to_n(buffer, size, FMT_COMPILE(Pattern.data), std::forward<T>(args)...).size;
+}
+
 } // namespace CppCommon
 
 //! @cond INTERNALS
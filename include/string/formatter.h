@@ -0,0 +1,120 @@
+/*!
+    \file formatter.h
+    \brief Formatter definition
+    \author Ivan Shynkarenka
+    \date 15.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_STRING_FORMATTER_H
+#define CPPCOMMON_STRING_FORMATTER_H
+
+#include "string/format.h"
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace CppCommon {
+
+//! Formatter
+/*!
+    Formatter is a runtime format string pattern (e.g. loaded from the config)
+    which is parsed once in the constructor into literal text segments and
+    replacement fields. Formatting copies literal segments and formats each
+    argument with its own replacement field, so the pattern is not parsed on
+    each call.
+
+    Pattern syntax is the {fmt} format string syntax with automatic ("{}") or
+    positional ("{0}") argument indexes and optional format specifications
+    ("{0:>10.2f}"). Named arguments and nested replacement fields in format
+    specifications are not supported.
+
+    Thread-safe.
+*/
+class Formatter
+{
+public:
+    Formatter() = default;
+    //! Parse the given format string pattern
+    /*!
+        Throws ArgumentException for the invalid pattern (e.g. unmatched brace
+        or named argument).
+
+        \param pattern - Format string pattern
+    */
+    explicit Formatter(std::string_view pattern);
+    Formatter(const Formatter&) = default;
+    Formatter(Formatter&&) noexcept = default;
+    ~Formatter() = default;
+
+    Formatter& operator=(const Formatter&) = default;
+    Formatter& operator=(Formatter&&) noexcept = default;
+
+    //! Get the source format string pattern
+    const std::string& pattern() const noexcept { return _pattern; }
+    //! Get the count of replacement fields
+    size_t fields() const noexcept { return _fields.size(); }
+    //! Get the count of required format arguments
+    size_t arguments() const noexcept { return _arguments; }
+
+    //! Format string
+    /*!
+        Will raise fmt::format_error exception if there are not enough format
+        arguments or some argument does not match its format specification!
+
+        \param args - Format arguments
+        \return Formatted string
+    */
+    template <typename... T>
+    std::string format(T&&... args) const;
+
+    //! Format string into the given memory buffer
+    /*!
+        \param buffer - Memory buffer to append the formatted string
+        \param args - Format arguments
+    */
+    template <size_t SIZE, typename... T>
+    void format_to(fmt::basic_memory_buffer<char, SIZE>& buffer, T&&... args) const;
+
+    //! Format string into the given fixed size characters buffer
+    /*!
+        Formatted string is truncated to the buffer size. Terminating zero
+        character is not written.
+
+        \param buffer - Fixed size characters buffer
+        \param args - Format arguments
+        \return Formatted (and possibly truncated) string view of the given buffer
+    */
+    template <size_t N, typename... T>
+    std::string_view format_to(char (&buffer)[N], T&&... args) const;
+
+    //! Format string with the given type-erased arguments into the given output
+    /*!
+        \param out - Output iterator
+        \param args - Type-erased format arguments
+        \return Output iterator after the formatted string
+    */
+    fmt::appender vformat_to(fmt::appender out, fmt::format_args args) const;
+
+private:
+    struct Field
+    {
+        size_t literal;     // End of the preceding literal text in _literals
+        size_t index;       // Argument index
+        std::string spec;   // Argument pattern ("{}" or "{:<spec>}")
+    };
+
+    std::string _pattern;
+    std::string _literals;
+    std::vector<Field> _fields;
+    size_t _arguments{0};
+};
+
+/*! \example string_format.cpp Format string example */
+
+} // namespace CppCommon
+
+#include "formatter.inl"
+
+#endif // CPPCOMMON_STRING_FORMATTER_H
@@ -0,0 +1,35 @@
+/*!
+    \file formatter.inl
+    \brief Formatter inline implementation
+    \author Ivan Shynkarenka
+    \date 15.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+template <typename... T>
+inline std::string Formatter::format(T&&... args) const
+{
+    fmt::memory_buffer buffer;
+    vformat_to(fmt::appender(buffer), fmt::make_format_args(args...));
+    return std::string(buffer.data(), buffer.size());
+}
+
+template <size_t SIZE, typename... T>
+inline void Formatter::format_to(fmt::basic_memory_buffer<char, SIZE>& buffer, T&&... args) const
+{
+    vformat_to(fmt::appender(buffer), fmt::make_format_args(args...));
+}
+
+template <size_t N, typename... T>
+inline std::string_view Formatter::format_to(char (&buffer)[N], T&&... args) const
+{
+    fmt::basic_memory_buffer<char, N> temp;
+    vformat_to(fmt::appender(temp), fmt::make_format_args(args...));
+    size_t size = (temp.size() < N) ? temp.size() : N;
+    std::copy_n(temp.data(), size, buffer);
+    return std::string_view(buffer, size);
+}
+
+} // namespace CppCommon
@@ -0,0 +1,137 @@
+/*!
+    \file glob_pattern.h
+    \brief Glob pattern definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_STRING_GLOB_PATTERN_H
+#define CPPCOMMON_STRING_GLOB_PATTERN_H
+
+#include <bitset>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace CppCommon {
+
+//! Glob pattern
+/*!
+    Glob pattern is a compiled list of semicolon separated glob patterns (e.g.
+    "*.txt;*.log;!debug*"). Patterns are parsed once in the constructor, so the
+    pattern could be matched with many strings (e.g. with millions of directory
+    entries) without parsing overhead.
+
+    Patterns syntax:
+    '*' - matches any sequence of characters (including the empty one);
+    '?' - matches any single character;
+    '[abc]', '[a-z]' - matches any single character of the given set;
+    '[!abc]', '[^a-z]' - matches any single character not in the given set;
+    '\' - escapes the next character;
+    '!' at the beginning of the pattern - negative pattern.
+
+    Patterns are matched in the given order with the same rules as
+    StringUtils::IsPatternMatch(): the first matched pattern gives the result
+    ('true' for positive patterns, 'false' for negative ones), otherwise the
+    result is 'true' only if the last pattern is negative. Empty glob pattern
+    matches any string.
+
+    Literal patterns and patterns with literal prefix and/or suffix around a
+    single '*' (e.g. "*.txt", "file*" or "file*.txt") are matched with plain
+    comparisons. Other patterns are matched greedily by '*' separated segments
+    without backtracking, so the matching time is linear in the string size.
+
+    Thread-safe.
+*/
+class GlobPattern
+{
+public:
+    GlobPattern() = default;
+    //! Compile glob pattern from the given list of semicolon separated patterns
+    /*!
+        Throws ArgumentException for the invalid pattern (e.g. unterminated
+        characters set or trailing escape character).
+
+        \param patterns - List of semicolon separated patterns
+    */
+    explicit GlobPattern(std::string_view patterns);
+    GlobPattern(const GlobPattern&) = default;
+    GlobPattern(GlobPattern&&) noexcept = default;
+    ~GlobPattern() = default;
+
+    GlobPattern& operator=(const GlobPattern&) = default;
+    GlobPattern& operator=(GlobPattern&&) noexcept = default;
+
+    //! Match the given string
+    bool operator()(std::string_view str) const noexcept { return Match(str); }
+
+    //! Get the source list of patterns
+    const std::string& patterns() const noexcept { return _patterns; }
+
+    //! Is the glob pattern empty?
+    bool empty() const noexcept { return _rules.empty(); }
+
+    //! Match the given string
+    /*!
+        \param str - String to match
+        \return 'true' if the given string is matched, 'false' if the given string is not matched
+    */
+    bool Match(std::string_view str) const noexcept;
+
+    //! Swap two instances
+    void swap(GlobPattern& pattern) noexcept;
+    friend void swap(GlobPattern& pattern1, GlobPattern& pattern2) noexcept;
+
+private:
+    //! Pattern token type
+    enum class TokenType : uint8_t
+    {
+        CHAR,       //!< Literal character
+        ANY,        //!< Any character ('?')
+        SET         //!< Characters set ('[...]')
+    };
+
+    //! Pattern token
+    struct Token
+    {
+        TokenType type;
+        char ch;
+        size_t set;
+    };
+
+    //! Pattern segment between '*' wildcards
+    struct Segment
+    {
+        std::string literal;
+        std::vector<Token> tokens;
+        size_t size() const noexcept { return tokens.empty() ? literal.size() : tokens.size(); }
+    };
+
+    //! Pattern rule
+    struct Rule
+    {
+        bool negative;
+        bool exact;
+        // First segment is the anchored prefix, last segment is the anchored suffix
+        std::vector<Segment> segments;
+    };
+
+    std::string _patterns;
+    std::vector<Rule> _rules;
+    std::vector<std::bitset<256>> _sets;
+
+    void Compile(std::string_view pattern, Rule& rule);
+    bool MatchRule(const Rule& rule, std::string_view str) const noexcept;
+    bool MatchSegment(const Segment& segment, const char* str) const noexcept;
+    size_t FindSegment(const Segment& segment, std::string_view str) const noexcept;
+};
+
+/*! \example string_glob_pattern.cpp Glob pattern example */
+
+} // namespace CppCommon
+
+#include "glob_pattern.inl"
+
+#endif // CPPCOMMON_STRING_GLOB_PATTERN_H
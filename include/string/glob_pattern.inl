@@ -0,0 +1,24 @@
+/*!
+    \file glob_pattern.inl
+    \brief Glob pattern inline implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+inline void GlobPattern::swap(GlobPattern& pattern) noexcept
+{
+    using std::swap;
+    swap(_patterns, pattern._patterns);
+    swap(_rules, pattern._rules);
+    swap(_sets, pattern._sets);
+}
+
+inline void swap(GlobPattern& pattern1, GlobPattern& pattern2) noexcept
+{
+    pattern1.swap(pattern2);
+}
+
+} // namespace CppCommon
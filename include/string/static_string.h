@@ -0,0 +1,180 @@
+/*!
+    \file static_string.h
+    \brief Static string definition
+    \author Ivan Shynkarenka
+    \date 15.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_STRING_STATIC_STRING_H
+#define CPPCOMMON_STRING_STATIC_STRING_H
+
+#include "algorithms/hash.h"
+
+#include <cassert>
+#include <compare>
+#include <cstdint>
+#include <cstring>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace CppCommon {
+
+//! Static string
+/*!
+    Static string is a null-terminated string with the fixed capacity N stored
+    inside the string itself. It never allocates memory and is trivially
+    copyable, so it could be used for short names and identifiers inside
+    message structs, shared memory and HashMap keys and values. String size is
+    stored in the smallest integer type which fits N.
+
+    Operations which exceed the capacity throw std::length_error, try_assign()
+    and try_append() methods return 'false' instead.
+
+    Not thread-safe.
+*/
+template <size_t N>
+class StaticString
+{
+public:
+    // Standard container type definitions
+    typedef char value_type;
+    typedef char& reference;
+    typedef const char& const_reference;
+    typedef char* pointer;
+    typedef const char* const_pointer;
+    typedef ptrdiff_t difference_type;
+    typedef size_t size_type;
+    typedef char* iterator;
+    typedef const char* const_iterator;
+
+    StaticString() noexcept : _data{}, _size(0) {}
+    StaticString(std::string_view str) : StaticString() { assign(str); }
+    StaticString(const char* str) : StaticString(std::string_view(str)) {}
+    StaticString(const std::string& str) : StaticString(std::string_view(str)) {}
+    StaticString(size_t count, char ch) : StaticString() { resize(count, ch); }
+    StaticString(const StaticString&) noexcept = default;
+    StaticString(StaticString&&) noexcept = default;
+    ~StaticString() noexcept = default;
+
+    StaticString& operator=(std::string_view str) { assign(str); return *this; }
+    StaticString& operator=(const char* str) { assign(std::string_view(str)); return *this; }
+    StaticString& operator=(const std::string& str) { assign(std::string_view(str)); return *this; }
+    StaticString& operator=(const StaticString&) noexcept = default;
+    StaticString& operator=(StaticString&&) noexcept = default;
+
+    StaticString& operator+=(std::string_view str) { append(str); return *this; }
+    StaticString& operator+=(char ch) { push_back(ch); return *this; }
+
+    //! Check if the static string is not empty
+    explicit operator bool() const noexcept { return !empty(); }
+    //! Convert the static string to the string view
+    operator std::string_view() const noexcept { return view(); }
+
+    //! Access to the character with the given index
+    char& operator[](size_t index) noexcept { assert((index < _size) && "Index out of bounds!"); return _data[index]; }
+    const char& operator[](size_t index) const noexcept { assert((index < _size) && "Index out of bounds!"); return _data[index]; }
+
+    //! Is the static string empty?
+    bool empty() const noexcept { return (_size == 0); }
+    //! Is the static string full?
+    bool full() const noexcept { return (_size == N); }
+    //! Get the static string size
+    size_t size() const noexcept { return _size; }
+    //! Get the static string length
+    size_t length() const noexcept { return _size; }
+    //! Get the static string capacity
+    static constexpr size_t capacity() noexcept { return N; }
+    //! Get the static string maximum size
+    static constexpr size_t max_size() noexcept { return N; }
+
+    //! Get the static string data
+    char* data() noexcept { return _data; }
+    const char* data() const noexcept { return _data; }
+    //! Get the null-terminated static string
+    const char* c_str() const noexcept { return _data; }
+    //! Get the static string view
+    std::string_view view() const noexcept { return std::string_view(_data, _size); }
+    //! Get the static string as std::string
+    std::string string() const { return std::string(_data, _size); }
+
+    //! Access to the character with the given index or throw std::out_of_range exception
+    char& at(size_t index) { if (index >= _size) throw std::out_of_range("Index out of bounds!"); return _data[index]; }
+    const char& at(size_t index) const { if (index >= _size) throw std::out_of_range("Index out of bounds!"); return _data[index]; }
+
+    //! Get the front character
+    char& front() noexcept { assert(!empty() && "Static string is empty!"); return _data[0]; }
+    const char& front() const noexcept { assert(!empty() && "Static string is empty!"); return _data[0]; }
+    //! Get the back character
+    char& back() noexcept { assert(!empty() && "Static string is empty!"); return _data[_size - 1]; }
+    const char& back() const noexcept { assert(!empty() && "Static string is empty!"); return _data[_size - 1]; }
+
+    //! Get the begin static string iterator
+    iterator begin() noexcept { return _data; }
+    const_iterator begin() const noexcept { return _data; }
+    const_iterator cbegin() const noexcept { return _data; }
+    //! Get the end static string iterator
+    iterator end() noexcept { return _data + _size; }
+    const_iterator end() const noexcept { return _data + _size; }
+    const_iterator cend() const noexcept { return _data + _size; }
+
+    //! Assign the given string or throw std::length_error exception
+    void assign(std::string_view str) { if (!try_assign(str)) throw std::length_error("Static string capacity exceeded!"); }
+    //! Append the given string or throw std::length_error exception
+    void append(std::string_view str) { if (!try_append(str)) throw std::length_error("Static string capacity exceeded!"); }
+    //! Push the given character into the back of the static string or throw std::length_error exception
+    void push_back(char ch) { append(std::string_view(&ch, 1)); }
+    //! Pop the back character from the static string
+    void pop_back() noexcept { assert(!empty() && "Static string is empty!"); _data[--_size] = 0; }
+
+    //! Try to assign the given string
+    /*!
+        \param str - String to assign
+        \return 'true' if the string was assigned, 'false' if it does not fit the capacity
+    */
+    bool try_assign(std::string_view str) noexcept;
+    //! Try to append the given string
+    /*!
+        \param str - String to append
+        \return 'true' if the string was appended, 'false' if it does not fit the capacity
+    */
+    bool try_append(std::string_view str) noexcept;
+
+    //! Resize the static string with the given character or throw std::length_error exception
+    void resize(size_t size, char ch = 0);
+
+    //! Clear the static string
+    void clear() noexcept { _size = 0; _data[0] = 0; }
+
+    //! Swap two instances
+    void swap(StaticString& str) noexcept { std::swap(*this, str); }
+    friend void swap(StaticString& str1, StaticString& str2) noexcept { str1.swap(str2); }
+
+    //! Compare static strings
+    friend bool operator==(const StaticString& str1, const StaticString& str2) noexcept { return str1.view() == str2.view(); }
+    friend bool operator==(const StaticString& str1, std::string_view str2) noexcept { return str1.view() == str2; }
+    friend bool operator==(const StaticString& str1, const char* str2) noexcept { return str1.view() == std::string_view(str2); }
+    friend std::strong_ordering operator<=>(const StaticString& str1, const StaticString& str2) noexcept { return str1.view() <=> str2.view(); }
+    friend std::strong_ordering operator<=>(const StaticString& str1, std::string_view str2) noexcept { return str1.view() <=> str2; }
+    friend std::strong_ordering operator<=>(const StaticString& str1, const char* str2) noexcept { return str1.view() <=> std::string_view(str2); }
+
+    //! Output static string into the given output stream
+    friend std::ostream& operator<<(std::ostream& os, const StaticString& str)
+    { os << str.view(); return os; }
+
+private:
+    // Size is stored in the smallest integer type which fits the capacity
+    typedef std::conditional_t<(N <= UINT8_MAX), uint8_t, std::conditional_t<(N <= UINT16_MAX), uint16_t, std::conditional_t<(N <= UINT32_MAX), uint32_t, size_t>>> size_storage;
+
+    char _data[N + 1];
+    size_storage _size;
+};
+
+} // namespace CppCommon
+
+#include "static_string.inl"
+
+#endif // CPPCOMMON_STRING_STATIC_STRING_H
@@ -0,0 +1,69 @@
+/*!
+    \file static_string.inl
+    \brief Static string inline implementation
+    \author Ivan Shynkarenka
+    \date 15.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+template <size_t N>
+inline bool StaticString<N>::try_assign(std::string_view str) noexcept
+{
+    if (str.size() > N)
+        return false;
+
+    // Source string might overlap with the static string
+    std::memmove(_data, str.data(), str.size());
+    _size = (size_storage)str.size();
+    _data[_size] = 0;
+    return true;
+}
+
+template <size_t N>
+inline bool StaticString<N>::try_append(std::string_view str) noexcept
+{
+    if (str.size() > (N - _size))
+        return false;
+
+    std::memmove(_data + _size, str.data(), str.size());
+    _size = (size_storage)(_size + str.size());
+    _data[_size] = 0;
+    return true;
+}
+
+template <size_t N>
+inline void StaticString<N>::resize(size_t size, char ch)
+{
+    if (size > N)
+        throw std::length_error("Static string capacity exceeded!");
+
+    if (size > _size)
+        std::memset(_data + _size, ch, size - _size);
+    _size = (size_storage)size;
+    _data[_size] = 0;
+}
+
+} // namespace CppCommon
+
+//! \cond DOXYGEN_SKIP
+template <size_t N>
+struct std::hash<CppCommon::StaticString<N>>
+{
+    typedef CppCommon::StaticString<N> argument_type;
+    typedef size_t result_type;
+
+    result_type operator() (const argument_type& value) const noexcept
+    {
+        return std::hash<std::string_view>()(value.view());
+    }
+};
+
+template <size_t N>
+struct CppCommon::FastHash<CppCommon::StaticString<N>>
+{
+    size_t operator()(const CppCommon::StaticString<N>& value) const noexcept
+    { return (size_t)CppCommon::Hash::Calculate(value.view()); }
+};
+//! \endcond
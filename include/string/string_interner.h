@@ -0,0 +1,133 @@
+/*!
+    \file string_interner.h
+    \brief String interner definition
+    \author Ivan Shynkarenka
+    \date 15.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_STRING_STRING_INTERNER_H
+#define CPPCOMMON_STRING_STRING_INTERNER_H
+
+#include "containers/hashmap.h"
+#include "memory/allocator_arena.h"
+#include "threads/rw_lock.h"
+#include "utility/cache_aligned.h"
+#include "utility/shard_selector.h"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+namespace CppCommon {
+
+//! String interner
+/*!
+    String interner keeps a single copy of each distinct string and  maps  it
+    to a compact 32-bit identifier. Identifiers are assigned sequentially,  so
+    they could be used as keys of HashMap/FlatMap or as indexes of  arrays  and
+    compared as integers instead of strings.
+
+    Strings are copied into arena memory of the string  hash  map  shard  and
+    never move or die until the interner is destroyed, so returned string views
+    are stable and null-terminated. String-to-identifier lookup is done in  one
+    of the hash map shards selected by the string hash and guarded by its  own
+    lock. Identifier-to-string lookup is lock-free and O(1): string views are
+    stored in the table of chunks with power of two growing sizes, which  are
+    never reallocated.
+
+    Identifier 0 is reserved for the empty string.
+
+    Thread-safe.
+*/
+class StringInterner
+{
+public:
+    //! Identifier of the empty string
+    static constexpr uint32_t EMPTY = 0;
+
+    //! Initialize the string interner with a given shards count and capacity
+    /*!
+        \param shards - Shards count (will be rounded up to the power of two, default is 16)
+        \param capacity - Initial capacity of each shard hash map (default is 128)
+    */
+    explicit StringInterner(size_t shards = 16, size_t capacity = 128);
+    StringInterner(const StringInterner&) = delete;
+    StringInterner(StringInterner&&) = delete;
+    ~StringInterner();
+
+    StringInterner& operator=(const StringInterner&) = delete;
+    StringInterner& operator=(StringInterner&&) = delete;
+
+    //! Get the interned string by the given identifier
+    std::string_view operator[](uint32_t id) const noexcept { return lookup(id); }
+
+    //! Get the count of interned strings (including the empty string)
+    size_t size() const noexcept { return _size.load(std::memory_order_acquire); }
+    //! Get the string interner shards count
+    size_t shards() const noexcept { return _selector.count(); }
+    //! Get the total size of interned strings memory in bytes
+    /*!
+        Arena sizes are summed shard after shard, so strings interned into the
+        already visited shards during the call are not counted.
+    */
+    size_t memory() const;
+
+    //! Intern the given string
+    /*!
+        \param str - String to intern
+        \return Identifier of the interned string
+    */
+    uint32_t intern(std::string_view str);
+
+    //! Find the identifier of the given string without interning it
+    /*!
+        \param str - String to find
+        \param id - Identifier of the found string
+        \return 'true' if the string was interned before, 'false' if the string was not found
+    */
+    bool find(std::string_view str, uint32_t& id) const;
+
+    //! Get the interned string by the given identifier
+    /*!
+        Identifier must be returned by this string interner. If it was obtained in
+        another thread then it must be passed with a proper synchronization.
+
+        \param id - Identifier of the interned string
+        \return Stable null-terminated view of the interned string
+    */
+    std::string_view lookup(uint32_t id) const noexcept;
+
+private:
+    struct Shard
+    {
+        mutable RWLock lock;
+        HashMap<std::string_view, uint32_t> map;
+        DefaultMemoryManager auxiliary;
+        ArenaMemoryManager<DefaultMemoryManager> arena;
+
+        explicit Shard(size_t capacity) : map(capacity), arena(auxiliary) {}
+        // Interned strings are released all at once
+        ~Shard() { arena.rewind(ArenaMemoryManager<DefaultMemoryManager>::Checkpoint()); }
+    };
+
+    // Identifiers table chunks: the first chunk keeps 1024 items,
+    // each next chunk doubles the table size up to 2^32 items
+    static const size_t CHUNKS = 23;
+
+    ShardSelector _selector;
+    std::vector<std::unique_ptr<CacheAligned<Shard>>> _shards;
+    std::atomic<std::string_view*> _chunks[CHUNKS];
+    std::atomic<size_t> _size;
+
+    Shard& shard(std::string_view str) const noexcept;
+    std::string_view* slot(uint32_t id);
+};
+
+/*! \example string_interner.cpp String interner example */
+
+} // namespace CppCommon
+
+#endif // CPPCOMMON_STRING_STRING_INTERNER_H
@@ -11,18 +11,31 @@
 
 #include <algorithm>
 #include <cctype>
+#include <charconv>
 #include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <limits>
 #include <sstream>
 #include <string>
+#include <string_view>
+#include <type_traits>
 #include <vector>
 
 namespace CppCommon {
 
+template <typename TDelimiter>
+class SplitView;
+
 //! String utilities
 /*!
     String utilities contains methods for UPPER/lower case conversions, join/split strings
     and other useful string manipulation methods.
 
+    Substring search, blank characters check, case conversion and case insensitive
+    comparison of strings are vectorized (SSE2/AVX2 with runtime dispatch on x86,
+    NEON on ARM64). Case conversion of strings maps only ASCII characters.
+
     Thread-safe.
 */
 class StringUtils
@@ -36,6 +49,25 @@ public:
     StringUtils& operator=(const StringUtils&) = delete;
     StringUtils& operator=(StringUtils&&) = delete;
 
+    //! Find the first occurrence of the given character
+    /*!
+        \param str - String to search in
+        \param ch - Character to find
+        \param pos - Search start position (default is 0)
+        \return Position of the found character or std::string::npos
+    */
+    static size_t Find(std::string_view str, char ch, size_t pos = 0) noexcept;
+    //! Find the first occurrence of the given substring
+    /*!
+        Empty substring is never found.
+
+        \param str - String to search in
+        \param substr - Substring to find
+        \param pos - Search start position (default is 0)
+        \return Position of the found substring or std::string::npos
+    */
+    static size_t Find(std::string_view str, std::string_view substr, size_t pos = 0) noexcept;
+
     //! Is the given character blank (empty or contains only space characters)?
     /*!
         \param ch - Character to check
@@ -67,6 +99,9 @@ public:
             "!Demo.*;!Live.*" + "LiveAccount" -> false
             "!Demo.*;!Live.*" + "UnknownAccount" -> true
 
+        Patterns are parsed for each call. Use GlobPattern to match many strings
+        with the same precompiled list of glob patterns.
+
         \param patterns - Patterns to match with
         \param str - String to match
         \return 'true' if given string matches, 'false' if given string does not match
@@ -170,11 +205,21 @@ public:
     static bool Compare(std::string_view str1, std::string_view str2);
     //! Compare two strings case insensitive version
     /*!
+        Only ASCII characters are compared case insensitive.
+
         \param str1 - First string to compare
         \param str2 - Second string to compare
         \return 'true' if two strings are equal, 'false' if two strings are different
     */
-    static bool CompareNoCase(std::string_view str1, std::string_view str2);
+    static bool CompareNoCase(std::string_view str1, std::string_view str2) noexcept;
+    //! Calculate case insensitive hash of the given string
+    /*!
+        Strings which are equal with CompareNoCase() have the same hash value.
+
+        \param str - String to hash
+        \return Hash value
+    */
+    static size_t HashNoCase(std::string_view str) noexcept;
 
     //! Is the given string contains the given character?
     /*!
@@ -262,6 +307,49 @@ public:
         \return Vector of tokens
     */
     static std::vector<std::string> Split(std::string_view str, std::string_view delimiter, bool skip_empty = false);
+    //! Split the string into string views by the given delimiter character
+    /*!
+        Works the same way as the Split() method does, but tokens are views of
+        the given string, so no token is copied or allocated.
+
+        \param str - String to split
+        \param delimiter - Delimiter character
+        \param tokens - Vector of string view tokens (cleared before split)
+        \param skip_empty - Skip empty substrings flag (default is false)
+        \return Count of tokens
+    */
+    static size_t Split(std::string_view str, char delimiter, std::vector<std::string_view>& tokens, bool skip_empty = false);
+    //! Split the string into string views by the given delimiter string
+    /*!
+        \param str - String to split
+        \param delimiter - Delimiter string
+        \param tokens - Vector of string view tokens (cleared before split)
+        \param skip_empty - Skip empty substrings flag (default is false)
+        \return Count of tokens
+    */
+    static size_t Split(std::string_view str, std::string_view delimiter, std::vector<std::string_view>& tokens, bool skip_empty = false);
+    //! Split the string lazily into string views by the given delimiter character
+    /*!
+        Tokens are found during the iteration without any memory allocation.
+        The given string must outlive the returned split view.
+
+        \param str - String to split
+        \param delimiter - Delimiter character
+        \param skip_empty - Skip empty tokens flag (default is false)
+        \return Split view of string view tokens
+    */
+    static SplitView<char> Tokenize(std::string_view str, char delimiter, bool skip_empty = false) noexcept;
+    //! Split the string lazily into string views by the given delimiter string
+    /*!
+        Tokens are found during the iteration without any memory allocation.
+        The given string and the delimiter string must outlive the returned split view.
+
+        \param str - String to split
+        \param delimiter - Delimiter string
+        \param skip_empty - Skip empty tokens flag (default is false)
+        \return Split view of string view tokens
+    */
+    static SplitView<std::string_view> Tokenize(std::string_view str, std::string_view delimiter, bool skip_empty = false) noexcept;
     //! Split the string into tokens by the any character in the given delimiter string
     /*!
         \param str - String to split
@@ -309,6 +397,11 @@ public:
 
     //! Converts arbitrary datatypes into string using std::ostringstream
     /*!
+        Integral and floating-point values are converted with std::to_chars()
+        into the stack buffer without locale and stream overhead. Floating-point
+        values are converted into the shortest string which is parsed back into
+        the same value.
+
         \param value - Value to convert
         \return Result converted string
     */
@@ -316,6 +409,11 @@ public:
     static std::string ToString(const T& value);
     //! Converts strings to arbitrary datatypes using std::istringstream
     /*!
+        Integral and floating-point values are converted with std::from_chars()
+        without locale and stream overhead. Leading blanks and plus sign are
+        skipped, invalid strings are converted into the zero value, integral
+        values out of range are saturated.
+
         \param str - String converted into the value
         \return Result converted value
     */
@@ -323,11 +421,122 @@ public:
     static T FromString(std::string_view str);
 
 private:
+    template <typename T>
+    static constexpr bool IsCharsConvertible();
+
     static bool IsBlankInternal(char ch);
     static char ToLowerInternal(char ch);
     static char ToUpperInternal(char ch);
 };
 
+//! Case insensitive string hasher
+/*!
+    Transparent hasher of std::string, std::string_view and C-string keys,
+    which could be used as THash parameter of hash containers together with
+    EqualNoCase comparator for case insensitive keys (e.g. HTTP headers)
+    without lower case copies of keys.
+
+    Thread-safe.
+*/
+struct HashNoCase
+{
+    typedef void is_transparent;
+
+    size_t operator()(std::string_view str) const noexcept { return StringUtils::HashNoCase(str); }
+};
+
+//! Case insensitive string comparator
+/*!
+    Transparent comparator of std::string, std::string_view and C-string keys,
+    which could be used as TEqual parameter of hash containers together with
+    HashNoCase hasher.
+
+    Thread-safe.
+*/
+struct EqualNoCase
+{
+    typedef void is_transparent;
+
+    bool operator()(std::string_view str1, std::string_view str2) const noexcept { return StringUtils::CompareNoCase(str1, str2); }
+};
+
+//! Split view of the string
+/*!
+    Split view is a lazy forward range of string view tokens separated by the
+    given delimiter. Tokens are found during the iteration, so the split view
+    never allocates memory. Iterators must not outlive the split view.
+
+    Not thread-safe.
+*/
+template <typename TDelimiter>
+class SplitView
+{
+public:
+    //! Split view iterator
+    class iterator
+    {
+    public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef std::string_view value_type;
+        typedef ptrdiff_t difference_type;
+        typedef const std::string_view* pointer;
+        typedef const std::string_view& reference;
+
+        iterator() noexcept : _view(nullptr), _next(0), _token() {}
+        iterator(const iterator&) noexcept = default;
+        iterator(iterator&&) noexcept = default;
+        ~iterator() noexcept = default;
+
+        iterator& operator=(const iterator&) noexcept = default;
+        iterator& operator=(iterator&&) noexcept = default;
+
+        friend bool operator==(const iterator& it1, const iterator& it2) noexcept
+        { return (it1._view == it2._view) && (it1._next == it2._next); }
+        friend bool operator!=(const iterator& it1, const iterator& it2) noexcept
+        { return !(it1 == it2); }
+
+        iterator& operator++() noexcept;
+        iterator operator++(int) noexcept;
+
+        reference operator*() const noexcept { return _token; }
+        pointer operator->() const noexcept { return &_token; }
+
+    private:
+        friend class SplitView;
+
+        const SplitView* _view;
+        size_t _next;
+        std::string_view _token;
+
+        explicit iterator(const SplitView* view) noexcept;
+    };
+
+    SplitView(std::string_view str, TDelimiter delimiter, bool skip_empty = false) noexcept
+        : _str(str), _delimiter(delimiter), _skip_empty(skip_empty)
+    {}
+    SplitView(const SplitView&) noexcept = default;
+    SplitView(SplitView&&) noexcept = default;
+    ~SplitView() noexcept = default;
+
+    SplitView& operator=(const SplitView&) noexcept = default;
+    SplitView& operator=(SplitView&&) noexcept = default;
+
+    //! Get the begin split view iterator
+    iterator begin() const noexcept { return iterator(this); }
+    //! Get the end split view iterator
+    iterator end() const noexcept { return iterator(); }
+
+    //! Get the count of tokens
+    size_t count() const noexcept { return (size_t)std::distance(begin(), end()); }
+
+private:
+    std::string_view _str;
+    TDelimiter _delimiter;
+    bool _skip_empty;
+
+    size_t DelimiterSize() const noexcept;
+};
+
 /*! \example string_utils.cpp String utilities example */
 
 } // namespace CppCommon
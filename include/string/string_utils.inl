@@ -52,18 +52,6 @@ inline std::string StringUtils::ToUpper(std::string_view str)
     return result;
 }
 
-inline std::string& StringUtils::Lower(std::string& str)
-{
-    std::transform(str.begin(), str.end(), str.begin(), ToLowerInternal);
-    return str;
-}
-
-inline std::string& StringUtils::Upper(std::string& str)
-{
-    std::transform(str.begin(), str.end(), str.begin(), ToUpperInternal);
-    return str;
-}
-
 inline std::string& StringUtils::Trim(std::string& str)
 {
     return LTrim(RTrim(str));
@@ -82,19 +70,28 @@ inline std::string& StringUtils::RemoveBlank(std::string& str)
     return str;
 }
 
+inline size_t StringUtils::Find(std::string_view str, char ch, size_t pos) noexcept
+{
+    if (pos >= str.size())
+        return std::string::npos;
+
+    const void* found = std::memchr(str.data() + pos, ch, str.size() - pos);
+    return (found != nullptr) ? (size_t)((const char*)found - str.data()) : std::string::npos;
+}
+
 inline bool StringUtils::Contains(std::string_view str, const char ch)
 {
-    return (str.find(ch) != std::string::npos);
+    return (Find(str, ch) != std::string::npos);
 }
 
 inline bool StringUtils::Contains(std::string_view str, const char* substr)
 {
-    return (str.find(substr) != std::string::npos);
+    return Contains(str, std::string_view(substr));
 }
 
 inline bool StringUtils::Contains(std::string_view str, std::string_view substr)
 {
-    return (str.find(substr) != std::string::npos);
+    return substr.empty() || (Find(str, substr) != std::string::npos);
 }
 
 inline bool StringUtils::StartsWith(std::string_view str, std::string_view prefix)
@@ -107,52 +104,91 @@ inline bool StringUtils::EndsWith(std::string_view str, std::string_view suffix)
     return (str.size() >= suffix.size()) && (str.compare(str.size() - suffix.size(), suffix.size(), suffix) == 0);
 }
 
+template <typename T>
+constexpr bool StringUtils::IsCharsConvertible()
+{
+    // Character types are converted as characters, not as numbers
+    if constexpr (std::is_same_v<T, bool> || std::is_same_v<T, char> || std::is_same_v<T, wchar_t> || std::is_same_v<T, char8_t> || std::is_same_v<T, char16_t> || std::is_same_v<T, char32_t>)
+        return false;
+    else if constexpr (std::is_integral_v<T>)
+        return true;
+#if defined(__cpp_lib_to_chars)
+    else if constexpr (std::is_floating_point_v<T>)
+        return true;
+#endif
+    else
+        return false;
+}
+
 template <typename T>
 inline std::string StringUtils::ToString(const T& value)
 {
-    std::ostringstream ss;
-    ss << value;
-    return ss.str();
+    if constexpr (IsCharsConvertible<T>())
+    {
+        char buffer[64];
+        auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+        return std::string(buffer, result.ptr);
+    }
+    else
+    {
+        std::ostringstream ss;
+        ss << value;
+        return ss.str();
+    }
 }
 
 template <>
 inline std::string StringUtils::ToString(const int8_t& value)
 {
-    std::ostringstream ss;
-    ss << (int32_t)value;
-    return ss.str();
+    return ToString((int32_t)value);
 }
 
 template <>
 inline std::string StringUtils::ToString(const uint8_t& value)
 {
-    std::ostringstream ss;
-    ss << (uint32_t)value;
-    return ss.str();
+    return ToString((uint32_t)value);
 }
 
 template <typename T>
 inline T StringUtils::FromString(std::string_view str)
 {
-    T result;
-    std::istringstream(std::string(str)) >> result;
-    return result;
+    if constexpr (IsCharsConvertible<T>())
+    {
+        const char* first = str.data();
+        const char* last = str.data() + str.size();
+
+        // Skip leading blanks and plus sign as std::istream does
+        while ((first != last) && IsBlankInternal(*first))
+            ++first;
+        if ((first != last) && (*first == '+'))
+            ++first;
+
+        T result = T();
+        if (std::from_chars(first, last, result).ec == std::errc::result_out_of_range)
+        {
+            if constexpr (std::is_integral_v<T>)
+                result = ((first != last) && (*first == '-')) ? std::numeric_limits<T>::min() : std::numeric_limits<T>::max();
+        }
+        return result;
+    }
+    else
+    {
+        T result;
+        std::istringstream(std::string(str)) >> result;
+        return result;
+    }
 }
 
 template <>
 inline int8_t StringUtils::FromString(std::string_view str)
 {
-    int32_t result;
-    std::istringstream(std::string(str)) >> result;
-    return (int8_t)result;
+    return (int8_t)FromString<int32_t>(str);
 }
 
 template <>
 inline uint8_t StringUtils::FromString(std::string_view str)
 {
-    uint32_t result;
-    std::istringstream(std::string(str)) >> result;
-    return (uint8_t)result;
+    return (uint8_t)FromString<uint32_t>(str);
 }
 
 template <>
@@ -170,4 +206,71 @@ inline std::string_view StringUtils::FromString(std::string_view str)
 template <>
 bool StringUtils::FromString(std::string_view str);
 
+inline SplitView<char> StringUtils::Tokenize(std::string_view str, char delimiter, bool skip_empty) noexcept
+{
+    return SplitView<char>(str, delimiter, skip_empty);
+}
+
+inline SplitView<std::string_view> StringUtils::Tokenize(std::string_view str, std::string_view delimiter, bool skip_empty) noexcept
+{
+    return SplitView<std::string_view>(str, delimiter, skip_empty);
+}
+
+template <typename TDelimiter>
+inline size_t SplitView<TDelimiter>::DelimiterSize() const noexcept
+{
+    if constexpr (std::is_same_v<TDelimiter, char>)
+        return 1;
+    else
+        return _delimiter.size();
+}
+
+template <typename TDelimiter>
+inline SplitView<TDelimiter>::iterator::iterator(const SplitView* view) noexcept
+    : _view(view), _next(0), _token()
+{
+    ++(*this);
+}
+
+template <typename TDelimiter>
+inline typename SplitView<TDelimiter>::iterator& SplitView<TDelimiter>::iterator::operator++() noexcept
+{
+    const std::string_view& str = _view->_str;
+
+    do
+    {
+        // Check for the end of tokens
+        if (_next > str.size())
+        {
+            _view = nullptr;
+            _next = 0;
+            _token = std::string_view();
+            return *this;
+        }
+
+        size_t found = StringUtils::Find(str, _view->_delimiter, _next);
+        if (found == std::string::npos)
+        {
+            // The last token
+            _token = str.substr(_next);
+            _next = str.size() + 1;
+        }
+        else
+        {
+            _token = str.substr(_next, found - _next);
+            _next = found + _view->DelimiterSize();
+        }
+    } while (_view->_skip_empty && _token.empty());
+
+    return *this;
+}
+
+template <typename TDelimiter>
+inline typename SplitView<TDelimiter>::iterator SplitView<TDelimiter>::iterator::operator++(int) noexcept
+{
+    iterator result(*this);
+    ++(*this);
+    return result;
+}
+
 } // namespace CppCommon
@@ -9,15 +9,144 @@
 #ifndef CPPCOMMON_SYSTEM_CPU_H
 #define CPPCOMMON_SYSTEM_CPU_H
 
+#include "system/cpu_set.h"
+
+#include <atomic>
 #include <cstdint>
 #include <string>
+#include <utility>
+#include <vector>
 
 namespace CppCommon {
 
+//! CPU cache types
+enum class CPUCacheType
+{
+    UNIFIED,        //!< Unified cache of data and instructions
+    DATA,           //!< Data cache
+    INSTRUCTION     //!< Instruction cache
+};
+
+//! CPU topology domains
+enum class CPUDomain
+{
+    CORE,           //!< Logical processors of the same physical core (SMT siblings)
+    L2,             //!< Logical processors sharing the same L2 cache
+    L3,             //!< Logical processors sharing the same L3 cache
+    SOCKET,         //!< Logical processors of the same socket (physical package)
+    NODE            //!< Logical processors of the same NUMA node
+};
+
+//! CPU topology
+/*!
+    CPU topology describes online logical processors with their physical cores,
+    sockets and NUMA nodes, and CPU caches with logical processors sharing them.
+    It could be used to place cooperating threads close to each other, e.g. to
+    pin producer / consumer pairs to SMT siblings or to the same L3 cache.
+
+    Logical processor index is the same as the index in the CPU affinity set.
+
+    Not thread-safe.
+*/
+class CPUTopology
+{
+    friend class CPU;
+
+public:
+    //! Logical processor
+    struct Processor
+    {
+        int cpu;                //!< Logical processor index
+        int core;               //!< Physical core index
+        int socket;             //!< Socket index
+        int node;               //!< NUMA node index
+    };
+
+    //! CPU cache
+    struct Cache
+    {
+        int level;              //!< Cache level
+        CPUCacheType type;      //!< Cache type
+        size_t size;            //!< Cache size in bytes
+        size_t line;            //!< Cache line size in bytes
+        CPUSet cpus;            //!< Logical processors sharing the cache
+    };
+
+    CPUTopology() : _cores(0), _sockets(0), _nodes(0) {}
+    CPUTopology(const CPUTopology&) = default;
+    CPUTopology(CPUTopology&&) noexcept = default;
+    ~CPUTopology() = default;
+
+    CPUTopology& operator=(const CPUTopology&) = default;
+    CPUTopology& operator=(CPUTopology&&) noexcept = default;
+
+    //! Get online logical processors sorted by the logical processor index
+    const std::vector<Processor>& processors() const noexcept { return _processors; }
+    //! Get CPU caches
+    const std::vector<Cache>& caches() const noexcept { return _caches; }
+
+    //! Get count of physical cores
+    int cores() const noexcept { return _cores; }
+    //! Get count of sockets
+    int sockets() const noexcept { return _sockets; }
+    //! Get count of NUMA nodes
+    int nodes() const noexcept { return _nodes; }
+
+    //! Get cache line size in bytes (0 if unknown)
+    size_t CacheLineSize() const noexcept;
+    //! Get data cache size of the given level in bytes (0 if unknown)
+    /*!
+        \param level - Cache level
+        \return Size of the single data (or unified) cache instance of the given level
+    */
+    size_t CacheSize(int level) const noexcept;
+
+    //! Get the set of all online logical processors
+    CPUSet All() const;
+    //! Get the set of logical processors of the given NUMA node
+    CPUSet NodeCPUs(int node) const;
+    //! Get the set of logical processors of the given socket
+    CPUSet SocketCPUs(int socket) const;
+    //! Get the set of logical processors of the given domain of the given logical processor
+    /*!
+        If the domain is unknown (e.g. there is no L3 cache), the set of the
+        enclosing known domain is returned.
+
+        \param cpu - Logical processor index
+        \param domain - Topology domain
+        \return Set of logical processors of the domain (empty if the logical processor is offline)
+    */
+    CPUSet Domain(int cpu, CPUDomain domain) const;
+    //! Get pairs of different logical processors which share the given domain
+    /*!
+        Logical processors are paired greedily in the order of their indexes and
+        each of them is used only once, so pairs could be used to pin producer /
+        consumer threads pairs.
+
+        \param domain - Topology domain
+        \return Collection of logical processors pairs
+    */
+    std::vector<std::pair<int, int>> Pairs(CPUDomain domain) const;
+
+private:
+    std::vector<Processor> _processors;
+    std::vector<Cache> _caches;
+    int _cores;
+    int _sockets;
+    int _nodes;
+
+    //! Find the logical processor by the given index
+    const Processor* Find(int cpu) const noexcept;
+    //! Add the cache if it is not added yet
+    void AddCache(const Cache& cache);
+    //! Sort processors and calculate counters
+    void Finalize();
+};
+
 //! CPU management static class
 /*!
     Provides CPU management functionality such as architecture, cores count,
-    clock speed, Hyper-Threading feature.
+    clock speed, Hyper-Threading and instruction set features and CPU topology.
 
     Thread-safe.
 */
@@ -46,7 +175,135 @@ public:
     static int64_t ClockSpeed();
     //! Is CPU Hyper-Threading enabled?
     static bool HyperThreading();
+    //! Is CPU AVX2 instruction set supported (by the CPU and the operating system)? (same as HasAVX2())
+    static bool AVX2() noexcept { return HasAVX2(); }
+
+    //! Is CPU SSE2 instruction set supported?
+    static bool HasSSE2() noexcept;
+    //! Is CPU SSSE3 instruction set supported?
+    static bool HasSSSE3() noexcept;
+    //! Is CPU SSE4.1 instruction set supported?
+    static bool HasSSE41() noexcept;
+    //! Is CPU SSE4.2 instruction set supported?
+    static bool HasSSE42() noexcept;
+    //! Is CPU POPCNT instruction supported?
+    static bool HasPOPCNT() noexcept;
+    //! Is CPU AVX instruction set supported (by the CPU and the operating system)?
+    static bool HasAVX() noexcept;
+    //! Is CPU AVX2 instruction set supported (by the CPU and the operating system)?
+    static bool HasAVX2() noexcept;
+    //! Is CPU FMA3 instruction set supported (by the CPU and the operating system)?
+    static bool HasFMA() noexcept;
+    //! Is CPU BMI1 instruction set supported?
+    static bool HasBMI1() noexcept;
+    //! Is CPU BMI2 instruction set supported?
+    static bool HasBMI2() noexcept;
+    //! Is CPU AVX-512 instruction set supported (F, CD, BW, DQ and VL subsets by the CPU and the operating system)?
+    static bool HasAVX512() noexcept;
+    //! Is CPU carry-less multiplication supported (x86 PCLMULQDQ or ARMv8 PMULL)?
+    static bool HasPCLMUL() noexcept;
+    //! Is CPU AES instruction set supported (x86 AES-NI or ARMv8 AES)?
+    static bool HasAES() noexcept;
+    //! Is CPU NEON (Advanced SIMD) instruction set supported?
+    static bool HasNEON() noexcept;
+    //! Is CPU CRC-32C instruction supported (x86 SSE4.2 or ARMv8 CRC32)?
+    static bool HasCRC32() noexcept;
+    //! CPU instruction set features string
+    /*!
+        \return Supported instruction set features separated by spaces (e.g. "SSE2 SSE4.2 AVX2")
+    */
+    static std::string Features();
+    //! CPU isolated logical processors
+    /*!
+        Isolated logical processors are excluded from the kernel scheduler
+        balancing (isolcpus boot parameter on Linux) and suit latency-critical
+        threads. Other platforms return the empty CPU set.
+
+        \return CPU set of isolated logical processors
+    */
+    static CPUSet Isolated();
+
+    //! CPU topology
+    /*!
+        CPU topology is discovered once per process.
+
+        \return CPU topology
+    */
+    static const CPUTopology& Topology();
+
+private:
+    //! Discover CPU topology
+    static CPUTopology DiscoverTopology();
+};
+
+//! CPU dispatched function
+/*!
+    CPU dispatched function selects the best implementation of the function
+    for the current CPU once on the first call and stores it in the function
+    pointer, so all following calls cost a single indirect call. Resolver is
+    a captureless lambda which checks CPU features and returns the pointer to
+    the selected implementation:
+    \code{.cpp}
+    size_t Count(const char* data, size_t size) noexcept
+    {
+        static const CPUDispatch<size_t(const char*, size_t)> dispatch([]() { return CPU::HasAVX2() ? CountAVX2 : CountScalar; });
+        return dispatch(data, size);
+    }
+    \endcode
+
+    Dispatched function could be a function local or a global static variable,
+    it is constant initialized and could be called during static initialization.
+
+    Thread-safe.
+*/
+template <typename TSignature>
+class CPUDispatch;
+
+//! \cond DOXYGEN_SKIP
+template <typename R, typename... Args>
+class CPUDispatch<R(Args...)>
+{
+public:
+    //! Dispatched function pointer type
+    typedef R (*Function)(Args...);
+
+    //! Initialize the dispatched function with the given resolver
+    /*!
+        \param resolver - Captureless resolver lambda returning the selected function pointer
+    */
+    template <typename TResolver>
+    constexpr explicit CPUDispatch(TResolver) noexcept : _resolver(&Resolve<TResolver>), _function(nullptr) {}
+    CPUDispatch(const CPUDispatch&) = delete;
+    CPUDispatch(CPUDispatch&&) = delete;
+    ~CPUDispatch() = default;
+
+    CPUDispatch& operator=(const CPUDispatch&) = delete;
+    CPUDispatch& operator=(CPUDispatch&&) = delete;
+
+    //! Get the selected function pointer
+    Function function() const noexcept
+    {
+        Function selected = _function.load(std::memory_order_relaxed);
+        if (selected == nullptr)
+        {
+            // Concurrent resolvers select the same function
+            selected = _resolver();
+            _function.store(selected, std::memory_order_relaxed);
+        }
+        return selected;
+    }
+
+    //! Call the selected function
+    R operator()(Args... args) const { return function()(std::forward<Args>(args)...); }
+
+private:
+    Function (*_resolver)();
+    mutable std::atomic<Function> _function;
+
+    template <typename TResolver>
+    static Function Resolve() { return TResolver()(); }
 };
+//! \endcond
 
 /*! \example system_cpu.cpp CPU management example */
 
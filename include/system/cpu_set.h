@@ -0,0 +1,130 @@
+/*!
+    \file cpu_set.h
+    \brief CPU set definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_SYSTEM_CPU_SET_H
+#define CPPCOMMON_SYSTEM_CPU_SET_H
+
+#include <algorithm>
+#include <bitset>
+#include <cstdint>
+#include <cstdlib>
+#include <initializer_list>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace CppCommon {
+
+//! CPU set
+/*!
+    CPU set is a dynamically sized set of logical processor indexes. It grows
+    on demand, so it addresses all logical processors of the system regardless
+    of their count (e.g. 256 logical processors of 2 sockets machines, or
+    logical processors of several Windows processor groups, where the index is
+    group * 64 + processor number in the group).
+
+    Not thread-safe.
+*/
+class CPUSet
+{
+public:
+    CPUSet() = default;
+    //! Initialize CPU set with the given logical processors
+    /*!
+        \param cpus - Logical processor indexes
+    */
+    CPUSet(std::initializer_list<int> cpus);
+    //! Initialize CPU set with the given 64 bits mask of logical processors
+    /*!
+        \param mask - Logical processors mask
+    */
+    explicit CPUSet(const std::bitset<64>& mask);
+    CPUSet(const CPUSet&) = default;
+    CPUSet(CPUSet&&) noexcept = default;
+    ~CPUSet() = default;
+
+    CPUSet& operator=(const CPUSet&) = default;
+    CPUSet& operator=(CPUSet&&) noexcept = default;
+
+    //! Check if the CPU set is not empty
+    explicit operator bool() const noexcept { return any(); }
+
+    //! Is the given logical processor in the CPU set?
+    bool operator[](int cpu) const noexcept { return test(cpu); }
+
+    //! Get the CPU set size (count of addressable logical processors)
+    size_t size() const noexcept { return _words.size() * 64; }
+    //! Get count of logical processors in the CPU set
+    size_t count() const noexcept;
+
+    //! Is there any logical processor in the CPU set?
+    bool any() const noexcept;
+    //! Is the CPU set empty?
+    bool none() const noexcept { return !any(); }
+
+    //! Is the given logical processor in the CPU set?
+    bool test(int cpu) const noexcept;
+    //! Is the given CPU set a subset of the current one?
+    bool contains(const CPUSet& cpus) const noexcept;
+
+    //! Get the first logical processor of the CPU set (-1 if the CPU set is empty)
+    int first() const noexcept { return next(-1); }
+    //! Get the next logical processor of the CPU set after the given one (-1 if there is no more logical processors)
+    int next(int cpu) const noexcept;
+    //! Get the last logical processor of the CPU set (-1 if the CPU set is empty)
+    int last() const noexcept;
+
+    //! Get the collection of logical processors of the CPU set
+    std::vector<int> cpus() const;
+    //! Get the 64 bits mask of the first 64 logical processors of the CPU set
+    std::bitset<64> mask() const noexcept { return std::bitset<64>(_words.empty() ? 0 : _words[0]); }
+
+    //! Add the given logical processor into the CPU set
+    CPUSet& set(int cpu);
+    //! Remove the given logical processor from the CPU set
+    CPUSet& reset(int cpu) noexcept;
+    //! Clear the CPU set
+    CPUSet& clear() noexcept { _words.clear(); return *this; }
+
+    //! Unite with the given CPU set
+    CPUSet& operator|=(const CPUSet& cpus);
+    //! Intersect with the given CPU set
+    CPUSet& operator&=(const CPUSet& cpus) noexcept;
+    //! Subtract the given CPU set
+    CPUSet& operator-=(const CPUSet& cpus) noexcept;
+
+    friend CPUSet operator|(CPUSet cpus1, const CPUSet& cpus2) { return cpus1 |= cpus2; }
+    friend CPUSet operator&(CPUSet cpus1, const CPUSet& cpus2) { return cpus1 &= cpus2; }
+    friend CPUSet operator-(CPUSet cpus1, const CPUSet& cpus2) { return cpus1 -= cpus2; }
+
+    friend bool operator==(const CPUSet& cpus1, const CPUSet& cpus2) noexcept;
+    friend bool operator!=(const CPUSet& cpus1, const CPUSet& cpus2) noexcept { return !(cpus1 == cpus2); }
+
+    //! Get the CPU set string in the list format (e.g. "0-3,8-11")
+    std::string string() const
+    { std::stringstream ss; ss << *this; return ss.str(); }
+
+    //! Parse the CPU set from the string in the list format (e.g. "0-3,8-11")
+    static CPUSet Parse(const std::string& list);
+
+    //! Output the CPU set into the given output stream in the list format
+    friend std::ostream& operator<<(std::ostream& os, const CPUSet& cpus);
+
+    //! Swap two instances
+    void swap(CPUSet& cpus) noexcept;
+    friend void swap(CPUSet& cpus1, CPUSet& cpus2) noexcept;
+
+private:
+    std::vector<uint64_t> _words;
+};
+
+} // namespace CppCommon
+
+#include "cpu_set.inl"
+
+#endif // CPPCOMMON_SYSTEM_CPU_SET_H
@@ -0,0 +1,211 @@
+/*!
+    \file cpu_set.inl
+    \brief CPU set inline implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+inline CPUSet::CPUSet(std::initializer_list<int> cpus)
+{
+    for (int cpu : cpus)
+        set(cpu);
+}
+
+inline CPUSet::CPUSet(const std::bitset<64>& mask)
+{
+    if (mask.any())
+        _words.push_back(mask.to_ullong());
+}
+
+inline size_t CPUSet::count() const noexcept
+{
+    size_t result = 0;
+    for (uint64_t word : _words)
+        result += std::bitset<64>(word).count();
+    return result;
+}
+
+inline bool CPUSet::any() const noexcept
+{
+    for (uint64_t word : _words)
+        if (word != 0)
+            return true;
+    return false;
+}
+
+inline bool CPUSet::test(int cpu) const noexcept
+{
+    if ((cpu < 0) || ((size_t)cpu >= size()))
+        return false;
+    return ((_words[cpu / 64] >> (cpu % 64)) & 1) != 0;
+}
+
+inline bool CPUSet::contains(const CPUSet& cpus) const noexcept
+{
+    for (size_t i = 0; i < cpus._words.size(); ++i)
+    {
+        uint64_t word = (i < _words.size()) ? _words[i] : 0;
+        if ((cpus._words[i] & ~word) != 0)
+            return false;
+    }
+    return true;
+}
+
+inline int CPUSet::next(int cpu) const noexcept
+{
+    size_t index = (size_t)(cpu + 1);
+    while (index < size())
+    {
+        uint64_t word = _words[index / 64] >> (index % 64);
+        if (word == 0)
+        {
+            // Skip the rest of the empty word
+            index = (index / 64 + 1) * 64;
+            continue;
+        }
+        while ((word & 1) == 0)
+        {
+            word >>= 1;
+            ++index;
+        }
+        return (int)index;
+    }
+    return -1;
+}
+
+inline int CPUSet::last() const noexcept
+{
+    for (size_t i = _words.size(); i-- > 0;)
+        for (size_t j = 64; j-- > 0;)
+            if (((_words[i] >> j) & 1) != 0)
+                return (int)(i * 64 + j);
+    return -1;
+}
+
+inline std::vector<int> CPUSet::cpus() const
+{
+    std::vector<int> result;
+    for (int cpu = first(); cpu >= 0; cpu = next(cpu))
+        result.push_back(cpu);
+    return result;
+}
+
+inline CPUSet& CPUSet::set(int cpu)
+{
+    if (cpu < 0)
+        return *this;
+    if ((size_t)cpu >= size())
+        _words.resize(cpu / 64 + 1, 0);
+    _words[cpu / 64] |= (uint64_t)1 << (cpu % 64);
+    return *this;
+}
+
+inline CPUSet& CPUSet::reset(int cpu) noexcept
+{
+    if ((cpu >= 0) && ((size_t)cpu < size()))
+        _words[cpu / 64] &= ~((uint64_t)1 << (cpu % 64));
+    return *this;
+}
+
+inline CPUSet& CPUSet::operator|=(const CPUSet& cpus)
+{
+    if (_words.size() < cpus._words.size())
+        _words.resize(cpus._words.size(), 0);
+    for (size_t i = 0; i < cpus._words.size(); ++i)
+        _words[i] |= cpus._words[i];
+    return *this;
+}
+
+inline CPUSet& CPUSet::operator&=(const CPUSet& cpus) noexcept
+{
+    for (size_t i = 0; i < _words.size(); ++i)
+        _words[i] &= (i < cpus._words.size()) ? cpus._words[i] : 0;
+    return *this;
+}
+
+inline CPUSet& CPUSet::operator-=(const CPUSet& cpus) noexcept
+{
+    for (size_t i = 0; i < std::min(_words.size(), cpus._words.size()); ++i)
+        _words[i] &= ~cpus._words[i];
+    return *this;
+}
+
+inline bool operator==(const CPUSet& cpus1, const CPUSet& cpus2) noexcept
+{
+    size_t size = std::max(cpus1._words.size(), cpus2._words.size());
+    for (size_t i = 0; i < size; ++i)
+    {
+        uint64_t word1 = (i < cpus1._words.size()) ? cpus1._words[i] : 0;
+        uint64_t word2 = (i < cpus2._words.size()) ? cpus2._words[i] : 0;
+        if (word1 != word2)
+            return false;
+    }
+    return true;
+}
+
+inline CPUSet CPUSet::Parse(const std::string& list)
+{
+    CPUSet cpus;
+    size_t position = 0;
+    while (position < list.size())
+    {
+        size_t end = list.find(',', position);
+        if (end == std::string::npos)
+            end = list.size();
+
+        std::string range = list.substr(position, end - position);
+        if (!range.empty())
+        {
+            size_t dash = range.find('-');
+            int first = std::atoi(range.c_str());
+            int last = (dash == std::string::npos) ? first : std::atoi(range.c_str() + dash + 1);
+            for (int cpu = first; cpu <= last; ++cpu)
+                cpus.set(cpu);
+        }
+
+        position = end + 1;
+    }
+    return cpus;
+}
+
+inline std::ostream& operator<<(std::ostream& os, const CPUSet& cpus)
+{
+    bool separator = false;
+    for (int first = cpus.first(); first >= 0;)
+    {
+        // Find the range of consecutive logical processors
+        int last = first;
+        int next = cpus.next(last);
+        while (next == (last + 1))
+        {
+            last = next;
+            next = cpus.next(last);
+        }
+
+        if (separator)
+            os << ',';
+        os << first;
+        if (last != first)
+            os << '-' << last;
+        separator = true;
+
+        first = next;
+    }
+    return os;
+}
+
+inline void CPUSet::swap(CPUSet& cpus) noexcept
+{
+    using std::swap;
+    swap(_words, cpus._words);
+}
+
+inline void swap(CPUSet& cpus1, CPUSet& cpus2) noexcept
+{
+    cpus1.swap(cpus2);
+}
+
+} // namespace CppCommon
@@ -9,10 +9,13 @@
 #ifndef CPPCOMMON_SYSTEM_DLL_H
 #define CPPCOMMON_SYSTEM_DLL_H
 
+#include "common/flags.h"
 #include "filesystem/path.h"
 #include "system/exceptions.h"
+#include "time/timespan.h"
 
 #include <memory>
+#include <vector>
 
 //! DLL export macro
 /*!
@@ -46,10 +49,135 @@
 
 namespace CppCommon {
 
+class ThreadPool;
+
+//! Dynamic link library options
+enum class DLLOptions
+{
+    NONE     = 0x00,    //!< Resolve all symbols on loading (RTLD_NOW)
+    LAZY     = 0x01,    //!< Resolve function symbols lazily on the first call (RTLD_LAZY, ignored on Windows)
+    GLOBAL   = 0x02,    //!< Make symbols available for subsequently loaded libraries (RTLD_GLOBAL, ignored on Windows)
+    NODELETE = 0x04     //!< Keep the library in memory after unloading, so resolved symbols stay valid (RTLD_NODELETE / module pin)
+};
+
+//! Dynamic link library symbol table
+/*!
+    Symbol table declares typed exports of the dynamic link library as its
+    DLLSymbol<T> members. All declared symbols are resolved once with
+    DLL::Load() or DLL::Resolve() methods, so later calls go through cached
+    pointers without dlsym() / GetProcAddress() string lookups:
+
+    \code{.cpp}
+    struct RandomPlugin : public CppCommon::DLLSymbolTable
+    {
+        CppCommon::DLLSymbol<bool (IRandom**)> create{*this, "PluginRandomCreate"};
+        CppCommon::DLLSymbol<bool (IRandom*)> release{*this, "PluginRandomRelease"};
+    };
+
+    RandomPlugin symbols;
+    CppCommon::DLL plugin("plugin-interface", false);
+    if (plugin.Load(symbols))
+        symbols.create(&random);
+    \endcode
+
+    Resolved symbols are valid while the dynamic link library is loaded.
+
+    Not thread-safe.
+*/
+class DLLSymbolTable
+{
+    friend class DLL;
+    template <typename T>
+    friend class DLLSymbol;
+
+public:
+    DLLSymbolTable() = default;
+    DLLSymbolTable(const DLLSymbolTable&) = delete;
+    DLLSymbolTable(DLLSymbolTable&&) = delete;
+    ~DLLSymbolTable() = default;
+
+    DLLSymbolTable& operator=(const DLLSymbolTable&) = delete;
+    DLLSymbolTable& operator=(DLLSymbolTable&&) = delete;
+
+    //! Check if all required symbols are resolved
+    explicit operator bool() const noexcept { return IsResolved(); }
+
+    //! Get the count of declared symbols
+    size_t size() const noexcept { return _symbols.size(); }
+
+    //! Are all required symbols resolved?
+    bool IsResolved() const noexcept { return _resolved; }
+
+    //! Reset all resolved symbols
+    void Reset() noexcept;
+
+private:
+    struct Symbol
+    {
+        const char* name;
+        void** address;
+        bool required;
+    };
+
+    std::vector<Symbol> _symbols;
+    bool _resolved{false};
+
+    void Register(const char* name, void** address, bool required) { _symbols.push_back({ name, address, required }); }
+};
+
+//! Dynamic link library symbol
+/*!
+    Typed symbol of the dynamic link library symbol table.
+
+    Not thread-safe.
+*/
+template <typename T>
+class DLLSymbol
+{
+public:
+    //! Declare the symbol in the given symbol table
+    /*!
+        \param table - Symbol table
+        \param name - Symbol name (must be valid while the symbol table exists)
+        \param required - Required symbol flag, the symbol table is not resolved without it (default is true)
+    */
+    DLLSymbol(DLLSymbolTable& table, const char* name, bool required = true) : _address(nullptr), _name(name)
+    { table.Register(name, &_address, required); }
+    DLLSymbol(const DLLSymbol&) = delete;
+    DLLSymbol(DLLSymbol&&) = delete;
+    ~DLLSymbol() = default;
+
+    DLLSymbol& operator=(const DLLSymbol&) = delete;
+    DLLSymbol& operator=(DLLSymbol&&) = delete;
+
+    //! Check if the symbol is resolved
+    explicit operator bool() const noexcept { return (_address != nullptr); }
+
+    //! Get the symbol name
+    const char* name() const noexcept { return _name; }
+
+    //! Get the resolved symbol pointer
+    T* get() const noexcept { return (T*)_address; }
+
+    //! Call the resolved function symbol
+    template <typename... Args>
+    decltype(auto) operator()(Args&&... args) const { return get()(std::forward<Args>(args)...); }
+
+private:
+    void* _address;
+    const char* _name;
+};
+
 //! Dynamic link library
 /*!
     Dynamic link library wraps dll operations (load, resolve, unload).
 
+    All symbols are bound on loading by default (RTLD_NOW), so the first calls
+    of plugin functions do not stall in the dynamic linker and missing
+    dependencies are reported by Load() instead of crashing later. Frequently
+    called exports should be declared in DLLSymbolTable and resolved once
+    instead of calling Resolve() with string lookups.
+
     Not thread-safe.
 */
 class DLL
@@ -61,8 +189,9 @@ public:
     /*!
         \param path - Dynamic link library path
         \param load - Load library flag (default is true)
+        \param options - Dynamic link library options (default is DLLOptions::NONE)
     */
-    DLL(const Path& path, bool load = true);
+    DLL(const Path& path, bool load = true, const Flags<DLLOptions>& options = DLLOptions::NONE);
     DLL(const DLL& dll);
     DLL(DLL&& dll) noexcept;
     ~DLL();
@@ -76,6 +205,14 @@ public:
 
     //! Get the dynamic link library path
     const Path path() const;
+    //! Get the dynamic link library options
+    Flags<DLLOptions> options() const;
+    //! Get the dynamic link library load time
+    /*!
+        Load time includes symbols resolution of the symbol table loaded with
+        the library. It is zero if the library was never loaded.
+    */
+    Timespan load_time() const;
 
     //! Is dynamic link library loaded?
     bool IsLoaded() const;
@@ -94,6 +231,21 @@ public:
         \return 'true' if the library was successfully loaded, 'false' if the library was not loaded
     */
     bool Load(const Path& path);
+    //! Load dynamic link library with a given path and options
+    /*!
+        \param path - Dynamic link library path
+        \param options - Dynamic link library options
+        \return 'true' if the library was successfully loaded, 'false' if the library was not loaded
+    */
+    bool Load(const Path& path, const Flags<DLLOptions>& options);
+    //! Load dynamic link library and resolve all symbols of the given symbol table
+    /*!
+        The library is unloaded if any required symbol cannot be resolved.
+
+        \param symbols - Symbol table
+        \return 'true' if the library was successfully loaded and all required symbols were resolved, 'false' otherwise
+    */
+    bool Load(DLLSymbolTable& symbols);
 
     //! Unload dynamic link library
     /*!
@@ -109,6 +261,25 @@ public:
     */
     template <typename T>
     T* Resolve(const std::string& name) const;
+    //! Resolve all symbols of the given symbol table
+    /*!
+        \param symbols - Symbol table
+        \return 'true' if all required symbols were resolved, 'false' otherwise
+    */
+    bool Resolve(DLLSymbolTable& symbols) const;
+
+    //! Load all dynamic link libraries of the given directory in parallel
+    /*!
+        Only files with the dynamic link library prefix and extension are
+        loaded. Libraries which cannot be loaded are returned unloaded, so
+        the caller could report their paths.
+
+        \param pool - Thread pool
+        \param directory - Plugins directory
+        \param options - Dynamic link library options (default is DLLOptions::NONE)
+        \return Dynamic link libraries collection sorted by path
+    */
+    static std::vector<DLL> LoadDirectory(ThreadPool& pool, const Path& directory, const Flags<DLLOptions>& options = DLLOptions::NONE);
 
     //! Get the dynamic link library prefix
     /*!
@@ -141,7 +312,7 @@ private:
     Impl& impl() noexcept { return reinterpret_cast<Impl&>(_storage); }
     const Impl& impl() const noexcept { return reinterpret_cast<Impl const&>(_storage); }
 
-    static const size_t StorageSize = 48;
+    static const size_t StorageSize = 64;
     static const size_t StorageAlign = 8;
     alignas(StorageAlign) std::byte _storage[StorageSize];
 
@@ -6,8 +6,17 @@
     \copyright MIT License
 */
 
+ENUM_FLAGS(CppCommon::DLLOptions)
+
 namespace CppCommon {
 
+inline void DLLSymbolTable::Reset() noexcept
+{
+    for (auto& symbol : _symbols)
+        *symbol.address = nullptr;
+    _resolved = false;
+}
+
 template <typename T>
 inline T* DLL::Resolve(const std::string& name) const
 {
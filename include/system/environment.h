@@ -9,13 +9,71 @@
 #ifndef CPPCOMMON_SYSTEM_ENVIRONMENT_H
 #define CPPCOMMON_SYSTEM_ENVIRONMENT_H
 
+#include "containers/hashmap.h"
 #include "errors/exceptions.h"
 
 #include <map>
+#include <memory>
 #include <string>
+#include <string_view>
 
 namespace CppCommon {
 
+//! Environment variables snapshot
+/*!
+    Environment variables snapshot copies all environment variables into the
+    single buffer once and indexes them in the hash map, so lookups return
+    string views without allocations and OS API calls.
+
+    Snapshot is immutable and is not changed by the following modifications
+    of environment variables.
+
+    Thread-safe.
+*/
+class EnvironmentSnapshot
+{
+public:
+    //! Environment variables hash map type
+    typedef HashMap<std::string_view, std::string_view> Envars;
+
+    //! Capture the snapshot of the current process environment variables
+    EnvironmentSnapshot();
+    EnvironmentSnapshot(const EnvironmentSnapshot&) = delete;
+    EnvironmentSnapshot(EnvironmentSnapshot&&) = delete;
+    ~EnvironmentSnapshot() = default;
+
+    EnvironmentSnapshot& operator=(const EnvironmentSnapshot&) = delete;
+    EnvironmentSnapshot& operator=(EnvironmentSnapshot&&) = delete;
+
+    //! Is the snapshot empty?
+    bool empty() const noexcept { return _envars.empty(); }
+    //! Get the count of environment variables
+    size_t size() const noexcept { return _envars.size(); }
+
+    //! Get environment variables hash map
+    const Envars& envars() const noexcept { return _envars; }
+
+    //! Is environment variable with the given name present in the snapshot?
+    /*!
+        \param name - Environment variable name
+        \return 'true' if the environment variable is present, 'false' otherwise
+    */
+    bool Contains(std::string_view name) const noexcept
+    { return !name.empty() && (_envars.find(name) != _envars.end()); }
+
+    //! Get environment variable value by the given name
+    /*!
+        \param name - Environment variable name
+        \param default_value - Default value if the environment variable is not present (default is empty)
+        \return Environment variable value which is valid while the snapshot is alive
+    */
+    std::string_view Get(std::string_view name, std::string_view default_value = std::string_view()) const noexcept;
+
+private:
+    std::string _buffer;
+    Envars _envars;
+};
+
 //! Environment management static class
 /*!
     Provides environment management functionality to get OS bit version, process bit version,
@@ -71,6 +129,23 @@ public:
     */
     static std::map<std::string, std::string> envars();
 
+    //! Get the cached environment variables snapshot
+    /*!
+        Snapshot is captured on the first call after the cache invalidation
+        and is shared by all following calls, so it could be kept for
+        repeated allocation-free lookups.
+
+        \return Environment variables snapshot
+    */
+    static std::shared_ptr<const EnvironmentSnapshot> Snapshot();
+    //! Invalidate the cached environment variables snapshot
+    /*!
+        Should be called after environment variables are modified without
+        SetEnvar() and ClearEnvar() methods (e.g. with setenv() directly).
+        Snapshots already returned by Snapshot() method are not changed.
+    */
+    static void InvalidateSnapshot();
+
     //! Get environment variable value by the given name
     /*!
         \param name - Environment variable name
@@ -79,12 +154,16 @@ public:
     static std::string GetEnvar(const std::string name);
     //! Set environment variable value by the given name
     /*!
+        Invalidates the cached environment variables snapshot.
+
         \param name - Environment variable name
         \param value - Environment variable value
     */
     static void SetEnvar(const std::string name, const std::string value);
     //! Clear environment variable by the given name
     /*!
+        Invalidates the cached environment variables snapshot.
+
         \param name - Environment variable name
     */
     static void ClearEnvar(const std::string name);
@@ -0,0 +1,173 @@
+/*!
+    \file event_loop.h
+    \brief Event loop definition
+    \author Ivan Shynkarenka
+    \date 15.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_SYSTEM_EVENT_LOOP_H
+#define CPPCOMMON_SYSTEM_EVENT_LOOP_H
+
+#include "common/function.h"
+#include "system/pipe.h"
+#include "system/process.h"
+#include "time/timespan.h"
+
+#include <memory>
+
+namespace CppCommon {
+
+//! Event loop
+/*!
+    Event loop (reactor) multiplexes readiness of pipe endpoints, exit
+    notifications of processes, timer deadlines and cross-thread tasks in
+    a single thread, so one thread could drive hundreds of child processes
+    and their pipes without blocking threads for each of them:
+    - Linux waits with epoll (pipes, pidfd of processes, eventfd wakeups);
+    - Apple and BSD wait with kqueue (pipes, EVFILT_PROC, EVFILT_USER wakeups);
+    - Windows waits with the I/O completion port (processes are assigned to
+      job objects associated with the port), anonymous pipes do not support
+      readiness notifications and are polled with PeekNamedPipe().
+
+    Timers are scheduled in the hierarchical timer wheel with the given
+    resolution, so the timer deadline is rounded up to the resolution in
+    the worst case.
+
+    Pipe handlers are level-triggered: the handler is called on each loop
+    iteration while the pipe endpoint is ready (or closed by the other side)
+    until the watch is canceled. Process handlers and timers are called once.
+    Exit result of the watched child process is collected by the event loop
+    (see ProcessMonitor for the exit result convention).
+
+    Post() and Stop() methods are thread-safe. Other methods must be called
+    from the thread which runs the event loop (e.g. from handlers) or before
+    the event loop is started. Handlers may watch and cancel other watches
+    (including themselves).
+
+    Handlers must not throw.
+
+    Not thread-safe.
+*/
+class EventLoop
+{
+public:
+    //! Task handler
+    typedef Function<void(), 128> Task;
+    //! Pipe readiness handler with the watch Id
+    typedef Function<void(uint64_t), 128> Handler;
+    //! Process exit handler with the process Id and its exit result
+    typedef Function<void(uint64_t, int), 128> ExitHandler;
+
+    //! Initialize the event loop with the given timers resolution
+    /*!
+        \param resolution - Timers resolution (default is 1 millisecond)
+    */
+    explicit EventLoop(const Timespan& resolution = Timespan::milliseconds(1));
+    EventLoop(const EventLoop&) = delete;
+    EventLoop(EventLoop&&) = delete;
+    ~EventLoop();
+
+    EventLoop& operator=(const EventLoop&) = delete;
+    EventLoop& operator=(EventLoop&&) = delete;
+
+    //! Get the count of active watches and timers
+    size_t size() const noexcept;
+
+    //! Is the event loop running?
+    bool IsRunning() const noexcept;
+
+    //! Watch the read endpoint of the given pipe
+    /*!
+        Handler is called when the pipe has data to read or the write
+        endpoint is closed.
+
+        \param pipe - Pipe to watch
+        \param handler - Pipe readiness handler
+        \return Watch Id
+    */
+    template <class THandler>
+    uint64_t WatchRead(const Pipe& pipe, THandler&& handler)
+    { return InsertPipe(pipe.reader(), true, Handler(std::forward<THandler>(handler))); }
+    //! Watch the write endpoint of the given pipe
+    /*!
+        Handler is called when the pipe has free space to write or the read
+        endpoint is closed.
+
+        \param pipe - Pipe to watch
+        \param handler - Pipe readiness handler
+        \return Watch Id
+    */
+    template <class THandler>
+    uint64_t WatchWrite(const Pipe& pipe, THandler&& handler)
+    { return InsertPipe(pipe.writer(), false, Handler(std::forward<THandler>(handler))); }
+    //! Watch the exit of the given process
+    /*!
+        \param process - Process to watch
+        \param handler - Process exit handler
+        \return Watch Id
+    */
+    template <class THandler>
+    uint64_t WatchProcess(const Process& process, THandler&& handler)
+    { return InsertProcess(process, ExitHandler(std::forward<THandler>(handler))); }
+
+    //! Schedule the task to be called after the given delay
+    /*!
+        \param delay - Delay timespan
+        \param task - Task to call
+        \return Timer Id
+    */
+    template <class TTask>
+    uint64_t Schedule(const Timespan& delay, TTask&& task)
+    { return InsertTimer(delay, Task(std::forward<TTask>(task))); }
+
+    //! Cancel the watch or the timer with the given Id
+    /*!
+        \param id - Watch or timer Id
+        \return 'true' if the watch or the timer was canceled, 'false' if it is not found or already called
+    */
+    bool Cancel(uint64_t id);
+
+    //! Post the task to be called by the event loop thread
+    /*!
+        Thread-safe.
+
+        \param task - Task to call
+    */
+    template <class TTask>
+    void Post(TTask&& task)
+    { InsertTask(Task(std::forward<TTask>(task))); }
+
+    //! Wait for events once and call their handlers
+    /*!
+        Will block for the given timespan in the worst case or until the
+        nearest timer deadline, posted task or the stop request.
+
+        \param timespan - Timespan to wait for events (default is zero)
+        \return Count of called handlers
+    */
+    size_t Poll(const Timespan& timespan = Timespan::zero());
+
+    //! Run the event loop in the current thread until the stop request
+    void Run();
+    //! Request the running event loop to stop
+    /*!
+        Thread-safe.
+    */
+    void Stop();
+
+private:
+    class Impl;
+    std::unique_ptr<Impl> _pimpl;
+
+    uint64_t InsertPipe(void* handle, bool read, Handler&& handler);
+    uint64_t InsertProcess(const Process& process, ExitHandler&& handler);
+    uint64_t InsertTimer(const Timespan& delay, Task&& task);
+    void InsertTask(Task&& task);
+};
+
+/*! \example system_event_loop.cpp Event loop example */
+
+} // namespace CppCommon
+
+#endif // CPPCOMMON_SYSTEM_EVENT_LOOP_H
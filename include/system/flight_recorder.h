@@ -0,0 +1,166 @@
+/*!
+    \file flight_recorder.h
+    \brief Flight recorder definition
+    \author Ivan Shynkarenka
+    \date 15.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_SYSTEM_FLIGHT_RECORDER_H
+#define CPPCOMMON_SYSTEM_FLIGHT_RECORDER_H
+
+#include "system/shared_memory.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace CppCommon {
+
+//! Flight recorder event
+struct FlightEvent
+{
+    uint64_t timestamp;     //!< Event timestamp (high resolution timestamp when recorded, UTC timestamp when read)
+    uint32_t id;            //!< Event Id
+    uint32_t tid;           //!< Operating system thread Id (low 32 bits)
+    uint64_t data[2];       //!< Event data
+};
+
+//! Flight recorder thread
+struct FlightThread
+{
+    uint32_t index;         //!< Thread ring index (dense thread index, see Thread::CurrentThreadIndex())
+    uint64_t tid;           //!< Operating system thread Id of the last thread which recorded into the ring
+    std::string name;       //!< Name of the last thread which recorded into the ring
+    uint64_t recorded;      //!< Total count of events recorded into the ring
+};
+
+//! Flight recorder
+/*!
+    Flight recorder is a "black box" which keeps the last events of each thread
+    in fixed size binary rings placed in the named shared memory segment. Each
+    event costs a few relaxed stores and one high resolution timestamp, so it is
+    cheap enough to record events of hot paths where full logging is too slow.
+
+    Shared memory segment is not unmapped when the process crashes, so the last
+    recorded events survive the crash and could be read with FlightRecorderReader
+    from another process (e.g. a watchdog or a post-mortem tool). This is a cheap
+    complement of ExceptionsHandler, which reports the crash but not the events
+    which led to it.
+
+    Each thread records into its own ring selected by the dense thread index
+    (see Thread::CurrentThreadIndex()). Threads with an index beyond the count
+    of rings are not recorded and their events are counted as dropped. Rings
+    of exited threads are reused by new threads.
+
+    Recorder resets the segment when it is created, so the segment of the
+    crashed process must be read before the process is restarted. On Windows
+    the named segment is destroyed with the last handle, so the reader must
+    keep it opened while the recorded process is running.
+
+    Thread-safe.
+*/
+class FlightRecorder
+{
+public:
+    //! Create the flight recorder in the named shared memory segment
+    /*!
+        \param name - Shared memory segment name
+        \param threads - Count of thread rings (default is 64)
+        \param capacity - Capacity of each thread ring in events, rounded up to the power of two (default is 4096)
+    */
+    explicit FlightRecorder(const std::string& name, size_t threads = 64, size_t capacity = 4096);
+    FlightRecorder(const FlightRecorder&) = delete;
+    FlightRecorder(FlightRecorder&&) = delete;
+    ~FlightRecorder() = default;
+
+    FlightRecorder& operator=(const FlightRecorder&) = delete;
+    FlightRecorder& operator=(FlightRecorder&&) = delete;
+
+    //! Get the shared memory segment name
+    const std::string& name() const noexcept { return _shared.name(); }
+    //! Get the count of thread rings
+    size_t threads() const noexcept { return _threads; }
+    //! Get the capacity of each thread ring in events
+    size_t capacity() const noexcept { return _capacity; }
+    //! Get the count of dropped events
+    uint64_t dropped() const noexcept;
+
+    //! Record the event of the current thread
+    /*!
+        \param id - Event Id
+        \param data0 - First event data (default is 0)
+        \param data1 - Second event data (default is 0)
+    */
+    void Record(uint32_t id, uint64_t data0 = 0, uint64_t data1 = 0) noexcept;
+
+    //! Get the size of the shared memory segment for the given flight recorder parameters
+    /*!
+        \param threads - Count of thread rings
+        \param capacity - Capacity of each thread ring in events
+        \return Shared memory segment size
+    */
+    static size_t Size(size_t threads, size_t capacity) noexcept;
+
+private:
+    size_t _threads;
+    size_t _capacity;
+    SharedMemory _shared;
+};
+
+//! Flight recorder reader
+/*!
+    Flight recorder reader opens the shared memory segment of the flight recorder
+    of the running or crashed process and reads recorded events. Parameters of
+    the reader must be the same as parameters of the recorder.
+
+    Reading the segment of the running process is possible, but the oldest
+    events of each ring could be overwritten while they are read.
+
+    Not thread-safe.
+*/
+class FlightRecorderReader
+{
+public:
+    //! Open the flight recorder shared memory segment
+    /*!
+        Throws SystemException if the segment is not found or has invalid format.
+
+        \param name - Shared memory segment name
+        \param threads - Count of thread rings (default is 64)
+        \param capacity - Capacity of each thread ring in events (default is 4096)
+    */
+    explicit FlightRecorderReader(const std::string& name, size_t threads = 64, size_t capacity = 4096);
+    FlightRecorderReader(const FlightRecorderReader&) = delete;
+    FlightRecorderReader(FlightRecorderReader&&) = delete;
+    ~FlightRecorderReader() = default;
+
+    FlightRecorderReader& operator=(const FlightRecorderReader&) = delete;
+    FlightRecorderReader& operator=(FlightRecorderReader&&) = delete;
+
+    //! Get the recorded process Id
+    uint64_t pid() const noexcept;
+    //! Get the count of dropped events
+    uint64_t dropped() const noexcept;
+
+    //! Read threads which recorded events
+    std::vector<FlightThread> ReadThreads() const;
+    //! Read events of all threads ordered by timestamps
+    /*!
+        Timestamps of read events are converted into UTC timestamps.
+
+        \return Recorded events
+    */
+    std::vector<FlightEvent> ReadEvents() const;
+
+private:
+    size_t _threads;
+    size_t _capacity;
+    SharedMemory _shared;
+};
+
+/*! \example system_flight_recorder.cpp Flight recorder example */
+
+} // namespace CppCommon
+
+#endif // CPPCOMMON_SYSTEM_FLIGHT_RECORDER_H
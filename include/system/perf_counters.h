@@ -0,0 +1,180 @@
+/*!
+    \file perf_counters.h
+    \brief Hardware performance counters definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_SYSTEM_PERF_COUNTERS_H
+#define CPPCOMMON_SYSTEM_PERF_COUNTERS_H
+
+#include <cstdint>
+#include <memory>
+
+namespace CppCommon {
+
+//! Hardware performance counter event
+enum class PerfEvent
+{
+    CYCLES,             //!< CPU cycles
+    INSTRUCTIONS,       //!< Retired instructions
+    CACHE_REFERENCES,   //!< Last level cache references
+    CACHE_MISSES,       //!< Last level cache misses
+    BRANCHES,           //!< Retired branch instructions
+    BRANCH_MISSES       //!< Mispredicted branch instructions
+};
+
+//! Hardware performance counters sample
+/*!
+    Sample contains values of all hardware performance counters events.
+    Values of unavailable events are always zero.
+
+    Not thread-safe.
+*/
+struct PerfSample
+{
+    //! Count of hardware performance counters events
+    static const size_t EVENTS = 6;
+
+    //! Hardware performance counters values indexed by event
+    uint64_t values[EVENTS];
+
+    PerfSample() noexcept : values() {}
+    PerfSample(const PerfSample&) noexcept = default;
+    PerfSample(PerfSample&&) noexcept = default;
+    ~PerfSample() noexcept = default;
+
+    PerfSample& operator=(const PerfSample&) noexcept = default;
+    PerfSample& operator=(PerfSample&&) noexcept = default;
+
+    //! Get the value of the given event
+    uint64_t operator[](PerfEvent event) const noexcept { return values[(size_t)event]; }
+    //! Get the value of the given event
+    uint64_t& operator[](PerfEvent event) noexcept { return values[(size_t)event]; }
+
+    //! Get CPU cycles
+    uint64_t cycles() const noexcept { return (*this)[PerfEvent::CYCLES]; }
+    //! Get retired instructions
+    uint64_t instructions() const noexcept { return (*this)[PerfEvent::INSTRUCTIONS]; }
+    //! Get last level cache references
+    uint64_t cache_references() const noexcept { return (*this)[PerfEvent::CACHE_REFERENCES]; }
+    //! Get last level cache misses
+    uint64_t cache_misses() const noexcept { return (*this)[PerfEvent::CACHE_MISSES]; }
+    //! Get retired branch instructions
+    uint64_t branches() const noexcept { return (*this)[PerfEvent::BRANCHES]; }
+    //! Get mispredicted branch instructions
+    uint64_t branch_misses() const noexcept { return (*this)[PerfEvent::BRANCH_MISSES]; }
+
+    //! Get instructions per cycle (0.0 if CPU cycles are not available)
+    double ipc() const noexcept
+    { return (cycles() > 0) ? ((double)instructions() / (double)cycles()) : 0.0; }
+
+    //! Accumulate the given sample
+    PerfSample& operator+=(const PerfSample& sample) noexcept;
+    //! Subtract the given sample
+    PerfSample& operator-=(const PerfSample& sample) noexcept;
+
+    friend PerfSample operator+(PerfSample sample1, const PerfSample& sample2) noexcept
+    { return sample1 += sample2; }
+    friend PerfSample operator-(PerfSample sample1, const PerfSample& sample2) noexcept
+    { return sample1 -= sample2; }
+};
+
+//! Hardware performance counters
+/*!
+    Hardware performance counters open CPU cycles, retired instructions, last
+    level cache misses and branch misses counters for the current thread. All
+    counters are started on construction and count only user space events of
+    the thread that created them, so the code region is measured as difference
+    of two samples or with the scoped PerfRegion.
+
+    Counters are opened as a single group, so they are scheduled on the CPU
+    together and ratios like IPC are consistent. If the kernel multiplexes the
+    counters because of lack of hardware registers, values are scaled by the
+    ratio of enabled and running times.
+
+    Hardware performance counters are available only for Linux (perf_event
+    interface). Counters could be unavailable on virtual machines, containers
+    or with restrictive 'perf_event_paranoid' settings. In this case counters
+    report the availability with IsAvailable() and read zero values.
+
+    Not thread-safe.
+
+    https://man7.org/linux/man-pages/man2/perf_event_open.2.html
+*/
+class PerfCounters
+{
+public:
+    //! Open hardware performance counters for the current thread
+    PerfCounters();
+    PerfCounters(const PerfCounters&) = delete;
+    PerfCounters(PerfCounters&& counters) noexcept;
+    ~PerfCounters();
+
+    PerfCounters& operator=(const PerfCounters&) = delete;
+    PerfCounters& operator=(PerfCounters&& counters) noexcept;
+
+    //! Is any hardware performance counter available?
+    bool IsAvailable() const noexcept;
+    //! Is the given hardware performance counter available?
+    bool IsAvailable(PerfEvent event) const noexcept;
+
+    //! Read the current values of hardware performance counters
+    /*!
+        Will not block.
+
+        \return Hardware performance counters sample
+    */
+    PerfSample Read() const noexcept;
+
+    //! Reset all hardware performance counters to zero
+    void Reset() noexcept;
+
+    //! Swap two instances
+    void swap(PerfCounters& counters) noexcept;
+    friend void swap(PerfCounters& counters1, PerfCounters& counters2) noexcept;
+
+private:
+    class Impl;
+    std::unique_ptr<Impl> _pimpl;
+};
+
+//! Hardware performance counters region measurer
+/*!
+    Scoped region measurer reads hardware performance counters on construction
+    and accumulates the difference into the given sample on destruction.
+
+    Not thread-safe.
+*/
+class PerfRegion
+{
+public:
+    //! Start measuring the region
+    /*!
+        \param counters - Hardware performance counters of the current thread
+        \param result - Sample to accumulate the region values
+    */
+    explicit PerfRegion(const PerfCounters& counters, PerfSample& result) noexcept
+        : _counters(counters), _result(result), _start(counters.Read())
+    {}
+    PerfRegion(const PerfRegion&) = delete;
+    PerfRegion(PerfRegion&&) = delete;
+    ~PerfRegion() noexcept { _result += _counters.Read() - _start; }
+
+    PerfRegion& operator=(const PerfRegion&) = delete;
+    PerfRegion& operator=(PerfRegion&&) = delete;
+
+private:
+    const PerfCounters& _counters;
+    PerfSample& _result;
+    PerfSample _start;
+};
+
+/*! \example system_perf_counters.cpp Hardware performance counters example */
+
+} // namespace CppCommon
+
+#include "perf_counters.inl"
+
+#endif // CPPCOMMON_SYSTEM_PERF_COUNTERS_H
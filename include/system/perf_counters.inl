@@ -0,0 +1,37 @@
+/*!
+    \file perf_counters.inl
+    \brief Hardware performance counters inline implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+inline PerfSample& PerfSample::operator+=(const PerfSample& sample) noexcept
+{
+    for (size_t i = 0; i < EVENTS; ++i)
+        values[i] += sample.values[i];
+    return *this;
+}
+
+inline PerfSample& PerfSample::operator-=(const PerfSample& sample) noexcept
+{
+    // Saturate values to avoid wrapped results of scaled multiplexed counters
+    for (size_t i = 0; i < EVENTS; ++i)
+        values[i] = (values[i] > sample.values[i]) ? (values[i] - sample.values[i]) : 0;
+    return *this;
+}
+
+inline void PerfCounters::swap(PerfCounters& counters) noexcept
+{
+    using std::swap;
+    swap(_pimpl, counters._pimpl);
+}
+
+inline void swap(PerfCounters& counters1, PerfCounters& counters2) noexcept
+{
+    counters1.swap(counters2);
+}
+
+} // namespace CppCommon
@@ -12,11 +12,15 @@
 #include "common/reader.h"
 #include "common/writer.h"
 #include "errors/exceptions.h"
+#include "time/timespan.h"
 
 #include <memory>
+#include <system_error>
 
 namespace CppCommon {
 
+class File;
+
 //! Pipe
 /*!
     A pipe is a section of shared memory that processes use for communication.  The
@@ -25,12 +29,25 @@ namespace CppCommon {
     other process reads the information from the pipe. This overview describes  how
     to create, manage, and use pipes.
 
+    Pipe could be switched into the non-blocking mode, where read and  write
+    operations return zero instead of waiting for the data or for  the  free
+    space of the pipe buffer. WaitRead() and WaitWrite() methods (or  native
+    endpoint handlers with poll()/epoll()) are used to wait for the pipe.
+
+    Transfer methods move data between the pipe and the file without copying
+    it through the user space (splice() and tee() on Linux). Other platforms
+    copy data through the intermediate buffer.
+
     Not thread-safe.
 */
 class Pipe : public Reader, public Writer
 {
 public:
-    Pipe();
+    //! Initialize a new pipe with a given buffer capacity
+    /*!
+        \param capacity - Pipe buffer capacity in bytes (default is 0 - system default capacity)
+    */
+    explicit Pipe(size_t capacity = 0);
     Pipe(const Pipe&) = delete;
     Pipe(Pipe&& pipe) = delete;
     virtual ~Pipe();
@@ -43,12 +60,31 @@ public:
     //! Get the native write endpoint handler
     void* writer() const noexcept;
 
+    //! Get the pipe buffer capacity in bytes (0 if the platform does not report it)
+    size_t capacity() const;
+
     //! Is pipe opened for reading or writing?
     bool IsPipeOpened() const noexcept;
     //! Is pipe opened for reading?
     bool IsPipeReadOpened() const noexcept;
     //! Is pipe opened for writing?
     bool IsPipeWriteOpened() const noexcept;
+    //! Is pipe in the blocking mode?
+    bool IsBlocking() const;
+
+    //! Set the pipe buffer capacity
+    /*!
+        Capacity is changed with F_SETPIPE_SZ on Linux, other platforms keep
+        the capacity given in the constructor.
+
+        \param capacity - Pipe buffer capacity in bytes
+    */
+    void SetCapacity(size_t capacity);
+    //! Switch the pipe into the blocking or non-blocking mode
+    /*!
+        \param blocking - Blocking mode flag
+    */
+    void SetBlocking(bool blocking);
 
     //! Read a bytes buffer from the pipe
     /*!
@@ -57,7 +93,7 @@ public:
 
         \param buffer - Buffer to read
         \param size - Buffer size
-        \return Count of read bytes
+        \return Count of read bytes (0 at the end of the pipe or if the non-blocking pipe is empty)
     */
     size_t Read(void* buffer, size_t size) override;
 
@@ -72,11 +108,96 @@ public:
 
         \param buffer - Buffer to write
         \param size - Buffer size
-        \return Count of written bytes
+        \return Count of written bytes (0 if the non-blocking pipe is full)
     */
     size_t Write(const void* buffer, size_t size) override;
+    //! Write bytes buffers into the pipe with one vectored write (writev)
+    /*!
+        If the pipe is not opened for writing the method will raise
+        a system exception!
+
+        \param buffers - Buffers to write
+        \return Count of written bytes (less than total buffers size if the non-blocking pipe is full)
+    */
+    size_t WriteV(std::span<const WriteBuffer> buffers) override;
 
     using Writer::Write;
+    using Writer::WriteV;
+
+    //! Try to read a bytes buffer from the pipe without raising a system exception
+    /*!
+        If the pipe is not opened for reading the method fails with
+        std::errc::bad_file_descriptor error code.
+
+        \param buffer - Buffer to read
+        \param size - Buffer size
+        \param ec - Error code of the failed read
+        \return Count of read bytes (0 at the end of the pipe, if the non-blocking pipe is empty or on error)
+    */
+    size_t TryRead(void* buffer, size_t size, std::error_code& ec);
+    //! Try to write a byte buffer into the pipe without raising a system exception
+    /*!
+        If the pipe is not opened for writing the method fails with
+        std::errc::bad_file_descriptor error code.
+
+        \param buffer - Buffer to write
+        \param size - Buffer size
+        \param ec - Error code of the failed write
+        \return Count of written bytes (0 if the non-blocking pipe is full or on error)
+    */
+    size_t TryWrite(const void* buffer, size_t size, std::error_code& ec);
+
+    //! Wait until the pipe has data to read or its write endpoint is closed
+    /*!
+        \param timeout - Wait timeout (default is Timespan::zero() - check without waiting)
+        \return 'true' if the pipe is ready for reading, 'false' if the timeout is expired
+    */
+    bool WaitRead(const Timespan& timeout = Timespan::zero());
+    //! Wait until the pipe has free space to write
+    /*!
+        Windows cannot wait for the anonymous pipe write endpoint, so the method
+        always returns 'true' there.
+
+        \param timeout - Wait timeout (default is Timespan::zero() - check without waiting)
+        \return 'true' if the pipe is ready for writing, 'false' if the timeout is expired
+    */
+    bool WaitWrite(const Timespan& timeout = Timespan::zero());
+
+    //! Transfer data from the pipe into the file at the given offset
+    /*!
+        Transfer is positional as File::WriteAt() and does not change the file
+        offset or the file write buffer. If the pipe is not opened for  reading
+        or the file is not opened for writing the method will raise  a  system
+        exception!
+
+        \param file - File to write
+        \param offset - File offset
+        \param size - Maximal count of bytes to transfer
+        \return Count of transferred bytes (0 at the end of the pipe or if the non-blocking pipe is empty)
+    */
+    size_t TransferTo(File& file, uint64_t offset, size_t size);
+    //! Transfer data from the file at the given offset into the pipe
+    /*!
+        Transfer is positional as File::ReadAt() and does not change the file
+        offset or the file read buffer. If the pipe is not opened for writing
+        or the file is not opened for reading the method will raise a  system
+        exception!
+
+        \param file - File to read
+        \param offset - File offset
+        \param size - Maximal count of bytes to transfer
+        \return Count of transferred bytes (0 at the end of the file or if the non-blocking pipe is full)
+    */
+    size_t TransferFrom(const File& file, uint64_t offset, size_t size);
+    //! Duplicate data of the pipe into another pipe without consuming it
+    /*!
+        Supported only on Linux, other platforms raise a system exception!
+
+        \param pipe - Target pipe opened for writing
+        \param size - Maximal count of bytes to duplicate
+        \return Count of duplicated bytes (0 if the current pipe is empty or closed)
+    */
+    size_t Tee(Pipe& pipe, size_t size);
 
     //! Close the read pipe endpoint
     void CloseRead();
@@ -10,6 +10,7 @@
 #define CPPCOMMON_SYSTEM_PROCESS_H
 
 #include "errors/exceptions.h"
+#include "system/cpu_set.h"
 #include "system/pipe.h"
 #include "time/timestamp.h"
 
@@ -27,6 +28,42 @@
 
 namespace CppCommon {
 
+//! Process priorities
+enum class ProcessPriority : uint8_t
+{
+    INHERIT,    //!< Inherit the parent process priority
+    IDLE,       //!< Idle process priority (nice 19 on Unix)
+    LOW,        //!< Low process priority (nice 10 on Unix)
+    NORMAL,     //!< Normal process priority (nice 0 on Unix)
+    HIGH,       //!< High process priority (nice -10 on Unix)
+    REALTIME    //!< Realtime process priority (nice -20 on Unix)
+};
+
+//! Process launch options
+/*!
+    Launch options place the new process before it executes its image, so the
+    new process never runs on logical processors outside of the given CPU
+    affinity or outside of the given cgroup, even for a moment.
+
+    NUMA node and cgroup placement are supported only on Linux. Raising the
+    process priority above the normal one requires privileges.
+*/
+struct ProcessOptions
+{
+    //! CPU affinity of the new process (empty to inherit the parent process CPU affinity)
+    CPUSet affinity;
+    //! Preferred NUMA node for memory allocations of the new process (-1 to inherit the parent process memory policy)
+    int node{-1};
+    //! Priority of the new process
+    ProcessPriority priority{ProcessPriority::INHERIT};
+    //! Cgroup directory to place the new process (e.g. "/sys/fs/cgroup/helpers", empty to inherit the parent process cgroup)
+    std::string cgroup;
+
+    //! Are all launch options inherited from the parent process?
+    bool empty() const noexcept
+    { return affinity.none() && (node < 0) && (priority == ProcessPriority::INHERIT) && cgroup.empty(); }
+};
+
 //! Process abstraction
 /*!
     Process contains different kinds of process manipulation functionality such as
@@ -46,6 +83,15 @@ public:
 
     //! Get the process Id
     uint64_t pid() const noexcept;
+    //! Get the native waitable process handle
+    /*!
+        Process handle becomes signaled when the process exits, so it could be
+        waited together with other handles of the event loop (pidfd for Linux,
+        process handle for Windows).
+
+        \return Native waitable process handle or nullptr if it is not available
+    */
+    void* handle() const noexcept;
 
     //! Is the process is running?
     bool IsRunning() const;
@@ -113,6 +159,14 @@ public:
         new process will use equivalent standard stream of the parent
         process.
 
+        On Unix systems new process is spawned with posix_spawn() which
+        does not copy page tables of the parent process, so the spawn
+        latency does not depend on the parent process memory size.
+        Launch options are applied on Linux by the vfork() child between
+        vfork() and exec(), which also does not copy page tables. On Windows
+        the new process is created suspended and resumed after its CPU
+        affinity is set.
+
         \param command - Command to execute
         \param arguments - Pointer to arguments vector (default is nullptr)
         \param envars - Pointer to environment variables map (default is nullptr)
@@ -120,9 +174,10 @@ public:
         \param input - Input communication pipe (default is nullptr)
         \param output - Output communication pipe (default is nullptr)
         \param error - Error communication pipe (default is nullptr)
+        \param options - Launch options (default is nullptr - inherit the parent process placement)
         \return Created process
     */
-    static Process Execute(const std::string& command, const std::vector<std::string>* arguments = nullptr, const std::map<std::string, std::string>* envars = nullptr, const std::string* directory = nullptr, Pipe* input = nullptr, Pipe* output = nullptr, Pipe* error = nullptr);
+    static Process Execute(const std::string& command, const std::vector<std::string>* arguments = nullptr, const std::map<std::string, std::string>* envars = nullptr, const std::string* directory = nullptr, Pipe* input = nullptr, Pipe* output = nullptr, Pipe* error = nullptr, const ProcessOptions* options = nullptr);
 
     //! Swap two instances
     void swap(Process& process) noexcept;
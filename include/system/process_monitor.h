@@ -0,0 +1,115 @@
+/*!
+    \file process_monitor.h
+    \brief Process monitor definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_SYSTEM_PROCESS_MONITOR_H
+#define CPPCOMMON_SYSTEM_PROCESS_MONITOR_H
+
+#include "common/function.h"
+#include "system/process.h"
+
+#include <memory>
+
+namespace CppCommon {
+
+//! Process monitor
+/*!
+    Process monitor multiplexes exit notifications of many watched processes
+    and calls the given callback once for each exited process. It replaces
+    dedicated watcher threads of each child process with a single one:
+    - Linux process descriptors (pidfd) are waited with epoll;
+    - Windows processes are assigned to job objects associated with the
+      single I/O completion port;
+    - on other platforms processes are polled without blocking.
+
+    Process monitor could be driven by the caller with Poll() method (e.g.
+    from an event loop) or by the dedicated thread started with Start()
+    method. Callbacks are called without the process monitor lock, so
+    callbacks may watch and unwatch other processes.
+
+    Exit result of the watched child process is collected by the process
+    monitor, so Process::Wait() must not be called for it. Exit result is
+    the process exit code, the negative signal number if the process was
+    killed by a signal or std::numeric_limits<int>::min() if it could not
+    be collected (e.g. the watched process is not a child one).
+
+    Callbacks must not throw.
+
+    Thread-safe.
+*/
+class ProcessMonitor
+{
+public:
+    //! Process exit callback with the process Id and its exit result
+    typedef Function<void(uint64_t, int), 256> Callback;
+
+    ProcessMonitor();
+    ProcessMonitor(const ProcessMonitor&) = delete;
+    ProcessMonitor(ProcessMonitor&&) = delete;
+    ~ProcessMonitor();
+
+    ProcessMonitor& operator=(const ProcessMonitor&) = delete;
+    ProcessMonitor& operator=(ProcessMonitor&&) = delete;
+
+    //! Check if the process monitor is not empty
+    explicit operator bool() const { return !empty(); }
+
+    //! Is the process monitor empty?
+    bool empty() const { return size() == 0; }
+    //! Get the count of watched processes
+    size_t size() const;
+
+    //! Is the dedicated process monitor thread running?
+    bool IsRunning() const noexcept;
+
+    //! Watch the given process
+    /*!
+        \param process - Process to watch
+        \param callback - Process exit callback
+    */
+    template <class TCallback>
+    void Watch(const Process& process, TCallback&& callback)
+    { Insert(process, Callback(std::forward<TCallback>(callback))); }
+    //! Stop watching the process with the given Id
+    /*!
+        \param pid - Process Id
+        \return 'true' if the process was watched, 'false' if the process was not watched or its callback is already called
+    */
+    bool Unwatch(uint64_t pid);
+
+    //! Wait for exited processes and call their callbacks
+    /*!
+        Will block for the given timespan in the worst case.
+
+        \param timespan - Timespan to wait for exited processes (default is zero)
+        \return Count of called callbacks
+    */
+    size_t Poll(const Timespan& timespan = Timespan::zero());
+
+    //! Start the dedicated process monitor thread
+    /*!
+        \return 'true' if the thread was started, 'false' if it is already running
+    */
+    bool Start();
+    //! Stop the dedicated process monitor thread
+    /*!
+        \return 'true' if the thread was stopped, 'false' if it is not running
+    */
+    bool Stop();
+
+private:
+    class Impl;
+    std::unique_ptr<Impl> _pimpl;
+
+    void Insert(const Process& process, Callback&& callback);
+};
+
+/*! \example system_process_monitor.cpp Process monitor example */
+
+} // namespace CppCommon
+
+#endif // CPPCOMMON_SYSTEM_PROCESS_MONITOR_H
@@ -0,0 +1,109 @@
+/*!
+    \file profiler.h
+    \brief Sampling CPU profiler definition
+    \author Ivan Shynkarenka
+    \date 15.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_SYSTEM_PROFILER_H
+#define CPPCOMMON_SYSTEM_PROFILER_H
+
+#include "filesystem/path.h"
+#include "time/timespan.h"
+#include "utility/singleton.h"
+
+#include <memory>
+#include <string>
+
+namespace CppCommon {
+
+//! Sampling CPU profiler
+/*!
+    Sampling CPU profiler arms the profiling interval timer (SIGPROF), which
+    is delivered to threads proportionally to their CPU time. Signal handler
+    captures raw frame addresses with StackTrace::Capture() into the slot of
+    the preallocated buffer claimed with atomic operations only, so sampling
+    never allocates or locks. The collector thread periodically drains ready
+    slots and counts unique stacks. Symbols are resolved only when the profile
+    is written, using the StackTrace symbol cache.
+
+    Profile is written in folded stacks format ("root;caller;callee count")
+    which is consumed by flame graph tools, so production processes could be
+    profiled on demand without perf permissions.
+
+    Profiler is available only for Unix platforms. SIGPROF handler remains
+    installed after the first start and ignores signals when the profiler is
+    stopped.
+
+    Thread-safe.
+
+    https://github.com/brendangregg/FlameGraph
+*/
+class Profiler : public Singleton<Profiler>
+{
+    friend Singleton<Profiler>;
+
+public:
+    //! Default count of preallocated sample slots
+    static const size_t DEFAULT_CAPACITY = 4096;
+    //! Maximal count of captured frames of a single sample
+    static const int MAX_FRAMES = 64;
+
+    Profiler(const Profiler&) = delete;
+    Profiler(Profiler&&) = delete;
+    ~Profiler();
+
+    Profiler& operator=(const Profiler&) = delete;
+    Profiler& operator=(Profiler&&) = delete;
+
+    //! Is the sampling profiler supported on the current platform?
+    static bool IsSupported() noexcept;
+    //! Is the sampling profiler started?
+    static bool IsStarted() noexcept;
+
+    //! Start sampling with the given interval
+    /*!
+        Clears the profile of the previous session.
+
+        \param interval - Sampling interval of the process CPU time (default is 10 milliseconds)
+        \param capacity - Count of preallocated sample slots (must be a power of two, default is DEFAULT_CAPACITY)
+        \return 'true' if the profiler was started, 'false' if it is already started or not supported
+    */
+    static bool Start(const Timespan& interval = Timespan::milliseconds(10), size_t capacity = DEFAULT_CAPACITY);
+    //! Stop sampling and collect all captured samples
+    /*!
+        \return 'true' if the profiler was stopped, 'false' if it is not started
+    */
+    static bool Stop();
+
+    //! Get the count of collected samples of the current or the last session
+    static uint64_t samples() noexcept;
+    //! Get the count of samples dropped because of busy sample slots of the current or the last session
+    static uint64_t dropped() noexcept;
+
+    //! Get the profile of the current or the last session in folded stacks format
+    /*!
+        Symbols of collected stacks are resolved on the call.
+
+        \return Folded stacks, one unique stack per line
+    */
+    static std::string Folded();
+    //! Write the profile of the current or the last session in folded stacks format into the given file
+    /*!
+        \param path - Folded stacks file path
+    */
+    static void WriteFolded(const Path& path);
+
+private:
+    class Impl;
+    std::unique_ptr<Impl> _pimpl;
+
+    Profiler();
+};
+
+/*! \example system_profiler.cpp Sampling CPU profiler example */
+
+} // namespace CppCommon
+
+#endif // CPPCOMMON_SYSTEM_PROFILER_H
@@ -0,0 +1,117 @@
+/*!
+    \file resource_usage.h
+    \brief Resource usage definition
+    \author Ivan Shynkarenka
+    \date 15.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_SYSTEM_RESOURCE_USAGE_H
+#define CPPCOMMON_SYSTEM_RESOURCE_USAGE_H
+
+#include "time/timespan.h"
+
+#include <cstdint>
+
+namespace CppCommon {
+
+//! Resource usage
+/*!
+    Resource usage is the snapshot of cumulative resource counters of the
+    current process or the current thread: CPU time, resident set size, page
+    faults and context switches. Counters which are not reported by the
+    platform are zero:
+    - Linux reports all counters (getrusage and /proc/self/statm);
+    - Apple does not report page faults and context switches of threads;
+    - Windows reports only the total count of page faults (as minor ones)
+      and does not report context switches.
+
+    Resident set size is always reported for the whole process, because
+    threads share the process memory.
+
+    Thread-safe.
+*/
+struct ResourceUsage
+{
+    Timespan user_time;                 //!< CPU time spent in the user mode
+    Timespan system_time;               //!< CPU time spent in the kernel mode
+    uint64_t rss{0};                    //!< Current resident set size in bytes
+    uint64_t peak_rss{0};               //!< Peak resident set size in bytes
+    uint64_t minor_faults{0};           //!< Page faults served without I/O
+    uint64_t major_faults{0};           //!< Page faults served with I/O
+    uint64_t voluntary_switches{0};     //!< Context switches caused by waiting for a resource
+    uint64_t involuntary_switches{0};   //!< Context switches caused by the scheduler preemption
+
+    //! Get the total CPU time (user and kernel modes)
+    Timespan cpu_time() const noexcept { return user_time + system_time; }
+
+    //! Get the resource usage of the current process
+    static ResourceUsage CurrentProcess();
+    //! Get the resource usage of the current thread
+    static ResourceUsage CurrentThread();
+};
+
+//! Resource usage sampler
+/*!
+    Resource usage sampler takes resource usage snapshots of the current
+    process or the current thread and calculates deltas of cumulative counters
+    between successive samples. It is cheap enough to be called every second
+    (e.g. from a metrics timer) to correlate performance regressions with CPU
+    time, page faults and context switches.
+
+    Resident set sizes of the delta are the current ones, not the difference.
+
+    Thread sampler must be sampled from the thread which created it.
+
+    Not thread-safe.
+*/
+class ResourceUsageSampler
+{
+public:
+    //! Initialize the resource usage sampler and take the first sample
+    /*!
+        \param thread - Sample the current thread instead of the current process (default is false)
+    */
+    explicit ResourceUsageSampler(bool thread = false);
+    ResourceUsageSampler(const ResourceUsageSampler&) = default;
+    ResourceUsageSampler(ResourceUsageSampler&&) = default;
+    ~ResourceUsageSampler() = default;
+
+    ResourceUsageSampler& operator=(const ResourceUsageSampler&) = default;
+    ResourceUsageSampler& operator=(ResourceUsageSampler&&) = default;
+
+    //! Is the current thread sampled?
+    bool thread() const noexcept { return _thread; }
+
+    //! Get the last resource usage snapshot
+    const ResourceUsage& total() const noexcept { return _total; }
+    //! Get the resource usage delta between two last samples
+    const ResourceUsage& delta() const noexcept { return _delta; }
+    //! Get the elapsed wall time between two last samples
+    const Timespan& elapsed() const noexcept { return _elapsed; }
+
+    //! Get the CPU utilization between two last samples
+    /*!
+        \return CPU utilization (1.0 means one fully busy logical processor)
+    */
+    double utilization() const noexcept;
+
+    //! Take the next sample
+    /*!
+        \return Resource usage delta since the previous sample
+    */
+    const ResourceUsage& Sample();
+
+private:
+    bool _thread;
+    uint64_t _timestamp;
+    ResourceUsage _total;
+    ResourceUsage _delta;
+    Timespan _elapsed;
+};
+
+/*! \example system_resource_usage.cpp Resource usage example */
+
+} // namespace CppCommon
+
+#endif // CPPCOMMON_SYSTEM_RESOURCE_USAGE_H
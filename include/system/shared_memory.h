@@ -9,6 +9,7 @@
 #ifndef CPPCOMMON_SYSTEM_SHARED_MEMORY_H
 #define CPPCOMMON_SYSTEM_SHARED_MEMORY_H
 
+#include "common/flags.h"
 #include "errors/exceptions.h"
 
 #include <memory>
@@ -16,11 +17,37 @@
 
 namespace CppCommon {
 
+//! Shared memory options
+enum class SharedMemoryOptions
+{
+    NONE      = 0x00,   //!< None
+    PREFAULT  = 0x01,   //!< Pre-fault all pages of the mapped segment (MAP_POPULATE on Linux, touch pages on other platforms)
+    LOCK      = 0x02,   //!< Lock pages of the mapped segment in the physical memory (mlock / VirtualLock)
+    HUGEPAGES = 0x04    //!< Back the segment with huge pages (hugetlbfs on Linux, SEC_LARGE_PAGES on Windows)
+};
+
 //! Shared memory manager
 /*!
     Shared memory manager allows to create named memory buffers shared between multiple processes.
     This is one of the common ways to organize different kinds of IPC (inter-process communication).
 
+    Pages of the shared memory segment are faulted in lazily on the first touch
+    by default. Latency critical processes should use SharedMemoryOptions::PREFAULT
+    and SharedMemoryOptions::LOCK options to fault in and lock all pages on mapping,
+    so the first access to the segment does not stall on page faults.
+
+    SharedMemoryOptions::HUGEPAGES option backs the segment with huge pages to
+    reduce TLB misses. On Linux the segment is created in the first mounted
+    hugetlbfs file system instead of POSIX shared memory, so all processes must
+    use the same option to open the segment. On Windows the process must have
+    SeLockMemoryPrivilege. If huge pages are not available the segment falls
+    back to ordinary pages (transparent huge pages are requested on Linux), check
+    huge() method to find out the actual backing.
+
+    If the NUMA node is given, pages of the new segment are bound to the memory
+    of the node (mbind() on Linux, CreateFileMappingNuma() on Windows, ignored on
+    other platforms).
+
     Not thread-safe.
 
     https://en.wikipedia.org/wiki/Shared_memory_(interprocess_communication)
@@ -32,8 +59,10 @@ public:
     /*!
         \param name - Shared memory block name
         \param size - Shared memory block size
+        \param options - Shared memory options (default is SharedMemoryOptions::NONE)
+        \param node - NUMA node to bind pages of the new block (default is -1 - no binding)
     */
-    explicit SharedMemory(const std::string& name, size_t size);
+    explicit SharedMemory(const std::string& name, size_t size, const Flags<SharedMemoryOptions>& options = SharedMemoryOptions::NONE, int node = -1);
     SharedMemory(const SharedMemory&) = delete;
     SharedMemory(SharedMemory&& shmem) = delete;
     ~SharedMemory();
@@ -56,6 +85,10 @@ public:
 
     //! Get the shared memory owner flag (true if the new one was created, false if the existing one was opened)
     bool owner() const;
+    //! Is the shared memory block backed with huge pages?
+    bool huge() const;
+    //! Is the shared memory block locked in the physical memory?
+    bool locked() const;
 
 private:
     class Impl;
@@ -75,4 +108,6 @@ private:
 
 } // namespace CppCommon
 
+ENUM_FLAGS(CppCommon::SharedMemoryOptions)
+
 #endif // CPPCOMMON_SYSTEM_SHARED_MEMORY_H
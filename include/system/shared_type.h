@@ -30,8 +30,10 @@ public:
     //! Create a new or open existing shared memory type with a given name
     /*!
         \param name - Shared memory type name
+        \param options - Shared memory options (default is SharedMemoryOptions::NONE)
+        \param node - NUMA node to bind the shared memory pages (default is -1 for no binding)
     */
-    explicit SharedType(const std::string& name);
+    explicit SharedType(const std::string& name, const Flags<SharedMemoryOptions>& options = SharedMemoryOptions::NONE, int node = -1);
     SharedType(const SharedType<T>&) = delete;
     SharedType(SharedType<T>&&) = delete;
     ~SharedType() = default;
@@ -69,6 +71,10 @@ public:
 
     //! Get the shared memory type owner flag (true if the new one was created, false if the existing one was opened)
     bool owner() const { return _shared.owner(); }
+    //! Is the shared memory type backed with huge pages?
+    bool huge() const { return _shared.huge(); }
+    //! Is the shared memory type locked in the physical memory?
+    bool locked() const { return _shared.locked(); }
 
 private:
     SharedMemory _shared;
@@ -9,7 +9,7 @@
 namespace CppCommon {
 
 template <typename T>
-inline SharedType<T>::SharedType(const std::string& name) : _shared(name, sizeof(T))
+inline SharedType<T>::SharedType(const std::string& name, const Flags<SharedMemoryOptions>& options, int node) : _shared(name, sizeof(T), options, node)
 {
     // Check for the owner flag
     if (_shared.owner())
@@ -11,6 +11,7 @@
 
 #include "string/format.h"
 
+#include <atomic>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -27,6 +28,12 @@ namespace CppCommon {
 /*!
     Capture the current stack trace snapshot with easy-to-use interface.
 
+    Stack trace snapshot captures only frame addresses, which is cheap enough
+    for hot error paths. Symbols of frames are resolved lazily on the first
+    access to frames (e.g. when the stack trace is printed) using the process
+    wide symbol cache, so each frame address and each module is resolved only
+    once.
+
     Thread-safe.
 */
 class StackTrace
@@ -55,15 +62,42 @@ public:
         \param skip - Skip frames count (default is 0)
     */
     explicit StackTrace(int skip = 0);
-    StackTrace(const StackTrace&) = default;
-    StackTrace(StackTrace&&) noexcept = default;
+    //! Initialize the stack trace snapshot with the given captured frame addresses
+    /*!
+        \param frames - Captured frame addresses
+        \param count - Captured frames count
+    */
+    explicit StackTrace(void* const* frames, size_t count);
+    StackTrace(const StackTrace& stack_trace);
+    StackTrace(StackTrace&& stack_trace) noexcept;
     ~StackTrace() = default;
 
-    StackTrace& operator=(const StackTrace&) = default;
-    StackTrace& operator=(StackTrace&&) noexcept = default;
+    StackTrace& operator=(const StackTrace& stack_trace);
+    StackTrace& operator=(StackTrace&& stack_trace) noexcept;
 
+    //! Capture frame addresses of the current stack trace without resolving symbols
+    /*!
+        Raw capture is much cheaper than the stack trace snapshot, so it could be
+        used in hot paths to resolve symbols later with StackTrace(frames, count).
+
+        \param frames - Frame addresses buffer
+        \param capacity - Frame addresses buffer capacity
+        \param skip - Skip frames count (default is 0)
+        \return Count of captured frames
+    */
+    static int Capture(void** frames, int capacity, int skip = 0) noexcept;
+
+    //! Get captured frame addresses
+    const std::vector<void*>& addresses() const noexcept { return _addresses; }
     //! Get stack trace frames
-    const std::vector<Frame>& frames() const noexcept { return _frames; }
+    /*!
+        Symbols of captured frames are resolved on the first call.
+    */
+    const std::vector<Frame>& frames() const
+    { if (!IsResolved()) Resolve(); return _frames; }
+
+    //! Is the stack trace snapshot resolved?
+    bool IsResolved() const noexcept { return _resolved.load(std::memory_order_acquire); }
 
     //! Get string from the current stack trace snapshot
     std::string string() const
@@ -73,7 +107,16 @@ public:
     friend std::ostream& operator<<(std::ostream& os, const StackTrace& stack_trace);
 
 private:
-    std::vector<Frame> _frames;
+    std::vector<void*> _addresses;
+    mutable std::vector<Frame> _frames;
+    mutable std::atomic<bool> _resolved;
+
+    friend class StackTraceManager;
+
+    //! Resolve symbols of captured frame addresses
+    void Resolve() const;
+    //! Clear the process wide symbol cache
+    static void ClearCache();
 };
 
 /*! \example system_stack_trace.cpp Stack trace snapshot provider example */
@@ -19,6 +19,8 @@ namespace CppCommon {
 //! Stack trace manager
 /*!
     Provides interface to initialize and cleanup stack trace snapshots capturing.
+    Cleanup also releases the process wide symbol cache of stack trace snapshots
+    (resolved symbols and opened modules), which is kept across all snapshots.
 
     Not thread-safe.
 */
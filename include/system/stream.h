@@ -12,7 +12,9 @@
 #include "common/reader.h"
 #include "common/writer.h"
 #include "errors/exceptions.h"
+#include "time/timespan.h"
 
+#include <cstdint>
 #include <memory>
 
 namespace CppCommon {
@@ -68,14 +70,55 @@ private:
     alignas(StorageAlign) std::byte _storage[StorageSize];
 };
 
+//! Standard stream backpressure policy
+enum class StdStreamBackpressure
+{
+    BLOCK,      //!< Block the writer until the buffer is flushed
+    DROP        //!< Drop the written data and count dropped bytes
+};
+
+//! Standard stream buffering settings
+/*!
+    Buffered standard stream coalesces writes into the buffer of the given
+    size and writes it into the stream when it is full, on Flush() call or
+    when the buffered data gets older than the given flush interval.
+
+    With the background flusher thread writers only copy data into the front
+    buffer while the flusher writes the back one into the stream, so a slow
+    stream consumer (e.g. a log shipper reading the container output) does
+    not stall them. If both buffers are full the writer is blocked or the
+    written data is dropped according to the backpressure policy. Without the
+    flusher thread the writer flushes the full buffer itself and is always
+    blocked.
+*/
+struct StdStreamBuffering
+{
+    //! Buffer size in bytes
+    size_t size = 65536;
+    //! Maximal age of the buffered data (zero to flush only full buffers)
+    Timespan interval = Timespan::milliseconds(100);
+    //! Flush the buffer with the background thread
+    bool flusher = true;
+    //! Backpressure policy of the full buffer (used with the flusher thread)
+    StdStreamBackpressure backpressure = StdStreamBackpressure::BLOCK;
+};
+
 //! Standard output stream
 /*!
+    Standard output stream writes directly into the stream by default or
+    coalesces writes in the buffered mode (see StdStreamBuffering).
+
     Thread-safe.
 */
 class StdOutput : public Writer
 {
 public:
     StdOutput();
+    //! Initialize the buffered standard stream with the given buffering settings
+    /*!
+        \param buffering - Buffering settings
+    */
+    explicit StdOutput(const StdStreamBuffering& buffering);
     StdOutput(const StdOutput&) = delete;
     StdOutput(StdOutput&& stream) = delete;
     virtual ~StdOutput();
@@ -91,6 +134,11 @@ public:
 
     //! Is stream valid?
     bool IsValid() const noexcept;
+    //! Is stream buffered?
+    bool IsBuffered() const noexcept;
+
+    //! Get the count of dropped bytes in the buffered mode
+    uint64_t dropped() const noexcept;
 
     //! Write a byte buffer into the stream
     /*!
@@ -99,8 +147,17 @@ public:
         \return Count of written bytes
     */
     size_t Write(const void* buffer, size_t size) override;
+    //! Write bytes buffers into the stream with one stream lock
+    /*!
+        If the stream is not valid the method will raise a system exception!
+
+        \param buffers - Buffers to write
+        \return Count of written bytes
+    */
+    size_t WriteV(std::span<const WriteBuffer> buffers) override;
 
     using Writer::Write;
+    using Writer::WriteV;
 
     //! Flush the stream
     void Flush() override;
@@ -115,19 +172,27 @@ private:
     Impl& impl() noexcept { return reinterpret_cast<Impl&>(_storage); }
     const Impl& impl() const noexcept { return reinterpret_cast<Impl const&>(_storage); }
 
-    static const size_t StorageSize = 8;
+    static const size_t StorageSize = 16;
     static const size_t StorageAlign = 8;
     alignas(StorageAlign) std::byte _storage[StorageSize];
 };
 
 //! Standard error stream
 /*!
+    Standard error stream writes directly into the stream by default or
+    coalesces writes in the buffered mode (see StdStreamBuffering).
+
     Thread-safe.
 */
 class StdError : public Writer
 {
 public:
     StdError();
+    //! Initialize the buffered standard stream with the given buffering settings
+    /*!
+        \param buffering - Buffering settings
+    */
+    explicit StdError(const StdStreamBuffering& buffering);
     StdError(const StdError&) = delete;
     StdError(StdError&& stream) = delete;
     virtual ~StdError();
@@ -143,6 +208,11 @@ public:
 
     //! Is stream valid?
     bool IsValid() const noexcept;
+    //! Is stream buffered?
+    bool IsBuffered() const noexcept;
+
+    //! Get the count of dropped bytes in the buffered mode
+    uint64_t dropped() const noexcept;
 
     //! Write a byte buffer into the stream
     /*!
@@ -151,8 +221,17 @@ public:
         \return Count of written bytes
     */
     size_t Write(const void* buffer, size_t size) override;
+    //! Write bytes buffers into the stream with one stream lock
+    /*!
+        If the stream is not valid the method will raise a system exception!
+
+        \param buffers - Buffers to write
+        \return Count of written bytes
+    */
+    size_t WriteV(std::span<const WriteBuffer> buffers) override;
 
     using Writer::Write;
+    using Writer::WriteV;
 
     //! Flush the stream
     void Flush() override;
@@ -167,7 +246,7 @@ private:
     Impl& impl() noexcept { return reinterpret_cast<Impl&>(_storage); }
     const Impl& impl() const noexcept { return reinterpret_cast<Impl const&>(_storage); }
 
-    static const size_t StorageSize = 8;
+    static const size_t StorageSize = 16;
     static const size_t StorageAlign = 8;
     alignas(StorageAlign) std::byte _storage[StorageSize];
 };
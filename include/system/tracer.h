@@ -0,0 +1,185 @@
+/*!
+    \file tracer.h
+    \brief Scoped tracing spans definition
+    \author Ivan Shynkarenka
+    \date 15.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_SYSTEM_TRACER_H
+#define CPPCOMMON_SYSTEM_TRACER_H
+
+#include "filesystem/path.h"
+#include "threads/spsc_ring_buffer.h"
+#include "time/timestamp.h"
+#include "utility/singleton.h"
+
+#include <atomic>
+#include <memory>
+
+//! @cond INTERNALS
+#define CPPCOMMON_TRACE_CONCAT_IMPL(x, y) x##y
+#define CPPCOMMON_TRACE_CONCAT(x, y) CPPCOMMON_TRACE_CONCAT_IMPL(x, y)
+//! @endcond
+
+//! Trace the current scope with the given name
+/*!
+    Scope is recorded only if the tracer is started. Name must be a string
+    literal or outlive the tracer session.
+*/
+#define TRACE_SCOPE(name) CppCommon::TraceScope CPPCOMMON_TRACE_CONCAT(__trace_scope_, __LINE__)(name)
+//! Trace the current scope with the given name if the given condition is true (e.g. for sampled requests)
+#define TRACE_SCOPE_IF(condition, name) CppCommon::TraceScope CPPCOMMON_TRACE_CONCAT(__trace_scope_, __LINE__)(name, condition)
+
+namespace CppCommon {
+
+//! Trace file format
+enum class TraceFormat
+{
+    CHROME,     //!< Chrome trace event JSON (chrome://tracing, Perfetto UI)
+    PERFETTO    //!< Perfetto protobuf trace (Perfetto UI, trace processor)
+};
+
+//! Trace event
+struct TraceEvent
+{
+    const char* name;   //!< Span name
+    uint64_t thread;    //!< Thread Id
+    uint64_t start;     //!< Start nanosecond timestamp
+    uint64_t stop;      //!< Stop nanosecond timestamp
+};
+
+//! @cond INTERNALS
+namespace Internals {
+
+// Per-thread trace events ring buffer
+struct TraceBuffer
+{
+    SPSCRingBuffer events;
+    uint64_t thread;
+    std::atomic<uint64_t> dropped;
+    std::atomic<bool> closed;
+
+    TraceBuffer(size_t capacity, uint64_t id) : events(capacity), thread(id), dropped(0), closed(false) {}
+};
+
+} // namespace Internals
+//! @endcond
+
+//! Tracer
+/*!
+    Tracer records spans of traced scopes (see TRACE_SCOPE macro) into the
+    per-thread SPSCRingBuffer without locks and allocations. Each span is
+    recorded with start/stop nanosecond timestamps and the thread Id. The
+    dedicated collector thread periodically drains all per-thread buffers
+    and writes spans into the trace file in Chrome trace event JSON or
+    Perfetto protobuf format.
+
+    If the per-thread buffer is full the span is dropped and counted, so
+    recording never blocks. When the tracer is stopped traced scopes cost
+    a single relaxed atomic load.
+
+    Thread-safe.
+
+    https://docs.google.com/document/d/1CvAClvFfyA5R-PhYUmn5OOQtYMH4h6I0nSsKchNAySU
+    https://perfetto.dev/docs/reference/synthetic-track-event
+*/
+class Tracer : public Singleton<Tracer>
+{
+    friend Singleton<Tracer>;
+
+public:
+    //! Default per-thread buffer capacity in bytes
+    static const size_t DEFAULT_CAPACITY = 65536;
+
+    Tracer(const Tracer&) = delete;
+    Tracer(Tracer&&) = delete;
+    ~Tracer();
+
+    Tracer& operator=(const Tracer&) = delete;
+    Tracer& operator=(Tracer&&) = delete;
+
+    //! Is the tracer started?
+    static bool IsStarted() noexcept { return _started.load(std::memory_order_relaxed); }
+
+    //! Start tracing into the given trace file
+    /*!
+        \param path - Trace file path
+        \param format - Trace file format (default is TraceFormat::CHROME)
+        \param capacity - Per-thread buffer capacity in bytes (must be a power of two, default is DEFAULT_CAPACITY)
+        \param period - Collector thread drain period (default is 10 milliseconds)
+        \return 'true' if the tracer was started, 'false' if it is already started
+    */
+    static bool Start(const Path& path, TraceFormat format = TraceFormat::CHROME, size_t capacity = DEFAULT_CAPACITY, const Timespan& period = Timespan::milliseconds(10));
+    //! Stop tracing, write all recorded spans and close the trace file
+    /*!
+        \return 'true' if the tracer was stopped, 'false' if it is not started
+    */
+    static bool Stop();
+
+    //! Get the count of spans written into the trace file during the current or the last session
+    static uint64_t written() noexcept;
+    //! Get the count of spans dropped because of full per-thread buffers during the current or the last session
+    static uint64_t dropped() noexcept;
+
+    //! Record the span of the current thread
+    /*!
+        Will not block.
+
+        \param name - Span name (must be a string literal or outlive the tracer session)
+        \param start - Start nanosecond timestamp
+        \param stop - Stop nanosecond timestamp
+    */
+    static void Record(const char* name, uint64_t start, uint64_t stop) noexcept;
+
+private:
+    class Impl;
+    std::unique_ptr<Impl> _pimpl;
+
+    static inline std::atomic<bool> _started{false};
+    static inline thread_local Internals::TraceBuffer* _buffer = nullptr;
+
+    Tracer();
+
+    //! Register the per-thread buffer of the current thread
+    static Internals::TraceBuffer* RegisterThread() noexcept;
+};
+
+//! Traced scope
+/*!
+    Traced scope records the span from its construction to its destruction
+    if the tracer was started at the construction.
+
+    Not thread-safe.
+*/
+class TraceScope
+{
+public:
+    //! Start the traced scope
+    /*!
+        \param name - Span name (must be a string literal or outlive the tracer session)
+        \param sampled - Sampled flag to trace only some scopes (default is true)
+    */
+    explicit TraceScope(const char* name, bool sampled = true)
+        : _name((sampled && Tracer::IsStarted()) ? name : nullptr),
+          _start((_name != nullptr) ? Timestamp::nano() : 0)
+    {}
+    TraceScope(const TraceScope&) = delete;
+    TraceScope(TraceScope&&) = delete;
+    ~TraceScope() { if (_name != nullptr) Tracer::Record(_name, _start, Timestamp::nano()); }
+
+    TraceScope& operator=(const TraceScope&) = delete;
+    TraceScope& operator=(TraceScope&&) = delete;
+
+private:
+    const char* _name;
+    uint64_t _start;
+};
+
+/*! \example system_tracer.cpp Scoped tracing spans example */
+
+} // namespace CppCommon
+
+#include "tracer.inl"
+
+#endif // CPPCOMMON_SYSTEM_TRACER_H
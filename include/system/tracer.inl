@@ -0,0 +1,27 @@
+/*!
+    \file tracer.inl
+    \brief Scoped tracing spans inline implementation
+    \author Ivan Shynkarenka
+    \date 15.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+inline void Tracer::Record(const char* name, uint64_t start, uint64_t stop) noexcept
+{
+    Internals::TraceBuffer* buffer = _buffer;
+    if (buffer == nullptr)
+    {
+        buffer = RegisterThread();
+        if (buffer == nullptr)
+            return;
+    }
+
+    // Never block the traced thread, count the dropped span instead
+    TraceEvent event = { name, buffer->thread, start, stop };
+    if (!buffer->events.Enqueue(&event, sizeof(event)))
+        buffer->dropped.fetch_add(1, std::memory_order_relaxed);
+}
+
+} // namespace CppCommon
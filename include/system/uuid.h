@@ -9,6 +9,7 @@
 #ifndef CPPCOMMON_SYSTEM_UUID_H
 #define CPPCOMMON_SYSTEM_UUID_H
 
+#include "algorithms/hash.h"
 #include "errors/exceptions.h"
 
 #include <array>
@@ -24,6 +25,7 @@ namespace CppCommon {
     - Nil UUID0 (all bits set to zero)
     - Sequential UUID1 (time based version)
     - Random UUID4 (randomly or pseudo-randomly generated version)
+    - Sortable UUID7 (Unix time ordered version)
 
     A UUID is simply a 128-bit value: "123e4567-e89b-12d3-a456-426655440000"
 
@@ -31,6 +33,7 @@ namespace CppCommon {
 
     https://en.wikipedia.org/wiki/Universally_unique_identifier
     https://www.ietf.org/rfc/rfc4122.txt
+    https://www.rfc-editor.org/rfc/rfc9562
 */
 class UUID
 {
@@ -51,9 +54,13 @@ public:
     explicit constexpr UUID(const char* uuid, size_t size);
     //! Initialize UUID with a given string
     /*!
+        Canonical "00000000-0000-0000-0000-000000000000" strings (optionally
+        in braces) are decoded with SIMD registers, other strings are parsed
+        character by character.
+
         \param uuid - UUID string
     */
-    explicit UUID(const std::string& uuid) : UUID(uuid.data(), uuid.size()) {}
+    explicit UUID(const std::string& uuid);
     //! Initialize UUID with a given 16 bytes data buffer
     /*!
         \param data - UUID 16 bytes data buffer
@@ -94,19 +101,52 @@ public:
 
     //! Get string from the current UUID in format "00000000-0000-0000-0000-000000000000"
     std::string string() const;
+    //! Write the current UUID in format "00000000-0000-0000-0000-000000000000" into the given characters buffer
+    /*!
+        Characters buffer must have space for 36 characters. Terminating zero
+        character is not written.
+
+        \param buffer - Characters buffer
+        \return Pointer to the end of written characters
+    */
+    char* ToChars(char* buffer) const noexcept;
 
     //! Generate nil UUID0 (all bits set to zero)
     static UUID Nil() { return UUID(); }
     //! Generate sequential UUID1 (time based version)
     static UUID Sequential();
     //! Generate random UUID4 (randomly or pseudo-randomly generated version)
+    /*!
+        Random bytes are taken from the per-thread batch filled by the operating
+        system CSPRNG, so only one system call is made for 256 generated UUIDs.
+
+        Thread-safe.
+    */
     static UUID Random();
+    //! Generate the given count of random UUID4 into the given buffer
+    /*!
+        Thread-safe.
+
+        \param uuids - UUIDs buffer
+        \param count - UUIDs count
+    */
+    static void Random(UUID* uuids, size_t count);
+    //! Generate sortable UUID7 (Unix time ordered version)
+    /*!
+        UUID7 starts with 48 bits of the Unix timestamp in milliseconds followed
+        by the 12 bits counter and 62 random bits, so UUIDs are ordered by their
+        creation time and keep B-tree index inserts local. UUIDs generated in the
+        same thread are strictly increasing even within the same millisecond.
+
+        Thread-safe.
+    */
+    static UUID Sortable();
     //! Generate secure UUID4 (secure generated version)
     static UUID Secure();
 
     //! Output instance into the given output stream
     friend std::ostream& operator<<(std::ostream& os, const UUID& uuid)
-    { os << uuid.string(); return os; }
+    { char buffer[36]; os.write(buffer, uuid.ToChars(buffer) - buffer); return os; }
 
     //! Swap two instances
     void swap(UUID& uuid) noexcept;
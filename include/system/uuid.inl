@@ -84,7 +84,8 @@ struct fmt::formatter<CppCommon::UUID> : formatter<std::string_view>
     template <typename FormatContext>
     auto format(const CppCommon::UUID& value, FormatContext& ctx) const
     {
-        return formatter<string_view>::format(value.string(), ctx);
+        char buffer[36];
+        return formatter<string_view>::format(string_view(buffer, value.ToChars(buffer) - buffer), ctx);
     }
 };
 #endif
@@ -105,4 +106,11 @@ struct std::hash<CppCommon::UUID>
         return result;
     }
 };
+
+template <>
+struct CppCommon::FastHash<CppCommon::UUID>
+{
+    size_t operator()(const CppCommon::UUID& value) const noexcept
+    { return (size_t)CppCommon::Hash::Calculate(value.data().data(), value.data().size()); }
+};
 //! \endcond
@@ -0,0 +1,206 @@
+/*!
+    \file actor.h
+    \brief Actor runtime definition
+    \author Ivan Shynkarenka
+    \date 15.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_ACTOR_H
+#define CPPCOMMON_THREADS_ACTOR_H
+
+#include "memory/object_pool.h"
+#include "threads/thread_pool.h"
+
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <utility>
+
+namespace CppCommon {
+
+template <typename TMessage>
+class Actor;
+
+//! Actor system
+/*!
+    Actor system connects actors of the given message type with the work-stealing
+    thread pool and keeps their messages in the lock-free object pool, so sending
+    a message does not allocate once the object pool is warmed up.
+
+    Actor is scheduled onto the thread pool only when its mailbox goes from empty
+    to non-empty. Each activation processes at most the given count of messages
+    and reschedules the actor if its mailbox is still not empty, so busy actors
+    do not starve others.
+
+    Thread pool must be large enough (see ThreadPool capacity) to queue all actors
+    scheduled at the same time, otherwise activations are executed in the sending
+    thread.
+
+    All actors must be destroyed before the actor system.
+
+    Thread-safe.
+*/
+template <typename TMessage>
+class ActorSystem
+{
+    friend class Actor<TMessage>;
+
+public:
+    //! Initialize the actor system
+    /*!
+        \param pool - Thread pool to run actors
+        \param throughput - Maximal count of messages processed in a single actor activation (default is 64)
+        \param chunk - Count of messages in a single chunk of the messages pool (default is 4096)
+        \param chunks - Max chunks count of the messages pool (default is 4096)
+    */
+    explicit ActorSystem(ThreadPool& pool, size_t throughput = 64, size_t chunk = 4096, size_t chunks = 4096);
+    ActorSystem(const ActorSystem&) = delete;
+    ActorSystem(ActorSystem&&) = delete;
+    ~ActorSystem() = default;
+
+    ActorSystem& operator=(const ActorSystem&) = delete;
+    ActorSystem& operator=(ActorSystem&&) = delete;
+
+    //! Get the thread pool
+    ThreadPool& pool() noexcept { return _pool; }
+    //! Get the maximal count of messages processed in a single actor activation
+    size_t throughput() const noexcept { return _throughput; }
+    //! Get the messages pool capacity
+    size_t capacity() const noexcept { return _envelopes.capacity(); }
+
+private:
+    // Intrusive mailbox node
+    struct Node
+    {
+        std::atomic<Node*> next;
+
+        Node() noexcept : next(nullptr) {}
+    };
+
+    // Message envelope
+    struct Envelope : public Node
+    {
+        TMessage message;
+
+        template <class... Args>
+        explicit Envelope(Args&&... args) : message(std::forward<Args>(args)...) {}
+    };
+
+    ThreadPool& _pool;
+    size_t _throughput;
+    DefaultMemoryManager _auxiliary;
+    ObjectPool<Envelope> _envelopes;
+};
+
+//! Actor
+/*!
+    Actor is a stateful entity which processes messages of its mailbox one by
+    one, so its state does not require any synchronization. Derived actor
+    overrides OnMessage() handler, which is never called concurrently for the
+    same actor.
+
+    Mailbox is an intrusive multiple producers / single consumer wait-free
+    linked queue of message envelopes (Dmitry Vyukov's algorithm), so the idle
+    actor takes only a few pointers and costs nothing to the thread pool.
+
+    Messages from the same sender are processed in FIFO order.
+
+    Actor must be idle (e.g. its thread pool is destroyed) before it is destroyed.
+
+    Thread-safe.
+
+    https://www.1024cores.net/home/lock-free-algorithms/queues/intrusive-mpsc-node-based-queue
+*/
+template <typename TMessage>
+class Actor
+{
+public:
+    //! Initialize the actor in the given actor system
+    /*!
+        \param system - Actor system
+    */
+    explicit Actor(ActorSystem<TMessage>& system) noexcept;
+    Actor(const Actor&) = delete;
+    Actor(Actor&&) = delete;
+    virtual ~Actor();
+
+    Actor& operator=(const Actor&) = delete;
+    Actor& operator=(Actor&&) = delete;
+
+    //! Get the actor system
+    ActorSystem<TMessage>& system() noexcept { return _system; }
+
+    //! Get count of pending messages (including the message being processed)
+    size_t pending() const noexcept { return _pending.load(std::memory_order_acquire); }
+
+    //! Send the message to the actor
+    /*!
+        The message will be copied into the actor mailbox.
+
+        Will not block.
+
+        \param message - Message to send
+        \return 'true' if the message was successfully sent, 'false' if the messages pool is exhausted
+    */
+    bool Send(const TMessage& message) { return Emplace(message); }
+    //! Send the message to the actor
+    /*!
+        The message will be moved into the actor mailbox.
+
+        Will not block.
+
+        \param message - Message to send
+        \return 'true' if the message was successfully sent, 'false' if the messages pool is exhausted
+    */
+    bool Send(TMessage&& message) { return Emplace(std::move(message)); }
+    //! Construct the message in place and send it to the actor
+    /*!
+        Will not block.
+
+        \param args - Arguments to construct the message with
+        \return 'true' if the message was successfully sent, 'false' if the messages pool is exhausted
+    */
+    template <class... Args>
+    bool Emplace(Args&&... args);
+
+protected:
+    //! Handle the message
+    /*!
+        Handler must not throw exceptions.
+
+        \param message - Message to handle
+    */
+    virtual void OnMessage(TMessage& message) = 0;
+
+private:
+    typedef typename ActorSystem<TMessage>::Node Node;
+    typedef typename ActorSystem<TMessage>::Envelope Envelope;
+
+    ActorSystem<TMessage>& _system;
+    std::atomic<size_t> _pending;
+    std::atomic<Node*> _tail;
+    Node* _head;
+    Node _stub;
+
+    //! Push the node into the mailbox (multiple producers threads method)
+    void Push(Node* node) noexcept;
+    //! Pop the node from the mailbox (single consumer thread method)
+    /*!
+        \return Popped node or nullptr if the mailbox is empty or the producer is in the middle of push
+    */
+    Node* Pop() noexcept;
+
+    //! Schedule the actor activation onto the thread pool
+    void Schedule();
+    //! Process messages of the mailbox
+    void Activate();
+};
+
+/*! \example threads_actor.cpp Actor runtime example */
+
+} // namespace CppCommon
+
+#include "actor.inl"
+
+#endif // CPPCOMMON_THREADS_ACTOR_H
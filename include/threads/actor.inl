@@ -0,0 +1,126 @@
+/*!
+    \file actor.inl
+    \brief Actor runtime inline implementation
+    \author Ivan Shynkarenka
+    \date 15.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+template <typename TMessage>
+inline ActorSystem<TMessage>::ActorSystem(ThreadPool& pool, size_t throughput, size_t chunk, size_t chunks)
+    : _pool(pool), _throughput(throughput), _envelopes(_auxiliary, chunk, chunks)
+{
+    assert((throughput > 0) && "Actor throughput must be greater than zero!");
+}
+
+template <typename TMessage>
+inline Actor<TMessage>::Actor(ActorSystem<TMessage>& system) noexcept
+    : _system(system), _pending(0), _tail(&_stub), _head(&_stub)
+{
+}
+
+template <typename TMessage>
+inline Actor<TMessage>::~Actor()
+{
+    assert((_pending.load(std::memory_order_acquire) == 0) && "Actor must be idle before destroyed!");
+
+    // Release messages which were never processed
+    Node* node;
+    while ((node = Pop()) != nullptr)
+        _system._envelopes.Release(static_cast<Envelope*>(node));
+}
+
+template <typename TMessage>
+template <class... Args>
+inline bool Actor<TMessage>::Emplace(Args&&... args)
+{
+    Envelope* envelope = _system._envelopes.Create(std::forward<Args>(args)...);
+    if (envelope == nullptr)
+        return false;
+
+    Push(envelope);
+
+    // Schedule the actor only when its mailbox goes from empty to non-empty
+    if (_pending.fetch_add(1, std::memory_order_acq_rel) == 0)
+        Schedule();
+
+    return true;
+}
+
+template <typename TMessage>
+inline void Actor<TMessage>::Push(Node* node) noexcept
+{
+    node->next.store(nullptr, std::memory_order_relaxed);
+    Node* prev = _tail.exchange(node, std::memory_order_acq_rel);
+    prev->next.store(node, std::memory_order_release);
+}
+
+template <typename TMessage>
+inline typename Actor<TMessage>::Node* Actor<TMessage>::Pop() noexcept
+{
+    Node* head = _head;
+    Node* next = head->next.load(std::memory_order_acquire);
+
+    // Skip the stub node
+    if (head == &_stub)
+    {
+        if (next == nullptr)
+            return nullptr;
+        _head = next;
+        head = next;
+        next = next->next.load(std::memory_order_acquire);
+    }
+
+    if (next != nullptr)
+    {
+        _head = next;
+        return head;
+    }
+
+    // Producer exchanged the tail, but did not link the node yet
+    if (head != _tail.load(std::memory_order_acquire))
+        return nullptr;
+
+    // The last node could be taken only after the stub node is pushed behind it
+    Push(&_stub);
+    next = head->next.load(std::memory_order_acquire);
+    if (next != nullptr)
+    {
+        _head = next;
+        return head;
+    }
+
+    return nullptr;
+}
+
+template <typename TMessage>
+inline void Actor<TMessage>::Schedule()
+{
+    _system._pool.Submit([this]() { Activate(); });
+}
+
+template <typename TMessage>
+inline void Actor<TMessage>::Activate()
+{
+    // Process the bounded batch of messages
+    size_t processed = 0;
+    while (processed < _system._throughput)
+    {
+        Node* node = Pop();
+        if (node == nullptr)
+            break;
+
+        Envelope* envelope = static_cast<Envelope*>(node);
+        OnMessage(envelope->message);
+        _system._envelopes.Release(envelope);
+        ++processed;
+    }
+
+    // Reschedule the actor if more messages arrived (or the producer is in the middle of push)
+    if ((_pending.fetch_sub(processed, std::memory_order_acq_rel) - processed) > 0)
+        Schedule();
+}
+
+} // namespace CppCommon
@@ -0,0 +1,155 @@
+/*!
+    \file adaptive_lock.h
+    \brief Adaptive spin-then-park lock synchronization primitive definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_ADAPTIVE_LOCK_H
+#define CPPCOMMON_THREADS_ADAPTIVE_LOCK_H
+
+#include "threads/locker.h"
+#include "threads/wait_strategy.h"
+#include "time/timestamp.h"
+
+#include <atomic>
+#include <cstdint>
+
+namespace CppCommon {
+
+//! Adaptive lock synchronization primitive
+/*!
+    Adaptive lock combines the spin-lock and the mutex. Uncontended lock and
+    unlock cost a single atomic operation as of the spin-lock. Contended lock
+    spins with CPU relax instructions and exponential backoff for the spin
+    budget calibrated from the given spin timespan, and then parks the thread
+    on the futex (Linux) or WaitOnAddress (Windows). So the lock does not burn
+    CPU when its owner is descheduled, and unlock makes a system call only
+    when there is at least one parked thread.
+
+    Lock keeps contention counters (contended locks, locks acquired in spin
+    and parks), which are updated only on the contended path.
+
+    Not recursive.
+
+    Thread-safe.
+*/
+class AdaptiveLock
+{
+public:
+    //! Default class constructor
+    /*!
+        \param spin - Spin timespan before park (default is 4 microseconds)
+    */
+    explicit AdaptiveLock(const Timespan& spin = Timespan::microseconds(4));
+    AdaptiveLock(const AdaptiveLock&) = delete;
+    AdaptiveLock(AdaptiveLock&&) = delete;
+    ~AdaptiveLock() = default;
+
+    AdaptiveLock& operator=(const AdaptiveLock&) = delete;
+    AdaptiveLock& operator=(AdaptiveLock&&) = delete;
+
+    //! Get count of spin iterations before park
+    uint32_t spins() const noexcept { return _spins; }
+
+    //! Get count of contended locks
+    uint64_t contentions() const noexcept { return _contentions.load(std::memory_order_relaxed); }
+    //! Get count of contended locks acquired in spin without park
+    uint64_t spinned() const noexcept { return _spinned.load(std::memory_order_relaxed); }
+    //! Get count of thread parks
+    uint64_t parks() const noexcept { return _parks.load(std::memory_order_relaxed); }
+
+    //! Is already locked?
+    /*!
+        Will not block.
+
+        \return 'true' if the adaptive lock is already locked, 'false' if the adaptive lock is released
+    */
+    bool IsLocked() const noexcept;
+
+    //! Try to acquire adaptive lock without block
+    /*!
+        Will not block.
+
+        \return 'true' if the adaptive lock was successfully acquired, 'false' if the adaptive lock is busy
+    */
+    bool TryLock() noexcept;
+
+    //! Try to acquire adaptive lock for the given spin count
+    /*!
+        Will block for the given spin count in the worst case.
+
+        \param spin - Spin count
+        \return 'true' if the adaptive lock was successfully acquired, 'false' if the adaptive lock is busy
+    */
+    bool TryLockSpin(int64_t spin) noexcept;
+
+    //! Try to acquire adaptive lock for the given timespan
+    /*!
+        Spins for the spin budget and then yields until the given timespan is over.
+
+        Will block for the given timespan in the worst case.
+
+        \param timespan - Timespan to wait for the adaptive lock
+        \return 'true' if the adaptive lock was successfully acquired, 'false' if the adaptive lock is busy
+    */
+    bool TryLockFor(const Timespan& timespan);
+    //! Try to acquire adaptive lock until the given timestamp
+    /*!
+        Will block until the given timestamp in the worst case.
+
+        \param timestamp - Timestamp to stop wait for the adaptive lock
+        \return 'true' if the adaptive lock was successfully acquired, 'false' if the adaptive lock is busy
+    */
+    bool TryLockUntil(const UtcTimestamp& timestamp)
+    { return TryLockFor(timestamp - UtcTimestamp()); }
+
+    //! Acquire adaptive lock with block
+    /*!
+        Will spin and then block.
+    */
+    void Lock() noexcept;
+
+    //! Release adaptive lock
+    /*!
+        Will not block.
+    */
+    void Unlock() noexcept;
+
+    //! Get count of spin iterations for the given spin timespan
+    /*!
+        CPU relax instruction cost is calibrated once per process.
+
+        \param spin - Spin timespan
+        \return Count of spin iterations
+    */
+    static uint32_t CalibrateSpins(const Timespan& spin);
+
+private:
+    // Lock states
+    static const uint32_t UNLOCKED = 0;
+    static const uint32_t LOCKED = 1;
+    static const uint32_t CONTENDED = 2;
+    // Max count of relax instructions between two lock attempts
+    static const uint32_t MAX_BACKOFF = 64;
+
+    std::atomic<uint32_t> _state;
+    uint32_t _spins;
+    std::atomic<uint64_t> _contentions;
+    std::atomic<uint64_t> _spinned;
+    std::atomic<uint64_t> _parks;
+
+    //! Spin with exponential backoff for the given count of iterations
+    bool Spin(uint64_t spins) noexcept;
+    //! Contended lock path
+    void LockSlow() noexcept;
+};
+
+/*! \example threads_adaptive_lock.cpp Adaptive lock synchronization primitive example */
+
+} // namespace CppCommon
+
+#include "adaptive_lock.inl"
+
+#endif // CPPCOMMON_THREADS_ADAPTIVE_LOCK_H
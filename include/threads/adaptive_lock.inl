@@ -0,0 +1,62 @@
+/*!
+    \file adaptive_lock.inl
+    \brief Adaptive spin-then-park lock synchronization primitive inline implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+inline bool AdaptiveLock::IsLocked() const noexcept
+{
+    return (_state.load(std::memory_order_acquire) != UNLOCKED);
+}
+
+inline bool AdaptiveLock::TryLock() noexcept
+{
+    uint32_t expected = UNLOCKED;
+    return _state.compare_exchange_strong(expected, LOCKED, std::memory_order_acquire, std::memory_order_relaxed);
+}
+
+inline bool AdaptiveLock::TryLockSpin(int64_t spin) noexcept
+{
+    // Try to acquire adaptive lock at least one time
+    if (TryLock())
+        return true;
+
+    return (spin > 0) && Spin((uint64_t)spin);
+}
+
+inline void AdaptiveLock::Lock() noexcept
+{
+    if (!TryLock())
+        LockSlow();
+}
+
+inline void AdaptiveLock::Unlock() noexcept
+{
+    // Wake one parked thread only if there is any
+    if (_state.exchange(UNLOCKED, std::memory_order_release) == CONTENDED)
+        WaitStrategy::WakeOne(_state);
+}
+
+inline bool AdaptiveLock::Spin(uint64_t spins) noexcept
+{
+    uint32_t backoff = 1;
+    for (uint64_t spin = 0; spin < spins; spin += backoff)
+    {
+        for (uint32_t i = 0; i < backoff; ++i)
+            WaitStrategy::Relax();
+
+        // Test the lock state before the atomic exchange to keep the cache line shared
+        if ((_state.load(std::memory_order_relaxed) == UNLOCKED) && TryLock())
+            return true;
+
+        if (backoff < MAX_BACKOFF)
+            backoff <<= 1;
+    }
+    return false;
+}
+
+} // namespace CppCommon
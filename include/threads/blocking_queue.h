@@ -0,0 +1,132 @@
+/*!
+    \file blocking_queue.h
+    \brief Blocking wrapper of lock-free queues definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_BLOCKING_QUEUE_H
+#define CPPCOMMON_THREADS_BLOCKING_QUEUE_H
+
+#include "threads/wait_strategy.h"
+
+#include <atomic>
+#include <utility>
+
+namespace CppCommon {
+
+//! Blocking wrapper of lock-free queues
+/*!
+    Blocking queue wraps one of lock-free ring queues (MPMCRingQueue, MPSCRingQueue
+    or SPSCRingQueue) and provides blocking enqueue and dequeue operations. Full and
+    empty queue states are waited with wait strategies, so blocked producers  and
+    consumers spin, then yield and finally park without burning CPU. Non blocking
+    operations of the wrapped queue are called directly, so wake-up system calls
+    are made only when there are parked threads.
+
+    Producers and consumers restrictions of the wrapped queue are kept (e.g. only
+    one consumer thread for MPSCRingQueue and SPSCRingQueue).
+
+    Thread-safe.
+*/
+template <class TQueue>
+class BlockingQueue
+{
+public:
+    //! Initialize blocking queue with arguments of the wrapped queue
+    /*!
+        \param args - Arguments to construct the wrapped queue with
+    */
+    template <typename... Args>
+    explicit BlockingQueue(Args&&... args);
+    BlockingQueue(const BlockingQueue&) = delete;
+    BlockingQueue(BlockingQueue&&) = delete;
+    ~BlockingQueue() = default;
+
+    BlockingQueue& operator=(const BlockingQueue&) = delete;
+    BlockingQueue& operator=(BlockingQueue&&) = delete;
+
+    //! Check if the queue is not empty
+    explicit operator bool() const noexcept { return !closed() && !empty(); }
+
+    //! Is blocking queue closed?
+    bool closed() const noexcept { return _closed.load(std::memory_order_acquire); }
+
+    //! Is blocking queue empty?
+    bool empty() const noexcept { return _queue.empty(); }
+    //! Get blocking queue capacity
+    size_t capacity() const noexcept { return _queue.capacity(); }
+    //! Get blocking queue size
+    size_t size() const noexcept { return _queue.size(); }
+
+    //! Get the wrapped queue
+    TQueue& queue() noexcept { return _queue; }
+
+    //! Enqueue an item into the blocking queue (producers threads method)
+    /*!
+        The item will be copied or moved into the blocking queue. Wrapped queues
+        move the item only on success, so it is safe to retry the enqueue  with
+        the same rvalue item.
+
+        Will block while the queue is full.
+
+        \param item - Item to enqueue
+        \return 'true' if the item was successfully enqueue, 'false' if the blocking queue is closed
+    */
+    template <typename TItem>
+    bool Enqueue(TItem&& item);
+    //! Try to enqueue an item into the blocking queue (producers threads method)
+    /*!
+        Will not block.
+
+        \param item - Item to enqueue
+        \return 'true' if the item was successfully enqueue, 'false' if the blocking queue is full or closed
+    */
+    template <typename TItem>
+    bool TryEnqueue(TItem&& item);
+
+    //! Dequeue an item from the blocking queue (consumers threads method)
+    /*!
+        The item will be moved from the blocking queue.
+
+        Will block while the queue is empty.
+
+        \param item - Item to dequeue
+        \return 'true' if the item was successfully dequeue, 'false' if the blocking queue is closed and empty
+    */
+    template <typename TItem>
+    bool Dequeue(TItem& item);
+    //! Try to dequeue an item from the blocking queue (consumers threads method)
+    /*!
+        Will not block.
+
+        \param item - Item to dequeue
+        \return 'true' if the item was successfully dequeue, 'false' if the blocking queue is empty
+    */
+    template <typename TItem>
+    bool TryDequeue(TItem& item);
+
+    //! Close the blocking queue
+    /*!
+        Wake up all blocked producers and consumers. Producers fail to enqueue
+        new items, consumers dequeue remaining items and fail after that.
+
+        Will not block.
+    */
+    void Close();
+
+private:
+    TQueue _queue;
+    std::atomic<bool> _closed;
+    WaitStrategy _not_empty;
+    WaitStrategy _not_full;
+};
+
+/*! \example threads_blocking_queue.cpp Blocking wrapper of lock-free queues example */
+
+} // namespace CppCommon
+
+#include "blocking_queue.inl"
+
+#endif // CPPCOMMON_THREADS_BLOCKING_QUEUE_H
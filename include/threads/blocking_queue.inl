@@ -0,0 +1,90 @@
+/*!
+    \file blocking_queue.inl
+    \brief Blocking wrapper of lock-free queues inline implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+template <class TQueue>
+template <typename... Args>
+inline BlockingQueue<TQueue>::BlockingQueue(Args&&... args) : _queue(std::forward<Args>(args)...), _closed(false)
+{
+}
+
+template <class TQueue>
+template <typename TItem>
+inline bool BlockingQueue<TQueue>::Enqueue(TItem&& item)
+{
+    bool result = false;
+
+    // Wait until the item is enqueued or the queue is closed
+    _not_full.Wait([this, &item, &result]()
+    {
+        if (closed())
+            return true;
+        result = _queue.Enqueue(std::forward<TItem>(item));
+        return result;
+    });
+
+    if (result)
+        _not_empty.Notify();
+
+    return result;
+}
+
+template <class TQueue>
+template <typename TItem>
+inline bool BlockingQueue<TQueue>::TryEnqueue(TItem&& item)
+{
+    if (closed() || !_queue.Enqueue(std::forward<TItem>(item)))
+        return false;
+
+    _not_empty.Notify();
+
+    return true;
+}
+
+template <class TQueue>
+template <typename TItem>
+inline bool BlockingQueue<TQueue>::Dequeue(TItem& item)
+{
+    bool result = false;
+
+    // Wait until the item is dequeued or the queue is closed
+    _not_empty.Wait([this, &item, &result]()
+    {
+        result = _queue.Dequeue(item);
+        return result || closed();
+    });
+
+    if (result)
+        _not_full.Notify();
+
+    return result;
+}
+
+template <class TQueue>
+template <typename TItem>
+inline bool BlockingQueue<TQueue>::TryDequeue(TItem& item)
+{
+    if (!_queue.Dequeue(item))
+        return false;
+
+    _not_full.Notify();
+
+    return true;
+}
+
+template <class TQueue>
+inline void BlockingQueue<TQueue>::Close()
+{
+    _closed.store(true, std::memory_order_release);
+
+    _not_empty.Notify();
+    _not_full.Notify();
+}
+
+} // namespace CppCommon
@@ -0,0 +1,177 @@
+/*!
+    \file copy_on_write.h
+    \brief Copy-on-write published snapshot synchronization primitive definition
+    \author Ivan Shynkarenka
+    \date 15.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_COPY_ON_WRITE_H
+#define CPPCOMMON_THREADS_COPY_ON_WRITE_H
+
+#include "threads/adaptive_lock.h"
+#include "threads/epoch_reclamation.h"
+#include "threads/locker.h"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <utility>
+
+namespace CppCommon {
+
+//! Copy-on-write published snapshot synchronization primitive
+/*!
+    Copy-on-write keeps the latest published immutable snapshot of the data
+    (e.g. the routing table of FlatMap or HashMap) behind the atomic pointer.
+    Readers enter the epoch critical section and load the pointer, so reading
+    never blocks, never retries and never writes shared cache lines except
+    the own epoch reader slot. Writers build a new instance of the data and
+    publish it with a single atomic exchange. The previous instance is
+    retired into the epoch reclamation domain and deleted once all its
+    readers have left.
+
+    In contrast to LeftRight writers never wait for readers and readers could
+    keep the snapshot for a while (see Reader), but each write allocates and
+    copies the whole data instance, so it fits read-mostly data updated
+    rarely.
+
+    Writers are serialized with the adaptive lock.
+
+    Thread-safe.
+*/
+template <typename T>
+class CopyOnWrite
+{
+    // Published data instance with its version
+    struct Instance
+    {
+        T data;
+        uint64_t version;
+
+        template <class... Args>
+        explicit Instance(uint64_t v, Args&&... args) : data(std::forward<Args>(args)...), version(v) {}
+    };
+
+public:
+    //! Snapshot reader
+    /*!
+        Reader keeps the published snapshot alive inside the epoch critical
+        section until it is destroyed. Keep readers short-lived, because they
+        delay the reclamation of all retired snapshots.
+
+        Not thread-safe.
+    */
+    class Reader
+    {
+    public:
+        explicit Reader(const CopyOnWrite& cow) noexcept : _domain(cow._reclamation), _token(cow._reclamation.Enter()), _instance(cow._instance.load(std::memory_order_acquire)) {}
+        Reader(const Reader&) = delete;
+        Reader(Reader&&) = delete;
+        ~Reader() { _domain.Leave(_token); }
+
+        Reader& operator=(const Reader&) = delete;
+        Reader& operator=(Reader&&) = delete;
+
+        const T& operator*() const noexcept { return _instance->data; }
+        const T* operator->() const noexcept { return &_instance->data; }
+
+        //! Get the snapshot data
+        const T& data() const noexcept { return _instance->data; }
+        //! Get the snapshot version
+        uint64_t version() const noexcept { return _instance->version; }
+
+    private:
+        EpochReclamation& _domain;
+        EpochReclamation::Token _token;
+        const Instance* _instance;
+    };
+
+    //! Initialize copy-on-write with the data constructed from the given arguments
+    /*!
+        \param args - Arguments to construct the initial data
+    */
+    template <class... Args>
+    explicit CopyOnWrite(Args&&... args);
+    CopyOnWrite(const CopyOnWrite&) = delete;
+    CopyOnWrite(CopyOnWrite&&) = delete;
+    ~CopyOnWrite();
+
+    CopyOnWrite& operator=(const T& data);
+    CopyOnWrite& operator=(T&& data);
+    CopyOnWrite& operator=(const CopyOnWrite&) = delete;
+    CopyOnWrite& operator=(CopyOnWrite&&) = delete;
+
+    //! Get the latest published version (zero for the initial data)
+    uint64_t version() const noexcept { return _instance.load(std::memory_order_acquire)->version; }
+
+    //! Read data
+    /*!
+        Will not block.
+
+        \return Copy of the latest published data
+    */
+    T Read() const;
+
+    //! Visit the latest published data in place
+    /*!
+        Visitor is called as visitor(const T& data) inside the epoch critical section.
+
+        Will not block.
+
+        \param visitor - Visitor function
+        \return Visitor result
+    */
+    template <class TVisitor>
+    decltype(auto) Visit(TVisitor&& visitor) const;
+
+    //! Publish new data
+    /*!
+        Will not block readers.
+
+        \param data - Data to publish
+        \return Version of the published data
+    */
+    uint64_t Write(const T& data);
+    //! Publish new data
+    /*!
+        Will not block readers.
+
+        \param data - Data to publish
+        \return Version of the published data
+    */
+    uint64_t Write(T&& data);
+
+    //! Modify the copy of the latest published data and publish it
+    /*!
+        Modifier is called as modifier(T& data) for the copy of the latest
+        published data under the writers lock.
+
+        Will not block readers.
+
+        \param modifier - Modifier function
+        \return Version of the published data
+    */
+    template <class TModifier>
+    uint64_t Modify(TModifier&& modifier);
+
+private:
+    typedef char cache_line_pad[128];
+
+    cache_line_pad _pad0;
+    std::atomic<Instance*> _instance;
+    cache_line_pad _pad1;
+    mutable EpochReclamation _reclamation;
+    AdaptiveLock _writers;
+
+    //! Publish the new data instance and retire the previous one (under the writers lock)
+    uint64_t Publish(std::unique_ptr<Instance> instance);
+};
+
+/*! \example threads_copy_on_write.cpp Copy-on-write published snapshot synchronization primitive example */
+
+} // namespace CppCommon
+
+#include "copy_on_write.inl"
+
+#endif // CPPCOMMON_THREADS_COPY_ON_WRITE_H
@@ -0,0 +1,94 @@
+/*!
+    \file copy_on_write.inl
+    \brief Copy-on-write published snapshot synchronization primitive inline implementation
+    \author Ivan Shynkarenka
+    \date 15.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+template <typename T>
+template <class... Args>
+inline CopyOnWrite<T>::CopyOnWrite(Args&&... args) : _pad0(), _instance(new Instance(0, std::forward<Args>(args)...)), _pad1(), _reclamation(0, 1)
+{
+}
+
+template <typename T>
+inline CopyOnWrite<T>::~CopyOnWrite()
+{
+    delete _instance.load(std::memory_order_relaxed);
+
+    // Delete all retired data instances
+    _reclamation.Synchronize();
+}
+
+template <typename T>
+inline CopyOnWrite<T>& CopyOnWrite<T>::operator=(const T& data)
+{
+    Write(data);
+    return *this;
+}
+
+template <typename T>
+inline CopyOnWrite<T>& CopyOnWrite<T>::operator=(T&& data)
+{
+    Write(std::move(data));
+    return *this;
+}
+
+template <typename T>
+inline T CopyOnWrite<T>::Read() const
+{
+    return Visit([](const T& data) { return data; });
+}
+
+template <typename T>
+template <class TVisitor>
+inline decltype(auto) CopyOnWrite<T>::Visit(TVisitor&& visitor) const
+{
+    EpochReclamation::Guard guard(_reclamation);
+    return visitor((const T&)_instance.load(std::memory_order_acquire)->data);
+}
+
+template <typename T>
+inline uint64_t CopyOnWrite<T>::Write(const T& data)
+{
+    Locker<AdaptiveLock> locker(_writers);
+    return Publish(std::make_unique<Instance>(_instance.load(std::memory_order_relaxed)->version + 1, data));
+}
+
+template <typename T>
+inline uint64_t CopyOnWrite<T>::Write(T&& data)
+{
+    Locker<AdaptiveLock> locker(_writers);
+    return Publish(std::make_unique<Instance>(_instance.load(std::memory_order_relaxed)->version + 1, std::move(data)));
+}
+
+template <typename T>
+template <class TModifier>
+inline uint64_t CopyOnWrite<T>::Modify(TModifier&& modifier)
+{
+    Locker<AdaptiveLock> locker(_writers);
+
+    // Copy the latest published data, which is not changed by other writers under the lock
+    const Instance* current = _instance.load(std::memory_order_relaxed);
+    auto instance = std::make_unique<Instance>(current->version + 1, current->data);
+    modifier(instance->data);
+
+    return Publish(std::move(instance));
+}
+
+template <typename T>
+inline uint64_t CopyOnWrite<T>::Publish(std::unique_ptr<Instance> instance)
+{
+    const uint64_t version = instance->version;
+
+    // Switch readers to the new data instance and retire the previous one
+    Instance* previous = _instance.exchange(instance.release(), std::memory_order_acq_rel);
+    _reclamation.Retire(previous);
+
+    return version;
+}
+
+} // namespace CppCommon
@@ -0,0 +1,262 @@
+/*!
+    \file coroutine.h
+    \brief Coroutine task and awaitable wrappers definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_COROUTINE_H
+#define CPPCOMMON_THREADS_COROUTINE_H
+
+#include <exception>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+#if defined(__cpp_impl_coroutine) && (__cpp_impl_coroutine >= 201902L) && __has_include(<coroutine>)
+#include <coroutine>
+//! Coroutines are supported by the compiler
+#define CPPCOMMON_COROUTINES 1
+#endif
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+namespace Internals {
+
+//! Asynchronous waiter
+/*!
+    Asynchronous waiter is registered in the wait container by the suspended
+    coroutine. Producer hands the dequeued data over to the waiter under the
+    container lock and resumes it after the lock is released.
+*/
+struct AsyncWaiter
+{
+    AsyncWaiter* next;
+    void* data;
+    bool result;
+    void (*resume)(AsyncWaiter* waiter);
+
+    AsyncWaiter(void* d, void (*r)(AsyncWaiter*)) noexcept : next(nullptr), data(d), result(false), resume(r) {}
+};
+
+//! Asynchronous waiters FIFO list
+class AsyncWaiters
+{
+public:
+    AsyncWaiters() noexcept : _head(nullptr), _tail(nullptr) {}
+
+    //! Is the list empty?
+    bool empty() const noexcept { return (_head == nullptr); }
+    //! Get the first waiter of the list
+    AsyncWaiter* front() const noexcept { return _head; }
+
+    //! Push the waiter to the end of the list
+    void Push(AsyncWaiter* waiter) noexcept;
+    //! Pop the waiter from the beginning of the list
+    AsyncWaiter* Pop() noexcept;
+
+private:
+    AsyncWaiter* _head;
+    AsyncWaiter* _tail;
+};
+
+//! Asynchronous waiters resumer
+/*!
+    Resumer collects waiters released under the container lock and resumes them
+    in its destructor. It should be declared before the container locker, so
+    waiters are resumed after the lock is released.
+*/
+class AsyncResumer
+{
+public:
+    AsyncResumer() noexcept : _waiters() {}
+    AsyncResumer(const AsyncResumer&) = delete;
+    AsyncResumer(AsyncResumer&&) = delete;
+    ~AsyncResumer();
+
+    AsyncResumer& operator=(const AsyncResumer&) = delete;
+    AsyncResumer& operator=(AsyncResumer&&) = delete;
+
+    //! Add the waiter with the given result to resume
+    void Add(AsyncWaiter* waiter, bool result) noexcept;
+
+private:
+    AsyncWaiters _waiters;
+};
+
+} // namespace Internals
+//! @endcond
+
+#if defined(CPPCOMMON_COROUTINES)
+
+//! Inline coroutines scheduler
+/*!
+    Resumes coroutines immediately in the notifying thread (after the wait
+    container lock is released).
+
+    Thread-safe.
+*/
+struct InlineScheduler
+{
+    //! Execute the given function immediately
+    template <class TFunction>
+    void Submit(TFunction&& fn) { fn(); }
+};
+
+//! Coroutine task
+/*!
+    Coroutine task is a lazy coroutine which starts when it is awaited with
+    co_await from another coroutine or spawned in the scheduler. Awaiting
+    coroutine resumes when the task is completed and receives its result or
+    rethrows its exception.
+
+    Coroutine scheduler is any object with Submit(fn) method (e.g. ThreadPool).
+
+    Not thread-safe.
+*/
+template <typename T = void>
+class CoroutineTask
+{
+public:
+    class promise_type;
+    typedef std::coroutine_handle<promise_type> handle_type;
+
+    CoroutineTask() noexcept : _handle(nullptr) {}
+    CoroutineTask(const CoroutineTask&) = delete;
+    CoroutineTask(CoroutineTask&& task) noexcept : _handle(std::exchange(task._handle, nullptr)) {}
+    ~CoroutineTask() { if (_handle) _handle.destroy(); }
+
+    CoroutineTask& operator=(const CoroutineTask&) = delete;
+    CoroutineTask& operator=(CoroutineTask&& task) noexcept
+    { if (this != &task) { if (_handle) _handle.destroy(); _handle = std::exchange(task._handle, nullptr); } return *this; }
+
+    //! Check if the coroutine task is valid
+    explicit operator bool() const noexcept { return (bool)_handle; }
+
+    //! Is the coroutine task completed?
+    bool done() const noexcept { return !_handle || _handle.done(); }
+
+    //! Spawn the detached coroutine task in the given scheduler
+    /*!
+        Coroutine task frame is destroyed when the coroutine is completed.
+        Unhandled exception of the detached coroutine task terminates the process.
+
+        \param scheduler - Coroutine scheduler
+    */
+    template <class TScheduler>
+    void Spawn(TScheduler& scheduler);
+
+    // Awaitable interface
+    bool await_ready() const noexcept { return done(); }
+    std::coroutine_handle<> await_suspend(std::coroutine_handle<> continuation) noexcept;
+    T await_resume();
+
+private:
+    handle_type _handle;
+
+    explicit CoroutineTask(handle_type handle) noexcept : _handle(handle) {}
+};
+
+//! @cond INTERNALS
+namespace Internals {
+
+//! Coroutine task promise base
+class CoroutinePromiseBase
+{
+public:
+    CoroutinePromiseBase() noexcept : _continuation(nullptr), _detached(false) {}
+
+    std::suspend_always initial_suspend() const noexcept { return {}; }
+
+    struct FinalAwaiter
+    {
+        bool await_ready() const noexcept { return false; }
+        template <class TPromise>
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<TPromise> handle) noexcept;
+        void await_resume() const noexcept {}
+    };
+    FinalAwaiter final_suspend() const noexcept { return {}; }
+
+    void unhandled_exception() noexcept;
+
+    void continuation(std::coroutine_handle<> continuation) noexcept { _continuation = continuation; }
+    void detach() noexcept { _detached = true; }
+    void rethrow() const { if (_exception) std::rethrow_exception(_exception); }
+
+private:
+    std::coroutine_handle<> _continuation;
+    bool _detached;
+    std::exception_ptr _exception;
+};
+
+//! Coroutine task promise
+template <typename T>
+class CoroutinePromise : public CoroutinePromiseBase
+{
+public:
+    template <typename U>
+    void return_value(U&& value) { _value.emplace(std::forward<U>(value)); }
+    T result() { rethrow(); return std::move(*_value); }
+
+private:
+    std::optional<T> _value;
+};
+
+//! Coroutine task promise without result
+template <>
+class CoroutinePromise<void> : public CoroutinePromiseBase
+{
+public:
+    void return_void() const noexcept {}
+    void result() const { rethrow(); }
+};
+
+} // namespace Internals
+//! @endcond
+
+//! Coroutine task promise type
+template <typename T>
+class CoroutineTask<T>::promise_type : public Internals::CoroutinePromise<T>
+{
+public:
+    CoroutineTask<T> get_return_object() noexcept { return CoroutineTask<T>(handle_type::from_promise(*this)); }
+};
+
+//! Asynchronous dequeue awaiter
+/*!
+    Awaiter is returned by DequeueAsync() methods of wait containers. If the
+    container has data the awaiting coroutine continues immediately, otherwise
+    it is suspended and resumed in the given scheduler when the data arrives or
+    the container is closed. Result of co_await is 'true' if the data was
+    dequeued, 'false' if the container is closed.
+*/
+template <class TContainer, typename TData, class TScheduler>
+class AsyncDequeueAwaiter : private Internals::AsyncWaiter
+{
+public:
+    AsyncDequeueAwaiter(TContainer& container, TData& value, TScheduler& scheduler) noexcept
+        : Internals::AsyncWaiter(&value, Resume), _container(container), _scheduler(scheduler), _handle(nullptr)
+    {}
+
+    // Awaitable interface
+    bool await_ready() const noexcept { return false; }
+    bool await_suspend(std::coroutine_handle<> handle);
+    bool await_resume() const noexcept { return result; }
+
+private:
+    TContainer& _container;
+    TScheduler& _scheduler;
+    std::coroutine_handle<> _handle;
+
+    static void Resume(Internals::AsyncWaiter* waiter);
+};
+
+#endif
+
+} // namespace CppCommon
+
+#include "coroutine.inl"
+
+#endif // CPPCOMMON_THREADS_COROUTINE_H
@@ -0,0 +1,132 @@
+/*!
+    \file coroutine.inl
+    \brief Coroutine task and awaitable wrappers inline implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+namespace Internals {
+
+inline void AsyncWaiters::Push(AsyncWaiter* waiter) noexcept
+{
+    waiter->next = nullptr;
+    if (_tail != nullptr)
+        _tail->next = waiter;
+    else
+        _head = waiter;
+    _tail = waiter;
+}
+
+inline AsyncWaiter* AsyncWaiters::Pop() noexcept
+{
+    AsyncWaiter* waiter = _head;
+    if (waiter != nullptr)
+    {
+        _head = waiter->next;
+        if (_head == nullptr)
+            _tail = nullptr;
+    }
+    return waiter;
+}
+
+inline AsyncResumer::~AsyncResumer()
+{
+    // Waiter could be destroyed right after the resume
+    AsyncWaiter* waiter;
+    while ((waiter = _waiters.Pop()) != nullptr)
+        waiter->resume(waiter);
+}
+
+inline void AsyncResumer::Add(AsyncWaiter* waiter, bool result) noexcept
+{
+    waiter->result = result;
+    _waiters.Push(waiter);
+}
+
+} // namespace Internals
+//! @endcond
+
+#if defined(CPPCOMMON_COROUTINES)
+
+//! @cond INTERNALS
+namespace Internals {
+
+template <class TPromise>
+inline std::coroutine_handle<> CoroutinePromiseBase::FinalAwaiter::await_suspend(std::coroutine_handle<TPromise> handle) noexcept
+{
+    CoroutinePromiseBase& promise = handle.promise();
+
+    // Transfer the control to the awaiting coroutine
+    if (promise._continuation)
+        return promise._continuation;
+
+    // Detached coroutine task destroys its own frame
+    if (promise._detached)
+        handle.destroy();
+
+    return std::noop_coroutine();
+}
+
+inline void CoroutinePromiseBase::unhandled_exception() noexcept
+{
+    if (_detached)
+        std::terminate();
+
+    _exception = std::current_exception();
+}
+
+} // namespace Internals
+//! @endcond
+
+template <typename T>
+template <class TScheduler>
+inline void CoroutineTask<T>::Spawn(TScheduler& scheduler)
+{
+    handle_type handle = std::exchange(_handle, nullptr);
+    if (!handle)
+        return;
+
+    handle.promise().detach();
+    scheduler.Submit([handle]() { handle.resume(); });
+}
+
+template <typename T>
+inline std::coroutine_handle<> CoroutineTask<T>::await_suspend(std::coroutine_handle<> continuation) noexcept
+{
+    // Start the lazy coroutine task and resume the awaiting coroutine on completion
+    _handle.promise().continuation(continuation);
+    return _handle;
+}
+
+template <typename T>
+inline T CoroutineTask<T>::await_resume()
+{
+    return _handle.promise().result();
+}
+
+template <class TContainer, typename TData, class TScheduler>
+inline bool AsyncDequeueAwaiter<TContainer, TData, TScheduler>::await_suspend(std::coroutine_handle<> handle)
+{
+    _handle = handle;
+
+    // Awaiter must not be touched after it is registered in the container,
+    // because it could be resumed in another thread before this method returns
+    return _container.SuspendAsync(*this);
+}
+
+template <class TContainer, typename TData, class TScheduler>
+inline void AsyncDequeueAwaiter<TContainer, TData, TScheduler>::Resume(Internals::AsyncWaiter* waiter)
+{
+    AsyncDequeueAwaiter* awaiter = static_cast<AsyncDequeueAwaiter*>(waiter);
+    TScheduler& scheduler = awaiter->_scheduler;
+    std::coroutine_handle<> handle = awaiter->_handle;
+    scheduler.Submit([handle]() { handle.resume(); });
+}
+
+#endif
+
+} // namespace CppCommon
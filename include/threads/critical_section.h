@@ -9,6 +9,7 @@
 #ifndef CPPCOMMON_THREADS_CRITICAL_SECTION_H
 #define CPPCOMMON_THREADS_CRITICAL_SECTION_H
 
+#include "threads/instrumentation.h"
 #include "threads/locker.h"
 #include "time/timestamp.h"
 
@@ -22,6 +23,9 @@ namespace CppCommon {
     access the code inside the critical section. Other threads must wait for the lock! Critical sections are usually
     more lightweight than mutexes and don't enter kernel mode.
 
+    With CPPCOMMON_INSTRUMENTATION definition the critical section counts
+    contended acquisitions and retry iterations (see InstrumentationRegistry).
+
     Thread-safe.
 
     https://en.wikipedia.org/wiki/Critical_section
@@ -87,6 +91,10 @@ private:
     static const size_t StorageAlign = 8;
     alignas(StorageAlign) std::byte _storage[StorageSize];
 
+#if defined(CPPCOMMON_INSTRUMENTATION)
+    InstrumentationCounters _instrumentation{"CriticalSection"};
+#endif
+
     //! Get the native critical section handler
     void* native() noexcept;
 };
@@ -0,0 +1,259 @@
+/*!
+    \file disruptor.h
+    \brief Disruptor multicast ring definition
+    \author Ivan Shynkarenka
+    \date 15.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_DISRUPTOR_H
+#define CPPCOMMON_THREADS_DISRUPTOR_H
+
+#include "wait_strategy.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <limits>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace CppCommon {
+
+//! Disruptor producers sequencer
+enum class DisruptorProducer
+{
+    SINGLE,     //!< Single producer thread, claimed sequences are published in order with a single store
+    MULTI       //!< Multiple producers threads, each slot is published separately
+};
+
+//! Disruptor multicast ring
+/*!
+    Disruptor is a bounded ring of preallocated slots where each published item
+    is seen by every consumer, unlike ring queues which hand each item to
+    exactly one consumer. Each consumer has its own sequence cursor, so a single
+    shared slot replaces copies of the item in several queues.
+
+    Consumers could depend on other consumers: the dependent consumer sees the
+    item only after all its dependencies have released it, e.g. business logic
+    is gated on the journaler. Producers reuse a slot only after all consumers
+    have released it.
+
+    Producers claim a contiguous batch of sequences, fill slots in place and
+    publish them. Consumers wait for the batch of available sequences, process
+    slots in place and release the whole batch with a single store. Producers
+    and consumers spin, yield and finally park using wait strategies.
+
+    All consumers must be added before the first item is claimed.
+
+    FIFO order is guaranteed!
+
+    Thread-safe.
+
+    https://lmax-exchange.github.io/disruptor/disruptor.html
+*/
+template <typename T, DisruptorProducer producer = DisruptorProducer::MULTI>
+class Disruptor
+{
+public:
+    //! Disruptor consumer sequence cursor
+    class Consumer
+    {
+        friend class Disruptor;
+
+    public:
+        Consumer(const Consumer&) = delete;
+        Consumer(Consumer&&) = delete;
+        ~Consumer() = default;
+
+        Consumer& operator=(const Consumer&) = delete;
+        Consumer& operator=(Consumer&&) = delete;
+
+        //! Get the next sequence to consume
+        uint64_t sequence() const noexcept { return _cursor.load(std::memory_order_acquire); }
+
+    private:
+        alignas(128) std::atomic<uint64_t> _cursor;
+        std::vector<const Consumer*> _dependencies;
+
+        explicit Consumer(std::initializer_list<const Consumer*> dependencies) : _cursor(0), _dependencies(dependencies) {}
+    };
+
+    //! Default class constructor
+    /*!
+        \param capacity - Disruptor capacity (must be a power of two)
+    */
+    explicit Disruptor(size_t capacity);
+    Disruptor(const Disruptor&) = delete;
+    Disruptor(Disruptor&&) = delete;
+    ~Disruptor();
+
+    Disruptor& operator=(const Disruptor&) = delete;
+    Disruptor& operator=(Disruptor&&) = delete;
+
+    //! Access to the slot of the given sequence
+    T& operator[](uint64_t sequence) noexcept { return _buffer[sequence & _mask]; }
+    const T& operator[](uint64_t sequence) const noexcept { return _buffer[sequence & _mask]; }
+
+    //! Is disruptor closed?
+    bool closed() const noexcept { return _closed.load(std::memory_order_acquire); }
+
+    //! Get disruptor capacity
+    size_t capacity() const noexcept { return _capacity; }
+    //! Get count of consumers
+    size_t consumers() const noexcept { return _consumers.size(); }
+    //! Get count of claimed items which are not released by all consumers
+    size_t size() const noexcept;
+
+    //! Add a new consumer
+    /*!
+        The consumer starts from the first sequence. Not thread-safe, so all
+        consumers must be added before producing.
+
+        \param dependencies - Consumers which must release items before the new consumer (default is {})
+        \return Consumer sequence cursor
+    */
+    Consumer& AddConsumer(std::initializer_list<const Consumer*> dependencies = {});
+
+    //! Claim the given count of sequences (producers threads method)
+    /*!
+        Waits until all consumers release slots of claimed sequences. Claimed
+        slots must be filled with operator[] and published with Publish().
+
+        Will block.
+
+        \param sequence - The first claimed sequence
+        \param count - Count of sequences to claim (default is 1)
+        \return 'true' if sequences were successfully claimed, 'false' if the disruptor is closed
+    */
+    bool Claim(uint64_t& sequence, size_t count = 1);
+    //! Try to claim the given count of sequences (producers threads method)
+    /*!
+        Will not block.
+
+        \param sequence - The first claimed sequence
+        \param count - Count of sequences to claim (default is 1)
+        \return 'true' if sequences were successfully claimed, 'false' if the disruptor is full or closed
+    */
+    bool TryClaim(uint64_t& sequence, size_t count = 1);
+    //! Publish the given count of claimed sequences (producers threads method)
+    /*!
+        Will not block.
+
+        \param sequence - The first claimed sequence
+        \param count - Count of sequences to publish (default is 1)
+    */
+    void Publish(uint64_t sequence, size_t count = 1);
+
+    //! Enqueue an item into the disruptor (producers threads method)
+    /*!
+        Claim a single slot, copy the item into it and publish it.
+
+        Will block.
+
+        \param item - Item to enqueue
+        \return 'true' if the item was successfully enqueue, 'false' if the disruptor is closed
+    */
+    bool Enqueue(const T& item);
+    //! Enqueue an item into the disruptor (producers threads method)
+    /*!
+        Claim a single slot, move the item into it and publish it.
+
+        Will block.
+
+        \param item - Item to enqueue
+        \return 'true' if the item was successfully enqueue, 'false' if the disruptor is closed
+    */
+    bool Enqueue(T&& item);
+
+    //! Get count of items available for the given consumer starting from its sequence (consumer thread method)
+    /*!
+        Will not block.
+
+        \param consumer - Consumer
+        \return Count of available items
+    */
+    size_t Available(const Consumer& consumer) const noexcept;
+    //! Wait for items available for the given consumer starting from its sequence (consumer thread method)
+    /*!
+        Will block.
+
+        \param consumer - Consumer
+        \return Count of available items or 0 if the disruptor is closed and all items are consumed
+    */
+    size_t Wait(const Consumer& consumer);
+    //! Release the given count of consumed items (consumer thread method)
+    /*!
+        Will not block.
+
+        \param consumer - Consumer
+        \param count - Count of items to release
+    */
+    void Release(Consumer& consumer, size_t count);
+
+    //! Consume the batch of available items with the given handler (consumer thread method)
+    /*!
+        Handler is called as handler(T& item, uint64_t sequence, bool end_of_batch)
+        for each available item and then the whole batch is released.
+
+        Will block.
+
+        \param consumer - Consumer
+        \param handler - Items handler
+        \param max - Max count of items to consume (default is unlimited)
+        \return Count of consumed items or 0 if the disruptor is closed and all items are consumed
+    */
+    template <class THandler>
+    size_t Consume(Consumer& consumer, THandler&& handler, size_t max = std::numeric_limits<size_t>::max());
+
+    //! Close the disruptor
+    /*!
+        Producers must publish all claimed sequences before close. Consumers
+        consume all published items and then their waits return 0.
+
+        Will not block.
+    */
+    void Close();
+
+private:
+    typedef char cache_line_pad[128];
+
+    cache_line_pad _pad0;
+    const size_t _capacity;
+    const size_t _mask;
+    T* const _buffer;
+    // Published flags (sequence + 1) of multiple producers slots
+    std::atomic<uint64_t>* const _available;
+    std::vector<std::unique_ptr<Consumer>> _consumers;
+
+    cache_line_pad _pad1;
+    std::atomic<uint64_t> _claimed;
+    // Cached minimal sequence of all consumers
+    std::atomic<uint64_t> _gating;
+    cache_line_pad _pad2;
+    std::atomic<uint64_t> _published;
+    std::atomic<bool> _closed;
+    cache_line_pad _pad3;
+
+    WaitStrategy _producers_wait;
+    WaitStrategy _consumers_wait;
+
+    //! Get the minimal sequence of all consumers
+    uint64_t Minimum() const noexcept;
+    //! Check if all consumers released slots of sequences before the given end
+    bool Fits(uint64_t end) noexcept;
+    //! Get the end of contiguous published sequences starting from the given one
+    uint64_t Published(uint64_t sequence) const noexcept;
+};
+
+/*! \example threads_disruptor.cpp Disruptor multicast ring example */
+
+} // namespace CppCommon
+
+#include "disruptor.inl"
+
+#endif // CPPCOMMON_THREADS_DISRUPTOR_H
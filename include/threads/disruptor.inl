@@ -0,0 +1,274 @@
+/*!
+    \file disruptor.inl
+    \brief Disruptor multicast ring inline implementation
+    \author Ivan Shynkarenka
+    \date 15.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+template <typename T, DisruptorProducer producer>
+inline Disruptor<T, producer>::Disruptor(size_t capacity)
+    : _capacity(capacity), _mask(capacity - 1), _buffer(new T[capacity]),
+      _available((producer == DisruptorProducer::MULTI) ? new std::atomic<uint64_t>[capacity] : nullptr),
+      _claimed(0), _gating(0), _published(0), _closed(false)
+{
+    assert((capacity > 1) && "Disruptor capacity must be greater than one!");
+    assert(((capacity & (capacity - 1)) == 0) && "Disruptor capacity must be a power of two!");
+
+    memset(_pad0, 0, sizeof(cache_line_pad));
+    memset(_pad1, 0, sizeof(cache_line_pad));
+    memset(_pad2, 0, sizeof(cache_line_pad));
+    memset(_pad3, 0, sizeof(cache_line_pad));
+
+    if constexpr (producer == DisruptorProducer::MULTI)
+    {
+        for (size_t i = 0; i < capacity; ++i)
+            _available[i].store(0, std::memory_order_relaxed);
+    }
+}
+
+template <typename T, DisruptorProducer producer>
+inline Disruptor<T, producer>::~Disruptor()
+{
+    delete[] _buffer;
+    delete[] _available;
+}
+
+template <typename T, DisruptorProducer producer>
+inline size_t Disruptor<T, producer>::size() const noexcept
+{
+    if (_consumers.empty())
+        return 0;
+
+    const uint64_t minimum = Minimum();
+    const uint64_t claimed = _claimed.load(std::memory_order_acquire);
+
+    return (size_t)(claimed - minimum);
+}
+
+template <typename T, DisruptorProducer producer>
+inline typename Disruptor<T, producer>::Consumer& Disruptor<T, producer>::AddConsumer(std::initializer_list<const Consumer*> dependencies)
+{
+    assert((_claimed.load(std::memory_order_relaxed) == 0) && "All consumers must be added before producing!");
+#if !defined(NDEBUG)
+    for (auto dependency : dependencies)
+        assert((std::find_if(_consumers.begin(), _consumers.end(), [dependency](const auto& consumer) { return consumer.get() == dependency; }) != _consumers.end()) && "Dependency must be a consumer of the same disruptor!");
+#endif
+
+    _consumers.emplace_back(new Consumer(dependencies));
+    return *_consumers.back();
+}
+
+template <typename T, DisruptorProducer producer>
+inline uint64_t Disruptor<T, producer>::Minimum() const noexcept
+{
+    uint64_t minimum = std::numeric_limits<uint64_t>::max();
+    for (const auto& consumer : _consumers)
+        minimum = std::min(minimum, consumer->_cursor.load(std::memory_order_acquire));
+    return minimum;
+}
+
+template <typename T, DisruptorProducer producer>
+inline bool Disruptor<T, producer>::Fits(uint64_t end) noexcept
+{
+    if (_consumers.empty())
+        return true;
+
+    // Check the cached gating sequence first to avoid reading cursors of all consumers
+    if (end <= (_gating.load(std::memory_order_acquire) + _capacity))
+        return true;
+
+    const uint64_t gating = Minimum();
+    _gating.store(gating, std::memory_order_release);
+    return (end <= (gating + _capacity));
+}
+
+template <typename T, DisruptorProducer producer>
+inline bool Disruptor<T, producer>::Claim(uint64_t& sequence, size_t count)
+{
+    assert(((count > 0) && (count <= _capacity)) && "Claimed count must be in range (0, capacity]!");
+
+    if (closed())
+        return false;
+
+    uint64_t first;
+    if constexpr (producer == DisruptorProducer::SINGLE)
+        first = _claimed.load(std::memory_order_relaxed);
+    else
+        first = _claimed.fetch_add(count, std::memory_order_acq_rel);
+
+    const uint64_t end = first + count;
+    if (!Fits(end))
+    {
+        _producers_wait.Wait([this, end]() { return closed() || Fits(end); });
+        if (!Fits(end))
+            return false;
+    }
+
+    if constexpr (producer == DisruptorProducer::SINGLE)
+        _claimed.store(end, std::memory_order_release);
+
+    sequence = first;
+    return true;
+}
+
+template <typename T, DisruptorProducer producer>
+inline bool Disruptor<T, producer>::TryClaim(uint64_t& sequence, size_t count)
+{
+    assert(((count > 0) && (count <= _capacity)) && "Claimed count must be in range (0, capacity]!");
+
+    uint64_t first = _claimed.load(std::memory_order_relaxed);
+
+    if constexpr (producer == DisruptorProducer::SINGLE)
+    {
+        if (closed() || !Fits(first + count))
+            return false;
+
+        _claimed.store(first + count, std::memory_order_release);
+    }
+    else
+    {
+        do
+        {
+            if (closed() || !Fits(first + count))
+                return false;
+        } while (!_claimed.compare_exchange_weak(first, first + count, std::memory_order_acq_rel, std::memory_order_relaxed));
+    }
+
+    sequence = first;
+    return true;
+}
+
+template <typename T, DisruptorProducer producer>
+inline void Disruptor<T, producer>::Publish(uint64_t sequence, size_t count)
+{
+    if constexpr (producer == DisruptorProducer::SINGLE)
+        _published.store(sequence + count, std::memory_order_release);
+    else
+    {
+        // Each slot is published separately, because producers publish their claims out of order
+        for (uint64_t i = sequence; i < (sequence + count); ++i)
+            _available[i & _mask].store(i + 1, std::memory_order_release);
+    }
+
+    _consumers_wait.Notify();
+}
+
+template <typename T, DisruptorProducer producer>
+inline bool Disruptor<T, producer>::Enqueue(const T& item)
+{
+    T temp = item;
+    return Enqueue(std::move(temp));
+}
+
+template <typename T, DisruptorProducer producer>
+inline bool Disruptor<T, producer>::Enqueue(T&& item)
+{
+    uint64_t sequence;
+    if (!Claim(sequence))
+        return false;
+
+    _buffer[sequence & _mask] = std::move(item);
+    Publish(sequence);
+    return true;
+}
+
+template <typename T, DisruptorProducer producer>
+inline uint64_t Disruptor<T, producer>::Published(uint64_t sequence) const noexcept
+{
+    if constexpr (producer == DisruptorProducer::SINGLE)
+        return _published.load(std::memory_order_acquire);
+    else
+    {
+        // Scan contiguous published slots up to the claimed sequence
+        const uint64_t claimed = _claimed.load(std::memory_order_acquire);
+        while ((sequence < claimed) && (_available[sequence & _mask].load(std::memory_order_acquire) == (sequence + 1)))
+            ++sequence;
+        return sequence;
+    }
+}
+
+template <typename T, DisruptorProducer producer>
+inline size_t Disruptor<T, producer>::Available(const Consumer& consumer) const noexcept
+{
+    const uint64_t sequence = consumer._cursor.load(std::memory_order_relaxed);
+
+    // Dependent consumer is gated by its dependencies, which never pass published sequences
+    uint64_t end;
+    if (consumer._dependencies.empty())
+        end = Published(sequence);
+    else
+    {
+        end = std::numeric_limits<uint64_t>::max();
+        for (auto dependency : consumer._dependencies)
+            end = std::min(end, dependency->_cursor.load(std::memory_order_acquire));
+    }
+
+    return (size_t)(end - sequence);
+}
+
+template <typename T, DisruptorProducer producer>
+inline size_t Disruptor<T, producer>::Wait(const Consumer& consumer)
+{
+    size_t count = Available(consumer);
+    if (count > 0)
+        return count;
+
+    _consumers_wait.Wait([this, &consumer, &count]()
+    {
+        count = Available(consumer);
+        if (count > 0)
+            return true;
+
+        // Closed disruptor is finished when nothing is published after the consumer sequence
+        if (closed())
+        {
+            const uint64_t sequence = consumer._cursor.load(std::memory_order_relaxed);
+            return (Published(sequence) == sequence);
+        }
+
+        return false;
+    });
+
+    return count;
+}
+
+template <typename T, DisruptorProducer producer>
+inline void Disruptor<T, producer>::Release(Consumer& consumer, size_t count)
+{
+    const uint64_t sequence = consumer._cursor.load(std::memory_order_relaxed);
+    consumer._cursor.store(sequence + count, std::memory_order_release);
+
+    // Wake dependent consumers and producers waiting for free slots
+    _consumers_wait.Notify();
+    _producers_wait.Notify();
+}
+
+template <typename T, DisruptorProducer producer>
+template <class THandler>
+inline size_t Disruptor<T, producer>::Consume(Consumer& consumer, THandler&& handler, size_t max)
+{
+    size_t count = std::min(Wait(consumer), max);
+    if (count == 0)
+        return 0;
+
+    const uint64_t sequence = consumer._cursor.load(std::memory_order_relaxed);
+    for (size_t i = 0; i < count; ++i)
+        handler(_buffer[(sequence + i) & _mask], sequence + i, ((i + 1) == count));
+
+    Release(consumer, count);
+    return count;
+}
+
+template <typename T, DisruptorProducer producer>
+inline void Disruptor<T, producer>::Close()
+{
+    _closed.store(true, std::memory_order_release);
+
+    _consumers_wait.Notify();
+    _producers_wait.Notify();
+}
+
+} // namespace CppCommon
@@ -0,0 +1,169 @@
+/*!
+    \file distributed_rw_lock.h
+    \brief Distributed read/write lock synchronization primitive definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_DISTRIBUTED_RW_LOCK_H
+#define CPPCOMMON_THREADS_DISTRIBUTED_RW_LOCK_H
+
+#include "threads/adaptive_lock.h"
+#include "threads/locker.h"
+#include "threads/wait_strategy.h"
+#include "time/timestamp.h"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+namespace CppCommon {
+
+//! Distributed read/write lock synchronization primitive
+/*!
+    Distributed read/write lock is a reader-biased read/write lock for read
+    mostly data (e.g. configuration tables). Each thread is assigned to one of
+    reader slots, which are padded with cache line, so readers of different
+    slots never touch the same cache line and read lock scales with cores.
+    Read lock and unlock cost a single atomic increment and decrement of the
+    reader slot counter in the uncontended case.
+
+    Writer raises the writer flag and scans all reader slots waiting for
+    active readers to leave, so the write lock cost grows with slots count.
+    New readers which see the writer flag step back and wait for the writer.
+    Writers are serialized with the adaptive lock.
+
+    Not recursive: the reader must not acquire the read lock again while any
+    writer could be waiting, because the waiting writer blocks new readers.
+
+    Thread-safe.
+*/
+class DistributedRWLock
+{
+public:
+    //! Default class constructor
+    /*!
+        \param slots - Reader slots count (will be rounded up to the power of two, default is 0 - CPU::LogicalCores())
+    */
+    explicit DistributedRWLock(size_t slots = 0);
+    DistributedRWLock(const DistributedRWLock&) = delete;
+    DistributedRWLock(DistributedRWLock&&) = delete;
+    ~DistributedRWLock() = default;
+
+    DistributedRWLock& operator=(const DistributedRWLock&) = delete;
+    DistributedRWLock& operator=(DistributedRWLock&&) = delete;
+
+    //! Get reader slots count
+    size_t slots() const noexcept { return _slots_mask + 1; }
+
+    //! Try to acquire read lock without block
+    /*!
+        Will not block.
+
+        \return 'true' if the read lock was successfully acquired, 'false' if the read lock is busy
+    */
+    bool TryLockRead() noexcept;
+    //! Try to acquire write lock without block
+    /*!
+        Will not block.
+
+        \return 'true' if the write lock was successfully acquired, 'false' if the write lock is busy
+    */
+    bool TryLockWrite() noexcept;
+
+    //! Try to acquire read lock for the given timespan
+    /*!
+        Will block for the given timespan in the worst case.
+
+        \param timespan - Timespan to wait for the read lock
+        \return 'true' if the read lock was successfully acquired, 'false' if the read lock is busy
+    */
+    bool TryLockReadFor(const Timespan& timespan);
+    //! Try to acquire write lock for the given timespan
+    /*!
+        Will block for the given timespan in the worst case.
+
+        \param timespan - Timespan to wait for the write lock
+        \return 'true' if the write lock was successfully acquired, 'false' if the write lock is busy
+    */
+    bool TryLockWriteFor(const Timespan& timespan);
+    //! Try to acquire read lock until the given timestamp
+    /*!
+        Will block until the given timestamp in the worst case.
+
+        \param timestamp - Timestamp to stop wait for the read lock
+        \return 'true' if the read lock was successfully acquired, 'false' if the read lock is busy
+    */
+    bool TryLockReadUntil(const UtcTimestamp& timestamp)
+    { return TryLockReadFor(timestamp - UtcTimestamp()); }
+    //! Try to acquire write lock until the given timestamp
+    /*!
+        Will block until the given timestamp in the worst case.
+
+        \param timestamp - Timestamp to stop wait for the write lock
+        \return 'true' if the write lock was successfully acquired, 'false' if the write lock is busy
+    */
+    bool TryLockWriteUntil(const UtcTimestamp& timestamp)
+    { return TryLockWriteFor(timestamp - UtcTimestamp()); }
+
+    //! Acquire read lock with block
+    /*!
+        Will block.
+    */
+    void LockRead();
+    //! Acquire write lock with block
+    /*!
+        Will block.
+    */
+    void LockWrite();
+
+    //! Release read lock
+    /*!
+        Will not block.
+    */
+    void UnlockRead() noexcept;
+    //! Release write lock
+    /*!
+        Will not block.
+    */
+    void UnlockWrite() noexcept;
+
+private:
+    typedef char cache_line_pad[128];
+
+    // Reader slot is padded with cache line to avoid false sharing of neighbour slots
+    struct Slot
+    {
+        std::atomic<uint32_t> readers;
+        cache_line_pad pad;
+
+        Slot() : readers(0) {}
+    };
+
+    cache_line_pad _pad0;
+    std::atomic<bool> _writer;
+    cache_line_pad _pad1;
+    size_t _slots_mask;
+    std::unique_ptr<Slot[]> _slots;
+    AdaptiveLock _writers;
+    WaitStrategy _wait;
+
+    //! Get the reader slot of the current thread
+    Slot& CurrentSlot() const noexcept { return _slots[CurrentThreadSlot() & _slots_mask]; }
+    //! Get the sequential slot index of the current thread
+    static size_t CurrentThreadSlot() noexcept;
+
+    //! Are all reader slots empty?
+    bool Drained() const noexcept;
+    //! Release the writer flag and wake waiting readers
+    void ReleaseWriter() noexcept;
+};
+
+/*! \example threads_distributed_rw_lock.cpp Distributed read/write lock synchronization primitive example */
+
+} // namespace CppCommon
+
+#include "distributed_rw_lock.inl"
+
+#endif // CPPCOMMON_THREADS_DISTRIBUTED_RW_LOCK_H
@@ -0,0 +1,36 @@
+/*!
+    \file distributed_rw_lock.inl
+    \brief Distributed read/write lock synchronization primitive inline implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+inline bool DistributedRWLock::TryLockRead() noexcept
+{
+    Slot& slot = CurrentSlot();
+
+    // Register the reader before the writer flag check (pairs with the writer flag raise before the slots scan)
+    slot.readers.fetch_add(1, std::memory_order_seq_cst);
+    if (!_writer.load(std::memory_order_seq_cst))
+        return true;
+
+    // Step back for the writer
+    slot.readers.fetch_sub(1, std::memory_order_release);
+    return false;
+}
+
+inline void DistributedRWLock::LockRead()
+{
+    while (!TryLockRead())
+        _wait.Wait([this]() { return !_writer.load(std::memory_order_acquire); });
+}
+
+inline void DistributedRWLock::UnlockRead() noexcept
+{
+    CurrentSlot().readers.fetch_sub(1, std::memory_order_release);
+}
+
+} // namespace CppCommon
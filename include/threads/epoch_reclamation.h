@@ -0,0 +1,209 @@
+/*!
+    \file epoch_reclamation.h
+    \brief Epoch-based memory reclamation definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_EPOCH_RECLAMATION_H
+#define CPPCOMMON_THREADS_EPOCH_RECLAMATION_H
+
+#include "common/function.h"
+
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <memory>
+#include <utility>
+
+namespace CppCommon {
+
+//! Epoch-based memory reclamation
+/*!
+    Epoch-based reclamation (RCU-style) allows lock-free data structures to
+    free unlinked nodes without locks while concurrent readers might still
+    access them. Readers access shared nodes between Enter() and Leave() calls
+    (or inside the Guard scope). Writers unlink nodes from the data structure
+    and pass them to Retire() method instead of deleting them. Retired nodes
+    are deleted once all readers which could see them have left.
+
+    Reclamation domain keeps the global epoch and reader slots padded with
+    cache line. Each thread is assigned to one of reader slots, each slot
+    counts active readers of the current and the previous epochs, so entering
+    and leaving the critical section costs a few atomic operations on the own
+    slot. The global epoch is advanced when there are no readers left in the
+    previous epoch. Nodes retired in the epoch E are deleted when the global
+    epoch reaches E + 2.
+
+    Retired nodes are kept in the lock-free stack. Every threshold-th retire
+    tries to advance the epoch and deletes nodes, which are safe to delete.
+
+    Readers must not block for a long time inside the critical section,
+    because they delay reclamation of all retired nodes.
+
+    Thread-safe.
+*/
+class EpochReclamation
+{
+public:
+    //! Critical section token
+    typedef uint64_t Token;
+    //! Retired node deleter
+    typedef Function<void(), 64> Deleter;
+
+    //! Critical section guard
+    /*!
+        Enters the critical section of the reclamation domain in constructor
+        and leaves it in destructor.
+    */
+    class Guard
+    {
+    public:
+        explicit Guard(EpochReclamation& domain) : _domain(domain), _token(domain.Enter()) {}
+        Guard(const Guard&) = delete;
+        Guard(Guard&&) = delete;
+        ~Guard() { _domain.Leave(_token); }
+
+        Guard& operator=(const Guard&) = delete;
+        Guard& operator=(Guard&&) = delete;
+
+    private:
+        EpochReclamation& _domain;
+        Token _token;
+    };
+
+    //! Initialize the reclamation domain with a given reader slots count and reclaim threshold
+    /*!
+        \param slots - Reader slots count (will be rounded up to the power of two, default is 0 - CPU::LogicalCores())
+        \param threshold - Count of retired nodes between automatic reclaims (default is 64)
+    */
+    explicit EpochReclamation(size_t slots = 0, size_t threshold = 64);
+    EpochReclamation(const EpochReclamation&) = delete;
+    EpochReclamation(EpochReclamation&&) = delete;
+    ~EpochReclamation();
+
+    EpochReclamation& operator=(const EpochReclamation&) = delete;
+    EpochReclamation& operator=(EpochReclamation&&) = delete;
+
+    //! Get reader slots count
+    size_t slots() const noexcept { return _slots_mask + 1; }
+    //! Get the reclaim threshold
+    size_t threshold() const noexcept { return _threshold; }
+    //! Get the global epoch
+    uint64_t epoch() const noexcept { return _epoch.load(std::memory_order_acquire); }
+    //! Get total count of retired nodes
+    uint64_t retired() const noexcept { return _retired.load(std::memory_order_relaxed); }
+    //! Get total count of deleted nodes
+    uint64_t reclaimed() const noexcept { return _reclaimed.load(std::memory_order_relaxed); }
+    //! Get count of retired nodes waiting for deletion
+    uint64_t pending() const noexcept { return retired() - reclaimed(); }
+
+    //! Enter the critical section
+    /*!
+        Critical sections could be nested.
+
+        Will not block.
+
+        \return Critical section token to leave
+    */
+    Token Enter() noexcept;
+    //! Leave the critical section
+    /*!
+        Will not block.
+
+        \param token - Critical section token returned by Enter()
+    */
+    void Leave(Token token) noexcept;
+
+    //! Retire the unlinked node and delete it with the delete operator
+    /*!
+        Will not block.
+
+        \param ptr - Pointer to the retired node
+    */
+    template <typename T>
+    void Retire(T* ptr)
+    { Retire(ptr, [](T* p) { delete p; }); }
+    //! Retire the unlinked node and delete it with the given deleter
+    /*!
+        Deleter is called as deleter(ptr) when the node is safe to delete.
+
+        Will not block.
+
+        \param ptr - Pointer to the retired node
+        \param deleter - Node deleter
+    */
+    template <typename T, class TDeleter>
+    void Retire(T* ptr, TDeleter&& deleter);
+
+    //! Try to advance the epoch and delete retired nodes which are safe to delete
+    /*!
+        Will not block.
+
+        \return Count of deleted nodes
+    */
+    size_t Reclaim();
+
+    //! Wait until all nodes retired before the call are safe to delete and delete them
+    /*!
+        Nodes taken by concurrent Reclaim() calls are deleted by those calls.
+
+        Must not be called inside the critical section.
+
+        Will block while active readers leave their critical sections.
+    */
+    void Synchronize();
+
+private:
+    typedef char cache_line_pad[128];
+
+    // Reader slot is padded with cache line to avoid false sharing of neighbour slots
+    struct Slot
+    {
+        std::atomic<uint64_t> readers[2];
+        cache_line_pad pad;
+
+        Slot() : readers{ 0, 0 } {}
+    };
+
+    // Retired node
+    struct Retired
+    {
+        Deleter deleter;
+        uint64_t epoch;
+        Retired* next;
+
+        template <class TDeleter>
+        Retired(TDeleter&& d, uint64_t e) : deleter(std::forward<TDeleter>(d)), epoch(e), next(nullptr) {}
+    };
+
+    cache_line_pad _pad0;
+    std::atomic<uint64_t> _epoch;
+    cache_line_pad _pad1;
+    std::atomic<Retired*> _limbo;
+    std::atomic<uint64_t> _retired;
+    std::atomic<uint64_t> _reclaimed;
+    cache_line_pad _pad2;
+    size_t _slots_mask;
+    size_t _threshold;
+    std::unique_ptr<Slot[]> _slots;
+
+    //! Get the sequential slot index of the current thread
+    static size_t CurrentThreadSlot() noexcept;
+
+    //! Push the retired node into the limbo stack
+    void Push(Retired* node) noexcept;
+    //! Try to advance the global epoch
+    bool TryAdvance() noexcept;
+    //! Delete retired nodes of the limbo stack retired before the given epoch
+    size_t Collect(uint64_t epoch);
+};
+
+/*! \example threads_epoch_reclamation.cpp Epoch-based memory reclamation example */
+
+} // namespace CppCommon
+
+#include "epoch_reclamation.inl"
+
+#endif // CPPCOMMON_THREADS_EPOCH_RECLAMATION_H
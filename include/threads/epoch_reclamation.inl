@@ -0,0 +1,57 @@
+/*!
+    \file epoch_reclamation.inl
+    \brief Epoch-based memory reclamation inline implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+inline EpochReclamation::Token EpochReclamation::Enter() noexcept
+{
+    size_t index = CurrentThreadSlot() & _slots_mask;
+    Slot& slot = _slots[index];
+
+    for (;;)
+    {
+        // Register the reader in the current epoch
+        uint64_t epoch = _epoch.load(std::memory_order_seq_cst);
+        size_t parity = (size_t)(epoch & 1);
+        slot.readers[parity].fetch_add(1, std::memory_order_seq_cst);
+
+        // Order the registration before any read of shared nodes (pairs with the fence in Retire())
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        // Check the epoch was not advanced during the registration
+        if (_epoch.load(std::memory_order_seq_cst) == epoch)
+            return (Token)((index << 1) | parity);
+
+        slot.readers[parity].fetch_sub(1, std::memory_order_release);
+    }
+}
+
+inline void EpochReclamation::Leave(Token token) noexcept
+{
+    assert(((token >> 1) <= _slots_mask) && "Invalid critical section token!");
+    _slots[token >> 1].readers[token & 1].fetch_sub(1, std::memory_order_release);
+}
+
+template <typename T, class TDeleter>
+inline void EpochReclamation::Retire(T* ptr, TDeleter&& deleter)
+{
+    if (ptr == nullptr)
+        return;
+
+    // Order the node unlink before the epoch read (pairs with the fence in Enter())
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    uint64_t epoch = _epoch.load(std::memory_order_seq_cst);
+
+    Push(new Retired([ptr, deleter = std::forward<TDeleter>(deleter)]() mutable { deleter(ptr); }, epoch));
+
+    // Reclaim retired nodes periodically
+    if ((_retired.fetch_add(1, std::memory_order_relaxed) + 1) % _threshold == 0)
+        Reclaim();
+}
+
+} // namespace CppCommon
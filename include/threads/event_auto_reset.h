@@ -21,6 +21,10 @@ namespace CppCommon {
     and signal only one thread at the time. Other thread will wait for the next event signalization.
     The order of thread signalization by auto-reset event is not guaranteed.
 
+    Event state is changed with atomic operations and waiting threads are parked on
+    the futex (Linux) or WaitOnAddress (Windows), so signal makes a system call only
+    when some threads are parked.
+
     Thread-safe.
 
     https://en.wikipedia.org/wiki/Event_(synchronization_primitive)
@@ -21,6 +21,10 @@ namespace CppCommon {
     and signal all waiting threads at the time. If the event is in the signaled state no thread will wait
     for it until the event is reset.
 
+    Event state is a single atomic word and waiting threads are parked on the futex
+    (Linux) or WaitOnAddress (Windows), so signal makes a system call only when some
+    threads are parked.
+
     Thread-safe.
 
     https://en.wikipedia.org/wiki/Event_(synchronization_primitive)
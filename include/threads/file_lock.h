@@ -26,6 +26,14 @@ namespace CppCommon {
     all other writers or readers will be blocked until the writer is finished
     writing.
 
+    Byte range locks allow to lock disjoint regions of the file independently
+    (e.g. multiple readers and a compactor of the same journal file). Byte
+    ranges held by the file-lock are counted in the process, so lock calls
+    which are already covered by held byte ranges do not make system calls.
+    On Linux open file description locks are used, so different file-lock
+    instances conflict with each other even within the same process. Whole
+    file and byte range locks should not be mixed in the same file-lock.
+
     Thread-safe.
 
     https://en.wikipedia.org/wiki/File_locking
@@ -127,13 +135,62 @@ public:
     */
     void UnlockWrite();
 
+    //! Try to acquire the byte range lock without block
+    /*!
+        Will not block.
+
+        \param offset - Byte range offset
+        \param size - Byte range size (0 to lock up to the end of the file)
+        \param shared - Shared (read) or exclusive (write) byte range lock
+        \return 'true' if the byte range lock was successfully acquired, 'false' if the byte range lock is busy
+    */
+    bool TryLockRange(uint64_t offset, uint64_t size, bool shared);
+    //! Try to acquire the byte range lock for the given timespan
+    /*!
+        Will block for the given timespan in the worst case.
+
+        \param offset - Byte range offset
+        \param size - Byte range size (0 to lock up to the end of the file)
+        \param shared - Shared (read) or exclusive (write) byte range lock
+        \param timespan - Timespan to wait for the byte range lock
+        \return 'true' if the byte range lock was successfully acquired, 'false' if the byte range lock is busy
+    */
+    bool TryLockRangeFor(uint64_t offset, uint64_t size, bool shared, const Timespan& timespan);
+    //! Acquire the byte range lock with block
+    /*!
+        On Windows a shared byte range held by the file-lock could not be
+        upgraded to the exclusive one, so it must be unlocked first.
+
+        Will block.
+
+        \param offset - Byte range offset
+        \param size - Byte range size (0 to lock up to the end of the file)
+        \param shared - Shared (read) or exclusive (write) byte range lock
+    */
+    void LockRange(uint64_t offset, uint64_t size, bool shared);
+    //! Release the byte range lock
+    /*!
+        Byte range must be the same as it was locked.
+
+        Will not block.
+
+        \param offset - Byte range offset
+        \param size - Byte range size (0 to unlock up to the end of the file)
+        \param shared - Shared (read) or exclusive (write) byte range lock
+    */
+    void UnlockRange(uint64_t offset, uint64_t size, bool shared);
+
 private:
     class Impl;
 
     Impl& impl() noexcept { return reinterpret_cast<Impl&>(_storage); }
     const Impl& impl() const noexcept { return reinterpret_cast<Impl const&>(_storage); }
 
-    static const size_t StorageSize = 48;
+#if defined(CPPCOMMON_INSTRUMENTATION)
+    static const size_t StorageSize = 256;
+#else
+    static const size_t StorageSize = 192;
+#endif
     static const size_t StorageAlign = 8;
     alignas(StorageAlign) std::byte _storage[StorageSize];
 };
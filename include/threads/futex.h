@@ -0,0 +1,81 @@
+/*!
+    \file futex.h
+    \brief Process-shared futex synchronization primitive definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_FUTEX_H
+#define CPPCOMMON_THREADS_FUTEX_H
+
+#include "time/timespan.h"
+
+#include <atomic>
+#include <cstdint>
+
+namespace CppCommon {
+
+//! Process-shared futex synchronization primitive
+/*!
+    Futex parks the calling thread while the 32-bit atomic value at the given
+    address is equal to the expected one. The address could be placed into the
+    shared memory, so threads of different processes could wait for each other.
+    In contrast to WaitStrategy::Park() the address is identified by the kernel
+    with the shared memory page, not with the process address space.
+
+    Synchronization primitives built on top of the futex change the atomic value
+    in the user space and call the futex only on contention.
+
+    On Linux process-shared futex is used. On other platforms waiting thread
+    yields and returns spuriously.
+
+    Thread-safe.
+*/
+class Futex
+{
+public:
+    Futex() = delete;
+    Futex(const Futex&) = delete;
+    Futex(Futex&&) = delete;
+    ~Futex() = delete;
+
+    Futex& operator=(const Futex&) = delete;
+    Futex& operator=(Futex&&) = delete;
+
+    //! Wait while the given address contains the given value
+    /*!
+        Might return spuriously, so the caller must check its condition again.
+
+        Will block.
+
+        \param address - Address to wait on
+        \param value - Expected value of the address
+    */
+    static void Wait(std::atomic<uint32_t>& address, uint32_t value) noexcept;
+    //! Wait for the given timespan while the given address contains the given value
+    /*!
+        Might return spuriously, so the caller must check its condition again.
+
+        Will block for the given timespan in the worst case.
+
+        \param address - Address to wait on
+        \param value - Expected value of the address
+        \param timespan - Timespan to wait
+        \return 'false' in case of timeout, 'true' otherwise
+    */
+    static bool WaitFor(std::atomic<uint32_t>& address, uint32_t value, const Timespan& timespan) noexcept;
+
+    //! Wake the given count of threads waiting on the given address
+    /*!
+        \param address - Address to wake
+        \param count - Count of threads to wake (default is 1)
+    */
+    static void Wake(std::atomic<uint32_t>& address, int count = 1) noexcept;
+    //! Wake all threads waiting on the given address
+    static void WakeAll(std::atomic<uint32_t>& address) noexcept;
+};
+
+} // namespace CppCommon
+
+#endif // CPPCOMMON_THREADS_FUTEX_H
@@ -0,0 +1,206 @@
+/*!
+    \file instrumentation.h
+    \brief Instrumentation counters of queues and locks definition
+    \author Ivan Shynkarenka
+    \date 15.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_INSTRUMENTATION_H
+#define CPPCOMMON_THREADS_INSTRUMENTATION_H
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+//! Increment the instrumentation event counter
+/*!
+    Expands to nothing unless the library is built with CPPCOMMON_INSTRUMENTATION
+    definition (CMake option), so instrumented queues and locks cost nothing when
+    the instrumentation is disabled.
+
+    \param counters - Instrumentation counters
+    \param event - Instrumentation event name (FULL, EMPTY, CONTENDED or SPINS)
+    \param count - Count of events
+*/
+#if defined(CPPCOMMON_INSTRUMENTATION)
+#define CPPCOMMON_INSTRUMENT(counters, event, count) (counters).Increment(CppCommon::InstrumentationEvent::event, (count))
+#else
+#define CPPCOMMON_INSTRUMENT(counters, event, count) ((void)0)
+#endif
+
+namespace CppCommon {
+
+//! Instrumentation event
+enum class InstrumentationEvent
+{
+    FULL,       //!< Enqueue was rejected because the queue is full
+    EMPTY,      //!< Dequeue was rejected because the queue is empty
+    CONTENDED,  //!< Lock or queue slot was busy on the first attempt
+    SPINS       //!< Retry iterations while waiting for the busy lock
+};
+
+//! Instrumentation sample
+/*!
+    Sample contains values of all instrumentation events of a single
+    instance or of all instances with the same name.
+
+    Not thread-safe.
+*/
+struct InstrumentationSample
+{
+    //! Count of instrumentation events
+    static const size_t EVENTS = 4;
+
+    //! Instrumented type name
+    std::string name;
+    //! Instance Id (0 for the totals of destroyed instances)
+    uint64_t id;
+    //! Instrumentation events values indexed by event
+    uint64_t values[EVENTS];
+
+    InstrumentationSample() : id(0), values() {}
+    InstrumentationSample(const InstrumentationSample&) = default;
+    InstrumentationSample(InstrumentationSample&&) noexcept = default;
+    ~InstrumentationSample() = default;
+
+    InstrumentationSample& operator=(const InstrumentationSample&) = default;
+    InstrumentationSample& operator=(InstrumentationSample&&) noexcept = default;
+
+    //! Get the value of the given event
+    uint64_t operator[](InstrumentationEvent event) const noexcept { return values[(size_t)event]; }
+    //! Get the value of the given event
+    uint64_t& operator[](InstrumentationEvent event) noexcept { return values[(size_t)event]; }
+
+    //! Get the count of rejected enqueues
+    uint64_t full() const noexcept { return (*this)[InstrumentationEvent::FULL]; }
+    //! Get the count of rejected dequeues
+    uint64_t empty() const noexcept { return (*this)[InstrumentationEvent::EMPTY]; }
+    //! Get the count of contended acquisitions
+    uint64_t contended() const noexcept { return (*this)[InstrumentationEvent::CONTENDED]; }
+    //! Get the count of retry iterations
+    uint64_t spins() const noexcept { return (*this)[InstrumentationEvent::SPINS]; }
+
+    //! Accumulate the given sample
+    InstrumentationSample& operator+=(const InstrumentationSample& sample) noexcept;
+};
+
+//! Instrumentation counters
+/*!
+    Instrumentation counters count events of a single queue or lock instance.
+    Each thread increments its own cache line isolated shard with a relaxed
+    atomic operation, so counting never contends between threads. Threads are
+    assigned to shards in round-robin order of their first increment.
+
+    Named counters are registered in the InstrumentationRegistry for the
+    lifetime of the instance. Default constructed counters are detached: they
+    are not registered and ignore all increments (e.g. for queues emplaced
+    into the shared memory).
+
+    Thread-safe.
+*/
+class InstrumentationCounters
+{
+    friend class InstrumentationRegistry;
+
+public:
+    //! Initialize detached instrumentation counters
+    InstrumentationCounters() noexcept;
+    //! Initialize and register instrumentation counters with the given name
+    /*!
+        \param name - Instrumented type name (must be a string literal or outlive the counters)
+    */
+    explicit InstrumentationCounters(const char* name);
+    InstrumentationCounters(const InstrumentationCounters&) = delete;
+    InstrumentationCounters(InstrumentationCounters&&) = delete;
+    ~InstrumentationCounters();
+
+    InstrumentationCounters& operator=(const InstrumentationCounters&) = delete;
+    InstrumentationCounters& operator=(InstrumentationCounters&&) = delete;
+
+    //! Get the instrumented type name
+    const char* name() const noexcept { return _name; }
+    //! Get the instance Id (0 for detached counters)
+    uint64_t id() const noexcept { return _id; }
+
+    //! Increment the given event counter
+    /*!
+        \param event - Instrumentation event
+        \param count - Count of events (default is 1)
+    */
+    void Increment(InstrumentationEvent event, uint64_t count = 1) noexcept;
+
+    //! Read the current values of all shards
+    InstrumentationSample Read() const;
+
+private:
+    struct alignas(128) Shard
+    {
+        std::atomic<uint64_t> values[InstrumentationSample::EVENTS];
+    };
+
+    const char* _name;
+    uint64_t _id;
+    size_t _shards_mask;
+    std::unique_ptr<Shard[]> _shards;
+
+    // Registry list links
+    InstrumentationCounters* _prev;
+    InstrumentationCounters* _next;
+
+    //! Get the sequential shard index of the current thread
+    static size_t CurrentThreadShard() noexcept;
+};
+
+//! Instrumentation registry
+/*!
+    Instrumentation registry keeps all alive named instrumentation counters
+    and the totals of destroyed ones, so monotonic values could be exported
+    into metrics systems with periodic snapshots.
+
+    Thread-safe.
+*/
+class InstrumentationRegistry
+{
+public:
+    InstrumentationRegistry() = delete;
+    InstrumentationRegistry(const InstrumentationRegistry&) = delete;
+    InstrumentationRegistry(InstrumentationRegistry&&) = delete;
+    ~InstrumentationRegistry() = delete;
+
+    InstrumentationRegistry& operator=(const InstrumentationRegistry&) = delete;
+    InstrumentationRegistry& operator=(InstrumentationRegistry&&) = delete;
+
+    //! Is the instrumentation of queues and locks enabled?
+    /*!
+        \return 'true' if the library is built with CPPCOMMON_INSTRUMENTATION definition
+    */
+    static bool IsEnabled() noexcept;
+
+    //! Snapshot all alive instances and the totals of destroyed instances
+    /*!
+        \return Instrumentation samples of alive instances in registration order followed by destroyed instances totals (Id is 0) per name
+    */
+    static std::vector<InstrumentationSample> Snapshot();
+    //! Snapshot the totals of all instances aggregated by name
+    /*!
+        \return Instrumentation samples aggregated by name (Id is 0) sorted by name
+    */
+    static std::vector<InstrumentationSample> Totals();
+
+private:
+    static void Register(InstrumentationCounters& counters);
+    static void Unregister(InstrumentationCounters& counters);
+
+    friend class InstrumentationCounters;
+};
+
+/*! \example threads_instrumentation.cpp Instrumentation counters of queues and locks example */
+
+} // namespace CppCommon
+
+#include "instrumentation.inl"
+
+#endif // CPPCOMMON_THREADS_INSTRUMENTATION_H
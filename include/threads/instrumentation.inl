@@ -0,0 +1,24 @@
+/*!
+    \file instrumentation.inl
+    \brief Instrumentation counters of queues and locks inline implementation
+    \author Ivan Shynkarenka
+    \date 15.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+inline InstrumentationSample& InstrumentationSample::operator+=(const InstrumentationSample& sample) noexcept
+{
+    for (size_t i = 0; i < EVENTS; ++i)
+        values[i] += sample.values[i];
+    return *this;
+}
+
+inline void InstrumentationCounters::Increment(InstrumentationEvent event, uint64_t count) noexcept
+{
+    if (_shards)
+        _shards[CurrentThreadShard() & _shards_mask].values[(size_t)event].fetch_add(count, std::memory_order_relaxed);
+}
+
+} // namespace CppCommon
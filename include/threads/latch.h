@@ -11,10 +11,9 @@
 
 #include "time/timestamp.h"
 
+#include <atomic>
 #include <cassert>
-#include <condition_variable>
-#include <memory>
-#include <mutex>
+#include <cstdint>
 
 namespace CppCommon {
 
@@ -23,6 +22,10 @@ namespace CppCommon {
     Latches are a thread co-ordination mechanism that allow one or more threads to block
     until one or more threads have reached a point.
 
+    Latch counter is changed with atomic operations and waiting threads are parked
+    on the latch generation, so count down makes a system call only when the latch
+    counter reaches zero and some threads are parked.
+
     Thread-safe.
 */
 class Latch
@@ -41,7 +44,7 @@ public:
     Latch& operator=(Latch&&) = delete;
 
     //! Get the count of threads to wait for the latch
-    int threads() const noexcept { return _threads; }
+    int threads() const noexcept { return _threads.load(std::memory_order_acquire); }
 
     //! Reset the latch with a new threads counter value
     /*!
@@ -107,12 +110,22 @@ public:
     bool TryWaitUntil(const Timestamp& timestamp) noexcept;
 
 private:
-    std::mutex _mutex;
-    std::condition_variable _cond;
-    int _generation;
-    int _threads;
+    std::atomic<uint32_t> _generation;
+    std::atomic<int> _threads;
+    std::atomic<uint32_t> _waiters;
 
-    bool CountDown(std::unique_lock<std::mutex>& lock) noexcept;
+    //! Count down the latch threads counter and release waiting threads if it reaches zero
+    /*!
+        \return 'true' if the latch counter reaches zero, 'false' otherwise
+    */
+    bool Release() noexcept;
+    //! Wait for the next latch generation until the given deadline
+    /*!
+        \param generation - Latch generation to wait for the change
+        \param deadline - Deadline nanoseconds timestamp (0 to wait infinite)
+        \return 'true' if the latch generation was changed, 'false' in case of timeout
+    */
+    bool WaitGeneration(uint32_t generation, uint64_t deadline) noexcept;
 };
 
 /*! \example threads_latch_multi.cpp Latch synchronization primitive example for multiple threads waiting */
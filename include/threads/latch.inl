@@ -8,39 +8,20 @@
 
 namespace CppCommon {
 
-inline Latch::Latch(int threads) noexcept : _generation(0), _threads(threads)
+inline Latch::Latch(int threads) noexcept : _generation(0), _threads(threads), _waiters(0)
 {
     assert((threads > 0) && "Latch threads counter must be greater than zero!");
 }
 
-inline bool Latch::TryWaitFor(const Timespan& timespan) noexcept
+inline bool Latch::TryWait() noexcept
 {
-    std::unique_lock<std::mutex> lock(_mutex);
-
     // Check the latch threads counter value
-    if (_threads == 0)
-        return true;
-
-    // Remember the current latch generation
-    int generation = _generation;
-
-    // Wait for the next latch generation
-    return _cond.wait_for(lock, timespan.chrono(), [&, this]() { return generation != _generation; });
+    return (_threads.load(std::memory_order_acquire) == 0);
 }
 
 inline bool Latch::TryWaitUntil(const Timestamp& timestamp) noexcept
 {
-    std::unique_lock<std::mutex> lock(_mutex);
-
-    // Check the latch threads counter value
-    if (_threads == 0)
-        return true;
-
-    // Remember the current latch generation
-    int generation = _generation;
-
-    // Wait for the next latch generation
-    return _cond.wait_until(lock, timestamp.chrono(), [&, this]() { return generation != _generation; });
+    return TryWaitFor(timestamp - UtcTimestamp());
 }
 
 } // namespace CppCommon
@@ -0,0 +1,123 @@
+/*!
+    \file left_right.h
+    \brief Left-Right synchronization primitive definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_LEFT_RIGHT_H
+#define CPPCOMMON_THREADS_LEFT_RIGHT_H
+
+#include "threads/adaptive_lock.h"
+#include "threads/thread.h"
+#include "threads/wait_strategy.h"
+
+#include <atomic>
+#include <cstdint>
+#include <utility>
+
+namespace CppCommon {
+
+//! Left-Right synchronization primitive
+/*!
+    Left-Right keeps two instances of the data. Readers always read the
+    instance, which is not modified by the writer, so readers never retry
+    and never wait: reading costs two atomic increments of the read indicator
+    and the read itself (wait-free readers). Writer modifies the other
+    instance, switches readers to it, waits for readers of the previous
+    instance to leave and repeats the modification on it.
+
+    In contrast to SeqLock the data is not required to be trivially copyable
+    and could be read in place without copying, but each write is applied
+    twice and writers wait for all active readers.
+
+    Writers are serialized with the adaptive lock.
+
+    Thread-safe.
+*/
+template <typename T>
+class LeftRight
+{
+public:
+    LeftRight();
+    explicit LeftRight(const T& data);
+    LeftRight(const LeftRight&) = delete;
+    LeftRight(LeftRight&&) = delete;
+    ~LeftRight() = default;
+
+    LeftRight& operator=(const T& data);
+    LeftRight& operator=(const LeftRight&) = delete;
+    LeftRight& operator=(LeftRight&&) = delete;
+
+    //! Read data
+    /*!
+        Will not block (wait-free).
+
+        \return Copy of the read data
+    */
+    T Read() const;
+
+    //! Visit data in place
+    /*!
+        Visitor is called as visitor(const T& data). Keep the visitor short,
+        because writers wait for active readers.
+
+        Will not block (wait-free).
+
+        \param visitor - Visitor function
+    */
+    template <class TVisitor>
+    void Visit(TVisitor&& visitor) const;
+
+    //! Write data
+    /*!
+        Will block while active readers leave the previous data instance.
+
+        \param data - Data to write
+    */
+    void Write(const T& data);
+
+    //! Modify data in place
+    /*!
+        Modifier is called as modifier(T& data) two times: for each of data
+        instances, so it must make the same change to both of them.
+
+        Will block while active readers leave the previous data instance.
+
+        \param modifier - Modifier function
+    */
+    template <class TModifier>
+    void Modify(TModifier&& modifier);
+
+private:
+    typedef char cache_line_pad[128];
+
+    // Read indicator is padded with cache line to avoid false sharing with data instances
+    struct Indicator
+    {
+        mutable std::atomic<uint64_t> readers;
+        cache_line_pad pad;
+
+        Indicator() : readers(0) {}
+    };
+
+    cache_line_pad _pad0;
+    std::atomic<uint32_t> _left_right;
+    std::atomic<uint32_t> _version;
+    cache_line_pad _pad1;
+    Indicator _indicators[2];
+    T _data[2];
+    AdaptiveLock _writers;
+
+    //! Wait for readers of the given version to leave
+    void Drain(uint32_t version) const noexcept;
+};
+
+/*! \example threads_left_right.cpp Left-Right synchronization primitive example */
+
+} // namespace CppCommon
+
+#include "left_right.inl"
+
+#endif // CPPCOMMON_THREADS_LEFT_RIGHT_H
@@ -0,0 +1,90 @@
+/*!
+    \file left_right.inl
+    \brief Left-Right synchronization primitive inline implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+template <typename T>
+inline LeftRight<T>::LeftRight() : _pad0(), _left_right(0), _version(0), _pad1(), _data()
+{
+}
+
+template <typename T>
+inline LeftRight<T>::LeftRight(const T& data) : _pad0(), _left_right(0), _version(0), _pad1(), _data{ data, data }
+{
+}
+
+template <typename T>
+inline LeftRight<T>& LeftRight<T>::operator=(const T& data)
+{
+    Write(data);
+    return *this;
+}
+
+template <typename T>
+inline T LeftRight<T>::Read() const
+{
+    T result;
+    Visit([&result](const T& data) { result = data; });
+    return result;
+}
+
+template <typename T>
+template <class TVisitor>
+inline void LeftRight<T>::Visit(TVisitor&& visitor) const
+{
+    // Arrive to the read indicator of the current version
+    uint32_t version = _version.load(std::memory_order_seq_cst);
+    _indicators[version].readers.fetch_add(1, std::memory_order_seq_cst);
+
+    // Read the data instance which is not modified by the writer
+    visitor(_data[_left_right.load(std::memory_order_seq_cst)]);
+
+    // Depart from the read indicator
+    _indicators[version].readers.fetch_sub(1, std::memory_order_release);
+}
+
+template <typename T>
+inline void LeftRight<T>::Write(const T& data)
+{
+    Modify([&data](T& instance) { instance = data; });
+}
+
+template <typename T>
+template <class TModifier>
+inline void LeftRight<T>::Modify(TModifier&& modifier)
+{
+    Locker<AdaptiveLock> locker(_writers);
+
+    // Modify the data instance without readers and switch new readers to it
+    uint32_t left_right = _left_right.load(std::memory_order_relaxed);
+    modifier(_data[1 - left_right]);
+    _left_right.store(1 - left_right, std::memory_order_seq_cst);
+
+    // Toggle the version, so readers of the previous data instance could be drained
+    uint32_t version = _version.load(std::memory_order_relaxed);
+    Drain(1 - version);
+    _version.store(1 - version, std::memory_order_seq_cst);
+    Drain(version);
+
+    // Repeat the modification of the previous data instance
+    modifier(_data[left_right]);
+}
+
+template <typename T>
+inline void LeftRight<T>::Drain(uint32_t version) const noexcept
+{
+    for (uint32_t spin = 0; _indicators[version].readers.load(std::memory_order_acquire) != 0; ++spin)
+    {
+        if (spin < 128)
+            WaitStrategy::Relax();
+        else
+            Thread::Yield();
+    }
+}
+
+} // namespace CppCommon
@@ -0,0 +1,156 @@
+/*!
+    \file mpmc_linked_queue.h
+    \brief Multiple producers / multiple consumers lock-free linked queue definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_MPMC_LINKED_QUEUE_H
+#define CPPCOMMON_THREADS_MPMC_LINKED_QUEUE_H
+
+#include "memory/allocator.h"
+#include "memory/object_pool.h"
+#include "threads/epoch_reclamation.h"
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <utility>
+
+namespace CppCommon {
+
+//! Multiple producers / multiple consumers lock-free linked queue
+/*!
+    Multiple producers / multiple consumers lock-free linked queue use only atomic operations to provide thread-safe
+    enqueue and dequeue operations. Linked queue is a dynamically grows queue of linked segments, so it is never full
+    as ring queues are.
+
+    Each segment is an array of N cells with its own enqueue and dequeue indexes. Producers and consumers claim cells
+    with a single atomic increment of the segment index, so enqueue and dequeue do not retry on contention as node based
+    queues do. Producer which finds the tail segment full links a new one. Consumer which exhausts the head segment
+    moves the head to the next segment and retires the exhausted segment.
+
+    Memory is allocated per segment instead of per item. Retired segments are not freed, but recycled through the
+    lock-free object pool, so steady state enqueue and dequeue never call the memory manager. Segments storage is
+    allocated in chunks from the auxiliary memory manager. Epoch-based reclamation guarantees that the recycled segment
+    is not accessed by concurrent producers and consumers anymore.
+
+    FIFO order is guaranteed!
+
+    Thread-safe.
+
+    C++ implementation of Pedro Ramalhete and Andreia Correia FAAArrayQueue
+    https://github.com/pramalhe/ConcurrencyFreaks/blob/master/CPP/queues/array/FAAArrayQueue.hpp
+*/
+template <typename T, size_t N = 256, class TAuxMemoryManager = DefaultMemoryManager>
+class MPMCLinkedQueue
+{
+public:
+    //! Initialize linked queue with an auxiliary memory manager
+    /*!
+        \param auxiliary - Auxiliary memory manager
+        \param chunk - Count of segments in a single chunk of segments storage (will be rounded up to the power of two, default is 16)
+        \param chunks - Max chunks count (default is 4096)
+    */
+    explicit MPMCLinkedQueue(TAuxMemoryManager& auxiliary, size_t chunk = 16, size_t chunks = 4096);
+    MPMCLinkedQueue(const MPMCLinkedQueue&) = delete;
+    MPMCLinkedQueue(MPMCLinkedQueue&&) = delete;
+    ~MPMCLinkedQueue();
+
+    MPMCLinkedQueue& operator=(const MPMCLinkedQueue&) = delete;
+    MPMCLinkedQueue& operator=(MPMCLinkedQueue&&) = delete;
+
+    //! Get count of cells in a single segment
+    static constexpr size_t segment() noexcept { return N; }
+    //! Get count of allocated segments (both used and recycled)
+    size_t segments() const noexcept { return _pool.capacity(); }
+
+    //! Auxiliary memory manager
+    TAuxMemoryManager& auxiliary() noexcept { return _pool.auxiliary(); }
+
+    //! Enqueue an item into the linked queue (multiple producers threads method)
+    /*!
+        The item will be copied into the linked queue.
+
+        Will not block.
+
+        \param item - Item to enqueue
+        \return 'true' if the item was successfully enqueue, 'false' if there is no enough memory for the queue segment
+    */
+    bool Enqueue(const T& item);
+    //! Enqueue an item into the linked queue (multiple producers threads method)
+    /*!
+        The item will be moved into the linked queue.
+
+        Will not block.
+
+        \param item - Item to enqueue
+        \return 'true' if the item was successfully enqueue, 'false' if there is no enough memory for the queue segment
+    */
+    bool Enqueue(T&& item);
+
+    //! Dequeue an item from the linked queue (multiple consumers threads method)
+    /*!
+        The item will be moved from the linked queue.
+
+        Will not block.
+
+        \param item - Item to dequeue
+        \return 'true' if the item was successfully dequeue, 'false' if the linked queue is empty
+    */
+    bool Dequeue(T& item);
+
+private:
+    // Cell states
+    static const uint32_t EMPTY = 0;
+    static const uint32_t FULL = 1;
+    static const uint32_t TAKEN = 2;
+
+    typedef char cache_line_pad[128];
+
+    // Segment cell
+    struct Cell
+    {
+        std::atomic<uint32_t> state;
+        alignas(T) uint8_t storage[sizeof(T)];
+
+        Cell() : state(EMPTY) {}
+
+        T* value() noexcept { return std::launder(reinterpret_cast<T*>(storage)); }
+    };
+
+    // Segment of cells
+    struct Segment
+    {
+        std::atomic<uint64_t> enqueue;
+        cache_line_pad pad0;
+        std::atomic<uint64_t> dequeue;
+        cache_line_pad pad1;
+        std::atomic<Segment*> next;
+        Cell cells[N];
+
+        Segment() : enqueue(0), dequeue(0), next(nullptr) {}
+    };
+
+    cache_line_pad _pad0;
+    std::atomic<Segment*> _head;
+    cache_line_pad _pad1;
+    std::atomic<Segment*> _tail;
+    cache_line_pad _pad2;
+
+    ObjectPool<Segment, TAuxMemoryManager> _pool;
+    EpochReclamation _reclamation;
+
+    //! Retire the exhausted head segment into the object pool
+    void Retire(Segment* segment);
+};
+
+/*! \example threads_mpmc_linked_queue.cpp Multiple producers / multiple consumers lock-free linked queue example */
+
+} // namespace CppCommon
+
+#include "mpmc_linked_queue.inl"
+
+#endif // CPPCOMMON_THREADS_MPMC_LINKED_QUEUE_H
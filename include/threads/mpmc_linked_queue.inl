@@ -0,0 +1,153 @@
+/*!
+    \file mpmc_linked_queue.inl
+    \brief Multiple producers / multiple consumers lock-free linked queue inline implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+template <typename T, size_t N, class TAuxMemoryManager>
+inline MPMCLinkedQueue<T, N, TAuxMemoryManager>::MPMCLinkedQueue(TAuxMemoryManager& auxiliary, size_t chunk, size_t chunks)
+    : _head(nullptr),
+      _tail(nullptr),
+      _pool(auxiliary, chunk, chunks),
+      _reclamation(0, 8)
+{
+    static_assert((N > 0), "Linked queue segment must contain at least one cell!");
+
+    memset(_pad0, 0, sizeof(cache_line_pad));
+    memset(_pad1, 0, sizeof(cache_line_pad));
+    memset(_pad2, 0, sizeof(cache_line_pad));
+
+    // Linked queue is initialized with an empty segment
+    Segment* segment = _pool.Create();
+    if (segment == nullptr)
+        throw std::bad_alloc();
+
+    _head.store(segment, std::memory_order_relaxed);
+    _tail.store(segment, std::memory_order_relaxed);
+}
+
+template <typename T, size_t N, class TAuxMemoryManager>
+inline MPMCLinkedQueue<T, N, TAuxMemoryManager>::~MPMCLinkedQueue()
+{
+    // Destroy all remaining items and release all linked segments
+    Segment* segment = _head.load(std::memory_order_relaxed);
+    while (segment != nullptr)
+    {
+        for (size_t i = 0; i < N; ++i)
+            if (segment->cells[i].state.load(std::memory_order_relaxed) == FULL)
+                segment->cells[i].value()->~T();
+
+        Segment* next = segment->next.load(std::memory_order_relaxed);
+        _pool.Release(segment);
+        segment = next;
+    }
+
+    // Release all retired segments
+    _reclamation.Synchronize();
+}
+
+template <typename T, size_t N, class TAuxMemoryManager>
+inline bool MPMCLinkedQueue<T, N, TAuxMemoryManager>::Enqueue(const T& item)
+{
+    T temp = item;
+    return Enqueue(std::forward<T>(temp));
+}
+
+template <typename T, size_t N, class TAuxMemoryManager>
+inline bool MPMCLinkedQueue<T, N, TAuxMemoryManager>::Enqueue(T&& item)
+{
+    EpochReclamation::Guard guard(_reclamation);
+
+    for (;;)
+    {
+        Segment* tail = _tail.load(std::memory_order_acquire);
+
+        // Claim the next cell of the tail segment
+        uint64_t index = tail->enqueue.fetch_add(1, std::memory_order_acq_rel);
+        if (index < N)
+        {
+            // Fill the claimed cell with the given value
+            Cell& cell = tail->cells[index];
+            T* value = new (cell.storage) T(std::move(item));
+
+            // Publish the value, unless the cell was already taken by the consumer
+            uint32_t state = EMPTY;
+            if (cell.state.compare_exchange_strong(state, FULL, std::memory_order_acq_rel, std::memory_order_relaxed))
+                return true;
+
+            // Return the value back and try the next cell
+            item = std::move(*value);
+            value->~T();
+            continue;
+        }
+
+        // Tail segment is full, so link a new one or help to move the tail
+        Segment* next = tail->next.load(std::memory_order_acquire);
+        if (next == nullptr)
+        {
+            Segment* segment = _pool.Create();
+            if (segment == nullptr)
+                return false;
+
+            if (tail->next.compare_exchange_strong(next, segment, std::memory_order_acq_rel, std::memory_order_acquire))
+                next = segment;
+            else
+                _pool.Release(segment);
+        }
+        _tail.compare_exchange_strong(tail, next, std::memory_order_acq_rel, std::memory_order_relaxed);
+    }
+}
+
+template <typename T, size_t N, class TAuxMemoryManager>
+inline bool MPMCLinkedQueue<T, N, TAuxMemoryManager>::Dequeue(T& item)
+{
+    EpochReclamation::Guard guard(_reclamation);
+
+    for (;;)
+    {
+        Segment* head = _head.load(std::memory_order_acquire);
+
+        // Check if the linked queue is empty
+        if ((head->dequeue.load(std::memory_order_acquire) >= head->enqueue.load(std::memory_order_acquire)) && (head->next.load(std::memory_order_acquire) == nullptr))
+            return false;
+
+        // Claim the next cell of the head segment
+        uint64_t index = head->dequeue.fetch_add(1, std::memory_order_acq_rel);
+        if (index < N)
+        {
+            // Take the cell. If the producer has not yet filled it, the producer will try the next cell.
+            Cell& cell = head->cells[index];
+            if (cell.state.exchange(TAKEN, std::memory_order_acq_rel) != FULL)
+                continue;
+
+            T* value = cell.value();
+            item = std::move(*value);
+            value->~T();
+            return true;
+        }
+
+        // Head segment is exhausted, so move the head to the next segment
+        Segment* next = head->next.load(std::memory_order_acquire);
+        if (next == nullptr)
+            return false;
+
+        // Move the lagging tail first, so the retired segment is not reachable from the tail
+        Segment* tail = head;
+        _tail.compare_exchange_strong(tail, next, std::memory_order_acq_rel, std::memory_order_relaxed);
+
+        if (_head.compare_exchange_strong(head, next, std::memory_order_acq_rel, std::memory_order_relaxed))
+            Retire(head);
+    }
+}
+
+template <typename T, size_t N, class TAuxMemoryManager>
+inline void MPMCLinkedQueue<T, N, TAuxMemoryManager>::Retire(Segment* segment)
+{
+    _reclamation.Retire(segment, [this](Segment* s) { _pool.Release(s); });
+}
+
+} // namespace CppCommon
@@ -0,0 +1,214 @@
+/*!
+    \file mpmc_ring_buffer.h
+    \brief Multiple producers / multiple consumers lock-free ring buffer definition
+    \author Ivan Shynkarenka
+    \date 15.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_MPMC_RING_BUFFER_H
+#define CPPCOMMON_THREADS_MPMC_RING_BUFFER_H
+
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+
+namespace CppCommon {
+
+//! Multiple producers / multiple consumers lock-free ring buffer
+/*!
+    Multiple producers / multiple consumers lock-free ring buffer transfers
+    variable size records of bytes. Each record is prefixed with a header of
+    16 bytes and aligned to 16 bytes, so a record of N bytes occupies
+    N + 16 bytes rounded up to 16 bytes of the ring buffer capacity.
+
+    Producers reserve records with a single atomic operation and commit them
+    in any order. Consumers claim committed records in the reservation order
+    with a single atomic operation and release them in any order: the space
+    of a released record is reclaimed when all records before it are released
+    as well. Records are never split by the end of the ring buffer, so they
+    could be written and read in place.
+
+    Released records are cleared with zeros by the releasing consumer, so the
+    free space of the ring buffer never contains stale headers. Record headers
+    are tagged with the record position, so a header of the previous lap is
+    never taken as a header of the current one.
+
+    An uncommitted record stops consumers from claiming the following records
+    and an unreleased record stops producers when the ring buffer is full, so
+    commit and release records as soon as possible.
+
+    FIFO order of claims is guaranteed!
+
+    Thread-safe.
+
+    Free space zeroing is based on the many-to-one ring buffer of Aeron:
+    https://github.com/real-logic/agrona/blob/master/agrona/src/main/java/org/agrona/concurrent/ringbuffer/ManyToOneRingBuffer.java
+*/
+class MPMCRingBuffer
+{
+public:
+    //! Record header size in bytes (records are aligned to the header size)
+    static const size_t HEADER = 16;
+
+    //! Default class constructor
+    /*!
+        \param capacity - Ring buffer capacity in bytes (must be a power of two, not less than 64 and not greater than 4 GiB)
+    */
+    explicit MPMCRingBuffer(size_t capacity);
+    MPMCRingBuffer(const MPMCRingBuffer&) = delete;
+    MPMCRingBuffer(MPMCRingBuffer&&) = delete;
+    ~MPMCRingBuffer() { delete[] _buffer; }
+
+    MPMCRingBuffer& operator=(const MPMCRingBuffer&) = delete;
+    MPMCRingBuffer& operator=(MPMCRingBuffer&&) = delete;
+
+    //! Check if the buffer is not empty
+    explicit operator bool() const noexcept { return !empty(); }
+
+    //! Is ring buffer empty?
+    bool empty() const noexcept { return (size() == 0); }
+    //! Get ring buffer capacity in bytes
+    size_t capacity() const noexcept { return _capacity; }
+    //! Get max record size in bytes
+    size_t max_record() const noexcept { return (_capacity / 2) - HEADER; }
+    //! Get ring buffer size in bytes (including headers, paddings and claimed records which are not released yet)
+    size_t size() const noexcept;
+
+    //! Reserved record of the ring buffer
+    struct Reservation
+    {
+        void* data;         //!< Pointer to the reserved record data (nullptr if the ring buffer is full)
+        size_t size;        //!< Reserved record size
+        size_t position;    //!< Reserved record position
+
+        //! Check if the record is reserved
+        explicit operator bool() const noexcept { return (data != nullptr); }
+    };
+
+    //! Claimed record of the ring buffer
+    struct Record
+    {
+        const void* data;   //!< Pointer to the claimed record data (nullptr if the ring buffer is empty)
+        size_t size;        //!< Claimed record size
+        size_t position;    //!< Claimed record position
+
+        //! Check if the record is claimed
+        explicit operator bool() const noexcept { return (data != nullptr); }
+    };
+
+    //! Reserve a record in the ring buffer to write a data in place (multiple producers threads method)
+    /*!
+        Reserved record is not visible for consumers until it is committed.
+
+        Will not block.
+
+        \param size - Reserved record size (must not be greater than max_record())
+        \return Reservation of the record which evaluates to 'false' if the ring buffer is full
+    */
+    Reservation Reserve(size_t size);
+    //! Commit the given count of bytes of the reserved record (multiple producers threads method)
+    /*!
+        The rest of the reserved record is not returned to the ring buffer.
+
+        Will not block.
+
+        \param reservation - Reservation of the record
+        \param size - Committed size (must not be greater than the reserved size)
+    */
+    void Commit(const Reservation& reservation, size_t size);
+    //! Commit the whole reserved record (multiple producers threads method)
+    /*!
+        \param reservation - Reservation of the record
+    */
+    void Commit(const Reservation& reservation) { Commit(reservation, reservation.size); }
+
+    //! Claim the next committed record in the ring buffer to read it in place (multiple consumers threads method)
+    /*!
+        Claimed record stays in the ring buffer until it is released.
+
+        Will not block.
+
+        \return Claimed record which evaluates to 'false' if the ring buffer is empty or the next record is not committed yet
+    */
+    Record Claim();
+    //! Release the claimed record (multiple consumers threads method)
+    /*!
+        Will not block.
+
+        \param record - Claimed record
+    */
+    void Release(const Record& record);
+
+    //! Enqueue a record into the ring buffer (multiple producers threads method)
+    /*!
+        The data will be copied into the ring buffer using 'memcpy()' function.
+
+        Will not block.
+
+        \param data - Data buffer to enqueue
+        \param size - Data buffer size (must not be greater than max_record())
+        \return 'true' if the record was successfully enqueue, 'false' if the ring buffer is full
+    */
+    bool Enqueue(const void* data, size_t size);
+
+    //! Dequeue a record from the ring buffer (multiple consumers threads method)
+    /*!
+        The data will be copied from the ring buffer using 'memcpy()' function.
+        Data buffer size should not be less than max_record()!
+
+        Will not block.
+
+        \param data - Data buffer to dequeue
+        \param size - Data buffer size / dequeued record size
+        \return 'true' if the record was successfully dequeue, 'false' if the ring buffer is empty
+    */
+    bool Dequeue(void* data, size_t& size);
+
+private:
+    //! Record states are stored in the low bits of the record position
+    enum State : uint64_t
+    {
+        COMMITTED = 1,
+        RELEASED = 2,
+        PADDING = 3,
+        MASK = HEADER - 1
+    };
+
+    //! Record header
+    struct Header
+    {
+        uint64_t sequence;  // Record position | record state (zero for the free space)
+        uint64_t extent;    // Record length with the header << 32 | record size
+    };
+
+    typedef char cache_line_pad[128];
+
+    cache_line_pad _pad0;
+    const size_t _capacity;
+    const size_t _mask;
+    uint8_t* const _buffer;
+
+    cache_line_pad _pad1;
+    std::atomic<size_t> _head;
+    cache_line_pad _pad2;
+    std::atomic<size_t> _claim;
+    cache_line_pad _pad3;
+    std::atomic<size_t> _tail;
+    cache_line_pad _pad4;
+
+    //! Get the record header at the given position
+    Header& header(size_t position) const noexcept { return *(Header*)&_buffer[position & _mask]; }
+
+    //! Reclaim the space of released records and passed paddings at the tail of the ring buffer
+    void Reclaim() noexcept;
+};
+
+/*! \example threads_mpmc_ring_buffer.cpp Multiple producers / multiple consumers lock-free ring buffer example */
+
+} // namespace CppCommon
+
+#include "mpmc_ring_buffer.inl"
+
+#endif // CPPCOMMON_THREADS_MPMC_RING_BUFFER_H
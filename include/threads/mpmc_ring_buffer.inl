@@ -0,0 +1,190 @@
+/*!
+    \file mpmc_ring_buffer.inl
+    \brief Multiple producers / multiple consumers lock-free ring buffer inline implementation
+    \author Ivan Shynkarenka
+    \date 15.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+inline MPMCRingBuffer::MPMCRingBuffer(size_t capacity) : _capacity(capacity), _mask(capacity - 1), _buffer(new uint8_t[capacity]()), _head(0), _claim(0), _tail(0)
+{
+    assert((capacity >= 4 * HEADER) && "Ring buffer capacity must not be less than four headers!");
+    assert((capacity <= 0x100000000ull) && "Ring buffer capacity must not be greater than 4 GiB!");
+    assert(((capacity & (capacity - 1)) == 0) && "Ring buffer capacity must be a power of two!");
+
+    memset(_pad0, 0, sizeof(cache_line_pad));
+    memset(_pad1, 0, sizeof(cache_line_pad));
+    memset(_pad2, 0, sizeof(cache_line_pad));
+    memset(_pad3, 0, sizeof(cache_line_pad));
+    memset(_pad4, 0, sizeof(cache_line_pad));
+}
+
+inline size_t MPMCRingBuffer::size() const noexcept
+{
+    const size_t tail = _tail.load(std::memory_order_acquire);
+    const size_t head = _head.load(std::memory_order_acquire);
+
+    return head - tail;
+}
+
+inline MPMCRingBuffer::Reservation MPMCRingBuffer::Reserve(size_t size)
+{
+    assert((size <= max_record()) && "Reserved size should not be greater than the max record size!");
+    if (size > max_record())
+        return Reservation{ nullptr, 0, 0 };
+
+    const size_t length = (HEADER + size + HEADER - 1) & ~(HEADER - 1);
+
+    size_t head = _head.load(std::memory_order_relaxed);
+    size_t padding;
+    for (;;)
+    {
+        // Skip the rest of the ring buffer if the record does not fit into it
+        const size_t contiguous = _capacity - (head & _mask);
+        padding = (length > contiguous) ? contiguous : 0;
+
+        // Reload the head cursor if it was passed by the tail cursor
+        const size_t tail = _tail.load(std::memory_order_acquire);
+        if (tail > head)
+        {
+            head = _head.load(std::memory_order_relaxed);
+            continue;
+        }
+
+        // Check if there is required free space in the ring buffer
+        if ((padding + length + head - tail) > _capacity)
+            return Reservation{ nullptr, 0, 0 };
+
+        // Claim the record space
+        if (_head.compare_exchange_weak(head, head + padding + length, std::memory_order_relaxed))
+            break;
+    }
+
+    // Publish the padding right away, consumers pass it as soon as they reach it
+    if (padding > 0)
+    {
+        Header& skip = header(head);
+        std::atomic_ref<uint64_t>(skip.extent).store(padding << 32, std::memory_order_relaxed);
+        std::atomic_ref<uint64_t>(skip.sequence).store(head | PADDING, std::memory_order_release);
+    }
+
+    const size_t position = head + padding;
+    return Reservation{ &header(position) + 1, size, position };
+}
+
+inline void MPMCRingBuffer::Commit(const Reservation& reservation, size_t size)
+{
+    assert(reservation && "Reservation must be valid!");
+    assert((size <= reservation.size) && "Committed size should not be greater than the reserved size!");
+    if (size > reservation.size)
+        size = reservation.size;
+
+    const uint64_t length = (HEADER + reservation.size + HEADER - 1) & ~(HEADER - 1);
+
+    // Publish the record for consumers
+    Header& record = header(reservation.position);
+    std::atomic_ref<uint64_t>(record.extent).store((length << 32) | size, std::memory_order_relaxed);
+    std::atomic_ref<uint64_t>(record.sequence).store(reservation.position | COMMITTED, std::memory_order_release);
+}
+
+inline MPMCRingBuffer::Record MPMCRingBuffer::Claim()
+{
+    size_t claim = _claim.load(std::memory_order_acquire);
+    for (;;)
+    {
+        // Check if the next record is committed (headers of the free space and of the previous lap do not match the position)
+        Header& record = header(claim);
+        const uint64_t sequence = std::atomic_ref<uint64_t>(record.sequence).load(std::memory_order_acquire);
+        if (((sequence & ~(uint64_t)MASK) != claim) || ((sequence & MASK) == 0))
+            return Record{ nullptr, 0, 0 };
+        const uint64_t extent = std::atomic_ref<uint64_t>(record.extent).load(std::memory_order_relaxed);
+
+        // Claim the record or the padding
+        if (_claim.compare_exchange_weak(claim, claim + (extent >> 32)))
+        {
+            if ((sequence & MASK) == COMMITTED)
+                return Record{ &record + 1, (size_t)(extent & 0xFFFFFFFF), (size_t)claim };
+
+            // Passed padding could be the last one which holds the tail
+            Reclaim();
+            claim = _claim.load(std::memory_order_acquire);
+        }
+    }
+}
+
+inline void MPMCRingBuffer::Release(const Record& record)
+{
+    assert(record && "Record must be valid!");
+
+    // Clear the record data, so the free space never contains stale headers
+    Header& released = header(record.position);
+    const uint64_t length = std::atomic_ref<uint64_t>(released.extent).load(std::memory_order_relaxed) >> 32;
+    memset(&released + 1, 0, length - HEADER);
+
+    std::atomic_ref<uint64_t>(released.sequence).store(record.position | RELEASED);
+
+    Reclaim();
+}
+
+inline bool MPMCRingBuffer::Enqueue(const void* data, size_t size)
+{
+    assert(((data != nullptr) || (size == 0)) && "Pointer to the data should not be null!");
+
+    Reservation reservation = Reserve(size);
+    if (!reservation)
+        return false;
+
+    if (size > 0)
+        memcpy(reservation.data, data, size);
+    Commit(reservation);
+
+    return true;
+}
+
+inline bool MPMCRingBuffer::Dequeue(void* data, size_t& size)
+{
+    assert((data != nullptr) && "Pointer to the data should not be null!");
+
+    Record record = Claim();
+    if (!record)
+        return false;
+
+    assert((record.size <= size) && "Data buffer size should not be less than the dequeued record size!");
+    size = (record.size < size) ? record.size : size;
+    memcpy(data, record.data, size);
+    Release(record);
+
+    return true;
+}
+
+inline void MPMCRingBuffer::Reclaim() noexcept
+{
+    // Releases and claims are sequentially consistent with the tail checks,
+    // so the last releaser or claimer always sees the whole released prefix
+    for (;;)
+    {
+        const size_t tail = _tail.load();
+        Header& record = header(tail);
+        uint64_t sequence = std::atomic_ref<uint64_t>(record.sequence).load();
+        if ((sequence & ~(uint64_t)MASK) != tail)
+            return;
+
+        // Padding is reclaimed only after consumers have passed it
+        const uint64_t state = sequence & MASK;
+        if ((state != RELEASED) && ((state != PADDING) || (_claim.load() <= tail)))
+            return;
+
+        // Only one thread wins the record at the tail, positions are unique, so a stale tail never wins
+        const uint64_t length = std::atomic_ref<uint64_t>(record.extent).load(std::memory_order_relaxed) >> 32;
+        if (!std::atomic_ref<uint64_t>(record.sequence).compare_exchange_strong(sequence, 0))
+            return;
+
+        // Clear the header and pass the record
+        std::atomic_ref<uint64_t>(record.extent).store(0, std::memory_order_relaxed);
+        _tail.store(tail + length);
+    }
+}
+
+} // namespace CppCommon
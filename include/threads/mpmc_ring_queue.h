@@ -9,14 +9,29 @@
 #ifndef CPPCOMMON_THREADS_MPMC_RING_QUEUE_H
 #define CPPCOMMON_THREADS_MPMC_RING_QUEUE_H
 
+#include "threads/instrumentation.h"
+
+#include <algorithm>
 #include <atomic>
 #include <cassert>
 #include <cstdio>
+#include <cstdlib>
 #include <cstring>
+#include <iterator>
+#include <new>
+#include <type_traits>
 #include <utility>
 
 namespace CppCommon {
 
+//! Multiple producers / multiple consumers ring queue slots layout
+enum class MPMCRingQueueLayout
+{
+    COMPACT,    //!< Slots are packed one by one, neighbour slots share cache lines (smallest memory footprint)
+    PADDED,     //!< Each slot is aligned to its own cache line (no false sharing, largest memory footprint)
+    REMAPPED    //!< Slots are packed, but consecutive sequences are remapped to slots of different cache lines
+};
+
 //! Multiple producers / multiple consumers wait-free ring queue
 /*!
     Multiple producers / multiple consumers wait-free ring queue use only atomic operations to provide thread-safe
@@ -24,12 +39,29 @@ namespace CppCommon {
 
     FIFO order is guaranteed!
 
+    With the compact slots layout neighbour slots share cache lines, so concurrent
+    producers and consumers working with consecutive sequences contend on the same
+    cache lines (false sharing). Padded layout aligns each slot to its own cache
+    line. Remapped layout keeps slots packed, but spreads consecutive sequences
+    over different cache lines by transposing the slot index.
+
+    Slots are constructed lazily: items are constructed in place of the slot on
+    enqueue and destroyed on dequeue, so the ring queue does not require default
+    constructible items and does not construct or touch slots on creation (slot
+    storage is zero initialized by the system on the first access). Use Emplace()
+    and Consume() to construct and process large items in place of the slot
+    without intermediate copies.
+
+    With CPPCOMMON_INSTRUMENTATION definition the ring queue counts rejected
+    enqueues (full), rejected dequeues (empty) and lost slot claims (contended)
+    (see InstrumentationRegistry).
+
     Thread-safe.
 
     C++ implementation of Dmitry Vyukov's non-intrusive lock free unbound MPSC queue
     http://www.1024cores.net/home/lock-free-algorithms/queues/non-intrusive-mpsc-node-based-queue
 */
-template<typename T>
+template<typename T, MPMCRingQueueLayout layout = MPMCRingQueueLayout::COMPACT>
 class MPMCRingQueue
 {
 public:
@@ -40,7 +72,7 @@ public:
     explicit MPMCRingQueue(size_t capacity);
     MPMCRingQueue(const MPMCRingQueue&) = delete;
     MPMCRingQueue(MPMCRingQueue&&) = delete;
-    ~MPMCRingQueue() { delete[] _buffer; }
+    ~MPMCRingQueue();
 
     MPMCRingQueue& operator=(const MPMCRingQueue&) = delete;
     MPMCRingQueue& operator=(MPMCRingQueue&&) = delete;
@@ -75,6 +107,18 @@ public:
         \return 'true' if the item was successfully enqueue, 'false' if the ring queue is full
     */
     bool Enqueue(T&& item);
+    //! Enqueue an item constructed in place of the slot from the given arguments (multiple producers threads method)
+    /*!
+        Item construction should not throw, because the claimed slot could not
+        be returned to the ring queue.
+
+        Will not block.
+
+        \param args - Item constructor arguments
+        \return 'true' if the item was successfully enqueue, 'false' if the ring queue is full
+    */
+    template <typename... Args>
+    bool Emplace(Args&&... args);
 
     //! Dequeue an item from the ring queue (multiple consumers threads method)
     /*!
@@ -86,26 +130,101 @@ public:
         \return 'true' if the item was successfully dequeue, 'false' if the ring queue is empty
     */
     bool Dequeue(T& item);
+    //! Dequeue an item from the ring queue and process it in place of the slot (multiple consumers threads method)
+    /*!
+        The handler is called with a reference to the item in the slot, then the
+        item is destroyed and the slot is returned to producers. The slot is not
+        available for producers while the handler is running, so keep it short.
+
+        Will not block.
+
+        \param handler - Item handler with the signature 'void(T&)'
+        \return 'true' if the item was successfully dequeue, 'false' if the ring queue is empty
+    */
+    template <class THandler>
+    bool Consume(THandler&& handler);
+
+    //! Enqueue a batch of items into the ring queue (multiple producers threads method)
+    /*!
+        Items will be copied into the ring queue (use std::move_iterator to move them).
+        Contiguous range of free slots is claimed with a single atomic operation, so
+        the whole batch costs the same synchronization as a single item.
+
+        Will not block.
+
+        \param first - Iterator to the first item to enqueue
+        \param last - Iterator to the end of items to enqueue
+        \return Count of enqueued items from the beginning of the given range (less than the range size if the ring queue is full)
+    */
+    template <class TIterator>
+    size_t EnqueueBulk(TIterator first, TIterator last);
+
+    //! Dequeue a batch of items from the ring queue (multiple consumers threads method)
+    /*!
+        Items will be moved from the ring queue into the output iterator.
+        Contiguous range of ready slots is claimed with a single atomic operation.
+
+        Will not block.
+
+        \param output - Output iterator
+        \param max - Max count of items to dequeue
+        \return Count of dequeued items (zero if the ring queue is empty)
+    */
+    template <class TOutputIterator>
+    size_t DequeueBulk(TOutputIterator output, size_t max);
 
 private:
-    struct Node
+    // Slot sequences are stored relative to the slot index, so the zero
+    // initialized slot storage is the initial state of the ring queue
+    struct CompactNode
     {
         std::atomic<size_t> sequence;
-        T value;
+        alignas(T) unsigned char storage[sizeof(T)];
+
+        T& value() noexcept { return *std::launder(reinterpret_cast<T*>(storage)); }
     };
 
+    struct alignas(128) PaddedNode
+    {
+        std::atomic<size_t> sequence;
+        alignas(T) unsigned char storage[sizeof(T)];
+
+        T& value() noexcept { return *std::launder(reinterpret_cast<T*>(storage)); }
+    };
+
+    typedef typename std::conditional<layout == MPMCRingQueueLayout::PADDED, PaddedNode, CompactNode>::type Node;
+
     typedef char cache_line_pad[128];
 
     cache_line_pad _pad0;
     const size_t _capacity;
     const size_t _mask;
+    void* const _memory;
     Node* const _buffer;
+    size_t _remap_lines_shift;
+    size_t _remap_slots_shift;
 
     cache_line_pad _pad1;
     std::atomic<size_t> _head;
     cache_line_pad _pad2;
     std::atomic<size_t> _tail;
     cache_line_pad _pad3;
+
+#if defined(CPPCOMMON_INSTRUMENTATION)
+    InstrumentationCounters _instrumentation{"MPMCRingQueue"};
+#endif
+
+    //! Get the slot index of the given sequence
+    size_t Index(size_t sequence) const noexcept;
+    //! Load the sequence of the slot with the given sequence
+    size_t Load(Node* node, size_t sequence) const noexcept
+    { return node->sequence.load(std::memory_order_acquire) + (sequence & _mask); }
+    //! Store the sequence of the slot with the given sequence
+    void Store(Node* node, size_t sequence, size_t value) noexcept
+    { node->sequence.store(value - (sequence & _mask), std::memory_order_release); }
+
+    //! Allocate the zero initialized slots storage
+    static void* Allocate(size_t capacity);
 };
 
 /*! \example threads_mpmc_ring_queue.cpp Multiple producers / multiple consumers wait-free ring queue example */
@@ -8,8 +8,8 @@
 
 namespace CppCommon {
 
-template<typename T>
-inline MPMCRingQueue<T>::MPMCRingQueue(size_t capacity) : _capacity(capacity), _mask(capacity - 1), _buffer(new Node[capacity]), _head(0), _tail(0)
+template<typename T, MPMCRingQueueLayout layout>
+inline MPMCRingQueue<T, layout>::MPMCRingQueue(size_t capacity) : _capacity(capacity), _mask(capacity - 1), _memory(Allocate(capacity)), _buffer((Node*)(((uintptr_t)_memory + alignof(Node) - 1) & ~(uintptr_t)(alignof(Node) - 1))), _remap_lines_shift(0), _remap_slots_shift(0), _head(0), _tail(0)
 {
     assert((capacity > 1) && "Ring queue capacity must be greater than one!");
     assert(((capacity & (capacity - 1)) == 0) && "Ring queue capacity must be a power of two!");
@@ -19,13 +19,57 @@ inline MPMCRingQueue<T>::MPMCRingQueue(size_t capacity) : _capacity(capacity), _
     memset(_pad2, 0, sizeof(cache_line_pad));
     memset(_pad3, 0, sizeof(cache_line_pad));
 
-    // Populate the sequence initial values
-    for (size_t i = 0; i < capacity; ++i)
-        _buffer[i].sequence.store(i, std::memory_order_relaxed);
+    if (layout == MPMCRingQueueLayout::REMAPPED)
+    {
+        // Calculate the count of slots in a single cache line (power of two)
+        while (((sizeof(Node) << (_remap_slots_shift + 1)) <= sizeof(cache_line_pad)) && (((size_t)2 << _remap_slots_shift) <= capacity))
+            ++_remap_slots_shift;
+
+        // Consecutive sequences are spread over all cache lines
+        while (((size_t)1 << (_remap_lines_shift + _remap_slots_shift)) < capacity)
+            ++_remap_lines_shift;
+    }
 }
 
-template<typename T>
-inline size_t MPMCRingQueue<T>::size() const noexcept
+template<typename T, MPMCRingQueueLayout layout>
+inline MPMCRingQueue<T, layout>::~MPMCRingQueue()
+{
+    // Destroy items which are still in the ring queue
+    if constexpr (!std::is_trivially_destructible<T>::value)
+    {
+        const size_t head = _head.load(std::memory_order_acquire);
+        for (size_t tail = _tail.load(std::memory_order_acquire); tail != head; ++tail)
+            _buffer[Index(tail)].value().~T();
+    }
+
+    std::free(_memory);
+}
+
+template<typename T, MPMCRingQueueLayout layout>
+inline void* MPMCRingQueue<T, layout>::Allocate(size_t capacity)
+{
+    // Large zero initialized blocks are mapped by the system lazily on the first access
+    void* memory = std::calloc(capacity * sizeof(Node) + alignof(Node), 1);
+    if (memory == nullptr)
+        throw std::bad_alloc();
+    return memory;
+}
+
+template<typename T, MPMCRingQueueLayout layout>
+inline size_t MPMCRingQueue<T, layout>::Index(size_t sequence) const noexcept
+{
+    if constexpr (layout == MPMCRingQueueLayout::REMAPPED)
+    {
+        // Transpose the slot index: low bits select the cache line and high bits select the slot in the cache line
+        const size_t index = sequence & _mask;
+        return ((index & (((size_t)1 << _remap_lines_shift) - 1)) << _remap_slots_shift) | (index >> _remap_lines_shift);
+    }
+    else
+        return sequence & _mask;
+}
+
+template<typename T, MPMCRingQueueLayout layout>
+inline size_t MPMCRingQueue<T, layout>::size() const noexcept
 {
     const size_t head = _head.load(std::memory_order_acquire);
     const size_t tail = _tail.load(std::memory_order_acquire);
@@ -33,22 +77,28 @@ inline size_t MPMCRingQueue<T>::size() const noexcept
     return head - tail;
 }
 
-template<typename T>
-inline bool MPMCRingQueue<T>::Enqueue(const T& item)
+template<typename T, MPMCRingQueueLayout layout>
+inline bool MPMCRingQueue<T, layout>::Enqueue(const T& item)
 {
-    T temp = item;
-    return Enqueue(std::forward<T>(temp));
+    return Emplace(item);
 }
 
-template<typename T>
-inline bool MPMCRingQueue<T>::Enqueue(T&& item)
+template<typename T, MPMCRingQueueLayout layout>
+inline bool MPMCRingQueue<T, layout>::Enqueue(T&& item)
+{
+    return Emplace(std::move(item));
+}
+
+template<typename T, MPMCRingQueueLayout layout>
+template <typename... Args>
+inline bool MPMCRingQueue<T, layout>::Emplace(Args&&... args)
 {
     size_t head_sequence = _head.load(std::memory_order_relaxed);
 
     for (;;)
     {
-        Node* node = &_buffer[head_sequence & _mask];
-        size_t node_sequence = node->sequence.load(std::memory_order_acquire);
+        Node* node = &_buffer[Index(head_sequence)];
+        size_t node_sequence = Load(node, head_sequence);
 
         // If node sequence and head sequence are the same then it means this slot is empty
         int64_t diff = (int64_t)node_sequence - (int64_t)head_sequence;
@@ -60,18 +110,21 @@ inline bool MPMCRingQueue<T>::Enqueue(T&& item)
             // results which in this instance is OK, because it's in the loop
             if (_head.compare_exchange_weak(head_sequence, head_sequence + 1, std::memory_order_relaxed))
             {
-                // Store the item value
-                node->value = std::move(item);
+                // Construct the item in place of the slot
+                new (node->storage) T(std::forward<Args>(args)...);
 
                 // Increment the sequence so that the tail knows it's accessible
-                node->sequence.store(head_sequence + 1, std::memory_order_release);
+                Store(node, head_sequence, head_sequence + 1);
                 return true;
             }
+
+            CPPCOMMON_INSTRUMENT(_instrumentation, CONTENDED, 1);
         }
         else if (diff < 0)
         {
             // If node sequence is less than head sequence then it means this slot is full
             // and therefore buffer is full
+            CPPCOMMON_INSTRUMENT(_instrumentation, FULL, 1);
             return false;
         }
         else
@@ -85,15 +138,65 @@ inline bool MPMCRingQueue<T>::Enqueue(T&& item)
     return false;
 }
 
-template<typename T>
-inline bool MPMCRingQueue<T>::Dequeue(T& item)
+template<typename T, MPMCRingQueueLayout layout>
+inline bool MPMCRingQueue<T, layout>::Dequeue(T& item)
+{
+    size_t tail_sequence = _tail.load(std::memory_order_relaxed);
+
+    for (;;)
+    {
+        Node* node = &_buffer[Index(tail_sequence)];
+        size_t node_sequence = Load(node, tail_sequence);
+
+        // If node sequence and head sequence are the same then it means this slot is empty
+        int64_t diff = (int64_t)node_sequence - (int64_t)(tail_sequence + 1);
+        if (diff == 0)
+        {
+            // Claim our spot by moving head. If head isn't the same
+            // as we last checked then that means someone beat us to
+            // the punch weak compare is faster, but can return spurious
+            // results which in this instance is OK, because it's in the loop
+            if (_tail.compare_exchange_weak(tail_sequence, tail_sequence + 1, std::memory_order_relaxed))
+            {
+                // Get the item value and destroy the item in the slot
+                T& value = node->value();
+                item = std::move(value);
+                value.~T();
+
+                // Set the sequence to what the head sequence should be next time around
+                Store(node, tail_sequence, tail_sequence + _mask + 1);
+                return true;
+            }
+
+            CPPCOMMON_INSTRUMENT(_instrumentation, CONTENDED, 1);
+        }
+        else if (diff < 0)
+        {
+            // If seq is less than head seq then it means this slot is full and therefore the buffer is full
+            CPPCOMMON_INSTRUMENT(_instrumentation, EMPTY, 1);
+            return false;
+        }
+        else
+        {
+            // Under normal circumstances this branch should never be taken
+            tail_sequence = _tail.load(std::memory_order_relaxed);
+        }
+    }
+
+    // Never happens...
+    return false;
+}
+
+template<typename T, MPMCRingQueueLayout layout>
+template <class THandler>
+inline bool MPMCRingQueue<T, layout>::Consume(THandler&& handler)
 {
     size_t tail_sequence = _tail.load(std::memory_order_relaxed);
 
     for (;;)
     {
-        Node* node = &_buffer[tail_sequence & _mask];
-        size_t node_sequence = node->sequence.load(std::memory_order_acquire);
+        Node* node = &_buffer[Index(tail_sequence)];
+        size_t node_sequence = Load(node, tail_sequence);
 
         // If node sequence and head sequence are the same then it means this slot is empty
         int64_t diff = (int64_t)node_sequence - (int64_t)(tail_sequence + 1);
@@ -105,17 +208,31 @@ inline bool MPMCRingQueue<T>::Dequeue(T& item)
             // results which in this instance is OK, because it's in the loop
             if (_tail.compare_exchange_weak(tail_sequence, tail_sequence + 1, std::memory_order_relaxed))
             {
-                // Get the item value
-                item = std::move(node->value);
+                // Process the item in place of the slot and destroy it, the slot is returned to producers even if the handler throws
+                T& value = node->value();
+                try
+                {
+                    handler(value);
+                }
+                catch (...)
+                {
+                    value.~T();
+                    Store(node, tail_sequence, tail_sequence + _mask + 1);
+                    throw;
+                }
+                value.~T();
 
                 // Set the sequence to what the head sequence should be next time around
-                node->sequence.store(tail_sequence + _mask + 1, std::memory_order_release);
+                Store(node, tail_sequence, tail_sequence + _mask + 1);
                 return true;
             }
+
+            CPPCOMMON_INSTRUMENT(_instrumentation, CONTENDED, 1);
         }
         else if (diff < 0)
         {
             // If seq is less than head seq then it means this slot is full and therefore the buffer is full
+            CPPCOMMON_INSTRUMENT(_instrumentation, EMPTY, 1);
             return false;
         }
         else
@@ -129,4 +246,124 @@ inline bool MPMCRingQueue<T>::Dequeue(T& item)
     return false;
 }
 
+template<typename T, MPMCRingQueueLayout layout>
+template <class TIterator>
+inline size_t MPMCRingQueue<T, layout>::EnqueueBulk(TIterator first, TIterator last)
+{
+    const size_t max = std::min((size_t)std::distance(first, last), _capacity);
+    if (max == 0)
+        return 0;
+
+    size_t head_sequence = _head.load(std::memory_order_relaxed);
+
+    for (;;)
+    {
+        // Count the contiguous range of empty slots from the head
+        size_t count = 0;
+        while (count < max)
+        {
+            Node* node = &_buffer[Index(head_sequence + count)];
+            if (Load(node, head_sequence + count) != (head_sequence + count))
+                break;
+            ++count;
+        }
+
+        if (count == 0)
+        {
+            Node* node = &_buffer[Index(head_sequence)];
+            int64_t diff = (int64_t)Load(node, head_sequence) - (int64_t)head_sequence;
+
+            // If node sequence is less than head sequence then it means the buffer is full
+            if (diff < 0)
+            {
+                CPPCOMMON_INSTRUMENT(_instrumentation, FULL, 1);
+                return 0;
+            }
+
+            // Otherwise the head is outdated
+            head_sequence = _head.load(std::memory_order_relaxed);
+            continue;
+        }
+
+        // Claim the whole range of slots by moving head once
+        if (_head.compare_exchange_weak(head_sequence, head_sequence + count, std::memory_order_relaxed))
+        {
+            for (size_t i = 0; i < count; ++i, ++first)
+            {
+                Node* node = &_buffer[Index(head_sequence + i)];
+
+                // Construct the item in place of the slot
+                new (node->storage) T(*first);
+
+                // Increment the sequence so that the tail knows it's accessible
+                Store(node, head_sequence + i, head_sequence + i + 1);
+            }
+            return count;
+        }
+
+        CPPCOMMON_INSTRUMENT(_instrumentation, CONTENDED, 1);
+    }
+}
+
+template<typename T, MPMCRingQueueLayout layout>
+template <class TOutputIterator>
+inline size_t MPMCRingQueue<T, layout>::DequeueBulk(TOutputIterator output, size_t max)
+{
+    max = std::min(max, _capacity);
+    if (max == 0)
+        return 0;
+
+    size_t tail_sequence = _tail.load(std::memory_order_relaxed);
+
+    for (;;)
+    {
+        // Count the contiguous range of ready slots from the tail
+        size_t count = 0;
+        while (count < max)
+        {
+            Node* node = &_buffer[Index(tail_sequence + count)];
+            if (Load(node, tail_sequence + count) != (tail_sequence + count + 1))
+                break;
+            ++count;
+        }
+
+        if (count == 0)
+        {
+            Node* node = &_buffer[Index(tail_sequence)];
+            int64_t diff = (int64_t)Load(node, tail_sequence) - (int64_t)(tail_sequence + 1);
+
+            // If node sequence is less than tail sequence then it means the buffer is empty
+            if (diff < 0)
+            {
+                CPPCOMMON_INSTRUMENT(_instrumentation, EMPTY, 1);
+                return 0;
+            }
+
+            // Otherwise the tail is outdated
+            tail_sequence = _tail.load(std::memory_order_relaxed);
+            continue;
+        }
+
+        // Claim the whole range of slots by moving tail once
+        if (_tail.compare_exchange_weak(tail_sequence, tail_sequence + count, std::memory_order_relaxed))
+        {
+            for (size_t i = 0; i < count; ++i)
+            {
+                Node* node = &_buffer[Index(tail_sequence + i)];
+
+                // Get the item value and destroy the item in the slot
+                T& value = node->value();
+                *output++ = std::move(value);
+                value.~T();
+
+                // Set the sequence to what the head sequence should be next time around
+                Store(node, tail_sequence + i, tail_sequence + i + _mask + 1);
+            }
+            return count;
+        }
+
+        CPPCOMMON_INSTRUMENT(_instrumentation, CONTENDED, 1);
+    }
+}
+
 } // namespace CppCommon
@@ -11,11 +11,71 @@
 
 #include <atomic>
 #include <cassert>
-#include <functional>
 #include <utility>
 
 namespace CppCommon {
 
+//! Multiple producers / single consumer wait-free intrusive linked batcher
+/*!
+    Multiple producers / single consumer wait-free intrusive linked batcher use only atomic operations to provide
+    thread-safe enqueue and batch dequeue operations. In contrast to the linked batcher it does not allocate memory:
+    callers supply nodes embedded into their own items (T must inherit MPSCIntrusiveBatcher<T>::Node), so the batch
+    hand-off is allocation-free. Batcher does not own items, each enqueued item must stay alive until it is handled.
+
+    FIFO order is guaranteed!
+
+    Thread-safe.
+*/
+template<typename T>
+class MPSCIntrusiveBatcher
+{
+public:
+    //! Intrusive batcher node
+    struct Node
+    {
+        T* next;    //!< Pointer to the next batcher node
+
+        Node() : next(nullptr) {}
+    };
+
+    MPSCIntrusiveBatcher() : _head(nullptr) {}
+    MPSCIntrusiveBatcher(const MPSCIntrusiveBatcher&) = delete;
+    MPSCIntrusiveBatcher(MPSCIntrusiveBatcher&&) = delete;
+    ~MPSCIntrusiveBatcher() = default;
+
+    MPSCIntrusiveBatcher& operator=(const MPSCIntrusiveBatcher&) = delete;
+    MPSCIntrusiveBatcher& operator=(MPSCIntrusiveBatcher&&) = delete;
+
+    //! Is intrusive batcher empty?
+    bool empty() const noexcept { return (_head.load(std::memory_order_acquire) == nullptr); }
+
+    //! Enqueue an item into the intrusive batcher (multiple producers threads method)
+    /*!
+        The item will be linked into the intrusive batcher without copy.
+
+        Will not block.
+
+        \param item - Item to enqueue
+    */
+    void Enqueue(T& item) noexcept;
+
+    //! Dequeue all items from the intrusive batcher (single consumer thread method)
+    /*!
+        All items in the batcher will be processed by the given handler in FIFO order.
+        Handler is called as handler(T& item) and may destroy or enqueue the item again.
+
+        Will not block.
+
+        \param handler - Batch handler
+        \return 'true' if all items were successfully handled, 'false' if the intrusive batcher is empty
+    */
+    template <class THandler>
+    bool Dequeue(THandler&& handler);
+
+private:
+    std::atomic<T*> _head;
+};
+
 //! Multiple producers / single consumer wait-free linked batcher
 /*!
     Multiple producers / single consumer wait-free linked batcher use only atomic operations to provide thread-safe
@@ -62,25 +122,38 @@ public:
     */
     bool Enqueue(T&& item);
 
+    //! Dequeue all items from the linked queue (single consumer thread method)
+    /*!
+        All items in the batcher will be dropped.
+
+        Will not block.
+
+        \return 'true' if all items were successfully handled, 'false' if the linked batcher is empty
+    */
+    bool Dequeue() { return Dequeue([](const T&){}); }
     //! Dequeue all items from the linked queue (single consumer thread method)
     /*!
         All items in the batcher will be processed by the given handler.
+        Handler is called as handler(const T& item).
 
         Will not block.
 
-        \param handler - Batch handler (default is empty handler)
+        \param handler - Batch handler
         \return 'true' if all items were successfully handled, 'false' if the linked batcher is empty
     */
-    bool Dequeue(const std::function<void(const T&)>& handler = [](const int&){});
+    template <class THandler>
+    bool Dequeue(THandler&& handler);
 
 private:
-    struct Node
+    struct Node : public MPSCIntrusiveBatcher<Node>::Node
     {
-        Node* next;
         T value;
+
+        template <class... Args>
+        explicit Node(Args&&... args) : value(std::forward<Args>(args)...) {}
     };
 
-    std::atomic<Node*> _head;
+    MPSCIntrusiveBatcher<Node> _batcher;
 };
 
 } // namespace CppCommon
@@ -9,61 +9,32 @@
 namespace CppCommon {
 
 template<typename T>
-inline MPSCLinkedBatcher<T>::MPSCLinkedBatcher() : _head(nullptr)
+inline void MPSCIntrusiveBatcher<T>::Enqueue(T& item) noexcept
 {
-}
-
-template<typename T>
-inline MPSCLinkedBatcher<T>::~MPSCLinkedBatcher()
-{
-    // Remove all nodes from the linked batcher
-    Dequeue([](const T&){});
-}
-
-template<typename T>
-inline bool MPSCLinkedBatcher<T>::Enqueue(const T& item)
-{
-    T temp = item;
-    return Enqueue(std::forward<T>(temp));
-}
-
-template<typename T>
-inline bool MPSCLinkedBatcher<T>::Enqueue(T&& item)
-{
-    // Create new head node
-    Node* node = new Node;
-    if (node == nullptr)
-        return false;
-
-    // Fill new head node with the given value
-    node->value = std::move(item);
-
     // Insert new head node into the batcher and linked it with the previous one
-    Node* prev_head = _head.load(std::memory_order_relaxed);
+    T* node = &item;
+    T* prev_head = _head.load(std::memory_order_relaxed);
     do
     {
         node->next = prev_head;
     } while (!_head.compare_exchange_weak(prev_head, node, std::memory_order_release));
-
-    return true;
 }
 
 template<typename T>
-inline bool MPSCLinkedBatcher<T>::Dequeue(const std::function<void(const T&)>& handler)
+template <class THandler>
+inline bool MPSCIntrusiveBatcher<T>::Dequeue(THandler&& handler)
 {
-    assert((handler) && "Batch handler must be valid!");
+    T* last = _head.exchange(nullptr, std::memory_order_acq_rel);
+    T* first = nullptr;
 
-    Node* last = _head.exchange(nullptr, std::memory_order_acq_rel);
-    Node* first = nullptr;
-
-    // Check if the linked batcher is empty
+    // Check if the intrusive batcher is empty
     if (last == nullptr)
         return false;
 
     // Reverse the order to get nodes in FIFO order
     do
     {
-        Node* temp = last;
+        T* temp = last;
         last = last->next;
         temp->next = first;
         first = temp;
@@ -72,14 +43,62 @@ inline bool MPSCLinkedBatcher<T>::Dequeue(const std::function<void(const T&)>& h
     // Process all items in a batch mode
     do
     {
-        Node* temp = first;
+        T* temp = first;
         first = first->next;
+        temp->next = nullptr;
         // Process the item with the given handler
-        handler(temp->value);
-        delete temp;
+        handler(*temp);
     } while (first != nullptr);
 
     return true;
 }
 
+template<typename T>
+inline MPSCLinkedBatcher<T>::MPSCLinkedBatcher()
+{
+}
+
+template<typename T>
+inline MPSCLinkedBatcher<T>::~MPSCLinkedBatcher()
+{
+    // Remove all nodes from the linked batcher
+    Dequeue();
+}
+
+template<typename T>
+inline bool MPSCLinkedBatcher<T>::Enqueue(const T& item)
+{
+    // Create new head node with the copy of the given value
+    Node* node = new Node(item);
+    if (node == nullptr)
+        return false;
+
+    _batcher.Enqueue(*node);
+    return true;
+}
+
+template<typename T>
+inline bool MPSCLinkedBatcher<T>::Enqueue(T&& item)
+{
+    // Create new head node with the given value
+    Node* node = new Node(std::move(item));
+    if (node == nullptr)
+        return false;
+
+    _batcher.Enqueue(*node);
+    return true;
+}
+
+template<typename T>
+template <class THandler>
+inline bool MPSCLinkedBatcher<T>::Dequeue(THandler&& handler)
+{
+    return _batcher.Dequeue([&handler](Node& node)
+    {
+        // Process the item with the given handler
+        handler((const T&)node.value);
+        delete &node;
+    });
+}
+
 } // namespace CppCommon
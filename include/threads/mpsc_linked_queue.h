@@ -9,6 +9,8 @@
 #ifndef CPPCOMMON_THREADS_MPSC_LINKED_QUEUE_H
 #define CPPCOMMON_THREADS_MPSC_LINKED_QUEUE_H
 
+#include "threads/instrumentation.h"
+
 #include <atomic>
 #include <cstring>
 #include <utility>
@@ -23,6 +25,9 @@ namespace CppCommon {
 
     FIFO order is guaranteed!
 
+    With CPPCOMMON_INSTRUMENTATION definition the linked queue counts rejected
+    dequeues (empty) (see InstrumentationRegistry).
+
     Thread-safe.
 
     C++ implementation of Dmitry Vyukov's non-intrusive lock free unbound MPSC queue
@@ -86,6 +91,10 @@ private:
     cache_line_pad _pad1;
     std::atomic<Node*> _tail;
     cache_line_pad _pad2;
+
+#if defined(CPPCOMMON_INSTRUMENTATION)
+    InstrumentationCounters _instrumentation{"MPSCLinkedQueue"};
+#endif
 };
 
 /*! \example threads_mpsc_linked_queue.cpp Multiple producers / single consumer wait-free linked queue example */
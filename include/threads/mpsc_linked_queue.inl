@@ -66,7 +66,10 @@ inline bool MPSCLinkedQueue<T>::Dequeue(T& item)
 
     // Check if the linked queue is empty
     if (next == nullptr)
+    {
+        CPPCOMMON_INSTRUMENT(_instrumentation, EMPTY, 1);
         return false;
+    }
 
     // Get the item value
     item = std::move(next->value);
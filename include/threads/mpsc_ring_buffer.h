@@ -15,6 +15,7 @@
 
 #include <cstdio>
 #include <memory>
+#include <span>
 #include <thread>
 #include <vector>
 
@@ -85,6 +86,62 @@ public:
     */
     bool Dequeue(void* data, size_t& size);
 
+    //! Reserved region of the ring buffer
+    struct Reservation
+    {
+        std::span<uint8_t> data;    //!< Reserved region (empty if the ring buffer is full)
+        size_t producer;            //!< Producer index
+
+        //! Check if the region is reserved
+        explicit operator bool() const noexcept { return !data.empty(); }
+    };
+
+    //! Reserve a contiguous region in the ring buffer to write a data in place (multiple producers threads method)
+    /*!
+        The chosen producer's ring buffer stays locked until the reservation is
+        committed, so commit it as soon as possible and from the same thread.
+
+        Reserved size must not be greater than half of the ring buffer capacity!
+
+        Will not block.
+
+        \param size - Reserved region size
+        \return Reservation of the region which evaluates to 'false' if the ring buffer is full
+    */
+    Reservation Reserve(size_t size);
+    //! Commit the given count of bytes of the reserved region (multiple producers threads method)
+    /*!
+        Will not block.
+
+        \param reservation - Reservation of the region
+        \param size - Committed size (must not be greater than the reserved size)
+    */
+    void Commit(const Reservation& reservation, size_t size);
+    //! Commit the whole reserved region (multiple producers threads method)
+    /*!
+        \param reservation - Reservation of the region
+    */
+    void Commit(const Reservation& reservation) { Commit(reservation, reservation.data.size()); }
+
+    //! Peek a contiguous region of the data in the ring buffer to read it in place (single consumer thread method)
+    /*!
+        Peeked region belongs to one of producers' ring buffers and contains every
+        region written with Reserve() as a whole. Release the peeked region before
+        the next peek.
+
+        Will not block.
+
+        \return Span of the peeked region or an empty span if the ring buffer is empty
+    */
+    std::span<const uint8_t> Peek();
+    //! Release the given count of bytes of the peeked region (single consumer thread method)
+    /*!
+        Will not block.
+
+        \param size - Released size (must not be greater than the peeked size)
+    */
+    void Release(size_t size);
+
 private:
     struct Producer
     {
@@ -98,6 +155,7 @@ private:
     size_t _concurrency;
     std::vector<std::shared_ptr<Producer>> _producers;
     size_t _consumer;
+    size_t _peeked;
 };
 
 /*! \example threads_mpsc_ring_buffer.cpp Multiple producers / single consumer wait-free ring buffer example */
@@ -8,7 +8,7 @@
 
 namespace CppCommon {
 
-inline MPSCRingBuffer::MPSCRingBuffer(size_t capacity, size_t concurrency) : _capacity(capacity - 1), _concurrency(concurrency), _consumer(0)
+inline MPSCRingBuffer::MPSCRingBuffer(size_t capacity, size_t concurrency) : _capacity(capacity - 1), _concurrency(concurrency), _consumer(0), _peeked(0)
 {
     // Initialize producers' ring buffer
     for (size_t i = 0; i < concurrency; ++i)
@@ -52,4 +52,53 @@ inline bool MPSCRingBuffer::Dequeue(void* data, size_t& size)
     return false;
 }
 
+inline MPSCRingBuffer::Reservation MPSCRingBuffer::Reserve(size_t size)
+{
+    // Get producer index for the current thread based on RDTS value
+    size_t index = Timestamp::rdts() % _concurrency;
+
+    // Lock the chosen producer using its spin-lock until the reservation is committed
+    _producers[index]->lock.Lock();
+
+    // Reserve the region in the producer's ring buffer
+    std::span<uint8_t> data = _producers[index]->buffer.Reserve(size);
+    if (data.empty())
+        _producers[index]->lock.Unlock();
+
+    return Reservation{ data, index };
+}
+
+inline void MPSCRingBuffer::Commit(const Reservation& reservation, size_t size)
+{
+    assert(reservation && "Reservation should be valid!");
+    if (!reservation)
+        return;
+
+    // Commit the region in the producer's ring buffer and unlock the producer
+    _producers[reservation.producer]->buffer.Commit(size);
+    _producers[reservation.producer]->lock.Unlock();
+}
+
+inline std::span<const uint8_t> MPSCRingBuffer::Peek()
+{
+    // Try to peek the region from the one of producer's ring buffers
+    for (size_t i = 0; i < _concurrency; ++i)
+    {
+        size_t index = _consumer++ % _concurrency;
+        std::span<const uint8_t> data = _producers[index]->buffer.Peek();
+        if (!data.empty())
+        {
+            _peeked = index;
+            return data;
+        }
+    }
+
+    return std::span<const uint8_t>();
+}
+
+inline void MPSCRingBuffer::Release(size_t size)
+{
+    _producers[_peeked]->buffer.Release(size);
+}
+
 } // namespace CppCommon
@@ -0,0 +1,101 @@
+/*!
+    \file per_cpu.h
+    \brief Per-CPU data definition
+    \author Ivan Shynkarenka
+    \date 15.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_PER_CPU_H
+#define CPPCOMMON_THREADS_PER_CPU_H
+
+#include "utility/cache_aligned.h"
+
+#include <cstdint>
+#include <memory>
+
+namespace CppCommon {
+
+//! Per-CPU data
+/*!
+    Per-CPU data keeps a cache aligned slot of the given type for each CPU.
+    Threads access the slot of the CPU they are running on, so concurrent
+    updates from different CPUs never touch the same cache line and scale
+    with cores, while reads combine all slots.
+
+    The current CPU is taken from the restartable sequences area (rseq) of
+    the thread on Linux, which is a plain memory read, with sched_getcpu()
+    and GetCurrentProcessorNumberEx() fallbacks. Platforms without current
+    CPU query (macOS) use the dense thread index instead.
+
+    The thread could migrate to another CPU right after the slot selection,
+    so slots are shared between threads and must be updated with atomic
+    operations (or other synchronization) of the slot type.
+
+    Thread-safe.
+*/
+template <typename T>
+class PerCpu
+{
+public:
+    //! Initialize per-CPU data
+    /*!
+        \param slots - Slots count (will be rounded up to the power of two, default is 0 - CPU::LogicalCores())
+    */
+    explicit PerCpu(size_t slots = 0);
+    PerCpu(const PerCpu&) = delete;
+    PerCpu(PerCpu&&) = delete;
+    ~PerCpu() = default;
+
+    PerCpu& operator=(const PerCpu&) = delete;
+    PerCpu& operator=(PerCpu&&) = delete;
+
+    //! Access the slot by the given index
+    T& operator[](size_t index) noexcept { return *_slots[index & _mask]; }
+    const T& operator[](size_t index) const noexcept { return *_slots[index & _mask]; }
+
+    //! Get slots count
+    size_t slots() const noexcept { return _mask + 1; }
+
+    //! Get the slot of the current CPU
+    T& local() noexcept { return *_slots[CurrentSlot() & _mask]; }
+    const T& local() const noexcept { return *_slots[CurrentSlot() & _mask]; }
+
+    //! Visit all slots with the given handler
+    /*!
+        \param handler - Slot handler with the signature 'void(T&)'
+    */
+    template <typename THandler>
+    void ForEach(THandler&& handler);
+    template <typename THandler>
+    void ForEach(THandler&& handler) const;
+
+    //! Get the slot index of the current thread
+    /*!
+        \return Current CPU index or the dense thread index if the current CPU is unknown
+    */
+    static uint32_t CurrentSlot() noexcept;
+
+private:
+    size_t _mask;
+    std::unique_ptr<CacheAligned<T>[]> _slots;
+};
+
+//! @cond INTERNALS
+namespace Internals {
+
+//! Get the current CPU index or the dense thread index if the current CPU is unknown
+uint32_t CurrentCpuSlot() noexcept;
+//! Get the default slots count of per-CPU data
+size_t DefaultCpuSlots() noexcept;
+
+} // namespace Internals
+//! @endcond
+
+/*! \example threads_per_cpu.cpp Per-CPU data and sharded counter example */
+
+} // namespace CppCommon
+
+#include "per_cpu.inl"
+
+#endif // CPPCOMMON_THREADS_PER_CPU_H
@@ -0,0 +1,48 @@
+/*!
+    \file per_cpu.inl
+    \brief Per-CPU data inline implementation
+    \author Ivan Shynkarenka
+    \date 15.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+template <typename T>
+inline PerCpu<T>::PerCpu(size_t slots) : _mask(0)
+{
+    if (slots == 0)
+        slots = Internals::DefaultCpuSlots();
+
+    // Round up slots count to the power of two
+    size_t count = 1;
+    while (count < slots)
+        count <<= 1;
+
+    _mask = count - 1;
+    _slots = std::make_unique<CacheAligned<T>[]>(count);
+}
+
+template <typename T>
+template <typename THandler>
+inline void PerCpu<T>::ForEach(THandler&& handler)
+{
+    for (size_t i = 0; i <= _mask; ++i)
+        handler(*_slots[i]);
+}
+
+template <typename T>
+template <typename THandler>
+inline void PerCpu<T>::ForEach(THandler&& handler) const
+{
+    for (size_t i = 0; i <= _mask; ++i)
+        handler(*_slots[i]);
+}
+
+template <typename T>
+inline uint32_t PerCpu<T>::CurrentSlot() noexcept
+{
+    return Internals::CurrentCpuSlot();
+}
+
+} // namespace CppCommon
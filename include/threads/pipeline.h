@@ -0,0 +1,207 @@
+/*!
+    \file pipeline.h
+    \brief Staged threads pipeline definition
+    \author Ivan Shynkarenka
+    \date 15.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_PIPELINE_H
+#define CPPCOMMON_THREADS_PIPELINE_H
+
+#include "system/cpu_set.h"
+#include "threads/spsc_ring_queue.h"
+#include "threads/thread.h"
+#include "threads/wait_strategy.h"
+#include "time/latency_histogram.h"
+
+#include <atomic>
+#include <cassert>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace CppCommon {
+
+//! Staged threads pipeline stage statistics
+struct PipelineStageStatistics
+{
+    std::string name;           //!< Stage name
+    size_t thread;              //!< Index of the pipeline thread which runs the stage
+    uint64_t items;             //!< Count of processed items
+    uint64_t dropped;           //!< Count of items dropped by the stage
+    uint64_t batches;           //!< Count of processed batches
+    Timespan busy;              //!< Total processing time
+    LatencyHistogram latency;   //!< Processing latency per item (averaged over each batch)
+
+    //! Get the stage throughput in items per second of processing time
+    double throughput() const noexcept
+    { return (busy.total() > 0) ? ((double)items * 1000000000.0 / (double)busy.total()) : 0.0; }
+};
+
+//! Staged threads pipeline
+/*!
+    Staged pipeline runs the chain of stages (e.g. "parse -> enrich -> route")
+    over items of the same type in dedicated threads pinned to logical
+    processors and connected with single producer / single consumer ring
+    queues. Each thread dequeues the batch of items, runs its stages over
+    the whole batch and enqueues the batch into the next thread.
+
+    When there are more stages than available logical processors adjacent
+    stages are fused into the same thread, so the pipeline never runs more
+    threads than logical processors and fused stages do not pay for the ring
+    queue between them.
+
+    Stage handler is called as handler(T& item) and could return 'false' to
+    drop the item from the pipeline. The last stage is the sink of items.
+
+    Full ring queue blocks the previous thread, so the backpressure is
+    propagated up to the producer. Threads spin, yield and finally park using
+    wait strategies. Stop() drains all enqueued items before threads exit.
+
+    Each stage counts processed items and records its processing latency.
+
+    Enqueue methods must be called from the single producer thread.
+*/
+template <typename T>
+class Pipeline
+{
+public:
+    //! Initialize the staged pipeline
+    /*!
+        \param capacity - Capacity of ring queues between threads (must be a power of two, default is 1024)
+        \param batch - Maximal count of items processed in a single batch (default is 64)
+    */
+    explicit Pipeline(size_t capacity = 1024, size_t batch = 64);
+    Pipeline(const Pipeline&) = delete;
+    Pipeline(Pipeline&&) = delete;
+    ~Pipeline() { Stop(); }
+
+    Pipeline& operator=(const Pipeline&) = delete;
+    Pipeline& operator=(Pipeline&&) = delete;
+
+    //! Is the pipeline started?
+    bool started() const noexcept { return _started; }
+
+    //! Get ring queues capacity
+    size_t capacity() const noexcept { return _capacity; }
+    //! Get the maximal batch size
+    size_t batch() const noexcept { return _batch; }
+    //! Get count of stages
+    size_t stages() const noexcept { return _stages.size(); }
+    //! Get count of running threads
+    size_t threads() const noexcept { return _threads.size(); }
+
+    //! Add a new stage at the end of the pipeline
+    /*!
+        \param name - Stage name
+        \param handler - Stage handler
+        \return Pipeline reference to chain stages
+    */
+    template <class THandler>
+    Pipeline& AddStage(const std::string& name, THandler&& handler);
+
+    //! Start the pipeline threads
+    /*!
+        Threads are pinned to logical processors of the given CPU set one by one
+        and the count of threads is limited by the count of logical processors.
+
+        \param cpus - CPU set to run threads (default is the current thread CPU affinity set)
+        \param pin - Pin threads to logical processors (default is true)
+    */
+    void Start(const CPUSet& cpus = CPUSet(), bool pin = true);
+    //! Stop the pipeline
+    /*!
+        Wait until all enqueued items pass all stages and stop threads.
+
+        Will block.
+    */
+    void Stop();
+
+    //! Enqueue an item into the pipeline (single producer thread method)
+    /*!
+        The item will be copied into the pipeline.
+
+        Will block while the first ring queue is full.
+
+        \param item - Item to enqueue
+        \return 'true' if the item was successfully enqueue, 'false' if the pipeline is not started
+    */
+    bool Enqueue(const T& item);
+    //! Enqueue an item into the pipeline (single producer thread method)
+    /*!
+        The item will be moved into the pipeline.
+
+        Will block while the first ring queue is full.
+
+        \param item - Item to enqueue
+        \return 'true' if the item was successfully enqueue, 'false' if the pipeline is not started
+    */
+    bool Enqueue(T&& item);
+    //! Enqueue a batch of items into the pipeline (single producer thread method)
+    /*!
+        Items will be copied into the pipeline (use std::move_iterator to move them).
+
+        Will block while the first ring queue is full.
+
+        \param first - Iterator to the first item to enqueue
+        \param last - Iterator to the end of items to enqueue
+        \return 'true' if items were successfully enqueue, 'false' if the pipeline is not started
+    */
+    template <class TIterator>
+    bool EnqueueBulk(TIterator first, TIterator last);
+
+    //! Get statistics of all stages
+    std::vector<PipelineStageStatistics> statistics() const;
+
+private:
+    struct Stage
+    {
+        std::string name;
+        std::function<bool(T&)> handler;
+        size_t thread;
+        std::atomic<uint64_t> items;
+        std::atomic<uint64_t> dropped;
+        std::atomic<uint64_t> batches;
+        std::atomic<uint64_t> busy;
+        ConcurrentLatencyHistogram latency;
+
+        Stage(const std::string& stage_name, std::function<bool(T&)>&& stage_handler);
+    };
+
+    struct Channel
+    {
+        SPSCRingQueue<T> queue;
+        WaitStrategy readers;
+        WaitStrategy writers;
+        std::atomic<bool> closed;
+
+        explicit Channel(size_t capacity) : queue(capacity), closed(false) {}
+    };
+
+    const size_t _capacity;
+    const size_t _batch;
+    bool _started;
+    std::vector<std::unique_ptr<Stage>> _stages;
+    // Channel of each thread input
+    std::vector<std::unique_ptr<Channel>> _channels;
+    std::vector<std::thread> _threads;
+
+    //! Run stages of the given range in the given thread
+    void Run(size_t thread, size_t first, size_t last);
+    //! Enqueue items into the given channel and wait while it is full
+    template <class TIterator>
+    static void Push(Channel& channel, TIterator first, TIterator last);
+};
+
+/*! \example threads_pipeline.cpp Staged threads pipeline example */
+
+} // namespace CppCommon
+
+#include "pipeline.inl"
+
+#endif // CPPCOMMON_THREADS_PIPELINE_H
@@ -0,0 +1,234 @@
+/*!
+    \file pipeline.inl
+    \brief Staged threads pipeline inline implementation
+    \author Ivan Shynkarenka
+    \date 15.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+template <typename T>
+inline Pipeline<T>::Stage::Stage(const std::string& stage_name, std::function<bool(T&)>&& stage_handler)
+    : name(stage_name), handler(std::move(stage_handler)), thread(0), items(0), dropped(0), batches(0), busy(0),
+      // Single shard of 2 significant digits up to 1 minute is enough for the single stage thread
+      latency(60000000000ull, 2, 1)
+{
+}
+
+template <typename T>
+inline Pipeline<T>::Pipeline(size_t capacity, size_t batch) : _capacity(capacity), _batch(batch), _started(false)
+{
+    assert((batch > 0) && "Pipeline batch size must be greater than zero!");
+}
+
+template <typename T>
+template <class THandler>
+inline Pipeline<T>& Pipeline<T>::AddStage(const std::string& name, THandler&& handler)
+{
+    assert(!_started && "Pipeline stages must be added before start!");
+
+    if constexpr (std::is_same_v<std::invoke_result_t<THandler&, T&>, bool>)
+        _stages.emplace_back(std::make_unique<Stage>(name, std::function<bool(T&)>(std::forward<THandler>(handler))));
+    else
+        _stages.emplace_back(std::make_unique<Stage>(name, std::function<bool(T&)>([fn = std::forward<THandler>(handler)](T& item) mutable { fn(item); return true; })));
+
+    return *this;
+}
+
+template <typename T>
+inline void Pipeline<T>::Start(const CPUSet& cpus, bool pin)
+{
+    assert(!_started && "Pipeline is already started!");
+    assert(!_stages.empty() && "Pipeline must have at least one stage!");
+
+    std::vector<int> processors = (cpus ? cpus : Thread::GetAffinitySet()).cpus();
+    if (processors.empty())
+        processors.push_back(-1);
+
+    // Fuse adjacent stages when there are more stages than logical processors
+    const size_t threads = std::min(_stages.size(), processors.size());
+    for (size_t i = 0; i < threads; ++i)
+        _channels.emplace_back(std::make_unique<Channel>(_capacity));
+
+    _started = true;
+
+    try
+    {
+        for (size_t i = 0; i < threads; ++i)
+        {
+            const size_t first = i * _stages.size() / threads;
+            const size_t last = (i + 1) * _stages.size() / threads;
+            for (size_t j = first; j < last; ++j)
+                _stages[j]->thread = i;
+
+            _threads.emplace_back(Thread::Start([this, i, first, last]() { Run(i, first, last); }));
+
+            if (pin && (processors[i] >= 0))
+                Thread::SetAffinity(_threads.back(), CPUSet{ processors[i] });
+        }
+    }
+    catch (...)
+    {
+        Stop();
+        throw;
+    }
+}
+
+template <typename T>
+inline void Pipeline<T>::Stop()
+{
+    if (!_started)
+        return;
+
+    // Close the first channel, each thread closes the next one when its input is drained
+    if (!_channels.empty())
+    {
+        _channels.front()->closed.store(true, std::memory_order_release);
+        _channels.front()->readers.Notify();
+    }
+
+    for (auto& thread : _threads)
+        thread.join();
+
+    _threads.clear();
+    _channels.clear();
+    _started = false;
+}
+
+template <typename T>
+inline bool Pipeline<T>::Enqueue(const T& item)
+{
+    const T* ptr = &item;
+    return EnqueueBulk(ptr, ptr + 1);
+}
+
+template <typename T>
+inline bool Pipeline<T>::Enqueue(T&& item)
+{
+    T* ptr = &item;
+    return EnqueueBulk(std::make_move_iterator(ptr), std::make_move_iterator(ptr + 1));
+}
+
+template <typename T>
+template <class TIterator>
+inline bool Pipeline<T>::EnqueueBulk(TIterator first, TIterator last)
+{
+    if (!_started || _channels.empty() || _channels.front()->closed.load(std::memory_order_relaxed))
+        return false;
+
+    Push(*_channels.front(), first, last);
+    return true;
+}
+
+template <typename T>
+template <class TIterator>
+inline void Pipeline<T>::Push(Channel& channel, TIterator first, TIterator last)
+{
+    while (first != last)
+    {
+        size_t count = 0;
+        channel.writers.Wait([&channel, &first, &last, &count]()
+        {
+            count = channel.queue.EnqueueBulk(first, last);
+            return (count > 0);
+        });
+        std::advance(first, count);
+        channel.readers.Notify();
+    }
+}
+
+template <typename T>
+inline void Pipeline<T>::Run(size_t thread, size_t first, size_t last)
+{
+    Channel& input = *_channels[thread];
+    Channel* output = ((thread + 1) < _channels.size()) ? _channels[thread + 1].get() : nullptr;
+
+    std::vector<T> batch;
+    batch.reserve(_batch);
+
+    for (;;)
+    {
+        // Dequeue the batch of items or finish when the closed input is drained
+        size_t count = 0;
+        input.readers.Wait([this, &input, &batch, &count]()
+        {
+            count = input.queue.DequeueBulk(std::back_inserter(batch), _batch);
+            if (count > 0)
+                return true;
+            if (!input.closed.load(std::memory_order_acquire))
+                return false;
+            // Items enqueued before the close are visible now
+            count = input.queue.DequeueBulk(std::back_inserter(batch), _batch);
+            return true;
+        });
+        if (count == 0)
+            break;
+        input.writers.Notify();
+
+        // Run all stages of the thread over the batch
+        for (size_t i = first; (i < last) && !batch.empty(); ++i)
+        {
+            Stage& stage = *_stages[i];
+            const size_t size = batch.size();
+
+            uint64_t timestamp = Timestamp::nano();
+
+            // Process items and compact the batch over dropped ones
+            size_t kept = 0;
+            for (size_t j = 0; j < size; ++j)
+            {
+                if (stage.handler(batch[j]))
+                {
+                    if (kept != j)
+                        batch[kept] = std::move(batch[j]);
+                    ++kept;
+                }
+            }
+            batch.resize(kept);
+
+            uint64_t elapsed = Timestamp::nano() - timestamp;
+
+            stage.items.fetch_add(size, std::memory_order_relaxed);
+            stage.dropped.fetch_add(size - kept, std::memory_order_relaxed);
+            stage.batches.fetch_add(1, std::memory_order_relaxed);
+            stage.busy.fetch_add(elapsed, std::memory_order_relaxed);
+            stage.latency.Record(elapsed / size, size);
+        }
+
+        // Enqueue the batch into the next thread
+        if ((output != nullptr) && !batch.empty())
+            Push(*output, std::make_move_iterator(batch.begin()), std::make_move_iterator(batch.end()));
+
+        batch.clear();
+    }
+
+    // Close the next thread input
+    if (output != nullptr)
+    {
+        output->closed.store(true, std::memory_order_release);
+        output->readers.Notify();
+    }
+}
+
+template <typename T>
+inline std::vector<PipelineStageStatistics> Pipeline<T>::statistics() const
+{
+    std::vector<PipelineStageStatistics> result;
+    result.reserve(_stages.size());
+    for (const auto& stage : _stages)
+    {
+        PipelineStageStatistics statistics;
+        statistics.name = stage->name;
+        statistics.thread = stage->thread;
+        statistics.items = stage->items.load(std::memory_order_relaxed);
+        statistics.dropped = stage->dropped.load(std::memory_order_relaxed);
+        statistics.batches = stage->batches.load(std::memory_order_relaxed);
+        statistics.busy = Timespan((int64_t)stage->busy.load(std::memory_order_relaxed));
+        statistics.latency = stage->latency.Snapshot();
+        result.emplace_back(std::move(statistics));
+    }
+    return result;
+}
+
+} // namespace CppCommon
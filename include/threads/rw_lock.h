@@ -9,6 +9,7 @@
 #ifndef CPPCOMMON_THREADS_RW_LOCK_H
 #define CPPCOMMON_THREADS_RW_LOCK_H
 
+#include "threads/instrumentation.h"
 #include "threads/locker.h"
 #include "time/timestamp.h"
 
@@ -23,6 +24,9 @@ namespace CppCommon {
     an exclusive lock is needed for writing or modifying data. When a writer is writing the data,
     all other writers or readers will be blocked until the writer is finished writing.
 
+    With CPPCOMMON_INSTRUMENTATION definition the read/write lock counts
+    contended acquisitions and retry iterations (see InstrumentationRegistry).
+
     Thread-safe.
 
     https://en.wikipedia.org/wiki/Readers%E2%80%93writer_lock
@@ -123,6 +127,10 @@ private:
 #endif
     static const size_t StorageAlign = 8;
     alignas(StorageAlign) std::byte _storage[StorageSize];
+
+#if defined(CPPCOMMON_INSTRUMENTATION)
+    InstrumentationCounters _instrumentation{"RWLock"};
+#endif
 };
 
 /*! \example threads_rw_lock.cpp Read/Write lock synchronization primitive example */
@@ -22,6 +22,10 @@ namespace CppCommon {
     while other threads are waiting for it. When some thread unlocks the semaphore then one of
     waiting threads will lock it.
 
+    Semaphore resources counter is changed with atomic operations and waiting threads
+    are parked on the futex (Linux) or WaitOnAddress (Windows), so unlock makes a system
+    call only when some threads are parked.
+
     Thread-safe.
 
     https://en.wikipedia.org/wiki/Semaphore_(programming)
@@ -9,6 +9,8 @@
 #ifndef CPPCOMMON_THREADS_SEQLOCK_H
 #define CPPCOMMON_THREADS_SEQLOCK_H
 
+#include "threads/wait_strategy.h"
+
 #include <atomic>
 #include <cstring>
 
@@ -22,6 +24,9 @@ namespace CppCommon {
     variable during a reader critical section, and hence improve performance
     by avoiding cache coherence misses on the lock object itself.
 
+    Readers retry while writes are in progress, so under heavy write bursts
+    read latency is unbounded. Use LeftRight if readers must never retry.
+
     Thread-safe.
 
     https://en.wikipedia.org/wiki/Seqlock
@@ -50,12 +55,37 @@ public:
 
     //! Write data under the sequential lock
     /*!
+        Supports only a single writer thread. Use WriteConcurrent() method
+        if the data is written from several threads.
+
         Will not block.
 
         \param data - Data to write
     */
     void Write(const T& data) noexcept;
 
+    //! Try to write data under the sequential lock from one of concurrent writers
+    /*!
+        Writer acquires the sequence with a single CAS from even to odd value.
+
+        Will not block.
+
+        \param data - Data to write
+        \return 'true' if the data was written, 'false' if another writer is in progress
+    */
+    bool TryWrite(const T& data) noexcept;
+    //! Write data under the sequential lock from one of concurrent writers
+    /*!
+        Writers are serialized with CAS on the sequence, so any count of threads
+        could write the data. All writers must use TryWrite() or WriteConcurrent()
+        methods.
+
+        Will block in a spin loop while another writer is in progress.
+
+        \param data - Data to write
+    */
+    void WriteConcurrent(const T& data) noexcept;
+
 private:
     typedef char cache_line_pad[128];
 
@@ -63,6 +93,9 @@ private:
     T _data;
     std::atomic<size_t> _seq;
     cache_line_pad _pad1;
+
+    //! Write data with the acquired odd sequence
+    void WriteAcquired(const T& data, size_t seq0) noexcept;
 };
 
 /*! \example threads_seq_lock.cpp Sequential lock synchronization primitive example */
@@ -58,4 +58,38 @@ inline void SeqLock<T>::Write(const T& data) noexcept
     _seq.store(seq0 + 2, std::memory_order_release);
 }
 
+template <typename T>
+inline bool SeqLock<T>::TryWrite(const T& data) noexcept
+{
+    size_t seq0 = _seq.load(std::memory_order_relaxed);
+    if ((seq0 & 1) || !_seq.compare_exchange_strong(seq0, seq0 + 1, std::memory_order_acquire, std::memory_order_relaxed))
+        return false;
+
+    WriteAcquired(data, seq0);
+    return true;
+}
+
+template <typename T>
+inline void SeqLock<T>::WriteConcurrent(const T& data) noexcept
+{
+    // Acquire the even sequence with CAS
+    size_t seq0 = _seq.load(std::memory_order_relaxed);
+    while ((seq0 & 1) || !_seq.compare_exchange_weak(seq0, seq0 + 1, std::memory_order_acquire, std::memory_order_relaxed))
+    {
+        WaitStrategy::Relax();
+        seq0 = _seq.load(std::memory_order_relaxed);
+    }
+
+    WriteAcquired(data, seq0);
+}
+
+template <typename T>
+inline void SeqLock<T>::WriteAcquired(const T& data, size_t seq0) noexcept
+{
+    // Order the odd sequence before the data change
+    std::atomic_thread_fence(std::memory_order_release);
+    _data = data;
+    _seq.store(seq0 + 2, std::memory_order_release);
+}
+
 } // namespace CppCommon
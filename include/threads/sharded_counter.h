@@ -0,0 +1,79 @@
+/*!
+    \file sharded_counter.h
+    \brief Sharded counter definition
+    \author Ivan Shynkarenka
+    \date 15.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_SHARDED_COUNTER_H
+#define CPPCOMMON_THREADS_SHARDED_COUNTER_H
+
+#include "threads/per_cpu.h"
+
+#include <atomic>
+#include <cstdint>
+
+namespace CppCommon {
+
+//! Sharded counter
+/*!
+    Sharded counter splits the counter value into per-CPU shards. Add()
+    is a single relaxed atomic addition to the shard of the current CPU,
+    so threads on different CPUs never contend, while Sum() walks all
+    shards. Use it for write mostly statistics counters which are updated
+    on hot paths and read rarely.
+
+    Sum() is not an atomic snapshot: additions concurrent with the sum are
+    either counted or not, but the sum of a quiescent counter is exact.
+
+    Thread-safe.
+*/
+class ShardedCounter
+{
+public:
+    //! Initialize the sharded counter
+    /*!
+        \param shards - Shards count (will be rounded up to the power of two, default is 0 - CPU::LogicalCores())
+    */
+    explicit ShardedCounter(size_t shards = 0) : _shards(shards) {}
+    ShardedCounter(const ShardedCounter&) = delete;
+    ShardedCounter(ShardedCounter&&) = delete;
+    ~ShardedCounter() = default;
+
+    ShardedCounter& operator=(const ShardedCounter&) = delete;
+    ShardedCounter& operator=(ShardedCounter&&) = delete;
+
+    //! Get shards count
+    size_t shards() const noexcept { return _shards.slots(); }
+
+    //! Add the given value to the counter
+    /*!
+        \param value - Value to add (could be negative, default is 1)
+    */
+    void Add(int64_t value = 1) noexcept
+    { _shards.local().fetch_add(value, std::memory_order_relaxed); }
+
+    //! Sum the counter value over all shards
+    /*!
+        \return Counter value
+    */
+    int64_t Sum() const noexcept;
+
+    //! Reset the counter value to zero
+    /*!
+        Additions concurrent with the reset could be lost.
+    */
+    void Reset() noexcept;
+
+private:
+    PerCpu<std::atomic<int64_t>> _shards;
+};
+
+/*! \example threads_per_cpu.cpp Per-CPU data and sharded counter example */
+
+} // namespace CppCommon
+
+#include "sharded_counter.inl"
+
+#endif // CPPCOMMON_THREADS_SHARDED_COUNTER_H
@@ -0,0 +1,23 @@
+/*!
+    \file sharded_counter.inl
+    \brief Sharded counter inline implementation
+    \author Ivan Shynkarenka
+    \date 15.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+inline int64_t ShardedCounter::Sum() const noexcept
+{
+    int64_t result = 0;
+    _shards.ForEach([&result](const std::atomic<int64_t>& shard) { result += shard.load(std::memory_order_relaxed); });
+    return result;
+}
+
+inline void ShardedCounter::Reset() noexcept
+{
+    _shards.ForEach([](std::atomic<int64_t>& shard) { shard.store(0, std::memory_order_relaxed); });
+}
+
+} // namespace CppCommon
@@ -0,0 +1,133 @@
+/*!
+    \file shared_mpsc_ring_buffer.h
+    \brief Shared memory multiple producers / single consumer wait-free ring buffer definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_SHARED_MPSC_RING_BUFFER_H
+#define CPPCOMMON_THREADS_SHARED_MPSC_RING_BUFFER_H
+
+#include "threads/locker.h"
+#include "threads/shared_ring.h"
+#include "threads/spsc_ring_buffer.h"
+#include "time/timestamp.h"
+
+#include <atomic>
+#include <thread>
+
+namespace CppCommon {
+
+//! Shared memory multiple producers / single consumer wait-free ring buffer
+/*!
+    Shared memory ring buffer emplaces several SPSC ring buffers with their spin-locks
+    into the named shared memory, so producers and consumer could live in different
+    processes. Producers choose the ring buffer with a RDTS distribution index as
+    MPSCRingBuffer does.
+
+    The first process creates and emplaces ring buffers, other processes open them
+    with the same name, capacity and concurrency. Consumer could wait for the data
+    with the named auto-reset event, producers signal it only if the consumer is
+    waiting.
+
+    FIFO order is not guaranteed!
+
+    Thread-safe.
+*/
+class SharedMPSCRingBuffer
+{
+public:
+    //! Create a new or open existing shared memory ring buffer with a given name, capacity and concurrency
+    /*!
+        \param name - Shared memory ring buffer name
+        \param capacity - Ring buffer capacity (must be a power of two)
+        \param concurrency - Hardware concurrency (default is std::thread::hardware_concurrency)
+    */
+    explicit SharedMPSCRingBuffer(const std::string& name, size_t capacity, size_t concurrency = std::thread::hardware_concurrency());
+    SharedMPSCRingBuffer(const SharedMPSCRingBuffer&) = delete;
+    SharedMPSCRingBuffer(SharedMPSCRingBuffer&&) = delete;
+    ~SharedMPSCRingBuffer() = default;
+
+    SharedMPSCRingBuffer& operator=(const SharedMPSCRingBuffer&) = delete;
+    SharedMPSCRingBuffer& operator=(SharedMPSCRingBuffer&&) = delete;
+
+    //! Check if the buffer is not empty
+    explicit operator bool() const noexcept { return !empty(); }
+
+    //! Is ring buffer empty?
+    bool empty() const noexcept { return (size() == 0); }
+    //! Get ring buffer capacity
+    size_t capacity() const noexcept { return _capacity; }
+    //! Get ring buffer concurrency
+    size_t concurrency() const noexcept { return _concurrency; }
+    //! Get ring buffer size
+    size_t size() const noexcept;
+
+    //! Get the shared memory ring buffer name
+    const std::string& name() const noexcept { return _shared.name(); }
+    //! Get the shared memory owner flag (true if the new one was created, false if the existing one was opened)
+    bool owner() const { return _shared.owner(); }
+
+    //! Enqueue a data into the ring buffer (multiple producers processes method)
+    /*!
+        \see MPSCRingBuffer::Enqueue()
+    */
+    bool Enqueue(const void* data, size_t size);
+    //! Dequeue a data from the ring buffer (single consumer process method)
+    /*!
+        \see MPSCRingBuffer::Dequeue()
+    */
+    bool Dequeue(void* data, size_t& size);
+
+    //! Wait for the data in the ring buffer for the given timespan (single consumer process method)
+    /*!
+        Will block for the given timespan in the worst case.
+
+        \param timespan - Timespan to wait for the data
+        \return 'true' if the ring buffer is not empty, 'false' in case of timeout
+    */
+    bool Wait(const Timespan& timespan) { return _shared.Wait([this]() { return !empty(); }, timespan); }
+    //! Wait for the data in the ring buffer (single consumer process method)
+    /*!
+        Will block.
+    */
+    void Wait() { _shared.Wait([this]() { return !empty(); }); }
+
+private:
+    // Producer's spin-lock and ring buffer are emplaced into the shared memory slot
+    // (spin-lock is a plain atomic flag, because SpinLock instrumentation is process local)
+    struct Producer
+    {
+        std::atomic<bool> locked{false};
+
+        void Lock() noexcept { while (locked.exchange(true, std::memory_order_acquire)); }
+        void Unlock() noexcept { locked.store(false, std::memory_order_release); }
+    };
+
+    Internals::SharedRing _shared;
+    uint8_t* _payload;
+    size_t _capacity;
+    size_t _concurrency;
+    size_t _stride;
+    size_t _consumer;
+
+    //! Get the shared memory slot size for the given capacity
+    static size_t Stride(size_t capacity) noexcept
+    { return Internals::SharedRing::ALIGNMENT + Internals::SharedRing::Align(SPSCRingBuffer::footprint(capacity)); }
+
+    //! Get the producer by the given index
+    Producer* producer(size_t index) const noexcept
+    { return (Producer*)(_payload + index * _stride); }
+    //! Get the producer's ring buffer by the given index
+    SPSCRingBuffer* buffer(size_t index) const noexcept
+    { return (SPSCRingBuffer*)((uint8_t*)producer(index) + Internals::SharedRing::ALIGNMENT); }
+};
+
+/*! \example threads_shared_ring_buffer.cpp Shared memory ring buffers example */
+
+} // namespace CppCommon
+
+#include "shared_mpsc_ring_buffer.inl"
+
+#endif // CPPCOMMON_THREADS_SHARED_MPSC_RING_BUFFER_H
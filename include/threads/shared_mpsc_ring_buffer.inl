@@ -0,0 +1,78 @@
+/*!
+    \file shared_mpsc_ring_buffer.inl
+    \brief Shared memory multiple producers / single consumer wait-free ring buffer inline implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+inline SharedMPSCRingBuffer::SharedMPSCRingBuffer(const std::string& name, size_t capacity, size_t concurrency)
+    : _shared(name, concurrency * Stride(capacity), capacity, concurrency, 1),
+      _payload((uint8_t*)_shared.payload()),
+      _capacity(capacity - 1),
+      _concurrency(concurrency),
+      _stride(Stride(capacity)),
+      _consumer(0)
+{
+    assert((concurrency > 0) && "Ring buffer concurrency must be greater than zero!");
+
+    // Owner emplaces producers' spin-locks and ring buffers into the shared memory
+    if (_shared.owner())
+    {
+        for (size_t i = 0; i < _concurrency; ++i)
+        {
+            new (producer(i)) Producer();
+            SPSCRingBuffer::Emplace(buffer(i), capacity);
+        }
+        _shared.Ready();
+    }
+}
+
+inline size_t SharedMPSCRingBuffer::size() const noexcept
+{
+    size_t size = 0;
+    for (size_t i = 0; i < _concurrency; ++i)
+        size += buffer(i)->size();
+    return size;
+}
+
+inline bool SharedMPSCRingBuffer::Enqueue(const void* data, size_t size)
+{
+    // Get producer index for the current thread based on RDTS value
+    size_t index = Timestamp::rdts() % _concurrency;
+
+    bool result;
+    {
+        // Lock the chosen producer using its spin-lock
+        Locker<Producer> lock(*producer(index));
+
+        // Enqueue the item into the producer's ring buffer
+        result = buffer(index)->Enqueue(data, size);
+    }
+
+    if (result)
+        _shared.Notify();
+
+    return result;
+}
+
+inline bool SharedMPSCRingBuffer::Dequeue(void* data, size_t& size)
+{
+    // Try to dequeue one item from the one of producer's ring buffers
+    for (size_t i = 0; i < _concurrency; ++i)
+    {
+        size_t temp = size;
+        if (buffer(_consumer++ % _concurrency)->Dequeue(data, temp))
+        {
+            size = temp;
+            return true;
+        }
+    }
+
+    size = 0;
+    return false;
+}
+
+} // namespace CppCommon
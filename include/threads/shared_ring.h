@@ -0,0 +1,120 @@
+/*!
+    \file shared_ring.h
+    \brief Shared memory ring segment definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_SHARED_RING_H
+#define CPPCOMMON_THREADS_SHARED_RING_H
+
+#include "errors/exceptions.h"
+#include "system/shared_memory.h"
+#include "threads/named_event_auto_reset.h"
+#include "threads/thread.h"
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+namespace Internals {
+
+//! Shared memory ring segment
+/*!
+    Shared memory ring segment contains the header and the payload of shared
+    memory ring buffers and queues. The owner process emplaces the payload and
+    marks the header as ready, other processes wait for the ready header and
+    validate its layout.
+
+    Consumer process could wait for the payload with the named auto-reset event.
+    It registers itself in the header before the wait, so producers signal the
+    event only when the consumer is really waiting.
+*/
+class SharedRing
+{
+public:
+    //! Layout alignment of the payload parts
+    static const size_t ALIGNMENT = 128;
+
+    //! Create a new or open existing shared memory ring segment
+    /*!
+        \param name - Shared memory ring name
+        \param size - Payload size
+        \param capacity - Ring capacity
+        \param concurrency - Ring concurrency
+        \param item - Ring item size
+    */
+    SharedRing(const std::string& name, size_t size, size_t capacity, size_t concurrency, size_t item);
+    SharedRing(const SharedRing&) = delete;
+    SharedRing(SharedRing&&) = delete;
+    ~SharedRing() = default;
+
+    SharedRing& operator=(const SharedRing&) = delete;
+    SharedRing& operator=(SharedRing&&) = delete;
+
+    //! Get the shared memory ring name
+    const std::string& name() const noexcept { return _shared.name(); }
+    //! Is the current process the owner of the shared memory ring?
+    bool owner() const { return _shared.owner(); }
+
+    //! Get the payload pointer
+    void* payload() { return (uint8_t*)_shared.ptr() + ALIGNMENT; }
+
+    //! Mark the emplaced payload as ready (owner method)
+    void Ready();
+
+    //! Signal the waiting consumer (producers method)
+    void Notify();
+
+    //! Wait until the given condition is satisfied (consumer method)
+    /*!
+        \param condition - Condition to wait for
+        \param timespan - Timespan to wait for the condition
+        \return 'true' if the condition is satisfied, 'false' in case of timeout
+    */
+    template <class TCondition>
+    bool Wait(TCondition&& condition, const Timespan& timespan);
+    //! Wait until the given condition is satisfied (consumer method)
+    /*!
+        \param condition - Condition to wait for
+    */
+    template <class TCondition>
+    void Wait(TCondition&& condition);
+
+    //! Round up the given size to the layout alignment
+    static size_t Align(size_t size) noexcept { return (size + ALIGNMENT - 1) & ~(ALIGNMENT - 1); }
+
+private:
+    static const uint32_t MAGIC = 0x53524E47;
+
+    // Shared memory ring header
+    struct Header
+    {
+        std::atomic<uint32_t> magic;
+        std::atomic<uint32_t> waiting;
+        uint64_t capacity;
+        uint64_t concurrency;
+        uint64_t item;
+    };
+
+    static_assert(sizeof(Header) <= ALIGNMENT, "Shared memory ring header must fit into the layout alignment!");
+    static_assert(std::atomic<uint32_t>::is_always_lock_free, "Shared memory ring atomics must be lock-free!");
+
+    SharedMemory _shared;
+    NamedEventAutoReset _event;
+
+    Header* header() { return (Header*)_shared.ptr(); }
+};
+
+} // namespace Internals
+//! @endcond
+
+} // namespace CppCommon
+
+#include "shared_ring.inl"
+
+#endif // CPPCOMMON_THREADS_SHARED_RING_H
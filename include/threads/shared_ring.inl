@@ -0,0 +1,92 @@
+/*!
+    \file shared_ring.inl
+    \brief Shared memory ring segment inline implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+namespace Internals {
+
+inline SharedRing::SharedRing(const std::string& name, size_t size, size_t capacity, size_t concurrency, size_t item)
+    : _shared(name, ALIGNMENT + size),
+      _event(name + "-event")
+{
+    if (owner())
+    {
+        // Fill the header layout, the payload is ready only after the owner emplaces it
+        header()->capacity = capacity;
+        header()->concurrency = concurrency;
+        header()->item = item;
+        header()->waiting.store(0, std::memory_order_relaxed);
+    }
+    else
+    {
+        // Wait for the owner to emplace the payload
+        Timestamp timeout = UtcTimestamp() + Timespan::seconds(10);
+        while (header()->magic.load(std::memory_order_acquire) != MAGIC)
+        {
+            if (UtcTimestamp() > timeout)
+                throwex SystemException("Shared memory ring '" + name + "' is not ready!");
+            Thread::Yield();
+        }
+
+        // Validate the header layout
+        if ((header()->capacity != capacity) || (header()->concurrency != concurrency) || (header()->item != item))
+            throwex SystemException("Invalid shared memory ring '" + name + "' layout!");
+    }
+}
+
+inline void SharedRing::Ready()
+{
+    header()->magic.store(MAGIC, std::memory_order_release);
+}
+
+inline void SharedRing::Notify()
+{
+    // Order the published payload before the waiting flag check (pairs with the consumer registration)
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if ((header()->waiting.load(std::memory_order_relaxed) != 0) && (header()->waiting.exchange(0, std::memory_order_acq_rel) != 0))
+        _event.Signal();
+}
+
+template <class TCondition>
+inline bool SharedRing::Wait(TCondition&& condition, const Timespan& timespan)
+{
+    if (condition())
+        return true;
+
+    // Register the waiting consumer and check the condition once again
+    header()->waiting.store(1, std::memory_order_seq_cst);
+    if (condition())
+    {
+        header()->waiting.store(0, std::memory_order_relaxed);
+        return true;
+    }
+
+    _event.TryWaitFor(timespan);
+
+    header()->waiting.store(0, std::memory_order_relaxed);
+    return condition();
+}
+
+template <class TCondition>
+inline void SharedRing::Wait(TCondition&& condition)
+{
+    while (!condition())
+    {
+        // Register the waiting consumer and check the condition once again
+        header()->waiting.store(1, std::memory_order_seq_cst);
+        if (!condition())
+            _event.Wait();
+        header()->waiting.store(0, std::memory_order_relaxed);
+    }
+}
+
+} // namespace Internals
+//! @endcond
+
+} // namespace CppCommon
@@ -0,0 +1,89 @@
+/*!
+    \file shared_seq_lock.h
+    \brief Shared memory sequential lock synchronization primitive definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_SHARED_SEQLOCK_H
+#define CPPCOMMON_THREADS_SHARED_SEQLOCK_H
+
+#include "threads/seq_lock.h"
+#include "threads/shared_ring.h"
+
+#include <type_traits>
+
+namespace CppCommon {
+
+//! Shared memory sequential lock synchronization primitive
+/*!
+    Shared memory sequential lock emplaces SeqLock into the named shared memory,
+    so the writer and readers could live in different processes. Readers never
+    enter the kernel and never modify the shared memory, so they do not limit
+    each other in contrast to NamedRWLock. Data must be trivially copyable and
+    must not contain any pointers to process memory.
+
+    The first process creates and emplaces the sequential lock with the given
+    initial data, other processes open it with the same name and data type.
+
+    Thread-safe.
+*/
+template <typename T>
+class SharedSeqLock
+{
+    static_assert(std::is_trivially_copyable<T>::value, "Shared sequential lock data must be trivially copyable!");
+
+public:
+    //! Create a new or open existing shared memory sequential lock with a given name
+    /*!
+        \param name - Shared memory sequential lock name
+        \param data - Initial data (used only by the owner, default is T())
+    */
+    explicit SharedSeqLock(const std::string& name, const T& data = T());
+    SharedSeqLock(const SharedSeqLock&) = delete;
+    SharedSeqLock(SharedSeqLock&&) = delete;
+    ~SharedSeqLock() = default;
+
+    SharedSeqLock& operator=(const T& data) noexcept { Write(data); return *this; }
+    SharedSeqLock& operator=(const SharedSeqLock&) = delete;
+    SharedSeqLock& operator=(SharedSeqLock&&) = delete;
+
+    //! Get the shared memory sequential lock name
+    const std::string& name() const noexcept { return _shared.name(); }
+    //! Get the shared memory owner flag (true if the new one was created, false if the existing one was opened)
+    bool owner() const { return _shared.owner(); }
+
+    //! Read data under the sequential lock
+    /*!
+        \see SeqLock::Read()
+    */
+    T Read() const noexcept { return _lock->Read(); }
+
+    //! Write data under the sequential lock (single writer method)
+    /*!
+        \see SeqLock::Write()
+    */
+    void Write(const T& data) noexcept { _lock->Write(data); }
+
+    //! Try to write data under the sequential lock from one of concurrent writers
+    /*!
+        \see SeqLock::TryWrite()
+    */
+    bool TryWrite(const T& data) noexcept { return _lock->TryWrite(data); }
+    //! Write data under the sequential lock from one of concurrent writers
+    /*!
+        \see SeqLock::WriteConcurrent()
+    */
+    void WriteConcurrent(const T& data) noexcept { _lock->WriteConcurrent(data); }
+
+private:
+    Internals::SharedRing _shared;
+    SeqLock<T>* _lock;
+};
+
+} // namespace CppCommon
+
+#include "shared_seq_lock.inl"
+
+#endif // CPPCOMMON_THREADS_SHARED_SEQLOCK_H
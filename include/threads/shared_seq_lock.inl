@@ -0,0 +1,24 @@
+/*!
+    \file shared_seq_lock.inl
+    \brief Shared memory sequential lock synchronization primitive inline implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+template <typename T>
+inline SharedSeqLock<T>::SharedSeqLock(const std::string& name, const T& data)
+    : _shared(name, sizeof(SeqLock<T>), 1, 1, sizeof(T)),
+      _lock((SeqLock<T>*)_shared.payload())
+{
+    // Owner emplaces the sequential lock into the shared memory
+    if (_shared.owner())
+    {
+        new (_shared.payload()) SeqLock<T>(data);
+        _shared.Ready();
+    }
+}
+
+} // namespace CppCommon
@@ -0,0 +1,113 @@
+/*!
+    \file shared_snapshot.h
+    \brief Shared memory double-buffered versioned snapshot definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_SHARED_SNAPSHOT_H
+#define CPPCOMMON_THREADS_SHARED_SNAPSHOT_H
+
+#include "threads/shared_ring.h"
+#include "threads/snapshot.h"
+
+namespace CppCommon {
+
+//! Shared memory double-buffered versioned snapshot
+/*!
+    Shared memory snapshot emplaces Snapshot into the named shared memory, so
+    the publisher and readers could live in different processes (e.g. the
+    top-of-book publisher and strategy processes). Readers copy the latest
+    published snapshot without any kernel calls and without waiting for the
+    publisher in progress. Data must be trivially copyable and must not contain
+    any pointers to process memory.
+
+    The first process creates and emplaces the snapshot with the given initial
+    data, other processes open it with the same name and data type. Readers
+    could wait for a newer version with the named auto-reset event, publisher
+    signals it only if a reader is waiting. Only one reader process should wait
+    for the event at a time, other readers should poll the version.
+
+    Thread-safe.
+*/
+template <typename T>
+class SharedSnapshot
+{
+public:
+    //! Create a new or open existing shared memory snapshot with a given name
+    /*!
+        \param name - Shared memory snapshot name
+        \param data - Initial data (used only by the owner, default is T())
+    */
+    explicit SharedSnapshot(const std::string& name, const T& data = T());
+    SharedSnapshot(const SharedSnapshot&) = delete;
+    SharedSnapshot(SharedSnapshot&&) = delete;
+    ~SharedSnapshot() = default;
+
+    SharedSnapshot& operator=(const T& data) { Publish(data); return *this; }
+    SharedSnapshot& operator=(const SharedSnapshot&) = delete;
+    SharedSnapshot& operator=(SharedSnapshot&&) = delete;
+
+    //! Get the shared memory snapshot name
+    const std::string& name() const noexcept { return _shared.name(); }
+    //! Get the shared memory owner flag (true if the new one was created, false if the existing one was opened)
+    bool owner() const { return _shared.owner(); }
+
+    //! Get the latest published version
+    /*!
+        \see Snapshot::version()
+    */
+    uint64_t version() const noexcept { return _snapshot->version(); }
+
+    //! Read the latest published snapshot
+    /*!
+        \see Snapshot::Read()
+    */
+    T Read() const noexcept { return _snapshot->Read(); }
+    //! Read the latest published snapshot with its version
+    /*!
+        \see Snapshot::Read()
+    */
+    uint64_t Read(T& data) const noexcept { return _snapshot->Read(data); }
+    //! Read the latest published snapshot if it is newer than the given version
+    /*!
+        \see Snapshot::TryRead()
+    */
+    bool TryRead(T& data, uint64_t& version) const noexcept { return _snapshot->TryRead(data, version); }
+
+    //! Publish a new snapshot of the data (single publisher method)
+    /*!
+        \see Snapshot::Publish()
+    */
+    uint64_t Publish(const T& data);
+
+    //! Wait for the version newer than the given one for the given timespan
+    /*!
+        Will block for the given timespan in the worst case.
+
+        \param version - Known version
+        \param timespan - Timespan to wait for the newer version
+        \return 'true' if the newer version is published, 'false' in case of timeout
+    */
+    bool Wait(uint64_t version, const Timespan& timespan) { return _shared.Wait([this, version]() { return (this->version() != version); }, timespan); }
+    //! Wait for the version newer than the given one
+    /*!
+        Will block.
+
+        \param version - Known version
+    */
+    void Wait(uint64_t version) { _shared.Wait([this, version]() { return (this->version() != version); }); }
+
+private:
+    Internals::SharedRing _shared;
+    Snapshot<T>* _snapshot;
+};
+
+/*! \example threads_shared_snapshot.cpp Shared memory snapshot example */
+
+} // namespace CppCommon
+
+#include "shared_snapshot.inl"
+
+#endif // CPPCOMMON_THREADS_SHARED_SNAPSHOT_H
@@ -0,0 +1,32 @@
+/*!
+    \file shared_snapshot.inl
+    \brief Shared memory double-buffered versioned snapshot inline implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+template <typename T>
+inline SharedSnapshot<T>::SharedSnapshot(const std::string& name, const T& data)
+    : _shared(name, sizeof(Snapshot<T>), 2, 1, sizeof(T)),
+      _snapshot((Snapshot<T>*)_shared.payload())
+{
+    // Owner emplaces the snapshot into the shared memory
+    if (_shared.owner())
+    {
+        new (_shared.payload()) Snapshot<T>(data);
+        _shared.Ready();
+    }
+}
+
+template <typename T>
+inline uint64_t SharedSnapshot<T>::Publish(const T& data)
+{
+    uint64_t version = _snapshot->Publish(data);
+    _shared.Notify();
+    return version;
+}
+
+} // namespace CppCommon
@@ -0,0 +1,121 @@
+/*!
+    \file shared_spsc_ring_buffer.h
+    \brief Shared memory single producer / single consumer wait-free ring buffer definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_SHARED_SPSC_RING_BUFFER_H
+#define CPPCOMMON_THREADS_SHARED_SPSC_RING_BUFFER_H
+
+#include "threads/shared_ring.h"
+#include "threads/spsc_ring_buffer.h"
+
+namespace CppCommon {
+
+//! Shared memory single producer / single consumer wait-free ring buffer
+/*!
+    Shared memory ring buffer emplaces SPSCRingBuffer into the named shared memory,
+    so producer and consumer could live in different processes. Ring buffer uses
+    cursors and offsets instead of pointers, so the shared memory could be mapped
+    at different addresses.
+
+    The first process creates and emplaces the ring buffer, other processes open
+    it with the same name and capacity. Consumer could wait for the data with the
+    named auto-reset event, producer signals it only if the consumer is waiting.
+
+    Thread-safe.
+*/
+class SharedSPSCRingBuffer
+{
+public:
+    //! Create a new or open existing shared memory ring buffer with a given name and capacity
+    /*!
+        \param name - Shared memory ring buffer name
+        \param capacity - Ring buffer capacity (must be a power of two)
+    */
+    explicit SharedSPSCRingBuffer(const std::string& name, size_t capacity);
+    SharedSPSCRingBuffer(const SharedSPSCRingBuffer&) = delete;
+    SharedSPSCRingBuffer(SharedSPSCRingBuffer&&) = delete;
+    ~SharedSPSCRingBuffer() = default;
+
+    SharedSPSCRingBuffer& operator=(const SharedSPSCRingBuffer&) = delete;
+    SharedSPSCRingBuffer& operator=(SharedSPSCRingBuffer&&) = delete;
+
+    //! Check if the buffer is not empty
+    explicit operator bool() const noexcept { return !empty(); }
+
+    //! Is ring buffer empty?
+    bool empty() const noexcept { return _buffer->empty(); }
+    //! Get ring buffer capacity in bytes
+    size_t capacity() const noexcept { return _buffer->capacity(); }
+    //! Get ring buffer size in bytes
+    size_t size() const noexcept { return _buffer->size(); }
+
+    //! Get the shared memory ring buffer name
+    const std::string& name() const noexcept { return _shared.name(); }
+    //! Get the shared memory owner flag (true if the new one was created, false if the existing one was opened)
+    bool owner() const { return _shared.owner(); }
+
+    //! Enqueue a data into the ring buffer (single producer process method)
+    /*!
+        \see SPSCRingBuffer::Enqueue()
+    */
+    bool Enqueue(const void* data, size_t size);
+    //! Dequeue a data from the ring buffer (single consumer process method)
+    /*!
+        \see SPSCRingBuffer::Dequeue()
+    */
+    bool Dequeue(void* data, size_t& size) { return _buffer->Dequeue(data, size); }
+
+    //! Reserve a contiguous region in the ring buffer to write a data in place (single producer process method)
+    /*!
+        \see SPSCRingBuffer::Reserve()
+    */
+    std::span<uint8_t> Reserve(size_t size) { return _buffer->Reserve(size); }
+    //! Commit the given count of bytes of the reserved region (single producer process method)
+    /*!
+        \see SPSCRingBuffer::Commit()
+    */
+    void Commit(size_t size);
+    //! Commit the whole reserved region (single producer process method)
+    void Commit();
+
+    //! Peek a contiguous region of the data in the ring buffer to read it in place (single consumer process method)
+    /*!
+        \see SPSCRingBuffer::Peek()
+    */
+    std::span<const uint8_t> Peek() { return _buffer->Peek(); }
+    //! Release the given count of bytes of the peeked region (single consumer process method)
+    /*!
+        \see SPSCRingBuffer::Release()
+    */
+    void Release(size_t size) { _buffer->Release(size); }
+
+    //! Wait for the data in the ring buffer for the given timespan (single consumer process method)
+    /*!
+        Will block for the given timespan in the worst case.
+
+        \param timespan - Timespan to wait for the data
+        \return 'true' if the ring buffer is not empty, 'false' in case of timeout
+    */
+    bool Wait(const Timespan& timespan) { return _shared.Wait([this]() { return !empty(); }, timespan); }
+    //! Wait for the data in the ring buffer (single consumer process method)
+    /*!
+        Will block.
+    */
+    void Wait() { _shared.Wait([this]() { return !empty(); }); }
+
+private:
+    Internals::SharedRing _shared;
+    SPSCRingBuffer* _buffer;
+};
+
+/*! \example threads_shared_ring_buffer.cpp Shared memory ring buffers example */
+
+} // namespace CppCommon
+
+#include "shared_spsc_ring_buffer.inl"
+
+#endif // CPPCOMMON_THREADS_SHARED_SPSC_RING_BUFFER_H
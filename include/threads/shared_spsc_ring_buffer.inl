@@ -0,0 +1,44 @@
+/*!
+    \file shared_spsc_ring_buffer.inl
+    \brief Shared memory single producer / single consumer wait-free ring buffer inline implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+inline SharedSPSCRingBuffer::SharedSPSCRingBuffer(const std::string& name, size_t capacity)
+    : _shared(name, SPSCRingBuffer::footprint(capacity), capacity, 1, 1),
+      _buffer((SPSCRingBuffer*)_shared.payload())
+{
+    // Owner emplaces the ring buffer into the shared memory
+    if (_shared.owner())
+    {
+        SPSCRingBuffer::Emplace(_shared.payload(), capacity);
+        _shared.Ready();
+    }
+}
+
+inline bool SharedSPSCRingBuffer::Enqueue(const void* data, size_t size)
+{
+    if (!_buffer->Enqueue(data, size))
+        return false;
+
+    _shared.Notify();
+    return true;
+}
+
+inline void SharedSPSCRingBuffer::Commit(size_t size)
+{
+    _buffer->Commit(size);
+    _shared.Notify();
+}
+
+inline void SharedSPSCRingBuffer::Commit()
+{
+    _buffer->Commit();
+    _shared.Notify();
+}
+
+} // namespace CppCommon
@@ -0,0 +1,113 @@
+/*!
+    \file shared_spsc_ring_queue.h
+    \brief Shared memory single producer / single consumer wait-free ring queue definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_SHARED_SPSC_RING_QUEUE_H
+#define CPPCOMMON_THREADS_SHARED_SPSC_RING_QUEUE_H
+
+#include "threads/shared_ring.h"
+#include "threads/spsc_ring_queue.h"
+
+namespace CppCommon {
+
+//! Shared memory single producer / single consumer wait-free ring queue
+/*!
+    Shared memory ring queue emplaces SPSCRingQueue into the named shared memory,
+    so producer and consumer could live in different processes. Items must be
+    trivially copyable and must not contain any pointers to process memory.
+
+    The first process creates and emplaces the ring queue, other processes open
+    it with the same name, capacity and item type. Consumer could wait for items
+    with the named auto-reset event, producer signals it only if the consumer is
+    waiting.
+
+    Thread-safe.
+*/
+template<typename T>
+class SharedSPSCRingQueue
+{
+public:
+    //! Create a new or open existing shared memory ring queue with a given name and capacity
+    /*!
+        \param name - Shared memory ring queue name
+        \param capacity - Ring queue capacity (must be a power of two)
+    */
+    explicit SharedSPSCRingQueue(const std::string& name, size_t capacity);
+    SharedSPSCRingQueue(const SharedSPSCRingQueue&) = delete;
+    SharedSPSCRingQueue(SharedSPSCRingQueue&&) = delete;
+    ~SharedSPSCRingQueue() = default;
+
+    SharedSPSCRingQueue& operator=(const SharedSPSCRingQueue&) = delete;
+    SharedSPSCRingQueue& operator=(SharedSPSCRingQueue&&) = delete;
+
+    //! Check if the queue is not empty
+    explicit operator bool() const noexcept { return !empty(); }
+
+    //! Is ring queue empty?
+    bool empty() const noexcept { return _queue->empty(); }
+    //! Get ring queue capacity
+    size_t capacity() const noexcept { return _queue->capacity(); }
+    //! Get ring queue size
+    size_t size() const noexcept { return _queue->size(); }
+
+    //! Get the shared memory ring queue name
+    const std::string& name() const noexcept { return _shared.name(); }
+    //! Get the shared memory owner flag (true if the new one was created, false if the existing one was opened)
+    bool owner() const { return _shared.owner(); }
+
+    //! Enqueue an item into the ring queue (single producer process method)
+    /*!
+        \see SPSCRingQueue::Enqueue()
+    */
+    bool Enqueue(const T& item);
+    //! Dequeue an item from the ring queue (single consumer process method)
+    /*!
+        \see SPSCRingQueue::Dequeue()
+    */
+    bool Dequeue(T& item) { return _queue->Dequeue(item); }
+
+    //! Enqueue items from the given range into the ring queue (single producer process method)
+    /*!
+        \see SPSCRingQueue::EnqueueBulk()
+    */
+    template <class TIterator>
+    size_t EnqueueBulk(TIterator first, TIterator last);
+    //! Dequeue up to the given count of items from the ring queue (single consumer process method)
+    /*!
+        \see SPSCRingQueue::DequeueBulk()
+    */
+    template <class TOutputIterator>
+    size_t DequeueBulk(TOutputIterator output, size_t max) { return _queue->DequeueBulk(output, max); }
+
+    //! Wait for items in the ring queue for the given timespan (single consumer process method)
+    /*!
+        Will block for the given timespan in the worst case.
+
+        \param timespan - Timespan to wait for items
+        \return 'true' if the ring queue is not empty, 'false' in case of timeout
+    */
+    bool Wait(const Timespan& timespan) { return _shared.Wait([this]() { return !empty(); }, timespan); }
+    //! Wait for items in the ring queue (single consumer process method)
+    /*!
+        Will block.
+    */
+    void Wait() { _shared.Wait([this]() { return !empty(); }); }
+
+private:
+    static_assert(std::is_trivially_copyable<T>::value, "Shared memory ring queue items must be trivially copyable!");
+
+    Internals::SharedRing _shared;
+    SPSCRingQueue<T>* _queue;
+};
+
+/*! \example threads_shared_ring_buffer.cpp Shared memory ring buffers example */
+
+} // namespace CppCommon
+
+#include "shared_spsc_ring_queue.inl"
+
+#endif // CPPCOMMON_THREADS_SHARED_SPSC_RING_QUEUE_H
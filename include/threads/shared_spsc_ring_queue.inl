@@ -0,0 +1,44 @@
+/*!
+    \file shared_spsc_ring_queue.inl
+    \brief Shared memory single producer / single consumer wait-free ring queue inline implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+template<typename T>
+inline SharedSPSCRingQueue<T>::SharedSPSCRingQueue(const std::string& name, size_t capacity)
+    : _shared(name, SPSCRingQueue<T>::footprint(capacity), capacity, 1, sizeof(T)),
+      _queue((SPSCRingQueue<T>*)_shared.payload())
+{
+    // Owner emplaces the ring queue into the shared memory
+    if (_shared.owner())
+    {
+        SPSCRingQueue<T>::Emplace(_shared.payload(), capacity);
+        _shared.Ready();
+    }
+}
+
+template<typename T>
+inline bool SharedSPSCRingQueue<T>::Enqueue(const T& item)
+{
+    if (!_queue->Enqueue(item))
+        return false;
+
+    _shared.Notify();
+    return true;
+}
+
+template<typename T>
+template <class TIterator>
+inline size_t SharedSPSCRingQueue<T>::EnqueueBulk(TIterator first, TIterator last)
+{
+    size_t count = _queue->EnqueueBulk(first, last);
+    if (count > 0)
+        _shared.Notify();
+    return count;
+}
+
+} // namespace CppCommon
@@ -0,0 +1,111 @@
+/*!
+    \file snapshot.h
+    \brief Double-buffered versioned snapshot synchronization primitive definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_SNAPSHOT_H
+#define CPPCOMMON_THREADS_SNAPSHOT_H
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace CppCommon {
+
+//! Double-buffered versioned snapshot synchronization primitive
+/*!
+    Snapshot publishes versions of the data from the single writer to any count
+    of readers. The writer alternates two sequential locked slots and always
+    writes the slot which is not the latest published one, so readers copy the
+    latest snapshot without waiting for the writer in progress. Reader retries
+    only if the writer published two new versions during the read.
+
+    Each published snapshot gets the next version number, so readers could
+    cheaply find out whether they already have the latest snapshot.
+
+    Snapshot contains only atomics and the data, so it could be placed into the
+    shared memory (see SharedSnapshot). The data must be trivially copyable.
+
+    Thread-safe.
+*/
+template <typename T>
+class Snapshot
+{
+    static_assert(std::is_trivially_copyable<T>::value, "Snapshot data must be trivially copyable!");
+
+public:
+    Snapshot();
+    explicit Snapshot(const T& data);
+    Snapshot(const Snapshot&) = delete;
+    Snapshot(Snapshot&&) = delete;
+    ~Snapshot() = default;
+
+    Snapshot& operator=(const T& data) noexcept;
+    Snapshot& operator=(const Snapshot&) = delete;
+    Snapshot& operator=(Snapshot&&) = delete;
+
+    //! Get the latest published version (zero for the initial data)
+    uint64_t version() const noexcept { return _version.load(std::memory_order_acquire); }
+
+    //! Read the latest published snapshot
+    /*!
+        Will not block the writer.
+
+        \return Read data
+    */
+    T Read() const noexcept;
+    //! Read the latest published snapshot with its version
+    /*!
+        Will not block the writer.
+
+        \param data - Read data
+        \return Version of the read data
+    */
+    uint64_t Read(T& data) const noexcept;
+    //! Read the latest published snapshot if it is newer than the given version
+    /*!
+        Will not block the writer.
+
+        \param data - Read data (not changed if there is no newer snapshot)
+        \param version - Known version, updated with the version of the read data
+        \return 'true' if the newer snapshot was read, 'false' if the known version is the latest one
+    */
+    bool TryRead(T& data, uint64_t& version) const noexcept;
+
+    //! Publish a new snapshot of the data
+    /*!
+        Supports only a single writer thread.
+
+        Will not block.
+
+        \param data - Data to publish
+        \return Version of the published data
+    */
+    uint64_t Publish(const T& data) noexcept;
+
+private:
+    typedef char cache_line_pad[128];
+
+    // Slot is padded with cache line to avoid false sharing with the other slot
+    struct Slot
+    {
+        std::atomic<uint64_t> seq;
+        T data;
+        cache_line_pad pad;
+    };
+
+    cache_line_pad _pad0;
+    std::atomic<uint64_t> _version;
+    cache_line_pad _pad1;
+    Slot _slots[2];
+};
+
+} // namespace CppCommon
+
+#include "snapshot.inl"
+
+#endif // CPPCOMMON_THREADS_SNAPSHOT_H
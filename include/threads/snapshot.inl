@@ -0,0 +1,90 @@
+/*!
+    \file snapshot.inl
+    \brief Double-buffered versioned snapshot synchronization primitive inline implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+template <typename T>
+inline Snapshot<T>::Snapshot() : Snapshot(T())
+{
+}
+
+template <typename T>
+inline Snapshot<T>::Snapshot(const T& data) : _version(0)
+{
+    memset(_pad0, 0, sizeof(cache_line_pad));
+    memset(_pad1, 0, sizeof(cache_line_pad));
+
+    // Both slots contain the initial data of the zero version
+    for (auto& slot : _slots)
+    {
+        slot.seq.store(0, std::memory_order_relaxed);
+        slot.data = data;
+        memset(slot.pad, 0, sizeof(cache_line_pad));
+    }
+}
+
+template <typename T>
+inline Snapshot<T>& Snapshot<T>::operator=(const T& data) noexcept
+{
+    Publish(data);
+    return *this;
+}
+
+template <typename T>
+inline T Snapshot<T>::Read() const noexcept
+{
+    T data;
+    Read(data);
+    return data;
+}
+
+template <typename T>
+inline uint64_t Snapshot<T>::Read(T& data) const noexcept
+{
+    for (;;)
+    {
+        // Slot of the version keeps the even sequence of the doubled version until the writer reuses it
+        uint64_t version = _version.load(std::memory_order_acquire);
+        const Slot& slot = _slots[version & 1];
+        uint64_t seq0 = slot.seq.load(std::memory_order_acquire);
+        std::memcpy((void*)&data, (const void*)&slot.data, sizeof(T));
+        std::atomic_thread_fence(std::memory_order_acquire);
+        uint64_t seq1 = slot.seq.load(std::memory_order_relaxed);
+        if ((seq0 == seq1) && (seq0 == (2 * version)))
+            return version;
+    }
+}
+
+template <typename T>
+inline bool Snapshot<T>::TryRead(T& data, uint64_t& version) const noexcept
+{
+    if (_version.load(std::memory_order_acquire) == version)
+        return false;
+
+    version = Read(data);
+    return true;
+}
+
+template <typename T>
+inline uint64_t Snapshot<T>::Publish(const T& data) noexcept
+{
+    uint64_t version = _version.load(std::memory_order_relaxed) + 1;
+    Slot& slot = _slots[version & 1];
+
+    // Mark the slot as being written with the odd sequence before the data change
+    slot.seq.store((2 * version) - 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    std::memcpy((void*)&slot.data, (const void*)&data, sizeof(T));
+    slot.seq.store(2 * version, std::memory_order_release);
+
+    // Switch readers to the written slot
+    _version.store(version, std::memory_order_release);
+    return version;
+}
+
+} // namespace CppCommon
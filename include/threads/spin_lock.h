@@ -9,6 +9,7 @@
 #ifndef CPPCOMMON_THREADS_SPIN_LOCK_H
 #define CPPCOMMON_THREADS_SPIN_LOCK_H
 
+#include "threads/instrumentation.h"
 #include "threads/locker.h"
 #include "time/timestamp.h"
 
@@ -22,6 +23,9 @@ namespace CppCommon {
     In contrast to a mutex, threads will busy-wait and waste CPU cycles instead of yielding the CPU to another thread.
     Do not use spinlocks unless you are certain that you understand the consequences!
 
+    With CPPCOMMON_INSTRUMENTATION definition the spin-lock counts contended
+    acquisitions and spin iterations (see InstrumentationRegistry).
+
     Thread-safe.
 
     https://en.wikipedia.org/wiki/Spinlock
@@ -94,6 +98,9 @@ public:
 
 private:
     std::atomic<bool> _lock;
+#if defined(CPPCOMMON_INSTRUMENTATION)
+    InstrumentationCounters _instrumentation{"SpinLock"};
+#endif
 };
 
 /*! \example threads_spin_lock.cpp Spin-lock synchronization primitive example */
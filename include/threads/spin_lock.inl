@@ -15,17 +15,26 @@ inline bool SpinLock::IsLocked() noexcept
 
 inline bool SpinLock::TryLock() noexcept
 {
-    return !_lock.exchange(true, std::memory_order_acquire);
+    if (!_lock.exchange(true, std::memory_order_acquire))
+        return true;
+
+    CPPCOMMON_INSTRUMENT(_instrumentation, CONTENDED, 1);
+    return false;
 }
 
 inline bool SpinLock::TryLockSpin(int64_t spin) noexcept
 {
     // Try to acquire spin-lock at least one time
-    do
+    if (TryLock())
+        return true;
+
+    // Spin for the given spin count
+    while (spin-- > 0)
     {
-        if (TryLock())
+        CPPCOMMON_INSTRUMENT(_instrumentation, SPINS, 1);
+        if (!_lock.exchange(true, std::memory_order_acquire))
             return true;
-    } while (spin-- > 0);
+    }
 
     // Failed to acquire spin-lock
     return false;
@@ -37,11 +46,16 @@ inline bool SpinLock::TryLockFor(const Timespan& timespan) noexcept
     Timestamp finish = NanoTimestamp() + timespan;
 
     // Try to acquire spin-lock at least one time
-    do
+    if (TryLock())
+        return true;
+
+    // Spin for the given timespan
+    while (NanoTimestamp() < finish)
     {
-        if (TryLock())
+        CPPCOMMON_INSTRUMENT(_instrumentation, SPINS, 1);
+        if (!_lock.exchange(true, std::memory_order_acquire))
             return true;
-    } while (NanoTimestamp() < finish);
+    }
 
     // Failed to acquire spin-lock
     return false;
@@ -49,7 +63,12 @@ inline bool SpinLock::TryLockFor(const Timespan& timespan) noexcept
 
 inline void SpinLock::Lock() noexcept
 {
-    while (_lock.exchange(true, std::memory_order_acquire));
+    if (!_lock.exchange(true, std::memory_order_acquire))
+        return;
+
+    CPPCOMMON_INSTRUMENT(_instrumentation, CONTENDED, 1);
+    while (_lock.exchange(true, std::memory_order_acquire))
+        CPPCOMMON_INSTRUMENT(_instrumentation, SPINS, 1);
 }
 
 inline void SpinLock::Unlock() noexcept
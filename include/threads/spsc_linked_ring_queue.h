@@ -0,0 +1,155 @@
+/*!
+    \file spsc_linked_ring_queue.h
+    \brief Single producer / single consumer wait-free linked ring queue definition
+    \author Ivan Shynkarenka
+    \date 15.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_SPSC_LINKED_RING_QUEUE_H
+#define CPPCOMMON_THREADS_SPSC_LINKED_RING_QUEUE_H
+
+#include "threads/instrumentation.h"
+#include "threads/spsc_ring_queue.h"
+
+#include <atomic>
+#include <cassert>
+#include <cstring>
+#include <new>
+#include <utility>
+
+namespace CppCommon {
+
+//! Single producer / single consumer wait-free linked ring queue
+/*!
+    Single producer / single consumer wait-free linked ring queue is an unbounded
+    queue made of fixed-size segments linked one after another. Producer fills
+    the current segment and links a new one when it is full, consumer drains
+    segments in the same order. Within a segment enqueue and dequeue cost the
+    same as in the ring queue, so the queue keeps ring-like throughput while its
+    memory is proportional to the real backlog instead of the worst burst.
+
+    Drained segments are recycled to the producer through the ring queue of
+    spare segments. Segments which do not fit into it are released, so an idle
+    queue keeps only its current segment and a few spare ones.
+
+    FIFO order is guaranteed!
+
+    With CPPCOMMON_INSTRUMENTATION definition the linked ring queue counts
+    rejected enqueues (full, i.e. out of memory) and rejected dequeues (empty)
+    (see InstrumentationRegistry).
+
+    Thread-safe.
+*/
+template<typename T>
+class SPSCLinkedRingQueue
+{
+public:
+    //! Default class constructor
+    /*!
+        \param segment - Count of items in a single segment (default is 1024)
+        \param spare - Max count of drained segments kept for reuse (rounded up to a power of two minus one, default is 3)
+    */
+    explicit SPSCLinkedRingQueue(size_t segment = 1024, size_t spare = 3);
+    SPSCLinkedRingQueue(const SPSCLinkedRingQueue&) = delete;
+    SPSCLinkedRingQueue(SPSCLinkedRingQueue&&) = delete;
+    ~SPSCLinkedRingQueue();
+
+    SPSCLinkedRingQueue& operator=(const SPSCLinkedRingQueue&) = delete;
+    SPSCLinkedRingQueue& operator=(SPSCLinkedRingQueue&&) = delete;
+
+    //! Check if the queue is not empty
+    explicit operator bool() const noexcept { return !empty(); }
+
+    //! Is linked ring queue empty?
+    bool empty() const noexcept { return (size() == 0); }
+    //! Get linked ring queue size
+    size_t size() const noexcept;
+    //! Get count of items in a single segment
+    size_t segment() const noexcept { return _segment; }
+    //! Get count of allocated segments (including spare ones)
+    size_t segments() const noexcept { return _segments.load(std::memory_order_relaxed); }
+
+    //! Enqueue an item into the linked ring queue (single producer thread method)
+    /*!
+        The item will be copied into the linked ring queue.
+
+        Will not block.
+
+        \param item - Item to enqueue
+        \return 'true' if the item was successfully enqueue, 'false' if there is no enough memory for a new segment
+    */
+    bool Enqueue(const T& item);
+    //! Enqueue an item into the linked ring queue (single producer thread method)
+    /*!
+        The item will be moved into the linked ring queue.
+
+        Will not block.
+
+        \param item - Item to enqueue
+        \return 'true' if the item was successfully enqueue, 'false' if there is no enough memory for a new segment
+    */
+    bool Enqueue(T&& item);
+
+    //! Dequeue an item from the linked ring queue (single consumer thread method)
+    /*!
+        The item will be moved from the linked ring queue.
+
+        Will not block.
+
+        \param item - Item to dequeue
+        \return 'true' if the item was successfully dequeue, 'false' if the linked ring queue is empty
+    */
+    bool Dequeue(T& item);
+
+private:
+    // Segment header is followed by its items storage
+    struct alignas(128) Segment
+    {
+        std::atomic<size_t> written;
+        std::atomic<Segment*> next;
+
+        T* items() noexcept { return reinterpret_cast<T*>(this + 1); }
+    };
+
+    typedef char cache_line_pad[128];
+
+    cache_line_pad _pad0;
+    const size_t _segment;
+    std::atomic<size_t> _segments;
+    SPSCRingQueue<Segment*> _spare;
+
+    // Producer state
+    cache_line_pad _pad1;
+    Segment* _producer;
+    std::atomic<size_t> _enqueued;
+
+    // Consumer state
+    cache_line_pad _pad2;
+    Segment* _consumer;
+    size_t _read;
+    size_t _written_cache;
+    std::atomic<size_t> _dequeued;
+    cache_line_pad _pad3;
+
+#if defined(CPPCOMMON_INSTRUMENTATION)
+    InstrumentationCounters _instrumentation{"SPSCLinkedRingQueue"};
+#endif
+
+    //! Allocate a new segment or reuse the spare one (producer thread method)
+    Segment* Acquire();
+    //! Recycle the drained segment (consumer thread method)
+    void Recycle(Segment* segment);
+    //! Allocate a new segment
+    Segment* Allocate();
+    //! Free the segment memory
+    void Free(Segment* segment);
+};
+
+/*! \example threads_spsc_linked_ring_queue.cpp Single producer / single consumer wait-free linked ring queue example */
+
+} // namespace CppCommon
+
+#include "spsc_linked_ring_queue.inl"
+
+#endif // CPPCOMMON_THREADS_SPSC_LINKED_RING_QUEUE_H
@@ -0,0 +1,203 @@
+/*!
+    \file spsc_linked_ring_queue.inl
+    \brief Single producer / single consumer wait-free linked ring queue inline implementation
+    \author Ivan Shynkarenka
+    \date 15.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+namespace Internals {
+
+// Spare segments ring queue capacity must be a power of two which holds the given count of segments
+inline size_t SPSCLinkedRingQueueSpare(size_t spare) noexcept
+{
+    size_t capacity = 2;
+    while ((capacity - 1) < spare)
+        capacity <<= 1;
+    return capacity;
+}
+
+} // namespace Internals
+//! @endcond
+
+template<typename T>
+inline SPSCLinkedRingQueue<T>::SPSCLinkedRingQueue(size_t segment, size_t spare)
+    : _segment(segment), _segments(0), _spare(Internals::SPSCLinkedRingQueueSpare(spare)),
+      _producer(nullptr), _enqueued(0), _consumer(nullptr), _read(0), _written_cache(0), _dequeued(0)
+{
+    static_assert(alignof(T) <= alignof(Segment), "Linked ring queue item alignment is too large!");
+    assert((segment > 0) && "Linked ring queue segment size must be greater than zero!");
+
+    memset(_pad0, 0, sizeof(cache_line_pad));
+    memset(_pad1, 0, sizeof(cache_line_pad));
+    memset(_pad2, 0, sizeof(cache_line_pad));
+    memset(_pad3, 0, sizeof(cache_line_pad));
+
+    // Linked ring queue is initialized with the empty segment shared by the producer and the consumer
+    _producer = _consumer = Allocate();
+    if (_producer == nullptr)
+        throw std::bad_alloc();
+}
+
+template<typename T>
+inline SPSCLinkedRingQueue<T>::~SPSCLinkedRingQueue()
+{
+    // Destroy items which were never dequeued and free all segments
+    Segment* segment = _consumer;
+    size_t index = _read;
+    while (segment != nullptr)
+    {
+        const size_t written = segment->written.load(std::memory_order_relaxed);
+        for (; index < written; ++index)
+            segment->items()[index].~T();
+
+        Segment* next = segment->next.load(std::memory_order_relaxed);
+        Free(segment);
+        segment = next;
+        index = 0;
+    }
+
+    Segment* spare;
+    while (_spare.Dequeue(spare))
+        Free(spare);
+}
+
+template<typename T>
+inline size_t SPSCLinkedRingQueue<T>::size() const noexcept
+{
+    const size_t dequeued = _dequeued.load(std::memory_order_acquire);
+    const size_t enqueued = _enqueued.load(std::memory_order_acquire);
+
+    return enqueued - dequeued;
+}
+
+template<typename T>
+inline bool SPSCLinkedRingQueue<T>::Enqueue(const T& item)
+{
+    T temp = item;
+    return Enqueue(std::forward<T>(temp));
+}
+
+template<typename T>
+inline bool SPSCLinkedRingQueue<T>::Enqueue(T&& item)
+{
+    Segment* segment = _producer;
+    size_t index = segment->written.load(std::memory_order_relaxed);
+
+    // Link a new segment when the current one is full
+    if (index == _segment)
+    {
+        Segment* next = Acquire();
+        if (next == nullptr)
+        {
+            CPPCOMMON_INSTRUMENT(_instrumentation, FULL, 1);
+            return false;
+        }
+
+        segment->next.store(next, std::memory_order_release);
+        _producer = segment = next;
+        index = 0;
+    }
+
+    // Store the item value
+    new (&segment->items()[index]) T(std::move(item));
+
+    // Publish the item
+    segment->written.store(index + 1, std::memory_order_release);
+    _enqueued.store(_enqueued.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+
+    return true;
+}
+
+template<typename T>
+inline bool SPSCLinkedRingQueue<T>::Dequeue(T& item)
+{
+    Segment* segment = _consumer;
+
+    // Move to the next segment when the current one is drained
+    if (_read == _segment)
+    {
+        Segment* next = segment->next.load(std::memory_order_acquire);
+        if (next == nullptr)
+        {
+            CPPCOMMON_INSTRUMENT(_instrumentation, EMPTY, 1);
+            return false;
+        }
+
+        // Producer never touches the segment after linking the next one
+        _consumer = next;
+        _read = 0;
+        _written_cache = 0;
+        Recycle(segment);
+        segment = next;
+    }
+
+    // Check if the segment is empty (reload the written cursor only if the cached one is not enough)
+    if (_read == _written_cache)
+    {
+        _written_cache = segment->written.load(std::memory_order_acquire);
+        if (_read == _written_cache)
+        {
+            CPPCOMMON_INSTRUMENT(_instrumentation, EMPTY, 1);
+            return false;
+        }
+    }
+
+    // Get the item value
+    T* value = &segment->items()[_read++];
+    item = std::move(*value);
+    value->~T();
+
+    _dequeued.store(_dequeued.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+
+    return true;
+}
+
+template<typename T>
+inline typename SPSCLinkedRingQueue<T>::Segment* SPSCLinkedRingQueue<T>::Acquire()
+{
+    Segment* segment;
+    if (_spare.Dequeue(segment))
+    {
+        segment->written.store(0, std::memory_order_relaxed);
+        segment->next.store(nullptr, std::memory_order_relaxed);
+        return segment;
+    }
+
+    return Allocate();
+}
+
+template<typename T>
+inline void SPSCLinkedRingQueue<T>::Recycle(Segment* segment)
+{
+    // Release the segment when there are enough spare ones
+    if (!_spare.Enqueue(segment))
+        Free(segment);
+}
+
+template<typename T>
+inline typename SPSCLinkedRingQueue<T>::Segment* SPSCLinkedRingQueue<T>::Allocate()
+{
+    void* memory = ::operator new(sizeof(Segment) + _segment * sizeof(T), std::align_val_t(alignof(Segment)), std::nothrow);
+    if (memory == nullptr)
+        return nullptr;
+
+    Segment* segment = new (memory) Segment();
+    segment->written.store(0, std::memory_order_relaxed);
+    segment->next.store(nullptr, std::memory_order_relaxed);
+    _segments.fetch_add(1, std::memory_order_relaxed);
+    return segment;
+}
+
+template<typename T>
+inline void SPSCLinkedRingQueue<T>::Free(Segment* segment)
+{
+    segment->~Segment();
+    ::operator delete(segment, std::align_val_t(alignof(Segment)));
+    _segments.fetch_sub(1, std::memory_order_relaxed);
+}
+
+} // namespace CppCommon
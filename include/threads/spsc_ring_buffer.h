@@ -13,6 +13,9 @@
 #include <cassert>
 #include <cstdio>
 #include <cstring>
+#include <limits>
+#include <new>
+#include <span>
 
 namespace CppCommon {
 
@@ -23,6 +26,11 @@ namespace CppCommon {
 
     FIFO order is guaranteed!
 
+    Ring buffer could be emplaced into the given memory (e.g. shared memory)
+    with its data right after the ring buffer object. Emplaced ring buffer does
+    not contain any pointers, so it could be mapped at different addresses in
+    different processes.
+
     Thread-safe.
 
     A combination of the algorithms described by the circular buffers documentation found in the Linux kernel, and the
@@ -44,6 +52,23 @@ public:
     SPSCRingBuffer& operator=(const SPSCRingBuffer&) = delete;
     SPSCRingBuffer& operator=(SPSCRingBuffer&&) = delete;
 
+    //! Get the memory size required to emplace the ring buffer with the given capacity
+    /*!
+        \param capacity - Ring buffer capacity (must be a power of two)
+        \return Required memory size in bytes
+    */
+    static size_t footprint(size_t capacity) noexcept { return sizeof(SPSCRingBuffer) + capacity; }
+
+    //! Emplace a new ring buffer with the given capacity into the given memory
+    /*!
+        Emplaced ring buffer is trivially destructible and must not be deleted.
+
+        \param memory - Memory to emplace the ring buffer (must be at least footprint(capacity) bytes aligned to the cache line)
+        \param capacity - Ring buffer capacity (must be a power of two)
+        \return Pointer to the emplaced ring buffer
+    */
+    static SPSCRingBuffer* Emplace(void* memory, size_t capacity);
+
     //! Check if the buffer is not empty
     explicit operator bool() const noexcept { return !empty(); }
 
@@ -79,19 +104,89 @@ public:
     */
     bool Dequeue(void* data, size_t& size);
 
+    //! Reserve a contiguous region in the ring buffer to write a data in place (single producer thread method)
+    /*!
+        Reserved region is never split by the end of the ring buffer, so serializers
+        could write a message straight into the ring buffer. If the region does not
+        fit into the rest of the ring buffer it is placed at the beginning and the
+        rest of the ring buffer is skipped as a padding. Padding is counted in the
+        ring buffer size until the consumer passes it.
+
+        Reserved size must not be greater than half of the ring buffer capacity!
+        Reserved region is not visible for the consumer until it is committed.
+        Reserve again or call Enqueue() only after the previous reservation is
+        committed.
+
+        Will not block.
+
+        \param size - Reserved region size
+        \return Span of the reserved region or an empty span if the ring buffer is full
+    */
+    std::span<uint8_t> Reserve(size_t size);
+    //! Commit the given count of bytes of the reserved region (single producer thread method)
+    /*!
+        Committed bytes become visible for the consumer. The rest of the reserved
+        region is returned to the ring buffer.
+
+        Will not block.
+
+        \param size - Committed size (must not be greater than the reserved size)
+    */
+    void Commit(size_t size);
+    //! Commit the whole reserved region (single producer thread method)
+    void Commit() { Commit(_reserved_size); }
+
+    //! Peek a contiguous region of the data in the ring buffer to read it in place (single consumer thread method)
+    /*!
+        Peeked region contains all available data up to the end of the ring buffer
+        or up to the padding of the reserved region, so every region written with
+        Reserve() is available as a whole. Peeked data stay in the ring buffer until
+        they are released.
+
+        Will not block.
+
+        \return Span of the peeked region or an empty span if the ring buffer is empty
+    */
+    std::span<const uint8_t> Peek();
+    //! Release the given count of bytes of the peeked region (single consumer thread method)
+    /*!
+        Will not block.
+
+        \param size - Released size (must not be greater than the peeked size)
+    */
+    void Release(size_t size);
+
 private:
+    struct EmplaceTag {};
+
     typedef char cache_line_pad[128];
 
+    //! Initialize the ring buffer with the data right after the ring buffer object
+    SPSCRingBuffer(size_t capacity, EmplaceTag);
+
     cache_line_pad _pad0;
     const size_t _capacity;
     const size_t _mask;
-    uint8_t* const _buffer;
+    uint8_t* const _buffer;     // nullptr for the emplaced ring buffer
 
+    // Each side keeps the cached cursor of the other side on its own cache line
+    // and reloads it only when the cached one is not enough to proceed
     cache_line_pad _pad1;
     std::atomic<size_t> _head;
+    size_t _tail_cache;
+    std::atomic<size_t> _skip;
+    size_t _reserved_head;
+    size_t _reserved_size;
     cache_line_pad _pad2;
     std::atomic<size_t> _tail;
+    size_t _head_cache;
     cache_line_pad _pad3;
+
+    //! Get the ring buffer data
+    uint8_t* storage() const noexcept { return (_buffer != nullptr) ? _buffer : (uint8_t*)(this + 1); }
+
+    //! Get the size of the contiguous readable region at the given tail cursor and skip the padding of the reserved region
+    size_t Readable(size_t& tail, size_t head) const noexcept;
 };
 
 /*! \example threads_spsc_ring_buffer.cpp Single producer / single consumer wait-free ring buffer example */
@@ -8,7 +8,7 @@
 
 namespace CppCommon {
 
-inline SPSCRingBuffer::SPSCRingBuffer(size_t capacity) : _capacity(capacity), _mask(capacity - 1), _buffer(new uint8_t[capacity]), _head(0), _tail(0)
+inline SPSCRingBuffer::SPSCRingBuffer(size_t capacity) : _capacity(capacity), _mask(capacity - 1), _buffer(new uint8_t[capacity]), _head(0), _tail_cache(0), _skip(std::numeric_limits<size_t>::max()), _reserved_head(0), _reserved_size(0), _tail(0), _head_cache(0)
 {
     assert((capacity > 1) && "Ring buffer capacity must be greater than one!");
     assert(((capacity & (capacity - 1)) == 0) && "Ring buffer capacity must be a power of two!");
@@ -19,6 +19,24 @@ inline SPSCRingBuffer::SPSCRingBuffer(size_t capacity) : _capacity(capacity), _m
     memset(_pad3, 0, sizeof(cache_line_pad));
 }
 
+inline SPSCRingBuffer::SPSCRingBuffer(size_t capacity, EmplaceTag) : _capacity(capacity), _mask(capacity - 1), _buffer(nullptr), _head(0), _tail_cache(0), _skip(std::numeric_limits<size_t>::max()), _reserved_head(0), _reserved_size(0), _tail(0), _head_cache(0)
+{
+    assert((capacity > 1) && "Ring buffer capacity must be greater than one!");
+    assert(((capacity & (capacity - 1)) == 0) && "Ring buffer capacity must be a power of two!");
+
+    memset(_pad0, 0, sizeof(cache_line_pad));
+    memset(_pad1, 0, sizeof(cache_line_pad));
+    memset(_pad2, 0, sizeof(cache_line_pad));
+    memset(_pad3, 0, sizeof(cache_line_pad));
+}
+
+inline SPSCRingBuffer* SPSCRingBuffer::Emplace(void* memory, size_t capacity)
+{
+    assert((memory != nullptr) && "Pointer to the memory should not be null!");
+
+    return new (memory) SPSCRingBuffer(capacity, EmplaceTag());
+}
+
 inline size_t SPSCRingBuffer::size() const noexcept
 {
     const size_t head = _head.load(std::memory_order_acquire);
@@ -41,11 +59,15 @@ inline bool SPSCRingBuffer::Enqueue(const void* data, size_t size)
         return false;
 
     const size_t head = _head.load(std::memory_order_relaxed);
-    const size_t tail = _tail.load(std::memory_order_acquire);
 
-    // Check if there is required free space in the ring buffer
-    if ((size + head - tail) > _capacity)
-        return false;
+    // Check if there is required free space in the ring buffer (reload the tail cursor only if the cached one is not enough)
+    if ((size + head - _tail_cache) > _capacity)
+    {
+        _tail_cache = _tail.load(std::memory_order_acquire);
+        if ((size + head - _tail_cache) > _capacity)
+            return false;
+    }
+    const size_t tail = _tail_cache;
 
     // Copy data into the ring buffer
     size_t head_index = head & _mask;
@@ -53,8 +75,9 @@ inline bool SPSCRingBuffer::Enqueue(const void* data, size_t size)
     size_t remain = (tail_index > head_index) ? (tail_index - head_index) : (_capacity - head_index);
     size_t first = (size > remain) ? remain : size;
     size_t last = (size > remain) ? size - remain : 0;
-    memcpy(&_buffer[head_index], (uint8_t*)data, first);
-    memcpy(_buffer, (uint8_t*)data + first, last);
+    uint8_t* buffer = storage();
+    memcpy(&buffer[head_index], (uint8_t*)data, first);
+    memcpy(buffer, (uint8_t*)data + first, last);
 
     // Increase the head cursor
     _head.store(head + size, std::memory_order_release);
@@ -72,30 +95,132 @@ inline bool SPSCRingBuffer::Dequeue(void* data, size_t& size)
         return false;
 
     const size_t tail = _tail.load(std::memory_order_relaxed);
-    const size_t head = _head.load(std::memory_order_acquire);
 
-    // Get the ring buffer size
-    size_t available = head - tail;
-    if (size > available)
-        size = available;
+    // Reload the head cursor only if the cached one is not enough
+    if ((_head_cache - tail) < size)
+        _head_cache = _head.load(std::memory_order_acquire);
+    const size_t head = _head_cache;
+
+    // Copy data from contiguous regions of the ring buffer
+    uint8_t* buffer = storage();
+    size_t count = 0;
+    size_t current = tail;
+    while (count < size)
+    {
+        size_t chunk = Readable(current, head);
+        if (chunk == 0)
+            break;
+        if (chunk > (size - count))
+            chunk = size - count;
+        memcpy((uint8_t*)data + count, &buffer[current & _mask], chunk);
+        current += chunk;
+        count += chunk;
+    }
 
     // Check if the ring buffer is empty
+    size = count;
     if (size == 0)
         return false;
 
-    // Copy data from the ring buffer
-    size_t head_index = head & _mask;
-    size_t tail_index = tail & _mask;
-    size_t remain = (head_index > tail_index) ? (head_index - tail_index) : (_capacity - tail_index);
-    size_t first = (size > remain) ? remain : size;
-    size_t last = (size > remain) ? size - remain : 0;
-    memcpy((uint8_t*)data, &_buffer[tail_index], first);
-    memcpy((uint8_t*)data + first, _buffer, last);
+    // Increase the tail cursor
+    _tail.store(current, std::memory_order_release);
+
+    return true;
+}
+
+inline std::span<uint8_t> SPSCRingBuffer::Reserve(size_t size)
+{
+    assert((size <= (_capacity / 2)) && "Reserved size should not be greater than half of the ring buffer capacity!");
+    if ((size == 0) || (size > (_capacity / 2)))
+        return std::span<uint8_t>();
+
+    const size_t head = _head.load(std::memory_order_relaxed);
+
+    // Skip the rest of the ring buffer if the reserved region does not fit into it
+    const size_t contiguous = _capacity - (head & _mask);
+    const size_t padding = (size > contiguous) ? contiguous : 0;
+
+    // Check if there is required free space in the ring buffer (reload the tail cursor only if the cached one is not enough)
+    if ((padding + size + head - _tail_cache) > _capacity)
+    {
+        _tail_cache = _tail.load(std::memory_order_acquire);
+        if ((padding + size + head - _tail_cache) > _capacity)
+            return std::span<uint8_t>();
+    }
+
+    _reserved_head = head + padding;
+    _reserved_size = size;
+
+    return std::span<uint8_t>(&storage()[_reserved_head & _mask], size);
+}
+
+inline void SPSCRingBuffer::Commit(size_t size)
+{
+    assert((size <= _reserved_size) && "Committed size should not be greater than the reserved size!");
+    if (size > _reserved_size)
+        size = _reserved_size;
+
+    if (size > 0)
+    {
+        // Publish the padding before the committed region
+        const size_t head = _head.load(std::memory_order_relaxed);
+        if (_reserved_head != head)
+            _skip.store(head, std::memory_order_relaxed);
+
+        // Increase the head cursor
+        _head.store(_reserved_head + size, std::memory_order_release);
+    }
+
+    _reserved_size = 0;
+}
+
+inline std::span<const uint8_t> SPSCRingBuffer::Peek()
+{
+    const size_t tail = _tail.load(std::memory_order_relaxed);
+    const size_t head = _head_cache = _head.load(std::memory_order_acquire);
+
+    size_t current = tail;
+    const size_t size = Readable(current, head);
+    if (size == 0)
+        return std::span<const uint8_t>();
+
+    // Pass the padding of the reserved region
+    if (current != tail)
+        _tail.store(current, std::memory_order_release);
+
+    return std::span<const uint8_t>(&storage()[current & _mask], size);
+}
+
+inline void SPSCRingBuffer::Release(size_t size)
+{
+    const size_t tail = _tail.load(std::memory_order_relaxed);
+
+    assert((size <= (_head_cache - tail)) && "Released size should not be greater than the peeked size!");
 
     // Increase the tail cursor
     _tail.store(tail + size, std::memory_order_release);
+}
 
-    return true;
+inline size_t SPSCRingBuffer::Readable(size_t& tail, size_t head) const noexcept
+{
+    // Readable region is limited with the end of the ring buffer
+    const size_t boundary = (tail | _mask) + 1;
+    if (head <= boundary)
+        return head - tail;
+
+    // At most one padding could be between cursors, it is published with the head passed the end of the ring buffer
+    const size_t skip = _skip.load(std::memory_order_relaxed);
+    if ((skip < tail) || (skip >= boundary))
+        return boundary - tail;
+
+    // Pass the padding
+    if (skip == tail)
+    {
+        tail = boundary;
+        return head - tail;
+    }
+
+    return skip - tail;
 }
 
 } // namespace CppCommon
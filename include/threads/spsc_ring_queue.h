@@ -9,10 +9,16 @@
 #ifndef CPPCOMMON_THREADS_SPSC_RING_QUEUE_H
 #define CPPCOMMON_THREADS_SPSC_RING_QUEUE_H
 
+#include "threads/instrumentation.h"
+
+#include <algorithm>
 #include <atomic>
 #include <cassert>
 #include <cstdio>
 #include <cstring>
+#include <iterator>
+#include <new>
+#include <type_traits>
 #include <utility>
 
 namespace CppCommon {
@@ -24,6 +30,15 @@ namespace CppCommon {
 
     FIFO order is guaranteed!
 
+    Ring queue of trivially copyable items could be emplaced into the given
+    memory (e.g. shared memory) with its items right after the ring queue object.
+    Emplaced ring queue does not contain any pointers, so it could be mapped at
+    different addresses in different processes.
+
+    With CPPCOMMON_INSTRUMENTATION definition the ring queue counts rejected
+    enqueues (full) and rejected dequeues (empty) (see InstrumentationRegistry).
+    Emplaced ring queue is not instrumented.
+
     Thread-safe.
 
     A combination of the algorithms described by the circular buffers documentation found in the Linux kernel, and the
@@ -46,6 +61,23 @@ public:
     SPSCRingQueue& operator=(const SPSCRingQueue&) = delete;
     SPSCRingQueue& operator=(SPSCRingQueue&&) = delete;
 
+    //! Get the memory size required to emplace the ring queue with the given capacity
+    /*!
+        \param capacity - Ring queue capacity (must be a power of two)
+        \return Required memory size in bytes
+    */
+    static size_t footprint(size_t capacity) noexcept { return offset() + capacity * sizeof(T); }
+
+    //! Emplace a new ring queue with the given capacity into the given memory
+    /*!
+        Emplaced ring queue is trivially destructible and must not be deleted.
+
+        \param memory - Memory to emplace the ring queue (must be at least footprint(capacity) bytes aligned to the cache line)
+        \param capacity - Ring queue capacity (must be a power of two)
+        \return Pointer to the emplaced ring queue
+    */
+    static SPSCRingQueue* Emplace(void* memory, size_t capacity);
+
     //! Check if the queue is not empty
     explicit operator bool() const noexcept { return !empty(); }
 
@@ -88,19 +120,65 @@ public:
     */
     bool Dequeue(T& item);
 
+    //! Enqueue a batch of items into the ring queue (single producer thread method)
+    /*!
+        Items will be copied into the ring queue (use std::move_iterator to move them).
+        The whole batch is published with a single atomic operation.
+
+        Will not block.
+
+        \param first - Iterator to the first item to enqueue
+        \param last - Iterator to the end of items to enqueue
+        \return Count of enqueued items from the beginning of the given range (less than the range size if the ring queue is full)
+    */
+    template <class TIterator>
+    size_t EnqueueBulk(TIterator first, TIterator last);
+
+    //! Dequeue a batch of items from the ring queue (single consumer thread method)
+    /*!
+        Items will be moved from the ring queue into the output iterator.
+        The whole batch is released with a single atomic operation.
+
+        Will not block.
+
+        \param output - Output iterator
+        \param max - Max count of items to dequeue
+        \return Count of dequeued items (zero if the ring queue is empty)
+    */
+    template <class TOutputIterator>
+    size_t DequeueBulk(TOutputIterator output, size_t max);
+
 private:
+    struct EmplaceTag {};
+
     typedef char cache_line_pad[128];
 
+    //! Initialize the ring queue with items right after the ring queue object
+    SPSCRingQueue(size_t capacity, EmplaceTag);
+
     cache_line_pad _pad0;
     const size_t _capacity;
     const size_t _mask;
-    T* const _buffer;
+    T* const _buffer;           // nullptr for the emplaced ring queue
 
+    // Each side keeps the cached cursor of the other side on its own cache line
+    // and reloads it only when the cached one is not enough to proceed
     cache_line_pad _pad1;
     std::atomic<size_t> _head;
+    size_t _tail_cache;
     cache_line_pad _pad2;
     std::atomic<size_t> _tail;
+    size_t _head_cache;
     cache_line_pad _pad3;
+
+#if defined(CPPCOMMON_INSTRUMENTATION)
+    InstrumentationCounters _instrumentation{"SPSCRingQueue"};
+#endif
+
+    //! Get the offset of emplaced items
+    static constexpr size_t offset() noexcept { return (sizeof(SPSCRingQueue) + alignof(T) - 1) & ~(alignof(T) - 1); }
+    //! Get the ring queue items
+    T* storage() const noexcept { return (_buffer != nullptr) ? _buffer : (T*)((uint8_t*)this + offset()); }
 };
 
 /*! \example threads_spsc_ring_queue.cpp Single producer / single consumer wait-free ring queue example */
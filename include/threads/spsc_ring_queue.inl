@@ -9,7 +9,7 @@
 namespace CppCommon {
 
 template<typename T>
-inline SPSCRingQueue<T>::SPSCRingQueue(size_t capacity) : _capacity(capacity - 1), _mask(capacity - 1), _buffer(new T[capacity]), _head(0), _tail(0)
+inline SPSCRingQueue<T>::SPSCRingQueue(size_t capacity) : _capacity(capacity - 1), _mask(capacity - 1), _buffer(new T[capacity]), _head(0), _tail_cache(0), _tail(0), _head_cache(0)
 {
     assert((capacity > 1) && "Ring queue capacity must be greater than one!");
     assert(((capacity & (capacity - 1)) == 0) && "Ring queue capacity must be a power of two!");
@@ -20,6 +20,38 @@ inline SPSCRingQueue<T>::SPSCRingQueue(size_t capacity) : _capacity(capacity - 1
     memset(_pad3, 0, sizeof(cache_line_pad));
 }
 
+template<typename T>
+inline SPSCRingQueue<T>::SPSCRingQueue(size_t capacity, EmplaceTag) : _capacity(capacity - 1), _mask(capacity - 1), _buffer(nullptr), _head(0), _tail_cache(0), _tail(0), _head_cache(0)
+#if defined(CPPCOMMON_INSTRUMENTATION)
+    // Emplaced ring queue could be shared between processes, so its instrumentation is detached
+    , _instrumentation()
+#endif
+{
+    assert((capacity > 1) && "Ring queue capacity must be greater than one!");
+    assert(((capacity & (capacity - 1)) == 0) && "Ring queue capacity must be a power of two!");
+
+    memset(_pad0, 0, sizeof(cache_line_pad));
+    memset(_pad1, 0, sizeof(cache_line_pad));
+    memset(_pad2, 0, sizeof(cache_line_pad));
+    memset(_pad3, 0, sizeof(cache_line_pad));
+}
+
+template<typename T>
+inline SPSCRingQueue<T>* SPSCRingQueue<T>::Emplace(void* memory, size_t capacity)
+{
+    static_assert(std::is_trivially_copyable<T>::value, "Emplaced ring queue items must be trivially copyable!");
+    assert((memory != nullptr) && "Pointer to the memory should not be null!");
+
+    SPSCRingQueue* queue = new (memory) SPSCRingQueue(capacity, EmplaceTag());
+
+    // Initialize emplaced items
+    T* items = queue->storage();
+    for (size_t i = 0; i < capacity; ++i)
+        new (&items[i]) T();
+
+    return queue;
+}
+
 template<typename T>
 inline size_t SPSCRingQueue<T>::size() const noexcept
 {
@@ -40,14 +72,20 @@ template<typename T>
 inline bool SPSCRingQueue<T>::Enqueue(T&& item)
 {
     const size_t head = _head.load(std::memory_order_relaxed);
-    const size_t tail = _tail.load(std::memory_order_acquire);
 
-    // Check if the ring queue is full
-    if (((head - tail + 1) & _mask) == 0)
-        return false;
+    // Check if the ring queue is full (reload the tail cursor only if the cached one is not enough)
+    if (((head - _tail_cache + 1) & _mask) == 0)
+    {
+        _tail_cache = _tail.load(std::memory_order_acquire);
+        if (((head - _tail_cache + 1) & _mask) == 0)
+        {
+            CPPCOMMON_INSTRUMENT(_instrumentation, FULL, 1);
+            return false;
+        }
+    }
 
     // Store the item value
-    _buffer[head & _mask] = std::move(item);
+    storage()[head & _mask] = std::move(item);
 
     // Increase the head cursor
     _head.store(head + 1, std::memory_order_release);
@@ -59,14 +97,20 @@ template<typename T>
 inline bool SPSCRingQueue<T>::Dequeue(T& item)
 {
     const size_t tail = _tail.load(std::memory_order_relaxed);
-    const size_t head = _head.load(std::memory_order_acquire);
 
-    // Check if the ring queue is empty
-    if (((head - tail) & _mask) == 0)
-        return false;
+    // Check if the ring queue is empty (reload the head cursor only if the cached one is not enough)
+    if (((_head_cache - tail) & _mask) == 0)
+    {
+        _head_cache = _head.load(std::memory_order_acquire);
+        if (((_head_cache - tail) & _mask) == 0)
+        {
+            CPPCOMMON_INSTRUMENT(_instrumentation, EMPTY, 1);
+            return false;
+        }
+    }
 
     // Get the item value
-    item = std::move(_buffer[tail & _mask]);
+    item = std::move(storage()[tail & _mask]);
 
     // Increase the tail cursor
     _tail.store(tail + 1, std::memory_order_release);
@@ -74,4 +118,61 @@ inline bool SPSCRingQueue<T>::Dequeue(T& item)
     return true;
 }
 
+template<typename T>
+template <class TIterator>
+inline size_t SPSCRingQueue<T>::EnqueueBulk(TIterator first, TIterator last)
+{
+    const size_t head = _head.load(std::memory_order_relaxed);
+    const size_t required = (size_t)std::distance(first, last);
+
+    // Calculate the count of free slots (reload the tail cursor only if the cached one is not enough)
+    if ((_capacity - (head - _tail_cache)) < required)
+        _tail_cache = _tail.load(std::memory_order_acquire);
+    const size_t count = std::min(_capacity - (head - _tail_cache), required);
+    if (count == 0)
+    {
+        if (required > 0)
+            CPPCOMMON_INSTRUMENT(_instrumentation, FULL, 1);
+        return 0;
+    }
+
+    // Store item values
+    T* buffer = storage();
+    for (size_t i = 0; i < count; ++i, ++first)
+        buffer[(head + i) & _mask] = *first;
+
+    // Increase the head cursor
+    _head.store(head + count, std::memory_order_release);
+
+    return count;
+}
+
+template<typename T>
+template <class TOutputIterator>
+inline size_t SPSCRingQueue<T>::DequeueBulk(TOutputIterator output, size_t max)
+{
+    const size_t tail = _tail.load(std::memory_order_relaxed);
+
+    // Calculate the count of available items (reload the head cursor only if the cached one is not enough)
+    if ((_head_cache - tail) < max)
+        _head_cache = _head.load(std::memory_order_acquire);
+    const size_t count = std::min(_head_cache - tail, max);
+    if (count == 0)
+    {
+        if (max > 0)
+            CPPCOMMON_INSTRUMENT(_instrumentation, EMPTY, 1);
+        return 0;
+    }
+
+    // Get item values
+    T* buffer = storage();
+    for (size_t i = 0; i < count; ++i)
+        *output++ = std::move(buffer[(tail + i) & _mask]);
+
+    // Increase the tail cursor
+    _tail.store(tail + count, std::memory_order_release);
+
+    return count;
+}
+
 } // namespace CppCommon
@@ -10,9 +10,11 @@
 #define CPPCOMMON_THREADS_THREAD_H
 
 #include "errors/exceptions_handler.h"
+#include "system/cpu.h"
 #include "time/timestamp.h"
 
 #include <bitset>
+#include <string>
 #include <thread>
 
 //! Current thread Id macro
@@ -44,6 +46,56 @@ enum class ThreadPriority : uint8_t
 template <class TOutputStream>
 TOutputStream& operator<<(TOutputStream& stream, ThreadPriority priority);
 
+//! Thread scheduling policies
+enum class ThreadScheduling : uint8_t
+{
+    NORMAL,     //!< Normal time-sharing scheduling (SCHED_OTHER)
+    FIFO,       //!< Real-time first in, first out scheduling (SCHED_FIFO)
+    RR          //!< Real-time round-robin scheduling (SCHED_RR)
+};
+
+//! Stream output: Thread scheduling policies
+/*!
+    \param stream - Output stream
+    \param scheduling - Thread scheduling policy
+    \return Output stream
+*/
+template <class TOutputStream>
+TOutputStream& operator<<(TOutputStream& stream, ThreadScheduling scheduling);
+
+//! Latency-critical thread setup
+/*!
+    Setup of the busy-polling thread which removes the main sources of its
+    jitter: scheduler preemption, page faults, migrations between logical
+    processors and timer slack (see Thread::SetupLatencyCritical()).
+*/
+struct ThreadLatencySetup
+{
+    ThreadScheduling scheduling{ThreadScheduling::FIFO};   //!< Scheduling policy
+    int priority{80};                                       //!< Real-time scheduling priority (1-99)
+    int cpu{-1};                                            //!< Logical processor to pin the thread (-1 - keep the current affinity)
+    bool lock_memory{true};                                 //!< Lock all current and future pages of the process in memory
+    size_t prefault_stack{256 * 1024};                      //!< Size of the thread stack to pre-fault in bytes (0 - do not pre-fault)
+    uint64_t timer_slack{1};                                //!< Timer slack in nanoseconds (0 - keep the current timer slack)
+};
+
+//! Thread metadata
+/*!
+    Thread metadata is computed once per thread on the first access and cached
+    in the thread-local storage, so reading it costs a single thread-local
+    load. It is suitable for profilers, loggers and tracing spans.
+
+    Thread name and CPU affinity are kept up to date when they are changed
+    with Thread::SetName() and Thread::SetAffinity() of the current thread.
+*/
+struct ThreadInfo
+{
+    uint32_t index{0};              //!< Dense thread index (see Thread::CurrentThreadIndex())
+    uint64_t tid{0};                //!< Operating system thread Id (kernel tid on Linux)
+    char name[16]{};                //!< Thread name (up to 15 characters, zero terminated)
+    std::bitset<64> affinity{};     //!< Thread CPU affinity bitset (first 64 logical processors)
+};
+
 //! Thread abstraction
 /*!
     Thread contains different kinds of thread manipulation  functionality  such  as
@@ -75,6 +127,40 @@ public:
     */
     static uint32_t CurrentThreadAffinity() noexcept;
 
+    //! Get the current thread metadata
+    /*!
+        Metadata is computed on the first call in the thread. Later calls read
+        it from the thread-local storage.
+
+        \return Current thread metadata
+    */
+    static const ThreadInfo& CurrentThreadInfo() noexcept;
+    //! Get the current thread dense index
+    /*!
+        Dense indexes are in range [0, ThreadIndexCount()) and could be used to
+        address per-thread counter arrays. Index of the finished thread is
+        reused by the next thread, so the smallest free index is always taken.
+
+        \return Current thread dense index
+    */
+    static uint32_t CurrentThreadIndex() noexcept { return CurrentThreadInfo().index; }
+    //! Get the count of allocated dense thread indexes
+    /*!
+        \return Upper bound of all dense thread indexes allocated so far
+    */
+    static uint32_t ThreadIndexCount() noexcept;
+
+    //! Get the current thread name
+    static std::string GetName() { return CurrentThreadInfo().name; }
+    //! Set the current thread name
+    /*!
+        Thread name is truncated to 15 characters which is the limit of Linux.
+        It is visible in debuggers, perf and top.
+
+        \param name - Thread name
+    */
+    static void SetName(const std::string& name);
+
     //! Start a new thread with an exception handler registered
     /*!
         Works the same way as std::thread() does but also register an exception handler
@@ -132,6 +218,51 @@ public:
     */
     static void SetAffinity(std::thread& thread, const std::bitset<64>& affinity);
 
+    //! Get the current thread CPU affinity set
+    /*!
+        In contrast to GetAffinity() supports systems with more than 64 logical processors.
+
+        \return CPU affinity set of the current thread
+    */
+    static CPUSet GetAffinitySet();
+    //! Get the given thread CPU affinity set
+    /*!
+        \param thread - Thread
+        \return CPU affinity set of the given thread
+    */
+    static CPUSet GetAffinitySet(std::thread& thread);
+
+    //! Set the current thread CPU affinity set
+    /*!
+        In contrast to SetAffinity() with 64 bits mask supports systems with
+        more than 64 logical processors. On Windows logical processors of
+        multiple processor groups are supported since Windows 11 and Windows
+        Server 2022, otherwise they must belong to the same processor group.
+
+        \param affinity - Thread CPU affinity set
+    */
+    static void SetAffinity(const CPUSet& affinity);
+    //! Set the given thread CPU affinity set
+    /*!
+        \param thread - Thread
+        \param affinity - Thread CPU affinity set
+    */
+    static void SetAffinity(std::thread& thread, const CPUSet& affinity);
+
+    //! Get NUMA node of the logical processor running the current thread
+    static int CurrentThreadNode();
+    //! Bind the current thread and its memory to the given NUMA node
+    /*!
+        Thread CPU affinity is set to logical processors of the given NUMA node.
+        Memory allocations of the thread are preferred from the given NUMA node
+        (on Windows the NUMA node of the thread ideal processor is used), and
+        fall back to other NUMA nodes when the node memory is exhausted.
+
+        \param node - NUMA node index (-1 to unbind the current thread from NUMA node)
+        \param memory - Bind thread memory allocations (default is true)
+    */
+    static void BindToNode(int node, bool memory = true);
+
     //! Get the current thread priority
     /*!
         \return Priority of the current thread
@@ -155,6 +286,55 @@ public:
         \param priority - Thread priority
     */
     static void SetPriority(std::thread& thread, ThreadPriority priority);
+
+    //! Get the current thread scheduling policy
+    static ThreadScheduling GetScheduling();
+    //! Set the current thread scheduling policy
+    /*!
+        Real-time scheduling policies require privileges (CAP_SYS_NICE or
+        RLIMIT_RTPRIO on Linux). Windows registers the thread in Multimedia
+        Class Scheduler Service (MMCSS) for real-time scheduling policies and
+        maps their priority to MMCSS priorities.
+
+        \param scheduling - Thread scheduling policy
+        \param priority - Real-time scheduling priority (1-99, ignored for ThreadScheduling::NORMAL)
+    */
+    static void SetScheduling(ThreadScheduling scheduling, int priority = 50);
+
+    //! Set the current thread timer slack
+    /*!
+        Timer slack is the time which the kernel might add to sleeps and
+        timeouts of the thread to group wakeups (50 microseconds by default).
+        Supported only on Linux, other platforms ignore it.
+
+        \param nanoseconds - Timer slack in nanoseconds (0 - reset to the default timer slack)
+    */
+    static void SetTimerSlack(uint64_t nanoseconds);
+
+    //! Pre-fault the given size of the current thread stack
+    /*!
+        Touches stack pages below the current stack frame, so they are
+        mapped before the latency-critical code uses them. Pages stay
+        resident if the process memory is locked.
+
+        \param size - Size of the stack to pre-fault in bytes
+    */
+    static void PrefaultStack(size_t size);
+
+    //! Setup the current thread as the latency-critical one
+    /*!
+        Performs the following steps in order:
+        - locks all current and future pages of the process in memory
+          (mlockall, Windows ignores it);
+        - pins the thread to the given logical processor (an isolated one is
+          preferable, see CPU::Isolated());
+        - reduces the timer slack;
+        - pre-faults the thread stack;
+        - switches the thread to the real-time scheduling policy.
+
+        \param setup - Latency-critical thread setup (default is ThreadLatencySetup())
+    */
+    static void SetupLatencyCritical(const ThreadLatencySetup& setup = ThreadLatencySetup());
 };
 
 /*! \example threads_thread.cpp Thread example */
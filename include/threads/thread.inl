@@ -41,6 +41,27 @@ inline TOutputStream& operator<<(TOutputStream& stream, ThreadPriority priority)
     return stream;
 }
 
+template <class TOutputStream>
+inline TOutputStream& operator<<(TOutputStream& stream, ThreadScheduling scheduling)
+{
+    switch (scheduling)
+    {
+        case ThreadScheduling::NORMAL:
+            stream << "NORMAL";
+            break;
+        case ThreadScheduling::FIFO:
+            stream << "FIFO";
+            break;
+        case ThreadScheduling::RR:
+            stream << "RR";
+            break;
+        default:
+            stream << "<unknown>";
+            break;
+    }
+    return stream;
+}
+
 template <class Fn, class... Args>
 inline std::thread Thread::Start(Fn&& fn, Args&&... args)
 {
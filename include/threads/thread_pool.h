@@ -0,0 +1,150 @@
+/*!
+    \file thread_pool.h
+    \brief Work-stealing thread pool definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_THREAD_POOL_H
+#define CPPCOMMON_THREADS_THREAD_POOL_H
+
+#include "common/function.h"
+#include "memory/object_pool.h"
+#include "threads/mpmc_ring_queue.h"
+#include "threads/wait_strategy.h"
+#include "threads/work_stealing_deque.h"
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace CppCommon {
+
+//! Thread pool workers affinity policy
+enum class ThreadPoolAffinity
+{
+    NONE,           //!< Workers are not pinned and scheduled by the operating system
+    PHYSICAL_CORES  //!< Each worker is pinned to its own core (workers count is limited with CPU::PhysicalCores())
+};
+
+//! Work-stealing thread pool
+/*!
+    Work-stealing thread pool runs submitted tasks in the fixed set of worker
+    threads. Each worker owns a lock-free work-stealing deque: tasks submitted
+    from the worker thread are pushed to its own deque and popped in LIFO order,
+    so nested tasks stay hot in the worker cache. Tasks submitted from other
+    threads are placed into the shared injection queue. Idle worker takes tasks
+    from the injection queue and steals the oldest tasks from other workers.
+    Workers without any work spin for a while and then park on the wait strategy,
+    so notification costs a system call only when some worker is parked.
+
+    Tasks are allocation free move-only functions (so they could capture
+    move-only objects) kept in the lock-free object pool, so submitting a
+    task does not allocate once the object pool is warmed up. If
+    the task could not be queued (all queues or the object pool are exhausted)
+    it is executed in the submitting thread.
+
+    All submitted tasks are executed before the thread pool is destroyed.
+
+    Thread-safe.
+*/
+class ThreadPool
+{
+public:
+    //! Thread pool task
+    typedef UniqueFunction<void(), 256> Task;
+
+    //! Initialize the thread pool with a given workers count and affinity policy
+    /*!
+        \param threads - Workers count (default is 0 - CPU::PhysicalCores())
+        \param affinity - Workers affinity policy (default is ThreadPoolAffinity::NONE)
+        \param capacity - Capacity of each worker deque and the injection queue (must be a power of two, default is 4096)
+    */
+    explicit ThreadPool(size_t threads = 0, ThreadPoolAffinity affinity = ThreadPoolAffinity::NONE, size_t capacity = 4096);
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool(ThreadPool&&) = delete;
+    ~ThreadPool();
+
+    ThreadPool& operator=(const ThreadPool&) = delete;
+    ThreadPool& operator=(ThreadPool&&) = delete;
+
+    //! Get workers count
+    size_t threads() const noexcept { return _workers.size(); }
+    //! Get workers affinity policy
+    ThreadPoolAffinity affinity() const noexcept { return _affinity; }
+    //! Get count of tasks executed in submitting threads because of exhausted queues
+    uint64_t overflows() const noexcept { return _overflows.load(std::memory_order_relaxed); }
+
+    //! Get the index of the current worker in the thread pool
+    /*!
+        \return Index of the current worker or -1 if the current thread is not a worker of the thread pool
+    */
+    int CurrentWorker() const noexcept;
+
+    //! Submit a task into the thread pool
+    /*!
+        Task is called as task() in one of worker threads.
+
+        Will not block.
+
+        \param task - Task to submit
+    */
+    template <class TTask>
+    void Submit(TTask&& task);
+
+private:
+    // Task node
+    struct Node
+    {
+        Task task;
+
+        template <class TTask>
+        explicit Node(TTask&& t) : task(std::forward<TTask>(t)) {}
+    };
+
+    typedef char cache_line_pad[128];
+
+    // Worker is padded with cache line to avoid false sharing of neighbour worker deques
+    struct Worker
+    {
+        ThreadPool* pool;
+        size_t index;
+        uint64_t random;
+        WorkStealingDeque<Node*> deque;
+        std::thread thread;
+        cache_line_pad pad;
+
+        Worker(ThreadPool* p, size_t i, size_t capacity) : pool(p), index(i), random(i + 1), deque(capacity) {}
+    };
+
+    ThreadPoolAffinity _affinity;
+    DefaultMemoryManager _auxiliary;
+    ObjectPool<Node> _nodes;
+    MPMCRingQueue<Node*> _injection;
+    std::vector<std::unique_ptr<Worker>> _workers;
+    WaitStrategy _idle;
+    std::atomic<bool> _stop;
+    std::atomic<uint64_t> _overflows;
+
+    static thread_local Worker* _current;
+
+    //! Worker thread loop
+    void Run(Worker& worker);
+    //! Find the next task for the given worker
+    Node* Find(Worker& worker);
+    //! Is there any queued task?
+    bool Pending() const noexcept;
+    //! Execute the given task node and release it
+    void Execute(Node* node);
+};
+
+/*! \example threads_thread_pool.cpp Work-stealing thread pool example */
+
+} // namespace CppCommon
+
+#include "thread_pool.inl"
+
+#endif // CPPCOMMON_THREADS_THREAD_POOL_H
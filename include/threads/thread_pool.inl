@@ -0,0 +1,39 @@
+/*!
+    \file thread_pool.inl
+    \brief Work-stealing thread pool inline implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+template <class TTask>
+inline void ThreadPool::Submit(TTask&& task)
+{
+    Node* node = _nodes.Create(std::forward<TTask>(task));
+    if (node == nullptr)
+    {
+        // Object pool is exhausted, so the task was not consumed
+        _overflows.fetch_add(1, std::memory_order_relaxed);
+        Task overflow(std::forward<TTask>(task));
+        overflow();
+        return;
+    }
+
+    // Push the task into the current worker deque or into the injection queue
+    Worker* worker = _current;
+    if ((worker == nullptr) || (worker->pool != this) || !worker->deque.Push(node))
+    {
+        if (!_injection.Enqueue(node))
+        {
+            _overflows.fetch_add(1, std::memory_order_relaxed);
+            Execute(node);
+            return;
+        }
+    }
+
+    _idle.Notify();
+}
+
+} // namespace CppCommon
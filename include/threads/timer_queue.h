@@ -0,0 +1,252 @@
+/*!
+    \file timer_queue.h
+    \brief Timer queue definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_TIMER_QUEUE_H
+#define CPPCOMMON_THREADS_TIMER_QUEUE_H
+
+#include "common/function.h"
+#include "time/timespan.h"
+#include "time/timestamp.h"
+
+#include <atomic>
+#include <cassert>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace CppCommon {
+
+//! Timer queue
+/*!
+    Timer queue runs callbacks at the given deadlines of the NanoTimestamp
+    timeline. Timers are kept in the hierarchical timer wheel of 4 levels with
+    256 slots each (the same layout as TimerWheel). Each slot is an intrusive
+    doubly linked list of timer nodes, so both scheduling and cancellation are
+    O(1). Timer handle packs the node index together with the node generation,
+    so stale handles of fired or cancelled timers are safely rejected.
+
+    Timer wheel resolution only groups timers into slots, deadlines are still
+    compared with nanosecond precision, so callbacks are never called before
+    their deadlines.
+
+    Timer queue could be driven by the caller with Tick() method (e.g. from an
+    event loop) or by the dedicated thread started with Start() method, which
+    sleeps until the nearest deadline. Expired callbacks are called without the
+    timer queue lock, so callbacks may schedule and cancel other timers.
+
+    Periodic timers could drive maintenance tasks such as MemCache watchdog:
+    \code
+    timers.SchedulePeriodic(Timespan::seconds(1), [&cache]() { cache.watchdog(); });
+    \endcode
+
+    Callbacks must not throw.
+
+    Thread-safe.
+*/
+class TimerQueue
+{
+public:
+    //! Timer callback
+    typedef Function<void(), 256> Callback;
+    //! Timer handle (0 - invalid handle)
+    typedef uint64_t Handle;
+
+    //! Initialize the timer queue with a given timer wheel resolution
+    /*!
+        \param resolution - Timer wheel resolution (default is 1 millisecond)
+    */
+    explicit TimerQueue(const Timespan& resolution = Timespan::milliseconds(1));
+    TimerQueue(const TimerQueue&) = delete;
+    TimerQueue(TimerQueue&&) = delete;
+    ~TimerQueue();
+
+    TimerQueue& operator=(const TimerQueue&) = delete;
+    TimerQueue& operator=(TimerQueue&&) = delete;
+
+    //! Check if the timer queue is not empty
+    explicit operator bool() const { return !empty(); }
+
+    //! Is the timer queue empty?
+    bool empty() const { return size() == 0; }
+
+    //! Get the count of active timers
+    size_t size() const;
+    //! Get the timer wheel resolution
+    Timespan resolution() const noexcept { return Timespan((int64_t)_resolution); }
+
+    //! Is the dedicated timer thread running?
+    bool IsRunning() const noexcept { return _running.load(std::memory_order_acquire); }
+
+    //! Schedule the callback at the given deadline
+    /*!
+        \param deadline - Deadline in the NanoTimestamp timeline
+        \param callback - Timer callback
+        \return Timer handle
+    */
+    template <class TCallback>
+    Handle Schedule(const Timestamp& deadline, TCallback&& callback)
+    { return Insert(deadline.total(), 0, Callback(std::forward<TCallback>(callback))); }
+    //! Schedule the callback after the given delay
+    /*!
+        \param delay - Delay from now
+        \param callback - Timer callback
+        \return Timer handle
+    */
+    template <class TCallback>
+    Handle ScheduleAfter(const Timespan& delay, TCallback&& callback)
+    { return Schedule(NanoTimestamp() + delay, std::forward<TCallback>(callback)); }
+    //! Schedule the periodic callback with the given period
+    /*!
+        Periodic timer keeps the fixed rate. If the timer queue falls behind for
+        more than a period, missed calls are skipped instead of called in burst.
+
+        \param period - Timer period (must be positive)
+        \param callback - Timer callback
+        \return Timer handle
+    */
+    template <class TCallback>
+    Handle SchedulePeriodic(const Timespan& period, TCallback&& callback)
+    { return SchedulePeriodic(NanoTimestamp() + period, period, std::forward<TCallback>(callback)); }
+    //! Schedule the periodic callback with the given first deadline and period
+    /*!
+        \param deadline - First deadline in the NanoTimestamp timeline
+        \param period - Timer period (must be positive)
+        \param callback - Timer callback
+        \return Timer handle
+    */
+    template <class TCallback>
+    Handle SchedulePeriodic(const Timestamp& deadline, const Timespan& period, TCallback&& callback);
+
+    //! Cancel the timer with the given handle
+    /*!
+        If the callback of the timer is running right now, it is not waited for,
+        but the periodic timer will not be scheduled again.
+
+        \param handle - Timer handle
+        \return 'true' if the timer was cancelled before its callback was called, 'false' if the timer is fired, running or already cancelled
+    */
+    bool Cancel(Handle handle);
+
+    //! Get the nearest deadline
+    /*!
+        The nearest deadline might be earlier than the real one if timers are
+        not yet cascaded to the first level of the timer wheel.
+
+        \return Nearest deadline in the NanoTimestamp timeline or Timestamp(0) if the timer queue is empty
+    */
+    Timestamp NextDeadline() const;
+
+    //! Call callbacks of expired timers
+    /*!
+        Callbacks are called in the calling thread. Concurrent ticks are serialized.
+
+        \param now - Current timestamp in the NanoTimestamp timeline (default is NanoTimestamp())
+        \param limit - Called callbacks limit (default is 0 - unlimited)
+        \return Count of called callbacks
+    */
+    size_t Tick(const Timestamp& now = NanoTimestamp(), size_t limit = 0);
+
+    //! Start the dedicated timer thread
+    /*!
+        \return 'true' if the timer thread was started, 'false' if it is already running
+    */
+    bool Start();
+    //! Stop the dedicated timer thread
+    /*!
+        Active timers are kept and could be called by the next Tick() or Start().
+
+        \return 'true' if the timer thread was stopped, 'false' if it is not running
+    */
+    bool Stop();
+
+private:
+    static const size_t LEVELS = 4;
+    static const size_t SLOT_BITS = 8;
+    static const size_t SLOTS = (size_t)1 << SLOT_BITS;
+    static const size_t SLOT_MASK = SLOTS - 1;
+    static const uint32_t NIL = 0xFFFFFFFF;
+
+    enum class TimerState : uint8_t { FREE, SCHEDULED, RUNNING };
+
+    // Timer node
+    struct Timer
+    {
+        uint32_t index;
+        uint32_t prev;
+        uint32_t next;
+        uint32_t slot;
+        uint32_t generation;
+        TimerState state;
+        bool cancelled;
+        uint64_t tick;
+        uint64_t expire;
+        uint64_t period;
+        Callback callback;
+
+        explicit Timer(uint32_t i) : index(i), prev(NIL), next(NIL), slot(NIL), generation(1), state(TimerState::FREE), cancelled(false), tick(0), expire(0), period(0) {}
+    };
+
+    mutable std::mutex _lock;
+    std::condition_variable _cv;
+    uint64_t _resolution;
+    uint64_t _current;
+    size_t _size;
+    size_t _active;
+    size_t _counts[LEVELS];
+    std::vector<uint32_t> _slots;
+    std::deque<Timer> _timers;
+    uint32_t _free;
+    uint64_t _wakeup;           // Wake up deadline of the waiting timer thread (0 - not waiting)
+
+    // Tick state
+    std::mutex _tick_lock;
+    std::vector<Timer*> _expired;
+
+    // Dedicated timer thread
+    std::mutex _thread_lock;
+    std::thread _thread;
+    std::atomic<bool> _running;
+    bool _stop;
+
+    //! Pack the timer handle with the given generation and index
+    static Handle MakeHandle(uint32_t generation, uint32_t index) noexcept { return ((uint64_t)generation << 32) | index; }
+    //! Get the timer wheel tick of the given timestamp
+    uint64_t ticks(uint64_t timestamp) const noexcept { return timestamp / _resolution; }
+
+    //! Insert a new timer
+    Handle Insert(uint64_t expire, uint64_t period, Callback&& callback);
+    //! Link the timer into the timer wheel slot
+    void Link(uint32_t index);
+    //! Unlink the timer from its timer wheel slot
+    void Unlink(uint32_t index);
+    //! Release the timer node
+    void Release(uint32_t index);
+    //! Redistribute timers of far levels which slots are reached by the current tick
+    void Cascade();
+    //! Collect expired timers
+    void Collect(uint64_t now, size_t limit);
+    //! Get the nearest deadline with the timer queue locked
+    uint64_t Nearest() const;
+    //! Call the timer callback
+    static void Call(Callback& callback) noexcept { callback(); }
+
+    //! Dedicated timer thread loop
+    void Run();
+};
+
+/*! \example threads_timer_queue.cpp Timer queue example */
+
+} // namespace CppCommon
+
+#include "timer_queue.inl"
+
+#endif // CPPCOMMON_THREADS_TIMER_QUEUE_H
@@ -0,0 +1,19 @@
+/*!
+    \file timer_queue.inl
+    \brief Timer queue inline implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+template <class TCallback>
+inline TimerQueue::Handle TimerQueue::SchedulePeriodic(const Timestamp& deadline, const Timespan& period, TCallback&& callback)
+{
+    assert((period.total() > 0) && "Timer period must be positive!");
+    uint64_t interval = (period.total() > 0) ? (uint64_t)period.total() : 1;
+    return Insert(deadline.total(), interval, Callback(std::forward<TCallback>(callback)));
+}
+
+} // namespace CppCommon
@@ -0,0 +1,146 @@
+/*!
+    \file tree_barrier.h
+    \brief Combining tree spin barrier synchronization primitive definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_TREE_BARRIER_H
+#define CPPCOMMON_THREADS_TREE_BARRIER_H
+
+#include "threads/wait_strategy.h"
+
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <memory>
+#include <thread>
+
+namespace CppCommon {
+
+//! Combining tree spin barrier synchronization primitive
+/*!
+    Combining tree barrier spreads arrivals of threads over the tree of counters
+    instead of a single shared counter of SpinBarrier. Each thread arrives at its
+    leaf node, which is shared with only fan-in threads. The last thread arrived
+    at the node continues to the parent node, and the last thread arrived at the
+    root node releases the barrier phase. Tree nodes and the phase are padded
+    with cache line, so arriving threads of different nodes never contend on the
+    same cache line, and waiting threads spin only reading their cached phase
+    until it is changed once by the releasing thread.
+
+    Barrier supports the split phase API like std::barrier: Arrive() registers
+    the thread at the barrier and returns the token, Wait() blocks until all
+    threads arrive at the phase of the token. So threads could overlap the
+    barrier with some independent work. Each thread must wait for its token
+    before it arrives at the barrier again.
+
+    Spin version: waiting threads spin with CPU relax instructions and then
+    yield the CPU to another thread.
+
+    Thread-safe.
+
+    https://en.wikipedia.org/wiki/Barrier_(computer_science)
+*/
+class TreeBarrier
+{
+public:
+    //! Barrier arrival token
+    struct Token
+    {
+        uint64_t phase;     //!< Arrived barrier phase
+        bool last;          //!< Is the thread the last one arrived at the phase?
+    };
+
+    //! Default class constructor
+    /*!
+        \param threads - Count of threads to wait at the barrier
+        \param fanin - Count of children of each tree node (default is 4)
+    */
+    explicit TreeBarrier(int threads, int fanin = 4);
+    TreeBarrier(const TreeBarrier&) = delete;
+    TreeBarrier(TreeBarrier&&) = delete;
+    ~TreeBarrier() = default;
+
+    TreeBarrier& operator=(const TreeBarrier&) = delete;
+    TreeBarrier& operator=(TreeBarrier&&) = delete;
+
+    //! Get the count of threads to wait at the barrier
+    int threads() const noexcept { return _threads; }
+    //! Get the count of children of each tree node
+    int fanin() const noexcept { return _fanin; }
+    //! Get the current barrier phase
+    uint64_t phase() const noexcept { return _phase.load(std::memory_order_acquire); }
+
+    //! Arrive at the barrier
+    /*!
+        Will not block.
+
+        \param thread - Thread index in range [0, threads)
+        \return Arrival token to wait for
+    */
+    Token Arrive(int thread) noexcept;
+
+    //! Is the phase of the given token completed?
+    /*!
+        Will not block.
+
+        \param token - Arrival token
+        \return 'true' if all threads arrived at the phase of the token, 'false' otherwise
+    */
+    bool IsReady(const Token& token) const noexcept
+    { return _phase.load(std::memory_order_acquire) != token.phase; }
+
+    //! Wait until all threads arrive at the phase of the given token
+    /*!
+        Will block.
+
+        \param token - Arrival token
+        \return 'true' for the last thread that reach barrier, 'false' for each of the remaining threads
+    */
+    bool Wait(const Token& token) const noexcept;
+
+    //! Arrive at the barrier and wait until all other threads reach this barrier
+    /*!
+        Will block.
+
+        \param thread - Thread index in range [0, threads)
+        \return 'true' for the last thread that reach barrier, 'false' for each of the remaining threads
+    */
+    bool Wait(int thread) noexcept
+    { return Wait(Arrive(thread)); }
+
+private:
+    static const uint32_t NIL = 0xFFFFFFFF;
+    // Count of spin iterations before yield
+    static const uint32_t SPINS = 128;
+
+    typedef char cache_line_pad[128];
+
+    // Tree node is padded with cache line to avoid false sharing of neighbour nodes
+    struct Node
+    {
+        std::atomic<uint32_t> count;
+        uint32_t expected;
+        uint32_t parent;
+        cache_line_pad pad;
+
+        Node() : count(0), expected(0), parent(NIL) {}
+    };
+
+    cache_line_pad _pad0;
+    std::atomic<uint64_t> _phase;
+    cache_line_pad _pad1;
+    int _threads;
+    int _fanin;
+    std::unique_ptr<Node[]> _nodes;
+};
+
+/*! \example threads_tree_barrier.cpp Combining tree spin barrier synchronization primitive example */
+
+} // namespace CppCommon
+
+#include "tree_barrier.inl"
+
+#endif // CPPCOMMON_THREADS_TREE_BARRIER_H
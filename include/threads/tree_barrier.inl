@@ -0,0 +1,61 @@
+/*!
+    \file tree_barrier.inl
+    \brief Combining tree spin barrier synchronization primitive inline implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+inline TreeBarrier::Token TreeBarrier::Arrive(int thread) noexcept
+{
+    assert(((thread >= 0) && (thread < _threads)) && "Barrier thread index is out of range!");
+
+    // Remember the current barrier phase
+    Token token = { _phase.load(std::memory_order_acquire), false };
+
+    // Climb the tree while the thread is the last one arrived at the node
+    uint32_t index = (uint32_t)(thread / _fanin);
+    for (;;)
+    {
+        Node& node = _nodes[index];
+        if (node.count.fetch_sub(1, std::memory_order_acq_rel) != 1)
+            break;
+
+        // Reset the node for the next phase. No thread of the node subtree could arrive before the phase is released
+        node.count.store(node.expected, std::memory_order_relaxed);
+
+        if (node.parent == NIL)
+        {
+            // Release the barrier phase
+            _phase.fetch_add(1, std::memory_order_release);
+            token.last = true;
+            break;
+        }
+
+        index = node.parent;
+    }
+
+    return token;
+}
+
+inline bool TreeBarrier::Wait(const Token& token) const noexcept
+{
+    // Spin-wait and then yield-wait for the next barrier phase
+    uint32_t spins = 0;
+    while (!IsReady(token))
+    {
+        if (spins < SPINS)
+        {
+            WaitStrategy::Relax();
+            ++spins;
+        }
+        else
+            std::this_thread::yield();
+    }
+
+    return token.last;
+}
+
+} // namespace CppCommon
@@ -9,19 +9,91 @@
 #ifndef CPPCOMMON_THREADS_WAIT_BATCHER_H
 #define CPPCOMMON_THREADS_WAIT_BATCHER_H
 
-#include "condition_variable.h"
+#include "coroutine.h"
+#include "critical_section.h"
+#include "mpmc_ring_queue.h"
+#include "wait_strategy.h"
 
+#include <algorithm>
+#include <bit>
 #include <cassert>
+#include <iterator>
 #include <vector>
 
 namespace CppCommon {
 
+//! @cond INTERNALS
+namespace Internals {
+
+//! Lock-free ring with the overflow batch
+/*!
+    Items are enqueued into the lock-free ring until it is full, then they are
+    appended to the overflow batch under the lock until the overflow batch is
+    taken. Consumer takes all ring items and then swaps the whole overflow
+    batch, so the burst is consumed with a single lock. Ring items are always
+    older than overflow items, so FIFO order is kept.
+
+    Overflow batch is double-buffered: it is preallocated for the ring capacity
+    and swapped with the consumer's cleared vector, which is grown up to the
+    overflow batch capacity if necessary. Enqueue does not allocate in steady
+    state when the consumer reuses its vector.
+*/
+template<typename T>
+class OverflowBatch
+{
+public:
+    //! Default class constructor
+    /*!
+        \param capacity - Ring capacity (must be a power of two)
+    */
+    explicit OverflowBatch(size_t capacity) : _ring(capacity), _overflowed(0) { _overflow.reserve(capacity); }
+    OverflowBatch(const OverflowBatch&) = delete;
+    OverflowBatch(OverflowBatch&&) = delete;
+    ~OverflowBatch() = default;
+
+    OverflowBatch& operator=(const OverflowBatch&) = delete;
+    OverflowBatch& operator=(OverflowBatch&&) = delete;
+
+    //! Get ring capacity
+    size_t capacity() const noexcept { return _ring.capacity(); }
+
+    //! Enqueue an item into the ring or into the overflow batch
+    void Enqueue(T&& item);
+    //! Dequeue items from the ring and from the overflow batch
+    /*!
+        \param items - Items to append
+        \param max - Max count of ring items to dequeue
+        \return Count of dequeued items
+    */
+    size_t Dequeue(std::vector<T>& items, size_t max);
+
+private:
+    MPMCRingQueue<T> _ring;
+    std::atomic<size_t> _overflowed;
+    CriticalSection _cs;
+    std::vector<T> _overflow;
+
+    //! Dequeue up to the given count of ring items
+    size_t DequeueRing(std::vector<T>& items, size_t max);
+};
+
+} // namespace Internals
+//! @endcond
+
 //! Multiple producers / multiple consumers wait batcher
 /*!
-    Multiple producers / multiple consumers wait batcher provides a classic solution
-    for producer-consumer problem using two vectors and hot-swap technique with monitor
-    synchronization primitive (mutex with condition variable). It allows a consumer thread
-    to process all items in queue in a batch mode.
+    Multiple producers / multiple consumers wait batcher provides a blocking solution
+    for producer-consumer problem using lock-free ring and wait strategies. It allows
+    a consumer thread to process all items in queue in a batch mode. Enqueue and batch
+    dequeue of the batcher which is neither empty nor full take only atomic operations.
+    Producers and consumers spin, yield and finally park only when they actually wait,
+    so notifications make system calls only for parked ones.
+
+    Items which do not fit into the lock-free ring (initial capacity) are collected
+    in the overflow batch under the lock, which is swapped by the consumer as the
+    whole. Consumer's cleared vector becomes the next overflow batch, so reusing
+    the same vector for dequeue keeps both buffers warm and enqueue does not
+    allocate in steady state.
 
     FIFO order is guaranteed!
 
@@ -34,7 +106,7 @@ public:
     //! Default class constructor
     /*!
         \param capacity - Wait batcher capacity (0 for unlimited capacity, default is 0)
-        \param initial - Initial wait batcher capacity (default is 0)
+        \param initial - Initial wait batcher capacity of the lock-free ring (will be rounded up to the power of two, default is 0 for 1024 items)
     */
     explicit WaitBatcher(size_t capacity = 0, size_t initial = 0);
     WaitBatcher(const WaitBatcher&) = delete;
@@ -79,13 +151,14 @@ public:
     bool Enqueue(T&& item);
     //! Enqueue all items into the wait batcher
     /*!
-        All items will be copied into the wait batcher.
+        All items will be copied into the wait batcher. Consumers are notified
+        once for the whole range of items unless the wait batcher is full.
 
         Will block.
 
         \param first - Iterator to the first item
         \param last - Iterator to the last item
-        \return 'true' if all items were successfully enqueue, 'false' if the wait batcher is closed
+        \return 'true' if all items were successfully enqueue, 'false' if the wait batcher is closed (some items might be already enqueued)
     */
     template <class InputIterator>
     bool Enqueue(InputIterator first, InputIterator last);
@@ -99,6 +172,24 @@ public:
     */
     bool Dequeue(std::vector<T>& items);
 
+#if defined(CPPCOMMON_COROUTINES)
+    //! Dequeue all items from the wait batcher asynchronously
+    /*!
+        Items vector will be swapped with the wait batcher batch. Use with co_await:
+        the coroutine is suspended without blocking the thread until some items
+        arrive and then resumed in the given scheduler.
+
+        Will not block.
+
+        \param items - Items to dequeue
+        \param scheduler - Coroutine scheduler to resume in (e.g. ThreadPool or InlineScheduler)
+        \return Awaiter with result 'true' if all items was successfully dequeue, 'false' if the wait batcher is closed
+    */
+    template <class TScheduler>
+    AsyncDequeueAwaiter<WaitBatcher<T>, std::vector<T>, TScheduler> DequeueAsync(std::vector<T>& items, TScheduler& scheduler)
+    { return AsyncDequeueAwaiter<WaitBatcher<T>, std::vector<T>, TScheduler>(*this, items, scheduler); }
+#endif
+
     //! Close the wait batcher
     /*!
         Will block.
@@ -106,12 +197,45 @@ public:
     void Close();
 
 private:
-    bool _closed;
     const size_t _capacity;
+    Internals::WaitCounter _counter;
+    Internals::OverflowBatch<T> _queue;
+    WaitStrategy _producers;
+    WaitStrategy _consumers;
+    std::atomic<size_t> _async;
     mutable CriticalSection _cs;
-    ConditionVariable _cv1;
-    ConditionVariable _cv2;
-    std::vector<T> _batch;
+    Internals::AsyncWaiters _waiters;
+
+#if defined(CPPCOMMON_COROUTINES)
+    template <class, typename, class>
+    friend class AsyncDequeueAwaiter;
+#endif
+
+    //! Reserve the item or wait for the free space
+    /*!
+        \return 'true' if the item was successfully reserved, 'false' if the wait batcher is closed
+    */
+    bool Reserve();
+    //! Enqueue the reserved item
+    void Publish(T&& item);
+    //! Notify consumers about enqueued items
+    void Notify();
+    //! Try to dequeue all items and release them
+    /*!
+        \param items - Items to dequeue
+        \param finished - 'true' if the closed wait batcher becomes empty
+        \return 'true' if some items were successfully dequeue, 'false' if the wait batcher is empty
+    */
+    bool TryDequeue(std::vector<T>& items, bool& finished);
+    //! Hand over items to asynchronous waiters or resume them if the closed wait batcher is empty
+    void HandOver();
+    //! Hand over items to asynchronous waiters under the lock
+    void HandOver(Internals::AsyncResumer& resumer);
+    //! Dequeue the batch into the asynchronous waiter or register it
+    /*!
+        \return 'true' if the waiter was registered, 'false' if the waiter is completed
+    */
+    bool SuspendAsync(Internals::AsyncWaiter& waiter);
 };
 
 /*! \example threads_wait_batcher.cpp Multiple producers / multiple consumers wait batcher example */
@@ -8,10 +8,79 @@
 
 namespace CppCommon {
 
+//! @cond INTERNALS
+namespace Internals {
+
+template<typename T>
+inline void OverflowBatch<T>::Enqueue(T&& item)
+{
+    if ((_overflowed.load(std::memory_order_acquire) == 0) && _ring.Enqueue(std::move(item)))
+        return;
+
+    Locker<CriticalSection> locker(_cs);
+
+    // Ring could be drained while the lock was acquired
+    if (!_overflow.empty() || !_ring.Enqueue(std::move(item)))
+    {
+        _overflow.emplace_back(std::move(item));
+        _overflowed.store(_overflow.size(), std::memory_order_release);
+    }
+}
+
+template<typename T>
+inline size_t OverflowBatch<T>::Dequeue(std::vector<T>& items, size_t max)
+{
+    size_t count = DequeueRing(items, max);
+    if ((count == max) || (_overflowed.load(std::memory_order_acquire) == 0))
+        return count;
+
+    Locker<CriticalSection> locker(_cs);
+
+    // Ring items are older than overflow items
+    count += DequeueRing(items, max - count);
+    if ((count == max) || _overflow.empty())
+        return count;
+
+    count += _overflow.size();
+    if (items.empty())
+    {
+        // Swap in the consumer's cleared vector and keep the overflow batch capacity warm
+        size_t reserved = _overflow.capacity();
+        std::swap(items, _overflow);
+        _overflow.reserve(reserved);
+    }
+    else
+    {
+        items.insert(items.end(), std::make_move_iterator(_overflow.begin()), std::make_move_iterator(_overflow.end()));
+        _overflow.clear();
+    }
+
+    _overflowed.store(0, std::memory_order_release);
+    return count;
+}
+
+template<typename T>
+inline size_t OverflowBatch<T>::DequeueRing(std::vector<T>& items, size_t max)
+{
+    size_t count = 0;
+    T item;
+    while ((count < max) && _ring.Dequeue(item))
+    {
+        items.emplace_back(std::move(item));
+        ++count;
+    }
+    return count;
+}
+
+} // namespace Internals
+//! @endcond
+
 template<typename T>
-inline WaitBatcher<T>::WaitBatcher(size_t capacity, size_t initial) : _closed(false),  _capacity(capacity)
+inline WaitBatcher<T>::WaitBatcher(size_t capacity, size_t initial)
+    : _capacity(capacity),
+      _queue((initial > 0) ? std::bit_ceil(std::max(initial, (size_t)2)) : 1024),
+      _async(0)
 {
-    _batch.reserve(initial);
 }
 
 template<typename T>
@@ -23,8 +92,7 @@ inline WaitBatcher<T>::~WaitBatcher()
 template<typename T>
 inline bool WaitBatcher<T>::closed() const
 {
-    Locker<CriticalSection> locker(_cs);
-    return _closed;
+    return _counter.closed();
 }
 
 template<typename T>
@@ -33,125 +101,221 @@ inline size_t WaitBatcher<T>::capacity() const
     if (_capacity > 0)
         return _capacity;
 
-    Locker<CriticalSection> locker(_cs);
-    return _batch.capacity();
+    return std::max(_queue.capacity(), _counter.size());
 }
 
 template<typename T>
 inline size_t WaitBatcher<T>::size() const
 {
-    Locker<CriticalSection> locker(_cs);
-    return _batch.size();
+    return _counter.size();
 }
 
 template<typename T>
 inline bool WaitBatcher<T>::Enqueue(const T& item)
 {
-    Locker<CriticalSection> locker(_cs);
+    T temp = item;
+    return Enqueue(std::forward<T>(temp));
+}
 
-    if (_closed)
+template<typename T>
+inline bool WaitBatcher<T>::Enqueue(T&& item)
+{
+    if (!Reserve())
         return false;
 
-    do
+    Publish(std::move(item));
+    Notify();
+    return true;
+}
+
+template<typename T>
+template <class InputIterator>
+inline bool WaitBatcher<T>::Enqueue(InputIterator first, InputIterator last)
+{
+    size_t published = 0;
+
+    for (; first != last; ++first)
     {
-        if ((_capacity == 0) || (_batch.size() < _capacity))
+        if (!_counter.Reserve(_capacity))
         {
-            _batch.push_back(item);
-            _cv1.NotifyOne();
-            return true;
+            // Notify consumers about published items before waiting for the free space
+            if (published > 0)
+            {
+                Notify();
+                published = 0;
+            }
+
+            if (!Reserve())
+                return false;
         }
 
-        _cv2.Wait(_cs, [this]() { return (_closed || (_capacity == 0) || (_batch.size() < _capacity)); });
+        T temp = *first;
+        Publish(std::move(temp));
+        ++published;
+    }
 
-    } while (!_closed);
+    if (published > 0)
+        Notify();
 
-    return false;
+    return true;
 }
 
 template<typename T>
-inline bool WaitBatcher<T>::Enqueue(T&& item)
+inline bool WaitBatcher<T>::Dequeue(std::vector<T>& items)
 {
-    Locker<CriticalSection> locker(_cs);
+    // Clear the result items vector
+    items.clear();
 
-    if (_closed)
-        return false;
+    bool result = false;
+    bool finished = false;
 
-    do
-    {
-        if ((_capacity == 0) || (_batch.size() < _capacity))
-        {
-            _batch.emplace_back(item);
-            _cv1.NotifyOne();
-            return true;
-        }
+    _consumers.Wait([this, &items, &result, &finished]() { return (result = TryDequeue(items, finished)) || _counter.finished(); });
 
-        _cv2.Wait(_cs, [this]() { return (_closed || (_capacity == 0) || (_batch.size() < _capacity)); });
+    // Resume asynchronous waiters of the closed wait batcher which becomes empty
+    if (finished)
+        HandOver();
 
-    } while (!_closed);
+    return result;
+}
 
-    return false;
+template<typename T>
+inline void WaitBatcher<T>::Close()
+{
+    _counter.Close();
+    _producers.Notify();
+    _consumers.Notify();
+    HandOver();
 }
 
 template<typename T>
-template <class InputIterator>
-inline bool WaitBatcher<T>::Enqueue(InputIterator first, InputIterator last)
+inline bool WaitBatcher<T>::Reserve()
 {
-    Locker<CriticalSection> locker(_cs);
+    while (!_counter.Reserve(_capacity))
+    {
+        if (_counter.closed())
+            return false;
 
-    if (_closed)
-        return false;
+        _producers.Wait([this]() { return !_counter.IsFull(_capacity); });
+    }
+
+    return true;
+}
 
-    do
+template<typename T>
+inline void WaitBatcher<T>::Publish(T&& item)
+{
+    try
+    {
+        _queue.Enqueue(std::move(item));
+    }
+    catch (...)
     {
-        if ((_capacity == 0) || (_batch.size() < _capacity))
+        // Release the reserved item which is not enqueued
+        if (_counter.Release())
         {
-            _batch.insert(_batch.end(), first, last);
-            _cv1.NotifyOne();
-            return true;
+            _consumers.Notify();
+            HandOver();
         }
+        throw;
+    }
+}
+
+template<typename T>
+inline void WaitBatcher<T>::Notify()
+{
+    // Notify() fence also orders enqueued items before the asynchronous waiters check
+    _consumers.Notify();
+    if (_async.load(std::memory_order_relaxed) > 0)
+        HandOver();
+}
+
+template<typename T>
+inline bool WaitBatcher<T>::TryDequeue(std::vector<T>& items, bool& finished)
+{
+    // Items enqueued during the dequeue are left for the next batch
+    size_t count = _counter.size();
+    if (count == 0)
+        return false;
+
+    // Grow the result items vector once for the whole batch
+    items.reserve(items.size() + count);
+
+    size_t dequeued = _queue.Dequeue(items, count);
+    if (dequeued == 0)
+        return false;
 
-        _cv2.Wait(_cs, [this]() { return (_closed || (_capacity == 0) || (_batch.size() < _capacity)); });
+    finished = _counter.Release(dequeued);
+    if (_capacity > 0)
+        _producers.Notify();
+    if (finished)
+        _consumers.Notify();
 
-    } while (!_closed);
+    return true;
+}
 
-    return false;
+template<typename T>
+inline void WaitBatcher<T>::HandOver()
+{
+    Internals::AsyncResumer resumer;
+    Locker<CriticalSection> locker(_cs);
+    HandOver(resumer);
 }
 
 template<typename T>
-inline bool WaitBatcher<T>::Dequeue(std::vector<T>& items)
+inline void WaitBatcher<T>::HandOver(Internals::AsyncResumer& resumer)
+{
+    Internals::AsyncWaiter* waiter;
+    while ((waiter = _waiters.front()) != nullptr)
+    {
+        bool finished = false;
+        bool result = TryDequeue(*(std::vector<T>*)waiter->data, finished);
+
+        // Waiters are resumed with the failed result only when the closed wait batcher is empty
+        if (!result && !_counter.finished())
+            break;
+
+        _waiters.Pop();
+        _async.fetch_sub(1, std::memory_order_relaxed);
+        resumer.Add(waiter, result);
+    }
+}
+
+template<typename T>
+inline bool WaitBatcher<T>::SuspendAsync(Internals::AsyncWaiter& waiter)
 {
+    std::vector<T>& items = *(std::vector<T>*)waiter.data;
+
     // Clear the result items vector
     items.clear();
 
+    Internals::AsyncResumer resumer;
     Locker<CriticalSection> locker(_cs);
 
-    if (_closed && _batch.empty())
-        return false;
+    // Register the waiter before the last check, so it could not be missed by the producer which enqueues items after the check
+    _async.fetch_add(1, std::memory_order_seq_cst);
 
-    do
+    bool finished = false;
+    if (TryDequeue(items, finished))
     {
-        if (!_batch.empty())
-        {
-            // Swap batch items
-            std::swap(_batch, items);
-            _cv2.NotifyOne();
-            return true;
-        }
+        _async.fetch_sub(1, std::memory_order_relaxed);
+        waiter.result = true;
 
-        _cv1.Wait(_cs, [this]() { return (_closed || !_batch.empty()); });
+        // Resume other asynchronous waiters of the closed wait batcher which becomes empty
+        if (finished)
+            HandOver(resumer);
 
-    } while (!_closed || !_batch.empty());
+        return false;
+    }
 
-    return false;
-}
+    if (_counter.finished())
+    {
+        _async.fetch_sub(1, std::memory_order_relaxed);
+        waiter.result = false;
+        return false;
+    }
 
-template<typename T>
-inline void WaitBatcher<T>::Close()
-{
-    Locker<CriticalSection> locker(_cs);
-    _closed = true;
-    _cv1.NotifyAll();
-    _cv2.NotifyAll();
+    _waiters.Push(&waiter);
+    return true;
 }
 
 } // namespace CppCommon
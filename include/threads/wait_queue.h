@@ -9,17 +9,80 @@
 #ifndef CPPCOMMON_THREADS_WAIT_QUEUE_H
 #define CPPCOMMON_THREADS_WAIT_QUEUE_H
 
-#include "condition_variable.h"
-
+#include "coroutine.h"
+#include "critical_section.h"
+#include "mpmc_ring_queue.h"
+#include "wait_strategy.h"
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <iterator>
+#include <limits>
 #include <queue>
+#include <vector>
 
 namespace CppCommon {
 
+//! @cond INTERNALS
+namespace Internals {
+
+//! Lock-free ring with the overflow queue
+/*!
+    Items are enqueued into the lock-free ring until it is full, then they are
+    enqueued into the overflow queue under the lock until the overflow queue
+    becomes empty. Consumer which takes the item from the overflow queue moves
+    remaining overflow items into the ring, so the burst does not leave the
+    container locked. Ring items are always older than overflow items, so FIFO
+    order is kept.
+*/
+template<typename T>
+class OverflowRing
+{
+public:
+    //! Default class constructor
+    /*!
+        \param capacity - Ring capacity (must be a power of two)
+    */
+    explicit OverflowRing(size_t capacity) : _ring(capacity), _overflowed(0) {}
+    OverflowRing(const OverflowRing&) = delete;
+    OverflowRing(OverflowRing&&) = delete;
+    ~OverflowRing() = default;
+
+    OverflowRing& operator=(const OverflowRing&) = delete;
+    OverflowRing& operator=(OverflowRing&&) = delete;
+
+    //! Get ring capacity
+    size_t capacity() const noexcept { return _ring.capacity(); }
+
+    //! Enqueue an item into the ring or into the overflow queue
+    void Enqueue(T&& item);
+    //! Dequeue an item from the ring or from the overflow queue
+    /*!
+        \return 'true' if the item was successfully dequeue, 'false' if both the ring and the overflow queue are empty
+    */
+    bool Dequeue(T& item);
+
+private:
+    MPMCRingQueue<T> _ring;
+    std::atomic<size_t> _overflowed;
+    CriticalSection _cs;
+    std::queue<T> _overflow;
+};
+
+} // namespace Internals
+//! @endcond
+
 //! Multiple producers / multiple consumers wait queue
 /*!
-    Multiple producers / multiple consumers wait queue provides a classic solution
-    for producer-consumer problem using queue and monitor synchronization primitive
-    (mutex with condition variable).
+    Multiple producers / multiple consumers wait queue provides a blocking solution
+    for producer-consumer problem using lock-free ring and wait strategies. Enqueue
+    and dequeue of the queue which is neither empty nor full take only atomic
+    operations. Producers and consumers spin, yield and finally park only when they
+    actually wait, so notifications make system calls only for parked ones.
+
+    Items which do not fit into the lock-free ring (1024 items) are kept in the
+    overflow queue under the lock until consumers catch up.
 
     FIFO order is guaranteed!
 
@@ -35,11 +98,11 @@ public:
     */
     explicit WaitQueue(size_t capacity = 0);
     WaitQueue(const WaitQueue&) = delete;
-    WaitQueue(WaitQueue&&) = default;
+    WaitQueue(WaitQueue&&) = delete;
     ~WaitQueue();
 
     WaitQueue& operator=(const WaitQueue&) = delete;
-    WaitQueue& operator=(WaitQueue&&) = default;
+    WaitQueue& operator=(WaitQueue&&) = delete;
 
     //! Check if the wait queue is not empty
     explicit operator bool() const noexcept { return !closed() && !empty(); }
@@ -85,6 +148,52 @@ public:
         \return 'true' if the item was successfully dequeue, 'false' if the wait queue is closed
     */
     bool Dequeue(T& item);
+    //! Dequeue all available items from the wait queue
+    /*!
+        Items will be moved from the wait queue into the cleared items vector. Waits
+        for at least one item, then dequeues all available items (but no more
+        than the given maximum) with a single release of the wait queue counter and
+        a single notification of producers.
+
+        Will block.
+
+        \param items - Items to dequeue
+        \param max - Maximal count of items to dequeue (default is unlimited)
+        \return Count of dequeued items (0 if the wait queue is closed)
+    */
+    size_t Dequeue(std::vector<T>& items, size_t max = std::numeric_limits<size_t>::max());
+    //! Dequeue all available items from the wait queue into the output iterator
+    /*!
+        Items will be moved from the wait queue into the given output iterator.
+        Waits for at least one item, then dequeues all available items (but no
+        more than the given maximum) the same way as the vector overload.
+
+        Will block.
+
+        \param output - Output iterator to dequeue items
+        \param max - Maximal count of items to dequeue (must be greater than zero)
+        \return Count of dequeued items (0 if the wait queue is closed)
+    */
+    template <class TOutputIterator>
+    size_t Dequeue(TOutputIterator output, size_t max);
+
+#if defined(CPPCOMMON_COROUTINES)
+    //! Dequeue an item from the wait queue asynchronously
+    /*!
+        The item will be moved from the wait queue. Use with co_await: the coroutine
+        is suspended without blocking the thread until the item arrives and then
+        resumed in the given scheduler.
+
+        Will not block.
+
+        \param item - Item to dequeue
+        \param scheduler - Coroutine scheduler to resume in (e.g. ThreadPool or InlineScheduler)
+        \return Awaiter with result 'true' if the item was successfully dequeue, 'false' if the wait queue is closed
+    */
+    template <class TScheduler>
+    AsyncDequeueAwaiter<WaitQueue<T>, T, TScheduler> DequeueAsync(T& item, TScheduler& scheduler)
+    { return AsyncDequeueAwaiter<WaitQueue<T>, T, TScheduler>(*this, item, scheduler); }
+#endif
 
     //! Close the wait queue
     /*!
@@ -93,12 +202,45 @@ public:
     void Close();
 
 private:
-    bool _closed;
     const size_t _capacity;
+    Internals::WaitCounter _counter;
+    Internals::OverflowRing<T> _queue;
+    WaitStrategy _producers;
+    WaitStrategy _consumers;
+    std::atomic<size_t> _async;
     mutable CriticalSection _cs;
-    ConditionVariable _cv1;
-    ConditionVariable _cv2;
-    std::queue<T> _queue;
+    Internals::AsyncWaiters _waiters;
+
+#if defined(CPPCOMMON_COROUTINES)
+    template <class, typename, class>
+    friend class AsyncDequeueAwaiter;
+#endif
+
+    //! Try to dequeue the item and release it
+    /*!
+        \param item - Item to dequeue
+        \param finished - 'true' if the closed wait queue becomes empty
+        \return 'true' if the item was successfully dequeue, 'false' if the wait queue is empty
+    */
+    bool TryDequeue(T& item, bool& finished);
+    //! Try to dequeue available items and release them
+    /*!
+        \param output - Output iterator to dequeue items
+        \param max - Maximal count of items to dequeue
+        \param finished - 'true' if the closed wait queue becomes empty
+        \return Count of dequeued items (0 if the wait queue is empty)
+    */
+    template <class TOutputIterator>
+    size_t TryDequeue(TOutputIterator& output, size_t max, bool& finished);
+    //! Hand over items to asynchronous waiters or resume them if the closed wait queue is empty
+    void HandOver();
+    //! Hand over items to asynchronous waiters under the lock
+    void HandOver(Internals::AsyncResumer& resumer);
+    //! Dequeue the item into the asynchronous waiter or register it
+    /*!
+        \return 'true' if the waiter was registered, 'false' if the waiter is completed
+    */
+    bool SuspendAsync(Internals::AsyncWaiter& waiter);
 };
 
 /*! \example threads_wait_queue.cpp Multiple producers / multiple consumers wait queue example */
@@ -8,8 +8,62 @@
 
 namespace CppCommon {
 
+//! @cond INTERNALS
+namespace Internals {
+
+template<typename T>
+inline void OverflowRing<T>::Enqueue(T&& item)
+{
+    if ((_overflowed.load(std::memory_order_acquire) == 0) && _ring.Enqueue(std::move(item)))
+        return;
+
+    Locker<CriticalSection> locker(_cs);
+
+    // Ring could be drained while the lock was acquired
+    if (!_overflow.empty() || !_ring.Enqueue(std::move(item)))
+    {
+        _overflow.push(std::move(item));
+        _overflowed.store(_overflow.size(), std::memory_order_release);
+    }
+}
+
+template<typename T>
+inline bool OverflowRing<T>::Dequeue(T& item)
+{
+    if (_ring.Dequeue(item))
+        return true;
+
+    if (_overflowed.load(std::memory_order_acquire) == 0)
+        return false;
+
+    Locker<CriticalSection> locker(_cs);
+
+    // Ring items are older than overflow items
+    if (_ring.Dequeue(item))
+        return true;
+
+    if (_overflow.empty())
+        return false;
+
+    item = std::move(_overflow.front());
+    _overflow.pop();
+
+    // Move remaining overflow items into the ring to continue without the lock
+    while (!_overflow.empty() && _ring.Enqueue(std::move(_overflow.front())))
+        _overflow.pop();
+
+    _overflowed.store(_overflow.size(), std::memory_order_release);
+    return true;
+}
+
+} // namespace Internals
+//! @endcond
+
 template<typename T>
-inline WaitQueue<T>::WaitQueue(size_t capacity) : _closed(false),  _capacity(capacity)
+inline WaitQueue<T>::WaitQueue(size_t capacity)
+    : _capacity(capacity),
+      _queue(((capacity > 0) && (capacity < 1024)) ? std::bit_ceil(std::max(capacity, (size_t)2)) : 1024),
+      _async(0)
 {
 }
 
@@ -22,8 +76,7 @@ inline WaitQueue<T>::~WaitQueue()
 template<typename T>
 inline bool WaitQueue<T>::closed() const
 {
-    Locker<CriticalSection> locker(_cs);
-    return _closed;
+    return _counter.closed();
 }
 
 template<typename T>
@@ -32,97 +85,209 @@ inline size_t WaitQueue<T>::capacity() const
     if (_capacity > 0)
         return _capacity;
 
-    Locker<CriticalSection> locker(_cs);
-    return _queue.size();
+    return _counter.size();
 }
 
 template<typename T>
 inline size_t WaitQueue<T>::size() const
 {
-    Locker<CriticalSection> locker(_cs);
-    return _queue.size();
+    return _counter.size();
 }
 
 template<typename T>
 inline bool WaitQueue<T>::Enqueue(const T& item)
 {
-    Locker<CriticalSection> locker(_cs);
+    T temp = item;
+    return Enqueue(std::forward<T>(temp));
+}
 
-    if (_closed)
-        return false;
+template<typename T>
+inline bool WaitQueue<T>::Enqueue(T&& item)
+{
+    // Reserve the item or wait for the free space
+    while (!_counter.Reserve(_capacity))
+    {
+        if (_counter.closed())
+            return false;
+
+        _producers.Wait([this]() { return !_counter.IsFull(_capacity); });
+    }
 
-    do
+    try
     {
-        if ((_capacity == 0) || (_queue.size() < _capacity))
+        _queue.Enqueue(std::move(item));
+    }
+    catch (...)
+    {
+        // Release the reserved item which is not enqueued
+        if (_counter.Release())
         {
-            _queue.push(item);
-            _cv1.NotifyOne();
-            return true;
+            _consumers.Notify();
+            HandOver();
         }
+        throw;
+    }
+
+    // Notify() fence also orders the enqueued item before the asynchronous waiters check
+    _consumers.Notify();
+    if (_async.load(std::memory_order_relaxed) > 0)
+        HandOver();
 
-        _cv2.Wait(_cs, [this]() { return (_closed || (_capacity == 0) || (_queue.size() < _capacity)); });
+    return true;
+}
 
-    } while (!_closed);
+template<typename T>
+inline bool WaitQueue<T>::Dequeue(T& item)
+{
+    bool result = false;
+    bool finished = false;
 
-    return false;
+    _consumers.Wait([this, &item, &result, &finished]() { return (result = TryDequeue(item, finished)) || _counter.finished(); });
+
+    // Resume asynchronous waiters of the closed wait queue which becomes empty
+    if (finished)
+        HandOver();
+
+    return result;
 }
 
 template<typename T>
-inline bool WaitQueue<T>::Enqueue(T&& item)
+inline size_t WaitQueue<T>::Dequeue(std::vector<T>& items, size_t max)
 {
-    Locker<CriticalSection> locker(_cs);
+    // Clear the result items vector
+    items.clear();
 
-    if (_closed)
-        return false;
+    return Dequeue(std::back_inserter(items), max);
+}
 
-    do
-    {
-        if ((_capacity == 0) || (_queue.size() < _capacity))
-        {
-            _queue.emplace(item);
-            _cv1.NotifyOne();
-            return true;
-        }
+template<typename T>
+template <class TOutputIterator>
+inline size_t WaitQueue<T>::Dequeue(TOutputIterator output, size_t max)
+{
+    assert((max > 0) && "Maximal count of items to dequeue must be greater than zero!");
 
-        _cv2.Wait(_cs, [this]() { return (_closed || (_capacity == 0) || (_queue.size() < _capacity)); });
+    size_t result = 0;
+    bool finished = false;
 
-    } while (!_closed);
+    _consumers.Wait([this, &output, max, &result, &finished]() { return ((result = TryDequeue(output, max, finished)) > 0) || _counter.finished(); });
 
-    return false;
+    // Resume asynchronous waiters of the closed wait queue which becomes empty
+    if (finished)
+        HandOver();
+
+    return result;
 }
 
 template<typename T>
-inline bool WaitQueue<T>::Dequeue(T& item)
+inline void WaitQueue<T>::Close()
 {
-    Locker<CriticalSection> locker(_cs);
+    _counter.Close();
+    _producers.Notify();
+    _consumers.Notify();
+    HandOver();
+}
 
-    if (_closed && _queue.empty())
+template<typename T>
+inline bool WaitQueue<T>::TryDequeue(T& item, bool& finished)
+{
+    if (!_queue.Dequeue(item))
         return false;
 
-    do
+    finished = _counter.Release();
+    if (_capacity > 0)
+        _producers.Notify();
+    if (finished)
+        _consumers.Notify();
+
+    return true;
+}
+
+template<typename T>
+template <class TOutputIterator>
+inline size_t WaitQueue<T>::TryDequeue(TOutputIterator& output, size_t max, bool& finished)
+{
+    // Items enqueued during the dequeue are left for the next batch
+    size_t count = std::min(_counter.size(), max);
+
+    size_t dequeued = 0;
+    T item;
+    while ((dequeued < count) && _queue.Dequeue(item))
     {
-        if (!_queue.empty())
-        {
-            item = _queue.front();
-            _queue.pop();
-            _cv2.NotifyOne();
-            return true;
-        }
+        *output++ = std::move(item);
+        ++dequeued;
+    }
+
+    if (dequeued == 0)
+        return 0;
 
-        _cv1.Wait(_cs, [this]() { return (_closed || !_queue.empty()); });
+    // Release all dequeued items at once
+    finished = _counter.Release(dequeued);
+    if (_capacity > 0)
+        _producers.Notify();
+    if (finished)
+        _consumers.Notify();
 
-    } while (!_closed || !_queue.empty());
+    return dequeued;
+}
 
-    return false;
+template<typename T>
+inline void WaitQueue<T>::HandOver()
+{
+    Internals::AsyncResumer resumer;
+    Locker<CriticalSection> locker(_cs);
+    HandOver(resumer);
 }
 
 template<typename T>
-inline void WaitQueue<T>::Close()
+inline void WaitQueue<T>::HandOver(Internals::AsyncResumer& resumer)
 {
+    Internals::AsyncWaiter* waiter;
+    while ((waiter = _waiters.front()) != nullptr)
+    {
+        bool finished = false;
+        bool result = TryDequeue(*(T*)waiter->data, finished);
+
+        // Waiters are resumed with the failed result only when the closed wait queue is empty
+        if (!result && !_counter.finished())
+            break;
+
+        _waiters.Pop();
+        _async.fetch_sub(1, std::memory_order_relaxed);
+        resumer.Add(waiter, result);
+    }
+}
+
+template<typename T>
+inline bool WaitQueue<T>::SuspendAsync(Internals::AsyncWaiter& waiter)
+{
+    Internals::AsyncResumer resumer;
     Locker<CriticalSection> locker(_cs);
-    _closed = true;
-    _cv1.NotifyAll();
-    _cv2.NotifyAll();
+
+    // Register the waiter before the last check, so it could not be missed by the producer which enqueues the item after the check
+    _async.fetch_add(1, std::memory_order_seq_cst);
+
+    bool finished = false;
+    if (TryDequeue(*(T*)waiter.data, finished))
+    {
+        _async.fetch_sub(1, std::memory_order_relaxed);
+        waiter.result = true;
+
+        // Resume other asynchronous waiters of the closed wait queue which becomes empty
+        if (finished)
+            HandOver(resumer);
+
+        return false;
+    }
+
+    if (_counter.finished())
+    {
+        _async.fetch_sub(1, std::memory_order_relaxed);
+        waiter.result = false;
+        return false;
+    }
+
+    _waiters.Push(&waiter);
+    return true;
 }
 
 } // namespace CppCommon
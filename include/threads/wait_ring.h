@@ -9,18 +9,26 @@
 #ifndef CPPCOMMON_THREADS_WAIT_RING_H
 #define CPPCOMMON_THREADS_WAIT_RING_H
 
-#include "condition_variable.h"
+#include "coroutine.h"
+#include "critical_section.h"
+#include "mpmc_ring_queue.h"
+#include "wait_strategy.h"
 
+#include <algorithm>
 #include <cassert>
+#include <iterator>
+#include <limits>
 #include <vector>
 
 namespace CppCommon {
 
 //! Multiple producers / multiple consumers wait ring
 /*!
-    Multiple producers / multiple consumers wait ring provides a classic solution
-    for producer-consumer problem using fixed ring and monitor synchronization
-    primitive (mutex with condition variable).
+    Multiple producers / multiple consumers wait ring provides a blocking solution
+    for producer-consumer problem using lock-free ring queue and wait strategies.
+    Enqueue and dequeue of the ring which is neither empty nor full take only atomic
+    operations. Producers and consumers spin, yield and finally park only when they
+    actually wait, so notifications make system calls only for parked ones.
 
     FIFO order is guaranteed!
 
@@ -86,6 +94,52 @@ public:
         \return 'true' if the item was successfully dequeue, 'false' if the wait ring is closed
     */
     bool Dequeue(T& item);
+    //! Dequeue all available items from the wait ring
+    /*!
+        Items will be moved from the wait ring into the cleared items vector. Waits
+        for at least one item, then dequeues all available items (but no more
+        than the given maximum) with a single release of the wait ring counter and
+        a single notification of producers.
+
+        Will block.
+
+        \param items - Items to dequeue
+        \param max - Maximal count of items to dequeue (default is unlimited)
+        \return Count of dequeued items (0 if the wait ring is closed)
+    */
+    size_t Dequeue(std::vector<T>& items, size_t max = std::numeric_limits<size_t>::max());
+    //! Dequeue all available items from the wait ring into the output iterator
+    /*!
+        Items will be moved from the wait ring into the given output iterator.
+        Waits for at least one item, then dequeues all available items (but no
+        more than the given maximum) the same way as the vector overload.
+
+        Will block.
+
+        \param output - Output iterator to dequeue items
+        \param max - Maximal count of items to dequeue (must be greater than zero)
+        \return Count of dequeued items (0 if the wait ring is closed)
+    */
+    template <class TOutputIterator>
+    size_t Dequeue(TOutputIterator output, size_t max);
+
+#if defined(CPPCOMMON_COROUTINES)
+    //! Dequeue an item from the wait ring asynchronously
+    /*!
+        The item will be moved from the wait ring. Use with co_await: the coroutine
+        is suspended without blocking the thread until the item arrives and then
+        resumed in the given scheduler.
+
+        Will not block.
+
+        \param item - Item to dequeue
+        \param scheduler - Coroutine scheduler to resume in (e.g. ThreadPool or InlineScheduler)
+        \return Awaiter with result 'true' if the item was successfully dequeue, 'false' if the wait ring is closed
+    */
+    template <class TScheduler>
+    AsyncDequeueAwaiter<WaitRing<T>, T, TScheduler> DequeueAsync(T& item, TScheduler& scheduler)
+    { return AsyncDequeueAwaiter<WaitRing<T>, T, TScheduler>(*this, item, scheduler); }
+#endif
 
     //! Close the wait ring
     /*!
@@ -94,15 +148,45 @@ public:
     void Close();
 
 private:
-    bool _closed;
-    mutable CriticalSection _cs;
-    ConditionVariable _cv1;
-    ConditionVariable _cv2;
     const size_t _capacity;
-    const size_t _mask;
-    size_t _head;
-    size_t _tail;
-    std::vector<T> _ring;
+    Internals::WaitCounter _counter;
+    MPMCRingQueue<T> _ring;
+    WaitStrategy _producers;
+    WaitStrategy _consumers;
+    std::atomic<size_t> _async;
+    mutable CriticalSection _cs;
+    Internals::AsyncWaiters _waiters;
+
+#if defined(CPPCOMMON_COROUTINES)
+    template <class, typename, class>
+    friend class AsyncDequeueAwaiter;
+#endif
+
+    //! Try to dequeue the item and release its slot
+    /*!
+        \param item - Item to dequeue
+        \param finished - 'true' if the closed wait ring becomes empty
+        \return 'true' if the item was successfully dequeue, 'false' if the wait ring is empty
+    */
+    bool TryDequeue(T& item, bool& finished);
+    //! Try to dequeue available items and release their slots
+    /*!
+        \param output - Output iterator to dequeue items
+        \param max - Maximal count of items to dequeue
+        \param finished - 'true' if the closed wait ring becomes empty
+        \return Count of dequeued items (0 if the wait ring is empty)
+    */
+    template <class TOutputIterator>
+    size_t TryDequeue(TOutputIterator& output, size_t max, bool& finished);
+    //! Hand over items to asynchronous waiters or resume them if the closed wait ring is empty
+    void HandOver();
+    //! Hand over items to asynchronous waiters under the lock
+    void HandOver(Internals::AsyncResumer& resumer);
+    //! Dequeue the item into the asynchronous waiter or register it
+    /*!
+        \return 'true' if the waiter was registered, 'false' if the waiter is completed
+    */
+    bool SuspendAsync(Internals::AsyncWaiter& waiter);
 };
 
 /*! \example threads_wait_ring.cpp Multiple producers / multiple consumers wait ring example */
@@ -9,7 +9,7 @@
 namespace CppCommon {
 
 template<typename T>
-inline WaitRing<T>::WaitRing(size_t capacity) : _closed(false), _capacity(capacity - 1), _mask(capacity - 1), _head(0), _tail(0), _ring(capacity)
+inline WaitRing<T>::WaitRing(size_t capacity) : _capacity(capacity - 1), _ring(capacity), _async(0)
 {
     assert((capacity > 1) && "Ring capacity must be greater than one!");
     assert(((capacity & (capacity - 1)) == 0) && "Ring capacity must be a power of two!");
@@ -24,15 +24,13 @@ inline WaitRing<T>::~WaitRing()
 template<typename T>
 inline bool WaitRing<T>::closed() const
 {
-    Locker<CriticalSection> locker(_cs);
-    return _closed;
+    return _counter.closed();
 }
 
 template<typename T>
 inline size_t WaitRing<T>::size() const
 {
-    Locker<CriticalSection> locker(_cs);
-    return _head - _tail;
+    return _counter.size();
 }
 
 template<typename T>
@@ -45,58 +43,177 @@ inline bool WaitRing<T>::Enqueue(const T& item)
 template<typename T>
 inline bool WaitRing<T>::Enqueue(T&& item)
 {
-    Locker<CriticalSection> locker(_cs);
-
-    if (_closed)
-        return false;
-
-    do
+    // Reserve the ring slot or wait for the free one
+    while (!_counter.Reserve(_capacity))
     {
-        if (((_head - _tail + 1) & _mask) != 0)
-        {
-            _ring[_head++ & _mask] = std::move(item);
-            _cv1.NotifyOne();
-            return true;
-        }
+        if (_counter.closed())
+            return false;
 
-        _cv2.Wait(_cs, [this]() { return (_closed || (((_head - _tail + 1) & _mask) != 0)); });
+        _producers.Wait([this]() { return !_counter.IsFull(_capacity); });
+    }
 
-    } while (!_closed);
+    // Reserved slot is always free, because the ring has one more slot than its capacity
+    while (!_ring.Enqueue(std::move(item)))
+        WaitStrategy::Relax();
 
-    return false;
+    // Notify() fence also orders the enqueued item before the asynchronous waiters check
+    _consumers.Notify();
+    if (_async.load(std::memory_order_relaxed) > 0)
+        HandOver();
+
+    return true;
 }
 
 template<typename T>
 inline bool WaitRing<T>::Dequeue(T& item)
 {
-    Locker<CriticalSection> locker(_cs);
+    bool result = false;
+    bool finished = false;
 
-    if (_closed && (((_head - _tail) & _mask) == 0))
+    _consumers.Wait([this, &item, &result, &finished]() { return (result = TryDequeue(item, finished)) || _counter.finished(); });
+
+    // Resume asynchronous waiters of the closed wait ring which becomes empty
+    if (finished)
+        HandOver();
+
+    return result;
+}
+
+template<typename T>
+inline size_t WaitRing<T>::Dequeue(std::vector<T>& items, size_t max)
+{
+    // Clear the result items vector
+    items.clear();
+
+    return Dequeue(std::back_inserter(items), max);
+}
+
+template<typename T>
+template <class TOutputIterator>
+inline size_t WaitRing<T>::Dequeue(TOutputIterator output, size_t max)
+{
+    assert((max > 0) && "Maximal count of items to dequeue must be greater than zero!");
+
+    size_t result = 0;
+    bool finished = false;
+
+    _consumers.Wait([this, &output, max, &result, &finished]() { return ((result = TryDequeue(output, max, finished)) > 0) || _counter.finished(); });
+
+    // Resume asynchronous waiters of the closed wait ring which becomes empty
+    if (finished)
+        HandOver();
+
+    return result;
+}
+
+template<typename T>
+inline void WaitRing<T>::Close()
+{
+    _counter.Close();
+    _producers.Notify();
+    _consumers.Notify();
+    HandOver();
+}
+
+template<typename T>
+inline bool WaitRing<T>::TryDequeue(T& item, bool& finished)
+{
+    if (!_ring.Dequeue(item))
         return false;
 
-    do
+    finished = _counter.Release();
+    _producers.Notify();
+    if (finished)
+        _consumers.Notify();
+
+    return true;
+}
+
+template<typename T>
+template <class TOutputIterator>
+inline size_t WaitRing<T>::TryDequeue(TOutputIterator& output, size_t max, bool& finished)
+{
+    // Items enqueued during the dequeue are left for the next batch
+    size_t count = std::min(_counter.size(), max);
+
+    size_t dequeued = 0;
+    T item;
+    while ((dequeued < count) && _ring.Dequeue(item))
     {
-        if (((_head - _tail) & _mask) != 0)
-        {
-            item = std::move(_ring[_tail++ & _mask]);
-            _cv2.NotifyOne();
-            return true;
-        }
+        *output++ = std::move(item);
+        ++dequeued;
+    }
 
-        _cv1.Wait(_cs, [this]() { return (_closed || (((_head - _tail) & _mask) != 0)); });
+    if (dequeued == 0)
+        return 0;
 
-    } while (!_closed || (((_head - _tail) & _mask) != 0));
+    // Release all dequeued items at once
+    finished = _counter.Release(dequeued);
+    _producers.Notify();
+    if (finished)
+        _consumers.Notify();
 
-    return false;
+    return dequeued;
 }
 
 template<typename T>
-inline void WaitRing<T>::Close()
+inline void WaitRing<T>::HandOver()
+{
+    Internals::AsyncResumer resumer;
+    Locker<CriticalSection> locker(_cs);
+    HandOver(resumer);
+}
+
+template<typename T>
+inline void WaitRing<T>::HandOver(Internals::AsyncResumer& resumer)
+{
+    Internals::AsyncWaiter* waiter;
+    while ((waiter = _waiters.front()) != nullptr)
+    {
+        bool finished = false;
+        bool result = TryDequeue(*(T*)waiter->data, finished);
+
+        // Waiters are resumed with the failed result only when the closed wait ring is empty
+        if (!result && !_counter.finished())
+            break;
+
+        _waiters.Pop();
+        _async.fetch_sub(1, std::memory_order_relaxed);
+        resumer.Add(waiter, result);
+    }
+}
+
+template<typename T>
+inline bool WaitRing<T>::SuspendAsync(Internals::AsyncWaiter& waiter)
 {
+    Internals::AsyncResumer resumer;
     Locker<CriticalSection> locker(_cs);
-    _closed = true;
-    _cv1.NotifyAll();
-    _cv2.NotifyAll();
+
+    // Register the waiter before the last check, so it could not be missed by the producer which enqueues the item after the check
+    _async.fetch_add(1, std::memory_order_seq_cst);
+
+    bool finished = false;
+    if (TryDequeue(*(T*)waiter.data, finished))
+    {
+        _async.fetch_sub(1, std::memory_order_relaxed);
+        waiter.result = true;
+
+        // Resume other asynchronous waiters of the closed wait ring which becomes empty
+        if (finished)
+            HandOver(resumer);
+
+        return false;
+    }
+
+    if (_counter.finished())
+    {
+        _async.fetch_sub(1, std::memory_order_relaxed);
+        waiter.result = false;
+        return false;
+    }
+
+    _waiters.Push(&waiter);
+    return true;
 }
 
 } // namespace CppCommon
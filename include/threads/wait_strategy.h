@@ -0,0 +1,179 @@
+/*!
+    \file wait_strategy.h
+    \brief Wait strategy synchronization primitive definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_WAIT_STRATEGY_H
+#define CPPCOMMON_THREADS_WAIT_STRATEGY_H
+
+#include "threads/thread.h"
+
+#include <atomic>
+#include <cstdint>
+
+#if defined(__i386__) || defined(__x86_64__) || defined(_M_IX86) || defined(_M_X64)
+#include <immintrin.h>
+#endif
+
+namespace CppCommon {
+
+//! Wait strategy synchronization primitive
+/*!
+    Wait strategy is used to wait for some condition of lock-free data structures
+    (e.g. ring queue is not empty or not full) without burning CPU forever. Waiting
+    thread spins for the given count of iterations, then yields for the given count
+    of iterations and finally parks on the futex (Linux) or WaitOnAddress (Windows).
+
+    Waiting threads register themselves before parking, so notifying thread makes
+    a system call only when there is at least one parked waiter. Otherwise notify
+    costs a single memory fence and an atomic load.
+
+    Thread-safe.
+*/
+class WaitStrategy
+{
+public:
+    //! Default class constructor
+    /*!
+        \param spins - Count of spin iterations before yield (default is 128)
+        \param yields - Count of yield iterations before park (default is 16)
+    */
+    explicit WaitStrategy(uint32_t spins = 128, uint32_t yields = 16) noexcept;
+    WaitStrategy(const WaitStrategy&) = delete;
+    WaitStrategy(WaitStrategy&&) = delete;
+    ~WaitStrategy() = default;
+
+    WaitStrategy& operator=(const WaitStrategy&) = delete;
+    WaitStrategy& operator=(WaitStrategy&&) = delete;
+
+    //! Get count of spin iterations
+    uint32_t spins() const noexcept { return _spins; }
+    //! Get count of yield iterations
+    uint32_t yields() const noexcept { return _yields; }
+    //! Get count of registered waiters
+    uint32_t waiters() const noexcept { return _waiters.load(std::memory_order_acquire); }
+
+    //! Wait until the given condition is satisfied
+    /*!
+        Condition is called as condition() and returns 'true' when the waiting
+        thread should continue. Condition must be satisfied by some other thread
+        which calls Notify() after the change.
+
+        Will block.
+
+        \param condition - Condition to wait for
+    */
+    template <class TCondition>
+    void Wait(TCondition&& condition);
+
+    //! Notify all parked waiters about the condition change
+    /*!
+        Must be called after the change which could satisfy the waiting condition.
+
+        Will not block.
+    */
+    void Notify() noexcept;
+
+    //! Relax CPU in the spin loop
+    static void Relax() noexcept;
+    //! Park the current thread while the given address contains the given value
+    /*!
+        Might return spuriously, so the caller must check its condition again.
+
+        Will block.
+
+        \param address - Address to park on
+        \param value - Expected value of the address
+    */
+    static void Park(std::atomic<uint32_t>& address, uint32_t value) noexcept;
+    //! Park the current thread for the given timespan while the given address contains the given value
+    /*!
+        Might return spuriously, so the caller must check its condition again.
+
+        Will block for the given timespan in the worst case.
+
+        \param address - Address to park on
+        \param value - Expected value of the address
+        \param timespan - Timespan to park
+        \return 'false' in case of timeout, 'true' otherwise
+    */
+    static bool ParkFor(std::atomic<uint32_t>& address, uint32_t value, const Timespan& timespan) noexcept;
+    //! Wake all threads parked on the given address
+    static void Wake(std::atomic<uint32_t>& address) noexcept;
+    //! Wake at least one thread parked on the given address
+    static void WakeOne(std::atomic<uint32_t>& address) noexcept;
+
+private:
+    typedef char cache_line_pad[128];
+
+    cache_line_pad _pad0;
+    std::atomic<uint32_t> _epoch;
+    std::atomic<uint32_t> _waiters;
+    uint32_t _spins;
+    uint32_t _yields;
+    cache_line_pad _pad1;
+};
+
+//! @cond INTERNALS
+namespace Internals {
+
+//! Closed flag and items counter of lock-free wait containers
+/*!
+    Items counter includes items reserved by producers which are not published
+    yet and items taken by consumers which are not released yet, so the closed
+    wait container is finished only when all its items are consumed.
+*/
+class WaitCounter
+{
+public:
+    WaitCounter() noexcept : _state(0) {}
+    WaitCounter(const WaitCounter&) = delete;
+    WaitCounter(WaitCounter&&) = delete;
+    ~WaitCounter() = default;
+
+    WaitCounter& operator=(const WaitCounter&) = delete;
+    WaitCounter& operator=(WaitCounter&&) = delete;
+
+    //! Is the wait container closed?
+    bool closed() const noexcept { return ((_state.load(std::memory_order_acquire) & CLOSED) != 0); }
+    //! Is the wait container closed and empty?
+    bool finished() const noexcept { return (_state.load(std::memory_order_acquire) == CLOSED); }
+    //! Get count of items
+    size_t size() const noexcept { return (size_t)(_state.load(std::memory_order_acquire) & ~CLOSED); }
+
+    //! Is the opened wait container of the given capacity full (0 for unlimited capacity)?
+    bool IsFull(size_t capacity) const noexcept;
+
+    //! Try to reserve the given count of items in the wait container of the given capacity (0 for unlimited capacity)
+    /*!
+        Bounded wait container could overflow its capacity only with the count
+        of items reserved when it was not full.
+
+        \return 'true' if items were reserved, 'false' if the wait container is full or closed
+    */
+    bool Reserve(size_t capacity, size_t count = 1) noexcept;
+    //! Release the given count of consumed or unpublished items
+    /*!
+        \return 'true' if the closed wait container becomes finished, 'false' otherwise
+    */
+    bool Release(size_t count = 1) noexcept;
+    //! Close the wait container
+    void Close() noexcept { _state.fetch_or(CLOSED, std::memory_order_acq_rel); }
+
+private:
+    static const uint64_t CLOSED = (uint64_t)1 << 63;
+
+    std::atomic<uint64_t> _state;
+};
+
+} // namespace Internals
+//! @endcond
+
+} // namespace CppCommon
+
+#include "wait_strategy.inl"
+
+#endif // CPPCOMMON_THREADS_WAIT_STRATEGY_H
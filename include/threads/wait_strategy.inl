@@ -0,0 +1,105 @@
+/*!
+    \file wait_strategy.inl
+    \brief Wait strategy synchronization primitive inline implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+inline WaitStrategy::WaitStrategy(uint32_t spins, uint32_t yields) noexcept
+    : _epoch(0), _waiters(0), _spins(spins), _yields(yields)
+{
+}
+
+template <class TCondition>
+inline void WaitStrategy::Wait(TCondition&& condition)
+{
+    // Spin
+    for (uint32_t i = 0; i < _spins; ++i)
+    {
+        if (condition())
+            return;
+        Relax();
+    }
+
+    // Yield
+    for (uint32_t i = 0; i < _yields; ++i)
+    {
+        if (condition())
+            return;
+        Thread::Yield();
+    }
+
+    // Park
+    for (;;)
+    {
+        // Read the epoch before the last condition check, so any notify after it will change the epoch
+        uint32_t epoch = _epoch.load(std::memory_order_acquire);
+
+        // Register the waiter and check the condition once again
+        _waiters.fetch_add(1, std::memory_order_seq_cst);
+        if (condition())
+        {
+            _waiters.fetch_sub(1, std::memory_order_relaxed);
+            return;
+        }
+
+        Park(_epoch, epoch);
+
+        _waiters.fetch_sub(1, std::memory_order_relaxed);
+        if (condition())
+            return;
+    }
+}
+
+inline void WaitStrategy::Notify() noexcept
+{
+    // Order the condition change before the waiters check (pairs with the waiter registration)
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (_waiters.load(std::memory_order_relaxed) == 0)
+        return;
+
+    _epoch.fetch_add(1, std::memory_order_release);
+    Wake(_epoch);
+}
+
+inline void WaitStrategy::Relax() noexcept
+{
+#if defined(__i386__) || defined(__x86_64__) || defined(_M_IX86) || defined(_M_X64)
+    _mm_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+    __asm__ __volatile__("yield");
+#endif
+}
+
+//! @cond INTERNALS
+namespace Internals {
+
+inline bool WaitCounter::IsFull(size_t capacity) const noexcept
+{
+    uint64_t state = _state.load(std::memory_order_acquire);
+    return (((state & CLOSED) == 0) && (capacity > 0) && ((state & ~CLOSED) >= capacity));
+}
+
+inline bool WaitCounter::Reserve(size_t capacity, size_t count) noexcept
+{
+    uint64_t state = _state.load(std::memory_order_relaxed);
+    do
+    {
+        if (((state & CLOSED) != 0) || ((capacity > 0) && ((state & ~CLOSED) >= capacity)))
+            return false;
+    } while (!_state.compare_exchange_weak(state, state + count, std::memory_order_acq_rel, std::memory_order_relaxed));
+    return true;
+}
+
+inline bool WaitCounter::Release(size_t count) noexcept
+{
+    return (_state.fetch_sub(count, std::memory_order_acq_rel) == (CLOSED | count));
+}
+
+} // namespace Internals
+//! @endcond
+
+} // namespace CppCommon
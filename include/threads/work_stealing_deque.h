@@ -0,0 +1,115 @@
+/*!
+    \file work_stealing_deque.h
+    \brief Single owner / multiple thieves lock-free work-stealing deque definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_WORK_STEALING_DEQUE_H
+#define CPPCOMMON_THREADS_WORK_STEALING_DEQUE_H
+
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace CppCommon {
+
+//! Single owner / multiple thieves lock-free work-stealing deque
+/*!
+    Work-stealing deque is owned by a single thread which pushes and pops items
+    at the bottom end in LIFO order. Any other thread could steal items from the
+    top end in FIFO order. Owner operations touch only the bottom cursor and take
+    a CAS only when the last item is contended with thieves. Deque size is limited
+    to the capacity provided in the constructor.
+
+    Items are stored in atomic slots, so the item type must be trivially copyable
+    (usually a pointer to the task).
+
+    Push() and Pop() are owner thread methods, Steal() is thread-safe.
+
+    C++ implementation of the Chase-Lev dynamic circular work-stealing deque with
+    the memory model of "Correct and Efficient Work-Stealing for Weak Memory Models"
+    https://www.di.ens.fr/~zappa/readings/ppopp13.pdf
+*/
+template<typename T>
+class WorkStealingDeque
+{
+    static_assert(std::is_trivially_copyable<T>::value, "Work-stealing deque item type must be trivially copyable!");
+
+public:
+    //! Default class constructor
+    /*!
+        \param capacity - Deque capacity (must be a power of two)
+    */
+    explicit WorkStealingDeque(size_t capacity);
+    WorkStealingDeque(const WorkStealingDeque&) = delete;
+    WorkStealingDeque(WorkStealingDeque&&) = delete;
+    ~WorkStealingDeque() { delete[] _buffer; }
+
+    WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+    WorkStealingDeque& operator=(WorkStealingDeque&&) = delete;
+
+    //! Check if the deque is not empty
+    explicit operator bool() const noexcept { return !empty(); }
+
+    //! Is deque empty?
+    bool empty() const noexcept { return (size() == 0); }
+    //! Get deque capacity
+    size_t capacity() const noexcept { return _capacity; }
+    //! Get deque size (approximate if called concurrently with other operations)
+    size_t size() const noexcept;
+
+    //! Push an item to the bottom of the deque (owner thread method)
+    /*!
+        The item will be copied into the deque.
+
+        Will not block.
+
+        \param item - Item to push
+        \return 'true' if the item was successfully pushed, 'false' if the deque is full
+    */
+    bool Push(const T& item);
+
+    //! Pop an item from the bottom of the deque (owner thread method)
+    /*!
+        Will not block.
+
+        \param item - Item to pop
+        \return 'true' if the item was successfully popped, 'false' if the deque is empty
+    */
+    bool Pop(T& item);
+
+    //! Steal an item from the top of the deque (thief threads method)
+    /*!
+        Steal fails if the deque is empty or the top item was taken by the owner
+        or another thief at the same time.
+
+        Will not block.
+
+        \param item - Item to steal
+        \return 'true' if the item was successfully stolen, 'false' if the deque is empty or the steal lost the race
+    */
+    bool Steal(T& item);
+
+private:
+    typedef char cache_line_pad[128];
+
+    const size_t _capacity;
+    const size_t _mask;
+    std::atomic<T>* _buffer;
+
+    cache_line_pad _pad0;
+    std::atomic<int64_t> _top;
+    cache_line_pad _pad1;
+    std::atomic<int64_t> _bottom;
+    cache_line_pad _pad2;
+};
+
+} // namespace CppCommon
+
+#include "work_stealing_deque.inl"
+
+#endif // CPPCOMMON_THREADS_WORK_STEALING_DEQUE_H
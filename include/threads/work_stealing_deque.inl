@@ -0,0 +1,89 @@
+/*!
+    \file work_stealing_deque.inl
+    \brief Single owner / multiple thieves lock-free work-stealing deque inline implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+template<typename T>
+inline WorkStealingDeque<T>::WorkStealingDeque(size_t capacity) : _capacity(capacity), _mask(capacity - 1), _buffer(new std::atomic<T>[capacity]), _top(0), _bottom(0)
+{
+    assert((capacity > 1) && "Deque capacity must be greater than one!");
+    assert(((capacity & (capacity - 1)) == 0) && "Deque capacity must be a power of two!");
+
+    memset(_pad0, 0, sizeof(cache_line_pad));
+    memset(_pad1, 0, sizeof(cache_line_pad));
+    memset(_pad2, 0, sizeof(cache_line_pad));
+}
+
+template<typename T>
+inline size_t WorkStealingDeque<T>::size() const noexcept
+{
+    const int64_t bottom = _bottom.load(std::memory_order_acquire);
+    const int64_t top = _top.load(std::memory_order_acquire);
+
+    return (bottom > top) ? (size_t)(bottom - top) : 0;
+}
+
+template<typename T>
+inline bool WorkStealingDeque<T>::Push(const T& item)
+{
+    const int64_t bottom = _bottom.load(std::memory_order_relaxed);
+    const int64_t top = _top.load(std::memory_order_acquire);
+
+    if ((size_t)(bottom - top) >= _capacity)
+        return false;
+
+    // Store the item and publish it with the bottom cursor
+    _buffer[bottom & _mask].store(item, std::memory_order_release);
+    std::atomic_thread_fence(std::memory_order_release);
+    _bottom.store(bottom + 1, std::memory_order_relaxed);
+
+    return true;
+}
+
+template<typename T>
+inline bool WorkStealingDeque<T>::Pop(T& item)
+{
+    // Reserve the bottom item before the top cursor check (pairs with the thief fence)
+    const int64_t bottom = _bottom.load(std::memory_order_relaxed) - 1;
+    _bottom.store(bottom, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    int64_t top = _top.load(std::memory_order_relaxed);
+
+    if (top > bottom)
+    {
+        // The deque is empty
+        _bottom.store(bottom + 1, std::memory_order_relaxed);
+        return false;
+    }
+
+    item = _buffer[bottom & _mask].load(std::memory_order_relaxed);
+    if (top < bottom)
+        return true;
+
+    // The last item is contended with thieves
+    bool result = _top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+    _bottom.store(bottom + 1, std::memory_order_relaxed);
+    return result;
+}
+
+template<typename T>
+inline bool WorkStealingDeque<T>::Steal(T& item)
+{
+    int64_t top = _top.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    const int64_t bottom = _bottom.load(std::memory_order_acquire);
+
+    if (top >= bottom)
+        return false;
+
+    // Read the item before claiming it, the slot could be reused after the top cursor moves
+    item = _buffer[top & _mask].load(std::memory_order_acquire);
+    return _top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+}
+
+} // namespace CppCommon
@@ -0,0 +1,88 @@
+/*!
+    \file coarse_clock.h
+    \brief Coarse cached clock definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_TIME_COARSE_CLOCK_H
+#define CPPCOMMON_TIME_COARSE_CLOCK_H
+
+#include "time/timestamp.h"
+
+namespace CppCommon {
+
+//! Coarse cached clock
+/*!
+    Coarse clock trades the timestamp resolution for the lower cost of reading
+    the time. It is designed for high-frequency timestamp consumers like cache
+    timeouts or rate limits, which are fine with the millisecond precision.
+
+    When the coarse clock ticker is started, the background thread updates the
+    cached UTC and monotonic values with the given resolution, and reading the
+    coarse clock is a single relaxed atomic load. When the ticker is stopped,
+    the coarse clock reads coarse system clocks (CLOCK_REALTIME_COARSE and
+    CLOCK_MONOTONIC_COARSE for Linux, system file time for Windows) or falls
+    back to the precise ones for other platforms.
+
+    Coarse clock monotonic values share the base with Timestamp::nano(), so
+    they could be mixed with each other in the scope of the clock resolution.
+
+    Thread-safe.
+*/
+class CoarseClock
+{
+public:
+    CoarseClock() = delete;
+    CoarseClock(const CoarseClock&) = delete;
+    CoarseClock(CoarseClock&&) = delete;
+    ~CoarseClock() = delete;
+
+    CoarseClock& operator=(const CoarseClock&) = delete;
+    CoarseClock& operator=(CoarseClock&&) = delete;
+
+    //! Is the coarse clock ticker started?
+    static bool IsStarted() noexcept;
+
+    //! Start the coarse clock ticker
+    /*!
+        \param resolution - Coarse clock update resolution (default is 1 millisecond)
+        \return 'true' if the coarse clock ticker was successfully started, 'false' if the ticker was already started
+    */
+    static bool Start(const Timespan& resolution = Timespan::milliseconds(1));
+    //! Stop the coarse clock ticker
+    /*!
+        \return 'true' if the coarse clock ticker was successfully stopped, 'false' if the ticker was already stopped
+    */
+    static bool Stop();
+
+    //! Get the coarse UTC timestamp
+    /*!
+        \return Coarse UTC timestamp in nanoseconds
+    */
+    static uint64_t utc();
+    //! Get the coarse monotonic timestamp
+    /*!
+        \return Coarse monotonic timestamp in nanoseconds
+    */
+    static uint64_t nano();
+};
+
+//! Coarse timestamp
+class CoarseTimestamp : public Timestamp
+{
+public:
+    using Timestamp::Timestamp;
+
+    //! Initialize coarse timestamp with a current coarse UTC time
+    CoarseTimestamp() : Timestamp(CoarseClock::utc()) {}
+    //! Initialize coarse timestamp with another timestamp value
+    CoarseTimestamp(const Timestamp& timestamp) : Timestamp(timestamp) {}
+};
+
+/*! \example time_coarse_clock.cpp Coarse cached clock example */
+
+} // namespace CppCommon
+
+#endif // CPPCOMMON_TIME_COARSE_CLOCK_H
@@ -0,0 +1,245 @@
+/*!
+    \file latency_histogram.h
+    \brief High dynamic range latency histogram definition
+    \author Ivan Shynkarenka
+    \date 15.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_TIME_LATENCY_HISTOGRAM_H
+#define CPPCOMMON_TIME_LATENCY_HISTOGRAM_H
+
+#include "time/timespan.h"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <vector>
+
+namespace CppCommon {
+
+//! High dynamic range latency histogram
+/*!
+    Latency histogram records nanosecond durations (e.g. Timestamp::nano() or
+    RdtsTimestamp deltas) from 1 nanosecond up to the highest trackable value
+    with the given count of significant decimal digits (HdrHistogram layout).
+    Values are grouped into power of two buckets, each of them is divided into
+    the same count of linear sub-buckets, so the relative error of any recorded
+    value is less than 10^-digits and recording takes O(1) without loops.
+
+    Values greater than the highest trackable value are saturated to it.
+
+    Histogram could be merged with other histograms with the same layout and
+    serialized into the compact form (zigzag LEB128 counts with run length
+    encoded empty sub-buckets).
+
+    Not thread-safe.
+
+    https://github.com/HdrHistogram/HdrHistogram
+*/
+class LatencyHistogram
+{
+public:
+    //! Default highest trackable value (1 hour in nanoseconds)
+    static constexpr uint64_t DEFAULT_HIGHEST = 3600000000000ull;
+
+    //! Initialize the latency histogram
+    /*!
+        \param highest - Highest trackable value in nanoseconds (default is LatencyHistogram::DEFAULT_HIGHEST)
+        \param digits - Count of significant decimal digits from 1 to 5 (default is 3)
+    */
+    explicit LatencyHistogram(uint64_t highest = DEFAULT_HIGHEST, int digits = 3);
+    LatencyHistogram(const LatencyHistogram&) = default;
+    LatencyHistogram(LatencyHistogram&&) noexcept = default;
+    ~LatencyHistogram() = default;
+
+    LatencyHistogram& operator=(const LatencyHistogram&) = default;
+    LatencyHistogram& operator=(LatencyHistogram&&) noexcept = default;
+
+    //! Check if the latency histogram is not empty
+    explicit operator bool() const noexcept { return !empty(); }
+
+    //! Is the latency histogram empty?
+    bool empty() const noexcept { return (_count == 0); }
+    //! Get the highest trackable value
+    uint64_t highest() const noexcept { return _highest; }
+    //! Get the count of significant decimal digits
+    int digits() const noexcept { return _digits; }
+    //! Get the count of histogram sub-buckets
+    size_t buckets() const noexcept { return _counts.size(); }
+
+    //! Get the total count of recorded values
+    uint64_t count() const noexcept { return _count; }
+    //! Get the minimal recorded value (0 if the histogram is empty)
+    uint64_t min() const noexcept;
+    //! Get the maximal recorded value (0 if the histogram is empty)
+    uint64_t max() const noexcept;
+    //! Get the mean of recorded values
+    double mean() const noexcept;
+    //! Get the standard deviation of recorded values
+    double stddev() const noexcept;
+
+    //! Get the recorded value at the given percentile
+    /*!
+        Returns the highest value equivalent to the recorded value at the given
+        percentile, so the result is never less than the exact percentile value.
+
+        \param percentile - Percentile from 0.0 to 100.0
+        \return Value at the given percentile (0 if the histogram is empty)
+    */
+    uint64_t Percentile(double percentile) const noexcept;
+    //! Get the median value
+    uint64_t p50() const noexcept { return Percentile(50.0); }
+    //! Get the 99th percentile value
+    uint64_t p99() const noexcept { return Percentile(99.0); }
+    //! Get the 99.9th percentile value
+    uint64_t p999() const noexcept { return Percentile(99.9); }
+
+    //! Record the given value
+    /*!
+        \param value - Value in nanoseconds
+        \param count - Count of values to record (default is 1)
+    */
+    void Record(uint64_t value, uint64_t count = 1) noexcept;
+    //! Record the given timespan
+    /*!
+        \param timespan - Timespan to record (negative timespan is recorded as zero)
+        \param count - Count of values to record (default is 1)
+    */
+    void Record(const Timespan& timespan, uint64_t count = 1) noexcept
+    { Record((timespan.total() > 0) ? (uint64_t)timespan.total() : 0, count); }
+
+    //! Merge the given latency histogram into the current one
+    /*!
+        \param histogram - Latency histogram with the same highest trackable value and significant digits
+        \return 'true' if the histogram was successfully merged, 'false' if histograms layouts are different
+    */
+    bool Merge(const LatencyHistogram& histogram) noexcept;
+
+    //! Clear all recorded values
+    void Clear() noexcept;
+
+    //! Serialize the latency histogram into the compact form
+    /*!
+        \return Serialized bytes
+    */
+    std::vector<uint8_t> Serialize() const;
+    //! Deserialize the latency histogram from the compact form
+    /*!
+        \param buffer - Buffer to deserialize
+        \param histogram - Deserialized latency histogram
+        \return Count of deserialized bytes or 0 if the buffer is truncated or malformed
+    */
+    static size_t Deserialize(std::span<const uint8_t> buffer, LatencyHistogram& histogram);
+
+    //! Get the sub-bucket index of the given value
+    size_t Index(uint64_t value) const noexcept;
+    //! Get the lowest value equivalent to the given sub-bucket index
+    uint64_t LowestValue(size_t index) const noexcept;
+    //! Get the highest value equivalent to the given sub-bucket index
+    uint64_t HighestValue(size_t index) const noexcept;
+
+    //! Swap two instances
+    void swap(LatencyHistogram& histogram) noexcept;
+    friend void swap(LatencyHistogram& histogram1, LatencyHistogram& histogram2) noexcept
+    { histogram1.swap(histogram2); }
+
+private:
+    uint64_t _highest;
+    int _digits;
+    int _sub_bucket_half_magnitude;
+    uint64_t _sub_bucket_mask;
+    uint64_t _count;
+    std::vector<uint64_t> _counts;
+
+    friend class ConcurrentLatencyHistogram;
+};
+
+//! Concurrent high dynamic range latency histogram
+/*!
+    Concurrent latency histogram records values into the shard of the current
+    thread with a single relaxed atomic increment, so recording is lock-free
+    and takes O(1). Threads are assigned to shards in round-robin order of
+    their first record. Shards are merged into the LatencyHistogram snapshot
+    on read, which is consistent per sub-bucket only.
+
+    Each shard holds all sub-buckets of the histogram layout, so the memory
+    usage grows with shards count (~270KB per shard for 3 significant digits
+    and 1 hour highest trackable value).
+
+    Thread-safe.
+*/
+class ConcurrentLatencyHistogram
+{
+public:
+    //! Initialize the concurrent latency histogram
+    /*!
+        \param highest - Highest trackable value in nanoseconds (default is LatencyHistogram::DEFAULT_HIGHEST)
+        \param digits - Count of significant decimal digits from 1 to 5 (default is 3)
+        \param shards - Count of shards (will be rounded up to the power of two, default is 0 - CPU::LogicalCores())
+    */
+    explicit ConcurrentLatencyHistogram(uint64_t highest = LatencyHistogram::DEFAULT_HIGHEST, int digits = 3, size_t shards = 0);
+    ConcurrentLatencyHistogram(const ConcurrentLatencyHistogram&) = delete;
+    ConcurrentLatencyHistogram(ConcurrentLatencyHistogram&&) = delete;
+    ~ConcurrentLatencyHistogram() = default;
+
+    ConcurrentLatencyHistogram& operator=(const ConcurrentLatencyHistogram&) = delete;
+    ConcurrentLatencyHistogram& operator=(ConcurrentLatencyHistogram&&) = delete;
+
+    //! Get the highest trackable value
+    uint64_t highest() const noexcept { return _layout.highest(); }
+    //! Get the count of significant decimal digits
+    int digits() const noexcept { return _layout.digits(); }
+    //! Get the count of shards
+    size_t shards() const noexcept { return _shards_mask + 1; }
+
+    //! Record the given value
+    /*!
+        \param value - Value in nanoseconds
+        \param count - Count of values to record (default is 1)
+    */
+    void Record(uint64_t value, uint64_t count = 1) noexcept;
+    //! Record the given timespan
+    /*!
+        \param timespan - Timespan to record (negative timespan is recorded as zero)
+        \param count - Count of values to record (default is 1)
+    */
+    void Record(const Timespan& timespan, uint64_t count = 1) noexcept
+    { Record((timespan.total() > 0) ? (uint64_t)timespan.total() : 0, count); }
+
+    //! Merge all shards into the latency histogram snapshot
+    LatencyHistogram Snapshot() const;
+    //! Merge all shards into the given latency histogram
+    /*!
+        \param histogram - Latency histogram with the same layout to merge into
+        \return 'true' if shards were successfully merged, 'false' if histograms layouts are different
+    */
+    bool Snapshot(LatencyHistogram& histogram) const noexcept;
+
+    //! Clear all recorded values
+    /*!
+        Values recorded concurrently with the clear might be partially kept.
+    */
+    void Clear() noexcept;
+
+private:
+    // Empty histogram with the shards layout
+    LatencyHistogram _layout;
+    size_t _shards_mask;
+    size_t _shard_size;
+    std::unique_ptr<std::atomic<uint64_t>[]> _counts;
+
+    //! Get the sequential shard index of the current thread
+    static size_t CurrentThreadShard() noexcept;
+};
+
+/*! \example time_latency_histogram.cpp High dynamic range latency histogram example */
+
+} // namespace CppCommon
+
+#include "latency_histogram.inl"
+
+#endif // CPPCOMMON_TIME_LATENCY_HISTOGRAM_H
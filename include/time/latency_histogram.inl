@@ -0,0 +1,68 @@
+/*!
+    \file latency_histogram.inl
+    \brief High dynamic range latency histogram inline implementation
+    \author Ivan Shynkarenka
+    \date 15.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+inline size_t LatencyHistogram::Index(uint64_t value) const noexcept
+{
+    if (value > _highest)
+        value = _highest;
+
+    // Power of two bucket of the value, values less than the sub-buckets count fall into the first bucket
+    int bucket = (63 - std::countl_zero(value | _sub_bucket_mask)) - _sub_bucket_half_magnitude;
+    size_t sub_bucket = (size_t)(value >> bucket);
+
+    // Each bucket except the first one uses only the upper half of its sub-buckets
+    return ((size_t)(bucket + 1) << _sub_bucket_half_magnitude) + sub_bucket - ((size_t)1 << _sub_bucket_half_magnitude);
+}
+
+inline uint64_t LatencyHistogram::LowestValue(size_t index) const noexcept
+{
+    const size_t half = (size_t)1 << _sub_bucket_half_magnitude;
+
+    int bucket = (int)(index >> _sub_bucket_half_magnitude) - 1;
+    size_t sub_bucket = (index & (half - 1)) + half;
+    if (bucket < 0)
+    {
+        sub_bucket -= half;
+        bucket = 0;
+    }
+
+    return (uint64_t)sub_bucket << bucket;
+}
+
+inline uint64_t LatencyHistogram::HighestValue(size_t index) const noexcept
+{
+    int bucket = std::max((int)(index >> _sub_bucket_half_magnitude) - 1, 0);
+    return LowestValue(index) + ((uint64_t)1 << bucket) - 1;
+}
+
+inline void LatencyHistogram::Record(uint64_t value, uint64_t count) noexcept
+{
+    _counts[Index(value)] += count;
+    _count += count;
+}
+
+inline void LatencyHistogram::swap(LatencyHistogram& histogram) noexcept
+{
+    using std::swap;
+    swap(_highest, histogram._highest);
+    swap(_digits, histogram._digits);
+    swap(_sub_bucket_half_magnitude, histogram._sub_bucket_half_magnitude);
+    swap(_sub_bucket_mask, histogram._sub_bucket_mask);
+    swap(_count, histogram._count);
+    swap(_counts, histogram._counts);
+}
+
+inline void ConcurrentLatencyHistogram::Record(uint64_t value, uint64_t count) noexcept
+{
+    size_t shard = CurrentThreadShard() & _shards_mask;
+    _counts[(shard * _shard_size) + _layout.Index(value)].fetch_add(count, std::memory_order_relaxed);
+}
+
+} // namespace CppCommon
@@ -11,6 +11,8 @@
 
 #include "time/timestamp.h"
 
+#include <string_view>
+
 namespace CppCommon {
 
 //! Weekday
@@ -256,6 +258,64 @@ public:
     LocalTime(const UtcTime& time);
 };
 
+//! Size of the buffer to format ISO-8601 timestamp ("YYYY-MM-DDTHH:MM:SS.nnnnnnnnn+HH:MM")
+const size_t ISO8601_BUFFER_SIZE = 35;
+
+//! Format the UTC timestamp into ISO-8601 (RFC-3339) string
+/*!
+    Formats the timestamp as "YYYY-MM-DDTHH:MM:SS.nnnnnnnnnZ" with the given
+    count of second fraction digits. Method does not allocate memory and uses
+    the lookup table of digit pairs, so it is suitable for hot paths like logs
+    or protocol messages formatting. The output string is not null-terminated.
+
+    Thread-safe.
+
+    \param buffer - Output buffer of at least ISO8601_BUFFER_SIZE characters
+    \param timestamp - UTC timestamp
+    \param precision - Count of second fraction digits in range [0, 9] (default is 9)
+    \return Count of formatted characters
+*/
+size_t FormatISO8601(char* buffer, const Timestamp& timestamp, int precision = 9) noexcept;
+//! Format the UTC timestamp into ISO-8601 (RFC-3339) string with the given local time offset
+/*!
+    Formats the local time of the timestamp as "YYYY-MM-DDTHH:MM:SS.nnnnnnnnn+HH:MM".
+
+    Thread-safe.
+
+    \param buffer - Output buffer of at least ISO8601_BUFFER_SIZE characters
+    \param timestamp - UTC timestamp
+    \param offset - Local time offset (e.g. Timezone::LocalOffset(timestamp))
+    \param precision - Count of second fraction digits in range [0, 9] (default is 9)
+    \return Count of formatted characters
+*/
+size_t FormatISO8601(char* buffer, const Timestamp& timestamp, const Timespan& offset, int precision = 9) noexcept;
+
+//! Parse ISO-8601 (RFC-3339) string into the UTC timestamp
+/*!
+    Parses strings in the "YYYY-MM-DDTHH:MM:SS[.fraction][Z|+HH:MM|-HH:MM]" format.
+    Date and time could be separated with 'T', 't' or space. Fraction could have
+    any count of digits, but only first nine of them (nanoseconds) are taken into
+    account. Time without the offset is treated as UTC. Method does not allocate
+    memory.
+
+    Thread-safe.
+
+    \param str - ISO-8601 string
+    \param timestamp - Parsed UTC timestamp
+    \return 'true' if the string was successfully parsed, 'false' if the string is not valid ISO-8601 timestamp
+*/
+bool ParseISO8601(std::string_view str, Timestamp& timestamp) noexcept;
+//! Parse ISO-8601 (RFC-3339) string into the UTC timestamp
+/*!
+    If the string is not valid ISO-8601 timestamp the method will raise an argument exception!
+
+    Thread-safe.
+
+    \param str - ISO-8601 string
+    \return Parsed UTC timestamp
+*/
+UtcTimestamp ParseISO8601(std::string_view str);
+
 /*! \example time_time.cpp Time example */
 
 } // namespace CppCommon
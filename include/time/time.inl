@@ -283,6 +283,33 @@ inline LocalTime::LocalTime(const UtcTime& time) : LocalTime(time.utcstamp())
 
 } // namespace CppCommon
 
+#if defined(FMT_VERSION)
+template <>
+struct fmt::formatter<CppCommon::Timestamp> : formatter<std::string_view>
+{
+    template <typename FormatContext>
+    auto format(const CppCommon::Timestamp& value, FormatContext& ctx) const
+    {
+        char buffer[CppCommon::ISO8601_BUFFER_SIZE];
+        return formatter<string_view>::format(std::string_view(buffer, CppCommon::FormatISO8601(buffer, value)), ctx);
+    }
+};
+
+template <>
+struct fmt::formatter<CppCommon::UtcTimestamp> : formatter<CppCommon::Timestamp> {};
+
+template <>
+struct fmt::formatter<CppCommon::UtcTime> : formatter<std::string_view>
+{
+    template <typename FormatContext>
+    auto format(const CppCommon::UtcTime& value, FormatContext& ctx) const
+    {
+        char buffer[CppCommon::ISO8601_BUFFER_SIZE];
+        return formatter<string_view>::format(std::string_view(buffer, CppCommon::FormatISO8601(buffer, value.utcstamp())), ctx);
+    }
+};
+#endif
+
 //! \cond DOXYGEN_SKIP
 template <>
 struct std::hash<CppCommon::Time>
@@ -9,6 +9,7 @@
 #ifndef CPPCOMMON_TIME_TIMESTAMP_H
 #define CPPCOMMON_TIME_TIMESTAMP_H
 
+#include "algorithms/hash.h"
 #include "time/timespan.h"
 
 namespace CppCommon {
@@ -35,4 +35,11 @@ struct std::hash<CppCommon::Timestamp>
         return result;
     }
 };
+
+template <>
+struct CppCommon::FastHash<CppCommon::Timestamp>
+{
+    size_t operator()(const CppCommon::Timestamp& value) const noexcept
+    { return (size_t)CppCommon::Hash::Mix(value.total()); }
+};
 //! \endcond
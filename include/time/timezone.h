@@ -81,6 +81,21 @@ public:
     UtcTime Convert(const LocalTime& localtime) const
     { return UtcTime(localtime - total()); }
 
+    //! Get the local time offset for the given UTC timestamp
+    /*!
+        Local time offset (including daylight saving time) is cached per thread
+        together with the instant of the next timezone transition, so sequential
+        conversions of UTC timestamps into local time are a compare plus an add.
+        Timezone rules are requested from the operating system only when the
+        timestamp is out of the cached range.
+
+        Thread-safe.
+
+        \param timestamp - UTC timestamp
+        \return Local time offset
+    */
+    static Timespan LocalOffset(const Timestamp& timestamp);
+
     //! Get the UTC timezone (Greenwich Mean Time)
     /*!
         Thread-safe.
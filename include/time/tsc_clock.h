@@ -0,0 +1,91 @@
+/*!
+    \file tsc_clock.h
+    \brief Calibrated TSC clock definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_TIME_TSC_CLOCK_H
+#define CPPCOMMON_TIME_TSC_CLOCK_H
+
+#include "time/timestamp.h"
+
+namespace CppCommon {
+
+//! Calibrated TSC clock
+/*!
+    TSC clock converts cheap RDTS timestamps (CPU time stamp counter) into UTC
+    nanoseconds with a single multiply-shift operation instead of the system
+    call of Timestamp::utc(). TSC frequency is calibrated against the monotonic
+    high resolution clock on the first use. Then the clock is periodically
+    (each second) resynchronized with the UTC time by the first caller that
+    observes the expired synchronization interval. Each resynchronization also
+    refines the TSC frequency over the whole time since the calibration.
+
+    TSC clock is used only if the CPU reports invariant TSC (constant rate in
+    all ACPI P-, C- and T-states, synchronized among cores). Otherwise all TSC
+    clock values fall back to Timestamp::utc().
+
+    Resynchronization steps the clock to the current UTC time, so sequential
+    values could slightly go back after it (by the drift of the previous
+    synchronization interval). Use Timestamp::nano() for strictly monotonic
+    time measurements.
+
+    Thread-safe.
+*/
+class TscClock
+{
+public:
+    TscClock() = delete;
+    TscClock(const TscClock&) = delete;
+    TscClock(TscClock&&) = delete;
+    ~TscClock() = delete;
+
+    TscClock& operator=(const TscClock&) = delete;
+    TscClock& operator=(TscClock&&) = delete;
+
+    //! Is the CPU time stamp counter invariant?
+    /*!
+        \return 'true' if TSC clock is based on the invariant CPU time stamp counter, 'false' if it falls back to the system UTC clock
+    */
+    static bool IsInvariant();
+
+    //! Get the calibrated CPU time stamp counter frequency
+    /*!
+        \return Count of RDTS ticks per second (0 if the CPU time stamp counter is not invariant)
+    */
+    static uint64_t frequency();
+
+    //! Get the UTC timestamp
+    /*!
+        Thread-safe.
+
+        \return UTC timestamp in nanoseconds
+    */
+    static uint64_t utc();
+
+    //! Resynchronize the TSC clock with the system UTC clock
+    /*!
+        Thread-safe.
+    */
+    static void Resync();
+};
+
+//! TSC timestamp
+class TscTimestamp : public Timestamp
+{
+public:
+    using Timestamp::Timestamp;
+
+    //! Initialize TSC timestamp with a current UTC time of the calibrated TSC clock
+    TscTimestamp() : Timestamp(TscClock::utc()) {}
+    //! Initialize TSC timestamp with another timestamp value
+    TscTimestamp(const Timestamp& timestamp) : Timestamp(timestamp) {}
+};
+
+/*! \example time_tsc_clock.cpp Calibrated TSC clock example */
+
+} // namespace CppCommon
+
+#endif // CPPCOMMON_TIME_TSC_CLOCK_H
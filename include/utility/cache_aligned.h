@@ -0,0 +1,68 @@
+/*!
+    \file cache_aligned.h
+    \brief Cache aligned value wrapper definition
+    \author Ivan Shynkarenka
+    \date 15.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_UTILITY_CACHE_ALIGNED_H
+#define CPPCOMMON_UTILITY_CACHE_ALIGNED_H
+
+#include <cstddef>
+#include <utility>
+
+namespace CppCommon {
+
+//! Cache aligned value wrapper
+/*!
+    Cache aligned value occupies its own destructive interference range,
+    so neighbour values in arrays (per-CPU or per-thread slots, shards)
+    never share a cache line and are modified without false sharing. For
+    example, shards of concurrent containers wrap their locks together with
+    the guarded data, so threads which lock neighbour shards do not bounce
+    the same cache line between CPUs.
+
+    Alignment is two 64-byte cache lines, because adjacent cache line
+    prefetchers of modern CPUs pull cache lines in pairs. The constant is
+    used instead of std::hardware_destructive_interference_size which may
+    differ between compiler flags and breaks ABI of the padded types.
+
+    Not thread-safe.
+*/
+template <typename T>
+class alignas(128) CacheAligned
+{
+public:
+    //! Destructive interference size in bytes
+    static constexpr size_t SIZE = 128;
+
+    CacheAligned() : _value() {}
+    explicit CacheAligned(const T& value) : _value(value) {}
+    explicit CacheAligned(T&& value) : _value(std::move(value)) {}
+    //! Initialize the wrapped value in place with the given arguments
+    template <typename... Args>
+    explicit CacheAligned(std::in_place_t, Args&&... args) : _value(std::forward<Args>(args)...) {}
+    CacheAligned(const CacheAligned&) = default;
+    CacheAligned(CacheAligned&&) = default;
+    ~CacheAligned() = default;
+
+    CacheAligned& operator=(const CacheAligned&) = default;
+    CacheAligned& operator=(CacheAligned&&) = default;
+
+    //! Get the wrapped value
+    T& value() noexcept { return _value; }
+    const T& value() const noexcept { return _value; }
+
+    T& operator*() noexcept { return _value; }
+    const T& operator*() const noexcept { return _value; }
+    T* operator->() noexcept { return &_value; }
+    const T* operator->() const noexcept { return &_value; }
+
+private:
+    T _value;
+};
+
+} // namespace CppCommon
+
+#endif // CPPCOMMON_UTILITY_CACHE_ALIGNED_H
@@ -9,8 +9,12 @@
 #ifndef CPPCOMMON_UTILITY_ENDIAN_H
 #define CPPCOMMON_UTILITY_ENDIAN_H
 
+#include <bit>
 #include <cstdint>
+#include <cstdlib>
 #include <cstring>
+#include <span>
+#include <type_traits>
 
 namespace CppCommon {
 
@@ -18,6 +22,12 @@ namespace CppCommon {
 /*!
     Big/Little-endian utilities contains methods for big<->little endian conversions.
 
+    Single values are converted with constexpr ByteSwap() and Convert*Endian()
+    methods which are compiled into the single bswap (or movbe) instruction.
+    Load*Endian() and Store*Endian() methods access unaligned buffers. Arrays
+    of values are converted in place with SIMD instructions (SSE2/AVX2 on x86,
+    NEON on ARM), so wire structures might be decoded in bulk.
+
     Thread-safe.
 */
 class Endian
@@ -32,9 +42,109 @@ public:
     Endian& operator=(Endian&&) = delete;
 
     //! Is big-endian system?
-    static bool IsBigEndian();
+    static constexpr bool IsBigEndian() noexcept { return (std::endian::native == std::endian::big); }
     //! Is little-endian system?
-    static bool IsLittleEndian();
+    static constexpr bool IsLittleEndian() noexcept { return (std::endian::native == std::endian::little); }
+
+    //! Reverse bytes of the given integer value
+    /*!
+        \param value - Integer value
+        \return Integer value with the reversed byte order
+    */
+    template <typename T, typename = std::enable_if_t<std::is_integral_v<T>>>
+    static constexpr T ByteSwap(T value) noexcept;
+
+    //! Convert the given integer value between the native and big-endian byte order
+    /*!
+        \param value - Integer value
+        \return Converted integer value
+    */
+    template <typename T, typename = std::enable_if_t<std::is_integral_v<T>>>
+    static constexpr T ConvertBigEndian(T value) noexcept { if constexpr (IsBigEndian()) return value; else return ByteSwap(value); }
+    //! Convert the given integer value between the native and little-endian byte order
+    /*!
+        \param value - Integer value
+        \return Converted integer value
+    */
+    template <typename T, typename = std::enable_if_t<std::is_integral_v<T>>>
+    static constexpr T ConvertLittleEndian(T value) noexcept { if constexpr (IsLittleEndian()) return value; else return ByteSwap(value); }
+
+    //! Load big-endian integer value from the given unaligned buffer
+    /*!
+        \param buffer - Buffer to read
+        \return Integer value
+    */
+    template <typename T>
+    static T LoadBigEndian(const void* buffer) noexcept;
+    //! Load little-endian integer value from the given unaligned buffer
+    /*!
+        \param buffer - Buffer to read
+        \return Integer value
+    */
+    template <typename T>
+    static T LoadLittleEndian(const void* buffer) noexcept;
+    //! Store integer value into the given unaligned buffer in big-endian byte order
+    /*!
+        \param buffer - Buffer to write
+        \param value - Integer value
+    */
+    template <typename T>
+    static void StoreBigEndian(void* buffer, T value) noexcept;
+    //! Store integer value into the given unaligned buffer in little-endian byte order
+    /*!
+        \param buffer - Buffer to write
+        \param value - Integer value
+    */
+    template <typename T>
+    static void StoreLittleEndian(void* buffer, T value) noexcept;
+
+    //! Reverse bytes of all 16-bit values in the given array
+    /*!
+        \param values - Array of values
+    */
+    static void ByteSwap(std::span<uint16_t> values) noexcept;
+    //! Reverse bytes of all 32-bit values in the given array
+    /*!
+        \param values - Array of values
+    */
+    static void ByteSwap(std::span<uint32_t> values) noexcept;
+    //! Reverse bytes of all 64-bit values in the given array
+    /*!
+        \param values - Array of values
+    */
+    static void ByteSwap(std::span<uint64_t> values) noexcept;
+
+    //! Convert all 16-bit values in the given array between the native and big-endian byte order
+    /*!
+        \param values - Array of values
+    */
+    static void ConvertBigEndian(std::span<uint16_t> values) noexcept { if constexpr (IsLittleEndian()) ByteSwap(values); }
+    //! Convert all 32-bit values in the given array between the native and big-endian byte order
+    /*!
+        \param values - Array of values
+    */
+    static void ConvertBigEndian(std::span<uint32_t> values) noexcept { if constexpr (IsLittleEndian()) ByteSwap(values); }
+    //! Convert all 64-bit values in the given array between the native and big-endian byte order
+    /*!
+        \param values - Array of values
+    */
+    static void ConvertBigEndian(std::span<uint64_t> values) noexcept { if constexpr (IsLittleEndian()) ByteSwap(values); }
+
+    //! Convert all 16-bit values in the given array between the native and little-endian byte order
+    /*!
+        \param values - Array of values
+    */
+    static void ConvertLittleEndian(std::span<uint16_t> values) noexcept { if constexpr (IsBigEndian()) ByteSwap(values); }
+    //! Convert all 32-bit values in the given array between the native and little-endian byte order
+    /*!
+        \param values - Array of values
+    */
+    static void ConvertLittleEndian(std::span<uint32_t> values) noexcept { if constexpr (IsBigEndian()) ByteSwap(values); }
+    //! Convert all 64-bit values in the given array between the native and little-endian byte order
+    /*!
+        \param values - Array of values
+    */
+    static void ConvertLittleEndian(std::span<uint64_t> values) noexcept { if constexpr (IsBigEndian()) ByteSwap(values); }
 
     //! Read big-endian signed 16-bit integer value from the given buffer
     /*!
@@ -8,525 +8,220 @@
 
 namespace CppCommon {
 
-inline bool Endian::IsBigEndian()
+template <typename T, typename>
+constexpr T Endian::ByteSwap(T value) noexcept
 {
-    return false;
+    static_assert((sizeof(T) == 1) || (sizeof(T) == 2) || (sizeof(T) == 4) || (sizeof(T) == 8), "Unsupported integer size!");
+
+    typedef std::make_unsigned_t<T> U;
+    U result = (U)value;
+
+    if constexpr (sizeof(T) == 1)
+        return value;
+    else
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        if constexpr (sizeof(T) == 2)
+            result = __builtin_bswap16(result);
+        else if constexpr (sizeof(T) == 4)
+            result = __builtin_bswap32(result);
+        else
+            result = __builtin_bswap64(result);
+#else
+#if defined(_MSC_VER)
+        if (!std::is_constant_evaluated())
+        {
+            if constexpr (sizeof(T) == 2)
+                return (T)_byteswap_ushort(result);
+            else if constexpr (sizeof(T) == 4)
+                return (T)_byteswap_ulong(result);
+            else
+                return (T)_byteswap_uint64(result);
+        }
+#endif
+        U swapped = 0;
+        for (size_t i = 0; i < sizeof(T); ++i)
+        {
+            swapped = (U)((swapped << 8) | (result & 0xFF));
+            result = (U)(result >> 8);
+        }
+        result = swapped;
+#endif
+        return (T)result;
+    }
 }
 
-inline bool Endian::IsLittleEndian()
+template <typename T>
+inline T Endian::LoadBigEndian(const void* buffer) noexcept
 {
-    return true;
+    T value;
+    std::memcpy(&value, buffer, sizeof(T));
+    return ConvertBigEndian(value);
 }
 
-inline size_t Endian::ReadBigEndian(const void* buffer, int16_t& value)
+template <typename T>
+inline T Endian::LoadLittleEndian(const void* buffer) noexcept
 {
-    if (IsBigEndian())
-    {
-        ((uint8_t*)&value)[0] = ((const uint8_t*)buffer)[0];
-        ((uint8_t*)&value)[1] = ((const uint8_t*)buffer)[1];
-    }
-    else
-    {
-        ((uint8_t*)&value)[0] = ((const uint8_t*)buffer)[1];
-        ((uint8_t*)&value)[1] = ((const uint8_t*)buffer)[0];
-    }
+    T value;
+    std::memcpy(&value, buffer, sizeof(T));
+    return ConvertLittleEndian(value);
+}
+
+template <typename T>
+inline void Endian::StoreBigEndian(void* buffer, T value) noexcept
+{
+    value = ConvertBigEndian(value);
+    std::memcpy(buffer, &value, sizeof(T));
+}
 
+template <typename T>
+inline void Endian::StoreLittleEndian(void* buffer, T value) noexcept
+{
+    value = ConvertLittleEndian(value);
+    std::memcpy(buffer, &value, sizeof(T));
+}
+
+inline size_t Endian::ReadBigEndian(const void* buffer, int16_t& value)
+{
+    value = LoadBigEndian<int16_t>(buffer);
     return 2;
 }
 
 inline size_t Endian::ReadBigEndian(const void* buffer, uint16_t& value)
 {
-    if (IsBigEndian())
-    {
-        ((uint8_t*)&value)[0] = ((const uint8_t*)buffer)[0];
-        ((uint8_t*)&value)[1] = ((const uint8_t*)buffer)[1];
-    }
-    else
-    {
-        ((uint8_t*)&value)[0] = ((const uint8_t*)buffer)[1];
-        ((uint8_t*)&value)[1] = ((const uint8_t*)buffer)[0];
-    }
-
+    value = LoadBigEndian<uint16_t>(buffer);
     return 2;
 }
 
 inline size_t Endian::ReadBigEndian(const void* buffer, int32_t& value)
 {
-    if (IsBigEndian())
-    {
-        ((uint8_t*)&value)[0] = ((const uint8_t*)buffer)[0];
-        ((uint8_t*)&value)[1] = ((const uint8_t*)buffer)[1];
-        ((uint8_t*)&value)[2] = ((const uint8_t*)buffer)[2];
-        ((uint8_t*)&value)[3] = ((const uint8_t*)buffer)[3];
-    }
-    else
-    {
-        ((uint8_t*)&value)[0] = ((const uint8_t*)buffer)[3];
-        ((uint8_t*)&value)[1] = ((const uint8_t*)buffer)[2];
-        ((uint8_t*)&value)[2] = ((const uint8_t*)buffer)[1];
-        ((uint8_t*)&value)[3] = ((const uint8_t*)buffer)[0];
-    }
-
+    value = LoadBigEndian<int32_t>(buffer);
     return 4;
 }
 
 inline size_t Endian::ReadBigEndian(const void* buffer, uint32_t& value)
 {
-    if (IsBigEndian())
-    {
-        ((uint8_t*)&value)[0] = ((const uint8_t*)buffer)[0];
-        ((uint8_t*)&value)[1] = ((const uint8_t*)buffer)[1];
-        ((uint8_t*)&value)[2] = ((const uint8_t*)buffer)[2];
-        ((uint8_t*)&value)[3] = ((const uint8_t*)buffer)[3];
-    }
-    else
-    {
-        ((uint8_t*)&value)[0] = ((const uint8_t*)buffer)[3];
-        ((uint8_t*)&value)[1] = ((const uint8_t*)buffer)[2];
-        ((uint8_t*)&value)[2] = ((const uint8_t*)buffer)[1];
-        ((uint8_t*)&value)[3] = ((const uint8_t*)buffer)[0];
-    }
-
+    value = LoadBigEndian<uint32_t>(buffer);
     return 4;
 }
 
 inline size_t Endian::ReadBigEndian(const void* buffer, int64_t& value)
 {
-    if (IsBigEndian())
-    {
-        ((uint8_t*)&value)[0] = ((const uint8_t*)buffer)[0];
-        ((uint8_t*)&value)[1] = ((const uint8_t*)buffer)[1];
-        ((uint8_t*)&value)[2] = ((const uint8_t*)buffer)[2];
-        ((uint8_t*)&value)[3] = ((const uint8_t*)buffer)[3];
-        ((uint8_t*)&value)[4] = ((const uint8_t*)buffer)[4];
-        ((uint8_t*)&value)[5] = ((const uint8_t*)buffer)[5];
-        ((uint8_t*)&value)[6] = ((const uint8_t*)buffer)[6];
-        ((uint8_t*)&value)[7] = ((const uint8_t*)buffer)[7];
-    }
-    else
-    {
-        ((uint8_t*)&value)[0] = ((const uint8_t*)buffer)[7];
-        ((uint8_t*)&value)[1] = ((const uint8_t*)buffer)[6];
-        ((uint8_t*)&value)[2] = ((const uint8_t*)buffer)[5];
-        ((uint8_t*)&value)[3] = ((const uint8_t*)buffer)[4];
-        ((uint8_t*)&value)[4] = ((const uint8_t*)buffer)[3];
-        ((uint8_t*)&value)[5] = ((const uint8_t*)buffer)[2];
-        ((uint8_t*)&value)[6] = ((const uint8_t*)buffer)[1];
-        ((uint8_t*)&value)[7] = ((const uint8_t*)buffer)[0];
-    }
-
+    value = LoadBigEndian<int64_t>(buffer);
     return 8;
 }
 
 inline size_t Endian::ReadBigEndian(const void* buffer, uint64_t& value)
 {
-    if (IsBigEndian())
-    {
-        ((uint8_t*)&value)[0] = ((const uint8_t*)buffer)[0];
-        ((uint8_t*)&value)[1] = ((const uint8_t*)buffer)[1];
-        ((uint8_t*)&value)[2] = ((const uint8_t*)buffer)[2];
-        ((uint8_t*)&value)[3] = ((const uint8_t*)buffer)[3];
-        ((uint8_t*)&value)[4] = ((const uint8_t*)buffer)[4];
-        ((uint8_t*)&value)[5] = ((const uint8_t*)buffer)[5];
-        ((uint8_t*)&value)[6] = ((const uint8_t*)buffer)[6];
-        ((uint8_t*)&value)[7] = ((const uint8_t*)buffer)[7];
-    }
-    else
-    {
-        ((uint8_t*)&value)[0] = ((const uint8_t*)buffer)[7];
-        ((uint8_t*)&value)[1] = ((const uint8_t*)buffer)[6];
-        ((uint8_t*)&value)[2] = ((const uint8_t*)buffer)[5];
-        ((uint8_t*)&value)[3] = ((const uint8_t*)buffer)[4];
-        ((uint8_t*)&value)[4] = ((const uint8_t*)buffer)[3];
-        ((uint8_t*)&value)[5] = ((const uint8_t*)buffer)[2];
-        ((uint8_t*)&value)[6] = ((const uint8_t*)buffer)[1];
-        ((uint8_t*)&value)[7] = ((const uint8_t*)buffer)[0];
-    }
-
+    value = LoadBigEndian<uint64_t>(buffer);
     return 8;
 }
 
 inline size_t Endian::ReadLittleEndian(const void* buffer, int16_t& value)
 {
-    if (IsBigEndian())
-    {
-        ((uint8_t*)&value)[0] = ((const uint8_t*)buffer)[1];
-        ((uint8_t*)&value)[1] = ((const uint8_t*)buffer)[0];
-    }
-    else
-    {
-        ((uint8_t*)&value)[0] = ((const uint8_t*)buffer)[0];
-        ((uint8_t*)&value)[1] = ((const uint8_t*)buffer)[1];
-    }
-
+    value = LoadLittleEndian<int16_t>(buffer);
     return 2;
 }
 
 inline size_t Endian::ReadLittleEndian(const void* buffer, uint16_t& value)
 {
-    if (IsBigEndian())
-    {
-        ((uint8_t*)&value)[0] = ((const uint8_t*)buffer)[1];
-        ((uint8_t*)&value)[1] = ((const uint8_t*)buffer)[0];
-    }
-    else
-    {
-        ((uint8_t*)&value)[0] = ((const uint8_t*)buffer)[0];
-        ((uint8_t*)&value)[1] = ((const uint8_t*)buffer)[1];
-    }
-
+    value = LoadLittleEndian<uint16_t>(buffer);
     return 2;
 }
 
 inline size_t Endian::ReadLittleEndian(const void* buffer, int32_t& value)
 {
-    if (IsBigEndian())
-    {
-        ((uint8_t*)&value)[0] = ((const uint8_t*)buffer)[3];
-        ((uint8_t*)&value)[1] = ((const uint8_t*)buffer)[2];
-        ((uint8_t*)&value)[2] = ((const uint8_t*)buffer)[1];
-        ((uint8_t*)&value)[3] = ((const uint8_t*)buffer)[0];
-    }
-    else
-    {
-        ((uint8_t*)&value)[0] = ((const uint8_t*)buffer)[0];
-        ((uint8_t*)&value)[1] = ((const uint8_t*)buffer)[1];
-        ((uint8_t*)&value)[2] = ((const uint8_t*)buffer)[2];
-        ((uint8_t*)&value)[3] = ((const uint8_t*)buffer)[3];
-    }
-
+    value = LoadLittleEndian<int32_t>(buffer);
     return 4;
 }
 
 inline size_t Endian::ReadLittleEndian(const void* buffer, uint32_t& value)
 {
-    if (IsBigEndian())
-    {
-        ((uint8_t*)&value)[0] = ((const uint8_t*)buffer)[3];
-        ((uint8_t*)&value)[1] = ((const uint8_t*)buffer)[2];
-        ((uint8_t*)&value)[2] = ((const uint8_t*)buffer)[1];
-        ((uint8_t*)&value)[3] = ((const uint8_t*)buffer)[0];
-    }
-    else
-    {
-        ((uint8_t*)&value)[0] = ((const uint8_t*)buffer)[0];
-        ((uint8_t*)&value)[1] = ((const uint8_t*)buffer)[1];
-        ((uint8_t*)&value)[2] = ((const uint8_t*)buffer)[2];
-        ((uint8_t*)&value)[3] = ((const uint8_t*)buffer)[3];
-    }
-
+    value = LoadLittleEndian<uint32_t>(buffer);
     return 4;
 }
 
 inline size_t Endian::ReadLittleEndian(const void* buffer, int64_t& value)
 {
-    if (IsBigEndian())
-    {
-        ((uint8_t*)&value)[0] = ((const uint8_t*)buffer)[7];
-        ((uint8_t*)&value)[1] = ((const uint8_t*)buffer)[6];
-        ((uint8_t*)&value)[2] = ((const uint8_t*)buffer)[5];
-        ((uint8_t*)&value)[3] = ((const uint8_t*)buffer)[4];
-        ((uint8_t*)&value)[4] = ((const uint8_t*)buffer)[3];
-        ((uint8_t*)&value)[5] = ((const uint8_t*)buffer)[2];
-        ((uint8_t*)&value)[6] = ((const uint8_t*)buffer)[1];
-        ((uint8_t*)&value)[7] = ((const uint8_t*)buffer)[0];
-    }
-    else
-    {
-        ((uint8_t*)&value)[0] = ((const uint8_t*)buffer)[0];
-        ((uint8_t*)&value)[1] = ((const uint8_t*)buffer)[1];
-        ((uint8_t*)&value)[2] = ((const uint8_t*)buffer)[2];
-        ((uint8_t*)&value)[3] = ((const uint8_t*)buffer)[3];
-        ((uint8_t*)&value)[4] = ((const uint8_t*)buffer)[4];
-        ((uint8_t*)&value)[5] = ((const uint8_t*)buffer)[5];
-        ((uint8_t*)&value)[6] = ((const uint8_t*)buffer)[6];
-        ((uint8_t*)&value)[7] = ((const uint8_t*)buffer)[7];
-    }
-
+    value = LoadLittleEndian<int64_t>(buffer);
     return 8;
 }
 
 inline size_t Endian::ReadLittleEndian(const void* buffer, uint64_t& value)
 {
-    if (IsBigEndian())
-    {
-        ((uint8_t*)&value)[0] = ((const uint8_t*)buffer)[7];
-        ((uint8_t*)&value)[1] = ((const uint8_t*)buffer)[6];
-        ((uint8_t*)&value)[2] = ((const uint8_t*)buffer)[5];
-        ((uint8_t*)&value)[3] = ((const uint8_t*)buffer)[4];
-        ((uint8_t*)&value)[4] = ((const uint8_t*)buffer)[3];
-        ((uint8_t*)&value)[5] = ((const uint8_t*)buffer)[2];
-        ((uint8_t*)&value)[6] = ((const uint8_t*)buffer)[1];
-        ((uint8_t*)&value)[7] = ((const uint8_t*)buffer)[0];
-    }
-    else
-    {
-        ((uint8_t*)&value)[0] = ((const uint8_t*)buffer)[0];
-        ((uint8_t*)&value)[1] = ((const uint8_t*)buffer)[1];
-        ((uint8_t*)&value)[2] = ((const uint8_t*)buffer)[2];
-        ((uint8_t*)&value)[3] = ((const uint8_t*)buffer)[3];
-        ((uint8_t*)&value)[4] = ((const uint8_t*)buffer)[4];
-        ((uint8_t*)&value)[5] = ((const uint8_t*)buffer)[5];
-        ((uint8_t*)&value)[6] = ((const uint8_t*)buffer)[6];
-        ((uint8_t*)&value)[7] = ((const uint8_t*)buffer)[7];
-    }
-
+    value = LoadLittleEndian<uint64_t>(buffer);
     return 8;
 }
 
 inline size_t Endian::WriteBigEndian(void* buffer, int16_t value)
 {
-    if (IsBigEndian())
-    {
-        ((uint8_t*)buffer)[0] = ((const uint8_t*)&value)[0];
-        ((uint8_t*)buffer)[1] = ((const uint8_t*)&value)[1];
-    }
-    else
-    {
-        ((uint8_t*)buffer)[0] = ((const uint8_t*)&value)[1];
-        ((uint8_t*)buffer)[1] = ((const uint8_t*)&value)[0];
-    }
-
+    StoreBigEndian(buffer, value);
     return 2;
 }
 
 inline size_t Endian::WriteBigEndian(void* buffer, uint16_t value)
 {
-    if (IsBigEndian())
-    {
-        ((uint8_t*)buffer)[0] = ((const uint8_t*)&value)[0];
-        ((uint8_t*)buffer)[1] = ((const uint8_t*)&value)[1];
-    }
-    else
-    {
-        ((uint8_t*)buffer)[0] = ((const uint8_t*)&value)[1];
-        ((uint8_t*)buffer)[1] = ((const uint8_t*)&value)[0];
-    }
-
+    StoreBigEndian(buffer, value);
     return 2;
 }
 
 inline size_t Endian::WriteBigEndian(void* buffer, int32_t value)
 {
-    if (IsBigEndian())
-    {
-        ((uint8_t*)buffer)[0] = ((const uint8_t*)&value)[0];
-        ((uint8_t*)buffer)[1] = ((const uint8_t*)&value)[1];
-        ((uint8_t*)buffer)[2] = ((const uint8_t*)&value)[2];
-        ((uint8_t*)buffer)[3] = ((const uint8_t*)&value)[3];
-    }
-    else
-    {
-        ((uint8_t*)buffer)[0] = ((const uint8_t*)&value)[3];
-        ((uint8_t*)buffer)[1] = ((const uint8_t*)&value)[2];
-        ((uint8_t*)buffer)[2] = ((const uint8_t*)&value)[1];
-        ((uint8_t*)buffer)[3] = ((const uint8_t*)&value)[0];
-    }
-
+    StoreBigEndian(buffer, value);
     return 4;
 }
 
 inline size_t Endian::WriteBigEndian(void* buffer, uint32_t value)
 {
-    if (IsBigEndian())
-    {
-        ((uint8_t*)buffer)[0] = ((const uint8_t*)&value)[0];
-        ((uint8_t*)buffer)[1] = ((const uint8_t*)&value)[1];
-        ((uint8_t*)buffer)[2] = ((const uint8_t*)&value)[2];
-        ((uint8_t*)buffer)[3] = ((const uint8_t*)&value)[3];
-    }
-    else
-    {
-        ((uint8_t*)buffer)[0] = ((const uint8_t*)&value)[3];
-        ((uint8_t*)buffer)[1] = ((const uint8_t*)&value)[2];
-        ((uint8_t*)buffer)[2] = ((const uint8_t*)&value)[1];
-        ((uint8_t*)buffer)[3] = ((const uint8_t*)&value)[0];
-    }
-
+    StoreBigEndian(buffer, value);
     return 4;
 }
 
 inline size_t Endian::WriteBigEndian(void* buffer, int64_t value)
 {
-    if (IsBigEndian())
-    {
-        ((uint8_t*)buffer)[0] = ((const uint8_t*)&value)[0];
-        ((uint8_t*)buffer)[1] = ((const uint8_t*)&value)[1];
-        ((uint8_t*)buffer)[2] = ((const uint8_t*)&value)[2];
-        ((uint8_t*)buffer)[3] = ((const uint8_t*)&value)[3];
-        ((uint8_t*)buffer)[4] = ((const uint8_t*)&value)[4];
-        ((uint8_t*)buffer)[5] = ((const uint8_t*)&value)[5];
-        ((uint8_t*)buffer)[6] = ((const uint8_t*)&value)[6];
-        ((uint8_t*)buffer)[7] = ((const uint8_t*)&value)[7];
-    }
-    else
-    {
-        ((uint8_t*)buffer)[0] = ((const uint8_t*)&value)[7];
-        ((uint8_t*)buffer)[1] = ((const uint8_t*)&value)[6];
-        ((uint8_t*)buffer)[2] = ((const uint8_t*)&value)[5];
-        ((uint8_t*)buffer)[3] = ((const uint8_t*)&value)[4];
-        ((uint8_t*)buffer)[4] = ((const uint8_t*)&value)[3];
-        ((uint8_t*)buffer)[5] = ((const uint8_t*)&value)[2];
-        ((uint8_t*)buffer)[6] = ((const uint8_t*)&value)[1];
-        ((uint8_t*)buffer)[7] = ((const uint8_t*)&value)[0];
-    }
-
+    StoreBigEndian(buffer, value);
     return 8;
 }
 
 inline size_t Endian::WriteBigEndian(void* buffer, uint64_t value)
 {
-    if (IsBigEndian())
-    {
-        ((uint8_t*)buffer)[0] = ((const uint8_t*)&value)[0];
-        ((uint8_t*)buffer)[1] = ((const uint8_t*)&value)[1];
-        ((uint8_t*)buffer)[2] = ((const uint8_t*)&value)[2];
-        ((uint8_t*)buffer)[3] = ((const uint8_t*)&value)[3];
-        ((uint8_t*)buffer)[4] = ((const uint8_t*)&value)[4];
-        ((uint8_t*)buffer)[5] = ((const uint8_t*)&value)[5];
-        ((uint8_t*)buffer)[6] = ((const uint8_t*)&value)[6];
-        ((uint8_t*)buffer)[7] = ((const uint8_t*)&value)[7];
-    }
-    else
-    {
-        ((uint8_t*)buffer)[0] = ((const uint8_t*)&value)[7];
-        ((uint8_t*)buffer)[1] = ((const uint8_t*)&value)[6];
-        ((uint8_t*)buffer)[2] = ((const uint8_t*)&value)[5];
-        ((uint8_t*)buffer)[3] = ((const uint8_t*)&value)[4];
-        ((uint8_t*)buffer)[4] = ((const uint8_t*)&value)[3];
-        ((uint8_t*)buffer)[5] = ((const uint8_t*)&value)[2];
-        ((uint8_t*)buffer)[6] = ((const uint8_t*)&value)[1];
-        ((uint8_t*)buffer)[7] = ((const uint8_t*)&value)[0];
-    }
-
+    StoreBigEndian(buffer, value);
     return 8;
 }
 
 inline size_t Endian::WriteLittleEndian(void* buffer, int16_t value)
 {
-    if (IsBigEndian())
-    {
-        ((uint8_t*)buffer)[0] = ((const uint8_t*)&value)[1];
-        ((uint8_t*)buffer)[1] = ((const uint8_t*)&value)[0];
-    }
-    else
-    {
-        ((uint8_t*)buffer)[0] = ((const uint8_t*)&value)[0];
-        ((uint8_t*)buffer)[1] = ((const uint8_t*)&value)[1];
-    }
-
+    StoreLittleEndian(buffer, value);
     return 2;
 }
 
 inline size_t Endian::WriteLittleEndian(void* buffer, uint16_t value)
 {
-    if (IsBigEndian())
-    {
-        ((uint8_t*)buffer)[0] = ((const uint8_t*)&value)[1];
-        ((uint8_t*)buffer)[1] = ((const uint8_t*)&value)[0];
-    }
-    else
-    {
-        ((uint8_t*)buffer)[0] = ((const uint8_t*)&value)[0];
-        ((uint8_t*)buffer)[1] = ((const uint8_t*)&value)[1];
-    }
-
+    StoreLittleEndian(buffer, value);
     return 2;
 }
 
 inline size_t Endian::WriteLittleEndian(void* buffer, int32_t value)
 {
-    if (IsBigEndian())
-    {
-        ((uint8_t*)buffer)[0] = ((const uint8_t*)&value)[3];
-        ((uint8_t*)buffer)[1] = ((const uint8_t*)&value)[2];
-        ((uint8_t*)buffer)[2] = ((const uint8_t*)&value)[1];
-        ((uint8_t*)buffer)[3] = ((const uint8_t*)&value)[0];
-    }
-    else
-    {
-        ((uint8_t*)buffer)[0] = ((const uint8_t*)&value)[0];
-        ((uint8_t*)buffer)[1] = ((const uint8_t*)&value)[1];
-        ((uint8_t*)buffer)[2] = ((const uint8_t*)&value)[2];
-        ((uint8_t*)buffer)[3] = ((const uint8_t*)&value)[3];
-    }
-
+    StoreLittleEndian(buffer, value);
     return 4;
 }
 
 inline size_t Endian::WriteLittleEndian(void* buffer, uint32_t value)
 {
-    if (IsBigEndian())
-    {
-        ((uint8_t*)buffer)[0] = ((const uint8_t*)&value)[3];
-        ((uint8_t*)buffer)[1] = ((const uint8_t*)&value)[2];
-        ((uint8_t*)buffer)[2] = ((const uint8_t*)&value)[1];
-        ((uint8_t*)buffer)[3] = ((const uint8_t*)&value)[0];
-    }
-    else
-    {
-        ((uint8_t*)buffer)[0] = ((const uint8_t*)&value)[0];
-        ((uint8_t*)buffer)[1] = ((const uint8_t*)&value)[1];
-        ((uint8_t*)buffer)[2] = ((const uint8_t*)&value)[2];
-        ((uint8_t*)buffer)[3] = ((const uint8_t*)&value)[3];
-    }
-
+    StoreLittleEndian(buffer, value);
     return 4;
 }
 
 inline size_t Endian::WriteLittleEndian(void* buffer, int64_t value)
 {
-    if (IsBigEndian())
-    {
-        ((uint8_t*)buffer)[0] = ((const uint8_t*)&value)[7];
-        ((uint8_t*)buffer)[1] = ((const uint8_t*)&value)[6];
-        ((uint8_t*)buffer)[2] = ((const uint8_t*)&value)[5];
-        ((uint8_t*)buffer)[3] = ((const uint8_t*)&value)[4];
-        ((uint8_t*)buffer)[4] = ((const uint8_t*)&value)[3];
-        ((uint8_t*)buffer)[5] = ((const uint8_t*)&value)[2];
-        ((uint8_t*)buffer)[6] = ((const uint8_t*)&value)[1];
-        ((uint8_t*)buffer)[7] = ((const uint8_t*)&value)[0];
-    }
-    else
-    {
-        ((uint8_t*)buffer)[0] = ((const uint8_t*)&value)[0];
-        ((uint8_t*)buffer)[1] = ((const uint8_t*)&value)[1];
-        ((uint8_t*)buffer)[2] = ((const uint8_t*)&value)[2];
-        ((uint8_t*)buffer)[3] = ((const uint8_t*)&value)[3];
-        ((uint8_t*)buffer)[4] = ((const uint8_t*)&value)[4];
-        ((uint8_t*)buffer)[5] = ((const uint8_t*)&value)[5];
-        ((uint8_t*)buffer)[6] = ((const uint8_t*)&value)[6];
-        ((uint8_t*)buffer)[7] = ((const uint8_t*)&value)[7];
-    }
-
+    StoreLittleEndian(buffer, value);
     return 8;
 }
 
 inline size_t Endian::WriteLittleEndian(void* buffer, uint64_t value)
 {
-    if (IsBigEndian())
-    {
-        ((uint8_t*)buffer)[0] = ((const uint8_t*)&value)[7];
-        ((uint8_t*)buffer)[1] = ((const uint8_t*)&value)[6];
-        ((uint8_t*)buffer)[2] = ((const uint8_t*)&value)[5];
-        ((uint8_t*)buffer)[3] = ((const uint8_t*)&value)[4];
-        ((uint8_t*)buffer)[4] = ((const uint8_t*)&value)[3];
-        ((uint8_t*)buffer)[5] = ((const uint8_t*)&value)[2];
-        ((uint8_t*)buffer)[6] = ((const uint8_t*)&value)[1];
-        ((uint8_t*)buffer)[7] = ((const uint8_t*)&value)[0];
-    }
-    else
-    {
-        ((uint8_t*)buffer)[0] = ((const uint8_t*)&value)[0];
-        ((uint8_t*)buffer)[1] = ((const uint8_t*)&value)[1];
-        ((uint8_t*)buffer)[2] = ((const uint8_t*)&value)[2];
-        ((uint8_t*)buffer)[3] = ((const uint8_t*)&value)[3];
-        ((uint8_t*)buffer)[4] = ((const uint8_t*)&value)[4];
-        ((uint8_t*)buffer)[5] = ((const uint8_t*)&value)[5];
-        ((uint8_t*)buffer)[6] = ((const uint8_t*)&value)[6];
-        ((uint8_t*)buffer)[7] = ((const uint8_t*)&value)[7];
-    }
-
+    StoreLittleEndian(buffer, value);
     return 8;
 }
 
@@ -0,0 +1,68 @@
+/*!
+    \file shard_selector.h
+    \brief Shard selector definition
+    \author Ivan Shynkarenka
+    \date 15.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_UTILITY_SHARD_SELECTOR_H
+#define CPPCOMMON_UTILITY_SHARD_SELECTOR_H
+
+#include <cstddef>
+#include <cstdint>
+
+namespace CppCommon {
+
+//! Shard selector
+/*!
+    Shard selector maps key hashes to one of the power of two count of shards.
+    The shard is selected with the high bits of the mixed key hash (Fibonacci
+    hashing), because low bits of the key hash are used by hash map buckets
+    inside the shard.
+
+    Thread-safe.
+*/
+class ShardSelector
+{
+public:
+    //! Initialize shard selector with the given shards count
+    /*!
+        \param shards - Shards count (will be rounded up to the power of two)
+    */
+    explicit ShardSelector(size_t shards) noexcept : _count(1), _shift(64)
+    {
+        while (_count < shards)
+        {
+            _count <<= 1;
+            --_shift;
+        }
+    }
+    ShardSelector(const ShardSelector&) noexcept = default;
+    ShardSelector(ShardSelector&&) noexcept = default;
+    ~ShardSelector() noexcept = default;
+
+    ShardSelector& operator=(const ShardSelector&) noexcept = default;
+    ShardSelector& operator=(ShardSelector&&) noexcept = default;
+
+    //! Get the shards count
+    size_t count() const noexcept { return _count; }
+
+    //! Select the shard index for the given key hash
+    size_t operator()(size_t hash) const noexcept
+    {
+        // Shift by 64 bits is undefined, so the single shard is selected explicitly
+        if (_count == 1)
+            return 0;
+
+        return (size_t)((((uint64_t)hash) * 0x9E3779B97F4A7C15ull) >> _shift);
+    }
+
+private:
+    size_t _count;
+    size_t _shift;
+};
+
+} // namespace CppCommon
+
+#endif // CPPCOMMON_UTILITY_SHARD_SELECTOR_H
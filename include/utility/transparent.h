@@ -0,0 +1,53 @@
+/*!
+    \file transparent.h
+    \brief Transparent hashers and comparators definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_UTILITY_TRANSPARENT_H
+#define CPPCOMMON_UTILITY_TRANSPARENT_H
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace CppCommon {
+
+//! Is the given hasher or comparator transparent?
+/*!
+    Transparent hashers and comparators define 'is_transparent' type and accept
+    any compatible key types, so containers can lookup items without constructing
+    temporary keys (e.g. std::string_view lookup in std::string keyed container).
+*/
+template <typename T, typename = void>
+struct IsTransparent : std::false_type {};
+
+//! \cond DOXYGEN_SKIP
+//! Is the given hasher or comparator transparent? (specialization)
+template <typename T>
+struct IsTransparent<T, std::void_t<typename T::is_transparent>> : std::true_type {};
+//! \endcond
+
+//! Transparent string hasher
+/*!
+    Calculates the same hash value for std::string, std::string_view and C-string
+    with the same content.
+
+    Thread-safe.
+*/
+struct TransparentStringHash
+{
+    typedef void is_transparent;
+
+    size_t operator()(std::string_view str) const noexcept { return std::hash<std::string_view>()(str); }
+    size_t operator()(const std::string& str) const noexcept { return std::hash<std::string_view>()(str); }
+    size_t operator()(const char* str) const noexcept { return std::hash<std::string_view>()(str); }
+};
+
+} // namespace CppCommon
+
+#endif // CPPCOMMON_UTILITY_TRANSPARENT_H
@@ -0,0 +1,80 @@
+//
+// Created by Ivan Shynkarenka on 15.10.2026
+//
+
+#include "benchmark_report.h"
+
+#include "algorithms/adler32.h"
+#include "algorithms/crc32c.h"
+#include "algorithms/hash.h"
+#include "algorithms/xxh32.h"
+#include "algorithms/xxh64.h"
+
+#include <vector>
+
+using namespace CppCommon;
+
+const size_t bytes_total = 1024 * 1024 * 1024;
+const int size_from = 16;
+const int size_to = 1024 * 1024;
+const auto settings = CppBenchmark::Settings().ParamRange(size_from, size_to, [](int from, int to, int& result) { int r = result; result *= 8; return r; });
+
+class BufferFixture
+{
+protected:
+    std::vector<uint8_t> buffer;
+
+    BufferFixture() : buffer(size_to)
+    {
+        // Fill buffer with pseudo random bytes
+        uint64_t seed = 1;
+        for (auto& item : buffer)
+        {
+            seed = seed * 6364136223846793005ull + 1442695040888963407ull;
+            item = (uint8_t)(seed >> 56);
+        }
+    }
+};
+
+template <typename TChecksum>
+void checksum(CppBenchmark::Context& context, const std::vector<uint8_t>& buffer, TChecksum calculate)
+{
+    const size_t size = context.x();
+    const size_t count = bytes_total / size;
+
+    uint64_t result = 0;
+    for (size_t i = 0; i < count; ++i)
+        result ^= calculate(buffer.data(), size);
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(count - 1);
+    context.metrics().AddBytes(count * size);
+    context.metrics().SetCustom("Checksum", result);
+}
+
+BENCHMARK_FIXTURE(BufferFixture, "CRC32C", settings)
+{
+    checksum(context, buffer, [](const void* data, size_t size) { return CRC32C::Calculate(data, size); });
+}
+
+BENCHMARK_FIXTURE(BufferFixture, "Adler32", settings)
+{
+    checksum(context, buffer, [](const void* data, size_t size) { return Adler32::Calculate(data, size); });
+}
+
+BENCHMARK_FIXTURE(BufferFixture, "XXH32", settings)
+{
+    checksum(context, buffer, [](const void* data, size_t size) { return XXH32::Calculate(data, size); });
+}
+
+BENCHMARK_FIXTURE(BufferFixture, "XXH64", settings)
+{
+    checksum(context, buffer, [](const void* data, size_t size) { return XXH64::Calculate(data, size); });
+}
+
+BENCHMARK_FIXTURE(BufferFixture, "Hash", settings)
+{
+    checksum(context, buffer, [](const void* data, size_t size) { return Hash::Calculate(data, size); });
+}
+
+BENCHMARK_REPORT_MAIN()
@@ -0,0 +1,104 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "benchmark_report.h"
+
+#include "algorithms/parallel.h"
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+using namespace CppCommon;
+
+const size_t items_count = 10000000;
+const int threads_from = 1;
+const int threads_to = 32;
+const auto settings = CppBenchmark::Settings().ParamRange(threads_from, threads_to, [](int from, int to, int& result) { int r = result; result *= 2; return r; });
+
+class ItemsFixture
+{
+protected:
+    std::vector<uint64_t> items;
+
+    ItemsFixture() : items(items_count)
+    {
+        // Fill items with pseudo random values
+        uint64_t seed = 1;
+        for (auto& item : items)
+        {
+            seed = seed * 6364136223846793005ull + 1442695040888963407ull;
+            item = seed >> 16;
+        }
+    }
+};
+
+BENCHMARK_FIXTURE(ItemsFixture, "std::sort")
+{
+    std::vector<uint64_t> sorted(items);
+    std::sort(sorted.begin(), sorted.end());
+    context.metrics().AddItems(sorted.size());
+    context.metrics().SetCustom("CRC", sorted[sorted.size() / 2]);
+}
+
+BENCHMARK_FIXTURE(ItemsFixture, "ParallelSort", settings)
+{
+    ThreadPool pool(context.x());
+    std::vector<uint64_t> sorted(items);
+    ParallelSort(pool, sorted.begin(), sorted.end());
+    context.metrics().AddItems(sorted.size());
+    context.metrics().SetCustom("CRC", sorted[sorted.size() / 2]);
+}
+
+BENCHMARK_FIXTURE(ItemsFixture, "std::accumulate")
+{
+    uint64_t sum = std::accumulate(items.begin(), items.end(), (uint64_t)0);
+    context.metrics().AddItems(items.size());
+    context.metrics().SetCustom("CRC", sum);
+}
+
+BENCHMARK_FIXTURE(ItemsFixture, "ParallelReduce", settings)
+{
+    ThreadPool pool(context.x());
+    uint64_t sum = ParallelReduce(pool, items.begin(), items.end(), (uint64_t)0, [](uint64_t value, uint64_t item) { return value + item; });
+    context.metrics().AddItems(items.size());
+    context.metrics().SetCustom("CRC", sum);
+}
+
+BENCHMARK_FIXTURE(ItemsFixture, "std::transform")
+{
+    std::vector<uint64_t> results(items.size());
+    std::transform(items.begin(), items.end(), results.begin(), [](uint64_t item) { return (item * item) ^ (item >> 7); });
+    context.metrics().AddItems(items.size());
+    context.metrics().SetCustom("CRC", results[results.size() / 2]);
+}
+
+BENCHMARK_FIXTURE(ItemsFixture, "ParallelTransform", settings)
+{
+    ThreadPool pool(context.x());
+    std::vector<uint64_t> results(items.size());
+    ParallelTransform(pool, items.begin(), items.end(), results.begin(), [](uint64_t item) { return (item * item) ^ (item >> 7); });
+    context.metrics().AddItems(items.size());
+    context.metrics().SetCustom("CRC", results[results.size() / 2]);
+}
+
+BENCHMARK_FIXTURE(ItemsFixture, "FlatMap-bulk")
+{
+    std::vector<std::pair<uint64_t, uint64_t>> pairs(items.size());
+    std::transform(items.begin(), items.end(), pairs.begin(), [](uint64_t item) { return std::make_pair(item, item); });
+    FlatMap<uint64_t, uint64_t> flatmap;
+    flatmap.insert(pairs.begin(), pairs.end());
+    context.metrics().AddItems(flatmap.size());
+}
+
+BENCHMARK_FIXTURE(ItemsFixture, "ParallelFlatMap", settings)
+{
+    ThreadPool pool(context.x());
+    std::vector<std::pair<uint64_t, uint64_t>> pairs(items.size());
+    ParallelTransform(pool, items.begin(), items.end(), pairs.begin(), [](uint64_t item) { return std::make_pair(item, item); });
+    auto flatmap = ParallelFlatMap<FlatMap<uint64_t, uint64_t>>(pool, pairs.begin(), pairs.end());
+    context.metrics().AddItems(flatmap.size());
+}
+
+BENCHMARK_REPORT_MAIN()
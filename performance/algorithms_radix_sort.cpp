@@ -0,0 +1,105 @@
+//
+// Created by Ivan Shynkarenka on 15.10.2026
+//
+
+#include "benchmark_report.h"
+
+#include "algorithms/parallel.h"
+#include "algorithms/radix_sort.h"
+
+#include <algorithm>
+#include <vector>
+
+using namespace CppCommon;
+
+const int items_from = 1000000;
+const int items_to = 100000000;
+const auto settings = CppBenchmark::Settings().Attempts(3).ParamRange(items_from, items_to, [](int from, int to, int& result) { int r = result; result *= 10; return r; });
+
+struct Event
+{
+    uint64_t timestamp;
+    uint64_t id;
+};
+
+class ItemsFixture : public virtual CppBenchmark::Fixture
+{
+protected:
+    std::vector<uint64_t> items;
+    std::vector<Event> events;
+
+    void Initialize(CppBenchmark::Context& context) override
+    {
+        items.resize(context.x());
+        events.resize(context.x());
+
+        // Fill items with pseudo random ids and events with timestamps of one day
+        uint64_t seed = 1;
+        for (size_t i = 0; i < items.size(); ++i)
+        {
+            seed = seed * 6364136223846793005ull + 1442695040888963407ull;
+            items[i] = seed >> 16;
+            events[i] = Event{ 1760486400000000000ull + (seed >> 17) % 86400000000000ull, i };
+        }
+    }
+
+    void Cleanup(CppBenchmark::Context& context) override
+    {
+        items.clear();
+        items.shrink_to_fit();
+        events.clear();
+        events.shrink_to_fit();
+    }
+};
+
+BENCHMARK_FIXTURE(ItemsFixture, "std::sort-ids", settings)
+{
+    std::vector<uint64_t> sorted(items);
+    std::sort(sorted.begin(), sorted.end());
+    context.metrics().AddItems(sorted.size());
+    context.metrics().SetCustom("CRC", sorted[sorted.size() / 2]);
+}
+
+BENCHMARK_FIXTURE(ItemsFixture, "RadixSort-ids", settings)
+{
+    std::vector<uint64_t> sorted(items);
+    RadixSort(sorted.begin(), sorted.end());
+    context.metrics().AddItems(sorted.size());
+    context.metrics().SetCustom("CRC", sorted[sorted.size() / 2]);
+}
+
+BENCHMARK_FIXTURE(ItemsFixture, "ParallelRadixSort-ids", settings)
+{
+    ThreadPool pool;
+    std::vector<uint64_t> sorted(items);
+    ParallelRadixSort(pool, sorted.begin(), sorted.end());
+    context.metrics().AddItems(sorted.size());
+    context.metrics().SetCustom("CRC", sorted[sorted.size() / 2]);
+}
+
+BENCHMARK_FIXTURE(ItemsFixture, "std::stable_sort-events", settings)
+{
+    std::vector<Event> sorted(events);
+    std::stable_sort(sorted.begin(), sorted.end(), [](const Event& event1, const Event& event2) { return event1.timestamp < event2.timestamp; });
+    context.metrics().AddItems(sorted.size());
+    context.metrics().SetCustom("CRC", sorted[sorted.size() / 2].id);
+}
+
+BENCHMARK_FIXTURE(ItemsFixture, "RadixSort-events", settings)
+{
+    std::vector<Event> sorted(events);
+    RadixSort(sorted.begin(), sorted.end(), [](const Event& event) { return event.timestamp; });
+    context.metrics().AddItems(sorted.size());
+    context.metrics().SetCustom("CRC", sorted[sorted.size() / 2].id);
+}
+
+BENCHMARK_FIXTURE(ItemsFixture, "ParallelRadixSort-events", settings)
+{
+    ThreadPool pool;
+    std::vector<Event> sorted(events);
+    ParallelRadixSort(pool, sorted.begin(), sorted.end(), [](const Event& event) { return event.timestamp; });
+    context.metrics().AddItems(sorted.size());
+    context.metrics().SetCustom("CRC", sorted[sorted.size() / 2].id);
+}
+
+BENCHMARK_REPORT_MAIN()
@@ -0,0 +1,162 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "benchmark_report.h"
+
+#include "algorithms/keyed_token_bucket.h"
+#include "algorithms/sharded_token_bucket.h"
+#include "algorithms/token_bucket.h"
+
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+using namespace CppCommon;
+
+const uint64_t operations = 10000000;
+const uint64_t rate = 100000000;
+const uint64_t burst = 1000000;
+const uint64_t keys_count = 1000000;
+const size_t batch_size = 64;
+const int threads_from = 1;
+const int threads_to = 32;
+const auto settings = CppBenchmark::Settings().ParamRange(threads_from, threads_to, [](int from, int to, int& result) { int r = result; result *= 2; return r; });
+
+template <class TTokenBucket>
+void consume(CppBenchmark::Context& context, TTokenBucket& tb)
+{
+    const int threads_count = context.x();
+    std::atomic<uint64_t> consumed(0);
+
+    // Start consumer threads of the shared rate limit
+    std::vector<std::thread> threads;
+    for (int thread = 0; thread < threads_count; ++thread)
+    {
+        threads.emplace_back([&tb, &consumed, threads_count]()
+        {
+            uint64_t count = 0;
+            for (uint64_t i = 0; i < (operations / threads_count); ++i)
+                if (tb.Consume())
+                    ++count;
+            consumed += count;
+        });
+    }
+
+    // Wait for all threads
+    for (auto& thread : threads)
+        thread.join();
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(operations - 1);
+    context.metrics().AddItems(consumed);
+    context.metrics().SetCustom("Consumed", consumed.load());
+}
+
+BENCHMARK("TokenBucket", settings)
+{
+    TokenBucket tb(rate, burst);
+    consume(context, tb);
+}
+
+BENCHMARK("ShardedTokenBucket", settings)
+{
+    ShardedTokenBucket tb(rate, burst);
+    consume(context, tb);
+}
+
+BENCHMARK("ShardedTokenBucket-exact", settings)
+{
+    ShardedTokenBucket tb(rate, burst, 0);
+    consume(context, tb);
+}
+
+// Baseline keyed rate limiter with token buckets in the mutex guarded map
+class MutexKeyedTokenBucket
+{
+public:
+    MutexKeyedTokenBucket(uint64_t keys_rate, uint64_t keys_burst) : _rate(keys_rate), _burst(keys_burst) {}
+
+    bool Consume(uint64_t key)
+    {
+        std::scoped_lock locker(_lock);
+        return _buckets.try_emplace(key, _rate, _burst).first->second.Consume();
+    }
+
+private:
+    std::mutex _lock;
+    uint64_t _rate;
+    uint64_t _burst;
+    std::unordered_map<uint64_t, TokenBucket> _buckets;
+};
+
+template <class TKeyedTokenBucket>
+void consume_keyed(CppBenchmark::Context& context, TKeyedTokenBucket& tb, bool batch)
+{
+    const int threads_count = context.x();
+    std::atomic<uint64_t> consumed(0);
+
+    // Start consumer threads of per key rate limits
+    std::vector<std::thread> threads;
+    for (int thread = 0; thread < threads_count; ++thread)
+    {
+        threads.emplace_back([&tb, &consumed, threads_count, thread, batch]()
+        {
+            uint64_t count = 0;
+            uint64_t seed = thread + 1;
+            uint64_t keys[batch_size];
+            for (uint64_t i = 0; i < (operations / threads_count); i += batch_size)
+            {
+                for (size_t j = 0; j < batch_size; ++j)
+                {
+                    seed = seed * 6364136223846793005ull + 1442695040888963407ull;
+                    keys[j] = 1 + ((seed >> 16) % keys_count);
+                }
+                if constexpr (std::is_same_v<TKeyedTokenBucket, KeyedTokenBucket<uint64_t>>)
+                {
+                    if (batch)
+                    {
+                        count += tb.ConsumeMany(keys, batch_size);
+                        continue;
+                    }
+                }
+                for (size_t j = 0; j < batch_size; ++j)
+                    if (tb.Consume(keys[j]))
+                        ++count;
+            }
+            consumed += count;
+        });
+    }
+
+    // Wait for all threads
+    for (auto& thread : threads)
+        thread.join();
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(operations - 1);
+    context.metrics().AddItems(consumed);
+    context.metrics().SetCustom("Consumed", consumed.load());
+}
+
+BENCHMARK("Keyed-std::mutex+std::unordered_map", settings)
+{
+    MutexKeyedTokenBucket tb(10, 100);
+    consume_keyed(context, tb, false);
+}
+
+BENCHMARK("KeyedTokenBucket", settings)
+{
+    KeyedTokenBucket<uint64_t> tb(10, 100);
+    consume_keyed(context, tb, false);
+}
+
+BENCHMARK("KeyedTokenBucket::ConsumeMany()", settings)
+{
+    KeyedTokenBucket<uint64_t> tb(10, 100);
+    consume_keyed(context, tb, true);
+}
+
+BENCHMARK_REPORT_MAIN()
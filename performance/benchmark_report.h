@@ -0,0 +1,499 @@
+//
+// Created by Ivan Shynkarenka on 15.10.2026
+//
+
+#ifndef CPPCOMMON_PERFORMANCE_BENCHMARK_REPORT_H
+#define CPPCOMMON_PERFORMANCE_BENCHMARK_REPORT_H
+
+#include "benchmark/cppbenchmark.h"
+
+#include "filesystem/file.h"
+#include "filesystem/path.h"
+#include "system/cpu.h"
+#include "system/environment.h"
+#include "system/process.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// Regression report mode of the performance suite:
+//
+//   --report=<file>       save results of repeat runs with the machine metadata as JSON
+//   --baseline=<file>     compare results against the stored baseline and flag regressions
+//   --repeat=<count>      count of repeat runs (default 5)
+//   --confidence=<level>  confidence level of intervals (default 0.95)
+//   --threshold=<ratio>   minimal relative slowdown reported as a regression (default 0.05)
+//
+// Each repeat run is a separate process, so run-to-run variance (memory layout, frequency
+// scaling, scheduling) is captured in the samples. The regression is flagged only when the
+// confidence interval of the time per operation difference (Welch's t-test) lies entirely
+// above zero and the relative slowdown exceeds the threshold. All other arguments are passed
+// to CppBenchmark launcher as is. Exit code is 1 if any regression is found.
+
+//! Benchmark results of repeat runs with the machine metadata
+struct BenchmarkReport
+{
+    //! Machine and build metadata
+    std::map<std::string, std::string> metadata;
+    //! Time per operation samples in nanoseconds (one sample per run) by benchmark phase name
+    std::map<std::string, std::vector<double>> results;
+
+    //! Collect the current machine and build metadata
+    static std::map<std::string, std::string> Machine()
+    {
+        std::map<std::string, std::string> metadata;
+        metadata["cpu.architecture"] = CppCommon::CPU::Architecture();
+        metadata["cpu.logical_cores"] = std::to_string(CppCommon::CPU::LogicalCores());
+        metadata["cpu.physical_cores"] = std::to_string(CppCommon::CPU::PhysicalCores());
+        metadata["cpu.clock_speed"] = std::to_string(CppCommon::CPU::ClockSpeed());
+        metadata["cpu.hyper_threading"] = CppCommon::CPU::HyperThreading() ? "true" : "false";
+        metadata["cpu.features"] = CppCommon::CPU::Features();
+        metadata["os.version"] = CppCommon::Environment::OSVersion();
+        metadata["os.bits"] = CppCommon::Environment::Is64BitOS() ? "64" : "32";
+        metadata["process.bits"] = CppCommon::Environment::Is64BitProcess() ? "64" : "32";
+        metadata["build"] = CppCommon::Environment::IsDebug() ? "debug" : "release";
+        return metadata;
+    }
+
+    //! Merge samples of another report
+    void Merge(const BenchmarkReport& report)
+    {
+        if (metadata.empty())
+            metadata = report.metadata;
+        for (const auto& result : report.results)
+            results[result.first].insert(results[result.first].end(), result.second.begin(), result.second.end());
+    }
+
+    //! Save the report into the JSON file
+    void Save(const CppCommon::Path& path) const
+    {
+        std::ostringstream json;
+        json << std::setprecision(17);
+        json << "{\n  \"metadata\": {";
+        for (auto it = metadata.begin(); it != metadata.end(); ++it)
+            json << ((it == metadata.begin()) ? "\n" : ",\n") << "    " << Quote(it->first) << ": " << Quote(it->second);
+        json << "\n  },\n  \"results\": {";
+        for (auto it = results.begin(); it != results.end(); ++it)
+        {
+            json << ((it == results.begin()) ? "\n" : ",\n") << "    " << Quote(it->first) << ": [";
+            for (size_t i = 0; i < it->second.size(); ++i)
+                json << ((i == 0) ? "" : ", ") << it->second[i];
+            json << "]";
+        }
+        json << "\n  }\n}\n";
+        CppCommon::File::WriteAllText(path, json.str());
+    }
+
+    //! Load the report from the JSON file saved with Save()
+    static BenchmarkReport Load(const CppCommon::Path& path)
+    {
+        BenchmarkReport report;
+        Parser parser(CppCommon::File::ReadAllText(path));
+
+        parser.Expect('{');
+        while (!parser.Next('}'))
+        {
+            std::string section = parser.String();
+            parser.Expect(':');
+            parser.Expect('{');
+            while (!parser.Next('}'))
+            {
+                std::string key = parser.String();
+                parser.Expect(':');
+                if (section == "metadata")
+                    report.metadata[key] = parser.String();
+                else if (section == "results")
+                {
+                    auto& samples = report.results[key];
+                    parser.Expect('[');
+                    while (!parser.Next(']'))
+                        samples.push_back(parser.Number());
+                }
+                else
+                    throw std::runtime_error("Unknown section '" + section + "' of the benchmark report!");
+            }
+        }
+        return report;
+    }
+
+private:
+    static std::string Quote(const std::string& str)
+    {
+        std::string result = "\"";
+        for (char ch : str)
+        {
+            switch (ch)
+            {
+                case '"': result += "\\\""; break;
+                case '\\': result += "\\\\"; break;
+                case '\n': result += "\\n"; break;
+                case '\r': result += "\\r"; break;
+                case '\t': result += "\\t"; break;
+                default:
+                    if ((unsigned char)ch < 0x20)
+                    {
+                        char buffer[8];
+                        std::snprintf(buffer, sizeof(buffer), "\\u%04x", (unsigned)ch);
+                        result += buffer;
+                    }
+                    else
+                        result += ch;
+                    break;
+            }
+        }
+        return result + "\"";
+    }
+
+    // Minimal JSON reader of the report schema: objects of strings and arrays of numbers
+    class Parser
+    {
+    public:
+        explicit Parser(std::string json) : _json(std::move(json)), _position(0) {}
+
+        void Expect(char ch)
+        {
+            if (Peek() != ch)
+                throw std::runtime_error(std::string("Invalid benchmark report: '") + ch + "' expected at position " + std::to_string(_position) + "!");
+            ++_position;
+        }
+
+        // Check for the closing bracket or skip the values separator
+        bool Next(char close)
+        {
+            if (Peek() == close)
+            {
+                ++_position;
+                return true;
+            }
+            if (Peek() == ',')
+                ++_position;
+            return false;
+        }
+
+        std::string String()
+        {
+            Expect('"');
+            std::string result;
+            while ((_position < _json.size()) && (_json[_position] != '"'))
+            {
+                char ch = _json[_position++];
+                if ((ch == '\\') && (_position < _json.size()))
+                {
+                    ch = _json[_position++];
+                    switch (ch)
+                    {
+                        case 'n': result += '\n'; break;
+                        case 'r': result += '\r'; break;
+                        case 't': result += '\t'; break;
+                        case 'u':
+                            result += (char)std::strtol(_json.substr(_position, 4).c_str(), nullptr, 16);
+                            _position += 4;
+                            break;
+                        default: result += ch; break;
+                    }
+                }
+                else
+                    result += ch;
+            }
+            Expect('"');
+            return result;
+        }
+
+        double Number()
+        {
+            Peek();
+            const char* start = _json.c_str() + _position;
+            char* end = nullptr;
+            double result = std::strtod(start, &end);
+            if (end == start)
+                throw std::runtime_error("Invalid benchmark report: number expected at position " + std::to_string(_position) + "!");
+            _position += (size_t)(end - start);
+            return result;
+        }
+
+    private:
+        std::string _json;
+        size_t _position;
+
+        char Peek()
+        {
+            while ((_position < _json.size()) && std::isspace((unsigned char)_json[_position]))
+                ++_position;
+            return (_position < _json.size()) ? _json[_position] : '\0';
+        }
+    };
+};
+
+//! Comparison of the benchmark phase against the baseline
+struct BenchmarkComparison
+{
+    std::string name;
+    //! Mean time per operation of the baseline and the current runs in nanoseconds
+    double baseline{0};
+    double current{0};
+    //! Confidence interval of the mean time per operation difference in nanoseconds
+    double lower{0};
+    double upper{0};
+    //! Is the difference statistically significant?
+    bool significant{false};
+
+    //! Relative change of the time per operation (positive is slower)
+    double change() const noexcept { return (baseline > 0) ? ((current - baseline) / baseline) : 0; }
+
+    //! Compare samples using Welch's t-test confidence interval of the means difference
+    static BenchmarkComparison Compare(const std::string& name, const std::vector<double>& baseline, const std::vector<double>& current, double confidence)
+    {
+        BenchmarkComparison result;
+        result.name = name;
+
+        double mean1, variance1, mean2, variance2;
+        Statistics(baseline, mean1, variance1);
+        Statistics(current, mean2, variance2);
+        result.baseline = mean1;
+        result.current = mean2;
+        result.lower = result.upper = mean2 - mean1;
+
+        // Confidence interval requires at least two samples of each side
+        if ((baseline.size() < 2) || (current.size() < 2))
+            return result;
+
+        double error1 = variance1 / baseline.size();
+        double error2 = variance2 / current.size();
+        double error = std::sqrt(error1 + error2);
+        if (error == 0)
+        {
+            result.significant = (mean1 != mean2);
+            return result;
+        }
+
+        // Welch-Satterthwaite degrees of freedom
+        double freedom = ((error1 + error2) * (error1 + error2)) / ((error1 * error1) / (baseline.size() - 1) + (error2 * error2) / (current.size() - 1));
+        double margin = StudentQuantile(0.5 + confidence / 2, freedom) * error;
+        result.lower = (mean2 - mean1) - margin;
+        result.upper = (mean2 - mean1) + margin;
+        result.significant = (result.lower > 0) || (result.upper < 0);
+        return result;
+    }
+
+private:
+    static void Statistics(const std::vector<double>& samples, double& mean, double& variance)
+    {
+        mean = variance = 0;
+        if (samples.empty())
+            return;
+        for (double sample : samples)
+            mean += sample;
+        mean /= samples.size();
+        if (samples.size() < 2)
+            return;
+        for (double sample : samples)
+            variance += (sample - mean) * (sample - mean);
+        variance /= (samples.size() - 1);
+    }
+
+    // Standard normal distribution quantile (Acklam's rational approximation)
+    static double NormalQuantile(double p)
+    {
+        static const double a[] = { -3.969683028665376e+01, 2.209460984245205e+02, -2.759285104469687e+02, 1.383577518672690e+02, -3.066479806614716e+01, 2.506628277459239e+00 };
+        static const double b[] = { -5.447609879822406e+01, 1.615858368580409e+02, -1.556989798598866e+02, 6.680131188771972e+01, -1.328068155288572e+01 };
+        static const double c[] = { -7.784894002430293e-03, -3.223964580411365e-01, -2.400758277161838e+00, -2.549732539343734e+00, 4.374664141464968e+00, 2.938163982698783e+00 };
+        static const double d[] = { 7.784695709041462e-03, 3.224671290700398e-01, 2.445134137142996e+00, 3.754408661907416e+00 };
+
+        if (p < 0.02425)
+        {
+            double q = std::sqrt(-2 * std::log(p));
+            return (((((c[0] * q + c[1]) * q + c[2]) * q + c[3]) * q + c[4]) * q + c[5]) / ((((d[0] * q + d[1]) * q + d[2]) * q + d[3]) * q + 1);
+        }
+        if (p > 1 - 0.02425)
+            return -NormalQuantile(1 - p);
+
+        double q = p - 0.5;
+        double r = q * q;
+        return (((((a[0] * r + a[1]) * r + a[2]) * r + a[3]) * r + a[4]) * r + a[5]) * q / (((((b[0] * r + b[1]) * r + b[2]) * r + b[3]) * r + b[4]) * r + 1);
+    }
+
+    // Student's t-distribution quantile (Cornish-Fisher expansion of the normal quantile)
+    static double StudentQuantile(double p, double freedom)
+    {
+        double z = NormalQuantile(p);
+        double z2 = z * z;
+        double g1 = (z2 + 1) * z / 4;
+        double g2 = ((5 * z2 + 16) * z2 + 3) * z / 96;
+        double g3 = (((3 * z2 + 19) * z2 + 17) * z2 - 15) * z / 384;
+        double g4 = ((((79 * z2 + 776) * z2 + 1482) * z2 - 1920) * z2 - 945) * z / 92160;
+        return z + g1 / freedom + g2 / std::pow(freedom, 2) + g3 / std::pow(freedom, 3) + g4 / std::pow(freedom, 4);
+    }
+};
+
+//! CppBenchmark reporter which collects the time per operation of all benchmark phases
+class BenchmarkReportCollector : public CppBenchmark::Reporter
+{
+public:
+    explicit BenchmarkReportCollector(BenchmarkReport& report) : _report(report) {}
+
+    void ReportPhase(const CppBenchmark::PhaseCore& phase, const CppBenchmark::PhaseMetrics& metrics) override
+    {
+        if (metrics.total_operations() > 0)
+            _report.results[phase.name()].push_back((double)metrics.total_time() / metrics.total_operations());
+    }
+
+private:
+    BenchmarkReport& _report;
+};
+
+//! Launch benchmarks in the report mode or with the default console reporter
+inline int BenchmarkReportMain(int argc, char** argv)
+{
+    std::string report_path;
+    std::string baseline_path;
+    std::string run_path;
+    int repeat = 5;
+    double confidence = 0.95;
+    double threshold = 0.05;
+
+    // Separate report options from CppBenchmark launcher arguments
+    std::vector<std::string> arguments;
+    std::vector<char*> launcher = { argv[0] };
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string argument = argv[i];
+        auto option = [&argument](const char* name, std::string& value)
+        {
+            std::string prefix = std::string(name) + "=";
+            if (argument.compare(0, prefix.size(), prefix) != 0)
+                return false;
+            value = argument.substr(prefix.size());
+            return true;
+        };
+
+        std::string value;
+        if (option("--report", value))
+            report_path = value;
+        else if (option("--baseline", value))
+            baseline_path = value;
+        else if (option("--report-run", value))
+            run_path = value;
+        else if (option("--repeat", value))
+            repeat = std::max(std::atoi(value.c_str()), 1);
+        else if (option("--confidence", value))
+            confidence = std::min(std::max(std::atof(value.c_str()), 0.5), 0.999);
+        else if (option("--threshold", value))
+            threshold = std::max(std::atof(value.c_str()), 0.0);
+        else
+        {
+            arguments.push_back(argument);
+            launcher.push_back(argv[i]);
+        }
+    }
+
+    // Default mode: single run with the console reporter
+    if (report_path.empty() && baseline_path.empty() && run_path.empty())
+    {
+        CppBenchmark::LauncherConsole::GetInstance().Initialize(argc, argv);
+        CppBenchmark::LauncherConsole::GetInstance().Launch();
+        CppBenchmark::LauncherConsole::GetInstance().Report();
+        return 0;
+    }
+
+    // Single repeat run: collect results into the given file
+    if (!run_path.empty())
+    {
+        BenchmarkReport report;
+        BenchmarkReportCollector collector(report);
+        CppBenchmark::LauncherConsole::GetInstance().Initialize((int)launcher.size(), launcher.data());
+        CppBenchmark::LauncherConsole::GetInstance().Launch();
+        CppBenchmark::LauncherConsole::GetInstance().Report(collector);
+        report.Save(run_path);
+        return 0;
+    }
+
+    // Repeat runs in separate processes
+    BenchmarkReport report;
+    CppCommon::Path executable = CppCommon::Path::executable();
+    CppCommon::Path run = CppCommon::Path::temp() / CppCommon::Path::unique();
+    arguments.push_back("--report-run=" + run.string());
+    for (int i = 0; i < repeat; ++i)
+    {
+        std::cout << "Benchmark run " << (i + 1) << " of " << repeat << std::endl;
+        int result = CppCommon::Process::Execute(executable.string(), &arguments).Wait();
+        if (result != 0)
+        {
+            std::cerr << "Benchmark run failed with the exit code " << result << "!" << std::endl;
+            return result;
+        }
+        report.Merge(BenchmarkReport::Load(run));
+        CppCommon::Path::Remove(run);
+    }
+    report.metadata = BenchmarkReport::Machine();
+
+    if (!report_path.empty())
+    {
+        report.Save(report_path);
+        std::cout << "Benchmark report saved into " << report_path << std::endl;
+    }
+
+    if (baseline_path.empty())
+        return 0;
+
+    BenchmarkReport baseline = BenchmarkReport::Load(baseline_path);
+
+    // Results of different machines are not comparable
+    for (const auto& entry : report.metadata)
+    {
+        auto it = baseline.metadata.find(entry.first);
+        if ((it != baseline.metadata.end()) && (it->second != entry.second))
+            std::cout << "Warning: baseline " << entry.first << " '" << it->second << "' differs from the current '" << entry.second << "'" << std::endl;
+    }
+
+    int regressions = 0;
+    std::cout << std::endl;
+    std::cout << std::fixed << std::setprecision(1);
+    std::cout << std::left << std::setw(48) << "Benchmark" << std::right << std::setw(14) << "Baseline, ns" << std::setw(14) << "Current, ns" << std::setw(10) << "Change" << std::setw(28) << "Difference CI, ns" << "  Verdict" << std::endl;
+    for (const auto& result : report.results)
+    {
+        auto it = baseline.results.find(result.first);
+        if (it == baseline.results.end())
+        {
+            std::cout << std::left << std::setw(48) << result.first << std::right << std::setw(14) << "-" << "  (not in the baseline)" << std::endl;
+            continue;
+        }
+
+        auto comparison = BenchmarkComparison::Compare(result.first, it->second, result.second, confidence);
+        std::string verdict = "unchanged";
+        if (comparison.significant && (comparison.change() > threshold))
+        {
+            verdict = "REGRESSION";
+            ++regressions;
+        }
+        else if (comparison.significant && (comparison.change() < -threshold))
+            verdict = "improvement";
+        else if (!comparison.significant && (std::fabs(comparison.change()) > threshold))
+            verdict = "noise";
+
+        std::ostringstream interval;
+        interval << std::fixed << std::setprecision(1) << "[" << comparison.lower << ", " << comparison.upper << "]";
+        std::cout << std::left << std::setw(48) << result.first << std::right << std::setw(14) << comparison.baseline << std::setw(14) << comparison.current << std::setw(9) << (comparison.change() * 100) << "%" << std::setw(28) << interval.str() << "  " << verdict << std::endl;
+    }
+    std::cout << std::endl << "Regressions found: " << regressions << " (confidence " << (confidence * 100) << "%, threshold " << (threshold * 100) << "%)" << std::endl;
+
+    return (regressions > 0) ? 1 : 0;
+}
+
+//! Benchmark main function with the regression report mode
+#define BENCHMARK_REPORT_MAIN()\
+int main(int argc, char** argv)\
+{\
+    return BenchmarkReportMain(argc, argv);\
+}
+
+#endif // CPPCOMMON_PERFORMANCE_BENCHMARK_REPORT_H
@@ -0,0 +1,168 @@
+//
+// Created by Ivan Shynkarenka on 15.10.2026
+//
+
+#include "benchmark_report.h"
+
+#include "cache/filecache.h"
+#include "filesystem/directory.h"
+#include "filesystem/file.h"
+
+#include "zipfian.h"
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace CppCommon;
+
+const uint64_t items_to_produce = 1000000;
+const int directories_count = 32;
+const int files_count = 64;
+const size_t file_size = 4096;
+const int threads_from = 1;
+const int threads_to = 32;
+const auto settings = CppBenchmark::Settings().ParamRange(threads_from, threads_to, [](int from, int to, int& result) { int r = result; result *= 2; return r; });
+const auto ingest_settings = CppBenchmark::Settings().Attempts(3).Operations(1).ParamRange(threads_from, 8, [](int from, int to, int& result) { int r = result; result *= 2; return r; });
+
+// Generated directory tree of 32 directories with 64 files of 4 KB each
+class TreeFixture : public virtual CppBenchmark::Fixture
+{
+protected:
+    Path root;
+    std::vector<std::string> keys;
+
+    TreeFixture() : root(Path::current() / "filecache.tmp")
+    {
+        for (int directory = 0; directory < directories_count; ++directory)
+            for (int file = 0; file < files_count; ++file)
+                keys.emplace_back("/" + std::to_string(directory) + "/" + std::to_string(file) + ".html");
+    }
+
+    void Initialize(CppBenchmark::Context& context) override
+    {
+        for (int directory = 0; directory < directories_count; ++directory)
+        {
+            Directory dir = Directory::CreateTree(root / std::to_string(directory));
+            for (int file = 0; file < files_count; ++file)
+                File::WriteAllText(dir / (std::to_string(file) + ".html"), std::string(file_size, (char)('a' + (file % 26))));
+        }
+    }
+
+    void Cleanup(CppBenchmark::Context& context) override
+    {
+        Directory::RemoveAll(root);
+    }
+};
+
+// Cold cache path setup: the directory tree is walked and all files are loaded into the new file cache
+BENCHMARK_FIXTURE(TreeFixture, "FileCache::insert_path()", ingest_settings)
+{
+    FileCache cache;
+    cache.insert_path(root, "/", Timespan(0), nullptr, context.x());
+
+    // Update benchmark metrics
+    context.metrics().AddItems(cache.size());
+    context.metrics().AddBytes(cache.metrics().weight);
+}
+
+BENCHMARK_FIXTURE(TreeFixture, "FileCache::insert_mapped_path()", ingest_settings)
+{
+    FileCache cache;
+    cache.insert_mapped_path(root, "/", Timespan(0), nullptr, context.x());
+
+    // Update benchmark metrics
+    context.metrics().AddItems(cache.size());
+}
+
+class FindFixture : public TreeFixture
+{
+protected:
+    FileCache cache;
+    std::vector<uint64_t> zipfian;
+
+    FindFixture() : zipfian(ZipfianKeys(items_to_produce, directories_count * files_count)) {}
+
+    void Initialize(CppBenchmark::Context& context) override
+    {
+        TreeFixture::Initialize(context);
+        cache.insert_path(root);
+    }
+
+    void Cleanup(CppBenchmark::Context& context) override
+    {
+        cache.clear();
+        TreeFixture::Cleanup(context);
+    }
+
+    void find(CppBenchmark::Context& context, bool uniform)
+    {
+        const int threads_count = context.x();
+        std::atomic<uint64_t> crc(0);
+
+        // Start threads which find cache values by keys with the given distribution
+        std::vector<std::thread> threads;
+        for (int thread = 0; thread < threads_count; ++thread)
+        {
+            threads.emplace_back([this, &crc, thread, threads_count, uniform]()
+            {
+                uint64_t result = 0;
+                uint64_t items = (items_to_produce / threads_count);
+                for (uint64_t i = 0; i < items; ++i)
+                {
+                    uint64_t index = uniform ? ((((thread * items) + i) * 7919) % keys.size()) : zipfian[(thread * items) + i];
+                    auto value = cache.find(keys[index]);
+                    if (value.first)
+                        result += (uint8_t)value.second[i % value.second.size()];
+                }
+                crc += result;
+            });
+        }
+
+        // Wait for all threads
+        for (auto& thread : threads)
+            thread.join();
+
+        // Update benchmark metrics
+        context.metrics().AddOperations(items_to_produce - 1);
+        context.metrics().SetCustom("CRC", crc.load());
+    }
+};
+
+BENCHMARK_FIXTURE(FindFixture, "FileCache::find()", settings)
+{
+    find(context, true);
+}
+
+BENCHMARK_FIXTURE(FindFixture, "FileCache::find() (Zipfian)", settings)
+{
+    find(context, false);
+}
+
+class PrefixFixture : public FindFixture
+{
+protected:
+    uint64_t index = 0;
+    std::string key;
+};
+
+// Directory listing: the prefix index visits only keys of the listed directory
+BENCHMARK_FIXTURE(PrefixFixture, "FileCache::find_prefix()")
+{
+    auto result = cache.find_prefix("/" + std::to_string(index++ % directories_count) + "/");
+
+    // Update benchmark metrics
+    context.metrics().AddItems(result.size());
+}
+
+// Longest-prefix route matching of nested paths under cached files
+BENCHMARK_FIXTURE(PrefixFixture, "FileCache::find_route()")
+{
+    auto result = cache.find_route(keys[(index++ * 7919) % keys.size()] + "/users/42", key);
+
+    // Update benchmark metrics
+    context.metrics().AddItems(result.first ? 1 : 0);
+}
+
+BENCHMARK_REPORT_MAIN()
@@ -0,0 +1,223 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "benchmark_report.h"
+
+#include "cache/memcache.h"
+#include "time/latency_histogram.h"
+
+#include "zipfian.h"
+
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace CppCommon;
+
+const uint64_t items_to_produce = 1000000;
+const uint64_t keys_count = 100000;
+const uint64_t blobs_count = 1000;
+const int threads_from = 1;
+const int threads_to = 32;
+const auto settings = CppBenchmark::Settings().ParamRange(threads_from, threads_to, [](int from, int to, int& result) { int r = result; result *= 2; return r; });
+
+// Zipfian keys are generated once, so the generation is not measured
+const std::vector<uint64_t> zipfian_keys = ZipfianKeys(items_to_produce, keys_count);
+
+void produce(CppBenchmark::Context& context, size_t shards, size_t capacity, MemCacheEviction eviction, uint64_t writes = 10, bool zipfian = false)
+{
+    const int threads_count = context.x();
+    std::atomic<uint64_t> crc(0);
+
+    // Create memory cache and fill it with initial values
+    MemCache<uint64_t, uint64_t> cache(shards, capacity, eviction);
+    for (uint64_t i = 0; i < keys_count; ++i)
+        cache.insert(i, i);
+
+    // Start threads: the given percent of updates and the rest of finds
+    std::vector<std::thread> threads;
+    for (int thread = 0; thread < threads_count; ++thread)
+    {
+        threads.emplace_back([&cache, &crc, thread, threads_count, writes, zipfian]()
+        {
+            uint64_t result = 0;
+            uint64_t items = (items_to_produce / threads_count);
+            for (uint64_t i = 0; i < items; ++i)
+            {
+                uint64_t key = zipfian ? zipfian_keys[(thread * items) + i] : ((((thread * items) + i) * 7919) % keys_count);
+                uint64_t value;
+                if (((i * 37) % 100) < writes)
+                    cache.insert(key, i);
+                else if (cache.find(key, value))
+                    result += value;
+            }
+            crc += result;
+        });
+    }
+
+    // Wait for all threads
+    for (auto& thread : threads)
+        thread.join();
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(items_to_produce - 1);
+    context.metrics().SetCustom("CRC", crc.load());
+    context.metrics().SetCustom("MemCache.hit_ratio", cache.metrics().hit_ratio());
+}
+
+void produce_ttl(CppBenchmark::Context& context, size_t limit)
+{
+    const int threads_count = context.x();
+    std::atomic<bool> done(false);
+
+    // Create memory cache with short timeouts of all values
+    MemCache<uint64_t, uint64_t> cache(16);
+    for (uint64_t i = 0; i < keys_count; ++i)
+        cache.insert(i, i, Timespan::milliseconds(1 + (i % 10)));
+
+    // Start the watchdog thread which erases expired values
+    LatencyHistogram latency;
+    auto watchdog = std::thread([&cache, &done, &latency, limit]()
+    {
+        while (!done)
+        {
+            uint64_t timestamp = Timestamp::nano();
+            cache.watchdog(UtcTimestamp(), limit);
+            latency.Record(Timestamp::nano() - timestamp);
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    });
+
+    // Start threads: 50% of updates with short timeouts and 50% of finds
+    std::vector<std::thread> threads;
+    for (int thread = 0; thread < threads_count; ++thread)
+    {
+        threads.emplace_back([&cache, thread, threads_count]()
+        {
+            uint64_t items = (items_to_produce / threads_count);
+            for (uint64_t i = 0; i < items; ++i)
+            {
+                uint64_t key = zipfian_keys[(thread * items) + i];
+                uint64_t value;
+                if ((i % 2) == 0)
+                    cache.insert(key, i, Timespan::milliseconds(1 + (i % 10)));
+                else
+                    cache.find(key, value);
+            }
+        });
+    }
+
+    // Wait for all threads
+    for (auto& thread : threads)
+        thread.join();
+
+    // Wait for the watchdog thread
+    done = true;
+    watchdog.join();
+
+    // Update benchmark metrics
+    CacheMetrics metrics = cache.metrics();
+    context.metrics().AddOperations(items_to_produce - 1);
+    context.metrics().SetCustom("MemCache.expired", metrics.expired);
+    context.metrics().SetCustom("MemCache.hit_ratio", metrics.hit_ratio());
+    context.metrics().SetCustom("Watchdog.calls", latency.count());
+    context.metrics().SetCustom("Watchdog.p50", latency.p50());
+    context.metrics().SetCustom("Watchdog.p99", latency.p99());
+    context.metrics().SetCustom("Watchdog.max", latency.max());
+}
+
+BENCHMARK("MemCache", settings)
+{
+    produce(context, 1, 0, MemCacheEviction::LRU);
+}
+
+BENCHMARK("MemCache (16 shards)", settings)
+{
+    produce(context, 16, 0, MemCacheEviction::LRU);
+}
+
+BENCHMARK("MemCache (16 shards, LRU)", settings)
+{
+    produce(context, 16, keys_count / 2, MemCacheEviction::LRU);
+}
+
+BENCHMARK("MemCache (16 shards, CLOCK)", settings)
+{
+    produce(context, 16, keys_count / 2, MemCacheEviction::CLOCK);
+}
+
+BENCHMARK("MemCache (16 shards, write-heavy)", settings)
+{
+    produce(context, 16, 0, MemCacheEviction::LRU, 50);
+}
+
+BENCHMARK("MemCache (16 shards, Zipfian)", settings)
+{
+    produce(context, 16, 0, MemCacheEviction::LRU, 10, true);
+}
+
+BENCHMARK("MemCache (16 shards, Zipfian, write-heavy)", settings)
+{
+    produce(context, 16, 0, MemCacheEviction::LRU, 50, true);
+}
+
+BENCHMARK("MemCache (16 shards, LRU, Zipfian)", settings)
+{
+    produce(context, 16, keys_count / 10, MemCacheEviction::LRU, 10, true);
+}
+
+BENCHMARK("MemCache (16 shards, CLOCK, Zipfian)", settings)
+{
+    produce(context, 16, keys_count / 10, MemCacheEviction::CLOCK, 10, true);
+}
+
+BENCHMARK("MemCache (16 shards, TTL-heavy)", settings)
+{
+    produce_ttl(context, 0);
+}
+
+BENCHMARK("MemCache (16 shards, TTL-heavy, watchdog limit 1000)", settings)
+{
+    produce_ttl(context, 1000);
+}
+
+class BlobFixture : public virtual CppBenchmark::Fixture
+{
+protected:
+    MemCache<uint64_t, std::string> cache;
+
+    BlobFixture() : cache(16)
+    {
+        for (uint64_t i = 0; i < blobs_count; ++i)
+            cache.insert(i, std::string(16 * 1024, (char)i));
+    }
+};
+
+BENCHMARK_FIXTURE(BlobFixture, "MemCache find 16 KB blob (copy)")
+{
+    uint64_t crc = 0;
+    std::string value;
+    for (uint64_t i = 0; i < items_to_produce; ++i)
+        if (cache.find(i % blobs_count, value))
+            crc += (uint8_t)value[i % value.size()];
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(items_to_produce - 1);
+    context.metrics().SetCustom("CRC", crc);
+}
+
+BENCHMARK_FIXTURE(BlobFixture, "MemCache visit 16 KB blob (zero-copy)")
+{
+    uint64_t crc = 0;
+    for (uint64_t i = 0; i < items_to_produce; ++i)
+        cache.visit(i % blobs_count, [&crc, i](const std::string& value) { crc += (uint8_t)value[i % value.size()]; });
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(items_to_produce - 1);
+    context.metrics().SetCustom("CRC", crc);
+}
+
+BENCHMARK_REPORT_MAIN()
@@ -0,0 +1,68 @@
+//
+// Created by Ivan Shynkarenka on 15.10.2026
+//
+
+#include "benchmark_report.h"
+
+#include "cache/tieredcache.h"
+#include "filesystem/directory.h"
+
+#include <string>
+
+using namespace CppCommon;
+
+const uint64_t items_to_produce = 1000000;
+const uint64_t keys_count = 100000;
+const size_t capacity = keys_count / 4;
+const size_t shards = 16;
+
+// Skewed keys: 90% of requests hit 20% of keys
+uint64_t request_key(uint64_t i)
+{
+    uint64_t hash = i * 0x9E3779B97F4A7C15ull;
+    return ((hash % 10) < 9) ? ((hash >> 8) % (keys_count / 5)) : ((hash >> 8) % keys_count);
+}
+
+template <class TCache>
+void produce(CppBenchmark::Context& context, TCache& cache)
+{
+    uint64_t misses = 0;
+    uint64_t value;
+    for (uint64_t i = 0; i < items_to_produce; ++i)
+    {
+        uint64_t key = request_key(i);
+        if (!cache.find(key, value))
+        {
+            // Missed cache value is loaded from the database
+            ++misses;
+            cache.insert(key, key);
+        }
+    }
+
+    context.metrics().AddOperations(items_to_produce - 1);
+    context.metrics().SetCustom("Misses", misses);
+}
+
+BENCHMARK("MemCache (evicted values dropped)")
+{
+    MemCache<uint64_t, uint64_t> cache(shards, capacity);
+    for (uint64_t i = 0; i < keys_count; ++i)
+        cache.insert(i, i);
+
+    produce(context, cache);
+}
+
+BENCHMARK("TieredCache (evicted values spilled to disk)")
+{
+    Path path = Path::current() / "tiered_benchmark";
+    {
+        TieredCache<uint64_t, uint64_t> cache(path, shards, capacity);
+        for (uint64_t i = 0; i < keys_count; ++i)
+            cache.insert(i, i);
+
+        produce(context, cache);
+    }
+    Directory::RemoveAll(path);
+}
+
+BENCHMARK_REPORT_MAIN()
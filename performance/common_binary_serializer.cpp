@@ -0,0 +1,73 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "benchmark_report.h"
+
+#include "common/binary_serializer.h"
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace CppCommon;
+
+const uint64_t operations = 10000000;
+
+struct Quote
+{
+    uint64_t id;
+    std::string_view symbol;
+    int64_t bid;
+    int64_t ask;
+    uint32_t bid_size;
+    uint32_t ask_size;
+};
+
+template <>
+struct CppCommon::BinarySchema<Quote>
+{
+    typedef std::tuple<
+        BinaryField<&Quote::id, BinaryEncoding::VARINT>,
+        BinaryField<&Quote::symbol>,
+        BinaryField<&Quote::bid, BinaryEncoding::VARINT>,
+        BinaryField<&Quote::ask, BinaryEncoding::VARINT>,
+        BinaryField<&Quote::bid_size>,
+        BinaryField<&Quote::ask_size>> fields;
+};
+
+class QuoteFixture
+{
+protected:
+    Quote quote;
+    std::vector<uint8_t> buffer;
+    std::vector<uint8_t> serialized;
+
+    QuoteFixture() : quote{ 123456789, "EUR/USD", 108250, 108260, 1000000, 2000000 }, buffer(256)
+    {
+        serialized.resize(BinarySerializer::Size(quote));
+        BinarySerializer::Serialize(quote, serialized);
+    }
+};
+
+BENCHMARK_FIXTURE(QuoteFixture, "BinarySerializer::Serialize()", operations)
+{
+    size_t size = BinarySerializer::Serialize(quote, buffer);
+    context.metrics().AddBytes(size);
+}
+
+BENCHMARK_FIXTURE(QuoteFixture, "BinarySerializer::Deserialize()", operations)
+{
+    Quote result;
+    size_t size = BinarySerializer::Deserialize(serialized, result);
+    context.metrics().AddBytes(size);
+}
+
+BENCHMARK_FIXTURE(QuoteFixture, "std::ostringstream", operations / 10)
+{
+    std::ostringstream stream;
+    stream << quote.id << ' ' << quote.symbol << ' ' << quote.bid << ' ' << quote.ask << ' ' << quote.bid_size << ' ' << quote.ask_size;
+    context.metrics().AddBytes(stream.str().size());
+}
+
+BENCHMARK_REPORT_MAIN()
@@ -0,0 +1,92 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "benchmark_report.h"
+
+#include "common/buffered_reader.h"
+#include "common/buffered_writer.h"
+#include "filesystem/file.h"
+
+#include <cstring>
+#include <string>
+
+using namespace CppCommon;
+
+const uint64_t iterations = 10;
+const size_t records = 1000000;
+const size_t record = 32;
+
+class RecordsFixture : public virtual CppBenchmark::Fixture
+{
+protected:
+    File file;
+
+    RecordsFixture() : file("test.tmp") {}
+
+    void Initialize(CppBenchmark::Context& context) override
+    {
+        File::WriteAllText(file, std::string(records * record, 'x'));
+    }
+
+    void Cleanup(CppBenchmark::Context& context) override
+    {
+        File::Remove(file);
+    }
+};
+
+BENCHMARK_FIXTURE(RecordsFixture, "File::Read()", iterations)
+{
+    file.Open(true, false);
+    uint8_t buffer[record];
+    size_t count = 0;
+    while (file.Read(buffer, sizeof(buffer)) == sizeof(buffer))
+        ++count;
+    file.Close();
+    context.metrics().AddItems(count);
+    context.metrics().AddBytes(count * record);
+}
+
+BENCHMARK_FIXTURE(RecordsFixture, "BufferedReader::Peek()", iterations)
+{
+    file.Open(true, false, false, File::DEFAULT_ATTRIBUTES, File::DEFAULT_PERMISSIONS, 0);
+    BufferedReader reader(file);
+    size_t count = 0;
+    while (reader.Peek(record).size() >= record)
+    {
+        reader.Consume(record);
+        ++count;
+    }
+    file.Close();
+    context.metrics().AddItems(count);
+    context.metrics().AddBytes(count * record);
+}
+
+BENCHMARK_FIXTURE(RecordsFixture, "File::Write()", iterations)
+{
+    file.Open(false, true, true);
+    uint8_t buffer[record] = { 0 };
+    for (size_t i = 0; i < records; ++i)
+        file.Write(buffer, sizeof(buffer));
+    file.Close();
+    context.metrics().AddItems(records);
+    context.metrics().AddBytes(records * record);
+}
+
+BENCHMARK_FIXTURE(RecordsFixture, "BufferedWriter::Prepare()", iterations)
+{
+    file.Open(false, true, true, File::DEFAULT_ATTRIBUTES, File::DEFAULT_PERMISSIONS, 0);
+    {
+        BufferedWriter writer(file);
+        for (size_t i = 0; i < records; ++i)
+        {
+            std::memset(writer.Prepare(record).data(), 0, record);
+            writer.Commit(record);
+        }
+    }
+    file.Close();
+    context.metrics().AddItems(records);
+    context.metrics().AddBytes(records * record);
+}
+
+BENCHMARK_REPORT_MAIN()
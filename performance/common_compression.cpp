@@ -0,0 +1,121 @@
+//
+// Created by Ivan Shynkarenka on 15.10.2026
+//
+
+#include "benchmark_report.h"
+
+#include "algorithms/lz4.h"
+#include "common/compressing_writer.h"
+#include "common/decompressing_reader.h"
+#include "threads/thread_pool.h"
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <vector>
+
+using namespace CppCommon;
+
+const uint64_t iterations = 10;
+const size_t size = 64 * 1024 * 1024;
+
+// Writer which counts written bytes
+class NullWriter : public Writer
+{
+public:
+    size_t Write(const void* buffer, size_t size) override { return size; }
+};
+
+// Reader of the compressed stream in memory
+class MemoryReader : public Reader
+{
+public:
+    explicit MemoryReader(const std::vector<uint8_t>& buffer) : _buffer(buffer), _offset(0) {}
+
+    size_t Read(void* buffer, size_t size) override
+    {
+        size = std::min(size, _buffer.size() - _offset);
+        std::memcpy(buffer, _buffer.data() + _offset, size);
+        _offset += size;
+        return size;
+    }
+
+private:
+    const std::vector<uint8_t>& _buffer;
+    size_t _offset;
+};
+
+// Writer of the compressed stream in memory
+class MemoryWriter : public Writer
+{
+public:
+    std::vector<uint8_t> buffer;
+
+    size_t Write(const void* data, size_t size) override
+    {
+        buffer.insert(buffer.end(), (const uint8_t*)data, (const uint8_t*)data + size);
+        return size;
+    }
+};
+
+class CompressionFixture : public virtual CppBenchmark::Fixture
+{
+protected:
+    std::string content;
+    std::vector<uint8_t> compressed;
+    ThreadPool pool;
+
+    CompressionFixture()
+    {
+        while (content.size() < size)
+            content += "Record " + std::to_string(content.size() % 7919) + " of the compressed stream\n";
+
+        MemoryWriter output;
+        CompressingWriter writer(output);
+        writer.Write(content.data(), content.size());
+        writer.Finish();
+        compressed = std::move(output.buffer);
+    }
+};
+
+BENCHMARK_FIXTURE(CompressionFixture, "LZ4::Compress()", iterations)
+{
+    std::vector<uint8_t> buffer(LZ4::Bound(CompressingWriter::DEFAULT_BLOCK));
+    size_t total = 0;
+    for (size_t offset = 0; offset < content.size(); offset += CompressingWriter::DEFAULT_BLOCK)
+        total += LZ4::Compress(content.data() + offset, std::min(CompressingWriter::DEFAULT_BLOCK, content.size() - offset), buffer.data(), buffer.size());
+    context.metrics().AddBytes(content.size());
+    context.metrics().SetCustom("Ratio", (double)total / content.size());
+}
+
+BENCHMARK_FIXTURE(CompressionFixture, "CompressingWriter", iterations)
+{
+    NullWriter output;
+    CompressingWriter writer(output);
+    writer.Write(content.data(), content.size());
+    writer.Finish();
+    context.metrics().AddBytes(content.size());
+}
+
+BENCHMARK_FIXTURE(CompressionFixture, "CompressingWriter with the thread pool", iterations)
+{
+    NullWriter output;
+    CompressingWriter writer(output, CompressingWriter::DEFAULT_BLOCK, &pool);
+    writer.Write(content.data(), content.size());
+    writer.Finish();
+    context.metrics().AddBytes(content.size());
+}
+
+BENCHMARK_FIXTURE(CompressionFixture, "DecompressingReader", iterations)
+{
+    MemoryReader input(compressed);
+    DecompressingReader reader(input);
+    std::vector<uint8_t> buffer(65536);
+    size_t total = 0;
+    size_t read;
+    while ((read = reader.Read(buffer.data(), buffer.size())) > 0)
+        total += read;
+    context.metrics().AddBytes(total);
+}
+
+BENCHMARK_REPORT_MAIN()
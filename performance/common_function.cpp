@@ -2,9 +2,12 @@
 // Created by Ivan Shynkarenka on 18.08.2017
 //
 
-#include "benchmark/cppbenchmark.h"
+#include "benchmark_report.h"
 
 #include "common/function.h"
+#include "memory/allocator.h"
+
+#include <array>
 
 using namespace CppCommon;
 
@@ -57,4 +60,71 @@ BENCHMARK("CppCommon::Function: invoke")
     function(context.metrics().total_operations());
 }
 
-BENCHMARK_MAIN()
+BENCHMARK("CppCommon::UniqueFunction: create & invoke")
+{
+    static Class instance;
+
+    // Create the function
+    CppCommon::UniqueFunction<void (int64_t)> function = std::bind(&Class::test, &instance, std::placeholders::_1);
+
+    // Call the function
+    function(context.metrics().total_operations());
+}
+
+BENCHMARK("CppCommon::UniqueFunction: invoke")
+{
+    static Class instance;
+    static CppCommon::UniqueFunction<void (int64_t)> function = std::bind(&Class::test, &instance, std::placeholders::_1);
+
+    // Call the function
+    function(context.metrics().total_operations());
+}
+
+BENCHMARK("CppCommon::UniqueFunction: create & invoke (spilled)")
+{
+    static Class instance;
+    static CppCommon::DefaultMemoryManager manager;
+    std::array<int64_t, 16> padding = {};
+
+    // Create the oversized function spilled into the memory manager
+    CppCommon::UniqueFunction<void (int64_t), 64> function([padding](int64_t data) { instance.test(data + padding[0]); }, manager);
+
+    // Call the function
+    function(context.metrics().total_operations());
+}
+
+BENCHMARK("std::function: create & invoke (large)")
+{
+    static Class instance;
+    std::array<int64_t, 16> padding = {};
+
+    // Create the large function
+    std::function<void (int64_t)> function = [padding](int64_t data) { instance.test(data + padding[0]); };
+
+    // Call the function
+    function(context.metrics().total_operations());
+}
+
+BENCHMARK("CppCommon::FunctionRef: create & invoke")
+{
+    static Class instance;
+
+    // Create the function reference
+    auto callable = std::bind(&Class::test, &instance, std::placeholders::_1);
+    CppCommon::FunctionRef<void (int64_t)> function = callable;
+
+    // Call the function
+    function(context.metrics().total_operations());
+}
+
+BENCHMARK("CppCommon::FunctionRef: invoke")
+{
+    static Class instance;
+    static auto callable = std::bind(&Class::test, &instance, std::placeholders::_1);
+    static CppCommon::FunctionRef<void (int64_t)> function = callable;
+
+    // Call the function
+    function(context.metrics().total_operations());
+}
+
+BENCHMARK_REPORT_MAIN()
@@ -0,0 +1,85 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "benchmark_report.h"
+
+#include "common/line_reader.h"
+#include "filesystem/file.h"
+#include "filesystem/mapped_file.h"
+
+#include <string>
+#include <vector>
+
+using namespace CppCommon;
+
+const uint64_t iterations = 10;
+const size_t lines = 1000000;
+
+class LinesFixture : public virtual CppBenchmark::Fixture
+{
+protected:
+    File file;
+    size_t bytes;
+
+    LinesFixture() : file("test.tmp"), bytes(0) {}
+
+    void Initialize(CppBenchmark::Context& context) override
+    {
+        // Create CSV file with lines of different length
+        std::string content;
+        for (size_t i = 0; i < lines; ++i)
+            content += std::to_string(i) + ",name" + std::to_string(i % 97) + "," + std::string(i % 64, 'x') + "\n";
+        File::WriteAllText(file, content);
+        bytes = content.size();
+    }
+
+    void Cleanup(CppBenchmark::Context& context) override
+    {
+        File::Remove(file);
+    }
+};
+
+BENCHMARK_FIXTURE(LinesFixture, "File::ReadAllLines()", iterations)
+{
+    auto result = File::ReadAllLines(file);
+    context.metrics().AddItems(result.size());
+    context.metrics().AddBytes(bytes);
+}
+
+BENCHMARK_FIXTURE(LinesFixture, "LineReader-File", iterations)
+{
+    file.Open(true, false, false, File::DEFAULT_ATTRIBUTES, File::DEFAULT_PERMISSIONS, 0);
+    LineReader reader(file);
+    size_t count = 0;
+    for (auto line : reader)
+        count += !line.empty();
+    file.Close();
+    context.metrics().AddItems(count);
+    context.metrics().AddBytes(bytes);
+}
+
+BENCHMARK_FIXTURE(LinesFixture, "LineReader-MappedFile", iterations)
+{
+    MappedFile mapped(file);
+    LineReader reader(mapped.view());
+    size_t count = 0;
+    for (auto line : reader)
+        count += !line.empty();
+    context.metrics().AddItems(count);
+    context.metrics().AddBytes(bytes);
+}
+
+BENCHMARK_FIXTURE(LinesFixture, "LineReader::ReadRecord()", iterations)
+{
+    MappedFile mapped(file);
+    LineReader reader(mapped.view());
+    std::vector<std::string_view> fields;
+    size_t count = 0;
+    while (reader.ReadRecord(fields, ','))
+        count += fields.size();
+    context.metrics().AddItems(count);
+    context.metrics().AddBytes(bytes);
+}
+
+BENCHMARK_REPORT_MAIN()
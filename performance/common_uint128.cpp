@@ -0,0 +1,54 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "benchmark_report.h"
+
+#include "common/uint128.h"
+
+using namespace CppCommon;
+
+const uint64_t operations = 10000000;
+
+// Fixed-point price and quantity with 8 decimal places
+const uint64_t scale = 100000000;
+
+static volatile uint64_t sink;
+
+BENCHMARK("uint128_t: price * quantity", operations)
+{
+    uint128_t price(108250000ull + (context.metrics().total_operations() & 0xFF));
+    uint128_t quantity(100000000000ull);
+    uint128_t notional = price * quantity;
+    sink = notional.lower();
+}
+
+BENCHMARK("uint128_t: price * quantity / scale", operations)
+{
+    uint128_t price(108250000ull + (context.metrics().total_operations() & 0xFF));
+    uint128_t quantity(100000000000ull);
+    uint128_t notional = price * quantity / scale;
+    sink = notional.lower();
+}
+
+BENCHMARK("uint128_t: 128-bit divide", operations)
+{
+    uint128_t dividend(0xFEDCBA9876543210ull, 0x0123456789ABCDEFull + context.metrics().total_operations());
+    uint128_t divisor(0x12345ull, 0xFEDCBA9876543210ull);
+    sink = (dividend / divisor).lower();
+}
+
+BENCHMARK("uint128_t: shifts", operations)
+{
+    uint128_t value(0xFEDCBA9876543210ull, 0x0123456789ABCDEFull);
+    size_t shift = context.metrics().total_operations() & 0x7F;
+    sink = ((value << shift) ^ (value >> shift)).lower();
+}
+
+BENCHMARK("uint128_t: string", operations / 100)
+{
+    uint128_t value(0xFEDCBA9876543210ull, 0x0123456789ABCDEFull + context.metrics().total_operations());
+    sink = value.string().size();
+}
+
+BENCHMARK_REPORT_MAIN()
@@ -0,0 +1,42 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "benchmark_report.h"
+
+#include "common/uint256.h"
+
+using namespace CppCommon;
+
+const uint64_t operations = 1000000;
+
+static volatile uint64_t sink;
+
+BENCHMARK("uint256_t: multiply", operations)
+{
+    uint256_t x(0x0123456789ABCDEFull, 0xFEDCBA9876543210ull, 0x0123456789ABCDEFull, context.metrics().total_operations());
+    uint256_t y(0, 0xFEDCBA9876543210ull, 0x0123456789ABCDEFull, 0xFEDCBA9876543210ull);
+    sink = (x * y).lower().lower();
+}
+
+BENCHMARK("uint256_t: divide by 64-bit", operations)
+{
+    uint256_t x(0x0123456789ABCDEFull, 0xFEDCBA9876543210ull, 0x0123456789ABCDEFull, context.metrics().total_operations());
+    sink = (x / 1000000007ull).lower().lower();
+}
+
+BENCHMARK("uint256_t: divide by 192-bit", operations)
+{
+    uint256_t x(0x0123456789ABCDEFull, 0xFEDCBA9876543210ull, 0x0123456789ABCDEFull, context.metrics().total_operations());
+    uint256_t y(0, 0x12345ull, 0x0123456789ABCDEFull, 0xFEDCBA9876543210ull);
+    auto qr = uint256_t::divmod(x, y);
+    sink = qr.first.lower().lower() ^ qr.second.lower().lower();
+}
+
+BENCHMARK("uint256_t: string", operations / 10)
+{
+    uint256_t x(0x0123456789ABCDEFull, 0xFEDCBA9876543210ull, 0x0123456789ABCDEFull, context.metrics().total_operations());
+    sink = x.string().size();
+}
+
+BENCHMARK_REPORT_MAIN()
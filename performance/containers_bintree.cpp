@@ -2,25 +2,36 @@
 // Created by Ivan Shynkarenka on 27.06.2017
 //
 
-#include "benchmark/cppbenchmark.h"
+#include "benchmark_report.h"
 
 #include "containers/bintree.h"
 #include "containers/bintree_aa.h"
 #include "containers/bintree_avl.h"
 #include "containers/bintree_rb.h"
 #include "containers/bintree_splay.h"
+#include "containers/btree.h"
+#include "containers/concurrent_skiplist.h"
 #include "memory/allocator.h"
 #include "memory/allocator_pool.h"
+#include "threads/locker.h"
+#include "threads/rw_lock.h"
 
 #include <algorithm>
+#include <atomic>
 #include <random>
 #include <set>
+#include <thread>
 #include <unordered_set>
 #include <vector>
 
 using namespace CppCommon;
 
 const int items = 1000000;
+const int operations = 1000000;
+const int range = 16;
+const int threads_from = 1;
+const int threads_to = 16;
+const auto threads_settings = CppBenchmark::Settings().ParamRange(threads_from, threads_to, [](int from, int to, int& result) { int r = result; result *= 2; return r; });
 
 struct MyBinTreeNode
 {
@@ -91,6 +102,84 @@ protected:
     }
 };
 
+template <class T>
+class FindBatchFixture : public FindFixture<T>
+{
+protected:
+    std::vector<MyBinTreeNode> keys;
+    std::vector<const MyBinTreeNode*> found;
+
+    void Initialize(CppBenchmark::Context& context) override
+    {
+        FindFixture<T>::Initialize(context);
+        keys.clear();
+        for (const auto& value : this->values)
+            keys.emplace_back(value);
+        found.resize(keys.size());
+    }
+};
+
+template <class T>
+class BuildFixture : public virtual CppBenchmark::Fixture
+{
+protected:
+    T tree;
+    std::vector<MyBinTreeNode> nodes;
+
+    BuildFixture()
+    {
+        for (int i = 0; i < items; ++i)
+            nodes.emplace_back(i);
+    }
+
+    void Cleanup(CppBenchmark::Context& context) override
+    {
+        tree.clear();
+    }
+};
+
+typedef BTree<int, std::less<int>, PoolAllocator<int>> MyBTree;
+
+class BTreeInsertFixture : public virtual CppBenchmark::Fixture
+{
+protected:
+    DefaultMemoryManager auxiliary;
+    PoolMemoryManager<DefaultMemoryManager> pool;
+    MyBTree tree;
+    std::vector<int> values;
+
+    BTreeInsertFixture() : pool(auxiliary), tree(std::less<int>(), PoolAllocator<int>(pool))
+    {
+        for (int i = 0; i < items; ++i)
+            values.push_back(i);
+    }
+
+    void Initialize(CppBenchmark::Context& context) override
+    {
+        std::default_random_engine random;
+        std::shuffle(values.begin(), values.end(), random);
+    }
+
+    void Cleanup(CppBenchmark::Context& context) override
+    {
+        tree.clear();
+        pool.reset();
+    }
+};
+
+class BTreeFindFixture : public BTreeInsertFixture
+{
+protected:
+    void Initialize(CppBenchmark::Context& context) override
+    {
+        std::default_random_engine random;
+        std::shuffle(this->values.begin(), this->values.end(),  random);
+        for (const auto& value : this->values)
+            this->tree.insert(value);
+        std::shuffle(this->values.begin(), this->values.end(), random);
+    }
+};
+
 BENCHMARK_FIXTURE(InsertFixture<BinTree<MyBinTreeNode>>, "Insert: std::set")
 {
     for (const auto& value : this->values)
@@ -145,6 +234,15 @@ BENCHMARK_FIXTURE(InsertFixture<BinTreeRB<MyBinTreeNode>>, "Insert: BinTreeRB")
     context.metrics().AddOperations(items - 1);
 }
 
+BENCHMARK_FIXTURE(BTreeInsertFixture, "Insert: BTree")
+{
+    for (const auto& value : this->values)
+        this->tree.insert(value);
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(items - 1);
+}
+
 BENCHMARK_FIXTURE(FindFixture<BinTree<MyBinTreeNode>>, "Find: std::set")
 {
     uint64_t crc = 0;
@@ -229,6 +327,34 @@ BENCHMARK_FIXTURE(FindFixture<BinTreeRB<MyBinTreeNode>>, "Find: BinTreeRB")
     context.metrics().SetCustom("CRC", crc);
 }
 
+BENCHMARK_FIXTURE(FindBatchFixture<BinTreeAVL<MyBinTreeNode>>, "Find: BinTreeAVL (find batch)")
+{
+    uint64_t crc = 0;
+
+    const auto& bintree = this->tree;
+    bintree.find_batch(this->keys.begin(), this->keys.end(), this->found.begin());
+    for (const auto& item : this->found)
+        crc += item->value;
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(items - 1);
+    context.metrics().SetCustom("CRC", crc);
+}
+
+BENCHMARK_FIXTURE(FindBatchFixture<BinTreeRB<MyBinTreeNode>>, "Find: BinTreeRB (find batch)")
+{
+    uint64_t crc = 0;
+
+    const auto& bintree = this->tree;
+    bintree.find_batch(this->keys.begin(), this->keys.end(), this->found.begin());
+    for (const auto& item : this->found)
+        crc += item->value;
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(items - 1);
+    context.metrics().SetCustom("CRC", crc);
+}
+
 BENCHMARK_FIXTURE(FindFixture<BinTreeSplay<MyBinTreeNode>>, "Find: BinTreeSplay")
 {
     uint64_t crc = 0;
@@ -244,6 +370,41 @@ BENCHMARK_FIXTURE(FindFixture<BinTreeSplay<MyBinTreeNode>>, "Find: BinTreeSplay"
     context.metrics().SetCustom("CRC", crc);
 }
 
+BENCHMARK_FIXTURE(BTreeFindFixture, "Find: BTree")
+{
+    uint64_t crc = 0;
+
+    for (const auto& value : this->values)
+        crc += *this->tree.find(value);
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(items - 1);
+    context.metrics().SetCustom("CRC", crc);
+}
+
+BENCHMARK_FIXTURE(FindFixture<BinTreeRB<MyBinTreeNode>>, "Iterate: BinTreeRB")
+{
+    uint64_t crc = 0;
+
+    for (const auto& item : this->tree)
+        crc += item.value;
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(items - 1);
+    context.metrics().SetCustom("CRC", crc);
+}
+
+BENCHMARK_FIXTURE(FindFixture<BinTreeRB<MyBinTreeNode>>, "Iterate: BinTreeRB (for each prefetch)")
+{
+    uint64_t crc = 0;
+
+    this->tree.for_each_prefetch([&crc](const MyBinTreeNode& item) { crc += item.value; });
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(items - 1);
+    context.metrics().SetCustom("CRC", crc);
+}
+
 BENCHMARK_FIXTURE(FindFixture<BinTree<MyBinTreeNode>>, "Remove: std::set")
 {
     uint64_t crc = 0;
@@ -321,4 +482,164 @@ BENCHMARK_FIXTURE(FindFixture<BinTreeRB<MyBinTreeNode>>, "Remove: BinTreeRB")
     context.metrics().SetCustom("CRC", crc);
 }
 
-BENCHMARK_MAIN()
+BENCHMARK_FIXTURE(BTreeFindFixture, "Remove: BTree")
+{
+    uint64_t crc = 0;
+
+    for (const auto& value : this->values)
+    {
+        crc += value;
+        this->tree.erase(value);
+    }
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(items - 1);
+    context.metrics().SetCustom("CRC", crc);
+}
+
+BENCHMARK_FIXTURE(BuildFixture<BinTreeAVL<MyBinTreeNode>>, "Build: BinTreeAVL (insert)")
+{
+    for (auto& node : this->nodes)
+        this->tree.insert(node);
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(items - 1);
+}
+
+BENCHMARK_FIXTURE(BuildFixture<BinTreeAVL<MyBinTreeNode>>, "Build: BinTreeAVL (build sorted)")
+{
+    this->tree.build_sorted(this->nodes.begin(), this->nodes.end());
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(items - 1);
+}
+
+BENCHMARK_FIXTURE(BuildFixture<BinTreeRB<MyBinTreeNode>>, "Build: BinTreeRB (insert)")
+{
+    for (auto& node : this->nodes)
+        this->tree.insert(node);
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(items - 1);
+}
+
+BENCHMARK_FIXTURE(BuildFixture<BinTreeRB<MyBinTreeNode>>, "Build: BinTreeRB (build sorted)")
+{
+    this->tree.build_sorted(this->nodes.begin(), this->nodes.end());
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(items - 1);
+}
+
+// Run the mixed workload of finds, inserts, erases and range scans in the given count of threads
+template <class TInsert, class TErase, class TFind, class TScan>
+uint64_t concurrent_workload(int threads_count, TInsert&& insert, TErase&& erase, TFind&& find, TScan&& scan)
+{
+    std::atomic<uint64_t> crc(0);
+
+    std::vector<std::thread> threads;
+    for (int thread = 0; thread < threads_count; ++thread)
+    {
+        threads.emplace_back([&, thread]()
+        {
+            std::default_random_engine random(thread);
+            std::uniform_int_distribution<int> keys(0, items - 1);
+
+            uint64_t result = 0;
+            for (int i = 0; i < (operations / threads_count); ++i)
+            {
+                int key = keys(random);
+                switch (i % 4)
+                {
+                    case 0: result += insert(key) ? 1 : 0; break;
+                    case 1: result += erase(key) ? 1 : 0; break;
+                    case 2: result += scan(key); break;
+                    default: result += find(key) ? 1 : 0; break;
+                }
+            }
+            crc += result;
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+
+    return crc;
+}
+
+BENCHMARK("Concurrent: BinTreeRB + RWLock", threads_settings)
+{
+    RWLock lock;
+    BinTreeRB<MyBinTreeNode> tree;
+    DefaultMemoryManager auxiliary;
+    PoolMemoryManager<DefaultMemoryManager> pool(auxiliary);
+    PoolAllocator<MyBinTreeNode> allocator(pool);
+
+    for (int i = 0; i < items; i += 2)
+        tree.insert(*allocator.Create(i));
+
+    uint64_t crc = concurrent_workload(context.x(),
+        [&](int key)
+        {
+            WriteLocker<RWLock> locker(lock);
+            MyBinTreeNode node(key);
+            if (tree.find(node) != tree.end())
+                return false;
+            tree.insert(*allocator.Create(key));
+            return true;
+        },
+        [&](int key)
+        {
+            WriteLocker<RWLock> locker(lock);
+            MyBinTreeNode* node = tree.erase(MyBinTreeNode(key));
+            if (node == nullptr)
+                return false;
+            allocator.Release(node);
+            return true;
+        },
+        [&](int key)
+        {
+            ReadLocker<RWLock> locker(lock);
+            return tree.find(MyBinTreeNode(key)) != tree.end();
+        },
+        [&](int key)
+        {
+            ReadLocker<RWLock> locker(lock);
+            uint64_t sum = 0;
+            auto it = tree.lower_bound(MyBinTreeNode(key));
+            for (int i = 0; (i < range) && (it != tree.end()); ++i, ++it)
+                sum += it->value;
+            return sum;
+        });
+
+    while (tree)
+        allocator.Release(tree.erase(*tree.root()));
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(operations - 1);
+    context.metrics().SetCustom("CRC", crc);
+}
+
+BENCHMARK("Concurrent: ConcurrentSkipList", threads_settings)
+{
+    ConcurrentSkipList<int, int> skiplist;
+
+    for (int i = 0; i < items; i += 2)
+        skiplist.insert(i, i);
+
+    uint64_t crc = concurrent_workload(context.x(),
+        [&](int key) { return skiplist.insert(key, key); },
+        [&](int key) { return skiplist.erase(key); },
+        [&](int key) { return skiplist.contains(key); },
+        [&](int key)
+        {
+            uint64_t sum = 0;
+            skiplist.visit_range(key, key + 2 * range, [&sum](int k, int v) { sum += v; });
+            return sum;
+        });
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(operations - 1);
+    context.metrics().SetCustom("CRC", crc);
+}
+
+BENCHMARK_REPORT_MAIN()
@@ -0,0 +1,97 @@
+//
+// Created by Ivan Shynkarenka on 15.10.2026
+//
+
+#include "benchmark_report.h"
+
+#include "containers/circular_buffer.h"
+
+#include <deque>
+#include <numeric>
+
+using namespace CppCommon;
+
+const int items = 10000000;
+const size_t window = 1024;
+
+const auto settings = CppBenchmark::Settings().Attempts(3).Operations(items);
+
+BENCHMARK("std::deque", settings)
+{
+    std::deque<int64_t> deque;
+    int64_t sum = 0;
+    for (int i = 0; i < items; ++i)
+    {
+        deque.push_back(i);
+        sum += i;
+        if (deque.size() > window)
+        {
+            sum -= deque.front();
+            deque.pop_front();
+        }
+    }
+    context.metrics().SetCustom("sum", sum);
+}
+
+BENCHMARK("CircularBuffer", settings)
+{
+    CircularBuffer<int64_t> buffer(window + 1);
+    int64_t sum = 0;
+    for (int i = 0; i < items; ++i)
+    {
+        buffer.push_back(i);
+        sum += i;
+        if (buffer.size() > window)
+        {
+            sum -= buffer.front();
+            buffer.pop_front();
+        }
+    }
+    context.metrics().SetCustom("sum", sum);
+}
+
+BENCHMARK("CircularBuffer (overwrite)", settings)
+{
+    CircularBuffer<int64_t> buffer(window, true);
+    int64_t sum = 0;
+    for (int i = 0; i < items; ++i)
+    {
+        if (buffer.full())
+            sum -= buffer.front();
+        buffer.push_back(i);
+        sum += i;
+    }
+    context.metrics().SetCustom("sum", sum);
+}
+
+BENCHMARK("std::deque (window sum)", CppBenchmark::Settings().Attempts(3).Operations(items / 100))
+{
+    std::deque<int64_t> deque;
+    int64_t sum = 0;
+    for (int i = 0; i < (items / 100); ++i)
+    {
+        deque.push_back(i);
+        if (deque.size() > window)
+            deque.pop_front();
+        sum += std::accumulate(deque.begin(), deque.end(), (int64_t)0);
+    }
+    context.metrics().SetCustom("sum", sum);
+}
+
+BENCHMARK("CircularBuffer (window sum)", CppBenchmark::Settings().Attempts(3).Operations(items / 100))
+{
+    CircularBuffer<int64_t> buffer(window, true);
+    int64_t sum = 0;
+    for (int i = 0; i < (items / 100); ++i)
+    {
+        buffer.push_back(i);
+
+        // Contiguous spans are vectorized by the compiler
+        auto spans = buffer.as_spans();
+        sum += std::accumulate(spans.first.begin(), spans.first.end(), (int64_t)0);
+        sum += std::accumulate(spans.second.begin(), spans.second.end(), (int64_t)0);
+    }
+    context.metrics().SetCustom("sum", sum);
+}
+
+BENCHMARK_REPORT_MAIN()
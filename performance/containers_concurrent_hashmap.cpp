@@ -0,0 +1,98 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "benchmark_report.h"
+
+#include "containers/concurrent_hashmap.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace CppCommon;
+
+const uint64_t items_to_produce = 1000000;
+const uint64_t keys_count = 100000;
+const int readers_from = 1;
+const int readers_to = 32;
+const int writers_from = 1;
+const int writers_to = 32;
+const auto settings = CppBenchmark::Settings().PairRange(readers_from, readers_to, [](int from, int to, int& result) { int r = result; result *= 2; return r; },
+                                                         writers_from, writers_to, [](int from, int to, int& result) { int r = result; result *= 2; return r; });
+
+template <class TLock>
+void produce(CppBenchmark::Context& context)
+{
+    const int readers_count = context.x();
+    const int writers_count = context.y();
+    std::atomic<uint64_t> readers_crc(0);
+    std::atomic<uint64_t> writers_crc(0);
+
+    // Create concurrent hash map
+    ConcurrentHashMap<uint64_t, uint64_t, std::hash<uint64_t>, std::equal_to<uint64_t>, TLock> hashmap(64, 1024, (uint64_t)-1);
+
+    // Start readers threads
+    std::vector<std::thread> readers;
+    for (int reader = 0; reader < readers_count; ++reader)
+    {
+        readers.emplace_back([&hashmap, &readers_crc, reader, readers_count]()
+        {
+            uint64_t crc = 0;
+            uint64_t items = (items_to_produce / readers_count);
+            for (uint64_t i = 0; i < items; ++i)
+            {
+                uint64_t value;
+                if (hashmap.find(((reader * items) + i) % keys_count, value))
+                    crc += value;
+            }
+            readers_crc += crc;
+        });
+    }
+
+    // Start writers threads
+    std::vector<std::thread> writers;
+    for (int writer = 0; writer < writers_count; ++writer)
+    {
+        writers.emplace_back([&hashmap, &writers_crc, writer, writers_count]()
+        {
+            uint64_t crc = 0;
+            uint64_t items = (items_to_produce / writers_count);
+            for (uint64_t i = 0; i < items; ++i)
+            {
+                uint64_t key = ((writer * items) + i) % keys_count;
+                if ((i % 4) == 3)
+                    hashmap.erase(key);
+                else
+                    hashmap.insert_or_assign(key, i);
+                crc += key;
+            }
+            writers_crc += crc;
+        });
+    }
+
+    // Wait for all readers threads
+    for (auto& reader : readers)
+        reader.join();
+
+    // Wait for all writers threads
+    for (auto& writer : writers)
+        writer.join();
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(2 * items_to_produce - 1);
+    context.metrics().SetCustom("CRC-Readers", readers_crc.load());
+    context.metrics().SetCustom("CRC-Writers", writers_crc.load());
+}
+
+BENCHMARK("ConcurrentHashMap<RWLock>", settings)
+{
+    produce<RWLock>(context);
+}
+
+BENCHMARK("ConcurrentHashMap<SpinLock>", settings)
+{
+    produce<SpinLock>(context);
+}
+
+BENCHMARK_REPORT_MAIN()
@@ -0,0 +1,94 @@
+//
+// Created by Ivan Shynkarenka on 15.10.2026
+//
+
+#include "benchmark_report.h"
+
+#include "containers/bloom_filter.h"
+#include "containers/cuckoo_filter.h"
+#include "containers/hashmap.h"
+
+using namespace CppCommon;
+
+const int items = 1000000;
+
+class BloomFilterFixture
+{
+protected:
+    BloomFilter filter;
+
+    BloomFilterFixture() : filter(items, 0.01)
+    {
+        for (int i = 0; i < items; ++i)
+            filter.Add(i);
+    }
+};
+
+class CuckooFilterFixture
+{
+protected:
+    CuckooFilter filter;
+
+    CuckooFilterFixture() : filter(items)
+    {
+        for (int i = 0; i < items; ++i)
+            filter.Add(i);
+    }
+};
+
+class HashMapFixture
+{
+protected:
+    HashMap<int, int> map;
+
+    HashMapFixture() : map(items * 2, -1)
+    {
+        for (int i = 0; i < items; ++i)
+            map.insert(std::make_pair(i, i));
+    }
+};
+
+BENCHMARK("Insert: BloomFilter")
+{
+    BloomFilter filter(items, 0.01);
+    for (int i = 0; i < items; ++i)
+        filter.Add(i);
+    context.metrics().AddOperations(items - 1);
+}
+
+BENCHMARK("Insert: CuckooFilter")
+{
+    CuckooFilter filter(items);
+    for (int i = 0; i < items; ++i)
+        filter.Add(i);
+    context.metrics().AddOperations(items - 1);
+}
+
+BENCHMARK_FIXTURE(BloomFilterFixture, "Negative lookup: BloomFilter")
+{
+    uint64_t crc = 0;
+    for (int i = items; i < 2 * items; ++i)
+        crc += filter.Contains(i) ? 1 : 0;
+    context.metrics().AddOperations(items - 1);
+    context.metrics().SetCustom("CRC", crc);
+}
+
+BENCHMARK_FIXTURE(CuckooFilterFixture, "Negative lookup: CuckooFilter")
+{
+    uint64_t crc = 0;
+    for (int i = items; i < 2 * items; ++i)
+        crc += filter.Contains(i) ? 1 : 0;
+    context.metrics().AddOperations(items - 1);
+    context.metrics().SetCustom("CRC", crc);
+}
+
+BENCHMARK_FIXTURE(HashMapFixture, "Negative lookup: HashMap")
+{
+    uint64_t crc = 0;
+    for (int i = items; i < 2 * items; ++i)
+        crc += (map.find(i) != map.end()) ? 1 : 0;
+    context.metrics().AddOperations(items - 1);
+    context.metrics().SetCustom("CRC", crc);
+}
+
+BENCHMARK_REPORT_MAIN()
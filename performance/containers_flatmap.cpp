@@ -2,13 +2,14 @@
 // Created by Ivan Shynkarenka on 27.07.2017
 //
 
-#include "benchmark/cppbenchmark.h"
+#include "benchmark_report.h"
 
 #include "containers/flatmap.h"
 
 #include <algorithm>
 #include <map>
 #include <random>
+#include <vector>
 
 using namespace CppCommon;
 
@@ -74,6 +75,56 @@ BENCHMARK_FIXTURE(InsertFixture<Flat>, "Insert: FlatMap")
     context.metrics().AddOperations(items - 1);
 }
 
+template <class T>
+class FrozenFindFixture : public FindFixture<T>
+{
+protected:
+    void Initialize(CppBenchmark::Context& context) override
+    {
+        FindFixture<T>::Initialize(context);
+        this->map.freeze();
+    }
+};
+
+BENCHMARK_FIXTURE(InsertFixture<Map>, "Bulk insert: std::map")
+{
+    std::vector<std::pair<int, int>> snapshot;
+    snapshot.reserve(this->values.size());
+    for (const auto& value : this->values)
+        snapshot.emplace_back(value, value);
+
+    this->map.insert(snapshot.begin(), snapshot.end());
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(items - 1);
+}
+
+BENCHMARK_FIXTURE(InsertFixture<Flat>, "Bulk insert: FlatMap")
+{
+    std::vector<std::pair<int, int>> snapshot;
+    snapshot.reserve(this->values.size());
+    for (const auto& value : this->values)
+        snapshot.emplace_back(value, value);
+
+    this->map.insert(snapshot.begin(), snapshot.end());
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(items - 1);
+}
+
+BENCHMARK_FIXTURE(InsertFixture<Flat>, "Bulk insert: FlatMap (sorted unique)")
+{
+    std::vector<std::pair<int, int>> snapshot;
+    snapshot.reserve(this->values.size());
+    for (int i = 0; i < items; ++i)
+        snapshot.emplace_back(i + 1, i + 1);
+
+    this->map.insert(sorted_unique, snapshot.begin(), snapshot.end());
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(items - 1);
+}
+
 BENCHMARK_FIXTURE(FindFixture<Map>, "Find: std::map")
 {
     uint64_t crc = 0;
@@ -98,6 +149,18 @@ BENCHMARK_FIXTURE(FindFixture<Flat>, "Find: FlatMap")
     context.metrics().SetCustom("CRC", crc);
 }
 
+BENCHMARK_FIXTURE(FrozenFindFixture<Flat>, "Find: FlatMap (frozen)")
+{
+    uint64_t crc = 0;
+
+    for (const auto& value : this->values)
+        crc += this->map.find(value)->second;
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(items - 1);
+    context.metrics().SetCustom("CRC", crc);
+}
+
 BENCHMARK_FIXTURE(FindFixture<Map>, "Remove: std::map")
 {
     uint64_t crc = 0;
@@ -122,4 +185,4 @@ BENCHMARK_FIXTURE(FindFixture<Flat>, "Remove: FlatMap")
     context.metrics().SetCustom("CRC", crc);
 }
 
-BENCHMARK_MAIN()
+BENCHMARK_REPORT_MAIN()
@@ -2,13 +2,15 @@
 // Created by Ivan Shynkarenka on 13.07.2017
 //
 
-#include "benchmark/cppbenchmark.h"
+#include "benchmark_report.h"
 
 #include "containers/hashmap.h"
+#include "time/timestamp.h"
 
 #include <algorithm>
 #include <map>
 #include <random>
+#include <span>
 #include <unordered_map>
 
 #if defined(__GNUC__)
@@ -35,10 +37,13 @@
 #endif
 
 const int items = 1000000;
+// Count of items of the hash map much larger than the CPU cache
+const int large_items = 8000000;
 
 typedef std::map<int, int> Map;
 typedef std::unordered_map<int, int> UnorderedMap;
 typedef CppCommon::HashMap<int, int> HashMap;
+typedef CppCommon::HashMap<int, int, std::hash<int>, std::equal_to<int>, std::allocator<std::pair<int, int>>, CppCommon::HashMapGroupProbing> HashMapGroup;
 typedef ska::flat_hash_map<int, int> FlatHash;
 typedef ska::bytell_hash_map<int, int> BytellHash;
 typedef tsl::bhopscotch_map<int, int> BHopscotchHash;
@@ -86,6 +91,85 @@ protected:
     }
 };
 
+template <class T>
+class IncrementalRehashFixture : public InsertFixture<T>
+{
+protected:
+    void Initialize(CppBenchmark::Context& context) override
+    {
+        InsertFixture<T>::Initialize(context);
+        this->map.incremental_rehash(16);
+    }
+};
+
+template <class T>
+class LargeFindFixture : public virtual CppBenchmark::Fixture
+{
+protected:
+    T map;
+    std::vector<int> keys;
+    std::vector<typename T::iterator> results;
+
+    LargeFindFixture() : map(2 * large_items)
+    {
+        for (int i = 0; i < large_items; ++i)
+            keys.push_back(i + 1);
+        for (const auto& key : keys)
+            map.emplace(key, key);
+        results.resize(keys.size());
+    }
+
+    void Initialize(CppBenchmark::Context& context) override
+    {
+        std::default_random_engine random;
+        std::shuffle(keys.begin(), keys.end(), random);
+    }
+};
+
+template <class T>
+uint64_t FindSerial(T& map, const std::vector<int>& keys)
+{
+    uint64_t crc = 0;
+    for (const auto& key : keys)
+        crc += map.find(key)->second;
+    return crc;
+}
+
+template <class T>
+uint64_t FindBatch(T& map, const std::vector<int>& keys, std::vector<typename T::iterator>& results, size_t batch)
+{
+    uint64_t crc = 0;
+    for (size_t offset = 0; offset < keys.size(); offset += batch)
+    {
+        size_t count = std::min(batch, keys.size() - offset);
+        std::span<const int> batch_keys(keys.data() + offset, count);
+        std::span<typename T::iterator> batch_results(results.data() + offset, count);
+        map.find_batch(batch_keys, batch_results);
+        for (auto& it : batch_results)
+            crc += it->second;
+    }
+    return crc;
+}
+
+template <class T>
+void GrowthLatency(CppBenchmark::Context& context, T& map, const std::vector<int>& values)
+{
+    int64_t maxlatency = 0;
+
+    for (const auto& value : values)
+    {
+        int64_t start = CppCommon::Timestamp::nano();
+        map.emplace(value, value);
+        int64_t latency = CppCommon::Timestamp::nano() - start;
+        if (latency > maxlatency)
+            maxlatency = latency;
+    }
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(items - 1);
+    context.metrics().SetCustom("latency-max", maxlatency);
+}
+
 BENCHMARK_FIXTURE(InsertFixture<Map>, "Insert: std::map")
 {
     for (const auto& value : this->values)
@@ -113,6 +197,15 @@ BENCHMARK_FIXTURE(InsertFixture<HashMap>, "Insert: HashMap")
     context.metrics().AddOperations(items - 1);
 }
 
+BENCHMARK_FIXTURE(InsertFixture<HashMapGroup>, "Insert: HashMap (group probing)")
+{
+    for (const auto& value : this->values)
+        this->map.emplace(value, value);
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(items - 1);
+}
+
 BENCHMARK_FIXTURE(InsertFixture<FlatHash>, "Insert: FlatHash")
 {
     for (const auto& value : this->values)
@@ -176,6 +269,21 @@ BENCHMARK_FIXTURE(InsertFixture<SparseHash>, "Insert: SparseHash")
     context.metrics().AddOperations(items - 1);
 }
 
+BENCHMARK_FIXTURE(InsertFixture<UnorderedMap>, "Growth latency: std::unordered_map")
+{
+    GrowthLatency(context, this->map, this->values);
+}
+
+BENCHMARK_FIXTURE(InsertFixture<HashMap>, "Growth latency: HashMap")
+{
+    GrowthLatency(context, this->map, this->values);
+}
+
+BENCHMARK_FIXTURE(IncrementalRehashFixture<HashMap>, "Growth latency: HashMap (incremental rehash)")
+{
+    GrowthLatency(context, this->map, this->values);
+}
+
 BENCHMARK_FIXTURE(FindFixture<Map>, "Find: std::map")
 {
     uint64_t crc = 0;
@@ -212,6 +320,63 @@ BENCHMARK_FIXTURE(FindFixture<HashMap>, "Find: HashMap")
     context.metrics().SetCustom("CRC", crc);
 }
 
+BENCHMARK_FIXTURE(FindFixture<HashMapGroup>, "Find: HashMap (group probing)")
+{
+    uint64_t crc = 0;
+
+    for (const auto& value : this->values)
+        crc += this->map.find(value)->second;
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(items - 1);
+    context.metrics().SetCustom("CRC", crc);
+}
+
+BENCHMARK_FIXTURE(LargeFindFixture<HashMap>, "Find large: HashMap (serial)")
+{
+    uint64_t crc = FindSerial(this->map, this->keys);
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(large_items - 1);
+    context.metrics().SetCustom("CRC", crc);
+}
+
+BENCHMARK_FIXTURE(LargeFindFixture<HashMap>, "Find large: HashMap (batch 32)")
+{
+    uint64_t crc = FindBatch(this->map, this->keys, this->results, 32);
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(large_items - 1);
+    context.metrics().SetCustom("CRC", crc);
+}
+
+BENCHMARK_FIXTURE(LargeFindFixture<HashMap>, "Find large: HashMap (batch 256)")
+{
+    uint64_t crc = FindBatch(this->map, this->keys, this->results, 256);
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(large_items - 1);
+    context.metrics().SetCustom("CRC", crc);
+}
+
+BENCHMARK_FIXTURE(LargeFindFixture<HashMapGroup>, "Find large: HashMap (group probing, serial)")
+{
+    uint64_t crc = FindSerial(this->map, this->keys);
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(large_items - 1);
+    context.metrics().SetCustom("CRC", crc);
+}
+
+BENCHMARK_FIXTURE(LargeFindFixture<HashMapGroup>, "Find large: HashMap (group probing, batch 256)")
+{
+    uint64_t crc = FindBatch(this->map, this->keys, this->results, 256);
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(large_items - 1);
+    context.metrics().SetCustom("CRC", crc);
+}
+
 BENCHMARK_FIXTURE(FindFixture<FlatHash>, "Find: FlatHash")
 {
     uint64_t crc = 0;
@@ -332,6 +497,18 @@ BENCHMARK_FIXTURE(FindFixture<HashMap>, "Remove: HashMap")
     context.metrics().SetCustom("CRC", crc);
 }
 
+BENCHMARK_FIXTURE(FindFixture<HashMapGroup>, "Remove: HashMap (group probing)")
+{
+    uint64_t crc = 0;
+
+    for (const auto& value : this->values)
+        crc += this->map.erase(value);
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(items - 1);
+    context.metrics().SetCustom("CRC", crc);
+}
+
 BENCHMARK_FIXTURE(FindFixture<FlatHash>, "Remove: FlatHash")
 {
     uint64_t crc = 0;
@@ -416,4 +593,4 @@ BENCHMARK_FIXTURE(FindFixture<SparseHash>, "Remove: SparseHash")
     context.metrics().SetCustom("CRC", crc);
 }
 
-BENCHMARK_MAIN()
+BENCHMARK_REPORT_MAIN()
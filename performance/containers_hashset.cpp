@@ -0,0 +1,112 @@
+//
+// Created by Ivan Shynkarenka on 15.10.2026
+//
+
+#include "benchmark_report.h"
+
+#include "containers/hashset.h"
+
+#include <algorithm>
+#include <random>
+#include <unordered_set>
+#include <vector>
+
+using namespace CppCommon;
+
+const int items = 1000000;
+
+struct MyHashSetNode : public HashSetNode<MyHashSetNode>
+{
+    int key;
+
+    explicit MyHashSetNode(int k) : key(k) {}
+};
+
+struct MyHashSetHash
+{
+    size_t operator()(int key) const noexcept { return (size_t)key * 0x9E3779B97F4A7C15ull >> 16; }
+    size_t operator()(const MyHashSetNode& node) const noexcept { return operator()(node.key); }
+    size_t operator()(const MyHashSetNode* node) const noexcept { return operator()(node->key); }
+};
+
+struct MyHashSetEqual
+{
+    bool operator()(const MyHashSetNode& node, int key) const noexcept { return node.key == key; }
+    bool operator()(const MyHashSetNode& node1, const MyHashSetNode& node2) const noexcept { return node1.key == node2.key; }
+    bool operator()(const MyHashSetNode* node1, const MyHashSetNode* node2) const noexcept { return node1->key == node2->key; }
+};
+
+class HashSetFixture
+{
+protected:
+    std::vector<MyHashSetNode> nodes;
+    std::vector<int> keys;
+
+    HashSetFixture()
+    {
+        for (int i = 0; i < items; ++i)
+        {
+            nodes.emplace_back(i);
+            keys.push_back(i);
+        }
+
+        std::default_random_engine random;
+        std::shuffle(keys.begin(), keys.end(), random);
+    }
+};
+
+BENCHMARK_FIXTURE(HashSetFixture, "HashSet-insert-find-erase")
+{
+    // Grow the bucket array twice at the load factor 1, keep the old one alive while migrating
+    std::vector<MyHashSetNode*> buckets(1024);
+    HashSet<MyHashSetNode, MyHashSetHash, MyHashSetEqual> hashset(buckets.data(), buckets.size());
+
+    std::vector<MyHashSetNode*> old;
+    for (auto& node : nodes)
+    {
+        if ((hashset.size() >= hashset.bucket_count()) && !hashset.resizing())
+        {
+            std::vector<MyHashSetNode*> temp(hashset.bucket_count() * 2);
+            hashset.rehash(temp.data(), temp.size());
+            old.swap(buckets);
+            buckets.swap(temp);
+        }
+        hashset.insert(node);
+    }
+
+    int found = 0;
+    for (int key : keys)
+        found += hashset.contains(key) ? 1 : 0;
+
+    for (int key : keys)
+        hashset.erase(key);
+
+    context.metrics().AddOperations(3 * items - 1);
+    context.metrics().SetCustom("found", found);
+}
+
+BENCHMARK_FIXTURE(HashSetFixture, "std::unordered_set<T*>-insert-find-erase")
+{
+    std::unordered_set<MyHashSetNode*, MyHashSetHash, MyHashSetEqual> hashset;
+
+    for (auto& node : nodes)
+        hashset.insert(&node);
+
+    int found = 0;
+    for (int key : keys)
+    {
+        MyHashSetNode node(key);
+        found += (hashset.find(&node) != hashset.end()) ? 1 : 0;
+    }
+
+    for (int key : keys)
+    {
+        MyHashSetNode node(key);
+        hashset.erase(&node);
+    }
+
+    context.metrics().AddOperations(3 * items - 1);
+    context.metrics().SetCustom("found", found);
+}
+
+BENCHMARK_REPORT_MAIN()
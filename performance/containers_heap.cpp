@@ -0,0 +1,172 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "benchmark_report.h"
+
+#include "containers/heap.h"
+
+#include <algorithm>
+#include <queue>
+#include <random>
+#include <set>
+#include <vector>
+
+using namespace CppCommon;
+
+const int items = 1000000;
+
+struct MyHeapNode
+{
+    size_t index;
+    int value;
+
+    explicit MyHeapNode(int v) : index((size_t)-1), value(v) {}
+    friend bool operator<(const MyHeapNode& node1, const MyHeapNode& node2)
+    { return node1.value < node2.value; }
+};
+
+struct MyHeapNodeGreater
+{
+    bool operator()(const MyHeapNode* node1, const MyHeapNode* node2) const noexcept
+    { return node2->value < node1->value; }
+};
+
+class HeapFixture : public virtual CppBenchmark::Fixture
+{
+protected:
+    std::vector<MyHeapNode> nodes;
+
+    HeapFixture()
+    {
+        nodes.reserve(items);
+        for (int i = 0; i < items; ++i)
+            nodes.emplace_back(i);
+    }
+
+    void Initialize(CppBenchmark::Context& context) override
+    {
+        std::default_random_engine random;
+        for (auto& node : nodes)
+            node.value = (int)(random() % items);
+    }
+};
+
+template <size_t D>
+uint64_t HeapPushPop(std::vector<MyHeapNode>& nodes)
+{
+    uint64_t crc = 0;
+
+    Heap<MyHeapNode, std::less<MyHeapNode>, D> heap(nodes.size());
+    for (auto& node : nodes)
+        heap.push(node);
+    while (heap)
+        crc += heap.pop()->value;
+
+    return crc;
+}
+
+template <size_t D>
+uint64_t HeapUpdate(std::vector<MyHeapNode>& nodes)
+{
+    uint64_t crc = 0;
+
+    Heap<MyHeapNode, std::less<MyHeapNode>, D> heap(nodes.size());
+    for (auto& node : nodes)
+        heap.push(node);
+
+    // Decrease and increase keys of random items
+    std::default_random_engine random;
+    for (int i = 0; i < items; ++i)
+    {
+        auto& node = nodes[random() % nodes.size()];
+        node.value = (int)(random() % items);
+        heap.update(node);
+        crc += heap.top()->value;
+    }
+
+    heap.clear();
+    return crc;
+}
+
+BENCHMARK_FIXTURE(HeapFixture, "Push/pop: std::priority_queue")
+{
+    uint64_t crc = 0;
+
+    std::priority_queue<MyHeapNode*, std::vector<MyHeapNode*>, MyHeapNodeGreater> queue;
+    for (auto& node : nodes)
+        queue.push(&node);
+    while (!queue.empty())
+    {
+        crc += queue.top()->value;
+        queue.pop();
+    }
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(items - 1);
+    context.metrics().SetCustom("CRC", crc);
+}
+
+BENCHMARK_FIXTURE(HeapFixture, "Push/pop: Heap<2>")
+{
+    uint64_t crc = HeapPushPop<2>(nodes);
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(items - 1);
+    context.metrics().SetCustom("CRC", crc);
+}
+
+BENCHMARK_FIXTURE(HeapFixture, "Push/pop: Heap<4>")
+{
+    uint64_t crc = HeapPushPop<4>(nodes);
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(items - 1);
+    context.metrics().SetCustom("CRC", crc);
+}
+
+BENCHMARK_FIXTURE(HeapFixture, "Push/pop: Heap<8>")
+{
+    uint64_t crc = HeapPushPop<8>(nodes);
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(items - 1);
+    context.metrics().SetCustom("CRC", crc);
+}
+
+BENCHMARK_FIXTURE(HeapFixture, "Update: std::multiset")
+{
+    uint64_t crc = 0;
+
+    std::multiset<MyHeapNode*, MyHeapNodeGreater> set;
+    std::vector<std::multiset<MyHeapNode*, MyHeapNodeGreater>::iterator> positions;
+    positions.reserve(nodes.size());
+    for (auto& node : nodes)
+        positions.push_back(set.insert(&node));
+
+    // Decrease and increase keys of random items
+    std::default_random_engine random;
+    for (int i = 0; i < items; ++i)
+    {
+        size_t index = random() % nodes.size();
+        set.erase(positions[index]);
+        nodes[index].value = (int)(random() % items);
+        positions[index] = set.insert(&nodes[index]);
+        crc += (*set.rbegin())->value;
+    }
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(items - 1);
+    context.metrics().SetCustom("CRC", crc);
+}
+
+BENCHMARK_FIXTURE(HeapFixture, "Update: Heap<4>")
+{
+    uint64_t crc = HeapUpdate<4>(nodes);
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(items - 1);
+    context.metrics().SetCustom("CRC", crc);
+}
+
+BENCHMARK_REPORT_MAIN()
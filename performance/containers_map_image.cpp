@@ -0,0 +1,101 @@
+//
+// Created by Ivan Shynkarenka on 15.10.2026
+//
+
+#include "benchmark_report.h"
+
+#include "containers/flatmap.h"
+#include "containers/hashmap.h"
+#include "containers/map_image.h"
+
+#include <vector>
+
+using namespace CppCommon;
+
+const uint64_t items = 1000000;
+const auto settings = CppBenchmark::Settings().Attempts(3).Operations(1);
+
+class ImageFixture
+{
+protected:
+    std::vector<std::pair<uint64_t, uint64_t>> source;
+
+    ImageFixture()
+    {
+        // Source items are sorted by the key, as they come from the database index
+        for (uint64_t i = 0; i < items; ++i)
+            source.emplace_back(i * 3, i);
+
+        HashMap<uint64_t, uint64_t> hashmap(items * 2, (uint64_t)-1);
+        for (const auto& item : source)
+            hashmap.insert(item);
+        HashMapImage<uint64_t, uint64_t>::Save("hashmap.image", hashmap);
+
+        FlatMap<uint64_t, uint64_t> flatmap(sorted_unique, source.begin(), source.end(), items);
+        FlatMapImage<uint64_t, uint64_t>::Save("flatmap.image", flatmap);
+    }
+
+    ~ImageFixture()
+    {
+        File::Remove("hashmap.image");
+        File::Remove("flatmap.image");
+    }
+
+    // Warm up the map by looking up all items
+    template <class TMap>
+    static uint64_t lookup(const TMap& map)
+    {
+        uint64_t crc = 0;
+        for (uint64_t i = 0; i < items; ++i)
+        {
+            auto it = map.find(i * 3);
+            if (it != map.end())
+                crc += it->second;
+        }
+        return crc;
+    }
+};
+
+BENCHMARK_FIXTURE(ImageFixture, "HashMap rebuild", settings)
+{
+    HashMap<uint64_t, uint64_t> hashmap(128, (uint64_t)-1);
+    for (const auto& item : source)
+        hashmap.emplace(item.first, item.second);
+    context.metrics().SetCustom("CRC", lookup(hashmap));
+}
+
+BENCHMARK_FIXTURE(ImageFixture, "HashMapImage::Load()", settings)
+{
+    auto image = HashMapImage<uint64_t, uint64_t>::Load("hashmap.image");
+    context.metrics().SetCustom("CRC", lookup(image));
+}
+
+BENCHMARK_FIXTURE(ImageFixture, "HashMapImage mapped", settings)
+{
+    MappedFile file("hashmap.image");
+    HashMapImage<uint64_t, uint64_t> image(file.data(), file.size());
+    context.metrics().SetCustom("CRC", lookup(image));
+}
+
+BENCHMARK_FIXTURE(ImageFixture, "FlatMap rebuild", settings)
+{
+    FlatMap<uint64_t, uint64_t> flatmap;
+    for (const auto& item : source)
+        flatmap.emplace(item.first, item.second);
+    context.metrics().SetCustom("CRC", lookup(flatmap));
+}
+
+BENCHMARK_FIXTURE(ImageFixture, "FlatMapImage::Load()", settings)
+{
+    auto image = FlatMapImage<uint64_t, uint64_t>::Load("flatmap.image");
+    context.metrics().SetCustom("CRC", lookup(image));
+}
+
+BENCHMARK_FIXTURE(ImageFixture, "FlatMapImage mapped", settings)
+{
+    MappedFile file("flatmap.image");
+    FlatMapImage<uint64_t, uint64_t> image(file.data(), file.size());
+    context.metrics().SetCustom("CRC", lookup(image));
+}
+
+BENCHMARK_REPORT_MAIN()
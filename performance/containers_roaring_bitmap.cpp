@@ -0,0 +1,74 @@
+//
+// Created by Ivan Shynkarenka on 15.10.2026
+//
+
+#include "benchmark_report.h"
+
+#include "containers/roaring_bitmap.h"
+
+#include <unordered_set>
+#include <vector>
+
+using namespace CppCommon;
+
+const int items_from = 100000;
+const int items_to = 10000000;
+const auto settings = CppBenchmark::Settings().Attempts(3).ParamRange(items_from, items_to, [](int from, int to, int& result) { int r = result; result *= 10; return r; });
+
+class IdsFixture : public virtual CppBenchmark::Fixture
+{
+protected:
+    std::vector<uint64_t> ids1;
+    std::vector<uint64_t> ids2;
+
+    void Initialize(CppBenchmark::Context& context) override
+    {
+        ids1.resize(context.x());
+        ids2.resize(context.x());
+
+        // Fill ids with pseudo random values of the range four times larger than the count
+        uint64_t seed = 1;
+        uint64_t range = (uint64_t)context.x() * 4;
+        for (size_t i = 0; i < ids1.size(); ++i)
+        {
+            seed = seed * 6364136223846793005ull + 1442695040888963407ull;
+            ids1[i] = (seed >> 20) % range;
+            seed = seed * 6364136223846793005ull + 1442695040888963407ull;
+            ids2[i] = (seed >> 20) % range;
+        }
+    }
+
+    void Cleanup(CppBenchmark::Context& context) override
+    {
+        ids1.clear();
+        ids1.shrink_to_fit();
+        ids2.clear();
+        ids2.shrink_to_fit();
+    }
+};
+
+BENCHMARK_FIXTURE(IdsFixture, "std::unordered_set-intersect", settings)
+{
+    std::unordered_set<uint64_t> set1(ids1.begin(), ids1.end());
+    std::unordered_set<uint64_t> set2(ids2.begin(), ids2.end());
+    size_t count = 0;
+    for (auto id : set1)
+        if (set2.count(id) > 0)
+            ++count;
+    context.metrics().AddItems(ids1.size() + ids2.size());
+    context.metrics().SetCustom("Count", (uint64_t)count);
+}
+
+BENCHMARK_FIXTURE(IdsFixture, "RoaringBitmap-intersect", settings)
+{
+    RoaringBitmap bitmap1;
+    RoaringBitmap bitmap2;
+    bitmap1.insert(ids1.begin(), ids1.end());
+    bitmap2.insert(ids2.begin(), ids2.end());
+    RoaringBitmap result = bitmap1 & bitmap2;
+    context.metrics().AddItems(ids1.size() + ids2.size());
+    context.metrics().SetCustom("Count", result.size());
+    context.metrics().SetCustom("Bytes", (uint64_t)bitmap1.bytes());
+}
+
+BENCHMARK_REPORT_MAIN()
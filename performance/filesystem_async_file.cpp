@@ -0,0 +1,93 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "benchmark_report.h"
+
+#include "filesystem/async_file.h"
+#include "filesystem/file.h"
+
+#include <array>
+
+using namespace CppCommon;
+
+const uint64_t operations = 10000;
+const uint64_t flush_every = 16;
+const int page = 4096;
+const int depth_from = 1;
+const int depth_to = 256;
+const auto settings = CppBenchmark::Settings().ParamRange(depth_from, depth_to, [](int from, int to, int& result) { int r = result; result *= 4; return r; });
+
+// Write the buffer into the file and flush the file each flush_every writes
+template <AsyncFileBackend backend>
+void write_async(CppBenchmark::Context& context)
+{
+    std::array<uint8_t, page> buffer;
+    buffer.fill(0xAA);
+
+    AsyncFile file("test.tmp", context.x(), backend);
+    file.OpenOrCreate(false, true, true);
+
+    uint64_t written = 0;
+    for (uint64_t i = 0; i < operations; ++i)
+    {
+        while (!file.WriteAsync(i * page, buffer.data(), buffer.size(), [&written](const AsyncFileResult& result) { written += result.size; }))
+            file.Wait();
+        if ((i % flush_every) == (flush_every - 1))
+            while (!file.FlushAsync(nullptr))
+                file.Wait();
+        file.Submit();
+        file.Poll();
+    }
+    file.Close();
+    File::Remove(file.path());
+
+    context.metrics().AddOperations(operations - 1);
+    context.metrics().AddBytes(written);
+    context.metrics().SetCustom("Backend", (int)file.backend());
+}
+
+class FileWriteFlushFixture : public virtual CppBenchmark::Fixture
+{
+protected:
+    File file;
+    std::array<uint8_t, page> buffer;
+    uint64_t index;
+
+    FileWriteFlushFixture() : file("test.tmp"), index(0)
+    {
+        buffer.fill(0xAA);
+    }
+
+    void Initialize(CppBenchmark::Context& context) override
+    {
+        file.Create(false, true);
+        index = 0;
+    }
+
+    void Cleanup(CppBenchmark::Context& context) override
+    {
+        file.Close();
+        File::Remove(file);
+    }
+};
+
+BENCHMARK_FIXTURE(FileWriteFlushFixture, "File::Write()+Flush()", operations)
+{
+    file.Write(buffer.data(), buffer.size());
+    if ((++index % flush_every) == 0)
+        file.Flush();
+    context.metrics().AddBytes(buffer.size());
+}
+
+BENCHMARK("AsyncFile-thread", settings)
+{
+    write_async<AsyncFileBackend::THREAD>(context);
+}
+
+BENCHMARK("AsyncFile-native", settings)
+{
+    write_async<AsyncFileBackend::AUTO>(context);
+}
+
+BENCHMARK_REPORT_MAIN()
@@ -0,0 +1,74 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "benchmark_report.h"
+
+#include "filesystem/async_logger.h"
+#include "filesystem/file.h"
+#include "string/format.h"
+
+#include <memory>
+
+using namespace CppCommon;
+
+const uint64_t operations = 100000;
+
+class AsyncLoggerFixture : public virtual CppBenchmark::Fixture
+{
+protected:
+    std::unique_ptr<AsyncLogger> logger;
+
+    void Initialize(CppBenchmark::Context& context) override
+    {
+        // Ring buffer is big enough to hold all messages of the benchmark
+        logger = std::make_unique<AsyncLogger>("test.log", 0, 0, 64 * 1024 * 1024);
+    }
+
+    void Cleanup(CppBenchmark::Context& context) override
+    {
+        logger.reset();
+        File::Remove("test.log");
+    }
+};
+
+class FileLoggerFixture : public virtual CppBenchmark::Fixture
+{
+protected:
+    File file;
+
+    FileLoggerFixture() : file("test.log") {}
+
+    void Initialize(CppBenchmark::Context& context) override
+    {
+        file.Create(false, true);
+    }
+
+    void Cleanup(CppBenchmark::Context& context) override
+    {
+        file.Close();
+        File::Remove(file);
+    }
+};
+
+BENCHMARK_FIXTURE(AsyncLoggerFixture, "AsyncLogger::Info()-no arguments", operations)
+{
+    logger->Info("Order accepted");
+}
+
+BENCHMARK_FIXTURE(AsyncLoggerFixture, "AsyncLogger::Info()-numbers", operations)
+{
+    logger->Info("Order {} accepted: price {} quantity {}", context.metrics().total_operations(), 1.0825, 100);
+}
+
+BENCHMARK_FIXTURE(AsyncLoggerFixture, "AsyncLogger::Info()-string", operations)
+{
+    logger->Info("Order {} accepted for {}", context.metrics().total_operations(), "EUR/USD");
+}
+
+BENCHMARK_FIXTURE(FileLoggerFixture, "print(File)-numbers", operations)
+{
+    print(file, "Order {} accepted: price {} quantity {}\n", context.metrics().total_operations(), 1.0825, 100);
+}
+
+BENCHMARK_REPORT_MAIN()
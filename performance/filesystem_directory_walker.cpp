@@ -0,0 +1,125 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "benchmark_report.h"
+
+#include "filesystem/directory.h"
+#include "filesystem/directory_walker.h"
+#include "filesystem/file.h"
+#include "filesystem/path.h"
+
+#include <atomic>
+#include <string>
+
+using namespace CppCommon;
+
+const uint64_t iterations = 10;
+const int fanout = 8;
+const int depth = 4;
+const int threads_from = 1;
+const int threads_to = 32;
+const auto settings = CppBenchmark::Settings().Attempts(1).Operations(iterations).ParamRange(threads_from, threads_to, [](int from, int to, int& result) { int r = result; result *= 2; return r; });
+const int entries_from = 10000;
+const int entries_to = 1000000;
+const int entries_per_directory = 1000;
+const auto entries_settings = CppBenchmark::Settings().Attempts(1).Operations(1).ParamRange(entries_from, entries_to, [](int from, int to, int& result) { int r = result; result *= 10; return r; });
+
+class TreeFixture
+{
+protected:
+    Directory root;
+
+    TreeFixture() : root(Path::current() / "walker")
+    {
+        Directory::Create(root);
+        CreateTree(root, depth);
+    }
+
+    ~TreeFixture()
+    {
+        Path::RemoveAll(root, 0);
+    }
+
+private:
+    static void CreateTree(const Path& path, int level)
+    {
+        for (int i = 0; i < fanout; ++i)
+        {
+            File::WriteEmpty(path / ("file" + std::to_string(i)));
+            if (level > 0)
+            {
+                Directory child = Directory::Create(path / ("dir" + std::to_string(i)));
+                CreateTree(child, level - 1);
+            }
+        }
+    }
+};
+
+class SizedTreeFixture : public virtual CppBenchmark::Fixture
+{
+protected:
+    Directory root;
+
+    SizedTreeFixture() : root(Path::current() / "walker-sized") {}
+
+    void Initialize(CppBenchmark::Context& context) override
+    {
+        // Generate the given count of entries as directories of the fixed size
+        Directory::Create(root);
+        for (int i = 0; i < context.x() / entries_per_directory; ++i)
+        {
+            Directory child = Directory::Create(root / ("dir" + std::to_string(i)));
+            for (int j = 1; j < entries_per_directory; ++j)
+                File::WriteEmpty(child / ("file" + std::to_string(j)));
+        }
+    }
+
+    void Cleanup(CppBenchmark::Context& context) override
+    {
+        Path::RemoveAll(root, 0);
+    }
+};
+
+BENCHMARK_FIXTURE(TreeFixture, "Directory::GetEntriesRecursive()", iterations)
+{
+    context.metrics().AddItems(root.GetEntriesRecursive().size());
+}
+
+BENCHMARK_FIXTURE(TreeFixture, "DirectoryWalker::Walk()", settings)
+{
+    DirectoryWalker walker(context.x());
+    std::atomic<uint64_t> files(0);
+    uint64_t entries = walker.Walk(root, [&files](const Path& path, FileType type)
+    {
+        if (type == FileType::REGULAR)
+            files.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    });
+    context.metrics().AddItems(entries);
+    context.metrics().SetCustom("Files", files.load());
+}
+
+BENCHMARK_FIXTURE(TreeFixture, "Path::CopyAll()", settings)
+{
+    std::atomic<uint64_t> entries(0);
+    Path copy = Path::CopyAll(root, Path::current() / "walker-copy", false, context.x(), [&entries](const Path& src, const Path& dst, uint64_t size)
+    {
+        entries.fetch_add(1, std::memory_order_relaxed);
+    });
+    context.metrics().AddItems(entries.load());
+    Path::RemoveAll(copy, 0);
+}
+
+BENCHMARK_FIXTURE(SizedTreeFixture, "Directory::GetEntriesRecursive()-entries", entries_settings)
+{
+    context.metrics().AddItems(root.GetEntriesRecursive().size());
+}
+
+BENCHMARK_FIXTURE(SizedTreeFixture, "DirectoryWalker::Walk()-entries", entries_settings)
+{
+    DirectoryWalker walker;
+    context.metrics().AddItems(walker.Walk(root, [](const Path& path, FileType type) { return true; }));
+}
+
+BENCHMARK_REPORT_MAIN()
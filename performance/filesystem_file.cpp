@@ -2,11 +2,14 @@
 // Created by Ivan Shynkarenka on 31.08.2016
 //
 
-#include "benchmark/cppbenchmark.h"
+#include "benchmark_report.h"
 
 #include "filesystem/file.h"
+#include "filesystem/mapped_file.h"
 
 #include <array>
+#include <cstring>
+#include <memory>
 
 using namespace CppCommon;
 
@@ -49,7 +52,6 @@ protected:
         file.Open(true, false);
     }
 
-private:
     void CreateTestFile()
     {
         file.Create(false, true);
@@ -59,6 +61,43 @@ private:
     }
 };
 
+class FileRecordWriteFixture : public FileWriteFixture
+{
+protected:
+    const size_t header = 16;
+
+    void Initialize(CppBenchmark::Context& context) override
+    {
+        // Open unbuffered file for writing
+        file.Create(false, true, File::DEFAULT_ATTRIBUTES, File::DEFAULT_PERMISSIONS, 0);
+    }
+};
+
+class MappedFileReadFixture : public FileReadFixture
+{
+protected:
+    std::unique_ptr<MappedFile> mapped;
+    size_t offset;
+
+    MappedFileReadFixture() : offset(0) {}
+
+    void Initialize(CppBenchmark::Context& context) override
+    {
+        CreateTestFile();
+
+        // Map file for sequential reading
+        mapped = std::make_unique<MappedFile>(file);
+        mapped->Advise(FileAdvice::SEQUENTIAL);
+        offset = 0;
+    }
+
+    void Cleanup(CppBenchmark::Context& context) override
+    {
+        mapped.reset();
+        File::Remove(file);
+    }
+};
+
 BENCHMARK_FIXTURE(FileWriteFixture, "File::Write()", operations)
 {
     file.Write(buffer.data(), buffer.size());
@@ -71,4 +110,30 @@ BENCHMARK_FIXTURE(FileReadFixture, "File::Read()", operations)
     context.metrics().AddBytes(buffer.size());
 }
 
-BENCHMARK_MAIN()
+BENCHMARK_FIXTURE(FileRecordWriteFixture, "File::Write()-record", operations)
+{
+    file.Write(buffer.data(), header);
+    file.Write(buffer.data() + header, buffer.size() - header);
+    context.metrics().AddBytes(buffer.size());
+}
+
+BENCHMARK_FIXTURE(FileRecordWriteFixture, "File::WriteV()-record", operations)
+{
+    file.WriteV({ { buffer.data(), header }, { buffer.data() + header, buffer.size() - header } });
+    context.metrics().AddBytes(buffer.size());
+}
+
+BENCHMARK_FIXTURE(FileReadFixture, "File::ReadAt()", operations)
+{
+    file.ReadAt((context.metrics().total_operations() % operations) * buffer.size(), buffer.data(), buffer.size());
+    context.metrics().AddBytes(buffer.size());
+}
+
+BENCHMARK_FIXTURE(MappedFileReadFixture, "MappedFile::data()", operations)
+{
+    std::memcpy(buffer.data(), mapped->data() + offset, buffer.size());
+    offset = (offset + buffer.size()) % mapped->size();
+    context.metrics().AddBytes(buffer.size());
+}
+
+BENCHMARK_REPORT_MAIN()
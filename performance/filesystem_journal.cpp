@@ -0,0 +1,88 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "benchmark_report.h"
+
+#include "algorithms/crc32c.h"
+#include "filesystem/file.h"
+#include "filesystem/journal.h"
+
+#include <array>
+#include <cstring>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace CppCommon;
+
+const uint64_t operations = 4096;
+const int record = 128;
+const int threads_from = 1;
+const int threads_to = 32;
+const auto settings = CppBenchmark::Settings().ParamRange(threads_from, threads_to, [](int from, int to, int& result) { int r = result; result *= 2; return r; });
+
+template <class TAppend>
+void append(CppBenchmark::Context& context, TAppend&& append)
+{
+    const int threads_count = context.x();
+
+    // Start producer threads of the shared journal
+    std::vector<std::thread> threads;
+    for (int thread = 0; thread < threads_count; ++thread)
+    {
+        threads.emplace_back([&append, threads_count]()
+        {
+            std::array<uint8_t, record> buffer;
+            buffer.fill(0xAA);
+            for (uint64_t i = 0; i < (operations / threads_count); ++i)
+                append(buffer.data(), buffer.size());
+        });
+    }
+
+    // Wait for all threads
+    for (auto& thread : threads)
+        thread.join();
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(operations - 1);
+    context.metrics().AddBytes(operations * record);
+}
+
+BENCHMARK("File::Write()+Flush()-record", settings)
+{
+    // Baseline with one write and one flush per record under the mutex
+    std::mutex mutex;
+    File file("test.tmp");
+    file.Create(false, true, File::DEFAULT_ATTRIBUTES, File::DEFAULT_PERMISSIONS, 0);
+
+    append(context, [&mutex, &file](const uint8_t* data, size_t size)
+    {
+        std::array<uint8_t, 8> header;
+        uint32_t length = (uint32_t)size;
+        uint32_t crc = CRC32C::Calculate(data, size);
+        std::memcpy(header.data(), &length, 4);
+        std::memcpy(header.data() + 4, &crc, 4);
+
+        std::scoped_lock locker(mutex);
+        file.WriteV({ { header.data(), header.size() }, { data, size } });
+        file.Flush();
+    });
+
+    file.Close();
+    File::Remove(file);
+}
+
+BENCHMARK("Journal::Append()", settings)
+{
+    Journal journal("test.tmp");
+    journal.Open();
+
+    append(context, [&journal](const uint8_t* data, size_t size) { journal.Append(data, size); });
+
+    context.metrics().SetCustom("Commits", journal.commits());
+    journal.Close();
+    File::Remove(journal.path());
+}
+
+BENCHMARK_REPORT_MAIN()
@@ -0,0 +1,71 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "benchmark_report.h"
+
+#include "math/decimal.h"
+#include "math/math.h"
+
+#include <cstring>
+#include <string>
+
+using namespace CppCommon;
+
+const uint64_t operations = 10000000;
+
+typedef Decimal<8> Price;
+
+const char* const prices[] = { "1.0825", "65000.12345678", "0.00001234", "105.5", "1234567.8" };
+
+static volatile int64_t sink;
+static volatile double dsink;
+
+BENCHMARK("std::stod()", operations)
+{
+    dsink = std::stod(prices[context.metrics().total_operations() % 5]);
+}
+
+BENCHMARK("Decimal::from_chars()", operations)
+{
+    const char* str = prices[context.metrics().total_operations() % 5];
+    Price price;
+    Price::from_chars(str, str + std::strlen(str), price);
+    sink = price.raw();
+}
+
+BENCHMARK("Decimal::to_chars()", operations)
+{
+    char buffer[Price::MAX_SIZE];
+    Price price = Price::FromRaw(6500012345678 + (int64_t)context.metrics().total_operations());
+    sink = price.to_chars(buffer, buffer + sizeof(buffer)).ptr - buffer;
+}
+
+BENCHMARK("Decimal: price * quantity", operations)
+{
+    Price price = Price::FromRaw(6500012345678 + (int64_t)(context.metrics().total_operations() & 0xFF));
+    Price quantity = Price::FromRaw(150000000);
+    sink = (price * quantity).raw();
+}
+
+BENCHMARK("Decimal: price * quantity (128-bit product)", operations)
+{
+    Price price = Price::FromRaw(6500012345678 + (int64_t)(context.metrics().total_operations() & 0xFF));
+    Price quantity = Price::FromRaw(100000000000000);
+    sink = (price * quantity).raw();
+}
+
+BENCHMARK("Decimal: price / quantity", operations)
+{
+    Price price = Price::FromRaw(6500012345678 + (int64_t)(context.metrics().total_operations() & 0xFF));
+    Price quantity = Price::FromRaw(150000000);
+    sink = (price / quantity).raw();
+}
+
+BENCHMARK("Math::MulDiv64()", operations)
+{
+    uint64_t price = 6500012345678 + (context.metrics().total_operations() & 0xFF);
+    sink = (int64_t)Math::MulDiv64(price, 100000000000000, 100000000);
+}
+
+BENCHMARK_REPORT_MAIN()
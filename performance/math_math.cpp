@@ -0,0 +1,235 @@
+//
+// Created by Ivan Shynkarenka on 15.10.2026
+//
+
+#include "benchmark_report.h"
+
+#include "math/math.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+using namespace CppCommon;
+
+const size_t values_count = 1000000;
+const auto settings = CppBenchmark::Settings().Operations(1000);
+
+class ValuesFixture
+{
+protected:
+    std::vector<int64_t> prices;
+    std::vector<int64_t> volumes;
+    std::vector<double> values;
+    std::vector<double> weights;
+
+    ValuesFixture() : prices(values_count), volumes(values_count), values(values_count), weights(values_count)
+    {
+        for (size_t i = 0; i < values_count; ++i)
+        {
+            prices[i] = 1000000 + (int64_t)((i * 7919) % 10000);
+            volumes[i] = 1 + (int64_t)((i * 104729) % 100);
+            values[i] = (double)prices[i] / 10000.0;
+            weights[i] = (double)volumes[i];
+        }
+    }
+};
+
+static volatile int64_t sink;
+static volatile double dsink;
+
+BENCHMARK_FIXTURE(ValuesFixture, "Sum(int64).scalar", settings)
+{
+    int64_t sum = 0;
+    for (auto value : prices)
+        sum += value;
+    sink = sum;
+    context.metrics().AddItems(values_count);
+}
+
+BENCHMARK_FIXTURE(ValuesFixture, "Sum(int64).Math", settings)
+{
+    sink = Math::Sum(prices);
+    context.metrics().AddItems(values_count);
+}
+
+BENCHMARK_FIXTURE(ValuesFixture, "Sum(double).scalar", settings)
+{
+    double sum = 0.0;
+    for (auto value : values)
+        sum += value;
+    dsink = sum;
+    context.metrics().AddItems(values_count);
+}
+
+BENCHMARK_FIXTURE(ValuesFixture, "Sum(double).Math", settings)
+{
+    dsink = Math::Sum(values);
+    context.metrics().AddItems(values_count);
+}
+
+BENCHMARK_FIXTURE(ValuesFixture, "Sum(double, Kahan).scalar", settings)
+{
+    double sum = 0.0;
+    double compensation = 0.0;
+    for (auto value : values)
+    {
+        double y = value - compensation;
+        double t = sum + y;
+        compensation = (t - sum) - y;
+        sum = t;
+    }
+    dsink = sum;
+    context.metrics().AddItems(values_count);
+}
+
+BENCHMARK_FIXTURE(ValuesFixture, "Sum(double, Kahan).Math", settings)
+{
+    dsink = Math::Sum(values, MathAccumulation::KAHAN);
+    context.metrics().AddItems(values_count);
+}
+
+BENCHMARK_FIXTURE(ValuesFixture, "MinMax(int64).scalar", settings)
+{
+    int64_t min = std::numeric_limits<int64_t>::max();
+    int64_t max = std::numeric_limits<int64_t>::lowest();
+    for (auto value : prices)
+    {
+        min = std::min(min, value);
+        max = std::max(max, value);
+    }
+    sink = max - min;
+    context.metrics().AddItems(values_count);
+}
+
+BENCHMARK_FIXTURE(ValuesFixture, "MinMax(int64).Math", settings)
+{
+    auto result = Math::MinMax(prices);
+    sink = result.second - result.first;
+    context.metrics().AddItems(values_count);
+}
+
+BENCHMARK_FIXTURE(ValuesFixture, "MinMax(double).scalar", settings)
+{
+    double min = std::numeric_limits<double>::max();
+    double max = std::numeric_limits<double>::lowest();
+    for (auto value : values)
+    {
+        min = std::min(min, value);
+        max = std::max(max, value);
+    }
+    dsink = max - min;
+    context.metrics().AddItems(values_count);
+}
+
+BENCHMARK_FIXTURE(ValuesFixture, "MinMax(double).Math", settings)
+{
+    auto result = Math::MinMax(values);
+    dsink = result.second - result.first;
+    context.metrics().AddItems(values_count);
+}
+
+BENCHMARK_FIXTURE(ValuesFixture, "MeanVariance(double).scalar", settings)
+{
+    double mean = 0.0;
+    for (auto value : values)
+        mean += value;
+    mean /= values_count;
+    double variance = 0.0;
+    for (auto value : values)
+        variance += (value - mean) * (value - mean);
+    dsink = variance / values_count;
+    context.metrics().AddItems(values_count);
+}
+
+BENCHMARK_FIXTURE(ValuesFixture, "MeanVariance(double).Math", settings)
+{
+    dsink = Math::MeanVariance(values).variance;
+    context.metrics().AddItems(values_count);
+}
+
+BENCHMARK_FIXTURE(ValuesFixture, "MeanVariance(double, Kahan).Math", settings)
+{
+    dsink = Math::MeanVariance(values, MathAccumulation::KAHAN).variance;
+    context.metrics().AddItems(values_count);
+}
+
+BENCHMARK_FIXTURE(ValuesFixture, "MeanVariance(double, Welford).scalar", settings)
+{
+    double count = 0.0;
+    double mean = 0.0;
+    double m2 = 0.0;
+    for (auto value : values)
+    {
+        count += 1.0;
+        double delta = value - mean;
+        mean += delta / count;
+        m2 += delta * (value - mean);
+    }
+    dsink = m2 / count;
+    context.metrics().AddItems(values_count);
+}
+
+BENCHMARK_FIXTURE(ValuesFixture, "MeanVariance(double, Welford).Math", settings)
+{
+    dsink = Math::MeanVariance(values, MathAccumulation::WELFORD).variance;
+    context.metrics().AddItems(values_count);
+}
+
+BENCHMARK_FIXTURE(ValuesFixture, "Dot(int64).scalar", settings)
+{
+    int64_t sum = 0;
+    for (size_t i = 0; i < values_count; ++i)
+        sum += prices[i] * volumes[i];
+    sink = sum;
+    context.metrics().AddItems(values_count);
+}
+
+BENCHMARK_FIXTURE(ValuesFixture, "Dot(int64).Math", settings)
+{
+    sink = Math::Dot(prices, volumes);
+    context.metrics().AddItems(values_count);
+}
+
+BENCHMARK_FIXTURE(ValuesFixture, "Dot(double).scalar", settings)
+{
+    double sum = 0.0;
+    for (size_t i = 0; i < values_count; ++i)
+        sum += values[i] * weights[i];
+    dsink = sum;
+    context.metrics().AddItems(values_count);
+}
+
+BENCHMARK_FIXTURE(ValuesFixture, "Dot(double).Math", settings)
+{
+    dsink = Math::Dot(values, weights);
+    context.metrics().AddItems(values_count);
+}
+
+BENCHMARK_FIXTURE(ValuesFixture, "VWAP(double).scalar", settings)
+{
+    double notional = 0.0;
+    double volume = 0.0;
+    for (size_t i = 0; i < values_count; ++i)
+    {
+        notional += values[i] * weights[i];
+        volume += weights[i];
+    }
+    dsink = notional / volume;
+    context.metrics().AddItems(values_count);
+}
+
+BENCHMARK_FIXTURE(ValuesFixture, "VWAP(double).Math", settings)
+{
+    dsink = Math::WeightedAverage(values, weights);
+    context.metrics().AddItems(values_count);
+}
+
+BENCHMARK_FIXTURE(ValuesFixture, "VWAP(int64).Math", settings)
+{
+    dsink = Math::WeightedAverage(prices, volumes);
+    context.metrics().AddItems(values_count);
+}
+
+BENCHMARK_REPORT_MAIN()
@@ -2,13 +2,19 @@
 // Created by Ivan Shynkarenka on 17.05.2017
 //
 
-#include "benchmark/cppbenchmark.h"
+#include "benchmark_report.h"
 
+#include "containers/arena_map.h"
 #include "memory/allocator.h"
 #include "memory/allocator_arena.h"
+#include "memory/allocator_concurrent_pool.h"
 #include "memory/allocator_heap.h"
 #include "memory/allocator_pool.h"
+#include "memory/allocator_slab.h"
+#include "memory/object_pool.h"
 
+#include <mutex>
+#include <thread>
 #include <vector>
 
 using namespace CppCommon;
@@ -62,6 +68,17 @@ protected:
     void Reset() override { manager.reset(); }
 };
 
+class SlabMemoryManagerFixture : public MemoryManagerFixture
+{
+protected:
+    DefaultMemoryManager auxiliary;
+    SlabMemoryManager<DefaultMemoryManager> manager;
+
+    SlabMemoryManagerFixture() : manager(auxiliary) {}
+
+    void Reset() override { manager.reset(); }
+};
+
 template <class TMemoryManagerFixture>
 class MallocFixture : public TMemoryManagerFixture
 {
@@ -191,4 +208,188 @@ BENCHMARK_FIXTURE(FreeFixture<PoolMemoryManagerFixture>, "PoolMemoryManager.free
     context.metrics().AddBytes(context.y());
 }
 
-BENCHMARK_MAIN()
+BENCHMARK_FIXTURE(MallocFixture<SlabMemoryManagerFixture>, "SlabMemoryManager.malloc", CppBenchmark::Settings().Pair(10000000, 16))
+{
+    this->pointers.push_back(this->manager.malloc(context.y()));
+    context.metrics().AddBytes(context.y());
+}
+
+BENCHMARK_FIXTURE(FreeFixture<SlabMemoryManagerFixture>, "SlabMemoryManager.free", CppBenchmark::Settings().Pair(10000000, 16))
+{
+    this->manager.free(this->pointers.back(), context.y());
+    this->pointers.pop_back();
+    context.metrics().AddBytes(context.y());
+}
+
+BENCHMARK_FIXTURE(MallocFixture<SlabMemoryManagerFixture>, "SlabMemoryManager.malloc", CppBenchmark::Settings().Pair(1000000, 256))
+{
+    this->pointers.push_back(this->manager.malloc(context.y()));
+    context.metrics().AddBytes(context.y());
+}
+
+BENCHMARK_FIXTURE(FreeFixture<SlabMemoryManagerFixture>, "SlabMemoryManager.free", CppBenchmark::Settings().Pair(1000000, 256))
+{
+    this->manager.free(this->pointers.back(), context.y());
+    this->pointers.pop_back();
+    context.metrics().AddBytes(context.y());
+}
+
+const int items_per_thread = 100000;
+const int threads_from = 1;
+const int threads_to = 16;
+const auto threads_settings = CppBenchmark::Settings().ParamRange(threads_from, threads_to, [](int from, int to, int& result) { int r = result; result *= 2; return r; });
+
+// Each thread allocates and frees batches of 16-256 bytes blocks
+template <class TMalloc, class TFree>
+void produce_threads(CppBenchmark::Context& context, TMalloc&& malloc, TFree&& free)
+{
+    const int threads_count = context.x();
+
+    std::vector<std::thread> threads;
+    for (int thread = 0; thread < threads_count; ++thread)
+    {
+        threads.emplace_back([&malloc, &free]()
+        {
+            std::vector<std::pair<void*, size_t>> pointers;
+            pointers.reserve(1000);
+            for (int i = 0; i < items_per_thread; i += 1000)
+            {
+                for (int j = 0; j < 1000; ++j)
+                {
+                    size_t size = 16 + ((i + j) % 16) * 16;
+                    pointers.emplace_back(malloc(size), size);
+                }
+                for (const auto& pointer : pointers)
+                    free(pointer.first, pointer.second);
+                pointers.clear();
+            }
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+
+    context.metrics().AddItems(threads_count * items_per_thread);
+}
+
+BENCHMARK("DefaultMemoryManager.threads", threads_settings)
+{
+    DefaultMemoryManager manager;
+    produce_threads(context, [&manager](size_t size) { return manager.malloc(size); }, [&manager](void* ptr, size_t size) { manager.free(ptr, size); });
+}
+
+BENCHMARK("PoolMemoryManager.threads (mutex)", threads_settings)
+{
+    std::mutex lock;
+    DefaultMemoryManager auxiliary;
+    PoolMemoryManager<DefaultMemoryManager> manager(auxiliary);
+    produce_threads(context, [&lock, &manager](size_t size) { std::scoped_lock locker(lock); return manager.malloc(size); }, [&lock, &manager](void* ptr, size_t size) { std::scoped_lock locker(lock); manager.free(ptr, size); });
+}
+
+BENCHMARK("ConcurrentPoolMemoryManager.threads", threads_settings)
+{
+    DefaultMemoryManager auxiliary;
+    ConcurrentPoolMemoryManager<DefaultMemoryManager> manager(auxiliary);
+    produce_threads(context, [&manager](size_t size) { return manager.malloc(size); }, [&manager](void* ptr, size_t size) { manager.free(ptr, size); });
+}
+
+struct PooledObject
+{
+    uint64_t data[4];
+
+    explicit PooledObject(uint64_t value) : data{ value, value, value, value } {}
+};
+
+// Each thread creates and releases batches of objects
+template <class TCreate, class TRelease>
+void produce_objects(CppBenchmark::Context& context, TCreate&& create, TRelease&& release)
+{
+    const int threads_count = context.x();
+
+    std::vector<std::thread> threads;
+    for (int thread = 0; thread < threads_count; ++thread)
+    {
+        threads.emplace_back([&create, &release]()
+        {
+            std::vector<PooledObject*> objects;
+            objects.reserve(1000);
+            for (int i = 0; i < items_per_thread; i += 1000)
+            {
+                for (int j = 0; j < 1000; ++j)
+                    objects.push_back(create(i + j));
+                release(objects);
+                objects.clear();
+            }
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+
+    context.metrics().AddItems(threads_count * items_per_thread);
+}
+
+BENCHMARK("new/delete.threads", threads_settings)
+{
+    produce_objects(context, [](uint64_t value) { return new PooledObject(value); }, [](std::vector<PooledObject*>& objects) { for (auto object : objects) delete object; });
+}
+
+BENCHMARK("ObjectPool.threads", threads_settings)
+{
+    DefaultMemoryManager auxiliary;
+    ObjectPool<PooledObject> pool(auxiliary);
+    produce_objects(context, [&pool](uint64_t value) { return pool.Create(value); }, [&pool](std::vector<PooledObject*>& objects) { for (auto object : objects) pool.Release(object); });
+}
+
+BENCHMARK("ObjectPool.threads (bulk)", threads_settings)
+{
+    DefaultMemoryManager auxiliary;
+    ObjectPool<PooledObject> pool(auxiliary);
+    produce_objects(context, [&pool](uint64_t value) { return pool.Create(value); }, [&pool](std::vector<PooledObject*>& objects) { pool.Release(objects.begin(), objects.end()); });
+}
+
+const int requests = 10000;
+const int items_per_request = 256;
+const auto requests_settings = CppBenchmark::Settings().Operations(requests);
+
+// Each request fills scratch hash map and flat map, then releases them
+template <class THashMap, class TFlatMap, class TMakeHashMap, class TMakeFlatMap, class TReset>
+void produce_requests(CppBenchmark::Context& context, TMakeHashMap&& make_hashmap, TMakeFlatMap&& make_flatmap, TReset&& reset)
+{
+    uint64_t crc = 0;
+    for (int request = 0; request < requests; ++request)
+    {
+        {
+            THashMap hashmap = make_hashmap();
+            TFlatMap flatmap = make_flatmap();
+            for (int i = 0; i < items_per_request; ++i)
+            {
+                hashmap[request + i] = i;
+                flatmap[(request * 31 + i * 17) % 1024] = i;
+            }
+            crc += hashmap.size() + flatmap.size();
+        }
+        reset();
+    }
+
+    context.metrics().AddItems(requests * items_per_request);
+    context.metrics().SetCustom("CRC", crc);
+}
+
+BENCHMARK("Request maps (std::allocator)", requests_settings)
+{
+    produce_requests<HashMap<int, int>, FlatMap<int, int>>(context,
+        []() { return HashMap<int, int>(16, -1); },
+        []() { return FlatMap<int, int>(16); },
+        []() {});
+}
+
+BENCHMARK("Request maps (arena)", requests_settings)
+{
+    DefaultMemoryManager auxiliary;
+    ArenaMemoryManager<DefaultMemoryManager> arena(auxiliary);
+    produce_requests<ArenaHashMap<int, int>, ArenaFlatMap<int, int>>(context,
+        [&arena]() { return MakeArenaHashMap<int, int>(arena, 16, -1); },
+        [&arena]() { return MakeArenaFlatMap<int, int>(arena, 16); },
+        [&arena]() { arena.reset(); });
+}
+
+BENCHMARK_REPORT_MAIN()
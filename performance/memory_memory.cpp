@@ -0,0 +1,88 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "benchmark_report.h"
+
+#include "memory/memory.h"
+
+#include <cstring>
+#include <vector>
+
+using namespace CppCommon;
+
+const uint64_t iterations = 100;
+const size_t size = 16 * 1024 * 1024;
+
+class BufferFixture
+{
+protected:
+    std::vector<uint8_t> source;
+    std::vector<uint8_t> destination;
+
+    BufferFixture() : source(size, 0), destination(size, 0) {}
+};
+
+BENCHMARK_FIXTURE(BufferFixture, "Memory::IsZero()", iterations)
+{
+    context.metrics().AddItems(Memory::IsZero(source.data(), source.size()) ? 1 : 0);
+    context.metrics().AddBytes(source.size());
+}
+
+BENCHMARK_FIXTURE(BufferFixture, "Memory::ZeroFill()", iterations)
+{
+    Memory::ZeroFill(destination.data(), destination.size());
+    context.metrics().AddBytes(destination.size());
+}
+
+BENCHMARK_FIXTURE(BufferFixture, "memset()", iterations)
+{
+    std::memset(destination.data(), 0x5A, destination.size());
+    context.metrics().AddBytes(destination.size());
+}
+
+BENCHMARK_FIXTURE(BufferFixture, "Memory::StreamFill()", iterations)
+{
+    Memory::StreamFill(destination.data(), destination.size(), 0x5A);
+    context.metrics().AddBytes(destination.size());
+}
+
+BENCHMARK_FIXTURE(BufferFixture, "memcpy()", iterations)
+{
+    std::memcpy(destination.data(), source.data(), destination.size());
+    context.metrics().AddBytes(destination.size());
+}
+
+BENCHMARK_FIXTURE(BufferFixture, "Memory::StreamCopy()", iterations)
+{
+    Memory::StreamCopy(destination.data(), source.data(), destination.size());
+    context.metrics().AddBytes(destination.size());
+}
+
+BENCHMARK_FIXTURE(BufferFixture, "Memory::RandomFill()", iterations)
+{
+    Memory::RandomFill(destination.data(), destination.size());
+    context.metrics().AddBytes(destination.size());
+}
+
+BENCHMARK_FIXTURE(BufferFixture, "Memory::FastRandomFill()", iterations)
+{
+    Memory::FastRandomFill(destination.data(), destination.size());
+    context.metrics().AddBytes(destination.size());
+}
+
+BENCHMARK("Memory::RandomFill()-16 bytes", 1000000)
+{
+    uint8_t buffer[16];
+    Memory::RandomFill(buffer, sizeof(buffer));
+    context.metrics().AddBytes(sizeof(buffer));
+}
+
+BENCHMARK("Memory::FastRandomFill()-16 bytes", 1000000)
+{
+    uint8_t buffer[16];
+    Memory::FastRandomFill(buffer, sizeof(buffer));
+    context.metrics().AddBytes(sizeof(buffer));
+}
+
+BENCHMARK_REPORT_MAIN()
@@ -0,0 +1,44 @@
+//
+// Created by Ivan Shynkarenka on 15.10.2026
+//
+
+#include "benchmark_report.h"
+
+#include "memory/scratch.h"
+
+#include <string>
+#include <vector>
+
+using namespace CppCommon;
+
+const uint64_t operations = 1000000;
+
+// Hot function which collects temporary values and formats them into the temporary string
+template <class TVector, class TString>
+size_t hot_function(uint64_t seed)
+{
+    TVector values;
+    for (uint64_t i = 0; i < 32; ++i)
+        values.push_back(seed * 31 + i);
+
+    TString text;
+    for (auto value : values)
+        text.append(1, (char)('a' + (value % 26)));
+
+    return text.size() + values.size();
+}
+
+BENCHMARK("std::vector + std::string", operations)
+{
+    static volatile size_t result;
+    result = hot_function<std::vector<uint64_t>, std::string>(context.metrics().total_operations());
+}
+
+BENCHMARK("ScratchVector + ScratchString", operations)
+{
+    static volatile size_t result;
+    ScratchScope scope;
+    result = hot_function<ScratchVector<uint64_t>, ScratchString>(context.metrics().total_operations());
+}
+
+BENCHMARK_REPORT_MAIN()
@@ -0,0 +1,184 @@
+//
+// Created by Ivan Shynkarenka on 15.10.2026
+//
+
+#include "benchmark_report.h"
+
+#include "memory/allocator.h"
+#include "memory/allocator_arena.h"
+#include "memory/allocator_concurrent_pool.h"
+#include "memory/allocator_heap.h"
+#include "memory/allocator_pool.h"
+#include "memory/allocator_slab.h"
+#include "memory/allocator_stack.h"
+#include "memory/allocator_trace.h"
+
+#include <cstdlib>
+#include <map>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace CppCommon;
+
+// Path to the allocation trace recorded from the real service
+const char* trace_environment = "CPPCOMMON_ALLOCATION_TRACE";
+// Count of threads and requests of the synthetic service workload
+const int service_threads = 4;
+const int service_requests = 2000;
+
+const auto replay_settings = CppBenchmark::Settings().Attempts(3).Operations(1);
+
+// Serialize access to the memory manager which is not thread-safe
+template <class TMemoryManager>
+class LockedMemoryManager
+{
+public:
+    LockedMemoryManager(TMemoryManager& manager, std::mutex& lock) : _manager(manager), _lock(lock) {}
+
+    size_t allocated() const noexcept { return _manager.allocated(); }
+    size_t allocations() const noexcept { return _manager.allocations(); }
+    size_t max_size() const noexcept { return _manager.max_size(); }
+
+    void* malloc(size_t size, size_t alignment = alignof(std::max_align_t)) { std::scoped_lock locker(_lock); return _manager.malloc(size, alignment); }
+    void free(void* ptr, size_t size) { std::scoped_lock locker(_lock); _manager.free(ptr, size); }
+    void reset() { std::scoped_lock locker(_lock); _manager.reset(); }
+
+private:
+    TMemoryManager& _manager;
+    std::mutex& _lock;
+};
+
+// Record the synthetic service workload: each request builds a map of
+// string headers and a body, while a part of responses is kept alive in
+// the session cache and released by the next requests
+void RecordService(AllocationTrace& trace)
+{
+    DefaultMemoryManager auxiliary;
+    std::mutex lock;
+    LockedMemoryManager<DefaultMemoryManager> locked(auxiliary, lock);
+    TraceMemoryManager<LockedMemoryManager<DefaultMemoryManager>> manager(locked, trace);
+    TraceMemoryResource<LockedMemoryManager<DefaultMemoryManager>> resource(manager);
+
+    std::vector<std::thread> threads;
+    for (int thread = 0; thread < service_threads; ++thread)
+    {
+        threads.emplace_back([&resource, thread]()
+        {
+            std::pmr::vector<std::pmr::string> cache(&resource);
+            for (int request = 0; request < service_requests; ++request)
+            {
+                std::pmr::map<std::pmr::string, std::pmr::string> headers(&resource);
+                for (int header = 0; header < 8 + (request % 8); ++header)
+                    headers.emplace(std::pmr::string("X-Service-Header-Name-" + std::to_string(header), &resource), std::pmr::string(32 + (header * 16), 'v', &resource));
+
+                std::pmr::string body((size_t)(64 << ((request + thread) % 10)), 'b', &resource);
+                if ((request % 4) == 0)
+                    cache.push_back(std::move(body));
+                if (cache.size() > 64)
+                    cache.erase(cache.begin());
+            }
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+}
+
+// Load the allocation trace from the file or record the synthetic one
+const AllocationTrace& Trace()
+{
+    static AllocationTrace trace;
+    if (trace.empty())
+    {
+        const char* path = std::getenv(trace_environment);
+        if (path != nullptr)
+            trace.Load(path);
+        else
+            RecordService(trace);
+    }
+    return trace;
+}
+
+template <class TMemoryManager>
+void Replay(CppBenchmark::Context& context, TMemoryManager& manager, bool threads = false)
+{
+    AllocationReplay result = Trace().Replay(manager, threads);
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(result.events - 1);
+    context.metrics().SetCustom("replay.events", result.events);
+    context.metrics().SetCustom("replay.throughput", result.throughput());
+    context.metrics().SetCustom("replay.failures", result.failures);
+    context.metrics().SetCustom("replay.peak_live", result.peak_live);
+    context.metrics().SetCustom("replay.peak_rss", result.peak_rss);
+    context.metrics().SetCustom("replay.fragmentation", result.fragmentation());
+}
+
+BENCHMARK("DefaultMemoryManager", replay_settings)
+{
+    DefaultMemoryManager manager;
+    Replay(context, manager);
+}
+
+BENCHMARK("HeapMemoryManager", replay_settings)
+{
+    HeapMemoryManager manager;
+    Replay(context, manager);
+}
+
+BENCHMARK("ArenaMemoryManager", replay_settings)
+{
+    DefaultMemoryManager auxiliary;
+    ArenaMemoryManager<DefaultMemoryManager> manager(auxiliary);
+    Replay(context, manager);
+}
+
+BENCHMARK("PoolMemoryManager", replay_settings)
+{
+    DefaultMemoryManager auxiliary;
+    PoolMemoryManager<DefaultMemoryManager> manager(auxiliary);
+    Replay(context, manager);
+}
+
+BENCHMARK("SlabMemoryManager", replay_settings)
+{
+    DefaultMemoryManager auxiliary;
+    SlabMemoryManager<DefaultMemoryManager> manager(auxiliary);
+    Replay(context, manager);
+}
+
+BENCHMARK("StackMemoryManager", replay_settings)
+{
+    // Stack memory manager never reuses freed blocks, so it fails on traces greater than its buffer
+    auto manager = std::make_unique<StackMemoryManager<64 * 1024 * 1024>>();
+    Replay(context, *manager);
+}
+
+BENCHMARK("DefaultMemoryManager.threads (mutex)", replay_settings)
+{
+    std::mutex lock;
+    DefaultMemoryManager auxiliary;
+    LockedMemoryManager<DefaultMemoryManager> manager(auxiliary, lock);
+    Replay(context, manager, true);
+}
+
+BENCHMARK("PoolMemoryManager.threads (mutex)", replay_settings)
+{
+    std::mutex lock;
+    DefaultMemoryManager auxiliary;
+    PoolMemoryManager<DefaultMemoryManager> pool(auxiliary);
+    LockedMemoryManager<PoolMemoryManager<DefaultMemoryManager>> manager(pool, lock);
+    Replay(context, manager, true);
+}
+
+BENCHMARK("ConcurrentPoolMemoryManager.threads", replay_settings)
+{
+    DefaultMemoryManager auxiliary;
+    ConcurrentPoolMemoryManager<DefaultMemoryManager> manager(auxiliary);
+    Replay(context, manager, true);
+}
+
+BENCHMARK_REPORT_MAIN()
@@ -0,0 +1,106 @@
+//
+// Created by Ivan Shynkarenka on 15.10.2026
+//
+
+#ifndef CPPCOMMON_PERFORMANCE_QUEUE_LATENCY_H
+#define CPPCOMMON_PERFORMANCE_QUEUE_LATENCY_H
+
+#include "benchmark/cppbenchmark.h"
+
+#include "time/latency_histogram.h"
+#include "time/timestamp.h"
+
+#include <functional>
+#include <thread>
+#include <vector>
+
+// Offered loads of the latency mode in items per second
+const int latency_rate_from = 100000;
+const int latency_rate_to = 10000000;
+// Duration of each offered load in nanoseconds
+const uint64_t latency_duration = 250000000;
+// Count of producers of multiple producers queues in the latency mode
+const int latency_producers = 4;
+const auto latency_settings = CppBenchmark::Settings().Attempts(1).Operations(1).ParamRange(latency_rate_from, latency_rate_to, [](int from, int to, int& result) { int r = result; result *= 10; return r; });
+
+// Adapter of byte ring buffers which transfers timestamps in the latency mode
+template <class TBuffer>
+class LatencyRingBuffer
+{
+public:
+    explicit LatencyRingBuffer(size_t capacity) : _buffer(capacity) {}
+
+    bool Enqueue(uint64_t item) { return _buffer.Enqueue(&item, sizeof(item)); }
+    bool Dequeue(uint64_t& item) { size_t size = sizeof(item); return _buffer.Dequeue(&item, size); }
+
+private:
+    TBuffer _buffer;
+};
+
+// Produce items at the fixed offered load and measure their enqueue-to-dequeue latency.
+// Producers stamp each item with its scheduled enqueue time rather than the actual one,
+// so stalls of the producer on the full queue are charged to all delayed items and are
+// not hidden from the latency distribution (coordinated omission).
+template <class TQueue>
+void produce_consume_latency(CppBenchmark::Context& context, TQueue& queue, int producers_count, const std::function<void()>& wait_strategy)
+{
+    const uint64_t rate = context.x();
+    const uint64_t items = (rate * latency_duration / 1000000000) / producers_count;
+    const double interval = 1000000000.0 * producers_count / rate;
+
+    CppCommon::LatencyHistogram histogram;
+
+    // Start consumer thread
+    auto consumer = std::thread([&queue, &wait_strategy, &histogram, items, producers_count]()
+    {
+        for (uint64_t i = 0; i < items * producers_count; ++i)
+        {
+            // Dequeue using the given waiting strategy
+            uint64_t stamp = 0;
+            while (!queue.Dequeue(stamp))
+                wait_strategy();
+
+            // Record the enqueue-to-dequeue latency
+            uint64_t timestamp = CppCommon::Timestamp::nano();
+            histogram.Record((timestamp > stamp) ? (timestamp - stamp) : 0);
+        }
+    });
+
+    // Start producer threads with interleaved schedules after all threads are started
+    const uint64_t start = CppCommon::Timestamp::nano() + 10000000;
+    std::vector<std::thread> producers;
+    for (int producer = 0; producer < producers_count; ++producer)
+    {
+        producers.emplace_back([&queue, &wait_strategy, start, interval, items, producer, producers_count]()
+        {
+            for (uint64_t i = 0; i < items; ++i)
+            {
+                // Wait for the scheduled enqueue time
+                uint64_t scheduled = start + (uint64_t)((i + (double)producer / producers_count) * interval);
+                while (CppCommon::Timestamp::nano() < scheduled)
+                    continue;
+
+                // Enqueue using the given waiting strategy
+                while (!queue.Enqueue((uint64_t)scheduled))
+                    wait_strategy();
+            }
+        });
+    }
+
+    // Wait for all producers threads
+    for (auto& producer : producers)
+        producer.join();
+
+    // Wait for the consumer thread
+    consumer.join();
+
+    // Update benchmark metrics
+    context.metrics().AddItems(items * producers_count);
+    context.metrics().SetCustom("latency.rate", rate);
+    context.metrics().SetCustom("latency.p50", histogram.p50());
+    context.metrics().SetCustom("latency.p99", histogram.p99());
+    context.metrics().SetCustom("latency.p99.9", histogram.p999());
+    context.metrics().SetCustom("latency.max", histogram.max());
+}
+
+#endif // CPPCOMMON_PERFORMANCE_QUEUE_LATENCY_H
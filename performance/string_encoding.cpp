@@ -0,0 +1,312 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "benchmark_report.h"
+
+#include "string/encoding.h"
+
+#include <string>
+
+using namespace CppCommon;
+
+const uint64_t operations = 10000;
+const size_t payload = 65536;
+const size_t bytes_total = 256 * 1024 * 1024;
+const int size_from = 16;
+const int size_to = 1024 * 1024;
+const auto settings = CppBenchmark::Settings().ParamRange(size_from, size_to, [](int from, int to, int& result) { int r = result; result *= 8; return r; });
+
+class PayloadFixture
+{
+protected:
+    std::string bytes;
+    std::string text;
+    std::string base16;
+    std::string base32;
+    std::string base64;
+    std::string unicode;
+    std::string message;
+    std::string json;
+    std::string html;
+    std::string csv;
+    std::u16string text16;
+    std::string output;
+    std::u16string output16;
+    std::u32string output32;
+
+    PayloadFixture()
+    {
+        for (size_t i = 0; i < payload; ++i)
+            bytes += (char)((i * 131) ^ (i >> 7));
+        while (text.size() < payload)
+            text += "/api/v1/orders?symbol=EUR/USD&side=buy&price=1.08250&comment=limit order #42 ";
+        text.resize(payload);
+        base16 = Encoding::Base16Encode(bytes);
+        base32 = Encoding::Base32Encode(bytes);
+        base64 = Encoding::Base64Encode(bytes);
+        while (unicode.size() < payload)
+            unicode += "Price \xE2\x82\xAC" "1.08 \xCE\xA9 \xF0\x9D\x93\x83 ";
+        while (message.size() < payload)
+            message += "Order \"limit\" <EUR/USD> filled at 1.08250 & closed, comment:\tsee log\n";
+        message.resize(payload);
+        json = Encoding::JsonEscape(message);
+        html = Encoding::HtmlEscape(message);
+        csv = Encoding::CsvQuote(message);
+        text16 = Encoding::UTF8toUTF16(text);
+        output.resize(payload * 6);
+        output16.resize(unicode.size());
+        output32.resize(unicode.size());
+    }
+};
+
+BENCHMARK_FIXTURE(PayloadFixture, "Encoding::Base16Encode()", operations)
+{
+    Encoding::Base16Encode(bytes.data(), bytes.size(), output.data());
+    context.metrics().AddBytes(bytes.size());
+}
+
+BENCHMARK_FIXTURE(PayloadFixture, "Encoding::Base16Decode()", operations)
+{
+    Encoding::Base16Decode(base16.data(), base16.size(), output.data());
+    context.metrics().AddBytes(base16.size());
+}
+
+BENCHMARK_FIXTURE(PayloadFixture, "Encoding::Base32Encode()", operations)
+{
+    Encoding::Base32Encode(bytes, output.data());
+    context.metrics().AddBytes(bytes.size());
+}
+
+BENCHMARK_FIXTURE(PayloadFixture, "Encoding::Base32Decode()", operations)
+{
+    Encoding::Base32Decode(base32, output.data());
+    context.metrics().AddBytes(base32.size());
+}
+
+BENCHMARK_FIXTURE(PayloadFixture, "Encoding::Base64Encode()", operations)
+{
+    Encoding::Base64Encode(bytes, output.data());
+    context.metrics().AddBytes(bytes.size());
+}
+
+BENCHMARK_FIXTURE(PayloadFixture, "Encoding::Base64Encode()-string", operations)
+{
+    context.metrics().AddBytes(Encoding::Base64Encode(bytes).size() * 3 / 4);
+}
+
+BENCHMARK_FIXTURE(PayloadFixture, "Encoding::Base64Decode()", operations)
+{
+    Encoding::Base64Decode(base64, output.data());
+    context.metrics().AddBytes(base64.size());
+}
+
+BENCHMARK_FIXTURE(PayloadFixture, "Encoding::Base64Decode()-string", operations)
+{
+    context.metrics().AddBytes(Encoding::Base64Decode(base64).size() * 4 / 3);
+}
+
+BENCHMARK_FIXTURE(PayloadFixture, "Encoding::URLEncode()", operations)
+{
+    Encoding::URLEncode(text, output.data());
+    context.metrics().AddBytes(text.size());
+}
+
+BENCHMARK_FIXTURE(PayloadFixture, "Encoding::JsonEscape()-plain", operations)
+{
+    Encoding::JsonEscape(text, output.data());
+    context.metrics().AddBytes(text.size());
+}
+
+BENCHMARK_FIXTURE(PayloadFixture, "Encoding::JsonEscape()", operations)
+{
+    Encoding::JsonEscape(message, output.data());
+    context.metrics().AddBytes(message.size());
+}
+
+BENCHMARK_FIXTURE(PayloadFixture, "Encoding::JsonEscape()-string", operations)
+{
+    context.metrics().AddBytes(Encoding::JsonEscape(message).size());
+}
+
+BENCHMARK_FIXTURE(PayloadFixture, "Encoding::JsonUnescape()", operations)
+{
+    Encoding::JsonUnescape(json, output.data());
+    context.metrics().AddBytes(json.size());
+}
+
+BENCHMARK_FIXTURE(PayloadFixture, "Encoding::HtmlEscape()", operations)
+{
+    Encoding::HtmlEscape(message, output.data());
+    context.metrics().AddBytes(message.size());
+}
+
+BENCHMARK_FIXTURE(PayloadFixture, "Encoding::HtmlUnescape()", operations)
+{
+    Encoding::HtmlUnescape(html, output.data());
+    context.metrics().AddBytes(html.size());
+}
+
+BENCHMARK_FIXTURE(PayloadFixture, "Encoding::CsvQuote()", operations)
+{
+    Encoding::CsvQuote(message, output.data());
+    context.metrics().AddBytes(message.size());
+}
+
+BENCHMARK_FIXTURE(PayloadFixture, "Encoding::CsvUnquote()", operations)
+{
+    Encoding::CsvUnquote(csv, output.data());
+    context.metrics().AddBytes(csv.size());
+}
+
+BENCHMARK_FIXTURE(PayloadFixture, "Encoding::IsUTF8()-ascii", operations)
+{
+    context.metrics().AddBytes(Encoding::IsUTF8(text) ? text.size() : 0);
+}
+
+BENCHMARK_FIXTURE(PayloadFixture, "Encoding::IsUTF8()-unicode", operations)
+{
+    context.metrics().AddBytes(Encoding::IsUTF8(unicode) ? unicode.size() : 0);
+}
+
+BENCHMARK_FIXTURE(PayloadFixture, "Encoding::UTF8toUTF16()-ascii", operations)
+{
+    Encoding::UTF8toUTF16(text, output16.data());
+    context.metrics().AddBytes(text.size());
+}
+
+BENCHMARK_FIXTURE(PayloadFixture, "Encoding::UTF8toUTF16()-unicode", operations)
+{
+    Encoding::UTF8toUTF16(unicode, output16.data());
+    context.metrics().AddBytes(unicode.size());
+}
+
+BENCHMARK_FIXTURE(PayloadFixture, "Encoding::UTF8toUTF32()-ascii", operations)
+{
+    Encoding::UTF8toUTF32(text, output32.data());
+    context.metrics().AddBytes(text.size());
+}
+
+BENCHMARK_FIXTURE(PayloadFixture, "Encoding::UTF16toUTF8()-ascii", operations)
+{
+    Encoding::UTF16toUTF8(text16, output.data());
+    context.metrics().AddBytes(text16.size() * sizeof(char16_t));
+}
+
+class SizesFixture
+{
+protected:
+    std::string bytes;
+    std::string base16;
+    std::string base32;
+    std::string base64;
+    std::string unicode;
+    std::u16string unicode16;
+    std::u32string unicode32;
+    std::string output;
+    std::u16string output16;
+    std::u32string output32;
+
+    SizesFixture()
+    {
+        for (size_t i = 0; i < size_to; ++i)
+            bytes += (char)((i * 131) ^ (i >> 7));
+        base16 = Encoding::Base16Encode(bytes);
+        base32 = Encoding::Base32Encode(bytes);
+        base64 = Encoding::Base64Encode(bytes);
+        while (unicode.size() < size_to)
+            unicode += "Price \xE2\x82\xAC" "1.08 \xCE\xA9 \xF0\x9D\x93\x83 ";
+        unicode16 = Encoding::UTF8toUTF16(unicode);
+        unicode32 = Encoding::UTF8toUTF32(unicode);
+        output.resize(size_to * 4);
+        output16.resize(unicode.size());
+        output32.resize(unicode.size());
+    }
+
+    //! Trim the size of the UTF-8 input to the last complete code point
+    size_t utf8(size_t size) const noexcept
+    {
+        size_t lead = size;
+        while ((lead > 0) && ((unicode[lead - 1] & 0xC0) == 0x80))
+            --lead;
+        if (lead-- == 0)
+            return 0;
+        uint8_t ch = (uint8_t)unicode[lead];
+        size_t length = (ch < 0x80) ? 1 : (ch < 0xE0) ? 2 : (ch < 0xF0) ? 3 : 4;
+        return (lead + length <= size) ? size : lead;
+    }
+
+    //! Trim the size of the UTF-16 input to the last complete code point
+    size_t utf16(size_t size) const noexcept
+    {
+        return ((size > 0) && ((unicode16[size - 1] & 0xFC00) == 0xD800)) ? (size - 1) : size;
+    }
+};
+
+template <typename TFunction>
+void measure(CppBenchmark::Context& context, TFunction function)
+{
+    const size_t size = context.x();
+    const size_t count = bytes_total / size;
+
+    uint64_t result = 0;
+    for (size_t i = 0; i < count; ++i)
+        result += function(size);
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(count - 1);
+    context.metrics().AddBytes(count * size);
+    context.metrics().SetCustom("CRC", result);
+}
+
+BENCHMARK_FIXTURE(SizesFixture, "Encoding::Base16Encode()-size", settings)
+{
+    measure(context, [this](size_t size) { return (size_t)(Encoding::Base16Encode(bytes.data(), size, output.data()) - output.data()); });
+}
+
+BENCHMARK_FIXTURE(SizesFixture, "Encoding::Base16Decode()-size", settings)
+{
+    measure(context, [this](size_t size) { return Encoding::Base16Decode(base16.data(), size & ~(size_t)1, output.data()) ? 1 : 0; });
+}
+
+BENCHMARK_FIXTURE(SizesFixture, "Encoding::Base32Encode()-size", settings)
+{
+    measure(context, [this](size_t size) { return Encoding::Base32Encode(std::string_view(bytes.data(), size), output.data()); });
+}
+
+BENCHMARK_FIXTURE(SizesFixture, "Encoding::Base32Decode()-size", settings)
+{
+    measure(context, [this](size_t size) { return Encoding::Base32Decode(std::string_view(base32.data(), size & ~(size_t)7), output.data()); });
+}
+
+BENCHMARK_FIXTURE(SizesFixture, "Encoding::Base64Encode()-size", settings)
+{
+    measure(context, [this](size_t size) { return Encoding::Base64Encode(std::string_view(bytes.data(), size), output.data()); });
+}
+
+BENCHMARK_FIXTURE(SizesFixture, "Encoding::Base64Decode()-size", settings)
+{
+    measure(context, [this](size_t size) { return Encoding::Base64Decode(std::string_view(base64.data(), size & ~(size_t)3), output.data()); });
+}
+
+BENCHMARK_FIXTURE(SizesFixture, "Encoding::UTF8toUTF16()-size", settings)
+{
+    measure(context, [this](size_t size) { return Encoding::UTF8toUTF16(std::string_view(unicode.data(), utf8(size)), output16.data()); });
+}
+
+BENCHMARK_FIXTURE(SizesFixture, "Encoding::UTF8toUTF32()-size", settings)
+{
+    measure(context, [this](size_t size) { return Encoding::UTF8toUTF32(std::string_view(unicode.data(), utf8(size)), output32.data()); });
+}
+
+BENCHMARK_FIXTURE(SizesFixture, "Encoding::UTF16toUTF8()-size", settings)
+{
+    measure(context, [this](size_t size) { return Encoding::UTF16toUTF8(std::u16string_view(unicode16.data(), utf16(size / sizeof(char16_t))), output.data()); });
+}
+
+BENCHMARK_FIXTURE(SizesFixture, "Encoding::UTF32toUTF8()-size", settings)
+{
+    measure(context, [this](size_t size) { return Encoding::UTF32toUTF8(std::u32string_view(unicode32.data(), size / sizeof(char32_t)), output.data()); });
+}
+
+BENCHMARK_REPORT_MAIN()
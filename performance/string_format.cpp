@@ -2,12 +2,30 @@
 // Created by Ivan Shynkarenka on 19.09.2016
 //
 
-#include "benchmark/cppbenchmark.h"
+#include "benchmark_report.h"
 
 #include "string/format.h"
+#include "string/formatter.h"
 
 using namespace CppCommon;
 
+class NullWriter : public Writer
+{
+public:
+    size_t Write(const void*, size_t size) override { return size; }
+
+    using Writer::Write;
+};
+
+class FormatFixture
+{
+protected:
+    fmt::memory_buffer buffer;
+    char chars[256];
+    NullWriter writer;
+    Formatter formatter{"test {}.{}.{} test"};
+};
+
 BENCHMARK("format(int)")
 {
     context.metrics().AddBytes(CppCommon::format("test {} test", context.metrics().total_operations()).size());
@@ -28,4 +46,55 @@ BENCHMARK("format(int, double, string)")
     context.metrics().AddBytes(CppCommon::format("test {}.{}.{} test", context.metrics().total_operations(), context.metrics().total_operations() / 1000.0, context.name()).size());
 }
 
-BENCHMARK_MAIN()
+BENCHMARK_FIXTURE(FormatFixture, "format_to(memory_buffer)")
+{
+    buffer.clear();
+    format_to(buffer, "test {}.{}.{} test", context.metrics().total_operations(), context.metrics().total_operations() / 1000.0, context.name());
+    context.metrics().AddBytes(buffer.size());
+}
+
+BENCHMARK_FIXTURE(FormatFixture, "format_to(char[])")
+{
+    context.metrics().AddBytes(format_to(chars, "test {}.{}.{} test", context.metrics().total_operations(), context.metrics().total_operations() / 1000.0, context.name()).size());
+}
+
+BENCHMARK_FIXTURE(FormatFixture, "format_to_n()")
+{
+    context.metrics().AddBytes(format_to_n(chars, sizeof(chars), "test {}.{}.{} test", context.metrics().total_operations(), context.metrics().total_operations() / 1000.0, context.name()));
+}
+
+BENCHMARK_FIXTURE(FormatFixture, "Writer::Write(format())")
+{
+    context.metrics().AddBytes(writer.Write(CppCommon::format("test {}.{}.{} test", context.metrics().total_operations(), context.metrics().total_operations() / 1000.0, context.name())));
+}
+
+BENCHMARK_FIXTURE(FormatFixture, "print(Writer)")
+{
+    print(writer, "test {}.{}.{} test", context.metrics().total_operations(), context.metrics().total_operations() / 1000.0, context.name());
+}
+
+BENCHMARK("format_compiled(int, double, string)")
+{
+    context.metrics().AddBytes(format_compiled<"test {}.{}.{} test">(context.metrics().total_operations(), context.metrics().total_operations() / 1000.0, context.name()).size());
+}
+
+BENCHMARK_FIXTURE(FormatFixture, "format_compiled_to(memory_buffer)")
+{
+    buffer.clear();
+    format_compiled_to<"test {}.{}.{} test">(buffer, context.metrics().total_operations(), context.metrics().total_operations() / 1000.0, context.name());
+    context.metrics().AddBytes(buffer.size());
+}
+
+BENCHMARK_FIXTURE(FormatFixture, "format_compiled_to(char[])")
+{
+    context.metrics().AddBytes(format_compiled_to<"test {}.{}.{} test">(chars, context.metrics().total_operations(), context.metrics().total_operations() / 1000.0, context.name()).size());
+}
+
+BENCHMARK_FIXTURE(FormatFixture, "Formatter::format_to(memory_buffer)")
+{
+    buffer.clear();
+    formatter.format_to(buffer, context.metrics().total_operations(), context.metrics().total_operations() / 1000.0, context.name());
+    context.metrics().AddBytes(buffer.size());
+}
+
+BENCHMARK_REPORT_MAIN()
@@ -0,0 +1,212 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "benchmark_report.h"
+
+#include "string/glob_pattern.h"
+#include "string/string_utils.h"
+
+using namespace CppCommon;
+
+const uint64_t operations = 1000000;
+const size_t bytes_total = 256 * 1024 * 1024;
+const int size_from = 16;
+const int size_to = 1024 * 1024;
+const auto settings = CppBenchmark::Settings().ParamRange(size_from, size_to, [](int from, int to, int& result) { int r = result; result *= 8; return r; });
+const auto pattern_settings = CppBenchmark::Settings().ParamRange(size_from, 4096, [](int from, int to, int& result) { int r = result; result *= 4; return r; });
+
+class HeadersFixture
+{
+protected:
+    std::string headers;
+
+    HeadersFixture()
+    {
+        headers += "Host: www.example.com\r\n";
+        headers += "User-Agent: Mozilla/5.0 (X11; Linux x86_64) AppleWebKit/537.36 (KHTML, like Gecko) Chrome/120.0 Safari/537.36\r\n";
+        headers += "Accept: text/html,application/xhtml+xml,application/xml;q=0.9,image/avif,image/webp,*/*;q=0.8\r\n";
+        headers += "Accept-Language: en-US,en;q=0.5\r\n";
+        headers += "Accept-Encoding: gzip, deflate, br\r\n";
+        headers += "Connection: keep-alive\r\n";
+        headers += "Cookie: session=0123456789abcdef0123456789abcdef; theme=dark; language=en-US; tracking=disabled\r\n";
+        headers += "Upgrade-Insecure-Requests: 1\r\n";
+        headers += "Cache-Control: max-age=0\r\n";
+    }
+};
+
+BENCHMARK_FIXTURE(HeadersFixture, "StringUtils::Split()", operations)
+{
+    context.metrics().AddItems(StringUtils::Split(headers, "\r\n", true).size());
+    context.metrics().AddBytes(headers.size());
+}
+
+BENCHMARK_FIXTURE(HeadersFixture, "StringUtils::Split()-views", operations)
+{
+    static std::vector<std::string_view> tokens;
+    context.metrics().AddItems(StringUtils::Split(headers, "\r\n", tokens, true));
+    context.metrics().AddBytes(headers.size());
+}
+
+BENCHMARK_FIXTURE(HeadersFixture, "StringUtils::Tokenize()", operations)
+{
+    size_t count = 0;
+    for (auto line : StringUtils::Tokenize(headers, "\r\n", true))
+        count += StringUtils::Find(line, ':') != std::string::npos;
+    context.metrics().AddItems(count);
+    context.metrics().AddBytes(headers.size());
+}
+
+BENCHMARK_FIXTURE(HeadersFixture, "StringUtils::Contains()", operations)
+{
+    context.metrics().AddItems(StringUtils::Contains(headers, "Cache-Control: max-age") ? 1 : 0);
+    context.metrics().AddBytes(headers.size());
+}
+
+BENCHMARK_FIXTURE(HeadersFixture, "StringUtils::CountAll()", operations)
+{
+    context.metrics().AddItems(StringUtils::CountAll(headers, "\r\n"));
+    context.metrics().AddBytes(headers.size());
+}
+
+BENCHMARK_FIXTURE(HeadersFixture, "StringUtils::ReplaceAll()", operations)
+{
+    std::string str = headers;
+    StringUtils::ReplaceAll(str, "\r\n", "\n");
+    context.metrics().AddBytes(str.size());
+}
+
+BENCHMARK_FIXTURE(HeadersFixture, "StringUtils::Lower()", operations)
+{
+    std::string str = headers;
+    StringUtils::Lower(str);
+    context.metrics().AddBytes(str.size());
+}
+
+BENCHMARK_FIXTURE(HeadersFixture, "StringUtils::IsBlank()", operations)
+{
+    static std::string blank(headers.size(), ' ');
+    context.metrics().AddItems(StringUtils::IsBlank(blank) ? 1 : 0);
+    context.metrics().AddBytes(blank.size());
+}
+
+BENCHMARK_FIXTURE(HeadersFixture, "StringUtils::CompareNoCase()", operations)
+{
+    std::string_view name(headers.data(), 27);
+    context.metrics().AddItems(StringUtils::CompareNoCase(name, "HOST: WWW.EXAMPLE.COM\r\nUSER") ? 1 : 0);
+    context.metrics().AddBytes(name.size());
+}
+
+BENCHMARK_FIXTURE(HeadersFixture, "StringUtils::HashNoCase()", operations)
+{
+    context.metrics().AddItems(StringUtils::HashNoCase(headers) & 1);
+    context.metrics().AddBytes(headers.size());
+}
+
+class TextFixture
+{
+protected:
+    std::string text;
+    std::string upper;
+
+    TextFixture()
+    {
+        // Fill text with the comma separated mixed case words
+        static const char* words[] = { "Order", "symbol=EUR/USD", "side=BUY", "price=1.08250", "Comment", "limit", "" };
+        for (size_t i = 0; text.size() < size_to; ++i)
+        {
+            text += words[i % (sizeof(words) / sizeof(words[0]))];
+            text += ',';
+        }
+        text.resize(size_to);
+        upper = StringUtils::ToUpper(text);
+    }
+};
+
+template <typename TFunction>
+void measure(CppBenchmark::Context& context, TFunction function)
+{
+    const size_t size = context.x();
+    const size_t count = bytes_total / size;
+
+    uint64_t result = 0;
+    for (size_t i = 0; i < count; ++i)
+        result += function(size);
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(count - 1);
+    context.metrics().AddBytes(count * size);
+    context.metrics().SetCustom("CRC", result);
+}
+
+BENCHMARK_FIXTURE(TextFixture, "StringUtils::Split()-size", settings)
+{
+    measure(context, [this](size_t size) { return StringUtils::Split(std::string_view(text.data(), size), ',').size(); });
+}
+
+BENCHMARK_FIXTURE(TextFixture, "StringUtils::Split()-views-size", settings)
+{
+    std::vector<std::string_view> tokens;
+    measure(context, [this, &tokens](size_t size) { return StringUtils::Split(std::string_view(text.data(), size), ',', tokens); });
+}
+
+BENCHMARK_FIXTURE(TextFixture, "StringUtils::ReplaceAll()-size", settings)
+{
+    std::string str;
+    measure(context, [this, &str](size_t size) { str.assign(text.data(), size); return StringUtils::ReplaceAll(str, ",", ";;") ? str.size() : 0; });
+}
+
+BENCHMARK_FIXTURE(TextFixture, "StringUtils::ToLower()-size", settings)
+{
+    measure(context, [this](size_t size) { return (size_t)StringUtils::ToLower(std::string_view(text.data(), size)).back(); });
+}
+
+BENCHMARK_FIXTURE(TextFixture, "StringUtils::CompareNoCase()-size", settings)
+{
+    measure(context, [this](size_t size) { return StringUtils::CompareNoCase(std::string_view(text.data(), size), std::string_view(upper.data(), size)) ? 1 : 0; });
+}
+
+BENCHMARK_FIXTURE(TextFixture, "StringUtils::IsPatternMatch()-size", pattern_settings)
+{
+    // Subject size is limited, because std::regex matching recurses per character
+    measure(context, [this](size_t size) { return StringUtils::IsPatternMatch(".*price=[0-9.]+,.*", std::string(text.data(), size)) ? 1 : 0; });
+}
+
+BENCHMARK("StringUtils::IsPatternMatch()", operations / 100)
+{
+    context.metrics().AddItems(StringUtils::IsPatternMatch(".*\\.txt;.*\\.log;!debug.*", "application-2026-10-14.log") ? 1 : 0);
+}
+
+BENCHMARK("GlobPattern::Match()", operations)
+{
+    static const GlobPattern pattern("*.txt;*.log;!debug*");
+    context.metrics().AddItems(pattern.Match("application-2026-10-14.log") ? 1 : 0);
+}
+
+BENCHMARK("GlobPattern::Match()-segments", operations)
+{
+    static const GlobPattern pattern("app*-[0-9][0-9][0-9][0-9]-*.log");
+    context.metrics().AddItems(pattern.Match("application-2026-10-14.log") ? 1 : 0);
+}
+
+BENCHMARK("StringUtils::ToString()-integer", operations)
+{
+    context.metrics().AddBytes(StringUtils::ToString((int64_t)-1234567890123).size());
+}
+
+BENCHMARK("StringUtils::ToString()-double", operations)
+{
+    context.metrics().AddBytes(StringUtils::ToString(1234.5678).size());
+}
+
+BENCHMARK("StringUtils::FromString()-integer", operations)
+{
+    context.metrics().AddItems(StringUtils::FromString<int64_t>("-1234567890123") & 1);
+}
+
+BENCHMARK("StringUtils::FromString()-double", operations)
+{
+    context.metrics().AddItems(StringUtils::FromString<double>("1234.5678") > 0 ? 1 : 0);
+}
+
+BENCHMARK_REPORT_MAIN()
@@ -0,0 +1,206 @@
+//
+// Created by Ivan Shynkarenka on 15.10.2026
+//
+
+#include "system/cpu.h"
+#include "threads/thread.h"
+#include "time/timestamp.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace CppCommon;
+
+// Default count of round trips of the cache line per measurement
+const int default_round_trips = 100000;
+// Count of measurements of each pair of logical processors (the minimal one is taken)
+const int measurements = 3;
+
+// Relation of two logical processors in the CPU topology
+enum class Relation { SMT, L3, SOCKET, NODE, REMOTE };
+
+const char* RelationName(Relation relation)
+{
+    switch (relation)
+    {
+        case Relation::SMT: return "SMT";
+        case Relation::L3: return "L3";
+        case Relation::SOCKET: return "socket";
+        case Relation::NODE: return "NUMA node";
+        default: return "remote";
+    }
+}
+
+Relation GetRelation(const CPUTopology& topology, int cpu1, int cpu2)
+{
+    if (topology.Domain(cpu1, CPUDomain::CORE).test(cpu2))
+        return Relation::SMT;
+    if (topology.Domain(cpu1, CPUDomain::L3).test(cpu2))
+        return Relation::L3;
+    if (topology.Domain(cpu1, CPUDomain::SOCKET).test(cpu2))
+        return Relation::SOCKET;
+    if (topology.Domain(cpu1, CPUDomain::NODE).test(cpu2))
+        return Relation::NODE;
+    return Relation::REMOTE;
+}
+
+// Ping-pong the cache line between two logical processors and return the one-way latency in nanoseconds
+double PingPong(int cpu1, int cpu2, int round_trips)
+{
+    struct alignas(128) Line { std::atomic<uint64_t> value{0}; } line;
+
+    // Pong thread answers each odd value with the next even one
+    std::thread pong([&line, cpu2, round_trips]()
+    {
+        Thread::SetAffinity(CPUSet{ cpu2 });
+        for (uint64_t i = 1; i < (uint64_t)round_trips * 2; i += 2)
+        {
+            while (line.value.load(std::memory_order_acquire) != i)
+                continue;
+            line.value.store(i + 1, std::memory_order_release);
+        }
+    });
+
+    // Ping in the current thread pinned to the first logical processor
+    CPUSet affinity = Thread::GetAffinitySet();
+    Thread::SetAffinity(CPUSet{ cpu1 });
+
+    uint64_t timestamp = Timestamp::nano();
+    for (uint64_t i = 0; i < (uint64_t)round_trips * 2; i += 2)
+    {
+        line.value.store(i + 1, std::memory_order_release);
+        while (line.value.load(std::memory_order_acquire) != (i + 2))
+            continue;
+    }
+    uint64_t duration = Timestamp::nano() - timestamp;
+
+    pong.join();
+    Thread::SetAffinity(affinity);
+
+    return (double)duration / (round_trips * 2.0);
+}
+
+int main(int argc, char** argv)
+{
+    int round_trips = (argc > 1) ? std::max(1, std::atoi(argv[1])) : default_round_trips;
+
+    const CPUTopology& topology = CPU::Topology();
+    std::vector<int> cpus = Thread::GetAffinitySet().cpus();
+    const size_t count = cpus.size();
+
+    std::cout << "Logical processors: " << Thread::GetAffinitySet() << std::endl;
+    std::cout << "Physical cores: " << topology.cores() << std::endl;
+    std::cout << "Sockets: " << topology.sockets() << std::endl;
+    std::cout << "NUMA nodes: " << topology.nodes() << std::endl;
+    if (count < 2)
+    {
+        std::cout << "At least two logical processors are required to measure core-to-core latency!" << std::endl;
+        return 0;
+    }
+
+    // Print topology groups
+    for (auto domain : { CPUDomain::CORE, CPUDomain::L3, CPUDomain::NODE })
+    {
+        std::vector<CPUSet> groups;
+        for (int cpu : cpus)
+        {
+            CPUSet group = topology.Domain(cpu, domain) & Thread::GetAffinitySet();
+            if (group && (std::find(groups.begin(), groups.end(), group) == groups.end()))
+                groups.push_back(group);
+        }
+        std::cout << ((domain == CPUDomain::CORE) ? "SMT" : ((domain == CPUDomain::L3) ? "L3" : "NUMA")) << " groups:";
+        for (const auto& group : groups)
+            std::cout << " [" << group << "]";
+        std::cout << std::endl;
+    }
+    std::cout << std::endl;
+
+    // Measure latency of each pair of logical processors
+    std::vector<std::vector<double>> latency(count, std::vector<double>(count, 0.0));
+    for (size_t i = 0; i < count; ++i)
+    {
+        for (size_t j = i + 1; j < count; ++j)
+        {
+            double result = std::numeric_limits<double>::max();
+            for (int attempt = 0; attempt < measurements; ++attempt)
+                result = std::min(result, PingPong(cpus[i], cpus[j], round_trips));
+            latency[i][j] = latency[j][i] = result;
+        }
+    }
+
+    // Print the latency matrix
+    std::cout << "One-way core-to-core latency in nanoseconds:" << std::endl;
+    std::cout << std::setw(6) << "CPU";
+    for (size_t j = 0; j < count; ++j)
+        std::cout << std::setw(7) << cpus[j];
+    std::cout << std::endl;
+    for (size_t i = 0; i < count; ++i)
+    {
+        std::cout << std::setw(6) << cpus[i];
+        for (size_t j = 0; j < count; ++j)
+        {
+            if (i == j)
+                std::cout << std::setw(7) << "-";
+            else
+                std::cout << std::setw(7) << std::fixed << std::setprecision(1) << latency[i][j];
+        }
+        std::cout << std::endl;
+    }
+    std::cout << std::endl;
+
+    // Print latency summary by relations in the CPU topology
+    struct Summary { size_t pairs{0}; double min{std::numeric_limits<double>::max()}; double max{0.0}; double total{0.0}; };
+    std::vector<Summary> summary(5);
+    for (size_t i = 0; i < count; ++i)
+    {
+        for (size_t j = i + 1; j < count; ++j)
+        {
+            auto& item = summary[(size_t)GetRelation(topology, cpus[i], cpus[j])];
+            ++item.pairs;
+            item.min = std::min(item.min, latency[i][j]);
+            item.max = std::max(item.max, latency[i][j]);
+            item.total += latency[i][j];
+        }
+    }
+    std::cout << "Latency by topology:" << std::endl;
+    for (size_t i = 0; i < summary.size(); ++i)
+    {
+        if (summary[i].pairs == 0)
+            continue;
+        std::cout << std::setw(12) << RelationName((Relation)i) << ": pairs=" << summary[i].pairs
+                  << " min=" << summary[i].min << " avg=" << (summary[i].total / summary[i].pairs) << " max=" << summary[i].max << std::endl;
+    }
+    std::cout << std::endl;
+
+    // Suggest SPSC pairs: greedily take the fastest pairs of unused logical processors
+    std::vector<std::pair<size_t, size_t>> pairs;
+    for (size_t i = 0; i < count; ++i)
+        for (size_t j = i + 1; j < count; ++j)
+            pairs.emplace_back(i, j);
+    std::sort(pairs.begin(), pairs.end(), [&latency](const auto& p1, const auto& p2) { return latency[p1.first][p1.second] < latency[p2.first][p2.second]; });
+
+    std::vector<bool> used(count, false);
+    std::cout << "Suggested SPSC pairs (Pipeline::Start(CPUSet::Parse(\"<pair>\"))):" << std::endl;
+    for (const auto& pair : pairs)
+    {
+        if (used[pair.first] || used[pair.second])
+            continue;
+        used[pair.first] = used[pair.second] = true;
+        CPUSet set{ cpus[pair.first], cpus[pair.second] };
+        std::cout << std::setw(12) << set << ": " << latency[pair.first][pair.second] << " ns (" << RelationName(GetRelation(topology, cpus[pair.first], cpus[pair.second])) << ")" << std::endl;
+    }
+
+    // Suggest the pipeline CPU set: the fastest L3 group of the fastest pair
+    const auto& best = pairs.front();
+    CPUSet pipeline = topology.Domain(cpus[best.first], CPUDomain::L3) & Thread::GetAffinitySet();
+    std::cout << "Suggested pipeline CPU set (Pipeline::Start(CPUSet::Parse(\"<set>\"))): " << pipeline << std::endl;
+
+    return 0;
+}
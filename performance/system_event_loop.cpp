@@ -0,0 +1,45 @@
+//
+// Created by Ivan Shynkarenka on 15.10.2026
+//
+
+#include "benchmark_report.h"
+
+#include "system/event_loop.h"
+
+using namespace CppCommon;
+
+const uint64_t iterations = 1000000;
+
+BENCHMARK("EventLoop::Post()", iterations)
+{
+    static EventLoop loop;
+    static uint64_t called = 0;
+    loop.Post([]() { ++called; });
+    loop.Poll();
+}
+
+BENCHMARK("EventLoop::Schedule()", iterations)
+{
+    static EventLoop loop;
+    static uint64_t called = 0;
+    loop.Schedule(Timespan::zero(), []() { ++called; });
+    loop.Poll();
+}
+
+BENCHMARK("EventLoop::WatchRead()", iterations)
+{
+    static Pipe pipe;
+    static EventLoop loop;
+    static bool initialized = false;
+    if (!initialized)
+    {
+        pipe.SetBlocking(false);
+        loop.WatchRead(pipe, [](uint64_t) { uint8_t data; pipe.Read(&data, sizeof(data)); });
+        initialized = true;
+    }
+    uint8_t data = 0;
+    pipe.Write(&data, sizeof(data));
+    loop.Poll();
+}
+
+BENCHMARK_REPORT_MAIN()
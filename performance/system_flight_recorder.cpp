@@ -0,0 +1,21 @@
+//
+// Created by Ivan Shynkarenka on 15.10.2026
+//
+
+#include "benchmark_report.h"
+
+#include "system/flight_recorder.h"
+
+using namespace CppCommon;
+
+const uint64_t iterations = 10000000;
+
+BENCHMARK("FlightRecorder::Record()", iterations)
+{
+    static FlightRecorder recorder("flight_recorder_benchmark");
+    static uint32_t id = 0;
+    ++id;
+    recorder.Record(id, id);
+}
+
+BENCHMARK_REPORT_MAIN()
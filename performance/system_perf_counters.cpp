@@ -0,0 +1,89 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "benchmark_report.h"
+
+#include "system/perf_counters.h"
+
+#include <vector>
+
+using namespace CppCommon;
+
+const size_t items_count = 1 << 24;
+
+class PerfCountersFixture
+{
+protected:
+    std::vector<uint64_t> items;
+    PerfCounters counters;
+    PerfSample sample;
+
+    PerfCountersFixture() : items(items_count, 1) {}
+
+    // Report hardware performance counters per operation into benchmark metrics
+    void Report(CppBenchmark::Context& context, uint64_t operations)
+    {
+        if (!counters.IsAvailable())
+            return;
+
+        context.metrics().SetCustom("IPC", sample.ipc());
+        context.metrics().SetCustom("Cycles/op", (double)sample.cycles() / operations);
+        context.metrics().SetCustom("Instructions/op", (double)sample.instructions() / operations);
+        context.metrics().SetCustom("Cache-misses/op", (double)sample.cache_misses() / operations);
+        context.metrics().SetCustom("Branch-misses/op", (double)sample.branch_misses() / operations);
+    }
+};
+
+BENCHMARK_FIXTURE(PerfCountersFixture, "PerfCounters::Read()")
+{
+    const uint64_t operations = 1000000;
+    uint64_t crc = 0;
+
+    for (uint64_t i = 0; i < operations; ++i)
+        crc += counters.Read().cycles();
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(operations - 1);
+    context.metrics().SetCustom("CRC", crc);
+}
+
+BENCHMARK_FIXTURE(PerfCountersFixture, "Sequential-access")
+{
+    uint64_t crc = 0;
+
+    sample = PerfSample();
+    {
+        PerfRegion region(counters, sample);
+        for (size_t i = 0; i < items.size(); ++i)
+            crc += items[i];
+    }
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(items.size() - 1);
+    context.metrics().SetCustom("CRC", crc);
+    Report(context, items.size());
+}
+
+BENCHMARK_FIXTURE(PerfCountersFixture, "Random-access")
+{
+    uint64_t crc = 0;
+
+    sample = PerfSample();
+    {
+        PerfRegion region(counters, sample);
+        uint64_t index = 0;
+        for (size_t i = 0; i < items.size(); ++i)
+        {
+            index = (index * 6364136223846793005ull + 1442695040888963407ull) & (items.size() - 1);
+            crc += items[index];
+        }
+    }
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(items.size() - 1);
+    context.metrics().SetCustom("CRC", crc);
+    Report(context, items.size());
+}
+
+BENCHMARK_REPORT_MAIN()
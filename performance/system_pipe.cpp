@@ -2,8 +2,9 @@
 // Created by Ivan Shynkarenka on 30.11.2016
 //
 
-#include "benchmark/cppbenchmark.h"
+#include "benchmark_report.h"
 
+#include "filesystem/file.h"
 #include "system/pipe.h"
 
 #include <functional>
@@ -78,4 +79,95 @@ BENCHMARK("Pipe", settings)
     produce_consume(context);
 }
 
-BENCHMARK_MAIN()
+const uint64_t file_size = 67108864;
+const int chunk_size_from = 4096;
+const int chunk_size_to = 1048576;
+const auto transfer_settings = CppBenchmark::Settings().Attempts(3).ParamRange(chunk_size_from, chunk_size_to, [](int from, int to, int& result) { int r = result; result *= 4; return r; });
+
+class TransferFixture
+{
+protected:
+    File source;
+    File target;
+
+    TransferFixture() : source("pipe-source.tmp"), target("pipe-target.tmp")
+    {
+        std::vector<uint8_t> buffer(chunk_size_to);
+        for (size_t i = 0; i < buffer.size(); ++i)
+            buffer[i] = (uint8_t)i;
+
+        source.Create(false, true);
+        for (uint64_t i = 0; i < file_size / buffer.size(); ++i)
+            source.Write(buffer.data(), buffer.size());
+        source.Close();
+    }
+
+    ~TransferFixture()
+    {
+        File::Remove(source);
+        File::Remove(target);
+    }
+};
+
+BENCHMARK_FIXTURE(TransferFixture, "Pipe::Read()/Write()", transfer_settings)
+{
+    const size_t chunk = context.x();
+
+    source.Open(true, false, false, File::DEFAULT_ATTRIBUTES, File::DEFAULT_PERMISSIONS, 0);
+    target.Create(false, true, File::DEFAULT_ATTRIBUTES, File::DEFAULT_PERMISSIONS, 0);
+
+    // Copy file data through the user space buffers
+    Pipe pipe(chunk_size_to);
+    auto producer = std::thread([this, &pipe, chunk]()
+    {
+        std::vector<uint8_t> buffer(chunk);
+        size_t size;
+        while ((size = source.Read(buffer.data(), buffer.size())) > 0)
+            pipe.Write(buffer.data(), size);
+        pipe.CloseWrite();
+    });
+
+    std::vector<uint8_t> buffer(chunk);
+    uint64_t total = 0;
+    size_t size;
+    while ((size = pipe.Read(buffer.data(), buffer.size())) > 0)
+        total += target.Write(buffer.data(), size);
+
+    producer.join();
+    source.Close();
+    target.Close();
+
+    context.metrics().AddBytes(total);
+}
+
+BENCHMARK_FIXTURE(TransferFixture, "Pipe::TransferFrom()/TransferTo()", transfer_settings)
+{
+    const size_t chunk = context.x();
+
+    source.Open(true, false);
+    target.Create(false, true);
+
+    // Move file data between page caches with splice()
+    Pipe pipe(chunk_size_to);
+    auto producer = std::thread([this, &pipe, chunk]()
+    {
+        uint64_t offset = 0;
+        size_t size;
+        while ((size = pipe.TransferFrom(source, offset, chunk)) > 0)
+            offset += size;
+        pipe.CloseWrite();
+    });
+
+    uint64_t total = 0;
+    size_t size;
+    while ((size = pipe.TransferTo(target, total, chunk)) > 0)
+        total += size;
+
+    producer.join();
+    source.Close();
+    target.Close();
+
+    context.metrics().AddBytes(total);
+}
+
+BENCHMARK_REPORT_MAIN()
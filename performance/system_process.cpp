@@ -0,0 +1,71 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "benchmark_report.h"
+
+#include "system/process.h"
+
+#include <cstring>
+#include <vector>
+
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+using namespace CppCommon;
+
+// Resident memory of the parent process in megabytes
+const int resident_from = 1;
+const int resident_to = 1024;
+const auto settings = CppBenchmark::Settings().ParamRange(resident_from, resident_to, [](int from, int to, int& result) { int r = result; result *= 4; return r; });
+
+#if defined(_WIN32) || defined(_WIN64)
+const char* command = "cmd.exe";
+const std::vector<std::string> arguments = { "/c", "exit" };
+#else
+const char* command = "true";
+const std::vector<std::string> arguments;
+#endif
+
+// Touch the given amount of the parent memory to populate its page tables
+void resident(size_t megabytes)
+{
+    static std::vector<uint8_t> memory;
+    size_t size = megabytes * 1024 * 1024;
+    if (memory.size() != size)
+    {
+        memory = std::vector<uint8_t>(size);
+        std::memset(memory.data(), 0xFF, memory.size());
+    }
+}
+
+BENCHMARK("Process::Execute", settings)
+{
+    resident(context.x());
+
+    Process child = Process::Execute(command, &arguments);
+    child.Wait();
+}
+
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+
+BENCHMARK("fork() + execvp()", settings)
+{
+    resident(context.x());
+
+    pid_t pid = fork();
+    if (pid == 0)
+    {
+        char* argv[] = { (char*)command, nullptr };
+        execvp(argv[0], argv);
+        _exit(666);
+    }
+    int status;
+    waitpid(pid, &status, 0);
+}
+
+#endif
+
+BENCHMARK_REPORT_MAIN()
@@ -0,0 +1,30 @@
+//
+// Created by Ivan Shynkarenka on 15.10.2026
+//
+
+#include "benchmark_report.h"
+
+#include "system/resource_usage.h"
+
+using namespace CppCommon;
+
+BENCHMARK("ResourceUsage::CurrentProcess()")
+{
+    static volatile uint64_t result;
+    result = ResourceUsage::CurrentProcess().minor_faults;
+}
+
+BENCHMARK("ResourceUsage::CurrentThread()")
+{
+    static volatile uint64_t result;
+    result = ResourceUsage::CurrentThread().minor_faults;
+}
+
+BENCHMARK("ResourceUsageSampler::Sample()")
+{
+    static ResourceUsageSampler sampler;
+    static volatile uint64_t result;
+    result = sampler.Sample().minor_faults;
+}
+
+BENCHMARK_REPORT_MAIN()
@@ -2,7 +2,7 @@
 // Created by Ivan Shynkarenka on 15.02.2016
 //
 
-#include "benchmark/cppbenchmark.h"
+#include "benchmark_report.h"
 
 #include "system/stack_trace.h"
 
@@ -10,7 +10,46 @@ using namespace CppCommon;
 
 const uint64_t operations = 1000000;
 
-BENCHMARK("StackTrace")
+BENCHMARK("StackTrace::Capture()")
+{
+    uint64_t crc = 0;
+
+    void* frames[64];
+    for (uint64_t i = 0; i < operations; ++i)
+        crc += StackTrace::Capture(frames, 64);
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(operations - 1);
+    context.metrics().SetCustom("CRC", crc);
+}
+
+BENCHMARK("StackTrace()-capture")
+{
+    uint64_t crc = 0;
+
+    for (uint64_t i = 0; i < operations; ++i)
+        crc += StackTrace().addresses().size();
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(operations - 1);
+    context.metrics().SetCustom("CRC", crc);
+}
+
+BENCHMARK("StackTrace()-resolve")
+{
+    uint64_t crc = 0;
+
+    // Resolve symbols of the same captured frames using the symbol cache
+    StackTrace trace;
+    for (uint64_t i = 0; i < operations; ++i)
+        crc += StackTrace(trace.addresses().data(), trace.addresses().size()).frames().size();
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(operations - 1);
+    context.metrics().SetCustom("CRC", crc);
+}
+
+BENCHMARK("StackTrace()")
 {
     uint64_t crc = 0;
 
@@ -22,4 +61,4 @@ BENCHMARK("StackTrace")
     context.metrics().SetCustom("CRC", crc);
 }
 
-BENCHMARK_MAIN()
+BENCHMARK_REPORT_MAIN()
@@ -0,0 +1,44 @@
+//
+// Created by Ivan Shynkarenka on 15.10.2026
+//
+
+#include "benchmark_report.h"
+
+#include "filesystem/path.h"
+#include "system/tracer.h"
+
+using namespace CppCommon;
+
+const uint64_t iterations = 10000000;
+
+BENCHMARK("TRACE_SCOPE-stopped")
+{
+    for (uint64_t i = 0; i < iterations; ++i)
+    {
+        TRACE_SCOPE("Span");
+    }
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(iterations - 1);
+}
+
+BENCHMARK("TRACE_SCOPE-started")
+{
+    Path path = Path::temp() / Path::unique();
+
+    Tracer::Start(path, TraceFormat::PERFETTO, 1 << 20, Timespan::milliseconds(1));
+    for (uint64_t i = 0; i < iterations; ++i)
+    {
+        TRACE_SCOPE("Span");
+    }
+    Tracer::Stop();
+
+    Path::Remove(path);
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(iterations - 1);
+    context.metrics().SetCustom("Written", Tracer::written());
+    context.metrics().SetCustom("Dropped", Tracer::dropped());
+}
+
+BENCHMARK_REPORT_MAIN()
@@ -2,10 +2,12 @@
 // Created by Ivan Shynkarenka on 19.08.2016
 //
 
-#include "benchmark/cppbenchmark.h"
+#include "benchmark_report.h"
 
 #include "system/uuid.h"
 
+#include <string>
+
 using namespace CppCommon;
 
 BENCHMARK("UUID::Nil()")
@@ -23,4 +25,41 @@ BENCHMARK("UUID::Random()")
     UUID::Random();
 }
 
-BENCHMARK_MAIN()
+BENCHMARK("UUID::Random()-bulk")
+{
+    UUID uuids[64];
+    UUID::Random(uuids, 64);
+    context.metrics().AddItems(64);
+}
+
+BENCHMARK("UUID::Sortable()")
+{
+    UUID::Sortable();
+}
+
+BENCHMARK("UUID::Secure()")
+{
+    UUID::Secure();
+}
+
+BENCHMARK("UUID::string()")
+{
+    static UUID uuid = UUID::Random();
+    context.metrics().AddBytes(uuid.string().size());
+}
+
+BENCHMARK("UUID::ToChars()")
+{
+    static UUID uuid = UUID::Random();
+    char buffer[36];
+    context.metrics().AddBytes(uuid.ToChars(buffer) - buffer);
+}
+
+BENCHMARK("UUID::UUID(string)")
+{
+    static std::string uuid = UUID::Random().string();
+    UUID parsed(uuid);
+    context.metrics().AddBytes(uuid.size());
+}
+
+BENCHMARK_REPORT_MAIN()
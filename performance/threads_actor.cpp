@@ -0,0 +1,64 @@
+//
+// Created by Ivan Shynkarenka on 15.10.2026
+//
+
+#include "benchmark_report.h"
+
+#include "threads/actor.h"
+
+#include <memory>
+#include <vector>
+
+using namespace CppCommon;
+
+const uint64_t messages_to_send = 10000000;
+const int actors_from = 1;
+const int actors_to = 1000000;
+const auto settings = CppBenchmark::Settings().ParamRange(actors_from, actors_to, [](int from, int to, int& result) { int r = result; result *= 100; return r; });
+
+class Accumulator : public Actor<uint64_t>
+{
+public:
+    uint64_t crc = 0;
+
+    using Actor<uint64_t>::Actor;
+
+protected:
+    void OnMessage(uint64_t& message) override { crc += message; }
+};
+
+BENCHMARK("Actor-send", settings)
+{
+    const int actors_count = context.x();
+
+    // Thread pool capacity must be enough to schedule all actors at once
+    size_t capacity = 4096;
+    while (capacity < (size_t)actors_count)
+        capacity *= 2;
+
+    auto pool = std::make_unique<ThreadPool>(0, ThreadPoolAffinity::NONE, capacity);
+    ActorSystem<uint64_t> system(*pool, 64, 65536);
+
+    std::vector<std::unique_ptr<Accumulator>> actors;
+    actors.reserve(actors_count);
+    for (int i = 0; i < actors_count; ++i)
+        actors.emplace_back(std::make_unique<Accumulator>(system));
+
+    // Send messages to actors in round-robin order
+    for (uint64_t i = 0; i < messages_to_send; ++i)
+        while (!actors[i % actors_count]->Send(i));
+
+    // Process all pending messages
+    pool.reset();
+
+    uint64_t crc = 0;
+    for (auto& actor : actors)
+        crc += actor->crc;
+
+    // Update benchmark metrics
+    context.metrics().AddItems(messages_to_send);
+    context.metrics().AddBytes(messages_to_send * sizeof(uint64_t));
+    context.metrics().SetCustom("CRC", crc);
+}
+
+BENCHMARK_REPORT_MAIN()
@@ -0,0 +1,133 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "benchmark_report.h"
+
+#include "threads/barrier.h"
+#include "threads/spin_barrier.h"
+#include "threads/tree_barrier.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace CppCommon;
+
+const uint64_t phases_to_pass = 100000;
+const int threads_from = 1;
+const int threads_to = 64;
+const auto settings = CppBenchmark::Settings().ParamRange(threads_from, threads_to, [](int from, int to, int& result) { int r = result; result *= 2; return r; });
+
+// Barrier adapters with the common phase synchronization interface
+struct BarrierAdapter
+{
+    Barrier barrier;
+    explicit BarrierAdapter(int threads) : barrier(threads) {}
+    bool Wait(int thread) { return barrier.Wait(); }
+};
+
+struct SpinBarrierAdapter
+{
+    SpinBarrier barrier;
+    explicit SpinBarrierAdapter(int threads) : barrier(threads) {}
+    bool Wait(int thread) { return barrier.Wait(); }
+};
+
+struct TreeBarrierAdapter
+{
+    TreeBarrier barrier;
+    explicit TreeBarrierAdapter(int threads) : barrier(threads) {}
+    bool Wait(int thread) { return barrier.Wait(thread); }
+};
+
+template <class TBarrier>
+void synchronize(CppBenchmark::Context& context)
+{
+    const int threads_count = context.x();
+    std::atomic<uint64_t> crc(0);
+
+    // Create barrier synchronization primitive
+    TBarrier barrier(threads_count);
+
+    // Start phase synchronous threads
+    std::vector<std::thread> threads;
+    for (int thread = 0; thread < threads_count; ++thread)
+    {
+        threads.emplace_back([&barrier, &crc, thread]()
+        {
+            uint64_t last = 0;
+            for (uint64_t i = 0; i < phases_to_pass; ++i)
+                if (barrier.Wait(thread))
+                    ++last;
+            crc += last;
+        });
+    }
+
+    // Wait for all threads
+    for (auto& thread : threads)
+        thread.join();
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(phases_to_pass - 1);
+    context.metrics().AddItems(phases_to_pass * threads_count);
+    context.metrics().SetCustom("CRC", crc.load());
+}
+
+void synchronize_split(CppBenchmark::Context& context)
+{
+    const int threads_count = context.x();
+    std::atomic<uint64_t> crc(0);
+
+    // Create combining tree spin barrier synchronization primitive
+    TreeBarrier barrier(threads_count);
+
+    // Start phase synchronous threads which overlap the barrier with independent work
+    std::vector<std::thread> threads;
+    for (int thread = 0; thread < threads_count; ++thread)
+    {
+        threads.emplace_back([&barrier, &crc, thread]()
+        {
+            uint64_t work = 0;
+            for (uint64_t i = 0; i < phases_to_pass; ++i)
+            {
+                auto token = barrier.Arrive(thread);
+                while (!barrier.IsReady(token))
+                    ++work;
+                barrier.Wait(token);
+            }
+            crc += work;
+        });
+    }
+
+    // Wait for all threads
+    for (auto& thread : threads)
+        thread.join();
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(phases_to_pass - 1);
+    context.metrics().AddItems(phases_to_pass * threads_count);
+    context.metrics().SetCustom("CRC", crc.load());
+}
+
+BENCHMARK("Barrier", settings)
+{
+    synchronize<BarrierAdapter>(context);
+}
+
+BENCHMARK("SpinBarrier", settings)
+{
+    synchronize<SpinBarrierAdapter>(context);
+}
+
+BENCHMARK("TreeBarrier", settings)
+{
+    synchronize<TreeBarrierAdapter>(context);
+}
+
+BENCHMARK("TreeBarrier-split-phase", settings)
+{
+    synchronize_split(context);
+}
+
+BENCHMARK_REPORT_MAIN()
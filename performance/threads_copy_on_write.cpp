@@ -0,0 +1,137 @@
+//
+// Created by Ivan Shynkarenka on 15.10.2026
+//
+
+#include "benchmark_report.h"
+
+#include "containers/hashmap.h"
+#include "threads/copy_on_write.h"
+#include "threads/locker.h"
+#include "threads/rw_lock.h"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+using namespace CppCommon;
+
+const uint64_t items_to_read = 10000000;
+const uint64_t routes_count = 10000;
+const int readers_from = 1;
+const int readers_to = 32;
+const auto settings = CppBenchmark::Settings().ParamRange(readers_from, readers_to, [](int from, int to, int& result) { int r = result; result *= 2; return r; });
+
+typedef HashMap<uint64_t, uint64_t> Routes;
+
+// Routing table guarded by the read-write lock
+class LockedRoutes
+{
+public:
+    LockedRoutes() : _routes(routes_count * 2, (uint64_t)-1) { for (uint64_t i = 0; i < routes_count; ++i) _routes.emplace(i, i); }
+
+    uint64_t Route(uint64_t key) const
+    {
+        ReadLocker<RWLock> locker(_lock);
+        auto it = _routes.find(key);
+        return (it != _routes.end()) ? it->second : 0;
+    }
+
+    void Update(uint64_t key, uint64_t value)
+    {
+        WriteLocker<RWLock> locker(_lock);
+        _routes[key] = value;
+    }
+
+private:
+    mutable RWLock _lock;
+    Routes _routes;
+};
+
+// Routing table published as copy-on-write snapshots
+class PublishedRoutes
+{
+public:
+    PublishedRoutes() : _routes(routes_count * 2, (uint64_t)-1) { _routes.Modify([](Routes& routes) { for (uint64_t i = 0; i < routes_count; ++i) routes.emplace(i, i); }); }
+
+    uint64_t Route(uint64_t key) const
+    {
+        return _routes.Visit([key](const Routes& routes)
+        {
+            auto it = routes.find(key);
+            return (it != routes.end()) ? it->second : 0;
+        });
+    }
+
+    void Update(uint64_t key, uint64_t value)
+    {
+        _routes.Modify([key, value](Routes& routes) { routes[key] = value; });
+    }
+
+private:
+    CopyOnWrite<Routes> _routes;
+};
+
+template <class TRoutes>
+void produce(CppBenchmark::Context& context)
+{
+    const int readers_count = context.x();
+    std::atomic<bool> done(false);
+    std::atomic<uint64_t> readers_crc(0);
+    std::atomic<uint64_t> updates(0);
+
+    // Create routing table
+    TRoutes routes;
+
+    // Start readers threads
+    std::vector<std::thread> readers;
+    for (int reader = 0; reader < readers_count; ++reader)
+    {
+        readers.emplace_back([&routes, &readers_crc, reader, readers_count]()
+        {
+            uint64_t crc = 0;
+            uint64_t items = (items_to_read / readers_count);
+            for (uint64_t i = 0; i < items; ++i)
+                crc += routes.Route(((reader * items) + i) % routes_count);
+            readers_crc += crc;
+        });
+    }
+
+    // Start rare updates writer thread
+    std::thread writer = std::thread([&routes, &done, &updates]()
+    {
+        uint64_t count = 0;
+        while (!done.load(std::memory_order_relaxed))
+        {
+            routes.Update(count % routes_count, count);
+            ++count;
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        updates += count;
+    });
+
+    // Wait for all readers threads
+    for (auto& reader : readers)
+        reader.join();
+
+    // Wait for the writer thread
+    done = true;
+    writer.join();
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(items_to_read - 1);
+    context.metrics().SetCustom("CRC-Readers", readers_crc.load());
+    context.metrics().SetCustom("Updates", updates.load());
+}
+
+BENCHMARK("HashMap + RWLock", settings)
+{
+    produce<LockedRoutes>(context);
+}
+
+BENCHMARK("CopyOnWrite<HashMap>", settings)
+{
+    produce<PublishedRoutes>(context);
+}
+
+BENCHMARK_REPORT_MAIN()
@@ -0,0 +1,115 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "benchmark_report.h"
+
+#include "threads/coroutine.h"
+#include "threads/latch.h"
+#include "threads/thread_pool.h"
+#include "threads/wait_queue.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace CppCommon;
+
+#if defined(CPPCOMMON_COROUTINES)
+
+const uint64_t items_to_produce = 1000000;
+const int consumers_from = 1;
+const int consumers_to = 1024;
+const auto settings = CppBenchmark::Settings().ParamRange(consumers_from, consumers_to, [](int from, int to, int& result) { int r = result; result *= 4; return r; });
+
+template <class TScheduler>
+CoroutineTask<> consume(WaitQueue<uint64_t>& queue, TScheduler& scheduler, std::atomic<uint64_t>& crc, Latch& latch)
+{
+    uint64_t result = 0;
+
+    // Dequeue the item or end consume
+    uint64_t item;
+    while (co_await queue.DequeueAsync(item, scheduler))
+        result += item;
+
+    crc += result;
+    latch.CountDown();
+}
+
+void produce(WaitQueue<uint64_t>& queue)
+{
+    for (uint64_t i = 0; i < items_to_produce; ++i)
+    {
+        // Enqueue the item or end produce
+        if (!queue.Enqueue(i))
+            break;
+    }
+
+    // Wait until all items are consumed and close the wait queue
+    while (!queue.empty())
+        std::this_thread::yield();
+    queue.Close();
+}
+
+BENCHMARK("WaitQueue-consumer-threads", settings)
+{
+    const int consumers_count = context.x();
+    std::atomic<uint64_t> crc(0);
+
+    // Create multiple producers / multiple consumers wait queue
+    WaitQueue<uint64_t> queue;
+
+    // Start consumer threads
+    std::vector<std::thread> consumers;
+    for (int consumer = 0; consumer < consumers_count; ++consumer)
+    {
+        consumers.emplace_back([&queue, &crc]()
+        {
+            uint64_t result = 0;
+            uint64_t item;
+            while (queue.Dequeue(item))
+                result += item;
+            crc += result;
+        });
+    }
+
+    produce(queue);
+
+    // Wait for all consumer threads
+    for (auto& consumer : consumers)
+        consumer.join();
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(items_to_produce - 1);
+    context.metrics().AddItems(items_to_produce);
+    context.metrics().SetCustom("CRC", crc.load());
+}
+
+BENCHMARK("WaitQueue-consumer-coroutines", settings)
+{
+    const int consumers_count = context.x();
+    std::atomic<uint64_t> crc(0);
+    Latch latch(consumers_count);
+
+    // Create multiple producers / multiple consumers wait queue
+    WaitQueue<uint64_t> queue;
+
+    // Spawn consumer coroutines in a couple of worker threads
+    ThreadPool pool(2);
+    for (int consumer = 0; consumer < consumers_count; ++consumer)
+        consume(queue, pool, crc, latch).Spawn(pool);
+
+    produce(queue);
+
+    // Wait for all consumer coroutines
+    latch.Wait();
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(items_to_produce - 1);
+    context.metrics().AddItems(items_to_produce);
+    context.metrics().SetCustom("CRC", crc.load());
+}
+
+#endif
+
+BENCHMARK_REPORT_MAIN()
@@ -2,7 +2,7 @@
 // Created by Ivan Shynkarenka on 28.01.2016
 //
 
-#include "benchmark/cppbenchmark.h"
+#include "benchmark_report.h"
 
 #include "threads/critical_section.h"
 
@@ -53,4 +53,4 @@ BENCHMARK("CriticalSection", settings)
     produce(context);
 }
 
-BENCHMARK_MAIN()
+BENCHMARK_REPORT_MAIN()
@@ -0,0 +1,165 @@
+//
+// Created by Ivan Shynkarenka on 15.10.2026
+//
+
+#include "benchmark_report.h"
+
+#include "threads/disruptor.h"
+#include "threads/wait_ring.h"
+
+#include <functional>
+#include <thread>
+#include <vector>
+
+using namespace CppCommon;
+
+const uint64_t items_to_produce = 10000000;
+const int producers_from = 1;
+const int producers_to = 8;
+const auto settings = CppBenchmark::Settings().ParamRange(producers_from, producers_to, [](int from, int to, int& result) { int r = result; result *= 2; return r; });
+
+template<typename T, uint64_t N>
+void produce_multicast(CppBenchmark::Context& context)
+{
+    const int producers_count = context.x();
+    uint64_t crcs[3] = { 0, 0, 0 };
+
+    // Create disruptor with journaler, replicator and business logic consumers
+    Disruptor<T> disruptor(N);
+    auto& journaler = disruptor.AddConsumer();
+    auto& replicator = disruptor.AddConsumer();
+    auto& logic = disruptor.AddConsumer({ &journaler });
+
+    // Start consumers threads
+    std::vector<std::thread> consumers;
+    consumers.emplace_back([&disruptor, &journaler, &crcs]()
+    {
+        while (disruptor.Consume(journaler, [&crcs](T& item, uint64_t sequence, bool end_of_batch) { crcs[0] += item; }) > 0);
+    });
+    consumers.emplace_back([&disruptor, &replicator, &crcs]()
+    {
+        while (disruptor.Consume(replicator, [&crcs](T& item, uint64_t sequence, bool end_of_batch) { crcs[1] += item; }) > 0);
+    });
+    consumers.emplace_back([&disruptor, &logic, &crcs]()
+    {
+        while (disruptor.Consume(logic, [&crcs](T& item, uint64_t sequence, bool end_of_batch) { crcs[2] += item; }) > 0);
+    });
+
+    // Start producer threads
+    std::vector<std::thread> producers;
+    for (int producer = 0; producer < producers_count; ++producer)
+    {
+        producers.emplace_back([&disruptor, producer, producers_count]()
+        {
+            uint64_t items = (items_to_produce / producers_count);
+            for (uint64_t i = 0; i < items; ++i)
+            {
+                // Enqueue the item or end produce
+                if (!disruptor.Enqueue((T)(items * producer + i)))
+                    break;
+            }
+        });
+    }
+
+    // Wait for all producers threads
+    for (auto& producer : producers)
+        producer.join();
+
+    // Close the disruptor
+    disruptor.Close();
+
+    // Wait for consumers threads
+    for (auto& consumer : consumers)
+        consumer.join();
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(items_to_produce - 1);
+    context.metrics().AddItems(items_to_produce);
+    context.metrics().AddBytes(items_to_produce * sizeof(T));
+    context.metrics().SetCustom("Disruptor.capacity", N);
+    context.metrics().SetCustom("CRC", crcs[0] + crcs[1] + crcs[2]);
+}
+
+template<typename T, uint64_t N>
+void produce_copies(CppBenchmark::Context& context)
+{
+    const int producers_count = context.x();
+    uint64_t crcs[3] = { 0, 0, 0 };
+
+    // Create a separate wait ring for each consumer and chain the business logic after the journaler
+    WaitRing<T> journal_ring(N);
+    WaitRing<T> replica_ring(N);
+    WaitRing<T> logic_ring(N);
+
+    // Start consumers threads
+    std::vector<std::thread> consumers;
+    consumers.emplace_back([&journal_ring, &logic_ring, &crcs]()
+    {
+        T item;
+        while (journal_ring.Dequeue(item))
+        {
+            crcs[0] += item;
+            logic_ring.Enqueue(item);
+        }
+        logic_ring.Close();
+    });
+    consumers.emplace_back([&replica_ring, &crcs]()
+    {
+        T item;
+        while (replica_ring.Dequeue(item))
+            crcs[1] += item;
+    });
+    consumers.emplace_back([&logic_ring, &crcs]()
+    {
+        T item;
+        while (logic_ring.Dequeue(item))
+            crcs[2] += item;
+    });
+
+    // Start producer threads
+    std::vector<std::thread> producers;
+    for (int producer = 0; producer < producers_count; ++producer)
+    {
+        producers.emplace_back([&journal_ring, &replica_ring, producer, producers_count]()
+        {
+            uint64_t items = (items_to_produce / producers_count);
+            for (uint64_t i = 0; i < items; ++i)
+            {
+                // Enqueue copies of the item or end produce
+                if (!journal_ring.Enqueue((T)(items * producer + i)) || !replica_ring.Enqueue((T)(items * producer + i)))
+                    break;
+            }
+        });
+    }
+
+    // Wait for all producers threads
+    for (auto& producer : producers)
+        producer.join();
+
+    // Close wait rings
+    journal_ring.Close();
+    replica_ring.Close();
+
+    // Wait for consumers threads
+    for (auto& consumer : consumers)
+        consumer.join();
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(items_to_produce - 1);
+    context.metrics().AddItems(items_to_produce);
+    context.metrics().AddBytes(items_to_produce * sizeof(T));
+    context.metrics().SetCustom("WaitRing.capacity", N);
+    context.metrics().SetCustom("CRC", crcs[0] + crcs[1] + crcs[2]);
+}
+
+BENCHMARK("Disruptor-producers", settings)
+{
+    produce_multicast<int, 1048576>(context);
+}
+
+BENCHMARK("WaitRing-copies-producers", settings)
+{
+    produce_copies<int, 1048576>(context);
+}
+
+BENCHMARK_REPORT_MAIN()
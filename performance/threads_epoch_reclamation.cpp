@@ -0,0 +1,128 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "benchmark_report.h"
+
+#include "threads/epoch_reclamation.h"
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <thread>
+#include <vector>
+
+using namespace CppCommon;
+
+const uint64_t items_to_read = 10000000;
+const uint64_t items_to_swap = 10000;
+const int readers_from = 1;
+const int readers_to = 32;
+const auto settings = CppBenchmark::Settings().ParamRange(readers_from, readers_to, [](int from, int to, int& result) { int r = result; result *= 2; return r; });
+
+struct Config
+{
+    uint64_t a;
+    uint64_t b;
+};
+
+// Readers copy the shared pointer of the current config snapshot under the shared lock
+void produce_shared_ptr(CppBenchmark::Context& context)
+{
+    const int readers_count = context.x();
+    std::atomic<uint64_t> crc(0);
+
+    std::shared_mutex lock;
+    std::shared_ptr<Config> config = std::make_shared<Config>(Config{ 0, 0 });
+
+    // Start readers threads
+    std::vector<std::thread> readers;
+    for (int reader = 0; reader < readers_count; ++reader)
+    {
+        readers.emplace_back([&lock, &config, &crc, readers_count]()
+        {
+            uint64_t result = 0;
+            for (uint64_t i = 0; i < (items_to_read / readers_count); ++i)
+            {
+                std::shared_ptr<Config> current;
+                {
+                    std::shared_lock<std::shared_mutex> locker(lock);
+                    current = config;
+                }
+                result += current->a + current->b;
+            }
+            crc += result;
+        });
+    }
+
+    // Swap config snapshots
+    for (uint64_t i = 1; i <= items_to_swap; ++i)
+    {
+        std::shared_ptr<Config> next = std::make_shared<Config>(Config{ i, i });
+        std::unique_lock<std::shared_mutex> locker(lock);
+        config.swap(next);
+    }
+
+    // Wait for all readers threads
+    for (auto& reader : readers)
+        reader.join();
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(items_to_read - 1);
+    context.metrics().SetCustom("CRC", crc.load());
+}
+
+// Readers access the current config snapshot inside the epoch critical section
+void produce_epoch(CppBenchmark::Context& context)
+{
+    const int readers_count = context.x();
+    std::atomic<uint64_t> crc(0);
+
+    EpochReclamation domain;
+    std::atomic<Config*> config(new Config{ 0, 0 });
+
+    // Start readers threads
+    std::vector<std::thread> readers;
+    for (int reader = 0; reader < readers_count; ++reader)
+    {
+        readers.emplace_back([&domain, &config, &crc, readers_count]()
+        {
+            uint64_t result = 0;
+            for (uint64_t i = 0; i < (items_to_read / readers_count); ++i)
+            {
+                EpochReclamation::Guard guard(domain);
+                Config* current = config.load(std::memory_order_acquire);
+                result += current->a + current->b;
+            }
+            crc += result;
+        });
+    }
+
+    // Swap config snapshots
+    for (uint64_t i = 1; i <= items_to_swap; ++i)
+        domain.Retire(config.exchange(new Config{ i, i }, std::memory_order_acq_rel));
+
+    // Wait for all readers threads
+    for (auto& reader : readers)
+        reader.join();
+
+    domain.Synchronize();
+    delete config.load();
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(items_to_read - 1);
+    context.metrics().SetCustom("CRC", crc.load());
+}
+
+BENCHMARK("SharedPtr-snapshot", settings)
+{
+    produce_shared_ptr(context);
+}
+
+BENCHMARK("EpochReclamation-snapshot", settings)
+{
+    produce_epoch(context);
+}
+
+BENCHMARK_REPORT_MAIN()
@@ -2,7 +2,7 @@
 // Created by Ivan Shynkarenka on 02.09.2016
 //
 
-#include "benchmark/cppbenchmark.h"
+#include "benchmark_report.h"
 
 #include "threads/file_lock.h"
 
@@ -77,9 +77,77 @@ void produce(CppBenchmark::Context& context)
     context.metrics().SetCustom("CRC-Writers", writers_crc);
 }
 
+void produce_ranges(CppBenchmark::Context& context)
+{
+    const int readers_count = context.x();
+    const int writers_count = context.y();
+    const uint64_t range_size = 4096;
+    uint64_t readers_crc = 0;
+    uint64_t writers_crc = 0;
+
+    // Create file-lock synchronization primitive
+    FileLock lock_master(".lock");
+
+    // Start readers threads which share the same byte ranges
+    std::vector<std::thread> readers;
+    for (int reader = 0; reader < readers_count; ++reader)
+    {
+        readers.emplace_back([&readers_crc, reader, readers_count, range_size]()
+        {
+            FileLock lock_slave(".lock");
+
+            uint64_t items = (items_to_produce / readers_count);
+            for (uint64_t i = 0; i < items; ++i)
+            {
+                uint64_t offset = (i % 16) * range_size;
+                lock_slave.LockRange(offset, range_size, true);
+                readers_crc += (reader * items) + i;
+                lock_slave.UnlockRange(offset, range_size, true);
+            }
+        });
+    }
+
+    // Start writers threads which exclusively lock their own byte ranges after readers ones
+    std::vector<std::thread> writers;
+    for (int writer = 0; writer < writers_count; ++writer)
+    {
+        writers.emplace_back([&writers_crc, writer, writers_count, range_size]()
+        {
+            FileLock lock_slave(".lock");
+
+            uint64_t items = (items_to_produce / writers_count);
+            uint64_t offset = (16 + writer) * range_size;
+            for (uint64_t i = 0; i < items; ++i)
+            {
+                lock_slave.LockRange(offset, range_size, false);
+                writers_crc += (writer * items) + i;
+                lock_slave.UnlockRange(offset, range_size, false);
+            }
+        });
+    }
+
+    // Wait for all readers threads
+    for (auto& reader : readers)
+        reader.join();
+
+    // Wait for all writers threads
+    for (auto& writer : writers)
+        writer.join();
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(items_to_produce - 1);
+    context.metrics().SetCustom("CRC-Readers", readers_crc);
+    context.metrics().SetCustom("CRC-Writers", writers_crc);
+}
+
 BENCHMARK("FileLock", settings)
 {
     produce(context);
 }
 
-BENCHMARK_MAIN()
+BENCHMARK("FileLock-ranges", settings)
+{
+    produce_ranges(context);
+}
+
+BENCHMARK_REPORT_MAIN()
@@ -0,0 +1,160 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "benchmark_report.h"
+
+#include "threads/mpmc_linked_queue.h"
+#include "threads/mpmc_ring_queue.h"
+#include "threads/mpsc_linked_queue.h"
+#include "queue_latency.h"
+
+#include <atomic>
+#include <functional>
+#include <thread>
+#include <vector>
+
+using namespace CppCommon;
+
+const uint64_t items_to_produce = 10000000;
+const int producers_from = 1;
+const int producers_to = 8;
+const int consumers_from = 1;
+const int consumers_to = 8;
+const auto settings = CppBenchmark::Settings().ParamRange(producers_from, producers_to, [](int from, int to, int& result) { int r = result; result *= 2; return r; });
+const auto mpmc_settings = CppBenchmark::Settings().PairRange(producers_from, producers_to, [](int from, int to, int& result) { int r = result; result *= 2; return r; },
+                                                              consumers_from, consumers_to, [](int from, int to, int& result) { int r = result; result *= 2; return r; });
+
+// Linked queues are created with the default memory manager, ring queues with the fixed capacity
+template <typename TQueue>
+struct QueueFactory;
+
+template <typename T, size_t N>
+struct QueueFactory<MPMCLinkedQueue<T, N>>
+{
+    DefaultMemoryManager auxiliary;
+    MPMCLinkedQueue<T, N> queue;
+    QueueFactory() : queue(auxiliary) {}
+};
+
+template <typename T>
+struct QueueFactory<MPSCLinkedQueue<T>>
+{
+    MPSCLinkedQueue<T> queue;
+};
+
+template <typename T>
+struct QueueFactory<MPMCRingQueue<T>>
+{
+    MPMCRingQueue<T> queue;
+    QueueFactory() : queue(1048576) {}
+};
+
+template <typename T, class TQueue>
+void produce_consume(CppBenchmark::Context& context, int producers_count, int consumers_count, const std::function<void()>& wait_strategy)
+{
+    std::atomic<uint64_t> consumed(0);
+    std::atomic<uint64_t> crc(0);
+
+    QueueFactory<TQueue> factory;
+    TQueue& queue = factory.queue;
+
+    // Start consumer threads
+    std::vector<std::thread> consumers;
+    for (int consumer = 0; consumer < consumers_count; ++consumer)
+    {
+        consumers.emplace_back([&queue, &wait_strategy, &consumed, &crc]()
+        {
+            uint64_t local = 0;
+            while (consumed.load(std::memory_order_relaxed) < items_to_produce)
+            {
+                // Dequeue using the given waiting strategy
+                T item;
+                if (!queue.Dequeue(item))
+                {
+                    wait_strategy();
+                    continue;
+                }
+
+                // Consume the item
+                local += item;
+                consumed.fetch_add(1, std::memory_order_relaxed);
+            }
+            crc += local;
+        });
+    }
+
+    // Start producer threads
+    std::vector<std::thread> producers;
+    for (int producer = 0; producer < producers_count; ++producer)
+    {
+        producers.emplace_back([&queue, &wait_strategy, producer, producers_count]()
+        {
+            uint64_t items = (items_to_produce / producers_count);
+            for (uint64_t i = 0; i < items; ++i)
+            {
+                // Enqueue using the given waiting strategy
+                while (!queue.Enqueue((T)(items * producer + i)))
+                    wait_strategy();
+            }
+        });
+    }
+
+    // Wait for all producers threads
+    for (auto& producer : producers)
+        producer.join();
+
+    // Wait for all consumer threads
+    for (auto& consumer : consumers)
+        consumer.join();
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(items_to_produce - 1);
+    context.metrics().AddItems(items_to_produce);
+    context.metrics().AddBytes(items_to_produce * sizeof(T));
+    context.metrics().SetCustom("CRC", crc.load());
+}
+
+BENCHMARK("MPMCLinkedQueue<SpinWait>-producers", settings)
+{
+    produce_consume<int, MPMCLinkedQueue<int, 256>>(context, context.x(), 1, []{});
+}
+
+BENCHMARK("MPMCLinkedQueue<YieldWait>-producers", settings)
+{
+    produce_consume<int, MPMCLinkedQueue<int, 256>>(context, context.x(), 1, []{ std::this_thread::yield(); });
+}
+
+BENCHMARK("MPSCLinkedQueue<SpinWait>-producers", settings)
+{
+    produce_consume<int, MPSCLinkedQueue<int>>(context, context.x(), 1, []{});
+}
+
+BENCHMARK("MPSCLinkedQueue<YieldWait>-producers", settings)
+{
+    produce_consume<int, MPSCLinkedQueue<int>>(context, context.x(), 1, []{ std::this_thread::yield(); });
+}
+
+BENCHMARK("MPMCLinkedQueue<YieldWait>-producers-consumers", mpmc_settings)
+{
+    produce_consume<int, MPMCLinkedQueue<int, 256>>(context, context.x(), context.y(), []{ std::this_thread::yield(); });
+}
+
+BENCHMARK("MPMCRingQueue<YieldWait>-producers-consumers", mpmc_settings)
+{
+    produce_consume<int, MPMCRingQueue<int>>(context, context.x(), context.y(), []{ std::this_thread::yield(); });
+}
+
+BENCHMARK("MPMCLinkedQueue<SpinWait>-latency", latency_settings)
+{
+    QueueFactory<MPMCLinkedQueue<uint64_t, 256>> factory;
+    produce_consume_latency(context, factory.queue, latency_producers, []{});
+}
+
+BENCHMARK("MPMCLinkedQueue<YieldWait>-latency", latency_settings)
+{
+    QueueFactory<MPMCLinkedQueue<uint64_t, 256>> factory;
+    produce_consume_latency(context, factory.queue, latency_producers, []{ std::this_thread::yield(); });
+}
+
+BENCHMARK_REPORT_MAIN()
@@ -0,0 +1,128 @@
+//
+// Created by Ivan Shynkarenka on 15.10.2026
+//
+
+#include "benchmark_report.h"
+
+#include "threads/mpmc_ring_buffer.h"
+#include "queue_latency.h"
+
+#include <atomic>
+#include <functional>
+#include <thread>
+#include <vector>
+
+using namespace CppCommon;
+
+const uint64_t bytes_to_produce = 134217728;
+const int item_size_from = 4;
+const int item_size_to = 4096;
+const int threads_from = 1;
+const int threads_to = 8;
+const auto settings = CppBenchmark::Settings().PairRange(item_size_from, item_size_to, [](int from, int to, int& result) { int r = result; result *= 4; return r; },
+                                                         threads_from, threads_to, [](int from, int to, int& result) { int r = result; result *= 2; return r; });
+
+template<uint64_t N>
+void produce_consume(CppBenchmark::Context& context, const std::function<void()>& wait_strategy)
+{
+    const int item_size = context.x();
+    const int threads_count = context.y();
+    const uint64_t items_to_produce = (bytes_to_produce / item_size / threads_count) * threads_count;
+    std::atomic<uint64_t> consumed(0);
+    std::atomic<uint64_t> crc(0);
+
+    // Create multiple producers / multiple consumers lock-free ring buffer
+    MPMCRingBuffer buffer(N);
+
+    // Start consumer threads
+    std::vector<std::thread> consumers;
+    for (int consumer = 0; consumer < threads_count; ++consumer)
+    {
+        consumers.emplace_back([&buffer, &wait_strategy, &consumed, &crc, items_to_produce]()
+        {
+            uint64_t local_crc = 0;
+            while (consumed.load(std::memory_order_relaxed) < items_to_produce)
+            {
+                // Claim using the given waiting strategy
+                auto record = buffer.Claim();
+                if (!record)
+                {
+                    wait_strategy();
+                    continue;
+                }
+
+                // Emulate consuming in place
+                const uint8_t* item = (const uint8_t*)record.data;
+                for (size_t j = 0; j < record.size; ++j)
+                    local_crc += item[j];
+
+                buffer.Release(record);
+                consumed.fetch_add(1, std::memory_order_relaxed);
+            }
+            crc += local_crc;
+        });
+    }
+
+    // Start producer threads
+    std::vector<std::thread> producers;
+    for (int producer = 0; producer < threads_count; ++producer)
+    {
+        producers.emplace_back([&buffer, &wait_strategy, item_size, items_to_produce, threads_count]()
+        {
+            uint64_t items = (items_to_produce / threads_count);
+            for (uint64_t i = 0; i < items; ++i)
+            {
+                // Reserve using the given waiting strategy
+                MPMCRingBuffer::Reservation reservation;
+                while (!(reservation = buffer.Reserve(item_size)))
+                    wait_strategy();
+
+                // Emulate producing in place
+                uint8_t* item = (uint8_t*)reservation.data;
+                for (int j = 0; j < item_size; ++j)
+                    item[j] = (uint8_t)j;
+
+                buffer.Commit(reservation);
+            }
+        });
+    }
+
+    // Wait for all producers threads
+    for (auto& producer : producers)
+        producer.join();
+
+    // Wait for all consumers threads
+    for (auto& consumer : consumers)
+        consumer.join();
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(items_to_produce - 1);
+    context.metrics().AddItems(items_to_produce);
+    context.metrics().AddBytes(items_to_produce * item_size);
+    context.metrics().SetCustom("MPMCRingBuffer.capacity", N);
+    context.metrics().SetCustom("CRC", crc.load());
+}
+
+BENCHMARK("MPMCRingBuffer<SpinWait>", settings)
+{
+    produce_consume<1048576>(context, []{});
+}
+
+BENCHMARK("MPMCRingBuffer<YieldWait>", settings)
+{
+    produce_consume<1048576>(context, []{ std::this_thread::yield(); });
+}
+
+BENCHMARK("MPMCRingBuffer<SpinWait>-latency", latency_settings)
+{
+    LatencyRingBuffer<MPMCRingBuffer> buffer(1048576);
+    produce_consume_latency(context, buffer, latency_producers, []{});
+}
+
+BENCHMARK("MPMCRingBuffer<YieldWait>-latency", latency_settings)
+{
+    LatencyRingBuffer<MPMCRingBuffer> buffer(1048576);
+    produce_consume_latency(context, buffer, latency_producers, []{ std::this_thread::yield(); });
+}
+
+BENCHMARK_REPORT_MAIN()
@@ -2,10 +2,13 @@
 // Created by Ivan Shynkarenka on 19.01.2016
 //
 
-#include "benchmark/cppbenchmark.h"
+#include "benchmark_report.h"
 
+#include "threads/blocking_queue.h"
 #include "threads/mpmc_ring_queue.h"
+#include "queue_latency.h"
 
+#include <cstring>
 #include <functional>
 #include <thread>
 #include <vector>
@@ -16,15 +19,19 @@ const uint64_t items_to_produce = 10000000;
 const int producers_from = 1;
 const int producers_to = 8;
 const auto settings = CppBenchmark::Settings().ParamRange(producers_from, producers_to, [](int from, int to, int& result) { int r = result; result *= 2; return r; });
+const int batch_from = 1;
+const int batch_to = 512;
+const auto batch_settings = CppBenchmark::Settings().PairRange(producers_from, producers_to, [](int from, int to, int& result) { int r = result; result *= 2; return r; },
+                                                               batch_from, batch_to, [](int from, int to, int& result) { int r = result; result *= 4; return r; });
 
-template<typename T, uint64_t N>
+template<typename T, uint64_t N, MPMCRingQueueLayout layout = MPMCRingQueueLayout::COMPACT>
 void produce_consume(CppBenchmark::Context& context, const std::function<void()>& wait_strategy)
 {
     const int producers_count = context.x();
     uint64_t crc = 0;
 
     // Create multiple producers / multiple consumers wait-free ring queue
-    MPMCRingQueue<T> queue(N);
+    MPMCRingQueue<T, layout> queue(N);
 
     // Start consumer thread
     auto consumer = std::thread([&queue, &wait_strategy, &crc]()
@@ -72,6 +79,211 @@ void produce_consume(CppBenchmark::Context& context, const std::function<void()>
     context.metrics().SetCustom("CRC", crc);
 }
 
+template<typename T, uint64_t N>
+void produce_consume_batch(CppBenchmark::Context& context, const std::function<void()>& wait_strategy)
+{
+    const int producers_count = context.x();
+    const uint64_t batch = context.y();
+    uint64_t crc = 0;
+
+    // Create multiple producers / multiple consumers wait-free ring queue
+    MPMCRingQueue<T> queue(N);
+
+    // Start consumer thread
+    auto consumer = std::thread([&queue, &wait_strategy, &crc, batch]()
+    {
+        std::vector<T> items;
+        items.reserve(batch);
+        for (uint64_t i = 0; i < items_to_produce;)
+        {
+            // Dequeue the batch using the given waiting strategy
+            items.clear();
+            while (queue.DequeueBulk(std::back_inserter(items), batch) == 0)
+                wait_strategy();
+
+            // Consume items
+            for (const auto& item : items)
+                crc += item;
+            i += items.size();
+        }
+    });
+
+    // Start producer threads
+    std::vector<std::thread> producers;
+    for (int producer = 0; producer < producers_count; ++producer)
+    {
+        producers.emplace_back([&queue, &wait_strategy, producer, producers_count, batch]()
+        {
+            uint64_t items_count = (items_to_produce / producers_count);
+            std::vector<T> items(batch);
+            for (uint64_t i = 0; i < items_count; i += batch)
+            {
+                // Prepare the batch
+                const uint64_t count = std::min(batch, items_count - i);
+                for (uint64_t j = 0; j < count; ++j)
+                    items[j] = (T)(items_count * producer + i + j);
+
+                // Enqueue the batch using the given waiting strategy
+                for (uint64_t j = 0; j < count;)
+                {
+                    size_t enqueued = queue.EnqueueBulk(items.begin() + j, items.begin() + count);
+                    if (enqueued == 0)
+                        wait_strategy();
+                    j += enqueued;
+                }
+            }
+        });
+    }
+
+    // Wait for all producers threads
+    for (auto& producer : producers)
+        producer.join();
+
+    // Wait for the consumer thread
+    consumer.join();
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(items_to_produce - 1);
+    context.metrics().AddItems(items_to_produce);
+    context.metrics().AddBytes(items_to_produce * sizeof(T));
+    context.metrics().SetCustom("MPMCRingQueue.capacity", N);
+    context.metrics().SetCustom("CRC", crc);
+}
+
+// Large item which is copied twice with Enqueue() / Dequeue()
+struct Order
+{
+    uint64_t id;
+    uint8_t payload[192];
+
+    Order() = default;
+    explicit Order(uint64_t i) : id(i) { memset(payload, (int)(i & 0xFF), sizeof(payload)); }
+};
+
+template <uint64_t N>
+void produce_consume_orders(CppBenchmark::Context& context, const std::function<void()>& wait_strategy, bool in_place)
+{
+    const int producers_count = context.x();
+    uint64_t crc = 0;
+
+    // Create multiple producers / multiple consumers wait-free ring queue
+    MPMCRingQueue<Order> queue(N);
+
+    // Start consumer thread
+    auto consumer = std::thread([&queue, &wait_strategy, &crc, in_place]()
+    {
+        auto handler = [&crc](const Order& order) { crc += order.id + order.payload[sizeof(order.payload) - 1]; };
+        for (uint64_t i = 0; i < items_to_produce; ++i)
+        {
+            // Dequeue or consume in place using the given waiting strategy
+            if (in_place)
+            {
+                while (!queue.Consume(handler))
+                    wait_strategy();
+            }
+            else
+            {
+                Order order;
+                while (!queue.Dequeue(order))
+                    wait_strategy();
+                handler(order);
+            }
+        }
+    });
+
+    // Start producer threads
+    std::vector<std::thread> producers;
+    for (int producer = 0; producer < producers_count; ++producer)
+    {
+        producers.emplace_back([&queue, &wait_strategy, producer, producers_count, in_place]()
+        {
+            uint64_t items = (items_to_produce / producers_count);
+            for (uint64_t i = 0; i < items; ++i)
+            {
+                // Enqueue or emplace using the given waiting strategy
+                const uint64_t id = items * producer + i;
+                if (in_place)
+                {
+                    while (!queue.Emplace(id))
+                        wait_strategy();
+                }
+                else
+                {
+                    while (!queue.Enqueue(Order(id)))
+                        wait_strategy();
+                }
+            }
+        });
+    }
+
+    // Wait for all producers threads
+    for (auto& producer : producers)
+        producer.join();
+
+    // Wait for the consumer thread
+    consumer.join();
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(items_to_produce - 1);
+    context.metrics().AddItems(items_to_produce);
+    context.metrics().AddBytes(items_to_produce * sizeof(Order));
+    context.metrics().SetCustom("MPMCRingQueue.capacity", N);
+    context.metrics().SetCustom("CRC", crc);
+}
+
+template<typename T, uint64_t N>
+void produce_consume_blocking(CppBenchmark::Context& context)
+{
+    const int producers_count = context.x();
+    uint64_t crc = 0;
+
+    // Create blocking multiple producers / multiple consumers wait-free ring queue
+    BlockingQueue<MPMCRingQueue<T>> queue(N);
+
+    // Start consumer thread
+    auto consumer = std::thread([&queue, &crc]()
+    {
+        for (uint64_t i = 0; i < items_to_produce; ++i)
+        {
+            // Dequeue with blocking
+            T item;
+            queue.Dequeue(item);
+
+            // Consume the item
+            crc += item;
+        }
+    });
+
+    // Start producer threads
+    std::vector<std::thread> producers;
+    for (int producer = 0; producer < producers_count; ++producer)
+    {
+        producers.emplace_back([&queue, producer, producers_count]()
+        {
+            uint64_t items = (items_to_produce / producers_count);
+            for (uint64_t i = 0; i < items; ++i)
+            {
+                // Enqueue with blocking
+                queue.Enqueue((T)(items * producer + i));
+            }
+        });
+    }
+
+    // Wait for all producers threads
+    for (auto& producer : producers)
+        producer.join();
+
+    // Wait for the consumer thread
+    consumer.join();
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(items_to_produce - 1);
+    context.metrics().AddItems(items_to_produce);
+    context.metrics().AddBytes(items_to_produce * sizeof(T));
+    context.metrics().SetCustom("MPMCRingQueue.capacity", N);
+    context.metrics().SetCustom("CRC", crc);
+}
+
 BENCHMARK("MPMCRingQueue<SpinWait>-producers", settings)
 {
     produce_consume<int, 1048576>(context, []{});
@@ -82,4 +294,76 @@ BENCHMARK("MPMCRingQueue<YieldWait>-producers", settings)
     produce_consume<int, 1048576>(context, []{ std::this_thread::yield(); });
 }
 
-BENCHMARK_MAIN()
+BENCHMARK("MPMCRingQueue<SpinWait, Padded>-producers", settings)
+{
+    produce_consume<int, 1048576, MPMCRingQueueLayout::PADDED>(context, []{});
+}
+
+BENCHMARK("MPMCRingQueue<SpinWait, Remapped>-producers", settings)
+{
+    produce_consume<int, 1048576, MPMCRingQueueLayout::REMAPPED>(context, []{});
+}
+
+BENCHMARK("MPMCRingQueue<SpinWait>-producers-batch", batch_settings)
+{
+    produce_consume_batch<int, 1048576>(context, []{});
+}
+
+BENCHMARK("MPMCRingQueue<YieldWait>-producers-batch", batch_settings)
+{
+    produce_consume_batch<int, 1048576>(context, []{ std::this_thread::yield(); });
+}
+
+BENCHMARK("MPMCRingQueue<SpinWait, Order>-producers", settings)
+{
+    produce_consume_orders<65536>(context, []{}, false);
+}
+
+BENCHMARK("MPMCRingQueue<SpinWait, Order>-producers-in-place", settings)
+{
+    produce_consume_orders<65536>(context, []{}, true);
+}
+
+BENCHMARK("MPMCRingQueue<Order>-create", 100)
+{
+    // Slots are neither constructed nor touched on creation
+    MPMCRingQueue<Order> queue(1048576);
+    context.metrics().AddBytes(queue.capacity() * sizeof(Order));
+}
+
+BENCHMARK("BlockingQueue<MPMCRingQueue>-producers", settings)
+{
+    produce_consume_blocking<int, 1048576>(context);
+}
+
+BENCHMARK("MPMCRingQueue<SpinWait>-latency", latency_settings)
+{
+    MPMCRingQueue<uint64_t> queue(1048576);
+    produce_consume_latency(context, queue, latency_producers, []{});
+}
+
+BENCHMARK("MPMCRingQueue<YieldWait>-latency", latency_settings)
+{
+    MPMCRingQueue<uint64_t> queue(1048576);
+    produce_consume_latency(context, queue, latency_producers, []{ std::this_thread::yield(); });
+}
+
+BENCHMARK("MPMCRingQueue<SpinWait, Padded>-latency", latency_settings)
+{
+    MPMCRingQueue<uint64_t, MPMCRingQueueLayout::PADDED> queue(1048576);
+    produce_consume_latency(context, queue, latency_producers, []{});
+}
+
+BENCHMARK("MPMCRingQueue<SpinWait, Remapped>-latency", latency_settings)
+{
+    MPMCRingQueue<uint64_t, MPMCRingQueueLayout::REMAPPED> queue(1048576);
+    produce_consume_latency(context, queue, latency_producers, []{});
+}
+
+BENCHMARK("BlockingQueue<MPMCRingQueue>-latency", latency_settings)
+{
+    BlockingQueue<MPMCRingQueue<uint64_t>> queue(1048576);
+    produce_consume_latency(context, queue, latency_producers, []{});
+}
+
+BENCHMARK_REPORT_MAIN()
@@ -2,7 +2,7 @@
 // Created by Ivan Shynkarenka on 19.01.2016
 //
 
-#include "benchmark/cppbenchmark.h"
+#include "benchmark_report.h"
 
 #include "threads/mpsc_linked_batcher.h"
 
@@ -77,6 +77,75 @@ void produce_consume(CppBenchmark::Context& context, const std::function<void()>
     context.metrics().SetCustom("CRC", crc);
 }
 
+template<typename T>
+void produce_consume_intrusive(CppBenchmark::Context& context, const std::function<void()>& wait_strategy)
+{
+    const int producers_count = context.x();
+    uint64_t crc = 0;
+
+    struct Item : public MPSCIntrusiveBatcher<Item>::Node
+    {
+        T value;
+    };
+
+    // Create multiple producers / single consumer wait-free intrusive batcher
+    MPSCIntrusiveBatcher<Item> batcher;
+
+    // Prepare items storage of all producers
+    const uint64_t items = (items_to_produce / producers_count);
+    std::vector<std::vector<Item>> storage(producers_count, std::vector<Item>(items));
+
+    // Start consumer thread
+    auto consumer = std::thread([&batcher, &wait_strategy, &crc]()
+    {
+        for (uint64_t i = 0; i < items_to_produce;)
+        {
+            // Define the batcher handler
+            auto handler = [&crc, &i](Item& item)
+            {
+                // Consume the item
+                crc += item.value;
+
+                // Increase the items counter
+                ++i;
+            };
+
+            // Dequeue all available items using the given waiting strategy
+            while (!batcher.Dequeue(handler))
+                wait_strategy();
+        }
+    });
+
+    // Start producer threads
+    std::vector<std::thread> producers;
+    for (int producer = 0; producer < producers_count; ++producer)
+    {
+        producers.emplace_back([&batcher, &storage, producer, items]()
+        {
+            for (uint64_t i = 0; i < items; ++i)
+            {
+                // Enqueue the preallocated item
+                Item& item = storage[producer][i];
+                item.value = (T)(items * producer + i);
+                batcher.Enqueue(item);
+            }
+        });
+    }
+
+    // Wait for all producers threads
+    for (auto& producer : producers)
+        producer.join();
+
+    // Wait for the consumer thread
+    consumer.join();
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(items_to_produce - 1);
+    context.metrics().AddItems(items_to_produce);
+    context.metrics().AddBytes(items_to_produce * sizeof(T));
+    context.metrics().SetCustom("CRC", crc);
+}
+
 BENCHMARK("MPSCLinkedBatcher<SpinWait>-producers", settings)
 {
     produce_consume<int>(context, []{});
@@ -87,4 +156,14 @@ BENCHMARK("MPSCLinkedBatcher<YieldWait>-producers", settings)
     produce_consume<int>(context, []{ std::this_thread::yield(); });
 }
 
-BENCHMARK_MAIN()
+BENCHMARK("MPSCIntrusiveBatcher<SpinWait>-producers", settings)
+{
+    produce_consume_intrusive<int>(context, []{});
+}
+
+BENCHMARK("MPSCIntrusiveBatcher<YieldWait>-producers", settings)
+{
+    produce_consume_intrusive<int>(context, []{ std::this_thread::yield(); });
+}
+
+BENCHMARK_REPORT_MAIN()
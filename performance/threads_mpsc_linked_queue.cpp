@@ -2,9 +2,10 @@
 // Created by Ivan Shynkarenka on 18.01.2016
 //
 
-#include "benchmark/cppbenchmark.h"
+#include "benchmark_report.h"
 
 #include "threads/mpsc_linked_queue.h"
+#include "queue_latency.h"
 
 #include <functional>
 #include <thread>
@@ -81,4 +82,16 @@ BENCHMARK("MPSCLinkedQueue<YieldWait>-producers", settings)
     produce_consume<int>(context, []{ std::this_thread::yield(); });
 }
 
-BENCHMARK_MAIN()
+BENCHMARK("MPSCLinkedQueue<SpinWait>-latency", latency_settings)
+{
+    MPSCLinkedQueue<uint64_t> queue;
+    produce_consume_latency(context, queue, latency_producers, []{});
+}
+
+BENCHMARK("MPSCLinkedQueue<YieldWait>-latency", latency_settings)
+{
+    MPSCLinkedQueue<uint64_t> queue;
+    produce_consume_latency(context, queue, latency_producers, []{ std::this_thread::yield(); });
+}
+
+BENCHMARK_REPORT_MAIN()
@@ -2,9 +2,10 @@
 // Created by Ivan Shynkarenka on 26.01.2016
 //
 
-#include "benchmark/cppbenchmark.h"
+#include "benchmark_report.h"
 
 #include "threads/mpsc_ring_buffer.h"
+#include "queue_latency.h"
 
 #include <functional>
 #include <thread>
@@ -102,4 +103,16 @@ BENCHMARK("MPSCRingBuffer<YieldWait>", settings)
     produce_consume<1048576>(context, []{ std::this_thread::yield(); });
 }
 
-BENCHMARK_MAIN()
+BENCHMARK("MPSCRingBuffer<SpinWait>-latency", latency_settings)
+{
+    LatencyRingBuffer<MPSCRingBuffer> buffer(1048576);
+    produce_consume_latency(context, buffer, latency_producers, []{});
+}
+
+BENCHMARK("MPSCRingBuffer<YieldWait>-latency", latency_settings)
+{
+    LatencyRingBuffer<MPSCRingBuffer> buffer(1048576);
+    produce_consume_latency(context, buffer, latency_producers, []{ std::this_thread::yield(); });
+}
+
+BENCHMARK_REPORT_MAIN()
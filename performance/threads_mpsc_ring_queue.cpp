@@ -2,9 +2,11 @@
 // Created by Ivan Shynkarenka on 21.01.2016
 //
 
-#include "benchmark/cppbenchmark.h"
+#include "benchmark_report.h"
 
+#include "threads/blocking_queue.h"
 #include "threads/mpsc_ring_queue.h"
+#include "queue_latency.h"
 
 #include <functional>
 #include <thread>
@@ -93,6 +95,58 @@ void produce_consume(CppBenchmark::Context& context, const std::function<void()>
     context.metrics().SetCustom("CRC", crc);
 }
 
+template<typename T, uint64_t N>
+void produce_consume_blocking(CppBenchmark::Context& context)
+{
+    const int producers_count = context.x();
+    uint64_t crc = 0;
+
+    // Create blocking multiple producers / single consumer wait-free ring queue
+    BlockingQueue<MPSCRingQueue<T>> queue(N, producers_count);
+
+    // Start consumer thread
+    auto consumer = std::thread([&queue, &crc]()
+    {
+        for (uint64_t i = 0; i < items_to_produce; ++i)
+        {
+            // Dequeue with blocking
+            T item;
+            queue.Dequeue(item);
+
+            // Consume the item
+            crc += item;
+        }
+    });
+
+    // Start producer threads
+    std::vector<std::thread> producers;
+    for (int producer = 0; producer < producers_count; ++producer)
+    {
+        producers.emplace_back([&queue, producer, producers_count]()
+        {
+            uint64_t items = (items_to_produce / producers_count);
+            for (uint64_t i = 0; i < items; ++i)
+            {
+                // Enqueue with blocking
+                queue.Enqueue((T)(items * producer + i));
+            }
+        });
+    }
+
+    // Wait for all producers threads
+    for (auto& producer : producers)
+        producer.join();
+
+    // Wait for the consumer thread
+    consumer.join();
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(items_to_produce - 1);
+    context.metrics().AddItems(items_to_produce);
+    context.metrics().AddBytes(items_to_produce * sizeof(T));
+    context.metrics().SetCustom("CRC", crc);
+}
+
 BENCHMARK("MPSCRingBatcher<SpinWait>-producers", settings)
 {
     produce_consume<int, 1048576, true>(context, []{});
@@ -113,4 +167,27 @@ BENCHMARK("MPSCRingQueue<YieldWait>-producers", settings)
     produce_consume<int, 1048576, false>(context, []{ std::this_thread::yield(); });
 }
 
-BENCHMARK_MAIN()
+BENCHMARK("BlockingQueue<MPSCRingQueue>-producers", settings)
+{
+    produce_consume_blocking<int, 1048576>(context);
+}
+
+BENCHMARK("MPSCRingQueue<SpinWait>-latency", latency_settings)
+{
+    MPSCRingQueue<uint64_t> queue(1048576, latency_producers);
+    produce_consume_latency(context, queue, latency_producers, []{});
+}
+
+BENCHMARK("MPSCRingQueue<YieldWait>-latency", latency_settings)
+{
+    MPSCRingQueue<uint64_t> queue(1048576, latency_producers);
+    produce_consume_latency(context, queue, latency_producers, []{ std::this_thread::yield(); });
+}
+
+BENCHMARK("BlockingQueue<MPSCRingQueue>-latency", latency_settings)
+{
+    BlockingQueue<MPSCRingQueue<uint64_t>> queue(1048576, latency_producers);
+    produce_consume_latency(context, queue, latency_producers, []{});
+}
+
+BENCHMARK_REPORT_MAIN()
@@ -2,7 +2,7 @@
 // Created by Ivan Shynkarenka on 26.05.2016
 //
 
-#include "benchmark/cppbenchmark.h"
+#include "benchmark_report.h"
 
 #include "threads/named_critical_section.h"
 
@@ -56,4 +56,4 @@ BENCHMARK("NamedCriticalSection", settings)
     produce(context);
 }
 
-BENCHMARK_MAIN()
+BENCHMARK_REPORT_MAIN()
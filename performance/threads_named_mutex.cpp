@@ -2,7 +2,7 @@
 // Created by Ivan Shynkarenka on 25.05.2016
 //
 
-#include "benchmark/cppbenchmark.h"
+#include "benchmark_report.h"
 
 #include "threads/named_mutex.h"
 
@@ -56,4 +56,4 @@ BENCHMARK("NamedMutex", settings)
     produce(context);
 }
 
-BENCHMARK_MAIN()
+BENCHMARK_REPORT_MAIN()
@@ -2,7 +2,7 @@
 // Created by Ivan Shynkarenka on 25.05.2016
 //
 
-#include "benchmark/cppbenchmark.h"
+#include "benchmark_report.h"
 
 #include "threads/named_semaphore.h"
 
@@ -60,4 +60,4 @@ BENCHMARK("NamedSemaphore", settings)
     produce(context);
 }
 
-BENCHMARK_MAIN()
+BENCHMARK_REPORT_MAIN()
@@ -0,0 +1,59 @@
+//
+// Created by Ivan Shynkarenka on 15.10.2026
+//
+
+#include "benchmark_report.h"
+
+#include "threads/pipeline.h"
+
+#include <functional>
+#include <vector>
+
+using namespace CppCommon;
+
+const uint64_t items_to_produce = 10000000;
+const int stages_from = 1;
+const int stages_to = 16;
+const auto settings = CppBenchmark::Settings().ParamRange(stages_from, stages_to, [](int from, int to, int& result) { int r = result; result *= 2; return r; });
+
+template<typename T, uint64_t N, size_t B>
+void produce_stages(CppBenchmark::Context& context)
+{
+    const int stages_count = context.x();
+    uint64_t crc = 0;
+
+    // Create the pipeline with the given count of stages
+    Pipeline<T> pipeline(N, B);
+    for (int stage = 0; stage < (stages_count - 1); ++stage)
+        pipeline.AddStage("increment", [](T& item) { ++item; });
+    pipeline.AddStage("sink", [&crc](T& item) { crc += item; });
+
+    pipeline.Start();
+
+    // Enqueue items in batches
+    std::vector<T> batch(B);
+    for (uint64_t i = 0; i < items_to_produce; i += B)
+    {
+        for (size_t j = 0; j < B; ++j)
+            batch[j] = (T)(i + j);
+        if (!pipeline.EnqueueBulk(batch.begin(), batch.end()))
+            break;
+    }
+
+    // Stop the pipeline
+    pipeline.Stop();
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(items_to_produce - 1);
+    context.metrics().AddItems(items_to_produce);
+    context.metrics().AddBytes(items_to_produce * sizeof(T));
+    context.metrics().SetCustom("Pipeline.threads", (uint64_t)pipeline.statistics().back().thread + 1);
+    context.metrics().SetCustom("CRC", crc);
+}
+
+BENCHMARK("Pipeline-stages", settings)
+{
+    produce_stages<uint64_t, 65536, 64>(context);
+}
+
+BENCHMARK_REPORT_MAIN()
@@ -2,10 +2,12 @@
 // Created by Ivan Shynkarenka on 25.05.2016
 //
 
-#include "benchmark/cppbenchmark.h"
+#include "benchmark_report.h"
 
+#include "threads/distributed_rw_lock.h"
 #include "threads/rw_lock.h"
 
+#include <atomic>
 #include <thread>
 #include <vector>
 
@@ -18,7 +20,11 @@ const int writers_from = 1;
 const int writers_to = 32;
 const auto settings = CppBenchmark::Settings().PairRange(readers_from, readers_to, [](int from, int to, int& result) { int r = result; result *= 2; return r; },
                                                          writers_from, writers_to, [](int from, int to, int& result) { int r = result; result *= 2; return r; });
+const int threads_from = 1;
+const int threads_to = 64;
+const auto settings_mixed = CppBenchmark::Settings().ParamRange(threads_from, threads_to, [](int from, int to, int& result) { int r = result; result *= 2; return r; });
 
+template <class TLock>
 void produce(CppBenchmark::Context& context)
 {
     const int readers_count = context.x();
@@ -27,7 +33,7 @@ void produce(CppBenchmark::Context& context)
     uint64_t writers_crc = 0;
 
     // Create read/write lock synchronization primitive
-    RWLock lock;
+    TLock lock;
 
     // Start readers threads
     std::vector<std::thread> readers;
@@ -38,7 +44,7 @@ void produce(CppBenchmark::Context& context)
             uint64_t items = (items_to_produce / readers_count);
             for (uint64_t i = 0; i < items; ++i)
             {
-                ReadLocker<RWLock> locker(lock);
+                ReadLocker<TLock> locker(lock);
                 readers_crc += (reader * items) + i;
             }
         });
@@ -53,7 +59,7 @@ void produce(CppBenchmark::Context& context)
             uint64_t items = (items_to_produce / writers_count);
             for (uint64_t i = 0; i < items; ++i)
             {
-                WriteLocker<RWLock> locker(lock);
+                WriteLocker<TLock> locker(lock);
                 writers_crc += (writer * items) + i;
             }
         });
@@ -73,9 +79,70 @@ void produce(CppBenchmark::Context& context)
     context.metrics().SetCustom("CRC-Writers", writers_crc);
 }
 
+// Read mostly workload: each thread makes 95% of reads and 5% of writes
+template <class TLock>
+void produce_mixed(CppBenchmark::Context& context)
+{
+    const int threads_count = context.x();
+    std::atomic<uint64_t> readers_crc(0);
+    uint64_t writers_crc = 0;
+
+    // Create read/write lock synchronization primitive
+    TLock lock;
+
+    // Start threads
+    std::vector<std::thread> threads;
+    for (int thread = 0; thread < threads_count; ++thread)
+    {
+        threads.emplace_back([&lock, &readers_crc, &writers_crc, thread, threads_count]()
+        {
+            uint64_t items = (items_to_produce / threads_count);
+            uint64_t result = 0;
+            for (uint64_t i = 0; i < items; ++i)
+            {
+                if ((i % 20) == 19)
+                {
+                    WriteLocker<TLock> locker(lock);
+                    writers_crc += (thread * items) + i;
+                }
+                else
+                {
+                    ReadLocker<TLock> locker(lock);
+                    result += writers_crc;
+                }
+            }
+            readers_crc += result;
+        });
+    }
+
+    // Wait for all threads
+    for (auto& thread : threads)
+        thread.join();
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(items_to_produce - 1);
+    context.metrics().SetCustom("CRC-Readers", readers_crc.load());
+    context.metrics().SetCustom("CRC-Writers", writers_crc);
+}
+
 BENCHMARK("RWLock", settings)
 {
-    produce(context);
+    produce<RWLock>(context);
+}
+
+BENCHMARK("DistributedRWLock", settings)
+{
+    produce<DistributedRWLock>(context);
+}
+
+BENCHMARK("RWLock-95/5", settings_mixed)
+{
+    produce_mixed<RWLock>(context);
+}
+
+BENCHMARK("DistributedRWLock-95/5", settings_mixed)
+{
+    produce_mixed<DistributedRWLock>(context);
 }
 
-BENCHMARK_MAIN()
+BENCHMARK_REPORT_MAIN()
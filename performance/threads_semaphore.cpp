@@ -2,7 +2,7 @@
 // Created by Ivan Shynkarenka on 25.05.2016
 //
 
-#include "benchmark/cppbenchmark.h"
+#include "benchmark_report.h"
 
 #include "threads/semaphore.h"
 
@@ -57,4 +57,4 @@ BENCHMARK("Semaphore", settings)
     produce(context);
 }
 
-BENCHMARK_MAIN()
+BENCHMARK_REPORT_MAIN()
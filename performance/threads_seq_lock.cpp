@@ -2,11 +2,14 @@
 // Created by Ivan Shynkarenka on 17.08.2017
 //
 
-#include "benchmark/cppbenchmark.h"
+#include "benchmark_report.h"
 
+#include "threads/left_right.h"
 #include "threads/seq_lock.h"
+#include "threads/snapshot.h"
 #include "threads/thread.h"
 
+#include <atomic>
 #include <thread>
 #include <vector>
 
@@ -16,6 +19,8 @@ const uint64_t items_to_produce = 100000000;
 const int readers_from = 1;
 const int readers_to = 32;
 const auto settings = CppBenchmark::Settings().ParamRange(readers_from, readers_to, [](int from, int to, int& result) { int r = result; result *= 2; return r; });
+const uint64_t items_to_burst = 1000000;
+const int writers_count = 4;
 
 struct Data
 {
@@ -24,13 +29,14 @@ struct Data
     uint64_t c;
 };
 
+template <class TLock>
 void produce(CppBenchmark::Context& context)
 {
     const int readers_count = context.x();
     uint64_t writer_crc = 0;
 
-    // Create sequential lock synchronization primitive
-    SeqLock<Data> lock;
+    // Create synchronization primitive
+    TLock lock;
 
     // Start readers threads
     std::vector<std::thread> readers;
@@ -53,7 +59,7 @@ void produce(CppBenchmark::Context& context)
     {
         for (uint64_t i = 0; i <= items_to_produce; ++i)
         {
-            lock.Write(Data{ i, i + 100, i + 200 });
+            lock = Data{ i, i + 100, i + 200 };
             writer_crc += i;
         }
     });
@@ -70,9 +76,80 @@ void produce(CppBenchmark::Context& context)
     context.metrics().SetCustom("CRC-Writer", writer_crc);
 }
 
+// Write bursts of several writers, readers latency is measured by the count of reads
+template <class TLock, class TWriter>
+void produce_burst(CppBenchmark::Context& context, TWriter&& write)
+{
+    const int readers_count = context.x();
+    std::atomic<bool> done(false);
+    std::atomic<uint64_t> reads(0);
+    std::atomic<uint64_t> broken(0);
+
+    // Create synchronization primitive
+    TLock lock(Data{ 0, 100, 200 });
+
+    // Start readers threads
+    std::vector<std::thread> readers;
+    for (int reader = 0; reader < readers_count; ++reader)
+    {
+        readers.emplace_back([&lock, &done, &reads, &broken]()
+        {
+            uint64_t count = 0;
+            while (!done.load(std::memory_order_relaxed))
+            {
+                Data data = lock.Read();
+                if ((data.b != data.a + 100) || (data.c != data.b + 100))
+                    broken.fetch_add(1, std::memory_order_relaxed);
+                ++count;
+            }
+            reads += count;
+        });
+    }
+
+    // Start writers threads
+    std::vector<std::thread> writers;
+    for (int writer = 0; writer < writers_count; ++writer)
+    {
+        writers.emplace_back([&lock, &write]()
+        {
+            for (uint64_t i = 0; i < (items_to_burst / writers_count); ++i)
+                write(lock, Data{ i, i + 100, i + 200 });
+        });
+    }
+
+    // Wait for all writers threads
+    for (auto& writer : writers)
+        writer.join();
+
+    // Wait for all readers threads
+    done = true;
+    for (auto& reader : readers)
+        reader.join();
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(items_to_burst - 1);
+    context.metrics().SetCustom("Reads", reads.load());
+    context.metrics().SetCustom("Broken", broken.load());
+}
+
 BENCHMARK("SeqLock", settings)
 {
-    produce(context);
+    produce<SeqLock<Data>>(context);
+}
+
+BENCHMARK("Snapshot", settings)
+{
+    produce<Snapshot<Data>>(context);
+}
+
+BENCHMARK("SeqLock-concurrent-writers", settings)
+{
+    produce_burst<SeqLock<Data>>(context, [](SeqLock<Data>& lock, const Data& data) { lock.WriteConcurrent(data); });
+}
+
+BENCHMARK("LeftRight-concurrent-writers", settings)
+{
+    produce_burst<LeftRight<Data>>(context, [](LeftRight<Data>& lock, const Data& data) { lock.Write(data); });
 }
 
-BENCHMARK_MAIN()
+BENCHMARK_REPORT_MAIN()
@@ -0,0 +1,58 @@
+//
+// Created by Ivan Shynkarenka on 15.10.2026
+//
+
+#include "benchmark_report.h"
+
+#include "threads/sharded_counter.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace CppCommon;
+
+const uint64_t items_to_add = 10000000;
+const int producers_from = 1;
+const int producers_to = 16;
+const auto settings = CppBenchmark::Settings().ParamRange(producers_from, producers_to, [](int from, int to, int& result) { int r = result; result *= 2; return r; });
+
+template <class TCounter, typename TAdd, typename TSum>
+void produce(CppBenchmark::Context& context, TCounter& counter, TAdd add, TSum sum)
+{
+    const int producers_count = context.x();
+
+    // Start producer threads
+    std::vector<std::thread> producers;
+    for (int producer = 0; producer < producers_count; ++producer)
+    {
+        producers.emplace_back([&counter, &add, producers_count]()
+        {
+            uint64_t items = (items_to_add / producers_count);
+            for (uint64_t i = 0; i < items; ++i)
+                add(counter);
+        });
+    }
+
+    // Wait for all producers threads
+    for (auto& producer : producers)
+        producer.join();
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(items_to_add - 1);
+    context.metrics().SetCustom("Sum", (int64_t)sum(counter));
+}
+
+BENCHMARK("std::atomic", settings)
+{
+    std::atomic<int64_t> counter(0);
+    produce(context, counter, [](std::atomic<int64_t>& c) { c.fetch_add(1, std::memory_order_relaxed); }, [](std::atomic<int64_t>& c) { return c.load(); });
+}
+
+BENCHMARK("ShardedCounter", settings)
+{
+    ShardedCounter counter;
+    produce(context, counter, [](ShardedCounter& c) { c.Add(); }, [](ShardedCounter& c) { return c.Sum(); });
+}
+
+BENCHMARK_REPORT_MAIN()
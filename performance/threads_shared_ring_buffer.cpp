@@ -0,0 +1,140 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "benchmark_report.h"
+
+#include "system/pipe.h"
+#include "threads/shared_mpsc_ring_buffer.h"
+#include "threads/shared_spsc_ring_queue.h"
+
+#include <functional>
+#include <thread>
+
+using namespace CppCommon;
+
+const uint64_t round_trips = 1000000;
+
+bool Enqueue(SharedSPSCRingQueue<uint64_t>& queue, uint64_t item) { return queue.Enqueue(item); }
+bool Dequeue(SharedSPSCRingQueue<uint64_t>& queue, uint64_t& item) { return queue.Dequeue(item); }
+
+bool Enqueue(SharedMPSCRingBuffer& buffer, uint64_t item) { return buffer.Enqueue(&item, sizeof(item)); }
+bool Dequeue(SharedMPSCRingBuffer& buffer, uint64_t& item) { size_t size = sizeof(item); return buffer.Dequeue(&item, size); }
+
+template <class TQueue, class TFactory>
+void ping_pong(CppBenchmark::Context& context, TFactory&& factory, const std::function<void(TQueue&)>& wait_strategy)
+{
+    uint64_t crc = 0;
+
+    // Create ping and pong queues with owner mappings
+    auto ping_master = factory("shared_ring_perf_ping");
+    auto pong_master = factory("shared_ring_perf_pong");
+
+    // Start echo thread with its own mappings of the same shared memory
+    auto echo = std::thread([&factory, &wait_strategy]()
+    {
+        auto ping_slave = factory("shared_ring_perf_ping");
+        auto pong_slave = factory("shared_ring_perf_pong");
+
+        for (uint64_t i = 0; i < round_trips; ++i)
+        {
+            // Receive the ping
+            uint64_t item;
+            while (!Dequeue(*ping_slave, item))
+                wait_strategy(*ping_slave);
+
+            // Send the pong
+            while (!Enqueue(*pong_slave, item))
+                continue;
+        }
+    });
+
+    for (uint64_t i = 0; i < round_trips; ++i)
+    {
+        // Send the ping
+        while (!Enqueue(*ping_master, i))
+            continue;
+
+        // Receive the pong
+        uint64_t item;
+        while (!Dequeue(*pong_master, item))
+            wait_strategy(*pong_master);
+
+        crc += item;
+    }
+
+    // Wait for the echo thread
+    echo.join();
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(round_trips - 1);
+    context.metrics().AddItems(round_trips);
+    context.metrics().AddBytes(round_trips * sizeof(uint64_t));
+    context.metrics().SetCustom("CRC", crc);
+}
+
+auto spsc_factory = [](const std::string& name) { return std::make_unique<SharedSPSCRingQueue<uint64_t>>(name, 1024); };
+auto mpsc_factory = [](const std::string& name) { return std::make_unique<SharedMPSCRingBuffer>(name, 8192, 4); };
+
+BENCHMARK("SharedSPSCRingQueue<SpinWait>-ping-pong")
+{
+    ping_pong<SharedSPSCRingQueue<uint64_t>>(context, spsc_factory, [](SharedSPSCRingQueue<uint64_t>&){});
+}
+
+BENCHMARK("SharedSPSCRingQueue<EventWait>-ping-pong")
+{
+    ping_pong<SharedSPSCRingQueue<uint64_t>>(context, spsc_factory, [](SharedSPSCRingQueue<uint64_t>& queue){ queue.Wait(); });
+}
+
+BENCHMARK("SharedMPSCRingBuffer<SpinWait>-ping-pong")
+{
+    ping_pong<SharedMPSCRingBuffer>(context, mpsc_factory, [](SharedMPSCRingBuffer&){});
+}
+
+BENCHMARK("SharedMPSCRingBuffer<EventWait>-ping-pong")
+{
+    ping_pong<SharedMPSCRingBuffer>(context, mpsc_factory, [](SharedMPSCRingBuffer& buffer){ buffer.Wait(); });
+}
+
+BENCHMARK("Pipe-ping-pong")
+{
+    uint64_t crc = 0;
+
+    // Create ping and pong pipes
+    Pipe ping;
+    Pipe pong;
+
+    // Start echo thread
+    auto echo = std::thread([&ping, &pong]()
+    {
+        for (uint64_t i = 0; i < round_trips; ++i)
+        {
+            uint64_t item;
+            if (ping.Read(&item, sizeof(item)) != sizeof(item))
+                break;
+            if (pong.Write(&item, sizeof(item)) != sizeof(item))
+                break;
+        }
+    });
+
+    for (uint64_t i = 0; i < round_trips; ++i)
+    {
+        uint64_t item = i;
+        if (ping.Write(&item, sizeof(item)) != sizeof(item))
+            break;
+        if (pong.Read(&item, sizeof(item)) != sizeof(item))
+            break;
+        crc += item;
+    }
+
+    // Wait for the echo thread
+    echo.join();
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(round_trips - 1);
+    context.metrics().AddItems(round_trips);
+    context.metrics().AddBytes(round_trips * sizeof(uint64_t));
+    context.metrics().SetCustom("CRC", crc);
+}
+
+BENCHMARK_REPORT_MAIN()
@@ -2,8 +2,10 @@
 // Created by Ivan Shynkarenka on 28.01.2016
 //
 
-#include "benchmark/cppbenchmark.h"
+#include "benchmark_report.h"
 
+#include "threads/adaptive_lock.h"
+#include "threads/mutex.h"
 #include "threads/spin_lock.h"
 
 #include <thread>
@@ -13,16 +15,17 @@ using namespace CppCommon;
 
 const uint64_t items_to_produce = 10000000;
 const int producers_from = 1;
-const int producers_to = 32;
+const int producers_to = 16;
 const auto settings = CppBenchmark::Settings().ParamRange(producers_from, producers_to, [](int from, int to, int& result) { int r = result; result *= 2; return r; });
 
+template <class TLock>
 void produce(CppBenchmark::Context& context)
 {
     const int producers_count = context.x();
     uint64_t crc = 0;
 
-    // Create spin-lock synchronization primitive
-    SpinLock lock;
+    // Create synchronization primitive
+    TLock lock;
 
     // Start producer threads
     std::vector<std::thread> producers;
@@ -33,7 +36,7 @@ void produce(CppBenchmark::Context& context)
             uint64_t items = (items_to_produce / producers_count);
             for (uint64_t i = 0; i < items; ++i)
             {
-                Locker<SpinLock> locker(lock);
+                Locker<TLock> locker(lock);
                 crc += (producer * items) + i;
             }
         });
@@ -50,7 +53,17 @@ void produce(CppBenchmark::Context& context)
 
 BENCHMARK("SpinLock", settings)
 {
-    produce(context);
+    produce<SpinLock>(context);
 }
 
-BENCHMARK_MAIN()
+BENCHMARK("AdaptiveLock", settings)
+{
+    produce<AdaptiveLock>(context);
+}
+
+BENCHMARK("Mutex", settings)
+{
+    produce<Mutex>(context);
+}
+
+BENCHMARK_REPORT_MAIN()
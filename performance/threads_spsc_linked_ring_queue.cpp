@@ -0,0 +1,103 @@
+//
+// Created by Ivan Shynkarenka on 15.10.2026
+//
+
+#include "benchmark_report.h"
+
+#include "threads/mpsc_linked_queue.h"
+#include "threads/spsc_linked_ring_queue.h"
+#include "queue_latency.h"
+
+#include <functional>
+#include <thread>
+
+using namespace CppCommon;
+
+const uint64_t items_to_produce = 100000000;
+const int segment_from = 16;
+const int segment_to = 65536;
+const auto settings = CppBenchmark::Settings().ParamRange(segment_from, segment_to, [](int from, int to, int& result) { int r = result; result *= 8; return r; });
+
+template<typename TQueue>
+void produce_consume(CppBenchmark::Context& context, TQueue& queue, const std::function<void()>& wait_strategy)
+{
+    uint64_t crc = 0;
+
+    // Start consumer thread
+    auto consumer = std::thread([&queue, &wait_strategy, &crc]()
+    {
+        for (uint64_t i = 0; i < items_to_produce; ++i)
+        {
+            // Dequeue using the given waiting strategy
+            int item;
+            while (!queue.Dequeue(item))
+                wait_strategy();
+
+            // Consume the item
+            crc += item;
+        }
+    });
+
+    // Start producer thread
+    auto producer = std::thread([&queue, &wait_strategy]()
+    {
+        for (uint64_t i = 0; i < items_to_produce; ++i)
+        {
+            // Enqueue using the given waiting strategy
+            while (!queue.Enqueue((int)i))
+                wait_strategy();
+        }
+    });
+
+    // Wait for the producer thread
+    producer.join();
+
+    // Wait for the consumer thread
+    consumer.join();
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(items_to_produce - 1);
+    context.metrics().AddItems(items_to_produce);
+    context.metrics().AddBytes(items_to_produce * sizeof(int));
+    context.metrics().SetCustom("CRC", crc);
+}
+
+BENCHMARK("SPSCLinkedRingQueue<SpinWait>-segment", settings)
+{
+    SPSCLinkedRingQueue<int> queue(context.x());
+    produce_consume(context, queue, []{});
+    context.metrics().SetCustom("SPSCLinkedRingQueue.segments", (uint64_t)queue.segments());
+}
+
+BENCHMARK("SPSCLinkedRingQueue<YieldWait>-segment", settings)
+{
+    SPSCLinkedRingQueue<int> queue(context.x());
+    produce_consume(context, queue, []{ std::this_thread::yield(); });
+    context.metrics().SetCustom("SPSCLinkedRingQueue.segments", (uint64_t)queue.segments());
+}
+
+BENCHMARK("MPSCLinkedQueue<SpinWait>")
+{
+    MPSCLinkedQueue<int> queue;
+    produce_consume(context, queue, []{});
+}
+
+BENCHMARK("MPSCLinkedQueue<YieldWait>")
+{
+    MPSCLinkedQueue<int> queue;
+    produce_consume(context, queue, []{ std::this_thread::yield(); });
+}
+
+BENCHMARK("SPSCLinkedRingQueue<SpinWait>-latency", latency_settings)
+{
+    SPSCLinkedRingQueue<uint64_t> queue(4096);
+    produce_consume_latency(context, queue, 1, []{});
+}
+
+BENCHMARK("SPSCLinkedRingQueue<YieldWait>-latency", latency_settings)
+{
+    SPSCLinkedRingQueue<uint64_t> queue(4096);
+    produce_consume_latency(context, queue, 1, []{ std::this_thread::yield(); });
+}
+
+BENCHMARK_REPORT_MAIN()
@@ -2,9 +2,10 @@
 // Created by Ivan Shynkarenka on 16.01.2016
 //
 
-#include "benchmark/cppbenchmark.h"
+#include "benchmark_report.h"
 
 #include "threads/spsc_ring_buffer.h"
+#include "queue_latency.h"
 
 #include <functional>
 #include <thread>
@@ -82,6 +83,71 @@ void produce_consume(CppBenchmark::Context& context, const std::function<void()>
     context.metrics().SetCustom("CRC", crc);
 }
 
+template<uint64_t N>
+void produce_consume_zero_copy(CppBenchmark::Context& context, const std::function<void()>& wait_strategy)
+{
+    const int item_size = context.x();
+    const uint64_t items_to_produce = bytes_to_produce / item_size;
+    uint64_t crc = 0;
+
+    // Create single producer / single consumer wait-free ring buffer
+    SPSCRingBuffer buffer(N);
+
+    // Start consumer thread
+    auto consumer = std::thread([&buffer, &wait_strategy, item_size, items_to_produce, &crc]()
+    {
+        for (uint64_t i = 0; i < items_to_produce;)
+        {
+            // Peek using the given waiting strategy
+            std::span<const uint8_t> items;
+            while ((items = buffer.Peek()).empty())
+                wait_strategy();
+
+            // Emulate consuming in place
+            for (uint8_t item : items)
+                crc += item;
+
+            // Release consumed items
+            buffer.Release(items.size());
+
+            // Increase the items counter
+            i += items.size() / item_size;
+        }
+    });
+
+    // Start producer thread
+    auto producer = std::thread([&buffer, &wait_strategy, item_size, items_to_produce]()
+    {
+        for (uint64_t i = 0; i < items_to_produce; ++i)
+        {
+            // Reserve using the given waiting strategy
+            std::span<uint8_t> item;
+            while ((item = buffer.Reserve(item_size)).empty())
+                wait_strategy();
+
+            // Emulate producing in place
+            for (int j = 0; j < item_size; ++j)
+                item[j] = (uint8_t)j;
+
+            // Commit the produced item
+            buffer.Commit();
+        }
+    });
+
+    // Wait for the producer thread
+    producer.join();
+
+    // Wait for the consumer thread
+    consumer.join();
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(items_to_produce - 1);
+    context.metrics().AddItems(items_to_produce);
+    context.metrics().AddBytes(items_to_produce * item_size);
+    context.metrics().SetCustom("SPSCRingBuffer.capacity", N);
+    context.metrics().SetCustom("CRC", crc);
+}
+
 BENCHMARK("SPSCRingBuffer<SpinWait>", settings)
 {
     produce_consume<1048576>(context, []{});
@@ -92,4 +158,26 @@ BENCHMARK("SPSCRingBuffer<YieldWait>", settings)
     produce_consume<1048576>(context, []{ std::this_thread::yield(); });
 }
 
-BENCHMARK_MAIN()
+BENCHMARK("SPSCRingBuffer<SpinWait>-zero-copy", settings)
+{
+    produce_consume_zero_copy<1048576>(context, []{});
+}
+
+BENCHMARK("SPSCRingBuffer<YieldWait>-zero-copy", settings)
+{
+    produce_consume_zero_copy<1048576>(context, []{ std::this_thread::yield(); });
+}
+
+BENCHMARK("SPSCRingBuffer<SpinWait>-latency", latency_settings)
+{
+    LatencyRingBuffer<SPSCRingBuffer> buffer(1048576);
+    produce_consume_latency(context, buffer, 1, []{});
+}
+
+BENCHMARK("SPSCRingBuffer<YieldWait>-latency", latency_settings)
+{
+    LatencyRingBuffer<SPSCRingBuffer> buffer(1048576);
+    produce_consume_latency(context, buffer, 1, []{ std::this_thread::yield(); });
+}
+
+BENCHMARK_REPORT_MAIN()
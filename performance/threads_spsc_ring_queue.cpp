@@ -2,24 +2,66 @@
 // Created by Ivan Shynkarenka on 16.01.2016
 //
 
-#include "benchmark/cppbenchmark.h"
+#include "benchmark_report.h"
 
+#include "threads/blocking_queue.h"
 #include "threads/spsc_ring_queue.h"
+#include "queue_latency.h"
 
+#include <atomic>
 #include <functional>
 #include <thread>
+#include <vector>
 
 using namespace CppCommon;
 
+// Baseline ring queue which loads the cursor of the other side on each operation,
+// so every item moves the other side cache line between cores
+template<typename T>
+class UncachedSPSCRingQueue
+{
+public:
+    explicit UncachedSPSCRingQueue(size_t capacity) : _mask(capacity - 1), _buffer(capacity), _head(0), _tail(0) {}
+
+    bool Enqueue(T&& item)
+    {
+        const size_t head = _head.load(std::memory_order_relaxed);
+        if ((head - _tail.load(std::memory_order_acquire)) == _mask)
+            return false;
+        _buffer[head & _mask] = std::move(item);
+        _head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool Dequeue(T& item)
+    {
+        const size_t tail = _tail.load(std::memory_order_relaxed);
+        if (_head.load(std::memory_order_acquire) == tail)
+            return false;
+        item = std::move(_buffer[tail & _mask]);
+        _tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+private:
+    const size_t _mask;
+    std::vector<T> _buffer;
+    alignas(128) std::atomic<size_t> _head;
+    alignas(128) std::atomic<size_t> _tail;
+};
+
 const uint64_t items_to_produce = 100000000;
+const int batch_from = 1;
+const int batch_to = 512;
+const auto batch_settings = CppBenchmark::Settings().ParamRange(batch_from, batch_to, [](int from, int to, int& result) { int r = result; result *= 4; return r; });
 
-template<typename T, uint64_t N>
+template<template<typename> class TQueue, typename T, uint64_t N>
 void produce_consume(CppBenchmark::Context& context, const std::function<void()>& wait_strategy)
 {
     uint64_t crc = 0;
 
     // Create single producer / single consumer wait-free ring queue
-    SPSCRingQueue<T> queue(N);
+    TQueue<T> queue(N);
 
     // Start consumer thread
     auto consumer = std::thread([&queue, &wait_strategy, &crc]()
@@ -61,14 +103,179 @@ void produce_consume(CppBenchmark::Context& context, const std::function<void()>
     context.metrics().SetCustom("CRC", crc);
 }
 
+template<typename T, uint64_t N>
+void produce_consume_batch(CppBenchmark::Context& context, const std::function<void()>& wait_strategy)
+{
+    const uint64_t batch = context.x();
+    uint64_t crc = 0;
+
+    // Create single producer / single consumer wait-free ring queue
+    SPSCRingQueue<T> queue(N);
+
+    // Start consumer thread
+    auto consumer = std::thread([&queue, &wait_strategy, &crc, batch]()
+    {
+        std::vector<T> items;
+        items.reserve(batch);
+        for (uint64_t i = 0; i < items_to_produce;)
+        {
+            // Dequeue the batch using the given waiting strategy
+            items.clear();
+            while (queue.DequeueBulk(std::back_inserter(items), batch) == 0)
+                wait_strategy();
+
+            // Consume items
+            for (const auto& item : items)
+                crc += item;
+            i += items.size();
+        }
+    });
+
+    // Start producer thread
+    auto producer = std::thread([&queue, &wait_strategy, batch]()
+    {
+        std::vector<T> items(batch);
+        for (uint64_t i = 0; i < items_to_produce; i += batch)
+        {
+            // Prepare the batch
+            const uint64_t count = std::min(batch, items_to_produce - i);
+            for (uint64_t j = 0; j < count; ++j)
+                items[j] = (T)(i + j);
+
+            // Enqueue the batch using the given waiting strategy
+            for (uint64_t j = 0; j < count;)
+            {
+                size_t enqueued = queue.EnqueueBulk(items.begin() + j, items.begin() + count);
+                if (enqueued == 0)
+                    wait_strategy();
+                j += enqueued;
+            }
+        }
+    });
+
+    // Wait for the producer thread
+    producer.join();
+
+    // Wait for the consumer thread
+    consumer.join();
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(items_to_produce - 1);
+    context.metrics().AddItems(items_to_produce);
+    context.metrics().AddBytes(items_to_produce * sizeof(T));
+    context.metrics().SetCustom("SPSCRingQueue.capacity", N);
+    context.metrics().SetCustom("CRC", crc);
+}
+
+template<typename T, uint64_t N>
+void produce_consume_blocking(CppBenchmark::Context& context)
+{
+    uint64_t crc = 0;
+
+    // Create blocking single producer / single consumer wait-free ring queue
+    BlockingQueue<SPSCRingQueue<T>> queue(N);
+
+    // Start consumer thread
+    auto consumer = std::thread([&queue, &crc]()
+    {
+        for (uint64_t i = 0; i < items_to_produce; ++i)
+        {
+            // Dequeue with blocking
+            T item;
+            queue.Dequeue(item);
+
+            // Consume the item
+            crc += item;
+        }
+    });
+
+    // Start producer thread
+    auto producer = std::thread([&queue]()
+    {
+        for (uint64_t i = 0; i < items_to_produce; ++i)
+        {
+            // Enqueue with blocking
+            queue.Enqueue((T)i);
+        }
+    });
+
+    // Wait for the producer thread
+    producer.join();
+
+    // Wait for the consumer thread
+    consumer.join();
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(items_to_produce - 1);
+    context.metrics().AddItems(items_to_produce);
+    context.metrics().AddBytes(items_to_produce * sizeof(T));
+    context.metrics().SetCustom("SPSCRingQueue.capacity", N);
+    context.metrics().SetCustom("CRC", crc);
+}
+
 BENCHMARK("SPSCRingQueue<SpinWait>")
 {
-    produce_consume<int, 1048576>(context, []{});
+    produce_consume<SPSCRingQueue, int, 1048576>(context, []{});
 }
 
 BENCHMARK("SPSCRingQueue<YieldWait>")
 {
-    produce_consume<int, 1048576>(context, []{ std::this_thread::yield(); });
+    produce_consume<SPSCRingQueue, int, 1048576>(context, []{ std::this_thread::yield(); });
+}
+
+BENCHMARK("UncachedSPSCRingQueue<SpinWait>")
+{
+    produce_consume<UncachedSPSCRingQueue, int, 1048576>(context, []{});
+}
+
+BENCHMARK("UncachedSPSCRingQueue<YieldWait>")
+{
+    produce_consume<UncachedSPSCRingQueue, int, 1048576>(context, []{ std::this_thread::yield(); });
+}
+
+BENCHMARK("SPSCRingQueue<SpinWait>-batch", batch_settings)
+{
+    produce_consume_batch<int, 1048576>(context, []{});
+}
+
+BENCHMARK("SPSCRingQueue<YieldWait>-batch", batch_settings)
+{
+    produce_consume_batch<int, 1048576>(context, []{ std::this_thread::yield(); });
+}
+
+BENCHMARK("BlockingQueue<SPSCRingQueue>")
+{
+    produce_consume_blocking<int, 1048576>(context);
+}
+
+BENCHMARK("SPSCRingQueue<SpinWait>-latency", latency_settings)
+{
+    SPSCRingQueue<uint64_t> queue(1048576);
+    produce_consume_latency(context, queue, 1, []{});
+}
+
+BENCHMARK("SPSCRingQueue<YieldWait>-latency", latency_settings)
+{
+    SPSCRingQueue<uint64_t> queue(1048576);
+    produce_consume_latency(context, queue, 1, []{ std::this_thread::yield(); });
+}
+
+BENCHMARK("UncachedSPSCRingQueue<SpinWait>-latency", latency_settings)
+{
+    UncachedSPSCRingQueue<uint64_t> queue(1048576);
+    produce_consume_latency(context, queue, 1, []{});
+}
+
+BENCHMARK("UncachedSPSCRingQueue<YieldWait>-latency", latency_settings)
+{
+    UncachedSPSCRingQueue<uint64_t> queue(1048576);
+    produce_consume_latency(context, queue, 1, []{ std::this_thread::yield(); });
+}
+
+BENCHMARK("BlockingQueue<SPSCRingQueue>-latency", latency_settings)
+{
+    BlockingQueue<SPSCRingQueue<uint64_t>> queue(1048576);
+    produce_consume_latency(context, queue, 1, []{});
 }
 
-BENCHMARK_MAIN()
+BENCHMARK_REPORT_MAIN()
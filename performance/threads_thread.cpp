@@ -2,7 +2,7 @@
 // Created by Ivan Shynkarenka on 27.01.2016
 //
 
-#include "benchmark/cppbenchmark.h"
+#include "benchmark_report.h"
 
 #include "threads/thread.h"
 #include "time/timestamp.h"
@@ -94,4 +94,4 @@ BENCHMARK("Thread::Yield()")
     context.metrics().SetCustom("CRC", crc);
 }
 
-BENCHMARK_MAIN()
+BENCHMARK_REPORT_MAIN()
@@ -0,0 +1,152 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "benchmark_report.h"
+
+#include "threads/latch.h"
+#include "threads/thread_pool.h"
+#include "threads/wait_queue.h"
+
+#include <atomic>
+#include <functional>
+#include <thread>
+#include <vector>
+
+using namespace CppCommon;
+
+const int tasks_to_submit = 1000000;
+const int split_depth = 20;
+const int threads_from = 1;
+const int threads_to = 32;
+const auto settings = CppBenchmark::Settings().ParamRange(threads_from, threads_to, [](int from, int to, int& result) { int r = result; result *= 2; return r; });
+
+// Hand-rolled thread pool around the single wait queue
+class WaitQueuePool
+{
+public:
+    explicit WaitQueuePool(int threads)
+    {
+        for (int thread = 0; thread < threads; ++thread)
+        {
+            _threads.emplace_back([this]()
+            {
+                std::function<void()> task;
+                while (_queue.Dequeue(task))
+                    task();
+            });
+        }
+    }
+
+    ~WaitQueuePool()
+    {
+        _queue.Close();
+        for (auto& thread : _threads)
+            thread.join();
+    }
+
+    template <class TTask>
+    void Submit(TTask&& task) { _queue.Enqueue(std::function<void()>(std::forward<TTask>(task))); }
+
+private:
+    WaitQueue<std::function<void()>> _queue;
+    std::vector<std::thread> _threads;
+};
+
+// Short task which emulates some useful work
+uint64_t work(uint64_t seed)
+{
+    uint64_t result = seed;
+    for (int i = 0; i < 64; ++i)
+        result = result * 6364136223846793005ull + 1442695040888963407ull;
+    return result;
+}
+
+template <class TPool>
+void submit(CppBenchmark::Context& context, TPool& pool)
+{
+    std::atomic<uint64_t> crc(0);
+
+    // Submit independent tasks from the outside of the thread pool
+    Latch latch(tasks_to_submit);
+    for (int i = 0; i < tasks_to_submit; ++i)
+    {
+        pool.Submit([&crc, &latch, i]()
+        {
+            crc.fetch_add(work(i) & 0xFF, std::memory_order_relaxed);
+            latch.CountDown();
+        });
+    }
+    latch.Wait();
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(tasks_to_submit - 1);
+    context.metrics().AddItems(tasks_to_submit);
+    context.metrics().SetCustom("CRC", crc.load());
+}
+
+template <class TPool>
+void split(CppBenchmark::Context& context, TPool& pool)
+{
+    const int leaves = 1 << split_depth;
+    std::atomic<uint64_t> crc(0);
+    Latch latch(leaves);
+
+    // Recursively split the work into nested tasks submitted from workers
+    std::function<void(int, uint64_t)> task = [&pool, &crc, &latch, &task](int depth, uint64_t seed)
+    {
+        if (depth == 0)
+        {
+            crc.fetch_add(work(seed) & 0xFF, std::memory_order_relaxed);
+            latch.CountDown();
+            return;
+        }
+        pool.Submit([&task, depth, seed]() { task(depth - 1, seed * 2); });
+        pool.Submit([&task, depth, seed]() { task(depth - 1, seed * 2 + 1); });
+    };
+    pool.Submit([&task]() { task(split_depth, 1); });
+    latch.Wait();
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(leaves - 1);
+    context.metrics().AddItems(leaves);
+    context.metrics().SetCustom("CRC", crc.load());
+}
+
+BENCHMARK("WaitQueuePool-submit", settings)
+{
+    WaitQueuePool pool(context.x());
+    submit(context, pool);
+}
+
+BENCHMARK("ThreadPool-submit", settings)
+{
+    ThreadPool pool(context.x());
+    submit(context, pool);
+}
+
+BENCHMARK("ThreadPool<PhysicalCores>-submit", settings)
+{
+    ThreadPool pool(context.x(), ThreadPoolAffinity::PHYSICAL_CORES);
+    submit(context, pool);
+}
+
+BENCHMARK("WaitQueuePool-split", settings)
+{
+    WaitQueuePool pool(context.x());
+    split(context, pool);
+}
+
+BENCHMARK("ThreadPool-split", settings)
+{
+    ThreadPool pool(context.x());
+    split(context, pool);
+}
+
+BENCHMARK("ThreadPool<PhysicalCores>-split", settings)
+{
+    ThreadPool pool(context.x(), ThreadPoolAffinity::PHYSICAL_CORES);
+    split(context, pool);
+}
+
+BENCHMARK_REPORT_MAIN()
@@ -0,0 +1,140 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "benchmark_report.h"
+
+#include "common/function.h"
+#include "threads/timer_queue.h"
+
+#include <cstdint>
+#include <map>
+#include <vector>
+
+using namespace CppCommon;
+
+const uint64_t timers_to_schedule = 1000000;
+const uint64_t timers_active = 10000;
+
+// Hand-rolled timer queue around the ordered map with O(log N) schedule and cancel
+class MapTimerQueue
+{
+public:
+    typedef Function<void(), 256> Callback;
+    typedef uint64_t Handle;
+
+    MapTimerQueue() : _sequence(0) {}
+
+    template <class TCallback>
+    Handle Schedule(const Timestamp& deadline, TCallback&& callback)
+    {
+        Handle handle = ++_sequence;
+        _timers.emplace(std::make_pair(deadline.total(), handle), Callback(std::forward<TCallback>(callback)));
+        _deadlines.emplace(handle, deadline.total());
+        return handle;
+    }
+
+    bool Cancel(Handle handle)
+    {
+        auto it = _deadlines.find(handle);
+        if (it == _deadlines.end())
+            return false;
+        _timers.erase(std::make_pair(it->second, handle));
+        _deadlines.erase(it);
+        return true;
+    }
+
+    size_t Tick(const Timestamp& now)
+    {
+        size_t result = 0;
+        while (!_timers.empty() && (_timers.begin()->first.first <= (uint64_t)now.total()))
+        {
+            auto it = _timers.begin();
+            Callback callback = std::move(it->second);
+            _deadlines.erase(it->first.second);
+            _timers.erase(it);
+            callback();
+            ++result;
+        }
+        return result;
+    }
+
+private:
+    Handle _sequence;
+    std::map<std::pair<uint64_t, Handle>, Callback> _timers;
+    std::map<Handle, uint64_t> _deadlines;
+};
+
+// Schedule timers with random deadlines and cancel most of them, as network timeouts do
+template <class TTimerQueue>
+void schedule_cancel(CppBenchmark::Context& context, TTimerQueue& timers)
+{
+    uint64_t crc = 0;
+    uint64_t random = 1;
+    Timestamp start = NanoTimestamp();
+
+    std::vector<typename TTimerQueue::Handle> handles(timers_active, 0);
+    for (uint64_t i = 0; i < timers_to_schedule; ++i)
+    {
+        random ^= random << 13;
+        random ^= random >> 7;
+        random ^= random << 17;
+
+        // Cancel the oldest active timer and schedule a new one
+        size_t index = (size_t)(i % timers_active);
+        if (handles[index] != 0)
+            timers.Cancel(handles[index]);
+        handles[index] = timers.Schedule(start + Timespan::microseconds(1000 + (int64_t)(random % 30000)), [&crc, i]() { crc += i; });
+
+        // Fire some of timers with the moving time
+        if ((i % 1000) == 0)
+            crc += timers.Tick(start + Timespan::microseconds((int64_t)i));
+    }
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(timers_to_schedule - 1);
+    context.metrics().SetCustom("CRC", crc);
+}
+
+// Schedule timers and fire all of them
+template <class TTimerQueue>
+void schedule_fire(CppBenchmark::Context& context, TTimerQueue& timers)
+{
+    uint64_t crc = 0;
+    Timestamp start = NanoTimestamp();
+
+    for (uint64_t i = 0; i < timers_to_schedule; ++i)
+        timers.Schedule(start + Timespan::microseconds((int64_t)((i * 7919) % timers_to_schedule)), [&crc, i]() { crc += i; });
+    for (uint64_t i = 0; i <= timers_to_schedule; i += 1000)
+        timers.Tick(start + Timespan::microseconds((int64_t)i));
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(timers_to_schedule - 1);
+    context.metrics().SetCustom("CRC", crc);
+}
+
+BENCHMARK("MapTimerQueue-schedule-cancel")
+{
+    MapTimerQueue timers;
+    schedule_cancel(context, timers);
+}
+
+BENCHMARK("TimerQueue-schedule-cancel")
+{
+    TimerQueue timers;
+    schedule_cancel(context, timers);
+}
+
+BENCHMARK("MapTimerQueue-schedule-fire")
+{
+    MapTimerQueue timers;
+    schedule_fire(context, timers);
+}
+
+BENCHMARK("TimerQueue-schedule-fire")
+{
+    TimerQueue timers;
+    schedule_fire(context, timers);
+}
+
+BENCHMARK_REPORT_MAIN()
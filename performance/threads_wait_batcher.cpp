@@ -2,7 +2,7 @@
 // Created by Ivan Shynkarenka on 13.03.2019
 //
 
-#include "benchmark/cppbenchmark.h"
+#include "benchmark_report.h"
 
 #include "threads/wait_batcher.h"
 
@@ -78,4 +78,4 @@ BENCHMARK("WaitBatcher-producers", settings)
     produce_consume<int>(context);
 }
 
-BENCHMARK_MAIN()
+BENCHMARK_REPORT_MAIN()
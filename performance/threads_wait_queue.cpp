@@ -2,9 +2,10 @@
 // Created by Ivan Shynkarenka on 05.10.2016
 //
 
-#include "benchmark/cppbenchmark.h"
+#include "benchmark_report.h"
 
 #include "threads/wait_queue.h"
+#include "queue_latency.h"
 
 #include <functional>
 #include <thread>
@@ -18,7 +19,7 @@ const int producers_to = 8;
 const auto settings = CppBenchmark::Settings().ParamRange(producers_from, producers_to, [](int from, int to, int& result) { int r = result; result *= 2; return r; });
 
 template<typename T>
-void produce_consume(CppBenchmark::Context& context)
+void produce_consume(CppBenchmark::Context& context, bool batch = false)
 {
     const int producers_count = context.x();
     uint64_t crc = 0;
@@ -27,8 +28,18 @@ void produce_consume(CppBenchmark::Context& context)
     WaitQueue<T> queue;
 
     // Start consumer thread
-    auto consumer = std::thread([&queue, &crc]()
+    auto consumer = std::thread([&queue, &crc, batch]()
     {
+        // Dequeue all available items at once or end consume
+        if (batch)
+        {
+            std::vector<T> items;
+            while (queue.Dequeue(items) > 0)
+                for (const auto& item : items)
+                    crc += item;
+            return;
+        }
+
         for (uint64_t i = 0; i < items_to_produce; ++i)
         {
             // Dequeue the item or end consume
@@ -79,4 +90,15 @@ BENCHMARK("WaitQueue-producers", settings)
     produce_consume<int>(context);
 }
 
-BENCHMARK_MAIN()
+BENCHMARK("WaitQueue-producers-batch", settings)
+{
+    produce_consume<int>(context, true);
+}
+
+BENCHMARK("WaitQueue-latency", latency_settings)
+{
+    WaitQueue<uint64_t> queue;
+    produce_consume_latency(context, queue, latency_producers, []{});
+}
+
+BENCHMARK_REPORT_MAIN()
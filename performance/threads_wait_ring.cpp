@@ -2,7 +2,7 @@
 // Created by Ivan Shynkarenka on 05.10.2016
 //
 
-#include "benchmark/cppbenchmark.h"
+#include "benchmark_report.h"
 
 #include "threads/wait_ring.h"
 
@@ -18,7 +18,7 @@ const int producers_to = 8;
 const auto settings = CppBenchmark::Settings().ParamRange(producers_from, producers_to, [](int from, int to, int& result) { int r = result; result *= 2; return r; });
 
 template<typename T, uint64_t N>
-void produce_consume(CppBenchmark::Context& context)
+void produce_consume(CppBenchmark::Context& context, bool batch = false)
 {
     const int producers_count = context.x();
     uint64_t crc = 0;
@@ -27,8 +27,18 @@ void produce_consume(CppBenchmark::Context& context)
     WaitRing<T> ring(N);
 
     // Start consumer thread
-    auto consumer = std::thread([&ring, &crc]()
+    auto consumer = std::thread([&ring, &crc, batch]()
     {
+        // Dequeue all available items at once or end consume
+        if (batch)
+        {
+            std::vector<T> items;
+            while (ring.Dequeue(items) > 0)
+                for (const auto& item : items)
+                    crc += item;
+            return;
+        }
+
         for (uint64_t i = 0; i < items_to_produce; ++i)
         {
             // Dequeue the item or end consume
@@ -80,4 +90,9 @@ BENCHMARK("WaitRing-producers", settings)
     produce_consume<int, 1048576>(context);
 }
 
-BENCHMARK_MAIN()
+BENCHMARK("WaitRing-producers-batch", settings)
+{
+    produce_consume<int, 1048576>(context, true);
+}
+
+BENCHMARK_REPORT_MAIN()
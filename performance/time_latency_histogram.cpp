@@ -0,0 +1,58 @@
+//
+// Created by Ivan Shynkarenka on 15.10.2026
+//
+
+#include "benchmark_report.h"
+
+#include "time/latency_histogram.h"
+
+#include <thread>
+#include <vector>
+
+using namespace CppCommon;
+
+const uint64_t items_to_record = 100000000;
+const int producers_from = 1;
+const int producers_to = 16;
+const auto settings = CppBenchmark::Settings().ParamRange(producers_from, producers_to, [](int from, int to, int& result) { int r = result; result *= 2; return r; });
+
+BENCHMARK("LatencyHistogram")
+{
+    LatencyHistogram histogram;
+
+    for (uint64_t i = 0; i < items_to_record; ++i)
+        histogram.Record(i);
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(items_to_record - 1);
+    context.metrics().SetCustom("p99", histogram.p99());
+}
+
+BENCHMARK("ConcurrentLatencyHistogram", settings)
+{
+    const int producers_count = context.x();
+
+    ConcurrentLatencyHistogram histogram;
+
+    // Start producer threads
+    std::vector<std::thread> producers;
+    for (int producer = 0; producer < producers_count; ++producer)
+    {
+        producers.emplace_back([&histogram, producers_count]()
+        {
+            uint64_t items = (items_to_record / producers_count);
+            for (uint64_t i = 0; i < items; ++i)
+                histogram.Record(i);
+        });
+    }
+
+    // Wait for all producers threads
+    for (auto& producer : producers)
+        producer.join();
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(items_to_record - 1);
+    context.metrics().SetCustom("p99", histogram.Snapshot().p99());
+}
+
+BENCHMARK_REPORT_MAIN()
@@ -2,7 +2,7 @@
 // Created by Ivan Shynkarenka on 13.07.2016
 //
 
-#include "benchmark/cppbenchmark.h"
+#include "benchmark_report.h"
 
 #include "time/time.h"
 
@@ -60,4 +60,76 @@ BENCHMARK("Time::localstamp()")
     context.metrics().SetCustom("CRC", crc);
 }
 
-BENCHMARK_MAIN()
+BENCHMARK("UtcTime(timestamp)")
+{
+    uint64_t crc = 0;
+
+    uint64_t timestamp = Timestamp::utc();
+    for (uint64_t i = 0; i < operations; ++i)
+        crc += UtcTime(Timestamp(timestamp + i * 1000)).second();
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(operations - 1);
+    context.metrics().SetCustom("CRC", crc);
+}
+
+BENCHMARK("LocalTime(timestamp)")
+{
+    uint64_t crc = 0;
+
+    uint64_t timestamp = Timestamp::utc();
+    for (uint64_t i = 0; i < operations; ++i)
+        crc += LocalTime(Timestamp(timestamp + i * 1000)).second();
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(operations - 1);
+    context.metrics().SetCustom("CRC", crc);
+}
+
+BENCHMARK("FormatISO8601()")
+{
+    uint64_t crc = 0;
+
+    char buffer[ISO8601_BUFFER_SIZE];
+    uint64_t timestamp = Timestamp::utc();
+    for (uint64_t i = 0; i < operations; ++i)
+        crc += FormatISO8601(buffer, Timestamp(timestamp + i * 1000)) + buffer[28];
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(operations - 1);
+    context.metrics().SetCustom("CRC", crc);
+}
+
+BENCHMARK("ParseISO8601()")
+{
+    uint64_t crc = 0;
+
+    char buffer[ISO8601_BUFFER_SIZE];
+    std::string_view str(buffer, FormatISO8601(buffer, UtcTimestamp()));
+    for (uint64_t i = 0; i < operations; ++i)
+    {
+        Timestamp timestamp;
+        buffer[28] = (char)('0' + (i % 10));
+        if (ParseISO8601(str, timestamp))
+            crc += timestamp.total();
+    }
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(operations - 1);
+    context.metrics().SetCustom("CRC", crc);
+}
+
+BENCHMARK("format(Timestamp)")
+{
+    uint64_t crc = 0;
+
+    uint64_t timestamp = Timestamp::utc();
+    for (uint64_t i = 0; i < operations; ++i)
+        crc += format("{}", Timestamp(timestamp + i * 1000)).size();
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(operations - 1);
+    context.metrics().SetCustom("CRC", crc);
+}
+
+BENCHMARK_REPORT_MAIN()
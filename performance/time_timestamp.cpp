@@ -2,9 +2,11 @@
 // Created by Ivan Shynkarenka on 26.01.2016
 //
 
-#include "benchmark/cppbenchmark.h"
+#include "benchmark_report.h"
 
+#include "time/coarse_clock.h"
 #include "time/timestamp.h"
+#include "time/tsc_clock.h"
 
 using namespace CppCommon;
 
@@ -70,4 +72,56 @@ BENCHMARK("RdtsTimestamp()")
     context.metrics().SetCustom("CRC", crc);
 }
 
-BENCHMARK_MAIN()
+BENCHMARK("TscTimestamp()")
+{
+    uint64_t crc = 0;
+
+    for (uint64_t i = 0; i < operations; ++i)
+        crc += TscTimestamp().total();
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(operations - 1);
+    context.metrics().SetCustom("CRC", crc);
+}
+
+BENCHMARK("CoarseTimestamp()")
+{
+    uint64_t crc = 0;
+
+    for (uint64_t i = 0; i < operations; ++i)
+        crc += CoarseTimestamp().total();
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(operations - 1);
+    context.metrics().SetCustom("CRC", crc);
+}
+
+BENCHMARK("CoarseTimestamp()-ticker")
+{
+    uint64_t crc = 0;
+
+    CoarseClock::Start();
+    for (uint64_t i = 0; i < operations; ++i)
+        crc += CoarseTimestamp().total();
+    CoarseClock::Stop();
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(operations - 1);
+    context.metrics().SetCustom("CRC", crc);
+}
+
+BENCHMARK("CoarseClock::nano()-ticker")
+{
+    uint64_t crc = 0;
+
+    CoarseClock::Start();
+    for (uint64_t i = 0; i < operations; ++i)
+        crc += CoarseClock::nano();
+    CoarseClock::Stop();
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(operations - 1);
+    context.metrics().SetCustom("CRC", crc);
+}
+
+BENCHMARK_REPORT_MAIN()
@@ -2,7 +2,7 @@
 // Created by Ivan Shynkarenka on 18.07.2016
 //
 
-#include "benchmark/cppbenchmark.h"
+#include "benchmark_report.h"
 
 #include "time/timezone.h"
 
@@ -34,4 +34,29 @@ BENCHMARK("Timezone::local()")
     context.metrics().SetCustom("CRC", crc);
 }
 
-BENCHMARK_MAIN()
+BENCHMARK("Timezone::LocalOffset()")
+{
+    uint64_t crc = 0;
+
+    uint64_t timestamp = Timestamp::utc();
+    for (uint64_t i = 0; i < operations; ++i)
+        crc += Timezone::LocalOffset(Timestamp(timestamp + i * 1000)).total();
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(operations - 1);
+    context.metrics().SetCustom("CRC", crc);
+}
+
+BENCHMARK("LocalTimestamp()")
+{
+    uint64_t crc = 0;
+
+    for (uint64_t i = 0; i < operations; ++i)
+        crc += LocalTimestamp().total();
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(operations - 1);
+    context.metrics().SetCustom("CRC", crc);
+}
+
+BENCHMARK_REPORT_MAIN()
@@ -0,0 +1,78 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "benchmark_report.h"
+
+#include "utility/endian.h"
+
+#include <cstring>
+#include <vector>
+
+using namespace CppCommon;
+
+const uint64_t operations = 10000;
+const size_t payload = 65536;
+
+class PayloadFixture
+{
+protected:
+    std::vector<uint8_t> bytes;
+    std::vector<uint16_t> values16;
+    std::vector<uint32_t> values32;
+    std::vector<uint64_t> values64;
+
+    PayloadFixture()
+    {
+        for (size_t i = 0; i < payload; ++i)
+            bytes.push_back((uint8_t)((i * 131) ^ (i >> 7)));
+        values16.resize(payload / sizeof(uint16_t));
+        values32.resize(payload / sizeof(uint32_t));
+        values64.resize(payload / sizeof(uint64_t));
+        std::memcpy(values16.data(), bytes.data(), payload);
+        std::memcpy(values32.data(), bytes.data(), payload);
+        std::memcpy(values64.data(), bytes.data(), payload);
+    }
+};
+
+BENCHMARK_FIXTURE(PayloadFixture, "Endian::ReadBigEndian(uint32_t)", operations)
+{
+    uint32_t sum = 0;
+    for (size_t i = 0; i < payload; i += sizeof(uint32_t))
+    {
+        uint32_t value;
+        Endian::ReadBigEndian(bytes.data() + i, value);
+        sum += value;
+    }
+    context.metrics().AddBytes(payload);
+    context.metrics().SetCustom("sum", sum);
+}
+
+BENCHMARK_FIXTURE(PayloadFixture, "Endian::LoadBigEndian<uint32_t>()", operations)
+{
+    uint32_t sum = 0;
+    for (size_t i = 0; i < payload; i += sizeof(uint32_t))
+        sum += Endian::LoadBigEndian<uint32_t>(bytes.data() + i);
+    context.metrics().AddBytes(payload);
+    context.metrics().SetCustom("sum", sum);
+}
+
+BENCHMARK_FIXTURE(PayloadFixture, "Endian::ByteSwap(span<uint16_t>)", operations)
+{
+    Endian::ByteSwap(values16);
+    context.metrics().AddBytes(payload);
+}
+
+BENCHMARK_FIXTURE(PayloadFixture, "Endian::ByteSwap(span<uint32_t>)", operations)
+{
+    Endian::ByteSwap(values32);
+    context.metrics().AddBytes(payload);
+}
+
+BENCHMARK_FIXTURE(PayloadFixture, "Endian::ByteSwap(span<uint64_t>)", operations)
+{
+    Endian::ByteSwap(values64);
+    context.metrics().AddBytes(payload);
+}
+
+BENCHMARK_REPORT_MAIN()
@@ -0,0 +1,41 @@
+//
+// Created by Ivan Shynkarenka on 15.10.2026
+//
+
+#ifndef CPPCOMMON_PERFORMANCE_ZIPFIAN_H
+#define CPPCOMMON_PERFORMANCE_ZIPFIAN_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+// Generate the sequence of keys from 0 to keys-1 with the Zipfian distribution,
+// where the key of the rank k is chosen with the probability proportional to 1/k^skew
+// (skew 0.99 is the default of YCSB workloads). Hot keys are scattered over the key
+// space, so they do not fall into the same shard of sharded caches.
+inline std::vector<uint64_t> ZipfianKeys(uint64_t count, uint64_t keys, double skew = 0.99, uint64_t seed = 0)
+{
+    // Cumulative distribution of key ranks
+    std::vector<double> cdf(keys);
+    double sum = 0.0;
+    for (uint64_t i = 0; i < keys; ++i)
+    {
+        sum += 1.0 / std::pow((double)(i + 1), skew);
+        cdf[i] = sum;
+    }
+
+    std::mt19937_64 generator(seed);
+    std::uniform_real_distribution<double> distribution(0.0, sum);
+
+    std::vector<uint64_t> result(count);
+    for (auto& key : result)
+    {
+        uint64_t rank = (uint64_t)(std::lower_bound(cdf.begin(), cdf.end(), distribution(generator)) - cdf.begin());
+        key = (std::min(rank, keys - 1) * 7919) % keys;
+    }
+    return result;
+}
+
+#endif // CPPCOMMON_PERFORMANCE_ZIPFIAN_H
@@ -0,0 +1,64 @@
+/*!
+    \file adler32.cpp
+    \brief Adler-32 checksum algorithm implementation
+    \author Ivan Shynkarenka
+    \date 15.10.2026
+    \copyright MIT License
+*/
+
+#include "algorithms/adler32.h"
+
+#include <algorithm>
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+namespace Internals {
+
+// Largest prime smaller than 65536
+const uint32_t ADLER32_BASE = 65521;
+// Largest count of bytes to process without 32-bit sums overflow
+const size_t ADLER32_NMAX = 5552;
+
+} // namespace Internals
+//! @endcond
+
+uint32_t Adler32::Calculate(const void* buffer, size_t size, uint32_t adler) noexcept
+{
+    const uint8_t* data = (const uint8_t*)buffer;
+
+    uint32_t a = adler & 0xFFFF;
+    uint32_t b = adler >> 16;
+
+    while (size > 0)
+    {
+        size_t block = std::min(size, Internals::ADLER32_NMAX);
+        size -= block;
+
+        while (block >= 8)
+        {
+            a += data[0]; b += a;
+            a += data[1]; b += a;
+            a += data[2]; b += a;
+            a += data[3]; b += a;
+            a += data[4]; b += a;
+            a += data[5]; b += a;
+            a += data[6]; b += a;
+            a += data[7]; b += a;
+            data += 8;
+            block -= 8;
+        }
+        while (block-- > 0)
+        {
+            a += *data++;
+            b += a;
+        }
+
+        a %= Internals::ADLER32_BASE;
+        b %= Internals::ADLER32_BASE;
+    }
+
+    return (b << 16) | a;
+}
+
+} // namespace CppCommon
@@ -0,0 +1,263 @@
+/*!
+    \file crc32c.cpp
+    \brief CRC-32C (Castagnoli) checksum algorithm implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "algorithms/crc32c.h"
+
+#include "system/cpu.h"
+
+#include <cstring>
+
+#if defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+#include <nmmintrin.h>
+#define CPPCOMMON_CRC32C_SSE42
+#define CPPCOMMON_CRC32C_TARGET
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__i386__) || defined(__x86_64__) || defined(__amd64__))
+#include <nmmintrin.h>
+#define CPPCOMMON_CRC32C_SSE42
+#define CPPCOMMON_CRC32C_TARGET __attribute__((target("sse4.2")))
+#elif defined(__aarch64__) && defined(__ARM_FEATURE_CRC32)
+#include <arm_acle.h>
+#define CPPCOMMON_CRC32C_ARM
+#define CPPCOMMON_CRC32C_TARGET
+#endif
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+namespace Internals {
+
+// CRC-32C reversed polynomial
+const uint32_t CRC32C_POLYNOMIAL = 0x82F63B78;
+
+class CRC32CTable
+{
+public:
+    CRC32CTable()
+    {
+        for (uint32_t i = 0; i < 256; ++i)
+        {
+            uint32_t crc = i;
+            for (int j = 0; j < 8; ++j)
+                crc = (crc >> 1) ^ ((crc & 1) ? CRC32C_POLYNOMIAL : 0);
+            table[0][i] = crc;
+        }
+        for (uint32_t i = 0; i < 256; ++i)
+            for (int j = 1; j < 8; ++j)
+                table[j][i] = (table[j - 1][i] >> 8) ^ table[0][table[j - 1][i] & 0xFF];
+    }
+
+    uint32_t table[8][256];
+};
+
+const CRC32CTable& GetTable() noexcept
+{
+    static const CRC32CTable instance;
+    return instance;
+}
+
+uint32_t CalculateSoftware(const uint8_t* data, size_t size, uint32_t crc) noexcept
+{
+    const auto& table = GetTable().table;
+
+    // Process unaligned head bytes
+    while ((size > 0) && (((uintptr_t)data & 7) != 0))
+    {
+        crc = (crc >> 8) ^ table[0][(crc ^ *data++) & 0xFF];
+        --size;
+    }
+
+    // Process 8 bytes at once with slicing-by-8 tables
+    while (size >= 8)
+    {
+        uint32_t low;
+        uint32_t high;
+        std::memcpy(&low, data, 4);
+        std::memcpy(&high, data + 4, 4);
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+        low = __builtin_bswap32(low);
+        high = __builtin_bswap32(high);
+#endif
+        low ^= crc;
+        crc = table[7][low & 0xFF] ^ table[6][(low >> 8) & 0xFF] ^ table[5][(low >> 16) & 0xFF] ^ table[4][low >> 24] ^
+              table[3][high & 0xFF] ^ table[2][(high >> 8) & 0xFF] ^ table[1][(high >> 16) & 0xFF] ^ table[0][high >> 24];
+        data += 8;
+        size -= 8;
+    }
+
+    // Process tail bytes
+    while (size-- > 0)
+        crc = (crc >> 8) ^ table[0][(crc ^ *data++) & 0xFF];
+
+    return crc;
+}
+
+#if defined(CPPCOMMON_CRC32C_SSE42)
+
+CPPCOMMON_CRC32C_TARGET inline uint32_t Hardware8(uint32_t crc, uint8_t value) noexcept
+{
+    return _mm_crc32_u8(crc, value);
+}
+
+CPPCOMMON_CRC32C_TARGET inline uint32_t Hardware64(uint32_t crc, const uint8_t* data) noexcept
+{
+#if defined(_M_X64) || defined(__x86_64__) || defined(__amd64__)
+    uint64_t value;
+    std::memcpy(&value, data, 8);
+    return (uint32_t)_mm_crc32_u64(crc, value);
+#else
+    uint32_t low;
+    uint32_t high;
+    std::memcpy(&low, data, 4);
+    std::memcpy(&high, data + 4, 4);
+    return _mm_crc32_u32(_mm_crc32_u32(crc, low), high);
+#endif
+}
+
+#elif defined(CPPCOMMON_CRC32C_ARM)
+
+inline uint32_t Hardware8(uint32_t crc, uint8_t value) noexcept
+{
+    return __crc32cb(crc, value);
+}
+
+inline uint32_t Hardware64(uint32_t crc, const uint8_t* data) noexcept
+{
+    uint64_t value;
+    std::memcpy(&value, data, 8);
+    return __crc32cd(crc, value);
+}
+
+#endif
+
+#if defined(CPPCOMMON_CRC32C_SSE42) || defined(CPPCOMMON_CRC32C_ARM)
+
+// Block sizes of three interleaved streams
+const size_t CRC32C_LONG = 8192;
+const size_t CRC32C_SHORT = 256;
+
+// Shift table applies the given count of zero bytes to the CRC register at once
+class CRC32CShiftTable
+{
+public:
+    explicit CRC32CShiftTable(size_t zeros)
+    {
+        const auto& crc = GetTable().table;
+
+        // Shift each register bit through zero bytes (shift is linear)
+        uint32_t basis[32];
+        for (int bit = 0; bit < 32; ++bit)
+        {
+            uint32_t value = (uint32_t)1 << bit;
+            for (size_t i = 0; i < zeros; ++i)
+                value = (value >> 8) ^ crc[0][value & 0xFF];
+            basis[bit] = value;
+        }
+
+        for (int i = 0; i < 4; ++i)
+        {
+            for (uint32_t j = 0; j < 256; ++j)
+            {
+                uint32_t value = 0;
+                for (int bit = 0; bit < 8; ++bit)
+                    if ((j & (1 << bit)) != 0)
+                        value ^= basis[i * 8 + bit];
+                table[i][j] = value;
+            }
+        }
+    }
+
+    uint32_t Shift(uint32_t crc) const noexcept
+    { return table[0][crc & 0xFF] ^ table[1][(crc >> 8) & 0xFF] ^ table[2][(crc >> 16) & 0xFF] ^ table[3][crc >> 24]; }
+
+    uint32_t table[4][256];
+};
+
+CPPCOMMON_CRC32C_TARGET inline uint32_t CalculateInterleaved(const uint8_t*& data, size_t& size, uint32_t crc, size_t block, const CRC32CShiftTable& shift) noexcept
+{
+    // Three independent streams hide the latency of the CRC32 instruction
+    while (size >= (3 * block))
+    {
+        uint32_t crc1 = 0;
+        uint32_t crc2 = 0;
+        const uint8_t* end = data + block;
+        do
+        {
+            crc = Hardware64(crc, data);
+            crc1 = Hardware64(crc1, data + block);
+            crc2 = Hardware64(crc2, data + 2 * block);
+            data += 8;
+        } while (data < end);
+
+        // Combine streams as if they were calculated sequentially
+        crc = shift.Shift(crc) ^ crc1;
+        crc = shift.Shift(crc) ^ crc2;
+
+        data += 2 * block;
+        size -= 3 * block;
+    }
+    return crc;
+}
+
+CPPCOMMON_CRC32C_TARGET uint32_t CalculateHardware(const uint8_t* data, size_t size, uint32_t crc) noexcept
+{
+    // Process unaligned head bytes
+    while ((size > 0) && (((uintptr_t)data & 7) != 0))
+    {
+        crc = Hardware8(crc, *data++);
+        --size;
+    }
+
+    // Process large buffers in three interleaved streams
+    if (size >= (3 * CRC32C_SHORT))
+    {
+        static const CRC32CShiftTable long_shift(CRC32C_LONG);
+        static const CRC32CShiftTable short_shift(CRC32C_SHORT);
+        crc = CalculateInterleaved(data, size, crc, CRC32C_LONG, long_shift);
+        crc = CalculateInterleaved(data, size, crc, CRC32C_SHORT, short_shift);
+    }
+
+    // Process 8 bytes at once
+    while (size >= 8)
+    {
+        crc = Hardware64(crc, data);
+        data += 8;
+        size -= 8;
+    }
+
+    // Process tail bytes
+    while (size-- > 0)
+        crc = Hardware8(crc, *data++);
+
+    return crc;
+}
+
+#endif
+
+} // namespace Internals
+//! @endcond
+
+bool CRC32C::IsHardwareSupported() noexcept
+{
+#if defined(CPPCOMMON_CRC32C_SSE42) || defined(CPPCOMMON_CRC32C_ARM)
+    return CPU::HasCRC32();
+#else
+    return false;
+#endif
+}
+
+uint32_t CRC32C::Calculate(const void* buffer, size_t size, uint32_t crc) noexcept
+{
+#if defined(CPPCOMMON_CRC32C_SSE42) || defined(CPPCOMMON_CRC32C_ARM)
+    static const CPUDispatch<uint32_t(const uint8_t*, size_t, uint32_t)> dispatch([]() { return IsHardwareSupported() ? Internals::CalculateHardware : Internals::CalculateSoftware; });
+    return ~dispatch((const uint8_t*)buffer, size, ~crc);
+#else
+    return ~Internals::CalculateSoftware((const uint8_t*)buffer, size, ~crc);
+#endif
+}
+
+} // namespace CppCommon
@@ -0,0 +1,226 @@
+/*!
+    \file lz4.cpp
+    \brief LZ4 block compression algorithm implementation
+    \author Ivan Shynkarenka
+    \date 15.10.2026
+    \copyright MIT License
+*/
+
+#include "algorithms/lz4.h"
+
+#include <cstring>
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+namespace Internals {
+
+const size_t LZ4_MIN_MATCH = 4;
+// Last match must start at least 12 bytes before the end of the block
+const size_t LZ4_MF_LIMIT = 12;
+// Last 5 bytes of the block are always literals
+const size_t LZ4_LAST_LITERALS = 5;
+const size_t LZ4_MAX_OFFSET = 65535;
+const size_t LZ4_HASH_BITS = 12;
+
+inline uint32_t LZ4Read32(const uint8_t* data) noexcept
+{
+    uint32_t value;
+    std::memcpy(&value, data, sizeof(value));
+    return value;
+}
+
+inline uint32_t LZ4Hash(uint32_t value) noexcept
+{
+    return (value * 2654435761u) >> (32 - LZ4_HASH_BITS);
+}
+
+inline uint8_t* LZ4WriteLength(uint8_t* output, size_t length) noexcept
+{
+    while (length >= 255)
+    {
+        *output++ = 255;
+        length -= 255;
+    }
+    *output++ = (uint8_t)length;
+    return output;
+}
+
+inline uint8_t* LZ4WriteLiterals(uint8_t* output, const uint8_t* literals, size_t length, size_t match) noexcept
+{
+    // Token with the literals length and the match length
+    uint8_t* token = output++;
+    *token = (uint8_t)(((length >= 15) ? 15 : length) << 4);
+    if (length >= 15)
+        output = LZ4WriteLength(output, length - 15);
+    if (length > 0)
+        std::memcpy(output, literals, length);
+    output += length;
+
+    *token |= (uint8_t)((match >= 15) ? 15 : match);
+    return output;
+}
+
+} // namespace Internals
+//! @endcond
+
+size_t LZ4::Compress(const void* source, size_t size, void* destination, size_t capacity) noexcept
+{
+    using namespace Internals;
+
+    if (capacity < Bound(size))
+        return 0;
+
+    const uint8_t* input = (const uint8_t*)source;
+    const uint8_t* end = input + size;
+    const uint8_t* anchor = input;
+    uint8_t* output = (uint8_t*)destination;
+
+    if (size > LZ4_MF_LIMIT)
+    {
+        const uint8_t* mflimit = end - LZ4_MF_LIMIT;
+        const uint8_t* matchlimit = end - LZ4_LAST_LITERALS;
+
+        // Hash table keeps the last position of each hashed 4 bytes sequence
+        uint32_t table[1 << LZ4_HASH_BITS] = {};
+
+        const uint8_t* ip = input + 1;
+        table[LZ4Hash(LZ4Read32(input))] = 0;
+
+        while (ip < mflimit)
+        {
+            uint32_t hash = LZ4Hash(LZ4Read32(ip));
+            const uint8_t* ref = input + table[hash];
+            table[hash] = (uint32_t)(ip - input);
+
+            if (((size_t)(ip - ref) > LZ4_MAX_OFFSET) || (ref >= ip) || (LZ4Read32(ref) != LZ4Read32(ip)))
+            {
+                // Skip faster through incompressible data
+                ip += 1 + ((ip - anchor) >> 6);
+                continue;
+            }
+
+            // Extend the match backwards
+            while ((ip > anchor) && (ref > input) && (ip[-1] == ref[-1]))
+            {
+                --ip;
+                --ref;
+            }
+
+            // Extend the match forwards
+            const uint8_t* match = ip + LZ4_MIN_MATCH;
+            const uint8_t* reference = ref + LZ4_MIN_MATCH;
+            while ((match < matchlimit) && (*match == *reference))
+            {
+                ++match;
+                ++reference;
+            }
+
+            // Write the sequence
+            size_t length = (size_t)(match - ip) - LZ4_MIN_MATCH;
+            output = LZ4WriteLiterals(output, anchor, (size_t)(ip - anchor), length);
+            size_t offset = (size_t)(ip - ref);
+            *output++ = (uint8_t)offset;
+            *output++ = (uint8_t)(offset >> 8);
+            if (length >= 15)
+                output = LZ4WriteLength(output, length - 15);
+
+            ip = match;
+            anchor = ip;
+
+            // Hash the position before the next one to find repeated matches
+            if (ip < mflimit)
+                table[LZ4Hash(LZ4Read32(ip - 2))] = (uint32_t)(ip - 2 - input);
+        }
+    }
+
+    // Write the last literals
+    output = LZ4WriteLiterals(output, anchor, (size_t)(end - anchor), 0);
+
+    return (size_t)(output - (uint8_t*)destination);
+}
+
+size_t LZ4::Decompress(const void* source, size_t size, void* destination, size_t capacity, size_t prefix) noexcept
+{
+    const size_t error = (size_t)-1;
+
+    const uint8_t* input = (const uint8_t*)source;
+    const uint8_t* end = input + size;
+    uint8_t* output = (uint8_t*)destination;
+    uint8_t* limit = output + capacity;
+
+    if (size == 0)
+        return error;
+
+    while (input < end)
+    {
+        // Read the literals length
+        uint8_t token = *input++;
+        size_t length = token >> 4;
+        if (length == 15)
+        {
+            uint8_t value;
+            do
+            {
+                if (input >= end)
+                    return error;
+                value = *input++;
+                length += value;
+            } while (value == 255);
+        }
+
+        // Copy literals
+        if ((length > (size_t)(end - input)) || (length > (size_t)(limit - output)))
+            return error;
+        if (length > 0)
+            std::memcpy(output, input, length);
+        input += length;
+        output += length;
+
+        // Last sequence has only literals
+        if (input == end)
+            break;
+
+        // Read the match offset
+        if ((end - input) < 2)
+            return error;
+        size_t offset = input[0] | ((size_t)input[1] << 8);
+        input += 2;
+        if ((offset == 0) || (offset > ((size_t)(output - (uint8_t*)destination) + prefix)))
+            return error;
+
+        // Read the match length
+        length = token & 15;
+        if (length == 15)
+        {
+            uint8_t value;
+            do
+            {
+                if (input >= end)
+                    return error;
+                value = *input++;
+                length += value;
+            } while (value == 255);
+        }
+        length += Internals::LZ4_MIN_MATCH;
+        if (length > (size_t)(limit - output))
+            return error;
+
+        // Copy the match, overlapped matches are copied byte by byte
+        const uint8_t* match = output - offset;
+        if (offset >= length)
+        {
+            std::memcpy(output, match, length);
+            output += length;
+        }
+        else
+        {
+            for (size_t i = 0; i < length; ++i)
+                *output++ = *match++;
+        }
+    }
+
+    return (size_t)(output - (uint8_t*)destination);
+}
+
+} // namespace CppCommon
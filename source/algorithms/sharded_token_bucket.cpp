@@ -0,0 +1,67 @@
+/*!
+    \file sharded_token_bucket.cpp
+    \brief Sharded token bucket rate limit algorithm implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "algorithms/sharded_token_bucket.h"
+
+#include <algorithm>
+#include <thread>
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+namespace Internals {
+
+size_t ShardIndex()
+{
+    // Assign shards to threads in the round-robin order
+    static std::atomic<size_t> counter(0);
+    thread_local size_t index = counter.fetch_add(1, std::memory_order_relaxed);
+    return index;
+}
+
+} // namespace Internals
+//! @endcond
+
+ShardedTokenBucket::ShardedTokenBucket(uint64_t rate, uint64_t burst, uint64_t tolerance, size_t shards)
+    : _global(std::in_place, rate, burst),
+      _shards((shards > 0) ? shards : std::max(std::thread::hardware_concurrency(), 1u)),
+      _batch(1),
+      _buckets(std::make_unique<CacheAligned<Shard>[]>(_shards))
+{
+    // Default tolerance is 1% of the rate
+    if (tolerance == (uint64_t)-1)
+        tolerance = rate / 100;
+
+    // Batch of tokens could not exceed the burst of the global token bucket
+    _batch = std::clamp<uint64_t>(tolerance / _shards, 1, std::max<uint64_t>(burst, 1));
+}
+
+bool ShardedTokenBucket::Consume(uint64_t tokens)
+{
+    Shard& shard = _buckets[Internals::ShardIndex() % _shards].value();
+
+    // Lock-free shard tokens consume loop
+    uint64_t available = shard.tokens.load(std::memory_order_relaxed);
+    while (available >= tokens)
+    {
+        if (shard.tokens.compare_exchange_weak(available, available - tokens, std::memory_order_relaxed, std::memory_order_relaxed))
+            return true;
+    }
+
+    // Refill the shard in bulk from the global token bucket
+    if ((_batch > tokens) && _global->Consume(_batch))
+    {
+        shard.tokens.fetch_add(_batch - tokens, std::memory_order_relaxed);
+        return true;
+    }
+
+    // Consume the exact count of tokens from the global token bucket
+    return _global->Consume(tokens);
+}
+
+} // namespace CppCommon
@@ -8,15 +8,54 @@
 
 #include "algorithms/token_bucket.h"
 
+#include "threads/thread.h"
 #include "time/timestamp.h"
 
+#include <algorithm>
+#include <limits>
+
 namespace CppCommon {
 
 bool TokenBucket::Consume(uint64_t tokens)
 {
-    uint64_t now = Timestamp::nano();
+    return Acquire(tokens, 0) == 0;
+}
+
+Timespan TokenBucket::WaitTime(uint64_t tokens) const
+{
+    uint64_t burstTime = _time_per_burst.load(std::memory_order_relaxed);
+    uint64_t now = Timestamp::nano() + burstTime;
+    uint64_t delay = tokens * _time_per_token.load(std::memory_order_relaxed);
+    uint64_t minTime = now - burstTime;
+    uint64_t newTime = std::max(_time.load(std::memory_order_relaxed), minTime) + delay;
+
+    return Timespan((newTime > now) ? (int64_t)(newTime - now) : 0);
+}
+
+Timespan TokenBucket::Reserve(uint64_t tokens)
+{
+    return Timespan((int64_t)Acquire(tokens, std::numeric_limits<uint64_t>::max() - 1));
+}
+
+bool TokenBucket::ConsumeOrWaitFor(uint64_t tokens, const Timespan& timeout)
+{
+    uint64_t wait = Acquire(tokens, (uint64_t)std::max(timeout.total(), (int64_t)0));
+    if (wait == std::numeric_limits<uint64_t>::max())
+        return false;
+
+    // Sleep exactly until reserved tokens are accumulated
+    if (wait > 0)
+        Thread::SleepFor(Timespan((int64_t)wait));
+    return true;
+}
+
+uint64_t TokenBucket::Acquire(uint64_t tokens, uint64_t limit)
+{
+    // Shift the current time with the burst time, so the full burst is available even after the recent system start
+    uint64_t burstTime = _time_per_burst.load(std::memory_order_relaxed);
+    uint64_t now = Timestamp::nano() + burstTime;
     uint64_t delay = tokens * _time_per_token.load(std::memory_order_relaxed);
-    uint64_t minTime = now - _time_per_burst.load(std::memory_order_relaxed);
+    uint64_t minTime = now - burstTime;
     uint64_t oldTime = _time.load(std::memory_order_relaxed);
     uint64_t newTime = oldTime;
 
@@ -30,16 +69,17 @@ bool TokenBucket::Consume(uint64_t tokens)
         // Consume tokens
         newTime += delay;
 
-        // No more tokens left in the bucket
-        if (newTime > now)
-            return false;
+        // Tokens will not be accumulated in the bucket within the wait limit
+        uint64_t wait = (newTime > now) ? (newTime - now) : 0;
+        if (wait > limit)
+            return std::numeric_limits<uint64_t>::max();
 
         // Try to update the current time atomically
         if (_time.compare_exchange_weak(oldTime, newTime, std::memory_order_relaxed, std::memory_order_relaxed))
-            return true;
+            return wait;
 
         // Failed... Then retry consume tokens with a new time value
-        newTime = oldTime;
+        newTime = (minTime > oldTime) ? minTime : oldTime;
     }
 }
 
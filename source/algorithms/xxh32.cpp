@@ -0,0 +1,152 @@
+/*!
+    \file xxh32.cpp
+    \brief XXH32 checksum algorithm implementation
+    \author Ivan Shynkarenka
+    \date 15.10.2026
+    \copyright MIT License
+*/
+
+#include "algorithms/xxh32.h"
+
+#include "utility/endian.h"
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+namespace Internals {
+
+// XXH32 primes
+const uint32_t XXH32_PRIME1 = 0x9E3779B1u;
+const uint32_t XXH32_PRIME2 = 0x85EBCA77u;
+const uint32_t XXH32_PRIME3 = 0xC2B2AE3Du;
+const uint32_t XXH32_PRIME4 = 0x27D4EB2Fu;
+const uint32_t XXH32_PRIME5 = 0x165667B1u;
+
+inline uint32_t XXH32Round(uint32_t lane, uint32_t input) noexcept
+{
+    lane += input * XXH32_PRIME2;
+    lane = std::rotl(lane, 13);
+    return lane * XXH32_PRIME1;
+}
+
+inline void XXH32Init(uint32_t lanes[4], uint32_t seed) noexcept
+{
+    lanes[0] = seed + XXH32_PRIME1 + XXH32_PRIME2;
+    lanes[1] = seed + XXH32_PRIME2;
+    lanes[2] = seed;
+    lanes[3] = seed - XXH32_PRIME1;
+}
+
+inline const uint8_t* XXH32Stripes(uint32_t lanes[4], const uint8_t* data, size_t count) noexcept
+{
+    for (size_t i = 0; i < count; ++i)
+    {
+        lanes[0] = XXH32Round(lanes[0], Endian::LoadLittleEndian<uint32_t>(data));
+        lanes[1] = XXH32Round(lanes[1], Endian::LoadLittleEndian<uint32_t>(data + 4));
+        lanes[2] = XXH32Round(lanes[2], Endian::LoadLittleEndian<uint32_t>(data + 8));
+        lanes[3] = XXH32Round(lanes[3], Endian::LoadLittleEndian<uint32_t>(data + 12));
+        data += 16;
+    }
+    return data;
+}
+
+uint32_t XXH32Finalize(const uint32_t lanes[4], uint32_t seed, uint64_t total, const uint8_t* data, size_t size) noexcept
+{
+    uint32_t hash;
+    if (total >= 16)
+        hash = std::rotl(lanes[0], 1) + std::rotl(lanes[1], 7) + std::rotl(lanes[2], 12) + std::rotl(lanes[3], 18);
+    else
+        hash = seed + XXH32_PRIME5;
+
+    // Total length is taken modulo 2^32
+    hash += (uint32_t)total;
+
+    // Process the remaining bytes
+    while (size >= 4)
+    {
+        hash += Endian::LoadLittleEndian<uint32_t>(data) * XXH32_PRIME3;
+        hash = std::rotl(hash, 17) * XXH32_PRIME4;
+        data += 4;
+        size -= 4;
+    }
+    while (size-- > 0)
+    {
+        hash += (*data++) * XXH32_PRIME5;
+        hash = std::rotl(hash, 11) * XXH32_PRIME1;
+    }
+
+    // Avalanche
+    hash ^= hash >> 15;
+    hash *= XXH32_PRIME2;
+    hash ^= hash >> 13;
+    hash *= XXH32_PRIME3;
+    hash ^= hash >> 16;
+    return hash;
+}
+
+} // namespace Internals
+//! @endcond
+
+void XXH32::Reset(uint32_t seed) noexcept
+{
+    _seed = seed;
+    _total = 0;
+    _buffered = 0;
+    Internals::XXH32Init(_lanes, seed);
+}
+
+XXH32& XXH32::Update(const void* buffer, size_t size) noexcept
+{
+    if (size == 0)
+        return *this;
+
+    const uint8_t* data = (const uint8_t*)buffer;
+
+    _total += size;
+
+    // Fill the buffered stripe
+    if (_buffered > 0)
+    {
+        size_t count = std::min(size, sizeof(_buffer) - _buffered);
+        std::memcpy(_buffer + _buffered, data, count);
+        _buffered += count;
+        data += count;
+        size -= count;
+
+        if (_buffered < sizeof(_buffer))
+            return *this;
+
+        Internals::XXH32Stripes(_lanes, _buffer, 1);
+        _buffered = 0;
+    }
+
+    // Process whole stripes directly from the buffer
+    data = Internals::XXH32Stripes(_lanes, data, size / 16);
+    size %= 16;
+
+    // Buffer the incomplete stripe
+    std::memcpy(_buffer, data, size);
+    _buffered = size;
+    return *this;
+}
+
+uint32_t XXH32::value() const noexcept
+{
+    return Internals::XXH32Finalize(_lanes, _seed, _total, _buffer, _buffered);
+}
+
+uint32_t XXH32::Calculate(const void* buffer, size_t size, uint32_t seed) noexcept
+{
+    const uint8_t* data = (const uint8_t*)buffer;
+
+    uint32_t lanes[4];
+    Internals::XXH32Init(lanes, seed);
+    data = Internals::XXH32Stripes(lanes, data, size / 16);
+    return Internals::XXH32Finalize(lanes, seed, size, data, size % 16);
+}
+
+} // namespace CppCommon
@@ -0,0 +1,170 @@
+/*!
+    \file xxh64.cpp
+    \brief XXH64 checksum algorithm implementation
+    \author Ivan Shynkarenka
+    \date 15.10.2026
+    \copyright MIT License
+*/
+
+#include "algorithms/xxh64.h"
+
+#include "utility/endian.h"
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+namespace Internals {
+
+// XXH64 primes
+const uint64_t XXH64_PRIME1 = 0x9E3779B185EBCA87ull;
+const uint64_t XXH64_PRIME2 = 0xC2B2AE3D27D4EB4Full;
+const uint64_t XXH64_PRIME3 = 0x165667B19E3779F9ull;
+const uint64_t XXH64_PRIME4 = 0x85EBCA77C2B2AE63ull;
+const uint64_t XXH64_PRIME5 = 0x27D4EB2F165667C5ull;
+
+inline uint64_t XXH64Round(uint64_t lane, uint64_t input) noexcept
+{
+    lane += input * XXH64_PRIME2;
+    lane = std::rotl(lane, 31);
+    return lane * XXH64_PRIME1;
+}
+
+inline uint64_t XXH64Merge(uint64_t hash, uint64_t lane) noexcept
+{
+    hash ^= XXH64Round(0, lane);
+    return hash * XXH64_PRIME1 + XXH64_PRIME4;
+}
+
+inline void XXH64Init(uint64_t lanes[4], uint64_t seed) noexcept
+{
+    lanes[0] = seed + XXH64_PRIME1 + XXH64_PRIME2;
+    lanes[1] = seed + XXH64_PRIME2;
+    lanes[2] = seed;
+    lanes[3] = seed - XXH64_PRIME1;
+}
+
+inline const uint8_t* XXH64Stripes(uint64_t lanes[4], const uint8_t* data, size_t count) noexcept
+{
+    for (size_t i = 0; i < count; ++i)
+    {
+        lanes[0] = XXH64Round(lanes[0], Endian::LoadLittleEndian<uint64_t>(data));
+        lanes[1] = XXH64Round(lanes[1], Endian::LoadLittleEndian<uint64_t>(data + 8));
+        lanes[2] = XXH64Round(lanes[2], Endian::LoadLittleEndian<uint64_t>(data + 16));
+        lanes[3] = XXH64Round(lanes[3], Endian::LoadLittleEndian<uint64_t>(data + 24));
+        data += 32;
+    }
+    return data;
+}
+
+uint64_t XXH64Finalize(const uint64_t lanes[4], uint64_t seed, uint64_t total, const uint8_t* data, size_t size) noexcept
+{
+    uint64_t hash;
+    if (total >= 32)
+    {
+        hash = std::rotl(lanes[0], 1) + std::rotl(lanes[1], 7) + std::rotl(lanes[2], 12) + std::rotl(lanes[3], 18);
+        hash = XXH64Merge(hash, lanes[0]);
+        hash = XXH64Merge(hash, lanes[1]);
+        hash = XXH64Merge(hash, lanes[2]);
+        hash = XXH64Merge(hash, lanes[3]);
+    }
+    else
+        hash = seed + XXH64_PRIME5;
+
+    hash += total;
+
+    // Process the remaining bytes
+    while (size >= 8)
+    {
+        hash ^= XXH64Round(0, Endian::LoadLittleEndian<uint64_t>(data));
+        hash = std::rotl(hash, 27) * XXH64_PRIME1 + XXH64_PRIME4;
+        data += 8;
+        size -= 8;
+    }
+    if (size >= 4)
+    {
+        hash ^= (uint64_t)Endian::LoadLittleEndian<uint32_t>(data) * XXH64_PRIME1;
+        hash = std::rotl(hash, 23) * XXH64_PRIME2 + XXH64_PRIME3;
+        data += 4;
+        size -= 4;
+    }
+    while (size-- > 0)
+    {
+        hash ^= (*data++) * XXH64_PRIME5;
+        hash = std::rotl(hash, 11) * XXH64_PRIME1;
+    }
+
+    // Avalanche
+    hash ^= hash >> 33;
+    hash *= XXH64_PRIME2;
+    hash ^= hash >> 29;
+    hash *= XXH64_PRIME3;
+    hash ^= hash >> 32;
+    return hash;
+}
+
+} // namespace Internals
+//! @endcond
+
+void XXH64::Reset(uint64_t seed) noexcept
+{
+    _seed = seed;
+    _total = 0;
+    _buffered = 0;
+    Internals::XXH64Init(_lanes, seed);
+}
+
+XXH64& XXH64::Update(const void* buffer, size_t size) noexcept
+{
+    if (size == 0)
+        return *this;
+
+    const uint8_t* data = (const uint8_t*)buffer;
+
+    _total += size;
+
+    // Fill the buffered stripe
+    if (_buffered > 0)
+    {
+        size_t count = std::min(size, sizeof(_buffer) - _buffered);
+        std::memcpy(_buffer + _buffered, data, count);
+        _buffered += count;
+        data += count;
+        size -= count;
+
+        if (_buffered < sizeof(_buffer))
+            return *this;
+
+        Internals::XXH64Stripes(_lanes, _buffer, 1);
+        _buffered = 0;
+    }
+
+    // Process whole stripes directly from the buffer
+    data = Internals::XXH64Stripes(_lanes, data, size / 32);
+    size %= 32;
+
+    // Buffer the incomplete stripe
+    std::memcpy(_buffer, data, size);
+    _buffered = size;
+    return *this;
+}
+
+uint64_t XXH64::value() const noexcept
+{
+    return Internals::XXH64Finalize(_lanes, _seed, _total, _buffer, _buffered);
+}
+
+uint64_t XXH64::Calculate(const void* buffer, size_t size, uint64_t seed) noexcept
+{
+    const uint8_t* data = (const uint8_t*)buffer;
+
+    uint64_t lanes[4];
+    Internals::XXH64Init(lanes, seed);
+    data = Internals::XXH64Stripes(lanes, data, size / 32);
+    return Internals::XXH64Finalize(lanes, seed, size, data, size % 32);
+}
+
+} // namespace CppCommon
@@ -8,26 +8,56 @@
 
 #include "cache/filecache.h"
 
+#include "threads/thread.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <exception>
+
 namespace CppCommon {
 
+CacheMetrics FileCache::metrics() const
+{
+    std::shared_lock<std::shared_mutex> locker(_lock);
+
+    CacheMetrics result;
+    result.size = _entries_by_key.size();
+    result.weight = _bytes;
+    _counters.Accumulate(result);
+    return result;
+}
+
+FileCache::~FileCache()
+{
+    // Unsubscribe from the memory pressure notifier (waits for the running shrink)
+    shrink_on_pressure(nullptr);
+}
+
 bool FileCache::emplace(std::string&& key, std::string&& value, const Timespan& timeout)
 {
     std::unique_lock<std::shared_mutex> locker(_lock);
 
+    const size_t size = value.size();
+
     // Try to find and remove the previous key
     remove_internal(key);
 
     // Update the cache entry
+    EntryMap::iterator it;
     if (timeout.total() > 0)
     {
         Timestamp current = UtcTimestamp();
         _timestamp = (current <= _timestamp) ? _timestamp + 1 : current;
-        _entries_by_key.insert(std::make_pair(key, MemCacheEntry(std::move(value), _timestamp, timeout)));
-        _entries_by_timestamp.insert(std::make_pair(_timestamp, key));
+        it = _entries_by_key.insert(std::make_pair(key, MemCacheEntry(std::move(value), _timestamp, timeout))).first;
+        _entries_by_timeout.insert(_timestamp + timeout, key);
     }
     else
-        _entries_by_key.emplace(std::make_pair(std::move(key), MemCacheEntry(std::move(value))));
+        it = _entries_by_key.emplace(std::make_pair(std::move(key), MemCacheEntry(std::move(value)))).first;
+    _entries_by_prefix.emplace(it->first, &(*it));
 
+    _bytes += size;
+    Internals::CacheCounters::Increment(_counters.inserts);
     return true;
 }
 
@@ -35,20 +65,43 @@ bool FileCache::insert(const std::string& key, const std::string& value, const T
 {
     std::unique_lock<std::shared_mutex> locker(_lock);
 
+    return insert_internal(key, MemCacheEntry(value), timeout);
+}
+
+bool FileCache::insert(const std::string& key, const std::shared_ptr<MappedFile>& file, const Timespan& timeout)
+{
+    if (!file)
+        return false;
+
+    std::unique_lock<std::shared_mutex> locker(_lock);
+
+    return insert_internal(key, MemCacheEntry(file), timeout);
+}
+
+bool FileCache::insert_internal(const std::string& key, MemCacheEntry&& entry, const Timespan& timeout)
+{
+    const size_t size = entry.bytes();
+
     // Try to find and remove the previous key
     remove_internal(key);
 
     // Update the cache entry
+    EntryMap::iterator it;
     if (timeout.total() > 0)
     {
         Timestamp current = UtcTimestamp();
         _timestamp = (current <= _timestamp) ? _timestamp + 1 : current;
-        _entries_by_key.insert(std::make_pair(key, MemCacheEntry(value, _timestamp, timeout)));
-        _entries_by_timestamp.insert(std::make_pair(_timestamp, key));
+        entry.timestamp = _timestamp;
+        entry.timespan = timeout;
+        it = _entries_by_key.insert(std::make_pair(key, std::move(entry))).first;
+        _entries_by_timeout.insert(_timestamp + timeout, key);
     }
     else
-        _entries_by_key.insert(std::make_pair(key, MemCacheEntry(value)));
+        it = _entries_by_key.insert(std::make_pair(key, std::move(entry))).first;
+    _entries_by_prefix.emplace(it->first, &(*it));
 
+    _bytes += size;
+    Internals::CacheCounters::Increment(_counters.inserts);
     return true;
 }
 
@@ -59,9 +112,13 @@ std::pair<bool, std::string_view> FileCache::find(const std::string& key)
     // Try to find the given key
     auto it = _entries_by_key.find(key);
     if (it == _entries_by_key.end())
+    {
+        Internals::CacheCounters::Increment(_counters.misses);
         return std::make_pair(false, std::string_view());
+    }
+    Internals::CacheCounters::Increment(_counters.hits);
 
-    return std::make_pair(true, std::string_view(it->second.value));
+    return std::make_pair(true, it->second.view());
 }
 
 std::pair<bool, std::string_view> FileCache::find(const std::string& key, Timestamp& timeout)
@@ -71,17 +128,104 @@ std::pair<bool, std::string_view> FileCache::find(const std::string& key, Timest
     // Try to find the given key
     auto it = _entries_by_key.find(key);
     if (it == _entries_by_key.end())
+    {
+        Internals::CacheCounters::Increment(_counters.misses);
         return std::make_pair(false, std::string_view());
+    }
+    Internals::CacheCounters::Increment(_counters.hits);
 
     timeout = it->second.timestamp + it->second.timespan;
-    return std::make_pair(true, std::string_view(it->second.value));
+    return std::make_pair(true, it->second.view());
+}
+
+std::pair<bool, std::string_view> FileCache::find(const std::string& key, const std::vector<std::string_view>& accepted, std::string_view& encoding)
+{
+    std::shared_lock<std::shared_mutex> locker(_lock);
+
+    // Try to find the given key
+    auto it = _entries_by_key.find(key);
+    if (it == _entries_by_key.end())
+    {
+        Internals::CacheCounters::Increment(_counters.misses);
+        return std::make_pair(false, std::string_view());
+    }
+    Internals::CacheCounters::Increment(_counters.hits);
+
+    // Find the smallest accepted variant
+    std::string_view result = it->second.view();
+    encoding = std::string_view();
+    for (const auto& variant : it->second.variants)
+    {
+        if ((variant.second.size() < result.size()) && (std::find(accepted.begin(), accepted.end(), variant.first) != accepted.end()))
+        {
+            result = variant.second;
+            encoding = variant.first;
+        }
+    }
+
+    return std::make_pair(true, result);
+}
+
+std::pair<bool, std::string_view> FileCache::find_route(std::string_view path, std::string& key)
+{
+    std::shared_lock<std::shared_mutex> locker(_lock);
+
+    // Try to find the whole path, then its parent prefixes from the longest one
+    key.assign(path);
+    while (!key.empty())
+    {
+        auto it = _entries_by_key.find(key);
+        if (it != _entries_by_key.end())
+        {
+            Internals::CacheCounters::Increment(_counters.hits);
+            return std::make_pair(true, it->second.view());
+        }
+
+        // Check the prefix with the trailing separator, then without it
+        if (key.back() == '/')
+            key.pop_back();
+        else
+        {
+            size_t separator = key.rfind('/');
+            if (separator == std::string::npos)
+                break;
+            key.resize(separator + 1);
+        }
+    }
+
+    Internals::CacheCounters::Increment(_counters.misses);
+    key.clear();
+    return std::make_pair(false, std::string_view());
+}
+
+std::vector<std::string> FileCache::find_prefix(std::string_view prefix) const
+{
+    std::shared_lock<std::shared_mutex> locker(_lock);
+
+    std::vector<std::string> result;
+    for (auto it = _entries_by_prefix.lower_bound(prefix); (it != _entries_by_prefix.end()) && it->first.starts_with(prefix); ++it)
+        result.emplace_back(it->first);
+    return result;
 }
 
 bool FileCache::remove(const std::string& key)
 {
     std::unique_lock<std::shared_mutex> locker(_lock);
 
-    return remove_internal(key);
+    if (!remove_internal(key))
+        return false;
+
+    Internals::CacheCounters::Increment(_counters.removes);
+    return true;
+}
+
+size_t FileCache::remove_prefix(std::string_view prefix)
+{
+    std::unique_lock<std::shared_mutex> locker(_lock);
+
+    size_t removed = remove_prefix_internal(prefix);
+    Internals::CacheCounters::Increment(_counters.removes, removed);
+    return removed;
 }
 
 bool FileCache::remove_internal(const std::string& key)
@@ -91,42 +235,142 @@ bool FileCache::remove_internal(const std::string& key)
     if (it == _entries_by_key.end())
         return false;
 
-    // Try to erase cache entry by timestamp
-    if (it->second.timestamp.total() > 0)
-        _entries_by_timestamp.erase(it->second.timestamp);
-
     // Erase cache entry
-    _entries_by_key.erase(it);
+    erase_internal(it);
 
     return true;
 }
 
-bool FileCache::insert_path(const CppCommon::Path& path, const std::string& prefix, const Timespan& timeout, const InsertHandler& handler)
+FileCache::EntryMap::iterator FileCache::erase_internal(EntryMap::iterator it)
+{
+    _bytes -= it->second.bytes();
+    _entries_by_prefix.erase(it->first);
+    return _entries_by_key.erase(it);
+}
+
+size_t FileCache::remove_prefix_internal(std::string_view prefix)
+{
+    size_t removed = 0;
+
+    // Visit only sorted cache keys with the given prefix
+    auto it = _entries_by_prefix.lower_bound(prefix);
+    while ((it != _entries_by_prefix.end()) && it->first.starts_with(prefix))
+    {
+        auto entry = _entries_by_key.find(it->second->first);
+        _bytes -= entry->second.bytes();
+        it = _entries_by_prefix.erase(it);
+        _entries_by_key.erase(entry);
+        ++removed;
+    }
+
+    return removed;
+}
+
+void FileCache::insert_batch_internal(EntryBatch& batch, const Timespan& timeout)
+{
+    if (batch.empty())
+        return;
+
+    std::unique_lock<std::shared_mutex> locker(_lock);
+
+    // Merge the whole batch of cache entries under the single lock
+    for (auto& entry : batch)
+        insert_internal(entry.first, std::move(entry.second), timeout);
+
+    batch.clear();
+}
+
+bool FileCache::insert_path(const CppCommon::Path& path, const std::string& prefix, const Timespan& timeout, const InsertHandler& handler, size_t threads, const Encoders& encoders)
+{
+    return insert_path_internal(path, FileCacheEntry(prefix, handler, threads, encoders, Timestamp(), timeout));
+}
+
+bool FileCache::insert_mapped_path(const CppCommon::Path& path, const std::string& prefix, const Timespan& timeout, const MappedInsertHandler& handler, size_t threads, const Encoders& encoders)
+{
+    return insert_path_internal(path, FileCacheEntry(prefix, handler, threads, encoders, Timestamp(), timeout));
+}
+
+void FileCache::encode_internal(const Encoders& encoders, MemCacheEntry& entry)
+{
+    const std::string_view content = entry.view();
+
+    // Precompute encoded variants which are smaller than the original content
+    for (const auto& encoder : encoders)
+    {
+        std::string output;
+        if (encoder.second(content, output) && (output.size() < content.size()))
+            entry.variants.emplace_back(encoder.first, std::move(output));
+    }
+}
+
+bool FileCache::insert_path_internal(const CppCommon::Path& path, FileCacheEntry&& entry)
 {
     // Try to find and remove the previous path
     remove_path_internal(path);
 
-    // Insert the cache path
-    if (!insert_path_internal(path, prefix, timeout, handler))
+    // Collect cache path files
+    FileList files;
+    if (!collect_path_internal(path, entry.prefix, files))
         return false;
 
-    std::unique_lock<std::shared_mutex> locker(_lock);
+    // Insert cache path files
+    if (!load_path_internal(files, entry.timespan, loader_internal(entry), entry.threads))
+        return false;
 
     // Update the cache path
-    if (timeout.total() > 0)
+    insert_path_entry(path, std::move(entry));
+    return true;
+}
+
+FileCache::FileLoader FileCache::loader_internal(const FileCacheEntry& entry)
+{
+    if (entry.mapped)
+    {
+        // Load cache files memory-mapped
+        return [this, &entry](const std::string& key, const CppCommon::Path& file, EntryBatch& batch)
+        {
+            auto mapped = std::make_shared<MappedFile>(file);
+            if (entry.mapped_handler)
+                return entry.mapped_handler(*this, key, mapped, entry.timespan);
+            MemCacheEntry value(mapped);
+            encode_internal(entry.encoders, value);
+            batch.emplace_back(key, std::move(value));
+            return true;
+        };
+    }
+    else
+    {
+        // Load cache files with content read into memory
+        return [this, &entry](const std::string& key, const CppCommon::Path& file, EntryBatch& batch)
+        {
+            auto content = CppCommon::File::ReadAllBytes(file);
+            std::string value(content.begin(), content.end());
+            if (entry.handler)
+                return entry.handler(*this, key, value, entry.timespan);
+            MemCacheEntry result(std::move(value));
+            encode_internal(entry.encoders, result);
+            batch.emplace_back(key, std::move(result));
+            return true;
+        };
+    }
+}
+
+void FileCache::insert_path_entry(const CppCommon::Path& path, FileCacheEntry&& entry)
+{
+    std::unique_lock<std::shared_mutex> locker(_lock);
+
+    if (entry.timespan.total() > 0)
     {
         Timestamp current = UtcTimestamp();
         _timestamp = (current <= _timestamp) ? _timestamp + 1 : current;
-        _paths_by_key.insert(std::make_pair(path, FileCacheEntry(prefix, handler, _timestamp, timeout)));
-        _paths_by_timestamp.insert(std::make_pair(_timestamp, path));
+        entry.timestamp = _timestamp;
+        _paths_by_timeout.insert(_timestamp + entry.timespan, path);
     }
-    else
-        _paths_by_key.insert(std::make_pair(path, FileCacheEntry(prefix, handler)));
 
-    return true;
+    _paths_by_key.insert(std::make_pair(path, std::move(entry)));
 }
 
-bool FileCache::insert_path_internal(const CppCommon::Path& path, const std::string& prefix, const Timespan& timeout, const InsertHandler& handler)
+bool FileCache::collect_path_internal(const CppCommon::Path& path, const std::string& prefix, FileList& files)
 {
     try
     {
@@ -135,27 +379,19 @@ bool FileCache::insert_path_internal(const CppCommon::Path& path, const std::str
         // Iterate through all directory entries
         for (const auto& item : CppCommon::Directory(path))
         {
-            const CppCommon::Path entry = item.IsSymlink() ? Symlink(item).target() : item;
-            const std::string key = key_prefix + CppCommon::Encoding::URLDecode(item.filename().string());
+            // Use the entry type cached by the directory iterator, only symbolic links require stat() call
+            const bool symlink = item.IsSymlink();
+            const CppCommon::Path entry = symlink ? Symlink(item).target() : static_cast<const CppCommon::Path&>(item);
+            const std::string key = key_prefix + CppCommon::Encoding::URLDecode(item.filename_view());
 
-            if (entry.IsDirectory())
+            if (symlink ? entry.IsDirectory() : item.IsDirectory())
             {
-                // Recursively insert sub-directory
-                if (!insert_path_internal(entry, key, timeout, handler))
+                // Recursively collect sub-directory
+                if (!collect_path_internal(entry, key, files))
                     return false;
             }
             else
-            {
-                try
-                {
-                    // Load the cache file content
-                    auto content = CppCommon::File::ReadAllBytes(entry);
-                    std::string value(content.begin(), content.end());
-                    if (!handler(*this, key, value, timeout))
-                        return false;
-                }
-                catch (const CppCommon::FileSystemException&) { return false; }
-            }
+                files.emplace_back(key, entry);
         }
 
         return true;
@@ -163,6 +399,68 @@ bool FileCache::insert_path_internal(const CppCommon::Path& path, const std::str
     catch (const CppCommon::FileSystemException&) { return false; }
 }
 
+bool FileCache::load_path_internal(const FileList& files, const Timespan& timeout, const FileLoader& loader, size_t threads)
+{
+    const size_t BATCH_SIZE = 64;
+
+    std::atomic<size_t> next(0);
+    std::atomic<bool> failed(false);
+    std::mutex exception_lock;
+    std::exception_ptr exception;
+
+    auto worker = [&]()
+    {
+        EntryBatch batch;
+        batch.reserve(BATCH_SIZE);
+
+        try
+        {
+            size_t index;
+            while (!failed && ((index = next++) < files.size()))
+            {
+                // Load the cache file
+                if (!loader(files[index].first, files[index].second, batch))
+                    failed = true;
+                else if (batch.size() >= BATCH_SIZE)
+                    insert_batch_internal(batch, timeout);
+            }
+        }
+        catch (const CppCommon::FileSystemException&)
+        {
+            failed = true;
+        }
+        catch (...)
+        {
+            std::scoped_lock locker(exception_lock);
+            if (!exception)
+                exception = std::current_exception();
+            failed = true;
+        }
+
+        // Merge the rest of loaded cache entries
+        insert_batch_internal(batch, timeout);
+    };
+
+    threads = std::min(threads, files.size());
+    if (threads > 1)
+    {
+        // Load cache files with the pool of worker threads
+        std::vector<std::thread> workers;
+        workers.reserve(threads);
+        for (size_t i = 0; i < threads; ++i)
+            workers.emplace_back(Thread::Start(worker));
+        for (auto& thread : workers)
+            thread.join();
+    }
+    else
+        worker();
+
+    if (exception)
+        std::rethrow_exception(exception);
+
+    return !failed;
+}
+
 bool FileCache::find_path(const CppCommon::Path& path)
 {
     std::shared_lock<std::shared_mutex> locker(_lock);
@@ -190,7 +488,129 @@ bool FileCache::find_path(const CppCommon::Path& path, Timestamp& timeout)
 
 bool FileCache::remove_path(const CppCommon::Path& path)
 {
-    return remove_path_internal(path);
+    if (!remove_path_internal(path))
+        return false;
+
+    std::scoped_lock locker(_watcher_lock);
+
+    // Stop watching the removed cache path
+    if (_watcher)
+        _watcher->Unwatch(path);
+
+    return true;
+}
+
+bool FileCache::watch_path(const CppCommon::Path& path)
+{
+    if (!find_path(path))
+        return false;
+
+    std::scoped_lock locker(_watcher_lock);
+
+    if (!_watcher)
+        _watcher = std::make_unique<DirectoryWatcher>();
+    _watcher->Watch(path);
+
+    return true;
+}
+
+size_t FileCache::refresh()
+{
+    std::vector<DirectoryEvent> events;
+
+    // Poll accumulated filesystem changes
+    {
+        std::scoped_lock locker(_watcher_lock);
+
+        if (!_watcher)
+            return 0;
+
+        events = _watcher->Poll();
+    }
+
+    size_t result = 0;
+    std::vector<CppCommon::Path> rescanned;
+
+    for (const auto& event : events)
+    {
+        // Skip changes of already reloaded cache paths
+        if (std::find(rescanned.begin(), rescanned.end(), event.root) != rescanned.end())
+            continue;
+
+        // Copy the cache path entry to reload files outside of the lock
+        FileCacheEntry entry;
+        {
+            std::shared_lock<std::shared_mutex> locker(_lock);
+
+            auto it = _paths_by_key.find(event.root);
+            if (it == _paths_by_key.end())
+                continue;
+
+            entry = it->second;
+        }
+
+        if (event.change == DirectoryChange::RESCAN)
+        {
+            // Reload the whole cache path
+            insert_path_internal(event.root, std::move(entry));
+            rescanned.push_back(event.root);
+            ++result;
+        }
+        else if (refresh_internal(event, entry))
+            ++result;
+    }
+
+    return result;
+}
+
+bool FileCache::refresh_internal(const DirectoryEvent& event, const FileCacheEntry& entry)
+{
+    const std::string key = key_internal(entry, event.root, event.path);
+
+    if (event.change == DirectoryChange::MODIFIED)
+    {
+        try
+        {
+            // Reload the changed file
+            EntryBatch batch;
+            if (!loader_internal(entry)(key, event.path, batch))
+                return false;
+            insert_batch_internal(batch, entry.timespan);
+            return true;
+        }
+        catch (const CppCommon::FileSystemException&) { return false; }
+    }
+
+    std::unique_lock<std::shared_mutex> locker(_lock);
+
+    // Remove the file or all files of the removed directory
+    size_t removed = remove_internal(key) ? 1 : 0;
+    removed += remove_prefix_internal(key + "/");
+
+    Internals::CacheCounters::Increment(_counters.removes, removed);
+    return (removed > 0);
+}
+
+std::string FileCache::key_internal(const FileCacheEntry& entry, const CppCommon::Path& root, const CppCommon::Path& path)
+{
+    std::string key = (entry.prefix.empty() || (entry.prefix == "/")) ? "" : entry.prefix;
+
+    // Build the cache key from URL decoded components of the relative path
+    const std::string& relative = path.string();
+    size_t start = root.string().size();
+    while (start < relative.size())
+    {
+        while ((start < relative.size()) && ((relative[start] == '/') || (relative[start] == '\\')))
+            ++start;
+        size_t end = start;
+        while ((end < relative.size()) && (relative[end] != '/') && (relative[end] != '\\'))
+            ++end;
+        if (end > start)
+            key += "/" + CppCommon::Encoding::URLDecode(relative.substr(start, end - start));
+        start = end;
+    }
+
+    return key;
 }
 
 bool FileCache::remove_path_internal(const CppCommon::Path& path)
@@ -202,72 +622,126 @@ bool FileCache::remove_path_internal(const CppCommon::Path& path)
     if (it == _paths_by_key.end())
         return false;
 
-    // Try to erase cache path by timestamp
-    if (it->second.timestamp.total() > 0)
-        _paths_by_timestamp.erase(it->second.timestamp);
-
     // Erase cache path
     _paths_by_key.erase(it);
 
     return true;
 }
 
+size_t FileCache::shrink(double fraction)
+{
+    std::unique_lock<std::shared_mutex> locker(_lock);
+
+    // Collect cache entries holding process memory
+    std::vector<std::pair<size_t, const std::string*>> candidates;
+    candidates.reserve(_entries_by_key.size());
+    for (const auto& entry : _entries_by_key)
+    {
+        size_t bytes = entry.second.bytes() - (entry.second.file ? entry.second.view().size() : 0);
+        if (bytes > 0)
+            candidates.emplace_back(bytes, &entry.first);
+    }
+
+    // Shed the largest cache entries first
+    size_t count = std::min((size_t)std::ceil(_entries_by_key.size() * std::min(std::max(fraction, 0.0), 1.0)), candidates.size());
+    std::partial_sort(candidates.begin(), candidates.begin() + count, candidates.end(), [](const auto& item1, const auto& item2) { return item1.first > item2.first; });
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        // Copy the key, because it is owned by the removed cache entry
+        std::string key = *candidates[i].second;
+        remove_internal(key);
+    }
+
+    Internals::CacheCounters::Increment(_counters.evictions, count);
+    return count;
+}
+
+void FileCache::shrink_on_pressure(MemoryPressure* pressure, double fraction)
+{
+    if (_pressure != nullptr)
+    {
+        _pressure->Unsubscribe(_pressure_id);
+        _pressure = nullptr;
+        _pressure_id = 0;
+    }
+
+    if (pressure != nullptr)
+    {
+        _pressure_id = pressure->Subscribe([this, fraction](const MemoryUsage&) { shrink(fraction); });
+        _pressure = pressure;
+    }
+}
+
 void FileCache::clear()
 {
     std::unique_lock<std::shared_mutex> locker(_lock);
 
     // Clear all cache entries
+    _bytes = 0;
     _entries_by_key.clear();
-    _entries_by_timestamp.clear();
+    _entries_by_prefix.clear();
+    _entries_by_timeout.clear();
     _paths_by_key.clear();
-    _paths_by_timestamp.clear();
+    _paths_by_timeout.clear();
+
+    locker.unlock();
+
+    // Stop watching all cache paths
+    std::scoped_lock watcher_locker(_watcher_lock);
+    _watcher.reset();
 }
 
-void FileCache::watchdog(const UtcTimestamp& utc)
+size_t FileCache::watchdog(const UtcTimestamp& utc, size_t limit)
 {
     std::unique_lock<std::shared_mutex> locker(_lock);
 
+    uint64_t start_time = Timestamp::nano();
+    size_t result = 0;
+
     // Watchdog for cache entries
-    auto it_entry_by_timestamp = _entries_by_timestamp.begin();
-    while (it_entry_by_timestamp != _entries_by_timestamp.end())
+    size_t processed = _entries_by_timeout.expire(utc, [this, &result](const Timestamp& expire, const std::string& key)
     {
-        // Check for the cache entry timeout
-        auto it_entry_by_key = _entries_by_key.find(it_entry_by_timestamp->second);
-        if ((it_entry_by_key->second.timestamp + it_entry_by_key->second.timespan) <= utc)
-        {
-            // Erase the cache entry with timeout
-            _entries_by_key.erase(it_entry_by_key);
-            _entries_by_timestamp.erase(it_entry_by_timestamp);
-            it_entry_by_timestamp = _entries_by_timestamp.begin();
-            continue;
-        }
-        else
-            break;
+        // Skip stale timers of removed or replaced cache entries
+        auto it = _entries_by_key.find(key);
+        if ((it == _entries_by_key.end()) || ((it->second.timestamp + it->second.timespan) != expire))
+            return;
+
+        // Erase the cache entry with timeout
+        erase_internal(it);
+        Internals::CacheCounters::Increment(_counters.expired);
+        ++result;
+    }, limit);
+
+    if ((limit > 0) && (processed >= limit))
+    {
+        _counters.Watchdog(Timestamp::nano() - start_time);
+        return result;
     }
 
     // Watchdog for cache paths
-    auto it_path_by_timestamp = _paths_by_timestamp.begin();
-    while (it_path_by_timestamp != _paths_by_timestamp.end())
+    std::vector<std::pair<CppCommon::Path, FileCacheEntry>> paths;
+    _paths_by_timeout.expire(utc, [this, &paths](const Timestamp& expire, const CppCommon::Path& path)
     {
-        // Check for the cache entry timeout
-        auto& it_path_by_key = _paths_by_key[it_path_by_timestamp->second];
-        if ((it_path_by_key.timestamp + it_path_by_key.timespan) <= utc)
-        {
-            // Update the cache path with timeout
-            auto path = it_path_by_timestamp->second;
-            auto prefix = it_path_by_key.prefix;
-            auto timespan = it_path_by_key.timespan;
-            auto handler = it_path_by_key.handler;
-            _paths_by_timestamp.erase(it_path_by_timestamp);
-            locker.unlock();
-            insert_path(path, prefix, timespan, handler);
-            locker.lock();
-            it_path_by_timestamp = _paths_by_timestamp.begin();
-            continue;
-        }
-        else
-            break;
+        // Skip stale timers of removed or replaced cache paths
+        auto it = _paths_by_key.find(path);
+        if ((it == _paths_by_key.end()) || ((it->second.timestamp + it->second.timespan) != expire))
+            return;
+
+        paths.emplace_back(path, it->second);
+    }, (limit > 0) ? (limit - processed) : 0);
+
+    locker.unlock();
+
+    // Update cache paths with timeout
+    for (auto& path : paths)
+    {
+        insert_path_internal(path.first, std::move(path.second));
+        ++result;
     }
+
+    _counters.Watchdog(Timestamp::nano() - start_time);
+    return result;
 }
 
 void FileCache::swap(FileCache& cache) noexcept
@@ -277,10 +751,15 @@ void FileCache::swap(FileCache& cache) noexcept
 
     using std::swap;
     swap(_timestamp, cache._timestamp);
+    swap(_bytes, cache._bytes);
     swap(_entries_by_key, cache._entries_by_key);
-    swap(_entries_by_timestamp, cache._entries_by_timestamp);
+    swap(_entries_by_prefix, cache._entries_by_prefix);
+    swap(_entries_by_timeout, cache._entries_by_timeout);
     swap(_paths_by_key, cache._paths_by_key);
-    swap(_paths_by_timestamp, cache._paths_by_timestamp);
+    swap(_paths_by_timeout, cache._paths_by_timeout);
+
+    std::scoped_lock watcher_locker(_watcher_lock, cache._watcher_lock);
+    swap(_watcher, cache._watcher);
 }
 
 } // namespace CppCommon
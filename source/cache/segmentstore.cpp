@@ -0,0 +1,415 @@
+/*!
+    \file segmentstore.cpp
+    \brief Segment store implementation
+    \author Ivan Shynkarenka
+    \date 15.10.2026
+    \copyright MIT License
+*/
+
+#include "cache/segmentstore.h"
+
+#include "algorithms/crc32c.h"
+#include "errors/fatal.h"
+#include "filesystem/directory.h"
+#include "filesystem/exceptions.h"
+#include "utility/endian.h"
+
+#include <cassert>
+#include <limits>
+#include <mutex>
+#include <vector>
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+namespace {
+
+// Value size of the remove record
+const uint32_t REMOVED = std::numeric_limits<uint32_t>::max();
+
+uint32_t RecordChecksum(const uint8_t* header, std::string_view key, std::string_view value) noexcept
+{
+    uint32_t crc = CRC32C::Calculate(header, 8);
+    crc = CRC32C::Calculate(key, crc);
+    return CRC32C::Calculate(value, crc);
+}
+
+} // namespace
+//! @endcond
+
+const size_t SegmentStore::HEADER_SIZE = 12;
+const size_t SegmentStore::DEFAULT_SEGMENT_SIZE = 64 * 1024 * 1024;
+
+SegmentStore::SegmentStore(const Path& path, size_t segment_size)
+    : _path(path), _segment_size(segment_size), _opened(false), _active(0)
+{
+}
+
+SegmentStore::~SegmentStore()
+{
+    try
+    {
+        if (IsOpened())
+            Close();
+    }
+    catch (const FileSystemException& ex)
+    {
+        fatality(FileSystemException(ex.string()).Attach(_path));
+    }
+}
+
+size_t SegmentStore::size() const
+{
+    std::shared_lock<std::shared_mutex> locker(_lock);
+    return _index.size();
+}
+
+size_t SegmentStore::segments() const
+{
+    std::shared_lock<std::shared_mutex> locker(_lock);
+    return _segments.size();
+}
+
+uint64_t SegmentStore::bytes() const
+{
+    std::shared_lock<std::shared_mutex> locker(_lock);
+
+    uint64_t result = 0;
+    for (const auto& segment : _segments)
+        result += segment.second->size;
+    return result;
+}
+
+uint64_t SegmentStore::garbage() const
+{
+    std::shared_lock<std::shared_mutex> locker(_lock);
+
+    uint64_t result = 0;
+    for (const auto& segment : _segments)
+        result += segment.second->garbage;
+    return result;
+}
+
+bool SegmentStore::IsOpened() const
+{
+    std::shared_lock<std::shared_mutex> locker(_lock);
+    return _opened;
+}
+
+void SegmentStore::Open()
+{
+    std::unique_lock<std::shared_mutex> locker(_lock);
+
+    assert(!_opened && "Segment store is already opened!");
+    if (_opened)
+        throwex FileSystemException("Segment store is already opened!").Attach(_path);
+
+    if (!_path.IsExists())
+        Directory::CreateTree(_path);
+
+    try
+    {
+        // Open existing segments in the order of their identifiers
+        for (const auto& entry : Directory(_path).GetEntries("[0-9]{8}\\.segment"))
+        {
+            uint32_t id = (uint32_t)std::stoul(entry.stem().string());
+            auto segment = std::make_unique<Segment>(entry);
+            segment->file.Open(true, true, false, File::DEFAULT_ATTRIBUTES, File::DEFAULT_PERMISSIONS, 0);
+            _segments.emplace(id, std::move(segment));
+        }
+
+        // Rebuild the index, later records override earlier ones
+        for (auto it = _segments.begin(); it != _segments.end(); ++it)
+            ScanSegment(it->first, *it->second, std::next(it) == _segments.end());
+
+        // Continue appending into the last segment
+        if (_segments.empty())
+            CreateSegment(1);
+        _active = _segments.rbegin()->first;
+    }
+    catch (...)
+    {
+        CloseSegments(_segments, false);
+        _index.clear();
+        throw;
+    }
+
+    _opened = true;
+}
+
+void SegmentStore::Close()
+{
+    std::unique_lock<std::shared_mutex> locker(_lock);
+
+    assert(_opened && "Segment store is not opened!");
+    if (!_opened)
+        throwex FileSystemException("Segment store is not opened!").Attach(_path);
+
+    _opened = false;
+    _index.clear();
+    CloseSegments(_segments, false);
+}
+
+void SegmentStore::insert(std::string_view key, std::string_view value)
+{
+    std::unique_lock<std::shared_mutex> locker(_lock);
+
+    assert(_opened && "Segment store is not opened!");
+    if (!_opened)
+        throwex FileSystemException("Segment store is not opened!").Attach(_path);
+
+    Location location = Append(key, value, false);
+
+    // Replace the location of the previous value
+    auto it = _index.find(key);
+    if (it != _index.end())
+    {
+        Discard(it->second);
+        it->second = location;
+    }
+    else
+        _index.emplace(key, location);
+}
+
+bool SegmentStore::find(std::string_view key) const
+{
+    std::shared_lock<std::shared_mutex> locker(_lock);
+    return _index.find(key) != _index.end();
+}
+
+bool SegmentStore::find(std::string_view key, std::string& value) const
+{
+    std::shared_lock<std::shared_mutex> locker(_lock);
+
+    auto it = _index.find(key);
+    if (it == _index.end())
+        return false;
+
+    // Positioned read is safe with the shared lock
+    const Location& location = it->second;
+    const Segment& segment = *_segments.at(location.segment);
+    value.resize(location.value_size);
+    if (segment.file.ReadAt(location.offset + HEADER_SIZE + location.key_size, value.data(), value.size()) != value.size())
+        throwex FileSystemException("Cannot read the value from the segment!").Attach(segment.file);
+
+    return true;
+}
+
+bool SegmentStore::remove(std::string_view key)
+{
+    std::unique_lock<std::shared_mutex> locker(_lock);
+
+    auto it = _index.find(key);
+    if (it == _index.end())
+        return false;
+
+    // Remove record is needed only until the compaction
+    Location location = Append(key, std::string_view(), true);
+    _segments.at(location.segment)->garbage += HEADER_SIZE + location.key_size;
+
+    Discard(it->second);
+    _index.erase(it);
+    return true;
+}
+
+void SegmentStore::clear()
+{
+    std::unique_lock<std::shared_mutex> locker(_lock);
+
+    assert(_opened && "Segment store is not opened!");
+    if (!_opened)
+        throwex FileSystemException("Segment store is not opened!").Attach(_path);
+
+    _index.clear();
+    CloseSegments(_segments, true);
+    _active = 1;
+    CreateSegment(_active);
+}
+
+void SegmentStore::Flush()
+{
+    std::shared_lock<std::shared_mutex> locker(_lock);
+
+    if (_opened)
+        _segments.at(_active)->file.FlushData();
+}
+
+uint64_t SegmentStore::Compact()
+{
+    std::unique_lock<std::shared_mutex> locker(_lock);
+
+    assert(_opened && "Segment store is not opened!");
+    if (!_opened)
+        throwex FileSystemException("Segment store is not opened!").Attach(_path);
+
+    uint64_t before = 0;
+    for (const auto& segment : _segments)
+        before += segment.second->size;
+
+    // Live records are appended into new segments after the active one
+    std::map<uint32_t, std::unique_ptr<Segment>> segments;
+    segments.swap(_segments);
+    try
+    {
+        CreateSegment(++_active);
+
+        std::string buffer;
+        for (auto& entry : _index)
+        {
+            Location& location = entry.second;
+            const Segment& segment = *segments.at(location.segment);
+            buffer.resize(location.value_size);
+            if (segment.file.ReadAt(location.offset + HEADER_SIZE + location.key_size, buffer.data(), buffer.size()) != buffer.size())
+                throwex FileSystemException("Cannot read the value from the segment!").Attach(segment.file);
+
+            location = Append(entry.first, buffer, false);
+        }
+    }
+    catch (...)
+    {
+        // Keep old segments, because the index might still point into them
+        _segments.merge(segments);
+        throw;
+    }
+
+    CloseSegments(segments, true);
+
+    uint64_t after = 0;
+    for (const auto& segment : _segments)
+        after += segment.second->size;
+
+    return (before > after) ? (before - after) : 0;
+}
+
+Path SegmentStore::SegmentPath(uint32_t id) const
+{
+    std::string name = std::to_string(id);
+    if (name.size() < 8)
+        name.insert(0, 8 - name.size(), '0');
+    return _path / (name + ".segment");
+}
+
+SegmentStore::Segment& SegmentStore::CreateSegment(uint32_t id)
+{
+    auto segment = std::make_unique<Segment>(SegmentPath(id));
+    segment->file.OpenOrCreate(true, true, true, File::DEFAULT_ATTRIBUTES, File::DEFAULT_PERMISSIONS, 0);
+    return *_segments.insert_or_assign(id, std::move(segment)).first->second;
+}
+
+void SegmentStore::ScanSegment(uint32_t id, Segment& segment, bool last)
+{
+    uint64_t total = segment.file.size();
+    uint64_t offset = 0;
+    std::vector<char> record;
+
+    while ((total - offset) >= HEADER_SIZE)
+    {
+        uint8_t header[12];
+        if (segment.file.ReadAt(offset, header, sizeof(header)) != sizeof(header))
+            break;
+
+        uint32_t key_size;
+        uint32_t value_size;
+        uint32_t crc;
+        Endian::ReadLittleEndian(header, key_size);
+        Endian::ReadLittleEndian(header + 4, value_size);
+        Endian::ReadLittleEndian(header + 8, crc);
+
+        // Incomplete record
+        bool removed = (value_size == REMOVED);
+        uint64_t size = (uint64_t)key_size + (removed ? 0 : value_size);
+        if (size > (total - offset - HEADER_SIZE))
+            break;
+
+        record.resize((size_t)size);
+        if (segment.file.ReadAt(offset + HEADER_SIZE, record.data(), record.size()) != record.size())
+            break;
+
+        // Corrupted record
+        std::string_view key(record.data(), key_size);
+        std::string_view value(record.data() + key_size, removed ? 0 : value_size);
+        if (RecordChecksum(header, key, value) != crc)
+            break;
+
+        Location location = { id, key_size, value_size, offset };
+        offset += HEADER_SIZE + size;
+
+        auto it = _index.find(key);
+        if (it != _index.end())
+            Discard(it->second);
+
+        if (removed)
+        {
+            segment.garbage += HEADER_SIZE + key_size;
+            if (it != _index.end())
+                _index.erase(it);
+        }
+        else if (it != _index.end())
+            it->second = location;
+        else
+            _index.emplace(key, location);
+    }
+
+    if (offset < total)
+    {
+        // Truncate the torn or corrupted tail of the last segment
+        if (last)
+        {
+            segment.file.Resize(offset);
+            segment.file.FlushData();
+        }
+        else
+        {
+            segment.garbage += total - offset;
+            offset = total;
+        }
+    }
+
+    segment.size = offset;
+}
+
+SegmentStore::Location SegmentStore::Append(std::string_view key, std::string_view value, bool removed)
+{
+    assert(((key.size() < REMOVED) && (value.size() < REMOVED)) && "Segment store record is too big!");
+    if ((key.size() >= REMOVED) || (value.size() >= REMOVED))
+        throwex FileSystemException("Segment store record is too big!").Attach(_path);
+
+    // Start a new segment when the active one is full
+    size_t size = HEADER_SIZE + key.size() + value.size();
+    Segment* segment = _segments.at(_active).get();
+    if ((segment->size > 0) && ((segment->size + size) > _segment_size))
+        segment = &CreateSegment(++_active);
+
+    uint8_t header[12];
+    Endian::WriteLittleEndian(header, (uint32_t)key.size());
+    Endian::WriteLittleEndian(header + 4, removed ? REMOVED : (uint32_t)value.size());
+    Endian::WriteLittleEndian(header + 8, RecordChecksum(header, key, value));
+
+    if (segment->file.WriteAt(segment->size, { { header, sizeof(header) }, { key.data(), key.size() }, { value.data(), value.size() } }) != size)
+        throwex FileSystemException("Cannot write the record into the segment!").Attach(segment->file);
+
+    Location location = { _active, (uint32_t)key.size(), removed ? REMOVED : (uint32_t)value.size(), segment->size };
+    segment->size += size;
+    return location;
+}
+
+void SegmentStore::Discard(const Location& location)
+{
+    auto it = _segments.find(location.segment);
+    if (it != _segments.end())
+        it->second->garbage += HEADER_SIZE + location.key_size + location.value_size;
+}
+
+void SegmentStore::CloseSegments(std::map<uint32_t, std::unique_ptr<Segment>>& segments, bool remove)
+{
+    for (auto& segment : segments)
+    {
+        if (segment.second->file.IsFileOpened())
+            segment.second->file.Close();
+        if (remove)
+            Path::Remove(segment.second->file);
+    }
+    segments.clear();
+}
+
+} // namespace CppCommon
@@ -0,0 +1,116 @@
+/*!
+    \file buffered_reader.cpp
+    \brief Buffered reader implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "common/buffered_reader.h"
+
+#include <cassert>
+#include <cstring>
+
+namespace CppCommon {
+
+const size_t BufferedReader::DEFAULT_BUFFER = 65536;
+
+BufferedReader::BufferedReader(Reader& reader, size_t buffer)
+    : _reader(&reader), _buffer((buffer > 0) ? buffer : 1), _begin(0), _end(0)
+{
+}
+
+std::span<const uint8_t> BufferedReader::Peek(size_t size)
+{
+    if (buffered() < size)
+    {
+        // Move buffered bytes to the beginning of the read buffer
+        if (_begin > 0)
+        {
+            std::memmove(_buffer.data(), _buffer.data() + _begin, buffered());
+            _end -= _begin;
+            _begin = 0;
+        }
+
+        // Grow the read buffer to fit the required size
+        if (_buffer.size() < size)
+            _buffer.resize(size);
+
+        while (_end < size)
+        {
+            size_t read = _reader->Read(_buffer.data() + _end, _buffer.size() - _end);
+            if (read == 0)
+                break;
+            _end += read;
+        }
+    }
+
+    return std::span<const uint8_t>(_buffer.data() + _begin, buffered());
+}
+
+void BufferedReader::Consume(size_t size) noexcept
+{
+    assert((size <= buffered()) && "Cannot consume more bytes than buffered!");
+    if (size > buffered())
+        size = buffered();
+
+    _begin += size;
+
+    // Reset the empty read buffer
+    if (_begin == _end)
+    {
+        _begin = 0;
+        _end = 0;
+    }
+}
+
+size_t BufferedReader::Read(void* buffer, size_t size)
+{
+    if ((buffer == nullptr) || (size == 0))
+        return 0;
+
+    uint8_t* bytes = (uint8_t*)buffer;
+    size_t counter = 0;
+
+    while (size > 0)
+    {
+        // Copy buffered bytes first
+        if (buffered() > 0)
+        {
+            size_t num = (size < buffered()) ? size : buffered();
+            std::memcpy(bytes, _buffer.data() + _begin, num);
+            Consume(num);
+            counter += num;
+            bytes += num;
+            size -= num;
+            continue;
+        }
+
+        // Read big buffers directly from the underlying reader
+        if (size >= _buffer.size())
+        {
+            size_t read = _reader->Read(bytes, size);
+            if (read == 0)
+                break;
+            counter += read;
+            bytes += read;
+            size -= read;
+            continue;
+        }
+
+        // Fill the read buffer
+        size_t read = _reader->Read(_buffer.data(), _buffer.size());
+        if (read == 0)
+            break;
+        _end = read;
+    }
+
+    return counter;
+}
+
+uint64_t BufferedReader::remaining() const
+{
+    return _reader->remaining() + buffered();
+}
+
+} // namespace CppCommon
@@ -0,0 +1,130 @@
+/*!
+    \file buffered_writer.cpp
+    \brief Buffered writer implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "common/buffered_writer.h"
+
+#include "errors/fatal.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <exception>
+
+namespace CppCommon {
+
+const size_t BufferedWriter::DEFAULT_BUFFER = 65536;
+
+BufferedWriter::BufferedWriter(Writer& writer, size_t buffer)
+    : _writer(&writer), _buffer((buffer > 0) ? buffer : 1), _size(0)
+{
+}
+
+BufferedWriter::~BufferedWriter()
+{
+    try
+    {
+        FlushBuffer();
+    }
+    catch (const std::exception& ex)
+    {
+        fatality(ex);
+    }
+}
+
+std::span<uint8_t> BufferedWriter::Prepare(size_t size)
+{
+    if ((_buffer.size() - _size) < size)
+    {
+        FlushBuffer();
+
+        // Grow the write buffer to fit the required size
+        if ((_buffer.size() - _size) < size)
+            _buffer.resize(_size + size);
+    }
+
+    return std::span<uint8_t>(_buffer.data() + _size, _buffer.size() - _size);
+}
+
+void BufferedWriter::Commit(size_t size) noexcept
+{
+    assert((size <= (_buffer.size() - _size)) && "Cannot commit more bytes than prepared!");
+    if (size > (_buffer.size() - _size))
+        size = _buffer.size() - _size;
+
+    _size += size;
+}
+
+size_t BufferedWriter::Write(const void* buffer, size_t size)
+{
+    if ((buffer == nullptr) || (size == 0))
+        return 0;
+
+    // Write big buffers directly into the underlying writer
+    if ((size > (_buffer.size() - _size)) && FlushBuffer() && (size >= _buffer.size()))
+        return _writer->Write(buffer, size);
+
+    // Copy the buffer into the write buffer
+    size_t num = std::min(size, _buffer.size() - _size);
+    std::memcpy(_buffer.data() + _size, buffer, num);
+    _size += num;
+    return num;
+}
+
+size_t BufferedWriter::WriteV(std::span<const WriteBuffer> buffers)
+{
+    size_t total = 0;
+    for (const auto& buffer : buffers)
+        total += buffer.size;
+
+    if (total > (_buffer.size() - _size))
+    {
+        // Write buffers one by one if the underlying writer is full
+        if (!FlushBuffer())
+            return Writer::WriteV(buffers);
+
+        // Write big buffers with one vectored write of the underlying writer
+        if (total >= _buffer.size())
+            return _writer->WriteV(buffers);
+    }
+
+    // Copy buffers into the write buffer
+    for (const auto& buffer : buffers)
+    {
+        if (buffer.size > 0)
+            std::memcpy(_buffer.data() + _size, buffer.data, buffer.size);
+        _size += buffer.size;
+    }
+    return total;
+}
+
+void BufferedWriter::Flush()
+{
+    FlushBuffer();
+    _writer->Flush();
+}
+
+bool BufferedWriter::FlushBuffer()
+{
+    size_t written = 0;
+    while (written < _size)
+    {
+        size_t size = _writer->Write(_buffer.data() + written, _size - written);
+        if (size == 0)
+            break;
+        written += size;
+    }
+
+    // Move not written bytes to the beginning of the write buffer
+    if ((written > 0) && (written < _size))
+        std::memmove(_buffer.data(), _buffer.data() + written, _size - written);
+    _size -= written;
+
+    return (_size == 0);
+}
+
+} // namespace CppCommon
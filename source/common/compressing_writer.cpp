@@ -0,0 +1,260 @@
+/*!
+    \file compressing_writer.cpp
+    \brief Compressing writer implementation
+    \author Ivan Shynkarenka
+    \date 15.10.2026
+    \copyright MIT License
+*/
+
+#include "common/compressing_writer.h"
+
+#include "algorithms/lz4.h"
+#include "errors/exceptions.h"
+#include "errors/fatal.h"
+#include "threads/thread_pool.h"
+
+#include <algorithm>
+#include <cstring>
+#include <exception>
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+namespace Internals {
+
+const uint32_t LZ4_FRAME_MAGIC = 0x184D2204;
+const uint32_t LZ4_FRAME_STORED = 0x80000000;
+
+inline void LZ4WriteLE32(uint8_t* buffer, uint32_t value) noexcept
+{
+    buffer[0] = (uint8_t)value;
+    buffer[1] = (uint8_t)(value >> 8);
+    buffer[2] = (uint8_t)(value >> 16);
+    buffer[3] = (uint8_t)(value >> 24);
+}
+
+} // namespace Internals
+//! @endcond
+
+const size_t CompressingWriter::DEFAULT_BLOCK = 262144;
+
+CompressingWriter::CompressingWriter(Writer& writer, size_t block, ThreadPool* pool)
+    : _writer(&writer),
+      _pool(pool),
+      _total(0),
+      _compressed(0),
+      _started(false)
+{
+    // Round up the block size to the nearest LZ4 frame block size
+    _block = 65536;
+    while ((_block < block) && (_block < 4194304))
+        _block *= 4;
+
+    // Limit the count of compressed blocks in flight
+    _inflight = (_pool != nullptr) ? std::max<size_t>(2, _pool->threads() * 2) : 1;
+}
+
+CompressingWriter::~CompressingWriter()
+{
+    try
+    {
+        if (_started || (_current && (_current->size > 0)))
+            Finish();
+    }
+    catch (const std::exception& ex)
+    {
+        fatality(ex);
+    }
+}
+
+size_t CompressingWriter::Write(const void* buffer, size_t size)
+{
+    if ((buffer == nullptr) || (size == 0))
+        return 0;
+
+    _checksum.Update(buffer, size);
+    _total += size;
+
+    const uint8_t* data = (const uint8_t*)buffer;
+    size_t remaining = size;
+    while (remaining > 0)
+    {
+        // Take the new block from the free list
+        if (!_current)
+        {
+            if (_free.empty())
+            {
+                _current = std::make_unique<Block>();
+                _current->raw.resize(_block);
+                _current->compressed.resize(LZ4::Bound(_block));
+            }
+            else
+            {
+                _current = std::move(_free.back());
+                _free.pop_back();
+            }
+        }
+
+        // Copy written bytes into the current block
+        size_t num = std::min(remaining, _block - _current->size);
+        std::memcpy(_current->raw.data() + _current->size, data, num);
+        _current->size += num;
+        data += num;
+        remaining -= num;
+
+        if (_current->size == _block)
+            Submit();
+    }
+
+    return size;
+}
+
+void CompressingWriter::Flush()
+{
+    Submit();
+    while (!_pending.empty())
+        WritePending();
+
+    _writer->Flush();
+}
+
+void CompressingWriter::Finish()
+{
+    if (!_started)
+        WriteHeader();
+
+    Submit();
+    while (!_pending.empty())
+        WritePending();
+
+    // Write the end mark and the content checksum
+    uint8_t footer[8];
+    Internals::LZ4WriteLE32(footer, 0);
+    Internals::LZ4WriteLE32(footer + 4, _checksum.value());
+    WriteBuffer buffers[] = { { footer, sizeof(footer) } };
+    WriteAll(buffers);
+
+    _started = false;
+    _checksum.Reset();
+
+    _writer->Flush();
+}
+
+void CompressingWriter::WriteHeader()
+{
+    // Frame descriptor: version 01, independent blocks, content checksum
+    uint8_t header[7];
+    Internals::LZ4WriteLE32(header, Internals::LZ4_FRAME_MAGIC);
+    header[4] = 0x40 | 0x20 | 0x04;
+    header[5] = 0x40;
+    for (size_t block = 262144; block <= _block; block *= 4)
+        header[5] += 0x10;
+    header[6] = (uint8_t)(XXH32::Calculate(header + 4, 2) >> 8);
+
+    WriteBuffer buffers[] = { { header, sizeof(header) } };
+    WriteAll(buffers);
+
+    _started = true;
+}
+
+void CompressingWriter::Submit()
+{
+    if (!_current || (_current->size == 0))
+        return;
+
+    if (!_started)
+        WriteHeader();
+
+    Block* block = _current.get();
+    _pending.emplace_back(std::move(_current));
+
+    if (_pool != nullptr)
+    {
+        _pool->Submit([this, block]()
+        {
+            Compress(*block);
+            std::scoped_lock locker(_lock);
+            block->done = true;
+            _cv.notify_all();
+        });
+    }
+    else
+    {
+        Compress(*block);
+        block->done = true;
+    }
+
+    // Write compressed blocks to limit the count of blocks in flight
+    while (_pending.size() >= _inflight)
+        WritePending();
+}
+
+void CompressingWriter::WritePending()
+{
+    Block& block = *_pending.front();
+
+    if (_pool != nullptr)
+    {
+        std::unique_lock<std::mutex> locker(_lock);
+        _cv.wait(locker, [&block]() { return block.done; });
+    }
+
+    uint8_t header[4];
+    Internals::LZ4WriteLE32(header, (uint32_t)block.length | (block.stored ? Internals::LZ4_FRAME_STORED : 0));
+    WriteBuffer buffers[] = { { header, sizeof(header) }, { block.stored ? block.raw.data() : block.compressed.data(), block.length } };
+    WriteAll(buffers);
+
+    // Return the written block to the free list
+    block.size = 0;
+    block.length = 0;
+    block.stored = false;
+    block.done = false;
+    _free.emplace_back(std::move(_pending.front()));
+    _pending.pop_front();
+}
+
+void CompressingWriter::WriteAll(std::span<const WriteBuffer> buffers)
+{
+    size_t total = 0;
+    for (const auto& buffer : buffers)
+        total += buffer.size;
+
+    size_t written = _writer->WriteV(buffers);
+
+    // Write the rest of incomplete vectored write buffer by buffer
+    size_t offset = 0;
+    for (size_t i = 0; (i < buffers.size()) && (written < total); ++i)
+    {
+        const uint8_t* data = (const uint8_t*)buffers[i].data;
+        size_t size = buffers[i].size;
+        for (size_t position = written - offset; position < size;)
+        {
+            size_t num = _writer->Write(data + position, size - position);
+            if (num == 0)
+                throwex SystemException("Cannot write the compressed block into the underlying writer!");
+            position += num;
+            written += num;
+        }
+        offset += size;
+    }
+
+    _compressed += total;
+}
+
+void CompressingWriter::Compress(Block& block)
+{
+    // Store the block uncompressed if the compression does not shrink it
+    size_t size = LZ4::Compress(block.raw.data(), block.size, block.compressed.data(), block.compressed.size());
+    if ((size == 0) || (size >= block.size))
+    {
+        block.length = block.size;
+        block.stored = true;
+    }
+    else
+    {
+        block.length = size;
+        block.stored = false;
+    }
+}
+
+} // namespace CppCommon
@@ -0,0 +1,226 @@
+/*!
+    \file decompressing_reader.cpp
+    \brief Decompressing reader implementation
+    \author Ivan Shynkarenka
+    \date 15.10.2026
+    \copyright MIT License
+*/
+
+#include "common/decompressing_reader.h"
+
+#include "algorithms/lz4.h"
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+namespace Internals {
+
+const uint32_t LZ4_FRAME_MAGIC = 0x184D2204;
+const uint32_t LZ4_SKIPPABLE_MAGIC = 0x184D2A50;
+const uint32_t LZ4_FRAME_STORED = 0x80000000;
+// Linked blocks refer up to 64 kilobytes of previous blocks
+const size_t LZ4_HISTORY = 65536;
+
+inline uint32_t LZ4ReadLE32(const uint8_t* buffer) noexcept
+{
+    return (uint32_t)buffer[0] | ((uint32_t)buffer[1] << 8) | ((uint32_t)buffer[2] << 16) | ((uint32_t)buffer[3] << 24);
+}
+
+} // namespace Internals
+//! @endcond
+
+DecompressingReader::DecompressingReader(Reader& reader)
+    : _reader(&reader),
+      _total(0),
+      _frame(false),
+      _linked(false),
+      _block_checksum(false),
+      _content_checksum(false),
+      _block(0),
+      _history(0),
+      _offset(0),
+      _size(0)
+{
+}
+
+size_t DecompressingReader::Read(void* buffer, size_t size)
+{
+    if ((buffer == nullptr) || (size == 0))
+        return 0;
+
+    while (_offset == _size)
+    {
+        if (!_frame && !ReadHeader())
+            return 0;
+        ReadBlock();
+    }
+
+    size_t num = std::min(size, _size - _offset);
+    std::memcpy(buffer, _output.data() + Internals::LZ4_HISTORY + _offset, num);
+    _offset += num;
+    _total += num;
+    return num;
+}
+
+bool DecompressingReader::ReadHeader()
+{
+    using namespace Internals;
+
+    for (;;)
+    {
+        uint8_t magic[4];
+        size_t size = ReadExact(magic, sizeof(magic));
+        if (size == 0)
+            return false;
+        if (size < sizeof(magic))
+            throw std::invalid_argument("Truncated LZ4 frame magic number!");
+
+        // Skip skippable frames
+        if ((LZ4ReadLE32(magic) & 0xFFFFFFF0) == LZ4_SKIPPABLE_MAGIC)
+        {
+            if (ReadExact(magic, sizeof(magic)) < sizeof(magic))
+                throw std::invalid_argument("Truncated LZ4 skippable frame size!");
+            uint32_t skip = LZ4ReadLE32(magic);
+            while (skip > 0)
+            {
+                uint8_t temp[4096];
+                size_t num = std::min<size_t>(skip, sizeof(temp));
+                if (ReadExact(temp, num) < num)
+                    throw std::invalid_argument("Truncated LZ4 skippable frame!");
+                skip -= (uint32_t)num;
+            }
+            continue;
+        }
+
+        if (LZ4ReadLE32(magic) != LZ4_FRAME_MAGIC)
+            throw std::invalid_argument("Invalid LZ4 frame magic number!");
+
+        // Read the frame descriptor: FLG, BD, optional content size and header checksum
+        uint8_t descriptor[11];
+        if (ReadExact(descriptor, 2) < 2)
+            throw std::invalid_argument("Truncated LZ4 frame descriptor!");
+        uint8_t flags = descriptor[0];
+        uint8_t bd = descriptor[1];
+        if ((flags >> 6) != 1)
+            throw std::invalid_argument("Unsupported LZ4 frame version!");
+        if (((flags & 0x02) != 0) || ((bd & 0x8F) != 0) || (((bd >> 4) & 7) < 4))
+            throw std::invalid_argument("Invalid LZ4 frame descriptor!");
+        if ((flags & 0x01) != 0)
+            throw std::invalid_argument("LZ4 frames with dictionary are not supported!");
+        size_t length = ((flags & 0x08) != 0) ? 10 : 2;
+        if (ReadExact(descriptor + 2, length - 2 + 1) < (length - 2 + 1))
+            throw std::invalid_argument("Truncated LZ4 frame descriptor!");
+        if (descriptor[length] != (uint8_t)(XXH32::Calculate(descriptor, length) >> 8))
+            throw std::invalid_argument("Invalid LZ4 frame header checksum!");
+
+        _frame = true;
+        _linked = ((flags & 0x20) == 0);
+        _block_checksum = ((flags & 0x10) != 0);
+        _content_checksum = ((flags & 0x04) != 0);
+        _block = (size_t)1 << (8 + 2 * ((bd >> 4) & 7));
+        _checksum.Reset();
+
+        _input.resize(_block);
+        _output.resize(LZ4_HISTORY + _block);
+        _history = 0;
+        _offset = 0;
+        _size = 0;
+        return true;
+    }
+}
+
+bool DecompressingReader::ReadBlock()
+{
+    using namespace Internals;
+
+    uint8_t header[4];
+    size_t size = ReadExact(header, sizeof(header));
+    if (size == 0)
+    {
+        // Unfinished frame is read up to the last complete block
+        _frame = false;
+        return false;
+    }
+    if (size < sizeof(header))
+        throw std::invalid_argument("Truncated LZ4 block size!");
+
+    uint32_t value = LZ4ReadLE32(header);
+
+    // Check the end mark and the content checksum
+    if (value == 0)
+    {
+        if (_content_checksum)
+        {
+            if (ReadExact(header, sizeof(header)) < sizeof(header))
+                throw std::invalid_argument("Truncated LZ4 content checksum!");
+            if (LZ4ReadLE32(header) != _checksum.value())
+                throw std::invalid_argument("Invalid LZ4 content checksum!");
+        }
+        _frame = false;
+        return false;
+    }
+
+    bool stored = ((value & LZ4_FRAME_STORED) != 0);
+    size_t length = value & ~LZ4_FRAME_STORED;
+    if (length > _block)
+        throw std::invalid_argument("Invalid LZ4 block size!");
+    if (ReadExact(_input.data(), length) < length)
+        throw std::invalid_argument("Truncated LZ4 block!");
+
+    if (_block_checksum)
+    {
+        if (ReadExact(header, sizeof(header)) < sizeof(header))
+            throw std::invalid_argument("Truncated LZ4 block checksum!");
+        if (LZ4ReadLE32(header) != XXH32::Calculate(_input.data(), length))
+            throw std::invalid_argument("Invalid LZ4 block checksum!");
+    }
+
+    // Keep the last 64 kilobytes of previous blocks just before the block
+    if (_linked)
+    {
+        size_t history = std::min(LZ4_HISTORY, _history + _size);
+        std::memmove(_output.data() + LZ4_HISTORY - history, _output.data() + LZ4_HISTORY + _size - history, history);
+        _history = history;
+    }
+
+    uint8_t* output = _output.data() + LZ4_HISTORY;
+    if (stored)
+    {
+        std::memcpy(output, _input.data(), length);
+        _size = length;
+    }
+    else
+    {
+        _size = LZ4::Decompress(_input.data(), length, output, _block, _history);
+        if (_size == (size_t)-1)
+        {
+            _size = 0;
+            throw std::invalid_argument("Invalid LZ4 block!");
+        }
+    }
+    _offset = 0;
+
+    if (_content_checksum)
+        _checksum.Update(output, _size);
+
+    return true;
+}
+
+size_t DecompressingReader::ReadExact(void* buffer, size_t size)
+{
+    size_t total = 0;
+    while (total < size)
+    {
+        size_t num = _reader->Read((uint8_t*)buffer + total, size - total);
+        if (num == 0)
+            break;
+        total += num;
+    }
+    return total;
+}
+
+} // namespace CppCommon
@@ -0,0 +1,186 @@
+/*!
+    \file line_reader.cpp
+    \brief Streaming line reader implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "common/line_reader.h"
+
+#include "string/string_utils.h"
+#include "system/cpu.h"
+
+#include <cstring>
+
+#if defined(_MSC_VER) && defined(_M_X64)
+#include <intrin.h>
+#include <immintrin.h>
+#define CPPCOMMON_LINE_READER_AVX2
+#define CPPCOMMON_LINE_READER_AVX2_TARGET
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__amd64__))
+#include <immintrin.h>
+#define CPPCOMMON_LINE_READER_AVX2
+#define CPPCOMMON_LINE_READER_AVX2_TARGET __attribute__((target("avx2")))
+#endif
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+namespace Internals {
+
+const char* FindNewlineScalar(const char* first, const char* last) noexcept
+{
+    if (first == last)
+        return last;
+
+    const void* found = std::memchr(first, '\n', (size_t)(last - first));
+    return (found != nullptr) ? (const char*)found : last;
+}
+
+#if defined(CPPCOMMON_LINE_READER_AVX2)
+
+CPPCOMMON_LINE_READER_AVX2_TARGET const char* FindNewlineAVX2(const char* first, const char* last) noexcept
+{
+    const __m256i newline = _mm256_set1_epi8('\n');
+
+    // Compare 64 characters at once
+    while ((last - first) >= 64)
+    {
+        __m256i chunk1 = _mm256_loadu_si256((const __m256i*)first);
+        __m256i chunk2 = _mm256_loadu_si256((const __m256i*)(first + 32));
+        uint32_t mask1 = (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(chunk1, newline));
+        uint32_t mask2 = (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(chunk2, newline));
+        uint64_t mask = ((uint64_t)mask2 << 32) | mask1;
+        if (mask != 0)
+        {
+#if defined(_MSC_VER)
+            unsigned long index;
+            _BitScanForward64(&index, mask);
+            return first + index;
+#else
+            return first + __builtin_ctzll(mask);
+#endif
+        }
+        first += 64;
+    }
+
+    return FindNewlineScalar(first, last);
+}
+
+#endif
+
+} // namespace Internals
+//! @endcond
+
+const size_t LineReader::DEFAULT_BUFFER = 65536;
+
+LineReader::LineReader(Reader& reader, size_t buffer)
+    : _reader(&reader), _buffer((buffer > 0) ? buffer : 1), _data(_buffer.data()), _begin(0), _scan(0), _end(0), _eof(false), _lines(0)
+{
+}
+
+LineReader::LineReader(std::string_view content) noexcept
+    : _reader(nullptr), _buffer(), _data(content.data()), _begin(0), _scan(0), _end(content.size()), _eof(true), _lines(0)
+{
+}
+
+const char* LineReader::FindNewline(const char* first, const char* last) noexcept
+{
+#if defined(CPPCOMMON_LINE_READER_AVX2)
+    static const CPUDispatch<const char*(const char*, const char*)> dispatch([]() { return CPU::HasAVX2() ? Internals::FindNewlineAVX2 : Internals::FindNewlineScalar; });
+    return dispatch(first, last);
+#else
+    return Internals::FindNewlineScalar(first, last);
+#endif
+}
+
+bool LineReader::ReadLine(std::string_view& line)
+{
+    for (;;)
+    {
+        // Scan only characters which were not scanned before
+        const char* found = FindNewline(_data + _scan, _data + _end);
+        if (found != (_data + _end))
+        {
+            size_t position = (size_t)(found - _data);
+            size_t length = position - _begin;
+            if ((length > 0) && (_data[position - 1] == '\r'))
+                --length;
+            line = std::string_view(_data + _begin, length);
+            _begin = _scan = position + 1;
+            ++_lines;
+            return true;
+        }
+        _scan = _end;
+
+        if (_eof || !Fill())
+        {
+            // Last line without the terminator
+            if (_begin == _end)
+                return false;
+            size_t length = _end - _begin;
+            if (_data[_end - 1] == '\r')
+                --length;
+            line = std::string_view(_data + _begin, length);
+            _begin = _scan = _end;
+            ++_lines;
+            return true;
+        }
+    }
+}
+
+bool LineReader::ReadRecord(std::vector<std::string_view>& fields, char delimiter, bool skip_empty)
+{
+    std::string_view line;
+    if (!ReadLine(line))
+    {
+        fields.clear();
+        return false;
+    }
+
+    StringUtils::Split(line, delimiter, fields, skip_empty);
+    return true;
+}
+
+bool LineReader::ReadRecord(std::vector<std::string_view>& fields, std::string_view delimiter, bool skip_empty)
+{
+    std::string_view line;
+    if (!ReadLine(line))
+    {
+        fields.clear();
+        return false;
+    }
+
+    StringUtils::Split(line, delimiter, fields, skip_empty);
+    return true;
+}
+
+bool LineReader::Fill()
+{
+    // Move the incomplete line to the beginning of the read buffer
+    if (_begin > 0)
+    {
+        std::memmove(_buffer.data(), _buffer.data() + _begin, _end - _begin);
+        _scan -= _begin;
+        _end -= _begin;
+        _begin = 0;
+    }
+
+    // Grow the read buffer to fit the long line
+    if (_end == _buffer.size())
+        _buffer.resize(_buffer.size() * 2);
+    _data = _buffer.data();
+
+    size_t size = _reader->Read(_buffer.data() + _end, _buffer.size() - _end);
+    if (size == 0)
+    {
+        _eof = true;
+        return false;
+    }
+
+    _end += size;
+    return true;
+}
+
+} // namespace CppCommon
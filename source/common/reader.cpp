@@ -8,54 +8,64 @@
 
 #include "common/reader.h"
 
-#include "utility/countof.h"
+#include "string/string_utils.h"
+
+#include <algorithm>
 
 namespace CppCommon {
 
-std::vector<uint8_t> Reader::ReadAllBytes()
+//! @cond INTERNALS
+namespace Internals {
+
+// Read all bytes directly into the result buffer
+template <class TBuffer>
+void ReadAll(Reader& reader, TBuffer& result)
 {
     const size_t PAGE = 8192;
 
-    uint8_t buffer[PAGE];
-    std::vector<uint8_t> result;
-    size_t size = 0;
+    // One more byte is reserved to detect the end of the reader without extra resize
+    uint64_t remaining = reader.remaining();
+    size_t capacity = std::max(PAGE, (size_t)std::min<uint64_t>(remaining + 1, (uint64_t)result.max_size()));
+    result.resize(capacity);
 
-    do
+    size_t size = 0;
+    for (;;)
     {
-        size = Read(buffer, countof(buffer));
-        result.insert(result.end(), buffer, buffer + size);
-    } while (size == countof(buffer));
+        if (size == result.size())
+            result.resize(result.size() * 2);
+
+        size_t read = reader.Read((uint8_t*)result.data() + size, result.size() - size);
+        if (read == 0)
+            break;
+        size += read;
+    }
+
+    result.resize(size);
+}
 
+} // namespace Internals
+//! @endcond
+
+std::vector<uint8_t> Reader::ReadAllBytes()
+{
+    std::vector<uint8_t> result;
+    Internals::ReadAll(*this, result);
     return result;
 }
 
 std::string Reader::ReadAllText()
 {
-    std::vector<uint8_t> bytes = ReadAllBytes();
-    return std::string(bytes.begin(), bytes.end());
+    std::string result;
+    Internals::ReadAll(*this, result);
+    return result;
 }
 
 std::vector<std::string> Reader::ReadAllLines()
 {
-    std::string temp;
-    std::vector<std::string> result;
     std::vector<uint8_t> bytes = ReadAllBytes();
 
-    for (auto ch : bytes)
-    {
-        if ((ch == '\r') || (ch == '\n'))
-        {
-            if (!temp.empty())
-            {
-                result.push_back(temp);
-                temp.clear();
-            }
-        }
-        else
-            temp += ch;
-    }
-
-    return result;
+    // Split by line terminators at once instead of appending characters one by one
+    return StringUtils::SplitByAny(std::string_view((const char*)bytes.data(), bytes.size()), "\r\n", true);
 }
 
 } // namespace CppCommon
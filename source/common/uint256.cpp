@@ -8,40 +8,96 @@
 
 #include "common/uint256.h"
 
+#include <bit>
+
 namespace CppCommon {
 
+//! @cond INTERNALS
+namespace Internals {
+
+void ToLimbs(const uint256_t& value, uint64_t limbs[4]) noexcept
+{
+    limbs[0] = value.lower().lower();
+    limbs[1] = value.lower().upper();
+    limbs[2] = value.upper().lower();
+    limbs[3] = value.upper().upper();
+}
+
+uint256_t FromLimbs(const uint64_t limbs[4]) noexcept
+{
+    return uint256_t(limbs[3], limbs[2], limbs[1], limbs[0]);
+}
+
+template <typename TChar>
+std::basic_string<TChar> ToString(const uint256_t& value, size_t base, size_t length)
+{
+    if ((base < 2) || (base > 16))
+        throw std::invalid_argument("Base must be in the range [2, 16]");
+
+    // Divide by the greatest power of the base that fits into 64-bit limb
+    uint64_t chunk = base;
+    size_t digits = 1;
+    while (chunk <= (UINT64_MAX / base))
+    {
+        chunk *= base;
+        ++digits;
+    }
+
+    TChar buffer[256];
+    size_t index = sizeof(buffer) / sizeof(TChar);
+
+    std::pair<uint256_t, uint256_t> qr(value, 0);
+    do
+    {
+        qr = uint256_t::divmod(qr.first, chunk);
+        uint64_t remainder = qr.second.lower().lower();
+
+        // Leading zeros are written only for inner chunks
+        for (size_t i = 0; (i < digits) && ((qr.first != 0) || (remainder != 0) || (i == 0)); ++i)
+        {
+            buffer[--index] = (TChar)"0123456789abcdef"[remainder % base];
+            remainder /= base;
+        }
+    } while (qr.first != 0);
+
+    std::basic_string<TChar> result;
+    size_t size = (sizeof(buffer) / sizeof(TChar)) - index;
+    if (size < length)
+        result.assign(length - size, (TChar)'0');
+    result.append(buffer + index, size);
+    return result;
+}
+
+} // namespace Internals
+//! @endcond
+
 uint256_t operator*(const uint256_t& value1, const uint256_t& value2) noexcept
 {
-    // Split values into four 32-bit parts
-    uint128_t top[4] = { value1.upper().upper(), value1.upper().lower(), value1.lower().upper(), value1.lower().lower() };
-    uint128_t bottom[4] = { value2.upper().upper(), value2.upper().lower(), value2.lower().upper(), value2.lower().lower() };
-    uint128_t products[4][4];
-
-    // Multiply each component of the values
-    for (int y = 3; y > -1; --y)
-        for (int x = 3; x > -1; --x)
-            products[3 - x][y] = top[x] * bottom[y];
-
-    // First row
-    uint128_t fourth64 = uint128_t(products[0][3].lower());
-    uint128_t third64  = uint128_t(products[0][2].lower()) + uint128_t(products[0][3].upper());
-    uint128_t second64 = uint128_t(products[0][1].lower()) + uint128_t(products[0][2].upper());
-    uint128_t first64  = uint128_t(products[0][0].lower()) + uint128_t(products[0][1].upper());
-
-    // Second row
-    third64  += uint128_t(products[1][3].lower());
-    second64 += uint128_t(products[1][2].lower()) + uint128_t(products[1][3].upper());
-    first64  += uint128_t(products[1][1].lower()) + uint128_t(products[1][2].upper());
-
-    // Third row
-    second64 += uint128_t(products[2][3].lower());
-    first64  += uint128_t(products[2][2].lower()) + uint128_t(products[2][3].upper());
-
-    // Fourth row
-    first64  += uint128_t(products[3][3].lower());
-
-    // Combines the values, taking care of carry over
-    return uint256_t(first64 << 64, 0) + uint256_t(third64.upper(), third64 << 64) + uint256_t(second64, 0) + uint256_t(fourth64);
+    uint64_t x[4], y[4];
+    Internals::ToLimbs(value1, x);
+    Internals::ToLimbs(value2, y);
+
+    // Schoolbook multiplication of 64-bit limbs, only the lower 256 bits of the product are kept
+    uint64_t result[4] = { 0, 0, 0, 0 };
+    for (size_t i = 0; i < 4; ++i)
+    {
+        if (x[i] == 0)
+            continue;
+
+        uint64_t carry = 0;
+        for (size_t j = 0; (i + j) < 4; ++j)
+        {
+            uint64_t upper;
+            uint64_t lower = Internals::Multiply64(x[i], y[j], upper);
+            lower += carry;
+            upper += (lower < carry) ? 1 : 0;
+            result[i + j] += lower;
+            upper += (result[i + j] < lower) ? 1 : 0;
+            carry = upper;
+        }
+    }
+
+    return Internals::FromLimbs(result);
 }
 
 uint256_t operator<<(const uint256_t& value1, const uint256_t& value2) noexcept
@@ -82,115 +138,147 @@ uint256_t operator>>(const uint256_t& value1, const uint256_t& value2) noexcept
 
 size_t uint256_t::bits() const noexcept
 {
-    size_t result = 0;
-
-    if (_upper)
-    {
-        result = 128;
-        uint128_t upper = _upper;
-        while (upper)
-        {
-            upper >>= 1;
-            ++result;
-        }
-    }
-    else
-    {
-        uint128_t lower = _lower;
-        while (lower)
-        {
-            lower >>= 1;
-            ++result;
-        }
-    }
-
-    return result;
+    return _upper ? (128 + _upper.bits()) : _lower.bits();
 }
 
 std::string uint256_t::string(size_t base, size_t length) const
 {
-    if ((base < 2) || (base > 16))
-        throw std::invalid_argument("Base must be in the range [2, 16]");
-
-    std::string out;
-
-    if (!(*this))
-        out = "0";
-    else
-    {
-        std::pair<uint256_t, uint256_t> qr(*this, 0);
-        do
-        {
-            qr = uint256_t::divmod(qr.first, uint256_t(base));
-            out = "0123456789abcdef"[(uint8_t)qr.second] + out;
-        } while (qr.first != 0);
-    }
-
-    if (out.size() < length)
-        out = std::string(length - out.size(), '0') + out;
-
-    return out;
+    return Internals::ToString<char>(*this, base, length);
 }
 
 std::wstring uint256_t::wstring(size_t base, size_t length) const
 {
-    if ((base < 2) || (base > 16))
-        throw std::invalid_argument("Base must be in the range [2, 16]");
-
-    std::wstring out;
-
-    if (!(*this))
-        out = L"0";
-    else
-    {
-        std::pair<uint256_t, uint256_t> qr(*this, 0);
-        do
-        {
-            qr = uint256_t::divmod(qr.first, uint256_t(base));
-            out = L"0123456789abcdef"[(uint8_t)qr.second] + out;
-        } while (qr.first != 0);
-    }
-
-    if (out.size() < length)
-        out = std::wstring(length - out.size(), L'0') + out;
-
-    return out;
+    return Internals::ToString<wchar_t>(*this, base, length);
 }
 
 std::pair<uint256_t, uint256_t> uint256_t::divmod(const uint256_t& x, const uint256_t& y)
 {
     if (y == 0)
         throw std::domain_error("Division by 0");
-    else if (y == 1)
-        return std::pair<uint256_t, uint256_t>(x, 0);
-    else if (x == y)
-        return std::pair<uint256_t, uint256_t>(1, 0);
-    else if ((x == 0) || (x < y))
+    else if (x < y)
         return std::pair<uint256_t, uint256_t>(0, x);
 
-    std::pair<uint256_t, uint256_t> result(0, x);
-    uint256_t delta = uint256_t(x.bits() - y.bits());
-    uint256_t copyd = y << delta;
-    uint256_t adder = 1 << delta;
+    // 128-bit division
+    if (!x._upper)
+    {
+        auto result = uint128_t::divmod(x._lower, y._lower);
+        return std::pair<uint256_t, uint256_t>(result.first, result.second);
+    }
 
-    if (copyd > result.second)
+    uint64_t u[5], v[4];
+    Internals::ToLimbs(x, u);
+    Internals::ToLimbs(y, v);
+    u[4] = 0;
+
+    size_t m = 4;
+    while (u[m - 1] == 0)
+        --m;
+    size_t n = 4;
+    while (v[n - 1] == 0)
+        --n;
+
+    uint64_t q[4] = { 0, 0, 0, 0 };
+    uint64_t r[4] = { 0, 0, 0, 0 };
+
+    // Single limb divisor
+    if (n == 1)
     {
-        copyd >>= 1;
-        adder >>= 1;
+        uint64_t remainder = 0;
+        for (size_t i = m; i-- > 0;)
+            q[i] = Internals::Divide128(remainder, u[i], v[0], remainder);
+        r[0] = remainder;
+        return std::pair<uint256_t, uint256_t>(Internals::FromLimbs(q), Internals::FromLimbs(r));
     }
 
-    while (result.second >= y)
+    // Knuth algorithm D: normalize the divisor so its highest limb has the highest bit set
+    const unsigned shift = (unsigned)std::countl_zero(v[n - 1]);
+    if (shift > 0)
     {
-        if (result.second >= copyd)
+        for (size_t i = n - 1; i > 0; --i)
+            v[i] = (v[i] << shift) | (v[i - 1] >> (64 - shift));
+        v[0] <<= shift;
+        u[m] = u[m - 1] >> (64 - shift);
+        for (size_t i = m - 1; i > 0; --i)
+            u[i] = (u[i] << shift) | (u[i - 1] >> (64 - shift));
+        u[0] <<= shift;
+    }
+    else
+        u[m] = 0;
+
+    for (size_t j = m - n + 1; j-- > 0;)
+    {
+        // Estimate the quotient limb from the two highest limbs of the remainder
+        uint64_t qhat;
+        uint64_t rhat;
+        bool overflow;
+        if (u[j + n] >= v[n - 1])
+        {
+            qhat = ~(uint64_t)0;
+            rhat = u[j + n - 1] + v[n - 1];
+            overflow = (rhat < v[n - 1]);
+        }
+        else
         {
-            result.second -= copyd;
-            result.first |= adder;
+            qhat = Internals::Divide128(u[j + n], u[j + n - 1], v[n - 1], rhat);
+            overflow = false;
         }
-        copyd >>= 1;
-        adder >>= 1;
+
+        // Correct the estimation with the next divisor limb, it is decreased at most twice
+        while (!overflow)
+        {
+            uint64_t upper;
+            uint64_t lower = Internals::Multiply64(qhat, v[n - 2], upper);
+            if ((upper < rhat) || ((upper == rhat) && (lower <= u[j + n - 2])))
+                break;
+            --qhat;
+            rhat += v[n - 1];
+            overflow = (rhat < v[n - 1]);
+        }
+
+        // Multiply and subtract
+        uint64_t carry = 0;
+        uint64_t borrow = 0;
+        for (size_t i = 0; i < n; ++i)
+        {
+            uint64_t upper;
+            uint64_t lower = Internals::Multiply64(qhat, v[i], upper);
+            lower += carry;
+            upper += (lower < carry) ? 1 : 0;
+            carry = upper;
+
+            uint64_t difference = u[i + j] - lower;
+            uint64_t borrow1 = (u[i + j] < lower) ? 1 : 0;
+            u[i + j] = difference - borrow;
+            borrow = borrow1 + ((difference < borrow) ? 1 : 0);
+        }
+        uint64_t difference = u[j + n] - carry;
+        uint64_t borrow1 = (u[j + n] < carry) ? 1 : 0;
+        u[j + n] = difference - borrow;
+        borrow = borrow1 + ((difference < borrow) ? 1 : 0);
+
+        // Add back the divisor if the estimation was still one too large
+        if (borrow)
+        {
+            --qhat;
+            uint64_t add = 0;
+            for (size_t i = 0; i < n; ++i)
+            {
+                uint64_t sum = u[i + j] + v[i];
+                uint64_t carry1 = (sum < v[i]) ? 1 : 0;
+                u[i + j] = sum + add;
+                add = carry1 + ((u[i + j] < sum) ? 1 : 0);
+            }
+            u[j + n] += add;
+        }
+
+        q[j] = qhat;
     }
 
-    return result;
+    // Denormalize the remainder
+    for (size_t i = 0; i < n; ++i)
+        r[i] = (shift > 0) ? ((u[i] >> shift) | (u[i + 1] << (64 - shift))) : u[i];
+
+    return std::pair<uint256_t, uint256_t>(Internals::FromLimbs(q), Internals::FromLimbs(r));
 }
 
 } // namespace CppCommon
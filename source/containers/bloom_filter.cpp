@@ -0,0 +1,316 @@
+/*!
+    \file bloom_filter.cpp
+    \brief Blocked Bloom filter container implementation
+    \author Ivan Shynkarenka
+    \date 15.10.2026
+    \copyright MIT License
+*/
+
+#include "containers/bloom_filter.h"
+
+#include "system/cpu.h"
+#include "utility/endian.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstring>
+
+#if defined(_MSC_VER) && defined(_M_X64)
+#include <immintrin.h>
+#define CPPCOMMON_BLOOM_FILTER_AVX2
+#define CPPCOMMON_BLOOM_FILTER_AVX2_TARGET
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__amd64__))
+#include <immintrin.h>
+#define CPPCOMMON_BLOOM_FILTER_AVX2
+#define CPPCOMMON_BLOOM_FILTER_AVX2_TARGET __attribute__((target("avx2")))
+#endif
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+namespace Internals {
+
+// Odd multipliers select one bit in each word of the block
+alignas(32) const uint32_t BLOOM_FILTER_SALT[8] = { 0x47B6137B, 0x44974D91, 0x8824AD5B, 0xA2B7289D, 0x705495C7, 0x2DF1424B, 0x9EFC4947, 0x5C6BFB31 };
+
+// Serialized header: magic, version, count of blocks, count of keys
+const uint8_t BLOOM_FILTER_MAGIC[4] = { 'C', 'C', 'B', 'F' };
+const uint32_t BLOOM_FILTER_VERSION = 1;
+const size_t BLOOM_FILTER_HEADER = 24;
+
+inline uint64_t BloomFilterMask(uint32_t hash, size_t word) noexcept
+{
+    return (uint64_t)1 << ((hash * BLOOM_FILTER_SALT[word]) >> 26);
+}
+
+void BloomFilterAdd(uint64_t* words, uint32_t hash) noexcept
+{
+    for (size_t i = 0; i < 8; ++i)
+        words[i] |= BloomFilterMask(hash, i);
+}
+
+bool BloomFilterContains(const uint64_t* words, uint32_t hash) noexcept
+{
+    uint64_t missing = 0;
+    for (size_t i = 0; i < 8; ++i)
+    {
+        uint64_t mask = BloomFilterMask(hash, i);
+        missing |= ~words[i] & mask;
+    }
+    return (missing == 0);
+}
+
+#if defined(CPPCOMMON_BLOOM_FILTER_AVX2)
+
+CPPCOMMON_BLOOM_FILTER_AVX2_TARGET
+inline void BloomFilterMaskAVX2(uint32_t hash, __m256i& low, __m256i& high) noexcept
+{
+    // Calculate 8 bit positions at once and expand them into 64-bit masks
+    __m256i salt = _mm256_load_si256((const __m256i*)BLOOM_FILTER_SALT);
+    __m256i bits = _mm256_srli_epi32(_mm256_mullo_epi32(_mm256_set1_epi32((int)hash), salt), 26);
+    __m256i one = _mm256_set1_epi64x(1);
+    low = _mm256_sllv_epi64(one, _mm256_cvtepu32_epi64(_mm256_castsi256_si128(bits)));
+    high = _mm256_sllv_epi64(one, _mm256_cvtepu32_epi64(_mm256_extracti128_si256(bits, 1)));
+}
+
+CPPCOMMON_BLOOM_FILTER_AVX2_TARGET
+void BloomFilterAddAVX2(uint64_t* words, uint32_t hash) noexcept
+{
+    __m256i low, high;
+    BloomFilterMaskAVX2(hash, low, high);
+    __m256i* block = (__m256i*)words;
+    _mm256_store_si256(block + 0, _mm256_or_si256(_mm256_load_si256(block + 0), low));
+    _mm256_store_si256(block + 1, _mm256_or_si256(_mm256_load_si256(block + 1), high));
+}
+
+CPPCOMMON_BLOOM_FILTER_AVX2_TARGET
+bool BloomFilterContainsAVX2(const uint64_t* words, uint32_t hash) noexcept
+{
+    __m256i low, high;
+    BloomFilterMaskAVX2(hash, low, high);
+    const __m256i* block = (const __m256i*)words;
+    return _mm256_testc_si256(_mm256_load_si256(block + 0), low) && _mm256_testc_si256(_mm256_load_si256(block + 1), high);
+}
+
+#endif
+
+} // namespace Internals
+//! @endcond
+
+BloomFilter::BloomFilter(size_t capacity, double probability) : _count(0)
+{
+    assert(((probability > 0.0) && (probability < 1.0)) && "Bloom filter false positive probability must be in (0, 1) range!");
+    probability = std::clamp(probability, 1e-12, 0.5);
+    capacity = std::max(capacity, (size_t)1);
+
+    // Optimal count of bits for the classic Bloom filter
+    const double ln2 = std::log(2.0);
+    double bits = -(double)capacity * std::log(probability) / (ln2 * ln2);
+
+    // Blocked layout has more false positives because keys are not spread
+    // uniformly over blocks, so reserve a quarter more bits to compensate
+    bits *= 1.25;
+
+    size_t blocks = (size_t)std::ceil(bits / (BLOCK_SIZE * 8));
+    _blocks.resize(std::max(blocks, (size_t)1), Block{});
+}
+
+BloomFilter::BloomFilter(const BloomFilter& filter) : _blocks(filter._blocks), _count(filter.count())
+{
+}
+
+BloomFilter::BloomFilter(BloomFilter&& filter) noexcept : _blocks(std::move(filter._blocks)), _count(filter.count())
+{
+    filter._count.store(0, std::memory_order_relaxed);
+}
+
+BloomFilter& BloomFilter::operator=(const BloomFilter& filter)
+{
+    if (this == &filter)
+        return *this;
+
+    _blocks = filter._blocks;
+    _count.store(filter.count(), std::memory_order_relaxed);
+    return *this;
+}
+
+BloomFilter& BloomFilter::operator=(BloomFilter&& filter) noexcept
+{
+    if (this == &filter)
+        return *this;
+
+    _blocks = std::move(filter._blocks);
+    _count.store(filter.count(), std::memory_order_relaxed);
+    filter._count.store(0, std::memory_order_relaxed);
+    return *this;
+}
+
+void BloomFilter::AddHash(uint64_t hash) noexcept
+{
+    if (_blocks.empty())
+        return;
+
+    hash = Hash::Mix(hash);
+
+#if defined(CPPCOMMON_BLOOM_FILTER_AVX2)
+    static const CPUDispatch<void(uint64_t*, uint32_t)> dispatch([]() { return CPU::HasAVX2() ? Internals::BloomFilterAddAVX2 : Internals::BloomFilterAdd; });
+    dispatch(_blocks[Index(hash)].words, (uint32_t)hash);
+#else
+    Internals::BloomFilterAdd(_blocks[Index(hash)].words, (uint32_t)hash);
+#endif
+
+    _count.store(count() + 1, std::memory_order_relaxed);
+}
+
+void BloomFilter::AddHashConcurrent(uint64_t hash) noexcept
+{
+    if (_blocks.empty())
+        return;
+
+    hash = Hash::Mix(hash);
+
+    uint64_t* words = _blocks[Index(hash)].words;
+    for (size_t i = 0; i < 8; ++i)
+    {
+        // Skip the atomic write if the bit is already set to avoid cache line ping-pong
+        std::atomic_ref<uint64_t> word(words[i]);
+        uint64_t mask = Internals::BloomFilterMask((uint32_t)hash, i);
+        if ((word.load(std::memory_order_relaxed) & mask) != mask)
+            word.fetch_or(mask, std::memory_order_relaxed);
+    }
+
+    _count.fetch_add(1, std::memory_order_relaxed);
+}
+
+bool BloomFilter::ContainsHash(uint64_t hash) const noexcept
+{
+    if (_blocks.empty())
+        return false;
+
+    hash = Hash::Mix(hash);
+
+#if defined(CPPCOMMON_BLOOM_FILTER_AVX2)
+    static const CPUDispatch<bool(const uint64_t*, uint32_t)> dispatch([]() { return CPU::HasAVX2() ? Internals::BloomFilterContainsAVX2 : Internals::BloomFilterContains; });
+    return dispatch(_blocks[Index(hash)].words, (uint32_t)hash);
+#else
+    return Internals::BloomFilterContains(_blocks[Index(hash)].words, (uint32_t)hash);
+#endif
+}
+
+bool BloomFilter::ContainsHashConcurrent(uint64_t hash) const noexcept
+{
+    if (_blocks.empty())
+        return false;
+
+    hash = Hash::Mix(hash);
+
+    uint64_t* words = const_cast<uint64_t*>(_blocks[Index(hash)].words);
+    for (size_t i = 0; i < 8; ++i)
+    {
+        std::atomic_ref<uint64_t> word(words[i]);
+        uint64_t mask = Internals::BloomFilterMask((uint32_t)hash, i);
+        if ((word.load(std::memory_order_relaxed) & mask) != mask)
+            return false;
+    }
+    return true;
+}
+
+bool BloomFilter::Merge(const BloomFilter& filter) noexcept
+{
+    if (_blocks.size() != filter._blocks.size())
+        return false;
+
+    for (size_t i = 0; i < _blocks.size(); ++i)
+        for (size_t j = 0; j < 8; ++j)
+            _blocks[i].words[j] |= filter._blocks[i].words[j];
+
+    _count.store(count() + filter.count(), std::memory_order_relaxed);
+    return true;
+}
+
+void BloomFilter::Clear() noexcept
+{
+    std::fill(_blocks.begin(), _blocks.end(), Block{});
+    _count.store(0, std::memory_order_relaxed);
+}
+
+std::vector<uint8_t> BloomFilter::Serialize() const
+{
+    std::vector<uint8_t> result(Internals::BLOOM_FILTER_HEADER + bytes());
+
+    uint8_t* buffer = result.data();
+    std::memcpy(buffer, Internals::BLOOM_FILTER_MAGIC, 4);
+    Endian::StoreLittleEndian<uint32_t>(buffer + 4, Internals::BLOOM_FILTER_VERSION);
+    Endian::StoreLittleEndian<uint64_t>(buffer + 8, (uint64_t)_blocks.size());
+    Endian::StoreLittleEndian<uint64_t>(buffer + 16, count());
+    buffer += Internals::BLOOM_FILTER_HEADER;
+
+    for (const auto& block : _blocks)
+    {
+        for (size_t i = 0; i < 8; ++i)
+        {
+            Endian::StoreLittleEndian<uint64_t>(buffer, block.words[i]);
+            buffer += 8;
+        }
+    }
+
+    return result;
+}
+
+void BloomFilter::Serialize(Writer& writer) const
+{
+    uint8_t header[Internals::BLOOM_FILTER_HEADER];
+    std::memcpy(header, Internals::BLOOM_FILTER_MAGIC, 4);
+    Endian::StoreLittleEndian<uint32_t>(header + 4, Internals::BLOOM_FILTER_VERSION);
+    Endian::StoreLittleEndian<uint64_t>(header + 8, (uint64_t)_blocks.size());
+    Endian::StoreLittleEndian<uint64_t>(header + 16, count());
+
+    if constexpr (Endian::IsLittleEndian())
+    {
+        // Write blocks as is without intermediate copy
+        writer.WriteV({ { header, sizeof(header) }, { _blocks.data(), bytes() } });
+    }
+    else
+    {
+        std::vector<uint8_t> buffer = Serialize();
+        writer.Write(buffer.data(), buffer.size());
+    }
+}
+
+size_t BloomFilter::Deserialize(std::span<const uint8_t> buffer, BloomFilter& filter)
+{
+    if (buffer.size() < Internals::BLOOM_FILTER_HEADER)
+        return 0;
+
+    const uint8_t* data = buffer.data();
+    if (std::memcmp(data, Internals::BLOOM_FILTER_MAGIC, 4) != 0)
+        return 0;
+    if (Endian::LoadLittleEndian<uint32_t>(data + 4) != Internals::BLOOM_FILTER_VERSION)
+        return 0;
+
+    uint64_t blocks = Endian::LoadLittleEndian<uint64_t>(data + 8);
+    uint64_t count = Endian::LoadLittleEndian<uint64_t>(data + 16);
+    if ((blocks == 0) || (blocks > (buffer.size() - Internals::BLOOM_FILTER_HEADER) / BLOCK_SIZE))
+        return 0;
+
+    filter._blocks.resize((size_t)blocks);
+    std::memcpy(filter._blocks.data(), data + Internals::BLOOM_FILTER_HEADER, (size_t)blocks * BLOCK_SIZE);
+    if constexpr (Endian::IsBigEndian())
+        for (auto& block : filter._blocks)
+            Endian::ConvertLittleEndian(std::span<uint64_t>(block.words));
+    filter._count.store(count, std::memory_order_relaxed);
+
+    return Internals::BLOOM_FILTER_HEADER + (size_t)blocks * BLOCK_SIZE;
+}
+
+void BloomFilter::swap(BloomFilter& filter) noexcept
+{
+    using std::swap;
+    swap(_blocks, filter._blocks);
+    uint64_t count = _count.load(std::memory_order_relaxed);
+    _count.store(filter._count.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    filter._count.store(count, std::memory_order_relaxed);
+}
+
+} // namespace CppCommon
@@ -0,0 +1,323 @@
+/*!
+    \file cuckoo_filter.cpp
+    \brief Cuckoo filter container implementation
+    \author Ivan Shynkarenka
+    \date 15.10.2026
+    \copyright MIT License
+*/
+
+#include "containers/cuckoo_filter.h"
+
+#include "threads/locker.h"
+#include "utility/endian.h"
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+namespace Internals {
+
+// SWAR constants of 4 x 16-bit lanes
+const uint64_t CUCKOO_FILTER_LANES = 0x0001000100010001ull;
+const uint64_t CUCKOO_FILTER_LOW = 0x7FFF7FFF7FFF7FFFull;
+
+// Serialized header: magic, version, count of buckets, count of fingerprints, victim
+const uint8_t CUCKOO_FILTER_MAGIC[4] = { 'C', 'C', 'C', 'F' };
+const uint32_t CUCKOO_FILTER_VERSION = 1;
+const size_t CUCKOO_FILTER_HEADER = 40;
+
+// Get the mask with the highest bit set in each lane equal to the given fingerprint
+inline uint64_t CuckooFilterMatch(uint64_t bucket, uint16_t fingerprint) noexcept
+{
+    uint64_t x = bucket ^ (fingerprint * CUCKOO_FILTER_LANES);
+    return ~(((x & CUCKOO_FILTER_LOW) + CUCKOO_FILTER_LOW) | x | CUCKOO_FILTER_LOW);
+}
+
+inline uint16_t CuckooFilterFingerprint(uint64_t hash) noexcept
+{
+    // Zero fingerprint marks the empty slot
+    uint16_t fingerprint = (uint16_t)hash;
+    return (fingerprint != 0) ? fingerprint : 1;
+}
+
+} // namespace Internals
+//! @endcond
+
+CuckooFilter::CuckooFilter(size_t capacity)
+    : _size(0), _random(0x9E3779B97F4A7C15ull), _victim(false), _victim_fingerprint(0), _victim_index(0)
+{
+    // Reserve buckets for 95% load factor
+    size_t buckets = std::max((capacity * 20 / 19 + BUCKET_SIZE - 1) / BUCKET_SIZE, (size_t)2);
+    buckets = std::bit_ceil(buckets);
+    _buckets.resize(buckets, 0);
+    _mask = buckets - 1;
+}
+
+CuckooFilter::CuckooFilter(const CuckooFilter& filter)
+    : _buckets(filter._buckets), _mask(filter._mask), _size(filter._size), _random(filter._random),
+      _victim(filter._victim), _victim_fingerprint(filter._victim_fingerprint), _victim_index(filter._victim_index)
+{
+}
+
+CuckooFilter::CuckooFilter(CuckooFilter&& filter) noexcept
+    : _buckets(std::move(filter._buckets)), _mask(filter._mask), _size(filter._size), _random(filter._random),
+      _victim(filter._victim), _victim_fingerprint(filter._victim_fingerprint), _victim_index(filter._victim_index)
+{
+    filter._size = 0;
+    filter._victim = false;
+}
+
+CuckooFilter& CuckooFilter::operator=(const CuckooFilter& filter)
+{
+    if (this == &filter)
+        return *this;
+
+    _buckets = filter._buckets;
+    _mask = filter._mask;
+    _size = filter._size;
+    _random = filter._random;
+    _victim = filter._victim;
+    _victim_fingerprint = filter._victim_fingerprint;
+    _victim_index = filter._victim_index;
+    return *this;
+}
+
+CuckooFilter& CuckooFilter::operator=(CuckooFilter&& filter) noexcept
+{
+    if (this == &filter)
+        return *this;
+
+    _buckets = std::move(filter._buckets);
+    _mask = filter._mask;
+    _size = filter._size;
+    _random = filter._random;
+    _victim = filter._victim;
+    _victim_fingerprint = filter._victim_fingerprint;
+    _victim_index = filter._victim_index;
+    filter._size = 0;
+    filter._victim = false;
+    return *this;
+}
+
+bool CuckooFilter::Insert(size_t index, uint16_t fingerprint) noexcept
+{
+    uint64_t empty = Internals::CuckooFilterMatch(_buckets[index], 0);
+    if (empty == 0)
+        return false;
+
+    int shift = std::countr_zero(empty) - 15;
+    _buckets[index] |= (uint64_t)fingerprint << shift;
+    return true;
+}
+
+bool CuckooFilter::Erase(size_t index, uint16_t fingerprint) noexcept
+{
+    uint64_t match = Internals::CuckooFilterMatch(_buckets[index], fingerprint);
+    if (match == 0)
+        return false;
+
+    int shift = std::countr_zero(match) - 15;
+    _buckets[index] &= ~((uint64_t)0xFFFF << shift);
+    return true;
+}
+
+bool CuckooFilter::Find(size_t index, uint16_t fingerprint) const noexcept
+{
+    return (Internals::CuckooFilterMatch(_buckets[index], fingerprint) != 0);
+}
+
+void CuckooFilter::Place(size_t index, uint16_t fingerprint) noexcept
+{
+    if (Insert(index, fingerprint))
+        return;
+    index = AltIndex(index, fingerprint);
+    if (Insert(index, fingerprint))
+        return;
+
+    // Relocate random fingerprints to their alternate buckets
+    for (size_t kick = 0; kick < MAX_KICKS; ++kick)
+    {
+        // xorshift64 random generator
+        _random ^= _random << 13;
+        _random ^= _random >> 7;
+        _random ^= _random << 17;
+
+        int shift = (int)(_random & 3) * 16;
+        uint16_t evicted = (uint16_t)(_buckets[index] >> shift);
+        _buckets[index] = (_buckets[index] & ~((uint64_t)0xFFFF << shift)) | ((uint64_t)fingerprint << shift);
+        fingerprint = evicted;
+
+        index = AltIndex(index, fingerprint);
+        if (Insert(index, fingerprint))
+            return;
+    }
+
+    // Keep the last evicted fingerprint as the victim, so no key is lost
+    _victim = true;
+    _victim_fingerprint = fingerprint;
+    _victim_index = index;
+}
+
+bool CuckooFilter::AddHash(uint64_t hash) noexcept
+{
+    // Filter is full until the victim is placed back
+    if (_victim)
+        return false;
+
+    hash = Hash::Mix(hash);
+    Place((size_t)(hash >> 32) & _mask, Internals::CuckooFilterFingerprint(hash));
+    ++_size;
+    return true;
+}
+
+bool CuckooFilter::AddHashConcurrent(uint64_t hash)
+{
+    WriteLocker<RWLock> locker(_lock);
+    return AddHash(hash);
+}
+
+bool CuckooFilter::RemoveHash(uint64_t hash) noexcept
+{
+    hash = Hash::Mix(hash);
+    uint16_t fingerprint = Internals::CuckooFilterFingerprint(hash);
+    size_t index1 = (size_t)(hash >> 32) & _mask;
+    size_t index2 = AltIndex(index1, fingerprint);
+
+    if (Erase(index1, fingerprint) || Erase(index2, fingerprint))
+    {
+        --_size;
+
+        // Try to place the victim into the released slot
+        if (_victim)
+        {
+            _victim = false;
+            Place(_victim_index, _victim_fingerprint);
+        }
+        return true;
+    }
+
+    if (_victim && (_victim_fingerprint == fingerprint) && ((_victim_index == index1) || (_victim_index == index2)))
+    {
+        _victim = false;
+        --_size;
+        return true;
+    }
+
+    return false;
+}
+
+bool CuckooFilter::RemoveHashConcurrent(uint64_t hash)
+{
+    WriteLocker<RWLock> locker(_lock);
+    return RemoveHash(hash);
+}
+
+bool CuckooFilter::ContainsHash(uint64_t hash) const noexcept
+{
+    hash = Hash::Mix(hash);
+    uint16_t fingerprint = Internals::CuckooFilterFingerprint(hash);
+    size_t index1 = (size_t)(hash >> 32) & _mask;
+    size_t index2 = AltIndex(index1, fingerprint);
+
+    if (Find(index1, fingerprint) || Find(index2, fingerprint))
+        return true;
+
+    return (_victim && (_victim_fingerprint == fingerprint) && ((_victim_index == index1) || (_victim_index == index2)));
+}
+
+bool CuckooFilter::ContainsHashConcurrent(uint64_t hash) const
+{
+    ReadLocker<RWLock> locker(_lock);
+    return ContainsHash(hash);
+}
+
+void CuckooFilter::Clear() noexcept
+{
+    std::fill(_buckets.begin(), _buckets.end(), 0);
+    _size = 0;
+    _victim = false;
+}
+
+std::vector<uint8_t> CuckooFilter::Serialize() const
+{
+    std::vector<uint8_t> result(Internals::CUCKOO_FILTER_HEADER + bytes());
+
+    uint8_t* buffer = result.data();
+    std::memcpy(buffer, Internals::CUCKOO_FILTER_MAGIC, 4);
+    Endian::StoreLittleEndian<uint32_t>(buffer + 4, Internals::CUCKOO_FILTER_VERSION);
+    Endian::StoreLittleEndian<uint64_t>(buffer + 8, (uint64_t)_buckets.size());
+    Endian::StoreLittleEndian<uint64_t>(buffer + 16, (uint64_t)_size);
+    Endian::StoreLittleEndian<uint64_t>(buffer + 24, _victim ? (uint64_t)_victim_index : ~(uint64_t)0);
+    Endian::StoreLittleEndian<uint64_t>(buffer + 32, _victim ? (uint64_t)_victim_fingerprint : 0);
+    buffer += Internals::CUCKOO_FILTER_HEADER;
+
+    for (uint64_t bucket : _buckets)
+    {
+        Endian::StoreLittleEndian<uint64_t>(buffer, bucket);
+        buffer += 8;
+    }
+
+    return result;
+}
+
+void CuckooFilter::Serialize(Writer& writer) const
+{
+    std::vector<uint8_t> buffer = Serialize();
+    writer.Write(buffer.data(), buffer.size());
+}
+
+size_t CuckooFilter::Deserialize(std::span<const uint8_t> buffer, CuckooFilter& filter)
+{
+    if (buffer.size() < Internals::CUCKOO_FILTER_HEADER)
+        return 0;
+
+    const uint8_t* data = buffer.data();
+    if (std::memcmp(data, Internals::CUCKOO_FILTER_MAGIC, 4) != 0)
+        return 0;
+    if (Endian::LoadLittleEndian<uint32_t>(data + 4) != Internals::CUCKOO_FILTER_VERSION)
+        return 0;
+
+    uint64_t buckets = Endian::LoadLittleEndian<uint64_t>(data + 8);
+    uint64_t size = Endian::LoadLittleEndian<uint64_t>(data + 16);
+    uint64_t victim_index = Endian::LoadLittleEndian<uint64_t>(data + 24);
+    uint64_t victim_fingerprint = Endian::LoadLittleEndian<uint64_t>(data + 32);
+    if ((buckets < 2) || !std::has_single_bit(buckets) || (buckets > (buffer.size() - Internals::CUCKOO_FILTER_HEADER) / sizeof(uint64_t)))
+        return 0;
+    if ((size > buckets * BUCKET_SIZE + 1) || (victim_fingerprint > 0xFFFF))
+        return 0;
+    bool victim = (victim_index != ~(uint64_t)0);
+    if (victim && ((victim_index >= buckets) || (victim_fingerprint == 0)))
+        return 0;
+
+    data += Internals::CUCKOO_FILTER_HEADER;
+    filter._buckets.resize((size_t)buckets);
+    for (auto& bucket : filter._buckets)
+    {
+        bucket = Endian::LoadLittleEndian<uint64_t>(data);
+        data += 8;
+    }
+    filter._mask = (size_t)buckets - 1;
+    filter._size = (size_t)size;
+    filter._victim = victim;
+    filter._victim_fingerprint = victim ? (uint16_t)victim_fingerprint : 0;
+    filter._victim_index = victim ? (size_t)victim_index : 0;
+
+    return Internals::CUCKOO_FILTER_HEADER + (size_t)buckets * sizeof(uint64_t);
+}
+
+void CuckooFilter::swap(CuckooFilter& filter) noexcept
+{
+    using std::swap;
+    swap(_buckets, filter._buckets);
+    swap(_mask, filter._mask);
+    swap(_size, filter._size);
+    swap(_random, filter._random);
+    swap(_victim, filter._victim);
+    swap(_victim_fingerprint, filter._victim_fingerprint);
+    swap(_victim_index, filter._victim_index);
+}
+
+} // namespace CppCommon
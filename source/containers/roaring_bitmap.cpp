@@ -0,0 +1,937 @@
+/*!
+    \file roaring_bitmap.cpp
+    \brief Roaring bitmap container implementation
+    \author Ivan Shynkarenka
+    \date 15.10.2026
+    \copyright MIT License
+*/
+
+#include "containers/roaring_bitmap.h"
+
+#include "system/cpu.h"
+#include "utility/endian.h"
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <cstring>
+
+#if defined(_MSC_VER) && defined(_M_X64)
+#include <immintrin.h>
+#define CPPCOMMON_ROARING_BITMAP_AVX2
+#define CPPCOMMON_ROARING_BITMAP_AVX2_TARGET
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__amd64__))
+#include <immintrin.h>
+#define CPPCOMMON_ROARING_BITMAP_AVX2
+#define CPPCOMMON_ROARING_BITMAP_AVX2_TARGET __attribute__((target("avx2,popcnt")))
+#endif
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+namespace Internals {
+
+// Count of 64-bit words in the bitmap container
+const size_t ROARING_BITMAP_WORDS = 1024;
+
+// Serialized header: magic, version, count of containers, count of values
+const uint8_t ROARING_BITMAP_MAGIC[4] = { 'C', 'C', 'R', 'B' };
+const uint32_t ROARING_BITMAP_VERSION = 1;
+const size_t ROARING_BITMAP_HEADER = 24;
+// Serialized container descriptor: key, type, reserved, count of values or runs
+const size_t ROARING_BITMAP_DESCRIPTOR = 16;
+
+enum class RoaringOperation { AND, OR, ANDNOT };
+
+template <RoaringOperation operation>
+inline uint64_t RoaringWord(uint64_t word1, uint64_t word2) noexcept
+{
+    if constexpr (operation == RoaringOperation::AND)
+        return word1 & word2;
+    else if constexpr (operation == RoaringOperation::OR)
+        return word1 | word2;
+    else
+        return word1 & ~word2;
+}
+
+template <RoaringOperation operation>
+uint32_t RoaringBitmapWords(uint64_t* result, const uint64_t* words1, const uint64_t* words2) noexcept
+{
+    uint32_t cardinality = 0;
+    for (size_t i = 0; i < ROARING_BITMAP_WORDS; ++i)
+    {
+        result[i] = RoaringWord<operation>(words1[i], words2[i]);
+        cardinality += (uint32_t)std::popcount(result[i]);
+    }
+    return cardinality;
+}
+
+#if defined(CPPCOMMON_ROARING_BITMAP_AVX2)
+
+template <RoaringOperation operation>
+CPPCOMMON_ROARING_BITMAP_AVX2_TARGET
+uint32_t RoaringBitmapWordsAVX2(uint64_t* result, const uint64_t* words1, const uint64_t* words2) noexcept
+{
+    uint64_t cardinality = 0;
+    for (size_t i = 0; i < ROARING_BITMAP_WORDS; i += 4)
+    {
+        __m256i a = _mm256_loadu_si256((const __m256i*)(words1 + i));
+        __m256i b = _mm256_loadu_si256((const __m256i*)(words2 + i));
+        __m256i c;
+        if constexpr (operation == RoaringOperation::AND)
+            c = _mm256_and_si256(a, b);
+        else if constexpr (operation == RoaringOperation::OR)
+            c = _mm256_or_si256(a, b);
+        else
+            c = _mm256_andnot_si256(b, a);
+        _mm256_storeu_si256((__m256i*)(result + i), c);
+        cardinality += _mm_popcnt_u64(result[i + 0]) + _mm_popcnt_u64(result[i + 1]) + _mm_popcnt_u64(result[i + 2]) + _mm_popcnt_u64(result[i + 3]);
+    }
+    return (uint32_t)cardinality;
+}
+
+#endif
+
+template <RoaringOperation operation>
+uint32_t RoaringBitmapCombine(uint64_t* result, const uint64_t* words1, const uint64_t* words2) noexcept
+{
+#if defined(CPPCOMMON_ROARING_BITMAP_AVX2)
+    static const CPUDispatch<uint32_t(uint64_t*, const uint64_t*, const uint64_t*)> dispatch([]() { return CPU::HasAVX2() ? RoaringBitmapWordsAVX2<operation> : RoaringBitmapWords<operation>; });
+    return dispatch(result, words1, words2);
+#else
+    return RoaringBitmapWords<operation>(result, words1, words2);
+#endif
+}
+
+inline bool RoaringTest(const uint64_t* words, uint16_t low) noexcept
+{
+    return (words[low >> 6] >> (low & 63)) & 1;
+}
+
+inline void RoaringSet(uint64_t* words, uint16_t low) noexcept
+{
+    words[low >> 6] |= (uint64_t)1 << (low & 63);
+}
+
+inline void RoaringClear(uint64_t* words, uint16_t low) noexcept
+{
+    words[low >> 6] &= ~((uint64_t)1 << (low & 63));
+}
+
+// Set bits of the inclusive range [first, last]
+inline void RoaringSetRange(uint64_t* words, uint32_t first, uint32_t last) noexcept
+{
+    size_t first_word = first >> 6;
+    size_t last_word = last >> 6;
+    uint64_t first_mask = ~(uint64_t)0 << (first & 63);
+    uint64_t last_mask = ~(uint64_t)0 >> (63 - (last & 63));
+    if (first_word == last_word)
+    {
+        words[first_word] |= first_mask & last_mask;
+        return;
+    }
+    words[first_word] |= first_mask;
+    for (size_t i = first_word + 1; i < last_word; ++i)
+        words[i] = ~(uint64_t)0;
+    words[last_word] |= last_mask;
+}
+
+uint32_t RoaringCardinality(const uint64_t* words) noexcept
+{
+    uint32_t cardinality = 0;
+    for (size_t i = 0; i < ROARING_BITMAP_WORDS; ++i)
+        cardinality += (uint32_t)std::popcount(words[i]);
+    return cardinality;
+}
+
+void RoaringToBitmap(RoaringContainer& container)
+{
+    std::vector<uint64_t> words(ROARING_BITMAP_WORDS, 0);
+    if (container.type == RoaringContainerType::ARRAY)
+    {
+        for (uint16_t low : container.values)
+            RoaringSet(words.data(), low);
+    }
+    else if (container.type == RoaringContainerType::RUN)
+    {
+        for (size_t i = 0; i < container.values.size(); i += 2)
+            RoaringSetRange(words.data(), container.values[i], (uint32_t)container.values[i] + container.values[i + 1]);
+    }
+    else
+        return;
+
+    container.type = RoaringContainerType::BITMAP;
+    container.values = std::vector<uint16_t>();
+    container.words = std::move(words);
+}
+
+void RoaringToArray(RoaringContainer& container)
+{
+    std::vector<uint16_t> values;
+    values.reserve(container.cardinality);
+    if (container.type == RoaringContainerType::BITMAP)
+    {
+        for (size_t i = 0; i < ROARING_BITMAP_WORDS; ++i)
+        {
+            for (uint64_t word = container.words[i]; word != 0; word &= word - 1)
+                values.push_back((uint16_t)(i * 64 + std::countr_zero(word)));
+        }
+    }
+    else if (container.type == RoaringContainerType::RUN)
+    {
+        for (size_t i = 0; i < container.values.size(); i += 2)
+            for (uint32_t value = container.values[i]; value <= (uint32_t)container.values[i] + container.values[i + 1]; ++value)
+                values.push_back((uint16_t)value);
+    }
+    else
+        return;
+
+    container.type = RoaringContainerType::ARRAY;
+    container.values = std::move(values);
+    container.words = std::vector<uint64_t>();
+}
+
+// Convert the run container into the array or bitmap one
+void RoaringMaterialize(RoaringContainer& container)
+{
+    if (container.type != RoaringContainerType::RUN)
+        return;
+
+    if (container.cardinality <= RoaringBitmap::ARRAY_MAX_SIZE)
+        RoaringToArray(container);
+    else
+        RoaringToBitmap(container);
+}
+
+// Choose the array or bitmap container by the cardinality
+void RoaringNormalize(RoaringContainer& container)
+{
+    if ((container.type == RoaringContainerType::BITMAP) && (container.cardinality <= RoaringBitmap::ARRAY_MAX_SIZE))
+        RoaringToArray(container);
+    else if ((container.type == RoaringContainerType::ARRAY) && (container.cardinality > RoaringBitmap::ARRAY_MAX_SIZE))
+        RoaringToBitmap(container);
+}
+
+size_t RoaringRuns(const RoaringContainer& container) noexcept
+{
+    size_t runs = 0;
+    if (container.type == RoaringContainerType::ARRAY)
+    {
+        for (size_t i = 0; i < container.values.size(); ++i)
+            if ((i == 0) || (container.values[i] != (container.values[i - 1] + 1)))
+                ++runs;
+    }
+    else if (container.type == RoaringContainerType::BITMAP)
+    {
+        // Count bits which start runs: set bits with the previous bit unset
+        uint64_t carry = 0;
+        for (size_t i = 0; i < ROARING_BITMAP_WORDS; ++i)
+        {
+            uint64_t word = container.words[i];
+            runs += (size_t)std::popcount(word & ~((word << 1) | carry));
+            carry = word >> 63;
+        }
+    }
+    else
+        runs = container.values.size() / 2;
+    return runs;
+}
+
+void RoaringToRun(RoaringContainer& container)
+{
+    RoaringContainer array(container);
+    RoaringToArray(array);
+
+    std::vector<uint16_t> runs;
+    for (size_t i = 0; i < array.values.size();)
+    {
+        size_t j = i + 1;
+        while ((j < array.values.size()) && (array.values[j] == (array.values[j - 1] + 1)))
+            ++j;
+        runs.push_back(array.values[i]);
+        runs.push_back((uint16_t)(j - i - 1));
+        i = j;
+    }
+
+    container.type = RoaringContainerType::RUN;
+    container.values = std::move(runs);
+    container.words = std::vector<uint64_t>();
+}
+
+size_t RoaringBytes(const RoaringContainer& container) noexcept
+{
+    return container.values.size() * sizeof(uint16_t) + container.words.size() * sizeof(uint64_t);
+}
+
+bool RoaringContains(const RoaringContainer& container, uint16_t low) noexcept
+{
+    if (container.type == RoaringContainerType::ARRAY)
+        return std::binary_search(container.values.begin(), container.values.end(), low);
+    else if (container.type == RoaringContainerType::BITMAP)
+        return RoaringTest(container.words.data(), low);
+
+    // Find the last run which starts not after the value
+    size_t first = 0;
+    size_t last = container.values.size() / 2;
+    while (first < last)
+    {
+        size_t middle = (first + last) / 2;
+        if (container.values[middle * 2] <= low)
+            first = middle + 1;
+        else
+            last = middle;
+    }
+    if (first == 0)
+        return false;
+    size_t run = (first - 1) * 2;
+    return (low - container.values[run]) <= container.values[run + 1];
+}
+
+bool RoaringInsert(RoaringContainer& container, uint16_t low)
+{
+    RoaringMaterialize(container);
+
+    if (container.type == RoaringContainerType::BITMAP)
+    {
+        if (RoaringTest(container.words.data(), low))
+            return false;
+        RoaringSet(container.words.data(), low);
+        ++container.cardinality;
+        return true;
+    }
+
+    auto it = std::lower_bound(container.values.begin(), container.values.end(), low);
+    if ((it != container.values.end()) && (*it == low))
+        return false;
+
+    if (container.cardinality == RoaringBitmap::ARRAY_MAX_SIZE)
+    {
+        RoaringToBitmap(container);
+        RoaringSet(container.words.data(), low);
+    }
+    else
+        container.values.insert(it, low);
+    ++container.cardinality;
+    return true;
+}
+
+bool RoaringErase(RoaringContainer& container, uint16_t low)
+{
+    if (!RoaringContains(container, low))
+        return false;
+
+    RoaringMaterialize(container);
+
+    if (container.type == RoaringContainerType::BITMAP)
+    {
+        RoaringClear(container.words.data(), low);
+        --container.cardinality;
+        RoaringNormalize(container);
+    }
+    else
+    {
+        container.values.erase(std::lower_bound(container.values.begin(), container.values.end(), low));
+        --container.cardinality;
+    }
+    return true;
+}
+
+template <RoaringOperation operation>
+RoaringContainer RoaringCombine(const RoaringContainer& container1, const RoaringContainer& container2)
+{
+    // Run containers are combined as array or bitmap ones
+    RoaringContainer temp1, temp2;
+    const RoaringContainer* a = &container1;
+    const RoaringContainer* b = &container2;
+    if (a->type == RoaringContainerType::RUN)
+    {
+        temp1 = *a;
+        RoaringMaterialize(temp1);
+        a = &temp1;
+    }
+    if (b->type == RoaringContainerType::RUN)
+    {
+        temp2 = *b;
+        RoaringMaterialize(temp2);
+        b = &temp2;
+    }
+
+    RoaringContainer result;
+    bool bitmap1 = (a->type == RoaringContainerType::BITMAP);
+    bool bitmap2 = (b->type == RoaringContainerType::BITMAP);
+
+    if (bitmap1 && bitmap2)
+    {
+        result.type = RoaringContainerType::BITMAP;
+        result.words.resize(ROARING_BITMAP_WORDS);
+        result.cardinality = RoaringBitmapCombine<operation>(result.words.data(), a->words.data(), b->words.data());
+    }
+    else if (!bitmap1 && !bitmap2)
+    {
+        auto inserter = std::back_inserter(result.values);
+        if constexpr (operation == RoaringOperation::AND)
+            std::set_intersection(a->values.begin(), a->values.end(), b->values.begin(), b->values.end(), inserter);
+        else if constexpr (operation == RoaringOperation::OR)
+            std::set_union(a->values.begin(), a->values.end(), b->values.begin(), b->values.end(), inserter);
+        else
+            std::set_difference(a->values.begin(), a->values.end(), b->values.begin(), b->values.end(), inserter);
+        result.cardinality = (uint32_t)result.values.size();
+    }
+    else if constexpr (operation == RoaringOperation::AND)
+    {
+        // Filter values of the array container with the bitmap container
+        const RoaringContainer* array = bitmap1 ? b : a;
+        const RoaringContainer* bitmap = bitmap1 ? a : b;
+        for (uint16_t low : array->values)
+            if (RoaringTest(bitmap->words.data(), low))
+                result.values.push_back(low);
+        result.cardinality = (uint32_t)result.values.size();
+    }
+    else if constexpr (operation == RoaringOperation::OR)
+    {
+        // Set values of the array container in the copy of the bitmap container
+        const RoaringContainer* array = bitmap1 ? b : a;
+        const RoaringContainer* bitmap = bitmap1 ? a : b;
+        result = *bitmap;
+        for (uint16_t low : array->values)
+            if (!RoaringTest(result.words.data(), low))
+            {
+                RoaringSet(result.words.data(), low);
+                ++result.cardinality;
+            }
+    }
+    else if (bitmap1)
+    {
+        // Clear values of the array container in the copy of the bitmap container
+        result = *a;
+        for (uint16_t low : b->values)
+            if (RoaringTest(result.words.data(), low))
+            {
+                RoaringClear(result.words.data(), low);
+                --result.cardinality;
+            }
+    }
+    else
+    {
+        // Filter values of the array container with the bitmap container
+        for (uint16_t low : a->values)
+            if (!RoaringTest(b->words.data(), low))
+                result.values.push_back(low);
+        result.cardinality = (uint32_t)result.values.size();
+    }
+
+    RoaringNormalize(result);
+    return result;
+}
+
+bool RoaringEqual(const RoaringContainer& container1, const RoaringContainer& container2)
+{
+    if (container1.cardinality != container2.cardinality)
+        return false;
+    if (container1.type == container2.type)
+        return (container1.values == container2.values) && (container1.words == container2.words);
+
+    RoaringContainer temp1(container1);
+    RoaringContainer temp2(container2);
+    RoaringToBitmap(temp1);
+    RoaringToBitmap(temp2);
+    return temp1.words == temp2.words;
+}
+
+} // namespace Internals
+//! @endcond
+
+using namespace Internals;
+
+RoaringBitmap::iterator::iterator(const RoaringBitmap* bitmap, size_t container) noexcept
+    : _bitmap(bitmap), _container(container), _index(0), _word(0), _value(0)
+{
+    First();
+}
+
+void RoaringBitmap::iterator::First() noexcept
+{
+    _index = 0;
+    _word = 0;
+    _value = 0;
+
+    if (_container >= _bitmap->_keys.size())
+        return;
+
+    const RoaringContainer& container = _bitmap->_containers[_container];
+    uint64_t high = _bitmap->_keys[_container] << 16;
+
+    if (container.type == RoaringContainerType::BITMAP)
+    {
+        while (container.words[_index] == 0)
+            ++_index;
+        _word = container.words[_index];
+        _value = high | (_index * 64 + std::countr_zero(_word));
+        _word &= _word - 1;
+    }
+    else
+        _value = high | container.values[0];
+}
+
+RoaringBitmap::iterator& RoaringBitmap::iterator::operator++() noexcept
+{
+    assert((_container < _bitmap->_keys.size()) && "Iterator must be valid!");
+
+    const RoaringContainer& container = _bitmap->_containers[_container];
+    uint64_t high = _bitmap->_keys[_container] << 16;
+
+    if (container.type == RoaringContainerType::ARRAY)
+    {
+        if (++_index < container.values.size())
+        {
+            _value = high | container.values[_index];
+            return *this;
+        }
+    }
+    else if (container.type == RoaringContainerType::BITMAP)
+    {
+        while ((_word == 0) && (++_index < ROARING_BITMAP_WORDS))
+            _word = container.words[_index];
+        if (_word != 0)
+        {
+            _value = high | (_index * 64 + std::countr_zero(_word));
+            _word &= _word - 1;
+            return *this;
+        }
+    }
+    else
+    {
+        // Index is the current run, word is the offset inside the run
+        if (_word < container.values[_index * 2 + 1])
+        {
+            ++_value;
+            ++_word;
+            return *this;
+        }
+        if (++_index < (container.values.size() / 2))
+        {
+            _word = 0;
+            _value = high | container.values[_index * 2];
+            return *this;
+        }
+    }
+
+    // Move to the next container
+    ++_container;
+    First();
+    return *this;
+}
+
+RoaringBitmap::RoaringBitmap(std::initializer_list<uint64_t> values)
+{
+    insert(values.begin(), values.end());
+}
+
+uint64_t RoaringBitmap::size() const noexcept
+{
+    uint64_t result = 0;
+    for (const auto& container : _containers)
+        result += container.cardinality;
+    return result;
+}
+
+size_t RoaringBitmap::bytes() const noexcept
+{
+    size_t result = _keys.size() * (sizeof(uint64_t) + sizeof(RoaringContainer));
+    for (const auto& container : _containers)
+        result += RoaringBytes(container);
+    return result;
+}
+
+uint64_t RoaringBitmap::min() const noexcept
+{
+    assert(!empty() && "Roaring bitmap is empty!");
+    return *begin();
+}
+
+uint64_t RoaringBitmap::max() const noexcept
+{
+    assert(!empty() && "Roaring bitmap is empty!");
+
+    const RoaringContainer& container = _containers.back();
+    uint64_t high = _keys.back() << 16;
+
+    if (container.type == RoaringContainerType::ARRAY)
+        return high | container.values.back();
+    else if (container.type == RoaringContainerType::RUN)
+        return high | ((uint32_t)container.values[container.values.size() - 2] + container.values.back());
+
+    size_t index = ROARING_BITMAP_WORDS - 1;
+    while (container.words[index] == 0)
+        --index;
+    return high | (index * 64 + 63 - std::countl_zero(container.words[index]));
+}
+
+size_t RoaringBitmap::Find(uint64_t key) const noexcept
+{
+    return (size_t)(std::lower_bound(_keys.begin(), _keys.end(), key) - _keys.begin());
+}
+
+bool RoaringBitmap::contains(uint64_t value) const noexcept
+{
+    uint64_t key = value >> 16;
+    size_t index = Find(key);
+    if ((index == _keys.size()) || (_keys[index] != key))
+        return false;
+
+    return RoaringContains(_containers[index], (uint16_t)value);
+}
+
+bool RoaringBitmap::insert(uint64_t value)
+{
+    uint64_t key = value >> 16;
+    size_t index = Find(key);
+    if ((index == _keys.size()) || (_keys[index] != key))
+    {
+        _keys.insert(_keys.begin() + index, key);
+        _containers.insert(_containers.begin() + index, RoaringContainer());
+    }
+
+    return RoaringInsert(_containers[index], (uint16_t)value);
+}
+
+bool RoaringBitmap::erase(uint64_t value)
+{
+    uint64_t key = value >> 16;
+    size_t index = Find(key);
+    if ((index == _keys.size()) || (_keys[index] != key))
+        return false;
+
+    if (!RoaringErase(_containers[index], (uint16_t)value))
+        return false;
+
+    // Remove the empty container
+    if (_containers[index].cardinality == 0)
+    {
+        _keys.erase(_keys.begin() + index);
+        _containers.erase(_containers.begin() + index);
+    }
+    return true;
+}
+
+bool RoaringBitmap::optimize()
+{
+    bool result = false;
+    for (auto& container : _containers)
+    {
+        if (container.type == RoaringContainerType::RUN)
+            continue;
+
+        // Each run costs two 16-bit values
+        if ((RoaringRuns(container) * 2 * sizeof(uint16_t)) < RoaringBytes(container))
+        {
+            RoaringToRun(container);
+            result = true;
+        }
+    }
+    return result;
+}
+
+void RoaringBitmap::clear() noexcept
+{
+    _keys.clear();
+    _containers.clear();
+}
+
+RoaringBitmap& RoaringBitmap::operator&=(const RoaringBitmap& bitmap)
+{
+    *this = *this & bitmap;
+    return *this;
+}
+
+RoaringBitmap& RoaringBitmap::operator|=(const RoaringBitmap& bitmap)
+{
+    *this = *this | bitmap;
+    return *this;
+}
+
+RoaringBitmap& RoaringBitmap::operator-=(const RoaringBitmap& bitmap)
+{
+    *this = *this - bitmap;
+    return *this;
+}
+
+RoaringBitmap operator&(const RoaringBitmap& bitmap1, const RoaringBitmap& bitmap2)
+{
+    RoaringBitmap result;
+
+    size_t i = 0, j = 0;
+    while ((i < bitmap1._keys.size()) && (j < bitmap2._keys.size()))
+    {
+        if (bitmap1._keys[i] < bitmap2._keys[j])
+            ++i;
+        else if (bitmap2._keys[j] < bitmap1._keys[i])
+            ++j;
+        else
+        {
+            RoaringContainer container = RoaringCombine<RoaringOperation::AND>(bitmap1._containers[i++], bitmap2._containers[j]);
+            if (container.cardinality > 0)
+            {
+                result._keys.push_back(bitmap2._keys[j]);
+                result._containers.emplace_back(std::move(container));
+            }
+            ++j;
+        }
+    }
+
+    return result;
+}
+
+RoaringBitmap operator|(const RoaringBitmap& bitmap1, const RoaringBitmap& bitmap2)
+{
+    RoaringBitmap result;
+    result._keys.reserve(std::max(bitmap1._keys.size(), bitmap2._keys.size()));
+    result._containers.reserve(result._keys.capacity());
+
+    size_t i = 0, j = 0;
+    while ((i < bitmap1._keys.size()) || (j < bitmap2._keys.size()))
+    {
+        if ((j == bitmap2._keys.size()) || ((i < bitmap1._keys.size()) && (bitmap1._keys[i] < bitmap2._keys[j])))
+        {
+            result._keys.push_back(bitmap1._keys[i]);
+            result._containers.push_back(bitmap1._containers[i++]);
+        }
+        else if ((i == bitmap1._keys.size()) || (bitmap2._keys[j] < bitmap1._keys[i]))
+        {
+            result._keys.push_back(bitmap2._keys[j]);
+            result._containers.push_back(bitmap2._containers[j++]);
+        }
+        else
+        {
+            result._keys.push_back(bitmap1._keys[i]);
+            result._containers.emplace_back(RoaringCombine<RoaringOperation::OR>(bitmap1._containers[i++], bitmap2._containers[j++]));
+        }
+    }
+
+    return result;
+}
+
+RoaringBitmap operator-(const RoaringBitmap& bitmap1, const RoaringBitmap& bitmap2)
+{
+    RoaringBitmap result;
+
+    size_t j = 0;
+    for (size_t i = 0; i < bitmap1._keys.size(); ++i)
+    {
+        while ((j < bitmap2._keys.size()) && (bitmap2._keys[j] < bitmap1._keys[i]))
+            ++j;
+
+        if ((j < bitmap2._keys.size()) && (bitmap2._keys[j] == bitmap1._keys[i]))
+        {
+            RoaringContainer container = RoaringCombine<RoaringOperation::ANDNOT>(bitmap1._containers[i], bitmap2._containers[j]);
+            if (container.cardinality > 0)
+            {
+                result._keys.push_back(bitmap1._keys[i]);
+                result._containers.emplace_back(std::move(container));
+            }
+        }
+        else
+        {
+            result._keys.push_back(bitmap1._keys[i]);
+            result._containers.push_back(bitmap1._containers[i]);
+        }
+    }
+
+    return result;
+}
+
+bool operator==(const RoaringBitmap& bitmap1, const RoaringBitmap& bitmap2) noexcept
+{
+    if (bitmap1._keys != bitmap2._keys)
+        return false;
+
+    for (size_t i = 0; i < bitmap1._containers.size(); ++i)
+        if (!RoaringEqual(bitmap1._containers[i], bitmap2._containers[i]))
+            return false;
+
+    return true;
+}
+
+std::vector<uint8_t> RoaringBitmap::Serialize() const
+{
+    size_t size = ROARING_BITMAP_HEADER + _keys.size() * ROARING_BITMAP_DESCRIPTOR;
+    for (const auto& container : _containers)
+        size += RoaringBytes(container);
+
+    std::vector<uint8_t> result(size, 0);
+
+    uint8_t* buffer = result.data();
+    std::memcpy(buffer, ROARING_BITMAP_MAGIC, 4);
+    Endian::StoreLittleEndian<uint32_t>(buffer + 4, ROARING_BITMAP_VERSION);
+    Endian::StoreLittleEndian<uint64_t>(buffer + 8, (uint64_t)_keys.size());
+    Endian::StoreLittleEndian<uint64_t>(buffer + 16, this->size());
+    buffer += ROARING_BITMAP_HEADER;
+
+    for (size_t i = 0; i < _keys.size(); ++i)
+    {
+        const RoaringContainer& container = _containers[i];
+        uint32_t count = (container.type == RoaringContainerType::RUN) ? (uint32_t)(container.values.size() / 2) : container.cardinality;
+        Endian::StoreLittleEndian<uint64_t>(buffer, _keys[i]);
+        buffer[8] = (uint8_t)container.type;
+        Endian::StoreLittleEndian<uint32_t>(buffer + 12, count);
+        buffer += ROARING_BITMAP_DESCRIPTOR;
+
+        for (uint16_t value : container.values)
+        {
+            Endian::StoreLittleEndian<uint16_t>(buffer, value);
+            buffer += sizeof(uint16_t);
+        }
+        for (uint64_t word : container.words)
+        {
+            Endian::StoreLittleEndian<uint64_t>(buffer, word);
+            buffer += sizeof(uint64_t);
+        }
+    }
+
+    return result;
+}
+
+void RoaringBitmap::Serialize(Writer& writer) const
+{
+    if constexpr (Endian::IsLittleEndian())
+    {
+        // Write containers payload as is without intermediate copy
+        std::vector<uint8_t> descriptors(ROARING_BITMAP_HEADER + _keys.size() * ROARING_BITMAP_DESCRIPTOR, 0);
+        std::vector<Writer::WriteBuffer> buffers;
+        buffers.reserve(1 + _keys.size() * 2);
+
+        uint8_t* buffer = descriptors.data();
+        std::memcpy(buffer, ROARING_BITMAP_MAGIC, 4);
+        Endian::StoreLittleEndian<uint32_t>(buffer + 4, ROARING_BITMAP_VERSION);
+        Endian::StoreLittleEndian<uint64_t>(buffer + 8, (uint64_t)_keys.size());
+        Endian::StoreLittleEndian<uint64_t>(buffer + 16, size());
+        buffers.push_back({ buffer, ROARING_BITMAP_HEADER });
+        buffer += ROARING_BITMAP_HEADER;
+
+        for (size_t i = 0; i < _keys.size(); ++i)
+        {
+            const RoaringContainer& container = _containers[i];
+            uint32_t count = (container.type == RoaringContainerType::RUN) ? (uint32_t)(container.values.size() / 2) : container.cardinality;
+            Endian::StoreLittleEndian<uint64_t>(buffer, _keys[i]);
+            buffer[8] = (uint8_t)container.type;
+            Endian::StoreLittleEndian<uint32_t>(buffer + 12, count);
+            buffers.push_back({ buffer, ROARING_BITMAP_DESCRIPTOR });
+            buffer += ROARING_BITMAP_DESCRIPTOR;
+
+            if (container.type == RoaringContainerType::BITMAP)
+                buffers.push_back({ container.words.data(), container.words.size() * sizeof(uint64_t) });
+            else
+                buffers.push_back({ container.values.data(), container.values.size() * sizeof(uint16_t) });
+        }
+
+        writer.WriteV(buffers);
+    }
+    else
+    {
+        std::vector<uint8_t> buffer = Serialize();
+        writer.Write(buffer.data(), buffer.size());
+    }
+}
+
+size_t RoaringBitmap::Deserialize(std::span<const uint8_t> buffer, RoaringBitmap& bitmap)
+{
+    if (buffer.size() < ROARING_BITMAP_HEADER)
+        return 0;
+
+    const uint8_t* data = buffer.data();
+    if (std::memcmp(data, ROARING_BITMAP_MAGIC, 4) != 0)
+        return 0;
+    if (Endian::LoadLittleEndian<uint32_t>(data + 4) != ROARING_BITMAP_VERSION)
+        return 0;
+
+    uint64_t containers = Endian::LoadLittleEndian<uint64_t>(data + 8);
+    uint64_t cardinality = Endian::LoadLittleEndian<uint64_t>(data + 16);
+    if (containers > (buffer.size() - ROARING_BITMAP_HEADER) / ROARING_BITMAP_DESCRIPTOR)
+        return 0;
+
+    RoaringBitmap result;
+    result._keys.reserve((size_t)containers);
+    result._containers.reserve((size_t)containers);
+
+    size_t offset = ROARING_BITMAP_HEADER;
+    uint64_t total = 0;
+    for (uint64_t i = 0; i < containers; ++i)
+    {
+        if ((buffer.size() - offset) < ROARING_BITMAP_DESCRIPTOR)
+            return 0;
+
+        uint64_t key = Endian::LoadLittleEndian<uint64_t>(data + offset);
+        uint8_t type = data[offset + 8];
+        uint32_t count = Endian::LoadLittleEndian<uint32_t>(data + offset + 12);
+        offset += ROARING_BITMAP_DESCRIPTOR;
+
+        // Keys must be sorted and unique, containers must not be empty
+        if ((key > (UINT64_MAX >> 16)) || (!result._keys.empty() && (key <= result._keys.back())) || (count == 0))
+            return 0;
+
+        RoaringContainer container;
+        container.type = (RoaringContainerType)type;
+        if (container.type == RoaringContainerType::BITMAP)
+        {
+            if ((buffer.size() - offset) < ROARING_BITMAP_WORDS * sizeof(uint64_t))
+                return 0;
+            container.words.resize(ROARING_BITMAP_WORDS);
+            for (size_t j = 0; j < ROARING_BITMAP_WORDS; ++j, offset += sizeof(uint64_t))
+                container.words[j] = Endian::LoadLittleEndian<uint64_t>(data + offset);
+            container.cardinality = RoaringCardinality(container.words.data());
+            if (container.cardinality != count)
+                return 0;
+        }
+        else if ((container.type == RoaringContainerType::ARRAY) || (container.type == RoaringContainerType::RUN))
+        {
+            size_t values = (container.type == RoaringContainerType::RUN) ? ((size_t)count * 2) : (size_t)count;
+            if ((values > 65536 * 2) || ((buffer.size() - offset) / sizeof(uint16_t) < values))
+                return 0;
+            container.values.resize(values);
+            for (size_t j = 0; j < values; ++j, offset += sizeof(uint16_t))
+                container.values[j] = Endian::LoadLittleEndian<uint16_t>(data + offset);
+
+            if (container.type == RoaringContainerType::ARRAY)
+            {
+                if (!std::is_sorted(container.values.begin(), container.values.end()) || (std::adjacent_find(container.values.begin(), container.values.end()) != container.values.end()))
+                    return 0;
+                container.cardinality = count;
+            }
+            else
+            {
+                // Runs must be sorted and must not overlap
+                uint32_t next = 0;
+                for (size_t j = 0; j < values; j += 2)
+                {
+                    uint32_t start = container.values[j];
+                    uint32_t end = start + container.values[j + 1];
+                    if ((start < next) || (end > UINT16_MAX))
+                        return 0;
+                    container.cardinality += end - start + 1;
+                    next = end + 1;
+                }
+            }
+        }
+        else
+            return 0;
+
+        total += container.cardinality;
+        result._keys.push_back(key);
+        result._containers.emplace_back(std::move(container));
+    }
+
+    if (total != cardinality)
+        return 0;
+
+    bitmap = std::move(result);
+    return offset;
+}
+
+void RoaringBitmap::swap(RoaringBitmap& bitmap) noexcept
+{
+    using std::swap;
+    swap(_keys, bitmap._keys);
+    swap(_containers, bitmap._containers);
+}
+
+} // namespace CppCommon
@@ -14,6 +14,8 @@
 #include "utility/resource.h"
 #include "utility/validate_aligned_storage.h"
 
+#include <algorithm>
+#include <cerrno>
 #include <cstring>
 #include <exception>
 #include <iostream>
@@ -21,8 +23,15 @@
 #if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
 #include "string/format.h"
 #include "utility/countof.h"
+#include <atomic>
+#include <sys/mman.h>
+#include <fcntl.h>
 #include <signal.h>
+#include <time.h>
 #include <unistd.h>
+#if defined(__linux__)
+#include <sys/syscall.h>
+#endif
 #elif defined(_WIN32) || defined(_WIN64)
 #if defined(_MSC_VER)
 #include <intrin.h>
@@ -47,6 +56,348 @@ namespace CppCommon {
 
 //! @cond INTERNALS
 
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+
+namespace Internals {
+
+//! Get the signal description
+const char* SignalDescription(int signo) noexcept
+{
+    switch (signo)
+    {
+        case SIGABRT: return "Caught abnormal program termination (SIGABRT) signal";
+        case SIGALRM: return "Caught alarm clock (SIGALRM) signal";
+        case SIGBUS: return "Caught memory access error (SIGBUS) signal";
+        case SIGFPE: return "Caught floating point exception (SIGFPE) signal";
+        case SIGHUP: return "Caught hangup instruction (SIGHUP) signal";
+        case SIGILL: return "Caught illegal instruction (SIGILL) signal";
+        case SIGINT: return "Caught terminal interrupt (SIGINT) signal";
+        case SIGPIPE: return "Caught pipe write error (SIGPIPE) signal";
+        case SIGPROF: return "Caught profiling timer expired error (SIGPROF) signal";
+        case SIGQUIT: return "Caught terminal quit (SIGQUIT) signal";
+        case SIGSEGV: return "Caught illegal storage access error (SIGSEGV) signal";
+        case SIGSYS: return "Caught bad system call (SIGSYS) signal";
+        case SIGTERM: return "Caught termination request (SIGTERM) signal";
+        case SIGXCPU: return "Caught CPU time limit exceeded (SIGXCPU) signal";
+        case SIGXFSZ: return "Caught file size limit exceeded (SIGXFSZ) signal";
+        default: return nullptr;
+    }
+}
+
+//! Emergency crash reporting state
+/*!
+    All emergency state is preallocated in the static storage,
+    so the signal handler never allocates memory.
+*/
+struct EmergencyState
+{
+    static const int FRAMES = 256;
+    static const size_t BUFFER = 4096;
+
+    std::atomic<bool> enabled{false};
+    std::atomic<void*> owner{nullptr};
+    char directory[4096];
+    char filename[4096 + 64];
+    void* frames[FRAMES];
+    char buffer[BUFFER];
+    char maps[1024];
+    char line[512];
+};
+
+EmergencyState emergency;
+
+// Unique address of the current thread to detect recursive crashes
+thread_local char emergency_thread;
+
+//! Async-signal-safe crash report writer
+class EmergencyWriter
+{
+public:
+    explicit EmergencyWriter(int fd) noexcept : _fd(fd), _size(0) {}
+    EmergencyWriter(const EmergencyWriter&) = delete;
+    EmergencyWriter(EmergencyWriter&&) = delete;
+    ~EmergencyWriter() { Flush(); }
+
+    EmergencyWriter& operator=(const EmergencyWriter&) = delete;
+    EmergencyWriter& operator=(EmergencyWriter&&) = delete;
+
+    EmergencyWriter& Text(const char* data, size_t size) noexcept
+    {
+        while (size > 0)
+        {
+            if (_size == EmergencyState::BUFFER)
+                Flush();
+            size_t chunk = std::min(size, EmergencyState::BUFFER - _size);
+            std::memcpy(emergency.buffer + _size, data, chunk);
+            _size += chunk;
+            data += chunk;
+            size -= chunk;
+        }
+        return *this;
+    }
+    EmergencyWriter& Text(const char* str) noexcept
+    { return Text(str, std::strlen(str)); }
+
+    EmergencyWriter& Number(uint64_t value) noexcept
+    {
+        char digits[20];
+        size_t index = sizeof(digits);
+        do
+        {
+            digits[--index] = (char)('0' + (value % 10));
+            value /= 10;
+        } while (value > 0);
+        return Text(digits + index, sizeof(digits) - index);
+    }
+
+    EmergencyWriter& Hex(uintptr_t value) noexcept
+    {
+        const char* hex = "0123456789ABCDEF";
+        char digits[2 + 2 * sizeof(uintptr_t)];
+        digits[0] = '0';
+        digits[1] = 'x';
+        for (size_t i = 0; i < 2 * sizeof(uintptr_t); ++i)
+            digits[sizeof(digits) - 1 - i] = hex[(value >> (4 * i)) & 0xF];
+        return Text(digits, sizeof(digits));
+    }
+
+    void Flush() noexcept
+    {
+        const char* data = emergency.buffer;
+        while (_size > 0)
+        {
+            ssize_t written = write(_fd, data, _size);
+            if (written < 0)
+            {
+                if (errno == EINTR)
+                    continue;
+                break;
+            }
+            data += written;
+            _size -= (size_t)written;
+        }
+        _size = 0;
+    }
+
+private:
+    int _fd;
+    size_t _size;
+};
+
+//! Write executable modules map for offline symbolization
+void EmergencyModules(EmergencyWriter& writer) noexcept
+{
+#if defined(__linux__)
+    int fd = open("/proc/self/maps", O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
+        return;
+
+    writer.Text("Modules:\n");
+
+    size_t length = 0;
+    bool truncated = false;
+    for (;;)
+    {
+        ssize_t size = read(fd, emergency.maps, sizeof(emergency.maps));
+        if (size < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            break;
+        }
+        if (size == 0)
+            break;
+
+        for (ssize_t i = 0; i < size; ++i)
+        {
+            char ch = emergency.maps[i];
+            if (ch != '\n')
+            {
+                if (length < sizeof(emergency.line))
+                    emergency.line[length++] = ch;
+                else
+                    truncated = true;
+                continue;
+            }
+
+            // Write only executable mappings: "start-end perms offset dev inode path"
+            const char* space = (const char*)std::memchr(emergency.line, ' ', length);
+            if ((space != nullptr) && ((size_t)(space - emergency.line) + 3 < length) && (space[3] == 'x'))
+            {
+                writer.Text(emergency.line, length);
+                writer.Text(truncated ? "...\n" : "\n");
+            }
+
+            length = 0;
+            truncated = false;
+        }
+    }
+
+    close(fd);
+#endif
+}
+
+//! Write the emergency crash report
+void EmergencyReport(int signo, siginfo_t* info) noexcept
+{
+    // Another crashing thread waits for the process termination by the first crash report
+    void* thread = &emergency_thread;
+    void* expected = nullptr;
+    if (!emergency.owner.compare_exchange_strong(expected, thread))
+    {
+        // Recursive crash of the reporting thread skips the report
+        if (expected == thread)
+            return;
+
+        for (;;)
+        {
+            struct timespec timeout = { 1, 0 };
+            nanosleep(&timeout, nullptr);
+        }
+    }
+
+    // Capture raw stack frames (skip the current and the signal handler frames)
+    int frames = StackTrace::Capture(emergency.frames, EmergencyState::FRAMES, 2);
+
+    struct timespec timestamp;
+    clock_gettime(CLOCK_REALTIME, &timestamp);
+    uint64_t nanoseconds = (uint64_t)timestamp.tv_sec * 1000000000ull + (uint64_t)timestamp.tv_nsec;
+
+#if defined(__linux__)
+    uint64_t tid = (uint64_t)syscall(SYS_gettid);
+#else
+    uint64_t tid = (uint64_t)pthread_self();
+#endif
+
+    // Open the crash report file or use the standard error output
+    int fd = STDERR_FILENO;
+    if (emergency.directory[0] != 0)
+    {
+        size_t length = std::strlen(emergency.directory);
+        std::memcpy(emergency.filename, emergency.directory, length);
+        char* filename = emergency.filename + length;
+        std::memcpy(filename, "/crash.", 7);
+        filename += 7;
+        for (uint64_t value : { (uint64_t)getpid(), nanoseconds })
+        {
+            char digits[20];
+            size_t index = sizeof(digits);
+            do
+            {
+                digits[--index] = (char)('0' + (value % 10));
+                value /= 10;
+            } while (value > 0);
+            std::memcpy(filename, digits + index, sizeof(digits) - index);
+            filename += sizeof(digits) - index;
+            *filename++ = '.';
+        }
+        std::memcpy(filename, "txt", 4);
+
+        int file = open(emergency.filename, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH);
+        if (file >= 0)
+            fd = file;
+    }
+
+    {
+        EmergencyWriter writer(fd);
+
+        const char* description = SignalDescription(signo);
+        writer.Text("*** Crash report ***\n");
+        writer.Text("Signal: ").Text((description != nullptr) ? description : "Caught unknown signal").Text(" (").Number(signo).Text(")\n");
+        if (info != nullptr)
+        {
+            writer.Text("Code: ").Number((uint64_t)(unsigned)info->si_code).Text("\n");
+            writer.Text("Address: ").Hex((uintptr_t)info->si_addr).Text("\n");
+        }
+        writer.Text("Process: ").Number((uint64_t)getpid()).Text("\n");
+        writer.Text("Thread: ").Number(tid).Text("\n");
+        writer.Text("Timestamp: ").Number(nanoseconds).Text("\n");
+        writer.Text("Stack trace:\n");
+        for (int i = 0; i < frames; ++i)
+            writer.Hex((uintptr_t)emergency.frames[i]).Text("\n");
+        EmergencyModules(writer);
+    }
+
+    if (fd != STDERR_FILENO)
+    {
+        fsync(fd);
+        close(fd);
+    }
+}
+
+//! Preallocated alternate signal stack of the current thread
+class AlternateStack
+{
+public:
+    AlternateStack() noexcept : _memory(nullptr), _size(0) {}
+    AlternateStack(const AlternateStack&) = delete;
+    AlternateStack(AlternateStack&&) = delete;
+    ~AlternateStack() { Release(); }
+
+    AlternateStack& operator=(const AlternateStack&) = delete;
+    AlternateStack& operator=(AlternateStack&&) = delete;
+
+    void Install()
+    {
+        // Check for double installation
+        if (_memory != nullptr)
+            return;
+
+        size_t page = (size_t)sysconf(_SC_PAGESIZE);
+        size_t size = std::max((size_t)65536, (size_t)SIGSTKSZ);
+        size = (size + page - 1) / page * page;
+
+        // Allocate the alternate signal stack with the guard page below it
+        void* memory = mmap(nullptr, size + page, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (memory == MAP_FAILED)
+            throwex SystemException("Failed to allocate the alternate signal stack!");
+        mprotect(memory, page, PROT_NONE);
+
+        stack_t stack;
+        memset(&stack, 0, sizeof(stack));
+        stack.ss_sp = (char*)memory + page;
+        stack.ss_size = size;
+        if (sigaltstack(&stack, nullptr) != 0)
+        {
+            munmap(memory, size + page);
+            throwex SystemException("Failed to setup the alternate signal stack!");
+        }
+
+        _memory = memory;
+        _size = size + page;
+    }
+
+    void Release() noexcept
+    {
+        if (_memory == nullptr)
+            return;
+
+        // Disable the alternate signal stack if it is still installed
+        stack_t stack;
+        if ((sigaltstack(nullptr, &stack) == 0) && ((stack.ss_flags & SS_DISABLE) == 0) && (stack.ss_sp == (char*)_memory + (_size - stack.ss_size)))
+        {
+            stack_t disable;
+            memset(&disable, 0, sizeof(disable));
+            disable.ss_flags = SS_DISABLE;
+            sigaltstack(&disable, nullptr);
+        }
+
+        munmap(_memory, _size);
+        _memory = nullptr;
+        _size = 0;
+    }
+
+private:
+    void* _memory;
+    size_t _size;
+};
+
+thread_local AlternateStack alternate_stack;
+
+} // namespace Internals
+
+#endif
+
 class ExceptionsHandler::Impl
 {
 public:
@@ -105,7 +456,7 @@ public:
         struct sigaction sa;
         memset(&sa, 0, sizeof(sa));
         sa.sa_sigaction = SignalHandler;
-        sa.sa_flags = SA_SIGINFO;
+        sa.sa_flags = SA_SIGINFO | SA_ONSTACK;
 
         // Define signals to catch
         int signals[] =
@@ -169,6 +520,31 @@ public:
 
         // Catch an illegal storage access error
         signal(SIGSEGV, SigsegvHandler);
+#elif defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+        // Install the preallocated alternate signal stack in emergency mode
+        if (Internals::emergency.enabled.load(std::memory_order_acquire))
+            Internals::alternate_stack.Install();
+#endif
+    }
+
+    static void SetupEmergency(const Path& directory)
+    {
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+        // Prepare crash reports directory
+        const std::string& path = directory.string();
+        if (path.size() >= sizeof(Internals::emergency.directory))
+            throwex FileSystemException("Crash reports directory path is too long!").Attach(directory);
+        std::memcpy(Internals::emergency.directory, path.data(), path.size());
+        Internals::emergency.directory[path.size()] = 0;
+
+        // Capture stack frames once to load the unwinder library outside of the signal context
+        void* frames[1];
+        StackTrace::Capture(frames, 1);
+
+        // Install the preallocated alternate signal stack for the current thread
+        Internals::alternate_stack.Install();
+
+        Internals::emergency.enabled.store(true, std::memory_order_release);
 #endif
     }
 
@@ -565,57 +941,19 @@ private:
     // Signal handler
     static void SignalHandler(int signo, siginfo_t* info, void* context)
     {
-        // Output error
-        switch (signo)
+        if (Internals::emergency.enabled.load(std::memory_order_acquire))
         {
-            case SIGABRT:
-                GetInstance()._handler(__LOCATION__ + SystemException("Caught abnormal program termination (SIGABRT) signal"), StackTrace(1));
-                break;
-            case SIGALRM:
-                GetInstance()._handler(__LOCATION__ + SystemException("Caught alarm clock (SIGALRM) signal"), StackTrace(1));
-                break;
-            case SIGBUS:
-                GetInstance()._handler(__LOCATION__ + SystemException("Caught memory access error (SIGBUS) signal"), StackTrace(1));
-                break;
-            case SIGFPE:
-                GetInstance()._handler(__LOCATION__ + SystemException("Caught floating point exception (SIGFPE) signal"), StackTrace(1));
-                break;
-            case SIGHUP:
-                GetInstance()._handler(__LOCATION__ + SystemException("Caught hangup instruction (SIGHUP) signal"), StackTrace(1));
-                break;
-            case SIGILL:
-                GetInstance()._handler(__LOCATION__ + SystemException("Caught illegal instruction (SIGILL) signal"), StackTrace(1));
-                break;
-            case SIGINT:
-                GetInstance()._handler(__LOCATION__ + SystemException("Caught terminal interrupt (SIGINT) signal"), StackTrace(1));
-                break;
-            case SIGPIPE:
-                GetInstance()._handler(__LOCATION__ + SystemException("Caught pipe write error (SIGPIPE) signal"), StackTrace(1));
-                break;
-            case SIGPROF:
-                GetInstance()._handler(__LOCATION__ + SystemException("Caught profiling timer expired error (SIGPROF) signal"), StackTrace(1));
-                break;
-            case SIGQUIT:
-                GetInstance()._handler(__LOCATION__ + SystemException("Caught terminal quit (SIGQUIT) signal"), StackTrace(1));
-                break;
-            case SIGSEGV:
-                GetInstance()._handler(__LOCATION__ + SystemException("Caught illegal storage access error (SIGSEGV) signal"), StackTrace(1));
-                break;
-            case SIGSYS:
-                GetInstance()._handler(__LOCATION__ + SystemException("Caught bad system call (SIGSYS) signal"), StackTrace(1));
-                break;
-            case SIGTERM:
-                GetInstance()._handler(__LOCATION__ + SystemException("Caught termination request (SIGTERM) signal"), StackTrace(1));
-                break;
-            case SIGXCPU:
-                GetInstance()._handler(__LOCATION__ + SystemException("Caught CPU time limit exceeded (SIGXCPU) signal"), StackTrace(1));
-                break;
-            case SIGXFSZ:
-                GetInstance()._handler(__LOCATION__ + SystemException("Caught file size limit exceeded (SIGXFSZ) signal"), StackTrace(1));
-                break;
-            default:
+            // Write async-signal-safe crash report
+            Internals::EmergencyReport(signo, info);
+        }
+        else
+        {
+            // Output error
+            const char* description = Internals::SignalDescription(signo);
+            if (description != nullptr)
+                GetInstance()._handler(__LOCATION__ + SystemException(description), StackTrace(1));
+            else
                 GetInstance()._handler(__LOCATION__ + SystemException(format("Caught unknown signal - {}", signo)), StackTrace(1));
-                break;
         }
 
         // Prepare signal action structure
@@ -656,5 +994,6 @@ ExceptionsHandler::~ExceptionsHandler()
 void ExceptionsHandler::SetupHandler(const std::function<void (const SystemException&, const StackTrace&)>& handler) { GetInstance().impl().SetupHandler(handler); }
 void ExceptionsHandler::SetupProcess() { GetInstance().impl().SetupProcess(); }
 void ExceptionsHandler::SetupThread() { GetInstance().impl().SetupThread(); }
+void ExceptionsHandler::SetupEmergency(const Path& directory) { GetInstance().impl().SetupEmergency(directory); }
 
 } // namespace CppCommon
@@ -0,0 +1,919 @@
+/*!
+    \file async_file.cpp
+    \brief Filesystem asynchronous file implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "filesystem/async_file.h"
+
+#include "errors/fatal.h"
+#include "filesystem/exceptions.h"
+
+#include <algorithm>
+#include <cassert>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#if defined(__linux__)
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#if defined(__NR_io_uring_setup) && defined(__NR_io_uring_enter)
+#define CPPCOMMON_ASYNC_FILE_IO_URING
+#endif
+#endif
+#elif defined(_WIN32) || defined(_WIN64)
+#include <windows.h>
+#endif
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+namespace Internals {
+
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+
+mode_t file_mode(const Flags<FilePermissions>& permissions)
+{
+    mode_t mode = 0;
+    if (permissions & FilePermissions::IRUSR)
+        mode |= S_IRUSR;
+    if (permissions & FilePermissions::IWUSR)
+        mode |= S_IWUSR;
+    if (permissions & FilePermissions::IXUSR)
+        mode |= S_IXUSR;
+    if (permissions & FilePermissions::IRGRP)
+        mode |= S_IRGRP;
+    if (permissions & FilePermissions::IWGRP)
+        mode |= S_IWGRP;
+    if (permissions & FilePermissions::IXGRP)
+        mode |= S_IXGRP;
+    if (permissions & FilePermissions::IROTH)
+        mode |= S_IROTH;
+    if (permissions & FilePermissions::IWOTH)
+        mode |= S_IWOTH;
+    if (permissions & FilePermissions::IXOTH)
+        mode |= S_IXOTH;
+    if (permissions & FilePermissions::ISUID)
+        mode |= S_ISUID;
+    if (permissions & FilePermissions::ISGID)
+        mode |= S_ISGID;
+    if (permissions & FilePermissions::ISVTX)
+        mode |= S_ISVTX;
+    return mode;
+}
+
+#endif
+
+} // namespace Internals
+//! @endcond
+
+class AsyncFile::Impl
+{
+public:
+    Impl(const Path& path, size_t depth, AsyncFileBackend backend)
+        : _path(path), _backend(backend), _operations(depth), _free(0), _pending(0), _stop(false)
+    {
+        assert((depth > 0) && "Asynchronous file queue depth must be greater than zero!");
+        if (depth == 0)
+            throwex FileSystemException("Asynchronous file queue depth must be greater than zero!").Attach(_path);
+
+        // Link all operations into the free list
+        for (size_t i = 0; i < depth; ++i)
+            _operations[i].next = ((i + 1) < depth) ? (i + 1) : NIL;
+        _queued.reserve(depth);
+
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+        _file = -1;
+#if defined(CPPCOMMON_ASYNC_FILE_IO_URING)
+        _ring = -1;
+        if ((_backend == AsyncFileBackend::AUTO) || (_backend == AsyncFileBackend::IO_URING))
+        {
+            if (SetupRing())
+                _backend = AsyncFileBackend::IO_URING;
+            else if (_backend == AsyncFileBackend::IO_URING)
+                throwex FileSystemException("Cannot setup the io_uring asynchronous file backend!").Attach(_path);
+        }
+#endif
+        if (_backend == AsyncFileBackend::AUTO)
+            _backend = AsyncFileBackend::THREAD;
+        if (_backend != AsyncFileBackend::IO_URING && _backend != AsyncFileBackend::THREAD)
+            throwex FileSystemException("Asynchronous file backend is not supported!").Attach(_path);
+#elif defined(_WIN32) || defined(_WIN64)
+        _file = INVALID_HANDLE_VALUE;
+        _port = nullptr;
+        _inflight = 0;
+        if (_backend == AsyncFileBackend::AUTO)
+            _backend = AsyncFileBackend::IOCP;
+        if (_backend != AsyncFileBackend::IOCP && _backend != AsyncFileBackend::THREAD)
+            throwex FileSystemException("Asynchronous file backend is not supported!").Attach(_path);
+#endif
+
+        if (_backend == AsyncFileBackend::THREAD)
+            _thread = std::thread([this]() { Run(); });
+    }
+
+    ~Impl()
+    {
+        try
+        {
+            if (IsFileOpened())
+                Close();
+        }
+        catch (const FileSystemException& ex)
+        {
+            fatality(FileSystemException(ex.string()).Attach(_path));
+        }
+
+        if (_backend == AsyncFileBackend::THREAD)
+        {
+            {
+                std::scoped_lock locker(_lock);
+                _stop = true;
+            }
+            _submit_cv.notify_one();
+            _thread.join();
+        }
+
+#if defined(CPPCOMMON_ASYNC_FILE_IO_URING)
+        if (_backend == AsyncFileBackend::IO_URING)
+            CloseRing();
+#endif
+    }
+
+    const Path& path() const noexcept { return _path; }
+    AsyncFileBackend backend() const noexcept { return _backend; }
+    size_t depth() const noexcept { return _operations.size(); }
+    size_t pending() const noexcept { return _pending; }
+    size_t queued() const noexcept { return _queued.size(); }
+
+    bool IsFileOpened() const noexcept
+    {
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+        return (_file >= 0);
+#elif defined(_WIN32) || defined(_WIN64)
+        return (_file != INVALID_HANDLE_VALUE);
+#endif
+    }
+
+    void Open(bool read, bool write, bool truncate, bool create, const Flags<FilePermissions>& permissions)
+    {
+        // Close previously opened file
+        assert(!IsFileOpened() && "File is already opened!");
+        if (IsFileOpened())
+            Close();
+
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+        int flags = ((read && write) ? O_RDWR : (read ? O_RDONLY : (write ? O_WRONLY : 0)));
+        if (create)
+            flags |= O_CREAT;
+        if (truncate)
+            flags |= O_TRUNC;
+        _file = open(_path.string().c_str(), flags, Internals::file_mode(permissions));
+        if (_file < 0)
+            throwex FileSystemException(create ? "Cannot create a new file!" : "Cannot open existing file!").Attach(_path);
+#elif defined(_WIN32) || defined(_WIN64)
+        DWORD disposition = create ? (truncate ? CREATE_ALWAYS : OPEN_ALWAYS) : (truncate ? TRUNCATE_EXISTING : OPEN_EXISTING);
+        DWORD flags = FILE_ATTRIBUTE_NORMAL | ((_backend == AsyncFileBackend::IOCP) ? FILE_FLAG_OVERLAPPED : 0);
+        _file = CreateFileW(_path.wstring().c_str(), (read ? GENERIC_READ : 0) | (write ? GENERIC_WRITE : 0), FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr, disposition, flags, nullptr);
+        if (_file == INVALID_HANDLE_VALUE)
+            throwex FileSystemException(create ? "Cannot create a new file!" : "Cannot open existing file!").Attach(_path);
+
+        if (_backend == AsyncFileBackend::IOCP)
+        {
+            _port = CreateIoCompletionPort(_file, nullptr, 0, 1);
+            if (_port == nullptr)
+            {
+                CloseHandle(_file);
+                _file = INVALID_HANDLE_VALUE;
+                throwex FileSystemException("Cannot create the I/O completion port of the file!").Attach(_path);
+            }
+        }
+#endif
+    }
+
+    void Close()
+    {
+        assert(IsFileOpened() && "File is not opened!");
+        if (!IsFileOpened())
+            throwex FileSystemException("File is not opened!").Attach(_path);
+
+        // Complete all outstanding operations including ones queued by callbacks
+        while (_pending > 0)
+            Wait(_pending);
+
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+        int result = close(_file);
+        _file = -1;
+        if (result != 0)
+            throwex FileSystemException("Cannot close the file descriptor!").Attach(_path);
+#elif defined(_WIN32) || defined(_WIN64)
+        if (_port != nullptr)
+        {
+            CloseHandle(_port);
+            _port = nullptr;
+        }
+        BOOL result = CloseHandle(_file);
+        _file = INVALID_HANDLE_VALUE;
+        if (!result)
+            throwex FileSystemException("Cannot close the file handle!").Attach(_path);
+#endif
+    }
+
+    bool Enqueue(AsyncFileOperation operation, uint64_t offset, char* buffer, size_t size, Callback&& callback)
+    {
+        assert(IsFileOpened() && "File is not opened!");
+        if (!IsFileOpened())
+            throwex FileSystemException("File is not opened!").Attach(_path);
+
+        // Check for the exhausted queue depth
+        if (_free == NIL)
+            return false;
+
+        size_t index = _free;
+        Operation& op = _operations[index];
+        _free = op.next;
+        ++_pending;
+
+        op.type = operation;
+        op.offset = offset;
+        op.buffer = buffer;
+        op.size = size;
+        op.done = 0;
+        op.error = 0;
+        op.callback = std::move(callback);
+
+        _queued.push_back(index);
+        return true;
+    }
+
+    size_t Submit()
+    {
+        size_t result = _queued.size();
+        if (result == 0)
+            return 0;
+
+        switch (_backend)
+        {
+#if defined(CPPCOMMON_ASYNC_FILE_IO_URING)
+            case AsyncFileBackend::IO_URING:
+            {
+                for (auto index : _queued)
+                    PrepareRing(index);
+                _queued.clear();
+                EnterRing(0);
+                break;
+            }
+#endif
+#if defined(_WIN32) || defined(_WIN64)
+            case AsyncFileBackend::IOCP:
+            {
+                for (auto index : _queued)
+                    StartOverlapped(index);
+                _queued.clear();
+                StartFlushes();
+                break;
+            }
+#endif
+            default:
+            {
+                {
+                    std::scoped_lock locker(_lock);
+                    _submitted.insert(_submitted.end(), _queued.begin(), _queued.end());
+                }
+                _queued.clear();
+                _submit_cv.notify_one();
+                break;
+            }
+        }
+
+        return result;
+    }
+
+    size_t Poll()
+    {
+        return Reap(false);
+    }
+
+    size_t Wait(size_t count)
+    {
+        size_t result = 0;
+        for (;;)
+        {
+            result += Reap(false);
+            if ((result >= count) || (_pending == 0))
+                break;
+
+            Submit();
+
+            result += Reap(true);
+            if ((result >= count) || (_pending == 0))
+                break;
+        }
+        return result;
+    }
+
+private:
+    static const size_t NIL = (size_t)-1;
+
+    struct Operation
+    {
+#if defined(_WIN32) || defined(_WIN64)
+        OVERLAPPED overlapped;
+#endif
+        AsyncFileOperation type;
+        uint64_t offset;
+        char* buffer;
+        size_t size;
+        size_t done;
+        int error;
+        Callback callback;
+        size_t next;
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+        struct iovec iov;
+#endif
+
+        Operation() : type(AsyncFileOperation::READ), offset(0), buffer(nullptr), size(0), done(0), error(0), next(NIL) {}
+    };
+
+    Path _path;
+    AsyncFileBackend _backend;
+    std::vector<Operation> _operations;
+    size_t _free;
+    size_t _pending;
+    std::vector<size_t> _queued;
+
+    // Dedicated I/O thread backend
+    std::thread _thread;
+    std::mutex _lock;
+    std::condition_variable _submit_cv;
+    std::condition_variable _complete_cv;
+    std::deque<size_t> _submitted;
+    std::vector<size_t> _completed;
+    std::vector<size_t> _completions;
+    bool _stop;
+
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+    int _file;
+#if defined(CPPCOMMON_ASYNC_FILE_IO_URING)
+    int _ring;
+    void* _sq_ring;
+    size_t _sq_ring_size;
+    void* _cq_ring;
+    size_t _cq_ring_size;
+    struct io_uring_sqe* _sqes;
+    size_t _sqes_size;
+    unsigned* _sq_head;
+    unsigned* _sq_tail;
+    unsigned* _sq_mask;
+    unsigned* _sq_array;
+    unsigned* _cq_head;
+    unsigned* _cq_tail;
+    unsigned* _cq_mask;
+    struct io_uring_cqe* _cqes;
+    unsigned _unsubmitted;
+#endif
+#elif defined(_WIN32) || defined(_WIN64)
+    HANDLE _file;
+    HANDLE _port;
+    size_t _inflight;
+    std::vector<size_t> _flushes;
+    std::vector<size_t> _failed;
+#endif
+
+    //! Complete the given operation: release it and call its completion callback
+    void Complete(size_t index)
+    {
+        Operation& op = _operations[index];
+
+        AsyncFileResult result;
+        result.operation = op.type;
+        result.offset = op.offset;
+        result.size = op.done;
+        result.error = op.error;
+
+        // Release the operation before the callback, so it could queue new operations
+        Callback callback(std::move(op.callback));
+        op.callback = nullptr;
+        op.next = _free;
+        _free = index;
+        --_pending;
+
+        if (callback)
+            callback(result);
+    }
+
+    //! Update the given operation with the transferred bytes count
+    /*!
+        \return 'true' if the operation is completed, 'false' if the rest of the operation should be resubmitted
+    */
+    bool Transferred(Operation& op, size_t transferred) noexcept
+    {
+        if ((op.type == AsyncFileOperation::FLUSH) || (op.error != 0))
+            return true;
+        op.done += transferred;
+        return (transferred == 0) || (op.done >= op.size);
+    }
+
+    size_t Reap(bool wait)
+    {
+        switch (_backend)
+        {
+#if defined(CPPCOMMON_ASYNC_FILE_IO_URING)
+            case AsyncFileBackend::IO_URING:
+                return ReapRing(wait);
+#endif
+#if defined(_WIN32) || defined(_WIN64)
+            case AsyncFileBackend::IOCP:
+                return ReapOverlapped(wait);
+#endif
+            default:
+                return ReapThread(wait);
+        }
+    }
+
+    // Dedicated I/O thread backend
+
+    void Run()
+    {
+        for (;;)
+        {
+            size_t index;
+            {
+                std::unique_lock<std::mutex> locker(_lock);
+                _submit_cv.wait(locker, [this]() { return _stop || !_submitted.empty(); });
+                if (_submitted.empty())
+                    return;
+                index = _submitted.front();
+                _submitted.pop_front();
+            }
+
+            Execute(_operations[index]);
+
+            {
+                std::scoped_lock locker(_lock);
+                _completed.push_back(index);
+            }
+            _complete_cv.notify_one();
+        }
+    }
+
+    void Execute(Operation& op)
+    {
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+        if (op.type == AsyncFileOperation::FLUSH)
+        {
+            if (fsync(_file) != 0)
+                op.error = errno;
+            return;
+        }
+
+        while (op.done < op.size)
+        {
+            ssize_t result = (op.type == AsyncFileOperation::READ) ?
+                pread(_file, op.buffer + op.done, op.size - op.done, (off_t)(op.offset + op.done)) :
+                pwrite(_file, op.buffer + op.done, op.size - op.done, (off_t)(op.offset + op.done));
+            if (result < 0)
+            {
+                if (errno == EINTR)
+                    continue;
+                op.error = errno;
+                return;
+            }
+            if (Transferred(op, (size_t)result))
+                return;
+        }
+#elif defined(_WIN32) || defined(_WIN64)
+        if (op.type == AsyncFileOperation::FLUSH)
+        {
+            if (!FlushFileBuffers(_file))
+                op.error = (int)GetLastError();
+            return;
+        }
+
+        while (op.done < op.size)
+        {
+            OVERLAPPED overlapped = {};
+            uint64_t offset = op.offset + op.done;
+            overlapped.Offset = (DWORD)offset;
+            overlapped.OffsetHigh = (DWORD)(offset >> 32);
+            DWORD size = (DWORD)std::min(op.size - op.done, (size_t)0x40000000);
+            DWORD transferred = 0;
+            BOOL result = (op.type == AsyncFileOperation::READ) ?
+                ReadFile(_file, op.buffer + op.done, size, &transferred, &overlapped) :
+                WriteFile(_file, op.buffer + op.done, size, &transferred, &overlapped);
+            if (!result)
+            {
+                DWORD error = GetLastError();
+                if (error != ERROR_HANDLE_EOF)
+                    op.error = (int)error;
+                return;
+            }
+            if (Transferred(op, (size_t)transferred))
+                return;
+        }
+#endif
+    }
+
+    size_t ReapThread(bool wait)
+    {
+        // Completions are moved out, so callbacks could poll the file again
+        std::vector<size_t> completions(std::move(_completions));
+        {
+            std::unique_lock<std::mutex> locker(_lock);
+            if (wait)
+                _complete_cv.wait(locker, [this]() { return !_completed.empty(); });
+            std::swap(_completed, completions);
+        }
+
+        size_t result = completions.size();
+        for (auto index : completions)
+            Complete(index);
+
+        // Reuse the completions buffer
+        completions.clear();
+        if (completions.capacity() > _completions.capacity())
+            _completions = std::move(completions);
+        return result;
+    }
+
+#if defined(CPPCOMMON_ASYNC_FILE_IO_URING)
+    // Linux io_uring backend
+
+    bool SetupRing()
+    {
+        struct io_uring_params params;
+        std::memset(&params, 0, sizeof(params));
+
+        int ring = (int)syscall(__NR_io_uring_setup, (unsigned)_operations.size(), &params);
+        if (ring < 0)
+            return false;
+
+        _ring = ring;
+        _sq_ring_size = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+        _cq_ring_size = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+        _sqes_size = params.sq_entries * sizeof(struct io_uring_sqe);
+
+        // Submission and completion rings could share the same mapping
+        bool single = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+        if (single)
+            _sq_ring_size = _cq_ring_size = std::max(_sq_ring_size, _cq_ring_size);
+
+        _sq_ring = mmap(nullptr, _sq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, _ring, IORING_OFF_SQ_RING);
+        _cq_ring = single ? _sq_ring : mmap(nullptr, _cq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, _ring, IORING_OFF_CQ_RING);
+        void* sqes = mmap(nullptr, _sqes_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, _ring, IORING_OFF_SQES);
+        if ((_sq_ring == MAP_FAILED) || (_cq_ring == MAP_FAILED) || (sqes == MAP_FAILED))
+        {
+            if (sqes != MAP_FAILED)
+                munmap(sqes, _sqes_size);
+            if (!single && (_cq_ring != MAP_FAILED))
+                munmap(_cq_ring, _cq_ring_size);
+            if (_sq_ring != MAP_FAILED)
+                munmap(_sq_ring, _sq_ring_size);
+            close(_ring);
+            _ring = -1;
+            return false;
+        }
+
+        char* sq = (char*)_sq_ring;
+        char* cq = (char*)_cq_ring;
+        _sq_head = (unsigned*)(sq + params.sq_off.head);
+        _sq_tail = (unsigned*)(sq + params.sq_off.tail);
+        _sq_mask = (unsigned*)(sq + params.sq_off.ring_mask);
+        _sq_array = (unsigned*)(sq + params.sq_off.array);
+        _cq_head = (unsigned*)(cq + params.cq_off.head);
+        _cq_tail = (unsigned*)(cq + params.cq_off.tail);
+        _cq_mask = (unsigned*)(cq + params.cq_off.ring_mask);
+        _cqes = (struct io_uring_cqe*)(cq + params.cq_off.cqes);
+        _sqes = (struct io_uring_sqe*)sqes;
+        _unsubmitted = 0;
+        return true;
+    }
+
+    void CloseRing()
+    {
+        munmap(_sqes, _sqes_size);
+        if (_cq_ring != _sq_ring)
+            munmap(_cq_ring, _cq_ring_size);
+        munmap(_sq_ring, _sq_ring_size);
+        if (close(_ring) != 0)
+            fatality(FileSystemException("Cannot close the io_uring asynchronous file backend!").Attach(_path));
+        _ring = -1;
+    }
+
+    void PrepareRing(size_t index)
+    {
+        Operation& op = _operations[index];
+
+        // Submission queue is never full, because it has at least depth entries
+        unsigned tail = *_sq_tail;
+        unsigned slot = tail & *_sq_mask;
+
+        struct io_uring_sqe* sqe = &_sqes[slot];
+        std::memset(sqe, 0, sizeof(*sqe));
+        sqe->fd = _file;
+        sqe->user_data = (uint64_t)index;
+        if (op.type == AsyncFileOperation::FLUSH)
+        {
+            // Flush starts after all previously submitted operations are completed
+            sqe->opcode = IORING_OP_FSYNC;
+            sqe->flags = IOSQE_IO_DRAIN;
+        }
+        else
+        {
+            op.iov.iov_base = op.buffer + op.done;
+            op.iov.iov_len = op.size - op.done;
+            sqe->opcode = (op.type == AsyncFileOperation::READ) ? IORING_OP_READV : IORING_OP_WRITEV;
+            sqe->off = op.offset + op.done;
+            sqe->addr = (uint64_t)(uintptr_t)&op.iov;
+            sqe->len = 1;
+        }
+
+        _sq_array[slot] = slot;
+        __atomic_store_n(_sq_tail, tail + 1, __ATOMIC_RELEASE);
+        ++_unsubmitted;
+    }
+
+    void EnterRing(unsigned wait)
+    {
+        for (;;)
+        {
+            unsigned flags = (wait > 0) ? IORING_ENTER_GETEVENTS : 0;
+            int result = (int)syscall(__NR_io_uring_enter, _ring, _unsubmitted, wait, flags, nullptr, 0);
+            if (result < 0)
+            {
+                if (errno == EINTR)
+                    continue;
+                // Completion queue is busy, unsubmitted operations will be submitted later
+                if ((errno == EAGAIN) || (errno == EBUSY))
+                    return;
+                throwex FileSystemException("Cannot submit asynchronous file operations!").Attach(_path);
+            }
+            _unsubmitted -= std::min((unsigned)result, _unsubmitted);
+            return;
+        }
+    }
+
+    size_t ReapRing(bool wait)
+    {
+        unsigned head = *_cq_head;
+        if (wait && (head == __atomic_load_n(_cq_tail, __ATOMIC_ACQUIRE)))
+            EnterRing(1);
+
+        bool resubmit = false;
+        size_t result = 0;
+        for (;;)
+        {
+            unsigned tail = __atomic_load_n(_cq_tail, __ATOMIC_ACQUIRE);
+            if (head == tail)
+                break;
+
+            while (head != tail)
+            {
+                struct io_uring_cqe* cqe = &_cqes[head & *_cq_mask];
+                size_t index = (size_t)cqe->user_data;
+                int res = cqe->res;
+                ++head;
+                __atomic_store_n(_cq_head, head, __ATOMIC_RELEASE);
+
+                Operation& op = _operations[index];
+                if ((res == -EINTR) || (res == -EAGAIN))
+                {
+                    PrepareRing(index);
+                    resubmit = true;
+                    continue;
+                }
+                if (res < 0)
+                    op.error = -res;
+                if (!Transferred(op, (res > 0) ? (size_t)res : 0))
+                {
+                    PrepareRing(index);
+                    resubmit = true;
+                    continue;
+                }
+
+                Complete(index);
+                ++result;
+            }
+        }
+
+        if (resubmit)
+            EnterRing(0);
+
+        return result;
+    }
+#endif
+
+#if defined(_WIN32) || defined(_WIN64)
+    // Windows overlapped I/O backend
+
+    void StartOverlapped(size_t index)
+    {
+        Operation& op = _operations[index];
+
+        // Flush starts after all previously submitted operations are completed
+        if (op.type == AsyncFileOperation::FLUSH)
+        {
+            _flushes.push_back(index);
+            return;
+        }
+
+        uint64_t offset = op.offset + op.done;
+        std::memset(&op.overlapped, 0, sizeof(op.overlapped));
+        op.overlapped.Offset = (DWORD)offset;
+        op.overlapped.OffsetHigh = (DWORD)(offset >> 32);
+        DWORD size = (DWORD)std::min(op.size - op.done, (size_t)0x40000000);
+        BOOL result = (op.type == AsyncFileOperation::READ) ?
+            ReadFile(_file, op.buffer + op.done, size, nullptr, &op.overlapped) :
+            WriteFile(_file, op.buffer + op.done, size, nullptr, &op.overlapped);
+        if (!result)
+        {
+            DWORD error = GetLastError();
+            if (error != ERROR_IO_PENDING)
+            {
+                if (error != ERROR_HANDLE_EOF)
+                    op.error = (int)error;
+                _failed.push_back(index);
+                return;
+            }
+        }
+
+        // Both pending and synchronously completed operations are posted to the completion port
+        ++_inflight;
+    }
+
+    void StartFlushes()
+    {
+        if ((_inflight > 0) || _flushes.empty())
+            return;
+
+        for (auto index : _flushes)
+        {
+            Operation& op = _operations[index];
+            std::memset(&op.overlapped, 0, sizeof(op.overlapped));
+            if (!FlushFileBuffers(_file))
+                op.error = (int)GetLastError();
+            if (!PostQueuedCompletionStatus(_port, 0, 0, &op.overlapped))
+                _failed.push_back(index);
+        }
+        _flushes.clear();
+    }
+
+    size_t ReapOverlapped(bool wait)
+    {
+        size_t result = 0;
+
+        // Complete operations failed to start
+        std::vector<size_t> failed;
+        std::swap(failed, _failed);
+        for (auto index : failed)
+        {
+            Complete(index);
+            ++result;
+        }
+
+        if (wait && (result > 0))
+            wait = false;
+
+        const ULONG capacity = 64;
+        OVERLAPPED_ENTRY entries[capacity];
+        ULONG count = 0;
+        if (!GetQueuedCompletionStatusEx(_port, entries, capacity, &count, wait ? INFINITE : 0, FALSE))
+        {
+            if (GetLastError() != WAIT_TIMEOUT)
+                throwex FileSystemException("Cannot get completed asynchronous file operations!").Attach(_path);
+            count = 0;
+        }
+
+        for (ULONG i = 0; i < count; ++i)
+        {
+            Operation* op = (Operation*)entries[i].lpOverlapped;
+            size_t index = (size_t)(op - _operations.data());
+
+            if (op->type != AsyncFileOperation::FLUSH)
+            {
+                --_inflight;
+                DWORD transferred = 0;
+                if (!GetOverlappedResult(_file, &op->overlapped, &transferred, FALSE))
+                {
+                    DWORD error = GetLastError();
+                    if (error != ERROR_HANDLE_EOF)
+                        op->error = (int)error;
+                }
+                if (!Transferred(*op, (size_t)transferred))
+                {
+                    StartOverlapped(index);
+                    continue;
+                }
+            }
+
+            Complete(index);
+            ++result;
+        }
+
+        // Start deferred flushes if all previous operations are completed
+        StartFlushes();
+
+        return result;
+    }
+#endif
+};
+
+const size_t AsyncFile::DEFAULT_DEPTH = 256;
+
+AsyncFile::AsyncFile(const Path& path, size_t depth, AsyncFileBackend backend) : _pimpl(std::make_unique<Impl>(path, depth, backend))
+{
+}
+
+AsyncFile::AsyncFile(AsyncFile&& file) noexcept : _pimpl(std::move(file._pimpl))
+{
+}
+
+AsyncFile::~AsyncFile()
+{
+}
+
+AsyncFile& AsyncFile::operator=(AsyncFile&& file) noexcept
+{
+    _pimpl = std::move(file._pimpl);
+    return *this;
+}
+
+const Path& AsyncFile::path() const noexcept
+{
+    return _pimpl->path();
+}
+
+AsyncFileBackend AsyncFile::backend() const noexcept
+{
+    return _pimpl->backend();
+}
+
+size_t AsyncFile::depth() const noexcept
+{
+    return _pimpl->depth();
+}
+
+size_t AsyncFile::pending() const noexcept
+{
+    return _pimpl->pending();
+}
+
+size_t AsyncFile::queued() const noexcept
+{
+    return _pimpl->queued();
+}
+
+bool AsyncFile::IsFileOpened() const noexcept
+{
+    return _pimpl->IsFileOpened();
+}
+
+void AsyncFile::Open(bool read, bool write, bool truncate)
+{
+    _pimpl->Open(read, write, truncate, false, File::DEFAULT_PERMISSIONS);
+}
+
+void AsyncFile::OpenOrCreate(bool read, bool write, bool truncate, const Flags<FilePermissions>& permissions)
+{
+    _pimpl->Open(read, write, truncate, true, permissions);
+}
+
+bool AsyncFile::Enqueue(AsyncFileOperation operation, uint64_t offset, char* buffer, size_t size, Callback&& callback)
+{
+    return _pimpl->Enqueue(operation, offset, buffer, size, std::move(callback));
+}
+
+size_t AsyncFile::Submit()
+{
+    return _pimpl->Submit();
+}
+
+size_t AsyncFile::Poll()
+{
+    return _pimpl->Poll();
+}
+
+size_t AsyncFile::Wait(size_t count)
+{
+    return _pimpl->Wait(count);
+}
+
+void AsyncFile::Close()
+{
+    _pimpl->Close();
+}
+
+} // namespace CppCommon
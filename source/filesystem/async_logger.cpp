@@ -0,0 +1,367 @@
+/*!
+    \file async_logger.cpp
+    \brief Filesystem asynchronous logger implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "filesystem/async_logger.h"
+
+#include "errors/exceptions.h"
+#include "errors/fatal.h"
+#include "filesystem/exceptions.h"
+#include "threads/thread.h"
+#include "time/time.h"
+
+#include <cassert>
+#include <exception>
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+namespace Internals {
+
+// Unique logger Ids are never reused, so cached producers of destroyed loggers are never matched
+std::atomic<uint64_t> logger_id(0);
+
+// Log level names padded to the same width
+const char* const log_levels[] = { "DEBUG", "INFO ", "WARN ", "ERROR", "FATAL", "NONE " };
+
+// Written log messages are batched up to this size
+const size_t log_batch = 65536;
+
+// Maximal count of messages drained in one pass, so flush and stop requests are not delayed by busy producers
+const size_t log_drain = 65536;
+
+} // namespace Internals
+//! @endcond
+
+const size_t AsyncLogger::DEFAULT_CAPACITY = 1024 * 1024;
+
+AsyncLogger::Producer::Producer(size_t capacity)
+    : buffer(std::make_unique<SPSCRingBuffer>(capacity)),
+      limit(capacity / 2),
+      thread(Thread::CurrentThreadId()),
+      dropped(0),
+      closed(false),
+      detached(false),
+      reported(0)
+{
+}
+
+AsyncLogger::AsyncLogger(const Path& path, uint64_t rotation_size, size_t rotation_backups, size_t capacity)
+    : _id(++Internals::logger_id),
+      _path(path),
+      _rotation_size(rotation_size),
+      _rotation_backups(rotation_backups),
+      _capacity(capacity),
+      _level(LogLevel::DEBUG),
+      _logged(0),
+      _dropped(0),
+      _producers_version(0),
+      _stop(false),
+      _flush_request(0),
+      _flush_done(0),
+      _file(path),
+      _written(0),
+      _active_version(0),
+      _output_messages(0),
+      _second(0)
+{
+    assert(((capacity & (capacity - 1)) == 0) && (capacity >= 1024) && "Ring buffer capacity must be a power of two not less than 1024!");
+    if (((capacity & (capacity - 1)) != 0) || (capacity < 1024))
+        throwex ArgumentException("Ring buffer capacity must be a power of two not less than 1024!");
+
+    _prefix[0] = 0;
+
+    // Open the log file for appending
+    _file.OpenOrCreate(false, true, false, File::DEFAULT_ATTRIBUTES, File::DEFAULT_PERMISSIONS, 0);
+    _written = _file.size();
+    _file.Seek(_written);
+
+    // Start the background thread
+    _thread = Thread::Start([this]() { Run(); });
+}
+
+AsyncLogger::~AsyncLogger()
+{
+    {
+        Locker<CriticalSection> locker(_cs);
+        _stop = true;
+    }
+    _cv.NotifyAll();
+
+    if (_thread.joinable())
+        _thread.join();
+
+    // Release ring buffers, producers might still be referenced by their threads
+    {
+        Locker<CriticalSection> locker(_producers_cs);
+        for (auto& producer : _producers)
+        {
+            producer->detached.store(true, std::memory_order_release);
+            producer->buffer.reset();
+        }
+        _producers.clear();
+    }
+
+    try
+    {
+        if (_file.IsFileOpened())
+            _file.Close();
+    }
+    catch (const FileSystemException& ex)
+    {
+        fatality(FileSystemException(ex.string()).Attach(_path));
+    }
+}
+
+void AsyncLogger::Flush()
+{
+    Locker<CriticalSection> locker(_cs);
+    uint64_t request = ++_flush_request;
+    _cv.NotifyAll();
+    _cv.Wait(_cs, [this, request]() { return (_flush_done >= request); });
+}
+
+AsyncLogger::Producer* AsyncLogger::Register()
+{
+    // Producers of the current thread are closed when the thread exits
+    struct ThreadProducers
+    {
+        std::vector<std::pair<uint64_t, std::shared_ptr<Producer>>> producers;
+
+        ~ThreadProducers()
+        {
+            for (auto& entry : producers)
+                entry.second->closed.store(true, std::memory_order_release);
+        }
+    };
+
+    static thread_local ThreadProducers thread_producers;
+
+    auto& producers = thread_producers.producers;
+    for (auto it = producers.begin(); it != producers.end();)
+    {
+        if (it->first == _id)
+        {
+            _cache = { _id, it->second.get() };
+            return _cache.producer;
+        }
+
+        // Forget producers of destroyed loggers
+        if (it->second->detached.load(std::memory_order_acquire))
+            it = producers.erase(it);
+        else
+            ++it;
+    }
+
+    auto producer = std::make_shared<Producer>(_capacity);
+    {
+        Locker<CriticalSection> locker(_producers_cs);
+        _producers.push_back(producer);
+        _producers_version.fetch_add(1, std::memory_order_release);
+    }
+    producers.emplace_back(_id, producer);
+
+    _cache = { _id, producer.get() };
+    return _cache.producer;
+}
+
+void AsyncLogger::Run()
+{
+    uint64_t flushed = 0;
+
+    for (;;)
+    {
+        uint64_t flush;
+        bool stop;
+        {
+            Locker<CriticalSection> locker(_cs);
+            flush = _flush_request;
+            stop = _stop;
+        }
+
+        size_t count = Drain();
+        Write();
+
+        // Flush the log file when requested and all messages logged before the request are written
+        if ((flush != flushed) && (count < Internals::log_drain))
+        {
+            try
+            {
+                _file.Flush();
+            }
+            catch (const FileSystemException&)
+            {
+                // Flush failure is not fatal, written messages stay in the system cache
+            }
+            flushed = flush;
+
+            {
+                Locker<CriticalSection> locker(_cs);
+                _flush_done = flush;
+            }
+            _cv.NotifyAll();
+        }
+
+        if (count > 0)
+            continue;
+        if (stop)
+            break;
+
+        // Wait for new messages
+        Locker<CriticalSection> locker(_cs);
+        _cv.TryWaitFor(_cs, Timespan::milliseconds(1), [this, flush]() { return _stop || (_flush_request != flush); });
+    }
+}
+
+size_t AsyncLogger::Drain()
+{
+    // Update the snapshot of registered producers
+    uint64_t version = _producers_version.load(std::memory_order_acquire);
+    if (version != _active_version)
+    {
+        Locker<CriticalSection> locker(_producers_cs);
+        _active = _producers;
+        _active_version = _producers_version.load(std::memory_order_relaxed);
+    }
+
+    size_t count = 0;
+
+    // Merge messages of all producers by their timestamps
+    while (count < Internals::log_drain)
+    {
+        Producer* next = nullptr;
+        const Record* record = nullptr;
+        for (auto& producer : _active)
+        {
+            auto peeked = producer->buffer->Peek();
+            const Record* current = (const Record*)peeked.data();
+            if (!peeked.empty() && ((record == nullptr) || (current->timestamp < record->timestamp)))
+            {
+                next = producer.get();
+                record = current;
+            }
+        }
+
+        if (next == nullptr)
+            break;
+
+        Format(*record, next->thread);
+        next->buffer->Release(record->size);
+        ++count;
+
+        if (_output.size() >= Internals::log_batch)
+            Write();
+    }
+
+    // Report dropped messages and forget producers of finished threads
+    bool finished = false;
+    for (auto& producer : _active)
+    {
+        uint64_t dropped = producer->dropped.load(std::memory_order_relaxed);
+        if (dropped != producer->reported)
+        {
+            Record record = { 0, LogLevel::WARN, TscClock::utc(), nullptr, 0, nullptr };
+            Format(record, producer->thread);
+            fmt::format_to(fmt::appender(_output), "{} messages were dropped\n", dropped - producer->reported);
+            _dropped.fetch_add(dropped - producer->reported, std::memory_order_relaxed);
+            producer->reported = dropped;
+        }
+
+        if (producer->closed.load(std::memory_order_acquire) && producer->buffer->Peek().empty())
+            finished = true;
+    }
+
+    if (finished)
+    {
+        Locker<CriticalSection> locker(_producers_cs);
+        std::erase_if(_producers, [](const std::shared_ptr<Producer>& producer)
+        {
+            return producer->closed.load(std::memory_order_acquire) && producer->buffer->Peek().empty();
+        });
+        _active = _producers;
+    }
+
+    return count;
+}
+
+void AsyncLogger::Format(const Record& record, uint64_t thread)
+{
+    // Date and time prefix is formatted once per second
+    uint64_t second = record.timestamp / 1000000000;
+    if (second != _second)
+    {
+        UtcTime time(Timestamp(second * 1000000000));
+        fmt::format_to_n(_prefix, sizeof(_prefix) - 1, "{:04}-{:02}-{:02} {:02}:{:02}:{:02}", time.year(), time.month(), time.day(), time.hour(), time.minute(), time.second()).out[0] = 0;
+        _second = second;
+    }
+
+    fmt::format_to(fmt::appender(_output), "{}.{:09} [{}] {} ", _prefix, record.timestamp % 1000000000, thread, Internals::log_levels[(size_t)record.level]);
+
+    // Dropped messages report has no message
+    if (record.formatter == nullptr)
+        return;
+
+    try
+    {
+        record.formatter(_output, fmt::string_view(record.pattern, record.pattern_size), (const uint8_t*)(&record + 1));
+    }
+    catch (const std::exception& ex)
+    {
+        fmt::format_to(fmt::appender(_output), "Log message format error: {}", ex.what());
+    }
+    _output.push_back('\n');
+    ++_output_messages;
+}
+
+void AsyncLogger::Write()
+{
+    if (_output.size() == 0)
+        return;
+
+    try
+    {
+        if ((_rotation_size > 0) && (_written > 0) && ((_written + _output.size()) > _rotation_size))
+            Rotate();
+
+        _file.Write(_output.data(), _output.size());
+        _written += _output.size();
+        _logged.fetch_add(_output_messages, std::memory_order_relaxed);
+    }
+    catch (const FileSystemException&)
+    {
+        // Messages of the failed batch are lost
+        _dropped.fetch_add(_output_messages, std::memory_order_relaxed);
+    }
+
+    _output.clear();
+    _output_messages = 0;
+}
+
+void AsyncLogger::Rotate()
+{
+    _file.Close();
+
+    if (_rotation_backups > 0)
+    {
+        // Shift backups and remove the oldest one
+        Path oldest(_path.string() + "." + std::to_string(_rotation_backups));
+        if (oldest.IsExists())
+            Path::Remove(oldest);
+        for (size_t i = _rotation_backups - 1; i > 0; --i)
+        {
+            Path backup(_path.string() + "." + std::to_string(i));
+            if (backup.IsExists())
+                Path::Rename(backup, Path(_path.string() + "." + std::to_string(i + 1)));
+        }
+        Path::Rename(_path, Path(_path.string() + ".1"));
+    }
+
+    _file.OpenOrCreate(false, true, true, File::DEFAULT_ATTRIBUTES, File::DEFAULT_PERMISSIONS, 0);
+    _written = 0;
+}
+
+} // namespace CppCommon
@@ -30,15 +30,24 @@ const Flags<FilePermissions> Directory::DEFAULT_PERMISSIONS = FilePermissions::I
 
 bool Directory::IsDirectoryExists() const
 {
+    std::error_code ec;
+    bool result = IsDirectoryExists(ec);
+    if (ec)
+        throwex FileSystemException("Cannot get the status of the directory!", ec.value()).Attach(*this);
+    return result;
+}
+
+bool Directory::IsDirectoryExists(std::error_code& ec) const noexcept
+{
+    ec.clear();
 #if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
     struct stat status;
     int result = stat(string().c_str(), &status);
     if (result != 0)
     {
-        if ((errno == ENOENT) || (errno == ENOTDIR))
-            return false;
-        else
-            throwex FileSystemException("Cannot get the status of the directory!").Attach(*this);
+        if ((errno != ENOENT) && (errno != ENOTDIR))
+            ec.assign(errno, std::system_category());
+        return false;
     }
 
     if (S_ISDIR(status.st_mode))
@@ -160,13 +169,14 @@ std::vector<Directory> Directory::GetDirectories(const std::string& pattern)
     std::regex matcher(pattern);
     for (auto it = begin(); it != end(); ++it)
     {
+        // Special check for directory using the cached entry type
+        bool directory = it->IsDirectory();
+
         // Special check for symbolic link
-        Directory target(*it);
         if (it->IsSymlink())
-            target = Symlink(target).target();
+            directory = Symlink(*it).target().IsDirectory();
 
-        // Special check for directory
-        if (target.IsDirectory())
+        if (directory)
             if (pattern.empty() || std::regex_match(it->filename().string(), matcher))
                 result.emplace_back(*it);
     }
@@ -179,13 +189,14 @@ std::vector<Directory> Directory::GetDirectoriesRecursive(const std::string& pat
     std::regex matcher(pattern);
     for (auto it = rbegin(); it != rend(); ++it)
     {
+        // Special check for directory using the cached entry type
+        bool directory = it->IsDirectory();
+
         // Special check for symbolic link
-        Directory target(*it);
         if (it->IsSymlink())
-            target = Symlink(target).target();
+            directory = Symlink(*it).target().IsDirectory();
 
-        // Special check for directory
-        if (target.IsDirectory())
+        if (directory)
             if (pattern.empty() || std::regex_match(it->filename().string(), matcher))
                 result.emplace_back(*it);
     }
@@ -198,13 +209,14 @@ std::vector<File> Directory::GetFiles(const std::string& pattern)
     std::regex matcher(pattern);
     for (auto it = begin(); it != end(); ++it)
     {
+        // Special check for directory using the cached entry type
+        bool directory = it->IsDirectory();
+
         // Special check for symbolic link
-        File target(*it);
         if (it->IsSymlink())
-            target = Symlink(target).target();
+            directory = Symlink(*it).target().IsDirectory();
 
-        // Special check for directory
-        if (!target.IsDirectory())
+        if (!directory)
             if (pattern.empty() || std::regex_match(it->filename().string(), matcher))
                 result.emplace_back(*it);
     }
@@ -217,13 +229,14 @@ std::vector<File> Directory::GetFilesRecursive(const std::string& pattern)
     std::regex matcher(pattern);
     for (auto it = rbegin(); it != rend(); ++it)
     {
+        // Special check for directory using the cached entry type
+        bool directory = it->IsDirectory();
+
         // Special check for symbolic link
-        File target(*it);
         if (it->IsSymlink())
-            target = Symlink(target).target();
+            directory = Symlink(*it).target().IsDirectory();
 
-        // Special check for directory
-        if (!target.IsDirectory())
+        if (!directory)
             if (pattern.empty() || std::regex_match(it->filename().string(), matcher))
                 result.emplace_back(*it);
     }
@@ -260,9 +273,18 @@ std::vector<Symlink> Directory::GetSymlinksRecursive(const std::string& pattern)
 
 Directory Directory::Create(const Path& path, const Flags<FileAttributes>& attributes, const Flags<FilePermissions>& permissions)
 {
-    Directory directory(path);
-    if (directory.IsDirectoryExists())
-        return directory;
+    std::error_code ec;
+    if (!TryCreate(path, ec, attributes, permissions))
+        throwex FileSystemException("Cannot create directory!", ec.value()).Attach(path);
+    return Directory(path);
+}
+
+bool Directory::TryCreate(const Path& path, std::error_code& ec, const Flags<FileAttributes>& attributes, const Flags<FilePermissions>& permissions) noexcept
+{
+    if (Directory(path).IsDirectoryExists(ec))
+        return true;
+    if (ec)
+        return false;
 #if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
     mode_t mode = 0;
     if (permissions & FilePermissions::IRUSR)
@@ -292,12 +314,18 @@ Directory Directory::Create(const Path& path, const Flags<FileAttributes>& attri
 
     int result = mkdir(path.string().c_str(), mode);
     if (result != 0)
-        throwex FileSystemException("Cannot create directory!").Attach(path);
+    {
+        ec.assign(errno, std::system_category());
+        return false;
+    }
 #elif defined(_WIN32) || defined(_WIN64)
     if (!CreateDirectoryW(path.wstring().c_str(), nullptr))
-        throwex FileSystemException("Cannot create directory!").Attach(path);
+    {
+        ec.assign(GetLastError(), std::system_category());
+        return false;
+    }
 #endif
-    return directory;
+    return true;
 }
 
 Directory Directory::CreateTree(const Path& path, const Flags<FileAttributes>& attributes, const Flags<FilePermissions>& permissions)
@@ -307,17 +335,14 @@ Directory Directory::CreateTree(const Path& path, const Flags<FileAttributes>& a
         return tree;
 
     // Try to create the last directory
-    try
-    {
-        Create(tree);
+    std::error_code ec;
+    if (TryCreate(tree, ec, attributes, permissions))
         return tree;
-    }
-    catch (const FileSystemException&) {}
 
     // Failed, try to get the parent path and retry
     Directory parent = tree.parent();
     if (parent.empty())
-        throwex FileSystemException("Cannot create directory tree!").Attach(path);
+        throwex FileSystemException("Cannot create directory tree!", ec.value()).Attach(path);
     else
         CreateTree(parent);
 
@@ -16,6 +16,7 @@
 #include <stack>
 
 #if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+#include <sys/stat.h>
 #include <dirent.h>
 #elif defined(_WIN32) || defined(_WIN64)
 #include <windows.h>
@@ -23,6 +24,68 @@
 
 namespace CppCommon {
 
+FileType DirectoryEntry::type() const
+{
+    // Request the entry type which was not provided by the directory listing
+    if (_type == FileType::UNKNOWN)
+        _type = Path::type();
+    return _type;
+}
+
+uint64_t DirectoryEntry::size() const
+{
+    if (!_status)
+        Status();
+    return _size;
+}
+
+UtcTimestamp DirectoryEntry::modified() const
+{
+    if (!_status)
+        Status();
+    return _modified;
+}
+
+void DirectoryEntry::Status() const
+{
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+    struct stat status;
+    int result = stat(string().c_str(), &status);
+    if (result != 0)
+        throwex FileSystemException("Cannot get the status of the directory entry!").Attach(*this);
+
+    _size = (uint64_t)status.st_size;
+#if defined(__APPLE__)
+    _modified = UtcTimestamp(Timestamp((status.st_mtimespec.tv_sec * 1000000000) + status.st_mtimespec.tv_nsec));
+#else
+    _modified = UtcTimestamp(Timestamp((status.st_mtim.tv_sec * 1000000000) + status.st_mtim.tv_nsec));
+#endif
+#elif defined(_WIN32) || defined(_WIN64)
+    // Open the entry to follow symbolic links
+    HANDLE hFile = CreateFileW(wstring().c_str(), 0, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING, FILE_FLAG_BACKUP_SEMANTICS, nullptr);
+    if (hFile == INVALID_HANDLE_VALUE)
+        throwex FileSystemException("Cannot open the directory entry for getting its status!").Attach(*this);
+
+    BY_HANDLE_FILE_INFORMATION info;
+    BOOL result = GetFileInformationByHandle(hFile, &info);
+    if (!CloseHandle(hFile))
+        throwex FileSystemException("Cannot close the directory entry!").Attach(*this);
+    if (!result)
+        throwex FileSystemException("Cannot get the status of the directory entry!").Attach(*this);
+
+    ULARGE_INTEGER size;
+    size.LowPart = info.nFileSizeLow;
+    size.HighPart = info.nFileSizeHigh;
+    _size = size.QuadPart;
+
+    ULARGE_INTEGER write;
+    write.LowPart = info.ftLastWriteTime.dwLowDateTime;
+    write.HighPart = info.ftLastWriteTime.dwHighDateTime;
+    _modified = UtcTimestamp(Timestamp((write.QuadPart - 116444736000000000ull) * 100));
+#endif
+    _status = true;
+}
+
 //! @cond INTERNALS
 
 class DirectoryIterator::Impl
@@ -35,13 +98,13 @@ public:
     virtual ~Impl() = default;
 
     const Path& parent() const noexcept { return _parent; }
-    const Path& current() const noexcept { return _current; }
+    const DirectoryEntry& current() const noexcept { return _current; }
 
-    virtual Path Next() = 0;
+    virtual DirectoryEntry Next() = 0;
 
 protected:
     Path _parent;
-    Path _current;
+    DirectoryEntry _current;
 };
 
 class DirectoryIterator::SimpleImpl : public DirectoryIterator::Impl
@@ -78,7 +141,7 @@ public:
 #endif
     }
 
-    Path Next() override
+    DirectoryEntry Next() override
     {
         if (_end)
             return _current;
@@ -90,7 +153,10 @@ public:
                 continue;
             if (std::strncmp(pentry->d_name, "..", sizeof(pentry->d_name)) == 0)
                 continue;
-            _current = _parent / pentry->d_name;
+            // Reuse the current path storage for the next entry
+            _current.Assign(_parent).Append(pentry->d_name);
+            _current._type = EntryType(pentry);
+            _current._status = false;
             return _current;
         }
 #elif defined(_WIN32) || defined(_WIN64)
@@ -106,7 +172,21 @@ public:
             if (std::wcsncmp(_entry.cFileName, L"..", countof(_entry.cFileName)) == 0)
                 continue;
             _next = true;
-            _current = _parent / _entry.cFileName;
+            _current = DirectoryEntry(_parent / _entry.cFileName, EntryType(_entry));
+            // Take the size and modified timestamp from the directory listing except of symbolic links
+            if (_current._type != FileType::SYMLINK)
+            {
+                ULARGE_INTEGER size;
+                size.LowPart = _entry.nFileSizeLow;
+                size.HighPart = _entry.nFileSizeHigh;
+                _current._size = size.QuadPart;
+
+                ULARGE_INTEGER write;
+                write.LowPart = _entry.ftLastWriteTime.dwLowDateTime;
+                write.HighPart = _entry.ftLastWriteTime.dwHighDateTime;
+                _current._modified = UtcTimestamp(Timestamp((write.QuadPart - 116444736000000000ull) * 100));
+                _current._status = true;
+            }
             return _current;
         } while (FindNextFileW(_directory, &_entry) != 0);
 
@@ -114,7 +194,7 @@ public:
             throwex FileSystemException("Cannot read directory entries!").Attach(_parent);
 #endif
         _end = true;
-        _current = Path();
+        _current = DirectoryEntry();
         return _current;
     }
 
@@ -155,6 +235,47 @@ private:
 #endif
     bool _next;
     bool _end;
+
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+    // Take the entry type from the directory listing without stat() call
+    static FileType EntryType(const struct dirent* pentry) noexcept
+    {
+#if defined(DT_UNKNOWN)
+        switch (pentry->d_type)
+        {
+            case DT_REG:
+                return FileType::REGULAR;
+            case DT_DIR:
+                return FileType::DIRECTORY;
+            case DT_LNK:
+                return FileType::SYMLINK;
+            case DT_BLK:
+                return FileType::BLOCK;
+            case DT_CHR:
+                return FileType::CHARACTER;
+            case DT_FIFO:
+                return FileType::FIFO;
+            case DT_SOCK:
+                return FileType::SOCKET;
+            default:
+                return FileType::UNKNOWN;
+        }
+#else
+        return FileType::UNKNOWN;
+#endif
+    }
+#elif defined(_WIN32) || defined(_WIN64)
+    // Take the entry type from the directory listing attributes
+    static FileType EntryType(const WIN32_FIND_DATAW& entry) noexcept
+    {
+        if (entry.dwFileAttributes & FILE_ATTRIBUTE_REPARSE_POINT)
+            return FileType::SYMLINK;
+        else if (entry.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY)
+            return FileType::DIRECTORY;
+        else
+            return FileType::REGULAR;
+    }
+#endif
 };
 
 class DirectoryIterator::RecursiveImpl : public DirectoryIterator::Impl
@@ -163,10 +284,10 @@ public:
     explicit RecursiveImpl(const Path& parent) : DirectoryIterator::Impl(parent), _current(parent) {}
     ~RecursiveImpl() = default;
 
-    Path Next() override
+    DirectoryEntry Next() override
     {
-        // Get the next path value
-        Path result = _current.Next();
+        // Get the next entry value
+        DirectoryEntry result = _current.Next();
         if (result.empty())
         {
             // Immediately return in case of empty stack
@@ -179,13 +300,14 @@ public:
             return _current.current();
         }
 
+        // Special check for directory using the cached entry type
+        bool directory = result.IsDirectory();
+
         // Special check for symbolic link
-        Path target(result);
         if (result.IsSymlink())
-            target = Symlink(target).target();
+            directory = Symlink(result).target().IsDirectory();
 
-        // Special check for directory
-        if (target.IsDirectory())
+        if (directory)
         {
             // Put the current iterator to stack
             _stack.push(_current);
@@ -212,7 +334,7 @@ DirectoryIterator::DirectoryIterator() : _pimpl(nullptr), _current()
 {
 }
 
-DirectoryIterator::DirectoryIterator(const Path& current) : _pimpl(nullptr), _current(current)
+DirectoryIterator::DirectoryIterator(const DirectoryEntry& current) : _pimpl(nullptr), _current(current)
 {
 }
 
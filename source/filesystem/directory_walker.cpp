@@ -0,0 +1,292 @@
+/*!
+    \file directory_walker.cpp
+    \brief Filesystem parallel directory walker implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "filesystem/directory_walker.h"
+
+#include "errors/fatal.h"
+#include "filesystem/exceptions.h"
+#include "system/cpu.h"
+#include "threads/condition_variable.h"
+#include "threads/thread_pool.h"
+
+#include <atomic>
+#include <cassert>
+#include <cstring>
+#include <exception>
+#include <utility>
+#include <vector>
+
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+#include <dirent.h>
+#elif defined(_WIN32) || defined(_WIN64)
+#include <windows.h>
+#endif
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+namespace Internals {
+
+// Directory of the walked tree
+struct WalkNode
+{
+    Path path;
+    WalkNode* parent;
+    // Own listing task and not completed sub-directories
+    std::atomic<size_t> pending;
+
+    WalkNode(const Path& p, WalkNode* pp) : path(p), parent(pp), pending(1) {}
+};
+
+class WalkState
+{
+public:
+    WalkState(ThreadPool* pool, const DirectoryWalker::EnterHandler& enter, const DirectoryWalker::LeaveHandler& leave)
+        : _pool(pool), _enter(enter), _leave(leave), _entries(0), _stop(false), _done(false)
+    {
+    }
+
+    uint64_t entries() const noexcept { return _entries.load(std::memory_order_relaxed); }
+
+    void Run(const Path& root)
+    {
+        WalkNode* node = new WalkNode(root, nullptr);
+
+        if (_pool == nullptr)
+        {
+            // Walk the tree depth-first in the calling thread
+            _stack.push_back(node);
+            while (!_stack.empty())
+            {
+                node = _stack.back();
+                _stack.pop_back();
+                Process(node);
+            }
+        }
+        else
+        {
+            Schedule(node);
+
+            // Wait for all directories of the tree
+            Locker<CriticalSection> locker(_cs);
+            _cv.Wait(_cs, [this]() { return _done; });
+        }
+
+        if (_error)
+            std::rethrow_exception(_error);
+    }
+
+private:
+    ThreadPool* _pool;
+    const DirectoryWalker::EnterHandler& _enter;
+    const DirectoryWalker::LeaveHandler& _leave;
+    std::atomic<uint64_t> _entries;
+    std::atomic<bool> _stop;
+    std::exception_ptr _error;
+    std::vector<WalkNode*> _stack;
+    CriticalSection _cs;
+    ConditionVariable _cv;
+    bool _done;
+
+    void Schedule(WalkNode* node)
+    {
+        if (_pool == nullptr)
+            _stack.push_back(node);
+        else
+            _pool->Submit([this, node]() { Process(node); });
+    }
+
+    void Process(WalkNode* node)
+    {
+        try
+        {
+            if (!_stop.load(std::memory_order_relaxed))
+            {
+                // List the whole directory before handling entries, so handlers may modify it
+                std::vector<std::pair<Path, FileType>> entries;
+                List(node->path, entries);
+
+                for (auto& entry : entries)
+                {
+                    if (_stop.load(std::memory_order_relaxed))
+                        break;
+
+                    _entries.fetch_add(1, std::memory_order_relaxed);
+                    bool descend = _enter(entry.first, entry.second);
+                    if (descend && (entry.second == FileType::DIRECTORY))
+                    {
+                        node->pending.fetch_add(1, std::memory_order_relaxed);
+                        Schedule(new WalkNode(entry.first, node));
+                    }
+                }
+            }
+        }
+        catch (...)
+        {
+            Fail(std::current_exception());
+        }
+
+        Complete(node);
+    }
+
+    void Complete(WalkNode* node)
+    {
+        // Leave all directories which content is completely handled
+        while (node != nullptr)
+        {
+            if (node->pending.fetch_sub(1, std::memory_order_acq_rel) != 1)
+                return;
+
+            WalkNode* parent = node->parent;
+            if ((parent != nullptr) && _leave && !_stop.load(std::memory_order_relaxed))
+            {
+                try
+                {
+                    _leave(node->path);
+                }
+                catch (...)
+                {
+                    Fail(std::current_exception());
+                }
+            }
+            delete node;
+            node = parent;
+        }
+
+        // The whole tree is completed
+        if (_pool != nullptr)
+        {
+            Locker<CriticalSection> locker(_cs);
+            _done = true;
+            _cv.NotifyAll();
+        }
+    }
+
+    void Fail(std::exception_ptr error)
+    {
+        Locker<CriticalSection> locker(_cs);
+        if (!_error)
+            _error = error;
+        _stop.store(true, std::memory_order_relaxed);
+    }
+
+    static void List(const Path& parent, std::vector<std::pair<Path, FileType>>& entries)
+    {
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+        DIR* directory = opendir(parent.string().c_str());
+        if (directory == nullptr)
+            throwex FileSystemException("Cannot open a directory!").Attach(parent);
+
+        struct dirent* pentry;
+        while ((pentry = readdir(directory)) != nullptr)
+        {
+            if ((std::strcmp(pentry->d_name, ".") == 0) || (std::strcmp(pentry->d_name, "..") == 0))
+                continue;
+
+            Path path = parent / pentry->d_name;
+            FileType type = FileType::UNKNOWN;
+#if defined(DT_UNKNOWN)
+            // Take the entry type from the directory listing without stat() call
+            switch (pentry->d_type)
+            {
+                case DT_REG:
+                    type = FileType::REGULAR;
+                    break;
+                case DT_DIR:
+                    type = FileType::DIRECTORY;
+                    break;
+                case DT_LNK:
+                    type = FileType::SYMLINK;
+                    break;
+                case DT_BLK:
+                    type = FileType::BLOCK;
+                    break;
+                case DT_CHR:
+                    type = FileType::CHARACTER;
+                    break;
+                case DT_FIFO:
+                    type = FileType::FIFO;
+                    break;
+                case DT_SOCK:
+                    type = FileType::SOCKET;
+                    break;
+                default:
+                    type = path.type();
+                    break;
+            }
+#else
+            type = path.type();
+#endif
+            entries.emplace_back(std::move(path), type);
+        }
+
+        if (closedir(directory) != 0)
+            throwex FileSystemException("Cannot close the directory descriptor!").Attach(parent);
+#elif defined(_WIN32) || defined(_WIN64)
+        WIN32_FIND_DATAW entry;
+        HANDLE directory = FindFirstFileExW((parent / "*").wstring().c_str(), FindExInfoBasic, &entry, FindExSearchNameMatch, nullptr, FIND_FIRST_EX_LARGE_FETCH);
+        if (directory == INVALID_HANDLE_VALUE)
+            throwex FileSystemException("Cannot open a directory!").Attach(parent);
+
+        do
+        {
+            if ((std::wcscmp(entry.cFileName, L".") == 0) || (std::wcscmp(entry.cFileName, L"..") == 0))
+                continue;
+
+            FileType type = FileType::REGULAR;
+            if (entry.dwFileAttributes & FILE_ATTRIBUTE_REPARSE_POINT)
+                type = FileType::SYMLINK;
+            else if (entry.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY)
+                type = FileType::DIRECTORY;
+            entries.emplace_back(parent / entry.cFileName, type);
+        } while (FindNextFileW(directory, &entry) != 0);
+
+        DWORD error = GetLastError();
+        if (!FindClose(directory))
+            throwex FileSystemException("Cannot close the directory handle!").Attach(parent);
+        if (error != ERROR_NO_MORE_FILES)
+            throwex FileSystemException("Cannot read directory entries!").Attach(parent);
+#endif
+    }
+};
+
+} // namespace Internals
+//! @endcond
+
+DirectoryWalker::DirectoryWalker(size_t threads) : _pool(nullptr), _threads((threads > 0) ? threads : (size_t)CPU::LogicalCores())
+{
+    if (_threads > 1)
+    {
+        _owned = std::make_unique<ThreadPool>(_threads);
+        _pool = _owned.get();
+    }
+}
+
+DirectoryWalker::DirectoryWalker(ThreadPool& pool) : _pool(&pool), _threads(pool.threads())
+{
+}
+
+DirectoryWalker::~DirectoryWalker()
+{
+}
+
+size_t DirectoryWalker::threads() const noexcept
+{
+    return _threads;
+}
+
+uint64_t DirectoryWalker::Walk(const Path& root, const EnterHandler& enter, const LeaveHandler& leave)
+{
+    assert(enter && "Directory walker enter handler must be valid!");
+
+    Internals::WalkState state(_pool, enter, leave);
+    state.Run(root);
+    return state.entries();
+}
+
+} // namespace CppCommon
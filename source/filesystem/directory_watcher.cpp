@@ -0,0 +1,420 @@
+/*!
+    \file directory_watcher.cpp
+    \brief Filesystem directory watcher implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "filesystem/directory_watcher.h"
+
+#include "errors/fatal.h"
+#include "filesystem/directory.h"
+#include "filesystem/exceptions.h"
+
+#include <algorithm>
+#include <map>
+
+#if defined(__linux__)
+#include <sys/inotify.h>
+#include <errno.h>
+#include <unistd.h>
+#elif defined(_WIN32) || defined(_WIN64)
+#include <windows.h>
+#endif
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+namespace Internals {
+
+bool is_subpath(const Path& parent, const Path& path)
+{
+    const std::string& p = parent.string();
+    const std::string& s = path.string();
+    if (s.size() < p.size())
+        return false;
+    if (s.compare(0, p.size(), p) != 0)
+        return false;
+    return (s.size() == p.size()) || (s[p.size()] == '/') || (s[p.size()] == '\\');
+}
+
+void modified_files(const Path& root, const Path& directory, std::vector<DirectoryEvent>& events)
+{
+    try
+    {
+        for (const auto& file : Directory(directory).GetFilesRecursive())
+            events.emplace_back(DirectoryChange::MODIFIED, root, file);
+    }
+    catch (const FileSystemException&) {}
+}
+
+} // namespace Internals
+//! @endcond
+
+#if defined(__linux__)
+
+class DirectoryWatcher::Impl
+{
+public:
+    Impl()
+    {
+        _inotify = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+        if (_inotify < 0)
+            throwex FileSystemException("Cannot initialize the directory watcher!");
+    }
+
+    ~Impl()
+    {
+        int result = close(_inotify);
+        if (result != 0)
+            fatality(FileSystemException("Cannot close the directory watcher!"));
+    }
+
+    void Watch(const Path& path)
+    {
+        if (std::find(_roots.begin(), _roots.end(), path) != _roots.end())
+            return;
+
+        _roots.push_back(path);
+        try
+        {
+            AddWatch(path, path);
+        }
+        catch (...)
+        {
+            Unwatch(path);
+            throw;
+        }
+    }
+
+    bool Unwatch(const Path& path)
+    {
+        auto root = std::find(_roots.begin(), _roots.end(), path);
+        if (root == _roots.end())
+            return false;
+
+        _roots.erase(root);
+        RemoveWatches([&path](const WatchEntry& watch) { return watch.root == path; });
+        return true;
+    }
+
+    std::vector<DirectoryEvent> Poll()
+    {
+        std::vector<DirectoryEvent> events;
+
+        alignas(struct inotify_event) char buffer[65536];
+        for (;;)
+        {
+            ssize_t size = read(_inotify, buffer, sizeof(buffer));
+            if (size < 0)
+            {
+                if ((errno == EAGAIN) || (errno == EWOULDBLOCK))
+                    break;
+                if (errno == EINTR)
+                    continue;
+                throwex FileSystemException("Cannot read directory change notifications!");
+            }
+
+            for (char* ptr = buffer; ptr < (buffer + size);)
+            {
+                const struct inotify_event* event = (const struct inotify_event*)ptr;
+                ptr += sizeof(struct inotify_event) + event->len;
+                Process(*event, events);
+            }
+        }
+
+        return events;
+    }
+
+private:
+    struct WatchEntry
+    {
+        Path root;
+        Path directory;
+    };
+
+    int _inotify;
+    std::vector<Path> _roots;
+    std::map<int, WatchEntry> _watches;
+
+    void AddWatch(const Path& root, const Path& directory)
+    {
+        const uint32_t mask = IN_CLOSE_WRITE | IN_CREATE | IN_DELETE | IN_MOVED_FROM | IN_MOVED_TO | IN_ONLYDIR;
+        int wd = inotify_add_watch(_inotify, directory.string().c_str(), mask);
+        if (wd < 0)
+            throwex FileSystemException("Cannot watch the directory!").Attach(directory);
+        _watches[wd] = WatchEntry{ root, directory };
+
+        // Watch all sub-directories (symlinks are not followed, entry types are cached by the directory iterator)
+        for (const auto& entry : Directory(directory))
+            if (entry.IsDirectory())
+                AddWatch(root, entry);
+    }
+
+    template <class TPredicate>
+    void RemoveWatches(TPredicate&& predicate)
+    {
+        for (auto it = _watches.begin(); it != _watches.end();)
+        {
+            if (predicate(it->second))
+            {
+                inotify_rm_watch(_inotify, it->first);
+                it = _watches.erase(it);
+            }
+            else
+                ++it;
+        }
+    }
+
+    void Process(const struct inotify_event& event, std::vector<DirectoryEvent>& events)
+    {
+        // Lost notifications require to rescan all watched directories
+        if (event.mask & IN_Q_OVERFLOW)
+        {
+            for (const auto& root : _roots)
+                events.emplace_back(DirectoryChange::RESCAN, root, root);
+            return;
+        }
+
+        auto it = _watches.find(event.wd);
+        if (it == _watches.end())
+            return;
+
+        // Watch was removed by the system (e.g. the directory was deleted)
+        if (event.mask & IN_IGNORED)
+        {
+            _watches.erase(it);
+            return;
+        }
+
+        if (event.len == 0)
+            return;
+
+        const Path root = it->second.root;
+        const Path path = it->second.directory / event.name;
+
+        if (event.mask & IN_ISDIR)
+        {
+            if (event.mask & (IN_CREATE | IN_MOVED_TO))
+            {
+                // Watch the new directory and report files created before the watch
+                try
+                {
+                    AddWatch(root, path);
+                }
+                catch (const FileSystemException&) { return; }
+                Internals::modified_files(root, path, events);
+            }
+            else if (event.mask & (IN_DELETE | IN_MOVED_FROM))
+            {
+                // Moved directories keep their watches, so remove them explicitly
+                RemoveWatches([&path](const WatchEntry& watch) { return Internals::is_subpath(path, watch.directory); });
+                events.emplace_back(DirectoryChange::REMOVED, root, path);
+            }
+        }
+        else
+        {
+            if (event.mask & (IN_CLOSE_WRITE | IN_MOVED_TO))
+                events.emplace_back(DirectoryChange::MODIFIED, root, path);
+            else if (event.mask & (IN_DELETE | IN_MOVED_FROM))
+                events.emplace_back(DirectoryChange::REMOVED, root, path);
+        }
+    }
+};
+
+#elif defined(_WIN32) || defined(_WIN64)
+
+class DirectoryWatcher::Impl
+{
+public:
+    Impl() = default;
+
+    ~Impl()
+    {
+        for (auto& root : _roots)
+            Close(*root);
+    }
+
+    void Watch(const Path& path)
+    {
+        for (const auto& root : _roots)
+            if (root->path == path)
+                return;
+
+        auto root = std::make_unique<Root>(path);
+        root->handle = CreateFileW(path.wstring().c_str(), FILE_LIST_DIRECTORY, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING, FILE_FLAG_BACKUP_SEMANTICS | FILE_FLAG_OVERLAPPED, nullptr);
+        if (root->handle == INVALID_HANDLE_VALUE)
+            throwex FileSystemException("Cannot open the directory to watch!").Attach(path);
+        root->overlapped.hEvent = CreateEventW(nullptr, TRUE, FALSE, nullptr);
+        if (root->overlapped.hEvent == nullptr)
+        {
+            CloseHandle(root->handle);
+            throwex FileSystemException("Cannot create the directory watcher event!").Attach(path);
+        }
+        if (!Read(*root))
+        {
+            CloseHandle(root->overlapped.hEvent);
+            CloseHandle(root->handle);
+            throwex FileSystemException("Cannot watch the directory!").Attach(path);
+        }
+
+        _roots.emplace_back(std::move(root));
+    }
+
+    bool Unwatch(const Path& path)
+    {
+        for (auto it = _roots.begin(); it != _roots.end(); ++it)
+        {
+            if ((*it)->path == path)
+            {
+                Close(**it);
+                _roots.erase(it);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    std::vector<DirectoryEvent> Poll()
+    {
+        std::vector<DirectoryEvent> events;
+
+        for (auto& root : _roots)
+        {
+            DWORD size;
+            if (!GetOverlappedResult(root->handle, &root->overlapped, &size, FALSE))
+            {
+                if (GetLastError() == ERROR_IO_INCOMPLETE)
+                    continue;
+                throwex FileSystemException("Cannot read directory change notifications!").Attach(root->path);
+            }
+
+            // Empty result means that the notifications buffer was overflowed
+            if (size == 0)
+                events.emplace_back(DirectoryChange::RESCAN, root->path, root->path);
+            else
+                Process(*root, events);
+
+            ResetEvent(root->overlapped.hEvent);
+            if (!Read(*root))
+                throwex FileSystemException("Cannot watch the directory!").Attach(root->path);
+        }
+
+        return events;
+    }
+
+private:
+    struct Root
+    {
+        Path path;
+        HANDLE handle;
+        OVERLAPPED overlapped;
+        std::vector<DWORD> buffer;
+
+        explicit Root(const Path& p) : path(p), handle(INVALID_HANDLE_VALUE), overlapped(), buffer(16384) {}
+    };
+
+    std::vector<std::unique_ptr<Root>> _roots;
+
+    static bool Read(Root& root)
+    {
+        const DWORD filter = FILE_NOTIFY_CHANGE_FILE_NAME | FILE_NOTIFY_CHANGE_DIR_NAME | FILE_NOTIFY_CHANGE_LAST_WRITE | FILE_NOTIFY_CHANGE_SIZE;
+        return ReadDirectoryChangesW(root.handle, root.buffer.data(), (DWORD)(root.buffer.size() * sizeof(DWORD)), TRUE, filter, nullptr, &root.overlapped, nullptr) != 0;
+    }
+
+    static void Close(Root& root)
+    {
+        DWORD size;
+        CancelIoEx(root.handle, &root.overlapped);
+        GetOverlappedResult(root.handle, &root.overlapped, &size, TRUE);
+        if (!CloseHandle(root.overlapped.hEvent) || !CloseHandle(root.handle))
+            fatality(FileSystemException("Cannot close the directory watcher!").Attach(root.path));
+    }
+
+    static void Process(const Root& root, std::vector<DirectoryEvent>& events)
+    {
+        const char* ptr = (const char*)root.buffer.data();
+        for (;;)
+        {
+            const FILE_NOTIFY_INFORMATION* info = (const FILE_NOTIFY_INFORMATION*)ptr;
+            const Path path = root.path / Path(std::wstring(info->FileName, info->FileNameLength / sizeof(WCHAR)));
+
+            switch (info->Action)
+            {
+                case FILE_ACTION_ADDED:
+                case FILE_ACTION_RENAMED_NEW_NAME:
+                    if (path.IsDirectory())
+                        Internals::modified_files(root.path, path, events);
+                    else
+                        events.emplace_back(DirectoryChange::MODIFIED, root.path, path);
+                    break;
+                case FILE_ACTION_MODIFIED:
+                    // Directories are reported as modified when their content changes
+                    if (!path.IsDirectory())
+                        events.emplace_back(DirectoryChange::MODIFIED, root.path, path);
+                    break;
+                case FILE_ACTION_REMOVED:
+                case FILE_ACTION_RENAMED_OLD_NAME:
+                    events.emplace_back(DirectoryChange::REMOVED, root.path, path);
+                    break;
+            }
+
+            if (info->NextEntryOffset == 0)
+                break;
+            ptr += info->NextEntryOffset;
+        }
+    }
+};
+
+#else
+
+class DirectoryWatcher::Impl
+{
+public:
+    void Watch(const Path& path)
+    {
+        throwex FileSystemException("Directory watcher is not supported for the current platform!").Attach(path);
+    }
+
+    bool Unwatch(const Path& path) { return false; }
+
+    std::vector<DirectoryEvent> Poll() { return std::vector<DirectoryEvent>(); }
+};
+
+#endif
+
+DirectoryWatcher::DirectoryWatcher() : _pimpl(std::make_unique<Impl>())
+{
+}
+
+DirectoryWatcher::DirectoryWatcher(DirectoryWatcher&& watcher) noexcept : _pimpl(std::move(watcher._pimpl))
+{
+}
+
+DirectoryWatcher::~DirectoryWatcher()
+{
+}
+
+DirectoryWatcher& DirectoryWatcher::operator=(DirectoryWatcher&& watcher) noexcept
+{
+    _pimpl = std::move(watcher._pimpl);
+    return *this;
+}
+
+void DirectoryWatcher::Watch(const Path& path)
+{
+    _pimpl->Watch(path);
+}
+
+bool DirectoryWatcher::Unwatch(const Path& path)
+{
+    return _pimpl->Unwatch(path);
+}
+
+std::vector<DirectoryEvent> DirectoryWatcher::Poll()
+{
+    return _pimpl->Poll();
+}
+
+} // namespace CppCommon
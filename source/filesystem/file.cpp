@@ -9,13 +9,18 @@
 #include "filesystem/file.h"
 
 #include "errors/fatal.h"
+#include "memory/memory.h"
 #include "utility/validate_aligned_storage.h"
 
+#include <algorithm>
 #include <cassert>
+#include <climits>
 #include <cstring>
 
 #if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
 #include <sys/stat.h>
+#include <sys/uio.h>
+#include <errno.h>
 #include <fcntl.h>
 #include <unistd.h>
 #elif defined(_WIN32) || defined(_WIN64)
@@ -125,6 +130,11 @@ public:
 #endif
     }
 
+    void* handle() const noexcept
+    {
+        return (void*)(size_t)_file;
+    }
+
     bool IsFileReadOpened() const
     {
         return _read;
@@ -137,6 +147,10 @@ public:
 
     void Create(bool read, bool write, const Flags<FileAttributes>& attributes = File::DEFAULT_ATTRIBUTES, const Flags<FilePermissions>& permissions = File::DEFAULT_PERMISSIONS, size_t buffer = File::DEFAULT_BUFFER)
     {
+        // Direct I/O files are always unbuffered
+        if (attributes & FileAttributes::DIRECT)
+            buffer = 0;
+
         // Close previously opened file
         assert(!IsFileOpened() && "File is already opened!");
         if (IsFileOpened())
@@ -168,9 +182,12 @@ public:
         if (permissions & FilePermissions::ISVTX)
             mode |= S_ISVTX;
 
-        _file = open(path().string().c_str(), O_CREAT | O_EXCL | ((read && write) ? O_RDWR : (read ? O_RDONLY : (write ? O_WRONLY : 0))), mode);
+        _file = open(path().string().c_str(), O_CREAT | O_EXCL | ((read && write) ? O_RDWR : (read ? O_RDONLY : (write ? O_WRONLY : 0))) | OpenFlags(attributes), mode);
         if (_file < 0)
             throwex FileSystemException("Cannot create a new file!").Attach(path());
+        std::error_code ec;
+        if (!OpenAttributes(attributes, ec))
+            throwex FileSystemException("Cannot disable the file caching!", ec.value()).Attach(path());
 #elif defined(_WIN32) || defined(_WIN64)
         DWORD dwFlagsAndAttributes = 0;
         if (attributes & FileAttributes::NORMAL)
@@ -189,6 +206,10 @@ public:
             dwFlagsAndAttributes |= FILE_ATTRIBUTE_SYSTEM;
         if (attributes & FileAttributes::TEMPORARY)
             dwFlagsAndAttributes |= FILE_ATTRIBUTE_TEMPORARY;
+        if (attributes & FileAttributes::DIRECT)
+            dwFlagsAndAttributes |= FILE_FLAG_NO_BUFFERING;
+        if (attributes & FileAttributes::WRITETHROUGH)
+            dwFlagsAndAttributes |= FILE_FLAG_WRITE_THROUGH;
 
         _file = CreateFileW(path().wstring().c_str(), (read ? GENERIC_READ : 0) | (write ? GENERIC_WRITE : 0), FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr, CREATE_NEW, dwFlagsAndAttributes, nullptr);
         if (_file == INVALID_HANDLE_VALUE)
@@ -211,6 +232,26 @@ public:
 
     void Open(bool read, bool write, bool truncate = false, const Flags<FileAttributes>& attributes = File::DEFAULT_ATTRIBUTES, const Flags<FilePermissions>& permissions = File::DEFAULT_PERMISSIONS, size_t buffer = File::DEFAULT_BUFFER)
     {
+        std::error_code ec;
+        if (!TryOpen(false, read, write, truncate, attributes, permissions, buffer, ec))
+            throwex FileSystemException("Cannot open existing file!", ec.value()).Attach(path());
+    }
+
+    void OpenOrCreate(bool read, bool write, bool truncate = false, const Flags<FileAttributes>& attributes = File::DEFAULT_ATTRIBUTES, const Flags<FilePermissions>& permissions = File::DEFAULT_PERMISSIONS, size_t buffer = File::DEFAULT_BUFFER)
+    {
+        std::error_code ec;
+        if (!TryOpen(true, read, write, truncate, attributes, permissions, buffer, ec))
+            throwex FileSystemException("Cannot open or create file!", ec.value()).Attach(path());
+    }
+
+    bool TryOpen(bool create, bool read, bool write, bool truncate, const Flags<FileAttributes>& attributes, const Flags<FilePermissions>& permissions, size_t buffer, std::error_code& ec)
+    {
+        ec.clear();
+
+        // Direct I/O files are always unbuffered
+        if (attributes & FileAttributes::DIRECT)
+            buffer = 0;
+
         // Close previously opened file
         assert(!IsFileOpened() && "File is already opened!");
         if (IsFileOpened())
@@ -242,9 +283,14 @@ public:
         if (permissions & FilePermissions::ISVTX)
             mode |= S_ISVTX;
 
-        _file = open(path().string().c_str(), ((read && write) ? O_RDWR : (read ? O_RDONLY : (write ? O_WRONLY : 0))) | (truncate ? O_TRUNC : 0), mode);
+        _file = open(path().string().c_str(), (create ? O_CREAT : 0) | ((read && write) ? O_RDWR : (read ? O_RDONLY : (write ? O_WRONLY : 0))) | (truncate ? O_TRUNC : 0) | OpenFlags(attributes), mode);
         if (_file < 0)
-            throwex FileSystemException("Cannot create a new file!").Attach(path());
+        {
+            ec.assign(errno, std::system_category());
+            return false;
+        }
+        if (!OpenAttributes(attributes, ec))
+            return false;
 #elif defined(_WIN32) || defined(_WIN64)
         DWORD dwFlagsAndAttributes = 0;
         if (attributes & FileAttributes::NORMAL)
@@ -263,10 +309,17 @@ public:
             dwFlagsAndAttributes |= FILE_ATTRIBUTE_SYSTEM;
         if (attributes & FileAttributes::TEMPORARY)
             dwFlagsAndAttributes |= FILE_ATTRIBUTE_TEMPORARY;
+        if (attributes & FileAttributes::DIRECT)
+            dwFlagsAndAttributes |= FILE_FLAG_NO_BUFFERING;
+        if (attributes & FileAttributes::WRITETHROUGH)
+            dwFlagsAndAttributes |= FILE_FLAG_WRITE_THROUGH;
 
-        _file = CreateFileW(path().wstring().c_str(), (read ? GENERIC_READ : 0) | (write ? GENERIC_WRITE : 0), FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr, (truncate ? TRUNCATE_EXISTING : OPEN_EXISTING), dwFlagsAndAttributes, nullptr);
+        _file = CreateFileW(path().wstring().c_str(), (read ? GENERIC_READ : 0) | (write ? GENERIC_WRITE : 0), FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr, (create ? (truncate ? CREATE_ALWAYS : OPEN_ALWAYS) : (truncate ? TRUNCATE_EXISTING : OPEN_EXISTING)), dwFlagsAndAttributes, nullptr);
         if (_file == INVALID_HANDLE_VALUE)
-            throwex FileSystemException("Cannot open existing file!").Attach(path());
+        {
+            ec.assign(GetLastError(), std::system_category());
+            return false;
+        }
 #endif
         // Initialize file read buffer
         _read = read;
@@ -281,80 +334,31 @@ public:
         _write_size = 0;
         if (write)
             _write_buffer.resize(buffer);
+
+        return true;
     }
 
-    void OpenOrCreate(bool read, bool write, bool truncate = false, const Flags<FileAttributes>& attributes = File::DEFAULT_ATTRIBUTES, const Flags<FilePermissions>& permissions = File::DEFAULT_PERMISSIONS, size_t buffer = File::DEFAULT_BUFFER)
+    uint64_t remaining() const
     {
-        // Close previously opened file
-        assert(!IsFileOpened() && "File is already opened!");
-        if (IsFileOpened())
-            Close();
-#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
-        mode_t mode = 0;
-        if (permissions & FilePermissions::IRUSR)
-            mode |= S_IRUSR;
-        if (permissions & FilePermissions::IWUSR)
-            mode |= S_IWUSR;
-        if (permissions & FilePermissions::IXUSR)
-            mode |= S_IXUSR;
-        if (permissions & FilePermissions::IRGRP)
-            mode |= S_IRGRP;
-        if (permissions & FilePermissions::IWGRP)
-            mode |= S_IWGRP;
-        if (permissions & FilePermissions::IXGRP)
-            mode |= S_IXGRP;
-        if (permissions & FilePermissions::IROTH)
-            mode |= S_IROTH;
-        if (permissions & FilePermissions::IWOTH)
-            mode |= S_IWOTH;
-        if (permissions & FilePermissions::IXOTH)
-            mode |= S_IXOTH;
-        if (permissions & FilePermissions::ISUID)
-            mode |= S_ISUID;
-        if (permissions & FilePermissions::ISGID)
-            mode |= S_ISGID;
-        if (permissions & FilePermissions::ISVTX)
-            mode |= S_ISVTX;
-
-        _file = open(path().string().c_str(), O_CREAT | ((read && write) ? O_RDWR : (read ? O_RDONLY : (write ? O_WRONLY : 0))) | (truncate ? O_TRUNC : 0), mode);
-        if (_file < 0)
-            throwex FileSystemException("Cannot create a new file!").Attach(path());
-#elif defined(_WIN32) || defined(_WIN64)
-        DWORD dwFlagsAndAttributes = 0;
-        if (attributes & FileAttributes::NORMAL)
-            dwFlagsAndAttributes |= FILE_ATTRIBUTE_NORMAL;
-        if (attributes & FileAttributes::ARCHIVED)
-            dwFlagsAndAttributes |= FILE_ATTRIBUTE_ARCHIVE;
-        if (attributes & FileAttributes::HIDDEN)
-            dwFlagsAndAttributes |= FILE_ATTRIBUTE_HIDDEN;
-        if (attributes & FileAttributes::INDEXED)
-            dwFlagsAndAttributes |= FILE_ATTRIBUTE_NOT_CONTENT_INDEXED;
-        if (attributes & FileAttributes::OFFLINE)
-            dwFlagsAndAttributes |= FILE_ATTRIBUTE_OFFLINE;
-        if (attributes & FileAttributes::READONLY)
-            dwFlagsAndAttributes |= FILE_ATTRIBUTE_READONLY;
-        if (attributes & FileAttributes::SYSTEM)
-            dwFlagsAndAttributes |= FILE_ATTRIBUTE_SYSTEM;
-        if (attributes & FileAttributes::TEMPORARY)
-            dwFlagsAndAttributes |= FILE_ATTRIBUTE_TEMPORARY;
+        if (!IsFileReadOpened())
+            return 0;
 
-        _file = CreateFileW(path().wstring().c_str(), (read ? GENERIC_READ : 0) | (write ? GENERIC_WRITE : 0), FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr, (truncate ? CREATE_ALWAYS : OPEN_ALWAYS), dwFlagsAndAttributes, nullptr);
-        if (_file == INVALID_HANDLE_VALUE)
-            throwex FileSystemException("Cannot open existing file!").Attach(path());
-#endif
-        // Initialize file read buffer
-        _read = read;
-        _read_index = 0;
-        _read_size = 0;
-        if (read)
-            _read_buffer.resize(buffer);
+        // Files without the valid offset (e.g. named pipes) have unknown size
+        uint64_t current;
+        uint64_t total;
+        try
+        {
+            current = offset();
+            total = size();
+        }
+        catch (const FileSystemException&)
+        {
+            return 0;
+        }
 
-        // Initialize file write buffer
-        _write = write;
-        _write_index = 0;
-        _write_size = 0;
-        if (write)
-            _write_buffer.resize(buffer);
+        // Locally buffered bytes are already read from the file
+        uint64_t buffered = _read_size - _read_index;
+        return ((total > current) ? (total - current) : 0) + buffered;
     }
 
     size_t Read(void* buffer, size_t size)
@@ -366,18 +370,44 @@ public:
         if (!IsFileReadOpened())
             throwex FileSystemException("File is not opened for reading!").Attach(path());
 
+        std::error_code ec;
+        size_t result = TryRead(buffer, size, ec);
+        if (ec)
+            throwex FileSystemException("Cannot read from the file!", ec.value()).Attach(path());
+        return result;
+    }
+
+    size_t TryRead(void* buffer, size_t size, std::error_code& ec)
+    {
+        ec.clear();
+
+        if ((buffer == nullptr) || (size == 0))
+            return 0;
+
+        if (!IsFileReadOpened())
+        {
+            ec = std::make_error_code(std::errc::bad_file_descriptor);
+            return 0;
+        }
+
         // Read file with zero buffer
         if (_read_buffer.empty())
         {
 #if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
             ssize_t result = read(_file, buffer, size);
             if (result < 0)
-                throwex FileSystemException("Cannot read from the file!").Attach(path());
+            {
+                ec.assign(errno, std::system_category());
+                return 0;
+            }
             return (size_t)result;
 #elif defined(_WIN32) || defined(_WIN64)
             DWORD result;
             if (!ReadFile(_file, buffer, (DWORD)size, &result, nullptr))
-                throwex FileSystemException("Cannot read from the file!").Attach(path());
+            {
+                ec.assign(GetLastError(), std::system_category());
+                return 0;
+            }
             return (size_t)result;
 #endif
         }
@@ -387,6 +417,34 @@ public:
 
         while (size > 0)
         {
+            // Read big chunks directly into the given buffer bypassing the local read buffer
+            if ((_read_index == _read_size) && (size >= _read_buffer.size()))
+            {
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+                ssize_t result = read(_file, bytes, size);
+                if (result < 0)
+                {
+                    ec.assign(errno, std::system_category());
+                    break;
+                }
+#elif defined(_WIN32) || defined(_WIN64)
+                DWORD result;
+                if (!ReadFile(_file, bytes, (DWORD)size, &result, nullptr))
+                {
+                    ec.assign(GetLastError(), std::system_category());
+                    break;
+                }
+#endif
+                // Stop if the end of file was met
+                if (result == 0)
+                    break;
+
+                counter += (size_t)result;
+                bytes += (size_t)result;
+                size -= (size_t)result;
+                continue;
+            }
+
             // Update the local read buffer from the file
             if (_read_index == _read_size)
             {
@@ -394,12 +452,20 @@ public:
 #if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
                 ssize_t result = read(_file, _read_buffer.data(), _read_buffer.size());
                 if (result < 0)
-                    throwex FileSystemException("Cannot read from the file!").Attach(path());
+                {
+                    ec.assign(errno, std::system_category());
+                    _read_size = 0;
+                    break;
+                }
                 _read_size = (size_t)result;
 #elif defined(_WIN32) || defined(_WIN64)
                 DWORD result;
                 if (!ReadFile(_file, _read_buffer.data(), (DWORD)_read_buffer.size(), &result, nullptr))
-                    throwex FileSystemException("Cannot read from the file!").Attach(path());
+                {
+                    ec.assign(GetLastError(), std::system_category());
+                    _read_size = 0;
+                    break;
+                }
                 _read_size = (size_t)result;
 #endif
                 // Stop if the end of file was met
@@ -486,6 +552,136 @@ public:
         return counter;
     }
 
+    size_t ReadV(std::span<const File::ReadBuffer> buffers)
+    {
+        assert(IsFileReadOpened() && "File is not opened for reading!");
+        if (!IsFileReadOpened())
+            throwex FileSystemException("File is not opened for reading!").Attach(path());
+
+        // Read buffered file through the local read buffer
+        if (!_read_buffer.empty())
+        {
+            size_t result = 0;
+            for (size_t i = 0; i < buffers.size(); ++i)
+            {
+                size_t size = Read(buffers[i].data, buffers[i].size);
+                result += size;
+                if (size < buffers[i].size)
+                    break;
+            }
+            return result;
+        }
+
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+        return Vectored(buffers, "Cannot read from the file!", [this](const struct iovec* vectors, int size, size_t)
+        {
+            return readv(_file, vectors, size);
+        });
+#elif defined(_WIN32) || defined(_WIN64)
+        size_t result = 0;
+        for (size_t i = 0; i < buffers.size(); ++i)
+        {
+            size_t size = Transfer(buffers[i].data, buffers[i].size, nullptr, true);
+            result += size;
+            if (size < buffers[i].size)
+                break;
+        }
+        return result;
+#endif
+    }
+
+    size_t WriteV(std::span<const File::WriteBuffer> buffers)
+    {
+        assert(IsFileWriteOpened() && "File is not opened for writing!");
+        if (!IsFileWriteOpened())
+            throwex FileSystemException("File is not opened for writing!").Attach(path());
+
+        // Write buffered file through the local write buffer
+        if (!_write_buffer.empty())
+        {
+            size_t result = 0;
+            for (size_t i = 0; i < buffers.size(); ++i)
+            {
+                size_t size = Write(buffers[i].data, buffers[i].size);
+                result += size;
+                if (size < buffers[i].size)
+                    break;
+            }
+            return result;
+        }
+
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+        return Vectored(buffers, "Cannot write into the file!", [this](const struct iovec* vectors, int size, size_t)
+        {
+            return writev(_file, vectors, size);
+        });
+#elif defined(_WIN32) || defined(_WIN64)
+        size_t result = 0;
+        for (size_t i = 0; i < buffers.size(); ++i)
+            result += Transfer((void*)buffers[i].data, buffers[i].size, nullptr, false);
+        return result;
+#endif
+    }
+
+    size_t ReadAt(uint64_t offset, void* buffer, size_t size) const
+    {
+        File::ReadBuffer buffers[] = { { buffer, size } };
+        return ReadAt(offset, buffers);
+    }
+
+    size_t ReadAt(uint64_t offset, std::span<const File::ReadBuffer> buffers) const
+    {
+        assert(IsFileReadOpened() && "File is not opened for reading!");
+        if (!IsFileReadOpened())
+            throwex FileSystemException("File is not opened for reading!").Attach(path());
+
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+        return Vectored(buffers, "Cannot read from the file!", [this, offset](const struct iovec* vectors, int size, size_t done)
+        {
+            return (size == 1) ? pread(_file, vectors[0].iov_base, vectors[0].iov_len, (off_t)(offset + done)) : preadv(_file, vectors, size, (off_t)(offset + done));
+        });
+#elif defined(_WIN32) || defined(_WIN64)
+        size_t result = 0;
+        for (size_t i = 0; i < buffers.size(); ++i)
+        {
+            uint64_t position = offset + result;
+            size_t size = Transfer(buffers[i].data, buffers[i].size, &position, true);
+            result += size;
+            if (size < buffers[i].size)
+                break;
+        }
+        return result;
+#endif
+    }
+
+    size_t WriteAt(uint64_t offset, const void* buffer, size_t size)
+    {
+        File::WriteBuffer buffers[] = { { buffer, size } };
+        return WriteAt(offset, buffers);
+    }
+
+    size_t WriteAt(uint64_t offset, std::span<const File::WriteBuffer> buffers)
+    {
+        assert(IsFileWriteOpened() && "File is not opened for writing!");
+        if (!IsFileWriteOpened())
+            throwex FileSystemException("File is not opened for writing!").Attach(path());
+
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+        return Vectored(buffers, "Cannot write into the file!", [this, offset](const struct iovec* vectors, int size, size_t done)
+        {
+            return (size == 1) ? pwrite(_file, vectors[0].iov_base, vectors[0].iov_len, (off_t)(offset + done)) : pwritev(_file, vectors, size, (off_t)(offset + done));
+        });
+#elif defined(_WIN32) || defined(_WIN64)
+        size_t result = 0;
+        for (size_t i = 0; i < buffers.size(); ++i)
+        {
+            uint64_t position = offset + result;
+            result += Transfer((void*)buffers[i].data, buffers[i].size, &position, false);
+        }
+        return result;
+#endif
+    }
+
     void Seek(uint64_t offset)
     {
         assert(IsFileOpened() && "File is not opened!");
@@ -583,6 +779,86 @@ public:
 #endif
     }
 
+    void Preallocate(uint64_t size)
+    {
+        assert(IsFileWriteOpened() && "File is not opened for writing!");
+        if (!IsFileWriteOpened())
+            throwex FileSystemException("File is not opened for writing!").Attach(path());
+#if defined(__linux__)
+        // Filesystems without extents preallocation support ignore the request
+        if ((fallocate(_file, FALLOC_FL_KEEP_SIZE, 0, (off_t)size) != 0) && (errno != EOPNOTSUPP) && (errno != ENOSYS))
+            throwex FileSystemException("Cannot preallocate the file space!").Attach(path());
+#elif defined(__APPLE__)
+        // Try to preallocate contiguous space and fall back to any space
+        fstore_t store = { F_ALLOCATECONTIG | F_ALLOCATEALL, F_PEOFPOSMODE, 0, (off_t)size, 0 };
+        if (fcntl(_file, F_PREALLOCATE, &store) != 0)
+        {
+            store.fst_flags = F_ALLOCATEALL;
+            if ((fcntl(_file, F_PREALLOCATE, &store) != 0) && (errno != ENOTSUP))
+                throwex FileSystemException("Cannot preallocate the file space!").Attach(path());
+        }
+#elif defined(_WIN32) || defined(_WIN64)
+        FILE_ALLOCATION_INFO info;
+        info.AllocationSize.QuadPart = (LONGLONG)size;
+        if (!SetFileInformationByHandle(_file, FileAllocationInfo, &info, sizeof(info)))
+            throwex FileSystemException("Cannot preallocate the file space!").Attach(path());
+#endif
+    }
+
+    void Advise(FileAdvice advice, uint64_t offset, uint64_t size)
+    {
+        assert(IsFileOpened() && "File is not opened!");
+        if (!IsFileOpened())
+            throwex FileSystemException("File is not opened!").Attach(path());
+#if (defined(unix) || defined(__unix) || defined(__unix__)) && !defined(__APPLE__)
+        int flag = POSIX_FADV_NORMAL;
+        switch (advice)
+        {
+            case FileAdvice::NORMAL:
+                flag = POSIX_FADV_NORMAL;
+                break;
+            case FileAdvice::SEQUENTIAL:
+                flag = POSIX_FADV_SEQUENTIAL;
+                break;
+            case FileAdvice::RANDOM:
+                flag = POSIX_FADV_RANDOM;
+                break;
+            case FileAdvice::WILLNEED:
+                flag = POSIX_FADV_WILLNEED;
+                break;
+            case FileAdvice::DONTNEED:
+                flag = POSIX_FADV_DONTNEED;
+                break;
+        }
+
+        // posix_fadvise() returns the error code instead of setting errno
+        int result = posix_fadvise(_file, (off_t)offset, (off_t)size, flag);
+        if (result != 0)
+        {
+            errno = result;
+            throwex FileSystemException("Cannot advise the file access pattern!").Attach(path());
+        }
+#elif defined(__APPLE__)
+        // Apple supports only the read-ahead control and prefetching
+        if ((advice == FileAdvice::SEQUENTIAL) || (advice == FileAdvice::RANDOM))
+        {
+            if (fcntl(_file, F_RDAHEAD, (advice == FileAdvice::SEQUENTIAL) ? 1 : 0) != 0)
+                throwex FileSystemException("Cannot advise the file access pattern!").Attach(path());
+        }
+        else if ((advice == FileAdvice::WILLNEED) && (size > 0))
+        {
+            struct radvisory radvisory = { (off_t)offset, (int)std::min(size, (uint64_t)INT_MAX) };
+            if (fcntl(_file, F_RDADVISE, &radvisory) != 0)
+                throwex FileSystemException("Cannot advise the file access pattern!").Attach(path());
+        }
+#elif defined(_WIN32) || defined(_WIN64)
+        // Windows has no access pattern advices for the opened file
+        (void)advice;
+        (void)offset;
+        (void)size;
+#endif
+    }
+
     void Flush()
     {
         FlushBuffer();
@@ -596,6 +872,23 @@ public:
 #endif
     }
 
+    void FlushData()
+    {
+        FlushBuffer();
+#if defined(__linux__)
+        int result = fdatasync(_file);
+        if (result != 0)
+            throwex FileSystemException("Cannot flush the file data!").Attach(path());
+#elif defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+        int result = fsync(_file);
+        if (result != 0)
+            throwex FileSystemException("Cannot flush the file data!").Attach(path());
+#elif defined(_WIN32) || defined(_WIN64)
+        if (!FlushFileBuffers(_file))
+            throwex FileSystemException("Cannot flush the file data!").Attach(path());
+#endif
+    }
+
     void Close()
     {
         assert(IsFileOpened() && "File is not opened!");
@@ -628,6 +921,46 @@ public:
     }
 
 private:
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+    static int OpenFlags(const Flags<FileAttributes>& attributes) noexcept
+    {
+        int flags = 0;
+#if defined(O_DIRECT)
+        if (attributes & FileAttributes::DIRECT)
+            flags |= O_DIRECT;
+#endif
+#if defined(O_DSYNC)
+        if (attributes & FileAttributes::WRITETHROUGH)
+            flags |= O_DSYNC;
+#else
+        if (attributes & FileAttributes::WRITETHROUGH)
+            flags |= O_SYNC;
+#endif
+        return flags;
+    }
+
+    bool OpenAttributes(const Flags<FileAttributes>& attributes, std::error_code& ec)
+    {
+#if defined(__APPLE__)
+        // Apple has no O_DIRECT flag and disables caching of the opened file instead
+        if (attributes & FileAttributes::DIRECT)
+        {
+            if (fcntl(_file, F_NOCACHE, 1) != 0)
+            {
+                ec.assign(errno, std::system_category());
+                close(_file);
+                _file = -1;
+                return false;
+            }
+        }
+#else
+        (void)attributes;
+        (void)ec;
+#endif
+        return true;
+    }
+#endif
+
     const Path* _path;
 #if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
     int _file;
@@ -645,6 +978,108 @@ private:
     size_t _write_index;
     size_t _write_size;
     std::vector<uint8_t> _write_buffer;
+
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+    //! Transfer the given buffers with vectored system calls until all buffers are transferred or the end of the file is met
+    template <class TBuffer, class TOperation>
+    size_t Vectored(std::span<const TBuffer> buffers, const char* error, TOperation operation) const
+    {
+        const size_t count = buffers.size();
+        const int chunk = 64;
+        struct iovec vectors[chunk];
+
+        size_t result = 0;
+        size_t index = 0;
+        size_t skip = 0;
+        for (;;)
+        {
+            // Skip transferred and empty buffers
+            while ((index < count) && (skip == buffers[index].size))
+            {
+                ++index;
+                skip = 0;
+            }
+            if (index == count)
+                break;
+
+            // Prepare the chunk of vectors from the first partially transferred buffer
+            int size = 0;
+            for (size_t i = index; (i < count) && (size < chunk); ++i, ++size)
+            {
+                size_t offset = (i == index) ? skip : 0;
+                vectors[size].iov_base = (char*)buffers[i].data + offset;
+                vectors[size].iov_len = buffers[i].size - offset;
+            }
+
+            ssize_t transferred = operation(vectors, size, result);
+            if (transferred < 0)
+            {
+                if (errno == EINTR)
+                    continue;
+                throwex FileSystemException(error).Attach(path());
+            }
+
+            // Stop if the end of file was met
+            if (transferred == 0)
+                break;
+
+            result += (size_t)transferred;
+
+            // Advance transferred buffers
+            size_t remain = (size_t)transferred;
+            while (remain > 0)
+            {
+                size_t left = buffers[index].size - skip;
+                if (remain < left)
+                {
+                    skip += remain;
+                    remain = 0;
+                }
+                else
+                {
+                    remain -= left;
+                    ++index;
+                    skip = 0;
+                }
+            }
+        }
+        return result;
+    }
+#elif defined(_WIN32) || defined(_WIN64)
+    //! Transfer the given buffer from the current or the given file offset until it is transferred or the end of the file is met
+    size_t Transfer(void* buffer, size_t size, const uint64_t* offset, bool read) const
+    {
+        uint8_t* bytes = (uint8_t*)buffer;
+        size_t result = 0;
+        while (result < size)
+        {
+            OVERLAPPED overlapped = {};
+            if (offset != nullptr)
+            {
+                overlapped.Offset = (DWORD)(*offset + result);
+                overlapped.OffsetHigh = (DWORD)((*offset + result) >> 32);
+            }
+            DWORD chunk = (DWORD)std::min(size - result, (size_t)0x40000000);
+            DWORD transferred = 0;
+            BOOL success = read ?
+                ReadFile(_file, bytes + result, chunk, &transferred, (offset != nullptr) ? &overlapped : nullptr) :
+                WriteFile(_file, bytes + result, chunk, &transferred, (offset != nullptr) ? &overlapped : nullptr);
+            if (!success)
+            {
+                if (read && (GetLastError() == ERROR_HANDLE_EOF))
+                    break;
+                throwex FileSystemException(read ? "Cannot read from the file!" : "Cannot write into the file!").Attach(path());
+            }
+
+            // Stop if the end of file was met
+            if (transferred == 0)
+                break;
+
+            result += (size_t)transferred;
+        }
+        return result;
+    }
+#endif
 };
 
 //! @endcond
@@ -652,6 +1087,15 @@ private:
 const Flags<FileAttributes> File::DEFAULT_ATTRIBUTES = FileAttributes::NORMAL;
 const Flags<FilePermissions> File::DEFAULT_PERMISSIONS = FilePermissions::IRUSR | FilePermissions::IWUSR | FilePermissions::IRGRP | FilePermissions::IROTH;
 const size_t File::DEFAULT_BUFFER = 8192;
+const size_t File::DIRECT_ALIGNMENT = 4096;
+
+File::DirectBuffer::DirectBuffer(size_t size, size_t alignment)
+    : _storage(), _data(nullptr), _size(AlignSize(size, alignment)), _alignment(alignment)
+{
+    assert(Memory::IsValidAlignment(alignment) && "Direct buffer alignment must be a power of two!");
+    _storage = std::make_unique<uint8_t[]>(_size + _alignment);
+    _data = Memory::Align(_storage.get(), _alignment);
+}
 
 File::File() : Path()
 {
@@ -709,8 +1153,10 @@ File& File::operator=(File&& file) noexcept
     return *this;
 }
 
+void* File::handle() const noexcept { return impl().handle(); }
 uint64_t File::offset() const { return impl().offset(); }
 uint64_t File::size() const { return impl().size(); }
+uint64_t File::remaining() const { return impl().remaining(); }
 
 bool File::IsFileExists() const
 {
@@ -755,13 +1201,27 @@ bool File::IsFileWriteOpened() const { return impl().IsFileWriteOpened(); }
 void File::Create(bool read, bool write, const Flags<FileAttributes>& attributes, const Flags<FilePermissions>& permissions, size_t buffer) { return impl().Create(read, write, attributes, permissions, buffer); }
 void File::Open(bool read, bool write, bool truncate, const Flags<FileAttributes>& attributes, const Flags<FilePermissions>& permissions, size_t buffer) { impl().Open(read, write, truncate, attributes, permissions, buffer); }
 void File::OpenOrCreate(bool read, bool write, bool truncate, const Flags<FileAttributes>& attributes, const Flags<FilePermissions>& permissions, size_t buffer) { impl().OpenOrCreate(read, write, truncate, attributes, permissions, buffer); }
+bool File::TryOpen(bool read, bool write, std::error_code& ec, bool truncate, const Flags<FileAttributes>& attributes, const Flags<FilePermissions>& permissions, size_t buffer) { return impl().TryOpen(false, read, write, truncate, attributes, permissions, buffer, ec); }
+bool File::TryOpenOrCreate(bool read, bool write, std::error_code& ec, bool truncate, const Flags<FileAttributes>& attributes, const Flags<FilePermissions>& permissions, size_t buffer) { return impl().TryOpen(true, read, write, truncate, attributes, permissions, buffer, ec); }
 
 size_t File::Read(void* buffer, size_t size) { return impl().Read(buffer, size); }
+size_t File::TryRead(void* buffer, size_t size, std::error_code& ec) { return impl().TryRead(buffer, size, ec); }
 size_t File::Write(const void* buffer, size_t size) { return impl().Write(buffer, size); }
 
+size_t File::ReadV(std::span<const ReadBuffer> buffers) { return impl().ReadV(buffers); }
+size_t File::WriteV(std::span<const WriteBuffer> buffers) { return impl().WriteV(buffers); }
+
+size_t File::ReadAt(uint64_t offset, void* buffer, size_t size) const { return impl().ReadAt(offset, buffer, size); }
+size_t File::ReadAt(uint64_t offset, std::span<const ReadBuffer> buffers) const { return impl().ReadAt(offset, buffers); }
+size_t File::WriteAt(uint64_t offset, const void* buffer, size_t size) { return impl().WriteAt(offset, buffer, size); }
+size_t File::WriteAt(uint64_t offset, std::span<const WriteBuffer> buffers) { return impl().WriteAt(offset, buffers); }
+
 void File::Seek(uint64_t offset) { return impl().Seek(offset); }
 void File::Resize(uint64_t size) { return impl().Resize(size); }
+void File::Preallocate(uint64_t size) { impl().Preallocate(size); }
+void File::Advise(FileAdvice advice, uint64_t offset, uint64_t size) { impl().Advise(advice, offset, size); }
 void File::Flush() { impl().Flush(); }
+void File::FlushData() { impl().FlushData(); }
 void File::Close() { impl().Close(); }
 
 std::vector<uint8_t> File::ReadAllBytes(const Path& path)
@@ -0,0 +1,296 @@
+/*!
+    \file journal.cpp
+    \brief Filesystem group commit journal implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "filesystem/journal.h"
+
+#include "algorithms/crc32c.h"
+#include "errors/fatal.h"
+#include "filesystem/exceptions.h"
+#include "threads/condition_variable.h"
+#include "threads/thread.h"
+#include "threads/wait_batcher.h"
+#include "utility/endian.h"
+
+#include <atomic>
+#include <cassert>
+#include <exception>
+#include <limits>
+#include <thread>
+#include <vector>
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+
+class Journal::Impl
+{
+public:
+    Impl(const Path& path, const Flags<FilePermissions>& permissions)
+        : _file(path), _permissions(permissions), _opened(false), _offset(0), _size(0), _records(0), _commits(0)
+    {
+    }
+
+    ~Impl()
+    {
+        try
+        {
+            if (IsOpened())
+                Close();
+        }
+        catch (const FileSystemException& ex)
+        {
+            fatality(FileSystemException(ex.string()).Attach(_file));
+        }
+    }
+
+    const Path& path() const noexcept { return _file; }
+    uint64_t size() const noexcept { return _size.load(std::memory_order_acquire); }
+    uint64_t records() const noexcept { return _records.load(std::memory_order_relaxed); }
+    uint64_t commits() const noexcept { return _commits.load(std::memory_order_relaxed); }
+
+    bool IsOpened() const noexcept { return _opened.load(std::memory_order_acquire); }
+
+    void Open()
+    {
+        assert(!IsOpened() && "Journal is already opened!");
+        if (IsOpened())
+            throwex FileSystemException("Journal is already opened!").Attach(_file);
+
+        // Find the end of the last valid record
+        uint64_t size = Journal::Read(_file, nullptr);
+
+        _file.OpenOrCreate(false, true, false, File::DEFAULT_ATTRIBUTES, _permissions, 0);
+        try
+        {
+            // Truncate the torn or corrupted tail of the journal file
+            if (_file.size() > size)
+            {
+                _file.Resize(size);
+                _file.FlushData();
+            }
+        }
+        catch (...)
+        {
+            _file.Close();
+            throw;
+        }
+
+        _offset = size;
+        _size.store(size, std::memory_order_release);
+        _records.store(0, std::memory_order_relaxed);
+        _commits.store(0, std::memory_order_relaxed);
+        _failure = nullptr;
+
+        // Start the writer thread
+        _batcher = std::make_unique<WaitBatcher<Request*>>();
+        _writer = Thread::Start([this]() { Run(); });
+        _opened.store(true, std::memory_order_release);
+    }
+
+    uint64_t Append(const void* buffer, size_t size)
+    {
+        assert(IsOpened() && "Journal is not opened!");
+        if (!IsOpened())
+            throwex FileSystemException("Journal is not opened!").Attach(_file);
+        assert((size <= Journal::MAX_RECORD_SIZE) && "Journal record is too big!");
+        if (size > Journal::MAX_RECORD_SIZE)
+            throwex FileSystemException("Journal record is too big!").Attach(_file);
+
+        // Request lives on the stack of the appending thread until its group is committed
+        Request request = { (const uint8_t*)buffer, size, 0, false, nullptr };
+        if (!_batcher->Enqueue(&request))
+            throwex FileSystemException("Journal is closed!").Attach(_file);
+
+        {
+            Locker<CriticalSection> locker(_cs);
+            _cv.Wait(_cs, [&request]() { return request.done; });
+        }
+
+        if (request.error)
+            std::rethrow_exception(request.error);
+
+        return request.offset;
+    }
+
+    void Close()
+    {
+        assert(IsOpened() && "Journal is not opened!");
+        if (!IsOpened())
+            throwex FileSystemException("Journal is not opened!").Attach(_file);
+
+        // Writer thread commits all appended records before it exits
+        _opened.store(false, std::memory_order_release);
+        _batcher->Close();
+        _writer.join();
+        _batcher.reset();
+
+        _file.Close();
+    }
+
+private:
+    struct Request
+    {
+        const uint8_t* data;
+        size_t size;
+        uint64_t offset;
+        bool done;
+        std::exception_ptr error;
+    };
+
+    File _file;
+    Flags<FilePermissions> _permissions;
+    std::atomic<bool> _opened;
+    uint64_t _offset;
+    std::atomic<uint64_t> _size;
+    std::atomic<uint64_t> _records;
+    std::atomic<uint64_t> _commits;
+    std::exception_ptr _failure;
+
+    // Writer thread with the batch of appended records
+    std::unique_ptr<WaitBatcher<Request*>> _batcher;
+    std::thread _writer;
+    std::vector<uint8_t> _buffer;
+
+    // Committed records notification
+    CriticalSection _cs;
+    ConditionVariable _cv;
+
+    void Run()
+    {
+        std::vector<Request*> batch;
+        while (_batcher->Dequeue(batch))
+            Commit(batch);
+    }
+
+    void Commit(const std::vector<Request*>& batch)
+    {
+        // Once the journal failed its file tail is unknown, so all following records fail too
+        std::exception_ptr error = _failure;
+
+        if (!error)
+        {
+            try
+            {
+                // Frame all records of the group into one buffer
+                _buffer.clear();
+                for (auto request : batch)
+                {
+                    request->offset = _offset + _buffer.size();
+
+                    uint8_t header[8];
+                    Endian::WriteLittleEndian(header, (uint32_t)request->size);
+                    uint32_t crc = CRC32C::Calculate(header, 4);
+                    crc = CRC32C::Calculate(request->data, request->size, crc);
+                    Endian::WriteLittleEndian(header + 4, crc);
+
+                    _buffer.insert(_buffer.end(), header, header + sizeof(header));
+                    _buffer.insert(_buffer.end(), request->data, request->data + request->size);
+                }
+
+                // Write and flush the whole group at once
+                if (_file.WriteAt(_offset, _buffer.data(), _buffer.size()) != _buffer.size())
+                    throwex FileSystemException("Cannot write all records into the journal!").Attach(_file);
+                _file.FlushData();
+
+                _offset += _buffer.size();
+                _size.store(_offset, std::memory_order_release);
+                _records.fetch_add(batch.size(), std::memory_order_relaxed);
+                _commits.fetch_add(1, std::memory_order_relaxed);
+            }
+            catch (...)
+            {
+                error = std::current_exception();
+                _failure = error;
+            }
+        }
+
+        // Wake all appending threads of the group together
+        {
+            Locker<CriticalSection> locker(_cs);
+            for (auto request : batch)
+            {
+                request->error = error;
+                request->done = true;
+            }
+        }
+        _cv.NotifyAll();
+    }
+};
+
+//! @endcond
+
+const size_t Journal::HEADER_SIZE = 8;
+const size_t Journal::MAX_RECORD_SIZE = std::numeric_limits<uint32_t>::max();
+
+Journal::Journal(const Path& path, const Flags<FilePermissions>& permissions) : _pimpl(std::make_unique<Impl>(path, permissions))
+{
+}
+
+Journal::~Journal()
+{
+}
+
+const Path& Journal::path() const noexcept { return _pimpl->path(); }
+uint64_t Journal::size() const noexcept { return _pimpl->size(); }
+uint64_t Journal::records() const noexcept { return _pimpl->records(); }
+uint64_t Journal::commits() const noexcept { return _pimpl->commits(); }
+
+bool Journal::IsOpened() const noexcept { return _pimpl->IsOpened(); }
+
+void Journal::Open() { _pimpl->Open(); }
+uint64_t Journal::Append(const void* buffer, size_t size) { return _pimpl->Append(buffer, size); }
+void Journal::Close() { _pimpl->Close(); }
+
+uint64_t Journal::Read(const Path& path, const RecordHandler& handler)
+{
+    File file(path);
+    if (!file.IsFileExists())
+        return 0;
+
+    file.Open(true, false);
+
+    uint64_t total = file.size();
+    uint64_t offset = 0;
+    std::vector<uint8_t> record;
+
+    while ((total - offset) >= HEADER_SIZE)
+    {
+        uint8_t header[8];
+        if (file.Read(header, sizeof(header)) != sizeof(header))
+            break;
+
+        uint32_t size;
+        uint32_t crc;
+        Endian::ReadLittleEndian(header, size);
+        Endian::ReadLittleEndian(header + 4, crc);
+
+        // Incomplete record
+        if (size > (total - offset - HEADER_SIZE))
+            break;
+
+        record.resize(size);
+        if (file.Read(record.data(), size) != size)
+            break;
+
+        // Corrupted record
+        if (CRC32C::Calculate(record.data(), size, CRC32C::Calculate(header, 4)) != crc)
+            break;
+
+        uint64_t current = offset;
+        offset += HEADER_SIZE + size;
+
+        if (handler && !handler(current, record.data(), size))
+            break;
+    }
+
+    file.Close();
+
+    return offset;
+}
+
+} // namespace CppCommon
@@ -0,0 +1,323 @@
+/*!
+    \file mapped_file.cpp
+    \brief Filesystem memory-mapped file implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "filesystem/mapped_file.h"
+
+#include "errors/fatal.h"
+#include "filesystem/exceptions.h"
+
+#include <algorithm>
+
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#elif defined(_WIN32) || defined(_WIN64)
+#include <windows.h>
+#endif
+
+namespace CppCommon {
+
+MappedFile::MappedFile(const Path& path, MappedFileMode mode, size_t size)
+    : _path(path), _mode(mode), _data(nullptr), _size(0), _file(-1)
+{
+    intptr_t file = OpenFile();
+
+    try
+    {
+        size_t current = GetFileSize(file);
+        if (IsWritable() && (size > current))
+        {
+            SetFileSize(file, size);
+            current = size;
+        }
+        Map(file, current);
+    }
+    catch (...)
+    {
+        CloseFile(file);
+        throw;
+    }
+
+    // Read-write mapping keeps the file opened to resize and flush it
+    if (IsWritable())
+    {
+        _file = file;
+        return;
+    }
+
+    // Read-only mapping stays valid after the file is closed
+    if (!CloseFile(file))
+    {
+        Unmap();
+        throwex FileSystemException("Cannot close the mapped file!").Attach(_path);
+    }
+}
+
+MappedFile::~MappedFile()
+{
+    Unmap();
+
+    if (_file != -1)
+    {
+        if (!CloseFile(_file))
+            fatality(FileSystemException("Cannot close the mapped file!").Attach(_path));
+        _file = -1;
+    }
+}
+
+void MappedFile::Advise(FileAdvice advice, size_t offset, size_t size)
+{
+    if ((_data == nullptr) || (offset >= _size))
+        return;
+
+    size = std::min(size, _size - offset);
+
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+    // Advised range must start at the page boundary
+    size_t page = (size_t)sysconf(_SC_PAGESIZE);
+    size += offset % page;
+    offset -= offset % page;
+
+    int flag = MADV_NORMAL;
+    switch (advice)
+    {
+        case FileAdvice::NORMAL:
+            flag = MADV_NORMAL;
+            break;
+        case FileAdvice::SEQUENTIAL:
+            flag = MADV_SEQUENTIAL;
+            break;
+        case FileAdvice::RANDOM:
+            flag = MADV_RANDOM;
+            break;
+        case FileAdvice::WILLNEED:
+            flag = MADV_WILLNEED;
+            break;
+        case FileAdvice::DONTNEED:
+            flag = MADV_DONTNEED;
+            break;
+    }
+
+    if (madvise(_data + offset, size, flag) != 0)
+        throwex FileSystemException("Cannot advise the mapped file access pattern!").Attach(_path);
+#elif defined(_WIN32) || defined(_WIN64)
+    // Windows supports only prefetching of the mapped content
+#if (_WIN32_WINNT >= 0x0602)
+    if (advice == FileAdvice::WILLNEED)
+    {
+        WIN32_MEMORY_RANGE_ENTRY range;
+        range.VirtualAddress = _data + offset;
+        range.NumberOfBytes = size;
+        if (!PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0))
+            throwex FileSystemException("Cannot advise the mapped file access pattern!").Attach(_path);
+    }
+#endif
+#endif
+}
+
+void MappedFile::Resize(size_t size)
+{
+    if (!IsWritable())
+        throwex FileSystemException("Cannot resize the read-only mapped file!").Attach(_path);
+
+    if (size == _size)
+        return;
+
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+    // Shrink the mapping before the file to never map content beyond the end of the file
+    if (size < _size)
+    {
+        Map(_file, size);
+        SetFileSize(_file, size);
+    }
+    else
+    {
+        SetFileSize(_file, size);
+        Map(_file, size);
+    }
+#elif defined(_WIN32) || defined(_WIN64)
+    // Windows cannot change the size of the file with mapped views
+    Unmap();
+    SetFileSize(_file, size);
+    Map(_file, size);
+#endif
+}
+
+bool MappedFile::Remap()
+{
+    size_t size = 0;
+
+    if (IsWritable())
+    {
+        size = GetFileSize(_file);
+        if (size == _size)
+            return false;
+        Map(_file, size);
+        return true;
+    }
+
+    // Read-only mapping reopens the file to get its current size
+    intptr_t file = OpenFile();
+
+    bool changed = false;
+
+    try
+    {
+        size = GetFileSize(file);
+        changed = (size != _size);
+        if (changed)
+            Map(file, size);
+    }
+    catch (...)
+    {
+        CloseFile(file);
+        throw;
+    }
+
+    if (!CloseFile(file))
+        throwex FileSystemException("Cannot close the mapped file!").Attach(_path);
+
+    return changed;
+}
+
+void MappedFile::Flush(bool async)
+{
+    if (!IsWritable() || (_data == nullptr))
+        return;
+
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+    if (msync(_data, _size, async ? MS_ASYNC : MS_SYNC) != 0)
+        throwex FileSystemException("Cannot flush the mapped file!").Attach(_path);
+#elif defined(_WIN32) || defined(_WIN64)
+    if (!FlushViewOfFile(_data, _size))
+        throwex FileSystemException("Cannot flush the mapped file!").Attach(_path);
+    if (!async && !FlushFileBuffers((HANDLE)_file))
+        throwex FileSystemException("Cannot flush the mapped file!").Attach(_path);
+#endif
+}
+
+intptr_t MappedFile::OpenFile()
+{
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+    int file = IsWritable() ? open(_path.string().c_str(), O_RDWR | O_CREAT, S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH) : open(_path.string().c_str(), O_RDONLY);
+    if (file < 0)
+        throwex FileSystemException("Cannot open the file for mapping!").Attach(_path);
+    return (intptr_t)file;
+#elif defined(_WIN32) || defined(_WIN64)
+    DWORD access = IsWritable() ? (GENERIC_READ | GENERIC_WRITE) : GENERIC_READ;
+    DWORD disposition = IsWritable() ? OPEN_ALWAYS : OPEN_EXISTING;
+    HANDLE file = CreateFileW(_path.wstring().c_str(), access, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr, disposition, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+        throwex FileSystemException("Cannot open the file for mapping!").Attach(_path);
+    return (intptr_t)file;
+#endif
+}
+
+bool MappedFile::CloseFile(intptr_t file) noexcept
+{
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+    return (close((int)file) == 0);
+#elif defined(_WIN32) || defined(_WIN64)
+    return (CloseHandle((HANDLE)file) != 0);
+#endif
+}
+
+size_t MappedFile::GetFileSize(intptr_t file)
+{
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+    struct stat status;
+    if (fstat((int)file, &status) != 0)
+        throwex FileSystemException("Cannot get the mapped file size!").Attach(_path);
+    return (size_t)status.st_size;
+#elif defined(_WIN32) || defined(_WIN64)
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx((HANDLE)file, &size))
+        throwex FileSystemException("Cannot get the mapped file size!").Attach(_path);
+    return (size_t)size.QuadPart;
+#endif
+}
+
+void MappedFile::SetFileSize(intptr_t file, size_t size)
+{
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+    if (ftruncate((int)file, (off_t)size) != 0)
+        throwex FileSystemException("Cannot resize the mapped file!").Attach(_path);
+#elif defined(_WIN32) || defined(_WIN64)
+    LARGE_INTEGER offset;
+    offset.QuadPart = (LONGLONG)size;
+    if (!SetFilePointerEx((HANDLE)file, offset, nullptr, FILE_BEGIN) || !SetEndOfFile((HANDLE)file))
+        throwex FileSystemException("Cannot resize the mapped file!").Attach(_path);
+#endif
+}
+
+void MappedFile::Map(intptr_t file, size_t size)
+{
+    if (size == _size)
+        return;
+
+    // Empty files are not mapped
+    if (size == 0)
+    {
+        Unmap();
+        return;
+    }
+
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+#if defined(__linux__)
+    // Linux extends or shrinks the existing mapping keeping its mapped pages
+    if (_data != nullptr)
+    {
+        void* data = mremap(_data, _size, size, MREMAP_MAYMOVE);
+        if (data == MAP_FAILED)
+            throwex FileSystemException("Cannot remap the file!").Attach(_path);
+        _data = (char*)data;
+        _size = size;
+        return;
+    }
+#endif
+
+    int protection = IsWritable() ? (PROT_READ | PROT_WRITE) : PROT_READ;
+    void* data = mmap(nullptr, size, protection, MAP_SHARED, (int)file, 0);
+    if (data == MAP_FAILED)
+        throwex FileSystemException("Cannot map the file!").Attach(_path);
+#elif defined(_WIN32) || defined(_WIN64)
+    HANDLE mapping = CreateFileMappingW((HANDLE)file, nullptr, IsWritable() ? PAGE_READWRITE : PAGE_READONLY, (DWORD)((uint64_t)size >> 32), (DWORD)size, nullptr);
+    if (mapping == nullptr)
+        throwex FileSystemException("Cannot create the file mapping!").Attach(_path);
+
+    void* data = MapViewOfFile(mapping, IsWritable() ? FILE_MAP_WRITE : FILE_MAP_READ, 0, 0, size);
+    CloseHandle(mapping);
+    if (data == nullptr)
+        throwex FileSystemException("Cannot map the file!").Attach(_path);
+#endif
+
+    Unmap();
+    _data = (char*)data;
+    _size = size;
+}
+
+void MappedFile::Unmap()
+{
+    if (_data == nullptr)
+        return;
+
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+    if (munmap(_data, _size) != 0)
+        fatality(FileSystemException("Cannot unmap the file!").Attach(_path));
+#elif defined(_WIN32) || defined(_WIN64)
+    if (!UnmapViewOfFile(_data))
+        fatality(FileSystemException("Cannot unmap the file!").Attach(_path));
+#endif
+
+    _data = nullptr;
+    _size = 0;
+}
+
+} // namespace CppCommon
@@ -9,12 +9,19 @@
 #include "filesystem/path.h"
 
 #include "filesystem/directory.h"
+#include "filesystem/directory_walker.h"
 #include "filesystem/symlink.h"
+#include "system/cpu.h"
 #include "system/uuid.h"
+#include "threads/critical_section.h"
+#include "threads/thread_pool.h"
 #include "utility/countof.h"
 #include "utility/resource.h"
 
 #include <algorithm>
+#include <atomic>
+#include <exception>
+#include <memory>
 #include <regex>
 #include <stack>
 #include <tuple>
@@ -22,8 +29,11 @@
 
 #if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
 #if defined(__APPLE__)
+#include <copyfile.h>
 #include <libproc.h>
 #elif defined(linux) || defined(__linux) || defined(__linux__)
+#include <linux/fs.h>
+#include <sys/ioctl.h>
 #include <sys/sendfile.h>
 #endif
 #include <sys/statvfs.h>
@@ -46,7 +56,7 @@ namespace Internals {
 
 Path initial = Path::current();
 
-std::pair<Path, size_t> root(const std::string& path)
+std::pair<std::string_view, size_t> root(std::string_view path)
 {
     bool root_found = false;
     size_t root_length = 0;
@@ -56,7 +66,7 @@ std::pair<Path, size_t> root(const std::string& path)
     {
         root_length = 1;
 
-        return std::make_pair(Path("/"), root_length);
+        return std::make_pair(std::string_view("/"), root_length);
     }
 
     // Unix case 2: "///foo"
@@ -72,7 +82,7 @@ std::pair<Path, size_t> root(const std::string& path)
             ++root_length;
         }
 
-        return std::make_pair(Path("/"), root_length);
+        return std::make_pair(std::string_view("/"), root_length);
     }
 
     // Windows case 1: "\\net" or "//net"
@@ -91,7 +101,7 @@ std::pair<Path, size_t> root(const std::string& path)
             ++root_length;
         }
 
-        return std::make_pair(Path(path.substr(0, root_length)), root_length);
+        return std::make_pair(path.substr(0, root_length), root_length);
     }
 
     // Windows case 2: "\\?\"
@@ -123,25 +133,25 @@ std::pair<Path, size_t> root(const std::string& path)
         ++root_length;
     }
 
-    return (root_found && (root_length > 0)) ? std::make_pair(Path(path.substr(0, root_length)), root_length) : std::make_pair<Path, size_t>(Path(), 0);
+    return (root_found && (root_length > 0)) ? std::make_pair(path.substr(0, root_length), root_length) : std::make_pair(std::string_view(), (size_t)0);
 }
 
 } // namespace Internals
 //! @endcond
 
-Path Path::root() const
+std::string_view Path::root_view() const noexcept
 {
     return Internals::root(_path).first;
 }
 
-Path Path::relative() const
+std::string_view Path::relative_view() const noexcept
 {
     size_t root_length = Internals::root(_path).second;
     size_t relative_length = _path.size() - root_length;
-    return Path(_path.substr(root_length, relative_length));
+    return std::string_view(_path).substr(root_length, relative_length);
 }
 
-Path Path::parent() const
+std::string_view Path::parent_view() const noexcept
 {
     bool parent_found = false;
     size_t parent_length = _path.size();
@@ -203,10 +213,10 @@ Path Path::parent() const
             filepart = true;
     }
 
-    return (parent_found && (parent_length > 0)) ? Path(_path.substr(0, parent_length)) : Path();
+    return (parent_found && (parent_length > 0)) ? std::string_view(_path).substr(0, parent_length) : std::string_view();
 }
 
-Path Path::filename() const
+std::string_view Path::filename_view() const noexcept
 {
     bool filename_found = false;
     size_t filename_begin = _path.size();
@@ -226,10 +236,10 @@ Path Path::filename() const
 
     size_t filename_length = (filename_end - filename_begin);
 
-    return (filename_length > 0) ? Path(_path.substr(filename_begin, filename_length)) : (filename_found ? Path(".") : Path());
+    return (filename_length > 0) ? std::string_view(_path).substr(filename_begin, filename_length) : (filename_found ? std::string_view(".") : std::string_view());
 }
 
-Path Path::stem() const
+std::string_view Path::stem_view() const noexcept
 {
     bool ext_found = false;
     size_t ext_begin = _path.size();
@@ -274,10 +284,10 @@ Path Path::stem() const
 
     size_t stem_length = (stem_end - stem_begin);
 
-    return (stem_length > 0) ? Path(_path.substr(stem_begin, stem_length)) : (stem_found ? Path(".") : Path());
+    return (stem_length > 0) ? std::string_view(_path).substr(stem_begin, stem_length) : (stem_found ? std::string_view(".") : std::string_view());
 }
 
-Path Path::extension() const
+std::string_view Path::extension_view() const noexcept
 {
     bool ext_found = false;
     size_t ext_begin = _path.size();
@@ -304,7 +314,7 @@ Path Path::extension() const
 
     size_t ext_length = ext_end - ext_begin;
 
-    return (ext_found && (ext_length > 1)) ? Path(_path.substr(ext_begin, ext_length)) : Path();
+    return (ext_found && (ext_length > 1)) ? std::string_view(_path).substr(ext_begin, ext_length) : std::string_view();
 }
 
 Path Path::absolute() const
@@ -422,6 +432,16 @@ Path Path::validate(char placeholder) const
 
 FileType Path::type() const
 {
+    std::error_code ec;
+    FileType result = TryStatus(ec);
+    if (ec)
+        throwex FileSystemException("Cannot get the status of the path!", ec.value()).Attach(*this);
+    return result;
+}
+
+FileType Path::TryStatus(std::error_code& ec) const noexcept
+{
+    ec.clear();
 #if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
     // Special check for symlink
     struct stat lstatus;
@@ -435,8 +455,9 @@ FileType Path::type() const
     {
         if ((errno == ENOENT) || (errno == ENOTDIR))
             return FileType::NONE;
-        else
-            throwex FileSystemException("Cannot get the status of the path!").Attach(*this);
+
+        ec.assign(errno, std::system_category());
+        return FileType::NONE;
     }
 
     if (S_ISLNK(status.st_mode))
@@ -734,19 +755,21 @@ bool Path::IsEquivalent(const Path& path) const
 #endif
 }
 
-Path& Path::Append(const Path& path)
+Path& Path::Append(std::string_view path)
 {
     if (_path.empty())
-        _path = path._path;
+        _path.assign(path);
     else
     {
         char last = _path[_path.size() - 1];
         if ((last == '\\') || (last == '/'))
-            _path += path._path;
+            _path.append(path);
         else
         {
+            // Grow the path storage once for the separator and the appended path
+            _path.reserve(_path.size() + 1 + path.size());
             _path += separator();
-            _path += path._path;
+            _path.append(path);
         }
     }
 
@@ -1014,8 +1037,140 @@ Path Path::unique()
     return Path(UUID::Random().string());
 }
 
-Path Path::Copy(const Path& src, const Path& dst, bool overwrite)
+//! @cond INTERNALS
+namespace Internals {
+
+// Filter of directory entry names (empty filter matches all entries)
+typedef std::function<bool (const std::string& name)> NameFilter;
+
+// Copy the content of the regular file and return the count of copied bytes
+uint64_t CopyContent(const Path& src, const Path& dst)
+{
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+    // Open the source file for reading
+    int source = open(src.string().c_str(), O_RDONLY, 0);
+    if (source < 0)
+        throwex FileSystemException("Cannot open source file for copy!").Attach(src);
+
+    // Get the source file status
+    struct stat status;
+    int result = fstat(source, &status);
+    if (result != 0)
+    {
+        close(source);
+        throwex FileSystemException("Cannot get the source file status for copy!").Attach(src);
+    }
+
+    // Open the destination file for writing
+    int destination = open(dst.string().c_str(), O_CREAT | O_WRONLY | O_TRUNC, status.st_mode);
+    if (destination < 0)
+    {
+        close(source);
+        throwex FileSystemException("Cannot open destination file for copy!").Attach(dst);
+    }
+
+    uint64_t tot = (uint64_t)status.st_size;
+
+#if defined(linux) || defined(__linux) || defined(__linux__)
+    bool copied = false;
+
+#if defined(FICLONE)
+    // Share the source file extents with the destination file (reflink of Btrfs, XFS, etc)
+    if ((tot > 0) && (ioctl(destination, FICLONE, source) == 0))
+        copied = true;
+#endif
+
+    // Copy data inside the kernel with copy_file_range() (server-side copy of network filesystems)
+    // and fallback to sendfile() if the filesystem or the kernel does not support it
+    bool range = true;
+    off_t offset = 0;
+    uint64_t cur = 0;
+    while (!copied && (cur < tot))
+    {
+        ssize_t sent;
+        if (range)
+        {
+            sent = copy_file_range(source, &offset, destination, nullptr, (size_t)(tot - cur), 0);
+            if ((sent < 0) && ((errno == ENOSYS) || (errno == EXDEV) || (errno == EINVAL) || (errno == EOPNOTSUPP)))
+            {
+                range = false;
+                continue;
+            }
+        }
+        else
+            sent = sendfile(destination, source, &offset, (size_t)(tot - cur));
+
+        if (sent <= 0)
+        {
+            if ((sent < 0) && ((errno == EINTR) || (errno == EAGAIN)))
+            {
+                // Interrupted system call/try again
+                // Just skip to the top of the loop and try again
+                continue;
+            }
+
+            close(source);
+            close(destination);
+            throwex FileSystemException("Cannot send the source file to the destination file!").Attach(src, dst);
+        }
+        cur += sent;
+    }
+#elif defined(__APPLE__)
+    // Copy data with the system copy engine
+    if (fcopyfile(source, destination, nullptr, COPYFILE_DATA) != 0)
+    {
+        close(source);
+        close(destination);
+        throwex FileSystemException("Cannot copy the source file to the destination file!").Attach(src, dst);
+    }
+#else
+    char buffer[BUFSIZ];
+    ssize_t size;
+
+    do
+    {
+        size = read(source, buffer, countof(buffer));
+        if (size < 0)
+        {
+            close(source);
+            close(destination);
+            throwex FileSystemException("Cannot read from the file!").Attach(src);
+        }
+        size = write(destination, buffer, size);
+        if (size < 0)
+        {
+            close(source);
+            close(destination);
+            throwex FileSystemException("Cannot write into the file!").Attach(dst);
+        }
+    } while (size > 0);
+#endif
+
+    // Close files
+    close(source);
+    close(destination);
+
+    return tot;
+#elif defined(_WIN32) || defined(_WIN64)
+    std::wstring wsrc = src.wstring();
+
+    WIN32_FILE_ATTRIBUTE_DATA data;
+    if (!GetFileAttributesExW(wsrc.c_str(), GetFileExInfoStandard, &data))
+        throwex FileSystemException("Cannot get the source file status for copy!").Attach(src);
+
+    // CopyFileEx() uses copy offload and block cloning if the filesystem supports them
+    if (!CopyFileExW(wsrc.c_str(), dst.wstring().c_str(), nullptr, nullptr, nullptr, 0))
+        throwex FileSystemException("Cannot copy the file!").Attach(src, dst);
+
+    return ((uint64_t)data.nFileSizeHigh << 32) | data.nFileSizeLow;
+#endif
+}
+
+// Copy the given path and return the count of copied bytes
+Path CopyPath(const Path& src, const Path& dst, bool overwrite, uint64_t& size)
 {
+    size = 0;
+
     // Check if the destination path exists
     bool exists = dst.IsExists();
     if (exists && !overwrite)
@@ -1035,90 +1190,120 @@ Path Path::Copy(const Path& src, const Path& dst, bool overwrite)
     }
     else
     {
-#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
-        // Open the source file for reading
-        int source = open(src.string().c_str(), O_RDONLY, 0);
-        if (source < 0)
-            throwex FileSystemException("Cannot open source file for copy!").Attach(src);
-
-        // Get the source file status
-        struct stat status;
-        int result = fstat(source, &status);
-        if (result != 0)
-        {
-            close(source);
-            throwex FileSystemException("Cannot get the source file status for copy!").Attach(src);
-        }
+        size = CopyContent(src, dst);
+        return dst;
+    }
+}
 
-        // Open the destination file for writing
-        int destination = open(dst.string().c_str(), O_CREAT | O_WRONLY | O_TRUNC, status.st_mode);
-        if (destination < 0)
-        {
-            close(source);
-            throwex FileSystemException("Cannot open destination file for copy!").Attach(dst);
-        }
+// Copy the directory tree with the given count of threads
+class CopyState
+{
+public:
+    CopyState(const Path& src, const Path& dst, const NameFilter& filter, bool overwrite, size_t threads, const Path::CopyHandler& progress)
+        : _src(src), _dst(dst), _prefix(src.string().size()), _filter(filter), _overwrite(overwrite), _progress(progress), _stop(false)
+    {
+        if (threads != 1)
+            _pool = std::make_unique<ThreadPool>((threads > 0) ? threads : (size_t)CPU::LogicalCores());
+    }
 
-#if defined(linux) || defined(__linux) || defined(__linux__)
-        // Transfer data between source and destination file descriptors
-        off_t offset = 0;
-        size_t cur = 0;
-        size_t tot = status.st_size;
-        while (cur < tot)
+    void Run()
+    {
+        try
         {
-            ssize_t sent;
-            if ((sent = sendfile(destination, source, &offset, tot - cur)) <= 0)
+            // Directories are created while they are entered, so their content is never copied before them
+            auto enter = [this](const Path& path, FileType type)
             {
-                if ((errno == EINTR) || (errno == EAGAIN))
+                if (_stop.load(std::memory_order_relaxed))
+                    return false;
+
+                std::string relative = path.string().substr(_prefix);
+                relative.erase(0, relative.find_first_not_of("\\/"));
+
+                // Pattern is matched only with entries of the source directory
+                if (_filter && (relative.find_first_of("\\/") == std::string::npos) && !_filter(path.filename().string()))
+                    return false;
+
+                Path target = _dst / relative;
+
+                if (type == FileType::DIRECTORY)
                 {
-                    // Interrupted system call/try again
-                    // Just skip to the top of the loop and try again
-                    continue;
+                    if (!target.IsExists() || !target.IsDirectory())
+                        Directory::Create(target, path.attributes(), path.permissions());
+                    if (_progress)
+                        _progress(path, target, 0);
                 }
+                else if (_pool)
+                    _pool->Submit([this, path, target]() { Copy(path, target); });
+                else
+                    Copy(path, target);
+                return true;
+            };
 
-                close(source);
-                close(destination);
-                throwex FileSystemException("Cannot send the source file to the destination file!").Attach(src, dst);
-            }
-            cur += sent;
-        }
-#else
-        char buffer[BUFSIZ];
-        int size;
-
-        do
-        {
-            size = read(source, buffer, countof(buffer));
-            if (size < 0)
+            if (_pool)
             {
-                close(source);
-                close(destination);
-                throwex FileSystemException("Cannot read from the file!").Attach(src);
+                DirectoryWalker walker(*_pool);
+                walker.Walk(_src, enter);
             }
-            size = write(destination, buffer, size);
-            if (size < 0)
+            else
             {
-                close(source);
-                close(destination);
-                throwex FileSystemException("Cannot write into the file!").Attach(dst);
+                DirectoryWalker walker(1);
+                walker.Walk(_src, enter);
             }
-        } while (size > 0);
-#endif
+        }
+        catch (...)
+        {
+            Fail(std::current_exception());
+        }
 
-        // Close files
-        close(source);
-        close(destination);
-#elif defined(_WIN32) || defined(_WIN64)
-        if (!CopyFileW(src.wstring().c_str(), dst.wstring().c_str(), FALSE))
-            throwex FileSystemException("Cannot copy the file!").Attach(src, dst);
-#endif
-        return dst;
+        // Wait for all submitted copy tasks
+        _pool.reset();
+
+        if (_error)
+            std::rethrow_exception(_error);
     }
-}
 
-Path Path::CopyIf(const Path& src, const Path& dst, const std::string& pattern, bool overwrite)
-{
-    std::regex matcher(pattern);
+private:
+    Path _src;
+    Path _dst;
+    size_t _prefix;
+    const NameFilter& _filter;
+    bool _overwrite;
+    const Path::CopyHandler& _progress;
+    std::unique_ptr<ThreadPool> _pool;
+    std::atomic<bool> _stop;
+    CriticalSection _cs;
+    std::exception_ptr _error;
+
+    void Copy(const Path& src, const Path& dst)
+    {
+        if (_stop.load(std::memory_order_relaxed))
+            return;
+
+        try
+        {
+            uint64_t size;
+            Path copied = CopyPath(src, dst, _overwrite, size);
+            if (_progress && !copied.empty())
+                _progress(src, dst, size);
+        }
+        catch (...)
+        {
+            Fail(std::current_exception());
+        }
+    }
+
+    void Fail(std::exception_ptr error)
+    {
+        Locker<CriticalSection> locker(_cs);
+        if (!_error)
+            _error = error;
+        _stop.store(true, std::memory_order_relaxed);
+    }
+};
 
+// Copy the path with all directory entries matched to the given filter
+Path CopyIf(const Path& src, const Path& dst, const NameFilter& filter, bool overwrite, size_t threads, const Path::CopyHandler& progress)
+{
     // Check if the destination path exists
     bool exists = dst.IsExists();
     if (exists && !overwrite)
@@ -1127,8 +1312,14 @@ Path Path::CopyIf(const Path& src, const Path& dst, const std::string& pattern,
     // Copy symbolic link or regular file
     if (src.IsSymlink() || !src.IsDirectory())
     {
-        if (pattern.empty() || std::regex_match(src.filename().string(), matcher))
-            return Copy(src, dst, overwrite);
+        if (!filter || filter(src.filename().string()))
+        {
+            uint64_t size;
+            Path copied = CopyPath(src, dst, overwrite, size);
+            if (progress && !copied.empty())
+                progress(src, dst, size);
+            return copied;
+        }
         else
             return Path();
     }
@@ -1137,60 +1328,74 @@ Path Path::CopyIf(const Path& src, const Path& dst, const std::string& pattern,
     if (!dst.IsExists() || !dst.IsDirectory())
         Directory::Create(dst, src.attributes(), src.permissions());
 
-    // Copy all directory entries
-    Directory directory(src);
-    for (auto it = directory.begin(); it != directory.end(); ++it)
-    {
-        if (pattern.empty() || std::regex_match(it->filename().string(), matcher))
-        {
-            // Copy symbolic link or regular file
-            if (it->IsSymlink() || !it->IsDirectory())
-                Copy(src / it->filename(), dst / it->filename(), overwrite);
-            else
-                CopyAll(src / it->filename(), dst / it->filename(), overwrite);
-        }
-    }
+    // Copy all matched directory entries into the same places of the destination tree
+    CopyState state(src, dst, filter, overwrite, threads, progress);
+    state.Run();
     return dst;
 }
 
-Path Path::CopyAll(const Path& src, const Path& dst, bool overwrite)
+// Remove the path or all its directory entries matched to the given filter
+Path RemoveIf(const Path& path, const NameFilter& filter)
 {
-    // Check if the destination path exists
-    bool exists = dst.IsExists();
-    if (exists && !overwrite)
+    bool is_directory = false;
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+    if (path.IsDirectory())
+        is_directory = true;
+#elif defined(_WIN32) || defined(_WIN64)
+    std::wstring wpath = path.wstring();
+    DWORD attributes = GetFileAttributesW(wpath.c_str());
+    if (attributes == INVALID_FILE_ATTRIBUTES)
+        throwex FileSystemException("Cannot get file attributes of the removed path!").Attach(path);
+
+    if (attributes & FILE_ATTRIBUTE_DIRECTORY)
+        is_directory = true;
+#endif
+    if (is_directory)
+    {
+        // Remove all directory entries
+        Directory directory(path);
+        for (auto it = directory.begin(); it != directory.end(); ++it)
+            if (!filter || filter(it->filename().string()))
+                Path::Remove(*it);
+        return path;
+    }
+
+    // Remove the path
+    if (!filter || filter(path.filename().string()))
+        return Path::Remove(path);
+    else
         return Path();
+}
 
-    // Copy symbolic link or regular file
-    if (src.IsSymlink() || !src.IsDirectory())
-        return Copy(src, dst, overwrite);
+} // namespace Internals
+//! @endcond
 
-    // Add directory to copy stack
-    std::stack<std::tuple<Path, Path>> dirs;
-    dirs.push(std::make_tuple(src, dst));
+Path Path::Copy(const Path& src, const Path& dst, bool overwrite)
+{
+    uint64_t size;
+    return Internals::CopyPath(src, dst, overwrite, size);
+}
 
-    // Do we have anything to copy in stack?
-    while (!dirs.empty())
-    {
-        // Get the top directory
-        std::tuple<Path, Path> current = dirs.top();
-        Directory srcdir(std::get<0>(current));
-        Directory dstdir(std::get<1>(current));
-        dirs.pop();
+Path Path::CopyIf(const Path& src, const Path& dst, const std::string& pattern, bool overwrite, size_t threads, const CopyHandler& progress)
+{
+    if (pattern.empty())
+        return Internals::CopyIf(src, dst, nullptr, overwrite, threads, progress);
 
-        // Create destination directory
-        Directory::Create(dstdir, srcdir.attributes(), srcdir.permissions());
+    std::regex matcher(pattern);
+    return Internals::CopyIf(src, dst, [&matcher](const std::string& name) { return std::regex_match(name, matcher); }, overwrite, threads, progress);
+}
 
-        // Copy all directory entries
-        for (auto it = srcdir.begin(); it != srcdir.end(); ++it)
-        {
-            // Copy symbolic link or regular file
-            if (it->IsSymlink() || !it->IsDirectory())
-                Copy(srcdir / it->filename(), dstdir / it->filename(), overwrite);
-            else
-                dirs.push(std::make_tuple(srcdir / it->filename(), dstdir / it->filename()));
-        }
-    }
-    return dst;
+Path Path::CopyIf(const Path& src, const Path& dst, const GlobPattern& pattern, bool overwrite, size_t threads, const CopyHandler& progress)
+{
+    if (pattern.empty())
+        return Internals::CopyIf(src, dst, nullptr, overwrite, threads, progress);
+
+    return Internals::CopyIf(src, dst, [&pattern](const std::string& name) { return pattern.Match(name); }, overwrite, threads, progress);
+}
+
+Path Path::CopyAll(const Path& src, const Path& dst, bool overwrite, size_t threads, const CopyHandler& progress)
+{
+    return CopyIf(src, dst, "", overwrite, threads, progress);
 }
 
 Path Path::Rename(const Path& src, const Path& dst)
@@ -1209,7 +1414,8 @@ Path Path::Rename(const Path& src, const Path& dst)
 Path Path::Remove(const Path& path)
 {
 #if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
-    if (path.IsDirectory())
+    // Symbolic link to the directory is unlinked as a file
+    if (path.IsDirectory() && !path.IsSymlink())
     {
         int result = rmdir(path.string().c_str());
         if (result != 0)
@@ -1247,43 +1453,26 @@ Path Path::Remove(const Path& path)
 
 Path Path::RemoveIf(const Path& path, const std::string& pattern)
 {
-    std::regex matcher(pattern);
+    if (pattern.empty())
+        return Internals::RemoveIf(path, nullptr);
 
-    bool is_directory = false;
-#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
-    if (path.IsDirectory())
-        is_directory = true;
-#elif defined(_WIN32) || defined(_WIN64)
-    std::wstring wpath = path.wstring();
-    DWORD attributes = GetFileAttributesW(wpath.c_str());
-    if (attributes == INVALID_FILE_ATTRIBUTES)
-        throwex FileSystemException("Cannot get file attributes of the removed path!").Attach(path);
+    std::regex matcher(pattern);
+    return Internals::RemoveIf(path, [&matcher](const std::string& name) { return std::regex_match(name, matcher); });
+}
 
-    if (attributes & FILE_ATTRIBUTE_DIRECTORY)
-        is_directory = true;
-#endif
-    if (is_directory)
-    {
-        // Remove all directory entries
-        Directory directory(path);
-        for (auto it = directory.begin(); it != directory.end(); ++it)
-            if (pattern.empty() || std::regex_match(it->filename().string(), matcher))
-                Remove(*it);
-        return path;
-    }
+Path Path::RemoveIf(const Path& path, const GlobPattern& pattern)
+{
+    if (pattern.empty())
+        return Internals::RemoveIf(path, nullptr);
 
-    // Remove the path
-    if (pattern.empty() || std::regex_match(path.filename().string(), matcher))
-        return Remove(path);
-    else
-        return Path();
+    return Internals::RemoveIf(path, [&pattern](const std::string& name) { return pattern.Match(name); });
 }
 
-Path Path::RemoveAll(const Path& path)
+Path Path::RemoveAll(const Path& path, size_t threads)
 {
     bool is_directory = false;
 #if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
-    if (path.IsDirectory())
+    if (path.IsDirectory() && !path.IsSymlink())
         is_directory = true;
 #elif defined(_WIN32) || defined(_WIN64)
     std::wstring wpath = path.wstring();
@@ -1291,15 +1480,23 @@ Path Path::RemoveAll(const Path& path)
     if (attributes == INVALID_FILE_ATTRIBUTES)
         throwex FileSystemException("Cannot get file attributes of the removed path!").Attach(path);
 
-    if (attributes & FILE_ATTRIBUTE_DIRECTORY)
+    if ((attributes & FILE_ATTRIBUTE_DIRECTORY) && !(attributes & FILE_ATTRIBUTE_REPARSE_POINT))
         is_directory = true;
 #endif
     if (is_directory)
     {
-        // Recursively remove all directory entries
-        Directory directory(path);
-        for (auto it = directory.rbegin(); it != directory.rend(); ++it)
-            Remove(*it);
+        // Recursively remove all directory entries and then directories themselves
+        DirectoryWalker walker(threads);
+        walker.Walk(path, [](const Path& entry, FileType type)
+        {
+            if (type != FileType::DIRECTORY)
+                Remove(entry);
+            return true;
+        },
+        [](const Path& directory)
+        {
+            Remove(directory);
+        });
     }
 
     // Remove the path
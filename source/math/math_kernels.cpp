@@ -0,0 +1,588 @@
+/*!
+    \file math_kernels.cpp
+    \brief Math numeric kernels implementation
+    \author Ivan Shynkarenka
+    \date 15.10.2026
+    \copyright MIT License
+*/
+
+#include "math/math.h"
+
+#include "system/cpu.h"
+
+#include <algorithm>
+#include <cassert>
+#include <limits>
+
+#if defined(_MSC_VER) && defined(_M_X64)
+#include <immintrin.h>
+#define CPPCOMMON_MATH_AVX2
+#define CPPCOMMON_MATH_AVX2_TARGET
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__amd64__))
+#include <immintrin.h>
+#define CPPCOMMON_MATH_AVX2
+#define CPPCOMMON_MATH_AVX2_TARGET __attribute__((target("avx2")))
+#endif
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+namespace Internals {
+
+// Values are accumulated in lanes by their index modulo MATH_LANES
+const size_t MATH_LANES = 8;
+
+// Floating point lanes of the accumulation
+struct MathLanes
+{
+    double sum[MATH_LANES];
+    double compensation[MATH_LANES];
+};
+
+template <bool kahan>
+inline void MathAdd(double& sum, double& compensation, double value) noexcept
+{
+    if constexpr (kahan)
+    {
+        double y = value - compensation;
+        double t = sum + y;
+        compensation = (t - sum) - y;
+        sum = t;
+    }
+    else
+        sum += value;
+}
+
+// Reduce lanes in the fixed order
+template <bool kahan>
+inline double MathReduce(const MathLanes& lanes) noexcept
+{
+    if constexpr (kahan)
+    {
+        double sum = 0.0;
+        double compensation = 0.0;
+        for (size_t i = 0; i < MATH_LANES; ++i)
+            MathAdd<true>(sum, compensation, lanes.sum[i]);
+        for (size_t i = 0; i < MATH_LANES; ++i)
+            MathAdd<true>(sum, compensation, -lanes.compensation[i]);
+        return sum;
+    }
+    else
+    {
+        const double* s = lanes.sum;
+        return ((s[0] + s[1]) + (s[2] + s[3])) + ((s[4] + s[5]) + (s[6] + s[7]));
+    }
+}
+
+// Accumulate values (or their squared deviations from the given mean) starting from the given index
+template <bool kahan, bool square, typename T>
+inline void MathAccumulate(MathLanes& lanes, const T* values, size_t index, size_t size, double mean) noexcept
+{
+    for (size_t i = index; i < size; ++i)
+    {
+        double value = (double)values[i];
+        if constexpr (square)
+            value = (value - mean) * (value - mean);
+        MathAdd<kahan>(lanes.sum[i % MATH_LANES], lanes.compensation[i % MATH_LANES], value);
+    }
+}
+
+template <bool kahan, bool square>
+double AccumulateScalar(const double* values, size_t size, double mean) noexcept
+{
+    MathLanes lanes = {};
+    MathAccumulate<kahan, square>(lanes, values, 0, size, mean);
+    return MathReduce<kahan>(lanes);
+}
+
+// Welford lanes of the accumulation
+struct MathWelford
+{
+    double count[MATH_LANES];
+    double mean[MATH_LANES];
+    double m2[MATH_LANES];
+};
+
+template <typename T>
+inline void MathWelfordAccumulate(MathWelford& lanes, const T* values, size_t index, size_t size) noexcept
+{
+    for (size_t i = index; i < size; ++i)
+    {
+        size_t lane = i % MATH_LANES;
+        double value = (double)values[i];
+        lanes.count[lane] += 1.0;
+        double delta = value - lanes.mean[lane];
+        lanes.mean[lane] += delta / lanes.count[lane];
+        lanes.m2[lane] += delta * (value - lanes.mean[lane]);
+    }
+}
+
+// Merge Welford lanes in the fixed order (Chan parallel algorithm)
+inline MathMoments MathWelfordReduce(const MathWelford& lanes, size_t size) noexcept
+{
+    double count = 0.0;
+    double mean = 0.0;
+    double m2 = 0.0;
+    for (size_t i = 0; i < MATH_LANES; ++i)
+    {
+        if (lanes.count[i] == 0.0)
+            continue;
+        double total = count + lanes.count[i];
+        double delta = lanes.mean[i] - mean;
+        mean += delta * lanes.count[i] / total;
+        m2 += lanes.m2[i] + delta * delta * count * lanes.count[i] / total;
+        count = total;
+    }
+
+    MathMoments result;
+    result.count = size;
+    result.mean = mean;
+    result.variance = (size > 0) ? (m2 / (double)size) : 0.0;
+    return result;
+}
+
+MathMoments WelfordScalar(const double* values, size_t size) noexcept
+{
+    MathWelford lanes = {};
+    MathWelfordAccumulate(lanes, values, 0, size);
+    return MathWelfordReduce(lanes, size);
+}
+
+double DotScalar(const double* a, const double* b, size_t size) noexcept
+{
+    MathLanes lanes = {};
+    for (size_t i = 0; i < size; ++i)
+        lanes.sum[i % MATH_LANES] += a[i] * b[i];
+    return MathReduce<false>(lanes);
+}
+
+void MinMaxScalar(const double* values, size_t size, double& min, double& max) noexcept
+{
+    for (size_t i = 0; i < size; ++i)
+    {
+        min = std::min(min, values[i]);
+        max = std::max(max, values[i]);
+    }
+}
+
+int64_t SumInt64Scalar(const int64_t* values, size_t size) noexcept
+{
+    uint64_t sum = 0;
+    for (size_t i = 0; i < size; ++i)
+        sum += (uint64_t)values[i];
+    return (int64_t)sum;
+}
+
+int64_t DotInt64Scalar(const int64_t* a, const int64_t* b, size_t size) noexcept
+{
+    uint64_t sum = 0;
+    for (size_t i = 0; i < size; ++i)
+        sum += (uint64_t)a[i] * (uint64_t)b[i];
+    return (int64_t)sum;
+}
+
+void MinMaxInt64Scalar(const int64_t* values, size_t size, int64_t& min, int64_t& max) noexcept
+{
+    for (size_t i = 0; i < size; ++i)
+    {
+        min = std::min(min, values[i]);
+        max = std::max(max, values[i]);
+    }
+}
+
+#if defined(CPPCOMMON_MATH_AVX2)
+
+template <bool kahan>
+CPPCOMMON_MATH_AVX2_TARGET
+inline void MathAddAVX2(__m256d& sum, __m256d& compensation, __m256d value) noexcept
+{
+    if constexpr (kahan)
+    {
+        __m256d y = _mm256_sub_pd(value, compensation);
+        __m256d t = _mm256_add_pd(sum, y);
+        compensation = _mm256_sub_pd(_mm256_sub_pd(t, sum), y);
+        sum = t;
+    }
+    else
+        sum = _mm256_add_pd(sum, value);
+}
+
+template <bool kahan, bool square>
+CPPCOMMON_MATH_AVX2_TARGET
+double AccumulateAVX2(const double* values, size_t size, double mean) noexcept
+{
+    const __m256d m = _mm256_set1_pd(mean);
+    __m256d s0 = _mm256_setzero_pd();
+    __m256d s1 = _mm256_setzero_pd();
+    __m256d c0 = _mm256_setzero_pd();
+    __m256d c1 = _mm256_setzero_pd();
+
+    size_t i = 0;
+    for (; (i + MATH_LANES) <= size; i += MATH_LANES)
+    {
+        __m256d v0 = _mm256_loadu_pd(values + i);
+        __m256d v1 = _mm256_loadu_pd(values + i + 4);
+        if constexpr (square)
+        {
+            v0 = _mm256_sub_pd(v0, m);
+            v1 = _mm256_sub_pd(v1, m);
+            v0 = _mm256_mul_pd(v0, v0);
+            v1 = _mm256_mul_pd(v1, v1);
+        }
+        MathAddAVX2<kahan>(s0, c0, v0);
+        MathAddAVX2<kahan>(s1, c1, v1);
+    }
+
+    MathLanes lanes;
+    _mm256_storeu_pd(lanes.sum, s0);
+    _mm256_storeu_pd(lanes.sum + 4, s1);
+    _mm256_storeu_pd(lanes.compensation, c0);
+    _mm256_storeu_pd(lanes.compensation + 4, c1);
+    MathAccumulate<kahan, square>(lanes, values, i, size, mean);
+    return MathReduce<kahan>(lanes);
+}
+
+CPPCOMMON_MATH_AVX2_TARGET
+MathMoments WelfordAVX2(const double* values, size_t size) noexcept
+{
+    __m256d m0 = _mm256_setzero_pd();
+    __m256d m1 = _mm256_setzero_pd();
+    __m256d q0 = _mm256_setzero_pd();
+    __m256d q1 = _mm256_setzero_pd();
+
+    size_t i = 0;
+    double count = 0.0;
+    for (; (i + MATH_LANES) <= size; i += MATH_LANES)
+    {
+        count += 1.0;
+        const __m256d n = _mm256_set1_pd(count);
+        __m256d v0 = _mm256_loadu_pd(values + i);
+        __m256d v1 = _mm256_loadu_pd(values + i + 4);
+        __m256d d0 = _mm256_sub_pd(v0, m0);
+        __m256d d1 = _mm256_sub_pd(v1, m1);
+        m0 = _mm256_add_pd(m0, _mm256_div_pd(d0, n));
+        m1 = _mm256_add_pd(m1, _mm256_div_pd(d1, n));
+        q0 = _mm256_add_pd(q0, _mm256_mul_pd(d0, _mm256_sub_pd(v0, m0)));
+        q1 = _mm256_add_pd(q1, _mm256_mul_pd(d1, _mm256_sub_pd(v1, m1)));
+    }
+
+    MathWelford lanes;
+    std::fill(lanes.count, lanes.count + MATH_LANES, count);
+    _mm256_storeu_pd(lanes.mean, m0);
+    _mm256_storeu_pd(lanes.mean + 4, m1);
+    _mm256_storeu_pd(lanes.m2, q0);
+    _mm256_storeu_pd(lanes.m2 + 4, q1);
+    MathWelfordAccumulate(lanes, values, i, size);
+    return MathWelfordReduce(lanes, size);
+}
+
+CPPCOMMON_MATH_AVX2_TARGET
+double DotAVX2(const double* a, const double* b, size_t size) noexcept
+{
+    __m256d s0 = _mm256_setzero_pd();
+    __m256d s1 = _mm256_setzero_pd();
+
+    size_t i = 0;
+    for (; (i + MATH_LANES) <= size; i += MATH_LANES)
+    {
+        s0 = _mm256_add_pd(s0, _mm256_mul_pd(_mm256_loadu_pd(a + i), _mm256_loadu_pd(b + i)));
+        s1 = _mm256_add_pd(s1, _mm256_mul_pd(_mm256_loadu_pd(a + i + 4), _mm256_loadu_pd(b + i + 4)));
+    }
+
+    MathLanes lanes;
+    _mm256_storeu_pd(lanes.sum, s0);
+    _mm256_storeu_pd(lanes.sum + 4, s1);
+    for (; i < size; ++i)
+        lanes.sum[i % MATH_LANES] += a[i] * b[i];
+    return MathReduce<false>(lanes);
+}
+
+CPPCOMMON_MATH_AVX2_TARGET
+void MinMaxAVX2(const double* values, size_t size, double& min, double& max) noexcept
+{
+    size_t i = 0;
+    if (size >= MATH_LANES)
+    {
+        __m256d min0 = _mm256_set1_pd(min);
+        __m256d min1 = min0;
+        __m256d max0 = _mm256_set1_pd(max);
+        __m256d max1 = max0;
+        for (; (i + MATH_LANES) <= size; i += MATH_LANES)
+        {
+            __m256d v0 = _mm256_loadu_pd(values + i);
+            __m256d v1 = _mm256_loadu_pd(values + i + 4);
+            min0 = _mm256_min_pd(min0, v0);
+            min1 = _mm256_min_pd(min1, v1);
+            max0 = _mm256_max_pd(max0, v0);
+            max1 = _mm256_max_pd(max1, v1);
+        }
+
+        alignas(32) double lanes[4];
+        _mm256_store_pd(lanes, _mm256_min_pd(min0, min1));
+        min = std::min(std::min(lanes[0], lanes[1]), std::min(lanes[2], lanes[3]));
+        _mm256_store_pd(lanes, _mm256_max_pd(max0, max1));
+        max = std::max(std::max(lanes[0], lanes[1]), std::max(lanes[2], lanes[3]));
+    }
+    MinMaxScalar(values + i, size - i, min, max);
+}
+
+CPPCOMMON_MATH_AVX2_TARGET
+int64_t SumInt64AVX2(const int64_t* values, size_t size) noexcept
+{
+    __m256i s0 = _mm256_setzero_si256();
+    __m256i s1 = _mm256_setzero_si256();
+
+    size_t i = 0;
+    for (; (i + MATH_LANES) <= size; i += MATH_LANES)
+    {
+        s0 = _mm256_add_epi64(s0, _mm256_loadu_si256((const __m256i*)(values + i)));
+        s1 = _mm256_add_epi64(s1, _mm256_loadu_si256((const __m256i*)(values + i + 4)));
+    }
+
+    alignas(32) int64_t lanes[4];
+    _mm256_store_si256((__m256i*)lanes, _mm256_add_epi64(s0, s1));
+    uint64_t sum = (uint64_t)lanes[0] + (uint64_t)lanes[1] + (uint64_t)lanes[2] + (uint64_t)lanes[3];
+    return (int64_t)(sum + (uint64_t)SumInt64Scalar(values + i, size - i));
+}
+
+// Multiply 64-bit integers modulo 2^64 with 32-bit multiplications
+CPPCOMMON_MATH_AVX2_TARGET
+inline __m256i MathMulInt64AVX2(__m256i a, __m256i b) noexcept
+{
+    __m256i low = _mm256_mul_epu32(a, b);
+    __m256i cross1 = _mm256_mul_epu32(_mm256_srli_epi64(a, 32), b);
+    __m256i cross2 = _mm256_mul_epu32(a, _mm256_srli_epi64(b, 32));
+    return _mm256_add_epi64(low, _mm256_slli_epi64(_mm256_add_epi64(cross1, cross2), 32));
+}
+
+CPPCOMMON_MATH_AVX2_TARGET
+int64_t DotInt64AVX2(const int64_t* a, const int64_t* b, size_t size) noexcept
+{
+    __m256i s0 = _mm256_setzero_si256();
+    __m256i s1 = _mm256_setzero_si256();
+
+    size_t i = 0;
+    for (; (i + MATH_LANES) <= size; i += MATH_LANES)
+    {
+        __m256i a0 = _mm256_loadu_si256((const __m256i*)(a + i));
+        __m256i a1 = _mm256_loadu_si256((const __m256i*)(a + i + 4));
+        __m256i b0 = _mm256_loadu_si256((const __m256i*)(b + i));
+        __m256i b1 = _mm256_loadu_si256((const __m256i*)(b + i + 4));
+        s0 = _mm256_add_epi64(s0, MathMulInt64AVX2(a0, b0));
+        s1 = _mm256_add_epi64(s1, MathMulInt64AVX2(a1, b1));
+    }
+
+    alignas(32) int64_t lanes[4];
+    _mm256_store_si256((__m256i*)lanes, _mm256_add_epi64(s0, s1));
+    uint64_t sum = (uint64_t)lanes[0] + (uint64_t)lanes[1] + (uint64_t)lanes[2] + (uint64_t)lanes[3];
+    return (int64_t)(sum + (uint64_t)DotInt64Scalar(a + i, b + i, size - i));
+}
+
+CPPCOMMON_MATH_AVX2_TARGET
+void MinMaxInt64AVX2(const int64_t* values, size_t size, int64_t& min, int64_t& max) noexcept
+{
+    size_t i = 0;
+    if (size >= MATH_LANES)
+    {
+        __m256i min0 = _mm256_set1_epi64x(min);
+        __m256i min1 = min0;
+        __m256i max0 = _mm256_set1_epi64x(max);
+        __m256i max1 = max0;
+        for (; (i + MATH_LANES) <= size; i += MATH_LANES)
+        {
+            __m256i v0 = _mm256_loadu_si256((const __m256i*)(values + i));
+            __m256i v1 = _mm256_loadu_si256((const __m256i*)(values + i + 4));
+            min0 = _mm256_blendv_epi8(min0, v0, _mm256_cmpgt_epi64(min0, v0));
+            min1 = _mm256_blendv_epi8(min1, v1, _mm256_cmpgt_epi64(min1, v1));
+            max0 = _mm256_blendv_epi8(max0, v0, _mm256_cmpgt_epi64(v0, max0));
+            max1 = _mm256_blendv_epi8(max1, v1, _mm256_cmpgt_epi64(v1, max1));
+        }
+
+        alignas(32) int64_t lanes[8];
+        _mm256_store_si256((__m256i*)lanes, min0);
+        _mm256_store_si256((__m256i*)(lanes + 4), min1);
+        min = *std::min_element(lanes, lanes + 8);
+        _mm256_store_si256((__m256i*)lanes, max0);
+        _mm256_store_si256((__m256i*)(lanes + 4), max1);
+        max = *std::max_element(lanes, lanes + 8);
+    }
+    MinMaxInt64Scalar(values + i, size - i, min, max);
+}
+
+#endif
+
+template <bool kahan, bool square>
+double Accumulate(const double* values, size_t size, double mean) noexcept
+{
+#if defined(CPPCOMMON_MATH_AVX2)
+    static const CPUDispatch<double(const double*, size_t, double)> dispatch([]() { return CPU::HasAVX2() ? &AccumulateAVX2<kahan, square> : &AccumulateScalar<kahan, square>; });
+    return dispatch(values, size, mean);
+#else
+    return AccumulateScalar<kahan, square>(values, size, mean);
+#endif
+}
+
+double Dot(const double* a, const double* b, size_t size) noexcept
+{
+#if defined(CPPCOMMON_MATH_AVX2)
+    static const CPUDispatch<double(const double*, const double*, size_t)> dispatch([]() { return CPU::HasAVX2() ? DotAVX2 : DotScalar; });
+    return dispatch(a, b, size);
+#else
+    return DotScalar(a, b, size);
+#endif
+}
+
+int64_t DotInt64(const int64_t* a, const int64_t* b, size_t size) noexcept
+{
+#if defined(CPPCOMMON_MATH_AVX2)
+    static const CPUDispatch<int64_t(const int64_t*, const int64_t*, size_t)> dispatch([]() { return CPU::HasAVX2() ? DotInt64AVX2 : DotInt64Scalar; });
+    return dispatch(a, b, size);
+#else
+    return DotInt64Scalar(a, b, size);
+#endif
+}
+
+} // namespace Internals
+//! @endcond
+
+int64_t Math::Sum(std::span<const int64_t> values) noexcept
+{
+#if defined(CPPCOMMON_MATH_AVX2)
+    static const CPUDispatch<int64_t(const int64_t*, size_t)> dispatch([]() { return CPU::HasAVX2() ? Internals::SumInt64AVX2 : Internals::SumInt64Scalar; });
+    return dispatch(values.data(), values.size());
+#else
+    return Internals::SumInt64Scalar(values.data(), values.size());
+#endif
+}
+
+double Math::Sum(std::span<const double> values, MathAccumulation accumulation) noexcept
+{
+    if (accumulation == MathAccumulation::FAST)
+        return Internals::Accumulate<false, false>(values.data(), values.size(), 0.0);
+    else
+        return Internals::Accumulate<true, false>(values.data(), values.size(), 0.0);
+}
+
+std::pair<int64_t, int64_t> Math::MinMax(std::span<const int64_t> values) noexcept
+{
+    int64_t min = std::numeric_limits<int64_t>::max();
+    int64_t max = std::numeric_limits<int64_t>::lowest();
+#if defined(CPPCOMMON_MATH_AVX2)
+    static const CPUDispatch<void(const int64_t*, size_t, int64_t&, int64_t&)> dispatch([]() { return CPU::HasAVX2() ? Internals::MinMaxInt64AVX2 : Internals::MinMaxInt64Scalar; });
+    dispatch(values.data(), values.size(), min, max);
+#else
+    Internals::MinMaxInt64Scalar(values.data(), values.size(), min, max);
+#endif
+    return std::make_pair(min, max);
+}
+
+std::pair<double, double> Math::MinMax(std::span<const double> values) noexcept
+{
+    double min = std::numeric_limits<double>::max();
+    double max = std::numeric_limits<double>::lowest();
+#if defined(CPPCOMMON_MATH_AVX2)
+    static const CPUDispatch<void(const double*, size_t, double&, double&)> dispatch([]() { return CPU::HasAVX2() ? Internals::MinMaxAVX2 : Internals::MinMaxScalar; });
+    dispatch(values.data(), values.size(), min, max);
+#else
+    Internals::MinMaxScalar(values.data(), values.size(), min, max);
+#endif
+    return std::make_pair(min, max);
+}
+
+MathMoments Math::MeanVariance(std::span<const int64_t> values, MathAccumulation accumulation) noexcept
+{
+    using namespace Internals;
+
+    MathMoments result;
+    result.count = values.size();
+    if (values.empty())
+        return result;
+
+    result.mean = (double)Sum(values) / (double)values.size();
+
+    MathLanes lanes = {};
+    if (accumulation == MathAccumulation::FAST)
+    {
+        MathAccumulate<false, true>(lanes, values.data(), 0, values.size(), result.mean);
+        result.variance = MathReduce<false>(lanes) / (double)values.size();
+    }
+    else
+    {
+        MathAccumulate<true, true>(lanes, values.data(), 0, values.size(), result.mean);
+        result.variance = MathReduce<true>(lanes) / (double)values.size();
+    }
+    return result;
+}
+
+MathMoments Math::MeanVariance(std::span<const double> values, MathAccumulation accumulation) noexcept
+{
+    using namespace Internals;
+
+    if (accumulation == MathAccumulation::WELFORD)
+    {
+#if defined(CPPCOMMON_MATH_AVX2)
+        static const CPUDispatch<MathMoments(const double*, size_t)> dispatch([]() { return CPU::HasAVX2() ? WelfordAVX2 : WelfordScalar; });
+        return dispatch(values.data(), values.size());
+#else
+        return WelfordScalar(values.data(), values.size());
+#endif
+    }
+
+    MathMoments result;
+    result.count = values.size();
+    if (values.empty())
+        return result;
+
+    // Two passes: the mean and then squared deviations from it
+    if (accumulation == MathAccumulation::FAST)
+    {
+        result.mean = Accumulate<false, false>(values.data(), values.size(), 0.0) / (double)values.size();
+        result.variance = Accumulate<false, true>(values.data(), values.size(), result.mean) / (double)values.size();
+    }
+    else
+    {
+        result.mean = Accumulate<true, false>(values.data(), values.size(), 0.0) / (double)values.size();
+        result.variance = Accumulate<true, true>(values.data(), values.size(), result.mean) / (double)values.size();
+    }
+    return result;
+}
+
+int64_t Math::Dot(std::span<const int64_t> a, std::span<const int64_t> b) noexcept
+{
+    assert((a.size() == b.size()) && "Vectors must have the same size!");
+
+    return Internals::DotInt64(a.data(), b.data(), std::min(a.size(), b.size()));
+}
+
+double Math::Dot(std::span<const double> a, std::span<const double> b) noexcept
+{
+    assert((a.size() == b.size()) && "Vectors must have the same size!");
+
+    return Internals::Dot(a.data(), b.data(), std::min(a.size(), b.size()));
+}
+
+double Math::WeightedAverage(std::span<const int64_t> values, std::span<const int64_t> weights) noexcept
+{
+    assert((values.size() == weights.size()) && "Values and weights must have the same size!");
+
+    size_t size = std::min(values.size(), weights.size());
+    int64_t total = Sum(weights.first(size));
+    if (total == 0)
+        return 0.0;
+
+    return (double)Internals::DotInt64(values.data(), weights.data(), size) / (double)total;
+}
+
+double Math::WeightedAverage(std::span<const double> values, std::span<const double> weights) noexcept
+{
+    assert((values.size() == weights.size()) && "Values and weights must have the same size!");
+
+    size_t size = std::min(values.size(), weights.size());
+    double total = Sum(weights.first(size));
+    if (total == 0.0)
+        return 0.0;
+
+    return Internals::Dot(values.data(), weights.data(), size) / total;
+}
+
+} // namespace CppCommon
@@ -0,0 +1,210 @@
+/*!
+    \file allocator_trace.cpp
+    \brief Tracing memory allocator implementation
+    \author Ivan Shynkarenka
+    \date 15.10.2026
+    \copyright MIT License
+*/
+
+#include "memory/allocator_trace.h"
+
+#include "filesystem/file.h"
+#include "system/resource_usage.h"
+#include "threads/thread.h"
+
+#include <cstring>
+#include <stdexcept>
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+namespace Internals {
+
+const char TRACE_MAGIC[8] = { 'C', 'C', 'A', 'L', 'L', 'O', 'C', 'T' };
+const uint32_t TRACE_VERSION = 1;
+// Header: magic, version, reserved, count of events
+const size_t TRACE_HEADER = 8 + 4 + 4 + 8;
+// Event: block, size, alignment, thread, free flag
+const size_t TRACE_EVENT = 8 + 8 + 4 + 4 + 4;
+
+template <typename T>
+inline uint8_t* TraceWrite(uint8_t* buffer, T value) noexcept
+{
+    std::memcpy(buffer, &value, sizeof(value));
+    return buffer + sizeof(value);
+}
+
+template <typename T>
+inline const uint8_t* TraceRead(const uint8_t* buffer, T& value) noexcept
+{
+    std::memcpy(&value, buffer, sizeof(value));
+    return buffer + sizeof(value);
+}
+
+} // namespace Internals
+//! @endcond
+
+bool AllocationTrace::empty() const
+{
+    std::scoped_lock locker(_lock);
+    return _events.empty();
+}
+
+size_t AllocationTrace::size() const
+{
+    std::scoped_lock locker(_lock);
+    return _events.size();
+}
+
+uint64_t AllocationTrace::allocations() const
+{
+    std::scoped_lock locker(_lock);
+    return _allocations;
+}
+
+uint64_t AllocationTrace::peak() const
+{
+    std::scoped_lock locker(_lock);
+    return _peak;
+}
+
+size_t AllocationTrace::threads() const
+{
+    std::scoped_lock locker(_lock);
+    std::vector<bool> threads;
+    size_t result = 0;
+    for (const auto& event : _events)
+    {
+        if (event.thread >= threads.size())
+            threads.resize(event.thread + 1, false);
+        if (!threads[event.thread])
+        {
+            threads[event.thread] = true;
+            ++result;
+        }
+    }
+    return result;
+}
+
+uint64_t AllocationTrace::Allocate(size_t size, size_t alignment)
+{
+    uint32_t thread = Thread::CurrentThreadIndex();
+
+    std::scoped_lock locker(_lock);
+    uint64_t block = _allocations++;
+    _events.push_back(AllocationEvent{ block, size, (uint32_t)alignment, thread, false });
+    _live += size;
+    _peak = std::max(_peak, _live);
+    return block;
+}
+
+void AllocationTrace::Free(uint64_t block, size_t size)
+{
+    uint32_t thread = Thread::CurrentThreadIndex();
+
+    std::scoped_lock locker(_lock);
+    _events.push_back(AllocationEvent{ block, size, 0, thread, true });
+    _live -= std::min<uint64_t>(_live, size);
+}
+
+void AllocationTrace::Clear()
+{
+    std::scoped_lock locker(_lock);
+    _events.clear();
+    _allocations = 0;
+    _live = 0;
+    _peak = 0;
+}
+
+void AllocationTrace::Save(const Path& path) const
+{
+    using namespace Internals;
+
+    std::scoped_lock locker(_lock);
+
+    std::vector<uint8_t> buffer(TRACE_HEADER + _events.size() * TRACE_EVENT);
+    uint8_t* data = buffer.data();
+    std::memcpy(data, TRACE_MAGIC, sizeof(TRACE_MAGIC));
+    data += sizeof(TRACE_MAGIC);
+    data = TraceWrite(data, TRACE_VERSION);
+    data = TraceWrite(data, (uint32_t)0);
+    data = TraceWrite(data, (uint64_t)_events.size());
+    for (const auto& event : _events)
+    {
+        data = TraceWrite(data, event.block);
+        data = TraceWrite(data, event.size);
+        data = TraceWrite(data, event.alignment);
+        data = TraceWrite(data, event.thread);
+        data = TraceWrite(data, (uint32_t)(event.free ? 1 : 0));
+    }
+
+    File::WriteAllBytes(path, buffer.data(), buffer.size());
+}
+
+void AllocationTrace::Load(const Path& path)
+{
+    using namespace Internals;
+
+    std::vector<uint8_t> buffer = File::ReadAllBytes(path);
+    if ((buffer.size() < TRACE_HEADER) || (std::memcmp(buffer.data(), TRACE_MAGIC, sizeof(TRACE_MAGIC)) != 0))
+        throw std::invalid_argument("Invalid allocation trace file!");
+
+    const uint8_t* data = buffer.data() + sizeof(TRACE_MAGIC);
+    uint32_t version;
+    uint32_t reserved;
+    uint64_t count;
+    data = TraceRead(data, version);
+    data = TraceRead(data, reserved);
+    data = TraceRead(data, count);
+    if (version != TRACE_VERSION)
+        throw std::invalid_argument("Unsupported allocation trace version!");
+    if (count != ((buffer.size() - TRACE_HEADER) / TRACE_EVENT) || (((buffer.size() - TRACE_HEADER) % TRACE_EVENT) != 0))
+        throw std::invalid_argument("Truncated allocation trace file!");
+
+    // Read and validate events, so the trace could be safely replayed
+    std::vector<AllocationEvent> events(count);
+    std::vector<bool> freed;
+    uint64_t allocations = 0;
+    uint64_t live = 0;
+    uint64_t peak = 0;
+    for (auto& event : events)
+    {
+        uint32_t free;
+        data = TraceRead(data, event.block);
+        data = TraceRead(data, event.size);
+        data = TraceRead(data, event.alignment);
+        data = TraceRead(data, event.thread);
+        data = TraceRead(data, free);
+        event.free = (free != 0);
+
+        if (!event.free)
+        {
+            if ((event.block != allocations) || (event.size == 0) || !Memory::IsValidAlignment(event.alignment))
+                throw std::invalid_argument("Invalid allocation event in the allocation trace!");
+            ++allocations;
+            freed.push_back(false);
+            live += event.size;
+            peak = std::max(peak, live);
+        }
+        else
+        {
+            if ((event.block >= allocations) || freed[event.block])
+                throw std::invalid_argument("Invalid free event in the allocation trace!");
+            freed[event.block] = true;
+            live -= std::min(live, event.size);
+        }
+    }
+
+    std::scoped_lock locker(_lock);
+    _events = std::move(events);
+    _allocations = allocations;
+    _live = live;
+    _peak = peak;
+}
+
+uint64_t AllocationTrace::CurrentRSS()
+{
+    return ResourceUsage::CurrentProcess().rss;
+}
+
+} // namespace CppCommon
@@ -14,22 +14,180 @@
 
 #include "memory/memory.h"
 
+#include "system/cpu.h"
+
+#if defined(_MSC_VER) && defined(_M_X64)
+#include <intrin.h>
+#include <immintrin.h>
+#define CPPCOMMON_MEMORY_SSE2
+#define CPPCOMMON_MEMORY_AVX2
+#define CPPCOMMON_MEMORY_AVX2_TARGET
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__amd64__))
+#include <immintrin.h>
+#define CPPCOMMON_MEMORY_SSE2
+#define CPPCOMMON_MEMORY_AVX2
+#define CPPCOMMON_MEMORY_AVX2_TARGET __attribute__((target("avx2")))
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#define CPPCOMMON_MEMORY_NEON
+#endif
+
 #if defined(__APPLE__)
 #include <mach/mach.h>
 #include <sys/sysctl.h>
 #include <fcntl.h>
 #include <unistd.h>
 #elif defined(unix) || defined(__unix) || defined(__unix__)
+#if defined(__linux__)
+#include <sys/random.h>
+#include <algorithm>
+#include <fstream>
+#include <string>
+#endif
 #include <sys/sysinfo.h>
+#include <errno.h>
 #include <fcntl.h>
 #include <unistd.h>
 #elif defined(_WIN32) || defined(_WIN64)
 #include <windows.h>
+#include <bcrypt.h>
 #include <wincrypt.h>
 #endif
 
 namespace CppCommon {
 
+//! @cond INTERNALS
+namespace Internals {
+
+// Buffers smaller than the threshold are likely to stay in the CPU cache, so they are written with regular stores
+const size_t STREAM_THRESHOLD = 1024 * 1024;
+
+inline uint64_t LoadWord(const uint8_t* ptr) noexcept
+{
+    uint64_t word;
+    std::memcpy(&word, ptr, sizeof(word));
+    return word;
+}
+
+bool IsZeroWords(const uint8_t* ptr, size_t size) noexcept
+{
+    uint64_t acc = 0;
+    for (; size >= 64; ptr += 64, size -= 64)
+    {
+        acc |= LoadWord(ptr + 0) | LoadWord(ptr + 8) | LoadWord(ptr + 16) | LoadWord(ptr + 24);
+        acc |= LoadWord(ptr + 32) | LoadWord(ptr + 40) | LoadWord(ptr + 48) | LoadWord(ptr + 56);
+        if (acc != 0)
+            return false;
+    }
+    for (; size >= 8; ptr += 8, size -= 8)
+        acc |= LoadWord(ptr);
+    for (; size > 0; ++ptr, --size)
+        acc |= *ptr;
+    return (acc == 0);
+}
+
+#if defined(CPPCOMMON_MEMORY_SSE2)
+
+bool IsZeroSSE2(const uint8_t* ptr, size_t size) noexcept
+{
+    const __m128i zero = _mm_setzero_si128();
+    for (; size >= 64; ptr += 64, size -= 64)
+    {
+        __m128i acc = _mm_or_si128(
+            _mm_or_si128(_mm_loadu_si128((const __m128i*)(ptr + 0)), _mm_loadu_si128((const __m128i*)(ptr + 16))),
+            _mm_or_si128(_mm_loadu_si128((const __m128i*)(ptr + 32)), _mm_loadu_si128((const __m128i*)(ptr + 48))));
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(acc, zero)) != 0xFFFF)
+            return false;
+    }
+    return IsZeroWords(ptr, size);
+}
+
+#endif
+
+#if defined(CPPCOMMON_MEMORY_AVX2)
+
+CPPCOMMON_MEMORY_AVX2_TARGET
+bool IsZeroAVX2(const uint8_t* ptr, size_t size) noexcept
+{
+    for (; size >= 128; ptr += 128, size -= 128)
+    {
+        __m256i acc = _mm256_or_si256(
+            _mm256_or_si256(_mm256_loadu_si256((const __m256i*)(ptr + 0)), _mm256_loadu_si256((const __m256i*)(ptr + 32))),
+            _mm256_or_si256(_mm256_loadu_si256((const __m256i*)(ptr + 64)), _mm256_loadu_si256((const __m256i*)(ptr + 96))));
+        if (!_mm256_testz_si256(acc, acc))
+            return false;
+    }
+    return IsZeroSSE2(ptr, size);
+}
+
+#endif
+
+#if defined(CPPCOMMON_MEMORY_NEON)
+
+bool IsZeroNEON(const uint8_t* ptr, size_t size) noexcept
+{
+    for (; size >= 64; ptr += 64, size -= 64)
+    {
+        uint8x16_t acc = vorrq_u8(vorrq_u8(vld1q_u8(ptr + 0), vld1q_u8(ptr + 16)), vorrq_u8(vld1q_u8(ptr + 32), vld1q_u8(ptr + 48)));
+        if (vmaxvq_u8(acc) != 0)
+            return false;
+    }
+    return IsZeroWords(ptr, size);
+}
+
+#endif
+
+// xoshiro256** generator (https://prng.di.unimi.it) seeded with splitmix64
+class Xoshiro256
+{
+public:
+    explicit Xoshiro256(uint64_t seed) noexcept
+    {
+        for (auto& state : _state)
+        {
+            uint64_t z = (seed += 0x9E3779B97F4A7C15ull);
+            z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+            z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+            state = z ^ (z >> 31);
+        }
+    }
+
+    uint64_t Next() noexcept
+    {
+        const uint64_t result = Rotl(_state[1] * 5, 7) * 9;
+        const uint64_t t = _state[1] << 17;
+        _state[2] ^= _state[0];
+        _state[3] ^= _state[1];
+        _state[1] ^= _state[2];
+        _state[0] ^= _state[3];
+        _state[2] ^= t;
+        _state[3] = Rotl(_state[3], 45);
+        return result;
+    }
+
+    void Fill(uint8_t* buffer, size_t size) noexcept
+    {
+        for (; size >= sizeof(uint64_t); buffer += sizeof(uint64_t), size -= sizeof(uint64_t))
+        {
+            uint64_t word = Next();
+            std::memcpy(buffer, &word, sizeof(word));
+        }
+        if (size > 0)
+        {
+            uint64_t word = Next();
+            std::memcpy(buffer, &word, size);
+        }
+    }
+
+private:
+    uint64_t _state[4];
+
+    static uint64_t Rotl(uint64_t x, int k) noexcept { return (x << k) | (x >> (64 - k)); }
+};
+
+} // namespace Internals
+//! @endcond
+
 int64_t Memory::RamTotal()
 {
 #if defined(__APPLE__)
@@ -92,56 +250,327 @@ int64_t Memory::RamFree()
 #endif
 }
 
-bool Memory::IsZero(const void* buffer, size_t size) noexcept
+#if defined(__linux__)
+
+//! @cond INTERNALS
+namespace Internals {
+
+// Find the memory cgroup directory of the current process (version is 2 for the unified hierarchy, 1 for the legacy one)
+std::string CgroupDirectory(int& version)
 {
-    const char* ptr = (const char*)buffer;
-    for (size_t i = 0; i < size; ++i)
-        if (ptr[i] != 0)
-            return false;
+    std::string unified;
+    std::string line;
+    std::ifstream stream("/proc/self/cgroup");
+    while (std::getline(stream, line))
+    {
+        // Line format: hierarchy-ID:controller-list:cgroup-path
+        size_t first = line.find(':');
+        size_t second = (first != std::string::npos) ? line.find(':', first + 1) : std::string::npos;
+        if (second == std::string::npos)
+            continue;
+
+        std::string controllers = "," + line.substr(first + 1, second - first - 1) + ",";
+        std::string path = line.substr(second + 1);
+        if (controllers == ",,")
+            unified = path;
+        else if (controllers.find(",memory,") != std::string::npos)
+        {
+            // Legacy memory controller takes precedence in the hybrid mode
+            version = 1;
+            return "/sys/fs/cgroup/memory" + path;
+        }
+    }
+
+    version = unified.empty() ? 0 : 2;
+    return unified.empty() ? std::string() : ("/sys/fs/cgroup" + unified);
+}
+
+// Read the integer value of the given cgroup file ('false' if the file is missing or the value is "max")
+bool ReadCgroupValue(const std::string& path, int64_t& value)
+{
+    std::string line;
+    std::ifstream stream(path);
+    if (!stream || !std::getline(stream, line) || line.empty() || (line == "max"))
+        return false;
+
+    value = std::atoll(line.c_str());
     return true;
 }
 
+// Read the value of the given key from the cgroup statistics file
+int64_t ReadCgroupStat(const std::string& path, const std::string& key)
+{
+    std::string name;
+    int64_t value;
+    std::ifstream stream(path);
+    while (stream >> name >> value)
+        if (name == key)
+            return value;
+    return 0;
+}
+
+} // namespace Internals
+//! @endcond
+
+#endif
+
+int64_t Memory::CgroupLimit()
+{
+#if defined(__linux__)
+    int version;
+    std::string directory = Internals::CgroupDirectory(version);
+    if (version == 0)
+        return -1;
+
+    // Cgroup v1 reports the unlimited memory as the huge page aligned maximal value
+    const int64_t unlimited = (int64_t)1 << 62;
+    const std::string root = (version == 2) ? "/sys/fs/cgroup" : "/sys/fs/cgroup/memory";
+    const std::string file = (version == 2) ? "/memory.max" : "/memory.limit_in_bytes";
+
+    // Visit the process cgroup and its ancestors (missing directories of the
+    // host hierarchy are skipped when the container has its own cgroup root)
+    int64_t result = -1;
+    for (;;)
+    {
+        int64_t limit;
+        if (Internals::ReadCgroupValue(directory + file, limit) && (limit > 0) && (limit < unlimited))
+            result = (result < 0) ? limit : std::min(result, limit);
+
+        if (directory.size() <= root.size())
+            break;
+        size_t index = directory.find_last_of('/');
+        directory = (index > root.size()) ? directory.substr(0, index) : root;
+    }
+    return result;
+#else
+    return -1;
+#endif
+}
+
+int64_t Memory::CgroupUsage()
+{
+#if defined(__linux__)
+    int version;
+    std::string directory = Internals::CgroupDirectory(version);
+    if (version == 0)
+        return -1;
+
+    const std::string root = (version == 2) ? "/sys/fs/cgroup" : "/sys/fs/cgroup/memory";
+    const std::string file = (version == 2) ? "/memory.current" : "/memory.usage_in_bytes";
+    const std::string inactive = (version == 2) ? "inactive_file" : "total_inactive_file";
+
+    // Find the nearest existing cgroup directory
+    for (;;)
+    {
+        int64_t usage;
+        if (Internals::ReadCgroupValue(directory + file, usage))
+        {
+            usage -= Internals::ReadCgroupStat(directory + "/memory.stat", inactive);
+            return std::max(usage, (int64_t)0);
+        }
+
+        if (directory.size() <= root.size())
+            return -1;
+        size_t index = directory.find_last_of('/');
+        directory = (index > root.size()) ? directory.substr(0, index) : root;
+    }
+#else
+    return -1;
+#endif
+}
+
+bool Memory::IsZero(const void* buffer, size_t size) noexcept
+{
+    const uint8_t* ptr = (const uint8_t*)buffer;
+#if defined(CPPCOMMON_MEMORY_AVX2)
+    static const CPUDispatch<bool(const uint8_t*, size_t)> dispatch([]() { return CPU::HasAVX2() ? Internals::IsZeroAVX2 : Internals::IsZeroSSE2; });
+    return dispatch(ptr, size);
+#elif defined(CPPCOMMON_MEMORY_SSE2)
+    return Internals::IsZeroSSE2(ptr, size);
+#elif defined(CPPCOMMON_MEMORY_NEON)
+    return Internals::IsZeroNEON(ptr, size);
+#else
+    return Internals::IsZeroWords(ptr, size);
+#endif
+}
+
 void Memory::ZeroFill(void* buffer, size_t size)
 {
 #ifdef __STDC_LIB_EXT1__
     memset_s(buffer, size, 0, size);
 #elif defined(_WIN32) || defined(_WIN64)
     SecureZeroMemory(buffer, size);
+#elif defined(__GNUC__) || defined(__clang__)
+    // The compiler barrier pretends to read the whole memory through the buffer, so the wide memset() is never eliminated as a dead store
+    std::memset(buffer, 0, size);
+    __asm__ __volatile__("" : : "r"(buffer) : "memory");
 #else
-    volatile char* ptr = (volatile char*)buffer;
-    while (size--)
-        *ptr++ = 0;
+    volatile uint8_t* ptr = (volatile uint8_t*)buffer;
+    for (; (size > 0) && !IsAligned(ptr, sizeof(uint64_t)); ++ptr, --size)
+        *ptr = 0;
+    for (; size >= sizeof(uint64_t); ptr += sizeof(uint64_t), size -= sizeof(uint64_t))
+        *(volatile uint64_t*)ptr = 0;
+    for (; size > 0; ++ptr, --size)
+        *ptr = 0;
+#endif
+}
+
+void Memory::StreamFill(void* buffer, size_t size, uint8_t value) noexcept
+{
+    uint8_t* ptr = (uint8_t*)buffer;
+#if defined(CPPCOMMON_MEMORY_SSE2)
+    if (size >= Internals::STREAM_THRESHOLD)
+    {
+        // Fill the unaligned head with regular stores
+        size_t head = (64 - ((uintptr_t)ptr & 63)) & 63;
+        std::memset(ptr, value, head);
+        ptr += head;
+        size -= head;
+
+        // Fill whole cache lines with non-temporal stores
+        const __m128i pattern = _mm_set1_epi8((char)value);
+        for (; size >= 64; ptr += 64, size -= 64)
+        {
+            _mm_stream_si128((__m128i*)(ptr + 0), pattern);
+            _mm_stream_si128((__m128i*)(ptr + 16), pattern);
+            _mm_stream_si128((__m128i*)(ptr + 32), pattern);
+            _mm_stream_si128((__m128i*)(ptr + 48), pattern);
+        }
+
+        // Order non-temporal stores before all following stores
+        _mm_sfence();
+    }
+#endif
+    std::memset(ptr, value, size);
+}
+
+void Memory::StreamCopy(void* destination, const void* source, size_t size) noexcept
+{
+    uint8_t* dst = (uint8_t*)destination;
+    const uint8_t* src = (const uint8_t*)source;
+#if defined(CPPCOMMON_MEMORY_SSE2)
+    if (size >= Internals::STREAM_THRESHOLD)
+    {
+        // Copy the unaligned head with regular stores
+        size_t head = (64 - ((uintptr_t)dst & 63)) & 63;
+        std::memcpy(dst, src, head);
+        dst += head;
+        src += head;
+        size -= head;
+
+        // Copy whole cache lines with non-temporal stores, the source could be unaligned
+        for (; size >= 64; dst += 64, src += 64, size -= 64)
+        {
+            _mm_prefetch((const char*)(src + 512), _MM_HINT_NTA);
+            __m128i block0 = _mm_loadu_si128((const __m128i*)(src + 0));
+            __m128i block1 = _mm_loadu_si128((const __m128i*)(src + 16));
+            __m128i block2 = _mm_loadu_si128((const __m128i*)(src + 32));
+            __m128i block3 = _mm_loadu_si128((const __m128i*)(src + 48));
+            _mm_stream_si128((__m128i*)(dst + 0), block0);
+            _mm_stream_si128((__m128i*)(dst + 16), block1);
+            _mm_stream_si128((__m128i*)(dst + 32), block2);
+            _mm_stream_si128((__m128i*)(dst + 48), block3);
+        }
+
+        // Order non-temporal stores before all following stores
+        _mm_sfence();
+    }
 #endif
+    std::memcpy(dst, src, size);
 }
 
 void Memory::RandomFill(void* buffer, size_t size)
 {
-#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
-    int fd = open("/dev/urandom", O_RDONLY);
+#if defined(__linux__)
+    // Read the kernel CSPRNG without opening any file
+    for (size_t done = 0; done < size;)
+    {
+        ssize_t count = getrandom((uint8_t*)buffer + done, size - done, 0);
+        if (count < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            throwex SystemException("Cannot get random bytes from the kernel!");
+        }
+        done += (size_t)count;
+    }
+#elif defined(__APPLE__)
+    arc4random_buf(buffer, size);
+#elif defined(unix) || defined(__unix) || defined(__unix__)
+    // Random device is opened once and kept open till the process exit
+    static const int fd = open("/dev/urandom", O_RDONLY | O_CLOEXEC);
     if (fd < 0)
         throwex SystemException("Cannot open '/dev/urandom' file for reading!");
-    ssize_t count = read(fd, buffer, size);
-    if (count < 0)
-        throwex SystemException("Cannot read from '/dev/urandom' file!");
-    int result = close(fd);
-    if (result != 0)
-        throwex SystemException("Cannot close '/dev/urandom' file!");
+    for (size_t done = 0; done < size;)
+    {
+        ssize_t count = read(fd, (uint8_t*)buffer + done, size - done);
+        if (count <= 0)
+        {
+            if ((count < 0) && (errno == EINTR))
+                continue;
+            throwex SystemException("Cannot read from '/dev/urandom' file!");
+        }
+        done += (size_t)count;
+    }
 #elif defined(_WIN32) || defined(_WIN64)
-    char* ptr = (char*)buffer;
-    for(size_t i = 0; i < size; ++i)
-        ptr[i] = rand() % 256;
+    for (size_t done = 0; done < size;)
+    {
+        // Generate random bytes in chunks which fit into ULONG size
+        ULONG count = (ULONG)(((size - done) < 0x40000000) ? (size - done) : 0x40000000);
+        if (!BCRYPT_SUCCESS(BCryptGenRandom(nullptr, (PUCHAR)buffer + done, count, BCRYPT_USE_SYSTEM_PREFERRED_RNG)))
+            throwex SystemException("Cannot generate random bytes using the system preferred random number generator!");
+        done += count;
+    }
 #endif
 }
 
+void Memory::FastRandomFill(void* buffer, size_t size)
+{
+    // Per-thread generator is seeded from the operating system random number generator on the first use
+    thread_local Internals::Xoshiro256 generator = []()
+    {
+        uint64_t seed;
+        RandomFill(&seed, sizeof(seed));
+        return Internals::Xoshiro256(seed);
+    }();
+    generator.Fill((uint8_t*)buffer, size);
+}
+
+void Memory::FastRandomFill(void* buffer, size_t size, uint64_t seed) noexcept
+{
+    Internals::Xoshiro256 generator(seed);
+    generator.Fill((uint8_t*)buffer, size);
+}
+
 void Memory::CryptoFill(void* buffer, size_t size)
 {
-#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+#if defined(__linux__)
+    // Read the kernel CSPRNG without opening any file
+    for (size_t done = 0; done < size;)
+    {
+        ssize_t count = getrandom((uint8_t*)buffer + done, size - done, 0);
+        if (count < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            throwex SystemException("Cannot get random bytes from the kernel!");
+        }
+        done += (size_t)count;
+    }
+#elif defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
     int fd = open("/dev/random", O_RDONLY);
     if (fd < 0)
         throwex SystemException("Cannot open '/dev/random' file for reading!");
-    ssize_t count = read(fd, buffer, size);
-    if (count < 0)
-        throwex SystemException("Cannot read from '/dev/random' file!");
+    for (size_t done = 0; done < size;)
+    {
+        ssize_t count = read(fd, (uint8_t*)buffer + done, size - done);
+        if (count <= 0)
+        {
+            close(fd);
+            throwex SystemException("Cannot read from '/dev/random' file!");
+        }
+        done += (size_t)count;
+    }
     int result = close(fd);
     if (result != 0)
         throwex SystemException("Cannot close '/dev/random' file!");
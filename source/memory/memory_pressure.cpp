@@ -0,0 +1,309 @@
+/*!
+    \file memory_pressure.cpp
+    \brief Memory pressure notifier implementation
+    \author Ivan Shynkarenka
+    \date 15.10.2026
+    \copyright MIT License
+*/
+
+#include "memory/memory_pressure.h"
+
+#include "errors/fatal.h"
+#include "memory/memory.h"
+#include "threads/thread.h"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstring>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <thread>
+
+#if defined(linux) || defined(__linux) || defined(__linux__)
+#include <sys/eventfd.h>
+#include <fcntl.h>
+#include <errno.h>
+#include <poll.h>
+#include <unistd.h>
+#include <fstream>
+#include <string>
+#endif
+#if defined(__GLIBC__)
+#include <malloc.h>
+#endif
+
+namespace CppCommon {
+
+MemoryUsage MemoryUsage::Current()
+{
+    MemoryUsage result;
+
+    int64_t limit = Memory::CgroupLimit();
+    int64_t usage = (limit > 0) ? Memory::CgroupUsage() : -1;
+    if ((limit > 0) && (usage >= 0))
+    {
+        result.limit = limit;
+        result.usage = usage;
+        result.cgroup = true;
+        return result;
+    }
+
+    int64_t total = Memory::RamTotal();
+    int64_t free = Memory::RamFree();
+    if ((total > 0) && (free >= 0))
+    {
+        result.limit = total;
+        result.usage = std::max(total - free, (int64_t)0);
+    }
+    return result;
+}
+
+//! @cond INTERNALS
+
+class MemoryPressure::Impl
+{
+public:
+    Impl(double threshold, bool psi) : _threshold(threshold), _id(0), _notifications(0), _running(false), _stop(false)
+    {
+#if defined(linux) || defined(__linux) || defined(__linux__)
+        _event = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+        if (_event < 0)
+            throwex SystemException("Failed to create a wakeup event for the memory pressure notifier!");
+
+        // Pressure stall information trigger is optional: it requires Linux 5.2+
+        // and the write permission to the pressure file (not granted in some containers)
+        _psi = psi ? OpenTrigger() : -1;
+#endif
+    }
+
+    ~Impl()
+    {
+        Stop();
+
+#if defined(linux) || defined(__linux) || defined(__linux__)
+        if ((_psi >= 0) && (close(_psi) != 0))
+            fatality(SystemException("Failed to close a pressure stall information trigger of the memory pressure notifier!"));
+        if (close(_event) != 0)
+            fatality(SystemException("Failed to close a wakeup event of the memory pressure notifier!"));
+#endif
+    }
+
+    double threshold() const noexcept { return _threshold; }
+
+    bool psi() const noexcept
+    {
+#if defined(linux) || defined(__linux) || defined(__linux__)
+        return (_psi >= 0);
+#else
+        return false;
+#endif
+    }
+
+    uint64_t notifications() const noexcept { return _notifications.load(std::memory_order_acquire); }
+
+    bool IsRunning() const noexcept
+    {
+        return _running.load(std::memory_order_acquire);
+    }
+
+    uint64_t Insert(Callback&& callback)
+    {
+        std::scoped_lock locker(_lock);
+
+        uint64_t id = ++_id;
+        _callbacks.emplace(id, std::move(callback));
+        return id;
+    }
+
+    bool Unsubscribe(uint64_t id)
+    {
+        std::scoped_lock locker(_lock);
+        return (_callbacks.erase(id) > 0);
+    }
+
+    bool Poll(const Timespan& timespan)
+    {
+        int64_t timeout = std::min(std::max((timespan.microseconds() + 999) / 1000, (int64_t)0), (int64_t)std::numeric_limits<int>::max());
+        bool stalled = Wait((int)timeout);
+
+        MemoryUsage usage = MemoryUsage::Current();
+        if (!stalled && (usage.ratio() < _threshold))
+            return false;
+
+        Notify(usage);
+        return true;
+    }
+
+    bool Start(const Timespan& interval)
+    {
+        std::scoped_lock locker(_thread_lock);
+
+        if (_running.load(std::memory_order_relaxed))
+            return false;
+
+        _stop.store(false, std::memory_order_release);
+        _thread = Thread::Start([this, interval]() { Run(interval); });
+        _running.store(true, std::memory_order_release);
+        return true;
+    }
+
+    bool Stop()
+    {
+        std::scoped_lock locker(_thread_lock);
+
+        if (!_running.load(std::memory_order_relaxed))
+            return false;
+
+        _stop.store(true, std::memory_order_release);
+        Wakeup();
+        if (_thread.joinable())
+            _thread.join();
+        _running.store(false, std::memory_order_release);
+        return true;
+    }
+
+private:
+    double _threshold;
+
+    std::mutex _lock;
+    std::map<uint64_t, Callback> _callbacks;
+    uint64_t _id;
+    std::atomic<uint64_t> _notifications;
+
+    std::mutex _thread_lock;
+    std::thread _thread;
+    std::atomic<bool> _running;
+    std::atomic<bool> _stop;
+
+#if defined(linux) || defined(__linux) || defined(__linux__)
+    int _event;
+    int _psi;
+
+    // Register the pressure stall information trigger of the process cgroup (v2) or of the whole system
+    static int OpenTrigger()
+    {
+        // 150ms of partial memory stall within 2s window
+        static const char trigger[] = "some 150000 2000000";
+
+        std::string line;
+        std::string cgroup;
+        std::ifstream stream("/proc/self/cgroup");
+        while (std::getline(stream, line))
+            if (line.compare(0, 3, "0::") == 0)
+                cgroup = "/sys/fs/cgroup" + line.substr(3) + "/memory.pressure";
+
+        for (const std::string& path : { cgroup, std::string("/proc/pressure/memory") })
+        {
+            if (path.empty())
+                continue;
+
+            int fd = open(path.c_str(), O_RDWR | O_NONBLOCK | O_CLOEXEC);
+            if (fd < 0)
+                continue;
+            if (write(fd, trigger, std::strlen(trigger) + 1) >= 0)
+                return fd;
+            close(fd);
+        }
+        return -1;
+    }
+#else
+    std::mutex _wait_lock;
+    std::condition_variable _wait_cv;
+    bool _wakeup{false};
+#endif
+
+    void Run(const Timespan& interval)
+    {
+        while (!_stop.load(std::memory_order_acquire))
+            Poll(interval);
+    }
+
+    void Wakeup()
+    {
+#if defined(linux) || defined(__linux) || defined(__linux__)
+        uint64_t value = 1;
+        [[maybe_unused]] ssize_t result = write(_event, &value, sizeof(value));
+#else
+        std::scoped_lock locker(_wait_lock);
+        _wakeup = true;
+        _wait_cv.notify_all();
+#endif
+    }
+
+    // Wait for the pressure stall information trigger or the wakeup ('true' if the trigger was fired)
+    bool Wait(int timeout)
+    {
+#if defined(linux) || defined(__linux) || defined(__linux__)
+        struct pollfd fds[2] = {};
+        fds[0].fd = _event;
+        fds[0].events = POLLIN;
+        fds[1].fd = _psi;
+        fds[1].events = POLLPRI;
+
+        int result = poll(fds, (_psi >= 0) ? 2 : 1, timeout);
+        if (result < 0)
+        {
+            if (errno == EINTR)
+                return false;
+            throwex SystemException("Failed to wait for the memory pressure!");
+        }
+
+        // Drain the wakeup event
+        if (fds[0].revents & POLLIN)
+        {
+            uint64_t value;
+            [[maybe_unused]] ssize_t drained = read(_event, &value, sizeof(value));
+        }
+
+        return (_psi >= 0) && ((fds[1].revents & POLLPRI) != 0);
+#else
+        std::unique_lock<std::mutex> locker(_wait_lock);
+        _wait_cv.wait_for(locker, std::chrono::milliseconds(timeout), [this]() { return _wakeup; });
+        _wakeup = false;
+        return false;
+#endif
+    }
+
+    void Notify(const MemoryUsage& usage)
+    {
+        {
+            std::scoped_lock locker(_lock);
+            for (auto& callback : _callbacks)
+                callback.second(usage);
+        }
+
+        _notifications.fetch_add(1, std::memory_order_acq_rel);
+
+#if defined(__GLIBC__)
+        // Return the memory freed by subscribers to the system
+        malloc_trim(0);
+#endif
+    }
+};
+
+//! @endcond
+
+MemoryPressure::MemoryPressure(double threshold, bool psi) : _pimpl(std::make_unique<Impl>(threshold, psi))
+{
+}
+
+MemoryPressure::~MemoryPressure()
+{
+}
+
+double MemoryPressure::threshold() const noexcept { return _pimpl->threshold(); }
+bool MemoryPressure::psi() const noexcept { return _pimpl->psi(); }
+uint64_t MemoryPressure::notifications() const noexcept { return _pimpl->notifications(); }
+bool MemoryPressure::IsRunning() const noexcept { return _pimpl->IsRunning(); }
+
+uint64_t MemoryPressure::Insert(Callback&& callback) { return _pimpl->Insert(std::move(callback)); }
+bool MemoryPressure::Unsubscribe(uint64_t id) { return _pimpl->Unsubscribe(id); }
+
+bool MemoryPressure::Poll(const Timespan& timespan) { return _pimpl->Poll(timespan); }
+
+bool MemoryPressure::Start(const Timespan& interval) { return _pimpl->Start(interval); }
+bool MemoryPressure::Stop() { return _pimpl->Stop(); }
+
+} // namespace CppCommon
@@ -0,0 +1,58 @@
+/*!
+    \file scratch.cpp
+    \brief Thread-local scratch memory implementation
+    \author Ivan Shynkarenka
+    \date 15.10.2026
+    \copyright MIT License
+*/
+
+#include "memory/scratch.h"
+
+#include <atomic>
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+namespace Internals {
+
+// Scratch stack of a single thread is destroyed on the thread exit
+struct ScratchStack
+{
+    DefaultMemoryManager auxiliary;
+    std::unique_ptr<uint8_t[]> buffer;
+    ArenaMemoryManager<DefaultMemoryManager> manager;
+
+    explicit ScratchStack(size_t capacity) : buffer(new uint8_t[capacity]), manager(auxiliary, buffer.get(), capacity) {}
+    ~ScratchStack() { Scratch::_manager = nullptr; }
+};
+
+} // namespace Internals
+//! @endcond
+
+namespace {
+
+std::atomic<size_t> scratch_capacity(1024 * 1024);
+thread_local std::unique_ptr<Internals::ScratchStack> scratch_stack;
+
+} // namespace
+
+const size_t Scratch::DEFAULT_CAPACITY = 1024 * 1024;
+
+size_t Scratch::capacity() noexcept
+{
+    return scratch_capacity.load(std::memory_order_relaxed);
+}
+
+void Scratch::capacity(size_t capacity) noexcept
+{
+    scratch_capacity.store((capacity > 0) ? capacity : 1, std::memory_order_relaxed);
+}
+
+ArenaMemoryManager<DefaultMemoryManager>& Scratch::Create()
+{
+    scratch_stack = std::make_unique<Internals::ScratchStack>(capacity());
+    _manager = &scratch_stack->manager;
+    return *_manager;
+}
+
+} // namespace CppCommon
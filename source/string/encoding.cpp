@@ -8,533 +8,1981 @@
 
 #include "string/encoding.h"
 
+#include "common/writer.h"
+#include "errors/exceptions.h"
+#include "system/cpu.h"
+
 #include <algorithm>
 #include <cassert>
-#include <codecvt>
-#include <locale>
+#include <cstring>
 #include <vector>
 
-namespace CppCommon {
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
-std::string Encoding::ToUTF8(std::wstring_view wstr)
+#if defined(_MSC_VER) && defined(_M_X64)
+#include <intrin.h>
+#include <immintrin.h>
+#define CPPCOMMON_ENCODING_SSE2
+#define CPPCOMMON_ENCODING_AVX2
+#define CPPCOMMON_ENCODING_AVX2_TARGET
+#elif defined(_MSC_VER) && (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#include <intrin.h>
+#include <emmintrin.h>
+#define CPPCOMMON_ENCODING_SSE2
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__amd64__))
+#include <immintrin.h>
+#define CPPCOMMON_ENCODING_SSE2
+#define CPPCOMMON_ENCODING_AVX2
+#define CPPCOMMON_ENCODING_AVX2_TARGET __attribute__((target("avx2")))
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#define CPPCOMMON_ENCODING_SSE2
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#define CPPCOMMON_ENCODING_NEON
+#endif
+
+namespace CppCommon {
+//! @cond INTERNALS
+namespace Internals {
+
+// Decode UTF-8 sequence of the non ASCII character
+inline bool DecodeUTF8Char(const uint8_t*& input, const uint8_t* end, uint32_t& code) noexcept
+{
+    uint8_t lead = *input;
+    size_t size;
+    uint32_t min;
+    if ((lead & 0xE0) == 0xC0)
+    {
+        size = 2;
+        code = lead & 0x1F;
+        min = 0x80;
+    }
+    else if ((lead & 0xF0) == 0xE0)
+    {
+        size = 3;
+        code = lead & 0x0F;
+        min = 0x800;
+    }
+    else if ((lead & 0xF8) == 0xF0)
+    {
+        size = 4;
+        code = lead & 0x07;
+        min = 0x10000;
+    }
+    else
+        return false;
+
+    if ((size_t)(end - input) < size)
+        return false;
+
+    for (size_t i = 1; i < size; ++i)
+    {
+        if ((input[i] & 0xC0) != 0x80)
+            return false;
+        code = (code << 6) | (input[i] & 0x3F);
+    }
+
+    // Reject overlong sequences, surrogates and code points above U+10FFFF
+    if ((code < min) || (code > 0x10FFFF) || ((code >= 0xD800) && (code <= 0xDFFF)))
+        return false;
+
+    input += size;
+    return true;
+}
+
+// Encode the code point into UTF-8 sequence
+inline char* EncodeUTF8Char(uint32_t code, char* output) noexcept
+{
+    if (code < 0x80)
+        *output++ = (char)code;
+    else if (code < 0x800)
+    {
+        *output++ = (char)(0xC0 | (code >> 6));
+        *output++ = (char)(0x80 | (code & 0x3F));
+    }
+    else if (code < 0x10000)
+    {
+        *output++ = (char)(0xE0 | (code >> 12));
+        *output++ = (char)(0x80 | ((code >> 6) & 0x3F));
+        *output++ = (char)(0x80 | (code & 0x3F));
+    }
+    else
+    {
+        *output++ = (char)(0xF0 | (code >> 18));
+        *output++ = (char)(0x80 | ((code >> 12) & 0x3F));
+        *output++ = (char)(0x80 | ((code >> 6) & 0x3F));
+        *output++ = (char)(0x80 | (code & 0x3F));
+    }
+    return output;
+}
+
+// Validate UTF-8 string with ASCII 8 bytes words fast path
+inline bool IsUTF8Scalar(const uint8_t* input, size_t size) noexcept
+{
+    const uint8_t* end = input + size;
+    while (input < end)
+    {
+        uint64_t word;
+        if (((end - input) >= 8) && ((std::memcpy(&word, input, 8), word) & 0x8080808080808080ull) == 0)
+        {
+            input += 8;
+            continue;
+        }
+        uint32_t code;
+        if (*input < 0x80)
+            ++input;
+        else if (!DecodeUTF8Char(input, end, code))
+            return false;
+    }
+    return true;
+}
+
+// UTF-8 errors classes of the Keiser & Lemire lookup validation algorithm
+const uint8_t TOO_SHORT = 1 << 0;
+const uint8_t TOO_LONG = 1 << 1;
+const uint8_t OVERLONG_3 = 1 << 2;
+const uint8_t TOO_LARGE = 1 << 3;
+const uint8_t SURROGATE = 1 << 4;
+const uint8_t OVERLONG_2 = 1 << 5;
+const uint8_t TOO_LARGE_1000 = 1 << 6;
+const uint8_t OVERLONG_4 = 1 << 6;
+const uint8_t TWO_CONTS = 1 << 7;
+const uint8_t CARRY = TOO_SHORT | TOO_LONG | TWO_CONTS;
+
+// Errors classes by the high nibble of the first byte
+const uint8_t utf8_byte1_high[16] =
+{
+    TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG,
+    TWO_CONTS, TWO_CONTS, TWO_CONTS, TWO_CONTS,
+    TOO_SHORT | OVERLONG_2,
+    TOO_SHORT,
+    TOO_SHORT | OVERLONG_3 | SURROGATE,
+    TOO_SHORT | TOO_LARGE | TOO_LARGE_1000 | OVERLONG_4
+};
+
+// Errors classes by the low nibble of the first byte
+const uint8_t utf8_byte1_low[16] =
+{
+    CARRY | OVERLONG_3 | OVERLONG_2 | OVERLONG_4,
+    CARRY | OVERLONG_2,
+    CARRY,
+    CARRY,
+    CARRY | TOO_LARGE,
+    CARRY | TOO_LARGE | TOO_LARGE_1000,
+    CARRY | TOO_LARGE | TOO_LARGE_1000,
+    CARRY | TOO_LARGE | TOO_LARGE_1000,
+    CARRY | TOO_LARGE | TOO_LARGE_1000,
+    CARRY | TOO_LARGE | TOO_LARGE_1000,
+    CARRY | TOO_LARGE | TOO_LARGE_1000,
+    CARRY | TOO_LARGE | TOO_LARGE_1000,
+    CARRY | TOO_LARGE | TOO_LARGE_1000,
+    CARRY | TOO_LARGE | TOO_LARGE_1000 | SURROGATE,
+    CARRY | TOO_LARGE | TOO_LARGE_1000,
+    CARRY | TOO_LARGE | TOO_LARGE_1000
+};
+
+// Errors classes by the high nibble of the second byte
+const uint8_t utf8_byte2_high[16] =
+{
+    TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT,
+    TOO_LONG | OVERLONG_2 | TWO_CONTS | OVERLONG_3 | TOO_LARGE_1000 | OVERLONG_4,
+    TOO_LONG | OVERLONG_2 | TWO_CONTS | OVERLONG_3 | TOO_LARGE,
+    TOO_LONG | OVERLONG_2 | TWO_CONTS | SURROGATE | TOO_LARGE,
+    TOO_LONG | OVERLONG_2 | TWO_CONTS | SURROGATE | TOO_LARGE,
+    TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT
+};
+
+// Maximal values of the last 3 bytes of the block without incomplete sequences
+const uint8_t utf8_incomplete[32] =
+{
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0 - 1, 0xE0 - 1, 0xC0 - 1
+};
+
+#if defined(CPPCOMMON_ENCODING_SSE2)
+
+// Widen ASCII characters by 16 characters blocks
+template <typename TChar>
+inline void WidenASCII(const uint8_t*& source, const uint8_t* end, TChar*& target) noexcept
+{
+    // Local pointers are kept in registers in the loop
+    const uint8_t* input = source;
+    TChar* output = target;
+    const __m128i zero = _mm_setzero_si128();
+    for (; (end - input) >= 16; input += 16, output += 16)
+    {
+        __m128i chars = _mm_loadu_si128((const __m128i*)input);
+        if (_mm_movemask_epi8(chars) != 0)
+            break;
+        __m128i lo = _mm_unpacklo_epi8(chars, zero);
+        __m128i hi = _mm_unpackhi_epi8(chars, zero);
+        if constexpr (sizeof(TChar) == 2)
+        {
+            _mm_storeu_si128((__m128i*)output, lo);
+            _mm_storeu_si128((__m128i*)(output + 8), hi);
+        }
+        else
+        {
+            _mm_storeu_si128((__m128i*)output, _mm_unpacklo_epi16(lo, zero));
+            _mm_storeu_si128((__m128i*)(output + 4), _mm_unpackhi_epi16(lo, zero));
+            _mm_storeu_si128((__m128i*)(output + 8), _mm_unpacklo_epi16(hi, zero));
+            _mm_storeu_si128((__m128i*)(output + 12), _mm_unpackhi_epi16(hi, zero));
+        }
+    }
+
+    source = input;
+    target = output;
+}
+
+// Narrow ASCII characters by 16 characters blocks
+template <typename TChar>
+inline void NarrowASCII(const TChar*& source, const TChar* end, char*& target) noexcept
+{
+    // Local pointers are kept in registers in the loop
+    const TChar* input = source;
+    char* output = target;
+    const __m128i zero = _mm_setzero_si128();
+    for (; (end - input) >= 16; input += 16, output += 16)
+    {
+        if constexpr (sizeof(TChar) == 2)
+        {
+            __m128i chars1 = _mm_loadu_si128((const __m128i*)input);
+            __m128i chars2 = _mm_loadu_si128((const __m128i*)(input + 8));
+            __m128i high = _mm_and_si128(_mm_or_si128(chars1, chars2), _mm_set1_epi16((short)0xFF80));
+            if (_mm_movemask_epi8(_mm_cmpeq_epi16(high, zero)) != 0xFFFF)
+                break;
+            _mm_storeu_si128((__m128i*)output, _mm_packus_epi16(chars1, chars2));
+        }
+        else
+        {
+            __m128i chars1 = _mm_loadu_si128((const __m128i*)input);
+            __m128i chars2 = _mm_loadu_si128((const __m128i*)(input + 4));
+            __m128i chars3 = _mm_loadu_si128((const __m128i*)(input + 8));
+            __m128i chars4 = _mm_loadu_si128((const __m128i*)(input + 12));
+            __m128i high = _mm_and_si128(_mm_or_si128(_mm_or_si128(chars1, chars2), _mm_or_si128(chars3, chars4)), _mm_set1_epi32((int)0xFFFFFF80));
+            if (_mm_movemask_epi8(_mm_cmpeq_epi32(high, zero)) != 0xFFFF)
+                break;
+            _mm_storeu_si128((__m128i*)output, _mm_packus_epi16(_mm_packs_epi32(chars1, chars2), _mm_packs_epi32(chars3, chars4)));
+        }
+    }
+
+    source = input;
+    target = output;
+}
+
+#elif defined(CPPCOMMON_ENCODING_NEON)
+
+// Widen ASCII characters by 16 characters blocks
+template <typename TChar>
+inline void WidenASCII(const uint8_t*& source, const uint8_t* end, TChar*& target) noexcept
+{
+    // Local pointers are kept in registers in the loop
+    const uint8_t* input = source;
+    TChar* output = target;
+    for (; (end - input) >= 16; input += 16, output += 16)
+    {
+        uint8x16_t chars = vld1q_u8(input);
+        if (vmaxvq_u8(chars) >= 0x80)
+            break;
+        uint16x8_t lo = vmovl_u8(vget_low_u8(chars));
+        uint16x8_t hi = vmovl_u8(vget_high_u8(chars));
+        if constexpr (sizeof(TChar) == 2)
+        {
+            vst1q_u16((uint16_t*)output, lo);
+            vst1q_u16((uint16_t*)(output + 8), hi);
+        }
+        else
+        {
+            vst1q_u32((uint32_t*)output, vmovl_u16(vget_low_u16(lo)));
+            vst1q_u32((uint32_t*)(output + 4), vmovl_u16(vget_high_u16(lo)));
+            vst1q_u32((uint32_t*)(output + 8), vmovl_u16(vget_low_u16(hi)));
+            vst1q_u32((uint32_t*)(output + 12), vmovl_u16(vget_high_u16(hi)));
+        }
+    }
+
+    source = input;
+    target = output;
+}
+
+// Narrow ASCII characters by 16 characters blocks
+template <typename TChar>
+inline void NarrowASCII(const TChar*& source, const TChar* end, char*& target) noexcept
+{
+    // Local pointers are kept in registers in the loop
+    const TChar* input = source;
+    char* output = target;
+    for (; (end - input) >= 16; input += 16, output += 16)
+    {
+        if constexpr (sizeof(TChar) == 2)
+        {
+            uint16x8_t chars1 = vld1q_u16((const uint16_t*)input);
+            uint16x8_t chars2 = vld1q_u16((const uint16_t*)(input + 8));
+            if (vmaxvq_u16(vorrq_u16(chars1, chars2)) >= 0x80)
+                break;
+            vst1q_u8((uint8_t*)output, vcombine_u8(vmovn_u16(chars1), vmovn_u16(chars2)));
+        }
+        else
+        {
+            uint32x4_t chars1 = vld1q_u32((const uint32_t*)input);
+            uint32x4_t chars2 = vld1q_u32((const uint32_t*)(input + 4));
+            uint32x4_t chars3 = vld1q_u32((const uint32_t*)(input + 8));
+            uint32x4_t chars4 = vld1q_u32((const uint32_t*)(input + 12));
+            if (vmaxvq_u32(vorrq_u32(vorrq_u32(chars1, chars2), vorrq_u32(chars3, chars4))) >= 0x80)
+                break;
+            uint16x8_t lo = vcombine_u16(vmovn_u32(chars1), vmovn_u32(chars2));
+            uint16x8_t hi = vcombine_u16(vmovn_u32(chars3), vmovn_u32(chars4));
+            vst1q_u8((uint8_t*)output, vcombine_u8(vmovn_u16(lo), vmovn_u16(hi)));
+        }
+    }
+
+    source = input;
+    target = output;
+}
+
+// Validate UTF-8 string by 16 bytes blocks
+inline bool IsUTF8NEON(const uint8_t* input, size_t size) noexcept
+{
+    const uint8x16_t byte1_high = vld1q_u8(utf8_byte1_high);
+    const uint8x16_t byte1_low = vld1q_u8(utf8_byte1_low);
+    const uint8x16_t byte2_high = vld1q_u8(utf8_byte2_high);
+    const uint8x16_t incomplete = vld1q_u8(utf8_incomplete + 16);
+    const uint8x16_t mask = vdupq_n_u8(0x0F);
+
+    uint8x16_t error = vdupq_n_u8(0);
+    uint8x16_t prev_input = vdupq_n_u8(0);
+    uint8x16_t prev_incomplete = vdupq_n_u8(0);
+
+    uint8_t tail[16];
+    while (size > 0)
+    {
+        uint8x16_t chars;
+        if (size >= 16)
+        {
+            chars = vld1q_u8(input);
+            input += 16;
+            size -= 16;
+        }
+        else
+        {
+            // Zero padded tail is never an incomplete sequence
+            std::memset(tail, 0, sizeof(tail));
+            std::memcpy(tail, input, size);
+            chars = vld1q_u8(tail);
+            size = 0;
+        }
+
+        if (vmaxvq_u8(chars) < 0x80)
+            error = vorrq_u8(error, prev_incomplete);
+        else
+        {
+            uint8x16_t prev1 = vextq_u8(prev_input, chars, 15);
+            uint8x16_t prev2 = vextq_u8(prev_input, chars, 14);
+            uint8x16_t prev3 = vextq_u8(prev_input, chars, 13);
+            uint8x16_t special = vandq_u8(vandq_u8(vqtbl1q_u8(byte1_high, vshrq_n_u8(prev1, 4)), vqtbl1q_u8(byte1_low, vandq_u8(prev1, mask))), vqtbl1q_u8(byte2_high, vshrq_n_u8(chars, 4)));
+            uint8x16_t must23 = vorrq_u8(vqsubq_u8(prev2, vdupq_n_u8(0xE0 - 0x80)), vqsubq_u8(prev3, vdupq_n_u8(0xF0 - 0x80)));
+            error = vorrq_u8(error, veorq_u8(vandq_u8(must23, vdupq_n_u8(0x80)), special));
+            prev_incomplete = vqsubq_u8(chars, incomplete);
+        }
+        prev_input = chars;
+    }
+
+    return (vmaxvq_u8(vorrq_u8(error, prev_incomplete)) == 0);
+}
+
+#endif
+
+#if defined(CPPCOMMON_ENCODING_AVX2)
+
+// Widen ASCII characters by 32 characters blocks
+template <typename TChar>
+CPPCOMMON_ENCODING_AVX2_TARGET void WidenASCIIAVX2(const uint8_t*& source, const uint8_t* end, TChar*& target) noexcept
+{
+    // Local pointers are kept in registers in the loop
+    const uint8_t* input = source;
+    TChar* output = target;
+    for (; (end - input) >= 32; input += 32, output += 32)
+    {
+        __m256i chars = _mm256_loadu_si256((const __m256i*)input);
+        if (_mm256_movemask_epi8(chars) != 0)
+            break;
+        __m128i lo = _mm256_castsi256_si128(chars);
+        __m128i hi = _mm256_extracti128_si256(chars, 1);
+        if constexpr (sizeof(TChar) == 2)
+        {
+            _mm256_storeu_si256((__m256i*)output, _mm256_cvtepu8_epi16(lo));
+            _mm256_storeu_si256((__m256i*)(output + 16), _mm256_cvtepu8_epi16(hi));
+        }
+        else
+        {
+            _mm256_storeu_si256((__m256i*)output, _mm256_cvtepu8_epi32(lo));
+            _mm256_storeu_si256((__m256i*)(output + 8), _mm256_cvtepu8_epi32(_mm_srli_si128(lo, 8)));
+            _mm256_storeu_si256((__m256i*)(output + 16), _mm256_cvtepu8_epi32(hi));
+            _mm256_storeu_si256((__m256i*)(output + 24), _mm256_cvtepu8_epi32(_mm_srli_si128(hi, 8)));
+        }
+    }
+
+    source = input;
+    target = output;
+}
+
+// Validate UTF-8 string by 32 bytes blocks
+CPPCOMMON_ENCODING_AVX2_TARGET bool IsUTF8AVX2(const uint8_t* input, size_t size) noexcept
+{
+    const __m256i byte1_high = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*)utf8_byte1_high));
+    const __m256i byte1_low = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*)utf8_byte1_low));
+    const __m256i byte2_high = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*)utf8_byte2_high));
+    const __m256i incomplete = _mm256_loadu_si256((const __m256i*)utf8_incomplete);
+    const __m256i mask = _mm256_set1_epi8(0x0F);
+
+    __m256i error = _mm256_setzero_si256();
+    __m256i prev_input = _mm256_setzero_si256();
+    __m256i prev_incomplete = _mm256_setzero_si256();
+
+    uint8_t tail[32];
+    while (size > 0)
+    {
+        __m256i chars;
+        if (size >= 32)
+        {
+            chars = _mm256_loadu_si256((const __m256i*)input);
+            input += 32;
+            size -= 32;
+        }
+        else
+        {
+            // Zero padded tail is never an incomplete sequence
+            std::memset(tail, 0, sizeof(tail));
+            std::memcpy(tail, input, size);
+            chars = _mm256_loadu_si256((const __m256i*)tail);
+            size = 0;
+        }
+
+        if (_mm256_movemask_epi8(chars) == 0)
+            error = _mm256_or_si256(error, prev_incomplete);
+        else
+        {
+            // Previous 1, 2 and 3 bytes of each byte of the block
+            __m256i shifted = _mm256_permute2x128_si256(prev_input, chars, 0x21);
+            __m256i prev1 = _mm256_alignr_epi8(chars, shifted, 15);
+            __m256i prev2 = _mm256_alignr_epi8(chars, shifted, 14);
+            __m256i prev3 = _mm256_alignr_epi8(chars, shifted, 13);
+
+            // Errors classes of the first two bytes of each sequence
+            __m256i special = _mm256_shuffle_epi8(byte1_high, _mm256_and_si256(_mm256_srli_epi16(prev1, 4), mask));
+            special = _mm256_and_si256(special, _mm256_shuffle_epi8(byte1_low, _mm256_and_si256(prev1, mask)));
+            special = _mm256_and_si256(special, _mm256_shuffle_epi8(byte2_high, _mm256_and_si256(_mm256_srli_epi16(chars, 4), mask)));
+
+            // Third and fourth bytes of 3 and 4 bytes sequences must be continuations
+            __m256i must23 = _mm256_or_si256(_mm256_subs_epu8(prev2, _mm256_set1_epi8((char)(0xE0 - 0x80))), _mm256_subs_epu8(prev3, _mm256_set1_epi8((char)(0xF0 - 0x80))));
+            error = _mm256_or_si256(error, _mm256_xor_si256(_mm256_and_si256(must23, _mm256_set1_epi8((char)0x80)), special));
+            prev_incomplete = _mm256_subs_epu8(chars, incomplete);
+        }
+        prev_input = chars;
+    }
+
+    error = _mm256_or_si256(error, prev_incomplete);
+    return (_mm256_testz_si256(error, error) != 0);
+}
+
+#endif
+
+// Convert UTF-8 string into UTF-16 or UTF-32 characters
+template <typename TChar>
+size_t DecodeUTF8(std::string_view str, TChar* output) noexcept
+{
+    const uint8_t* input = (const uint8_t*)str.data();
+    const uint8_t* end = input + str.size();
+    TChar* start = output;
+
+#if defined(CPPCOMMON_ENCODING_AVX2)
+    static const bool avx2 = CPU::HasAVX2();
+#endif
+
+    while (input < end)
+    {
+        // Widen ASCII characters by blocks
+#if defined(CPPCOMMON_ENCODING_AVX2)
+        if (avx2)
+            WidenASCIIAVX2(input, end, output);
+        else
+            WidenASCII(input, end, output);
+#elif defined(CPPCOMMON_ENCODING_SSE2) || defined(CPPCOMMON_ENCODING_NEON)
+        WidenASCII(input, end, output);
+#endif
+
+        // Convert characters one by one up to the next block
+        const uint8_t* limit = ((end - input) > 32) ? (input + 32) : end;
+        while (input < limit)
+        {
+            if (*input < 0x80)
+            {
+                *output++ = (TChar)*input++;
+                continue;
+            }
+
+            uint32_t code;
+            if (!DecodeUTF8Char(input, end, code))
+                return std::string::npos;
+
+            if constexpr (sizeof(TChar) == 2)
+            {
+                if (code >= 0x10000)
+                {
+                    code -= 0x10000;
+                    *output++ = (TChar)(0xD800 + (code >> 10));
+                    *output++ = (TChar)(0xDC00 + (code & 0x3FF));
+                    continue;
+                }
+            }
+            *output++ = (TChar)code;
+        }
+    }
+
+    return (size_t)(output - start);
+}
+
+// Convert UTF-16 or UTF-32 characters into UTF-8 string
+template <typename TChar>
+size_t EncodeUTF8(const TChar* input, size_t size, char* output) noexcept
+{
+    const TChar* end = input + size;
+    char* start = output;
+
+    while (input < end)
+    {
+        // Narrow ASCII characters by blocks
+#if defined(CPPCOMMON_ENCODING_SSE2) || defined(CPPCOMMON_ENCODING_NEON)
+        NarrowASCII(input, end, output);
+#endif
+
+        // Convert characters one by one up to the next block
+        const TChar* limit = ((end - input) > 16) ? (input + 16) : end;
+        while (input < limit)
+        {
+            uint32_t code = (uint32_t)*input++;
+            if constexpr (sizeof(TChar) == 2)
+            {
+                // Join surrogate pair
+                if ((code >= 0xD800) && (code <= 0xDFFF))
+                {
+                    if ((code >= 0xDC00) || (input == end) || ((uint32_t)*input < 0xDC00) || ((uint32_t)*input > 0xDFFF))
+                        return std::string::npos;
+                    code = 0x10000 + ((code - 0xD800) << 10) + ((uint32_t)*input++ - 0xDC00);
+                }
+            }
+            else
+            {
+                if ((code > 0x10FFFF) || ((code >= 0xD800) && (code <= 0xDFFF)))
+                    return std::string::npos;
+            }
+            output = EncodeUTF8Char(code, output);
+        }
+    }
+
+    return (size_t)(output - start);
+}
+
+} // namespace Internals
+//! @endcond
+
+std::string Encoding::ToUTF8(std::wstring_view wstr)
+{
+    std::string result(wstr.size() * ((sizeof(wchar_t) == 2) ? 3 : 4), 0);
+    size_t size = ToUTF8(wstr, result.data());
+    if (size == std::string::npos)
+        throwex ArgumentException("Invalid wide-string!");
+    result.resize(size);
+    return result;
+}
+
+size_t Encoding::ToUTF8(std::wstring_view wstr, char* output) noexcept
+{
+    return Internals::EncodeUTF8(wstr.data(), wstr.size(), output);
+}
+
+std::wstring Encoding::FromUTF8(std::string_view str)
+{
+    std::wstring result(str.size(), 0);
+    size_t size = FromUTF8(str, result.data());
+    if (size == std::string::npos)
+        throwex ArgumentException("Invalid UTF-8 encoded string!");
+    result.resize(size);
+    return result;
+}
+
+size_t Encoding::FromUTF8(std::string_view str, wchar_t* output) noexcept
+{
+    return Internals::DecodeUTF8(str, output);
+}
+
+bool Encoding::IsUTF8(std::string_view str) noexcept
+{
+#if defined(CPPCOMMON_ENCODING_AVX2)
+    static const CPUDispatch<bool(const uint8_t*, size_t)> dispatch([]() { return CPU::HasAVX2() ? Internals::IsUTF8AVX2 : Internals::IsUTF8Scalar; });
+    return dispatch((const uint8_t*)str.data(), str.size());
+#elif defined(CPPCOMMON_ENCODING_NEON)
+    return Internals::IsUTF8NEON((const uint8_t*)str.data(), str.size());
+#endif
+    return Internals::IsUTF8Scalar((const uint8_t*)str.data(), str.size());
+}
+
+std::u16string Encoding::UTF8toUTF16(std::string_view str)
+{
+    std::u16string result(str.size(), 0);
+    size_t size = UTF8toUTF16(str, result.data());
+    if (size == std::string::npos)
+        throwex ArgumentException("Invalid UTF-8 encoded string!");
+    result.resize(size);
+    return result;
+}
+
+size_t Encoding::UTF8toUTF16(std::string_view str, char16_t* output) noexcept
+{
+    return Internals::DecodeUTF8(str, output);
+}
+
+std::u32string Encoding::UTF8toUTF32(std::string_view str)
+{
+    std::u32string result(str.size(), 0);
+    size_t size = UTF8toUTF32(str, result.data());
+    if (size == std::string::npos)
+        throwex ArgumentException("Invalid UTF-8 encoded string!");
+    result.resize(size);
+    return result;
+}
+
+size_t Encoding::UTF8toUTF32(std::string_view str, char32_t* output) noexcept
+{
+    return Internals::DecodeUTF8(str, output);
+}
+
+std::string Encoding::UTF16toUTF8(std::u16string_view str)
+{
+    std::string result(str.size() * 3, 0);
+    size_t size = UTF16toUTF8(str, result.data());
+    if (size == std::string::npos)
+        throwex ArgumentException("Invalid UTF-16 encoded string!");
+    result.resize(size);
+    return result;
+}
+
+size_t Encoding::UTF16toUTF8(std::u16string_view str, char* output) noexcept
+{
+    return Internals::EncodeUTF8(str.data(), str.size(), output);
+}
+
+std::u32string Encoding::UTF16toUTF32(std::u16string_view str)
+{
+    std::u32string result;
+    result.reserve(str.size());
+
+    for (size_t i = 0; i < str.size(); ++i)
+    {
+        char32_t code = str[i];
+
+        // Join surrogate pair
+        if ((code >= 0xD800) && (code <= 0xDFFF))
+        {
+            if ((code >= 0xDC00) || ((i + 1) == str.size()) || (str[i + 1] < 0xDC00) || (str[i + 1] > 0xDFFF))
+                throwex ArgumentException("Invalid UTF-16 encoded string!");
+            code = 0x10000 + ((code - 0xD800) << 10) + (str[++i] - 0xDC00);
+        }
+
+        result.push_back(code);
+    }
+
+    return result;
+}
+
+std::string Encoding::UTF32toUTF8(std::u32string_view str)
+{
+    std::string result(str.size() * 4, 0);
+    size_t size = UTF32toUTF8(str, result.data());
+    if (size == std::string::npos)
+        throwex ArgumentException("Invalid UTF-32 encoded string!");
+    result.resize(size);
+    return result;
+}
+
+size_t Encoding::UTF32toUTF8(std::u32string_view str, char* output) noexcept
+{
+    return Internals::EncodeUTF8(str.data(), str.size(), output);
+}
+
+std::u16string Encoding::UTF32toUTF16(std::u32string_view str)
+{
+    std::u16string result;
+    result.reserve(str.size());
+
+    for (char32_t code : str)
+    {
+        if ((code > 0x10FFFF) || ((code >= 0xD800) && (code <= 0xDFFF)))
+            throwex ArgumentException("Invalid UTF-32 encoded string!");
+
+        // Split into surrogate pair
+        if (code >= 0x10000)
+        {
+            code -= 0x10000;
+            result.push_back((char16_t)(0xD800 + (code >> 10)));
+            result.push_back((char16_t)(0xDC00 + (code & 0x3FF)));
+        }
+        else
+            result.push_back((char16_t)code);
+    }
+
+    return result;
+}
+
+//! @cond INTERNALS
+namespace Internals {
+
+const unsigned char base16_decode[256] =
+{
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF
+};
+
+const char base64_encode[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+const unsigned char base64_decode[256] =
+{
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3e, 0xFF, 0xFF, 0xFF, 0x3f,
+    0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x3b, 0x3c, 0x3d, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e,
+    0x0f, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28,
+    0x29, 0x2a, 0x2b, 0x2c, 0x2d, 0x2e, 0x2f, 0x30, 0x31, 0x32, 0x33, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF
+};
+
+const char base32_encode[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZ234567";
+
+const unsigned char base32_decode[128] =
+{
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06,
+    0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e,
+    0x0f, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16,
+    0x17, 0x18, 0x19, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06,
+    0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e,
+    0x0f, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16,
+    0x17, 0x18, 0x19, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF
+};
+
+// Count of trailing one bits of the mask
+inline unsigned TrailingOnes(uint64_t mask) noexcept
+{
+    mask = ~mask;
+#if defined(_MSC_VER)
+    unsigned long index;
+#if defined(_M_X64)
+    _BitScanForward64(&index, mask);
+#else
+    if (!_BitScanForward(&index, (unsigned long)mask))
+    {
+        _BitScanForward(&index, (unsigned long)(mask >> 32));
+        index += 32;
+    }
+#endif
+    return (unsigned)index;
+#else
+    return (unsigned)__builtin_ctzll(mask);
+#endif
+}
+
+// Is the given character not escaped by URL encoding?
+inline bool IsURLSafe(char ch) noexcept
+{
+    return ((ch >= 'a') && (ch <= 'z')) || ((ch >= 'A') && (ch <= 'Z')) || ((ch >= '-') && (ch <= '9')) || (ch == '_') || (ch == '~');
+}
+
+#if defined(CPPCOMMON_ENCODING_SSE2)
+
+// Mask of 16 characters which are not escaped by URL encoding
+inline unsigned URLSafeMask(__m128i chars) noexcept
+{
+    // Signed comparison skips all non ASCII characters
+    __m128i letters = _mm_sub_epi8(_mm_or_si128(chars, _mm_set1_epi8(0x20)), _mm_set1_epi8('a'));
+    // Range from '-' to '9' contains '-', '.', '/' and digits
+    __m128i digits = _mm_sub_epi8(chars, _mm_set1_epi8('-'));
+    __m128i safe = _mm_and_si128(_mm_cmpgt_epi8(letters, _mm_set1_epi8(-1)), _mm_cmplt_epi8(letters, _mm_set1_epi8(26)));
+    safe = _mm_or_si128(safe, _mm_and_si128(_mm_cmpgt_epi8(digits, _mm_set1_epi8(-1)), _mm_cmplt_epi8(digits, _mm_set1_epi8('9' - '-' + 1))));
+    safe = _mm_or_si128(safe, _mm_cmpeq_epi8(chars, _mm_set1_epi8('_')));
+    safe = _mm_or_si128(safe, _mm_cmpeq_epi8(chars, _mm_set1_epi8('~')));
+    return (unsigned)_mm_movemask_epi8(safe);
+}
+
+#endif
+
+#if defined(CPPCOMMON_ENCODING_AVX2)
+
+// Convert 32 sextets into Base64 characters
+CPPCOMMON_ENCODING_AVX2_TARGET inline __m256i Base64Chars(__m256i indices) noexcept
+{
+    // Map sextets ranges [0..25], [26..51], [52..61], 62, 63 into the offsets table indexes
+    __m256i result = _mm256_subs_epu8(indices, _mm256_set1_epi8(51));
+    __m256i less = _mm256_cmpgt_epi8(_mm256_set1_epi8(26), indices);
+    result = _mm256_or_si256(result, _mm256_and_si256(less, _mm256_set1_epi8(13)));
+    const __m256i offsets = _mm256_setr_epi8(
+        'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0,
+        'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0);
+    return _mm256_add_epi8(_mm256_shuffle_epi8(offsets, result), indices);
+}
+
+// Base64 encode blocks of 24 bytes into 32 characters
+CPPCOMMON_ENCODING_AVX2_TARGET void Base64EncodeAVX2(const uint8_t*& input, size_t& size, char*& output) noexcept
+{
+    const __m256i shuffle = _mm256_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10, 1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10);
+
+    // Each lane loads 16 bytes and uses 12 of them, so 28 bytes must be available
+    for (; size >= 28; size -= 24, input += 24, output += 32)
+    {
+        __m256i bytes = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128((const __m128i*)input)), _mm_loadu_si128((const __m128i*)(input + 12)), 1);
+        bytes = _mm256_shuffle_epi8(bytes, shuffle);
+
+        // Split each 3 bytes into 4 sextets with multiplications instead of variable shifts
+        __m256i t0 = _mm256_mulhi_epu16(_mm256_and_si256(bytes, _mm256_set1_epi32(0x0FC0FC00)), _mm256_set1_epi32(0x04000040));
+        __m256i t1 = _mm256_mullo_epi16(_mm256_and_si256(bytes, _mm256_set1_epi32(0x003F03F0)), _mm256_set1_epi32(0x01000010));
+        _mm256_storeu_si256((__m256i*)output, Base64Chars(_mm256_or_si256(t0, t1)));
+    }
+}
+
+// Base64 decode blocks of 32 characters into 24 bytes
+CPPCOMMON_ENCODING_AVX2_TARGET bool Base64DecodeAVX2(const char*& input, size_t& size, uint8_t*& output) noexcept
+{
+    const __m256i lo_table = _mm256_setr_epi8(
+        0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A,
+        0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A);
+    const __m256i hi_table = _mm256_setr_epi8(
+        0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+        0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+    const __m256i roll_table = _mm256_setr_epi8(
+        0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0);
+    const __m256i shuffle = _mm256_setr_epi8(
+        2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1,
+        2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1);
+    const __m256i mask = _mm256_set1_epi8(0x0F);
+
+    // The last 4 characters are always decoded by the scalar code because they could be padded
+    for (; size >= 36; size -= 32, input += 32, output += 24)
+    {
+        __m256i chars = _mm256_loadu_si256((const __m256i*)input);
+
+        // Validate characters with the nibbles classes tables
+        __m256i hi_nibbles = _mm256_and_si256(_mm256_srli_epi32(chars, 4), mask);
+        __m256i lo_nibbles = _mm256_and_si256(chars, mask);
+        if (!_mm256_testz_si256(_mm256_shuffle_epi8(lo_table, lo_nibbles), _mm256_shuffle_epi8(hi_table, hi_nibbles)))
+            return false;
+
+        // Convert characters into sextets
+        __m256i roll = _mm256_shuffle_epi8(roll_table, _mm256_add_epi8(_mm256_cmpeq_epi8(chars, _mm256_set1_epi8('/')), hi_nibbles));
+        __m256i sextets = _mm256_add_epi8(chars, roll);
+
+        // Join each 4 sextets into 3 bytes
+        __m256i pairs = _mm256_maddubs_epi16(sextets, _mm256_set1_epi32(0x01400140));
+        __m256i triples = _mm256_madd_epi16(pairs, _mm256_set1_epi32(0x00011000));
+        __m256i bytes = _mm256_shuffle_epi8(triples, shuffle);
+        bytes = _mm256_permutevar8x32_epi32(bytes, _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 7, 7));
+        _mm_storeu_si128((__m128i*)output, _mm256_castsi256_si128(bytes));
+        _mm_storel_epi64((__m128i*)(output + 16), _mm256_extracti128_si256(bytes, 1));
+    }
+    return true;
+}
+
+#endif
+
+#if defined(CPPCOMMON_ENCODING_SSE2)
+
+// Convert 16 hex characters into their nibble values
+inline bool Base16Nibbles(__m128i chars, __m128i& nibbles) noexcept
+{
+    __m128i digits = _mm_sub_epi8(chars, _mm_set1_epi8('0'));
+    __m128i is_digit = _mm_and_si128(_mm_cmpgt_epi8(digits, _mm_set1_epi8(-1)), _mm_cmplt_epi8(digits, _mm_set1_epi8(10)));
+    __m128i letters = _mm_sub_epi8(_mm_or_si128(chars, _mm_set1_epi8(0x20)), _mm_set1_epi8('a'));
+    __m128i is_letter = _mm_and_si128(_mm_cmpgt_epi8(letters, _mm_set1_epi8(-1)), _mm_cmplt_epi8(letters, _mm_set1_epi8(6)));
+    nibbles = _mm_or_si128(_mm_and_si128(digits, is_digit), _mm_and_si128(_mm_add_epi8(letters, _mm_set1_epi8(10)), is_letter));
+    return (_mm_movemask_epi8(_mm_or_si128(is_digit, is_letter)) == 0xFFFF);
+}
+
+#endif
+
+} // namespace Internals
+//! @endcond
+
+char* Encoding::Base16Encode(const void* buffer, size_t size, char* output, bool lowercase) noexcept
+{
+    const char* base16 = lowercase ? "0123456789abcdef" : "0123456789ABCDEF";
+    const uint8_t* input = (const uint8_t*)buffer;
+
+#if defined(CPPCOMMON_ENCODING_SSE2)
+    const __m128i mask = _mm_set1_epi8(0x0F);
+    const __m128i nine = _mm_set1_epi8(9);
+    const __m128i zero = _mm_set1_epi8('0');
+    const __m128i letter = _mm_set1_epi8(lowercase ? ('a' - '0' - 10) : ('A' - '0' - 10));
+
+    // Encode 16 bytes into 32 characters at once
+    for (; size >= 16; size -= 16, input += 16, output += 32)
+    {
+        __m128i bytes = _mm_loadu_si128((const __m128i*)input);
+        __m128i high = _mm_and_si128(_mm_srli_epi16(bytes, 4), mask);
+        __m128i low = _mm_and_si128(bytes, mask);
+        __m128i chars1 = _mm_unpacklo_epi8(high, low);
+        __m128i chars2 = _mm_unpackhi_epi8(high, low);
+        chars1 = _mm_add_epi8(_mm_add_epi8(chars1, zero), _mm_and_si128(_mm_cmpgt_epi8(chars1, nine), letter));
+        chars2 = _mm_add_epi8(_mm_add_epi8(chars2, zero), _mm_and_si128(_mm_cmpgt_epi8(chars2, nine), letter));
+        _mm_storeu_si128((__m128i*)output, chars1);
+        _mm_storeu_si128((__m128i*)(output + 16), chars2);
+    }
+#elif defined(CPPCOMMON_ENCODING_NEON)
+    const uint8x16_t mask = vdupq_n_u8(0x0F);
+    const uint8x16_t nine = vdupq_n_u8(9);
+    const uint8x16_t zero = vdupq_n_u8('0');
+    const uint8x16_t letter = vdupq_n_u8(lowercase ? ('a' - '0' - 10) : ('A' - '0' - 10));
+
+    // Encode 16 bytes into 32 characters at once
+    for (; size >= 16; size -= 16, input += 16, output += 32)
+    {
+        uint8x16_t bytes = vld1q_u8(input);
+        uint8x16_t high = vshrq_n_u8(bytes, 4);
+        uint8x16_t low = vandq_u8(bytes, mask);
+        uint8x16_t chars1 = vzip1q_u8(high, low);
+        uint8x16_t chars2 = vzip2q_u8(high, low);
+        chars1 = vaddq_u8(vaddq_u8(chars1, zero), vandq_u8(vcgtq_u8(chars1, nine), letter));
+        chars2 = vaddq_u8(vaddq_u8(chars2, zero), vandq_u8(vcgtq_u8(chars2, nine), letter));
+        vst1q_u8((uint8_t*)output, chars1);
+        vst1q_u8((uint8_t*)(output + 16), chars2);
+    }
+#endif
+
+    for (; size > 0; --size)
+    {
+        uint8_t ch = *input++;
+        *output++ = base16[(ch & 0xF0) >> 4];
+        *output++ = base16[(ch & 0x0F) >> 0];
+    }
+
+    return output;
+}
+
+bool Encoding::Base16Decode(const char* str, size_t size, void* buffer) noexcept
+{
+    if ((size % 2) != 0)
+        return false;
+
+    uint8_t* output = (uint8_t*)buffer;
+
+#if defined(CPPCOMMON_ENCODING_SSE2)
+    // Decode 32 characters into 16 bytes at once
+    for (; size >= 32; size -= 32, str += 32, output += 16)
+    {
+        __m128i nibbles1, nibbles2;
+        if (!Internals::Base16Nibbles(_mm_loadu_si128((const __m128i*)str), nibbles1) || !Internals::Base16Nibbles(_mm_loadu_si128((const __m128i*)(str + 16)), nibbles2))
+            return false;
+
+        // Join high and low nibbles of each 16-bit lane into one byte
+        const __m128i mask = _mm_set1_epi16(0x00FF);
+        __m128i bytes1 = _mm_and_si128(_mm_or_si128(_mm_slli_epi16(nibbles1, 4), _mm_srli_epi16(nibbles1, 8)), mask);
+        __m128i bytes2 = _mm_and_si128(_mm_or_si128(_mm_slli_epi16(nibbles2, 4), _mm_srli_epi16(nibbles2, 8)), mask);
+        _mm_storeu_si128((__m128i*)output, _mm_packus_epi16(bytes1, bytes2));
+    }
+#elif defined(CPPCOMMON_ENCODING_NEON)
+    const uint8x16_t zero = vdupq_n_u8('0');
+    const uint8x16_t lower = vdupq_n_u8(0x20);
+    const uint8x16_t a = vdupq_n_u8('a');
+    const uint8x16_t ten = vdupq_n_u8(10);
+    const uint8x16_t six = vdupq_n_u8(6);
+
+    // Decode 32 characters into 16 bytes at once
+    for (; size >= 32; size -= 32, str += 32, output += 16)
+    {
+        uint8x16x2_t chars = vld2q_u8((const uint8_t*)str);
+        uint8x16_t nibbles[2];
+        for (int i = 0; i < 2; ++i)
+        {
+            uint8x16_t digits = vsubq_u8(chars.val[i], zero);
+            uint8x16_t is_digit = vcltq_u8(digits, ten);
+            uint8x16_t letters = vsubq_u8(vorrq_u8(chars.val[i], lower), a);
+            uint8x16_t is_letter = vcltq_u8(letters, six);
+            if (vminvq_u8(vorrq_u8(is_digit, is_letter)) != 0xFF)
+                return false;
+            nibbles[i] = vorrq_u8(vandq_u8(digits, is_digit), vandq_u8(vaddq_u8(letters, ten), is_letter));
+        }
+        vst1q_u8(output, vorrq_u8(vshlq_n_u8(nibbles[0], 4), nibbles[1]));
+    }
+#endif
+
+    for (; size > 0; size -= 2)
+    {
+        uint8_t a = Internals::base16_decode[(uint8_t)*str++];
+        uint8_t b = Internals::base16_decode[(uint8_t)*str++];
+        if ((a | b) == 0xFF)
+            return false;
+        *output++ = (uint8_t)((a << 4) | b);
+    }
+
+    return true;
+}
+
+std::string Encoding::Base16Encode(std::string_view str)
+{
+    std::string result;
+    result.resize(str.length() * 2, 0);
+    Base16Encode(str.data(), str.length(), result.data());
+    return result;
+}
+
+std::string Encoding::Base16Decode(std::string_view str)
+{
+    size_t ilength = str.length();
+
+    assert(((ilength % 2) == 0) && "Invalid Base16 sting!");
+    if ((ilength % 2) != 0)
+        return "";
+
+    std::string result;
+    result.resize(ilength / 2, 0);
+
+    [[maybe_unused]] bool decoded = Base16Decode(str.data(), ilength, result.data());
+    assert(decoded && "Invalid Base16 content!");
+    if (!decoded)
+        return "";
+
+    return result;
+}
+
+size_t Encoding::Base32Encode(std::string_view str, char* output) noexcept
+{
+    const uint8_t* input = (const uint8_t*)str.data();
+    size_t size = str.size();
+    char* start = output;
+
+    // Encode 5 bytes into 8 characters
+    for (; size >= 5; size -= 5, input += 5, output += 8)
+    {
+        uint64_t block = ((uint64_t)input[0] << 32) | ((uint64_t)input[1] << 24) | ((uint64_t)input[2] << 16) | ((uint64_t)input[3] << 8) | (uint64_t)input[4];
+        for (int i = 0; i < 8; ++i)
+            output[i] = Internals::base32_encode[(block >> (35 - 5 * i)) & 0x1F];
+    }
+
+    // Encode the last block with padding
+    if (size > 0)
+    {
+        const size_t chars[] = { 0, 2, 4, 5, 7 };
+        uint64_t block = 0;
+        for (size_t i = 0; i < size; ++i)
+            block |= (uint64_t)input[i] << (32 - 8 * i);
+        for (size_t i = 0; i < 8; ++i)
+            output[i] = (i < chars[size]) ? Internals::base32_encode[(block >> (35 - 5 * i)) & 0x1F] : '=';
+        output += 8;
+    }
+
+    return (size_t)(output - start);
+}
+
+size_t Encoding::Base32Decode(std::string_view str, void* buffer) noexcept
+{
+    size_t size = str.size();
+    if ((size % 8) != 0)
+        return std::string::npos;
+
+    const uint8_t* input = (const uint8_t*)str.data();
+    uint8_t* output = (uint8_t*)buffer;
+    uint8_t* start = output;
+
+    for (; size > 0; size -= 8, input += 8)
+    {
+        // Only the last block could be padded with 1, 3, 4 or 6 characters
+        size_t padding = 0;
+        if (size == 8)
+            while ((padding < 6) && (input[7 - padding] == '='))
+                ++padding;
+        const size_t bytes[] = { 5, 4, 0, 3, 2, 0, 1 };
+        if ((padding > 0) && (bytes[padding] == 0))
+            return std::string::npos;
+
+        uint64_t block = 0;
+        for (size_t i = 0; i < (8 - padding); ++i)
+        {
+            uint8_t value = (input[i] < 0x80) ? Internals::base32_decode[input[i]] : 0xFF;
+            if (value > 31)
+                return std::string::npos;
+            block |= (uint64_t)value << (35 - 5 * i);
+        }
+        for (size_t i = 0; i < bytes[padding]; ++i)
+            *output++ = (uint8_t)(block >> (32 - 8 * i));
+    }
+
+    return (size_t)(output - start);
+}
+
+std::string Encoding::Base32Encode(std::string_view str)
+{
+    std::string result;
+    result.resize(((str.length() + 4) / 5) * 8, 0);
+    Base32Encode(str, result.data());
+    return result;
+}
+
+std::string Encoding::Base32Decode(std::string_view str)
+{
+    size_t ilength = str.length();
+
+    assert(((ilength % 8) == 0) && "Invalid Base32 sting!");
+    if ((ilength % 8) != 0)
+        return "";
+
+    std::string result;
+    result.resize((ilength / 8) * 5, 0);
+
+    size_t olength = Base32Decode(str, result.data());
+    assert((olength != std::string::npos) && "Invalid Base32 content!");
+    if (olength == std::string::npos)
+        return "";
+
+    result.resize(olength);
+    return result;
+}
+
+size_t Encoding::Base64Encode(std::string_view str, char* output) noexcept
+{
+    const uint8_t* input = (const uint8_t*)str.data();
+    size_t size = str.size();
+    char* start = output;
+
+#if defined(CPPCOMMON_ENCODING_AVX2)
+    static const bool avx2 = CPU::HasAVX2();
+    if (avx2)
+        Internals::Base64EncodeAVX2(input, size, output);
+#elif defined(CPPCOMMON_ENCODING_NEON)
+    uint8x16x4_t table;
+    for (int i = 0; i < 4; ++i)
+        table.val[i] = vld1q_u8((const uint8_t*)Internals::base64_encode + 16 * i);
+    const uint8x16_t mask = vdupq_n_u8(0x3F);
+
+    // Encode 48 bytes into 64 characters at once
+    for (; size >= 48; size -= 48, input += 48, output += 64)
+    {
+        uint8x16x3_t bytes = vld3q_u8(input);
+        uint8x16x4_t chars;
+        chars.val[0] = vshrq_n_u8(bytes.val[0], 2);
+        chars.val[1] = vandq_u8(vorrq_u8(vshlq_n_u8(bytes.val[0], 4), vshrq_n_u8(bytes.val[1], 4)), mask);
+        chars.val[2] = vandq_u8(vorrq_u8(vshlq_n_u8(bytes.val[1], 2), vshrq_n_u8(bytes.val[2], 6)), mask);
+        chars.val[3] = vandq_u8(bytes.val[2], mask);
+        for (int i = 0; i < 4; ++i)
+            chars.val[i] = vqtbl4q_u8(table, chars.val[i]);
+        vst4q_u8((uint8_t*)output, chars);
+    }
+#endif
+
+    // Encode 3 bytes into 4 characters
+    for (; size >= 3; size -= 3, input += 3, output += 4)
+    {
+        uint32_t triple = ((uint32_t)input[0] << 16) | ((uint32_t)input[1] << 8) | (uint32_t)input[2];
+        output[0] = Internals::base64_encode[(triple >> 18) & 0x3F];
+        output[1] = Internals::base64_encode[(triple >> 12) & 0x3F];
+        output[2] = Internals::base64_encode[(triple >> 6) & 0x3F];
+        output[3] = Internals::base64_encode[triple & 0x3F];
+    }
+
+    // Encode the last 1 or 2 bytes with padding
+    if (size > 0)
+    {
+        uint32_t triple = ((uint32_t)input[0] << 16) | ((size > 1) ? ((uint32_t)input[1] << 8) : 0);
+        output[0] = Internals::base64_encode[(triple >> 18) & 0x3F];
+        output[1] = Internals::base64_encode[(triple >> 12) & 0x3F];
+        output[2] = (size > 1) ? Internals::base64_encode[(triple >> 6) & 0x3F] : '=';
+        output[3] = '=';
+        output += 4;
+    }
+
+    return (size_t)(output - start);
+}
+
+size_t Encoding::Base64Decode(std::string_view str, void* buffer) noexcept
+{
+    size_t size = str.size();
+    if ((size % 4) != 0)
+        return std::string::npos;
+    if (size == 0)
+        return 0;
+
+    const char* input = str.data();
+    uint8_t* output = (uint8_t*)buffer;
+    uint8_t* start = output;
+
+#if defined(CPPCOMMON_ENCODING_AVX2)
+    static const bool avx2 = CPU::HasAVX2();
+    if (avx2 && !Internals::Base64DecodeAVX2(input, size, output))
+        return std::string::npos;
+#elif defined(CPPCOMMON_ENCODING_NEON)
+    uint8x16x4_t lo_table, hi_table;
+    for (int i = 0; i < 4; ++i)
+    {
+        lo_table.val[i] = vld1q_u8(Internals::base64_decode + 16 * i);
+        hi_table.val[i] = vld1q_u8(Internals::base64_decode + 64 + 16 * i);
+    }
+
+    // Decode 64 characters into 48 bytes at once keeping the last 4 characters for the scalar code
+    for (; size >= 68; size -= 64, input += 64, output += 48)
+    {
+        uint8x16x4_t chars = vld4q_u8((const uint8_t*)input);
+        uint8x16_t invalid = vdupq_n_u8(0);
+        for (int i = 0; i < 4; ++i)
+        {
+            uint8x16_t value = vqtbl4q_u8(lo_table, chars.val[i]);
+            value = vqtbx4q_u8(value, hi_table, vsubq_u8(chars.val[i], vdupq_n_u8(64)));
+            chars.val[i] = vorrq_u8(value, vcgeq_u8(chars.val[i], vdupq_n_u8(0x80)));
+            invalid = vorrq_u8(invalid, chars.val[i]);
+        }
+        if (vmaxvq_u8(invalid) > 0x3F)
+            return std::string::npos;
+
+        uint8x16x3_t bytes;
+        bytes.val[0] = vorrq_u8(vshlq_n_u8(chars.val[0], 2), vshrq_n_u8(chars.val[1], 4));
+        bytes.val[1] = vorrq_u8(vshlq_n_u8(chars.val[1], 4), vshrq_n_u8(chars.val[2], 2));
+        bytes.val[2] = vorrq_u8(vshlq_n_u8(chars.val[2], 6), chars.val[3]);
+        vst3q_u8(output, bytes);
+    }
+#endif
+
+    // Decode 4 characters into 3 bytes keeping the last 4 characters
+    for (; size > 4; size -= 4, input += 4, output += 3)
+    {
+        uint32_t a = Internals::base64_decode[(uint8_t)input[0]];
+        uint32_t b = Internals::base64_decode[(uint8_t)input[1]];
+        uint32_t c = Internals::base64_decode[(uint8_t)input[2]];
+        uint32_t d = Internals::base64_decode[(uint8_t)input[3]];
+        if (((a | b | c | d) & 0x80) != 0)
+            return std::string::npos;
+        uint32_t triple = (a << 18) | (b << 12) | (c << 6) | d;
+        output[0] = (uint8_t)(triple >> 16);
+        output[1] = (uint8_t)(triple >> 8);
+        output[2] = (uint8_t)triple;
+    }
+
+    // Decode the last 4 characters which could be padded with 1 or 2 characters
+    size_t padding = (input[3] == '=') ? ((input[2] == '=') ? 2 : 1) : 0;
+    uint32_t a = Internals::base64_decode[(uint8_t)input[0]];
+    uint32_t b = Internals::base64_decode[(uint8_t)input[1]];
+    uint32_t c = (padding < 2) ? Internals::base64_decode[(uint8_t)input[2]] : 0;
+    uint32_t d = (padding < 1) ? Internals::base64_decode[(uint8_t)input[3]] : 0;
+    if (((a | b | c | d) & 0x80) != 0)
+        return std::string::npos;
+    uint32_t triple = (a << 18) | (b << 12) | (c << 6) | d;
+    *output++ = (uint8_t)(triple >> 16);
+    if (padding < 2)
+        *output++ = (uint8_t)(triple >> 8);
+    if (padding < 1)
+        *output++ = (uint8_t)triple;
+
+    return (size_t)(output - start);
+}
+
+std::string Encoding::Base64Encode(std::string_view str)
+{
+    std::string result;
+    result.resize(4 * ((str.length() + 2) / 3), 0);
+    Base64Encode(str, result.data());
+    return result;
+}
+
+std::string Encoding::Base64Decode(std::string_view str)
+{
+    size_t ilength = str.length();
+
+    if ((ilength % 4) != 0)
+        return "";
+
+    std::string result;
+    result.resize((ilength / 4) * 3, 0);
+
+    size_t olength = Base64Decode(str, result.data());
+    if (olength == std::string::npos)
+        return "";
+
+    result.resize(olength);
+    return result;
+}
+
+size_t Encoding::URLEncode(std::string_view str, char* output) noexcept
+{
+    const char hex[] = "0123456789ABCDEF";
+
+    const char* input = str.data();
+    size_t size = str.size();
+    char* start = output;
+
+    while (size > 0)
+    {
+#if defined(CPPCOMMON_ENCODING_SSE2)
+        // Copy 16 characters at once while they are not escaped
+        if (size >= 16)
+        {
+            __m128i chars = _mm_loadu_si128((const __m128i*)input);
+            _mm_storeu_si128((__m128i*)output, chars);
+            unsigned safe = Internals::TrailingOnes(Internals::URLSafeMask(chars));
+            input += safe;
+            output += safe;
+            size -= safe;
+            if (safe == 16)
+                continue;
+        }
+#elif defined(CPPCOMMON_ENCODING_NEON)
+        // Copy 16 characters at once while they are not escaped
+        if (size >= 16)
+        {
+            uint8x16_t chars = vld1q_u8((const uint8_t*)input);
+            vst1q_u8((uint8_t*)output, chars);
+            uint8x16_t letters = vsubq_u8(vorrq_u8(chars, vdupq_n_u8(0x20)), vdupq_n_u8('a'));
+            uint8x16_t digits = vsubq_u8(chars, vdupq_n_u8('-'));
+            uint8x16_t safe = vorrq_u8(vcltq_u8(letters, vdupq_n_u8(26)), vcltq_u8(digits, vdupq_n_u8('9' - '-' + 1)));
+            safe = vorrq_u8(safe, vorrq_u8(vceqq_u8(chars, vdupq_n_u8('_')), vceqq_u8(chars, vdupq_n_u8('~'))));
+            uint64_t mask = vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(safe), 4)), 0);
+            unsigned count = (mask == ~0ull) ? 16 : (Internals::TrailingOnes(mask) / 4);
+            input += count;
+            output += count;
+            size -= count;
+            if (count == 16)
+                continue;
+        }
+#endif
+        char ch = *input++;
+        --size;
+
+        if (Internals::IsURLSafe(ch))
+            *output++ = ch;
+        else if (ch == ' ')
+            *output++ = '+';
+        else
+        {
+            *output++ = '%';
+            *output++ = hex[((uint8_t)ch >> 4) & 0x0F];
+            *output++ = hex[((uint8_t)ch >> 0) & 0x0F];
+        }
+    }
+
+    return (size_t)(output - start);
+}
+
+std::string Encoding::URLEncode(std::string_view str)
 {
-#if defined(__CYGWIN__) || defined(__MINGW32__) || defined(__MINGW64__)
-    std::wstring_convert<std::codecvt_utf8_utf16<char16_t>, char16_t> convert;
-    return convert.to_bytes((char16_t*)wstr.data(), (char16_t*)wstr.data() + wstr.size());
-#elif defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
-    std::wstring_convert<std::codecvt_utf8<wchar_t>> convert;
-    return convert.to_bytes(wstr.data(), wstr.data() + wstr.size());
-#elif defined(_WIN32) || defined(_WIN64)
-    std::wstring_convert<std::codecvt_utf8_utf16<wchar_t>> convert;
-    return convert.to_bytes(wstr.data(), wstr.data() + wstr.size());
-#endif
+    std::string result;
+    result.resize(str.size() * 3, 0);
+    result.resize(URLEncode(str, result.data()));
+    return result;
 }
 
-std::wstring Encoding::FromUTF8(std::string_view str)
+std::string Encoding::URLDecode(std::string_view str)
 {
-#if defined(__CYGWIN__) || defined(__MINGW32__) || defined(__MINGW64__)
-    std::wstring_convert<std::codecvt_utf8_utf16<char16_t>, char16_t> convert;
-    auto tmp = convert.from_bytes(str.data(), str.data() + str.size());
-    return std::wstring(tmp.data(), tmp.data() + tmp.size());
-#elif defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
-    std::wstring_convert<std::codecvt_utf8<wchar_t>> convert;
-    return convert.from_bytes(str.data(), str.data() + str.size());
-#elif defined(_WIN32) || defined(_WIN64)
-    std::wstring_convert<std::codecvt_utf8_utf16<wchar_t>> convert;
-    return convert.from_bytes(str.data(), str.data() + str.size());
-#endif
+    std::string result;
+    result.reserve(str.size());
+
+    for (size_t i = 0; i < str.size(); ++i)
+    {
+        char ch = str[i];
+        if (ch == '%')
+        {
+            const char hex[] = "0123456789ABCDEF";
+
+            if (++i == str.size())
+            {
+                result.push_back('?');
+                break;
+            }
+
+            int hi = (int)(std::find(hex, hex + 16, toupper(str[i])) - hex);
+
+            if (++i == str.size())
+            {
+                result.push_back('?');
+                break;
+            }
+
+            int lo = (int)(std::find(hex, hex + 16, toupper(str[i])) - hex);
+
+            if ((hi >= 16) || (lo >= 16))
+            {
+                result.push_back('?');
+                break;
+            }
+
+            result.push_back((char)((hi << 4) + lo));
+        }
+        else if (ch == '+')
+            result.push_back(' ');
+        else
+            result.push_back(ch);
+    }
+
+    return result;
 }
+//! @cond INTERNALS
+namespace Internals {
 
-std::u16string Encoding::UTF8toUTF16(std::string_view str)
+#if defined(CPPCOMMON_ENCODING_SSE2)
+
+// Count of leading characters which are not special by the given mask of 16 characters
+template <class TSpecial>
+inline size_t PlainRun(const char* input, size_t size, TSpecial special) noexcept
 {
-#if defined(_MSC_VER)
-    std::wstring_convert<std::codecvt_utf8_utf16<uint16_t>, uint16_t> convert;
-    auto tmp = convert.from_bytes(str.data(), str.data() + str.size());
-    return std::u16string(tmp.data(), tmp.data() + tmp.size());
-#else
-    std::wstring_convert<std::codecvt_utf8_utf16<char16_t>, char16_t> convert;
-    return convert.from_bytes(str.data(), str.data() + str.size());
-#endif
+    size_t count = 0;
+    for (; (size - count) >= 16; count += 16)
+    {
+        unsigned mask = (unsigned)_mm_movemask_epi8(special(_mm_loadu_si128((const __m128i*)(input + count))));
+        if (mask != 0)
+            return count + TrailingOnes(~(uint64_t)mask);
+    }
+    return count;
 }
 
-std::u32string Encoding::UTF8toUTF32(std::string_view str)
+#elif defined(CPPCOMMON_ENCODING_NEON)
+
+// Count of leading characters which are not special by the given mask of 16 characters
+template <class TSpecial>
+inline size_t PlainRun(const char* input, size_t size, TSpecial special) noexcept
 {
-#if defined(_MSC_VER)
-    std::wstring_convert<std::codecvt_utf8<uint32_t>, uint32_t> convert;
-    auto tmp = convert.from_bytes(str.data(), str.data() + str.size());
-    return std::u32string(tmp.data(), tmp.data() + tmp.size());
-#else
-    std::wstring_convert<std::codecvt_utf8<char32_t>, char32_t> convert;
-    return convert.from_bytes(str.data(), str.data() + str.size());
+    size_t count = 0;
+    for (; (size - count) >= 16; count += 16)
+    {
+        uint8x16_t chars = special(vld1q_u8((const uint8_t*)(input + count)));
+        uint64_t mask = vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(chars), 4)), 0);
+        if (mask != 0)
+            return count + TrailingOnes(~mask) / 4;
+    }
+    return count;
+}
+
 #endif
+
+// Is the given character escaped in JSON strings?
+inline bool IsJsonSpecial(char ch) noexcept
+{
+    return ((uint8_t)ch < 0x20) || (ch == '"') || (ch == '\\');
 }
 
-std::string Encoding::UTF16toUTF8(std::u16string_view str)
+// Count of leading characters which are not escaped in JSON strings
+inline size_t JsonPlainRun(const char* input, size_t size) noexcept
 {
-#if defined(_MSC_VER)
-    std::wstring_convert<std::codecvt_utf8_utf16<uint16_t>, uint16_t> convert;
-    return convert.to_bytes((uint16_t*)str.data(), (uint16_t*)str.data() + str.size());
+#if defined(CPPCOMMON_ENCODING_SSE2)
+    size_t count = PlainRun(input, size, [](__m128i chars)
+    {
+        // Unsigned comparison keeps characters of UTF-8 sequences
+        __m128i control = _mm_cmpeq_epi8(_mm_min_epu8(chars, _mm_set1_epi8(0x1F)), chars);
+        return _mm_or_si128(control, _mm_or_si128(_mm_cmpeq_epi8(chars, _mm_set1_epi8('"')), _mm_cmpeq_epi8(chars, _mm_set1_epi8('\\'))));
+    });
+#elif defined(CPPCOMMON_ENCODING_NEON)
+    size_t count = PlainRun(input, size, [](uint8x16_t chars)
+    {
+        uint8x16_t control = vcltq_u8(chars, vdupq_n_u8(0x20));
+        return vorrq_u8(control, vorrq_u8(vceqq_u8(chars, vdupq_n_u8('"')), vceqq_u8(chars, vdupq_n_u8('\\'))));
+    });
 #else
-    std::wstring_convert<std::codecvt_utf8_utf16<char16_t>, char16_t> convert;
-    return convert.to_bytes(str.data(), str.data() + str.size());
+    size_t count = 0;
 #endif
+    while ((count < size) && !IsJsonSpecial(input[count]))
+        ++count;
+    return count;
 }
 
-std::u32string Encoding::UTF16toUTF32(std::u16string_view str)
+// Is the given character escaped in HTML?
+inline bool IsHtmlSpecial(char ch) noexcept
 {
-    std::string bytes;
-    bytes.reserve(str.size() * 2);
+    return (ch == '&') || (ch == '<') || (ch == '>') || (ch == '"') || (ch == '\'');
+}
 
-    for (const char16_t ch : str)
+// Count of leading characters which are not escaped in HTML
+inline size_t HtmlPlainRun(const char* input, size_t size) noexcept
+{
+#if defined(CPPCOMMON_ENCODING_SSE2)
+    size_t count = PlainRun(input, size, [](__m128i chars)
     {
-        bytes.push_back((uint8_t)(ch / 256));
-        bytes.push_back((uint8_t)(ch % 256));
-    }
-
-#if defined(_MSC_VER)
-    std::wstring_convert<std::codecvt_utf16<uint32_t>, uint32_t> convert;
-    auto tmp = convert.from_bytes(bytes);
-    return std::u32string(tmp.data(), tmp.data() + tmp.size());
+        __m128i special = _mm_or_si128(_mm_cmpeq_epi8(chars, _mm_set1_epi8('&')), _mm_cmpeq_epi8(chars, _mm_set1_epi8('<')));
+        special = _mm_or_si128(special, _mm_or_si128(_mm_cmpeq_epi8(chars, _mm_set1_epi8('>')), _mm_cmpeq_epi8(chars, _mm_set1_epi8('"'))));
+        return _mm_or_si128(special, _mm_cmpeq_epi8(chars, _mm_set1_epi8('\'')));
+    });
+#elif defined(CPPCOMMON_ENCODING_NEON)
+    size_t count = PlainRun(input, size, [](uint8x16_t chars)
+    {
+        uint8x16_t special = vorrq_u8(vceqq_u8(chars, vdupq_n_u8('&')), vceqq_u8(chars, vdupq_n_u8('<')));
+        special = vorrq_u8(special, vorrq_u8(vceqq_u8(chars, vdupq_n_u8('>')), vceqq_u8(chars, vdupq_n_u8('"'))));
+        return vorrq_u8(special, vceqq_u8(chars, vdupq_n_u8('\'')));
+    });
 #else
-    std::wstring_convert<std::codecvt_utf16<char32_t>, char32_t> convert;
-    return convert.from_bytes(bytes);
+    size_t count = 0;
 #endif
+    while ((count < size) && !IsHtmlSpecial(input[count]))
+        ++count;
+    return count;
 }
 
-std::string Encoding::UTF32toUTF8(std::u32string_view str)
+// Is the given character requires the CSV field to be quoted?
+inline bool IsCsvSpecial(char ch, char delimiter) noexcept
 {
-#if defined(_MSC_VER)
-    std::wstring_convert<std::codecvt_utf8<uint32_t>, uint32_t> convert;
-    return convert.to_bytes((uint32_t*)str.data(), (uint32_t*)str.data() + str.size());
-#else
-    std::wstring_convert<std::codecvt_utf8<char32_t>, char32_t> convert;
-    return convert.to_bytes(str.data(), str.data() + str.size());
-#endif
+    return (ch == delimiter) || (ch == '"') || (ch == '\r') || (ch == '\n');
 }
 
-std::u16string Encoding::UTF32toUTF16(std::u32string_view str)
+// Count of leading characters which do not require the CSV field to be quoted
+inline size_t CsvPlainRun(const char* input, size_t size, char delimiter) noexcept
 {
-#if defined(_MSC_VER)
-    std::wstring_convert<std::codecvt_utf16<uint32_t>, uint32_t> convert;
-    std::string bytes = convert.to_bytes((uint32_t*)str.data(), (uint32_t*)str.data() + str.size());
+#if defined(CPPCOMMON_ENCODING_SSE2)
+    size_t count = PlainRun(input, size, [delimiter](__m128i chars)
+    {
+        __m128i special = _mm_or_si128(_mm_cmpeq_epi8(chars, _mm_set1_epi8(delimiter)), _mm_cmpeq_epi8(chars, _mm_set1_epi8('"')));
+        return _mm_or_si128(special, _mm_or_si128(_mm_cmpeq_epi8(chars, _mm_set1_epi8('\r')), _mm_cmpeq_epi8(chars, _mm_set1_epi8('\n'))));
+    });
+#elif defined(CPPCOMMON_ENCODING_NEON)
+    size_t count = PlainRun(input, size, [delimiter](uint8x16_t chars)
+    {
+        uint8x16_t special = vorrq_u8(vceqq_u8(chars, vdupq_n_u8((uint8_t)delimiter)), vceqq_u8(chars, vdupq_n_u8('"')));
+        return vorrq_u8(special, vorrq_u8(vceqq_u8(chars, vdupq_n_u8('\r')), vceqq_u8(chars, vdupq_n_u8('\n'))));
+    });
 #else
-    std::wstring_convert<std::codecvt_utf16<char32_t>, char32_t> convert;
-    std::string bytes = convert.to_bytes(str.data(), str.data() + str.size());
+    size_t count = 0;
 #endif
-
-    std::u16string result;
-    result.reserve(bytes.size() / 2);
-
-    for (size_t i = 0; i < bytes.size(); i += 2)
-        result.push_back((char16_t)((uint8_t)(bytes[i]) * 256 + (uint8_t)(bytes[i + 1])));
-
-    return result;
+    while ((count < size) && !IsCsvSpecial(input[count], delimiter))
+        ++count;
+    return count;
 }
 
-std::string Encoding::Base16Encode(std::string_view str)
+// Escape the string into the writer in chunks through the local buffer
+template <class TEscape>
+inline size_t EscapeChunks(std::string_view str, Writer& writer, size_t ratio, TEscape escape)
 {
-    const char base16[] = "0123456789ABCDEF";
-
-    size_t ilength = str.length();
-    size_t olength = ilength * 2;
-
-    std::string result;
-    result.resize(olength, 0);
+    // Reserve two characters for the enclosing quotes of CSV fields
+    char buffer[6144];
+    const size_t chunk = (sizeof(buffer) - 2) / ratio;
+
+    size_t written = 0;
+    for (size_t offset = 0; offset < str.size(); offset += chunk)
+        written += writer.Write(buffer, escape(str.substr(offset, chunk), buffer));
+    return written;
+}
 
-    for (size_t i = 0, j = 0; i < ilength;)
+// Parse the given count of hex digits
+inline bool ParseHex(const char* input, size_t count, uint32_t& value) noexcept
+{
+    value = 0;
+    for (size_t i = 0; i < count; ++i)
     {
-        uint8_t ch = (uint8_t)str[i++];
-
-        result[j++] = base16[(ch & 0xF0) >> 4];
-        result[j++] = base16[(ch & 0x0F) >> 0];
+        char ch = input[i];
+        uint32_t digit;
+        if ((ch >= '0') && (ch <= '9'))
+            digit = ch - '0';
+        else if ((ch >= 'a') && (ch <= 'f'))
+            digit = ch - 'a' + 10;
+        else if ((ch >= 'A') && (ch <= 'F'))
+            digit = ch - 'A' + 10;
+        else
+            return false;
+        value = (value << 4) | digit;
     }
-
-    return result;
+    return true;
 }
 
-std::string Encoding::Base16Decode(std::string_view str)
+// Parse the HTML entity name (without '&' and ';') into the code point
+inline bool ParseHtmlEntity(std::string_view name, uint32_t& code) noexcept
 {
-    static const unsigned char base16[128] =
-    {
-        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-        0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
-        0x08, 0x09, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-        0xFF, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0xFF,
-        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-        0xFF, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0xFF,
-        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF
-    };
-
-    size_t ilength = str.length();
-
-    assert(((ilength % 2) == 0) && "Invalid Base16 sting!");
-    if ((ilength % 2) != 0)
-        return "";
-
-    size_t olength = ilength / 2;
-
-    std::string result;
-    result.resize(olength, 0);
-
-    for (size_t i = 0, j = 0; i < ilength;)
+    if (name == "amp")
+        code = '&';
+    else if (name == "lt")
+        code = '<';
+    else if (name == "gt")
+        code = '>';
+    else if (name == "quot")
+        code = '"';
+    else if (name == "apos")
+        code = '\'';
+    else if ((name.size() > 1) && (name[0] == '#'))
     {
-        uint8_t a = (uint8_t)str[i++];
-        uint8_t b = (uint8_t)str[i++];
-
-        // Validate ASCII
-        assert(((a < 0x80) && (b < 0x80)) && "Invalid Base16 content!");
-        if ((a >= 0x80) || (b >= 0x80))
-            return "";
-
-        // Convert ASCII to Base16
-        a = base16[a];
-        b = base16[b];
+        code = 0;
+        if ((name[1] == 'x') || (name[1] == 'X'))
+        {
+            if ((name.size() < 3) || (name.size() > 8) || !ParseHex(name.data() + 2, name.size() - 2, code))
+                return false;
+        }
+        else
+        {
+            if (name.size() > 8)
+                return false;
+            for (size_t i = 1; i < name.size(); ++i)
+            {
+                if ((name[i] < '0') || (name[i] > '9'))
+                    return false;
+                code = code * 10 + (name[i] - '0');
+            }
+        }
 
-        result[j++] = ((a << 4) | b);
+        // Reject null character, surrogates and code points above U+10FFFF
+        return (code != 0) && ((code < 0xD800) || (code > 0xDFFF)) && (code <= 0x10FFFF);
     }
-
-    return result;
+    else
+        return false;
+    return true;
 }
 
-std::string Encoding::Base32Encode(std::string_view str)
+} // namespace Internals
+//! @endcond
+
+size_t Encoding::JsonEscape(std::string_view str, char* output) noexcept
 {
-    const char base32[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZ234567=";
+    const char hex[] = "0123456789abcdef";
 
-    size_t ilength = str.length();
-    size_t olength = ((ilength / 5) * 8) + ((ilength % 5) ? 8 : 0);
+    const char* input = str.data();
+    size_t size = str.size();
+    char* start = output;
 
-    std::string result;
-    result.resize(olength, 0);
-
-    for (size_t i = 0, j = 0; i < ilength;)
-    {
-        size_t block = ((ilength - i) < 5 ? (ilength - i) : 5);
-        uint8_t n1, n2, n3, n4, n5, n6, n7, n8;
-        n1 = n2 = n3 = n4 = n5 = n6 = n7 = n8 = 0;
-
-        switch (block)
-        {
-            case 5:
-                n8  = (((uint8_t)str[i + 4] & 0x1F) >> 0);
-                n7  = (((uint8_t)str[i + 4] & 0xE0) >> 5);
-            case 4:
-                n7 |= (((uint8_t)str[i + 3] & 0x03) << 3);
-                n6  = (((uint8_t)str[i + 3] & 0x7C) >> 2);
-                n5  = (((uint8_t)str[i + 3] & 0x80) >> 7);
-            case 3:
-                n5 |= (((uint8_t)str[i + 2] & 0x0F) << 1);
-                n4  = (((uint8_t)str[i + 2] & 0xF0) >> 4);
-            case 2:
-                n4 |= (((uint8_t)str[i + 1] & 0x01) << 4);
-                n3  = (((uint8_t)str[i + 1] & 0x3E) >> 1);
-                n2  = (((uint8_t)str[i + 1] & 0xC0) >> 6);
-            case 1:
-                n2 |= (((uint8_t)str[i + 0] & 0x07) << 2);
-                n1  = (((uint8_t)str[i + 0] & 0xF8) >> 3);
-                break;
+    while (size > 0)
+    {
+        // Copy the run of not escaped characters at once
+        size_t count = Internals::JsonPlainRun(input, size);
+        memcpy(output, input, count);
+        input += count;
+        output += count;
+        size -= count;
+        if (size == 0)
+            break;
+
+        char ch = *input++;
+        --size;
+
+        *output++ = '\\';
+        switch (ch)
+        {
+            case '"': *output++ = '"'; break;
+            case '\\': *output++ = '\\'; break;
+            case '\b': *output++ = 'b'; break;
+            case '\f': *output++ = 'f'; break;
+            case '\n': *output++ = 'n'; break;
+            case '\r': *output++ = 'r'; break;
+            case '\t': *output++ = 't'; break;
             default:
-                assert(false && "Invalid Base32 operation!");
-        }
-        i += block;
-
-        // Validate
-        assert((n1 <= 31) && "Invalid Base32 n1 value!");
-        assert((n2 <= 31) && "Invalid Base32 n2 value!" );
-        assert((n3 <= 31) && "Invalid Base32 n3 value!" );
-        assert((n4 <= 31) && "Invalid Base32 n4 value!" );
-        assert((n5 <= 31) && "Invalid Base32 n5 value!" );
-        assert((n6 <= 31) && "Invalid Base32 n6 value!" );
-        assert((n7 <= 31) && "Invalid Base32 n7 value!" );
-        assert((n8 <= 31) && "Invalid Base32 n8 value!" );
-
-        // Padding
-        switch (block)
-        {
-            case 1: n3 = n4 = 32;
-            case 2: n5 = 32;
-            case 3: n6 = n7 = 32;
-            case 4: n8 = 32;
-            case 5:
+                *output++ = 'u';
+                *output++ = '0';
+                *output++ = '0';
+                *output++ = hex[((uint8_t)ch >> 4) & 0x0F];
+                *output++ = hex[((uint8_t)ch >> 0) & 0x0F];
                 break;
-            default:
-                assert(false && "Invalid Base32 operation!");
         }
-
-        // 8 outputs
-        result[j++] = base32[n1];
-        result[j++] = base32[n2];
-        result[j++] = base32[n3];
-        result[j++] = base32[n4];
-        result[j++] = base32[n5];
-        result[j++] = base32[n6];
-        result[j++] = base32[n7];
-        result[j++] = base32[n8];
     }
 
-    return result;
+    return (size_t)(output - start);
 }
 
-std::string Encoding::Base32Decode(std::string_view str)
+std::string Encoding::JsonEscape(std::string_view str)
 {
-    static const unsigned char base32[128] =
-    {
-        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-        0xFF, 0xFF, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f,
-        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0xFF, 0xFF,
-        0xFF, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06,
-        0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e,
-        0x0f, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16,
-        0x17, 0x18, 0x19, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-        0xFF, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06,
-        0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e,
-        0x0f, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16,
-        0x17, 0x18, 0x19, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF
-    };
-
-    size_t ilength = str.length();
+    std::string result;
+    result.resize(str.size() * 6, 0);
+    result.resize(JsonEscape(str, result.data()));
+    return result;
+}
 
-    assert(((ilength % 8) == 0) && "Invalid Base32 sting!");
-    if ((ilength % 8) != 0)
-        return "";
+size_t Encoding::JsonEscape(std::string_view str, Writer& writer)
+{
+    return Internals::EscapeChunks(str, writer, 6, [](std::string_view chunk, char* output) { return JsonEscape(chunk, output); });
+}
 
-    size_t olength = (ilength / 8) * 5;
+size_t Encoding::JsonUnescape(std::string_view str, char* output) noexcept
+{
+    const char* input = str.data();
+    const char* end = input + str.size();
+    char* start = output;
 
-    std::string result;
-    result.resize(olength, 0);
-
-    for (size_t i = 0, j = 0; i < ilength;)
-    {
-        // 8 inputs
-        uint8_t n1 = (uint8_t)str[i++];
-        uint8_t n2 = (uint8_t)str[i++];
-        uint8_t n3 = (uint8_t)str[i++];
-        uint8_t n4 = (uint8_t)str[i++];
-        uint8_t n5 = (uint8_t)str[i++];
-        uint8_t n6 = (uint8_t)str[i++];
-        uint8_t n7 = (uint8_t)str[i++];
-        uint8_t n8 = (uint8_t)str[i++];
-
-        // Validate ASCII
-        assert(((n1 < 0x80) && (n2 < 0x80) && (n3 < 0x80) && (n4 < 0x80) && (n5 < 0x80) && (n6 < 0x80) && (n7 < 0x80) && (n8 < 0x80)) && "Invalid Base32 content!");
-        if ((n1 >= 0x80) || (n2 >= 0x80) || (n3 >= 0x80) || (n4 >= 0x80) || (n5 >= 0x80) || (n6 >= 0x80) || (n7 >= 0x80) || (n8 >= 0x80))
-            return "";
-
-        // Convert ASCII to Base32
-        n1 = base32[n1];
-        n2 = base32[n2];
-        n3 = base32[n3];
-        n4 = base32[n4];
-        n5 = base32[n5];
-        n6 = base32[n6];
-        n7 = base32[n7];
-        n8 = base32[n8];
-
-        // Validate Base32
-        assert(((n1 <= 31) && (n2 <= 31)) && "Invalid Base32 content!");
-        if ((n1 > 31) || (n2 > 31))
-            return "";
-
-        // The following can be padding
-        assert(((n3 <= 32) && (n4 <= 32) && (n5 <= 32) && (n6 <= 32) && (n7 <= 32) && (n8 <= 32)) && "Invalid Base32 content!");
-        if ((n3 > 32) || (n4 > 32) || (n5 > 32) || (n6 > 32) || (n7 > 32) || (n8 > 32))
-            return "";
-
-        // 5 outputs
-        result[j++] = ((n1 & 0x1f) << 3) | ((n2 & 0x1c) >> 2);
-        result[j++] = ((n2 & 0x03) << 6) | ((n3 & 0x1f) << 1) | ((n4 & 0x10) >> 4);
-        result[j++] = ((n4 & 0x0f) << 4) | ((n5 & 0x1e) >> 1);
-        result[j++] = ((n5 & 0x01) << 7) | ((n6 & 0x1f) << 2) | ((n7 & 0x18) >> 3);
-        result[j++] = ((n7 & 0x07) << 5) | ((n8 & 0x1f));
-
-        // Padding
-        if (n8 == 32)
-        {
-            result.resize(result.size() - 1);
-            assert((((n7 == 32) && (n6 == 32)) || (n7 != 32)) && "Invalid Base32 content!");
-            if (n6 == 32)
+    while (input < end)
+    {
+        // Copy the run of characters up to the next escape sequence at once
+        const char* escape = (const char*)memchr(input, '\\', end - input);
+        size_t count = ((escape != nullptr) ? escape : end) - input;
+        memcpy(output, input, count);
+        input += count;
+        output += count;
+        if (escape == nullptr)
+            break;
+
+        if (++input == end)
+            return std::string::npos;
+
+        switch (*input++)
+        {
+            case '"': *output++ = '"'; break;
+            case '\\': *output++ = '\\'; break;
+            case '/': *output++ = '/'; break;
+            case 'b': *output++ = '\b'; break;
+            case 'f': *output++ = '\f'; break;
+            case 'n': *output++ = '\n'; break;
+            case 'r': *output++ = '\r'; break;
+            case 't': *output++ = '\t'; break;
+            case 'u':
             {
-                result.resize(result.size() - 1);
-                if (n5 == 32)
+                uint32_t code;
+                if (((end - input) < 4) || !Internals::ParseHex(input, 4, code))
+                    return std::string::npos;
+                input += 4;
+
+                // Combine the surrogate pair
+                if ((code >= 0xD800) && (code <= 0xDBFF))
                 {
-                    result.resize(result.size() - 1);
-                    assert((((n4 == 32) && (n3 == 32)) || (n4 != 32)) && "Invalid Base32 content!");
-                    if (n3 == 32)
-                    {
-                        result.resize(result.size() - 1);
-                    }
+                    uint32_t low;
+                    if (((end - input) < 6) || (input[0] != '\\') || (input[1] != 'u') || !Internals::ParseHex(input + 2, 4, low) || (low < 0xDC00) || (low > 0xDFFF))
+                        return std::string::npos;
+                    input += 6;
+                    code = 0x10000 + ((code - 0xD800) << 10) + (low - 0xDC00);
                 }
+                else if ((code >= 0xDC00) && (code <= 0xDFFF))
+                    return std::string::npos;
+
+                output = Internals::EncodeUTF8Char(code, output);
+                break;
             }
+            default:
+                return std::string::npos;
         }
     }
 
-    return result;
+    return (size_t)(output - start);
 }
 
-std::string Encoding::Base64Encode(std::string_view str)
+std::string Encoding::JsonUnescape(std::string_view str)
 {
-    const char base64[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
-    const size_t mods[] = { 0, 2, 1 };
-
-    size_t ilength = str.length();
-    size_t olength = 4 * ((ilength + 2) / 3);
+    std::string result(str.size(), 0);
+    size_t size = JsonUnescape(str, result.data());
+    if (size == std::string::npos)
+        throwex ArgumentException("Invalid JSON escaped string!");
+    result.resize(size);
+    return result;
+}
 
-    std::string result;
-    result.resize(olength, 0);
+size_t Encoding::HtmlEscape(std::string_view str, char* output) noexcept
+{
+    const char* input = str.data();
+    size_t size = str.size();
+    char* start = output;
 
-    for (size_t i = 0, j = 0; i < ilength;)
+    while (size > 0)
     {
-        uint32_t octet_a = i < ilength ? (uint8_t)str[i++] : 0;
-        uint32_t octet_b = i < ilength ? (uint8_t)str[i++] : 0;
-        uint32_t octet_c = i < ilength ? (uint8_t)str[i++] : 0;
-
-        uint32_t triple = (octet_a << 0x10) + (octet_b << 0x08) + octet_c;
+        // Copy the run of not escaped characters at once
+        size_t count = Internals::HtmlPlainRun(input, size);
+        memcpy(output, input, count);
+        input += count;
+        output += count;
+        size -= count;
+        if (size == 0)
+            break;
+
+        const char* entity;
+        switch (*input++)
+        {
+            case '&': entity = "&amp;"; break;
+            case '<': entity = "&lt;"; break;
+            case '>': entity = "&gt;"; break;
+            case '"': entity = "&quot;"; break;
+            default: entity = "&#39;"; break;
+        }
+        --size;
 
-        result[j++] = base64[(triple >> 3 * 6) & 0x3F];
-        result[j++] = base64[(triple >> 2 * 6) & 0x3F];
-        result[j++] = base64[(triple >> 1 * 6) & 0x3F];
-        result[j++] = base64[(triple >> 0 * 6) & 0x3F];
+        size_t length = strlen(entity);
+        memcpy(output, entity, length);
+        output += length;
     }
 
-    for (size_t i = 0; i < mods[ilength % 3]; ++i)
-        result[result.size() - 1 - i] = '=';
+    return (size_t)(output - start);
+}
 
+std::string Encoding::HtmlEscape(std::string_view str)
+{
+    std::string result;
+    result.resize(str.size() * 6, 0);
+    result.resize(HtmlEscape(str, result.data()));
     return result;
 }
 
-std::string Encoding::Base64Decode(std::string_view str)
+size_t Encoding::HtmlEscape(std::string_view str, Writer& writer)
 {
-    static const unsigned char base64[256] =
-    {
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x3f,
-        0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x3b, 0x3c, 0x3d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e,
-        0x0f, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28,
-        0x29, 0x2a, 0x2b, 0x2c, 0x2d, 0x2e, 0x2f, 0x30, 0x31, 0x32, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-    };
+    return Internals::EscapeChunks(str, writer, 6, [](std::string_view chunk, char* output) { return HtmlEscape(chunk, output); });
+}
 
-    size_t ilength = str.length();
+size_t Encoding::HtmlUnescape(std::string_view str, char* output) noexcept
+{
+    const char* input = str.data();
+    const char* end = input + str.size();
+    char* start = output;
 
-    if (ilength % 4 != 0)
-        return "";
+    while (input < end)
+    {
+        // Copy the run of characters up to the next entity at once
+        const char* ampersand = (const char*)memchr(input, '&', end - input);
+        size_t count = ((ampersand != nullptr) ? ampersand : end) - input;
+        memcpy(output, input, count);
+        input += count;
+        output += count;
+        if (ampersand == nullptr)
+            break;
+
+        // Longest supported entity is '&#x10FFFF;'
+        const char* limit = ((end - input) > 10) ? (input + 10) : end;
+        const char* semicolon = (const char*)memchr(input + 1, ';', limit - input - 1);
+        uint32_t code;
+        if ((semicolon != nullptr) && Internals::ParseHtmlEntity(std::string_view(input + 1, semicolon - input - 1), code))
+        {
+            output = Internals::EncodeUTF8Char(code, output);
+            input = semicolon + 1;
+        }
+        else
+        {
+            // Keep unknown or malformed entity as is
+            *output++ = *input++;
+        }
+    }
 
-    size_t olength = ilength / 4 * 3;
+    return (size_t)(output - start);
+}
 
-    if (str[ilength - 1] == '=') olength--;
-    if (str[ilength - 2] == '=') olength--;
+std::string Encoding::HtmlUnescape(std::string_view str)
+{
+    std::string result(str.size(), 0);
+    result.resize(HtmlUnescape(str, result.data()));
+    return result;
+}
 
-    std::string result;
-    result.resize(olength, 0);
+size_t Encoding::CsvQuote(std::string_view str, char* output, char delimiter) noexcept
+{
+    const char* input = str.data();
+    size_t size = str.size();
+    char* start = output;
 
-    for (size_t i = 0, j = 0; i < ilength;)
+    // Copy the field as is if it does not require quotes
+    size_t count = Internals::CsvPlainRun(input, size, delimiter);
+    if (count == size)
     {
-        uint32_t sextet_a = str[i] == '=' ? 0 & i++ : base64[(uint8_t)str[i++]];
-        uint32_t sextet_b = str[i] == '=' ? 0 & i++ : base64[(uint8_t)str[i++]];
-        uint32_t sextet_c = str[i] == '=' ? 0 & i++ : base64[(uint8_t)str[i++]];
-        uint32_t sextet_d = str[i] == '=' ? 0 & i++ : base64[(uint8_t)str[i++]];
-
-        uint32_t triple = (sextet_a << 3 * 6) + (sextet_b << 2 * 6) + (sextet_c << 1 * 6) + (sextet_d << 0 * 6);
-
-        if (j < olength) result[j++] = (triple >> 2 * 8) & 0xFF;
-        if (j < olength) result[j++] = (triple >> 1 * 8) & 0xFF;
-        if (j < olength) result[j++] = (triple >> 0 * 8) & 0xFF;
+        memcpy(output, input, size);
+        return size;
+    }
 
+    *output++ = '"';
+    while (size > 0)
+    {
+        // Copy the run of characters up to the next quote at once
+        const char* quote = (const char*)memchr(input, '"', size);
+        count = ((quote != nullptr) ? (size_t)(quote - input + 1) : size);
+        memcpy(output, input, count);
+        input += count;
+        output += count;
+        size -= count;
+
+        // Double the quote
+        if (quote != nullptr)
+            *output++ = '"';
     }
+    *output++ = '"';
 
-    return result;
+    return (size_t)(output - start);
 }
 
-std::string Encoding::URLEncode(std::string_view str)
+std::string Encoding::CsvQuote(std::string_view str, char delimiter)
 {
     std::string result;
-    result.reserve(str.size());
-
-    for (char ch : str)
-    {
-        if (isalnum(ch) || (ch == '-') || (ch == '.') || (ch == '/') || (ch == '_') || (ch == '~'))
-            result.push_back(ch);
-        else if (ch == ' ')
-            result.push_back('+');
-        else
-        {
-            const char hex[16] = { '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'A', 'B', 'C', 'D', 'E', 'F' };
-            result.push_back('%');
-            result.push_back(hex[(ch >> 4) & 0x0F]);
-            result.push_back(hex[(ch >> 0) & 0x0F]);
-        }
-    }
-
+    result.resize(str.size() * 2 + 2, 0);
+    result.resize(CsvQuote(str, result.data(), delimiter));
     return result;
 }
 
-std::string Encoding::URLDecode(std::string_view str)
+size_t Encoding::CsvQuote(std::string_view str, Writer& writer, char delimiter)
 {
-    std::string result;
-    result.reserve(str.size());
+    // Write the field as is if it does not require quotes
+    if (Internals::CsvPlainRun(str.data(), str.size(), delimiter) == str.size())
+        return writer.Write(str.data(), str.size());
 
-    for (size_t i = 0; i < str.size(); ++i)
+    size_t written = writer.Write("\"", 1);
+    written += Internals::EscapeChunks(str, writer, 2, [](std::string_view chunk, char* output)
     {
-        char ch = str[i];
-        if (ch == '%')
+        // Quote the chunk with doubled quotes and cut off the enclosing quotes
+        size_t size = CsvQuote(chunk, output, '"');
+        if ((size > 0) && (output[0] == '"'))
         {
-            const char hex[] = "0123456789ABCDEF";
-
-            if (++i == str.size())
-            {
-                result.push_back('?');
-                break;
-            }
-
-            int hi = (int)(std::find(hex, hex + 16, toupper(str[i])) - hex);
+            memmove(output, output + 1, size - 2);
+            size -= 2;
+        }
+        return size;
+    });
+    written += writer.Write("\"", 1);
+    return written;
+}
 
-            if (++i == str.size())
-            {
-                result.push_back('?');
-                break;
-            }
+size_t Encoding::CsvUnquote(std::string_view str, char* output) noexcept
+{
+    // Copy the field as is if it is not quoted
+    if (str.empty() || (str[0] != '"'))
+    {
+        memcpy(output, str.data(), str.size());
+        return str.size();
+    }
 
-            int lo = (int)(std::find(hex, hex + 16, toupper(str[i])) - hex);
+    if ((str.size() < 2) || (str.back() != '"'))
+        return std::string::npos;
 
-            if ((hi >= 16) || (lo >= 16))
-            {
-                result.push_back('?');
-                break;
-            }
+    const char* input = str.data() + 1;
+    const char* end = str.data() + str.size() - 1;
+    char* start = output;
 
-            result.push_back((char)((hi << 4) + lo));
-        }
-        else if (ch == '+')
-            result.push_back(' ');
-        else
-            result.push_back(ch);
+    while (input < end)
+    {
+        // Copy the run of characters up to the next quote at once
+        const char* quote = (const char*)memchr(input, '"', end - input);
+        size_t count = ((quote != nullptr) ? quote : end) - input;
+        memcpy(output, input, count);
+        input += count;
+        output += count;
+        if (quote == nullptr)
+            break;
+
+        // Inner quote must be doubled
+        if (((input + 1) >= end) || (input[1] != '"'))
+            return std::string::npos;
+        *output++ = '"';
+        input += 2;
     }
 
+    return (size_t)(output - start);
+}
+
+std::string Encoding::CsvUnquote(std::string_view str)
+{
+    std::string result(str.size(), 0);
+    size_t size = CsvUnquote(str, result.data());
+    if (size == std::string::npos)
+        throwex ArgumentException("Invalid CSV quoted field!");
+    result.resize(size);
     return result;
 }
-#pragma GCC diagnostic pop
+
 } // namespace CppCommon
@@ -0,0 +1,108 @@
+/*!
+    \file formatter.cpp
+    \brief Formatter implementation
+    \author Ivan Shynkarenka
+    \date 15.10.2026
+    \copyright MIT License
+*/
+
+#include "string/formatter.h"
+
+#include "errors/exceptions.h"
+
+#include <algorithm>
+
+namespace CppCommon {
+
+Formatter::Formatter(std::string_view pattern) : _pattern(pattern)
+{
+    size_t next = 0;
+    bool automatic = false;
+    bool positional = false;
+
+    size_t i = 0;
+    while (i < pattern.size())
+    {
+        char ch = pattern[i];
+
+        // Escaped braces are the part of the literal text
+        if ((ch == '{') || (ch == '}'))
+        {
+            if (((i + 1) < pattern.size()) && (pattern[i + 1] == ch))
+            {
+                _literals.push_back(ch);
+                i += 2;
+                continue;
+            }
+            if (ch == '}')
+                throwex ArgumentException("Invalid format pattern with the unmatched '}'!");
+        }
+        else
+        {
+            _literals.push_back(ch);
+            ++i;
+            continue;
+        }
+
+        // Parse the replacement field
+        size_t end = pattern.find('}', i + 1);
+        if (end == std::string_view::npos)
+            throwex ArgumentException("Invalid format pattern with the unmatched '{'!");
+
+        std::string_view field = pattern.substr(i + 1, end - i - 1);
+        size_t colon = field.find(':');
+        std::string_view id = field.substr(0, colon);
+        std::string_view spec = (colon != std::string_view::npos) ? field.substr(colon + 1) : std::string_view();
+
+        if (spec.find('{') != std::string_view::npos)
+            throwex ArgumentException("Invalid format pattern with the nested replacement field!");
+
+        size_t index = 0;
+        if (id.empty())
+        {
+            automatic = true;
+            index = next++;
+        }
+        else
+        {
+            positional = true;
+            for (char digit : id)
+            {
+                if ((digit < '0') || (digit > '9'))
+                    throwex ArgumentException("Invalid format pattern with the named argument!");
+                index = index * 10 + (digit - '0');
+            }
+        }
+        if (automatic && positional)
+            throwex ArgumentException("Invalid format pattern with mixed automatic and positional arguments!");
+
+        Field current;
+        current.literal = _literals.size();
+        current.index = index;
+        current.spec = spec.empty() ? "{}" : "{:" + std::string(spec) + "}";
+        _fields.emplace_back(std::move(current));
+
+        _arguments = std::max(_arguments, index + 1);
+        i = end + 1;
+    }
+}
+
+fmt::appender Formatter::vformat_to(fmt::appender out, fmt::format_args args) const
+{
+    size_t literal = 0;
+    for (const auto& field : _fields)
+    {
+        out = std::copy(_literals.data() + literal, _literals.data() + field.literal, out);
+        literal = field.literal;
+
+        auto arg = args.get((int)field.index);
+        if (!arg)
+            throw fmt::format_error("Format argument index is out of range!");
+
+        // Only the format specification of the single argument is parsed
+        out = fmt::vformat_to(out, field.spec, fmt::format_args(&arg, 1));
+    }
+    return std::copy(_literals.data() + literal, _literals.data() + _literals.size(), out);
+}
+
+} // namespace CppCommon
@@ -0,0 +1,209 @@
+/*!
+    \file glob_pattern.cpp
+    \brief Glob pattern implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "string/glob_pattern.h"
+
+#include "errors/exceptions.h"
+#include "string/string_utils.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace CppCommon {
+
+GlobPattern::GlobPattern(std::string_view patterns) : _patterns(patterns)
+{
+    size_t start = 0;
+    while (start <= patterns.size())
+    {
+        // Find the end of the pattern at the first unescaped semicolon
+        size_t end = start;
+        while ((end < patterns.size()) && (patterns[end] != ';'))
+            end += (patterns[end] == '\\') ? 2 : 1;
+        end = std::min(end, patterns.size());
+
+        std::string_view pattern = patterns.substr(start, end - start);
+        if (!pattern.empty())
+        {
+            Rule rule;
+            rule.negative = (pattern[0] == '!');
+            if (rule.negative)
+                pattern.remove_prefix(1);
+            Compile(pattern, rule);
+            _rules.emplace_back(std::move(rule));
+        }
+
+        start = end + 1;
+    }
+}
+
+void GlobPattern::Compile(std::string_view pattern, Rule& rule)
+{
+    rule.segments.emplace_back();
+    for (size_t i = 0; i < pattern.size(); ++i)
+    {
+        Segment& segment = rule.segments.back();
+        char ch = pattern[i];
+
+        if (ch == '*')
+        {
+            // Consecutive wildcards are the same as the single one
+            if ((rule.segments.size() == 1) || (segment.size() > 0))
+                rule.segments.emplace_back();
+            continue;
+        }
+
+        Token token = { TokenType::CHAR, ch, 0 };
+        if (ch == '?')
+            token.type = TokenType::ANY;
+        else if (ch == '\\')
+        {
+            if (++i == pattern.size())
+                throwex ArgumentException("Invalid glob pattern with the trailing escape character!");
+            token.ch = pattern[i];
+        }
+        else if (ch == '[')
+        {
+            std::bitset<256> set;
+            size_t j = i + 1;
+            bool negative = (j < pattern.size()) && ((pattern[j] == '!') || (pattern[j] == '^'));
+            if (negative)
+                ++j;
+
+            // Closing bracket is a set character at the first position
+            bool first = true;
+            for (; (j < pattern.size()) && ((pattern[j] != ']') || first); ++j, first = false)
+            {
+                if ((pattern[j] == '\\') && (++j == pattern.size()))
+                    break;
+                uint8_t from = (uint8_t)pattern[j];
+                uint8_t to = from;
+                if (((j + 2) < pattern.size()) && (pattern[j + 1] == '-') && (pattern[j + 2] != ']'))
+                {
+                    j += 2;
+                    if ((pattern[j] == '\\') && (++j == pattern.size()))
+                        break;
+                    to = (uint8_t)pattern[j];
+                }
+                for (size_t c = from; c <= to; ++c)
+                    set.set(c);
+            }
+            if (j >= pattern.size())
+                throwex ArgumentException("Invalid glob pattern with the unterminated characters set!");
+            if (negative)
+                set.flip();
+
+            token.type = TokenType::SET;
+            token.set = _sets.size();
+            _sets.push_back(set);
+            i = j;
+        }
+
+        segment.literal.push_back(token.ch);
+        segment.tokens.push_back(token);
+    }
+
+    // Segments of only literal characters are compared as strings
+    for (auto& segment : rule.segments)
+    {
+        bool literal = std::all_of(segment.tokens.begin(), segment.tokens.end(), [](const Token& token) { return token.type == TokenType::CHAR; });
+        if (literal)
+            segment.tokens.clear();
+        else
+            segment.literal.clear();
+    }
+
+    // Pattern without wildcards must match the whole string
+    rule.exact = (rule.segments.size() == 1);
+}
+
+bool GlobPattern::Match(std::string_view str) const noexcept
+{
+    if (_rules.empty())
+        return true;
+
+    bool result = false;
+    for (const auto& rule : _rules)
+    {
+        if (MatchRule(rule, str))
+            return !rule.negative;
+
+        // Last negative pattern should success result
+        result = rule.negative;
+    }
+    return result;
+}
+
+bool GlobPattern::MatchRule(const Rule& rule, std::string_view str) const noexcept
+{
+    const Segment& prefix = rule.segments.front();
+
+    if (rule.exact)
+        return (str.size() == prefix.size()) && MatchSegment(prefix, str.data());
+
+    const Segment& suffix = rule.segments.back();
+
+    // Match the anchored prefix and suffix
+    if (str.size() < (prefix.size() + suffix.size()))
+        return false;
+    if (!MatchSegment(prefix, str.data()) || !MatchSegment(suffix, str.data() + str.size() - suffix.size()))
+        return false;
+
+    // Find middle segments one by one with the leftmost match
+    std::string_view middle = str.substr(prefix.size(), str.size() - prefix.size() - suffix.size());
+    for (size_t i = 1; (i + 1) < rule.segments.size(); ++i)
+    {
+        const Segment& segment = rule.segments[i];
+        size_t position = FindSegment(segment, middle);
+        if (position == std::string::npos)
+            return false;
+        middle.remove_prefix(position + segment.size());
+    }
+    return true;
+}
+
+bool GlobPattern::MatchSegment(const Segment& segment, const char* str) const noexcept
+{
+    if (segment.tokens.empty())
+        return (std::memcmp(str, segment.literal.data(), segment.literal.size()) == 0);
+
+    for (const auto& token : segment.tokens)
+    {
+        switch (token.type)
+        {
+            case TokenType::CHAR:
+                if (*str != token.ch)
+                    return false;
+                break;
+            case TokenType::ANY:
+                break;
+            case TokenType::SET:
+                if (!_sets[token.set].test((uint8_t)*str))
+                    return false;
+                break;
+        }
+        ++str;
+    }
+    return true;
+}
+
+size_t GlobPattern::FindSegment(const Segment& segment, std::string_view str) const noexcept
+{
+    if (segment.size() > str.size())
+        return std::string::npos;
+
+    if (segment.tokens.empty())
+        return StringUtils::Find(str, segment.literal);
+
+    for (size_t i = 0; i <= (str.size() - segment.size()); ++i)
+        if (MatchSegment(segment, str.data() + i))
+            return i;
+    return std::string::npos;
+}
+
+} // namespace CppCommon
@@ -0,0 +1,171 @@
+/*!
+    \file string_interner.cpp
+    \brief String interner implementation
+    \author Ivan Shynkarenka
+    \date 15.10.2026
+    \copyright MIT License
+*/
+
+#include "string/string_interner.h"
+
+#include "threads/locker.h"
+
+#include <bit>
+#include <cassert>
+#include <cstring>
+#include <new>
+#include <stdexcept>
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+namespace Internals {
+
+// Chunk 0 keeps identifiers [0, 2^SHIFT), chunk N > 0 keeps identifiers
+// [2^(N + SHIFT - 1), 2^(N + SHIFT)), so the table is never reallocated
+const size_t STRING_INTERNER_CHUNK_SHIFT = 10;
+
+inline size_t StringInternerChunkIndex(uint32_t id) noexcept
+{
+    return (id >> STRING_INTERNER_CHUNK_SHIFT) ? (std::bit_width(id) - STRING_INTERNER_CHUNK_SHIFT) : 0;
+}
+
+inline size_t StringInternerChunkOffset(uint32_t id, size_t chunk) noexcept
+{
+    return chunk ? (id - ((uint32_t)1 << (chunk + STRING_INTERNER_CHUNK_SHIFT - 1))) : id;
+}
+
+inline size_t StringInternerChunkSize(size_t chunk) noexcept
+{
+    return (size_t)1 << (chunk ? (chunk + STRING_INTERNER_CHUNK_SHIFT - 1) : STRING_INTERNER_CHUNK_SHIFT);
+}
+
+} // namespace Internals
+//! @endcond
+
+StringInterner::StringInterner(size_t shards, size_t capacity)
+    : _selector(shards), _size(1)
+{
+    _shards.reserve(_selector.count());
+    for (size_t i = 0; i < _selector.count(); ++i)
+        _shards.emplace_back(std::make_unique<CacheAligned<Shard>>(std::in_place, capacity));
+
+    for (auto& chunk : _chunks)
+        chunk.store(nullptr, std::memory_order_relaxed);
+
+    // Reserve the identifier of the empty string
+    *slot(EMPTY) = std::string_view("");
+}
+
+StringInterner::~StringInterner()
+{
+    for (auto& chunk : _chunks)
+        delete[] chunk.load(std::memory_order_relaxed);
+}
+
+size_t StringInterner::memory() const
+{
+    size_t result = 0;
+    for (const auto& current : _shards)
+    {
+        ReadLocker<RWLock> locker((*current)->lock);
+        result += (*current)->arena.allocated();
+    }
+    return result;
+}
+
+uint32_t StringInterner::intern(std::string_view str)
+{
+    if (str.empty())
+        return EMPTY;
+
+    Shard& current = shard(str);
+
+    // Fast path: the string is already interned
+    {
+        ReadLocker<RWLock> locker(current.lock);
+        auto it = current.map.find(str);
+        if (it != current.map.end())
+            return it->second;
+    }
+
+    WriteLocker<RWLock> locker(current.lock);
+
+    // Check again, because the string might be interned by another thread
+    auto it = current.map.find(str);
+    if (it != current.map.end())
+        return it->second;
+
+    // Copy the null-terminated string into the shard arena
+    char* buffer = (char*)current.arena.malloc(str.size() + 1, 1);
+    if (buffer == nullptr)
+        throw std::bad_alloc();
+    std::memcpy(buffer, str.data(), str.size());
+    buffer[str.size()] = 0;
+    std::string_view interned(buffer, str.size());
+
+    // Assign a new identifier and publish the string in the identifiers table
+    size_t id = _size.fetch_add(1, std::memory_order_acq_rel);
+    if (id > UINT32_MAX)
+    {
+        _size.fetch_sub(1, std::memory_order_acq_rel);
+        throw std::length_error("String interner identifiers are exhausted!");
+    }
+    *slot((uint32_t)id) = interned;
+
+    current.map.emplace(interned, (uint32_t)id);
+    return (uint32_t)id;
+}
+
+bool StringInterner::find(std::string_view str, uint32_t& id) const
+{
+    if (str.empty())
+    {
+        id = EMPTY;
+        return true;
+    }
+
+    Shard& current = shard(str);
+
+    ReadLocker<RWLock> locker(current.lock);
+    auto it = current.map.find(str);
+    if (it == current.map.end())
+        return false;
+
+    id = it->second;
+    return true;
+}
+
+std::string_view StringInterner::lookup(uint32_t id) const noexcept
+{
+    assert((id < size()) && "Invalid string interner identifier!");
+
+    size_t chunk = Internals::StringInternerChunkIndex(id);
+    std::string_view* items = _chunks[chunk].load(std::memory_order_acquire);
+    assert((items != nullptr) && "Invalid string interner identifier!");
+    return items[Internals::StringInternerChunkOffset(id, chunk)];
+}
+
+StringInterner::Shard& StringInterner::shard(std::string_view str) const noexcept
+{
+    return _shards[_selector(FastStringHash()(str))]->value();
+}
+
+std::string_view* StringInterner::slot(uint32_t id)
+{
+    size_t chunk = Internals::StringInternerChunkIndex(id);
+    std::string_view* items = _chunks[chunk].load(std::memory_order_acquire);
+    if (items == nullptr)
+    {
+        // Allocate a new chunk, several shards might race for it
+        std::string_view* allocated = new std::string_view[Internals::StringInternerChunkSize(chunk)];
+        if (_chunks[chunk].compare_exchange_strong(items, allocated, std::memory_order_acq_rel, std::memory_order_acquire))
+            items = allocated;
+        else
+            delete[] allocated;
+    }
+
+    return items + Internals::StringInternerChunkOffset(id, chunk);
+}
+
+} // namespace CppCommon
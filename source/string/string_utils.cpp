@@ -8,30 +8,353 @@
 
 #include "string/string_utils.h"
 
+#include "system/cpu.h"
+
 #include <cassert>
+#include <cstring>
 #include <regex>
 
+#if defined(_MSC_VER) && defined(_M_X64)
+#include <intrin.h>
+#include <immintrin.h>
+#define CPPCOMMON_STRING_UTILS_SSE2
+#define CPPCOMMON_STRING_UTILS_AVX2
+#define CPPCOMMON_STRING_UTILS_AVX2_TARGET
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__amd64__))
+#include <immintrin.h>
+#define CPPCOMMON_STRING_UTILS_SSE2
+#define CPPCOMMON_STRING_UTILS_AVX2
+#define CPPCOMMON_STRING_UTILS_AVX2_TARGET __attribute__((target("avx2")))
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#define CPPCOMMON_STRING_UTILS_NEON
+#endif
+
 namespace CppCommon {
 
-bool StringUtils::IsBlank(const char* str)
+//! @cond INTERNALS
+namespace Internals {
+
+inline unsigned LowestBit(uint64_t mask) noexcept
 {
-    for (size_t i = 0; str[i] != 0; ++i)
-        if (!IsBlank(str[i]))
-            return false;
+#if defined(_MSC_VER)
+    unsigned long index;
+    _BitScanForward64(&index, mask);
+    return (unsigned)index;
+#else
+    return (unsigned)__builtin_ctzll(mask);
+#endif
+}
+
+// Load up to 8 bytes into the zero padded word
+inline uint64_t LoadWord(const char* data, size_t size) noexcept
+{
+    uint64_t word = 0;
+    std::memcpy(&word, data, size);
+    return word;
+}
+
+// Convert ASCII upper case characters of the word to lower case
+inline uint64_t LowerWord(uint64_t word) noexcept
+{
+    const uint64_t ones = 0x0101010101010101ull;
+    const uint64_t high = 0x8080808080808080ull;
+
+    // Set the high bit of each byte in the ['A', 'Z'] range without carries between bytes
+    uint64_t ascii = word & ~high;
+    uint64_t above = ascii + (0x80 - 'A') * ones;
+    uint64_t below = ascii + (0x80 - 'Z' - 1) * ones;
+    uint64_t letters = (above ^ below) & ~word & high;
 
+    return word | (letters >> 2);
+}
+
+inline bool IsBlankScalar(const char* data, size_t size) noexcept
+{
+    for (size_t i = 0; i < size; ++i)
+        if (!StringUtils::IsBlank(data[i]))
+            return false;
     return true;
 }
 
-bool StringUtils::IsBlank(std::string_view str)
+// Flip the case bit of ASCII characters in the [first, last] range
+inline void FlipCaseScalar(char* data, size_t size, char first, char last) noexcept
 {
-    if (str.empty())
-        return true;
+    for (size_t i = 0; i < size; ++i)
+        if ((data[i] >= first) && (data[i] <= last))
+            data[i] ^= 0x20;
+}
+
+// Find the substring of at least two characters comparing its first and last characters of many positions at once
+size_t FindVector(const char* data, size_t size, const char* substr, size_t length) noexcept
+{
+    size_t i = 0;
 
-    for (auto ch : str)
-        if (!IsBlank(ch))
+#if defined(CPPCOMMON_STRING_UTILS_SSE2)
+    const __m128i first = _mm_set1_epi8(substr[0]);
+    const __m128i last = _mm_set1_epi8(substr[length - 1]);
+    for (; (i + length - 1 + 16) <= size; i += 16)
+    {
+        __m128i block_first = _mm_loadu_si128((const __m128i*)(data + i));
+        __m128i block_last = _mm_loadu_si128((const __m128i*)(data + i + length - 1));
+        uint64_t mask = (uint32_t)_mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(first, block_first), _mm_cmpeq_epi8(last, block_last)));
+        while (mask != 0)
+        {
+            unsigned bit = LowestBit(mask);
+            if (std::memcmp(data + i + bit + 1, substr + 1, length - 2) == 0)
+                return i + bit;
+            mask &= mask - 1;
+        }
+    }
+#elif defined(CPPCOMMON_STRING_UTILS_NEON)
+    const uint8x16_t first = vdupq_n_u8((uint8_t)substr[0]);
+    const uint8x16_t last = vdupq_n_u8((uint8_t)substr[length - 1]);
+    for (; (i + length - 1 + 16) <= size; i += 16)
+    {
+        uint8x16_t block_first = vld1q_u8((const uint8_t*)(data + i));
+        uint8x16_t block_last = vld1q_u8((const uint8_t*)(data + i + length - 1));
+        uint8x16_t matches = vandq_u8(vceqq_u8(first, block_first), vceqq_u8(last, block_last));
+        // Narrow comparison result into 4 bits per character mask
+        uint64_t mask = vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(matches), 4)), 0);
+        while (mask != 0)
+        {
+            unsigned bit = LowestBit(mask) / 4;
+            if (std::memcmp(data + i + bit + 1, substr + 1, length - 2) == 0)
+                return i + bit;
+            mask &= ~((uint64_t)0xF << (bit * 4));
+        }
+    }
+#endif
+
+    size_t found = std::string_view(data + i, size - i).find(std::string_view(substr, length));
+    return (found != std::string::npos) ? (i + found) : std::string::npos;
+}
+
+bool IsBlankVector(const char* data, size_t size) noexcept
+{
+#if defined(CPPCOMMON_STRING_UTILS_SSE2)
+    const __m128i space = _mm_set1_epi8(' ');
+    const __m128i lower = _mm_set1_epi8('\t' - 1);
+    const __m128i upper = _mm_set1_epi8('\r' + 1);
+    for (; size >= 16; data += 16, size -= 16)
+    {
+        __m128i block = _mm_loadu_si128((const __m128i*)data);
+        __m128i control = _mm_and_si128(_mm_cmpgt_epi8(block, lower), _mm_cmplt_epi8(block, upper));
+        __m128i blank = _mm_or_si128(_mm_cmpeq_epi8(block, space), control);
+        if (_mm_movemask_epi8(blank) != 0xFFFF)
             return false;
+    }
+#elif defined(CPPCOMMON_STRING_UTILS_NEON)
+    const uint8x16_t space = vdupq_n_u8(' ');
+    const uint8x16_t lower = vdupq_n_u8('\t');
+    const uint8x16_t upper = vdupq_n_u8('\r');
+    for (; size >= 16; data += 16, size -= 16)
+    {
+        uint8x16_t block = vld1q_u8((const uint8_t*)data);
+        uint8x16_t control = vandq_u8(vcgeq_u8(block, lower), vcleq_u8(block, upper));
+        uint8x16_t blank = vorrq_u8(vceqq_u8(block, space), control);
+        if (vminvq_u8(blank) != 0xFF)
+            return false;
+    }
+#endif
+    return IsBlankScalar(data, size);
+}
 
-    return true;
+void FlipCaseVector(char* data, size_t size, char first, char last) noexcept
+{
+#if defined(CPPCOMMON_STRING_UTILS_SSE2)
+    // Signed comparison skips all non ASCII characters
+    const __m128i lower = _mm_set1_epi8(first - 1);
+    const __m128i upper = _mm_set1_epi8(last + 1);
+    const __m128i flip = _mm_set1_epi8(0x20);
+    for (; size >= 16; data += 16, size -= 16)
+    {
+        __m128i block = _mm_loadu_si128((const __m128i*)data);
+        __m128i letters = _mm_and_si128(_mm_cmpgt_epi8(block, lower), _mm_cmplt_epi8(block, upper));
+        _mm_storeu_si128((__m128i*)data, _mm_xor_si128(block, _mm_and_si128(letters, flip)));
+    }
+#elif defined(CPPCOMMON_STRING_UTILS_NEON)
+    const uint8x16_t lower = vdupq_n_u8((uint8_t)first);
+    const uint8x16_t upper = vdupq_n_u8((uint8_t)last);
+    const uint8x16_t flip = vdupq_n_u8(0x20);
+    for (; size >= 16; data += 16, size -= 16)
+    {
+        uint8x16_t block = vld1q_u8((const uint8_t*)data);
+        uint8x16_t letters = vandq_u8(vcgeq_u8(block, lower), vcleq_u8(block, upper));
+        vst1q_u8((uint8_t*)data, veorq_u8(block, vandq_u8(letters, flip)));
+    }
+#endif
+    FlipCaseScalar(data, size, first, last);
+}
+
+bool CompareNoCaseVector(const char* data1, const char* data2, size_t size) noexcept
+{
+#if defined(CPPCOMMON_STRING_UTILS_SSE2)
+    // Signed comparison skips all non ASCII characters
+    const __m128i lower = _mm_set1_epi8('A' - 1);
+    const __m128i upper = _mm_set1_epi8('Z' + 1);
+    const __m128i flip = _mm_set1_epi8(0x20);
+    for (; size >= 16; data1 += 16, data2 += 16, size -= 16)
+    {
+        __m128i block1 = _mm_loadu_si128((const __m128i*)data1);
+        __m128i block2 = _mm_loadu_si128((const __m128i*)data2);
+        block1 = _mm_or_si128(block1, _mm_and_si128(_mm_and_si128(_mm_cmpgt_epi8(block1, lower), _mm_cmplt_epi8(block1, upper)), flip));
+        block2 = _mm_or_si128(block2, _mm_and_si128(_mm_and_si128(_mm_cmpgt_epi8(block2, lower), _mm_cmplt_epi8(block2, upper)), flip));
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(block1, block2)) != 0xFFFF)
+            return false;
+    }
+#elif defined(CPPCOMMON_STRING_UTILS_NEON)
+    const uint8x16_t lower = vdupq_n_u8('A');
+    const uint8x16_t upper = vdupq_n_u8('Z');
+    const uint8x16_t flip = vdupq_n_u8(0x20);
+    for (; size >= 16; data1 += 16, data2 += 16, size -= 16)
+    {
+        uint8x16_t block1 = vld1q_u8((const uint8_t*)data1);
+        uint8x16_t block2 = vld1q_u8((const uint8_t*)data2);
+        block1 = vorrq_u8(block1, vandq_u8(vandq_u8(vcgeq_u8(block1, lower), vcleq_u8(block1, upper)), flip));
+        block2 = vorrq_u8(block2, vandq_u8(vandq_u8(vcgeq_u8(block2, lower), vcleq_u8(block2, upper)), flip));
+        if (vminvq_u8(vceqq_u8(block1, block2)) != 0xFF)
+            return false;
+    }
+#endif
+
+    // Compare lower case 8 bytes words
+    for (; size >= 8; data1 += 8, data2 += 8, size -= 8)
+        if (LowerWord(LoadWord(data1, 8)) != LowerWord(LoadWord(data2, 8)))
+            return false;
+    return (size == 0) || (LowerWord(LoadWord(data1, size)) == LowerWord(LoadWord(data2, size)));
+}
+
+#if defined(CPPCOMMON_STRING_UTILS_AVX2)
+
+CPPCOMMON_STRING_UTILS_AVX2_TARGET size_t FindAVX2(const char* data, size_t size, const char* substr, size_t length) noexcept
+{
+    size_t i = 0;
+
+    const __m256i first = _mm256_set1_epi8(substr[0]);
+    const __m256i last = _mm256_set1_epi8(substr[length - 1]);
+    for (; (i + length - 1 + 32) <= size; i += 32)
+    {
+        __m256i block_first = _mm256_loadu_si256((const __m256i*)(data + i));
+        __m256i block_last = _mm256_loadu_si256((const __m256i*)(data + i + length - 1));
+        uint64_t mask = (uint32_t)_mm256_movemask_epi8(_mm256_and_si256(_mm256_cmpeq_epi8(first, block_first), _mm256_cmpeq_epi8(last, block_last)));
+        while (mask != 0)
+        {
+            unsigned bit = LowestBit(mask);
+            if (std::memcmp(data + i + bit + 1, substr + 1, length - 2) == 0)
+                return i + bit;
+            mask &= mask - 1;
+        }
+    }
+
+    size_t found = FindVector(data + i, size - i, substr, length);
+    return (found != std::string::npos) ? (i + found) : std::string::npos;
+}
+
+CPPCOMMON_STRING_UTILS_AVX2_TARGET bool IsBlankAVX2(const char* data, size_t size) noexcept
+{
+    const __m256i space = _mm256_set1_epi8(' ');
+    const __m256i lower = _mm256_set1_epi8('\t' - 1);
+    const __m256i upper = _mm256_set1_epi8('\r' + 1);
+    for (; size >= 32; data += 32, size -= 32)
+    {
+        __m256i block = _mm256_loadu_si256((const __m256i*)data);
+        __m256i control = _mm256_and_si256(_mm256_cmpgt_epi8(block, lower), _mm256_cmpgt_epi8(upper, block));
+        __m256i blank = _mm256_or_si256(_mm256_cmpeq_epi8(block, space), control);
+        if ((uint32_t)_mm256_movemask_epi8(blank) != 0xFFFFFFFF)
+            return false;
+    }
+    return IsBlankVector(data, size);
+}
+
+CPPCOMMON_STRING_UTILS_AVX2_TARGET void FlipCaseAVX2(char* data, size_t size, char first, char last) noexcept
+{
+    // Signed comparison skips all non ASCII characters
+    const __m256i lower = _mm256_set1_epi8(first - 1);
+    const __m256i upper = _mm256_set1_epi8(last + 1);
+    const __m256i flip = _mm256_set1_epi8(0x20);
+    for (; size >= 32; data += 32, size -= 32)
+    {
+        __m256i block = _mm256_loadu_si256((const __m256i*)data);
+        __m256i letters = _mm256_and_si256(_mm256_cmpgt_epi8(block, lower), _mm256_cmpgt_epi8(upper, block));
+        _mm256_storeu_si256((__m256i*)data, _mm256_xor_si256(block, _mm256_and_si256(letters, flip)));
+    }
+    FlipCaseVector(data, size, first, last);
+}
+
+CPPCOMMON_STRING_UTILS_AVX2_TARGET bool CompareNoCaseAVX2(const char* data1, const char* data2, size_t size) noexcept
+{
+    // Signed comparison skips all non ASCII characters
+    const __m256i lower = _mm256_set1_epi8('A' - 1);
+    const __m256i upper = _mm256_set1_epi8('Z' + 1);
+    const __m256i flip = _mm256_set1_epi8(0x20);
+    for (; size >= 32; data1 += 32, data2 += 32, size -= 32)
+    {
+        __m256i block1 = _mm256_loadu_si256((const __m256i*)data1);
+        __m256i block2 = _mm256_loadu_si256((const __m256i*)data2);
+        block1 = _mm256_or_si256(block1, _mm256_and_si256(_mm256_and_si256(_mm256_cmpgt_epi8(block1, lower), _mm256_cmpgt_epi8(upper, block1)), flip));
+        block2 = _mm256_or_si256(block2, _mm256_and_si256(_mm256_and_si256(_mm256_cmpgt_epi8(block2, lower), _mm256_cmpgt_epi8(upper, block2)), flip));
+        if ((uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(block1, block2)) != 0xFFFFFFFF)
+            return false;
+    }
+    return CompareNoCaseVector(data1, data2, size);
+}
+
+#endif
+
+bool IsBlank(const char* data, size_t size) noexcept
+{
+#if defined(CPPCOMMON_STRING_UTILS_AVX2)
+    static const CPUDispatch<bool(const char*, size_t)> dispatch([]() { return CPU::HasAVX2() ? IsBlankAVX2 : IsBlankVector; });
+    return dispatch(data, size);
+#else
+    return IsBlankVector(data, size);
+#endif
+}
+
+void FlipCase(char* data, size_t size, char first, char last) noexcept
+{
+#if defined(CPPCOMMON_STRING_UTILS_AVX2)
+    static const CPUDispatch<void(char*, size_t, char, char)> dispatch([]() { return CPU::HasAVX2() ? FlipCaseAVX2 : FlipCaseVector; });
+    dispatch(data, size, first, last);
+#else
+    FlipCaseVector(data, size, first, last);
+#endif
+}
+
+} // namespace Internals
+//! @endcond
+
+size_t StringUtils::Find(std::string_view str, std::string_view substr, size_t pos) noexcept
+{
+    if (substr.empty() || (pos >= str.size()) || (substr.size() > (str.size() - pos)))
+        return std::string::npos;
+
+    // Single character is found with memchr()
+    if (substr.size() == 1)
+        return Find(str, substr[0], pos);
+
+    const char* data = str.data() + pos;
+    size_t size = str.size() - pos;
+
+#if defined(CPPCOMMON_STRING_UTILS_AVX2)
+    static const CPUDispatch<size_t(const char*, size_t, const char*, size_t)> dispatch([]() { return CPU::HasAVX2() ? Internals::FindAVX2 : Internals::FindVector; });
+    size_t found = dispatch(data, size, substr.data(), substr.size());
+#else
+    size_t found = Internals::FindVector(data, size, substr.data(), substr.size());
+#endif
+
+    return (found != std::string::npos) ? (pos + found) : std::string::npos;
+}
+
+bool StringUtils::IsBlank(const char* str)
+{
+    return IsBlank(std::string_view(str));
+}
+
+bool StringUtils::IsBlank(std::string_view str)
+{
+    return Internals::IsBlank(str.data(), str.size());
 }
 
 bool StringUtils::IsPatternMatch(const std::string& patterns, const std::string& str)
@@ -94,19 +417,64 @@ bool StringUtils::Compare(std::string_view str1, std::string_view str2)
     return (str1 == str2);
 }
 
-bool StringUtils::CompareNoCase(std::string_view str1, std::string_view str2)
+bool StringUtils::CompareNoCase(std::string_view str1, std::string_view str2) noexcept
 {
     if (str1.size() != str2.size())
         return false;
-    return std::equal(str1.cbegin(), str1.cend(), str2.cbegin(), [](std::string::value_type l, std::string::value_type r) { return std::tolower(l) == std::tolower(r); });
+
+#if defined(CPPCOMMON_STRING_UTILS_AVX2)
+    static const CPUDispatch<bool(const char*, const char*, size_t)> dispatch([]() { return CPU::HasAVX2() ? Internals::CompareNoCaseAVX2 : Internals::CompareNoCaseVector; });
+    return dispatch(str1.data(), str2.data(), str1.size());
+#else
+    return Internals::CompareNoCaseVector(str1.data(), str2.data(), str1.size());
+#endif
+}
+
+size_t StringUtils::HashNoCase(std::string_view str) noexcept
+{
+    const uint64_t multiplier = 0x9E3779B97F4A7C15ull;
+
+    const char* data = str.data();
+    size_t size = str.size();
+
+    // Hash lower case 8 bytes words
+    uint64_t hash = (uint64_t)size * multiplier;
+    for (; size >= 8; data += 8, size -= 8)
+    {
+        hash ^= Internals::LowerWord(Internals::LoadWord(data, 8));
+        hash = (hash ^ (hash >> 29)) * multiplier;
+    }
+    if (size > 0)
+    {
+        hash ^= Internals::LowerWord(Internals::LoadWord(data, size));
+        hash = (hash ^ (hash >> 29)) * multiplier;
+    }
+
+    // Final avalanche
+    hash ^= hash >> 33;
+    hash *= 0xFF51AFD7ED558CCDull;
+    hash ^= hash >> 33;
+    return (size_t)hash;
+}
+
+std::string& StringUtils::Lower(std::string& str)
+{
+    Internals::FlipCase(str.data(), str.size(), 'A', 'Z');
+    return str;
+}
+
+std::string& StringUtils::Upper(std::string& str)
+{
+    Internals::FlipCase(str.data(), str.size(), 'a', 'z');
+    return str;
 }
 
 size_t StringUtils::CountAll(std::string_view str, std::string_view substr)
 {
-    size_t count=0;
+    size_t count = 0;
 
     size_t pos = 0;
-    while ((pos = str.find(substr, pos)) != std::string::npos)
+    while ((pos = Find(str, substr, pos)) != std::string::npos)
     {
         pos += substr.size();
         ++count;
@@ -137,71 +505,73 @@ bool StringUtils::ReplaceLast(std::string& str, std::string_view substr, std::st
 
 bool StringUtils::ReplaceAll(std::string& str, std::string_view substr, std::string_view with)
 {
-    bool result = false;
+    size_t pos = Find(str, substr);
+    if (pos == std::string::npos)
+        return false;
 
-    size_t pos = 0;
-    while ((pos = str.find(substr, pos)) != std::string::npos)
+    // Replace in place substrings of the same size
+    if (with.size() == substr.size())
     {
-        str.replace(pos, substr.size(), with);
-        pos += with.size();
-        result = true;
+        do
+        {
+            std::memcpy(str.data() + pos, with.data(), with.size());
+            pos = Find(str, substr, pos + substr.size());
+        } while (pos != std::string::npos);
+        return true;
     }
 
-    return result;
+    // Build the result string once instead of shifting the tail on each replacement
+    size_t size = str.size();
+    if (with.size() > substr.size())
+        size += CountAll(std::string_view(str).substr(pos), substr) * (with.size() - substr.size());
+
+    std::string result;
+    result.reserve(size);
+
+    size_t last = 0;
+    do
+    {
+        result.append(str, last, pos - last);
+        result.append(with);
+        last = pos + substr.size();
+        pos = Find(str, substr, last);
+    } while (pos != std::string::npos);
+    result.append(str, last, std::string::npos);
+
+    str.swap(result);
+    return true;
 }
 
 std::vector<std::string> StringUtils::Split(std::string_view str, char delimiter, bool skip_empty)
 {
     std::vector<std::string> tokens;
-
-    size_t pos_current;
-    size_t pos_last = 0;
-    size_t length;
-
-    while (true)
-    {
-        pos_current = str.find(delimiter, pos_last);
-        if (pos_current == std::string::npos)
-            pos_current = str.size();
-
-        length = pos_current - pos_last;
-        if (!skip_empty || (length != 0))
-            tokens.emplace_back(str.substr(pos_last, length));
-
-        if (pos_current == str.size())
-            break;
-        else
-            pos_last = pos_current + 1;
-    }
-
+    for (auto token : Tokenize(str, delimiter, skip_empty))
+        tokens.emplace_back(token);
     return tokens;
 }
 
 std::vector<std::string> StringUtils::Split(std::string_view str, std::string_view delimiter, bool skip_empty)
 {
     std::vector<std::string> tokens;
+    for (auto token : Tokenize(str, delimiter, skip_empty))
+        tokens.emplace_back(token);
+    return tokens;
+}
 
-    size_t pos_current;
-    size_t pos_last = 0;
-    size_t length;
-
-    while (true)
-    {
-        pos_current = str.find(delimiter, pos_last);
-        if (pos_current == std::string::npos)
-            pos_current = str.size();
-
-        length = pos_current - pos_last;
-        if (!skip_empty || (length != 0))
-            tokens.emplace_back(str.substr(pos_last, length));
-
-        if (pos_current == str.size())
-            break;
-        else
-            pos_last = pos_current + delimiter.size();
-    }
+size_t StringUtils::Split(std::string_view str, char delimiter, std::vector<std::string_view>& tokens, bool skip_empty)
+{
+    tokens.clear();
+    for (auto token : Tokenize(str, delimiter, skip_empty))
+        tokens.emplace_back(token);
+    return tokens.size();
+}
 
-    return tokens;
+size_t StringUtils::Split(std::string_view str, std::string_view delimiter, std::vector<std::string_view>& tokens, bool skip_empty)
+{
+    tokens.clear();
+    for (auto token : Tokenize(str, delimiter, skip_empty))
+        tokens.emplace_back(token);
+    return tokens.size();
 }
 
 std::vector<std::string> StringUtils::SplitByAny(std::string_view str, std::string_view delimiters, bool skip_empty)
@@ -9,16 +9,33 @@
 #include "system/cpu.h"
 #include "utility/resource.h"
 
+#include <algorithm>
+#include <map>
+
 #if defined(__APPLE__)
 #include <sys/sysctl.h>
 #elif defined(unix) || defined(__unix) || defined(__unix__)
 #include <unistd.h>
+#include <cstdlib>
 #include <fstream>
 #include <regex>
 #elif defined(_WIN32) || defined(_WIN64)
 #include <windows.h>
 #endif
 
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#include <immintrin.h>
+#define CPPCOMMON_CPU_X86
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__amd64__) || defined(__i386__))
+#include <cpuid.h>
+#define CPPCOMMON_CPU_X86
+#endif
+
+#if defined(__linux__) && (defined(__aarch64__) || defined(__arm__))
+#include <sys/auxv.h>
+#endif
+
 namespace CppCommon {
 
 //! @cond INTERNALS
@@ -42,7 +59,195 @@ DWORD CountSetBits(ULONG_PTR pBitMask)
     return dwBitSetCount;
 }
 
+// Helper function to add processors of the group mask into the CPU set
+void AddGroupMask(CPUSet& cpus, const GROUP_AFFINITY& affinity)
+{
+    for (size_t i = 0; i < sizeof(KAFFINITY) * 8; ++i)
+    {
+        size_t cpu = (size_t)affinity.Group * sizeof(KAFFINITY) * 8 + i;
+        if ((affinity.Mask >> i) & 1)
+            cpus.set((int)cpu);
+    }
+}
+
+#elif defined(unix) || defined(__unix) || defined(__unix__)
+
+// Helper function to read the first line of the given system file
+std::string ReadLine(const std::string& path)
+{
+    std::string line;
+    std::ifstream stream(path);
+    if (stream)
+        getline(stream, line);
+    return line;
+}
+
+// Helper function to read the integer value of the given system file
+int ReadInt(const std::string& path, int value)
+{
+    std::string line = ReadLine(path);
+    return line.empty() ? value : std::atoi(line.c_str());
+}
+
+// Helper function to parse the cache size (e.g. "48K")
+size_t ParseSize(const std::string& size)
+{
+    size_t result = (size_t)std::atoll(size.c_str());
+    if (size.find('K') != std::string::npos)
+        result *= 1024;
+    else if (size.find('M') != std::string::npos)
+        result *= 1024 * 1024;
+    else if (size.find('G') != std::string::npos)
+        result *= 1024 * 1024 * 1024;
+    return result;
+}
+
+#endif
+
+// CPU instruction set features
+struct CPUFeatures
+{
+    bool sse2{false};
+    bool ssse3{false};
+    bool sse41{false};
+    bool sse42{false};
+    bool popcnt{false};
+    bool avx{false};
+    bool avx2{false};
+    bool fma{false};
+    bool bmi1{false};
+    bool bmi2{false};
+    bool avx512{false};
+    bool pclmul{false};
+    bool aes{false};
+    bool neon{false};
+    bool crc32{false};
+};
+
+#if defined(CPPCOMMON_CPU_X86)
+
+void CPUID(uint32_t leaf, uint32_t subleaf, uint32_t registers[4]) noexcept
+{
+#if defined(_MSC_VER)
+    int info[4];
+    __cpuidex(info, (int)leaf, (int)subleaf);
+    for (int i = 0; i < 4; ++i)
+        registers[i] = (uint32_t)info[i];
+#else
+    __cpuid_count(leaf, subleaf, registers[0], registers[1], registers[2], registers[3]);
+#endif
+}
+
+uint64_t XGETBV() noexcept
+{
+#if defined(_MSC_VER)
+    return _xgetbv(0);
+#else
+    uint32_t eax, edx;
+    __asm__ __volatile__("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+    return ((uint64_t)edx << 32) | eax;
+#endif
+}
+
+#endif
+
+CPUFeatures DetectFeatures() noexcept
+{
+    CPUFeatures features;
+
+#if defined(CPPCOMMON_CPU_X86)
+    uint32_t registers[4];
+    CPUID(0, 0, registers);
+    uint32_t max_leaf = registers[0];
+    if (max_leaf < 1)
+        return features;
+
+    CPUID(1, 0, registers);
+    uint32_t ecx1 = registers[2];
+    uint32_t edx1 = registers[3];
+    features.sse2 = (edx1 & (1u << 26)) != 0;
+    features.ssse3 = (ecx1 & (1u << 9)) != 0;
+    features.sse41 = (ecx1 & (1u << 19)) != 0;
+    features.sse42 = (ecx1 & (1u << 20)) != 0;
+    features.popcnt = (ecx1 & (1u << 23)) != 0;
+    features.pclmul = (ecx1 & (1u << 1)) != 0;
+    features.aes = (ecx1 & (1u << 25)) != 0;
+    features.crc32 = features.sse42;
+
+    // Check the operating system support of AVX (XMM/YMM) and AVX-512 (opmask/ZMM) registers
+    bool os_avx = false;
+    bool os_avx512 = false;
+    if ((ecx1 & (1u << 27)) != 0)
+    {
+        uint64_t xcr0 = XGETBV();
+        os_avx = (xcr0 & 0x06) == 0x06;
+        os_avx512 = (xcr0 & 0xE6) == 0xE6;
+    }
+    features.avx = os_avx && ((ecx1 & (1u << 28)) != 0);
+    features.fma = features.avx && ((ecx1 & (1u << 12)) != 0);
+
+    if (max_leaf >= 7)
+    {
+        CPUID(7, 0, registers);
+        uint32_t ebx7 = registers[1];
+        features.bmi1 = (ebx7 & (1u << 3)) != 0;
+        features.bmi2 = (ebx7 & (1u << 8)) != 0;
+        features.avx2 = features.avx && ((ebx7 & (1u << 5)) != 0);
+
+        // AVX-512 F, DQ, CD, BW and VL subsets
+        const uint32_t avx512 = (1u << 16) | (1u << 17) | (1u << 28) | (1u << 30) | (1u << 31);
+        features.avx512 = os_avx512 && ((ebx7 & avx512) == avx512);
+    }
+#elif defined(__aarch64__) || defined(_M_ARM64)
+    // Advanced SIMD is mandatory for ARMv8-A
+    features.neon = true;
+#if defined(__linux__)
+    unsigned long hwcap = getauxval(AT_HWCAP);
+    features.aes = (hwcap & (1ul << 3)) != 0;
+    features.pclmul = (hwcap & (1ul << 4)) != 0;
+    features.crc32 = (hwcap & (1ul << 7)) != 0;
+#elif defined(__APPLE__)
+    // Apple Silicon supports ARMv8 cryptography extensions
+    int crc32 = 0;
+    size_t size = sizeof(crc32);
+    features.crc32 = (sysctlbyname("hw.optional.armv8_crc32", &crc32, &size, nullptr, 0) == 0) && (crc32 != 0);
+    features.aes = true;
+    features.pclmul = true;
+#elif defined(_WIN32) || defined(_WIN64)
+    features.aes = IsProcessorFeaturePresent(PF_ARM_V8_CRYPTO_INSTRUCTIONS_AVAILABLE) != 0;
+    features.pclmul = features.aes;
+    features.crc32 = IsProcessorFeaturePresent(PF_ARM_V8_CRC32_INSTRUCTIONS_AVAILABLE) != 0;
+#else
+#if defined(__ARM_FEATURE_CRYPTO) || defined(__ARM_FEATURE_AES)
+    features.aes = true;
+    features.pclmul = true;
+#endif
+#if defined(__ARM_FEATURE_CRC32)
+    features.crc32 = true;
+#endif
+#endif
+#elif defined(__arm__)
+#if defined(__linux__)
+    unsigned long hwcap = getauxval(AT_HWCAP);
+    unsigned long hwcap2 = getauxval(AT_HWCAP2);
+    features.neon = (hwcap & (1ul << 12)) != 0;
+    features.aes = (hwcap2 & (1ul << 0)) != 0;
+    features.pclmul = (hwcap2 & (1ul << 1)) != 0;
+    features.crc32 = (hwcap2 & (1ul << 4)) != 0;
+#elif defined(__ARM_NEON)
+    features.neon = true;
 #endif
+#endif
+
+    return features;
+}
+
+const CPUFeatures& GetFeatures() noexcept
+{
+    // Features are detected once per process
+    static const CPUFeatures features = DetectFeatures();
+    return features;
+}
 
 } // namespace Internals
 //! @endcond
@@ -137,7 +342,8 @@ std::pair<int, int> CPU::TotalCores()
     return std::make_pair(logical, physical);
 #elif defined(unix) || defined(__unix) || defined(__unix__)
     long processors = sysconf(_SC_NPROCESSORS_ONLN);
-    return std::make_pair(processors, processors);
+    int cores = Topology().cores();
+    return std::make_pair((int)processors, (cores > 0) ? cores : (int)processors);
 #elif defined(_WIN32) || defined(_WIN64)
     BOOL allocated = FALSE;
     PSYSTEM_LOGICAL_PROCESSOR_INFORMATION pBuffer = nullptr;
@@ -243,4 +449,408 @@ bool CPU::HyperThreading()
     return (cores.first != cores.second);
 }
 
+bool CPU::HasSSE2() noexcept { return Internals::GetFeatures().sse2; }
+bool CPU::HasSSSE3() noexcept { return Internals::GetFeatures().ssse3; }
+bool CPU::HasSSE41() noexcept { return Internals::GetFeatures().sse41; }
+bool CPU::HasSSE42() noexcept { return Internals::GetFeatures().sse42; }
+bool CPU::HasPOPCNT() noexcept { return Internals::GetFeatures().popcnt; }
+bool CPU::HasAVX() noexcept { return Internals::GetFeatures().avx; }
+bool CPU::HasAVX2() noexcept { return Internals::GetFeatures().avx2; }
+bool CPU::HasFMA() noexcept { return Internals::GetFeatures().fma; }
+bool CPU::HasBMI1() noexcept { return Internals::GetFeatures().bmi1; }
+bool CPU::HasBMI2() noexcept { return Internals::GetFeatures().bmi2; }
+bool CPU::HasAVX512() noexcept { return Internals::GetFeatures().avx512; }
+bool CPU::HasPCLMUL() noexcept { return Internals::GetFeatures().pclmul; }
+bool CPU::HasAES() noexcept { return Internals::GetFeatures().aes; }
+bool CPU::HasNEON() noexcept { return Internals::GetFeatures().neon; }
+bool CPU::HasCRC32() noexcept { return Internals::GetFeatures().crc32; }
+
+std::string CPU::Features()
+{
+    const Internals::CPUFeatures& features = Internals::GetFeatures();
+
+    const std::pair<bool, const char*> names[] =
+    {
+        { features.sse2, "SSE2" },
+        { features.ssse3, "SSSE3" },
+        { features.sse41, "SSE4.1" },
+        { features.sse42, "SSE4.2" },
+        { features.popcnt, "POPCNT" },
+        { features.avx, "AVX" },
+        { features.avx2, "AVX2" },
+        { features.fma, "FMA" },
+        { features.bmi1, "BMI1" },
+        { features.bmi2, "BMI2" },
+        { features.avx512, "AVX-512" },
+        { features.pclmul, "PCLMUL" },
+        { features.aes, "AES" },
+        { features.neon, "NEON" },
+        { features.crc32, "CRC32" }
+    };
+
+    std::string result;
+    for (const auto& name : names)
+    {
+        if (name.first)
+        {
+            if (!result.empty())
+                result.push_back(' ');
+            result.append(name.second);
+        }
+    }
+    return result;
+}
+
+CPUSet CPU::Isolated()
+{
+#if defined(__APPLE__)
+    return CPUSet();
+#elif defined(unix) || defined(__unix) || defined(__unix__)
+    return CPUSet::Parse(Internals::ReadLine("/sys/devices/system/cpu/isolated"));
+#else
+    return CPUSet();
+#endif
+}
+
+const CPUTopology& CPU::Topology()
+{
+    static CPUTopology topology = DiscoverTopology();
+    return topology;
+}
+
+CPUTopology CPU::DiscoverTopology()
+{
+    CPUTopology topology;
+
+#if defined(__APPLE__)
+    int logical = 0;
+    size_t logical_size = sizeof(logical);
+    if (sysctlbyname("hw.logicalcpu", &logical, &logical_size, nullptr, 0) != 0)
+        logical = 1;
+
+    int physical = 0;
+    size_t physical_size = sizeof(physical);
+    if (sysctlbyname("hw.physicalcpu", &physical, &physical_size, nullptr, 0) != 0)
+        physical = logical;
+
+    // Logical processors of the same physical core are numbered sequentially
+    int threads = std::max(logical / std::max(physical, 1), 1);
+    for (int cpu = 0; cpu < logical; ++cpu)
+        topology._processors.push_back({ cpu, cpu / threads, 0, 0 });
+
+    // Caches are reported per level only, so consider them shared by all logical processors
+    uint64_t line = 0;
+    size_t line_size = sizeof(line);
+    if (sysctlbyname("hw.cachelinesize", &line, &line_size, nullptr, 0) != 0)
+        line = 0;
+
+    static const std::pair<const char*, std::pair<int, CPUCacheType>> levels[] =
+    {
+        { "hw.l1dcachesize", { 1, CPUCacheType::DATA } },
+        { "hw.l1icachesize", { 1, CPUCacheType::INSTRUCTION } },
+        { "hw.l2cachesize", { 2, CPUCacheType::UNIFIED } },
+        { "hw.l3cachesize", { 3, CPUCacheType::UNIFIED } }
+    };
+    for (const auto& level : levels)
+    {
+        uint64_t size = 0;
+        size_t size_size = sizeof(size);
+        if ((sysctlbyname(level.first, &size, &size_size, nullptr, 0) == 0) && (size > 0))
+        {
+            CPUTopology::Cache cache = { level.second.first, level.second.second, (size_t)size, (size_t)line, CPUSet() };
+            for (int cpu = 0; cpu < logical; ++cpu)
+                cache.cpus.set(cpu);
+            topology.AddCache(cache);
+        }
+    }
+#elif defined(unix) || defined(__unix) || defined(__unix__)
+    const std::string root = "/sys/devices/system/cpu/";
+
+    CPUSet online = CPUSet::Parse(Internals::ReadLine(root + "online"));
+    if (online.none())
+    {
+        long processors = sysconf(_SC_NPROCESSORS_ONLN);
+        for (long cpu = 0; cpu < processors; ++cpu)
+            online.set((int)cpu);
+    }
+
+    // NUMA nodes of logical processors
+    std::map<int, int> nodes;
+    CPUSet online_nodes = CPUSet::Parse(Internals::ReadLine("/sys/devices/system/node/online"));
+    for (int node = online_nodes.first(); node >= 0; node = online_nodes.next(node))
+    {
+        CPUSet cpus = CPUSet::Parse(Internals::ReadLine("/sys/devices/system/node/node" + std::to_string(node) + "/cpulist"));
+        for (int cpu = cpus.first(); cpu >= 0; cpu = cpus.next(cpu))
+            nodes[cpu] = node;
+    }
+
+    // Physical cores are identified by the socket and the core id within the socket
+    std::map<std::pair<int, int>, int> cores;
+    for (int cpu = online.first(); cpu >= 0; cpu = online.next(cpu))
+    {
+        std::string path = root + "cpu" + std::to_string(cpu) + "/";
+
+        int socket = std::max(Internals::ReadInt(path + "topology/physical_package_id", 0), 0);
+        int core_id = Internals::ReadInt(path + "topology/core_id", cpu);
+        auto it = cores.emplace(std::make_pair(socket, core_id), (int)cores.size()).first;
+        auto node = nodes.find(cpu);
+
+        topology._processors.push_back({ cpu, it->second, socket, (node != nodes.end()) ? node->second : 0 });
+
+        // CPU caches of the logical processor
+        for (int index = 0;; ++index)
+        {
+            std::string cache_path = path + "cache/index" + std::to_string(index) + "/";
+            std::string level = Internals::ReadLine(cache_path + "level");
+            if (level.empty())
+                break;
+
+            std::string type = Internals::ReadLine(cache_path + "type");
+
+            CPUTopology::Cache cache;
+            cache.level = std::atoi(level.c_str());
+            cache.type = (type == "Data") ? CPUCacheType::DATA : ((type == "Instruction") ? CPUCacheType::INSTRUCTION : CPUCacheType::UNIFIED);
+            cache.size = Internals::ParseSize(Internals::ReadLine(cache_path + "size"));
+            cache.line = (size_t)std::max(Internals::ReadInt(cache_path + "coherency_line_size", 0), 0);
+            cache.cpus = CPUSet::Parse(Internals::ReadLine(cache_path + "shared_cpu_list"));
+            if (cache.cpus.none())
+                cache.cpus.set(cpu);
+            topology.AddCache(cache);
+        }
+    }
+#elif defined(_WIN32) || defined(_WIN64)
+    DWORD dwLength = 0;
+    GetLogicalProcessorInformationEx(RelationAll, nullptr, &dwLength);
+    std::vector<BYTE> buffer(dwLength);
+    if ((dwLength > 0) && GetLogicalProcessorInformationEx(RelationAll, (PSYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX)buffer.data(), &dwLength))
+    {
+        std::map<int, CPUTopology::Processor> processors;
+        int cores = 0;
+        int sockets = 0;
+
+        DWORD dwOffset = 0;
+        while (dwOffset < dwLength)
+        {
+            PSYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX pCurrent = (PSYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX)(buffer.data() + dwOffset);
+
+            CPUSet cpus;
+            switch (pCurrent->Relationship)
+            {
+                case RelationProcessorCore:
+                case RelationProcessorPackage:
+                {
+                    for (WORD i = 0; i < pCurrent->Processor.GroupCount; ++i)
+                        Internals::AddGroupMask(cpus, pCurrent->Processor.GroupMask[i]);
+                    int index = (pCurrent->Relationship == RelationProcessorCore) ? cores++ : sockets++;
+                    for (int cpu = cpus.first(); cpu >= 0; cpu = cpus.next(cpu))
+                    {
+                        auto& processor = processors.emplace(cpu, CPUTopology::Processor{ cpu, 0, 0, 0 }).first->second;
+                        if (pCurrent->Relationship == RelationProcessorCore)
+                            processor.core = index;
+                        else
+                            processor.socket = index;
+                    }
+                    break;
+                }
+                case RelationNumaNode:
+                {
+                    Internals::AddGroupMask(cpus, pCurrent->NumaNode.GroupMask);
+                    for (int cpu = cpus.first(); cpu >= 0; cpu = cpus.next(cpu))
+                        processors.emplace(cpu, CPUTopology::Processor{ cpu, 0, 0, 0 }).first->second.node = (int)pCurrent->NumaNode.NodeNumber;
+                    break;
+                }
+                case RelationCache:
+                {
+                    if ((pCurrent->Cache.Type == CacheUnified) || (pCurrent->Cache.Type == CacheData) || (pCurrent->Cache.Type == CacheInstruction))
+                    {
+                        CPUTopology::Cache cache;
+                        cache.level = pCurrent->Cache.Level;
+                        cache.type = (pCurrent->Cache.Type == CacheData) ? CPUCacheType::DATA : ((pCurrent->Cache.Type == CacheInstruction) ? CPUCacheType::INSTRUCTION : CPUCacheType::UNIFIED);
+                        cache.size = pCurrent->Cache.CacheSize;
+                        cache.line = pCurrent->Cache.LineSize;
+                        Internals::AddGroupMask(cache.cpus, pCurrent->Cache.GroupMask);
+                        topology.AddCache(cache);
+                    }
+                    break;
+                }
+                default:
+                    break;
+            }
+
+            dwOffset += pCurrent->Size;
+        }
+
+        for (const auto& processor : processors)
+            topology._processors.push_back(processor.second);
+    }
+#else
+    #error Unsupported platform
+#endif
+
+    // Fallback to the flat topology of independent logical processors
+    if (topology._processors.empty())
+    {
+        int processors = std::max(Affinity(), 1);
+        for (int cpu = 0; cpu < processors; ++cpu)
+            topology._processors.push_back({ cpu, cpu, 0, 0 });
+    }
+
+    topology.Finalize();
+    return topology;
+}
+
+size_t CPUTopology::CacheLineSize() const noexcept
+{
+    for (const auto& cache : _caches)
+        if ((cache.level == 1) && (cache.type != CPUCacheType::INSTRUCTION) && (cache.line > 0))
+            return cache.line;
+
+    for (const auto& cache : _caches)
+        if (cache.line > 0)
+            return cache.line;
+
+    return 0;
+}
+
+size_t CPUTopology::CacheSize(int level) const noexcept
+{
+    for (const auto& cache : _caches)
+        if ((cache.level == level) && (cache.type != CPUCacheType::INSTRUCTION))
+            return cache.size;
+
+    return 0;
+}
+
+CPUSet CPUTopology::All() const
+{
+    CPUSet cpus;
+    for (const auto& processor : _processors)
+        cpus.set(processor.cpu);
+    return cpus;
+}
+
+CPUSet CPUTopology::NodeCPUs(int node) const
+{
+    CPUSet cpus;
+    for (const auto& processor : _processors)
+        if (processor.node == node)
+            cpus.set(processor.cpu);
+    return cpus;
+}
+
+CPUSet CPUTopology::SocketCPUs(int socket) const
+{
+    CPUSet cpus;
+    for (const auto& processor : _processors)
+        if (processor.socket == socket)
+            cpus.set(processor.cpu);
+    return cpus;
+}
+
+CPUSet CPUTopology::Domain(int cpu, CPUDomain domain) const
+{
+    CPUSet cpus;
+
+    const Processor* current = Find(cpu);
+    if (current == nullptr)
+        return cpus;
+
+    // Find the cache of the given level shared by the logical processor
+    if ((domain == CPUDomain::L2) || (domain == CPUDomain::L3))
+    {
+        int level = (domain == CPUDomain::L2) ? 2 : 3;
+        for (const auto& cache : _caches)
+            if ((cache.level == level) && (cache.type != CPUCacheType::INSTRUCTION) && cache.cpus[cpu])
+                return cache.cpus;
+
+        // Fallback to the socket domain
+        domain = CPUDomain::SOCKET;
+    }
+
+    for (const auto& processor : _processors)
+    {
+        bool same = false;
+        switch (domain)
+        {
+            case CPUDomain::CORE:
+                same = (processor.core == current->core);
+                break;
+            case CPUDomain::SOCKET:
+                same = (processor.socket == current->socket);
+                break;
+            case CPUDomain::NODE:
+                same = (processor.node == current->node);
+                break;
+            default:
+                break;
+        }
+        if (same)
+            cpus.set(processor.cpu);
+    }
+
+    return cpus;
+}
+
+std::vector<std::pair<int, int>> CPUTopology::Pairs(CPUDomain domain) const
+{
+    std::vector<std::pair<int, int>> result;
+
+    CPUSet used;
+    for (const auto& processor : _processors)
+    {
+        if (used[processor.cpu])
+            continue;
+
+        // Find the first unused logical processor of the same domain
+        CPUSet cpus = Domain(processor.cpu, domain);
+        for (const auto& other : _processors)
+        {
+            if ((other.cpu != processor.cpu) && cpus[other.cpu] && !used[other.cpu])
+            {
+                used.set(processor.cpu);
+                used.set(other.cpu);
+                result.emplace_back(processor.cpu, other.cpu);
+                break;
+            }
+        }
+    }
+
+    return result;
+}
+
+const CPUTopology::Processor* CPUTopology::Find(int cpu) const noexcept
+{
+    auto it = std::lower_bound(_processors.begin(), _processors.end(), cpu, [](const Processor& processor, int index) { return processor.cpu < index; });
+    return ((it != _processors.end()) && (it->cpu == cpu)) ? &(*it) : nullptr;
+}
+
+void CPUTopology::AddCache(const Cache& cache)
+{
+    for (const auto& item : _caches)
+        if ((item.level == cache.level) && (item.type == cache.type) && (item.cpus == cache.cpus))
+            return;
+
+    _caches.push_back(cache);
+}
+
+void CPUTopology::Finalize()
+{
+    std::sort(_processors.begin(), _processors.end(), [](const Processor& p1, const Processor& p2) { return p1.cpu < p2.cpu; });
+    std::sort(_caches.begin(), _caches.end(), [](const Cache& c1, const Cache& c2) { return c1.level < c2.level; });
+
+    int cores = 0;
+    int sockets = 0;
+    int nodes = 0;
+    for (const auto& processor : _processors)
+    {
+        cores = std::max(cores, processor.core + 1);
+        sockets = std::max(sockets, processor.socket + 1);
+        nodes = std::max(nodes, processor.node + 1);
+    }
+
+    _cores = cores;
+    _sockets = sockets;
+    _nodes = nodes;
+}
+
 } // namespace CppCommon
@@ -8,11 +8,16 @@
 
 #include "system/dll.h"
 
+#include "algorithms/parallel.h"
 #include "errors/fatal.h"
+#include "filesystem/directory.h"
 #include "string/format.h"
+#include "time/timestamp.h"
 #include "utility/validate_aligned_storage.h"
 
+#include <algorithm>
 #include <cassert>
+#include <cstring>
 
 #if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
 #include <dlfcn.h>
@@ -27,7 +32,7 @@ namespace CppCommon {
 class DLL::Impl
 {
 public:
-    Impl() : _dll(nullptr) {}
+    Impl() : _dll(nullptr), _options(DLLOptions::NONE), _load_time(0) {}
 
     ~Impl()
     {
@@ -43,6 +48,8 @@ public:
     }
 
     const Path path() const { return _path; }
+    Flags<DLLOptions> options() const { return _options; }
+    Timespan load_time() const { return _load_time; }
 
     bool IsLoaded() const
     {
@@ -83,18 +90,18 @@ public:
             _path.Concat(DLL::extension());
     }
 
-    bool Load()
+    void Assign(const Path& path, const Flags<DLLOptions>& options)
     {
-        assert(!IsLoaded() && "DLL is already loaded!");
-        if (IsLoaded())
-            Unload();
+        Assign(path);
+        _options = options;
+    }
 
-#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
-        _dll = dlopen(_path.string().c_str(), RTLD_NOW);
-#elif defined(_WIN32) || defined(_WIN64)
-        _dll = LoadLibraryExW(_path.wstring().c_str(), nullptr, 0);
-#endif
-        return (_dll != nullptr);
+    bool Load()
+    {
+        Timestamp start = NanoTimestamp();
+        bool result = Open();
+        _load_time = NanoTimestamp() - start;
+        return result;
     }
 
     bool Load(const Path& path)
@@ -103,6 +110,25 @@ public:
         return Load();
     }
 
+    bool Load(const Path& path, const Flags<DLLOptions>& options)
+    {
+        Assign(path, options);
+        return Load();
+    }
+
+    bool Load(DLLSymbolTable& symbols)
+    {
+        Timestamp start = NanoTimestamp();
+        bool result = Open();
+        if (result && !Resolve(symbols))
+        {
+            Unload();
+            result = false;
+        }
+        _load_time = NanoTimestamp() - start;
+        return result;
+    }
+
     void Unload()
     {
         assert(IsLoaded() && "DLL is not loaded!");
@@ -133,6 +159,43 @@ public:
 #endif
     }
 
+    void swap(Impl& impl) noexcept
+    {
+        using std::swap;
+        swap(_path, impl._path);
+        swap(_dll, impl._dll);
+        swap(_options, impl._options);
+        swap(_load_time, impl._load_time);
+    }
+
+    bool Resolve(DLLSymbolTable& symbols) const
+    {
+        assert(IsLoaded() && "DLL is not loaded!");
+        if (!IsLoaded())
+        {
+            symbols.Reset();
+            return false;
+        }
+
+        symbols._resolved = true;
+        for (auto& symbol : symbols._symbols)
+        {
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+            *symbol.address = dlsym(_dll, symbol.name);
+#elif defined(_WIN32) || defined(_WIN64)
+            *symbol.address = (void*)GetProcAddress(_dll, symbol.name);
+#endif
+            if (symbol.required && (*symbol.address == nullptr))
+                symbols._resolved = false;
+        }
+
+        // Do not leave partially resolved symbol table
+        if (!symbols._resolved)
+            symbols.Reset();
+
+        return symbols._resolved;
+    }
+
 private:
     Path _path;
 #if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
@@ -140,6 +203,34 @@ private:
 #elif defined(_WIN32) || defined(_WIN64)
     HMODULE _dll;
 #endif
+    Flags<DLLOptions> _options;
+    Timespan _load_time;
+
+    bool Open()
+    {
+        assert(!IsLoaded() && "DLL is already loaded!");
+        if (IsLoaded())
+            Unload();
+
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+        int mode = (_options & DLLOptions::LAZY) ? RTLD_LAZY : RTLD_NOW;
+        mode |= (_options & DLLOptions::GLOBAL) ? RTLD_GLOBAL : RTLD_LOCAL;
+#if defined(RTLD_NODELETE)
+        if (_options & DLLOptions::NODELETE)
+            mode |= RTLD_NODELETE;
+#endif
+        _dll = dlopen(_path.string().c_str(), mode);
+#elif defined(_WIN32) || defined(_WIN64)
+        _dll = LoadLibraryExW(_path.wstring().c_str(), nullptr, 0);
+        if ((_dll != nullptr) && (_options & DLLOptions::NODELETE))
+        {
+            // Pin the module, so FreeLibrary() will not unload it
+            HMODULE pinned;
+            GetModuleHandleExW(GET_MODULE_HANDLE_EX_FLAG_FROM_ADDRESS | GET_MODULE_HANDLE_EX_FLAG_PIN, (LPCWSTR)_dll, &pinned);
+        }
+#endif
+        return (_dll != nullptr);
+    }
 };
 
 //! @endcond
@@ -155,7 +246,7 @@ DLL::DLL()
     new(&_storage)Impl();
 }
 
-DLL::DLL(const Path& path, bool load)
+DLL::DLL(const Path& path, bool load, const Flags<DLLOptions>& options)
 {
     // Check implementation storage parameters
     [[maybe_unused]] ValidateAlignedStorage<sizeof(Impl), alignof(Impl), StorageSize, StorageAlign> _;
@@ -165,7 +256,7 @@ DLL::DLL(const Path& path, bool load)
     // Create the implementation instance
     new(&_storage)Impl();
 
-    impl().Assign(path);
+    impl().Assign(path, options);
 
     if (load)
         impl().Load();
@@ -181,7 +272,7 @@ DLL::DLL(const DLL& dll)
     // Create the implementation instance
     new(&_storage)Impl();
 
-    impl().Assign(dll.path());
+    impl().Assign(dll.path(), dll.options());
 }
 
 DLL::DLL(DLL&& dll) noexcept
@@ -194,7 +285,7 @@ DLL::DLL(DLL&& dll) noexcept
     // Create the implementation instance
     new(&_storage)Impl();
 
-    std::swap(_storage, dll._storage);
+    impl().swap(dll.impl());
 }
 
 DLL::~DLL()
@@ -211,31 +302,56 @@ DLL& DLL::operator=(const Path& path)
 
 DLL& DLL::operator=(const DLL& dll)
 {
-    impl().Assign(dll.path());
+    impl().Assign(dll.path(), dll.options());
     return *this;
 }
 
 DLL& DLL::operator=(DLL&& dll) noexcept
 {
-    std::swap(_storage, dll._storage);
+    impl().swap(dll.impl());
     return *this;
 }
 
 const Path DLL::path() const { return impl().path(); }
+Flags<DLLOptions> DLL::options() const { return impl().options(); }
+Timespan DLL::load_time() const { return impl().load_time(); }
 
 bool DLL::IsLoaded() const { return impl().IsLoaded(); }
 bool DLL::IsResolve(const std::string& name) const { return impl().IsResolve(name); }
 
 bool DLL::Load() { return impl().Load(); }
 bool DLL::Load(const Path& path) { return impl().Load(path); }
+bool DLL::Load(const Path& path, const Flags<DLLOptions>& options) { return impl().Load(path, options); }
+bool DLL::Load(DLLSymbolTable& symbols) { return impl().Load(symbols); }
 void DLL::Unload() { impl().Unload(); }
 
 void* DLL::ResolveAddress(const std::string& name) const { return impl().ResolveAddress(name); }
+bool DLL::Resolve(DLLSymbolTable& symbols) const { return impl().Resolve(symbols); }
+
+std::vector<DLL> DLL::LoadDirectory(ThreadPool& pool, const Path& directory, const Flags<DLLOptions>& options)
+{
+    std::vector<DLL> result;
+
+    // Collect dynamic link libraries of the directory
+    std::string prefix = DLL::prefix();
+    std::string extension = DLL::extension();
+    for (const auto& file : Directory(directory.absolute()).GetFiles())
+    {
+        std::string filename = file.filename().string();
+        if ((file.extension() == extension) && (std::strncmp(filename.c_str(), prefix.c_str(), prefix.size()) == 0))
+            result.emplace_back(file, false, options);
+    }
+    std::sort(result.begin(), result.end(), [](const DLL& dll1, const DLL& dll2) { return dll1.path() < dll2.path(); });
+
+    // Load dynamic link libraries in parallel, one library per task
+    ParallelFor(pool, result.begin(), result.end(), [](DLL& dll) { dll.Load(); }, 1);
+
+    return result;
+}
 
 void DLL::swap(DLL& dll) noexcept
 {
-    using std::swap;
-    swap(_storage, dll._storage);
+    impl().swap(dll.impl());
 }
 
 } // namespace CppCommon
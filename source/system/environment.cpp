@@ -11,9 +11,9 @@
 #include "string/encoding.h"
 #include "utility/resource.h"
 
-#include <codecvt>
+#include <algorithm>
 #include <cstring>
-#include <locale>
+#include <mutex>
 #include <sstream>
 
 #if defined(__APPLE__)
@@ -382,9 +382,8 @@ std::string Environment::OSVersion()
 
     // Windows Service Pack version
     std::wstring sp_version(osvi.szCSDVersion);
-    std::wstring_convert<std::codecvt_utf8_utf16<wchar_t>> convert;
     if (std::wcslen(osvi.szCSDVersion) > 0)
-        os << " " << convert.to_bytes(sp_version.data(), sp_version.data() + sp_version.size());
+        os << " " << Encoding::ToUTF8(sp_version);
 
     // Windows build
     os << " (build " << osvi.dwBuildNumber << ")";
@@ -470,6 +469,77 @@ std::map<std::string, std::string> Environment::envars()
     return result;
 }
 
+//! @cond INTERNALS
+namespace Internals {
+
+std::mutex& snapshot_lock()
+{
+    static std::mutex lock;
+    return lock;
+}
+
+std::shared_ptr<const EnvironmentSnapshot>& snapshot_cache()
+{
+    static std::shared_ptr<const EnvironmentSnapshot> snapshot;
+    return snapshot;
+}
+
+} // namespace Internals
+//! @endcond
+
+EnvironmentSnapshot::EnvironmentSnapshot()
+{
+    auto envars = Environment::envars();
+
+    // Reserve the buffer once, so string views are not invalidated
+    size_t size = 0;
+    for (const auto& envar : envars)
+        size += envar.first.size() + envar.second.size();
+    _buffer.reserve(size);
+
+    _envars = Envars(std::max((size_t)16, envars.size() * 2));
+    for (const auto& envar : envars)
+    {
+        if (envar.first.empty())
+            continue;
+
+        size_t offset = _buffer.size();
+        _buffer.append(envar.first);
+        _buffer.append(envar.second);
+        std::string_view key(_buffer.data() + offset, envar.first.size());
+        std::string_view value(_buffer.data() + offset + envar.first.size(), envar.second.size());
+        _envars.emplace(key, value);
+    }
+}
+
+std::string_view EnvironmentSnapshot::Get(std::string_view name, std::string_view default_value) const noexcept
+{
+    if (name.empty())
+        return default_value;
+
+    auto it = _envars.find(name);
+    return (it != _envars.end()) ? it->second : default_value;
+}
+
+std::shared_ptr<const EnvironmentSnapshot> Environment::Snapshot()
+{
+    std::scoped_lock locker(Internals::snapshot_lock());
+    auto& snapshot = Internals::snapshot_cache();
+    if (!snapshot)
+        snapshot = std::make_shared<const EnvironmentSnapshot>();
+    return snapshot;
+}
+
+void Environment::InvalidateSnapshot()
+{
+    std::shared_ptr<const EnvironmentSnapshot> snapshot;
+    {
+        std::scoped_lock locker(Internals::snapshot_lock());
+        // Release the old snapshot outside of the lock
+        Internals::snapshot_cache().swap(snapshot);
+    }
+}
+
 std::string Environment::GetEnvar(const std::string name)
 {
 #if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
@@ -499,6 +569,7 @@ void Environment::SetEnvar(const std::string name, const std::string value)
     if (!SetEnvironmentVariableW(Encoding::FromUTF8(name).c_str(), Encoding::FromUTF8(value).c_str()))
         throwex SystemException("Cannot set environment variable - " + name);
 #endif
+    InvalidateSnapshot();
 }
 
 void Environment::ClearEnvar(const std::string name)
@@ -510,6 +581,7 @@ void Environment::ClearEnvar(const std::string name)
     if (!SetEnvironmentVariableW(Encoding::FromUTF8(name).c_str(), nullptr))
         throwex SystemException("Cannot clear environment variable - " + name);
 #endif
+    InvalidateSnapshot();
 }
 
 } // namespace CppCommon
@@ -0,0 +1,690 @@
+/*!
+    \file event_loop.cpp
+    \brief Event loop implementation
+    \author Ivan Shynkarenka
+    \date 15.10.2026
+    \copyright MIT License
+*/
+
+#include "system/event_loop.h"
+
+#include "cache/timerwheel.h"
+#include "errors/fatal.h"
+#include "string/format.h"
+
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <vector>
+
+#if defined(linux) || defined(__linux) || defined(__linux__)
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/syscall.h>
+#include <sys/wait.h>
+#include <errno.h>
+#include <signal.h>
+#include <unistd.h>
+#elif defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+#include <sys/types.h>
+#include <sys/event.h>
+#include <sys/time.h>
+#include <sys/wait.h>
+#include <errno.h>
+#include <signal.h>
+#include <unistd.h>
+#elif defined(_WIN32) || defined(_WIN64)
+#include <windows.h>
+#undef max
+#undef min
+#endif
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+
+class EventLoop::Impl
+{
+public:
+    Impl(const Timespan& resolution) : _wheel(resolution, NanoTimestamp()), _id(0), _dispatching(false), _running(false), _stop(false)
+    {
+#if defined(linux) || defined(__linux) || defined(__linux__)
+        _polled = 0;
+        _epoll = epoll_create1(EPOLL_CLOEXEC);
+        if (_epoll < 0)
+            throwex SystemException("Failed to create an epoll instance for the event loop!");
+        _event = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+        if (_event < 0)
+        {
+            close(_epoll);
+            throwex SystemException("Failed to create a wakeup event for the event loop!");
+        }
+        struct epoll_event event = {};
+        event.events = EPOLLIN;
+        event.data.u64 = 0;
+        if (epoll_ctl(_epoll, EPOLL_CTL_ADD, _event, &event) != 0)
+        {
+            close(_event);
+            close(_epoll);
+            throwex SystemException("Failed to register a wakeup event for the event loop!");
+        }
+#elif defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+        _kqueue = kqueue();
+        if (_kqueue < 0)
+            throwex SystemException("Failed to create a kqueue instance for the event loop!");
+        struct kevent event;
+        EV_SET(&event, 0, EVFILT_USER, EV_ADD | EV_CLEAR, 0, 0, nullptr);
+        if (kevent(_kqueue, &event, 1, nullptr, 0, nullptr) != 0)
+        {
+            close(_kqueue);
+            throwex SystemException("Failed to register a wakeup event for the event loop!");
+        }
+#elif defined(_WIN32) || defined(_WIN64)
+        _polled = 0;
+        _port = CreateIoCompletionPort(INVALID_HANDLE_VALUE, nullptr, 0, 1);
+        if (_port == nullptr)
+            throwex SystemException("Failed to create an I/O completion port for the event loop!");
+#endif
+    }
+
+    ~Impl()
+    {
+        // Release all watches
+        for (auto& watch : _watches)
+            Release(watch.second);
+        _watches.clear();
+
+#if defined(linux) || defined(__linux) || defined(__linux__)
+        if (close(_event) != 0)
+            fatality(SystemException("Failed to close a wakeup event of the event loop!"));
+        if (close(_epoll) != 0)
+            fatality(SystemException("Failed to close an epoll instance of the event loop!"));
+#elif defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+        if (close(_kqueue) != 0)
+            fatality(SystemException("Failed to close a kqueue instance of the event loop!"));
+#elif defined(_WIN32) || defined(_WIN64)
+        if (!CloseHandle(_port))
+            fatality(SystemException("Failed to close an I/O completion port of the event loop!"));
+#endif
+    }
+
+    size_t size() const noexcept
+    {
+        return (_watches.size() - _cancelled.size()) + _timers.size();
+    }
+
+    bool IsRunning() const noexcept
+    {
+        return _running.load(std::memory_order_acquire);
+    }
+
+    uint64_t InsertPipe(void* handle, bool read, Handler&& handler)
+    {
+        uint64_t id = ++_id;
+
+        Watch watch;
+        watch.kind = read ? Kind::READ : Kind::WRITE;
+        watch.handler = std::move(handler);
+
+#if defined(linux) || defined(__linux) || defined(__linux__)
+        watch.fd = (int)(size_t)handle;
+        struct epoll_event event = {};
+        event.events = read ? EPOLLIN : EPOLLOUT;
+        event.data.u64 = id;
+        if (epoll_ctl(_epoll, EPOLL_CTL_ADD, watch.fd, &event) != 0)
+            throwex SystemException("Failed to register a pipe in the event loop!");
+#elif defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+        watch.fd = (int)(size_t)handle;
+        struct kevent event;
+        EV_SET(&event, watch.fd, read ? EVFILT_READ : EVFILT_WRITE, EV_ADD, 0, 0, (void*)(uintptr_t)id);
+        if (kevent(_kqueue, &event, 1, nullptr, 0, nullptr) != 0)
+            throwex SystemException("Failed to register a pipe in the event loop!");
+#elif defined(_WIN32) || defined(_WIN64)
+        // Anonymous pipes do not support readiness notifications and are polled
+        watch.handle = (HANDLE)handle;
+        ++_polled;
+#endif
+
+        _watches.emplace(id, std::move(watch));
+        return id;
+    }
+
+    uint64_t InsertProcess(const Process& process, ExitHandler&& handler)
+    {
+        uint64_t id = ++_id;
+        uint64_t pid = process.pid();
+
+        Watch watch;
+        watch.kind = Kind::PROCESS;
+        watch.exit_handler = std::move(handler);
+        watch.pid = pid;
+
+#if defined(linux) || defined(__linux) || defined(__linux__)
+#if defined(SYS_pidfd_open)
+        watch.fd = (int)syscall(SYS_pidfd_open, (pid_t)pid, 0);
+#else
+        errno = ENOSYS;
+#endif
+        if (watch.fd >= 0)
+        {
+            struct epoll_event event = {};
+            event.events = EPOLLIN;
+            event.data.u64 = id;
+            if (epoll_ctl(_epoll, EPOLL_CTL_ADD, watch.fd, &event) != 0)
+            {
+                Release(watch);
+                throwex SystemException(format("Failed to register a process with Id {} in the event loop!", pid));
+            }
+        }
+        else if (errno == ENOSYS)
+        {
+            // Process is polled if process descriptors are not supported
+            watch.polled = true;
+            ++_polled;
+        }
+        else
+            throwex SystemException(format("Failed to watch a process with Id {}!", pid));
+#elif defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+        struct kevent event;
+        EV_SET(&event, (uintptr_t)pid, EVFILT_PROC, EV_ADD | EV_ONESHOT, NOTE_EXIT, 0, (void*)(uintptr_t)id);
+        if (kevent(_kqueue, &event, 1, nullptr, 0, nullptr) != 0)
+        {
+            // Process has already exited
+            if (errno != ESRCH)
+                throwex SystemException(format("Failed to register a process with Id {} in the event loop!", pid));
+            _ready.push_back(id);
+        }
+#elif defined(_WIN32) || defined(_WIN64)
+        bool exited = false;
+        HANDLE hCurrentProcess = GetCurrentProcess();
+        if ((process.handle() == nullptr) || !DuplicateHandle(hCurrentProcess, (HANDLE)process.handle(), hCurrentProcess, &watch.handle, 0, FALSE, DUPLICATE_SAME_ACCESS))
+            throwex SystemException(format("Failed to watch a process with Id {}!", pid));
+        watch.job = CreateJobObjectW(nullptr, nullptr);
+        if (watch.job == nullptr)
+        {
+            Release(watch);
+            throwex SystemException(format("Failed to create a job object for a process with Id {}!", pid));
+        }
+        JOBOBJECT_ASSOCIATE_COMPLETION_PORT association;
+        association.CompletionKey = (PVOID)(ULONG_PTR)id;
+        association.CompletionPort = _port;
+        if (!SetInformationJobObject(watch.job, JobObjectAssociateCompletionPortInformation, &association, sizeof(association)))
+        {
+            Release(watch);
+            throwex SystemException(format("Failed to associate a job object for a process with Id {}!", pid));
+        }
+        if (!AssignProcessToJobObject(watch.job, watch.handle))
+        {
+            // Exited process could not be assigned to the job object
+            exited = (WaitForSingleObject(watch.handle, 0) == WAIT_OBJECT_0);
+            if (!exited)
+            {
+                Release(watch);
+                throwex SystemException(format("Failed to assign a job object for a process with Id {}!", pid));
+            }
+            _ready.push_back(id);
+        }
+#endif
+
+        _watches.emplace(id, std::move(watch));
+        return id;
+    }
+
+    uint64_t InsertTimer(const Timespan& delay, Task&& task)
+    {
+        uint64_t id = ++_id;
+        _wheel.insert(NanoTimestamp() + std::max(delay, Timespan::zero()), id);
+        _timers.emplace(id, std::move(task));
+        return id;
+    }
+
+    void InsertTask(Task&& task)
+    {
+        {
+            std::scoped_lock locker(_lock);
+            _tasks.emplace_back(std::move(task));
+        }
+        Wakeup();
+    }
+
+    bool Cancel(uint64_t id)
+    {
+        auto timer = _timers.find(id);
+        if (timer != _timers.end())
+        {
+            _timers.erase(timer);
+            return true;
+        }
+
+        auto it = _watches.find(id);
+        if ((it == _watches.end()) || !it->second.active)
+            return false;
+
+        Remove(it);
+        return true;
+    }
+
+    size_t Poll(const Timespan& timespan)
+    {
+        int64_t timeout = std::min(std::max((timespan.microseconds() + 999) / 1000, (int64_t)0), (int64_t)std::numeric_limits<int>::max());
+        return Dispatch((int)timeout);
+    }
+
+    void Run()
+    {
+        _running.store(true, std::memory_order_release);
+        while (!_stop.load(std::memory_order_acquire))
+            Dispatch(-1);
+        _stop.store(false, std::memory_order_release);
+        _running.store(false, std::memory_order_release);
+    }
+
+    void Stop()
+    {
+        _stop.store(true, std::memory_order_release);
+        Wakeup();
+    }
+
+private:
+    enum class Kind { READ, WRITE, PROCESS };
+
+    // Watch entry
+    struct Watch
+    {
+        Kind kind;
+        bool active;
+        Handler handler;
+        ExitHandler exit_handler;
+        uint64_t pid;
+        bool exited;
+        int result;
+#if defined(linux) || defined(__linux) || defined(__linux__)
+        int fd;
+        bool polled;
+#elif defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+        int fd;
+#elif defined(_WIN32) || defined(_WIN64)
+        HANDLE handle;
+        HANDLE job;
+#endif
+
+        Watch() : kind(Kind::READ), active(true), pid(0), exited(false), result(std::numeric_limits<int>::min())
+#if defined(linux) || defined(__linux) || defined(__linux__)
+            , fd(-1), polled(false)
+#elif defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+            , fd(-1)
+#elif defined(_WIN32) || defined(_WIN64)
+            , handle(nullptr), job(nullptr)
+#endif
+        {}
+    };
+
+    std::map<uint64_t, Watch> _watches;
+    std::map<uint64_t, Task> _timers;
+    TimerWheel<uint64_t> _wheel;
+    uint64_t _id;
+
+    // Watches which are ready without waiting (e.g. already exited processes)
+    std::vector<uint64_t> _ready;
+    // Watches canceled during the dispatch
+    std::vector<uint64_t> _cancelled;
+    bool _dispatching;
+
+    std::mutex _lock;
+    std::vector<Task> _tasks;
+
+    std::atomic<bool> _running;
+    std::atomic<bool> _stop;
+
+#if defined(linux) || defined(__linux) || defined(__linux__)
+    int _epoll;
+    int _event;
+    size_t _polled;
+#elif defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+    int _kqueue;
+#elif defined(_WIN32) || defined(_WIN64)
+    HANDLE _port;
+    size_t _polled;
+#endif
+
+    void Wakeup()
+    {
+#if defined(linux) || defined(__linux) || defined(__linux__)
+        uint64_t value = 1;
+        [[maybe_unused]] ssize_t result = write(_event, &value, sizeof(value));
+#elif defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+        struct kevent event;
+        EV_SET(&event, 0, EVFILT_USER, 0, NOTE_TRIGGER, 0, nullptr);
+        kevent(_kqueue, &event, 1, nullptr, 0, nullptr);
+#elif defined(_WIN32) || defined(_WIN64)
+        PostQueuedCompletionStatus(_port, 0, 0, nullptr);
+#endif
+    }
+
+    // Deactivate the watch and erase it (deferred during the dispatch)
+    void Remove(std::map<uint64_t, Watch>::iterator it)
+    {
+        Release(it->second);
+        it->second.active = false;
+        if (_dispatching)
+            _cancelled.push_back(it->first);
+        else
+            _watches.erase(it);
+    }
+
+    // Release native handles of the watch
+    void Release(Watch& watch)
+    {
+#if defined(linux) || defined(__linux) || defined(__linux__)
+        if (watch.polled)
+        {
+            --_polled;
+            watch.polled = false;
+        }
+        if (watch.fd >= 0)
+        {
+            // Pipe endpoint could be already closed by its owner
+            epoll_ctl(_epoll, EPOLL_CTL_DEL, watch.fd, nullptr);
+            if (watch.kind == Kind::PROCESS)
+                close(watch.fd);
+            watch.fd = -1;
+        }
+#elif defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+        struct kevent event;
+        if (watch.kind == Kind::PROCESS)
+            EV_SET(&event, (uintptr_t)watch.pid, EVFILT_PROC, EV_DELETE, 0, 0, nullptr);
+        else
+            EV_SET(&event, watch.fd, (watch.kind == Kind::READ) ? EVFILT_READ : EVFILT_WRITE, EV_DELETE, 0, 0, nullptr);
+        kevent(_kqueue, &event, 1, nullptr, 0, nullptr);
+        watch.fd = -1;
+#elif defined(_WIN32) || defined(_WIN64)
+        if (watch.kind == Kind::PROCESS)
+        {
+            if (watch.job != nullptr)
+            {
+                CloseHandle(watch.job);
+                watch.job = nullptr;
+            }
+            if (watch.handle != nullptr)
+            {
+                CloseHandle(watch.handle);
+                watch.handle = nullptr;
+            }
+        }
+        else if (watch.handle != nullptr)
+        {
+            --_polled;
+            watch.handle = nullptr;
+        }
+#endif
+    }
+
+    // Collect the exit result of the process without blocking
+    static bool Collect(Watch& watch)
+    {
+        int& result = watch.result;
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+        int status;
+        pid_t waited;
+        do
+        {
+            waited = waitpid((pid_t)watch.pid, &status, WNOHANG);
+        }
+        while ((waited < 0) && (errno == EINTR));
+
+        if (waited > 0)
+        {
+            if (WIFEXITED(status))
+                result = WEXITSTATUS(status);
+            else if (WIFSIGNALED(status))
+                result = -WTERMSIG(status);
+            watch.exited = true;
+            return true;
+        }
+
+        // Exit result of other processes could not be collected
+        watch.exited = ((waited < 0) && (errno == ECHILD) && (kill((pid_t)watch.pid, 0) != 0) && (errno == ESRCH));
+        return watch.exited;
+#elif defined(_WIN32) || defined(_WIN64)
+        DWORD dwExitCode;
+        if (GetExitCodeProcess(watch.handle, &dwExitCode))
+        {
+            if (dwExitCode == STILL_ACTIVE)
+                return false;
+            result = (int)dwExitCode;
+        }
+        watch.exited = true;
+        return true;
+#else
+        watch.exited = true;
+        return true;
+#endif
+    }
+
+    // Get the wait timeout in milliseconds limited by the nearest timer deadline
+    int Timeout(int timeout)
+    {
+        if (!_ready.empty())
+            return 0;
+
+        {
+            std::scoped_lock locker(_lock);
+            if (!_tasks.empty())
+                return 0;
+        }
+
+        if (!_wheel.empty())
+        {
+            uint64_t next = _wheel.next().total();
+            uint64_t now = Timestamp::nano();
+            if (next <= now)
+                return 0;
+            uint64_t milliseconds = std::min((next - now + 999999) / 1000000, (uint64_t)std::numeric_limits<int>::max());
+            if ((timeout < 0) || (milliseconds < (uint64_t)timeout))
+                timeout = (int)milliseconds;
+        }
+
+#if defined(linux) || defined(__linux) || defined(__linux__) || defined(_WIN32) || defined(_WIN64)
+        // Polled watches are checked every 10 milliseconds
+        if ((_polled > 0) && ((timeout < 0) || (timeout > 10)))
+            timeout = 10;
+#endif
+
+        return timeout;
+    }
+
+    // Wait for ready watches for the given timeout in milliseconds (-1 for infinite)
+    void Wait(int timeout, std::vector<uint64_t>& ready)
+    {
+        ready.swap(_ready);
+
+#if defined(linux) || defined(__linux) || defined(__linux__)
+        // Check polled processes
+        if (_polled > 0)
+        {
+            for (auto& watch : _watches)
+                if (watch.second.active && watch.second.polled && !watch.second.exited && Collect(watch.second))
+                    ready.push_back(watch.first);
+            if (!ready.empty())
+                timeout = 0;
+        }
+
+        struct epoll_event events[64];
+        int count;
+        do
+        {
+            count = epoll_wait(_epoll, events, (int)std::size(events), timeout);
+        }
+        while ((count < 0) && (errno == EINTR));
+
+        if (count < 0)
+            throwex SystemException("Failed to wait for the event loop events!");
+
+        for (int i = 0; i < count; ++i)
+        {
+            if (events[i].data.u64 == 0)
+            {
+                // Reset the wakeup event
+                uint64_t value;
+                [[maybe_unused]] ssize_t result = read(_event, &value, sizeof(value));
+            }
+            else
+                ready.push_back(events[i].data.u64);
+        }
+#elif defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+        struct timespec time;
+        struct timespec* ptime = nullptr;
+        if (!ready.empty())
+            timeout = 0;
+        if (timeout >= 0)
+        {
+            time.tv_sec = timeout / 1000;
+            time.tv_nsec = (timeout % 1000) * 1000000;
+            ptime = &time;
+        }
+
+        struct kevent events[64];
+        int count;
+        do
+        {
+            count = kevent(_kqueue, nullptr, 0, events, (int)std::size(events), ptime);
+        }
+        while ((count < 0) && (errno == EINTR));
+
+        if (count < 0)
+            throwex SystemException("Failed to wait for the event loop events!");
+
+        for (int i = 0; i < count; ++i)
+            if (events[i].filter != EVFILT_USER)
+                ready.push_back((uint64_t)(uintptr_t)events[i].udata);
+#elif defined(_WIN32) || defined(_WIN64)
+        // Check polled pipes
+        if (_polled > 0)
+        {
+            for (auto& watch : _watches)
+            {
+                if (!watch.second.active || (watch.second.kind == Kind::PROCESS))
+                    continue;
+
+                // Anonymous pipe is always ready to write, read endpoint is ready if it has data or it is broken
+                DWORD dwAvailable = 0;
+                if ((watch.second.kind == Kind::WRITE) || !PeekNamedPipe(watch.second.handle, nullptr, 0, nullptr, &dwAvailable, nullptr) || (dwAvailable > 0))
+                    ready.push_back(watch.first);
+            }
+            if (!ready.empty())
+                timeout = 0;
+        }
+
+        DWORD dwTimeout = (timeout < 0) ? INFINITE : (DWORD)timeout;
+        DWORD dwMessage;
+        ULONG_PTR key;
+        LPOVERLAPPED overlapped;
+        while (GetQueuedCompletionStatus(_port, &dwMessage, &key, &overlapped, dwTimeout))
+        {
+            // Exit notifications of watched processes (ignore their children)
+            if ((key != 0) && ((dwMessage == JOB_OBJECT_MSG_EXIT_PROCESS) || (dwMessage == JOB_OBJECT_MSG_ABNORMAL_EXIT_PROCESS)))
+            {
+                auto it = _watches.find((uint64_t)key);
+                if ((it != _watches.end()) && (it->second.pid == (uint64_t)(ULONG_PTR)overlapped))
+                    ready.push_back((uint64_t)key);
+            }
+
+            // Drain all queued notifications
+            dwTimeout = 0;
+        }
+#endif
+    }
+
+    size_t Dispatch(int timeout)
+    {
+        std::vector<uint64_t> ready;
+        Wait(Timeout(timeout), ready);
+
+        size_t count = 0;
+        _dispatching = true;
+
+        // Call handlers of ready watches
+        for (uint64_t id : ready)
+        {
+            auto it = _watches.find(id);
+            if ((it == _watches.end()) || !it->second.active)
+                continue;
+
+            Watch& watch = it->second;
+            if (watch.kind == Kind::PROCESS)
+            {
+                // Process watch is called once
+                if (!watch.exited)
+                    Collect(watch);
+                Remove(it);
+                watch.exit_handler(watch.pid, watch.result);
+            }
+            else
+                watch.handler(id);
+            ++count;
+        }
+
+        // Call handlers of expired timers
+        std::vector<uint64_t> expired;
+        _wheel.expire(NanoTimestamp(), [&expired](const Timestamp&, uint64_t id) { expired.push_back(id); });
+        for (uint64_t id : expired)
+        {
+            auto it = _timers.find(id);
+            if (it == _timers.end())
+                continue;
+
+            Task task = std::move(it->second);
+            _timers.erase(it);
+            task();
+            ++count;
+        }
+
+        // Call posted tasks
+        std::vector<Task> tasks;
+        {
+            std::scoped_lock locker(_lock);
+            tasks.swap(_tasks);
+        }
+        for (auto& task : tasks)
+        {
+            task();
+            ++count;
+        }
+
+        // Erase watches canceled during the dispatch
+        _dispatching = false;
+        for (uint64_t id : _cancelled)
+            _watches.erase(id);
+        _cancelled.clear();
+
+        return count;
+    }
+};
+
+//! @endcond
+
+EventLoop::EventLoop(const Timespan& resolution) : _pimpl(std::make_unique<Impl>(resolution))
+{
+}
+
+EventLoop::~EventLoop()
+{
+}
+
+size_t EventLoop::size() const noexcept { return _pimpl->size(); }
+bool EventLoop::IsRunning() const noexcept { return _pimpl->IsRunning(); }
+
+uint64_t EventLoop::InsertPipe(void* handle, bool read, Handler&& handler) { return _pimpl->InsertPipe(handle, read, std::move(handler)); }
+uint64_t EventLoop::InsertProcess(const Process& process, ExitHandler&& handler) { return _pimpl->InsertProcess(process, std::move(handler)); }
+uint64_t EventLoop::InsertTimer(const Timespan& delay, Task&& task) { return _pimpl->InsertTimer(delay, std::move(task)); }
+void EventLoop::InsertTask(Task&& task) { _pimpl->InsertTask(std::move(task)); }
+
+bool EventLoop::Cancel(uint64_t id) { return _pimpl->Cancel(id); }
+
+size_t EventLoop::Poll(const Timespan& timespan) { return _pimpl->Poll(timespan); }
+void EventLoop::Run() { _pimpl->Run(); }
+void EventLoop::Stop() { _pimpl->Stop(); }
+
+} // namespace CppCommon
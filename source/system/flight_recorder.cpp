@@ -0,0 +1,220 @@
+/*!
+    \file flight_recorder.cpp
+    \brief Flight recorder implementation
+    \author Ivan Shynkarenka
+    \date 15.10.2026
+    \copyright MIT License
+*/
+
+#include "system/flight_recorder.h"
+
+#include "system/process.h"
+#include "threads/thread.h"
+#include "time/timestamp.h"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cassert>
+#include <cstring>
+#include <new>
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+namespace Internals {
+
+static const char FLIGHT_RECORDER_MAGIC[8] = { 'C', 'C', 'F', 'L', 'I', 'G', 'H', 'T' };
+static const uint32_t FLIGHT_RECORDER_VERSION = 1;
+
+// Flight recorder segment header
+struct alignas(64) FlightHeader
+{
+    char magic[8];
+    uint32_t version;
+    uint32_t threads;
+    uint64_t capacity;
+    uint64_t pid;
+    uint64_t start_utc;
+    uint64_t start_nano;
+    std::atomic<uint64_t> dropped;
+};
+
+// Flight recorder thread ring header followed by ring events
+struct alignas(64) FlightRing
+{
+    std::atomic<uint64_t> head;
+    uint64_t tid;
+    char name[16];
+};
+
+static_assert(sizeof(FlightEvent) == 32, "Flight recorder event must be 32 bytes!");
+static_assert(std::atomic<uint64_t>::is_always_lock_free, "Flight recorder requires lock-free 64-bit atomics in shared memory!");
+
+size_t FlightCapacity(size_t capacity) noexcept
+{
+    return std::bit_ceil(std::max(capacity, (size_t)1));
+}
+
+size_t FlightRingSize(size_t capacity) noexcept
+{
+    return sizeof(FlightRing) + capacity * sizeof(FlightEvent);
+}
+
+FlightRing* GetFlightRing(void* segment, size_t capacity, size_t index) noexcept
+{
+    return (FlightRing*)((uint8_t*)segment + sizeof(FlightHeader) + index * FlightRingSize(capacity));
+}
+
+FlightEvent* GetFlightEvents(FlightRing* ring) noexcept
+{
+    return (FlightEvent*)((uint8_t*)ring + sizeof(FlightRing));
+}
+
+} // namespace Internals
+//! @endcond
+
+FlightRecorder::FlightRecorder(const std::string& name, size_t threads, size_t capacity)
+    : _threads(threads),
+      _capacity(Internals::FlightCapacity(capacity)),
+      _shared(name, Size(threads, capacity))
+{
+    assert((threads > 0) && "Flight recorder must have at least one thread ring!");
+
+    // Reset events of the previous process
+    void* segment = _shared.ptr();
+    std::memset(segment, 0, _shared.size());
+
+    Internals::FlightHeader* header = new (segment) Internals::FlightHeader();
+    header->version = Internals::FLIGHT_RECORDER_VERSION;
+    header->threads = (uint32_t)_threads;
+    header->capacity = _capacity;
+    header->pid = Process::CurrentProcessId();
+    header->start_utc = Timestamp::utc();
+    header->start_nano = Timestamp::nano();
+    header->dropped.store(0, std::memory_order_relaxed);
+    for (size_t i = 0; i < _threads; ++i)
+        new (Internals::GetFlightRing(segment, _capacity, i)) Internals::FlightRing();
+
+    // Mark the segment as valid at the last step
+    std::atomic_thread_fence(std::memory_order_release);
+    std::memcpy(header->magic, Internals::FLIGHT_RECORDER_MAGIC, sizeof(header->magic));
+}
+
+uint64_t FlightRecorder::dropped() const noexcept
+{
+    const Internals::FlightHeader* header = (const Internals::FlightHeader*)_shared.ptr();
+    return header->dropped.load(std::memory_order_relaxed);
+}
+
+void FlightRecorder::Record(uint32_t id, uint64_t data0, uint64_t data1) noexcept
+{
+    void* segment = _shared.ptr();
+
+    const ThreadInfo& info = Thread::CurrentThreadInfo();
+    if (info.index >= _threads)
+    {
+        ((Internals::FlightHeader*)segment)->dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    Internals::FlightRing* ring = Internals::GetFlightRing(segment, _capacity, info.index);
+
+    // Ring of the exited thread is taken by the new thread
+    if (ring->tid != info.tid)
+    {
+        ring->tid = info.tid;
+        std::memcpy(ring->name, info.name, sizeof(ring->name));
+    }
+
+    // Ring has the only writer, so the event is written with plain stores
+    uint64_t head = ring->head.load(std::memory_order_relaxed);
+    FlightEvent& event = Internals::GetFlightEvents(ring)[head & (_capacity - 1)];
+    event.timestamp = Timestamp::nano();
+    event.id = id;
+    event.tid = (uint32_t)info.tid;
+    event.data[0] = data0;
+    event.data[1] = data1;
+    ring->head.store(head + 1, std::memory_order_release);
+}
+
+size_t FlightRecorder::Size(size_t threads, size_t capacity) noexcept
+{
+    return sizeof(Internals::FlightHeader) + threads * Internals::FlightRingSize(Internals::FlightCapacity(capacity));
+}
+
+FlightRecorderReader::FlightRecorderReader(const std::string& name, size_t threads, size_t capacity)
+    : _threads(threads),
+      _capacity(Internals::FlightCapacity(capacity)),
+      _shared(name, FlightRecorder::Size(threads, capacity))
+{
+    const Internals::FlightHeader* header = (const Internals::FlightHeader*)_shared.ptr();
+    if (std::memcmp(header->magic, Internals::FLIGHT_RECORDER_MAGIC, sizeof(header->magic)) != 0)
+        throwex SystemException("Flight recorder shared memory segment is not found!");
+    if ((header->version != Internals::FLIGHT_RECORDER_VERSION) || (header->threads != _threads) || (header->capacity != _capacity))
+        throwex SystemException("Flight recorder shared memory segment has invalid format!");
+    std::atomic_thread_fence(std::memory_order_acquire);
+}
+
+uint64_t FlightRecorderReader::pid() const noexcept
+{
+    const Internals::FlightHeader* header = (const Internals::FlightHeader*)_shared.ptr();
+    return header->pid;
+}
+
+uint64_t FlightRecorderReader::dropped() const noexcept
+{
+    const Internals::FlightHeader* header = (const Internals::FlightHeader*)_shared.ptr();
+    return header->dropped.load(std::memory_order_relaxed);
+}
+
+std::vector<FlightThread> FlightRecorderReader::ReadThreads() const
+{
+    void* segment = const_cast<void*>(_shared.ptr());
+
+    std::vector<FlightThread> threads;
+    for (size_t i = 0; i < _threads; ++i)
+    {
+        Internals::FlightRing* ring = Internals::GetFlightRing(segment, _capacity, i);
+        uint64_t head = ring->head.load(std::memory_order_acquire);
+        if (head == 0)
+            continue;
+
+        FlightThread thread;
+        thread.index = (uint32_t)i;
+        thread.tid = ring->tid;
+        thread.name.assign(ring->name, strnlen(ring->name, sizeof(ring->name)));
+        thread.recorded = head;
+        threads.emplace_back(std::move(thread));
+    }
+    return threads;
+}
+
+std::vector<FlightEvent> FlightRecorderReader::ReadEvents() const
+{
+    void* segment = const_cast<void*>(_shared.ptr());
+    const Internals::FlightHeader* header = (const Internals::FlightHeader*)segment;
+
+    std::vector<FlightEvent> events;
+    for (size_t i = 0; i < _threads; ++i)
+    {
+        Internals::FlightRing* ring = Internals::GetFlightRing(segment, _capacity, i);
+        const FlightEvent* ring_events = Internals::GetFlightEvents(ring);
+
+        // Read the last events of the ring from the oldest one
+        uint64_t head = ring->head.load(std::memory_order_acquire);
+        uint64_t tail = (head > _capacity) ? (head - _capacity) : 0;
+        for (uint64_t j = tail; j < head; ++j)
+            events.emplace_back(ring_events[j & (_capacity - 1)]);
+    }
+
+    std::stable_sort(events.begin(), events.end(), [](const FlightEvent& e1, const FlightEvent& e2) { return e1.timestamp < e2.timestamp; });
+
+    // Convert high resolution timestamps into UTC timestamps
+    for (auto& event : events)
+        event.timestamp = header->start_utc + (event.timestamp - header->start_nano);
+
+    return events;
+}
+
+} // namespace CppCommon
@@ -0,0 +1,172 @@
+/*!
+    \file perf_counters.cpp
+    \brief Hardware performance counters implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "system/perf_counters.h"
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <cstring>
+#include <unistd.h>
+#endif
+
+namespace CppCommon {
+
+#if defined(__linux__)
+
+class PerfCounters::Impl
+{
+public:
+    Impl()
+    {
+        static const uint64_t configs[PerfSample::EVENTS] =
+        {
+            PERF_COUNT_HW_CPU_CYCLES,
+            PERF_COUNT_HW_INSTRUCTIONS,
+            PERF_COUNT_HW_CACHE_REFERENCES,
+            PERF_COUNT_HW_CACHE_MISSES,
+            PERF_COUNT_HW_BRANCH_INSTRUCTIONS,
+            PERF_COUNT_HW_BRANCH_MISSES
+        };
+
+        int leader = -1;
+        for (size_t i = 0; i < PerfSample::EVENTS; ++i)
+        {
+            // Try to join the counters group and open the standalone counter otherwise
+            _fds[i] = Open(configs[i], leader);
+            if ((_fds[i] < 0) && (leader >= 0))
+                _fds[i] = Open(configs[i], -1);
+            if ((_fds[i] >= 0) && (leader < 0))
+                leader = _fds[i];
+        }
+    }
+
+    ~Impl()
+    {
+        // Close group members before the group leader
+        for (size_t i = PerfSample::EVENTS; i-- > 0;)
+            if (_fds[i] >= 0)
+                close(_fds[i]);
+    }
+
+    bool IsAvailable() const noexcept
+    {
+        for (int fd : _fds)
+            if (fd >= 0)
+                return true;
+        return false;
+    }
+
+    bool IsAvailable(PerfEvent event) const noexcept
+    {
+        return (_fds[(size_t)event] >= 0);
+    }
+
+    PerfSample Read() const noexcept
+    {
+        PerfSample sample;
+        for (size_t i = 0; i < PerfSample::EVENTS; ++i)
+        {
+            if (_fds[i] < 0)
+                continue;
+
+            // Counter value, enabled time and running time
+            uint64_t data[3];
+            if (read(_fds[i], data, sizeof(data)) != (ssize_t)sizeof(data))
+                continue;
+
+            // Scale the value of the multiplexed counter
+            if (data[2] == 0)
+                sample.values[i] = 0;
+            else if (data[2] < data[1])
+                sample.values[i] = (uint64_t)((double)data[0] * ((double)data[1] / (double)data[2]));
+            else
+                sample.values[i] = data[0];
+        }
+        return sample;
+    }
+
+    void Reset() noexcept
+    {
+        for (int fd : _fds)
+            if (fd >= 0)
+                ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+    }
+
+private:
+    int _fds[PerfSample::EVENTS];
+
+    static int Open(uint64_t config, int group) noexcept
+    {
+        struct perf_event_attr attr;
+        std::memset(&attr, 0, sizeof(attr));
+        attr.size = sizeof(attr);
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.config = config;
+        attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+
+        // Count the calling thread on any CPU
+        return (int)syscall(SYS_perf_event_open, &attr, 0, -1, group, PERF_FLAG_FD_CLOEXEC);
+    }
+};
+
+#else
+
+class PerfCounters::Impl
+{
+public:
+    bool IsAvailable() const noexcept { return false; }
+    bool IsAvailable(PerfEvent event) const noexcept { return false; }
+    PerfSample Read() const noexcept { return PerfSample(); }
+    void Reset() noexcept {}
+};
+
+#endif
+
+PerfCounters::PerfCounters() : _pimpl(std::make_unique<Impl>())
+{
+}
+
+PerfCounters::PerfCounters(PerfCounters&& counters) noexcept : _pimpl(std::move(counters._pimpl))
+{
+}
+
+PerfCounters::~PerfCounters()
+{
+}
+
+PerfCounters& PerfCounters::operator=(PerfCounters&& counters) noexcept
+{
+    _pimpl = std::move(counters._pimpl);
+    return *this;
+}
+
+bool PerfCounters::IsAvailable() const noexcept
+{
+    return _pimpl->IsAvailable();
+}
+
+bool PerfCounters::IsAvailable(PerfEvent event) const noexcept
+{
+    return _pimpl->IsAvailable(event);
+}
+
+PerfSample PerfCounters::Read() const noexcept
+{
+    return _pimpl->Read();
+}
+
+void PerfCounters::Reset() noexcept
+{
+    _pimpl->Reset();
+}
+
+} // namespace CppCommon
@@ -9,11 +9,17 @@
 #include "system/pipe.h"
 
 #include "errors/fatal.h"
+#include "filesystem/file.h"
+#include "time/timestamp.h"
 #include "utility/validate_aligned_storage.h"
 
+#include <algorithm>
 #include <cassert>
 
 #if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/uio.h>
 #include <unistd.h>
 #elif defined(_WIN32) || defined(_WIN64)
 #include <windows.h>
@@ -26,14 +32,22 @@ namespace CppCommon {
 class Pipe::Impl
 {
 public:
-    Impl()
+    explicit Impl(size_t capacity)
     {
 #if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
         int result = pipe(_pipe);
         if (result != 0)
             throwex SystemException("Failed to create a new pipe!");
+#if defined(__linux__)
+        if ((capacity > 0) && (fcntl(_pipe[1], F_SETPIPE_SZ, (int)capacity) < 0))
+        {
+            close(_pipe[0]);
+            close(_pipe[1]);
+            throwex SystemException("Failed to set the pipe buffer capacity!");
+        }
+#endif
 #elif defined(_WIN32) || defined(_WIN64)
-        if (!CreatePipe(&_pipe[0], &_pipe[1], nullptr, 0))
+        if (!CreatePipe(&_pipe[0], &_pipe[1], nullptr, (DWORD)capacity))
             throwex SystemException("Failed to create a new pipe!");
 #endif
     }
@@ -61,6 +75,27 @@ public:
         return (void*)(size_t)_pipe[1];
     }
 
+    size_t capacity() const
+    {
+        assert(IsPipeOpened() && "Pipe is not opened!");
+        if (!IsPipeOpened())
+            throwex SystemException("Pipe is not opened!");
+#if defined(__linux__)
+        int result = fcntl(IsPipeWriteOpened() ? _pipe[1] : _pipe[0], F_GETPIPE_SZ);
+        if (result < 0)
+            throwex SystemException("Cannot get the pipe buffer capacity!");
+        return (size_t)result;
+#elif defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+        return 0;
+#elif defined(_WIN32) || defined(_WIN64)
+        DWORD output = 0;
+        DWORD input = 0;
+        if (!GetNamedPipeInfo(IsPipeWriteOpened() ? _pipe[1] : _pipe[0], nullptr, &output, &input, nullptr))
+            throwex SystemException("Cannot get the pipe buffer capacity!");
+        return (size_t)std::max(output, input);
+#endif
+    }
+
     bool IsPipeOpened() const noexcept
     {
         return IsPipeReadOpened() || IsPipeWriteOpened();
@@ -84,6 +119,64 @@ public:
 #endif
     }
 
+    bool IsBlocking() const
+    {
+        assert(IsPipeOpened() && "Pipe is not opened!");
+        if (!IsPipeOpened())
+            throwex SystemException("Pipe is not opened!");
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+        int flags = fcntl(IsPipeReadOpened() ? _pipe[0] : _pipe[1], F_GETFL);
+        if (flags < 0)
+            throwex SystemException("Cannot get the pipe mode!");
+        return ((flags & O_NONBLOCK) == 0);
+#elif defined(_WIN32) || defined(_WIN64)
+        DWORD mode = 0;
+        if (!GetNamedPipeHandleState(IsPipeReadOpened() ? _pipe[0] : _pipe[1], &mode, nullptr, nullptr, nullptr, nullptr, 0))
+            throwex SystemException("Cannot get the pipe mode!");
+        return ((mode & PIPE_NOWAIT) == 0);
+#endif
+    }
+
+    void SetCapacity(size_t capacity)
+    {
+        assert(IsPipeOpened() && "Pipe is not opened!");
+        if (!IsPipeOpened())
+            throwex SystemException("Pipe is not opened!");
+#if defined(__linux__)
+        if (fcntl(IsPipeWriteOpened() ? _pipe[1] : _pipe[0], F_SETPIPE_SZ, (int)capacity) < 0)
+            throwex SystemException("Cannot set the pipe buffer capacity!");
+#else
+        // Other platforms cannot change the capacity of the created pipe
+        (void)capacity;
+#endif
+    }
+
+    void SetBlocking(bool blocking)
+    {
+        assert(IsPipeOpened() && "Pipe is not opened!");
+        if (!IsPipeOpened())
+            throwex SystemException("Pipe is not opened!");
+        for (auto endpoint : _pipe)
+        {
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+            if (endpoint < 0)
+                continue;
+            int flags = fcntl(endpoint, F_GETFL);
+            if (flags < 0)
+                throwex SystemException("Cannot get the pipe mode!");
+            flags = blocking ? (flags & ~O_NONBLOCK) : (flags | O_NONBLOCK);
+            if (fcntl(endpoint, F_SETFL, flags) != 0)
+                throwex SystemException("Cannot set the pipe mode!");
+#elif defined(_WIN32) || defined(_WIN64)
+            if (endpoint == INVALID_HANDLE_VALUE)
+                continue;
+            DWORD mode = blocking ? PIPE_WAIT : PIPE_NOWAIT;
+            if (!SetNamedPipeHandleState(endpoint, &mode, nullptr, nullptr))
+                throwex SystemException("Cannot set the pipe mode!");
+#endif
+        }
+    }
+
     size_t Read(void* buffer, size_t size)
     {
         if ((buffer == nullptr) || (size == 0))
@@ -92,16 +185,40 @@ public:
         assert(IsPipeReadOpened() && "Pipe is not opened for reading!");
         if (!IsPipeReadOpened())
             throwex SystemException("Cannot read from the closed pipe!");
+
+        std::error_code ec;
+        size_t result = TryRead(buffer, size, ec);
+        if (ec)
+            throwex SystemException("Cannot read from the pipe!", ec.value());
+        return result;
+    }
+
+    size_t TryRead(void* buffer, size_t size, std::error_code& ec)
+    {
+        ec.clear();
+
+        if ((buffer == nullptr) || (size == 0))
+            return 0;
+
+        if (!IsPipeReadOpened())
+        {
+            ec = std::make_error_code(std::errc::bad_file_descriptor);
+            return 0;
+        }
 #if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
         ssize_t result = read(_pipe[0], buffer, size);
         if (result < 0)
-            throwex SystemException("Cannot read from the pipe!");
+        {
+            if ((errno != EAGAIN) && (errno != EWOULDBLOCK))
+                ec.assign(errno, std::system_category());
+            return 0;
+        }
         return (size_t)result;
 #elif defined(_WIN32) || defined(_WIN64)
         DWORD result = 0;
         if (!ReadFile(_pipe[0], buffer, (DWORD)size, &result, nullptr))
-            if (GetLastError() != ERROR_BROKEN_PIPE)
-                throwex SystemException("Cannot read from the pipe!");
+            if ((GetLastError() != ERROR_BROKEN_PIPE) && (GetLastError() != ERROR_NO_DATA))
+                ec.assign(GetLastError(), std::system_category());
         return (size_t)result;
 #endif
     }
@@ -114,20 +231,228 @@ public:
         assert(IsPipeWriteOpened() && "Pipe is not opened for writing!");
         if (!IsPipeWriteOpened())
             throwex SystemException("Cannot write into the closed pipe!");
+
+        std::error_code ec;
+        size_t result = TryWrite(buffer, size, ec);
+        if (ec)
+            throwex SystemException("Cannot write into the pipe!", ec.value());
+        return result;
+    }
+
+    size_t TryWrite(const void* buffer, size_t size, std::error_code& ec)
+    {
+        ec.clear();
+
+        if ((buffer == nullptr) || (size == 0))
+            return 0;
+
+        if (!IsPipeWriteOpened())
+        {
+            ec = std::make_error_code(std::errc::bad_file_descriptor);
+            return 0;
+        }
 #if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
         ssize_t result = write(_pipe[1], buffer, size);
         if (result < 0)
-            throwex SystemException("Cannot write into the pipe!");
+        {
+            if ((errno != EAGAIN) && (errno != EWOULDBLOCK))
+                ec.assign(errno, std::system_category());
+            return 0;
+        }
         return (size_t)result;
 #elif defined(_WIN32) || defined(_WIN64)
         DWORD result = 0;
         if (!WriteFile(_pipe[1], buffer, (DWORD)size, &result, nullptr))
             if (GetLastError() != ERROR_BROKEN_PIPE)
-                throwex SystemException("Cannot write into the pipe!");
+                ec.assign(GetLastError(), std::system_category());
         return (size_t)result;
 #endif
     }
 
+    size_t WriteV(std::span<const Writer::WriteBuffer> buffers)
+    {
+        assert(IsPipeWriteOpened() && "Pipe is not opened for writing!");
+        if (!IsPipeWriteOpened())
+            throwex SystemException("Cannot write into the closed pipe!");
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+        size_t result = 0;
+        struct iovec vectors[64];
+        while (!buffers.empty())
+        {
+            size_t chunk = std::min(buffers.size(), sizeof(vectors) / sizeof(vectors[0]));
+            size_t total = 0;
+            for (size_t i = 0; i < chunk; ++i)
+            {
+                vectors[i].iov_base = (void*)buffers[i].data;
+                vectors[i].iov_len = buffers[i].size;
+                total += buffers[i].size;
+            }
+
+            ssize_t written = writev(_pipe[1], vectors, (int)chunk);
+            if (written < 0)
+            {
+                if ((errno == EAGAIN) || (errno == EWOULDBLOCK))
+                    return result;
+                throwex SystemException("Cannot write into the pipe!");
+            }
+            result += (size_t)written;
+
+            // Stop if the pipe is full
+            if ((size_t)written < total)
+                break;
+
+            buffers = buffers.subspan(chunk);
+        }
+        return result;
+#elif defined(_WIN32) || defined(_WIN64)
+        size_t result = 0;
+        for (const auto& buffer : buffers)
+        {
+            size_t size = Write(buffer.data, buffer.size);
+            result += size;
+            if (size < buffer.size)
+                break;
+        }
+        return result;
+#endif
+    }
+
+    bool WaitRead(const Timespan& timeout)
+    {
+        assert(IsPipeReadOpened() && "Pipe is not opened for reading!");
+        if (!IsPipeReadOpened())
+            throwex SystemException("Cannot wait for the closed pipe!");
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+        return Poll(_pipe[0], POLLIN, (int)std::max<int64_t>(0, timeout.milliseconds()));
+#elif defined(_WIN32) || defined(_WIN64)
+        // Anonymous pipes cannot be waited, so the pipe is peeked until the timeout is expired
+        Timestamp deadline = UtcTimestamp() + timeout;
+        for (;;)
+        {
+            DWORD available = 0;
+            if (!PeekNamedPipe(_pipe[0], nullptr, 0, nullptr, &available, nullptr))
+            {
+                if (GetLastError() == ERROR_BROKEN_PIPE)
+                    return true;
+                throwex SystemException("Cannot wait for the pipe!");
+            }
+            if (available > 0)
+                return true;
+            if (UtcTimestamp() >= deadline)
+                return false;
+            Sleep(1);
+        }
+#endif
+    }
+
+    bool WaitWrite(const Timespan& timeout)
+    {
+        assert(IsPipeWriteOpened() && "Pipe is not opened for writing!");
+        if (!IsPipeWriteOpened())
+            throwex SystemException("Cannot wait for the closed pipe!");
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+        return Poll(_pipe[1], POLLOUT, (int)std::max<int64_t>(0, timeout.milliseconds()));
+#elif defined(_WIN32) || defined(_WIN64)
+        return true;
+#endif
+    }
+
+    size_t TransferTo(File& file, uint64_t offset, size_t size)
+    {
+        if (size == 0)
+            return 0;
+
+        assert(IsPipeReadOpened() && "Pipe is not opened for reading!");
+        if (!IsPipeReadOpened())
+            throwex SystemException("Cannot read from the closed pipe!");
+        assert(file.IsFileWriteOpened() && "File is not opened for writing!");
+        if (!file.IsFileWriteOpened())
+            throwex SystemException("Cannot transfer the pipe into the file which is not opened for writing!");
+#if defined(__linux__)
+        // Move pipe buffer pages into the file page cache
+        loff_t position = (loff_t)offset;
+        ssize_t result = splice(_pipe[0], nullptr, (int)(size_t)file.handle(), &position, size, SPLICE_F_MOVE);
+        if (result >= 0)
+            return (size_t)result;
+        if ((errno == EAGAIN) || (errno == EWOULDBLOCK))
+            return 0;
+        if (errno != EINVAL)
+            throwex SystemException("Cannot transfer the pipe into the file!");
+        // Filesystem does not support splice(), so fallback to the buffer copy
+#endif
+        uint8_t buffer[TRANSFER_BUFFER];
+        size_t count = Read(buffer, std::min(size, sizeof(buffer)));
+        if ((count > 0) && (file.WriteAt(offset, buffer, count) != count))
+            throwex SystemException("Cannot transfer the pipe into the file!");
+        return count;
+    }
+
+    size_t TransferFrom(const File& file, uint64_t offset, size_t size)
+    {
+        if (size == 0)
+            return 0;
+
+        assert(IsPipeWriteOpened() && "Pipe is not opened for writing!");
+        if (!IsPipeWriteOpened())
+            throwex SystemException("Cannot write into the closed pipe!");
+        assert(file.IsFileReadOpened() && "File is not opened for reading!");
+        if (!file.IsFileReadOpened())
+            throwex SystemException("Cannot transfer the file which is not opened for reading into the pipe!");
+#if defined(__linux__)
+        // Reference file page cache pages from the pipe buffer
+        loff_t position = (loff_t)offset;
+        ssize_t result = splice((int)(size_t)file.handle(), &position, _pipe[1], nullptr, size, SPLICE_F_MOVE);
+        if (result >= 0)
+            return (size_t)result;
+        if ((errno == EAGAIN) || (errno == EWOULDBLOCK))
+            return 0;
+        if (errno != EINVAL)
+            throwex SystemException("Cannot transfer the file into the pipe!");
+        // Filesystem does not support splice(), so fallback to the buffer copy
+#endif
+        uint8_t buffer[TRANSFER_BUFFER];
+        size_t count = file.ReadAt(offset, buffer, std::min(size, sizeof(buffer)));
+        for (size_t written = 0; written < count;)
+        {
+            size_t chunk = Write(buffer + written, count - written);
+            written += chunk;
+
+            // Wait for the free space of the full non-blocking pipe
+            if (chunk == 0)
+            {
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+                Poll(_pipe[1], POLLOUT, -1);
+#elif defined(_WIN32) || defined(_WIN64)
+                Sleep(1);
+#endif
+            }
+        }
+        return count;
+    }
+
+    size_t Tee(Impl& pipe, size_t size)
+    {
+        if (size == 0)
+            return 0;
+
+        assert(IsPipeReadOpened() && "Pipe is not opened for reading!");
+        if (!IsPipeReadOpened())
+            throwex SystemException("Cannot read from the closed pipe!");
+        assert(pipe.IsPipeWriteOpened() && "Target pipe is not opened for writing!");
+        if (!pipe.IsPipeWriteOpened())
+            throwex SystemException("Cannot write into the closed pipe!");
+#if defined(__linux__)
+        ssize_t result = tee(_pipe[0], pipe._pipe[1], size, 0);
+        if (result >= 0)
+            return (size_t)result;
+        if ((errno == EAGAIN) || (errno == EWOULDBLOCK))
+            return 0;
+        throwex SystemException("Cannot duplicate the pipe!");
+#else
+        throwex SystemException("Pipe tee is not supported!");
+#endif
+    }
+
     void CloseRead()
     {
         assert(IsPipeReadOpened() && "Pipe is not opened for reading!");
@@ -171,16 +496,34 @@ public:
     }
 
 private:
+    static const size_t TRANSFER_BUFFER = 16384;
+
 #if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
     int _pipe[2];
 #elif defined(_WIN32) || defined(_WIN64)
     HANDLE _pipe[2];
 #endif
+
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+    // Poll the pipe endpoint with the given timeout in milliseconds (-1 is infinite)
+    static bool Poll(int endpoint, short events, int timeout)
+    {
+        struct pollfd request = { endpoint, events, 0 };
+        int result;
+        do
+        {
+            result = poll(&request, 1, timeout);
+        } while ((result < 0) && (errno == EINTR));
+        if (result < 0)
+            throwex SystemException("Cannot wait for the pipe!");
+        return (result > 0);
+    }
+#endif
 };
 
 //! @endcond
 
-Pipe::Pipe()
+Pipe::Pipe(size_t capacity)
 {
     // Check implementation storage parameters
     [[maybe_unused]] ValidateAlignedStorage<sizeof(Impl), alignof(Impl), StorageSize, StorageAlign> _;
@@ -188,7 +531,7 @@ Pipe::Pipe()
     static_assert(((StorageAlign % alignof(Impl)) == 0), "Pipe::StorageAlign must be adjusted!");
 
     // Create the implementation instance
-    new(&_storage)Impl();
+    new(&_storage)Impl(capacity);
 }
 
 Pipe::~Pipe()
@@ -200,12 +543,28 @@ Pipe::~Pipe()
 void* Pipe::reader() const noexcept { return impl().reader(); }
 void* Pipe::writer() const noexcept { return impl().writer(); }
 
+size_t Pipe::capacity() const { return impl().capacity(); }
+
 bool Pipe::IsPipeOpened() const noexcept { return impl().IsPipeOpened(); }
 bool Pipe::IsPipeReadOpened() const noexcept { return impl().IsPipeReadOpened(); }
 bool Pipe::IsPipeWriteOpened() const noexcept { return impl().IsPipeWriteOpened(); }
+bool Pipe::IsBlocking() const { return impl().IsBlocking(); }
+
+void Pipe::SetCapacity(size_t capacity) { impl().SetCapacity(capacity); }
+void Pipe::SetBlocking(bool blocking) { impl().SetBlocking(blocking); }
 
 size_t Pipe::Read(void* buffer, size_t size) { return impl().Read(buffer, size); }
 size_t Pipe::Write(const void* buffer, size_t size) { return impl().Write(buffer, size); }
+size_t Pipe::TryRead(void* buffer, size_t size, std::error_code& ec) { return impl().TryRead(buffer, size, ec); }
+size_t Pipe::TryWrite(const void* buffer, size_t size, std::error_code& ec) { return impl().TryWrite(buffer, size, ec); }
+size_t Pipe::WriteV(std::span<const WriteBuffer> buffers) { return impl().WriteV(buffers); }
+
+bool Pipe::WaitRead(const Timespan& timeout) { return impl().WaitRead(timeout); }
+bool Pipe::WaitWrite(const Timespan& timeout) { return impl().WaitWrite(timeout); }
+
+size_t Pipe::TransferTo(File& file, uint64_t offset, size_t size) { return impl().TransferTo(file, offset, size); }
+size_t Pipe::TransferFrom(const File& file, uint64_t offset, size_t size) { return impl().TransferFrom(file, offset, size); }
+size_t Pipe::Tee(Pipe& pipe, size_t size) { return impl().Tee(pipe.impl(), size); }
 
 void Pipe::CloseRead() { return impl().CloseRead(); }
 void Pipe::CloseWrite() { return impl().CloseWrite(); }
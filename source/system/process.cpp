@@ -18,14 +18,30 @@
 #if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
 #include <sys/wait.h>
 #include <signal.h>
+#include <spawn.h>
 #include <stdlib.h>
 #include <unistd.h>
+#include <cstring>
+extern char **environ;
 #elif defined(_WIN32) || defined(_WIN64)
 #include <windows.h>
 #include <tlhelp32.h>
 #undef max
 #undef min
 #endif
+#if defined(__APPLE__) || (defined(__GLIBC__) && ((__GLIBC__ > 2) || ((__GLIBC__ == 2) && (__GLIBC_MINOR__ >= 34))))
+#define CPPCOMMON_PROCESS_SPAWN_CLOSEFROM
+#endif
+#if (defined(__APPLE__) && (__ENVIRONMENT_MAC_OS_X_VERSION_MIN_REQUIRED__ >= 101500)) || (defined(__GLIBC__) && ((__GLIBC__ > 2) || ((__GLIBC__ == 2) && (__GLIBC_MINOR__ >= 29))))
+#define CPPCOMMON_PROCESS_SPAWN_CHDIR
+#endif
+#if defined(linux) || defined(__linux) || defined(__linux__)
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <sched.h>
+#endif
 
 namespace CppCommon {
 
@@ -38,6 +54,7 @@ public:
     {
 #if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
         _pid = (pid_t)-1;
+        _pidfd = -1;
 #elif defined(_WIN32) || defined(_WIN64)
         _pid = (DWORD)-1;
         _process = nullptr;
@@ -48,6 +65,7 @@ public:
     {
 #if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
         _pid = (pid_t)pid;
+        _pidfd = OpenPidfd(_pid);
 #elif defined(_WIN32) || defined(_WIN64)
         _pid = (DWORD)pid;
         _process = OpenProcess(PROCESS_QUERY_INFORMATION | PROCESS_TERMINATE | SYNCHRONIZE, FALSE, _pid);
@@ -58,7 +76,14 @@ public:
 
     ~Impl()
     {
-#if defined(_WIN32) || defined(_WIN64)
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+        if (_pidfd >= 0)
+        {
+            if (close(_pidfd) != 0)
+                fatality(SystemException(format("Failed to close a process descriptor with Id {}!", pid())));
+            _pidfd = -1;
+        }
+#elif defined(_WIN32) || defined(_WIN64)
         if (_process != nullptr)
         {
             if (!CloseHandle(_process))
@@ -73,6 +98,15 @@ public:
         return (uint64_t)_pid;
     }
 
+    void* handle() const noexcept
+    {
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+        return (_pidfd >= 0) ? (void*)(size_t)_pidfd : nullptr;
+#elif defined(_WIN32) || defined(_WIN64)
+        return _process;
+#endif
+    }
+
     bool IsRunning() const
     {
 #if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
@@ -119,16 +153,7 @@ public:
         if (result == -1)
             throwex SystemException(format("Failed to wait for a process with Id {}!", pid()));
 
-        if (WIFEXITED(status))
-            return WEXITSTATUS(status);
-        else if (WIFSIGNALED(status))
-            throwex SystemException(format("Process with Id {} was killed by signal {}!", pid(), WTERMSIG(status)));
-        else if (WIFSTOPPED(status))
-            throwex SystemException(format("Process with Id {} was stopped by signal {}!", pid(), WSTOPSIG(status)));
-        else if (WIFCONTINUED(status))
-            throwex SystemException(format("Process with Id {} was continued by signal SIGCONT!", pid()));
-        else
-            throwex SystemException(format("Process with Id {} has unknown wait status!", pid()));
+        return ExitResult(status);
 #elif defined(_WIN32) || defined(_WIN64)
         if (_process == nullptr)
             throwex SystemException(format("Failed to wait for a process with Id {}!", pid()));
@@ -151,27 +176,43 @@ public:
         int status;
         pid_t result;
 
+#if defined(linux) || defined(__linux) || defined(__linux__)
+        // Process descriptor becomes readable when the process exits
+        if (_pidfd >= 0)
+        {
+            struct pollfd descriptor = { _pidfd, POLLIN, 0 };
+            int timeout = (int)std::min(std::max((timespan.microseconds() + 999) / 1000, (int64_t)0), (int64_t)std::numeric_limits<int>::max());
+            do
+            {
+                result = poll(&descriptor, 1, timeout);
+            }
+            while ((result < 0) && (errno == EINTR));
+
+            if (result < 0)
+                throwex SystemException(format("Failed to wait for a process with Id {}!", pid()));
+            if (result == 0)
+                return std::numeric_limits<int>::min();
+        }
+#endif
+
+        // Try to wait the process or yield until the deadline
+        Timestamp deadline = NanoTimestamp() + timespan;
         do
         {
             result = waitpid(_pid, &status, WNOHANG);
             if (result == 0)
+            {
+                if (NanoTimestamp() >= deadline)
+                    return std::numeric_limits<int>::min();
                 Thread::Yield();
+            }
         }
         while ((result == 0) || ((result < 0) && (errno == EINTR)));
 
         if (result == -1)
             throwex SystemException(format("Failed to wait for a process with Id {}!", pid()));
 
-        if (WIFEXITED(status))
-            return WEXITSTATUS(status);
-        else if (WIFSIGNALED(status))
-            throwex SystemException(format("Process with Id {} was killed by signal {}!", pid(), WTERMSIG(status)));
-        else if (WIFSTOPPED(status))
-            throwex SystemException(format("Process with Id {} was stopped by signal {}!", pid(), WSTOPSIG(status)));
-        else if (WIFCONTINUED(status))
-            throwex SystemException(format("Process with Id {} was continued by signal SIGCONT!", pid()));
-        else
-            throwex SystemException(format("Process with Id {} has unknown wait status!", pid()));
+        return ExitResult(status);
 #elif defined(_WIN32) || defined(_WIN64)
         if (_process == nullptr)
             throwex SystemException(format("Failed to wait for a process with Id {}!", pid()));
@@ -237,7 +278,7 @@ public:
 #endif
     }
 
-    static Process Execute(const std::string& command, const std::vector<std::string>* arguments, const std::map<std::string, std::string>* envars, const std::string* directory, Pipe* input, Pipe* output, Pipe* error)
+    static Process Execute(const std::string& command, const std::vector<std::string>* arguments, const std::map<std::string, std::string>* envars, const std::string* directory, Pipe* input, Pipe* output, Pipe* error, const ProcessOptions* options)
     {
 #if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
         // Prepare arguments
@@ -256,63 +297,30 @@ public:
         // Prepare environment variables
         std::vector<char> environment = PrepareEnvars(envars);
 
-        // Fork the current process
-        pid_t pid = fork();
-        if (pid < 0)
-            throwex SystemException("Failed to fork the current process!");
-        else if (pid == 0)
+        // Inherit parent environment variables which are not overridden
+        std::vector<char*> envp;
+        for (char** envar = environ; *envar != nullptr; ++envar)
+        {
+            const char* separator = std::strchr(*envar, '=');
+            std::string key(*envar, (separator != nullptr) ? (size_t)(separator - *envar) : std::strlen(*envar));
+            if ((envars == nullptr) || (envars->find(key) == envars->end()))
+                envp.push_back(*envar);
+        }
+        if (!environment.empty())
         {
-            // Set environment variables of the new process
-            if (!environment.empty())
+            char* envar = environment.data();
+            while (*envar != '\0')
             {
-                char* envar = environment.data();
+                envp.push_back(envar);
                 while (*envar != '\0')
-                {
-                    putenv(envar);
-                    while (*envar != '\0')
-                        ++envar;
                     ++envar;
-                }
+                ++envar;
             }
-
-            // Change the current directory of the new process
-            if (directory != nullptr)
-            {
-                int result = chdir(directory->c_str());
-                if (result != 0)
-                    _exit(666);
-            }
-
-            // Prepare input communication pipe
-            if (input != nullptr)
-                dup2((int)(size_t)input->reader(), STDIN_FILENO);
-
-            // Prepare output communication pipe
-            if (output != nullptr)
-                dup2((int)(size_t)output->writer(), STDOUT_FILENO);
-
-            // Prepare error communication pipe
-            if (error != nullptr)
-                dup2((int)(size_t)error->writer(), STDERR_FILENO);
-
-            // Close pipes endpoints
-            if (input != nullptr)
-                input->Close();
-            if (output != nullptr)
-                output->Close();
-            if (error != nullptr)
-                error->Close();
-
-            // Close all open file descriptors other than stdin, stdout, stderr
-            for (int i = 3; i < sysconf(_SC_OPEN_MAX); ++i)
-                close(i);
-
-            // Execute a new process image
-            execvp(argv[0], argv.data());
-
-            // Get here only if error occurred during image execution
-            _exit(666);
         }
+        envp.push_back(nullptr);
+
+        // Spawn a new process with launch options applied before the image execution
+        pid_t pid = ((options != nullptr) && !options->empty()) ? SpawnPlaced(argv.data(), envp.data(), directory, input, output, error, *options) : Spawn(argv.data(), envp.data(), directory, input, output, error);
 
         // Close pipes endpoints
         if (input != nullptr)
@@ -323,10 +331,17 @@ public:
             error->CloseWrite();
 
         // Return result process
-        Process result;
-        result.impl()._pid = pid;
-        return result;
+        Process process;
+        process.impl()._pid = pid;
+        process.impl()._pidfd = OpenPidfd(pid);
+        return process;
 #elif defined(_WIN32) || defined(_WIN64)
+        // Validate launch options supported by Windows
+        if ((options != nullptr) && ((options->node >= 0) || !options->cgroup.empty()))
+            throwex SystemException("Windows platform does not allow to set NUMA node or cgroup of the new process!");
+        if ((options != nullptr) && (options->affinity.last() >= (int)(sizeof(DWORD_PTR) * 8)))
+            throwex SystemException("Windows platform allows to set the CPU affinity of the new process only within the first processor group!");
+
         BOOL bInheritHandles = FALSE;
 
         // Prepare command line
@@ -408,9 +423,10 @@ public:
             si.dwFlags |= STARTF_USESTDHANDLES;
         }
 
-        // Create a new process
+        // Create a new process suspended to set its CPU affinity before it runs
         PROCESS_INFORMATION pi;
-        if (!CreateProcessW(nullptr, (wchar_t*)command_line.c_str(), nullptr, nullptr, bInheritHandles, CREATE_UNICODE_ENVIRONMENT, environment.empty() ? nullptr : (LPVOID)environment.data(), (directory == nullptr) ? nullptr : Encoding::FromUTF8(*directory).c_str(), &si, &pi))
+        DWORD dwCreationFlags = CREATE_UNICODE_ENVIRONMENT | PriorityClass(options) | (((options != nullptr) && options->affinity.any()) ? CREATE_SUSPENDED : 0);
+        if (!CreateProcessW(nullptr, (wchar_t*)command_line.c_str(), nullptr, nullptr, bInheritHandles, dwCreationFlags, environment.empty() ? nullptr : (LPVOID)environment.data(), (directory == nullptr) ? nullptr : Encoding::FromUTF8(*directory).c_str(), &si, &pi))
             throwex SystemException(CppCommon::format("Failed to execute a new process with command '{}'!", command));
 
         // Close standard handles
@@ -421,6 +437,19 @@ public:
         if (si.hStdError != nullptr)
             CloseHandle(si.hStdError);
 
+        // Set the new process CPU affinity and resume it
+        if ((options != nullptr) && options->affinity.any())
+        {
+            if (!SetProcessAffinityMask(pi.hProcess, (DWORD_PTR)options->affinity.mask().to_ullong()) || (ResumeThread(pi.hThread) == (DWORD)-1))
+            {
+                DWORD dwError = GetLastError();
+                TerminateProcess(pi.hProcess, 1);
+                CloseHandle(pi.hThread);
+                CloseHandle(pi.hProcess);
+                throwex SystemException("Failed to set the CPU affinity of the new process!", dwError);
+            }
+        }
+
         // Close thread handle
         CloseHandle(pi.hThread);
 
@@ -432,6 +461,292 @@ public:
 #endif
     }
 
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+    static pid_t Fork(char* const* argv, char* const* envp, const std::string* directory, Pipe* input, Pipe* output, Pipe* error)
+    {
+        const long open_max = sysconf(_SC_OPEN_MAX);
+
+        // Fork the current process
+        pid_t pid = fork();
+        if (pid < 0)
+            throwex SystemException("Failed to fork the current process!");
+        else if (pid == 0)
+        {
+            // Change the current directory of the new process
+            if ((directory != nullptr) && (chdir(directory->c_str()) != 0))
+                _exit(127);
+
+            // Prepare input, output and error communication pipes
+            if (input != nullptr)
+                dup2((int)(size_t)input->reader(), STDIN_FILENO);
+            if (output != nullptr)
+                dup2((int)(size_t)output->writer(), STDOUT_FILENO);
+            if (error != nullptr)
+                dup2((int)(size_t)error->writer(), STDERR_FILENO);
+
+            // Close all open file descriptors other than stdin, stdout, stderr
+            for (int fd = 3; fd < open_max; ++fd)
+                close(fd);
+
+            // Execute a new process image with the prepared environment variables
+            environ = (char**)envp;
+            execvp(argv[0], argv);
+
+            // Get here only if error occurred during image execution
+            _exit(127);
+        }
+
+        return pid;
+    }
+
+    static pid_t Spawn(char* const* argv, char* const* envp, const std::string* directory, Pipe* input, Pipe* output, Pipe* error)
+    {
+#if !defined(CPPCOMMON_PROCESS_SPAWN_CLOSEFROM)
+        // posix_spawn() is not able to close all inherited file descriptors on this platform
+        return Fork(argv, envp, directory, input, output, error);
+#else
+#if !defined(CPPCOMMON_PROCESS_SPAWN_CHDIR)
+        // posix_spawn() is not able to change the current directory on this platform
+        if (directory != nullptr)
+            return Fork(argv, envp, directory, input, output, error);
+#endif
+
+        // Spawn actions are applied in the new process before the image execution
+        posix_spawn_file_actions_t actions;
+        int result = posix_spawn_file_actions_init(&actions);
+        if (result != 0)
+            throwex SystemException("Failed to initialize process spawn file actions!", result);
+        auto actions_cleaner = resource(&actions, [](posix_spawn_file_actions_t* pactions) { posix_spawn_file_actions_destroy(pactions); });
+        posix_spawnattr_t attributes;
+        result = posix_spawnattr_init(&attributes);
+        if (result != 0)
+            throwex SystemException("Failed to initialize process spawn attributes!", result);
+        auto attributes_cleaner = resource(&attributes, [](posix_spawnattr_t* pattributes) { posix_spawnattr_destroy(pattributes); });
+
+#if defined(CPPCOMMON_PROCESS_SPAWN_CHDIR)
+        // Change the current directory of the new process
+        if ((directory != nullptr) && ((result = posix_spawn_file_actions_addchdir_np(&actions, directory->c_str())) != 0))
+            throwex SystemException("Failed to set the current directory of the new process!", result);
+#endif
+
+        // Prepare input, output and error communication pipes
+        if ((input != nullptr) && ((result = posix_spawn_file_actions_adddup2(&actions, (int)(size_t)input->reader(), STDIN_FILENO)) != 0))
+            throwex SystemException("Failed to redirect the input of the new process!", result);
+        if ((output != nullptr) && ((result = posix_spawn_file_actions_adddup2(&actions, (int)(size_t)output->writer(), STDOUT_FILENO)) != 0))
+            throwex SystemException("Failed to redirect the output of the new process!", result);
+        if ((error != nullptr) && ((result = posix_spawn_file_actions_adddup2(&actions, (int)(size_t)error->writer(), STDERR_FILENO)) != 0))
+            throwex SystemException("Failed to redirect the error of the new process!", result);
+
+        // Close all open file descriptors other than stdin, stdout, stderr
+#if defined(__APPLE__)
+        result = posix_spawnattr_setflags(&attributes, POSIX_SPAWN_CLOEXEC_DEFAULT);
+        for (int i = STDIN_FILENO; (result == 0) && (i <= STDERR_FILENO); ++i)
+            result = posix_spawn_file_actions_addinherit_np(&actions, i);
+#else
+        result = posix_spawn_file_actions_addclosefrom_np(&actions, 3);
+#endif
+        if (result != 0)
+            throwex SystemException("Failed to close file descriptors of the new process!", result);
+
+        // Spawn a new process image without copying the parent address space
+        pid_t pid;
+        result = posix_spawnp(&pid, argv[0], &actions, &attributes, argv, envp);
+        if (result != 0)
+            throwex SystemException("Failed to execute a new process!", result);
+
+        return pid;
+#endif
+    }
+
+    static pid_t SpawnPlaced(char* const* argv, char* const* envp, const std::string* directory, Pipe* input, Pipe* output, Pipe* error, const ProcessOptions& options)
+    {
+#if defined(linux) || defined(__linux) || defined(__linux__)
+        // Prepare all launch options in the parent process, because vfork() child may only call async-signal-safe functions
+        const size_t bits = sizeof(unsigned long) * 8;
+
+        std::string cgroup = options.cgroup.empty() ? std::string() : (options.cgroup + "/cgroup.procs");
+
+        std::vector<unsigned long> affinity;
+        if (options.affinity.any())
+        {
+            affinity.resize(std::max((size_t)options.affinity.last() + 1, (size_t)CPU_SETSIZE) / bits + 1, 0);
+            for (int cpu = options.affinity.first(); cpu >= 0; cpu = options.affinity.next(cpu))
+                affinity[cpu / bits] |= 1ul << (cpu % bits);
+        }
+
+        // Memory policy mode from <linux/mempolicy.h>
+        const int MPOL_PREFERRED = 1;
+        std::vector<unsigned long> nodes;
+        if (options.node >= 0)
+        {
+            nodes.resize(options.node / bits + 1, 0);
+            nodes[options.node / bits] |= 1ul << (options.node % bits);
+        }
+
+        // Communication pipes endpoints of the new process
+        const int pipes[] = {
+            (input != nullptr) ? (int)(size_t)input->reader() : -1,
+            (output != nullptr) ? (int)(size_t)output->writer() : -1,
+            (error != nullptr) ? (int)(size_t)error->writer() : -1
+        };
+
+        // Open file descriptors limit for the fallback close loop
+        const long open_max = sysconf(_SC_OPEN_MAX);
+
+        // Block all signals, so signal handlers of the parent process are not called in the shared address space
+        sigset_t all;
+        sigset_t mask;
+        sigfillset(&all);
+        pthread_sigmask(SIG_SETMASK, &all, &mask);
+
+        // Failed child stage and its error are reported through the shared address space
+        volatile int stage = 0;
+        volatile int failure = 0;
+
+        pid_t pid = vfork();
+        if (pid == 0)
+        {
+            // Reset signal handlers of the new process (signal handlers are not shared with the parent process)
+            for (int signal = 1; signal < NSIG; ++signal)
+            {
+                struct sigaction action;
+                if ((sigaction(signal, nullptr, &action) == 0) && (action.sa_handler != SIG_IGN) && (action.sa_handler != SIG_DFL))
+                {
+                    action.sa_handler = SIG_DFL;
+                    action.sa_flags = 0;
+                    sigaction(signal, &action, nullptr);
+                }
+            }
+
+            // Move the new process into the cgroup
+            if (!cgroup.empty())
+            {
+                int fd = open(cgroup.c_str(), O_WRONLY | O_CLOEXEC);
+                if ((fd < 0) || (write(fd, "0", 1) != 1))
+                {
+                    failure = errno;
+                    stage = 1;
+                    _exit(127);
+                }
+                close(fd);
+            }
+
+            // Set the new process CPU affinity
+            if (!affinity.empty() && (sched_setaffinity(0, affinity.size() * sizeof(unsigned long), (cpu_set_t*)affinity.data()) != 0))
+            {
+                failure = errno;
+                stage = 2;
+                _exit(127);
+            }
+
+            // Set the new process NUMA memory policy
+            if (!nodes.empty() && (syscall(SYS_set_mempolicy, MPOL_PREFERRED, nodes.data(), nodes.size() * bits + 1) != 0))
+            {
+                failure = errno;
+                stage = 3;
+                _exit(127);
+            }
+
+            // Set the new process priority
+            int nice = 0;
+            switch (options.priority)
+            {
+                case ProcessPriority::IDLE:
+                    nice = 19;
+                    break;
+                case ProcessPriority::LOW:
+                    nice = 10;
+                    break;
+                case ProcessPriority::HIGH:
+                    nice = -10;
+                    break;
+                case ProcessPriority::REALTIME:
+                    nice = -20;
+                    break;
+                default:
+                    break;
+            }
+            if ((options.priority != ProcessPriority::INHERIT) && (setpriority(PRIO_PROCESS, 0, nice) != 0))
+            {
+                failure = errno;
+                stage = 4;
+                _exit(127);
+            }
+
+            // Change the current directory of the new process
+            if ((directory != nullptr) && (chdir(directory->c_str()) != 0))
+            {
+                failure = errno;
+                stage = 5;
+                _exit(127);
+            }
+
+            // Redirect input, output and error communication pipes
+            for (int fd = STDIN_FILENO; fd <= STDERR_FILENO; ++fd)
+            {
+                if ((pipes[fd] >= 0) && (dup2(pipes[fd], fd) < 0))
+                {
+                    failure = errno;
+                    stage = 6;
+                    _exit(127);
+                }
+            }
+
+            // Close all open file descriptors other than stdin, stdout, stderr
+#if defined(SYS_close_range)
+            if (syscall(SYS_close_range, 3, ~0u, 0) != 0)
+#endif
+            {
+                for (int fd = 3; fd < open_max; ++fd)
+                    close(fd);
+            }
+
+            // Restore the signal mask and execute the new process image
+            pthread_sigmask(SIG_SETMASK, &mask, nullptr);
+            execvpe(argv[0], argv, envp);
+            failure = errno;
+            stage = 7;
+            _exit(127);
+        }
+
+        // Restore the signal mask of the parent process
+        int vfork_error = errno;
+        pthread_sigmask(SIG_SETMASK, &mask, nullptr);
+        if (pid < 0)
+            throwex SystemException("Failed to execute a new process!", vfork_error);
+
+        if (stage != 0)
+        {
+            // Reap the failed new process
+            int status;
+            while ((waitpid(pid, &status, 0) < 0) && (errno == EINTR));
+
+            switch (stage)
+            {
+                case 1:
+                    throwex SystemException("Failed to move the new process into the cgroup " + options.cgroup + "!", failure);
+                case 2:
+                    throwex SystemException("Failed to set the CPU affinity of the new process!", failure);
+                case 3:
+                    throwex SystemException("Failed to set the NUMA memory policy of the new process!", failure);
+                case 4:
+                    throwex SystemException("Failed to set the priority of the new process!", failure);
+                case 5:
+                    throwex SystemException("Failed to set the current directory of the new process!", failure);
+                case 6:
+                    throwex SystemException("Failed to redirect communication pipes of the new process!", failure);
+                default:
+                    throwex SystemException("Failed to execute a new process!", failure);
+            }
+        }
+
+        return pid;
+#else
+        throwex SystemException("Process launch options are not supported on this platform!");
+#endif
+    }
+#endif
+
 #if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
     static std::vector<char> PrepareEnvars(const std::map<std::string, std::string>* envars)
 #elif defined(_WIN32) || defined(_WIN64)
@@ -466,9 +781,60 @@ public:
         return result;
     }
 
+#if defined(_WIN32) || defined(_WIN64)
+    static DWORD PriorityClass(const ProcessOptions* options) noexcept
+    {
+        if (options == nullptr)
+            return 0;
+
+        switch (options->priority)
+        {
+            case ProcessPriority::IDLE:
+                return IDLE_PRIORITY_CLASS;
+            case ProcessPriority::LOW:
+                return BELOW_NORMAL_PRIORITY_CLASS;
+            case ProcessPriority::NORMAL:
+                return NORMAL_PRIORITY_CLASS;
+            case ProcessPriority::HIGH:
+                return HIGH_PRIORITY_CLASS;
+            case ProcessPriority::REALTIME:
+                return REALTIME_PRIORITY_CLASS;
+            default:
+                return 0;
+        }
+    }
+#endif
+
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+    static int OpenPidfd(pid_t pid) noexcept
+    {
+#if (defined(linux) || defined(__linux) || defined(__linux__)) && defined(SYS_pidfd_open)
+        // Process descriptor is not available before Linux 5.3
+        return (pid > 0) ? (int)syscall(SYS_pidfd_open, pid, 0) : -1;
+#else
+        return -1;
+#endif
+    }
+
+    int ExitResult(int status) const
+    {
+        if (WIFEXITED(status))
+            return WEXITSTATUS(status);
+        else if (WIFSIGNALED(status))
+            throwex SystemException(format("Process with Id {} was killed by signal {}!", pid(), WTERMSIG(status)));
+        else if (WIFSTOPPED(status))
+            throwex SystemException(format("Process with Id {} was stopped by signal {}!", pid(), WSTOPSIG(status)));
+        else if (WIFCONTINUED(status))
+            throwex SystemException(format("Process with Id {} was continued by signal SIGCONT!", pid()));
+        else
+            throwex SystemException(format("Process with Id {} has unknown wait status!", pid()));
+    }
+#endif
+
 private:
 #if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
     pid_t _pid;
+    int _pidfd;
 #elif defined(_WIN32) || defined(_WIN64)
     DWORD _pid;
     HANDLE _process;
@@ -534,6 +900,7 @@ Process& Process::operator=(Process&& process) noexcept
 }
 
 uint64_t Process::pid() const noexcept { return impl().pid(); }
+void* Process::handle() const noexcept { return impl().handle(); }
 
 bool Process::IsRunning() const { return impl().IsRunning(); }
 
@@ -546,9 +913,9 @@ uint64_t Process::ParentProcessId() noexcept { return Impl::ParentProcessId(); }
 
 void Process::Exit(int result) { return Impl::Exit(result); }
 
-Process Process::Execute(const std::string& command, const std::vector<std::string>* arguments, const std::map<std::string, std::string>* envars, const std::string* directory, Pipe* input, Pipe* output, Pipe* error)
+Process Process::Execute(const std::string& command, const std::vector<std::string>* arguments, const std::map<std::string, std::string>* envars, const std::string* directory, Pipe* input, Pipe* output, Pipe* error, const ProcessOptions* options)
 {
-    return Impl::Execute(command, arguments, envars, directory, input, output, error);
+    return Impl::Execute(command, arguments, envars, directory, input, output, error, options);
 }
 
 void Process::swap(Process& process) noexcept
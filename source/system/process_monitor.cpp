@@ -0,0 +1,519 @@
+/*!
+    \file process_monitor.cpp
+    \brief Process monitor implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "system/process_monitor.h"
+
+#include "errors/fatal.h"
+#include "string/format.h"
+#include "threads/thread.h"
+
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#if defined(linux) || defined(__linux) || defined(__linux__)
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/syscall.h>
+#include <sys/wait.h>
+#include <errno.h>
+#include <signal.h>
+#include <unistd.h>
+#elif defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+#include <sys/wait.h>
+#include <errno.h>
+#include <signal.h>
+#include <unistd.h>
+#elif defined(_WIN32) || defined(_WIN64)
+#include <windows.h>
+#undef max
+#undef min
+#endif
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+
+class ProcessMonitor::Impl
+{
+public:
+    Impl() : _running(false), _stop(false)
+    {
+#if defined(linux) || defined(__linux) || defined(__linux__)
+        _polled = 0;
+        _epoll = epoll_create1(EPOLL_CLOEXEC);
+        if (_epoll < 0)
+            throwex SystemException("Failed to create an epoll instance for the process monitor!");
+        _event = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+        if (_event < 0)
+        {
+            close(_epoll);
+            throwex SystemException("Failed to create a wakeup event for the process monitor!");
+        }
+        struct epoll_event event = {};
+        event.events = EPOLLIN;
+        event.data.u64 = 0;
+        if (epoll_ctl(_epoll, EPOLL_CTL_ADD, _event, &event) != 0)
+        {
+            close(_event);
+            close(_epoll);
+            throwex SystemException("Failed to register a wakeup event for the process monitor!");
+        }
+#elif defined(_WIN32) || defined(_WIN64)
+        _port = CreateIoCompletionPort(INVALID_HANDLE_VALUE, nullptr, 0, 1);
+        if (_port == nullptr)
+            throwex SystemException("Failed to create an I/O completion port for the process monitor!");
+#endif
+    }
+
+    ~Impl()
+    {
+        Stop();
+
+        // Release all watched processes
+        for (auto& entry : _entries)
+            Release(entry.second);
+        _entries.clear();
+
+#if defined(linux) || defined(__linux) || defined(__linux__)
+        if (close(_event) != 0)
+            fatality(SystemException("Failed to close a wakeup event of the process monitor!"));
+        if (close(_epoll) != 0)
+            fatality(SystemException("Failed to close an epoll instance of the process monitor!"));
+#elif defined(_WIN32) || defined(_WIN64)
+        if (!CloseHandle(_port))
+            fatality(SystemException("Failed to close an I/O completion port of the process monitor!"));
+#endif
+    }
+
+    size_t size() const
+    {
+        std::scoped_lock locker(_lock);
+        return _entries.size();
+    }
+
+    bool IsRunning() const noexcept
+    {
+        return _running.load(std::memory_order_acquire);
+    }
+
+    void Insert(const Process& process, Callback&& callback)
+    {
+        uint64_t pid = process.pid();
+
+        Entry entry;
+        entry.callback = std::move(callback);
+
+#if defined(linux) || defined(__linux) || defined(__linux__)
+#if defined(SYS_pidfd_open)
+        entry.pidfd = (int)syscall(SYS_pidfd_open, (pid_t)pid, 0);
+#else
+        errno = ENOSYS;
+#endif
+        // Process is polled if process descriptors are not supported
+        if ((entry.pidfd < 0) && (errno != ENOSYS))
+            throwex SystemException(format("Failed to watch a process with Id {}!", pid));
+#elif defined(_WIN32) || defined(_WIN64)
+        bool exited = false;
+        HANDLE hCurrentProcess = GetCurrentProcess();
+        if ((process.handle() == nullptr) || !DuplicateHandle(hCurrentProcess, (HANDLE)process.handle(), hCurrentProcess, &entry.process, 0, FALSE, DUPLICATE_SAME_ACCESS))
+            throwex SystemException(format("Failed to watch a process with Id {}!", pid));
+        entry.job = CreateJobObjectW(nullptr, nullptr);
+        if (entry.job == nullptr)
+        {
+            Release(entry);
+            throwex SystemException(format("Failed to create a job object for a process with Id {}!", pid));
+        }
+        JOBOBJECT_ASSOCIATE_COMPLETION_PORT association;
+        association.CompletionKey = entry.job;
+        association.CompletionPort = _port;
+        if (!SetInformationJobObject(entry.job, JobObjectAssociateCompletionPortInformation, &association, sizeof(association)))
+        {
+            Release(entry);
+            throwex SystemException(format("Failed to associate a job object for a process with Id {}!", pid));
+        }
+        if (!AssignProcessToJobObject(entry.job, entry.process))
+        {
+            // Exited process could not be assigned to the job object
+            exited = (WaitForSingleObject(entry.process, 0) == WAIT_OBJECT_0);
+            if (!exited)
+            {
+                Release(entry);
+                throwex SystemException(format("Failed to assign a job object for a process with Id {}!", pid));
+            }
+        }
+#endif
+
+        bool polled = false;
+        {
+            std::scoped_lock locker(_lock);
+
+            if (_entries.find(pid) != _entries.end())
+            {
+                Release(entry);
+                throwex SystemException(format("Process with Id {} is already watched!", pid));
+            }
+
+#if defined(linux) || defined(__linux) || defined(__linux__)
+            if (entry.pidfd >= 0)
+            {
+                struct epoll_event event = {};
+                event.events = EPOLLIN;
+                event.data.u64 = pid;
+                if (epoll_ctl(_epoll, EPOLL_CTL_ADD, entry.pidfd, &event) != 0)
+                {
+                    Release(entry);
+                    throwex SystemException(format("Failed to register a process with Id {} in the process monitor!", pid));
+                }
+            }
+            else
+            {
+                polled = true;
+                ++_polled;
+            }
+#endif
+
+            _entries.emplace(pid, std::move(entry));
+        }
+
+#if defined(linux) || defined(__linux) || defined(__linux__)
+        // Wake up the waiting thread to start polling
+        if (polled)
+            Wakeup();
+#elif defined(_WIN32) || defined(_WIN64)
+        // Notify about the process exited before it was assigned to the job object
+        if (exited)
+            PostQueuedCompletionStatus(_port, JOB_OBJECT_MSG_EXIT_PROCESS, 0, (LPOVERLAPPED)(ULONG_PTR)pid);
+#endif
+    }
+
+    bool Unwatch(uint64_t pid)
+    {
+        std::scoped_lock locker(_lock);
+
+        auto it = _entries.find(pid);
+        if (it == _entries.end())
+            return false;
+
+        Entry entry = Remove(it);
+        Release(entry);
+        return true;
+    }
+
+    size_t Poll(const Timespan& timespan)
+    {
+        int64_t timeout = std::min(std::max((timespan.microseconds() + 999) / 1000, (int64_t)0), (int64_t)std::numeric_limits<int>::max());
+        return Dispatch((int)timeout);
+    }
+
+    bool Start()
+    {
+        std::scoped_lock locker(_thread_lock);
+
+        if (_running.load(std::memory_order_relaxed))
+            return false;
+
+        _stop.store(false, std::memory_order_release);
+        _thread = Thread::Start([this]() { Run(); });
+        _running.store(true, std::memory_order_release);
+        return true;
+    }
+
+    bool Stop()
+    {
+        std::scoped_lock locker(_thread_lock);
+
+        if (!_running.load(std::memory_order_relaxed))
+            return false;
+
+        _stop.store(true, std::memory_order_release);
+        Wakeup();
+        if (_thread.joinable())
+            _thread.join();
+        _running.store(false, std::memory_order_release);
+        return true;
+    }
+
+private:
+    // Watched process entry
+    struct Entry
+    {
+        Callback callback;
+        bool exited;
+        int result;
+#if defined(linux) || defined(__linux) || defined(__linux__)
+        int pidfd;
+#elif defined(_WIN32) || defined(_WIN64)
+        HANDLE process;
+        HANDLE job;
+#endif
+
+        Entry() : exited(false), result(std::numeric_limits<int>::min())
+#if defined(linux) || defined(__linux) || defined(__linux__)
+            , pidfd(-1)
+#elif defined(_WIN32) || defined(_WIN64)
+            , process(nullptr), job(nullptr)
+#endif
+        {}
+    };
+
+    mutable std::mutex _lock;
+    std::map<uint64_t, Entry> _entries;
+
+    std::mutex _thread_lock;
+    std::thread _thread;
+    std::atomic<bool> _running;
+    std::atomic<bool> _stop;
+
+#if defined(linux) || defined(__linux) || defined(__linux__)
+    int _epoll;
+    int _event;
+    size_t _polled;
+#elif defined(_WIN32) || defined(_WIN64)
+    HANDLE _port;
+#endif
+
+    void Run()
+    {
+        while (!_stop.load(std::memory_order_acquire))
+            Dispatch(-1);
+    }
+
+    void Wakeup()
+    {
+#if defined(linux) || defined(__linux) || defined(__linux__)
+        uint64_t value = 1;
+        [[maybe_unused]] ssize_t result = write(_event, &value, sizeof(value));
+#elif defined(_WIN32) || defined(_WIN64)
+        PostQueuedCompletionStatus(_port, 0, 0, nullptr);
+#endif
+    }
+
+    // Remove the watched process entry (must be called under the lock)
+    Entry Remove(std::map<uint64_t, Entry>::iterator it)
+    {
+        Entry entry = std::move(it->second);
+        _entries.erase(it);
+#if defined(linux) || defined(__linux) || defined(__linux__)
+        if (entry.pidfd < 0)
+            --_polled;
+#endif
+        return entry;
+    }
+
+    // Release native handles of the watched process
+    void Release(Entry& entry)
+    {
+#if defined(linux) || defined(__linux) || defined(__linux__)
+        if (entry.pidfd >= 0)
+        {
+            epoll_ctl(_epoll, EPOLL_CTL_DEL, entry.pidfd, nullptr);
+            close(entry.pidfd);
+            entry.pidfd = -1;
+        }
+#elif defined(_WIN32) || defined(_WIN64)
+        if (entry.job != nullptr)
+        {
+            CloseHandle(entry.job);
+            entry.job = nullptr;
+        }
+        if (entry.process != nullptr)
+        {
+            CloseHandle(entry.process);
+            entry.process = nullptr;
+        }
+#endif
+    }
+
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+    // Collect the exit result of the process without blocking
+    static bool Collect(uint64_t pid, int& result)
+    {
+        int status;
+        pid_t waited;
+        do
+        {
+            waited = waitpid((pid_t)pid, &status, WNOHANG);
+        }
+        while ((waited < 0) && (errno == EINTR));
+
+        if (waited > 0)
+        {
+            if (WIFEXITED(status))
+                result = WEXITSTATUS(status);
+            else if (WIFSIGNALED(status))
+                result = -WTERMSIG(status);
+            else
+                result = std::numeric_limits<int>::min();
+            return true;
+        }
+
+        // Exit result of other processes could not be collected
+        if ((waited < 0) && (errno == ECHILD) && (kill((pid_t)pid, 0) != 0) && (errno == ESRCH))
+        {
+            result = std::numeric_limits<int>::min();
+            return true;
+        }
+
+        return false;
+    }
+
+    // Poll processes without descriptors (must be called under the lock)
+    void Check(std::vector<uint64_t>& exited)
+    {
+        for (auto& entry : _entries)
+        {
+#if defined(linux) || defined(__linux) || defined(__linux__)
+            if (entry.second.pidfd >= 0)
+                continue;
+#endif
+            if (!entry.second.exited && Collect(entry.first, entry.second.result))
+            {
+                entry.second.exited = true;
+                exited.push_back(entry.first);
+            }
+        }
+    }
+#endif
+
+    // Wait for exited processes for the given timeout in milliseconds (-1 for infinite)
+    void Wait(int timeout, std::vector<uint64_t>& exited)
+    {
+#if defined(linux) || defined(__linux) || defined(__linux__)
+        {
+            std::scoped_lock locker(_lock);
+            if (_polled > 0)
+            {
+                Check(exited);
+                if (!exited.empty())
+                    timeout = 0;
+                else if ((timeout < 0) || (timeout > 10))
+                    timeout = 10;
+            }
+        }
+
+        struct epoll_event events[64];
+        int count;
+        do
+        {
+            count = epoll_wait(_epoll, events, (int)std::size(events), timeout);
+        }
+        while ((count < 0) && (errno == EINTR));
+
+        if (count < 0)
+            throwex SystemException("Failed to wait for the process monitor events!");
+
+        for (int i = 0; i < count; ++i)
+        {
+            if (events[i].data.u64 == 0)
+            {
+                // Reset the wakeup event
+                uint64_t value;
+                [[maybe_unused]] ssize_t result = read(_event, &value, sizeof(value));
+            }
+            else
+                exited.push_back(events[i].data.u64);
+        }
+#elif defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+        // Poll all processes until the timeout or the stop request
+        Timestamp deadline = NanoTimestamp() + Timespan::milliseconds(std::max(timeout, 0));
+        for (;;)
+        {
+            {
+                std::scoped_lock locker(_lock);
+                Check(exited);
+            }
+            if (!exited.empty() || _stop.load(std::memory_order_acquire))
+                break;
+            if ((timeout >= 0) && (NanoTimestamp() >= deadline))
+                break;
+            Thread::Sleep(1);
+        }
+#elif defined(_WIN32) || defined(_WIN64)
+        DWORD dwTimeout = (timeout < 0) ? INFINITE : (DWORD)timeout;
+        DWORD dwMessage;
+        ULONG_PTR key;
+        LPOVERLAPPED overlapped;
+        while (GetQueuedCompletionStatus(_port, &dwMessage, &key, &overlapped, dwTimeout))
+        {
+            // Exit notifications of watched processes and their children
+            if ((dwMessage == JOB_OBJECT_MSG_EXIT_PROCESS) || (dwMessage == JOB_OBJECT_MSG_ABNORMAL_EXIT_PROCESS))
+                exited.push_back((uint64_t)(ULONG_PTR)overlapped);
+
+            // Drain all queued notifications
+            dwTimeout = 0;
+        }
+#endif
+    }
+
+    size_t Dispatch(int timeout)
+    {
+        std::vector<uint64_t> exited;
+        Wait(timeout, exited);
+
+        size_t count = 0;
+        for (uint64_t pid : exited)
+        {
+            Entry entry;
+            {
+                std::scoped_lock locker(_lock);
+
+                auto it = _entries.find(pid);
+                if (it == _entries.end())
+                    continue;
+
+                entry = Remove(it);
+
+                // Collect the exit result of the signaled process
+                if (!entry.exited)
+                {
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+                    Collect(pid, entry.result);
+#elif defined(_WIN32) || defined(_WIN64)
+                    DWORD dwExitCode;
+                    if (GetExitCodeProcess(entry.process, &dwExitCode))
+                        entry.result = (int)dwExitCode;
+#endif
+                }
+
+                Release(entry);
+            }
+
+            entry.callback(pid, entry.result);
+            ++count;
+        }
+        return count;
+    }
+};
+
+//! @endcond
+
+ProcessMonitor::ProcessMonitor() : _pimpl(std::make_unique<Impl>())
+{
+}
+
+ProcessMonitor::~ProcessMonitor()
+{
+}
+
+size_t ProcessMonitor::size() const { return _pimpl->size(); }
+bool ProcessMonitor::IsRunning() const noexcept { return _pimpl->IsRunning(); }
+
+void ProcessMonitor::Insert(const Process& process, Callback&& callback) { _pimpl->Insert(process, std::move(callback)); }
+bool ProcessMonitor::Unwatch(uint64_t pid) { return _pimpl->Unwatch(pid); }
+
+size_t ProcessMonitor::Poll(const Timespan& timespan) { return _pimpl->Poll(timespan); }
+
+bool ProcessMonitor::Start() { return _pimpl->Start(); }
+bool ProcessMonitor::Stop() { return _pimpl->Stop(); }
+
+} // namespace CppCommon
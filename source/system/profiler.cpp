@@ -0,0 +1,355 @@
+/*!
+    \file profiler.cpp
+    \brief Sampling CPU profiler implementation
+    \author Ivan Shynkarenka
+    \date 15.10.2026
+    \copyright MIT License
+*/
+
+#include "system/profiler.h"
+
+#include "filesystem/file.h"
+#include "system/stack_trace.h"
+#include "threads/thread.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <condition_variable>
+#include <cstdio>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#if (defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)) && !defined(__CYGWIN__)
+#include <cerrno>
+#include <signal.h>
+#include <sys/time.h>
+#endif
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+
+namespace {
+
+// Sample slot states
+const int SLOT_EMPTY = 0;
+const int SLOT_WRITING = 1;
+const int SLOT_READY = 2;
+
+// Preallocated sample slot
+struct Sample
+{
+    std::atomic<int> state;
+    int count;
+    void* frames[Profiler::MAX_FRAMES];
+};
+
+// Signal handler state is kept outside of the singleton, because it must be reachable without any initialization
+std::atomic<Sample*> samples_slots(nullptr);
+std::atomic<size_t> samples_mask(0);
+std::atomic<size_t> samples_head(0);
+std::atomic<uint64_t> samples_dropped(0);
+std::atomic<int> samples_writers(0);
+
+#if (defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)) && !defined(__CYGWIN__)
+void ProfilerSignalHandler(int, siginfo_t*, void*)
+{
+    // Async-signal-safe code only: atomics and the warmed up unwinder
+    int saved_errno = errno;
+
+    samples_writers.fetch_add(1, std::memory_order_seq_cst);
+    Sample* slots = samples_slots.load(std::memory_order_seq_cst);
+    if (slots != nullptr)
+    {
+        size_t index = samples_head.fetch_add(1, std::memory_order_relaxed) & samples_mask.load(std::memory_order_relaxed);
+        Sample& sample = slots[index];
+
+        // Never wait for the collector, count the dropped sample instead
+        int expected = SLOT_EMPTY;
+        if (sample.state.compare_exchange_strong(expected, SLOT_WRITING, std::memory_order_acquire, std::memory_order_relaxed))
+        {
+            // Skip the signal handler and the signal trampoline frames
+            sample.count = StackTrace::Capture(sample.frames, Profiler::MAX_FRAMES, 2);
+            sample.state.store(SLOT_READY, std::memory_order_release);
+        }
+        else
+            samples_dropped.fetch_add(1, std::memory_order_relaxed);
+    }
+    samples_writers.fetch_sub(1, std::memory_order_release);
+
+    errno = saved_errno;
+}
+#endif
+
+} // namespace
+
+class Profiler::Impl
+{
+public:
+    Impl() : _started(false), _installed(false), _samples(0), _dropped(0), _stop(false) {}
+
+    ~Impl()
+    {
+        Stop();
+    }
+
+    bool IsStarted() const noexcept { return _started.load(std::memory_order_acquire); }
+
+    uint64_t samples() const noexcept { return _samples.load(std::memory_order_relaxed); }
+    uint64_t dropped() const noexcept { return _dropped.load(std::memory_order_relaxed); }
+
+    bool Start(const Timespan& interval, size_t capacity)
+    {
+        assert((capacity > 0) && "Profiler capacity must be greater than zero!");
+        assert(((capacity & (capacity - 1)) == 0) && "Profiler capacity must be a power of two!");
+
+#if (defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)) && !defined(__CYGWIN__)
+        std::scoped_lock locker(_thread_lock);
+
+        if (_started.load(std::memory_order_relaxed))
+            return false;
+
+        // Clear the profile of the previous session
+        {
+            std::scoped_lock stacks_locker(_stacks_lock);
+            _stacks.clear();
+        }
+        _samples.store(0, std::memory_order_relaxed);
+        _dropped.store(0, std::memory_order_relaxed);
+
+        // Warm up the unwinder outside of the signal handler, because its first call might load libraries and allocate
+        void* frames[MAX_FRAMES];
+        StackTrace::Capture(frames, MAX_FRAMES);
+
+        // Preallocate sample slots
+        _slots = std::make_unique<Sample[]>(capacity);
+        for (size_t i = 0; i < capacity; ++i)
+            _slots[i].state.store(SLOT_EMPTY, std::memory_order_relaxed);
+        samples_mask.store(capacity - 1, std::memory_order_relaxed);
+        samples_head.store(0, std::memory_order_relaxed);
+        samples_dropped.store(0, std::memory_order_relaxed);
+        samples_slots.store(_slots.get(), std::memory_order_release);
+
+        // Install the signal handler once, pending signals after stop are ignored by the handler itself
+        if (!_installed)
+        {
+            struct sigaction action;
+            sigemptyset(&action.sa_mask);
+            action.sa_sigaction = ProfilerSignalHandler;
+            action.sa_flags = SA_SIGINFO | SA_RESTART;
+            if (sigaction(SIGPROF, &action, nullptr) != 0)
+                throwex SystemException("Cannot install SIGPROF signal handler!");
+            _installed = true;
+        }
+
+        _stop = false;
+        _thread = Thread::Start([this]() { Run(); });
+
+        // Arm the profiling interval timer
+        int64_t microseconds = std::max(interval.microseconds(), (int64_t)1);
+        struct itimerval timer;
+        timer.it_interval.tv_sec = (time_t)(microseconds / 1000000);
+        timer.it_interval.tv_usec = (suseconds_t)(microseconds % 1000000);
+        timer.it_value = timer.it_interval;
+        if (setitimer(ITIMER_PROF, &timer, nullptr) != 0)
+        {
+            StopThread();
+            samples_slots.store(nullptr, std::memory_order_release);
+            _slots.reset();
+            throwex SystemException("Cannot arm the profiling interval timer!");
+        }
+
+        _started.store(true, std::memory_order_release);
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    bool Stop()
+    {
+#if (defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)) && !defined(__CYGWIN__)
+        std::scoped_lock locker(_thread_lock);
+
+        if (!_started.load(std::memory_order_relaxed))
+            return false;
+
+        // Disarm the profiling interval timer
+        struct itimerval timer = {};
+        setitimer(ITIMER_PROF, &timer, nullptr);
+
+        _started.store(false, std::memory_order_release);
+        StopThread();
+
+        // Detach slots from the signal handler and wait for samples being captured
+        samples_slots.store(nullptr, std::memory_order_seq_cst);
+        while (samples_writers.load(std::memory_order_acquire) > 0)
+            std::this_thread::yield();
+
+        // Collect all captured samples
+        Drain();
+        _slots.reset();
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    std::string Folded()
+    {
+        // Copy collected stacks to resolve symbols without the lock
+        std::map<std::vector<void*>, uint64_t> stacks;
+        {
+            std::scoped_lock locker(_stacks_lock);
+            stacks = _stacks;
+        }
+
+        std::map<std::string, uint64_t> folded;
+        for (const auto& stack : stacks)
+        {
+            StackTrace trace(stack.first.data(), stack.first.size());
+            const auto& frames = trace.frames();
+
+            // Folded stack starts from the root frame
+            std::string line;
+            for (auto it = frames.rbegin(); it != frames.rend(); ++it)
+            {
+                if (!line.empty())
+                    line.push_back(';');
+                line.append(FrameName(*it));
+            }
+
+            // Different addresses of the same functions are merged
+            folded[line] += stack.second;
+        }
+
+        std::string result;
+        for (const auto& stack : folded)
+        {
+            result.append(stack.first);
+            result.push_back(' ');
+            result.append(std::to_string(stack.second));
+            result.push_back('\n');
+        }
+        return result;
+    }
+
+private:
+    std::atomic<bool> _started;
+
+    std::mutex _thread_lock;
+    std::thread _thread;
+    bool _installed;
+
+    std::unique_ptr<Sample[]> _slots;
+
+    std::mutex _stacks_lock;
+    std::map<std::vector<void*>, uint64_t> _stacks;
+    std::atomic<uint64_t> _samples;
+    std::atomic<uint64_t> _dropped;
+
+    std::mutex _stop_lock;
+    std::condition_variable _stop_cv;
+    bool _stop;
+
+    void Run()
+    {
+        for (;;)
+        {
+            {
+                std::unique_lock<std::mutex> locker(_stop_lock);
+                if (_stop_cv.wait_for(locker, std::chrono::milliseconds(100), [this]() { return _stop; }))
+                    return;
+            }
+
+            Drain();
+        }
+    }
+
+    void StopThread()
+    {
+        {
+            std::scoped_lock stop_locker(_stop_lock);
+            _stop = true;
+        }
+        _stop_cv.notify_one();
+        if (_thread.joinable())
+            _thread.join();
+    }
+
+    void Drain()
+    {
+        std::scoped_lock locker(_stacks_lock);
+
+        for (size_t i = 0; i <= samples_mask.load(std::memory_order_relaxed); ++i)
+        {
+            Sample& sample = _slots[i];
+            if (sample.state.load(std::memory_order_acquire) != SLOT_READY)
+                continue;
+
+            if (sample.count > 0)
+            {
+                _stacks[std::vector<void*>(sample.frames, sample.frames + sample.count)]++;
+                _samples.fetch_add(1, std::memory_order_relaxed);
+            }
+
+            sample.state.store(SLOT_EMPTY, std::memory_order_release);
+        }
+
+        _dropped.fetch_add(samples_dropped.exchange(0, std::memory_order_relaxed), std::memory_order_relaxed);
+    }
+
+    static std::string FrameName(const StackTrace::Frame& frame)
+    {
+        std::string name;
+        if (!frame.function.empty())
+            name = frame.function;
+        else
+        {
+            // Unresolved frame is named by its module and address
+            char address[2 + 2 * sizeof(void*) + 1];
+            std::snprintf(address, sizeof(address), "0x%0*zx", (int)(2 * sizeof(void*)), (size_t)frame.address);
+            name = frame.module.empty() ? address : (Path(frame.module).filename().string() + "+" + address);
+        }
+
+        // Semicolons separate frames of the folded stack
+        std::replace(name.begin(), name.end(), ';', ':');
+        return name;
+    }
+};
+
+//! @endcond
+
+Profiler::Profiler() : _pimpl(std::make_unique<Impl>()) {}
+
+Profiler::~Profiler() = default;
+
+bool Profiler::IsSupported() noexcept
+{
+#if (defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)) && !defined(__CYGWIN__)
+    return true;
+#else
+    return false;
+#endif
+}
+
+bool Profiler::IsStarted() noexcept { return GetInstance()._pimpl->IsStarted(); }
+
+bool Profiler::Start(const Timespan& interval, size_t capacity) { return GetInstance()._pimpl->Start(interval, capacity); }
+bool Profiler::Stop() { return GetInstance()._pimpl->Stop(); }
+
+uint64_t Profiler::samples() noexcept { return GetInstance()._pimpl->samples(); }
+uint64_t Profiler::dropped() noexcept { return GetInstance()._pimpl->dropped(); }
+
+std::string Profiler::Folded() { return GetInstance()._pimpl->Folded(); }
+
+void Profiler::WriteFolded(const Path& path)
+{
+    std::string folded = Folded();
+    File::WriteAllText(path, folded);
+}
+
+} // namespace CppCommon
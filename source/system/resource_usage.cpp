@@ -0,0 +1,230 @@
+/*!
+    \file resource_usage.cpp
+    \brief Resource usage implementation
+    \author Ivan Shynkarenka
+    \date 15.10.2026
+    \copyright MIT License
+*/
+
+#include "system/resource_usage.h"
+
+#include "errors/exceptions.h"
+#include "time/timestamp.h"
+
+#include <cstdlib>
+
+#if defined(__APPLE__)
+#include <mach/mach.h>
+#include <pthread.h>
+#include <sys/resource.h>
+#elif defined(unix) || defined(__unix) || defined(__unix__)
+#include <sys/resource.h>
+#include <sys/time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#elif defined(_WIN32) || defined(_WIN64)
+#include <windows.h>
+#include <psapi.h>
+#endif
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+namespace Internals {
+
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+
+// Helper function to convert timeval into the timespan
+Timespan ToTimespan(const struct timeval& time) noexcept
+{
+    return Timespan((int64_t)time.tv_sec * 1000000000 + (int64_t)time.tv_usec * 1000);
+}
+
+// Helper function to fill the resource usage with getrusage() counters
+void FillResourceUsage(ResourceUsage& usage, const struct rusage& rusage) noexcept
+{
+    usage.user_time = ToTimespan(rusage.ru_utime);
+    usage.system_time = ToTimespan(rusage.ru_stime);
+    usage.minor_faults = (uint64_t)rusage.ru_minflt;
+    usage.major_faults = (uint64_t)rusage.ru_majflt;
+    usage.voluntary_switches = (uint64_t)rusage.ru_nvcsw;
+    usage.involuntary_switches = (uint64_t)rusage.ru_nivcsw;
+#if defined(__APPLE__)
+    // Apple reports the maximal resident set size in bytes
+    usage.peak_rss = (uint64_t)rusage.ru_maxrss;
+#else
+    // Other platforms report the maximal resident set size in kilobytes
+    usage.peak_rss = (uint64_t)rusage.ru_maxrss * 1024;
+#endif
+}
+
+#endif
+
+// Helper function to get the current resident set size of the process
+uint64_t CurrentRSS() noexcept
+{
+#if defined(__APPLE__)
+    mach_task_basic_info_data_t info;
+    mach_msg_type_number_t count = MACH_TASK_BASIC_INFO_COUNT;
+    if (task_info(mach_task_self(), MACH_TASK_BASIC_INFO, (task_info_t)&info, &count) != KERN_SUCCESS)
+        return 0;
+    return (uint64_t)info.resident_size;
+#elif defined(unix) || defined(__unix) || defined(__unix__)
+    // The second field of /proc/self/statm is the resident set size in pages
+    int fd = open("/proc/self/statm", O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
+        return 0;
+
+    char buffer[128];
+    ssize_t size = read(fd, buffer, sizeof(buffer) - 1);
+    close(fd);
+    if (size <= 0)
+        return 0;
+    buffer[size] = 0;
+
+    char* end = nullptr;
+    std::strtoull(buffer, &end, 10);
+    uint64_t pages = std::strtoull(end, nullptr, 10);
+    long page_size = sysconf(_SC_PAGESIZE);
+    return (page_size > 0) ? pages * (uint64_t)page_size : 0;
+#elif defined(_WIN32) || defined(_WIN64)
+    PROCESS_MEMORY_COUNTERS counters;
+    if (!GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+        return 0;
+    return (uint64_t)counters.WorkingSetSize;
+#else
+    return 0;
+#endif
+}
+
+#if defined(_WIN32) || defined(_WIN64)
+
+// Helper function to convert FILETIME in 100 nanoseconds units into the timespan
+Timespan ToTimespan(const FILETIME& time) noexcept
+{
+    ULARGE_INTEGER value;
+    value.LowPart = time.dwLowDateTime;
+    value.HighPart = time.dwHighDateTime;
+    return Timespan((int64_t)value.QuadPart * 100);
+}
+
+#endif
+
+} // namespace Internals
+//! @endcond
+
+ResourceUsage ResourceUsage::CurrentProcess()
+{
+    ResourceUsage usage;
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+    struct rusage rusage;
+    if (getrusage(RUSAGE_SELF, &rusage) != 0)
+        throwex SystemException("Cannot get the resource usage of the current process!");
+    Internals::FillResourceUsage(usage, rusage);
+    usage.rss = Internals::CurrentRSS();
+#elif defined(_WIN32) || defined(_WIN64)
+    FILETIME creation, exit, kernel, user;
+    if (!GetProcessTimes(GetCurrentProcess(), &creation, &exit, &kernel, &user))
+        throwex SystemException("Cannot get the CPU times of the current process!");
+    usage.user_time = Internals::ToTimespan(user);
+    usage.system_time = Internals::ToTimespan(kernel);
+
+    PROCESS_MEMORY_COUNTERS counters;
+    if (!GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+        throwex SystemException("Cannot get the memory counters of the current process!");
+    usage.rss = (uint64_t)counters.WorkingSetSize;
+    usage.peak_rss = (uint64_t)counters.PeakWorkingSetSize;
+    usage.minor_faults = (uint64_t)counters.PageFaultCount;
+#endif
+    return usage;
+}
+
+ResourceUsage ResourceUsage::CurrentThread()
+{
+    ResourceUsage usage;
+#if defined(__APPLE__)
+    thread_basic_info_data_t info;
+    mach_msg_type_number_t count = THREAD_BASIC_INFO_COUNT;
+    if (thread_info(pthread_mach_thread_np(pthread_self()), THREAD_BASIC_INFO, (thread_info_t)&info, &count) != KERN_SUCCESS)
+        throwex SystemException("Cannot get the resource usage of the current thread!");
+    usage.user_time = Timespan((int64_t)info.user_time.seconds * 1000000000 + (int64_t)info.user_time.microseconds * 1000);
+    usage.system_time = Timespan((int64_t)info.system_time.seconds * 1000000000 + (int64_t)info.system_time.microseconds * 1000);
+
+    struct rusage rusage;
+    if (getrusage(RUSAGE_SELF, &rusage) == 0)
+        usage.peak_rss = (uint64_t)rusage.ru_maxrss;
+    usage.rss = Internals::CurrentRSS();
+#elif defined(unix) || defined(__unix) || defined(__unix__)
+#if defined(RUSAGE_THREAD)
+    struct rusage rusage;
+    if (getrusage(RUSAGE_THREAD, &rusage) != 0)
+        throwex SystemException("Cannot get the resource usage of the current thread!");
+    Internals::FillResourceUsage(usage, rusage);
+
+    // Thread shares the resident set of the process
+    struct rusage process;
+    if (getrusage(RUSAGE_SELF, &process) == 0)
+        usage.peak_rss = (uint64_t)process.ru_maxrss * 1024;
+    usage.rss = Internals::CurrentRSS();
+#else
+    // Platform does not report the resource usage of threads
+    usage = CurrentProcess();
+#endif
+#elif defined(_WIN32) || defined(_WIN64)
+    FILETIME creation, exit, kernel, user;
+    if (!GetThreadTimes(GetCurrentThread(), &creation, &exit, &kernel, &user))
+        throwex SystemException("Cannot get the CPU times of the current thread!");
+    usage.user_time = Internals::ToTimespan(user);
+    usage.system_time = Internals::ToTimespan(kernel);
+
+    PROCESS_MEMORY_COUNTERS counters;
+    if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+    {
+        usage.rss = (uint64_t)counters.WorkingSetSize;
+        usage.peak_rss = (uint64_t)counters.PeakWorkingSetSize;
+    }
+#endif
+    return usage;
+}
+
+ResourceUsageSampler::ResourceUsageSampler(bool thread)
+    : _thread(thread),
+      _timestamp(Timestamp::nano()),
+      _total(thread ? ResourceUsage::CurrentThread() : ResourceUsage::CurrentProcess()),
+      _elapsed(0)
+{
+    _delta.rss = _total.rss;
+    _delta.peak_rss = _total.peak_rss;
+}
+
+double ResourceUsageSampler::utilization() const noexcept
+{
+    if (_elapsed.total() <= 0)
+        return 0.0;
+    return (double)_delta.cpu_time().total() / (double)_elapsed.total();
+}
+
+const ResourceUsage& ResourceUsageSampler::Sample()
+{
+    // Keep deltas non-negative if the thread sampler is misused from another thread
+    auto difference = [](uint64_t current, uint64_t previous) { return (current > previous) ? (current - previous) : 0; };
+
+    uint64_t timestamp = Timestamp::nano();
+    ResourceUsage total = _thread ? ResourceUsage::CurrentThread() : ResourceUsage::CurrentProcess();
+
+    _delta.user_time = total.user_time - _total.user_time;
+    _delta.system_time = total.system_time - _total.system_time;
+    _delta.rss = total.rss;
+    _delta.peak_rss = total.peak_rss;
+    _delta.minor_faults = difference(total.minor_faults, _total.minor_faults);
+    _delta.major_faults = difference(total.major_faults, _total.major_faults);
+    _delta.voluntary_switches = difference(total.voluntary_switches, _total.voluntary_switches);
+    _delta.involuntary_switches = difference(total.involuntary_switches, _total.involuntary_switches);
+    _elapsed = Timespan((int64_t)(timestamp - _timestamp));
+
+    _timestamp = timestamp;
+    _total = total;
+    return _delta;
+}
+
+} // namespace CppCommon
@@ -18,10 +18,23 @@
 #include <sys/mman.h>
 #include <fcntl.h>
 #include <unistd.h>
-#elif defined(_WIN32) || defined(_WIN64)
+#endif
+#if defined(linux) || defined(__linux) || defined(__linux__)
+#include <linux/mempolicy.h>
+#include <mntent.h>
+#include <sys/syscall.h>
+#include <sys/vfs.h>
+#endif
+#if defined(_WIN32) || defined(_WIN64)
 #include <windows.h>
 #endif
 
+#if defined(_WIN32) || defined(_WIN64)
+#if !defined(FILE_MAP_LARGE_PAGES)
+#define FILE_MAP_LARGE_PAGES 0x20000000
+#endif
+#endif
+
 namespace CppCommon {
 
 //! @cond INTERNALS
@@ -29,43 +42,58 @@ namespace CppCommon {
 class SharedMemory::Impl
 {
 public:
-    Impl(const std::string& name, size_t size)
+    Impl(const std::string& name, size_t size, const Flags<SharedMemoryOptions>& options, int node) : _owner(false), _huge(false), _locked(false)
     {
         assert(!name.empty() && "Shared memory buffer name must not be empty!");
         assert((size > 0) && "Shared memory buffer size must be greater than zero!");
 
         size_t total = SHARED_MEMORY_HEADER_SIZE + size;
 #if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
-        _name = "/" + name;
-        _owner = true;
-
-        // Try to create a shared memory handler
-        _shared = shm_open(_name.c_str(), (O_CREAT | O_EXCL | O_RDWR), (S_IRUSR | S_IWUSR));
-        if (_shared == -1)
+        // Pre-fault pages on mapping, bound pages are pre-faulted after the NUMA binding
+        int flags = MAP_SHARED;
+        bool populated = false;
+#if defined(MAP_POPULATE)
+        if ((options & SharedMemoryOptions::PREFAULT) && (node < 0))
         {
-            // Try to open a shared memory handler
-            _shared = shm_open(_name.c_str(), (O_CREAT | O_RDWR), (S_IRUSR | S_IWUSR));
-            if (_shared == -1)
-                throwex SystemException("Failed to create or open a shared memory handler!");
-            else
-                _owner = false;
+            flags |= MAP_POPULATE;
+            populated = true;
         }
+#endif
+
+#if defined(linux) || defined(__linux) || defined(__linux__)
+        // Try to create the shared memory in the hugetlbfs file system
+        std::string mount = (options & SharedMemoryOptions::HUGEPAGES) ? HugePagesMount() : std::string();
+        if (!mount.empty() && Map(mount + "/" + name, total, true, flags))
+            _huge = true;
         else
-        {
-            // Truncate a shared memory handler
-            int result = ftruncate(_shared, total);
-            if (result != 0)
-                throwex SystemException("Failed to truncate a shared memory handler!");
-        }
+#endif
+            Map("/" + name, total, false, flags);
 
-        // Map a shared memory buffer
-        _ptr = mmap(nullptr, total, (PROT_READ | PROT_WRITE), MAP_SHARED, _shared, 0);
-        if (_ptr == MAP_FAILED)
+#if defined(linux) || defined(__linux) || defined(__linux__)
+        // Ask for transparent huge pages if the hugetlbfs file system is not available
+        if ((options & SharedMemoryOptions::HUGEPAGES) && !_huge)
+            madvise(_ptr, _total, MADV_HUGEPAGE);
+
+        // Bind pages of the new shared memory to the NUMA node before the first touch
+        if (_owner && (node >= 0))
         {
-            close(_shared);
-            shm_unlink(_name.c_str());
-            throwex SystemException("Failed to map a shared memory buffer!");
+            // Single word node mask supports first 64 NUMA nodes
+            unsigned long mask = ((size_t)node < (sizeof(mask) * 8)) ? (1UL << node) : 0;
+            if ((mask == 0) || (syscall(SYS_mbind, _ptr, _total, MPOL_BIND, &mask, sizeof(mask) * 8, 0) != 0))
+            {
+                Unmap();
+                throwex SystemException("Failed to bind a shared memory buffer to the NUMA node!");
+            }
         }
+#endif
+
+        // Pre-fault pages which were not populated on mapping
+        if ((options & SharedMemoryOptions::PREFAULT) && !populated)
+            Touch();
+
+        // Lock pages in the physical memory
+        if (options & SharedMemoryOptions::LOCK)
+            _locked = (mlock(_ptr, _total) == 0);
 #elif defined(_WIN32) || defined(_WIN64)
         _name = "Global\\" + name;
         _owner = false;
@@ -74,8 +102,26 @@ public:
         _shared = OpenFileMappingA(FILE_MAP_ALL_ACCESS, FALSE, _name.c_str());
         if (_shared == nullptr)
         {
+            // Try to create a shared memory handler backed with large pages
+            if (options & SharedMemoryOptions::HUGEPAGES)
+            {
+                // Large pages size must be a multiple of the minimal large page
+                SIZE_T minimum = GetLargePageMinimum();
+                if (minimum > 0)
+                {
+                    size_t rounded = ((total + minimum - 1) / minimum) * minimum;
+                    _shared = CreateMapping(rounded, SEC_COMMIT | SEC_LARGE_PAGES, node);
+                    if (_shared != nullptr)
+                    {
+                        _huge = true;
+                        total = rounded;
+                    }
+                }
+            }
+
             // Try to create a shared memory handler
-            _shared = CreateFileMappingA(INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE, 0, (DWORD)total, _name.c_str());
+            if (_shared == nullptr)
+                _shared = CreateMapping(total, 0, node);
             if (_shared == nullptr)
                 throwex SystemException("Failed to create or open a shared memory handler!");
             else
@@ -83,12 +129,21 @@ public:
         }
 
         // Map a shared memory buffer
-        _ptr = MapViewOfFile(_shared, FILE_MAP_ALL_ACCESS, 0, 0, total);
+        _ptr = MapViewOfFileExNuma(_shared, FILE_MAP_ALL_ACCESS | (_huge ? FILE_MAP_LARGE_PAGES : 0), 0, 0, total, nullptr, (node >= 0) ? (DWORD)node : NUMA_NO_PREFERRED_NODE);
         if (_ptr == nullptr)
         {
             CloseHandle(_shared);
             throwex SystemException("Failed to map a shared memory buffer!");
         }
+        _total = total;
+
+        // Pre-fault pages of the mapped view
+        if (options & SharedMemoryOptions::PREFAULT)
+            Touch();
+
+        // Lock pages in the physical memory
+        if (options & SharedMemoryOptions::LOCK)
+            _locked = (VirtualLock(_ptr, _total) != 0);
 #endif
         static const char* SHARED_MEMORY_HEADER_PREFIX = "SHMM";
 
@@ -107,7 +162,7 @@ public:
             if (!is_valid_prefix || !is_valid_size)
             {
 #if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
-                munmap(_ptr, total);
+                munmap(_ptr, _total);
                 close(_shared);
 #elif defined(_WIN32) || defined(_WIN64)
                 UnmapViewOfFile(_ptr);
@@ -125,8 +180,7 @@ public:
     {
 #if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
         // Unmap the shared memory buffer
-        size_t total = ((SharedMemoryHeader*)_ptr)->size + SHARED_MEMORY_HEADER_SIZE;
-        int result = munmap(_ptr, total);
+        int result = munmap(_ptr, _total);
         if (result != 0)
             fatality(SystemException("Failed to unmap a shared memory buffer!"));
 
@@ -138,7 +192,7 @@ public:
         // Unlink the shared memory handler (owner only)
         if (_owner)
         {
-            result = shm_unlink(_name.c_str());
+            result = _huge ? unlink(_name.c_str()) : shm_unlink(_name.c_str());
             if (result != 0)
                 fatality(SystemException("Failed to unlink a shared memory handler!"));
         }
@@ -154,8 +208,10 @@ public:
     }
 
     void* ptr() { return (uint8_t*)_ptr + SHARED_MEMORY_HEADER_SIZE; }
-    const void* ptr() const { return _ptr; }
+    const void* ptr() const { return (const uint8_t*)_ptr + SHARED_MEMORY_HEADER_SIZE; }
     bool owner() const { return _owner; }
+    bool huge() const { return _huge; }
+    bool locked() const { return _locked; }
 
 private:
     // Shared memory header size
@@ -178,13 +234,147 @@ private:
 #elif defined(_WIN32) || defined(_WIN64)
     HANDLE _shared;
 #endif
-    void* _ptr;
     bool _owner;
+    bool _huge;
+    bool _locked;
+    void* _ptr;
+    size_t _total;
+
+    // Touch all pages of the mapped buffer
+    void Touch()
+    {
+        const size_t page = 4096;
+        volatile const uint8_t* data = (volatile const uint8_t*)_ptr;
+        for (size_t offset = 0; offset < _total; offset += page)
+            (void)data[offset];
+    }
+
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+    // Create or open and map the shared memory in POSIX shared memory or in the hugetlbfs file system
+    bool Map(const std::string& name, size_t total, bool huge, int flags)
+    {
+        _name = name;
+        _owner = true;
+
+        // Try to create a shared memory handler
+        _shared = huge ? open(_name.c_str(), (O_CREAT | O_EXCL | O_RDWR), (S_IRUSR | S_IWUSR)) : shm_open(_name.c_str(), (O_CREAT | O_EXCL | O_RDWR), (S_IRUSR | S_IWUSR));
+        if (_shared == -1)
+        {
+            // Try to open a shared memory handler
+            _shared = huge ? open(_name.c_str(), (O_CREAT | O_RDWR), (S_IRUSR | S_IWUSR)) : shm_open(_name.c_str(), (O_CREAT | O_RDWR), (S_IRUSR | S_IWUSR));
+            if (_shared == -1)
+            {
+                if (huge)
+                    return false;
+                throwex SystemException("Failed to create or open a shared memory handler!");
+            }
+            else
+                _owner = false;
+        }
+
+#if defined(linux) || defined(__linux) || defined(__linux__)
+        // Size of the hugetlbfs file must be a multiple of the huge page size
+        if (huge)
+        {
+            struct statfs status;
+            if ((fstatfs(_shared, &status) != 0) || (status.f_bsize <= 0))
+            {
+                Close(huge);
+                return false;
+            }
+            size_t page = (size_t)status.f_bsize;
+            total = ((total + page - 1) / page) * page;
+        }
+#endif
+        _total = total;
+
+        if (_owner)
+        {
+            // Truncate a shared memory handler
+            int result = ftruncate(_shared, total);
+            if (result != 0)
+            {
+                if (huge)
+                {
+                    Close(huge);
+                    return false;
+                }
+                throwex SystemException("Failed to truncate a shared memory handler!");
+            }
+        }
+
+        // Map a shared memory buffer (huge pages are reserved here)
+        _ptr = mmap(nullptr, total, (PROT_READ | PROT_WRITE), flags, _shared, 0);
+        if (_ptr == MAP_FAILED)
+        {
+            Close(huge);
+            if (huge)
+                return false;
+            throwex SystemException("Failed to map a shared memory buffer!");
+        }
+
+        return true;
+    }
+
+    // Close and unlink the shared memory handler of the failed mapping
+    void Close(bool huge)
+    {
+        close(_shared);
+        if (huge)
+            unlink(_name.c_str());
+        else
+            shm_unlink(_name.c_str());
+    }
+
+    // Unmap and close the shared memory of the failed initialization
+    void Unmap()
+    {
+        munmap(_ptr, _total);
+        if (_owner)
+            Close(_huge);
+        else
+            close(_shared);
+    }
+#endif
+
+#if defined(linux) || defined(__linux) || defined(__linux__)
+    // Find the mount point of the first hugetlbfs file system
+    static std::string HugePagesMount()
+    {
+        std::string result;
+        FILE* mounts = setmntent("/proc/mounts", "r");
+        if (mounts == nullptr)
+            return result;
+        struct mntent* entry;
+        while ((entry = getmntent(mounts)) != nullptr)
+        {
+            if (std::strcmp(entry->mnt_type, "hugetlbfs") == 0)
+            {
+                result = entry->mnt_dir;
+                break;
+            }
+        }
+        endmntent(mounts);
+        return result;
+    }
+#endif
+
+#if defined(_WIN32) || defined(_WIN64)
+    HANDLE CreateMapping(size_t total, DWORD attributes, int node)
+    {
+        DWORD high = (DWORD)((uint64_t)total >> 32);
+        DWORD low = (DWORD)((uint64_t)total & 0xFFFFFFFF);
+        if (node >= 0)
+            return CreateFileMappingNumaA(INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE | attributes, high, low, _name.c_str(), (DWORD)node);
+        else
+            return CreateFileMappingA(INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE | attributes, high, low, _name.c_str());
+    }
+#endif
 };
 
 //! @endcond
 
-SharedMemory::SharedMemory(const std::string& name, size_t size) : _name(name), _size(size)
+SharedMemory::SharedMemory(const std::string& name, size_t size, const Flags<SharedMemoryOptions>& options, int node) : _name(name), _size(size)
 {
     // Check implementation storage parameters
     [[maybe_unused]] ValidateAlignedStorage<sizeof(Impl), alignof(Impl), StorageSize, StorageAlign> _;
@@ -192,7 +382,7 @@ SharedMemory::SharedMemory(const std::string& name, size_t size) : _name(name),
     static_assert(((StorageAlign % alignof(Impl)) == 0), "SharedMemory::StorageAlign must be adjusted!");
 
     // Create the implementation instance
-    new(&_storage)Impl(name, size);
+    new(&_storage)Impl(name, size, options, node);
 }
 
 SharedMemory::~SharedMemory()
@@ -204,5 +394,7 @@ SharedMemory::~SharedMemory()
 void* SharedMemory::ptr() { return impl().ptr(); }
 const void* SharedMemory::ptr() const { return impl().ptr(); }
 bool SharedMemory::owner() const { return impl().owner(); }
+bool SharedMemory::huge() const { return impl().huge(); }
+bool SharedMemory::locked() const { return impl().locked(); }
 
 } // namespace CppCommon
@@ -16,9 +16,12 @@
 #include "threads/critical_section.h"
 #include "utility/countof.h"
 
+#include <algorithm>
 #include <cstring>
 #include <iomanip>
 #include <sstream>
+#include <string>
+#include <unordered_map>
 
 #if (defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)) && !defined(__CYGWIN__)
 #include <execinfo.h>
@@ -60,41 +63,138 @@ std::ostream& operator<<(std::ostream& os, const StackTrace::Frame& frame)
     return os;
 }
 
-StackTrace::StackTrace(int skip)
+//! @cond INTERNALS
+
+namespace Internals {
+
+//! Process wide symbol cache
+/*!
+    Keeps resolved symbols of frame addresses and opened modules (bfd handles
+    with loaded symbol tables) across all stack trace snapshots. All methods
+    must be called under the cache critical section.
+*/
+class SymbolCache
 {
-#if (defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)) && !defined(__CYGWIN__)
-    const int capacity = 1024;
-    void* frames[capacity];
+public:
+    SymbolCache() = default;
+    SymbolCache(const SymbolCache&) = delete;
+    SymbolCache(SymbolCache&&) = delete;
+    ~SymbolCache() { Clear(); }
 
-    // Capture the current stack trace
-    int captured = backtrace(frames, capacity);
-    int index = skip + 1;
-    int size = captured - index;
+    SymbolCache& operator=(const SymbolCache&) = delete;
+    SymbolCache& operator=(SymbolCache&&) = delete;
 
-    // Check the current stack trace size
-    if (size <= 0)
-        return;
+    static SymbolCache& GetInstance()
+    { static SymbolCache instance; return instance; }
+
+    CriticalSection& lock() noexcept { return _cs; }
 
-    // Resize stack trace frames vector
-    _frames.resize(size);
+    void Resolve(void* address, StackTrace::Frame& frame)
+    {
+        // Find the frame address in the cache
+        auto it = _symbols.find(address);
+        if (it != _symbols.end())
+        {
+            frame = it->second;
+            return;
+        }
 
-    // Capture stack trace snapshot under the critical section
-    static CriticalSection cs;
-    Locker<CriticalSection> locker(cs);
+        // Resolve symbols of the frame address
+        frame.address = address;
+        frame.line = 0;
+        ResolveFrame(frame);
 
-    // Fill all captured frames with symbol information
-    for (int i = 0; i < size; ++i)
+        // Limit the cache size with stale frame addresses of unloaded modules
+        if (_symbols.size() >= MAX_SYMBOLS)
+            _symbols.clear();
+        _symbols.emplace(address, frame);
+    }
+
+    void Clear()
     {
-        auto& frame = _frames[i];
+        _symbols.clear();
+#if defined(LIBBFD_SUPPORT)
+        for (auto& module : _modules)
+            CloseModule(module.second);
+        _modules.clear();
+#endif
+    }
+
+private:
+    static const size_t MAX_SYMBOLS = 65536;
+
+    CriticalSection _cs;
+    std::unordered_map<void*, StackTrace::Frame> _symbols;
+
+#if defined(LIBBFD_SUPPORT)
+    struct Module
+    {
+        bfd* abfd;
+        void* symsptr;
+    };
+
+    std::unordered_map<std::string, Module> _modules;
+
+    Module& OpenModule(const char* path)
+    {
+        // Find the module in the cache
+        auto it = _modules.find(path);
+        if (it != _modules.end())
+            return it->second;
+
+        // Modules without symbols are cached as well to avoid reopening them
+        Module module = { nullptr, nullptr };
+        char** matching = nullptr;
+        unsigned int symsize;
+        long symcount;
 
-        // Get the frame address
-        frame.address = frames[index + i];
+        module.abfd = bfd_openr(path, nullptr);
+        if (module.abfd == nullptr)
+            goto done;
 
+        if (bfd_check_format(module.abfd, bfd_archive))
+            goto failed;
+
+        if (!bfd_check_format_matches(module.abfd, bfd_object, &matching))
+            goto failed;
+
+        if ((bfd_get_file_flags(module.abfd) & HAS_SYMS) == 0)
+            goto failed;
+
+        symcount = bfd_read_minisymbols(module.abfd, FALSE, &module.symsptr, &symsize);
+        if (symcount == 0)
+            symcount = bfd_read_minisymbols(module.abfd, TRUE, &module.symsptr, &symsize);
+        if (symcount < 0)
+            goto failed;
+
+        goto done;
+
+failed:
+        CloseModule(module);
+done:
+        return _modules.emplace(path, module).first->second;
+    }
+
+    static void CloseModule(Module& module)
+    {
+        if (module.symsptr != nullptr)
+            free(module.symsptr);
+        module.symsptr = nullptr;
+
+        if (module.abfd != nullptr)
+            bfd_close(module.abfd);
+        module.abfd = nullptr;
+    }
+#endif
+
+    void ResolveFrame([[maybe_unused]] StackTrace::Frame& frame)
+    {
+#if (defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)) && !defined(__CYGWIN__)
 #if defined(LIBDL_SUPPORT)
         // Get the frame information
         Dl_info info;
-        if (dladdr(frames[index + i], &info) == 0)
-            continue;
+        if (dladdr(frame.address, &info) == 0)
+            return;
 
         // Get the frame module
         if (info.dli_fname != nullptr)
@@ -120,46 +220,21 @@ StackTrace::StackTrace(int skip)
         }
 #endif
 #if defined(LIBBFD_SUPPORT)
-        bfd* abfd = nullptr;
-        char** matching = nullptr;
+        if ((frame.address == nullptr) || (info.dli_fname == nullptr))
+            return;
 
-        void* symsptr = nullptr;
-        asymbol** syms = nullptr;
-        unsigned int symsize;
-        long symcount;
+        // Get the frame module with loaded symbols
+        Module& module = OpenModule(info.dli_fname);
+        if (module.abfd == nullptr)
+            return;
 
         const char* filename = nullptr;
         const char* functionname = nullptr;
-        unsigned int line;
+        unsigned int line = 0;
 
         bfd_boolean found = false;
-        bfd_vma pc;
-
-        if ((frame.address == nullptr) || (info.dli_fname == nullptr))
-            continue;
-
-        abfd = bfd_openr(info.dli_fname, nullptr);
-        if (abfd == nullptr)
-            continue;
-
-        if (bfd_check_format(abfd, bfd_archive))
-            goto cleanup;
-
-        if (!bfd_check_format_matches(abfd, bfd_object, &matching))
-            goto cleanup;
-
-        if ((bfd_get_file_flags(abfd) & HAS_SYMS) == 0)
-            goto cleanup;
-
-        symcount = bfd_read_minisymbols(abfd, FALSE, &symsptr, &symsize);
-        if (symcount == 0)
-            symcount = bfd_read_minisymbols(abfd, TRUE, &symsptr, &symsize);
-        if (symcount < 0)
-            goto cleanup;
-        syms = (asymbol**)symsptr;
-
-        pc = (bfd_vma)frame.address;
-        for (asection* section = abfd->sections; section != nullptr; section = section->next)
+        bfd_vma pc = (bfd_vma)frame.address;
+        for (asection* section = module.abfd->sections; section != nullptr; section = section->next)
         {
             if (found)
                 break;
@@ -175,46 +250,17 @@ StackTrace::StackTrace(int skip)
             if (pc >= vma + secsize)
                 continue;
 
-            found = bfd_find_nearest_line(abfd, section, syms, pc - vma, &filename, &functionname, &line);
+            found = bfd_find_nearest_line(module.abfd, section, (asymbol**)module.symsptr, pc - vma, &filename, &functionname, &line);
         }
 
         if (!found)
-            goto cleanup;
+            return;
 
         if (filename != nullptr)
             frame.filename = filename;
         frame.line = line;
-
-cleanup:
-        if (symsptr != nullptr)
-            free(symsptr);
-
-        if (abfd != nullptr)
-            bfd_close(abfd);
 #endif
-    }
 #elif defined(_WIN32) || defined(_WIN64) || defined(__CYGWIN__)
-    const int capacity = 1024;
-    void* frames[capacity];
-
-    // Capture the current stack trace
-    USHORT captured = CaptureStackBackTrace(skip + 1, capacity, frames, nullptr);
-
-    // Resize stack trace frames vector
-    _frames.resize(captured);
-
-    // Capture stack trace snapshot under the critical section
-    static CriticalSection cs;
-    Locker<CriticalSection> locker(cs);
-
-    // Fill all captured frames with symbol information
-    for (int i = 0; i < captured; ++i)
-    {
-        auto& frame = _frames[i];
-
-        // Get the frame address
-        frame.address = frames[i];
-
 #if defined(DBGHELP_SUPPORT)
         // Get the current process handle
         HANDLE hProcess = GetCurrentProcess();
@@ -255,8 +301,128 @@ cleanup:
             frame.line = line.LineNumber;
         }
 #endif
+#endif
+    }
+};
+
+} // namespace Internals
+
+//! @endcond
+
+StackTrace::StackTrace(int skip) : _resolved(false)
+{
+    const int capacity = 1024;
+    void* frames[capacity];
+
+    // Capture the current stack trace without resolving symbols
+    int captured = Capture(frames, capacity, skip + 1);
+    _addresses.assign(frames, frames + captured);
+}
+
+StackTrace::StackTrace(void* const* frames, size_t count) : _addresses(frames, frames + count), _resolved(false)
+{
+}
+
+StackTrace::StackTrace(const StackTrace& stack_trace) : _addresses(stack_trace._addresses), _resolved(false)
+{
+    // Resolved frames are never changed, so they could be copied without the lock
+    if (stack_trace.IsResolved())
+    {
+        _frames = stack_trace._frames;
+        _resolved.store(true, std::memory_order_relaxed);
+    }
+}
+
+StackTrace::StackTrace(StackTrace&& stack_trace) noexcept
+    : _addresses(std::move(stack_trace._addresses)),
+      _frames(std::move(stack_trace._frames)),
+      _resolved(stack_trace._resolved.load(std::memory_order_acquire))
+{
+    stack_trace._resolved.store(false, std::memory_order_relaxed);
+}
+
+StackTrace& StackTrace::operator=(const StackTrace& stack_trace)
+{
+    if (this != &stack_trace)
+    {
+        bool resolved = stack_trace.IsResolved();
+        _addresses = stack_trace._addresses;
+        if (resolved)
+            _frames = stack_trace._frames;
+        else
+            _frames.clear();
+        _resolved.store(resolved, std::memory_order_relaxed);
     }
+    return *this;
+}
+
+StackTrace& StackTrace::operator=(StackTrace&& stack_trace) noexcept
+{
+    if (this != &stack_trace)
+    {
+        _addresses = std::move(stack_trace._addresses);
+        _frames = std::move(stack_trace._frames);
+        _resolved.store(stack_trace._resolved.load(std::memory_order_acquire), std::memory_order_relaxed);
+        stack_trace._resolved.store(false, std::memory_order_relaxed);
+    }
+    return *this;
+}
+
+// Capture must not be inlined to skip the right count of frames
+#if defined(__GNUC__)
+__attribute__((noinline))
+#elif defined(_MSC_VER)
+__declspec(noinline)
 #endif
+int StackTrace::Capture(void** frames, int capacity, int skip) noexcept
+{
+#if (defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)) && !defined(__CYGWIN__)
+    const int buffer_capacity = 1024;
+    void* buffer[buffer_capacity];
+
+    // Capture the current stack trace
+    int captured = backtrace(buffer, buffer_capacity);
+    int index = skip + 1;
+    int size = std::min(captured - index, capacity);
+
+    // Check the current stack trace size
+    if (size <= 0)
+        return 0;
+
+    std::memcpy(frames, buffer + index, size * sizeof(void*));
+    return size;
+#elif defined(_WIN32) || defined(_WIN64) || defined(__CYGWIN__)
+    // Capture the current stack trace
+    return (int)CaptureStackBackTrace(skip + 1, (DWORD)capacity, frames, nullptr);
+#else
+    return 0;
+#endif
+}
+
+void StackTrace::Resolve() const
+{
+    auto& cache = Internals::SymbolCache::GetInstance();
+
+    // Resolve stack trace frames under the symbol cache critical section
+    Locker<CriticalSection> locker(cache.lock());
+
+    // Check for the concurrent resolving
+    if (_resolved.load(std::memory_order_relaxed))
+        return;
+
+    // Fill all captured frames with symbol information
+    _frames.resize(_addresses.size());
+    for (size_t i = 0; i < _addresses.size(); ++i)
+        cache.Resolve(_addresses[i], _frames[i]);
+
+    _resolved.store(true, std::memory_order_release);
+}
+
+void StackTrace::ClearCache()
+{
+    auto& cache = Internals::SymbolCache::GetInstance();
+    Locker<CriticalSection> locker(cache.lock());
+    cache.Clear();
 }
 
 std::ostream& operator<<(std::ostream& os, const StackTrace& stack_trace)
@@ -8,6 +8,7 @@
 
 #include "system/stack_trace_manager.h"
 
+#include "system/stack_trace.h"
 #include "utility/validate_aligned_storage.h"
 
 #if defined(_WIN32) || defined(_WIN64)
@@ -39,6 +40,9 @@ public:
         if (_initialized)
             return;
 
+        // Drop symbols resolved before the symbol handler initialization
+        StackTrace::ClearCache();
+
 #if defined(_WIN32) || defined(_WIN64)
 #if defined(DBGHELP_SUPPORT)
         // Provide required symbol options
@@ -62,6 +66,9 @@ public:
         if (!_initialized)
             return;
 
+        // Close all cached modules and drop all cached symbols
+        StackTrace::ClearCache();
+
 #if defined(_WIN32) || defined(_WIN64)
 #if defined(DBGHELP_SUPPORT)
         // Get the current process handle
@@ -9,9 +9,19 @@
 #include "system/stream.h"
 
 #include "errors/fatal.h"
+#include "string/format.h"
+#include "threads/thread.h"
+#include "time/timestamp.h"
 #include "utility/validate_aligned_storage.h"
 
+#include <algorithm>
+#include <atomic>
 #include <cassert>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
 
 #if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
 #include <stdio.h>
@@ -22,6 +32,234 @@
 namespace CppCommon {
 
 //! @cond INTERNALS
+namespace Internals {
+
+class StdStreamBuffer
+{
+public:
+    StdStreamBuffer(void* stream, const char* name, const StdStreamBuffering& buffering)
+        : _stream(stream), _name(name),
+          _capacity(std::max(buffering.size, (size_t)1)),
+          _interval(std::max(buffering.interval.total(), (int64_t)0)),
+          _backpressure(buffering.backpressure),
+          _flusher(buffering.flusher),
+          _stop(false), _flushing(false), _waiters(0), _timestamp(0), _dropped(0)
+    {
+        _front.reserve(_capacity);
+        _back.reserve(_capacity);
+
+        // Start the background flusher thread
+        if (_flusher)
+            _thread = Thread::Start([this]() { Run(); });
+    }
+
+    ~StdStreamBuffer()
+    {
+        // Stop the background flusher thread
+        if (_thread.joinable())
+        {
+            {
+                std::scoped_lock locker(_lock);
+                _stop = true;
+            }
+            _flusher_cv.notify_one();
+            _thread.join();
+        }
+
+        // Flush the rest of the buffered data
+        std::unique_lock<std::mutex> locker(_lock);
+        size_t pending = _front.size();
+        try
+        {
+            Flush(locker);
+        }
+        catch (const SystemException&)
+        {
+            _dropped.fetch_add(pending, std::memory_order_relaxed);
+        }
+    }
+
+    uint64_t dropped() const noexcept { return _dropped.load(std::memory_order_relaxed); }
+
+    size_t WriteV(std::span<const Writer::WriteBuffer> buffers)
+    {
+        size_t size = 0;
+        for (size_t i = 0; i < buffers.size(); ++i)
+            size += buffers[i].size;
+        if (size == 0)
+            return 0;
+
+        std::unique_lock<std::mutex> locker(_lock);
+
+        // Drop the written data in case of backpressure
+        bool drop = (_flusher && (_backpressure == StdStreamBackpressure::DROP));
+
+        // Write oversized data directly after the buffered one
+        if (size > _capacity)
+        {
+            if (drop)
+            {
+                _dropped.fetch_add(size, std::memory_order_relaxed);
+                return 0;
+            }
+            Flush(locker, buffers);
+            return size;
+        }
+
+        // Wait for the free space in the buffer
+        while ((_front.size() + size) > _capacity)
+        {
+            if (drop)
+            {
+                _dropped.fetch_add(size, std::memory_order_relaxed);
+                return 0;
+            }
+            if (_flusher)
+            {
+                ++_waiters;
+                _flusher_cv.notify_one();
+                _writers_cv.wait(locker);
+                --_waiters;
+            }
+            else
+                Flush(locker);
+        }
+
+        // Copy the written data into the buffer
+        bool empty = _front.empty();
+        if (empty)
+            _timestamp = (int64_t)NanoTimestamp().total();
+        for (size_t i = 0; i < buffers.size(); ++i)
+        {
+            const uint8_t* data = (const uint8_t*)buffers[i].data;
+            _front.insert(_front.end(), data, data + buffers[i].size);
+        }
+
+        // Flush the half full buffer or the aged data
+        if (_flusher)
+        {
+            if ((_front.size() >= (_capacity / 2)) || (empty && (_interval > 0)))
+                _flusher_cv.notify_one();
+        }
+        else if ((_interval > 0) && (((int64_t)NanoTimestamp().total() - _timestamp) >= _interval))
+            Flush(locker);
+
+        return size;
+    }
+
+    void Flush()
+    {
+        std::unique_lock<std::mutex> locker(_lock);
+        Flush(locker);
+    }
+
+private:
+    void* _stream;
+    const char* _name;
+    const size_t _capacity;
+    const int64_t _interval;
+    const StdStreamBackpressure _backpressure;
+    const bool _flusher;
+
+    std::mutex _lock;
+    std::condition_variable _flusher_cv;
+    std::condition_variable _writers_cv;
+    std::thread _thread;
+    bool _stop;
+    bool _flushing;
+    size_t _waiters;
+    int64_t _timestamp;
+    std::vector<uint8_t> _front;
+    std::vector<uint8_t> _back;
+    std::atomic<uint64_t> _dropped;
+
+    void Run()
+    {
+        std::unique_lock<std::mutex> locker(_lock);
+        while (!_stop)
+        {
+            // Wait for the half full buffer, the aged data or the stop request
+            auto ready = [this]() { return (_stop || (_front.size() >= (_capacity / 2)) || ((_waiters > 0) && !_front.empty())); };
+            if (_front.empty() || (_interval == 0))
+            {
+                _flusher_cv.wait(locker, [this, &ready]() { return ready() || ((_interval > 0) && !_front.empty()); });
+                // Wait for the new buffered data to get aged
+                if (!ready())
+                    continue;
+            }
+            else
+            {
+                int64_t timeout = _timestamp + _interval - (int64_t)NanoTimestamp().total();
+                if (timeout > 0)
+                    _flusher_cv.wait_for(locker, std::chrono::nanoseconds(timeout), ready);
+            }
+
+            if (_stop || _front.empty())
+                continue;
+
+            // Stream errors should not stop the flusher thread
+            size_t pending = _front.size();
+            try
+            {
+                Flush(locker);
+            }
+            catch (const SystemException&)
+            {
+                _dropped.fetch_add(pending, std::memory_order_relaxed);
+            }
+        }
+    }
+
+    // Write the buffered data and the given buffers into the stream (must be called under the lock)
+    void Flush(std::unique_lock<std::mutex>& locker, std::span<const Writer::WriteBuffer> buffers = {})
+    {
+        // Wait for other flushes to keep the order of the written data
+        _writers_cv.wait(locker, [this]() { return !_flushing; });
+        if (_front.empty() && buffers.empty())
+            return;
+
+        std::swap(_front, _back);
+        _flushing = true;
+        _writers_cv.notify_all();
+        locker.unlock();
+
+        bool error = !Output(_back.data(), _back.size());
+        for (size_t i = 0; !error && (i < buffers.size()); ++i)
+            error = !Output(buffers[i].data, buffers[i].size);
+
+        locker.lock();
+        _back.clear();
+        _flushing = false;
+        _writers_cv.notify_all();
+
+        if (error)
+            throwex SystemException(format("Cannot write into the {}!", _name));
+    }
+
+    bool Output(const void* buffer, size_t size)
+    {
+        if (size == 0)
+            return true;
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+        FILE* stream = (FILE*)_stream;
+        size_t result = fwrite(buffer, 1, size, stream);
+        return ((result == size) && (fflush(stream) == 0));
+#elif defined(_WIN32) || defined(_WIN64)
+        const uint8_t* data = (const uint8_t*)buffer;
+        while (size > 0)
+        {
+            DWORD result;
+            if (!WriteFile((HANDLE)_stream, data, (DWORD)std::min(size, (size_t)0x7FFFFFFF), &result, nullptr))
+                return false;
+            data += result;
+            size -= result;
+        }
+        return true;
+#endif
+    }
+};
+
+} // namespace Internals
 
 class StdInput::Impl
 {
@@ -100,6 +338,11 @@ public:
 #endif
     }
 
+    Impl(const StdStreamBuffering& buffering) : Impl()
+    {
+        _buffer = std::make_unique<Internals::StdStreamBuffer>(_stream, "standard output stream", buffering);
+    }
+
     ~Impl() = default;
 
     void* stream() const noexcept
@@ -116,11 +359,27 @@ public:
 #endif
     }
 
+    bool IsBuffered() const noexcept
+    {
+        return (_buffer != nullptr);
+    }
+
+    uint64_t dropped() const noexcept
+    {
+        return (_buffer != nullptr) ? _buffer->dropped() : 0;
+    }
+
     size_t Write(const void* buffer, size_t size)
     {
         if ((buffer == nullptr) || (size == 0))
             return 0;
 
+        if (_buffer)
+        {
+            Writer::WriteBuffer buffers[] = { { buffer, size } };
+            return _buffer->WriteV(buffers);
+        }
+
         assert(IsValid() && "Standard output stream is not valid!");
         if (!IsValid())
             throwex SystemException("Cannot write into the invalid standard output stream!");
@@ -137,8 +396,49 @@ public:
 #endif
     }
 
+    size_t WriteV(std::span<const Writer::WriteBuffer> buffers)
+    {
+        assert(IsValid() && "Standard standard output stream is not valid!");
+        if (!IsValid())
+            throwex SystemException("Cannot write into the invalid standard output stream!");
+
+        if (_buffer)
+            return _buffer->WriteV(buffers);
+
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+        // Lock the stream once, so buffers are not interleaved with other threads output
+        size_t result = 0;
+        flockfile(_stream);
+        for (size_t i = 0; i < buffers.size(); ++i)
+        {
+            size_t size = (buffers[i].size > 0) ? fwrite(buffers[i].data, 1, buffers[i].size, _stream) : 0;
+            result += size;
+            if (size < buffers[i].size)
+                break;
+        }
+        bool error = (ferror(_stream) != 0);
+        funlockfile(_stream);
+        if (error)
+            throwex SystemException("Cannot write into the standard output stream!");
+        return result;
+#elif defined(_WIN32) || defined(_WIN64)
+        size_t result = 0;
+        for (size_t i = 0; i < buffers.size(); ++i)
+        {
+            size_t size = Write(buffers[i].data, buffers[i].size);
+            result += size;
+            if (size < buffers[i].size)
+                break;
+        }
+        return result;
+#endif
+    }
+
     void Flush()
     {
+        if (_buffer)
+            _buffer->Flush();
+
 #if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
         int result = fflush(_stream);
         if (result != 0)
@@ -155,6 +455,7 @@ private:
 #elif defined(_WIN32) || defined(_WIN64)
     HANDLE _stream;
 #endif
+    std::unique_ptr<Internals::StdStreamBuffer> _buffer;
 };
 
 class StdError::Impl
@@ -173,6 +474,11 @@ public:
 #endif
     }
 
+    Impl(const StdStreamBuffering& buffering) : Impl()
+    {
+        _buffer = std::make_unique<Internals::StdStreamBuffer>(_stream, "standard error stream", buffering);
+    }
+
     ~Impl() = default;
 
     void* stream() const noexcept
@@ -189,11 +495,27 @@ public:
 #endif
     }
 
+    bool IsBuffered() const noexcept
+    {
+        return (_buffer != nullptr);
+    }
+
+    uint64_t dropped() const noexcept
+    {
+        return (_buffer != nullptr) ? _buffer->dropped() : 0;
+    }
+
     size_t Write(const void* buffer, size_t size)
     {
         if ((buffer == nullptr) || (size == 0))
             return 0;
 
+        if (_buffer)
+        {
+            Writer::WriteBuffer buffers[] = { { buffer, size } };
+            return _buffer->WriteV(buffers);
+        }
+
         assert(IsValid() && "Standard error stream is not valid!");
         if (!IsValid())
             throwex SystemException("Cannot write into the invalid standard error stream!");
@@ -210,8 +532,49 @@ public:
 #endif
     }
 
+    size_t WriteV(std::span<const Writer::WriteBuffer> buffers)
+    {
+        assert(IsValid() && "Standard standard error stream is not valid!");
+        if (!IsValid())
+            throwex SystemException("Cannot write into the invalid standard error stream!");
+
+        if (_buffer)
+            return _buffer->WriteV(buffers);
+
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+        // Lock the stream once, so buffers are not interleaved with other threads output
+        size_t result = 0;
+        flockfile(_stream);
+        for (size_t i = 0; i < buffers.size(); ++i)
+        {
+            size_t size = (buffers[i].size > 0) ? fwrite(buffers[i].data, 1, buffers[i].size, _stream) : 0;
+            result += size;
+            if (size < buffers[i].size)
+                break;
+        }
+        bool error = (ferror(_stream) != 0);
+        funlockfile(_stream);
+        if (error)
+            throwex SystemException("Cannot write into the standard error stream!");
+        return result;
+#elif defined(_WIN32) || defined(_WIN64)
+        size_t result = 0;
+        for (size_t i = 0; i < buffers.size(); ++i)
+        {
+            size_t size = Write(buffers[i].data, buffers[i].size);
+            result += size;
+            if (size < buffers[i].size)
+                break;
+        }
+        return result;
+#endif
+    }
+
     void Flush()
     {
+        if (_buffer)
+            _buffer->Flush();
+
 #if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
         int result = fflush(_stream);
         if (result != 0)
@@ -228,6 +591,7 @@ private:
 #elif defined(_WIN32) || defined(_WIN64)
     HANDLE _stream;
 #endif
+    std::unique_ptr<Internals::StdStreamBuffer> _buffer;
 };
 
 //! @endcond
@@ -270,6 +634,17 @@ StdOutput::StdOutput()
     new(&_storage)Impl();
 }
 
+StdOutput::StdOutput(const StdStreamBuffering& buffering)
+{
+    // Check implementation storage parameters
+    [[maybe_unused]] ValidateAlignedStorage<sizeof(Impl), alignof(Impl), StorageSize, StorageAlign> _;
+    static_assert((StorageSize >= sizeof(Impl)), "StdOutput::StorageSize must be increased!");
+    static_assert(((StorageAlign % alignof(Impl)) == 0), "StdOutput::StorageAlign must be adjusted!");
+
+    // Create the implementation instance
+    new(&_storage)Impl(buffering);
+}
+
 StdOutput::~StdOutput()
 {
     // Delete the implementation instance
@@ -278,7 +653,10 @@ StdOutput::~StdOutput()
 
 void* StdOutput::stream() const noexcept { return impl().stream(); }
 bool StdOutput::IsValid() const noexcept { return impl().IsValid(); }
+bool StdOutput::IsBuffered() const noexcept { return impl().IsBuffered(); }
+uint64_t StdOutput::dropped() const noexcept { return impl().dropped(); }
 size_t StdOutput::Write(const void* buffer, size_t size) { return impl().Write(buffer, size); }
+size_t StdOutput::WriteV(std::span<const WriteBuffer> buffers) { return impl().WriteV(buffers); }
 void StdOutput::Flush() { return impl().Flush(); }
 
 void StdOutput::swap(StdOutput& stream) noexcept
@@ -298,6 +676,17 @@ StdError::StdError()
     new(&_storage)Impl();
 }
 
+StdError::StdError(const StdStreamBuffering& buffering)
+{
+    // Check implementation storage parameters
+    [[maybe_unused]] ValidateAlignedStorage<sizeof(Impl), alignof(Impl), StorageSize, StorageAlign> _;
+    static_assert((StorageSize >= sizeof(Impl)), "StdError::StorageSize must be increased!");
+    static_assert(((StorageAlign % alignof(Impl)) == 0), "StdError::StorageAlign must be adjusted!");
+
+    // Create the implementation instance
+    new(&_storage)Impl(buffering);
+}
+
 StdError::~StdError()
 {
     // Delete the implementation instance
@@ -306,7 +695,10 @@ StdError::~StdError()
 
 void* StdError::stream() const noexcept { return impl().stream(); }
 bool StdError::IsValid() const noexcept { return impl().IsValid(); }
+bool StdError::IsBuffered() const noexcept { return impl().IsBuffered(); }
+uint64_t StdError::dropped() const noexcept { return impl().dropped(); }
 size_t StdError::Write(const void* buffer, size_t size) { return impl().Write(buffer, size); }
+size_t StdError::WriteV(std::span<const WriteBuffer> buffers) { return impl().WriteV(buffers); }
 void StdError::Flush() { return impl().Flush(); }
 
 void StdError::swap(StdError& stream) noexcept
@@ -0,0 +1,372 @@
+/*!
+    \file tracer.cpp
+    \brief Scoped tracing spans implementation
+    \author Ivan Shynkarenka
+    \date 15.10.2026
+    \copyright MIT License
+*/
+
+#include "system/tracer.h"
+
+#include "filesystem/file.h"
+#include "system/process.h"
+#include "threads/thread.h"
+
+#include <cassert>
+#include <condition_variable>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+
+namespace {
+
+// Keeps the per-thread buffer alive and closes it on the thread exit
+struct TraceBufferHolder
+{
+    std::shared_ptr<Internals::TraceBuffer> buffer;
+
+    ~TraceBufferHolder()
+    {
+        if (buffer)
+            buffer->closed.store(true, std::memory_order_release);
+    }
+};
+
+thread_local TraceBufferHolder holder;
+
+// Protobuf wire format helpers for Perfetto traces
+void WriteVarint(std::string& output, uint64_t value)
+{
+    while (value >= 0x80)
+    {
+        output.push_back((char)(value | 0x80));
+        value >>= 7;
+    }
+    output.push_back((char)value);
+}
+
+void WriteVarintField(std::string& output, uint32_t field, uint64_t value)
+{
+    WriteVarint(output, ((uint64_t)field << 3) | 0);
+    WriteVarint(output, value);
+}
+
+void WriteBytesField(std::string& output, uint32_t field, const std::string& value)
+{
+    WriteVarint(output, ((uint64_t)field << 3) | 2);
+    WriteVarint(output, value.size());
+    output.append(value);
+}
+
+} // namespace
+
+class Tracer::Impl
+{
+public:
+    Impl() : _capacity(DEFAULT_CAPACITY), _format(TraceFormat::CHROME), _origin(0), _pid(0), _written(0), _dropped(0), _stop(false), _first(true) {}
+
+    ~Impl()
+    {
+        Stop();
+    }
+
+    uint64_t written() const noexcept { return _written.load(std::memory_order_relaxed); }
+    uint64_t dropped() const noexcept { return _dropped.load(std::memory_order_relaxed); }
+
+    bool Start(const Path& path, TraceFormat format, size_t capacity, const Timespan& period)
+    {
+        assert((capacity >= (2 * sizeof(TraceEvent))) && "Tracer buffer capacity must be at least two trace events!");
+        assert(((capacity & (capacity - 1)) == 0) && "Tracer buffer capacity must be a power of two!");
+
+        std::scoped_lock locker(_thread_lock);
+
+        if (_started.load(std::memory_order_relaxed))
+            return false;
+
+        // Discard spans left from the previous session
+        Drain(false);
+
+        _file = path;
+        _file.OpenOrCreate(false, true, true);
+        _format = format;
+        _period = period;
+        _origin = Timestamp::nano();
+        _pid = Process::CurrentProcessId();
+        _written.store(0, std::memory_order_relaxed);
+        _dropped.store(0, std::memory_order_relaxed);
+        _threads.clear();
+        _first = true;
+        {
+            std::scoped_lock buffers_locker(_buffers_lock);
+            _capacity = capacity;
+        }
+
+        if (_format == TraceFormat::CHROME)
+            _output.assign("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[");
+
+        _stop = false;
+        _thread = Thread::Start([this]() { Run(); });
+        _started.store(true, std::memory_order_release);
+        return true;
+    }
+
+    bool Stop()
+    {
+        std::scoped_lock locker(_thread_lock);
+
+        if (!_started.load(std::memory_order_relaxed))
+            return false;
+
+        _started.store(false, std::memory_order_release);
+        {
+            std::scoped_lock stop_locker(_stop_lock);
+            _stop = true;
+        }
+        _stop_cv.notify_one();
+        if (_thread.joinable())
+            _thread.join();
+
+        // Write all recorded spans and finish the trace file
+        Drain(true);
+        if (_format == TraceFormat::CHROME)
+            _output.append("]}\n");
+        Flush();
+        _file.Close();
+        return true;
+    }
+
+    Internals::TraceBuffer* RegisterThread()
+    {
+        if (!_started.load(std::memory_order_acquire))
+            return nullptr;
+
+        std::scoped_lock locker(_buffers_lock);
+
+        holder.buffer = std::make_shared<Internals::TraceBuffer>(_capacity, Thread::CurrentThreadId());
+        _buffers.push_back(holder.buffer);
+        return holder.buffer.get();
+    }
+
+private:
+    std::mutex _thread_lock;
+    std::thread _thread;
+
+    std::mutex _buffers_lock;
+    std::vector<std::shared_ptr<Internals::TraceBuffer>> _buffers;
+    size_t _capacity;
+
+    File _file;
+    TraceFormat _format;
+    Timespan _period;
+    uint64_t _origin;
+    uint64_t _pid;
+    std::atomic<uint64_t> _written;
+    std::atomic<uint64_t> _dropped;
+
+    std::mutex _stop_lock;
+    std::condition_variable _stop_cv;
+    bool _stop;
+
+    std::string _output;
+    std::set<uint64_t> _threads;
+    bool _first;
+
+    void Run()
+    {
+        for (;;)
+        {
+            {
+                std::unique_lock<std::mutex> locker(_stop_lock);
+                if (_stop_cv.wait_for(locker, std::chrono::nanoseconds(_period.total()), [this]() { return _stop; }))
+                    return;
+            }
+
+            Drain(true);
+            Flush();
+        }
+    }
+
+    void Drain(bool write)
+    {
+        // Copy the list of buffers to drain them without the lock
+        std::vector<std::shared_ptr<Internals::TraceBuffer>> buffers;
+        {
+            std::scoped_lock locker(_buffers_lock);
+            buffers = _buffers;
+        }
+
+        for (auto& buffer : buffers)
+        {
+            // Closed buffer is drained for the last time
+            bool closed = buffer->closed.load(std::memory_order_acquire);
+
+            TraceEvent events[64];
+            size_t size = sizeof(events);
+            while (buffer->events.Dequeue(events, size))
+            {
+                if (write)
+                    for (size_t i = 0; i < (size / sizeof(TraceEvent)); ++i)
+                        Write(events[i]);
+                size = sizeof(events);
+            }
+
+            uint64_t dropped = buffer->dropped.exchange(0, std::memory_order_relaxed);
+            if (write)
+                _dropped.fetch_add(dropped, std::memory_order_relaxed);
+
+            if (closed)
+            {
+                std::scoped_lock locker(_buffers_lock);
+                std::erase(_buffers, buffer);
+            }
+        }
+    }
+
+    void Write(const TraceEvent& event)
+    {
+        // Skip spans started before the current session
+        if (event.start < _origin)
+            return;
+
+        if (_format == TraceFormat::CHROME)
+            WriteChrome(event);
+        else
+            WritePerfetto(event);
+
+        _written.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void WriteChrome(const TraceEvent& event)
+    {
+        if (!_first)
+            _output.push_back(',');
+        _first = false;
+
+        _output.append("\n{\"name\":\"");
+        for (const char* ch = event.name; *ch != 0; ++ch)
+        {
+            if ((*ch == '"') || (*ch == '\\'))
+                _output.push_back('\\');
+            if ((unsigned char)*ch >= 0x20)
+                _output.push_back(*ch);
+        }
+        _output.append("\",\"ph\":\"X\",\"pid\":");
+        _output.append(std::to_string(_pid));
+        _output.append(",\"tid\":");
+        _output.append(std::to_string(event.thread));
+        _output.append(",\"ts\":");
+        WriteMicroseconds(event.start - _origin);
+        _output.append(",\"dur\":");
+        WriteMicroseconds((event.stop > event.start) ? (event.stop - event.start) : 0);
+        _output.push_back('}');
+    }
+
+    void WriteMicroseconds(uint64_t nanoseconds)
+    {
+        std::string fraction = std::to_string(nanoseconds % 1000);
+        _output.append(std::to_string(nanoseconds / 1000));
+        _output.push_back('.');
+        _output.append(3 - fraction.size(), '0');
+        _output.append(fraction);
+    }
+
+    void WritePerfetto(const TraceEvent& event)
+    {
+        // Perfetto protobuf field numbers
+        const uint32_t TRACE_PACKET = 1;
+        const uint32_t PACKET_TIMESTAMP = 8;
+        const uint32_t PACKET_SEQUENCE_ID = 10;
+        const uint32_t PACKET_TRACK_EVENT = 11;
+        const uint32_t PACKET_SEQUENCE_FLAGS = 13;
+        const uint32_t PACKET_TRACK_DESCRIPTOR = 60;
+        const uint32_t TRACK_UUID = 1;
+        const uint32_t TRACK_NAME = 2;
+        const uint32_t EVENT_TYPE = 9;
+        const uint32_t EVENT_TRACK_UUID = 11;
+        const uint32_t EVENT_NAME = 23;
+        const uint64_t TYPE_SLICE_BEGIN = 1;
+        const uint64_t TYPE_SLICE_END = 2;
+        const uint64_t SEQUENCE_ID = 1;
+        const uint64_t SEQ_INCREMENTAL_STATE_CLEARED = 1;
+
+        std::string packet;
+        std::string message;
+
+        // Describe the thread track before its first span (named track, because thread Id might not fit into the Perfetto thread descriptor)
+        if (_threads.insert(event.thread).second)
+        {
+            WriteVarintField(message, TRACK_UUID, event.thread + 1);
+            WriteBytesField(message, TRACK_NAME, "Thread " + std::to_string(event.thread));
+            WriteBytesField(packet, PACKET_TRACK_DESCRIPTOR, message);
+            WriteVarintField(packet, PACKET_SEQUENCE_ID, SEQUENCE_ID);
+            if (_threads.size() == 1)
+                WriteVarintField(packet, PACKET_SEQUENCE_FLAGS, SEQ_INCREMENTAL_STATE_CLEARED);
+            WriteBytesField(_output, TRACE_PACKET, packet);
+        }
+
+        // Slice begin
+        packet.clear();
+        message.clear();
+        WriteVarintField(message, EVENT_TYPE, TYPE_SLICE_BEGIN);
+        WriteVarintField(message, EVENT_TRACK_UUID, event.thread + 1);
+        WriteBytesField(message, EVENT_NAME, event.name);
+        WriteVarintField(packet, PACKET_TIMESTAMP, event.start);
+        WriteBytesField(packet, PACKET_TRACK_EVENT, message);
+        WriteVarintField(packet, PACKET_SEQUENCE_ID, SEQUENCE_ID);
+        WriteBytesField(_output, TRACE_PACKET, packet);
+
+        // Slice end
+        packet.clear();
+        message.clear();
+        WriteVarintField(message, EVENT_TYPE, TYPE_SLICE_END);
+        WriteVarintField(message, EVENT_TRACK_UUID, event.thread + 1);
+        WriteVarintField(packet, PACKET_TIMESTAMP, std::max(event.stop, event.start));
+        WriteBytesField(packet, PACKET_TRACK_EVENT, message);
+        WriteVarintField(packet, PACKET_SEQUENCE_ID, SEQUENCE_ID);
+        WriteBytesField(_output, TRACE_PACKET, packet);
+    }
+
+    void Flush()
+    {
+        if (_output.empty())
+            return;
+
+        _file.Write(_output.data(), _output.size());
+        _file.Flush();
+        _output.clear();
+    }
+};
+
+//! @endcond
+
+Tracer::Tracer() : _pimpl(std::make_unique<Impl>()) {}
+
+Tracer::~Tracer() = default;
+
+bool Tracer::Start(const Path& path, TraceFormat format, size_t capacity, const Timespan& period) { return GetInstance()._pimpl->Start(path, format, capacity, period); }
+bool Tracer::Stop() { return GetInstance()._pimpl->Stop(); }
+
+uint64_t Tracer::written() noexcept { return GetInstance()._pimpl->written(); }
+uint64_t Tracer::dropped() noexcept { return GetInstance()._pimpl->dropped(); }
+
+Internals::TraceBuffer* Tracer::RegisterThread() noexcept
+{
+    try
+    {
+        Internals::TraceBuffer* buffer = GetInstance()._pimpl->RegisterThread();
+        _buffer = buffer;
+        return buffer;
+    }
+    catch (...)
+    {
+        return nullptr;
+    }
+}
+
+} // namespace CppCommon
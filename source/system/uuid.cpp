@@ -9,34 +9,133 @@
 #include "system/uuid.h"
 
 #include "memory/memory.h"
+#include "string/encoding.h"
+#include "time/timestamp.h"
+
+#include <atomic>
+#include <cstring>
 
 #if defined(__MSYS__) || defined(_WIN32) || defined(_WIN64)
 #include <windows.h>
 #include <rpc.h>
 #elif defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+#include <pthread.h>
 #include <uuid/uuid.h>
 #endif
 
 namespace CppCommon {
 
-std::string UUID::string() const
+//! @cond INTERNALS
+namespace Internals {
+
+// Generation of random batches is changed in the child process after fork(),
+// so the child never repeats random bytes already buffered by the parent
+std::atomic<uint64_t> random_generation(0);
+
+#if !defined(__MSYS__) && !defined(_WIN32) && !defined(_WIN64)
+const int fork_handler = pthread_atfork(nullptr, nullptr, []() { random_generation.fetch_add(1, std::memory_order_relaxed); });
+#endif
+
+// Per-thread batch of random bytes from the operating system CSPRNG
+class RandomBatch
 {
-    const char* digits = "0123456789abcdef";
+public:
+    RandomBatch() : _generation(0), _index(sizeof(_buffer)) {}
+    ~RandomBatch() { std::memset(_buffer, 0, sizeof(_buffer)); }
 
-    std::string result(36, '0');
+    void Fill(uint8_t* buffer, size_t size)
+    {
+        uint64_t generation = random_generation.load(std::memory_order_relaxed);
+        if ((size > (sizeof(_buffer) - _index)) || (generation != _generation))
+        {
+            Memory::CryptoFill(_buffer, sizeof(_buffer));
+            _generation = generation;
+            _index = 0;
+        }
+
+        // Consumed bytes are erased from the batch
+        std::memcpy(buffer, _buffer + _index, size);
+        std::memset(_buffer + _index, 0, size);
+        _index += size;
+    }
+
+private:
+    uint64_t _generation;
+    size_t _index;
+    uint8_t _buffer[4096];
+};
+
+thread_local RandomBatch random_batch;
+
+// Last timestamp and counter of sortable UUIDs generated in the current thread
+thread_local uint64_t sortable_timestamp = 0;
+thread_local uint16_t sortable_counter = 0;
+
+void Randomize(std::array<uint8_t, 16>& data, uint8_t version)
+{
+    random_batch.Fill(data.data(), data.size());
+
+    // Set the version and RFC 4122 variant bits
+    data[6] = (uint8_t)((data[6] & 0x0F) | (version << 4));
+    data[8] = (uint8_t)((data[8] & 0x3F) | 0x80);
+}
+
+} // namespace Internals
+//! @endcond
+
+UUID::UUID(const std::string& uuid) : _data()
+{
+    const char* str = uuid.data();
+    size_t size = uuid.size();
+
+    // Skip braces of "{00000000-0000-0000-0000-000000000000}" string
+    if ((size == 38) && (str[0] == '{') && (str[37] == '}'))
+    {
+        ++str;
+        size -= 2;
+    }
 
-    int index = 0;
-    for (auto value : _data)
+    // Gather hex digits of the canonical string and decode them at once
+    if ((size == 36) && (str[8] == '-') && (str[13] == '-') && (str[18] == '-') && (str[23] == '-'))
     {
-        result[index++] = digits[(value >> 4) & 0x0F];
-        result[index++] = digits[(value >> 0) & 0x0F];
-        if ((index == 8) || (index == 13) || (index == 18) || (index == 23))
-            result[index++] = '-';
+        char digits[32];
+        std::memcpy(digits, str, 8);
+        std::memcpy(digits + 8, str + 9, 4);
+        std::memcpy(digits + 12, str + 14, 4);
+        std::memcpy(digits + 16, str + 19, 4);
+        std::memcpy(digits + 20, str + 24, 12);
+        if (Encoding::Base16Decode(digits, sizeof(digits), _data.data()))
+            return;
     }
 
+    *this = UUID(uuid.data(), uuid.size());
+}
+
+std::string UUID::string() const
+{
+    std::string result(36, '0');
+    ToChars(result.data());
     return result;
 }
 
+char* UUID::ToChars(char* buffer) const noexcept
+{
+    char digits[32];
+    Encoding::Base16Encode(_data.data(), _data.size(), digits, true);
+
+    // Scatter hex digits into "00000000-0000-0000-0000-000000000000" groups
+    std::memcpy(buffer, digits, 8);
+    buffer[8] = '-';
+    std::memcpy(buffer + 9, digits + 8, 4);
+    buffer[13] = '-';
+    std::memcpy(buffer + 14, digits + 12, 4);
+    buffer[18] = '-';
+    std::memcpy(buffer + 19, digits + 16, 4);
+    buffer[23] = '-';
+    std::memcpy(buffer + 24, digits + 20, 12);
+    return buffer + 36;
+}
+
 UUID UUID::Sequential()
 {
     UUID result;
@@ -96,56 +195,44 @@ UUID UUID::Sequential()
 UUID UUID::Random()
 {
     UUID result;
-#if defined(__MSYS__) || defined(_WIN32) || defined(_WIN64)
-    ::UUID uuid;
-    if (UuidCreate(&uuid) != RPC_S_OK)
-        throwex SystemException("Cannot generate random UUID!");
-
-    result._data[0] = (uuid.Data1 >> 24) & 0xFF;
-    result._data[1] = (uuid.Data1 >> 16) & 0xFF;
-    result._data[2] = (uuid.Data1 >>  8) & 0xFF;
-    result._data[3] = (uuid.Data1 >>  0) & 0xFF;
-
-    result._data[4] = (uuid.Data2 >>  8) & 0xFF;
-    result._data[5] = (uuid.Data2 >>  0) & 0xFF;
-
-    result._data[6] = (uuid.Data3 >>  8) & 0xFF;
-    result._data[7] = (uuid.Data3 >>  0) & 0xFF;
-
-    result._data[8] = uuid.Data4[0];
-    result._data[9] = uuid.Data4[1];
-
-    result._data[10] = uuid.Data4[2];
-    result._data[11] = uuid.Data4[3];
-    result._data[12] = uuid.Data4[4];
-    result._data[13] = uuid.Data4[5];
-    result._data[14] = uuid.Data4[6];
-    result._data[15] = uuid.Data4[7];
-#elif defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
-    uuid_t uuid;
-    uuid_generate_random(uuid);
-
-    result._data[0] = uuid[0];
-    result._data[1] = uuid[1];
-    result._data[2] = uuid[2];
-    result._data[3] = uuid[3];
+    Internals::Randomize(result._data, 4);
+    return result;
+}
 
-    result._data[4] = uuid[4];
-    result._data[5] = uuid[5];
+void UUID::Random(UUID* uuids, size_t count)
+{
+    for (size_t i = 0; i < count; ++i)
+        Internals::Randomize(uuids[i]._data, 4);
+}
 
-    result._data[6] = uuid[6];
-    result._data[7] = uuid[7];
+UUID UUID::Sortable()
+{
+    UUID result;
+    Internals::Randomize(result._data, 7);
 
-    result._data[8] = uuid[8];
-    result._data[9] = uuid[9];
+    uint64_t timestamp = Timestamp::utc() / 1000000;
+    if (timestamp > Internals::sortable_timestamp)
+    {
+        // Start the new millisecond with the random counter leaving a half of its range for increments
+        Internals::sortable_timestamp = timestamp;
+        Internals::sortable_counter = (uint16_t)(((result._data[6] << 8) | result._data[7]) & 0x07FF);
+    }
+    else if (++Internals::sortable_counter > 0x0FFF)
+    {
+        // Counter is overflowed or the clock goes back, so borrow the next millisecond
+        ++Internals::sortable_timestamp;
+        Internals::sortable_counter = 0;
+    }
 
-    result._data[10] = uuid[10];
-    result._data[11] = uuid[11];
-    result._data[12] = uuid[12];
-    result._data[13] = uuid[13];
-    result._data[14] = uuid[14];
-    result._data[15] = uuid[15];
-#endif
+    timestamp = Internals::sortable_timestamp;
+    result._data[0] = (uint8_t)(timestamp >> 40);
+    result._data[1] = (uint8_t)(timestamp >> 32);
+    result._data[2] = (uint8_t)(timestamp >> 24);
+    result._data[3] = (uint8_t)(timestamp >> 16);
+    result._data[4] = (uint8_t)(timestamp >> 8);
+    result._data[5] = (uint8_t)(timestamp >> 0);
+    result._data[6] = (uint8_t)(0x70 | ((Internals::sortable_counter >> 8) & 0x0F));
+    result._data[7] = (uint8_t)(Internals::sortable_counter & 0xFF);
     return result;
 }
 
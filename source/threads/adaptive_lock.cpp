@@ -0,0 +1,97 @@
+/*!
+    \file adaptive_lock.cpp
+    \brief Adaptive spin-then-park lock synchronization primitive implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "threads/adaptive_lock.h"
+
+#include <algorithm>
+#include <limits>
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+
+namespace Internals {
+
+// Calibrate nanoseconds per CPU relax instruction (scaled by 1024)
+uint64_t CalibrateRelax()
+{
+    const uint64_t iterations = 10000;
+
+    uint64_t start = Timestamp::nano();
+    for (uint64_t i = 0; i < iterations; ++i)
+        WaitStrategy::Relax();
+    uint64_t finish = Timestamp::nano();
+
+    return std::max((((finish - start) * 1024) / iterations), (uint64_t)1);
+}
+
+} // namespace Internals
+
+//! @endcond
+
+AdaptiveLock::AdaptiveLock(const Timespan& spin)
+    : _state(UNLOCKED), _spins(CalibrateSpins(spin)), _contentions(0), _spinned(0), _parks(0)
+{
+}
+
+uint32_t AdaptiveLock::CalibrateSpins(const Timespan& spin)
+{
+    static const uint64_t relax = Internals::CalibrateRelax();
+
+    if (spin.total() <= 0)
+        return 0;
+
+    uint64_t spins = ((uint64_t)spin.total() * 1024) / relax;
+    return (uint32_t)std::min(spins, (uint64_t)std::numeric_limits<uint32_t>::max());
+}
+
+bool AdaptiveLock::TryLockFor(const Timespan& timespan)
+{
+    // Try to acquire adaptive lock at least one time
+    if (TryLock())
+        return true;
+
+    // Calculate a finish timestamp
+    Timestamp finish = NanoTimestamp() + timespan;
+
+    // Spin for the spin budget
+    if (Spin(_spins))
+        return true;
+
+    // Yield until the finish timestamp
+    while (NanoTimestamp() < finish)
+    {
+        if (TryLock())
+            return true;
+        Thread::Yield();
+    }
+
+    // Failed to acquire adaptive lock
+    return false;
+}
+
+void AdaptiveLock::LockSlow() noexcept
+{
+    _contentions.fetch_add(1, std::memory_order_relaxed);
+
+    // Spin with exponential backoff
+    if (Spin(_spins))
+    {
+        _spinned.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    // Mark the lock as contended and park until the lock is released
+    while (_state.exchange(CONTENDED, std::memory_order_acquire) != UNLOCKED)
+    {
+        _parks.fetch_add(1, std::memory_order_relaxed);
+        WaitStrategy::Park(_state, CONTENDED);
+    }
+}
+
+} // namespace CppCommon
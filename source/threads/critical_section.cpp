@@ -126,7 +126,14 @@ CriticalSection::~CriticalSection()
 
 void* CriticalSection::native() noexcept { return impl().native(); }
 
-bool CriticalSection::TryLock() { return impl().TryLock(); }
+bool CriticalSection::TryLock()
+{
+    if (impl().TryLock())
+        return true;
+
+    CPPCOMMON_INSTRUMENT(_instrumentation, CONTENDED, 1);
+    return false;
+}
 
 bool CriticalSection::TryLockFor(const Timespan& timespan)
 {
@@ -141,7 +148,8 @@ bool CriticalSection::TryLockFor(const Timespan& timespan)
         // Try lock or yield for the given timespan
         while (NanoTimestamp() < finish)
         {
-            if (TryLock())
+            CPPCOMMON_INSTRUMENT(_instrumentation, SPINS, 1);
+            if (impl().TryLock())
                 return true;
             else
                 Thread::Yield();
@@ -152,7 +160,18 @@ bool CriticalSection::TryLockFor(const Timespan& timespan)
     }
 }
 
-void CriticalSection::Lock() { impl().Lock(); }
+void CriticalSection::Lock()
+{
+#if defined(CPPCOMMON_INSTRUMENTATION)
+    // Count the contended acquisition before the blocking one
+    if (impl().TryLock())
+        return;
+    CPPCOMMON_INSTRUMENT(_instrumentation, CONTENDED, 1);
+#endif
+
+    impl().Lock();
+}
+
 void CriticalSection::Unlock() { impl().Unlock(); }
 
 } // namespace CppCommon
@@ -0,0 +1,138 @@
+/*!
+    \file distributed_rw_lock.cpp
+    \brief Distributed read/write lock synchronization primitive implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "threads/distributed_rw_lock.h"
+
+#include "system/cpu.h"
+#include "threads/thread.h"
+
+#include <algorithm>
+
+namespace CppCommon {
+
+DistributedRWLock::DistributedRWLock(size_t slots)
+    : _writer(false), _slots_mask(0)
+{
+    if (slots == 0)
+        slots = (size_t)std::max(CPU::LogicalCores(), 1);
+
+    // Round up slots count to the power of two
+    size_t count = 1;
+    while (count < slots)
+        count <<= 1;
+
+    _slots_mask = count - 1;
+    _slots = std::make_unique<Slot[]>(count);
+}
+
+size_t DistributedRWLock::CurrentThreadSlot() noexcept
+{
+    // Threads are assigned to reader slots in round-robin order of their first read lock
+    static std::atomic<size_t> sequence(0);
+    thread_local size_t slot = sequence.fetch_add(1, std::memory_order_relaxed);
+    return slot;
+}
+
+bool DistributedRWLock::Drained() const noexcept
+{
+    for (size_t i = 0; i <= _slots_mask; ++i)
+        if (_slots[i].readers.load(std::memory_order_acquire) != 0)
+            return false;
+    return true;
+}
+
+void DistributedRWLock::ReleaseWriter() noexcept
+{
+    _writer.store(false, std::memory_order_release);
+    _wait.Notify();
+}
+
+bool DistributedRWLock::TryLockWrite() noexcept
+{
+    if (!_writers.TryLock())
+        return false;
+
+    // Raise the writer flag before the slots scan (pairs with the reader registration)
+    _writer.store(true, std::memory_order_seq_cst);
+    if (Drained())
+        return true;
+
+    ReleaseWriter();
+    _writers.Unlock();
+    return false;
+}
+
+bool DistributedRWLock::TryLockReadFor(const Timespan& timespan)
+{
+    // Try to acquire read lock at least one time
+    if (TryLockRead())
+        return true;
+
+    // Calculate a finish timestamp
+    Timestamp finish = NanoTimestamp() + timespan;
+
+    // Yield until the finish timestamp
+    while (NanoTimestamp() < finish)
+    {
+        if (!_writer.load(std::memory_order_acquire) && TryLockRead())
+            return true;
+        Thread::Yield();
+    }
+
+    // Failed to acquire read lock
+    return false;
+}
+
+bool DistributedRWLock::TryLockWriteFor(const Timespan& timespan)
+{
+    // Calculate a finish timestamp
+    Timestamp finish = NanoTimestamp() + timespan;
+
+    if (!_writers.TryLockFor(timespan))
+        return false;
+
+    // Raise the writer flag and wait for active readers until the finish timestamp
+    _writer.store(true, std::memory_order_seq_cst);
+    do
+    {
+        if (Drained())
+            return true;
+        Thread::Yield();
+    } while (NanoTimestamp() < finish);
+
+    if (Drained())
+        return true;
+
+    // Failed to acquire write lock
+    ReleaseWriter();
+    _writers.Unlock();
+    return false;
+}
+
+void DistributedRWLock::LockWrite()
+{
+    _writers.Lock();
+
+    // Raise the writer flag and wait for active readers
+    _writer.store(true, std::memory_order_seq_cst);
+    for (uint32_t spin = 0; !Drained(); ++spin)
+    {
+        if (spin < 128)
+            WaitStrategy::Relax();
+        else
+            Thread::Yield();
+    }
+}
+
+void DistributedRWLock::UnlockWrite() noexcept
+{
+    ReleaseWriter();
+    _writers.Unlock();
+}
+
+} // namespace CppCommon
@@ -0,0 +1,127 @@
+/*!
+    \file epoch_reclamation.cpp
+    \brief Epoch-based memory reclamation implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "threads/epoch_reclamation.h"
+
+#include "system/cpu.h"
+#include "threads/thread.h"
+#include "threads/wait_strategy.h"
+
+#include <algorithm>
+
+namespace CppCommon {
+
+EpochReclamation::EpochReclamation(size_t slots, size_t threshold)
+    : _epoch(2), _limbo(nullptr), _retired(0), _reclaimed(0), _slots_mask(0), _threshold(std::max(threshold, (size_t)1))
+{
+    if (slots == 0)
+        slots = (size_t)std::max(CPU::LogicalCores(), 1);
+
+    // Round up slots count to the power of two
+    size_t count = 1;
+    while (count < slots)
+        count <<= 1;
+
+    _slots_mask = count - 1;
+    _slots = std::make_unique<Slot[]>(count);
+}
+
+EpochReclamation::~EpochReclamation()
+{
+    // Delete all retired nodes, there must be no readers at this point
+    Retired* node = _limbo.exchange(nullptr, std::memory_order_acquire);
+    while (node != nullptr)
+    {
+        Retired* next = node->next;
+        node->deleter();
+        delete node;
+        node = next;
+    }
+}
+
+size_t EpochReclamation::CurrentThreadSlot() noexcept
+{
+    // Threads are assigned to reader slots in round-robin order of their first critical section
+    static std::atomic<size_t> sequence(0);
+    thread_local size_t slot = sequence.fetch_add(1, std::memory_order_relaxed);
+    return slot;
+}
+
+void EpochReclamation::Push(Retired* node) noexcept
+{
+    Retired* head = _limbo.load(std::memory_order_relaxed);
+    do
+    {
+        node->next = head;
+    } while (!_limbo.compare_exchange_weak(head, node, std::memory_order_release, std::memory_order_relaxed));
+}
+
+bool EpochReclamation::TryAdvance() noexcept
+{
+    uint64_t epoch = _epoch.load(std::memory_order_seq_cst);
+
+    // Readers of the previous epoch must leave before its parity is reused by the next epoch
+    size_t parity = (size_t)((epoch - 1) & 1);
+    for (size_t i = 0; i <= _slots_mask; ++i)
+        if (_slots[i].readers[parity].load(std::memory_order_seq_cst) != 0)
+            return false;
+
+    // Another thread could advance the epoch concurrently
+    _epoch.compare_exchange_strong(epoch, epoch + 1, std::memory_order_seq_cst);
+    return true;
+}
+
+size_t EpochReclamation::Collect(uint64_t epoch)
+{
+    size_t result = 0;
+
+    // Take the whole limbo stack, delete safe nodes and push others back
+    Retired* node = _limbo.exchange(nullptr, std::memory_order_acquire);
+    while (node != nullptr)
+    {
+        Retired* next = node->next;
+        if ((node->epoch + 2) <= epoch)
+        {
+            node->deleter();
+            delete node;
+            ++result;
+        }
+        else
+            Push(node);
+        node = next;
+    }
+
+    _reclaimed.fetch_add(result, std::memory_order_relaxed);
+    return result;
+}
+
+size_t EpochReclamation::Reclaim()
+{
+    TryAdvance();
+    return Collect(_epoch.load(std::memory_order_seq_cst));
+}
+
+void EpochReclamation::Synchronize()
+{
+    // Nodes retired before the call are safe to delete two epochs later
+    uint64_t target = _epoch.load(std::memory_order_seq_cst) + 2;
+    for (uint32_t spin = 0; _epoch.load(std::memory_order_seq_cst) < target; ++spin)
+    {
+        if (!TryAdvance())
+        {
+            if (spin < 128)
+                WaitStrategy::Relax();
+            else
+                Thread::Yield();
+        }
+    }
+
+    Collect(_epoch.load(std::memory_order_seq_cst));
+}
+
+} // namespace CppCommon
@@ -8,19 +8,9 @@
 
 #include "threads/event_auto_reset.h"
 
-#include "errors/fatal.h"
+#include "threads/wait_strategy.h"
 #include "utility/validate_aligned_storage.h"
 
-#include <algorithm>
-
-#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
-#include <pthread.h>
-#elif defined(_WIN32) || defined(_WIN64)
-#include <windows.h>
-#undef max
-#undef min
-#endif
-
 namespace CppCommon {
 
 //! @cond INTERNALS
@@ -28,141 +18,63 @@ namespace CppCommon {
 class EventAutoReset::Impl
 {
 public:
-    Impl(bool signaled)
-    {
-#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
-        int result = pthread_mutex_init(&_mutex, nullptr);
-        if (result != 0)
-            throwex SystemException("Failed to initialize a mutex for the auto-reset event!", result);
-        result = pthread_cond_init(&_cond, nullptr);
-        if (result != 0)
-            throwex SystemException("Failed to initialize a conditional variable for the auto-reset event!", result);
-        _signaled = signaled ? 1 : 0;
-#elif defined(_WIN32) || defined(_WIN64)
-        _event = CreateEvent(nullptr, FALSE, signaled ? TRUE : FALSE, nullptr);
-        if (_event == nullptr)
-            throwex SystemException("Failed to create an auto-reset event!");
-#endif
-    }
-
-    ~Impl()
-    {
-#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
-        int result = pthread_mutex_destroy(&_mutex);
-        if (result != 0)
-            fatality(SystemException("Failed to destroy a mutex for the auto-reset event!", result));
-        result = pthread_cond_destroy(&_cond);
-        if (result != 0)
-            fatality(SystemException("Failed to destroy a conditional variable for the auto-reset event!", result));
-#elif defined(_WIN32) || defined(_WIN64)
-        if (!CloseHandle(_event))
-            fatality(SystemException("Failed to close an auto-reset event!"));
-#endif
-    }
+    Impl(bool signaled) : _signaled(signaled ? 1 : 0), _waiters(0) {}
 
     void Signal()
     {
-#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
-        int result = pthread_mutex_lock(&_mutex);
-        if (result != 0)
-            throwex SystemException("Failed to lock a mutex for the auto-reset event!", result);
-        ++_signaled;
-        result = pthread_mutex_unlock(&_mutex);
-        if (result != 0)
-            throwex SystemException("Failed to unlock a mutex for the auto-reset event!", result);
-        result = pthread_cond_signal(&_cond);
-        if (result != 0)
-            throwex SystemException("Failed to signal an auto-reset event!", result);
-#elif defined(_WIN32) || defined(_WIN64)
-        if (!SetEvent(_event))
-            throwex SystemException("Failed to signal an auto-reset event!");
-#endif
+        // Order the signal before the waiters check (pairs with the waiter registration)
+        _signaled.fetch_add(1, std::memory_order_seq_cst);
+        if (_waiters.load(std::memory_order_seq_cst) > 0)
+            WaitStrategy::WakeOne(_signaled);
     }
 
     bool TryWait()
     {
-#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
-        int result = pthread_mutex_lock(&_mutex);
-        if (result != 0)
-            throwex SystemException("Failed to lock a mutex for the auto-reset event!", result);
-        bool signaled = (_signaled-- > 0);
-        _signaled = (_signaled < 0) ? 0 : _signaled;
-        result = pthread_mutex_unlock(&_mutex);
-        if (result != 0)
-            throwex SystemException("Failed to unlock a mutex for the auto-reset event!", result);
-        return signaled;
-#elif defined(_WIN32) || defined(_WIN64)
-        DWORD result = WaitForSingleObject(_event, 0);
-        if ((result != WAIT_OBJECT_0) && (result != WAIT_TIMEOUT))
-            throwex SystemException("Failed to try lock an auto-reset event!");
-        return (result == WAIT_OBJECT_0);
-#endif
+        // Uncontended wait is a single CAS in the user space
+        uint32_t signaled = _signaled.load(std::memory_order_relaxed);
+        while (signaled > 0)
+            if (_signaled.compare_exchange_weak(signaled, signaled - 1, std::memory_order_acquire, std::memory_order_relaxed))
+                return true;
+        return false;
     }
 
     bool TryWaitFor(const Timespan& timespan)
     {
-        if (timespan < 0)
-            return TryWait();
-#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
-        struct timespec timeout;
-        timeout.tv_sec = timespan.seconds();
-        timeout.tv_nsec = timespan.nanoseconds() % 1000000000;
-        int result = pthread_mutex_lock(&_mutex);
-        if (result != 0)
-            throwex SystemException("Failed to lock a mutex for the auto-reset event!", result);
-        bool signaled = true;
-        while (!_signaled)
+        if (TryWait())
+            return true;
+        if (timespan <= 0)
+            return false;
+
+        // Wait for the signal until the deadline
+        Timestamp deadline = NanoTimestamp() + timespan;
+        _waiters.fetch_add(1, std::memory_order_seq_cst);
+        bool signaled = false;
+        while (!(signaled = TryWait()))
         {
-            result = pthread_cond_timedwait(&_cond, &_mutex, &timeout);
-            if ((result != 0) && (result != ETIMEDOUT))
-                throwex SystemException("Failed to timeout waiting a conditional variable for the auto-reset event!", result);
-            if (result == ETIMEDOUT)
-                signaled = (_signaled > 0);
+            Timestamp current = NanoTimestamp();
+            if (current >= deadline)
+                break;
+            WaitStrategy::ParkFor(_signaled, 0, deadline - current);
         }
-        _signaled = (_signaled > 0) ? (_signaled - 1) : 0;
-        result = pthread_mutex_unlock(&_mutex);
-        if (result != 0)
-            throwex SystemException("Failed to unlock a mutex for the auto-reset event!", result);
+        _waiters.fetch_sub(1, std::memory_order_relaxed);
         return signaled;
-#elif defined(_WIN32) || defined(_WIN64)
-        DWORD result = WaitForSingleObject(_event, std::max((DWORD)1, (DWORD)timespan.milliseconds()));
-        if ((result != WAIT_OBJECT_0) && (result != WAIT_TIMEOUT))
-            throwex SystemException("Failed to try lock an auto-reset event for the given timeout!");
-        return (result == WAIT_OBJECT_0);
-#endif
     }
 
     void Wait()
     {
-#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
-        int result = pthread_mutex_lock(&_mutex);
-        if (result != 0)
-            throwex SystemException("Failed to lock a mutex for the auto-reset event!", result);
-        while (!_signaled)
-        {
-            result = pthread_cond_wait(&_cond, &_mutex);
-            if (result != 0)
-                throwex SystemException("Failed to waiting a conditional variable for the auto-reset event!", result);
-        }
-        _signaled = (_signaled > 0) ? (_signaled - 1) : 0;
-        result = pthread_mutex_unlock(&_mutex);
-        if (result != 0)
-            throwex SystemException("Failed to unlock a mutex for the auto-reset event!", result);
-#elif defined(_WIN32) || defined(_WIN64)
-        DWORD result = WaitForSingleObject(_event, INFINITE);
-        if (result != WAIT_OBJECT_0)
-            throwex SystemException("Failed to lock an auto-reset event!");
-#endif
+        if (TryWait())
+            return;
+
+        // Wait for the signal
+        _waiters.fetch_add(1, std::memory_order_seq_cst);
+        while (!TryWait())
+            WaitStrategy::Park(_signaled, 0);
+        _waiters.fetch_sub(1, std::memory_order_relaxed);
     }
 
 private:
-#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
-    pthread_mutex_t _mutex;
-    pthread_cond_t _cond;
-    int _signaled;
-#elif defined(_WIN32) || defined(_WIN64)
-    HANDLE _event;
-#endif
+    std::atomic<uint32_t> _signaled;
+    std::atomic<uint32_t> _waiters;
 };
 
 //! @endcond
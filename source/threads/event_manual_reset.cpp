@@ -8,19 +8,9 @@
 
 #include "threads/event_manual_reset.h"
 
-#include "errors/fatal.h"
+#include "threads/wait_strategy.h"
 #include "utility/validate_aligned_storage.h"
 
-#include <algorithm>
-
-#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
-#include <pthread.h>
-#elif defined(_WIN32) || defined(_WIN64)
-#include <windows.h>
-#undef max
-#undef min
-#endif
-
 namespace CppCommon {
 
 //! @cond INTERNALS
@@ -28,154 +18,70 @@ namespace CppCommon {
 class EventManualReset::Impl
 {
 public:
-    Impl(bool signaled)
-    {
-#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
-        int result = pthread_mutex_init(&_mutex, nullptr);
-        if (result != 0)
-            throwex SystemException("Failed to initialize a mutex for the manual-reset event!", result);
-        result = pthread_cond_init(&_cond, nullptr);
-        if (result != 0)
-            throwex SystemException("Failed to initialize a conditional variable for the manual-reset event!", result);
-        _signaled = signaled;
-#elif defined(_WIN32) || defined(_WIN64)
-        _event = CreateEvent(nullptr, TRUE, signaled ? TRUE : FALSE, nullptr);
-        if (_event == nullptr)
-            throwex SystemException("Failed to create a manual-reset event!");
-#endif
-    }
-
-    ~Impl()
-    {
-#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
-        int result = pthread_mutex_destroy(&_mutex);
-        if (result != 0)
-            fatality(SystemException("Failed to destroy a mutex for the manual-reset event!", result));
-        result = pthread_cond_destroy(&_cond);
-        if (result != 0)
-            fatality(SystemException("Failed to destroy a conditional variable for the manual-reset event!", result));
-#elif defined(_WIN32) || defined(_WIN64)
-        if (!CloseHandle(_event))
-            fatality(SystemException("Failed to close a manual-reset event!"));
-#endif
-    }
+    Impl(bool signaled) : _state(signaled ? SIGNALED : RESET) {}
 
     void Reset()
     {
-#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
-        int result = pthread_mutex_lock(&_mutex);
-        if (result != 0)
-            throwex SystemException("Failed to lock a mutex for the manual-reset event!", result);
-        _signaled = false;
-        result = pthread_mutex_unlock(&_mutex);
-        if (result != 0)
-            throwex SystemException("Failed to unlock a mutex for the manual-reset event!", result);
-#elif defined(_WIN32) || defined(_WIN64)
-        if (!ResetEvent(_event))
-            throwex SystemException("Failed to reset a manual-reset event!");
-#endif
+        // Parked waiters keep waiting for the next signal
+        uint32_t state = SIGNALED;
+        _state.compare_exchange_strong(state, RESET, std::memory_order_relaxed);
     }
 
     void Signal()
     {
-#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
-        int result = pthread_mutex_lock(&_mutex);
-        if (result != 0)
-            throwex SystemException("Failed to lock a mutex for the manual-reset event!", result);
-        _signaled = true;
-        result = pthread_mutex_unlock(&_mutex);
-        if (result != 0)
-            throwex SystemException("Failed to unlock a mutex for the manual-reset event!", result);
-        result = pthread_cond_broadcast(&_cond);
-        if (result != 0)
-            throwex SystemException("Failed to signal an manual-reset event!", result);
-#elif defined(_WIN32) || defined(_WIN64)
-        if (!SetEvent(_event))
-            throwex SystemException("Failed to signal a manual-reset event!");
-#endif
+        // Wake all waiters only if some of them are parked
+        if (_state.exchange(SIGNALED, std::memory_order_release) == PARKED)
+            WaitStrategy::Wake(_state);
     }
 
     bool TryWait()
     {
-#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
-        int result = pthread_mutex_lock(&_mutex);
-        if (result != 0)
-            throwex SystemException("Failed to lock a mutex for the manual-reset event!", result);
-        bool signaled = _signaled;
-        result = pthread_mutex_unlock(&_mutex);
-        if (result != 0)
-            throwex SystemException("Failed to unlock a mutex for the manual-reset event!", result);
-        return signaled;
-#elif defined(_WIN32) || defined(_WIN64)
-        DWORD result = WaitForSingleObject(_event, 0);
-        if ((result != WAIT_OBJECT_0) && (result != WAIT_TIMEOUT))
-            throwex SystemException("Failed to try lock a manual-reset event!");
-        return (result == WAIT_OBJECT_0);
-#endif
+        return (_state.load(std::memory_order_acquire) == SIGNALED);
     }
 
     bool TryWaitFor(const Timespan& timespan)
     {
-        if (timespan < 0)
-            return TryWait();
-#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
-        struct timespec timeout;
-        timeout.tv_sec = timespan.seconds();
-        timeout.tv_nsec = timespan.nanoseconds() % 1000000000;
-        int result = pthread_mutex_lock(&_mutex);
-        if (result != 0)
-            throwex SystemException("Failed to lock a mutex for the manual-reset event!", result);
-        bool signaled = true;
-        while (!_signaled)
+        if (TryWait())
+            return true;
+        if (timespan <= 0)
+            return false;
+
+        // Wait for the signal until the deadline
+        Timestamp deadline = NanoTimestamp() + timespan;
+        while (!Register())
         {
-            result = pthread_cond_timedwait(&_cond, &_mutex, &timeout);
-            if ((result != 0) && (result != ETIMEDOUT))
-                throwex SystemException("Failed to timeout waiting a conditional variable for the manual-reset event!", result);
-            if (result == ETIMEDOUT)
-                signaled = _signaled;
+            Timestamp current = NanoTimestamp();
+            if (current >= deadline)
+                return false;
+            WaitStrategy::ParkFor(_state, PARKED, deadline - current);
         }
-        result = pthread_mutex_unlock(&_mutex);
-        if (result != 0)
-            throwex SystemException("Failed to unlock a mutex for the manual-reset event!", result);
-        return signaled;
-#elif defined(_WIN32) || defined(_WIN64)
-        DWORD result = WaitForSingleObject(_event, std::max((DWORD)1, (DWORD)timespan.milliseconds()));
-        if ((result != WAIT_OBJECT_0) && (result != WAIT_TIMEOUT))
-            throwex SystemException("Failed to try lock a manual-reset event for the given timeout!");
-        return (result == WAIT_OBJECT_0);
-#endif
+        return true;
     }
 
     void Wait()
     {
-#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
-        int result = pthread_mutex_lock(&_mutex);
-        if (result != 0)
-            throwex SystemException("Failed to lock a mutex for the manual-reset event!", result);
-        while (!_signaled)
-        {
-            result = pthread_cond_wait(&_cond, &_mutex);
-            if (result != 0)
-                throwex SystemException("Failed to waiting a conditional variable for the manual-reset event!", result);
-        }
-        result = pthread_mutex_unlock(&_mutex);
-        if (result != 0)
-            throwex SystemException("Failed to unlock a mutex for the manual-reset event!", result);
-#elif defined(_WIN32) || defined(_WIN64)
-        DWORD result = WaitForSingleObject(_event, INFINITE);
-        if (result != WAIT_OBJECT_0)
-            throwex SystemException("Failed to lock a manual-reset event!");
-#endif
+        // Wait for the signal
+        while (!Register())
+            WaitStrategy::Park(_state, PARKED);
     }
 
 private:
-#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
-    pthread_mutex_t _mutex;
-    pthread_cond_t _cond;
-    bool _signaled;
-#elif defined(_WIN32) || defined(_WIN64)
-    HANDLE _event;
-#endif
+    // Reset event with parked waiters must be woken by the next signal
+    static const uint32_t RESET = 0;
+    static const uint32_t SIGNALED = 1;
+    static const uint32_t PARKED = 2;
+
+    std::atomic<uint32_t> _state;
+
+    // Check the signaled state or mark the reset event as having parked waiters
+    bool Register()
+    {
+        uint32_t state = _state.load(std::memory_order_acquire);
+        while (state == RESET)
+            if (_state.compare_exchange_weak(state, PARKED, std::memory_order_acquire, std::memory_order_acquire))
+                return false;
+        return (state == SIGNALED);
+    }
 };
 
 //! @endcond
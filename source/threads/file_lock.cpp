@@ -9,9 +9,15 @@
 #include "threads/file_lock.h"
 
 #include "errors/fatal.h"
+#include "threads/critical_section.h"
 #include "threads/thread.h"
 #include "utility/validate_aligned_storage.h"
 
+#include <algorithm>
+#include <limits>
+#include <map>
+#include <vector>
+
 #if (defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)) && !defined(__CYGWIN__)
 #include <sys/file.h>
 #include <fcntl.h>
@@ -36,9 +42,9 @@ class FileLock::Impl
 {
 public:
 #if (defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)) && !defined(__CYGWIN__)
-    Impl() : _file(0) {}
+    Impl() : _file(0) { ResetRanges(); }
 #elif defined(_WIN32) || defined(_WIN64) || defined(__CYGWIN__)
-    Impl() : _file(nullptr) {}
+    Impl() : _file(nullptr) { ResetRanges(); }
 #endif
 
     ~Impl()
@@ -89,6 +95,12 @@ public:
         if (!_file)
             return;
 
+        // Byte range locks are released with the file-lock file
+        {
+            Locker<CriticalSection> locker(_cs);
+            ResetRanges();
+        }
+
 #if (defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)) && !defined(__CYGWIN__)
         int result = close(_file);
         if (result != 0)
@@ -274,6 +286,90 @@ public:
 #endif
     }
 
+    bool TryLockRange(uint64_t offset, uint64_t size, bool shared)
+    {
+        const uint64_t start = offset;
+        const uint64_t end = ((size == 0) || (size >= (END - offset))) ? END : (offset + size);
+
+        Locker<CriticalSection> locker(_cs);
+
+        Split(start);
+        Split(end);
+
+        // Collect byte range state transitions, no transitions means the byte range is already covered by held ranges
+        std::vector<Run> runs;
+        auto first = _ranges.find(start);
+        auto last = _ranges.find(end);
+        for (auto it = first; it != last; ++it)
+        {
+            State from = StateOf(it->second);
+            State to = shared ? std::max(from, READ) : WRITE;
+            if (from != to)
+                AddRun(runs, it->first, std::next(it)->first, from, to);
+        }
+
+        // Acquire uncovered byte ranges in the kernel
+        for (size_t i = 0; i < runs.size(); ++i)
+        {
+            if (!Acquire(runs[i]))
+            {
+                // Rollback byte ranges acquired before
+                for (size_t j = i; j-- > 0;)
+                    Restore(runs[j]);
+                Compact();
+                return false;
+            }
+        }
+
+        // Count the held byte range
+        for (auto it = first; it != last; ++it)
+        {
+            if (shared)
+                ++it->second.readers;
+            else
+                ++it->second.writers;
+        }
+
+        Compact();
+        return true;
+    }
+
+    void UnlockRange(uint64_t offset, uint64_t size, bool shared)
+    {
+        const uint64_t start = offset;
+        const uint64_t end = ((size == 0) || (size >= (END - offset))) ? END : (offset + size);
+
+        Locker<CriticalSection> locker(_cs);
+
+        Split(start);
+        Split(end);
+
+        // Uncount the held byte range and collect byte range state transitions
+        std::vector<Run> runs;
+        auto first = _ranges.find(start);
+        auto last = _ranges.find(end);
+        for (auto it = first; it != last; ++it)
+        {
+            State from = StateOf(it->second);
+            uint32_t& counter = shared ? it->second.readers : it->second.writers;
+            if (counter == 0)
+            {
+                Compact();
+                throwex FileSystemException("Failed to unlock the byte range which is not locked!").Attach(_path);
+            }
+            --counter;
+            State to = StateOf(it->second);
+            if (from != to)
+                AddRun(runs, it->first, std::next(it)->first, from, to);
+        }
+
+        // Release or downgrade byte ranges in the kernel
+        for (const auto& run : runs)
+            Release(run);
+
+        Compact();
+    }
+
 private:
     Path _path;
 #if (defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)) && !defined(__CYGWIN__)
@@ -281,6 +377,172 @@ private:
 #elif defined(_WIN32) || defined(_WIN64) || defined(__CYGWIN__)
     HANDLE _file;
 #endif
+
+    // Byte range lock state
+    enum State { NONE, READ, WRITE };
+
+    // Counters of byte ranges held by the file-lock
+    struct Segment
+    {
+        uint32_t readers;
+        uint32_t writers;
+
+        bool operator==(const Segment& other) const noexcept { return (readers == other.readers) && (writers == other.writers); }
+    };
+
+    // Contiguous byte range with the same state transition
+    struct Run
+    {
+        uint64_t start;
+        uint64_t end;
+        State from;
+        State to;
+    };
+
+    static constexpr uint64_t END = std::numeric_limits<uint64_t>::max();
+
+    // Held byte ranges: each segment starts at its key and ends at the next key
+    CriticalSection _cs;
+    std::map<uint64_t, Segment> _ranges;
+#if defined(_WIN32) || defined(_WIN64) || defined(__CYGWIN__)
+    // Byte ranges locked in the kernel, which must be unlocked exactly as they were locked
+    std::vector<Run> _locked;
+#endif
+
+    static State StateOf(const Segment& segment) noexcept
+    { return (segment.writers > 0) ? WRITE : ((segment.readers > 0) ? READ : NONE); }
+
+    static void AddRun(std::vector<Run>& runs, uint64_t start, uint64_t end, State from, State to)
+    {
+        if (!runs.empty() && (runs.back().end == start) && (runs.back().from == from) && (runs.back().to == to))
+            runs.back().end = end;
+        else
+            runs.push_back(Run{ start, end, from, to });
+    }
+
+    void ResetRanges()
+    {
+        _ranges.clear();
+        _ranges[0] = Segment{ 0, 0 };
+        _ranges[END] = Segment{ 0, 0 };
+#if defined(_WIN32) || defined(_WIN64) || defined(__CYGWIN__)
+        _locked.clear();
+#endif
+    }
+
+    // Make sure the segment starts at the given position
+    void Split(uint64_t position)
+    {
+        auto it = _ranges.upper_bound(position);
+        --it;
+        if (it->first != position)
+            _ranges.emplace_hint(std::next(it), position, it->second);
+    }
+
+    // Merge adjacent segments with the same counters
+    void Compact()
+    {
+        auto it = std::next(_ranges.begin());
+        while (it->first != END)
+        {
+            if (it->second == std::prev(it)->second)
+                it = _ranges.erase(it);
+            else
+                ++it;
+        }
+    }
+
+#if (defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)) && !defined(__CYGWIN__)
+    // Set the given lock type for the byte range in the kernel (existing lock of the byte range is converted)
+    bool Apply(uint64_t start, uint64_t end, short type)
+    {
+        struct flock lock;
+        lock.l_type = type;
+        lock.l_whence = SEEK_SET;
+        lock.l_start = (off_t)start;
+        lock.l_len = (end == END) ? 0 : (off_t)(end - start);
+        lock.l_pid = 0;
+#if defined(linux) || defined(__linux) || defined(__linux__)
+        int result = fcntl(_file, F_OFD_SETLK, &lock);
+#else
+        int result = fcntl(_file, F_SETLK, &lock);
+#endif
+        if (result == -1)
+        {
+            if ((errno == EAGAIN) || (errno == EACCES))
+                return false;
+            else
+                throwex FileSystemException("Failed to set the byte range lock!").Attach(_path);
+        }
+        return true;
+    }
+
+    static short TypeOf(State state) noexcept
+    { return (state == WRITE) ? F_WRLCK : ((state == READ) ? F_RDLCK : F_UNLCK); }
+
+    bool Acquire(const Run& run) { return Apply(run.start, run.end, TypeOf(run.to)); }
+    void Restore(const Run& run) { Apply(run.start, run.end, TypeOf(run.from)); }
+    void Release(const Run& run)
+    {
+        if (!Apply(run.start, run.end, TypeOf(run.to)))
+            throwex FileSystemException("Failed to unlock the byte range!").Attach(_path);
+    }
+#elif defined(_WIN32) || defined(_WIN64) || defined(__CYGWIN__)
+    static void SetOverlapped(OVERLAPPED& overlapped, uint64_t start)
+    {
+        ZeroMemory(&overlapped, sizeof(OVERLAPPED));
+        overlapped.Offset = (DWORD)(start & 0xFFFFFFFF);
+        overlapped.OffsetHigh = (DWORD)(start >> 32);
+    }
+
+    // Windows locks could not be converted, so shared byte ranges are upgraded only if the kernel allows it
+    bool Acquire(const Run& run)
+    {
+        OVERLAPPED overlapped;
+        SetOverlapped(overlapped, run.start);
+        uint64_t size = run.end - run.start;
+        DWORD flags = LOCKFILE_FAIL_IMMEDIATELY | ((run.to == WRITE) ? LOCKFILE_EXCLUSIVE_LOCK : 0);
+        if (!LockFileEx(_file, flags, 0, (DWORD)(size & 0xFFFFFFFF), (DWORD)(size >> 32), &overlapped))
+            return false;
+        _locked.push_back(run);
+        return true;
+    }
+
+    void Unlock(const Run& run)
+    {
+        OVERLAPPED overlapped;
+        SetOverlapped(overlapped, run.start);
+        uint64_t size = run.end - run.start;
+        if (!UnlockFileEx(_file, 0, (DWORD)(size & 0xFFFFFFFF), (DWORD)(size >> 32), &overlapped))
+            throwex FileSystemException("Failed to unlock the byte range!").Attach(_path);
+    }
+
+    void Restore(const Run&)
+    {
+        Unlock(_locked.back());
+        _locked.pop_back();
+    }
+
+    // Kernel byte range is unlocked only when none of its bytes is held anymore
+    void Release(const Run&)
+    {
+        for (auto it = _locked.begin(); it != _locked.end();)
+        {
+            bool held = false;
+            Split(it->start);
+            for (auto segment = _ranges.find(it->start); segment->first < it->end; ++segment)
+                held |= (StateOf(segment->second) != NONE);
+
+            if (!held)
+            {
+                Unlock(*it);
+                it = _locked.erase(it);
+            }
+            else
+                ++it;
+        }
+    }
+#endif
 };
 
 //! @endcond
@@ -298,14 +560,6 @@ FileLock::FileLock()
 
 FileLock::FileLock(const Path& path) : FileLock()
 {
-    // Check implementation storage parameters
-    [[maybe_unused]] ValidateAlignedStorage<sizeof(Impl), alignof(Impl), StorageSize, StorageAlign> _;
-    static_assert((StorageSize >= sizeof(Impl)), "FileLock::StorageSize must be increased!");
-    static_assert(((StorageAlign % alignof(Impl)) == 0), "FileLock::StorageAlign must be adjusted!");
-
-    // Create the implementation instance
-    new(&_storage)Impl();
-
     Assign(path);
 }
 
@@ -377,6 +631,46 @@ bool FileLock::TryLockWriteFor(const Timespan& timespan)
     }
 }
 
+bool FileLock::TryLockRange(uint64_t offset, uint64_t size, bool shared) { return impl().TryLockRange(offset, size, shared); }
+
+bool FileLock::TryLockRangeFor(uint64_t offset, uint64_t size, bool shared, const Timespan& timespan)
+{
+    // Calculate a finish timestamp
+    Timestamp finish = NanoTimestamp() + timespan;
+
+    // Try to acquire byte range lock at least one time
+    if (TryLockRange(offset, size, shared))
+        return true;
+    else
+    {
+        // Try lock or yield for the given timespan
+        while (NanoTimestamp() < finish)
+        {
+            if (TryLockRange(offset, size, shared))
+                return true;
+            else
+                Thread::Yield();
+        }
+
+        // Failed to acquire byte range lock
+        return false;
+    }
+}
+
+void FileLock::LockRange(uint64_t offset, uint64_t size, bool shared)
+{
+    // Byte range lock does not wait in the kernel, so other threads could release their byte ranges meanwhile
+    for (int attempt = 0; !TryLockRange(offset, size, shared); ++attempt)
+    {
+        if (attempt < 100)
+            Thread::Yield();
+        else
+            Thread::Sleep(1);
+    }
+}
+
+void FileLock::UnlockRange(uint64_t offset, uint64_t size, bool shared) { impl().UnlockRange(offset, size, shared); }
+
 void FileLock::LockRead() { impl().LockRead(); }
 void FileLock::LockWrite() { impl().LockWrite(); }
 void FileLock::UnlockRead() { impl().UnlockRead(); }
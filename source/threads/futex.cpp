@@ -0,0 +1,69 @@
+/*!
+    \file futex.cpp
+    \brief Process-shared futex synchronization primitive implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "threads/futex.h"
+
+#include <climits>
+
+#if defined(linux) || defined(__linux) || defined(__linux__)
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <errno.h>
+#include <time.h>
+#include <unistd.h>
+#else
+#include "threads/thread.h"
+#endif
+
+namespace CppCommon {
+
+static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t), "Atomic value must be lock-free to wait on its address!");
+
+void Futex::Wait(std::atomic<uint32_t>& address, uint32_t value) noexcept
+{
+#if defined(linux) || defined(__linux) || defined(__linux__)
+    // Spurious wake-ups and interrupts are handled by the caller
+    syscall(SYS_futex, (uint32_t*)&address, FUTEX_WAIT, value, nullptr, nullptr, 0);
+#else
+    if (address.load(std::memory_order_acquire) == value)
+        Thread::Yield();
+#endif
+}
+
+bool Futex::WaitFor(std::atomic<uint32_t>& address, uint32_t value, const Timespan& timespan) noexcept
+{
+    if (timespan.total() <= 0)
+        return false;
+
+#if defined(linux) || defined(__linux) || defined(__linux__)
+    // Futex timeout is relative to the current time
+    struct timespec timeout;
+    timeout.tv_sec = (time_t)timespan.seconds();
+    timeout.tv_nsec = (long)(timespan.nanoseconds() % 1000000000);
+    long result = syscall(SYS_futex, (uint32_t*)&address, FUTEX_WAIT, value, &timeout, nullptr, 0);
+    return !((result != 0) && (errno == ETIMEDOUT));
+#else
+    if (address.load(std::memory_order_acquire) == value)
+        Thread::Yield();
+    return true;
+#endif
+}
+
+void Futex::Wake(std::atomic<uint32_t>& address, int count) noexcept
+{
+#if defined(linux) || defined(__linux) || defined(__linux__)
+    syscall(SYS_futex, (uint32_t*)&address, FUTEX_WAKE, count, nullptr, nullptr, 0);
+#endif
+}
+
+void Futex::WakeAll(std::atomic<uint32_t>& address) noexcept
+{
+    Wake(address, INT_MAX);
+}
+
+} // namespace CppCommon
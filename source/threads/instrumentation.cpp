@@ -0,0 +1,179 @@
+/*!
+    \file instrumentation.cpp
+    \brief Instrumentation counters of queues and locks implementation
+    \author Ivan Shynkarenka
+    \date 15.10.2026
+    \copyright MIT License
+*/
+
+#include "threads/instrumentation.h"
+
+#include "system/cpu.h"
+
+#include <algorithm>
+#include <mutex>
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+
+namespace {
+
+// Registry is guarded with the standard mutex, because CppCommon locks are instrumented themselves
+struct Registry
+{
+    std::mutex lock;
+    uint64_t sequence{0};
+    InstrumentationCounters* first{nullptr};
+    InstrumentationCounters* last{nullptr};
+    std::vector<InstrumentationSample> retired;
+};
+
+Registry& GetRegistry()
+{
+    static Registry registry;
+    return registry;
+}
+
+size_t GetShardsCount()
+{
+    static size_t shards = []()
+    {
+        // Round up logical cores count to the power of two
+        size_t count = 1;
+        while (count < (size_t)std::max(CPU::LogicalCores(), 1))
+            count <<= 1;
+        return count;
+    }();
+    return shards;
+}
+
+} // namespace
+
+//! @endcond
+
+InstrumentationCounters::InstrumentationCounters() noexcept
+    : _name(""), _id(0), _shards_mask(0), _prev(nullptr), _next(nullptr)
+{
+}
+
+InstrumentationCounters::InstrumentationCounters(const char* name)
+    : _name(name), _id(0), _shards_mask(GetShardsCount() - 1), _shards(std::make_unique<Shard[]>(_shards_mask + 1)), _prev(nullptr), _next(nullptr)
+{
+    for (size_t i = 0; i <= _shards_mask; ++i)
+        for (auto& value : _shards[i].values)
+            value.store(0, std::memory_order_relaxed);
+
+    InstrumentationRegistry::Register(*this);
+}
+
+InstrumentationCounters::~InstrumentationCounters()
+{
+    if (_shards)
+        InstrumentationRegistry::Unregister(*this);
+}
+
+InstrumentationSample InstrumentationCounters::Read() const
+{
+    InstrumentationSample sample;
+    sample.name = _name;
+    sample.id = _id;
+
+    if (_shards)
+        for (size_t i = 0; i <= _shards_mask; ++i)
+            for (size_t j = 0; j < InstrumentationSample::EVENTS; ++j)
+                sample.values[j] += _shards[i].values[j].load(std::memory_order_relaxed);
+
+    return sample;
+}
+
+size_t InstrumentationCounters::CurrentThreadShard() noexcept
+{
+    // Threads are assigned to shards in round-robin order of their first increment
+    static std::atomic<size_t> sequence(0);
+    thread_local size_t shard = sequence.fetch_add(1, std::memory_order_relaxed);
+    return shard;
+}
+
+bool InstrumentationRegistry::IsEnabled() noexcept
+{
+#if defined(CPPCOMMON_INSTRUMENTATION)
+    return true;
+#else
+    return false;
+#endif
+}
+
+void InstrumentationRegistry::Register(InstrumentationCounters& counters)
+{
+    Registry& registry = GetRegistry();
+    std::scoped_lock locker(registry.lock);
+
+    counters._id = ++registry.sequence;
+    counters._prev = registry.last;
+    counters._next = nullptr;
+    if (registry.last != nullptr)
+        registry.last->_next = &counters;
+    else
+        registry.first = &counters;
+    registry.last = &counters;
+}
+
+void InstrumentationRegistry::Unregister(InstrumentationCounters& counters)
+{
+    InstrumentationSample sample = counters.Read();
+    sample.id = 0;
+
+    Registry& registry = GetRegistry();
+    std::scoped_lock locker(registry.lock);
+
+    if (counters._prev != nullptr)
+        counters._prev->_next = counters._next;
+    else
+        registry.first = counters._next;
+    if (counters._next != nullptr)
+        counters._next->_prev = counters._prev;
+    else
+        registry.last = counters._prev;
+
+    // Keep the totals of destroyed instances per name
+    auto it = std::find_if(registry.retired.begin(), registry.retired.end(), [&sample](const InstrumentationSample& retired) { return retired.name == sample.name; });
+    if (it != registry.retired.end())
+        *it += sample;
+    else
+        registry.retired.emplace_back(std::move(sample));
+}
+
+std::vector<InstrumentationSample> InstrumentationRegistry::Snapshot()
+{
+    Registry& registry = GetRegistry();
+    std::scoped_lock locker(registry.lock);
+
+    std::vector<InstrumentationSample> result;
+    for (InstrumentationCounters* counters = registry.first; counters != nullptr; counters = counters->_next)
+        result.emplace_back(counters->Read());
+    result.insert(result.end(), registry.retired.begin(), registry.retired.end());
+    return result;
+}
+
+std::vector<InstrumentationSample> InstrumentationRegistry::Totals()
+{
+    std::vector<InstrumentationSample> result;
+
+    for (auto& sample : Snapshot())
+    {
+        auto it = std::find_if(result.begin(), result.end(), [&sample](const InstrumentationSample& total) { return total.name == sample.name; });
+        if (it != result.end())
+            *it += sample;
+        else
+        {
+            sample.id = 0;
+            result.emplace_back(std::move(sample));
+        }
+    }
+
+    std::sort(result.begin(), result.end(), [](const InstrumentationSample& sample1, const InstrumentationSample& sample2) { return sample1.name < sample2.name; });
+    return result;
+}
+
+} // namespace CppCommon
@@ -8,81 +8,103 @@
 
 #include "threads/latch.h"
 
+#include "threads/wait_strategy.h"
+
 namespace CppCommon {
 
 void Latch::Reset(int threads) noexcept
 {
     assert((threads > 0) && "Latch threads counter must be greater than zero!");
 
-    std::scoped_lock lock(_mutex);
-
     // Reset the latch threads counter with a new value
-    _threads = threads;
+    _threads.store(threads, std::memory_order_release);
 }
 
-bool Latch::CountDown(std::unique_lock<std::mutex>& lock) noexcept
+bool Latch::Release() noexcept
 {
     // Count down the latch threads counter and check its value
-    if (--_threads == 0)
+    if (_threads.fetch_sub(1, std::memory_order_acq_rel) == 1)
     {
         // Increase the current latch generation
-        ++_generation;
+        _generation.fetch_add(1, std::memory_order_seq_cst);
 
-        // Notify all waiting threads
-        _cond.notify_all();
+        // Wake all parked threads
+        if (_waiters.load(std::memory_order_seq_cst) > 0)
+            WaitStrategy::Wake(_generation);
 
-        // Wait for the next latch generation
         return true;
     }
 
-    // Notify each of remaining threads
     return false;
 }
 
-void Latch::CountDown() noexcept
+bool Latch::WaitGeneration(uint32_t generation, uint64_t deadline) noexcept
 {
-    std::unique_lock<std::mutex> lock(_mutex);
+    // Register the waiter before the generation check, so it could not be missed by the last count down
+    _waiters.fetch_add(1, std::memory_order_seq_cst);
+    bool result = false;
+    while (!(result = (_generation.load(std::memory_order_acquire) != generation)))
+    {
+        if (deadline == 0)
+        {
+            WaitStrategy::Park(_generation, generation);
+            continue;
+        }
+
+        uint64_t current = Timestamp::nano();
+        if (current >= deadline)
+            break;
+        WaitStrategy::ParkFor(_generation, generation, Timespan((int64_t)(deadline - current)));
+    }
+    _waiters.fetch_sub(1, std::memory_order_relaxed);
+    return result;
+}
 
+void Latch::CountDown() noexcept
+{
     // Count down the latch threads counter
-    CountDown(lock);
+    Release();
 }
 
 void Latch::CountDownAndWait() noexcept
 {
-    std::unique_lock<std::mutex> lock(_mutex);
-
     // Remember the current latch generation
-    int generation = _generation;
+    uint32_t generation = _generation.load(std::memory_order_acquire);
 
     // Count down the latch threads counter
-    if (CountDown(lock))
+    if (Release())
         return;
 
     // Wait for the next latch generation
-    _cond.wait(lock, [&, this]() { return generation != _generation; });
+    WaitGeneration(generation, 0);
 }
 
 void Latch::Wait() noexcept
 {
-    std::unique_lock<std::mutex> lock(_mutex);
+    // Remember the current latch generation before the latch threads counter check
+    uint32_t generation = _generation.load(std::memory_order_acquire);
 
     // Check the latch threads counter value
-    if (_threads == 0)
+    if (_threads.load(std::memory_order_acquire) == 0)
         return;
 
-    // Remember the current latch generation
-    int generation = _generation;
-
     // Wait for the next latch generation
-    _cond.wait(lock, [&, this]() { return generation != _generation; });
+    WaitGeneration(generation, 0);
 }
 
-bool Latch::TryWait() noexcept
+bool Latch::TryWaitFor(const Timespan& timespan) noexcept
 {
-    std::unique_lock<std::mutex> lock(_mutex);
+    // Remember the current latch generation before the latch threads counter check
+    uint32_t generation = _generation.load(std::memory_order_acquire);
 
     // Check the latch threads counter value
-    return (_threads == 0);
+    if (_threads.load(std::memory_order_acquire) == 0)
+        return true;
+    if (timespan <= 0)
+        return false;
+
+    // Wait for the next latch generation until the deadline
+    return WaitGeneration(generation, Timestamp::nano() + timespan.total());
 }
 
 } // namespace CppCommon
@@ -13,7 +13,11 @@
 
 #include <algorithm>
 
-#if (defined(unix) || defined(__unix) || defined(__unix__)) && !defined(__APPLE__) && !defined(__CYGWIN__)
+#if defined(linux) || defined(__linux) || defined(__linux__)
+#include "system/shared_type.h"
+#include "threads/futex.h"
+#include <atomic>
+#elif (defined(unix) || defined(__unix) || defined(__unix__)) && !defined(__APPLE__) && !defined(__CYGWIN__)
 #include "system/shared_type.h"
 #include <pthread.h>
 #elif defined(_WIN32) || defined(_WIN64) || defined(__CYGWIN__)
@@ -36,6 +40,10 @@ public:
     {
 #if defined(__APPLE__)
         throwex SystemException("Named auto-reset event is not supported!");
+#elif defined(linux) || defined(__linux) || defined(__linux__)
+        // Only the owner should initializate a named auto-reset event
+        if (_shared.owner())
+            _shared->signaled.store(signaled ? 1 : 0, std::memory_order_release);
 #elif (defined(unix) || defined(__unix) || defined(__unix__)) && !defined(__CYGWIN__)
         // Only the owner should initializate a named auto-reset event
         if (_shared.owner())
@@ -81,6 +89,8 @@ public:
     {
 #if defined(__APPLE__)
         fatality(SystemException("Named auto-reset event is not supported!"));
+#elif defined(linux) || defined(__linux) || defined(__linux__)
+        // Futex counter does not require any destruction
 #elif (defined(unix) || defined(__unix) || defined(__unix__)) && !defined(__CYGWIN__)
         // Only the owner should destroy a named auto-reset event
         if (_shared.owner())
@@ -107,6 +117,11 @@ public:
     {
 #if defined(__APPLE__)
         throwex SystemException("Named auto-reset event is not supported!");
+#elif defined(linux) || defined(__linux) || defined(__linux__)
+        // Wake one waiter only if someone waits for the event
+        _shared->signaled.fetch_add(1, std::memory_order_seq_cst);
+        if (_shared->waiters.load(std::memory_order_seq_cst) > 0)
+            Futex::Wake(_shared->signaled);
 #elif (defined(unix) || defined(__unix) || defined(__unix__)) && !defined(__CYGWIN__)
         int result = pthread_mutex_lock(&_shared->mutex);
         if (result != 0)
@@ -128,6 +143,13 @@ public:
     {
 #if defined(__APPLE__)
         throwex SystemException("Named auto-reset event is not supported!");
+#elif defined(linux) || defined(__linux) || defined(__linux__)
+        // Signaled event is reset with a single CAS in the user space
+        uint32_t signaled = _shared->signaled.load(std::memory_order_relaxed);
+        while (signaled > 0)
+            if (_shared->signaled.compare_exchange_weak(signaled, signaled - 1, std::memory_order_acquire, std::memory_order_relaxed))
+                return true;
+        return false;
 #elif (defined(unix) || defined(__unix) || defined(__unix__)) && !defined(__CYGWIN__)
         int result = pthread_mutex_lock(&_shared->mutex);
         if (result != 0)
@@ -152,10 +174,29 @@ public:
             return TryWait();
 #if defined(__APPLE__)
         throwex SystemException("Named auto-reset event is not supported!");
+#elif defined(linux) || defined(__linux) || defined(__linux__)
+        if (TryWait())
+            return true;
+
+        // Wait for the signal until the deadline
+        Timestamp deadline = NanoTimestamp() + timespan;
+        _shared->waiters.fetch_add(1, std::memory_order_seq_cst);
+        bool signaled = false;
+        while (!(signaled = TryWait()))
+        {
+            Timestamp current = NanoTimestamp();
+            if (current >= deadline)
+                break;
+            Futex::WaitFor(_shared->signaled, 0, deadline - current);
+        }
+        _shared->waiters.fetch_sub(1, std::memory_order_relaxed);
+        return signaled;
 #elif (defined(unix) || defined(__unix) || defined(__unix__)) && !defined(__CYGWIN__)
+        // Conditional variable waits until the absolute timeout
+        Timestamp deadline = UtcTimestamp() + timespan;
         struct timespec timeout;
-        timeout.tv_sec = timespan.seconds();
-        timeout.tv_nsec = timespan.nanoseconds() % 1000000000;
+        timeout.tv_sec = deadline.seconds();
+        timeout.tv_nsec = deadline.nanoseconds() % 1000000000;
         int result = pthread_mutex_lock(&_shared->mutex);
         if (result != 0)
             throwex SystemException("Failed to lock a mutex for the named auto-reset event!", result);
@@ -166,7 +207,10 @@ public:
             if ((result != 0) && (result != ETIMEDOUT))
                 throwex SystemException("Failed to timeout waiting a conditional variable for the named auto-reset event!", result);
             if (result == ETIMEDOUT)
+            {
                 signaled = (_shared->signaled > 0);
+                break;
+            }
         }
         _shared->signaled = (_shared->signaled > 0) ? (_shared->signaled - 1) : 0;
         result = pthread_mutex_unlock(&_shared->mutex);
@@ -185,6 +229,15 @@ public:
     {
 #if defined(__APPLE__)
         throwex SystemException("Named auto-reset event is not supported!");
+#elif defined(linux) || defined(__linux) || defined(__linux__)
+        if (TryWait())
+            return;
+
+        // Wait for the signal
+        _shared->waiters.fetch_add(1, std::memory_order_seq_cst);
+        while (!TryWait())
+            Futex::Wait(_shared->signaled, 0);
+        _shared->waiters.fetch_sub(1, std::memory_order_relaxed);
 #elif (defined(unix) || defined(__unix) || defined(__unix__)) && !defined(__CYGWIN__)
         int result = pthread_mutex_lock(&_shared->mutex);
         if (result != 0)
@@ -208,7 +261,19 @@ public:
 
 private:
     std::string _name;
-#if (defined(unix) || defined(__unix) || defined(__unix__)) && !defined(__APPLE__) && !defined(__CYGWIN__)
+#if defined(linux) || defined(__linux) || defined(__linux__)
+    // Shared auto-reset event structure
+    struct EventHeader
+    {
+        std::atomic<uint32_t> signaled;
+        std::atomic<uint32_t> waiters;
+
+        EventHeader() : signaled(0), waiters(0) {}
+    };
+
+    // Shared auto-reset event structure wrapper
+    SharedType<EventHeader> _shared;
+#elif (defined(unix) || defined(__unix) || defined(__unix__)) && !defined(__APPLE__) && !defined(__CYGWIN__)
     // Shared auto-reset event structure
     struct EventHeader
     {
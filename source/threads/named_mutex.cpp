@@ -16,7 +16,10 @@
 #if defined(__APPLE__)
 #include "threads/thread.h"
 #endif
-#if (defined(unix) || defined(__unix) || defined(__unix__)) && !defined(__APPLE__) && !defined(__CYGWIN__)
+#if defined(linux) || defined(__linux) || defined(__linux__)
+#include "system/shared_type.h"
+#include "threads/futex.h"
+#elif (defined(unix) || defined(__unix) || defined(__unix__)) && !defined(__APPLE__) && !defined(__CYGWIN__)
 #include "system/shared_type.h"
 #include <pthread.h>
 #elif defined(_WIN32) || defined(_WIN64) || defined(__CYGWIN__)
@@ -39,6 +42,8 @@ public:
     {
 #if defined(__APPLE__)
         throwex SystemException("Named mutex is not supported!");
+#elif defined(linux) || defined(__linux) || defined(__linux__)
+        // Futex state is initialized as unlocked by the shared type owner
 #elif (defined(unix) || defined(__unix) || defined(__unix__)) && !defined(__CYGWIN__)
         // Only the owner should initializate a named mutex
         if (_shared.owner())
@@ -68,6 +73,8 @@ public:
     {
 #if defined(__APPLE__)
         fatality(SystemException("Named mutex is not supported!"));
+#elif defined(linux) || defined(__linux) || defined(__linux__)
+        // Futex state does not require any destruction
 #elif (defined(unix) || defined(__unix) || defined(__unix__)) && !defined(__CYGWIN__)
         // Only the owner should destroy a named mutex
         if (_shared.owner())
@@ -91,6 +98,9 @@ public:
     {
 #if defined(__APPLE__)
         throwex SystemException("Named mutex is not supported!");
+#elif defined(linux) || defined(__linux) || defined(__linux__)
+        uint32_t state = UNLOCKED;
+        return _shared->state.compare_exchange_strong(state, LOCKED, std::memory_order_acquire, std::memory_order_relaxed);
 #elif (defined(unix) || defined(__unix) || defined(__unix__)) && !defined(__CYGWIN__)
         int result = pthread_mutex_trylock(&_shared->mutex);
         if ((result != 0) && (result != EAGAIN) && (result != EBUSY) && (result != EDEADLK))
@@ -110,6 +120,20 @@ public:
             return TryLock();
 #if defined(__APPLE__)
         throwex SystemException("Named mutex is not supported!");
+#elif defined(linux) || defined(__linux) || defined(__linux__)
+        if (TryLock())
+            return true;
+
+        // Mark the mutex as contended and wait for the unlock until the deadline
+        Timestamp deadline = NanoTimestamp() + timespan;
+        while (_shared->state.exchange(CONTENDED, std::memory_order_acquire) != UNLOCKED)
+        {
+            Timestamp current = NanoTimestamp();
+            if (current >= deadline)
+                return false;
+            Futex::WaitFor(_shared->state, CONTENDED, deadline - current);
+        }
+        return true;
 #elif (defined(unix) || defined(__unix) || defined(__unix__)) && !defined(__CYGWIN__)
         struct timespec timeout;
         timeout.tv_sec = timespan.seconds();
@@ -130,6 +154,14 @@ public:
     {
 #if defined(__APPLE__)
         throwex SystemException("Named mutex is not supported!");
+#elif defined(linux) || defined(__linux) || defined(__linux__)
+        // Uncontended lock is a single CAS in the user space
+        if (TryLock())
+            return;
+
+        // Mark the mutex as contended and wait for the unlock
+        while (_shared->state.exchange(CONTENDED, std::memory_order_acquire) != UNLOCKED)
+            Futex::Wait(_shared->state, CONTENDED);
 #elif (defined(unix) || defined(__unix) || defined(__unix__)) && !defined(__CYGWIN__)
         int result = pthread_mutex_lock(&_shared->mutex);
         if (result != 0)
@@ -145,6 +177,10 @@ public:
     {
 #if defined(__APPLE__)
         throwex SystemException("Named mutex is not supported!");
+#elif defined(linux) || defined(__linux) || defined(__linux__)
+        // Wake one waiter only if the mutex is contended
+        if (_shared->state.exchange(UNLOCKED, std::memory_order_release) == CONTENDED)
+            Futex::Wake(_shared->state);
 #elif (defined(unix) || defined(__unix) || defined(__unix__)) && !defined(__CYGWIN__)
         int result = pthread_mutex_unlock(&_shared->mutex);
         if (result != 0)
@@ -157,7 +193,23 @@ public:
 
 private:
     std::string _name;
-#if (defined(unix) || defined(__unix) || defined(__unix__)) && !defined(__APPLE__) && !defined(__CYGWIN__)
+#if defined(linux) || defined(__linux) || defined(__linux__)
+    // Futex states of the named mutex
+    static const uint32_t UNLOCKED = 0;
+    static const uint32_t LOCKED = 1;
+    static const uint32_t CONTENDED = 2;
+
+    // Shared mutex structure
+    struct MutexHeader
+    {
+        std::atomic<uint32_t> state;
+
+        MutexHeader() : state(UNLOCKED) {}
+    };
+
+    // Shared mutex structure wrapper
+    SharedType<MutexHeader> _shared;
+#elif (defined(unix) || defined(__unix) || defined(__unix__)) && !defined(__APPLE__) && !defined(__CYGWIN__)
     // Shared mutex structure
     struct MutexHeader
     {
@@ -17,7 +17,11 @@
 #if defined(__APPLE__)
 #include "threads/thread.h"
 #endif
-#if (defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)) && !defined(__CYGWIN__)
+#if defined(linux) || defined(__linux) || defined(__linux__)
+#include "system/shared_type.h"
+#include "threads/futex.h"
+#include <atomic>
+#elif (defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)) && !defined(__CYGWIN__)
 #include <fcntl.h>
 #include <semaphore.h>
 #elif defined(_WIN32) || defined(_WIN64) || defined(__CYGWIN__)
@@ -35,10 +39,17 @@ class NamedSemaphore::Impl
 {
 public:
     Impl(const std::string& name, int resources) : _name(name), _resources(resources)
+#if defined(linux) || defined(__linux) || defined(__linux__)
+        , _shared(name)
+#endif
     {
         assert((resources > 0) && "Named semaphore resources counter must be greater than zero!");
 
-#if (defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)) && !defined(__CYGWIN__)
+#if defined(linux) || defined(__linux) || defined(__linux__)
+        // Only the owner should initializate a named semaphore counter
+        if (_shared.owner())
+            _shared->count.store((uint32_t)resources, std::memory_order_release);
+#elif (defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)) && !defined(__CYGWIN__)
         _owner = true;
         // Try to create a named binary semaphore
         _semaphore = sem_open(name.c_str(), (O_CREAT | O_EXCL), 0666, resources);
@@ -60,7 +71,9 @@ public:
 
     ~Impl()
     {
-#if (defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)) && !defined(__CYGWIN__)
+#if defined(linux) || defined(__linux) || defined(__linux__)
+        // Futex counter does not require any destruction
+#elif (defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)) && !defined(__CYGWIN__)
         int result = sem_close(_semaphore);
         if (result != 0)
             fatality(SystemException("Failed to close a named semaphore!"));
@@ -89,7 +102,14 @@ public:
 
     bool TryLock()
     {
-#if (defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)) && !defined(__CYGWIN__)
+#if defined(linux) || defined(__linux) || defined(__linux__)
+        // Uncontended lock is a single CAS in the user space
+        uint32_t count = _shared->count.load(std::memory_order_relaxed);
+        while (count > 0)
+            if (_shared->count.compare_exchange_weak(count, count - 1, std::memory_order_acquire, std::memory_order_relaxed))
+                return true;
+        return false;
+#elif (defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)) && !defined(__CYGWIN__)
         int result = sem_trywait(_semaphore);
         if ((result != 0) && (errno != EAGAIN))
             throwex SystemException("Failed to try lock a named semaphore!");
@@ -106,7 +126,24 @@ public:
     {
         if (timespan < 0)
             return TryLock();
-#if defined(__APPLE__)
+#if defined(linux) || defined(__linux) || defined(__linux__)
+        if (TryLock())
+            return true;
+
+        // Wait for the released resource until the deadline
+        Timestamp deadline = NanoTimestamp() + timespan;
+        _shared->waiters.fetch_add(1, std::memory_order_seq_cst);
+        bool result = false;
+        while (!(result = TryLock()))
+        {
+            Timestamp current = NanoTimestamp();
+            if (current >= deadline)
+                break;
+            Futex::WaitFor(_shared->count, 0, deadline - current);
+        }
+        _shared->waiters.fetch_sub(1, std::memory_order_relaxed);
+        return result;
+#elif defined(__APPLE__)
         // Calculate a finish timestamp
         Timestamp finish = NanoTimestamp() + timespan;
 
@@ -145,7 +182,16 @@ public:
 
     void Lock()
     {
-#if (defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)) && !defined(__CYGWIN__)
+#if defined(linux) || defined(__linux) || defined(__linux__)
+        if (TryLock())
+            return;
+
+        // Wait for the released resource
+        _shared->waiters.fetch_add(1, std::memory_order_seq_cst);
+        while (!TryLock())
+            Futex::Wait(_shared->count, 0);
+        _shared->waiters.fetch_sub(1, std::memory_order_relaxed);
+#elif (defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)) && !defined(__CYGWIN__)
         int result = sem_wait(_semaphore);
         if (result != 0)
             throwex SystemException("Failed to lock a named semaphore!");
@@ -158,7 +204,12 @@ public:
 
     void Unlock()
     {
-#if (defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)) && !defined(__CYGWIN__)
+#if defined(linux) || defined(__linux) || defined(__linux__)
+        // Wake one waiter only if someone waits for the resource
+        _shared->count.fetch_add(1, std::memory_order_seq_cst);
+        if (_shared->waiters.load(std::memory_order_seq_cst) > 0)
+            Futex::Wake(_shared->count);
+#elif (defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)) && !defined(__CYGWIN__)
         int result = sem_post(_semaphore);
         if (result != 0)
             throwex SystemException("Failed to unlock a named semaphore!");
@@ -171,7 +222,19 @@ public:
 private:
     std::string _name;
     int _resources;
-#if (defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)) && !defined(__CYGWIN__)
+#if defined(linux) || defined(__linux) || defined(__linux__)
+    // Shared semaphore structure
+    struct SemaphoreHeader
+    {
+        std::atomic<uint32_t> count;
+        std::atomic<uint32_t> waiters;
+
+        SemaphoreHeader() : count(0), waiters(0) {}
+    };
+
+    // Shared semaphore structure wrapper
+    SharedType<SemaphoreHeader> _shared;
+#elif (defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)) && !defined(__CYGWIN__)
     sem_t* _semaphore;
     bool _owner;
 #elif defined(_WIN32) || defined(_WIN64) || defined(__CYGWIN__)
@@ -0,0 +1,65 @@
+/*!
+    \file per_cpu.cpp
+    \brief Per-CPU data implementation
+    \author Ivan Shynkarenka
+    \date 15.10.2026
+    \copyright MIT License
+*/
+
+#include "threads/per_cpu.h"
+
+#include "system/cpu.h"
+#include "threads/thread.h"
+
+#include <algorithm>
+
+#if defined(linux) || defined(__linux) || defined(__linux__)
+#include <sched.h>
+#if defined(__GLIBC__) && defined(__has_include)
+#if __has_include(<sys/rseq.h>)
+#include <sys/rseq.h>
+#endif
+#endif
+#elif defined(_WIN32) || defined(_WIN64)
+#include <windows.h>
+#endif
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+namespace Internals {
+
+uint32_t CurrentCpuSlot() noexcept
+{
+#if defined(linux) || defined(__linux) || defined(__linux__)
+#if defined(RSEQ_SIG) && (defined(__x86_64__) || defined(__aarch64__))
+    // Read the current CPU from the restartable sequences area registered by glibc 2.35+
+    if (__rseq_size > 0)
+    {
+        const struct rseq* area = (const struct rseq*)((const char*)__builtin_thread_pointer() + __rseq_offset);
+        int32_t cpu = (int32_t)__atomic_load_n(&area->cpu_id, __ATOMIC_RELAXED);
+        if (cpu >= 0)
+            return (uint32_t)cpu;
+    }
+#endif
+    int cpu = sched_getcpu();
+    if (cpu >= 0)
+        return (uint32_t)cpu;
+#elif defined(_WIN32) || defined(_WIN64)
+    PROCESSOR_NUMBER processor;
+    GetCurrentProcessorNumberEx(&processor);
+    return (uint32_t)processor.Group * 64 + processor.Number;
+#endif
+    // Current CPU is unknown, so spread threads over slots by their dense indexes
+    return Thread::CurrentThreadIndex();
+}
+
+size_t DefaultCpuSlots() noexcept
+{
+    return (size_t)std::max(CPU::LogicalCores(), 1);
+}
+
+} // namespace Internals
+//! @endcond
+
+} // namespace CppCommon
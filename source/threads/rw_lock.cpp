@@ -143,8 +143,23 @@ RWLock::~RWLock()
     reinterpret_cast<Impl*>(&_storage)->~Impl();
 }
 
-bool RWLock::TryLockRead() { return impl().TryLockRead(); }
-bool RWLock::TryLockWrite() { return impl().TryLockWrite(); }
+bool RWLock::TryLockRead()
+{
+    if (impl().TryLockRead())
+        return true;
+
+    CPPCOMMON_INSTRUMENT(_instrumentation, CONTENDED, 1);
+    return false;
+}
+
+bool RWLock::TryLockWrite()
+{
+    if (impl().TryLockWrite())
+        return true;
+
+    CPPCOMMON_INSTRUMENT(_instrumentation, CONTENDED, 1);
+    return false;
+}
 
 bool RWLock::TryLockReadFor(const Timespan& timespan)
 {
@@ -159,7 +174,8 @@ bool RWLock::TryLockReadFor(const Timespan& timespan)
         // Try lock or yield for the given timespan
         while (NanoTimestamp() < finish)
         {
-            if (TryLockRead())
+            CPPCOMMON_INSTRUMENT(_instrumentation, SPINS, 1);
+            if (impl().TryLockRead())
                 return true;
             else
                 Thread::Yield();
@@ -183,7 +199,8 @@ bool RWLock::TryLockWriteFor(const Timespan& timespan)
         // Try lock or yield for the given timespan
         while (NanoTimestamp() < finish)
         {
-            if (TryLockWrite())
+            CPPCOMMON_INSTRUMENT(_instrumentation, SPINS, 1);
+            if (impl().TryLockWrite())
                 return true;
             else
                 Thread::Yield();
@@ -194,8 +211,30 @@ bool RWLock::TryLockWriteFor(const Timespan& timespan)
     }
 }
 
-void RWLock::LockRead() { impl().LockRead(); }
-void RWLock::LockWrite() { impl().LockWrite(); }
+void RWLock::LockRead()
+{
+#if defined(CPPCOMMON_INSTRUMENTATION)
+    // Count the contended acquisition before the blocking one
+    if (impl().TryLockRead())
+        return;
+    CPPCOMMON_INSTRUMENT(_instrumentation, CONTENDED, 1);
+#endif
+
+    impl().LockRead();
+}
+
+void RWLock::LockWrite()
+{
+#if defined(CPPCOMMON_INSTRUMENTATION)
+    // Count the contended acquisition before the blocking one
+    if (impl().TryLockWrite())
+        return;
+    CPPCOMMON_INSTRUMENT(_instrumentation, CONTENDED, 1);
+#endif
+
+    impl().LockWrite();
+}
+
 void RWLock::UnlockRead() { impl().UnlockRead(); }
 void RWLock::UnlockWrite() { impl().UnlockWrite(); }
 
@@ -8,23 +8,11 @@
 
 #include "threads/semaphore.h"
 
-#include "errors/fatal.h"
+#include "threads/wait_strategy.h"
 #include "utility/validate_aligned_storage.h"
 
-#include <algorithm>
 #include <cassert>
 
-#if defined(__APPLE__)
-#include <dispatch/dispatch.h>
-#elif defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
-#include <fcntl.h>
-#include <semaphore.h>
-#elif defined(_WIN32) || defined(_WIN64)
-#include <windows.h>
-#undef max
-#undef min
-#endif
-
 namespace CppCommon {
 
 //! @cond INTERNALS
@@ -32,38 +20,9 @@ namespace CppCommon {
 class Semaphore::Impl
 {
 public:
-    explicit Impl(int resources) : _resources(resources)
+    explicit Impl(int resources) : _resources(resources), _count(resources), _waiters(0)
     {
         assert((resources > 0) && "Semaphore resources counter must be greater than zero!");
-
-#if defined(__APPLE__)
-        _semaphore = dispatch_semaphore_create(resources);
-        if (_semaphore == nullptr)
-            throwex SystemException("Failed to initialize a semaphore!");
-#elif defined(unix) || defined(__unix) || defined(__unix__)
-        int result = sem_init(&_semaphore, 0, resources);
-        if (result != 0)
-            throwex SystemException("Failed to initialize a semaphore!");
-#elif defined(_WIN32) || defined(_WIN64)
-        _semaphore = CreateSemaphore(nullptr, resources, resources, nullptr);
-        if (_semaphore == nullptr)
-            throwex SystemException("Failed to create a semaphore!");
-#endif
-    }
-
-    ~Impl()
-    {
-#if defined(__APPLE__)
-        if (_semaphore != nullptr)
-            dispatch_release(_semaphore);
-#elif defined(unix) || defined(__unix) || defined(__unix__)
-        int result = sem_destroy(&_semaphore);
-        if (result != 0)
-            fatality(SystemException("Failed to destroy a semaphore!"));
-#elif defined(_WIN32) || defined(_WIN64)
-        if (!CloseHandle(_semaphore))
-            fatality(SystemException("Failed to close a semaphore!"));
-#endif
     }
 
     int resources() const noexcept
@@ -73,82 +32,60 @@ public:
 
     bool TryLock()
     {
-#if defined(__APPLE__)
-        return (dispatch_semaphore_wait(_semaphore, DISPATCH_TIME_NOW) == 0);
-#elif defined(unix) || defined(__unix) || defined(__unix__)
-        int result = sem_trywait(&_semaphore);
-        if ((result != 0) && (errno != EAGAIN))
-            throwex SystemException("Failed to try lock a semaphore!");
-        return (result == 0);
-#elif defined(_WIN32) || defined(_WIN64)
-        DWORD result = WaitForSingleObject(_semaphore, 0);
-        if ((result != WAIT_OBJECT_0) && (result != WAIT_TIMEOUT))
-            throwex SystemException("Failed to try lock a semaphore!");
-        return (result == WAIT_OBJECT_0);
-#endif
+        // Uncontended lock is a single CAS in the user space
+        uint32_t count = _count.load(std::memory_order_relaxed);
+        while (count > 0)
+            if (_count.compare_exchange_weak(count, count - 1, std::memory_order_acquire, std::memory_order_relaxed))
+                return true;
+        return false;
     }
 
     bool TryLockFor(const Timespan& timespan)
     {
-        if (timespan < 0)
-            return TryLock();
-#if defined(__APPLE__)
-        dispatch_time_t timeout = dispatch_time(DISPATCH_TIME_NOW, timespan.nanoseconds());
-        return (dispatch_semaphore_wait(_semaphore, timeout) == 0);
-#elif defined(unix) || defined(__unix) || defined(__unix__)
-        struct timespec timeout;
-        timeout.tv_sec = timespan.seconds();
-        timeout.tv_nsec = timespan.nanoseconds() % 1000000000;
-        int result = sem_timedwait(&_semaphore, &timeout);
-        if ((result != 0) && (errno != ETIMEDOUT))
-            throwex SystemException("Failed to try lock a semaphore for the given timeout!");
-        return (result == 0);
-#elif defined(_WIN32) || defined(_WIN64)
-        DWORD result = WaitForSingleObject(_semaphore, std::max((DWORD)1, (DWORD)timespan.milliseconds()));
-        if ((result != WAIT_OBJECT_0) && (result != WAIT_TIMEOUT))
-            throwex SystemException("Failed to try lock a semaphore for the given timeout!");
-        return (result == WAIT_OBJECT_0);
-#endif
+        if (TryLock())
+            return true;
+        if (timespan <= 0)
+            return false;
+
+        // Wait for the released resource until the deadline
+        Timestamp deadline = NanoTimestamp() + timespan;
+        _waiters.fetch_add(1, std::memory_order_seq_cst);
+        bool result = false;
+        while (!(result = TryLock()))
+        {
+            Timestamp current = NanoTimestamp();
+            if (current >= deadline)
+                break;
+            WaitStrategy::ParkFor(_count, 0, deadline - current);
+        }
+        _waiters.fetch_sub(1, std::memory_order_relaxed);
+        return result;
     }
 
     void Lock()
     {
-#if defined(__APPLE__)
-        dispatch_semaphore_wait(_semaphore, DISPATCH_TIME_FOREVER);
-#elif defined(unix) || defined(__unix) || defined(__unix__)
-        int result = sem_wait(&_semaphore);
-        if (result != 0)
-            throwex SystemException("Failed to lock a semaphore!");
-#elif defined(_WIN32) || defined(_WIN64)
-        DWORD result = WaitForSingleObject(_semaphore, INFINITE);
-        if (result != WAIT_OBJECT_0)
-            throwex SystemException("Failed to lock a semaphore!");
-#endif
+        if (TryLock())
+            return;
+
+        // Wait for the released resource
+        _waiters.fetch_add(1, std::memory_order_seq_cst);
+        while (!TryLock())
+            WaitStrategy::Park(_count, 0);
+        _waiters.fetch_sub(1, std::memory_order_relaxed);
     }
 
     void Unlock()
     {
-#if defined(__APPLE__)
-        dispatch_semaphore_signal(_semaphore);
-#elif defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
-        int result = sem_post(&_semaphore);
-        if (result != 0)
-            throwex SystemException("Failed to unlock a semaphore!");
-#elif defined(_WIN32) || defined(_WIN64)
-        if (!ReleaseSemaphore(_semaphore, 1, nullptr))
-            throwex SystemException("Failed to unlock a semaphore!");
-#endif
+        // Order the released resource before the waiters check (pairs with the waiter registration)
+        _count.fetch_add(1, std::memory_order_seq_cst);
+        if (_waiters.load(std::memory_order_seq_cst) > 0)
+            WaitStrategy::WakeOne(_count);
     }
 
 private:
     int _resources;
-#if defined(__APPLE__)
-    dispatch_semaphore_t _semaphore;
-#elif defined(unix) || defined(__unix) || defined(__unix__)
-    sem_t _semaphore;
-#elif defined(_WIN32) || defined(_WIN64)
-    HANDLE _semaphore;
-#endif
+    std::atomic<uint32_t> _count;
+    std::atomic<uint32_t> _waiters;
 };
 
 //! @endcond
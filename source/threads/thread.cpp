@@ -8,19 +8,34 @@
 
 #include "threads/thread.h"
 
+#include "string/encoding.h"
 #include "system/cpu.h"
 #include "time/timestamp.h"
 
 #include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <functional>
+#include <mutex>
+#include <queue>
+#include <vector>
 
 #if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
 #include <errno.h>
 #include <pthread.h>
 #include <sched.h>
+#include <alloca.h>
 #include <time.h>
+#include <unistd.h>
+#if !defined(__APPLE__) && !defined(__CYGWIN__)
+#include <sys/mman.h>
+#include <sys/prctl.h>
+#include <sys/syscall.h>
+#endif
 #elif defined(_WIN32) || defined(_WIN64)
 #include <windows.h>
 #include <winternl.h>
+#include <malloc.h>
 #undef Yield
 #undef max
 #undef min
@@ -54,6 +69,277 @@ uint64_t SetMinimumTimerResolution()
 }
 #endif
 
+#if defined(unix) || defined(__unix) || defined(__unix__)
+#if !defined(__APPLE__) && !defined(__CYGWIN__)
+
+// Helper function to get the given thread CPU affinity set
+CPUSet GetAffinitySet(pthread_t thread)
+{
+    // Grow the dynamic CPU set until it covers all configured logical processors
+    int count = std::max((int)sysconf(_SC_NPROCESSORS_CONF), CPU_SETSIZE);
+    for (;;)
+    {
+        cpu_set_t* cpuset = CPU_ALLOC(count);
+        if (cpuset == nullptr)
+            throwex SystemException("Failed to allocate the thread CPU affinity set!");
+        size_t size = CPU_ALLOC_SIZE(count);
+        CPU_ZERO_S(size, cpuset);
+
+        int result = pthread_getaffinity_np(thread, size, cpuset);
+        if (result == 0)
+        {
+            CPUSet affinity;
+            for (int i = 0; i < count; ++i)
+                if (CPU_ISSET_S(i, size, cpuset))
+                    affinity.set(i);
+            CPU_FREE(cpuset);
+            return affinity;
+        }
+
+        CPU_FREE(cpuset);
+        if ((result != EINVAL) || (count >= (1 << 20)))
+            throwex SystemException("Failed to get the thread CPU affinity!", result);
+        count *= 2;
+    }
+}
+
+// Helper function to set the given thread CPU affinity set
+void SetAffinitySet(pthread_t thread, const CPUSet& affinity)
+{
+    int count = std::max(affinity.last() + 1, CPU_SETSIZE);
+    cpu_set_t* cpuset = CPU_ALLOC(count);
+    if (cpuset == nullptr)
+        throwex SystemException("Failed to allocate the thread CPU affinity set!");
+    size_t size = CPU_ALLOC_SIZE(count);
+    CPU_ZERO_S(size, cpuset);
+    for (int cpu = affinity.first(); cpu >= 0; cpu = affinity.next(cpu))
+        CPU_SET_S(cpu, size, cpuset);
+    int result = pthread_setaffinity_np(thread, size, cpuset);
+    CPU_FREE(cpuset);
+    if (result != 0)
+        throwex SystemException("Failed to set the thread CPU affinity!", result);
+}
+
+// Helper function to set the memory policy of the current thread
+void SetMemoryPolicy(int node)
+{
+    // Memory policy modes from <linux/mempolicy.h>
+    const int MPOL_DEFAULT = 0;
+    const int MPOL_PREFERRED = 1;
+
+    long result;
+    if (node < 0)
+        result = syscall(SYS_set_mempolicy, MPOL_DEFAULT, nullptr, 0);
+    else
+    {
+        std::vector<unsigned long> mask(node / (sizeof(unsigned long) * 8) + 1, 0);
+        mask[node / (sizeof(unsigned long) * 8)] |= 1ul << (node % (sizeof(unsigned long) * 8));
+        result = syscall(SYS_set_mempolicy, MPOL_PREFERRED, mask.data(), mask.size() * sizeof(unsigned long) * 8 + 1);
+    }
+    if (result != 0)
+        throwex SystemException("Failed to set the current thread NUMA memory policy!");
+}
+
+#endif
+#elif defined(_WIN32) || defined(_WIN64)
+
+// Multiple processor groups thread CPU set masks (Windows 11 and Windows Server 2022)
+typedef BOOL(WINAPI *GetThreadSelectedCpuSetMasksFunc)(HANDLE Thread, PGROUP_AFFINITY CpuSetMasks, USHORT CpuSetMaskCount, PUSHORT RequiredMaskCount);
+typedef BOOL(WINAPI *SetThreadSelectedCpuSetMasksFunc)(HANDLE Thread, PGROUP_AFFINITY CpuSetMasks, USHORT CpuSetMaskCount);
+
+// Helper function to split the CPU set into processor group masks
+std::vector<GROUP_AFFINITY> GetGroupMasks(const CPUSet& affinity)
+{
+    const size_t bits = sizeof(KAFFINITY) * 8;
+
+    std::vector<GROUP_AFFINITY> result;
+    for (int cpu = affinity.first(); cpu >= 0; cpu = affinity.next(cpu))
+    {
+        WORD group = (WORD)(cpu / bits);
+        if (result.empty() || (result.back().Group != group))
+        {
+            GROUP_AFFINITY ga;
+            ZeroMemory(&ga, sizeof(ga));
+            ga.Group = group;
+            result.push_back(ga);
+        }
+        result.back().Mask |= (KAFFINITY)1 << (cpu % bits);
+    }
+    return result;
+}
+
+// Helper function to get the given thread CPU affinity set
+CPUSet GetAffinitySet(HANDLE hThread)
+{
+    CPUSet affinity;
+
+    auto add = [&affinity](const GROUP_AFFINITY& ga)
+    {
+        for (size_t i = 0; i < sizeof(KAFFINITY) * 8; ++i)
+            if ((ga.Mask >> i) & 1)
+                affinity.set((int)(ga.Group * sizeof(KAFFINITY) * 8 + i));
+    };
+
+    // Try to get CPU set masks of multiple processor groups
+    static GetThreadSelectedCpuSetMasksFunc GetThreadSelectedCpuSetMasks = (GetThreadSelectedCpuSetMasksFunc)GetProcAddress(GetModuleHandle("kernel32.dll"), "GetThreadSelectedCpuSetMasks");
+    if (GetThreadSelectedCpuSetMasks != nullptr)
+    {
+        GROUP_AFFINITY masks[64];
+        USHORT count = 0;
+        if (GetThreadSelectedCpuSetMasks(hThread, masks, 64, &count) && (count > 0))
+        {
+            for (USHORT i = 0; i < count; ++i)
+                add(masks[i]);
+            return affinity;
+        }
+    }
+
+    GROUP_AFFINITY ga;
+    ZeroMemory(&ga, sizeof(ga));
+    if (!GetThreadGroupAffinity(hThread, &ga))
+        throwex SystemException("Failed to get the thread CPU affinity!");
+    add(ga);
+    return affinity;
+}
+
+// Helper function to set the given thread CPU affinity set
+void SetAffinitySet(HANDLE hThread, const CPUSet& affinity)
+{
+    std::vector<GROUP_AFFINITY> masks = GetGroupMasks(affinity);
+    if (masks.empty())
+        throwex SystemException("Failed to set the empty thread CPU affinity!");
+
+    // Multiple processor groups are supported only with thread CPU set masks
+    if (masks.size() > 1)
+    {
+        static SetThreadSelectedCpuSetMasksFunc SetThreadSelectedCpuSetMasks = (SetThreadSelectedCpuSetMasksFunc)GetProcAddress(GetModuleHandle("kernel32.dll"), "SetThreadSelectedCpuSetMasks");
+        if (SetThreadSelectedCpuSetMasks == nullptr)
+            throwex SystemException("Thread CPU affinity of multiple processor groups is not supported!");
+        if (!SetThreadSelectedCpuSetMasks(hThread, masks.data(), (USHORT)masks.size()))
+            throwex SystemException("Failed to set the thread CPU affinity!");
+        return;
+    }
+
+    if (!SetThreadGroupAffinity(hThread, &masks[0], nullptr))
+        throwex SystemException("Failed to set the thread CPU affinity!");
+}
+
+#endif
+
+
+// Dense thread indexes allocator
+class ThreadIndexes
+{
+public:
+    static ThreadIndexes& GetInstance()
+    { static ThreadIndexes instance; return instance; }
+
+    uint32_t count() const noexcept { return _count.load(std::memory_order_acquire); }
+
+    uint32_t Allocate()
+    {
+        std::scoped_lock locker(_lock);
+
+        // Reuse the smallest free index to keep indexes dense
+        if (!_free.empty())
+        {
+            uint32_t index = _free.top();
+            _free.pop();
+            return index;
+        }
+
+        uint32_t index = _count.load(std::memory_order_relaxed);
+        _count.store(index + 1, std::memory_order_release);
+        return index;
+    }
+
+    void Release(uint32_t index)
+    {
+        std::scoped_lock locker(_lock);
+        _free.push(index);
+    }
+
+private:
+    std::mutex _lock;
+    std::atomic<uint32_t> _count{0};
+    std::priority_queue<uint32_t, std::vector<uint32_t>, std::greater<uint32_t>> _free;
+};
+
+// Dense thread index holder which releases the index when the thread finishes
+struct ThreadIndexHolder
+{
+    uint32_t index;
+
+    ThreadIndexHolder() : index(ThreadIndexes::GetInstance().Allocate()) {}
+    ~ThreadIndexHolder() { ThreadIndexes::GetInstance().Release(index); }
+};
+
+// Current thread metadata
+thread_local ThreadInfo thread_info;
+thread_local bool thread_info_initialized = false;
+
+// Helper function to compute the current thread metadata
+void InitializeThreadInfo() noexcept
+{
+    ThreadInfo& info = thread_info;
+
+    static thread_local ThreadIndexHolder holder;
+    info.index = holder.index;
+
+#if defined(__APPLE__)
+    uint64_t tid = 0;
+    pthread_threadid_np(nullptr, &tid);
+    info.tid = tid;
+#elif defined(__CYGWIN__)
+    info.tid = (uint64_t)pthread_self();
+#elif defined(unix) || defined(__unix) || defined(__unix__)
+    info.tid = (uint64_t)syscall(SYS_gettid);
+#elif defined(_WIN32) || defined(_WIN64)
+    info.tid = GetCurrentThreadId();
+#endif
+
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+    if (pthread_getname_np(pthread_self(), info.name, sizeof(info.name)) != 0)
+        info.name[0] = 0;
+#elif defined(_WIN32) || defined(_WIN64)
+    // GetThreadDescription() is available since Windows 10 1607
+    static HRESULT(WINAPI *GetThreadDescription)(HANDLE hThread, PWSTR* ppszThreadDescription) = (HRESULT(WINAPI*)(HANDLE, PWSTR*))GetProcAddress(GetModuleHandle("kernel32.dll"), "GetThreadDescription");
+    PWSTR description = nullptr;
+    if ((GetThreadDescription != nullptr) && SUCCEEDED(GetThreadDescription(GetCurrentThread(), &description)))
+    {
+        std::string name = Encoding::ToUTF8(description);
+        size_t size = std::min(name.size(), sizeof(info.name) - 1);
+        std::memcpy(info.name, name.data(), size);
+        info.name[size] = 0;
+        LocalFree(description);
+    }
+#endif
+
+    try
+    {
+        info.affinity = Thread::GetAffinity();
+    }
+    catch (...)
+    {
+        info.affinity.set();
+    }
+
+    thread_info_initialized = true;
+}
+
+// Helper function to update the cached affinity of the current thread
+void UpdateThreadAffinity(const std::bitset<64>& affinity) noexcept
+{
+    if (thread_info_initialized)
+        thread_info.affinity = affinity;
+}
+
+#if defined(_WIN32) || defined(_WIN64)
+// Current thread scheduling policy and its MMCSS task handle
+thread_local ThreadScheduling thread_scheduling = ThreadScheduling::NORMAL;
+thread_local HANDLE thread_mmcss = nullptr;
+#endif
+
 } // namespace Internals
 //! @endcond
 
@@ -68,6 +354,44 @@ uint64_t Thread::CurrentThreadId() noexcept
 #endif
 }
 
+const ThreadInfo& Thread::CurrentThreadInfo() noexcept
+{
+    if (!Internals::thread_info_initialized)
+        Internals::InitializeThreadInfo();
+    return Internals::thread_info;
+}
+
+uint32_t Thread::ThreadIndexCount() noexcept
+{
+    return Internals::ThreadIndexes::GetInstance().count();
+}
+
+void Thread::SetName(const std::string& name)
+{
+    // Thread name is limited to 15 characters
+    std::string truncated = name.substr(0, sizeof(ThreadInfo::name) - 1);
+#if defined(__APPLE__)
+    int result = pthread_setname_np(truncated.c_str());
+    if (result != 0)
+        throwex SystemException("Failed to set the current thread name!", result);
+#elif defined(unix) || defined(__unix) || defined(__unix__)
+    int result = pthread_setname_np(pthread_self(), truncated.c_str());
+    if (result != 0)
+        throwex SystemException("Failed to set the current thread name!", result);
+#elif defined(_WIN32) || defined(_WIN64)
+    // SetThreadDescription() is available since Windows 10 1607
+    static HRESULT(WINAPI *SetThreadDescription)(HANDLE hThread, PCWSTR lpThreadDescription) = (HRESULT(WINAPI*)(HANDLE, PCWSTR))GetProcAddress(GetModuleHandle("kernel32.dll"), "SetThreadDescription");
+    if (SetThreadDescription != nullptr)
+        if (FAILED(SetThreadDescription(GetCurrentThread(), Encoding::FromUTF8(truncated).c_str())))
+            throwex SystemException("Failed to set the current thread name!");
+#endif
+
+    // Update the cached thread name
+    ThreadInfo& info = const_cast<ThreadInfo&>(CurrentThreadInfo());
+    std::memset(info.name, 0, sizeof(info.name));
+    std::memcpy(info.name, truncated.data(), truncated.size());
+}
+
 uint32_t Thread::CurrentThreadAffinity() noexcept
 {
 #if defined(__APPLE__) || defined(__CYGWIN__)
@@ -271,6 +595,7 @@ void Thread::SetAffinity(const std::bitset<64>& affinity)
     if (!SetThreadAffinityMask(GetCurrentThread(), dwThreadAffinityMask))
         throwex SystemException("Failed to set the current thread CPU affinity!");
 #endif
+    Internals::UpdateThreadAffinity(affinity);
 }
 
 void Thread::SetAffinity(std::thread& thread, const std::bitset<64>& affinity)
@@ -295,6 +620,111 @@ void Thread::SetAffinity(std::thread& thread, const std::bitset<64>& affinity)
 #endif
 }
 
+CPUSet Thread::GetAffinitySet()
+{
+#if defined(__APPLE__) || defined(__CYGWIN__)
+    CPUSet affinity;
+    for (int i = 0; i < CPU::Affinity(); ++i)
+        affinity.set(i);
+    return affinity;
+#elif defined(unix) || defined(__unix) || defined(__unix__)
+    return Internals::GetAffinitySet(pthread_self());
+#elif defined(_WIN32) || defined(_WIN64)
+    return Internals::GetAffinitySet(GetCurrentThread());
+#endif
+}
+
+CPUSet Thread::GetAffinitySet(std::thread& thread)
+{
+#if defined(__APPLE__) || defined(__CYGWIN__)
+    return GetAffinitySet();
+#elif defined(unix) || defined(__unix) || defined(__unix__)
+    return Internals::GetAffinitySet(thread.native_handle());
+#elif defined(_WIN32) || defined(_WIN64)
+    return Internals::GetAffinitySet((HANDLE)thread.native_handle());
+#endif
+}
+
+void Thread::SetAffinity(const CPUSet& affinity)
+{
+#if defined(__APPLE__)
+    throwex SystemException("Apple platform does not allow to set the current thread CPU affinity!");
+#elif defined(__CYGWIN__)
+    throwex SystemException("Cygwin platform does not allow to set the current thread CPU affinity!");
+#elif defined(unix) || defined(__unix) || defined(__unix__)
+    Internals::SetAffinitySet(pthread_self(), affinity);
+#elif defined(_WIN32) || defined(_WIN64)
+    Internals::SetAffinitySet(GetCurrentThread(), affinity);
+#endif
+    Internals::UpdateThreadAffinity(affinity.mask());
+}
+
+void Thread::SetAffinity(std::thread& thread, const CPUSet& affinity)
+{
+#if defined(__APPLE__)
+    throwex SystemException("Apple platform does not allow to set the given thread CPU affinity!");
+#elif defined(__CYGWIN__)
+    throwex SystemException("Cygwin platform does not allow to set the given thread CPU affinity!");
+#elif defined(unix) || defined(__unix) || defined(__unix__)
+    Internals::SetAffinitySet(thread.native_handle(), affinity);
+#elif defined(_WIN32) || defined(_WIN64)
+    Internals::SetAffinitySet((HANDLE)thread.native_handle(), affinity);
+#endif
+}
+
+int Thread::CurrentThreadNode()
+{
+    const CPUTopology& topology = CPU::Topology();
+    int cpu = (int)CurrentThreadAffinity();
+    for (const auto& processor : topology.processors())
+        if (processor.cpu == cpu)
+            return processor.node;
+    return 0;
+}
+
+void Thread::BindToNode(int node, bool memory)
+{
+#if defined(__APPLE__)
+    throwex SystemException("Apple platform does not allow to bind the current thread to NUMA node!");
+#elif defined(__CYGWIN__)
+    throwex SystemException("Cygwin platform does not allow to bind the current thread to NUMA node!");
+#else
+    const CPUTopology& topology = CPU::Topology();
+
+    // Unbind the current thread from NUMA node
+    if (node < 0)
+    {
+        SetAffinity(topology.All());
+#if defined(unix) || defined(__unix) || defined(__unix__)
+        if (memory)
+            Internals::SetMemoryPolicy(-1);
+#endif
+        return;
+    }
+
+    CPUSet cpus = topology.NodeCPUs(node);
+    if (cpus.none())
+        throwex SystemException("Failed to bind the current thread to the unknown NUMA node " + std::to_string(node) + "!");
+
+    SetAffinity(cpus);
+
+    if (memory)
+    {
+#if defined(unix) || defined(__unix) || defined(__unix__)
+        Internals::SetMemoryPolicy(node);
+#elif defined(_WIN32) || defined(_WIN64)
+        // Windows allocates memory from NUMA node of the thread ideal processor
+        PROCESSOR_NUMBER pn;
+        ZeroMemory(&pn, sizeof(pn));
+        pn.Group = (WORD)(cpus.first() / (sizeof(KAFFINITY) * 8));
+        pn.Number = (BYTE)(cpus.first() % (sizeof(KAFFINITY) * 8));
+        if (!SetThreadIdealProcessorEx(GetCurrentThread(), &pn, nullptr))
+            throwex SystemException("Failed to set the current thread ideal processor!");
+#endif
+    }
+#endif
+}
+
 ThreadPriority Thread::GetPriority()
 {
 #if defined(__CYGWIN__)
@@ -527,4 +957,137 @@ void Thread::SetPriority(std::thread& thread, ThreadPriority priority)
 #endif
 }
 
+ThreadScheduling Thread::GetScheduling()
+{
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+    int policy;
+    struct sched_param sched;
+    int result = pthread_getschedparam(pthread_self(), &policy, &sched);
+    if (result != 0)
+        throwex SystemException("Failed to get the current thread scheduling policy!", result);
+    if (policy == SCHED_FIFO)
+        return ThreadScheduling::FIFO;
+    else if (policy == SCHED_RR)
+        return ThreadScheduling::RR;
+    else
+        return ThreadScheduling::NORMAL;
+#elif defined(_WIN32) || defined(_WIN64)
+    return Internals::thread_scheduling;
+#endif
+}
+
+void Thread::SetScheduling(ThreadScheduling scheduling, int priority)
+{
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+    int policy = SCHED_OTHER;
+    struct sched_param sched;
+    sched.sched_priority = 0;
+    if (scheduling != ThreadScheduling::NORMAL)
+    {
+        policy = (scheduling == ThreadScheduling::FIFO) ? SCHED_FIFO : SCHED_RR;
+        sched.sched_priority = std::clamp(priority, sched_get_priority_min(policy), sched_get_priority_max(policy));
+    }
+
+    int result = pthread_setschedparam(pthread_self(), policy, &sched);
+    if (result != 0)
+        throwex SystemException("Failed to set the current thread scheduling policy!", result);
+#elif defined(_WIN32) || defined(_WIN64)
+    // Multimedia Class Scheduler Service is loaded dynamically from avrt.dll
+    static HMODULE hAvrt = LoadLibraryA("avrt.dll");
+    static HANDLE(WINAPI *AvSetMmThreadCharacteristicsW)(LPCWSTR TaskName, LPDWORD TaskIndex) = (hAvrt != nullptr) ? (HANDLE(WINAPI*)(LPCWSTR, LPDWORD))GetProcAddress(hAvrt, "AvSetMmThreadCharacteristicsW") : nullptr;
+    static BOOL(WINAPI *AvSetMmThreadPriority)(HANDLE AvrtHandle, int Priority) = (hAvrt != nullptr) ? (BOOL(WINAPI*)(HANDLE, int))GetProcAddress(hAvrt, "AvSetMmThreadPriority") : nullptr;
+    static BOOL(WINAPI *AvRevertMmThreadCharacteristics)(HANDLE AvrtHandle) = (hAvrt != nullptr) ? (BOOL(WINAPI*)(HANDLE))GetProcAddress(hAvrt, "AvRevertMmThreadCharacteristics") : nullptr;
+
+    if (scheduling == ThreadScheduling::NORMAL)
+    {
+        if ((Internals::thread_mmcss != nullptr) && (AvRevertMmThreadCharacteristics != nullptr))
+            AvRevertMmThreadCharacteristics(Internals::thread_mmcss);
+        Internals::thread_mmcss = nullptr;
+
+        if (!SetThreadPriority(GetCurrentThread(), THREAD_PRIORITY_NORMAL))
+            throwex SystemException("Failed to set the current thread scheduling policy!");
+    }
+    else if ((AvSetMmThreadCharacteristicsW != nullptr) && (AvSetMmThreadPriority != nullptr))
+    {
+        if (Internals::thread_mmcss == nullptr)
+        {
+            DWORD dwTaskIndex = 0;
+            Internals::thread_mmcss = AvSetMmThreadCharacteristicsW(L"Pro Audio", &dwTaskIndex);
+            if (Internals::thread_mmcss == nullptr)
+                throwex SystemException("Failed to register the current thread in MMCSS!");
+        }
+
+        // Map the real-time priority to AVRT_PRIORITY_LOW..AVRT_PRIORITY_CRITICAL
+        int nPriority = (priority >= 90) ? 2 : ((priority >= 70) ? 1 : ((priority >= 30) ? 0 : -1));
+        if (!AvSetMmThreadPriority(Internals::thread_mmcss, nPriority))
+            throwex SystemException("Failed to set the current thread MMCSS priority!");
+    }
+    else
+    {
+        if (!SetThreadPriority(GetCurrentThread(), THREAD_PRIORITY_TIME_CRITICAL))
+            throwex SystemException("Failed to set the current thread scheduling policy!");
+    }
+
+    Internals::thread_scheduling = scheduling;
+#endif
+}
+
+void Thread::SetTimerSlack(uint64_t nanoseconds)
+{
+#if defined(__APPLE__) || defined(__CYGWIN__)
+    (void)nanoseconds;
+#elif defined(unix) || defined(__unix) || defined(__unix__)
+    if (prctl(PR_SET_TIMERSLACK, (unsigned long)nanoseconds) != 0)
+        throwex SystemException("Failed to set the current thread timer slack!");
+#elif defined(_WIN32) || defined(_WIN64)
+    (void)nanoseconds;
+#endif
+}
+
+void Thread::PrefaultStack(size_t size)
+{
+    if (size == 0)
+        return;
+
+    // Allocate the given size on the current thread stack
+#if defined(_WIN32) || defined(_WIN64)
+    volatile uint8_t* stack = (volatile uint8_t*)_alloca(size);
+#else
+    volatile uint8_t* stack = (volatile uint8_t*)alloca(size);
+#endif
+
+    // Touch each page of the allocated stack from its top downwards
+    const size_t page = 4096;
+    for (size_t offset = size; offset > 0; offset -= std::min(offset, page))
+        stack[offset - 1] = 0;
+}
+
+void Thread::SetupLatencyCritical(const ThreadLatencySetup& setup)
+{
+    // Avoid page faults of the process memory
+    if (setup.lock_memory)
+    {
+#if defined(unix) || defined(__unix) || defined(__unix__)
+#if !defined(__APPLE__) && !defined(__CYGWIN__)
+        if (mlockall(MCL_CURRENT | MCL_FUTURE) != 0)
+            throwex SystemException("Failed to lock the process memory!");
+#endif
+#endif
+    }
+
+    // Avoid migrations between logical processors
+    if (setup.cpu >= 0)
+        SetAffinity(CPUSet({ setup.cpu }));
+
+    // Avoid delayed wakeups
+    if (setup.timer_slack > 0)
+        SetTimerSlack(setup.timer_slack);
+
+    // Avoid page faults of the thread stack
+    PrefaultStack(setup.prefault_stack);
+
+    // Avoid scheduler preemption
+    SetScheduling(setup.scheduling, setup.priority);
+}
+
 } // namespace CppCommon
@@ -0,0 +1,145 @@
+/*!
+    \file thread_pool.cpp
+    \brief Work-stealing thread pool implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "threads/thread_pool.h"
+
+#include "system/cpu.h"
+#include "threads/thread.h"
+
+#include <algorithm>
+
+namespace CppCommon {
+
+thread_local ThreadPool::Worker* ThreadPool::_current = nullptr;
+
+ThreadPool::ThreadPool(size_t threads, ThreadPoolAffinity affinity, size_t capacity)
+    : _affinity(affinity), _nodes(_auxiliary), _injection(capacity), _stop(false), _overflows(0)
+{
+    // Calculate workers count
+    int cores = CPU::PhysicalCores();
+    size_t physical = (cores > 0) ? (size_t)cores : std::max((size_t)std::thread::hardware_concurrency(), (size_t)1);
+    if (threads == 0)
+        threads = physical;
+    if (affinity == ThreadPoolAffinity::PHYSICAL_CORES)
+        threads = std::min(threads, std::min(physical, (size_t)64));
+
+    // Create all workers before start, so thieves could safely visit them
+    _workers.reserve(threads);
+    for (size_t i = 0; i < threads; ++i)
+        _workers.emplace_back(std::make_unique<Worker>(this, i, capacity));
+
+    // Start workers threads
+    for (auto& worker : _workers)
+        worker->thread = Thread::Start([this, current = worker.get()]() { Run(*current); });
+}
+
+ThreadPool::~ThreadPool()
+{
+    // Stop workers threads after all submitted tasks are executed
+    _stop.store(true, std::memory_order_release);
+    _idle.Notify();
+
+    for (auto& worker : _workers)
+        worker->thread.join();
+}
+
+int ThreadPool::CurrentWorker() const noexcept
+{
+    Worker* worker = _current;
+    return ((worker != nullptr) && (worker->pool == this)) ? (int)worker->index : -1;
+}
+
+void ThreadPool::Run(Worker& worker)
+{
+    _current = &worker;
+
+    // Pin the worker to its own core (pinning is not supported on some platforms)
+    if (_affinity == ThreadPoolAffinity::PHYSICAL_CORES)
+    {
+        try
+        {
+            CPUSet mask;
+            mask.set((int)worker.index);
+            Thread::SetAffinity(mask);
+        }
+        catch (const SystemException&) {}
+    }
+
+    for (;;)
+    {
+        Node* node = Find(worker);
+        if (node != nullptr)
+        {
+            Execute(node);
+            continue;
+        }
+
+        // Stop the worker when there are no more queued tasks
+        if (_stop.load(std::memory_order_acquire))
+        {
+            if (!Pending())
+                break;
+            continue;
+        }
+
+        _idle.Wait([this]() { return _stop.load(std::memory_order_acquire) || Pending(); });
+    }
+
+    _current = nullptr;
+}
+
+ThreadPool::Node* ThreadPool::Find(Worker& worker)
+{
+    Node* node;
+
+    // Pop the most recent task from the own deque
+    if (worker.deque.Pop(node))
+        return node;
+
+    // Take the task submitted from outside of the thread pool
+    if (_injection.Dequeue(node))
+        return node;
+
+    // Steal the oldest task from other workers starting with the random victim
+    size_t count = _workers.size();
+    if (count > 1)
+    {
+        worker.random ^= worker.random << 13;
+        worker.random ^= worker.random >> 7;
+        worker.random ^= worker.random << 17;
+        size_t victim = (size_t)(worker.random % count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            Worker& other = *_workers[(victim + i) % count];
+            if ((&other != &worker) && other.deque.Steal(node))
+                return node;
+        }
+    }
+
+    return nullptr;
+}
+
+bool ThreadPool::Pending() const noexcept
+{
+    if (!_injection.empty())
+        return true;
+
+    for (auto& worker : _workers)
+        if (!worker->deque.empty())
+            return true;
+
+    return false;
+}
+
+void ThreadPool::Execute(Node* node)
+{
+    node->task();
+    _nodes.Release(node);
+}
+
+} // namespace CppCommon
@@ -0,0 +1,407 @@
+/*!
+    \file timer_queue.cpp
+    \brief Timer queue implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "threads/timer_queue.h"
+
+#include "threads/thread.h"
+
+#include <algorithm>
+#include <chrono>
+#include <limits>
+
+namespace CppCommon {
+
+TimerQueue::TimerQueue(const Timespan& resolution)
+    : _resolution((resolution.total() > 0) ? (uint64_t)resolution.total() : 1),
+      _current(0),
+      _size(0),
+      _active(0),
+      _counts(),
+      _slots(LEVELS * SLOTS, NIL),
+      _free(NIL),
+      _wakeup(0),
+      _running(false),
+      _stop(false)
+{
+    _current = ticks(NanoTimestamp().total());
+}
+
+TimerQueue::~TimerQueue()
+{
+    Stop();
+}
+
+size_t TimerQueue::size() const
+{
+    std::scoped_lock locker(_lock);
+    return _active;
+}
+
+TimerQueue::Handle TimerQueue::Insert(uint64_t expire, uint64_t period, Callback&& callback)
+{
+    bool notify = false;
+    Handle result;
+    {
+        std::scoped_lock locker(_lock);
+
+        // Reuse the free timer node or allocate a new one
+        uint32_t index = _free;
+        if (index != NIL)
+            _free = _timers[index].next;
+        else
+        {
+            assert((_timers.size() < NIL) && "Timer queue is exhausted!");
+            index = (uint32_t)_timers.size();
+            _timers.emplace_back(index);
+        }
+
+        Timer& timer = _timers[index];
+        timer.state = TimerState::SCHEDULED;
+        timer.cancelled = false;
+        timer.tick = std::max(ticks(expire), _current);
+        timer.expire = expire;
+        timer.period = period;
+        timer.callback = std::move(callback);
+        Link(index);
+        ++_active;
+
+        // Wake up the waiting timer thread if the new deadline is earlier
+        notify = (expire < _wakeup);
+        result = MakeHandle(timer.generation, index);
+    }
+    if (notify)
+        _cv.notify_one();
+    return result;
+}
+
+bool TimerQueue::Cancel(Handle handle)
+{
+    uint32_t index = (uint32_t)(handle & 0xFFFFFFFF);
+    uint32_t generation = (uint32_t)(handle >> 32);
+
+    std::scoped_lock locker(_lock);
+
+    if (index >= _timers.size())
+        return false;
+
+    Timer& timer = _timers[index];
+    if ((timer.generation != generation) || (timer.state == TimerState::FREE))
+        return false;
+
+    // Running timer will be released after its callback returns
+    if (timer.state == TimerState::RUNNING)
+    {
+        timer.cancelled = true;
+        return false;
+    }
+
+    Unlink(index);
+    Release(index);
+    return true;
+}
+
+Timestamp TimerQueue::NextDeadline() const
+{
+    std::scoped_lock locker(_lock);
+    uint64_t nearest = Nearest();
+    return Timestamp((nearest != std::numeric_limits<uint64_t>::max()) ? nearest : 0);
+}
+
+size_t TimerQueue::Tick(const Timestamp& now, size_t limit)
+{
+    std::scoped_lock ticker(_tick_lock);
+
+    uint64_t timestamp = now.total();
+
+    {
+        std::scoped_lock locker(_lock);
+        Collect(timestamp, limit);
+    }
+
+    if (_expired.empty())
+        return 0;
+
+    // Call expired callbacks without the timer queue lock
+    for (auto timer : _expired)
+        Call(timer->callback);
+
+    bool notify = false;
+    {
+        std::scoped_lock locker(_lock);
+
+        // Schedule periodic timers again and release others
+        for (auto timer : _expired)
+        {
+            if ((timer->period > 0) && !timer->cancelled)
+            {
+                // Skip missed periods to avoid the burst of calls
+                uint64_t expire = timer->expire + timer->period;
+                if (expire <= timestamp)
+                    expire += ((timestamp - expire) / timer->period + 1) * timer->period;
+                timer->state = TimerState::SCHEDULED;
+                timer->tick = std::max(ticks(expire), _current);
+                timer->expire = expire;
+                Link(timer->index);
+                notify = notify || (expire < _wakeup);
+            }
+            else
+                Release(timer->index);
+        }
+    }
+    if (notify)
+        _cv.notify_one();
+
+    size_t result = _expired.size();
+    _expired.clear();
+    return result;
+}
+
+bool TimerQueue::Start()
+{
+    std::scoped_lock locker(_thread_lock);
+
+    if (_running.load(std::memory_order_relaxed))
+        return false;
+
+    {
+        std::scoped_lock lock(_lock);
+        _stop = false;
+    }
+
+    _thread = Thread::Start([this]() { Run(); });
+    _running.store(true, std::memory_order_release);
+    return true;
+}
+
+bool TimerQueue::Stop()
+{
+    std::scoped_lock locker(_thread_lock);
+
+    if (!_running.load(std::memory_order_relaxed))
+        return false;
+
+    {
+        std::scoped_lock lock(_lock);
+        _stop = true;
+    }
+    _cv.notify_all();
+
+    _thread.join();
+    _running.store(false, std::memory_order_release);
+    return true;
+}
+
+void TimerQueue::Link(uint32_t index)
+{
+    Timer& timer = _timers[index];
+
+    // Find the nearest level which covers the timer tick
+    size_t slot = NIL;
+    uint64_t delta = timer.tick - _current;
+    for (size_t level = 0; level < LEVELS; ++level)
+    {
+        if (delta < ((uint64_t)1 << (SLOT_BITS * (level + 1))))
+        {
+            slot = level * SLOTS + ((timer.tick >> (SLOT_BITS * level)) & SLOT_MASK);
+            break;
+        }
+    }
+
+    // Keep the tick beyond all levels in the farthest slot of the last level
+    if (slot == NIL)
+    {
+        uint64_t tick = _current + ((uint64_t)1 << (SLOT_BITS * LEVELS)) - 1;
+        slot = (LEVELS - 1) * SLOTS + ((tick >> (SLOT_BITS * (LEVELS - 1))) & SLOT_MASK);
+    }
+
+    // Push the timer to the front of the slot list
+    timer.slot = (uint32_t)slot;
+    timer.prev = NIL;
+    timer.next = _slots[slot];
+    if (timer.next != NIL)
+        _timers[timer.next].prev = index;
+    _slots[slot] = index;
+    ++_counts[slot >> SLOT_BITS];
+    ++_size;
+}
+
+void TimerQueue::Unlink(uint32_t index)
+{
+    Timer& timer = _timers[index];
+
+    if (timer.prev != NIL)
+        _timers[timer.prev].next = timer.next;
+    else
+        _slots[timer.slot] = timer.next;
+    if (timer.next != NIL)
+        _timers[timer.next].prev = timer.prev;
+
+    --_counts[timer.slot >> SLOT_BITS];
+    --_size;
+    timer.slot = NIL;
+    timer.prev = NIL;
+    timer.next = NIL;
+}
+
+void TimerQueue::Release(uint32_t index)
+{
+    Timer& timer = _timers[index];
+
+    // Change the generation to reject stale handles of the released timer
+    timer.callback = nullptr;
+    timer.state = TimerState::FREE;
+    if (++timer.generation == 0)
+        timer.generation = 1;
+    timer.next = _free;
+    _free = index;
+    --_active;
+}
+
+void TimerQueue::Cascade()
+{
+    for (size_t level = 1; level < LEVELS; ++level)
+    {
+        size_t index = (size_t)((_current >> (SLOT_BITS * level)) & SLOT_MASK);
+        size_t slot = level * SLOTS + index;
+        uint32_t current = _slots[slot];
+        _slots[slot] = NIL;
+        while (current != NIL)
+        {
+            Timer& timer = _timers[current];
+            uint32_t next = timer.next;
+            --_counts[level];
+            --_size;
+            timer.tick = std::max(timer.tick, _current);
+            Link(current);
+            current = next;
+        }
+        if (index != 0)
+            break;
+    }
+}
+
+void TimerQueue::Collect(uint64_t now, size_t limit)
+{
+    uint64_t target = ticks(now);
+
+    while (_size > 0)
+    {
+        // Collect expired timers of the current slot
+        uint32_t current = _slots[_current & SLOT_MASK];
+        while (current != NIL)
+        {
+            if ((limit > 0) && (_expired.size() >= limit))
+                break;
+
+            Timer& timer = _timers[current];
+            uint32_t next = timer.next;
+            if (timer.expire <= now)
+            {
+                Unlink(current);
+                timer.state = TimerState::RUNNING;
+                _expired.push_back(&timer);
+            }
+            current = next;
+        }
+
+        // Stop with the current slot if the limit is reached or the target tick is reached
+        if (((limit > 0) && (_expired.size() >= limit)) || (_current >= target))
+            break;
+
+        // Skip empty levels up to the next cascade of the first non empty level or the target tick
+        size_t level = 0;
+        while ((level < (LEVELS - 1)) && (_counts[level] == 0))
+            ++level;
+        if (level > 0)
+        {
+            uint64_t next = ((_current >> (SLOT_BITS * level)) + 1) << (SLOT_BITS * level);
+            if (next > target)
+            {
+                _current = target;
+                break;
+            }
+            _current = next;
+        }
+        else
+            ++_current;
+
+        // Cascade timers of far levels
+        if ((_current & SLOT_MASK) == 0)
+            Cascade();
+    }
+
+    // Move the current tick forward for the empty timer wheel
+    if ((_size == 0) && (_current < target))
+        _current = target;
+}
+
+uint64_t TimerQueue::Nearest() const
+{
+    uint64_t result = std::numeric_limits<uint64_t>::max();
+
+    if (_size == 0)
+        return result;
+
+    // Find the first non empty slot of the first level
+    if (_counts[0] > 0)
+    {
+        for (size_t i = 0; i < SLOTS; ++i)
+        {
+            uint32_t current = _slots[(_current + i) & SLOT_MASK];
+            if (current == NIL)
+                continue;
+            for (; current != NIL; current = _timers[current].next)
+                result = std::min(result, _timers[current].expire);
+            break;
+        }
+    }
+
+    // Far timers are not earlier than the next cascade of the first non empty far level
+    for (size_t level = 1; level < LEVELS; ++level)
+    {
+        if (_counts[level] > 0)
+        {
+            uint64_t next = ((_current >> (SLOT_BITS * level)) + 1) << (SLOT_BITS * level);
+            result = std::min(result, next * _resolution);
+            break;
+        }
+    }
+
+    return result;
+}
+
+void TimerQueue::Run()
+{
+    for (;;)
+    {
+        Tick();
+
+        std::unique_lock<std::mutex> locker(_lock);
+
+        if (_stop)
+            break;
+
+        // Sleep until the nearest deadline or the new earlier timer
+        uint64_t nearest = Nearest();
+        uint64_t now = NanoTimestamp().total();
+        if (nearest > now)
+        {
+            _wakeup = nearest;
+            if (nearest == std::numeric_limits<uint64_t>::max())
+                _cv.wait(locker);
+            else
+                _cv.wait_for(locker, std::chrono::nanoseconds(nearest - now));
+            _wakeup = 0;
+        }
+
+        if (_stop)
+            break;
+    }
+}
+
+} // namespace CppCommon
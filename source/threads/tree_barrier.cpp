@@ -0,0 +1,58 @@
+/*!
+    \file tree_barrier.cpp
+    \brief Combining tree spin barrier synchronization primitive implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "threads/tree_barrier.h"
+
+#include <vector>
+
+namespace CppCommon {
+
+TreeBarrier::TreeBarrier(int threads, int fanin)
+    : _phase(0), _threads(threads), _fanin(fanin)
+{
+    assert((threads > 0) && "Count of barrier threads must be greater than zero!");
+    assert((fanin > 1) && "Barrier tree node fan-in must be greater than one!");
+
+    // Calculate tree levels sizes from leaves to the root
+    std::vector<size_t> levels;
+    size_t count = ((size_t)threads + fanin - 1) / fanin;
+    levels.push_back(count);
+    while (count > 1)
+    {
+        count = (count + fanin - 1) / fanin;
+        levels.push_back(count);
+    }
+
+    size_t total = 0;
+    for (auto level : levels)
+        total += level;
+
+    _nodes = std::make_unique<Node[]>(total);
+
+    // Leaf nodes are expected to be reached by threads
+    for (int thread = 0; thread < threads; ++thread)
+        ++_nodes[thread / fanin].expected;
+
+    // Link each level nodes with parent nodes of the next level
+    size_t base = 0;
+    for (size_t level = 0; (level + 1) < levels.size(); ++level)
+    {
+        size_t next = base + levels[level];
+        for (size_t i = 0; i < levels[level]; ++i)
+        {
+            _nodes[base + i].parent = (uint32_t)(next + i / fanin);
+            ++_nodes[next + i / fanin].expected;
+        }
+        base = next;
+    }
+
+    for (size_t i = 0; i < total; ++i)
+        _nodes[i].count.store(_nodes[i].expected, std::memory_order_relaxed);
+}
+
+} // namespace CppCommon
@@ -0,0 +1,134 @@
+/*!
+    \file wait_strategy.cpp
+    \brief Wait strategy synchronization primitive implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "threads/wait_strategy.h"
+
+#include <climits>
+
+#if defined(linux) || defined(__linux) || defined(__linux__)
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <errno.h>
+#include <time.h>
+#include <unistd.h>
+#elif defined(_WIN32) || defined(_WIN64)
+#include <windows.h>
+#undef max
+#undef min
+#else
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#endif
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+
+namespace Internals {
+
+#if !defined(linux) && !defined(__linux) && !defined(__linux__) && !defined(_WIN32) && !defined(_WIN64)
+
+// Parking lot of monitors striped by the address for platforms without futex
+struct ParkingLot
+{
+    static const size_t SIZE = 64;
+
+    struct Bucket
+    {
+        std::mutex lock;
+        std::condition_variable cv;
+    };
+
+    Bucket buckets[SIZE];
+
+    static Bucket& bucket(const void* address)
+    {
+        static ParkingLot instance;
+        return instance.buckets[(((uintptr_t)address) >> 6) % SIZE];
+    }
+};
+
+#endif
+
+} // namespace Internals
+
+//! @endcond
+
+void WaitStrategy::Park(std::atomic<uint32_t>& address, uint32_t value) noexcept
+{
+    static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t), "Atomic value must be lock-free to park on its address!");
+
+#if defined(linux) || defined(__linux) || defined(__linux__)
+    // Spurious wake-ups and interrupts are handled by the caller
+    syscall(SYS_futex, (uint32_t*)&address, FUTEX_WAIT_PRIVATE, value, nullptr, nullptr, 0);
+#elif defined(_WIN32) || defined(_WIN64)
+    WaitOnAddress((volatile VOID*)&address, &value, sizeof(value), INFINITE);
+#else
+    auto& bucket = Internals::ParkingLot::bucket(&address);
+    std::unique_lock<std::mutex> lock(bucket.lock);
+    if (address.load(std::memory_order_acquire) == value)
+        bucket.cv.wait(lock);
+#endif
+}
+
+bool WaitStrategy::ParkFor(std::atomic<uint32_t>& address, uint32_t value, const Timespan& timespan) noexcept
+{
+    if (timespan.total() <= 0)
+        return false;
+
+#if defined(linux) || defined(__linux) || defined(__linux__)
+    // Futex timeout is relative to the current time
+    struct timespec timeout;
+    timeout.tv_sec = (time_t)timespan.seconds();
+    timeout.tv_nsec = (long)(timespan.nanoseconds() % 1000000000);
+    long result = syscall(SYS_futex, (uint32_t*)&address, FUTEX_WAIT_PRIVATE, value, &timeout, nullptr, 0);
+    return !((result != 0) && (errno == ETIMEDOUT));
+#elif defined(_WIN32) || defined(_WIN64)
+    // Round the timeout up to milliseconds, so the caller does not spin near the deadline
+    DWORD milliseconds = (DWORD)((timespan.total() + 999999) / 1000000);
+    if (!WaitOnAddress((volatile VOID*)&address, &value, sizeof(value), milliseconds))
+        return (GetLastError() != ERROR_TIMEOUT);
+    return true;
+#else
+    auto& bucket = Internals::ParkingLot::bucket(&address);
+    std::unique_lock<std::mutex> lock(bucket.lock);
+    if (address.load(std::memory_order_acquire) == value)
+        return (bucket.cv.wait_for(lock, std::chrono::nanoseconds(timespan.total())) == std::cv_status::no_timeout);
+    return true;
+#endif
+}
+
+void WaitStrategy::Wake(std::atomic<uint32_t>& address) noexcept
+{
+#if defined(linux) || defined(__linux) || defined(__linux__)
+    syscall(SYS_futex, (uint32_t*)&address, FUTEX_WAKE_PRIVATE, INT_MAX, nullptr, nullptr, 0);
+#elif defined(_WIN32) || defined(_WIN64)
+    WakeByAddressAll((PVOID)&address);
+#else
+    auto& bucket = Internals::ParkingLot::bucket(&address);
+    {
+        std::lock_guard<std::mutex> lock(bucket.lock);
+    }
+    bucket.cv.notify_all();
+#endif
+}
+
+void WaitStrategy::WakeOne(std::atomic<uint32_t>& address) noexcept
+{
+#if defined(linux) || defined(__linux) || defined(__linux__)
+    syscall(SYS_futex, (uint32_t*)&address, FUTEX_WAKE_PRIVATE, 1, nullptr, nullptr, 0);
+#elif defined(_WIN32) || defined(_WIN64)
+    WakeByAddressSingle((PVOID)&address);
+#else
+    // Monitors are shared between addresses of the bucket, so wake all of them
+    Wake(address);
+#endif
+}
+
+} // namespace CppCommon
@@ -0,0 +1,168 @@
+/*!
+    \file coarse_clock.cpp
+    \brief Coarse cached clock implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "time/coarse_clock.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+#if defined(__linux__)
+#include <time.h>
+#elif defined(_WIN32) || defined(_WIN64)
+#include <windows.h>
+#endif
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+namespace Internals {
+
+class CoarseTicker
+{
+public:
+    CoarseTicker() : _started(false), _stop(false), _utc(0), _nano(0) {}
+
+    ~CoarseTicker()
+    {
+        Stop();
+    }
+
+    bool IsStarted() const noexcept { return _started; }
+
+    bool Start(const Timespan& resolution)
+    {
+        std::scoped_lock locker(_lock);
+
+        if (_started)
+            return false;
+
+        // Prepare cached values before the first tick
+        _utc.store(Timestamp::utc(), std::memory_order_relaxed);
+        _nano.store(Timestamp::nano(), std::memory_order_relaxed);
+
+        _stop = false;
+        _started = true;
+        _thread = std::thread([this, resolution]() { Tick(resolution); });
+        return true;
+    }
+
+    bool Stop()
+    {
+        std::scoped_lock locker(_lock);
+
+        if (!_started)
+            return false;
+
+        {
+            std::scoped_lock tick_locker(_tick_lock);
+            _stop = true;
+            _cond.notify_one();
+        }
+
+        _thread.join();
+
+        // Reset cached values to read coarse system clocks
+        _utc.store(0, std::memory_order_relaxed);
+        _nano.store(0, std::memory_order_relaxed);
+        _started = false;
+        return true;
+    }
+
+    uint64_t utc() const noexcept { return _utc.load(std::memory_order_relaxed); }
+    uint64_t nano() const noexcept { return _nano.load(std::memory_order_relaxed); }
+
+private:
+    std::mutex _lock;
+    std::mutex _tick_lock;
+    std::condition_variable _cond;
+    std::thread _thread;
+    std::atomic<bool> _started;
+    bool _stop;
+    std::atomic<uint64_t> _utc;
+    std::atomic<uint64_t> _nano;
+
+    void Tick(const Timespan& resolution)
+    {
+        std::unique_lock<std::mutex> locker(_tick_lock);
+        while (!_cond.wait_for(locker, resolution.chrono(), [this]() { return _stop; }))
+        {
+            _utc.store(Timestamp::utc(), std::memory_order_relaxed);
+            _nano.store(Timestamp::nano(), std::memory_order_relaxed);
+        }
+    }
+};
+
+CoarseTicker& GetCoarseTicker()
+{
+    static CoarseTicker ticker;
+    return ticker;
+}
+
+} // namespace Internals
+//! @endcond
+
+bool CoarseClock::IsStarted() noexcept
+{
+    return Internals::GetCoarseTicker().IsStarted();
+}
+
+bool CoarseClock::Start(const Timespan& resolution)
+{
+    return Internals::GetCoarseTicker().Start(resolution);
+}
+
+bool CoarseClock::Stop()
+{
+    return Internals::GetCoarseTicker().Stop();
+}
+
+uint64_t CoarseClock::utc()
+{
+    // Cached value is zero if the coarse clock ticker is stopped
+    uint64_t result = Internals::GetCoarseTicker().utc();
+    if (result != 0)
+        return result;
+
+#if defined(__linux__)
+    struct timespec timestamp;
+    if (clock_gettime(CLOCK_REALTIME_COARSE, &timestamp) != 0)
+        throwex SystemException("Cannot get value of CLOCK_REALTIME_COARSE timer!");
+    return (timestamp.tv_sec * 1000000000) + timestamp.tv_nsec;
+#elif defined(_WIN32) || defined(_WIN64)
+    FILETIME ft;
+    GetSystemTimeAsFileTime(&ft);
+
+    ULARGE_INTEGER value;
+    value.LowPart = ft.dwLowDateTime;
+    value.HighPart = ft.dwHighDateTime;
+    return (value.QuadPart - 116444736000000000ull) * 100;
+#else
+    return Timestamp::utc();
+#endif
+}
+
+uint64_t CoarseClock::nano()
+{
+    // Cached value is zero if the coarse clock ticker is stopped
+    uint64_t result = Internals::GetCoarseTicker().nano();
+    if (result != 0)
+        return result;
+
+#if defined(__linux__)
+    struct timespec timestamp;
+    if (clock_gettime(CLOCK_MONOTONIC_COARSE, &timestamp) != 0)
+        throwex SystemException("Cannot get value of CLOCK_MONOTONIC_COARSE timer!");
+    return (timestamp.tv_sec * 1000000000) + timestamp.tv_nsec;
+#else
+    return Timestamp::nano();
+#endif
+}
+
+} // namespace CppCommon
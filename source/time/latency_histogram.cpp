@@ -0,0 +1,292 @@
+/*!
+    \file latency_histogram.cpp
+    \brief High dynamic range latency histogram implementation
+    \author Ivan Shynkarenka
+    \date 15.10.2026
+    \copyright MIT License
+*/
+
+#include "time/latency_histogram.h"
+
+#include "system/cpu.h"
+
+#include <cassert>
+#include <cmath>
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+
+namespace Internals {
+
+void WriteVarint(std::vector<uint8_t>& buffer, uint64_t value)
+{
+    while (value >= 0x80)
+    {
+        buffer.push_back((uint8_t)(value | 0x80));
+        value >>= 7;
+    }
+    buffer.push_back((uint8_t)value);
+}
+
+bool ReadVarint(std::span<const uint8_t> buffer, size_t& offset, uint64_t& value) noexcept
+{
+    value = 0;
+    for (int shift = 0; shift < 64; shift += 7)
+    {
+        if (offset >= buffer.size())
+            return false;
+        uint8_t byte = buffer[offset++];
+        value |= (uint64_t)(byte & 0x7F) << shift;
+        if ((byte & 0x80) == 0)
+            return true;
+    }
+    return false;
+}
+
+uint64_t ZigZag(int64_t value) noexcept { return ((uint64_t)value << 1) ^ (uint64_t)(value >> 63); }
+int64_t UnZigZag(uint64_t value) noexcept { return (int64_t)(value >> 1) ^ -(int64_t)(value & 1); }
+
+} // namespace Internals
+
+//! @endcond
+
+LatencyHistogram::LatencyHistogram(uint64_t highest, int digits)
+    : _highest(highest), _digits(digits), _count(0)
+{
+    assert(((digits >= 1) && (digits <= 5)) && "Latency histogram significant digits must be from 1 to 5!");
+    _digits = std::clamp(digits, 1, 5);
+
+    // Sub-buckets count is the power of two which keeps the given significant digits in each bucket
+    uint64_t resolution = 2;
+    for (int i = 0; i < _digits; ++i)
+        resolution *= 10;
+    int magnitude = (int)std::bit_width(resolution - 1);
+    _sub_bucket_half_magnitude = magnitude - 1;
+    _sub_bucket_mask = ((uint64_t)1 << magnitude) - 1;
+
+    // Highest trackable value must cover at least two buckets
+    _highest = std::max(highest, (_sub_bucket_mask + 1) * 2);
+
+    _counts.resize(Index(_highest) + 1, 0);
+}
+
+uint64_t LatencyHistogram::min() const noexcept
+{
+    for (size_t i = 0; i < _counts.size(); ++i)
+        if (_counts[i] > 0)
+            return LowestValue(i);
+    return 0;
+}
+
+uint64_t LatencyHistogram::max() const noexcept
+{
+    for (size_t i = _counts.size(); i-- > 0;)
+        if (_counts[i] > 0)
+            return HighestValue(i);
+    return 0;
+}
+
+double LatencyHistogram::mean() const noexcept
+{
+    if (_count == 0)
+        return 0.0;
+
+    // Each sub-bucket is represented with its median equivalent value
+    double total = 0.0;
+    for (size_t i = 0; i < _counts.size(); ++i)
+        if (_counts[i] > 0)
+            total += (double)_counts[i] * ((double)(LowestValue(i) + HighestValue(i)) / 2.0);
+    return total / (double)_count;
+}
+
+double LatencyHistogram::stddev() const noexcept
+{
+    if (_count == 0)
+        return 0.0;
+
+    double average = mean();
+    double total = 0.0;
+    for (size_t i = 0; i < _counts.size(); ++i)
+    {
+        if (_counts[i] > 0)
+        {
+            double deviation = ((double)(LowestValue(i) + HighestValue(i)) / 2.0) - average;
+            total += (double)_counts[i] * deviation * deviation;
+        }
+    }
+    return std::sqrt(total / (double)_count);
+}
+
+uint64_t LatencyHistogram::Percentile(double percentile) const noexcept
+{
+    if (_count == 0)
+        return 0;
+
+    // Count of values at the given percentile (at least one value)
+    percentile = std::clamp(percentile, 0.0, 100.0);
+    uint64_t target = std::max((uint64_t)std::ceil((percentile / 100.0) * (double)_count), (uint64_t)1);
+
+    uint64_t total = 0;
+    for (size_t i = 0; i < _counts.size(); ++i)
+    {
+        total += _counts[i];
+        if (total >= target)
+            return HighestValue(i);
+    }
+
+    return max();
+}
+
+bool LatencyHistogram::Merge(const LatencyHistogram& histogram) noexcept
+{
+    if ((_highest != histogram._highest) || (_digits != histogram._digits))
+        return false;
+
+    for (size_t i = 0; i < _counts.size(); ++i)
+        _counts[i] += histogram._counts[i];
+    _count += histogram._count;
+    return true;
+}
+
+void LatencyHistogram::Clear() noexcept
+{
+    std::fill(_counts.begin(), _counts.end(), 0);
+    _count = 0;
+}
+
+std::vector<uint8_t> LatencyHistogram::Serialize() const
+{
+    // Only sub-buckets up to the last non-empty one are serialized
+    size_t size = _counts.size();
+    while ((size > 0) && (_counts[size - 1] == 0))
+        --size;
+
+    std::vector<uint8_t> buffer;
+    buffer.reserve(32 + size / 8);
+    Internals::WriteVarint(buffer, _highest);
+    Internals::WriteVarint(buffer, (uint64_t)_digits);
+    Internals::WriteVarint(buffer, size);
+
+    // Non-empty sub-buckets are encoded with positive counts, runs of empty sub-buckets with negative lengths
+    for (size_t i = 0; i < size;)
+    {
+        if (_counts[i] > 0)
+        {
+            Internals::WriteVarint(buffer, Internals::ZigZag((int64_t)_counts[i]));
+            ++i;
+        }
+        else
+        {
+            size_t run = 0;
+            while (_counts[i] == 0)
+            {
+                ++run;
+                ++i;
+            }
+            Internals::WriteVarint(buffer, Internals::ZigZag(-(int64_t)run));
+        }
+    }
+
+    return buffer;
+}
+
+size_t LatencyHistogram::Deserialize(std::span<const uint8_t> buffer, LatencyHistogram& histogram)
+{
+    size_t offset = 0;
+    uint64_t highest, digits, size;
+    if (!Internals::ReadVarint(buffer, offset, highest) || !Internals::ReadVarint(buffer, offset, digits) || !Internals::ReadVarint(buffer, offset, size))
+        return 0;
+    if ((digits < 1) || (digits > 5))
+        return 0;
+
+    LatencyHistogram result(highest, (int)digits);
+    if ((result._highest != highest) || (size > result._counts.size()))
+        return 0;
+
+    for (size_t i = 0; i < size;)
+    {
+        uint64_t varint;
+        if (!Internals::ReadVarint(buffer, offset, varint))
+            return 0;
+
+        int64_t value = Internals::UnZigZag(varint);
+        if (value > 0)
+        {
+            result._counts[i++] = (uint64_t)value;
+            result._count += (uint64_t)value;
+        }
+        else
+        {
+            uint64_t run = (uint64_t)-value;
+            if ((run == 0) || (run > (size - i)))
+                return 0;
+            i += (size_t)run;
+        }
+    }
+
+    histogram.swap(result);
+    return offset;
+}
+
+ConcurrentLatencyHistogram::ConcurrentLatencyHistogram(uint64_t highest, int digits, size_t shards)
+    : _layout(highest, digits), _shards_mask(0), _shard_size(0)
+{
+    if (shards == 0)
+        shards = (size_t)std::max(CPU::LogicalCores(), 1);
+
+    // Round up shards count to the power of two
+    size_t count = 1;
+    while (count < shards)
+        count <<= 1;
+
+    // Round up shard size to the cache line, so neighbour shards do not share it
+    const size_t line = 128 / sizeof(std::atomic<uint64_t>);
+    _shard_size = ((_layout.buckets() + line - 1) / line) * line;
+
+    _shards_mask = count - 1;
+    _counts = std::make_unique<std::atomic<uint64_t>[]>(count * _shard_size);
+    Clear();
+}
+
+size_t ConcurrentLatencyHistogram::CurrentThreadShard() noexcept
+{
+    // Threads are assigned to shards in round-robin order of their first record
+    static std::atomic<size_t> sequence(0);
+    thread_local size_t shard = sequence.fetch_add(1, std::memory_order_relaxed);
+    return shard;
+}
+
+LatencyHistogram ConcurrentLatencyHistogram::Snapshot() const
+{
+    LatencyHistogram histogram(_layout.highest(), _layout.digits());
+    Snapshot(histogram);
+    return histogram;
+}
+
+bool ConcurrentLatencyHistogram::Snapshot(LatencyHistogram& histogram) const noexcept
+{
+    if ((histogram._highest != _layout._highest) || (histogram._digits != _layout._digits))
+        return false;
+
+    for (size_t shard = 0; shard <= _shards_mask; ++shard)
+    {
+        const std::atomic<uint64_t>* counts = &_counts[shard * _shard_size];
+        for (size_t i = 0; i < histogram._counts.size(); ++i)
+        {
+            uint64_t count = counts[i].load(std::memory_order_relaxed);
+            histogram._counts[i] += count;
+            histogram._count += count;
+        }
+    }
+
+    return true;
+}
+
+void ConcurrentLatencyHistogram::Clear() noexcept
+{
+    for (size_t i = 0; i < (_shards_mask + 1) * _shard_size; ++i)
+        _counts[i].store(0, std::memory_order_relaxed);
+}
+
+} // namespace CppCommon
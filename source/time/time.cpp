@@ -8,32 +8,156 @@
 
 #include "time/time.h"
 
-#include "string/format.h"
+#include "time/timezone.h"
 
 #include <cassert>
+#include <limits>
 
 #include <time.h>
 
 namespace CppCommon {
 
+//! @cond INTERNALS
+namespace Internals {
+
+// Civil date from days since the epoch: http://howardhinnant.github.io/date_algorithms.html#civil_from_days
+void CivilFromDays(int64_t days, int& year, int& month, int& day) noexcept
+{
+    days += 719468;
+    int64_t era = ((days >= 0) ? days : (days - 146096)) / 146097;
+    int64_t doe = days - era * 146097;
+    int64_t yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+    int64_t doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+    int64_t mp = (5 * doy + 2) / 153;
+    day = (int)(doy - (153 * mp + 2) / 5 + 1);
+    month = (int)((mp < 10) ? (mp + 3) : (mp - 9));
+    year = (int)(yoe + era * 400 + ((month <= 2) ? 1 : 0));
+}
+
+// Days since the epoch from civil date: http://howardhinnant.github.io/date_algorithms.html#days_from_civil
+int64_t DaysFromCivil(int year, int month, int day) noexcept
+{
+    int64_t y = year - ((month <= 2) ? 1 : 0);
+    int64_t era = ((y >= 0) ? y : (y - 399)) / 400;
+    int64_t yoe = y - era * 400;
+    int64_t doy = (153 * ((month > 2) ? (month - 3) : (month + 9)) + 2) / 5 + day - 1;
+    int64_t doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+    return era * 146097 + doe - 719468;
+}
+
+// Lookup table of decimal digit pairs
+const char DIGIT_PAIRS[201] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
+// Powers of ten for second fraction digits
+const uint32_t POWERS_OF_TEN[10] = { 1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000 };
+
+inline char* WritePair(char* buffer, uint32_t value) noexcept
+{
+    const char* pair = DIGIT_PAIRS + value * 2;
+    buffer[0] = pair[0];
+    buffer[1] = pair[1];
+    return buffer + 2;
+}
+
+char* WriteISO8601(char* buffer, uint64_t timestamp, int precision) noexcept
+{
+    uint64_t seconds = timestamp / 1000000000;
+    uint32_t nanoseconds = (uint32_t)(timestamp % 1000000000);
+    uint32_t time = (uint32_t)(seconds % 86400);
+
+    int year, month, day;
+    CivilFromDays((int64_t)(seconds / 86400), year, month, day);
+
+    // Date
+    buffer = WritePair(buffer, (uint32_t)year / 100);
+    buffer = WritePair(buffer, (uint32_t)year % 100);
+    *buffer++ = '-';
+    buffer = WritePair(buffer, (uint32_t)month);
+    *buffer++ = '-';
+    buffer = WritePair(buffer, (uint32_t)day);
+    *buffer++ = 'T';
+
+    // Time
+    buffer = WritePair(buffer, time / 3600);
+    *buffer++ = ':';
+    buffer = WritePair(buffer, (time % 3600) / 60);
+    *buffer++ = ':';
+    buffer = WritePair(buffer, time % 60);
+
+    // Second fraction
+    if (precision > 0)
+    {
+        if (precision > 9)
+            precision = 9;
+
+        *buffer++ = '.';
+        uint32_t fraction = nanoseconds / POWERS_OF_TEN[9 - precision];
+        char* end = buffer + precision;
+        char* current = end;
+        while ((current - buffer) >= 2)
+        {
+            current -= 2;
+            WritePair(current, fraction % 100);
+            fraction /= 100;
+        }
+        if (current != buffer)
+            *buffer = (char)('0' + fraction);
+        buffer = end;
+    }
+
+    return buffer;
+}
+
+// Parse the fixed count of decimal digits
+inline bool ReadDigits(const char*& current, const char* end, int count, int& value) noexcept
+{
+    if ((end - current) < count)
+        return false;
+
+    value = 0;
+    for (int i = 0; i < count; ++i)
+    {
+        unsigned digit = (unsigned)(current[i] - '0');
+        if (digit > 9)
+            return false;
+        value = value * 10 + (int)digit;
+    }
+    current += count;
+    return true;
+}
+
+inline bool ReadChar(const char*& current, const char* end, char ch) noexcept
+{
+    if ((current == end) || (*current != ch))
+        return false;
+    ++current;
+    return true;
+}
+
+} // namespace Internals
+//! @endcond
+
 Time::Time(const Timestamp& timestamp)
 {
-    struct tm result;
-    time_t seconds = timestamp.seconds();
-#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
-    if (gmtime_r(&seconds, &result) != &result)
-        throwex SystemException(format("Cannot convert the given timestamp ({}) to date & time structure!", timestamp.total()));
-#elif defined(_WIN32) || defined(_WIN64)
-    if (gmtime_s(&result, &seconds))
-        throwex SystemException(format("Cannot convert the given timestamp ({}) to date & time structure!", timestamp.total()));
-#endif
-    _year = result.tm_year + 1900;
-    _month = result.tm_mon + 1;
-    _weekday = result.tm_wday;
-    _day = result.tm_mday;
-    _hour = result.tm_hour;
-    _minute = result.tm_min;
-    _second = result.tm_sec % 60;
+    int64_t seconds = (int64_t)timestamp.seconds();
+    int64_t days = seconds / 86400;
+    int64_t time = seconds % 86400;
+
+    Internals::CivilFromDays(days, _year, _month, _day);
+    _weekday = (int)((days + 4) % 7);
+    _hour = (int)(time / 3600);
+    _minute = (int)((time % 3600) / 60);
+    _second = (int)(time % 60);
     _millisecond = timestamp.milliseconds() % 1000;
     _microsecond = timestamp.microseconds() % 1000;
     _nanosecond = timestamp.nanoseconds() % 1000;
@@ -99,88 +223,140 @@ Time::Time(int year, int month, int day, int hour, int minute, int second, int m
 
 UtcTimestamp Time::utcstamp() const
 {
-    struct tm result;
-    result.tm_year = _year - 1900;
-    result.tm_mon = _month - 1;
-    result.tm_mday = _day;
-    result.tm_hour = _hour;
-    result.tm_min = _minute;
-    result.tm_sec = _second;
-    result.tm_isdst = -1;
-
-#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
-    time_t seconds = timegm(&result);
-#elif defined(_WIN32) || defined(_WIN64)
-    time_t seconds = _mkgmtime(&result);
-#endif
-    if (seconds == -1)
-        throwex SystemException("Cannot convert date & time to UTC timestamp!");
-
+    int64_t seconds = Internals::DaysFromCivil(_year, _month, _day) * 86400 + _hour * 3600 + _minute * 60 + _second;
     return UtcTimestamp(seconds * 1000000000ull + _millisecond * 1000000ull + _microsecond * 1000ull + _nanosecond);
 }
 
 LocalTimestamp Time::localstamp() const
 {
-    struct tm result;
-    result.tm_year = _year - 1900;
-    result.tm_mon = _month - 1;
-    result.tm_mday = _day;
-    result.tm_hour = _hour;
-    result.tm_min = _minute;
-    result.tm_sec = _second;
-    result.tm_isdst = -1;
+    int64_t seconds = Internals::DaysFromCivil(_year, _month, _day) * 86400 + _hour * 3600 + _minute * 60 + _second;
 
-    time_t seconds = mktime(&result);
-    if (seconds == -1)
-        throwex SystemException("Cannot convert date & time to local timestamp!");
+    // Find the local time offset at the UTC time of the local date & time
+    int64_t offset = Timezone::LocalOffset(Timestamp(seconds * 1000000000ull)).seconds();
+    offset = Timezone::LocalOffset(Timestamp((seconds - offset) * 1000000000ull)).seconds();
 
-    return LocalTimestamp(seconds * 1000000000ull + _millisecond * 1000000ull + _microsecond * 1000ull + _nanosecond);
+    return LocalTimestamp((seconds - offset) * 1000000000ull + _millisecond * 1000000ull + _microsecond * 1000ull + _nanosecond);
 }
 
-UtcTime::UtcTime(const Timestamp& timestamp)
+UtcTime::UtcTime(const Timestamp& timestamp) : Time(timestamp)
 {
-    struct tm result;
-    time_t seconds = timestamp.seconds();
-#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
-    if (gmtime_r(&seconds, &result) != &result)
-        throwex SystemException(format("Cannot convert the given timestamp ({}) to UTC date & time structure!", timestamp.total()));
-#elif defined(_WIN32) || defined(_WIN64)
-    if (gmtime_s(&result, &seconds))
-        throwex SystemException(format("Cannot convert the given timestamp ({}) to UTC date & time structure!", timestamp.total()));
-#endif
-    _year = result.tm_year + 1900;
-    _month = result.tm_mon + 1;
-    _weekday = result.tm_wday;
-    _day = result.tm_mday;
-    _hour = result.tm_hour;
-    _minute = result.tm_min;
-    _second = result.tm_sec % 60;
-    _millisecond = timestamp.milliseconds() % 1000;
-    _microsecond = timestamp.microseconds() % 1000;
-    _nanosecond = timestamp.nanoseconds() % 1000;
 }
 
-LocalTime::LocalTime(const Timestamp& timestamp)
+LocalTime::LocalTime(const Timestamp& timestamp) : Time(timestamp + Timezone::LocalOffset(timestamp))
 {
-    struct tm result;
-    time_t seconds = timestamp.seconds();
-#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
-    if (localtime_r(&seconds, &result) != &result)
-        throwex SystemException(format("Cannot convert the given timestamp ({}) to local date & time structure!", timestamp.total()));
-#elif defined(_WIN32) || defined(_WIN64)
-    if (localtime_s(&result, &seconds))
-        throwex SystemException(format("Cannot convert the given timestamp ({}) to local date & time structure!", timestamp.total()));
-#endif
-    _year = result.tm_year + 1900;
-    _month = result.tm_mon + 1;
-    _weekday = result.tm_wday;
-    _day = result.tm_mday;
-    _hour = result.tm_hour;
-    _minute = result.tm_min;
-    _second = result.tm_sec % 60;
-    _millisecond = timestamp.milliseconds() % 1000;
-    _microsecond = timestamp.microseconds() % 1000;
-    _nanosecond = timestamp.nanoseconds() % 1000;
+}
+
+size_t FormatISO8601(char* buffer, const Timestamp& timestamp, int precision) noexcept
+{
+    char* end = Internals::WriteISO8601(buffer, timestamp.total(), precision);
+    *end++ = 'Z';
+    return (size_t)(end - buffer);
+}
+
+size_t FormatISO8601(char* buffer, const Timestamp& timestamp, const Timespan& offset, int precision) noexcept
+{
+    char* end = Internals::WriteISO8601(buffer, timestamp.total() + offset.total(), precision);
+
+    int64_t minutes = offset.minutes();
+    *end++ = (minutes < 0) ? '-' : '+';
+    if (minutes < 0)
+        minutes = -minutes;
+    end = Internals::WritePair(end, (uint32_t)(minutes / 60) % 100);
+    *end++ = ':';
+    end = Internals::WritePair(end, (uint32_t)(minutes % 60));
+    return (size_t)(end - buffer);
+}
+
+bool ParseISO8601(std::string_view str, Timestamp& timestamp) noexcept
+{
+    const char* current = str.data();
+    const char* end = str.data() + str.size();
+
+    // Date & time
+    int year, month, day, hour, minute, second;
+    if (!Internals::ReadDigits(current, end, 4, year) || !Internals::ReadChar(current, end, '-') ||
+        !Internals::ReadDigits(current, end, 2, month) || !Internals::ReadChar(current, end, '-') ||
+        !Internals::ReadDigits(current, end, 2, day))
+        return false;
+    if ((current == end) || ((*current != 'T') && (*current != 't') && (*current != ' ')))
+        return false;
+    ++current;
+    if (!Internals::ReadDigits(current, end, 2, hour) || !Internals::ReadChar(current, end, ':') ||
+        !Internals::ReadDigits(current, end, 2, minute) || !Internals::ReadChar(current, end, ':') ||
+        !Internals::ReadDigits(current, end, 2, second))
+        return false;
+
+    // Validate date & time (leap second is folded into the last second of the minute)
+    if ((year < 1970) || (month < 1) || (month > 12) || (day < 1) || (hour > 23) || (minute > 59) || (second > 60))
+        return false;
+    static const int days_in_month[12] = { 31, 29, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31 };
+    bool leap = ((year % 4) == 0) && (((year % 100) != 0) || ((year % 400) == 0));
+    if ((day > days_in_month[month - 1]) || ((month == 2) && (day == 29) && !leap))
+        return false;
+    if (second == 60)
+        second = 59;
+
+    // Second fraction
+    uint64_t nanoseconds = 0;
+    if ((current != end) && ((*current == '.') || (*current == ',')))
+    {
+        ++current;
+        int digits = 0;
+        while ((current != end) && ((unsigned)(*current - '0') <= 9))
+        {
+            if (digits < 9)
+            {
+                nanoseconds = nanoseconds * 10 + (uint64_t)(*current - '0');
+                ++digits;
+            }
+            ++current;
+        }
+        if (digits == 0)
+            return false;
+        nanoseconds *= Internals::POWERS_OF_TEN[9 - digits];
+    }
+
+    // Time offset
+    int64_t offset = 0;
+    if (current != end)
+    {
+        if ((*current == 'Z') || (*current == 'z'))
+            ++current;
+        else if ((*current == '+') || (*current == '-'))
+        {
+            bool negative = (*current == '-');
+            ++current;
+            int hours, minutes;
+            if (!Internals::ReadDigits(current, end, 2, hours))
+                return false;
+            Internals::ReadChar(current, end, ':');
+            if (!Internals::ReadDigits(current, end, 2, minutes) || (hours > 23) || (minutes > 59))
+                return false;
+            offset = (hours * 60 + minutes) * 60;
+            if (negative)
+                offset = -offset;
+        }
+        else
+            return false;
+    }
+    if (current != end)
+        return false;
+
+    // Check the timestamp range bounds (up to 2554 year)
+    int64_t seconds = Internals::DaysFromCivil(year, month, day) * 86400 + hour * 3600 + minute * 60 + second - offset;
+    if ((seconds < 0) || ((uint64_t)seconds > (std::numeric_limits<uint64_t>::max() / 1000000000 - 1)))
+        return false;
+
+    timestamp = Timestamp((uint64_t)seconds * 1000000000 + nanoseconds);
+    return true;
+}
+
+UtcTimestamp ParseISO8601(std::string_view str)
+{
+    Timestamp timestamp;
+    if (!ParseISO8601(str, timestamp))
+        throwex ArgumentException("Invalid ISO-8601 timestamp string!");
+    return UtcTimestamp(timestamp);
 }
 
 } // namespace CppCommon
@@ -9,6 +9,7 @@
 #include "time/timestamp.h"
 
 #include "math/math.h"
+#include "time/timezone.h"
 
 #if defined(__APPLE__)
 #include <mach/mach.h>
@@ -125,12 +126,8 @@ uint64_t Timestamp::local()
 #if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
     uint64_t timestamp = utc();
 
-    // Adjust UTC time with local timezone offset
-    struct tm local;
-    time_t seconds = timestamp / (1000000000);
-    if (localtime_r(&seconds, &local) != &local)
-        throwex SystemException("Cannot convert CLOCK_REALTIME time to local date & time structure!");
-    return timestamp + (local.tm_gmtoff * 1000000000);
+    // Adjust UTC time with the cached local timezone offset
+    return timestamp + Timezone::LocalOffset(Timestamp(timestamp)).total();
 #elif defined(_WIN32) || defined(_WIN64)
     FILETIME ft;
 #if (_WIN32_WINNT >= _WIN32_WINNT_WIN8)
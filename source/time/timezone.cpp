@@ -8,30 +8,114 @@
 
 #include "time/timezone.h"
 
+#include <string>
+
 #if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
 #include <time.h>
 #elif defined(_WIN32) || defined(_WIN64)
 #include <windows.h>
+#include <time.h>
 #endif
 
 namespace CppCommon {
 
+//! @cond INTERNALS
+namespace Internals {
+
+// Step to search the next timezone transition (timezone transitions never happen more often)
+const int64_t TIMEZONE_TRANSITION_STEP = 7 * 24 * 60 * 60;
+// Maximal range of the cached timezone without transitions
+const int64_t TIMEZONE_TRANSITION_RANGE = 53 * TIMEZONE_TRANSITION_STEP;
+
+struct LocalZone
+{
+    int64_t start;
+    int64_t end;
+    int64_t offset;
+    bool dst;
+    std::string name;
+
+    LocalZone() : start(0), end(0), offset(0), dst(false) {}
+};
+
+// Get the local time offset in seconds for the given UTC time in seconds
+int64_t GetLocalOffset(int64_t seconds, bool* dst = nullptr, std::string* name = nullptr)
+{
+    struct tm local;
+    time_t time = (time_t)seconds;
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+    if (localtime_r(&time, &local) != &local)
+        throwex SystemException("Cannot convert the given time to local date & time structure!");
+    int64_t offset = local.tm_gmtoff;
+    if (name != nullptr)
+        *name = local.tm_zone;
+#elif defined(_WIN32) || defined(_WIN64)
+    if (localtime_s(&local, &time))
+        throwex SystemException("Cannot convert the given time to local date & time structure!");
+    int64_t offset = (int64_t)_mkgmtime(&local) - seconds;
+#endif
+    if (dst != nullptr)
+        *dst = (local.tm_isdst > 0);
+    return offset;
+}
+
+const LocalZone& GetLocalZone(int64_t seconds)
+{
+    thread_local LocalZone zone;
+
+    // Fast path: the given time is in the cached range without timezone transitions
+    if ((seconds >= zone.start) && (seconds < zone.end))
+        return zone;
+
+    zone.offset = GetLocalOffset(seconds, &zone.dst, &zone.name);
+    zone.start = seconds;
+    zone.end = seconds + TIMEZONE_TRANSITION_RANGE;
+
+    // Find the week of the next timezone transition
+    for (int64_t time = seconds + TIMEZONE_TRANSITION_STEP; time <= zone.end; time += TIMEZONE_TRANSITION_STEP)
+    {
+        if (GetLocalOffset(time) != zone.offset)
+        {
+            // Binary search of the first second of the next timezone transition
+            int64_t first = time - TIMEZONE_TRANSITION_STEP;
+            int64_t last = time;
+            while ((last - first) > 1)
+            {
+                int64_t middle = first + (last - first) / 2;
+                if (GetLocalOffset(middle) == zone.offset)
+                    first = middle;
+                else
+                    last = middle;
+            }
+            zone.end = last;
+            break;
+        }
+    }
+
+    return zone;
+}
+
+} // namespace Internals
+//! @endcond
+
+Timespan Timezone::LocalOffset(const Timestamp& timestamp)
+{
+    return Timespan::seconds(Internals::GetLocalZone((int64_t)timestamp.seconds()).offset);
+}
+
 Timezone::Timezone() : _name(), _offset(Timespan::zero()), _dstoffset(Timespan::zero())
 {
 #if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
-    struct tm local;
-    time_t seconds = time(nullptr);
-    if (localtime_r(&seconds, &local) != &local)
-        throwex SystemException("Cannot convert current time to local date & time structure!");
-    _name = local.tm_zone;
-    if (local.tm_isdst > 0)
+    const Internals::LocalZone& local = Internals::GetLocalZone(time(nullptr));
+    _name = local.name;
+    if (local.dst)
     {
-        _offset = Timespan::seconds(local.tm_gmtoff - 3600);
+        _offset = Timespan::seconds(local.offset - 3600);
         _dstoffset = Timespan::seconds(3600);
     }
     else
     {
-        _offset = Timespan::seconds(local.tm_gmtoff);
+        _offset = Timespan::seconds(local.offset);
         _dstoffset = Timespan::zero();
     }
 #elif defined(_WIN32) || defined(_WIN64)
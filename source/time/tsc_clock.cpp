@@ -0,0 +1,235 @@
+/*!
+    \file tsc_clock.cpp
+    \brief Calibrated TSC clock implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "time/tsc_clock.h"
+
+#include <atomic>
+#include <limits>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#elif defined(__i386__) || defined(__x86_64__) || defined(__amd64__)
+#include <cpuid.h>
+#endif
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+namespace Internals {
+
+// TSC clock resynchronization interval in nanoseconds
+const uint64_t TSC_RESYNC_INTERVAL = 1000000000;
+// TSC clock initial calibration interval in nanoseconds
+const uint64_t TSC_CALIBRATION_INTERVAL = 10000000;
+
+bool IsInvariantTsc() noexcept
+{
+#if defined(__APPLE__) || defined(__aarch64__)
+    // Mach absolute time and ARMv8 virtual timer run at the constant frequency
+    return true;
+#elif defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+    int info[4];
+    __cpuid(info, 0x80000000);
+    if ((unsigned)info[0] < 0x80000007)
+        return false;
+    __cpuid(info, 0x80000007);
+    return (info[3] & (1 << 8)) != 0;
+#elif defined(__i386__) || defined(__x86_64__) || defined(__amd64__)
+    unsigned int eax, ebx, ecx, edx;
+    if (__get_cpuid_max(0x80000000, nullptr) < 0x80000007)
+        return false;
+    if (!__get_cpuid(0x80000007, &eax, &ebx, &ecx, &edx))
+        return false;
+    return (edx & (1 << 8)) != 0;
+#else
+    return false;
+#endif
+}
+
+class TscState
+{
+public:
+    TscState()
+        : _invariant(IsInvariantTsc()), _busy(false), _version(0),
+          _base_tsc(0), _base_utc(0), _mult(0), _shift(0), _limit(0), _frequency(0),
+          _anchor_tsc(0), _anchor_nano(0)
+    {
+        if (!_invariant)
+            return;
+
+        // Calibrate TSC frequency against the monotonic high resolution clock
+        Sample(_anchor_tsc, _anchor_nano);
+        uint64_t tsc = 0;
+        uint64_t nano = 0;
+        do
+        {
+            Sample(tsc, nano);
+        } while ((nano - _anchor_nano) < TSC_CALIBRATION_INTERVAL);
+
+        _busy.store(true, std::memory_order_relaxed);
+        Update();
+    }
+
+    bool invariant() const noexcept { return _invariant; }
+    uint64_t frequency() const noexcept { return _frequency.load(std::memory_order_relaxed); }
+
+    uint64_t utc()
+    {
+        if (!_invariant)
+            return Timestamp::utc();
+
+        for (;;)
+        {
+            uint64_t version = _version.load(std::memory_order_acquire);
+            if ((version & 1) == 0)
+            {
+                uint64_t base_tsc = _base_tsc.load(std::memory_order_relaxed);
+                uint64_t base_utc = _base_utc.load(std::memory_order_relaxed);
+                uint64_t mult = _mult.load(std::memory_order_relaxed);
+                uint64_t shift = _shift.load(std::memory_order_relaxed);
+                uint64_t limit = _limit.load(std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_acquire);
+                if (_version.load(std::memory_order_relaxed) == version)
+                {
+                    // Delta is never overflowed in the multiplication within the resynchronization interval
+                    uint64_t delta = Timestamp::rdts() - base_tsc;
+                    if (delta < limit)
+                        return base_utc + ((delta * mult) >> shift);
+
+                    // Expired synchronization interval or TSC value behind the base one
+                    if (!Resync())
+                        return Timestamp::utc();
+                    continue;
+                }
+            }
+            std::atomic_thread_fence(std::memory_order_acquire);
+        }
+    }
+
+    bool Resync()
+    {
+        if (!_invariant)
+            return false;
+
+        // Only one thread resynchronizes the clock, others fall back to the system UTC clock
+        if (_busy.exchange(true, std::memory_order_acquire))
+            return false;
+
+        Update();
+        return true;
+    }
+
+private:
+    const bool _invariant;
+    std::atomic<bool> _busy;
+    std::atomic<uint64_t> _version;
+    std::atomic<uint64_t> _base_tsc;
+    std::atomic<uint64_t> _base_utc;
+    std::atomic<uint64_t> _mult;
+    std::atomic<uint64_t> _shift;
+    std::atomic<uint64_t> _limit;
+    std::atomic<uint64_t> _frequency;
+    uint64_t _anchor_tsc;
+    uint64_t _anchor_nano;
+
+    // Sample the TSC value closest to the given clock value with the minimal read latency
+    template <typename TClock>
+    static void Sample(uint64_t& tsc, uint64_t& value, TClock clock)
+    {
+        uint64_t latency = std::numeric_limits<uint64_t>::max();
+        for (int i = 0; i < 5; ++i)
+        {
+            uint64_t tsc1 = Timestamp::rdts();
+            uint64_t current = clock();
+            uint64_t tsc2 = Timestamp::rdts();
+            if ((tsc2 - tsc1) < latency)
+            {
+                latency = tsc2 - tsc1;
+                tsc = tsc1 + latency / 2;
+                value = current;
+            }
+        }
+    }
+
+    static void Sample(uint64_t& tsc, uint64_t& nano)
+    {
+        Sample(tsc, nano, [](){ return Timestamp::nano(); });
+    }
+
+    // Must be called by the only thread that acquired the busy flag
+    void Update()
+    {
+        uint64_t tsc = 0;
+        uint64_t nano = 0;
+        uint64_t utc = 0;
+        uint64_t utc_tsc = 0;
+        Sample(tsc, nano);
+        Sample(utc_tsc, utc, [](){ return Timestamp::utc(); });
+
+        // Refine TSC frequency over the whole time since the calibration
+        double frequency = (double)(tsc - _anchor_tsc) * 1000000000.0 / (double)(nano - _anchor_nano);
+
+        // Count of TSC ticks within the resynchronization interval
+        uint64_t limit = (uint64_t)(frequency * ((double)TSC_RESYNC_INTERVAL / 1000000000.0));
+
+        // Find the most precise multiplier which is not overflowed within the limit
+        uint64_t mult = 0;
+        uint64_t shift = 32;
+        for (; shift > 0; --shift)
+        {
+            mult = (uint64_t)(((double)(1ull << shift) * 1000000000.0) / frequency);
+            if (mult <= (std::numeric_limits<uint64_t>::max() / limit))
+                break;
+        }
+
+        // Publish new synchronization parameters
+        uint64_t version = _version.load(std::memory_order_relaxed);
+        _version.store(version + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        _base_tsc.store(utc_tsc, std::memory_order_relaxed);
+        _base_utc.store(utc, std::memory_order_relaxed);
+        _mult.store(mult, std::memory_order_relaxed);
+        _shift.store(shift, std::memory_order_relaxed);
+        _limit.store(limit, std::memory_order_relaxed);
+        _frequency.store((uint64_t)frequency, std::memory_order_relaxed);
+        _version.store(version + 2, std::memory_order_release);
+
+        _busy.store(false, std::memory_order_release);
+    }
+};
+
+TscState& GetTscState()
+{
+    static TscState state;
+    return state;
+}
+
+} // namespace Internals
+//! @endcond
+
+bool TscClock::IsInvariant()
+{
+    return Internals::GetTscState().invariant();
+}
+
+uint64_t TscClock::frequency()
+{
+    return Internals::GetTscState().frequency();
+}
+
+uint64_t TscClock::utc()
+{
+    return Internals::GetTscState().utc();
+}
+
+void TscClock::Resync()
+{
+    Internals::GetTscState().Resync();
+}
+
+} // namespace CppCommon
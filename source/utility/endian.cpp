@@ -0,0 +1,180 @@
+/*!
+    \file endian.cpp
+    \brief Big/Little-endian utilities implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "utility/endian.h"
+
+#include "system/cpu.h"
+
+#if defined(_MSC_VER) && defined(_M_X64)
+#include <immintrin.h>
+#define CPPCOMMON_ENDIAN_SSE2
+#define CPPCOMMON_ENDIAN_AVX2
+#define CPPCOMMON_ENDIAN_AVX2_TARGET
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__amd64__))
+#include <immintrin.h>
+#define CPPCOMMON_ENDIAN_SSE2
+#define CPPCOMMON_ENDIAN_AVX2
+#define CPPCOMMON_ENDIAN_AVX2_TARGET __attribute__((target("avx2")))
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#define CPPCOMMON_ENDIAN_SSE2
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#define CPPCOMMON_ENDIAN_NEON
+#endif
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+namespace Internals {
+
+template <typename T>
+void ByteSwapScalar(T* data, size_t size) noexcept
+{
+    for (size_t i = 0; i < size; ++i)
+        data[i] = Endian::ByteSwap(data[i]);
+}
+
+#if defined(CPPCOMMON_ENDIAN_SSE2)
+
+// Reverse bytes of each value in the SSE2 register without SSSE3 shuffles
+template <typename T>
+inline __m128i ByteSwapBlock(__m128i block) noexcept
+{
+    if constexpr (sizeof(T) == 4)
+    {
+        block = _mm_shufflelo_epi16(block, _MM_SHUFFLE(2, 3, 0, 1));
+        block = _mm_shufflehi_epi16(block, _MM_SHUFFLE(2, 3, 0, 1));
+    }
+    else if constexpr (sizeof(T) == 8)
+    {
+        block = _mm_shufflelo_epi16(block, _MM_SHUFFLE(0, 1, 2, 3));
+        block = _mm_shufflehi_epi16(block, _MM_SHUFFLE(0, 1, 2, 3));
+    }
+    return _mm_or_si128(_mm_slli_epi16(block, 8), _mm_srli_epi16(block, 8));
+}
+
+template <typename T>
+void ByteSwapSSE2(T* data, size_t size) noexcept
+{
+    const size_t count = 16 / sizeof(T);
+
+    size_t i = 0;
+    for (; (i + count) <= size; i += count)
+    {
+        __m128i block = _mm_loadu_si128((const __m128i*)(data + i));
+        _mm_storeu_si128((__m128i*)(data + i), ByteSwapBlock<T>(block));
+    }
+
+    ByteSwapScalar(data + i, size - i);
+}
+
+#endif
+
+#if defined(CPPCOMMON_ENDIAN_AVX2)
+
+// Shuffle mask reverses bytes of each value in both 128-bit lanes
+template <typename T>
+struct ByteSwapMask
+{
+    alignas(32) uint8_t bytes[32];
+
+    constexpr ByteSwapMask() noexcept : bytes()
+    {
+        for (size_t i = 0; i < 32; ++i)
+            bytes[i] = (uint8_t)((i % 16) - (i % sizeof(T)) + (sizeof(T) - 1 - (i % sizeof(T))));
+    }
+};
+
+template <typename T>
+constexpr ByteSwapMask<T> byte_swap_mask;
+
+template <typename T>
+CPPCOMMON_ENDIAN_AVX2_TARGET void ByteSwapAVX2(T* data, size_t size) noexcept
+{
+    const size_t count = 32 / sizeof(T);
+    const __m256i mask = _mm256_load_si256((const __m256i*)byte_swap_mask<T>.bytes);
+
+    size_t i = 0;
+    for (; (i + 2 * count) <= size; i += 2 * count)
+    {
+        __m256i block1 = _mm256_loadu_si256((const __m256i*)(data + i));
+        __m256i block2 = _mm256_loadu_si256((const __m256i*)(data + i + count));
+        _mm256_storeu_si256((__m256i*)(data + i), _mm256_shuffle_epi8(block1, mask));
+        _mm256_storeu_si256((__m256i*)(data + i + count), _mm256_shuffle_epi8(block2, mask));
+    }
+    for (; (i + count) <= size; i += count)
+    {
+        __m256i block = _mm256_loadu_si256((const __m256i*)(data + i));
+        _mm256_storeu_si256((__m256i*)(data + i), _mm256_shuffle_epi8(block, mask));
+    }
+
+    ByteSwapSSE2(data + i, size - i);
+}
+
+#endif
+
+#if defined(CPPCOMMON_ENDIAN_NEON)
+
+template <typename T>
+void ByteSwapNEON(T* data, size_t size) noexcept
+{
+    const size_t count = 16 / sizeof(T);
+
+    size_t i = 0;
+    for (; (i + count) <= size; i += count)
+    {
+        uint8x16_t block = vld1q_u8((const uint8_t*)(data + i));
+        if constexpr (sizeof(T) == 2)
+            block = vrev16q_u8(block);
+        else if constexpr (sizeof(T) == 4)
+            block = vrev32q_u8(block);
+        else
+            block = vrev64q_u8(block);
+        vst1q_u8((uint8_t*)(data + i), block);
+    }
+
+    ByteSwapScalar(data + i, size - i);
+}
+
+#endif
+
+template <typename T>
+void ByteSwapArray(T* data, size_t size) noexcept
+{
+#if defined(CPPCOMMON_ENDIAN_AVX2)
+    static const CPUDispatch<void(T*, size_t)> dispatch([]() { return CPU::HasAVX2() ? ByteSwapAVX2<T> : ByteSwapSSE2<T>; });
+    dispatch(data, size);
+#elif defined(CPPCOMMON_ENDIAN_SSE2)
+    ByteSwapSSE2(data, size);
+#elif defined(CPPCOMMON_ENDIAN_NEON)
+    ByteSwapNEON(data, size);
+#else
+    ByteSwapScalar(data, size);
+#endif
+}
+
+} // namespace Internals
+//! @endcond
+
+void Endian::ByteSwap(std::span<uint16_t> values) noexcept
+{
+    Internals::ByteSwapArray(values.data(), values.size());
+}
+
+void Endian::ByteSwap(std::span<uint32_t> values) noexcept
+{
+    Internals::ByteSwapArray(values.data(), values.size());
+}
+
+void Endian::ByteSwap(std::span<uint64_t> values) noexcept
+{
+    Internals::ByteSwapArray(values.data(), values.size());
+}
+
+} // namespace CppCommon
@@ -0,0 +1,43 @@
+//
+// Created by Ivan Shynkarenka on 15.10.2026
+//
+
+#include "test.h"
+
+#include "algorithms/adler32.h"
+
+#include <string>
+#include <vector>
+
+using namespace CppCommon;
+
+TEST_CASE("Adler-32", "[CppCommon][Algorithms]")
+{
+    // Standard check values (zlib)
+    REQUIRE(Adler32::Calculate("", 0) == 1);
+    REQUIRE(Adler32::Calculate("Wikipedia") == 0x11E60398);
+    REQUIRE(Adler32::Calculate("The quick brown fox jumps over the lazy dog") == 0x5BDC0FDA);
+
+    // Large buffers with deferred modulo reduction
+    std::vector<uint8_t> ones(100000, 0xFF);
+    REQUIRE(Adler32::Calculate(ones.data(), ones.size()) == 0x149A302C);
+    std::string data;
+    for (int i = 0; i < 100000; ++i)
+        data += (char)(i * 31 + 7);
+    REQUIRE(Adler32::Calculate(data) == 0x76F5980F);
+
+    // Streaming checksum of all splits is the same as the whole one
+    for (size_t split = 0; split < 10000; split += 97)
+    {
+        Adler32 adler;
+        adler.Update(std::string_view(data).substr(0, split));
+        adler.Update(std::string_view(data).substr(split));
+        REQUIRE(adler.value() == 0x76F5980F);
+    }
+
+    Adler32 adler;
+    adler.Update("Wikipedia");
+    REQUIRE(adler.value() == 0x11E60398);
+    adler.Reset();
+    REQUIRE(adler.value() == 1);
+}
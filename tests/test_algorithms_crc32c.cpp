@@ -0,0 +1,77 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "test.h"
+
+#include "algorithms/crc32c.h"
+
+#include <string>
+#include <vector>
+
+using namespace CppCommon;
+
+TEST_CASE("CRC-32C", "[CppCommon][Algorithms]")
+{
+    // Standard check values
+    REQUIRE(CRC32C::Calculate("", 0) == 0);
+    REQUIRE(CRC32C::Calculate("123456789") == 0xE3069283);
+    REQUIRE(CRC32C::Calculate("The quick brown fox jumps over the lazy dog") == 0x22620404);
+
+    // RFC 3720 iSCSI test vectors
+    std::vector<uint8_t> zeros(32, 0x00);
+    std::vector<uint8_t> ones(32, 0xFF);
+    std::vector<uint8_t> incrementing(32);
+    for (size_t i = 0; i < incrementing.size(); ++i)
+        incrementing[i] = (uint8_t)i;
+    REQUIRE(CRC32C::Calculate(zeros.data(), zeros.size()) == 0x8A9136AA);
+    REQUIRE(CRC32C::Calculate(ones.data(), ones.size()) == 0x62A8AB43);
+    REQUIRE(CRC32C::Calculate(incrementing.data(), incrementing.size()) == 0x46DD794E);
+
+    // Chained checksum of all unaligned splits is the same as the whole one
+    std::string data;
+    for (int i = 0; i < 1000; ++i)
+        data += (char)(i * 31 + 7);
+    for (size_t offset = 0; offset < 32; ++offset)
+    {
+        for (size_t split = 0; split < 64; ++split)
+        {
+            std::string_view view(data.data() + offset, data.size() - offset);
+            uint32_t chained = CRC32C::Calculate(view.substr(0, split));
+            chained = CRC32C::Calculate(view.substr(split), chained);
+            REQUIRE(chained == CRC32C::Calculate(view));
+        }
+    }
+}
+
+TEST_CASE("CRC-32C large buffers", "[CppCommon][Algorithms]")
+{
+    std::string data;
+    for (int i = 0; i < 100000; ++i)
+        data += (char)(i * 131 + (i >> 8));
+
+    // Interleaved checksum of large buffers is the same as chained checksum of small ones
+    for (size_t offset = 0; offset < 8; ++offset)
+    {
+        for (size_t size : { 767, 768, 769, 3 * 8192, 3 * 8192 + 3 * 256 + 13, 99000 })
+        {
+            std::string_view view = std::string_view(data).substr(offset, size);
+            uint32_t chained = 0;
+            for (size_t position = 0; position < view.size(); position += 100)
+                chained = CRC32C::Calculate(view.substr(position, 100), chained);
+            REQUIRE(CRC32C::Calculate(view) == chained);
+        }
+    }
+}
+
+TEST_CASE("CRC-32C streaming", "[CppCommon][Algorithms]")
+{
+    CRC32C crc;
+    REQUIRE(crc.value() == 0);
+    crc.Update("1234").Update("56789");
+    REQUIRE(crc.value() == 0xE3069283);
+    crc.Reset();
+    REQUIRE(crc.value() == 0);
+    crc.Update("The quick brown fox jumps over the lazy dog");
+    REQUIRE(crc.value() == 0x22620404);
+}
@@ -0,0 +1,140 @@
+//
+// Created by Ivan Shynkarenka on 15.10.2026
+//
+
+#include "test.h"
+
+#include "algorithms/hash.h"
+#include "common/uint128.h"
+#include "containers/hashmap.h"
+#include "filesystem/path.h"
+#include "system/uuid.h"
+#include "time/timestamp.h"
+
+#include <bit>
+#include <set>
+#include <string>
+#include <unordered_set>
+
+using namespace CppCommon;
+
+TEST_CASE("Hash buffers", "[CppCommon][Algorithms]")
+{
+    std::string data;
+    for (int i = 0; i < 300; ++i)
+        data += (char)(i * 31 + 7);
+
+    // Hashes of all prefixes (short, medium and long paths) are deterministic and different
+    std::set<uint64_t> hashes;
+    for (size_t size = 0; size <= data.size(); ++size)
+    {
+        uint64_t hash = Hash::Calculate(data.data(), size);
+        REQUIRE(hash == Hash::Calculate(std::string_view(data.data(), size)));
+        REQUIRE(hash != Hash::Calculate(data.data(), size, 1));
+        hashes.insert(hash);
+    }
+    REQUIRE(hashes.size() == (data.size() + 1));
+
+    // Hash does not depend on the buffer alignment
+    for (size_t offset = 1; offset < 8; ++offset)
+    {
+        std::string copy = std::string(offset, 'x') + data;
+        REQUIRE(Hash::Calculate(copy.data() + offset, data.size()) == Hash::Calculate(data));
+    }
+
+    // Single bit flips change about a half of hash bits
+    uint64_t total = 0;
+    uint64_t flips = 0;
+    for (size_t size : { 3, 8, 13, 16, 40, 100, 300 })
+    {
+        uint64_t hash = Hash::Calculate(data.data(), size);
+        for (size_t bit = 0; bit < size * 8; ++bit)
+        {
+            std::string flipped = data.substr(0, size);
+            flipped[bit / 8] ^= (char)(1 << (bit % 8));
+            uint64_t changed = std::popcount(hash ^ Hash::Calculate(flipped));
+            REQUIRE(changed > 0);
+            total += changed;
+            ++flips;
+        }
+    }
+    REQUIRE(((total / flips) >= 28 && (total / flips) <= 36));
+}
+
+TEST_CASE("Hash integers", "[CppCommon][Algorithms]")
+{
+    // Mixer is bijective and spreads sequential values over all bits
+    std::unordered_set<uint64_t> hashes;
+    uint64_t low_bits = 0;
+    for (uint64_t i = 0; i < 65536; ++i)
+    {
+        uint64_t hash = Hash::Mix(i);
+        hashes.insert(hash);
+        low_bits |= (uint64_t)1 << (hash & 63);
+    }
+    REQUIRE(hashes.size() == 65536);
+    REQUIRE(low_bits == ~(uint64_t)0);
+
+    static_assert(Hash::Mix(1) != Hash::Mix(2), "Mixer must be constexpr!");
+
+    // Pair mixer is not symmetric
+    REQUIRE(Hash::Mix(1, 2) != Hash::Mix(2, 1));
+    REQUIRE(Hash::Mix(0, 0) != Hash::Mix(0, 1));
+}
+
+TEST_CASE("Hash combine", "[CppCommon][Algorithms]")
+{
+    size_t seed1 = 0;
+    HashCombine(seed1, 1);
+    HashCombine(seed1, std::string("test"));
+
+    size_t seed2 = 0;
+    HashCombine(seed2, std::string("test"));
+    HashCombine(seed2, 1);
+
+    size_t seed3 = 0;
+    HashCombine(seed3, 1);
+    HashCombine(seed3, std::string("test"));
+
+    REQUIRE(seed1 != seed2);
+    REQUIRE(seed1 == seed3);
+}
+
+TEST_CASE("Fast hashers", "[CppCommon][Algorithms]")
+{
+    // Transparent string hashers
+    REQUIRE(FastHash<std::string>()(std::string("test")) == FastHash<std::string_view>()(std::string_view("test")));
+    REQUIRE(FastHash<std::string>()("test") == Hash::Calculate("test"));
+    REQUIRE(IsTransparent<FastHash<std::string>>::value);
+
+    // Integers and enums
+    enum class Color { RED, GREEN };
+    REQUIRE(FastHash<int>()(1) == Hash::Mix(1));
+    REQUIRE(FastHash<Color>()(Color::GREEN) == Hash::Mix(1));
+
+    // Types with std::hash specialization only
+    REQUIRE(FastHash<double>()(1.0) == FastHash<double>()(1.0));
+
+    // Library types
+    UUID uuid1 = UUID::Sequential();
+    UUID uuid2 = UUID::Sequential();
+    REQUIRE(FastHash<UUID>()(uuid1) == FastHash<UUID>()(UUID(uuid1)));
+    REQUIRE(FastHash<UUID>()(uuid1) != FastHash<UUID>()(uuid2));
+
+    REQUIRE(FastHash<uint128_t>()(uint128_t(1, 2)) != FastHash<uint128_t>()(uint128_t(2, 1)));
+
+    REQUIRE(FastHash<Path>()(Path("a") / "b") == Hash::Calculate((Path("a") / "b").string()));
+    REQUIRE(std::hash<Path>()(Path("a/b")) == FastHash<Path>()(Path("a/b")));
+    REQUIRE(FastHash<Path>()(Path("a/b")) != FastHash<Path>()(Path("a/c")));
+
+    REQUIRE(FastHash<Timestamp>()(Timestamp(1)) != FastHash<Timestamp>()(Timestamp(2)));
+    REQUIRE(FastHash<Timestamp>()(UtcTimestamp()) != 0);
+
+    // Hash map uses fast hasher by default
+    HashMap<int, int> hashmap;
+    REQUIRE(hashmap.key_hash(1) == FastHash<int>()(1));
+    for (int i = 1; i <= 1000; ++i)
+        hashmap.emplace(i * 1024, i);
+    for (int i = 1; i <= 1000; ++i)
+        REQUIRE(hashmap.find(i * 1024)->second == i);
+}
@@ -0,0 +1,115 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "test.h"
+
+#include "algorithms/keyed_token_bucket.h"
+#include "threads/thread.h"
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace CppCommon;
+
+TEST_CASE("Keyed token bucket", "[CppCommon][Algorithms]")
+{
+    KeyedTokenBucket<uint32_t> tb(1, 10, 4);
+    REQUIRE(tb.shards() == 4);
+    REQUIRE(tb.size() == 0);
+
+    // Consume all tokens in buckets of two keys
+    REQUIRE(tb.Consume(1, 10));
+    REQUIRE(!tb.Consume(1));
+    REQUIRE(tb.Consume(2, 5));
+    REQUIRE(tb.Consume(2, 5));
+    REQUIRE(!tb.Consume(2));
+    REQUIRE(!tb.Consume(3, 11));
+    REQUIRE(tb.size() == 2);
+
+    // Batch consume
+    std::vector<uint32_t> keys = { 1, 2, 3, 4, 3, 3 };
+    std::vector<bool> results;
+    REQUIRE(tb.ConsumeMany(keys, results, 4) == 3);
+    REQUIRE(results == std::vector<bool>({ false, false, true, true, true, false }));
+
+    // Sleep for one second...
+    Thread::SleepFor(Timespan::seconds(1));
+    Thread::SleepFor(Timespan::milliseconds(1));
+
+    REQUIRE(tb.Consume(1));
+    REQUIRE(!tb.Consume(1));
+    REQUIRE(tb.Consume(2));
+    REQUIRE(!tb.Consume(2));
+
+    // Active keys are not expired
+    REQUIRE(tb.Expire() == 0);
+
+    tb.clear();
+    REQUIRE(tb.size() == 0);
+}
+
+TEST_CASE("Keyed token bucket expiration", "[CppCommon][Algorithms]")
+{
+    // Fast refill rate to make keys idle quickly
+    KeyedTokenBucket<std::string> tb(1000, 10, 2, 16);
+
+    for (int i = 0; i < 1000; ++i)
+        REQUIRE(tb.Consume("key" + std::to_string(i)));
+    REQUIRE(tb.size() <= 1000);
+
+    // Sleep until all key buckets are full
+    Thread::SleepFor(Timespan::milliseconds(20));
+
+    // New keys lazily expire idle ones
+    for (int i = 1000; i < 2000; ++i)
+        REQUIRE(tb.Consume("key" + std::to_string(i)));
+    REQUIRE(tb.size() < 2000);
+
+    Thread::SleepFor(Timespan::milliseconds(20));
+    REQUIRE(tb.Expire() > 0);
+    REQUIRE(tb.size() == 0);
+
+    // Expired key bucket is full of burst tokens again
+    REQUIRE(tb.Consume("key0", 10));
+    REQUIRE(!tb.Consume("key0"));
+}
+
+TEST_CASE("Keyed token bucket contention", "[CppCommon][Algorithms]")
+{
+    KeyedTokenBucket<uint64_t> tb(1, 100, 8);
+
+    // Concurrent consumers never exceed burst of each key
+    uint64_t start = Timestamp::nano();
+    std::atomic<uint64_t> consumed(0);
+    std::vector<std::thread> threads;
+    for (int thread = 0; thread < 4; ++thread)
+    {
+        threads.emplace_back([&tb, &consumed, thread]()
+        {
+            uint64_t count = 0;
+            std::vector<uint64_t> keys(64);
+            std::unique_ptr<bool[]> results = std::make_unique<bool[]>(keys.size());
+            for (int i = 0; i < 1000; ++i)
+            {
+                for (size_t j = 0; j < keys.size(); ++j)
+                    keys[j] = 1 + ((i + j + thread) % 100);
+                count += ((i % 2) == 0) ? tb.ConsumeMany(keys.data(), keys.size(), results.get()) : (tb.Consume(keys[0]) ? 1 : 0);
+                if ((i % 100) == 0)
+                    std::this_thread::yield();
+            }
+            consumed += count;
+        });
+    }
+
+    for (auto& thread : threads)
+        thread.join();
+
+    // Each key accumulates one token per second
+    uint64_t seconds = (Timestamp::nano() - start) / 1000000000 + 1;
+    REQUIRE(consumed >= 100 * 100);
+    REQUIRE(consumed <= 100 * (100 + seconds));
+    REQUIRE(tb.size() == 100);
+}
@@ -0,0 +1,97 @@
+//
+// Created by Ivan Shynkarenka on 15.10.2026
+//
+
+#include "test.h"
+
+#include "algorithms/lz4.h"
+
+#include <string>
+#include <vector>
+
+using namespace CppCommon;
+
+namespace {
+
+std::string RoundTrip(const std::string& data)
+{
+    std::vector<uint8_t> compressed(LZ4::Bound(data.size()));
+    size_t size = LZ4::Compress(data.data(), data.size(), compressed.data(), compressed.size());
+    REQUIRE(size > 0);
+    REQUIRE(size <= LZ4::Bound(data.size()));
+
+    std::string result(data.size(), 0);
+    REQUIRE(LZ4::Decompress(compressed.data(), size, result.data(), result.size()) == data.size());
+    return result;
+}
+
+} // namespace
+
+TEST_CASE("LZ4", "[CppCommon][Algorithms]")
+{
+    // Reference block of the short literals
+    uint8_t block[16];
+    REQUIRE(LZ4::Compress("abc", 3, block, sizeof(block)) == 0);
+    REQUIRE(LZ4::Compress("abc", 3, block, LZ4::Bound(3)) == 4);
+    REQUIRE(block[0] == 0x30);
+    REQUIRE(std::string((const char*)block + 1, 3) == "abc");
+
+    // Round trip of repeated, text and random data of different sizes
+    std::string repeated(100000, 'x');
+    std::string text;
+    while (text.size() < 100000)
+        text += "Nobody inspects the spammish repetition. ";
+    std::string random;
+    uint32_t seed = 1;
+    for (size_t i = 0; i < 100000; ++i)
+    {
+        seed = seed * 1103515245 + 12345;
+        random += (char)(seed >> 16);
+    }
+
+    for (size_t size : { 0, 1, 5, 12, 13, 64, 1000, 65536, 100000 })
+    {
+        REQUIRE(RoundTrip(repeated.substr(0, size)) == repeated.substr(0, size));
+        REQUIRE(RoundTrip(text.substr(0, size)) == text.substr(0, size));
+        REQUIRE(RoundTrip(random.substr(0, size)) == random.substr(0, size));
+    }
+
+    // Compressible data is compressed
+    std::vector<uint8_t> compressed(LZ4::Bound(text.size()));
+    REQUIRE(LZ4::Compress(text.data(), text.size(), compressed.data(), compressed.size()) < text.size() / 10);
+}
+
+TEST_CASE("LZ4 malformed blocks", "[CppCommon][Algorithms]")
+{
+    std::string text;
+    while (text.size() < 10000)
+        text += "Nobody inspects the spammish repetition. ";
+
+    std::vector<uint8_t> compressed(LZ4::Bound(text.size()));
+    size_t size = LZ4::Compress(text.data(), text.size(), compressed.data(), compressed.size());
+    std::string result(text.size(), 0);
+
+    // Empty block, small destination buffer and truncated blocks are rejected
+    REQUIRE(LZ4::Decompress(compressed.data(), 0, result.data(), result.size()) == (size_t)-1);
+    REQUIRE(LZ4::Decompress(compressed.data(), size, result.data(), result.size() - 1) == (size_t)-1);
+    for (size_t i = 1; i < size; ++i)
+    {
+        size_t decompressed = LZ4::Decompress(compressed.data(), i, result.data(), result.size());
+        REQUIRE(((decompressed == (size_t)-1) || (decompressed < text.size())));
+    }
+
+    // Offset out of the destination buffer is rejected
+    const uint8_t offset[] = { 0x10, 'a', 0x10, 0x00, 0x50, 'b', 'c', 'd', 'e', 'f' };
+    REQUIRE(LZ4::Decompress(offset, sizeof(offset), result.data(), result.size()) == (size_t)-1);
+
+    // Corrupted blocks never write out of the destination buffer
+    uint32_t seed = 1;
+    for (size_t i = 0; i < 1000; ++i)
+    {
+        std::vector<uint8_t> corrupted(compressed.begin(), compressed.begin() + size);
+        seed = seed * 1103515245 + 12345;
+        corrupted[(seed >> 8) % size] ^= (uint8_t)(1 + (seed >> 24) % 255);
+        size_t decompressed = LZ4::Decompress(corrupted.data(), corrupted.size(), result.data(), result.size());
+        REQUIRE(((decompressed == (size_t)-1) || (decompressed <= result.size())));
+    }
+}
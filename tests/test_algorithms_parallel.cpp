@@ -0,0 +1,134 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "test.h"
+
+#include "algorithms/parallel.h"
+#include "threads/latch.h"
+
+#include <atomic>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+using namespace CppCommon;
+
+TEST_CASE("Parallel for", "[CppCommon][Algorithms]")
+{
+    ThreadPool pool(4);
+
+    std::vector<int> items(100000, 1);
+    ParallelFor(pool, items.begin(), items.end(), [](int& item) { item *= 2; });
+    REQUIRE(std::accumulate(items.begin(), items.end(), 0) == 200000);
+
+    // Small ranges are processed inline
+    std::vector<int> small(10, 1);
+    ParallelFor(pool, small.begin(), small.end(), [&pool](int& item) { item = pool.CurrentWorker(); });
+    REQUIRE(std::count(small.begin(), small.end(), -1) == 10);
+
+    // Empty range
+    std::vector<int> empty;
+    ParallelFor(pool, empty.begin(), empty.end(), [](int& item) { item = 0; });
+
+    // The first exception is rethrown in the calling thread
+    REQUIRE_THROWS_AS(ParallelFor(pool, items.begin(), items.end(), [](int& item) { if (item == 2) throw std::runtime_error("error"); }, 100), std::runtime_error);
+}
+
+TEST_CASE("Parallel transform", "[CppCommon][Algorithms]")
+{
+    ThreadPool pool(4);
+
+    std::vector<int> items(100000);
+    std::iota(items.begin(), items.end(), 0);
+    std::vector<int64_t> results(items.size());
+
+    auto end = ParallelTransform(pool, items.begin(), items.end(), results.begin(), [](int item) { return (int64_t)item * item; }, 1000);
+    REQUIRE(end == results.end());
+    for (size_t i = 0; i < items.size(); ++i)
+        REQUIRE(results[i] == (int64_t)(i * i));
+}
+
+TEST_CASE("Parallel reduce", "[CppCommon][Algorithms]")
+{
+    ThreadPool pool(4);
+
+    std::vector<int> items(100000);
+    std::iota(items.begin(), items.end(), 0);
+
+    int64_t sum = ParallelReduce(pool, items.begin(), items.end(), (int64_t)10, [](int64_t value, int item) { return value + item; });
+    REQUIRE(sum == 10 + (int64_t)(items.size() * (items.size() - 1) / 2));
+
+    // Not commutative reduce keeps the order of chunks
+    std::vector<std::string> words = { "a", "b", "c", "d", "e", "f", "g" };
+    std::string text = ParallelReduce(pool, words.begin(), words.end(), std::string(">"), [](std::string value, const std::string& item) { return value + item; }, 2);
+    REQUIRE(text == ">abcdefg");
+
+    std::vector<int> empty;
+    REQUIRE(ParallelReduce(pool, empty.begin(), empty.end(), 5, [](int value, int item) { return value + item; }) == 5);
+}
+
+TEST_CASE("Parallel sort", "[CppCommon][Algorithms]")
+{
+    ThreadPool pool(4);
+
+    for (size_t size : { 0, 1, 1000, 12345, 100000 })
+    {
+        std::vector<std::pair<int, int>> items(size);
+        for (size_t i = 0; i < size; ++i)
+            items[i] = std::make_pair((int)((i * 7919) % 1000), (int)i);
+
+        ParallelSort(pool, items.begin(), items.end(), [](const auto& item1, const auto& item2) { return item1.first < item2.first; }, 1000);
+
+        // Sort is stable
+        for (size_t i = 1; i < size; ++i)
+        {
+            REQUIRE(items[i - 1].first <= items[i].first);
+            if (items[i - 1].first == items[i].first)
+                REQUIRE(items[i - 1].second < items[i].second);
+        }
+    }
+
+    std::vector<int> items(50000);
+    std::iota(items.rbegin(), items.rend(), 0);
+    ParallelSort(pool, items.begin(), items.end());
+    REQUIRE(std::is_sorted(items.begin(), items.end()));
+}
+
+TEST_CASE("Parallel flat map", "[CppCommon][Algorithms]")
+{
+    ThreadPool pool(4);
+
+    std::vector<std::pair<int, int>> items;
+    for (int i = 0; i < 10000; ++i)
+        items.emplace_back((i * 7919) % 5000, i);
+
+    auto flatmap = ParallelFlatMap<FlatMap<int, int>>(pool, items.begin(), items.end(), 500);
+    REQUIRE(flatmap.size() == 5000);
+
+    // The first item of repeated keys is inserted
+    for (auto& item : flatmap)
+        REQUIRE(item.second < 5000);
+    REQUIRE(flatmap.find(0)->second == 0);
+}
+
+TEST_CASE("Parallel algorithms from thread pool tasks", "[CppCommon][Algorithms]")
+{
+    ThreadPool pool(2);
+
+    // Parallel algorithms called from all workers must not deadlock
+    std::atomic<int64_t> total(0);
+    Latch latch(4);
+    for (int task = 0; task < 4; ++task)
+    {
+        pool.Submit([&pool, &total, &latch]()
+        {
+            std::vector<int> items(10000, 1);
+            total += ParallelReduce(pool, items.begin(), items.end(), (int64_t)0, [](int64_t value, int item) { return value + item; }, 100);
+            latch.CountDown();
+        });
+    }
+    latch.Wait();
+
+    REQUIRE(total == 40000);
+}
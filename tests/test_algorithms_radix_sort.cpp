@@ -0,0 +1,112 @@
+//
+// Created by Ivan Shynkarenka on 15.10.2026
+//
+
+#include "test.h"
+
+#include "algorithms/parallel.h"
+#include "algorithms/radix_sort.h"
+#include "time/timestamp.h"
+
+#include <string>
+#include <vector>
+
+using namespace CppCommon;
+
+namespace {
+
+std::vector<uint64_t> RandomItems(size_t count, uint64_t mask)
+{
+    std::vector<uint64_t> items(count);
+    uint64_t seed = 1;
+    for (auto& item : items)
+    {
+        seed = seed * 6364136223846793005ull + 1442695040888963407ull;
+        item = (seed >> 11) & mask;
+    }
+    return items;
+}
+
+struct Event
+{
+    Timestamp time;
+    int id;
+};
+
+} // namespace
+
+TEST_CASE("Radix sort", "[CppCommon][Algorithms]")
+{
+    for (uint64_t mask : { 0xFFull, 0xFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull })
+    {
+        for (size_t count : { (size_t)0, (size_t)1, (size_t)100, (size_t)100000 })
+        {
+            auto items = RandomItems(count, mask);
+            auto expected = items;
+            std::sort(expected.begin(), expected.end());
+            RadixSort(items.begin(), items.end());
+            REQUIRE(items == expected);
+        }
+    }
+
+    // Signed keys are sorted in the natural order
+    std::vector<int32_t> signed_items;
+    for (int i = 0; i < 10000; ++i)
+        signed_items.push_back(((i * 7919) % 10000) - 5000);
+    RadixSort(signed_items.begin(), signed_items.end());
+    REQUIRE(std::is_sorted(signed_items.begin(), signed_items.end()));
+    REQUIRE(signed_items.front() == -5000);
+}
+
+TEST_CASE("Radix sort by key", "[CppCommon][Algorithms]")
+{
+    Timestamp base = UtcTimestamp();
+
+    std::vector<Event> events;
+    for (int i = 0; i < 10000; ++i)
+        events.push_back(Event{ Timestamp(base.total() + (i * 7919) % 1000), i });
+
+    RadixSort(events.begin(), events.end(), [](const Event& event) { return event.time.total(); });
+
+    // Events are sorted by time and events with the same time keep their order
+    for (size_t i = 1; i < events.size(); ++i)
+    {
+        REQUIRE(events[i - 1].time <= events[i].time);
+        if (events[i - 1].time == events[i].time)
+            REQUIRE(events[i - 1].id < events[i].id);
+    }
+}
+
+TEST_CASE("Parallel radix sort", "[CppCommon][Algorithms]")
+{
+    ThreadPool pool(4);
+
+    for (uint64_t mask : { 0ull, 0xFFull, 0xFFFFFFull, 0xFFFFFFFFFFFFFFFFull })
+    {
+        auto items = RandomItems(1000000, mask);
+        auto expected = items;
+        std::sort(expected.begin(), expected.end());
+        ParallelRadixSort(pool, items.begin(), items.end());
+        REQUIRE(items == expected);
+    }
+
+    // Parallel radix sort is stable
+    std::vector<std::pair<int64_t, int>> pairs;
+    for (int i = 0; i < 100000; ++i)
+        pairs.emplace_back(((i * 7919) % 5000) - 2500, i);
+    ParallelRadixSort(pool, pairs.begin(), pairs.end(), [](const auto& item) { return item.first; }, 1000);
+    for (size_t i = 1; i < pairs.size(); ++i)
+    {
+        REQUIRE(pairs[i - 1].first <= pairs[i].first);
+        if (pairs[i - 1].first == pairs[i].first)
+            REQUIRE(pairs[i - 1].second < pairs[i].second);
+    }
+
+    // Non-trivial items
+    std::vector<std::string> strings;
+    for (int i = 0; i < 10000; ++i)
+        strings.push_back(std::to_string((i * 7919) % 10000));
+    ParallelRadixSort(pool, strings.begin(), strings.end(), [](const std::string& item) { return std::stoi(item); }, 100);
+    for (size_t i = 0; i < strings.size(); ++i)
+        REQUIRE(strings[i] == std::to_string(i));
+}
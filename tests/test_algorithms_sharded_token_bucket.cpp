@@ -0,0 +1,76 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "test.h"
+
+#include "algorithms/sharded_token_bucket.h"
+#include "threads/thread.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace CppCommon;
+
+TEST_CASE("Sharded token bucket", "[CppCommon][Algorithms]")
+{
+    // Zero tolerance sharded token bucket is as accurate as the token bucket
+    ShardedTokenBucket tb1(1, 10, 0, 4);
+    REQUIRE(tb1.shards() == 4);
+    REQUIRE(tb1.batch() == 1);
+    REQUIRE(tb1.tolerance() == 0);
+    REQUIRE(tb1.Consume(10));
+    REQUIRE(!tb1.Consume());
+
+    // Sleep for one second...
+    Thread::SleepFor(Timespan::seconds(1));
+    Thread::SleepFor(Timespan::milliseconds(1));
+
+    REQUIRE(tb1.Consume());
+    REQUIRE(!tb1.Consume());
+    REQUIRE(!tb1.Consume(10));
+
+    // Sharded token bucket could exceed the burst within the tolerance
+    ShardedTokenBucket tb2(1, 1000, 100, 4);
+    REQUIRE(tb2.batch() == 25);
+    REQUIRE(tb2.tolerance() == 100);
+    uint64_t consumed = 0;
+    while (tb2.Consume())
+        ++consumed;
+    REQUIRE(consumed >= 1000);
+    REQUIRE(consumed <= 1000 + tb2.tolerance());
+
+    // Batch is limited with the burst
+    ShardedTokenBucket tb3(1000, 10, 1000, 2);
+    REQUIRE(tb3.batch() == 10);
+}
+
+TEST_CASE("Sharded token bucket contention", "[CppCommon][Algorithms]")
+{
+    const uint64_t burst = 100000;
+    ShardedTokenBucket tb(1, burst, 1000, 8);
+
+    // Concurrent consumers never exceed the burst with the tolerance
+    std::atomic<uint64_t> consumed(0);
+    std::vector<std::thread> threads;
+    for (int thread = 0; thread < 8; ++thread)
+    {
+        threads.emplace_back([&tb, &consumed]()
+        {
+            uint64_t count = 0;
+            while (tb.Consume())
+            {
+                if ((++count % 1000) == 0)
+                    std::this_thread::yield();
+            }
+            consumed += count;
+        });
+    }
+
+    for (auto& thread : threads)
+        thread.join();
+
+    REQUIRE(consumed >= burst);
+    REQUIRE(consumed <= burst + tb.tolerance() + 1);
+}
@@ -38,3 +38,38 @@ TEST_CASE("Token bucket", "[CppCommon][Algorithms]")
     REQUIRE(!tb.Consume(1));
     REQUIRE(!tb.Consume(10));
 }
+
+TEST_CASE("Token bucket reservation", "[CppCommon][Algorithms]")
+{
+    // Token bucket with one token per 10 milliseconds and ten burst tokens
+    TokenBucket tb(100, 10);
+
+    // Full burst is available right now
+    REQUIRE(tb.WaitTime(10) == Timespan::zero());
+    REQUIRE(tb.Reserve(10) == Timespan::zero());
+
+    // Predict the wait time without consuming tokens
+    Timespan wait = tb.WaitTime(2);
+    REQUIRE(wait > Timespan::milliseconds(10));
+    REQUIRE(wait <= Timespan::milliseconds(20));
+    REQUIRE(!tb.Consume());
+
+    // Reserve tokens in the future
+    wait = tb.Reserve(2);
+    REQUIRE(wait > Timespan::milliseconds(10));
+    REQUIRE(wait <= Timespan::milliseconds(20));
+
+    // Following consumers wait for reserved tokens
+    REQUIRE(tb.WaitTime() > Timespan::milliseconds(20));
+
+    // Tokens are not consumed if the wait timeout is not enough
+    REQUIRE(!tb.ConsumeOrWaitFor(1, Timespan::milliseconds(1)));
+    REQUIRE(tb.WaitTime() > Timespan::milliseconds(20));
+
+    // Wait exactly for the required tokens
+    uint64_t start = Timestamp::nano();
+    REQUIRE(tb.ConsumeOrWaitFor(1, Timespan::seconds(1)));
+    uint64_t elapsed = Timestamp::nano() - start;
+    REQUIRE(elapsed >= 20000000);
+    REQUIRE(elapsed < 1000000000);
+}
@@ -0,0 +1,46 @@
+//
+// Created by Ivan Shynkarenka on 15.10.2026
+//
+
+#include "test.h"
+
+#include "algorithms/xxh32.h"
+
+#include <string>
+
+using namespace CppCommon;
+
+TEST_CASE("XXH32", "[CppCommon][Algorithms]")
+{
+    // Reference check values
+    REQUIRE(XXH32::Calculate("", 0) == 0x02CC5D05u);
+    REQUIRE(XXH32::Calculate("abc") == 0x32D153FFu);
+    REQUIRE(XXH32::Calculate("Nobody inspects the spammish repetition") == 0xE2293B2Fu);
+
+    // Seed changes the checksum
+    REQUIRE(XXH32::Calculate("abc", 1) != XXH32::Calculate("abc"));
+
+    std::string data;
+    for (int i = 0; i < 1000; ++i)
+        data += (char)(i * 31 + 7);
+
+    // Streaming checksum of all splits and chunk sizes is the same as the whole one
+    for (size_t size = 0; size <= 200; ++size)
+    {
+        std::string_view view = std::string_view(data).substr(0, size);
+        uint32_t expected = XXH32::Calculate(view, 7);
+        for (size_t chunk = 1; chunk <= 40; ++chunk)
+        {
+            XXH32 xxh32(7);
+            for (size_t offset = 0; offset < view.size(); offset += chunk)
+                xxh32.Update(view.substr(offset, chunk));
+            REQUIRE(xxh32.value() == expected);
+        }
+    }
+
+    XXH32 xxh32;
+    xxh32.Update("abc");
+    REQUIRE(xxh32.value() == 0x32D153FFu);
+    xxh32.Reset();
+    REQUIRE(xxh32.value() == 0x02CC5D05u);
+}
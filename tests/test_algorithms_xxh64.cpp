@@ -0,0 +1,46 @@
+//
+// Created by Ivan Shynkarenka on 15.10.2026
+//
+
+#include "test.h"
+
+#include "algorithms/xxh64.h"
+
+#include <string>
+
+using namespace CppCommon;
+
+TEST_CASE("XXH64", "[CppCommon][Algorithms]")
+{
+    // Reference check values
+    REQUIRE(XXH64::Calculate("", 0) == 0xEF46DB3751D8E999ull);
+    REQUIRE(XXH64::Calculate("abc") == 0x44BC2CF5AD770999ull);
+    REQUIRE(XXH64::Calculate("Nobody inspects the spammish repetition") == 0xFBCEA83C8A378BF1ull);
+
+    // Seed changes the checksum
+    REQUIRE(XXH64::Calculate("abc", 1) != XXH64::Calculate("abc"));
+
+    std::string data;
+    for (int i = 0; i < 1000; ++i)
+        data += (char)(i * 31 + 7);
+
+    // Streaming checksum of all splits and chunk sizes is the same as the whole one
+    for (size_t size = 0; size <= 200; ++size)
+    {
+        std::string_view view = std::string_view(data).substr(0, size);
+        uint64_t expected = XXH64::Calculate(view, 7);
+        for (size_t chunk = 1; chunk <= 40; ++chunk)
+        {
+            XXH64 xxh64(7);
+            for (size_t offset = 0; offset < view.size(); offset += chunk)
+                xxh64.Update(view.substr(offset, chunk));
+            REQUIRE(xxh64.value() == expected);
+        }
+    }
+
+    XXH64 xxh64;
+    xxh64.Update("abc");
+    REQUIRE(xxh64.value() == 0x44BC2CF5AD770999ull);
+    xxh64.Reset();
+    REQUIRE(xxh64.value() == 0xEF46DB3751D8E999ull);
+}
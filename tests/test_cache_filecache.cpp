@@ -63,3 +63,308 @@ TEST_CASE("File cache", "[CppCommon][Cache]")
     REQUIRE(cache.empty());
     REQUIRE(cache.size() == 0);
 }
+
+TEST_CASE("File cache metrics", "[CppCommon][Cache]")
+{
+    FileCache cache;
+
+    cache.insert("a", "12345");
+    cache.insert("b", "123", Timespan::milliseconds(1));
+    cache.insert("a", "1234567890");
+    REQUIRE(cache.find("a").first);
+    REQUIRE(!cache.find("c").first);
+
+    UtcTimestamp utc((UtcTimestamp() + Timespan::seconds(1)).total());
+    REQUIRE(cache.watchdog(utc) == 1);
+
+    CacheMetrics metrics = cache.metrics();
+    REQUIRE(metrics.hits == 1);
+    REQUIRE(metrics.misses == 1);
+    REQUIRE(metrics.inserts == 3);
+    REQUIRE(metrics.expired == 1);
+    REQUIRE(metrics.size == 1);
+    REQUIRE(metrics.weight == 10);
+    REQUIRE(metrics.watchdog_calls == 1);
+    REQUIRE(metrics.watchdog_time >= metrics.watchdog_max_time);
+
+    REQUIRE(cache.remove("a"));
+    metrics = cache.metrics();
+    REQUIRE(metrics.removes == 1);
+    REQUIRE(metrics.weight == 0);
+}
+
+TEST_CASE("File cache shrink", "[CppCommon][Cache]")
+{
+    FileCache cache;
+
+    for (int i = 0; i < 8; ++i)
+        cache.insert("/" + std::to_string(i), std::string((i + 1) * 100, 'x'));
+
+    // The largest cache values are shed first
+    REQUIRE(cache.shrink(0.5) == 4);
+    REQUIRE(cache.size() == 4);
+    REQUIRE(cache.find("/0").first);
+    REQUIRE(cache.find("/3").first);
+    REQUIRE(!cache.find("/4").first);
+    REQUIRE(!cache.find("/7").first);
+
+    CacheMetrics metrics = cache.metrics();
+    REQUIRE(metrics.evictions == 4);
+    REQUIRE(metrics.weight == 1000);
+
+    // Shrink the file cache on memory pressure
+    MemoryPressure pressure(0.0, false);
+    cache.shrink_on_pressure(&pressure, 0.5);
+    REQUIRE(pressure.Poll());
+    REQUIRE(cache.size() == 2);
+    REQUIRE(cache.metrics().weight == 300);
+    cache.shrink_on_pressure(nullptr);
+}
+
+TEST_CASE("File cache prefix index", "[CppCommon][Cache]")
+{
+    FileCache cache;
+
+    cache.insert("/", "root");
+    cache.insert("/app", "app");
+    cache.insert("/static/index.html", "index");
+    cache.insert("/static/js/app.js", "12345");
+    cache.insert("/static/js/lib.js", "123", Timespan::milliseconds(1));
+    cache.insert("/static/jsx/view.jsx", "view");
+
+    // Enumerate cache keys with the given prefix in the sorted order
+    std::vector<std::string> keys = cache.find_prefix("/static/js/");
+    REQUIRE(keys.size() == 2);
+    REQUIRE(keys[0] == "/static/js/app.js");
+    REQUIRE(keys[1] == "/static/js/lib.js");
+    REQUIRE(cache.find_prefix("/static/").size() == 4);
+    REQUIRE(cache.find_prefix("/static/js").size() == 3);
+    REQUIRE(cache.find_prefix("/none/").empty());
+    REQUIRE(cache.find_prefix("").size() == 6);
+
+    // Match the longest route
+    std::string key;
+    auto route = cache.find_route("/static/js/app.js", key);
+    REQUIRE((route.first && (route.second == "12345") && (key == "/static/js/app.js")));
+    route = cache.find_route("/app/users/42", key);
+    REQUIRE((route.first && (route.second == "app") && (key == "/app")));
+    route = cache.find_route("/static/css/main.css", key);
+    REQUIRE((route.first && (route.second == "root") && (key == "/")));
+    route = cache.find_route("relative", key);
+    REQUIRE((!route.first && key.empty()));
+
+    // Expired cache values are removed from the prefix index
+    UtcTimestamp utc((UtcTimestamp() + Timespan::seconds(1)).total());
+    REQUIRE(cache.watchdog(utc) == 1);
+    REQUIRE(cache.find_prefix("/static/js/").size() == 1);
+
+    // Remove the subtree of cache values
+    REQUIRE(cache.remove_prefix("/static/js/") == 1);
+    REQUIRE(cache.remove_prefix("/static/js/") == 0);
+    REQUIRE(cache.find("/static/jsx/view.jsx").first);
+    REQUIRE(cache.size() == 4);
+    REQUIRE(cache.metrics().weight == 16);
+
+    // Replaced cache values are indexed once
+    cache.insert("/app", "application");
+    REQUIRE(cache.find_prefix("/app").size() == 1);
+    REQUIRE(cache.remove_prefix("/") == 4);
+    REQUIRE(cache.empty());
+    REQUIRE(cache.find_prefix("").empty());
+}
+
+TEST_CASE("File cache with memory-mapped files", "[CppCommon][Cache]")
+{
+    Directory test = Directory::CreateTree(Path::current() / "test_mapped" / "sub");
+    File::WriteAllText(test.parent() / "a.txt", "12345");
+    File::WriteAllText(test / "b.txt", "1234567890");
+    File::WriteEmpty(test / "c.txt");
+
+    FileCache cache;
+    REQUIRE(cache.insert_mapped_path(test.parent(), "/static"));
+    REQUIRE(cache.find_path(test.parent()));
+    REQUIRE(cache.size() == 3);
+
+    std::pair<bool, std::string_view> result;
+
+    result = cache.find("/static/a.txt");
+    REQUIRE(result.first);
+    REQUIRE(result.second == "12345");
+    result = cache.find("/static/sub/b.txt");
+    REQUIRE(result.first);
+    REQUIRE(result.second == "1234567890");
+    result = cache.find("/static/sub/c.txt");
+    REQUIRE(result.first);
+    REQUIRE(result.second.empty());
+    REQUIRE(cache.metrics().weight == 15);
+
+    // Replace the mapped cache value with the in-memory one
+    cache.insert("/static/a.txt", "123");
+    result = cache.find("/static/a.txt");
+    REQUIRE(result.first);
+    REQUIRE(result.second == "123");
+    REQUIRE(cache.metrics().weight == 13);
+
+    // Insert the mapped file directly
+    auto file = std::make_shared<MappedFile>(test / "b.txt");
+    REQUIRE(file->size() == 10);
+    REQUIRE(cache.insert("/b", file));
+    REQUIRE(cache.find("/b").second == "1234567890");
+    REQUIRE(!cache.insert("/null", std::shared_ptr<MappedFile>()));
+
+    cache.clear();
+    REQUIRE(cache.empty());
+    REQUIRE(cache.metrics().weight == 0);
+
+    // Missing files are not mapped
+    REQUIRE_THROWS_AS(MappedFile(test / "missing.txt"), FileSystemException);
+
+    file.reset();
+    Directory::RemoveAll(test.parent());
+}
+
+TEST_CASE("File cache with parallel ingest", "[CppCommon][Cache]")
+{
+    Directory test = Directory::CreateTree(Path::current() / "test_parallel" / "sub");
+    for (int i = 0; i < 200; ++i)
+        File::WriteAllText(((i % 2) ? test : test.parent()) / (std::to_string(i) + ".txt"), std::to_string(i));
+
+    // Parallel ingest with batched merge
+    FileCache cache;
+    REQUIRE(cache.insert_path(test.parent(), "/", Timespan(0), nullptr, 4));
+    REQUIRE(cache.size() == 200);
+    for (int i = 0; i < 200; ++i)
+    {
+        std::string key = ((i % 2) ? "/sub/" : "/") + std::to_string(i) + ".txt";
+        auto result = cache.find(key);
+        REQUIRE(result.first);
+        REQUIRE(result.second == std::to_string(i));
+    }
+
+    // Parallel ingest with the custom insert handler
+    std::atomic<size_t> handled(0);
+    cache.clear();
+    REQUIRE(cache.insert_mapped_path(test.parent(), "/static", Timespan(0), [&handled](FileCache& target, const std::string& key, const std::shared_ptr<MappedFile>& file, const Timespan& timeout)
+    {
+        ++handled;
+        return target.insert(key, file, timeout);
+    }, 4));
+    REQUIRE(handled == 200);
+    REQUIRE(cache.size() == 200);
+    REQUIRE(cache.find("/static/sub/199.txt").second == "199");
+
+    // Failed insert handler stops the ingest
+    cache.clear();
+    REQUIRE(!cache.insert_path(test.parent(), "/", Timespan(0), [](FileCache&, const std::string&, const std::string&, const Timespan&) { return false; }, 4));
+
+    cache.clear();
+    Directory::RemoveAll(test.parent());
+}
+
+#if defined(__linux__) || defined(_WIN32) || defined(_WIN64)
+TEST_CASE("File cache with change notifications", "[CppCommon][Cache]")
+{
+    Directory test = Directory::CreateTree(Path::current() / "test_watch" / "sub");
+    File::WriteAllText(test.parent() / "a.txt", "12345");
+    File::WriteAllText(test / "b.txt", "1234567890");
+
+    FileCache cache;
+    REQUIRE(!cache.watch_path(test.parent()));
+    REQUIRE(cache.insert_path(test.parent(), "/static"));
+    REQUIRE(cache.watch_path(test.parent()));
+    REQUIRE(cache.refresh() == 0);
+
+    // Modify, create and remove files
+    File::WriteAllText(test.parent() / "a.txt", "123");
+    File::WriteAllText(test / "c.txt", "c");
+    File::Remove(test / "b.txt");
+
+    // Filesystem change notifications are asynchronous on some platforms
+    for (int i = 0; (i < 100) && (cache.find("/static/a.txt").second != "123"); ++i)
+    {
+        cache.refresh();
+        Thread::SleepFor(Timespan::milliseconds(10));
+    }
+    cache.refresh();
+
+    REQUIRE(cache.find("/static/a.txt").second == "123");
+    REQUIRE(cache.find("/static/sub/c.txt").second == "c");
+    REQUIRE(!cache.find("/static/sub/b.txt").first);
+    REQUIRE(cache.size() == 2);
+
+    // Remove the whole sub-directory
+    Directory::RemoveAll(test);
+    for (int i = 0; (i < 100) && cache.find("/static/sub/c.txt").first; ++i)
+    {
+        cache.refresh();
+        Thread::SleepFor(Timespan::milliseconds(10));
+    }
+    REQUIRE(!cache.find("/static/sub/c.txt").first);
+    REQUIRE(cache.size() == 1);
+
+    REQUIRE(cache.remove_path(test.parent()));
+    cache.clear();
+    Directory::RemoveAll(test.parent());
+}
+#endif
+
+TEST_CASE("File cache with precompressed variants", "[CppCommon][Cache]")
+{
+    Directory test = Directory::CreateTree(Path::current() / "test_variants");
+    File::WriteAllText(test / "a.txt", std::string(100, 'a'));
+    File::WriteAllText(test / "b.txt", "b");
+
+    // Simple run-length encoder and the encoder which never shrinks content
+    FileCache::Encoders encoders;
+    encoders.emplace_back("rle", [](std::string_view content, std::string& output)
+    {
+        for (size_t i = 0; i < content.size();)
+        {
+            size_t j = i;
+            while ((j < content.size()) && (content[j] == content[i]))
+                ++j;
+            output += std::to_string(j - i) + content[i];
+            i = j;
+        }
+        return true;
+    });
+    encoders.emplace_back("copy", [](std::string_view content, std::string& output)
+    {
+        output = content;
+        return true;
+    });
+
+    FileCache cache;
+    REQUIRE(cache.insert_path(test, "/", Timespan(0), nullptr, 2, encoders));
+    REQUIRE(cache.metrics().weight == 105);
+
+    std::pair<bool, std::string_view> result;
+    std::string_view encoding;
+
+    result = cache.find("/a.txt", { "gzip", "rle" }, encoding);
+    REQUIRE(result.first);
+    REQUIRE(result.second == "100a");
+    REQUIRE(encoding == "rle");
+
+    result = cache.find("/a.txt", { "gzip", "copy" }, encoding);
+    REQUIRE(result.first);
+    REQUIRE(result.second.size() == 100);
+    REQUIRE(encoding.empty());
+
+    result = cache.find("/b.txt", { "rle" }, encoding);
+    REQUIRE(result.first);
+    REQUIRE(result.second == "b");
+    REQUIRE(encoding.empty());
+
+    REQUIRE(!cache.find("/c.txt", { "rle" }, encoding).first);
+
+    // Precompressed variants of memory-mapped files
+    cache.clear();
+    REQUIRE(cache.insert_mapped_path(test, "/", Timespan(0), nullptr, 1, encoders));
+    result = cache.find("/a.txt", { "rle" }, encoding);
+    REQUIRE(result.second == "100a");
+    REQUIRE(encoding == "rle");
+
+    cache.clear();
+    Directory::RemoveAll(test);
+}
@@ -0,0 +1,114 @@
+//
+// Created by Ivan Shynkarenka on 15.10.2026
+//
+
+#include "test.h"
+
+#include "cache/lrucache.h"
+
+#include <memory>
+#include <string>
+
+using namespace CppCommon;
+
+TEST_CASE("LRU cache", "[CppCommon][Cache]")
+{
+    LruCache<std::string, int> cache(3);
+    REQUIRE(cache.empty());
+    REQUIRE(cache.capacity() == 3);
+    REQUIRE(cache.policy() == LruCachePolicy::LRU);
+
+    REQUIRE(cache.insert("1", 1));
+    REQUIRE(cache.insert("2", 2));
+    REQUIRE(cache.emplace("3", 3));
+    REQUIRE(cache.size() == 3);
+
+    // Touch the oldest value, so the next one is evicted
+    int result = 0;
+    REQUIRE(cache.find("1", result));
+    REQUIRE(result == 1);
+    REQUIRE(cache.insert("4", 4));
+    REQUIRE(cache.size() == 3);
+    REQUIRE(cache.contains("1"));
+    REQUIRE(!cache.contains("2"));
+    REQUIRE(cache.contains("3"));
+    REQUIRE(cache.contains("4"));
+
+    // Replace the cached value
+    REQUIRE(!cache.insert("3", 33));
+    REQUIRE(*cache.find("3") == 33);
+    REQUIRE(cache.find("2") == nullptr);
+
+    // Update the cached value in place
+    *cache.find("4") = 44;
+    REQUIRE(cache.find("4", result));
+    REQUIRE(result == 44);
+
+    REQUIRE(cache.remove("4"));
+    REQUIRE(!cache.remove("4"));
+    REQUIRE(cache.size() == 2);
+
+    CacheMetrics metrics = cache.metrics();
+    REQUIRE(metrics.inserts == 5);
+    REQUIRE(metrics.hits == 4);
+    REQUIRE(metrics.misses == 1);
+    REQUIRE(metrics.evictions == 1);
+    REQUIRE(metrics.removes == 1);
+    REQUIRE(metrics.size == 2);
+
+    cache.clear();
+    REQUIRE(cache.empty());
+    REQUIRE(!cache.contains("1"));
+}
+
+TEST_CASE("LRU cache 2Q", "[CppCommon][Cache]")
+{
+    LruCache<int, int> cache(100, LruCachePolicy::TWO_Q, -1);
+    REQUIRE(cache.policy() == LruCachePolicy::TWO_Q);
+
+    // Admit the working set into the main queue with the second access
+    for (int i = 0; i < 75; ++i)
+        cache.insert(i, i);
+    for (int i = 0; i < 75; ++i)
+        REQUIRE(cache.find(i) != nullptr);
+    for (int i = 0; i < 75; ++i)
+        REQUIRE(cache.contains(i));
+
+    // Scan does not flush the working set
+    for (int i = 1000; i < 100000; ++i)
+        cache.insert(i, i);
+    REQUIRE(cache.size() == 100);
+    int working = 0;
+    for (int i = 0; i < 75; ++i)
+        if (cache.contains(i))
+            ++working;
+    REQUIRE(working == 75);
+
+    // Keys recently evicted from the recent queue are admitted on the next insert
+    REQUIRE(!cache.contains(99950));
+    REQUIRE(cache.insert(99950, 0));
+    REQUIRE(!cache.insert(99950, 0));
+
+    // Plain LRU cache is flushed by the same scan
+    LruCache<int, int> lru(100, LruCachePolicy::LRU, -1);
+    for (int i = 0; i < 75; ++i)
+        lru.insert(i, i);
+    for (int i = 1000; i < 100000; ++i)
+        lru.insert(i, i);
+    for (int i = 0; i < 75; ++i)
+        REQUIRE(!lru.contains(i));
+}
+
+TEST_CASE("LRU cache values lifetime", "[CppCommon][Cache]")
+{
+    auto value = std::make_shared<int>(42);
+    {
+        LruCache<int, std::shared_ptr<int>> cache(10, LruCachePolicy::TWO_Q, -1);
+        for (int i = 0; i < 100; ++i)
+            cache.insert(i, value);
+        REQUIRE(value.use_count() == 11);
+        REQUIRE(cache.remove(99));
+        REQUIRE(value.use_count() == 10);
+    }
+    REQUIRE(value.use_count() == 1);
+}
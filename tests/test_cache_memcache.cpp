@@ -7,6 +7,12 @@
 #include "cache/memcache.h"
 #include "threads/thread.h"
 
+#include <atomic>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
 using namespace CppCommon;
 
 TEST_CASE("Memory cache", "[CppCommon][Cache]")
@@ -63,3 +69,258 @@ TEST_CASE("Memory cache", "[CppCommon][Cache]")
     REQUIRE(cache.empty());
     REQUIRE(cache.size() == 0);
 }
+
+TEST_CASE("Memory cache with LRU eviction", "[CppCommon][Cache]")
+{
+    MemCache<int, int> cache(1, 3, MemCacheEviction::LRU);
+    REQUIRE(cache.capacity() == 3);
+
+    cache.insert(1, 1);
+    cache.insert(2, 2);
+    cache.insert(3, 3);
+
+    // Touch the oldest cache value to make it the most recently used
+    REQUIRE(cache.find(1));
+
+    // Exceed the capacity to evict the least recently used cache value
+    cache.insert(4, 4);
+    REQUIRE(cache.size() == 3);
+    REQUIRE(cache.find(1));
+    REQUIRE(!cache.find(2));
+    REQUIRE(cache.find(3));
+    REQUIRE(cache.find(4));
+
+    // Replace of the present key must not evict anything
+    cache.insert(3, 30);
+    REQUIRE(cache.size() == 3);
+    int result = 0;
+    REQUIRE(cache.find(3, result));
+    REQUIRE(result == 30);
+}
+
+TEST_CASE("Memory cache with CLOCK eviction", "[CppCommon][Cache]")
+{
+    MemCache<int, int> cache(1, 3, MemCacheEviction::CLOCK);
+
+    cache.insert(1, 1);
+    cache.insert(2, 2);
+    cache.insert(3, 3);
+
+    // Referenced cache values receive the second chance
+    REQUIRE(cache.find(1));
+    REQUIRE(cache.find(2));
+
+    cache.insert(4, 4);
+    REQUIRE(cache.size() == 3);
+    REQUIRE(cache.find(1));
+    REQUIRE(cache.find(2));
+    REQUIRE(!cache.find(3));
+    REQUIRE(cache.find(4));
+}
+
+namespace {
+
+struct StringWeigher
+{
+    size_t operator()(const std::string& key, const std::string& value) const noexcept { return key.size() + value.size(); }
+};
+
+} // namespace
+
+TEST_CASE("Memory cache bounded by bytes", "[CppCommon][Cache]")
+{
+    MemCache<std::string, std::string, StringWeigher> cache(1, 100);
+
+    // Cache value larger than the capacity must be rejected
+    REQUIRE(!cache.insert("big", std::string(200, 'x')));
+    REQUIRE(cache.empty());
+
+    for (int i = 0; i < 10; ++i)
+        REQUIRE(cache.insert("key" + std::to_string(i), std::string(16, 'x')));
+    REQUIRE(cache.size() == 5);
+    REQUIRE(cache.weight() == 100);
+    REQUIRE(!cache.find("key4"));
+    REQUIRE(cache.find("key5"));
+    REQUIRE(cache.find("key9"));
+
+    REQUIRE(cache.remove("key9"));
+    REQUIRE(cache.weight() == 80);
+    cache.clear();
+    REQUIRE(cache.weight() == 0);
+}
+
+TEST_CASE("Sharded memory cache", "[CppCommon][Cache]")
+{
+    const int keys = 10000;
+    const int threads_count = 4;
+    MemCache<int, int> cache(16, keys / 2, MemCacheEviction::CLOCK);
+    REQUIRE(cache.shards() == 16);
+
+    std::atomic<int> errors(0);
+    std::vector<std::thread> threads;
+    for (int thread = 0; thread < threads_count; ++thread)
+    {
+        threads.emplace_back([&cache, &errors, thread]()
+        {
+            for (int i = 0; i < keys; ++i)
+            {
+                int key = (i * threads_count + thread) % keys;
+                int value;
+                if (cache.find(key, value) && (value != key))
+                    ++errors;
+                cache.insert(key, key, Timespan::seconds(60));
+            }
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+    REQUIRE(errors == 0);
+
+    // Every shard is bounded with its part of the capacity
+    REQUIRE(cache.size() <= (size_t)(keys / 2 + cache.shards()));
+    REQUIRE(cache.size() == cache.weight());
+
+    cache.watchdog(UtcTimestamp((UtcTimestamp() + Timespan::seconds(120)).total()));
+    REQUIRE(cache.empty());
+}
+
+TEST_CASE("Memory cache with limited watchdog", "[CppCommon][Cache]")
+{
+    MemCache<int, int> cache(4);
+
+    for (int i = 0; i < 100; ++i)
+        cache.insert(i, i, Timespan::milliseconds(10 + (i % 2) * 10000));
+
+    // Replaced and removed cache values leave stale timers which must be skipped
+    cache.insert(0, 0);
+    REQUIRE(cache.remove(2));
+
+    UtcTimestamp utc((UtcTimestamp() + Timespan::seconds(1)).total());
+    size_t erased = 0;
+    size_t batch;
+    while ((batch = cache.watchdog(utc, 10)) > 0)
+        erased += batch;
+    erased += cache.watchdog(utc);
+    REQUIRE(erased == 48);
+    REQUIRE(cache.size() == 51);
+    REQUIRE(cache.find(0));
+    REQUIRE(cache.find(1));
+    REQUIRE(!cache.find(4));
+}
+
+TEST_CASE("Memory cache visit and single flight load", "[CppCommon][Cache]")
+{
+    MemCache<int, std::string> cache(4);
+    cache.insert(1, "value");
+
+    // Visit the cache value in place
+    size_t length = 0;
+    REQUIRE(cache.visit(1, [&length](const std::string& value) { length = value.size(); }));
+    REQUIRE(length == 5);
+    REQUIRE(!cache.visit(2, [](const std::string&) {}));
+
+    // Cache hit must not call the loader
+    std::string result;
+    REQUIRE(cache.get_or_insert(1, result, [](int, std::string&) { return false; }));
+    REQUIRE(result == "value");
+
+    // Failed load must not insert anything
+    REQUIRE(!cache.get_or_insert(2, result, [](int, std::string&) { return false; }));
+    REQUIRE(!cache.find(2));
+
+    // Thrown exception must be propagated
+    REQUIRE_THROWS(cache.get_or_insert(2, result, [](int, std::string&) -> bool { throw std::runtime_error("error"); }));
+    REQUIRE(!cache.find(2));
+
+    // Concurrent misses of the same key must be collapsed into a single load
+    const int threads_count = 8;
+    std::atomic<int> loads(0);
+    std::atomic<int> errors(0);
+    std::vector<std::thread> threads;
+    for (int thread = 0; thread < threads_count; ++thread)
+    {
+        threads.emplace_back([&cache, &loads, &errors]()
+        {
+            std::string value;
+            bool loaded = cache.get_or_insert(3, value, [&loads](int key, std::string& loaded_value)
+            {
+                ++loads;
+                Thread::SleepFor(Timespan::milliseconds(100));
+                loaded_value = std::to_string(key);
+                return true;
+            });
+            if (!loaded || (value != "3"))
+                ++errors;
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+    REQUIRE(errors == 0);
+    REQUIRE(loads == 1);
+    REQUIRE(cache.find(3, result));
+    REQUIRE(result == "3");
+}
+
+TEST_CASE("Memory cache metrics", "[CppCommon][Cache]")
+{
+    MemCache<int, int> cache(4, 8);
+
+    for (int i = 0; i < 16; ++i)
+        cache.insert(i, i, Timespan::milliseconds(1));
+    for (int i = 0; i < 16; ++i)
+        cache.find(i);
+
+    CacheMetrics metrics = cache.metrics();
+    REQUIRE(metrics.inserts == 16);
+    REQUIRE(metrics.evictions == 8);
+    REQUIRE(metrics.hits == 8);
+    REQUIRE(metrics.misses == 8);
+    REQUIRE(metrics.hit_ratio() == 0.5);
+    REQUIRE(metrics.size == 8);
+    REQUIRE(metrics.weight == 8);
+
+    UtcTimestamp utc((UtcTimestamp() + Timespan::seconds(1)).total());
+    REQUIRE(cache.watchdog(utc) == 8);
+    metrics = cache.metrics();
+    REQUIRE(metrics.expired == 8);
+    REQUIRE(metrics.size == 0);
+    REQUIRE(metrics.watchdog_calls == 1);
+}
+
+TEST_CASE("Memory cache shrink", "[CppCommon][Cache]")
+{
+    MemCache<int, int> cache;
+
+    int evicted = 0;
+    cache.eviction_handler([&evicted](const int&, int&&) { ++evicted; });
+
+    for (int i = 0; i < 64; ++i)
+        cache.insert(i, i);
+
+    REQUIRE(cache.shrink(0.5) == 32);
+    REQUIRE(cache.size() == 32);
+    REQUIRE(cache.metrics().evictions == 32);
+    REQUIRE(evicted == 0);
+    REQUIRE(cache.shrink(0.0) == 0);
+
+    // Shrink the memory cache on memory pressure
+    MemoryPressure pressure(0.0, false);
+    cache.shrink_on_pressure(&pressure, 0.25);
+    REQUIRE(pressure.Poll());
+    REQUIRE(cache.size() == 24);
+    cache.shrink_on_pressure(nullptr);
+    REQUIRE(pressure.Poll());
+    REQUIRE(cache.size() == 24);
+
+    REQUIRE(cache.shrink(1.0) == 24);
+    REQUIRE(cache.empty());
+
+    // Each shard is shrunk by the given fraction of its cache values
+    MemCache<int, int> sharded(4);
+    for (int i = 0; i < 64; ++i)
+        sharded.insert(i, i);
+    size_t shed = sharded.shrink(0.5);
+    REQUIRE(shed >= 32);
+    REQUIRE(shed <= 36);
+    REQUIRE((sharded.size() + shed) == 64);
+}
@@ -0,0 +1,163 @@
+//
+// Created by Ivan Shynkarenka on 15.10.2026
+//
+
+#include "test.h"
+
+#include "cache/tieredcache.h"
+#include "filesystem/directory.h"
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+using namespace CppCommon;
+
+TEST_CASE("Segment store", "[CppCommon][Cache]")
+{
+    Path path = Path::current() / "test_segments";
+    if (path.IsExists())
+        Directory::RemoveAll(path);
+
+    {
+        SegmentStore store(path, 64);
+        store.Open();
+        REQUIRE(store.empty());
+
+        // Fill the segment store with rolling segments
+        store.insert("a", "1111111111");
+        store.insert("b", "2222222222");
+        store.insert("c", "3333333333");
+        store.insert("a", "4444444444");
+        REQUIRE(store.remove("b"));
+        REQUIRE(!store.remove("b"));
+        REQUIRE(store.size() == 2);
+        REQUIRE(store.segments() > 1);
+        REQUIRE(store.garbage() > 0);
+
+        std::string value;
+        REQUIRE(store.find("a", value));
+        REQUIRE(value == "4444444444");
+        REQUIRE(!store.find("b", value));
+        REQUIRE(store.find("c"));
+    }
+
+    {
+        // Append the torn record into the last segment
+        std::vector<Path> segments = Directory(path).GetEntries();
+        std::sort(segments.begin(), segments.end());
+        File last(segments.back());
+        last.Open(false, true);
+        last.Seek(last.size());
+        last.Write("torn", 4);
+        last.Close();
+    }
+
+    {
+        // Rebuild the index from segments
+        SegmentStore store(path, 64);
+        store.Open();
+        REQUIRE(store.size() == 2);
+
+        std::string value;
+        REQUIRE(store.find("a", value));
+        REQUIRE(value == "4444444444");
+        REQUIRE(!store.find("b"));
+        REQUIRE(store.find("c", value));
+        REQUIRE(value == "3333333333");
+
+        // Compact the segment store
+        uint64_t bytes = store.bytes();
+        REQUIRE(store.Compact() > 0);
+        REQUIRE(store.bytes() < bytes);
+        REQUIRE(store.garbage() == 0);
+        REQUIRE(store.find("a", value));
+        REQUIRE(value == "4444444444");
+
+        store.clear();
+        REQUIRE(store.empty());
+        REQUIRE(store.segments() == 1);
+    }
+
+    Directory::RemoveAll(path);
+}
+
+TEST_CASE("Tiered cache", "[CppCommon][Cache]")
+{
+    Path path = Path::current() / "test_tiered";
+    if (path.IsExists())
+        Directory::RemoveAll(path);
+
+    {
+        TieredCache<std::string, int> cache(path / "disk", 1, 2);
+
+        // Demote evicted cache values into the disk tier
+        for (int i = 0; i < 5; ++i)
+            cache.insert(std::to_string(i), i);
+        REQUIRE(cache.size() == 5);
+        REQUIRE(cache.memory().size() == 2);
+        REQUIRE(cache.disk().size() == 3);
+        REQUIRE(cache.demotions() == 3);
+
+        // Promote the cache value back into the memory tier
+        int value = 0;
+        REQUIRE(cache.find("0", value));
+        REQUIRE(value == 0);
+        REQUIRE(cache.promotions() == 1);
+        REQUIRE(cache.memory().find("0"));
+        REQUIRE(!cache.disk().find("0"));
+        REQUIRE(cache.size() == 5);
+
+        // Replace the cache value stored in the disk tier
+        cache.insert("1", 100);
+        REQUIRE(cache.find("1", value));
+        REQUIRE(value == 100);
+
+        // Load the missing cache value
+        REQUIRE(cache.get_or_insert("5", value, [](const std::string& key, int& v) { v = std::stoi(key); return true; }));
+        REQUIRE(value == 5);
+        REQUIRE(!cache.get_or_insert("6", value, [](const std::string&, int&) { return false; }));
+
+        REQUIRE(cache.remove("2"));
+        REQUIRE(!cache.find("2", value));
+        REQUIRE(cache.size() == 5);
+
+        // Save the memory tier snapshot
+        REQUIRE(cache.Save(path / "snapshot") == 2);
+    }
+
+    {
+        TieredCache<std::string, int> cache(path / "disk", 1, 2);
+        REQUIRE(cache.memory().empty());
+        REQUIRE(cache.disk().size() == 3);
+
+        // Warm start from the memory tier snapshot
+        REQUIRE(cache.Load(path / "snapshot") == 2);
+        REQUIRE(cache.memory().size() == 2);
+        REQUIRE(cache.size() == 5);
+
+        int value = 0;
+        REQUIRE(cache.memory().find("5", value));
+        REQUIRE(value == 5);
+        REQUIRE(cache.find("1", value));
+        REQUIRE(value == 100);
+
+        cache.clear();
+        REQUIRE(cache.empty());
+        REQUIRE(cache.Load(path / "missing") == 0);
+    }
+
+    {
+        // Corrupted snapshot
+        File snapshot(path / "snapshot");
+        snapshot.Open(false, true);
+        snapshot.Seek(snapshot.size() - 1);
+        snapshot.Write("X", 1);
+        snapshot.Close();
+
+        TieredCache<std::string, int> cache(path / "disk", 1, 2);
+        REQUIRE_THROWS_AS(cache.Load(path / "snapshot"), std::invalid_argument);
+    }
+
+    Directory::RemoveAll(path);
+}
@@ -0,0 +1,112 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "test.h"
+
+#include "cache/timerwheel.h"
+
+#include <algorithm>
+#include <limits>
+#include <random>
+#include <vector>
+
+using namespace CppCommon;
+
+TEST_CASE("Timer wheel", "[CppCommon][Cache]")
+{
+    Timestamp start(1000000000);
+    TimerWheel<int> wheel(Timespan::milliseconds(1), start);
+    REQUIRE(wheel.empty());
+
+    wheel.insert(start + Timespan::milliseconds(10), 1);
+    wheel.insert(start + Timespan::seconds(5), 2);
+    wheel.insert(start + Timespan::hours(2), 3);
+    wheel.insert(start - Timespan::seconds(1), 4);
+    REQUIRE(wheel.size() == 4);
+
+    std::vector<int> expired;
+    auto handler = [&expired](const Timestamp&, int item) { expired.push_back(item); };
+
+    // Already expired item
+    REQUIRE(wheel.expire(start, handler) == 1);
+    REQUIRE(expired == std::vector<int>({ 4 }));
+
+    REQUIRE(wheel.expire(start + Timespan::milliseconds(9), handler) == 0);
+    REQUIRE(wheel.expire(start + Timespan::milliseconds(10), handler) == 1);
+    REQUIRE(wheel.expire(start + Timespan::seconds(10), handler) == 1);
+    REQUIRE(wheel.expire(start + Timespan::hours(1), handler) == 0);
+    REQUIRE(wheel.expire(start + Timespan::hours(3), handler) == 1);
+    REQUIRE(expired == std::vector<int>({ 4, 1, 2, 3 }));
+    REQUIRE(wheel.empty());
+}
+
+TEST_CASE("Timer wheel next expiration", "[CppCommon][Cache]")
+{
+    Timestamp start(1000000000);
+    TimerWheel<int> wheel(Timespan::milliseconds(1), start);
+    REQUIRE(wheel.next().total() == std::numeric_limits<uint64_t>::max());
+
+    // Exact expiration timestamp of the nearest level
+    wheel.insert(start + Timespan::microseconds(10500), 1);
+    wheel.insert(start + Timespan::seconds(5), 2);
+    REQUIRE(wheel.next() == (start + Timespan::microseconds(10500)));
+
+    // Follow next expiration timestamps until all items are expired
+    std::vector<int> expired;
+    auto handler = [&expired](const Timestamp&, int item) { expired.push_back(item); };
+    size_t wakeups = 0;
+    while (!wheel.empty())
+    {
+        Timestamp next = wheel.next();
+        REQUIRE(next <= (start + Timespan::seconds(5)));
+        wheel.expire(next, handler);
+        ++wakeups;
+    }
+    REQUIRE(expired == std::vector<int>({ 1, 2 }));
+    REQUIRE(wakeups < 10);
+}
+
+TEST_CASE("Timer wheel random expiration", "[CppCommon][Cache]")
+{
+    // Nanosecond resolution makes the range of all levels only 2^32 ns (~4.3 seconds)
+    Timestamp start(1000000000);
+    TimerWheel<size_t> wheel(Timespan(1), start);
+
+    std::default_random_engine random;
+    std::uniform_int_distribution<int64_t> distribution(0, 20000000000ll);
+
+    const size_t count = 10000;
+    std::vector<Timestamp> timestamps;
+    for (size_t i = 0; i < count; ++i)
+    {
+        timestamps.push_back(start + Timespan(distribution(random)));
+        wheel.insert(timestamps.back(), i);
+    }
+
+    // Expire items with limited batches moving the time forward
+    std::vector<bool> expired(count, false);
+    Timestamp current = start;
+    size_t total = 0;
+    bool valid = true;
+    while (total < count)
+    {
+        current += Timespan(distribution(random) / 1000);
+        size_t batch;
+        do
+        {
+            batch = wheel.expire(current, [&](const Timestamp& expire, size_t item)
+            {
+                valid = valid && (expire == timestamps[item]) && (expire <= current) && !expired[item];
+                expired[item] = true;
+            }, 100);
+            total += batch;
+        } while (batch == 100);
+
+        // All items with passed timestamps must be expired
+        for (size_t i = 0; i < count; ++i)
+            valid = valid && (expired[i] == (timestamps[i] <= current));
+        REQUIRE(valid);
+    }
+    REQUIRE(wheel.empty());
+}
@@ -0,0 +1,207 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "test.h"
+#include "test_streams.h"
+
+#include "common/binary_serializer.h"
+#include "threads/spsc_ring_buffer.h"
+
+#include <cstring>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace CppCommon;
+
+namespace {
+
+enum class Side : uint8_t { BUY, SELL };
+
+struct Level
+{
+    int64_t price;
+    uint32_t quantity;
+};
+
+struct Order
+{
+    uint64_t id;
+    int32_t offset;
+    Side side;
+    bool active;
+    double price;
+    float ratio;
+    std::string_view symbol;
+    std::string comment;
+    std::vector<uint8_t> payload;
+    Level level;
+};
+
+Order MakeOrder()
+{
+    Order order;
+    order.id = 300;
+    order.offset = -2;
+    order.side = Side::SELL;
+    order.active = true;
+    order.price = 1.0825;
+    order.ratio = 0.5f;
+    order.symbol = "EUR/USD";
+    order.comment = "limit";
+    order.payload = { 1, 2, 3 };
+    order.level = { -5, 1000 };
+    return order;
+}
+
+void RequireOrder(const Order& order, const Order& expected)
+{
+    REQUIRE(order.id == expected.id);
+    REQUIRE(order.offset == expected.offset);
+    REQUIRE(order.side == expected.side);
+    REQUIRE(order.active == expected.active);
+    REQUIRE(order.price == expected.price);
+    REQUIRE(order.ratio == expected.ratio);
+    REQUIRE(order.symbol == expected.symbol);
+    REQUIRE(order.comment == expected.comment);
+    REQUIRE(order.payload == expected.payload);
+    REQUIRE(order.level.price == expected.level.price);
+    REQUIRE(order.level.quantity == expected.level.quantity);
+}
+
+} // namespace
+
+namespace CppCommon {
+
+template <>
+struct BinarySchema<Level>
+{
+    typedef std::tuple<
+        BinaryField<&Level::price, BinaryEncoding::VARINT>,
+        BinaryField<&Level::quantity>> fields;
+};
+
+template <>
+struct BinarySchema<Order>
+{
+    typedef std::tuple<
+        BinaryField<&Order::id, BinaryEncoding::VARINT>,
+        BinaryField<&Order::offset, BinaryEncoding::VARINT>,
+        BinaryField<&Order::side>,
+        BinaryField<&Order::active>,
+        BinaryField<&Order::price>,
+        BinaryField<&Order::ratio>,
+        BinaryField<&Order::symbol>,
+        BinaryField<&Order::comment>,
+        BinaryField<&Order::payload>,
+        BinaryField<&Order::level>> fields;
+};
+
+} // namespace CppCommon
+
+TEST_CASE("Binary serializer", "[CppCommon][Common]")
+{
+    Order order = MakeOrder();
+
+    // id(2) + offset(1) + side(1) + active(1) + price(8) + ratio(4) + symbol(1 + 7) + comment(1 + 5) + payload(1 + 3) + level(1 + 4)
+    REQUIRE(BinarySerializer::Size(order) == 40);
+
+    uint8_t buffer[64];
+    REQUIRE(BinarySerializer::Serialize(order, std::span<uint8_t>(buffer, 39)) == 0);
+    REQUIRE(BinarySerializer::Serialize(order, buffer) == 40);
+
+    // Check the wire format
+    const uint8_t header[] = { 0xAC, 0x02, 0x03, 0x01, 0x01 };
+    REQUIRE(std::memcmp(buffer, header, sizeof(header)) == 0);
+    REQUIRE(Endian::LoadLittleEndian<uint64_t>(buffer + 5) == std::bit_cast<uint64_t>(1.0825));
+    REQUIRE(buffer[17] == 7);
+    REQUIRE(std::memcmp(buffer + 18, "EUR/USD", 7) == 0);
+    const uint8_t level[] = { 0x09, 0xE8, 0x03, 0x00, 0x00 };
+    REQUIRE(std::memcmp(buffer + 35, level, sizeof(level)) == 0);
+
+    // Deserialize views into the buffer
+    Order result;
+    REQUIRE(BinarySerializer::Deserialize(std::span<const uint8_t>(buffer, 40), result) == 40);
+    RequireOrder(result, order);
+    REQUIRE(result.symbol.data() == (const char*)buffer + 18);
+
+    // Truncated buffer
+    for (size_t size = 0; size < 40; ++size)
+        REQUIRE(BinarySerializer::Deserialize(std::span<const uint8_t>(buffer, size), result) == 0);
+
+    // Malformed bool value
+    buffer[4] = 2;
+    REQUIRE(BinarySerializer::Deserialize(std::span<const uint8_t>(buffer, 40), result) == 0);
+}
+
+TEST_CASE("Binary serializer varints", "[CppCommon][Common]")
+{
+    Level level;
+    uint8_t buffer[32];
+
+    const int64_t values[] = { 0, 1, -1, 63, -64, 64, std::numeric_limits<int64_t>::max(), std::numeric_limits<int64_t>::min() };
+    for (int64_t value : values)
+    {
+        level = { value, 0 };
+        size_t size = BinarySerializer::Serialize(level, buffer);
+        REQUIRE(size == BinarySerializer::Size(level));
+        Level result;
+        REQUIRE(BinarySerializer::Deserialize(std::span<const uint8_t>(buffer, size), result) == size);
+        REQUIRE(result.price == value);
+    }
+
+    level = { std::numeric_limits<int64_t>::min(), 0 };
+    REQUIRE(BinarySerializer::Size(level) == 14);
+
+    // Varint longer than 64 bits
+    const uint8_t overflow[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00 };
+    REQUIRE(BinarySerializer::Deserialize(std::span<const uint8_t>(overflow), level) == 0);
+}
+
+TEST_CASE("Binary serializer writer", "[CppCommon][Common]")
+{
+    Order order = MakeOrder();
+    std::vector<uint8_t> expected(BinarySerializer::Size(order));
+    BinarySerializer::Serialize(order, expected);
+
+    StringWriter writer;
+    REQUIRE(BinarySerializer::Serialize(order, writer) == expected.size());
+    REQUIRE(writer.writes == 1);
+    REQUIRE(std::memcmp(writer.content.data(), expected.data(), expected.size()) == 0);
+
+    // Big strings are written directly
+    order.comment = std::string(10000, 'x');
+    writer.content.clear();
+    writer.writes = 0;
+    REQUIRE(BinarySerializer::Serialize(order, writer) == BinarySerializer::Size(order));
+    REQUIRE(writer.writes == 3);
+
+    Order result;
+    REQUIRE(BinarySerializer::Deserialize(std::span<const uint8_t>((const uint8_t*)writer.content.data(), writer.content.size()), result) == writer.content.size());
+    RequireOrder(result, order);
+}
+
+TEST_CASE("Binary serializer ring buffer", "[CppCommon][Common]")
+{
+    SPSCRingBuffer buffer(1024);
+
+    Order order = MakeOrder();
+    size_t count = 0;
+    while (BinarySerializer::Enqueue(buffer, order))
+        ++count;
+    REQUIRE(count > 0);
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        auto data = buffer.Peek();
+        REQUIRE(!data.empty());
+
+        Order result;
+        size_t consumed = BinarySerializer::Deserialize(data, result);
+        REQUIRE(consumed == BinarySerializer::Size(order));
+        RequireOrder(result, order);
+        buffer.Release(consumed);
+    }
+}
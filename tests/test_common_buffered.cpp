@@ -0,0 +1,190 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "test.h"
+#include "test_streams.h"
+
+#include "common/buffered_reader.h"
+#include "common/buffered_writer.h"
+#include "filesystem/file.h"
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <vector>
+
+using namespace CppCommon;
+
+namespace {
+
+std::string Content(size_t size)
+{
+    std::string result;
+    for (size_t i = 0; i < size; ++i)
+        result += (char)('a' + (i * 7) % 26);
+    return result;
+}
+
+} // namespace
+
+TEST_CASE("Buffered reader", "[CppCommon][Common]")
+{
+    const std::string content = Content(1000);
+
+    ChunkReader chunks(content, 7);
+    BufferedReader reader(chunks, 16);
+    REQUIRE(reader.capacity() == 16);
+
+    // Peek does not consume bytes
+    auto bytes = reader.Peek(4);
+    REQUIRE(bytes.size() >= 4);
+    REQUIRE(std::memcmp(bytes.data(), content.data(), 4) == 0);
+    bytes = reader.Peek(4);
+    REQUIRE(std::memcmp(bytes.data(), content.data(), 4) == 0);
+    reader.Consume(3);
+
+    // Peek bigger than the buffer grows it
+    bytes = reader.Peek(100);
+    REQUIRE(bytes.size() >= 100);
+    REQUIRE(reader.capacity() >= 100);
+    REQUIRE(std::memcmp(bytes.data(), content.data() + 3, 100) == 0);
+    reader.Consume(100);
+
+    // Read buffered and direct bytes
+    std::string buffer(500, 0);
+    REQUIRE(reader.Read(buffer.data(), buffer.size()) == 500);
+    REQUIRE(buffer == content.substr(103, 500));
+
+    // Read the rest
+    REQUIRE(std::string(reader.ReadAllText()) == content.substr(603));
+    REQUIRE(reader.Peek().empty());
+    REQUIRE(reader.Read(buffer.data(), buffer.size()) == 0);
+}
+
+TEST_CASE("Buffered reader records", "[CppCommon][Common]")
+{
+    // Length prefixed records are parsed in place
+    std::string content;
+    for (uint8_t i = 0; i < 100; ++i)
+    {
+        content += (char)i;
+        content += std::string(i, (char)i);
+    }
+
+    ChunkReader chunks(content, 13);
+    BufferedReader reader(chunks, 32);
+
+    size_t records = 0;
+    for (;;)
+    {
+        auto header = reader.Peek(1);
+        if (header.empty())
+            break;
+        // Peeked bytes are invalidated by the next peek
+        uint8_t length = header[0];
+        size_t size = 1 + length;
+        auto record = reader.Peek(size);
+        REQUIRE(record.size() >= size);
+        REQUIRE(std::count(record.begin() + 1, record.begin() + size, length) == length);
+        reader.Consume(size);
+        ++records;
+    }
+    REQUIRE(records == 100);
+}
+
+TEST_CASE("Buffered writer", "[CppCommon][Common]")
+{
+    const std::string content = Content(1000);
+
+    StringWriter output;
+    {
+        BufferedWriter writer(output, 64);
+
+        // Small writes are buffered
+        REQUIRE(writer.Write(content.data(), 10) == 10);
+        REQUIRE(writer.Write(content.data() + 10, 10) == 10);
+        REQUIRE(writer.buffered() == 20);
+        REQUIRE(output.writes == 0);
+
+        // Prepared span is committed in place
+        auto buffer = writer.Prepare(30);
+        REQUIRE(buffer.size() >= 30);
+        std::memcpy(buffer.data(), content.data() + 20, 30);
+        writer.Commit(30);
+        REQUIRE(writer.buffered() == 50);
+
+        // Big write flushes the buffer and bypasses it
+        REQUIRE(writer.Write(content.data() + 50, 200) == 200);
+        REQUIRE(writer.buffered() == 0);
+        REQUIRE(output.content == content.substr(0, 250));
+
+        // Small vectored writes are buffered
+        REQUIRE(writer.WriteV({ { content.data() + 250, 5 }, { nullptr, 0 }, { content.data() + 255, 5 } }) == 10);
+        REQUIRE(writer.buffered() == 10);
+        REQUIRE(output.vectored == 0);
+
+        // Big vectored write is forwarded to the underlying writer
+        REQUIRE(writer.WriteV({ { content.data() + 260, 100 }, { content.data() + 360, 100 } }) == 200);
+        REQUIRE(output.vectored == 1);
+        REQUIRE(output.content == content.substr(0, 460));
+
+        // Prepare bigger than the buffer grows it
+        buffer = writer.Prepare(500);
+        REQUIRE(buffer.size() >= 500);
+        std::memcpy(buffer.data(), content.data() + 460, 500);
+        writer.Commit(500);
+
+        writer.Flush();
+        REQUIRE(output.flushes == 1);
+        REQUIRE(output.content == content.substr(0, 960));
+
+        // Rest of bytes are written on destruction
+        writer.Write(content.data() + 960, 40);
+    }
+    REQUIRE(output.content == content);
+}
+
+TEST_CASE("Buffered writer of the full writer", "[CppCommon][Common]")
+{
+    const std::string content = Content(100);
+
+    StringWriter output;
+    output.limit = 15;
+
+    // Not written bytes stay in the buffer and only its free space is accepted
+    BufferedWriter writer(output, 16);
+    REQUIRE(writer.Write(content.data(), 10) == 10);
+    REQUIRE(writer.Write(content.data() + 10, 10) == 10);
+    REQUIRE(writer.Write(content.data() + 20, 20) == 11);
+    REQUIRE(output.content == content.substr(0, 15));
+    REQUIRE(writer.buffered() == 16);
+
+    output.limit = SIZE_MAX;
+    writer.Flush();
+    REQUIRE(output.content == content.substr(0, 31));
+}
+
+TEST_CASE("Read all bytes presized by the file size", "[CppCommon][Common]")
+{
+    const std::string content = Content(100000);
+    File::WriteAllText("test.tmp", content);
+
+    File file("test.tmp");
+    file.Open(true, false);
+    REQUIRE(file.remaining() == content.size());
+    char buffer[10];
+    REQUIRE(file.Read(buffer, sizeof(buffer)) == sizeof(buffer));
+    REQUIRE(file.remaining() == (content.size() - sizeof(buffer)));
+    REQUIRE(file.ReadAllText() == content.substr(sizeof(buffer)));
+    REQUIRE(file.remaining() == 0);
+    file.Close();
+
+    REQUIRE(File::ReadAllBytes("test.tmp").size() == content.size());
+
+    // Short reads do not stop reading all bytes
+    ChunkReader chunks(content, 1000);
+    REQUIRE(chunks.ReadAllText() == content);
+
+    File::Remove("test.tmp");
+}
@@ -0,0 +1,220 @@
+//
+// Created by Ivan Shynkarenka on 15.10.2026
+//
+
+#include "test.h"
+#include "test_streams.h"
+
+#include "common/compressing_writer.h"
+#include "common/decompressing_reader.h"
+#include "filesystem/file.h"
+#include "threads/thread_pool.h"
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+using namespace CppCommon;
+
+namespace {
+
+std::string Content(size_t size)
+{
+    std::string result;
+    uint32_t seed = 1;
+    while (result.size() < size)
+    {
+        seed = seed * 1103515245 + 12345;
+        result += "Record " + std::to_string(seed % 1000) + " of the compressed stream\n";
+        // Mix incompressible bytes to get stored blocks
+        if ((seed % 7) == 0)
+            for (size_t i = 0; i < 100; ++i)
+                result += (char)((seed = seed * 1103515245 + 12345) >> 16);
+    }
+    result.resize(size);
+    return result;
+}
+
+std::string Decompress(const std::string& compressed, size_t chunk = 4096)
+{
+    ChunkReader input(compressed, chunk);
+    DecompressingReader reader(input);
+    std::string result;
+    char buffer[3000];
+    size_t size;
+    while ((size = reader.Read(buffer, sizeof(buffer))) > 0)
+        result.append(buffer, size);
+    REQUIRE(reader.total() == result.size());
+    return result;
+}
+
+} // namespace
+
+TEST_CASE("Compressing writer", "[CppCommon][Common]")
+{
+    const std::string content = Content(1000000);
+
+    StringWriter output(1000);
+    {
+        CompressingWriter writer(output, 100000);
+        REQUIRE(writer.block() == 262144);
+
+        // Write by chunks of different sizes
+        size_t offset = 0;
+        for (size_t chunk = 1; offset < content.size(); chunk = chunk * 3 + 1)
+        {
+            size_t size = std::min(chunk, content.size() - offset);
+            REQUIRE(writer.Write(content.data() + offset, size) == size);
+            offset += size;
+        }
+        REQUIRE(writer.total() == content.size());
+
+        // Frame is finished on destruction
+    }
+    REQUIRE(output.content.size() < content.size());
+    REQUIRE(Decompress(output.content) == content);
+    REQUIRE(Decompress(output.content, 1) == content);
+
+    // Block sizes are rounded up to LZ4 frame block sizes
+    REQUIRE(CompressingWriter(output, 0).block() == 65536);
+    REQUIRE(CompressingWriter(output, 65537).block() == 262144);
+    REQUIRE(CompressingWriter(output, 1000000).block() == 1048576);
+    REQUIRE(CompressingWriter(output, 100000000).block() == 4194304);
+}
+
+TEST_CASE("Compressing writer with the thread pool", "[CppCommon][Common]")
+{
+    const std::string content = Content(3000000);
+
+    ThreadPool pool(4);
+
+    StringWriter sequential(1000);
+    StringWriter parallel(1000);
+    {
+        CompressingWriter writer1(sequential, 65536);
+        CompressingWriter writer2(parallel, 65536, &pool);
+        for (size_t offset = 0; offset < content.size(); offset += 10000)
+        {
+            writer1.Write(content.data() + offset, std::min<size_t>(10000, content.size() - offset));
+            writer2.Write(content.data() + offset, std::min<size_t>(10000, content.size() - offset));
+        }
+        writer1.Finish();
+        writer2.Finish();
+        REQUIRE(writer2.compressed() == parallel.content.size());
+    }
+
+    // Parallel compression gives the same frame
+    REQUIRE(parallel.content == sequential.content);
+    REQUIRE(Decompress(parallel.content) == content);
+}
+
+TEST_CASE("Compressing writer flush and frames", "[CppCommon][Common]")
+{
+    StringWriter output(1000);
+    CompressingWriter writer(output);
+
+    // Flushed blocks could be read before the frame is finished
+    writer.Write("Hello, ");
+    writer.Flush();
+    REQUIRE(output.flushes == 1);
+    REQUIRE(Decompress(output.content) == "Hello, ");
+    writer.Write("world!");
+    writer.Flush();
+    REQUIRE(Decompress(output.content) == "Hello, world!");
+
+    // Finished frames are concatenated
+    writer.Finish();
+    writer.Write(std::string(100000, 'x'));
+    writer.Finish();
+    REQUIRE(Decompress(output.content) == "Hello, world!" + std::string(100000, 'x'));
+
+    // Empty frame
+    StringWriter empty(1000);
+    CompressingWriter(empty).Finish();
+    REQUIRE(empty.content.size() == 15);
+    REQUIRE(Decompress(empty.content).empty());
+}
+
+TEST_CASE("Decompressing reader of linked blocks", "[CppCommon][Common]")
+{
+    const std::string content = Content(65536);
+
+    // Frame with linked blocks and the skippable frame before it
+    std::string frame = { 0x50, 0x2A, 0x4D, 0x18, 0x03, 0x00, 0x00, 0x00, 'a', 'b', 'c' };
+    frame += { 0x04, 0x22, 0x4D, 0x18, 0x40, 0x40 };
+    frame += (char)(XXH32::Calculate(frame.data() + 15, 2) >> 8);
+    // Stored block
+    frame += { 0x00, 0x00, 0x01, (char)0x80 };
+    frame += content;
+    // Compressed block with the match of 100 bytes in the previous block and the literal
+    frame += { 0x06, 0x00, 0x00, 0x00, 0x0F, (char)0xE8, 0x03, 81, 0x10, 'z' };
+    frame += { 0x00, 0x00, 0x00, 0x00 };
+
+    REQUIRE(Decompress(frame) == content + content.substr(65536 - 1000, 100) + "z");
+}
+
+TEST_CASE("Decompressing reader of malformed frames", "[CppCommon][Common]")
+{
+    const std::string content = Content(100000);
+
+    StringWriter output(1000);
+    {
+        CompressingWriter writer(output, 65536);
+        writer.Write(content.data(), content.size());
+    }
+    const std::string& frame = output.content;
+
+    // Truncated frame at the block boundary is read up to the last block
+    REQUIRE(Decompress(frame.substr(0, frame.size() - 8)) == content);
+
+    // Invalid magic number, header checksum and content checksum
+    std::string corrupted = frame;
+    corrupted[0] ^= 1;
+    REQUIRE_THROWS_AS(Decompress(corrupted), std::invalid_argument);
+    corrupted = frame;
+    corrupted[6] ^= 1;
+    REQUIRE_THROWS_AS(Decompress(corrupted), std::invalid_argument);
+    corrupted = frame;
+    corrupted[frame.size() - 1] ^= 1;
+    REQUIRE_THROWS_AS(Decompress(corrupted), std::invalid_argument);
+
+    // Truncated blocks
+    REQUIRE_THROWS_AS(Decompress(frame.substr(0, 9)), std::invalid_argument);
+    REQUIRE_THROWS_AS(Decompress(frame.substr(0, 100)), std::invalid_argument);
+
+    // Corrupted bytes are detected
+    for (size_t i = 7; i < frame.size(); i += 997)
+    {
+        corrupted = frame;
+        corrupted[i] ^= 0x5A;
+        REQUIRE_THROWS_AS(Decompress(corrupted), std::invalid_argument);
+    }
+}
+
+TEST_CASE("Compressed file", "[CppCommon][Common]")
+{
+    const std::string content = Content(500000);
+
+    ThreadPool pool(2);
+
+    File file("test.lz4.tmp");
+    file.Create(false, true);
+    {
+        CompressingWriter writer(file, 65536, &pool);
+        writer.Write(content.data(), content.size());
+    }
+    file.Close();
+
+    file.Open(true, false);
+    DecompressingReader reader(file);
+    std::string result;
+    char buffer[65536];
+    size_t size;
+    while ((size = reader.Read(buffer, sizeof(buffer))) > 0)
+        result.append(buffer, size);
+    file.Close();
+    REQUIRE(result == content);
+
+    File::Remove(file);
+}
@@ -5,6 +5,11 @@
 #include "test.h"
 
 #include "common/function.h"
+#include "memory/allocator.h"
+
+#include <array>
+#include <memory>
+#include <string>
 
 using namespace CppCommon;
 
@@ -52,3 +57,94 @@ TEST_CASE("Function", "[CppCommon][Common]")
     function = lambda;
     REQUIRE(function(55) == 555);
 }
+
+TEST_CASE("Function move", "[CppCommon][Common]")
+{
+    // Closure with not trivially relocatable capture
+    std::string text = "short";
+    CppCommon::Function<size_t (), 128> function1 = [text]() { return text.size(); };
+    CppCommon::Function<size_t (), 128> function2 = std::move(function1);
+    REQUIRE(!function1);
+    REQUIRE(function2() == 5);
+
+    CppCommon::Function<size_t (), 128> function3 = [](){ return (size_t)1; };
+    swap(function2, function3);
+    REQUIRE(function2() == 1);
+    REQUIRE(function3() == 5);
+
+    function1 = function3;
+    REQUIRE(function1() == 5);
+    REQUIRE(function3() == 5);
+}
+
+TEST_CASE("UniqueFunction", "[CppCommon][Common]")
+{
+    // Move-only capture
+    auto value = std::make_unique<int>(123);
+    CppCommon::UniqueFunction<int (int), 128> function1 = [value = std::move(value)](int v) { return *value + v; };
+    REQUIRE(function1);
+    REQUIRE(!function1.IsSpilled());
+    REQUIRE(function1(1) == 124);
+
+    CppCommon::UniqueFunction<int (int), 128> function2 = std::move(function1);
+    REQUIRE(!function1);
+    REQUIRE(function2(2) == 125);
+
+    function1 = test;
+    swap(function1, function2);
+    REQUIRE(function1(3) == 126);
+    REQUIRE(function2(11) == 111);
+
+    function1 = nullptr;
+    REQUIRE(!function1);
+    REQUIRE_THROWS_AS(function1(0), std::bad_function_call);
+
+    // Oversized closure spilled into the memory manager
+    DefaultMemoryManager manager;
+    {
+        std::array<int, 64> data;
+        data.fill(1);
+        CppCommon::UniqueFunction<int (int), 128> spilled([data, value = std::make_unique<int>(7)](int v) { return (int)data.size() + *value + v; }, manager);
+        REQUIRE(spilled.IsSpilled());
+        REQUIRE(manager.allocations() == 1);
+        REQUIRE(spilled(1) == 72);
+
+        CppCommon::UniqueFunction<int (int), 128> moved = std::move(spilled);
+        REQUIRE(!spilled);
+        REQUIRE(moved.IsSpilled());
+        REQUIRE(moved(2) == 73);
+        REQUIRE(manager.allocations() == 1);
+
+        // Small closure is kept in the internal buffer
+        CppCommon::UniqueFunction<int (int), 128> small([](int v) { return v; }, manager);
+        REQUIRE(!small.IsSpilled());
+        REQUIRE(manager.allocations() == 1);
+    }
+    REQUIRE(manager.allocations() == 0);
+}
+
+TEST_CASE("FunctionRef", "[CppCommon][Common]")
+{
+    auto call = [](CppCommon::FunctionRef<int (int)> function, int v) { return function(v); };
+
+    // Function reference
+    REQUIRE(call(test, 11) == 111);
+    REQUIRE(call(Class::static_test, 44) == 444);
+
+    // Functor reference
+    Class instance;
+    REQUIRE(call(instance, 22) == 222);
+
+    // Lambda reference with captured state
+    int counter = 0;
+    auto lambda = [&counter](int v) { ++counter; return v + 500; };
+    REQUIRE(call(lambda, 55) == 555);
+    REQUIRE(call([&counter](int v) { ++counter; return v + 600; }, 66) == 666);
+    REQUIRE(counter == 2);
+
+    CppCommon::FunctionRef<int (int)> function1 = test;
+    CppCommon::FunctionRef<int (int)> function2 = lambda;
+    swap(function1, function2);
+    REQUIRE(function1(77) == 577);
+    REQUIRE(function2(88) == 188);
+}
@@ -0,0 +1,101 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "test.h"
+#include "test_streams.h"
+
+#include "common/line_reader.h"
+#include "filesystem/file.h"
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <vector>
+
+using namespace CppCommon;
+
+namespace {
+
+std::vector<std::string> ReadLines(LineReader& reader)
+{
+    std::vector<std::string> result;
+    for (auto line : reader)
+        result.emplace_back(line);
+    return result;
+}
+
+} // namespace
+
+TEST_CASE("Line reader", "[CppCommon][Common]")
+{
+    const std::string content = "first\r\n\nthird line\nlast";
+    const std::vector<std::string> expected = { "first", "", "third line", "last" };
+
+    // Memory buffer
+    LineReader memory(content);
+    REQUIRE(ReadLines(memory) == expected);
+    REQUIRE(memory.lines() == 4);
+
+    // Reader with all chunk sizes and minimal read buffer
+    for (size_t chunk = 1; chunk <= content.size(); ++chunk)
+    {
+        ChunkReader source(content, chunk);
+        LineReader reader(source, 1);
+        REQUIRE(ReadLines(reader) == expected);
+    }
+
+    // Empty content and terminated last line
+    LineReader empty("");
+    std::string_view line;
+    REQUIRE(!empty.ReadLine(line));
+    LineReader terminated("one\ntwo\n");
+    REQUIRE(ReadLines(terminated) == std::vector<std::string>({ "one", "two" }));
+}
+
+TEST_CASE("Line reader long lines", "[CppCommon][Common]")
+{
+    // Lines longer than the read buffer and the SIMD block
+    std::string content;
+    std::vector<std::string> expected;
+    for (size_t i = 0; i < 300; ++i)
+    {
+        expected.emplace_back(i * 7, (char)('a' + (i % 26)));
+        content += expected.back() + "\n";
+    }
+
+    ChunkReader source(content, 1000);
+    LineReader reader(source, 16);
+    REQUIRE(ReadLines(reader) == expected);
+
+    for (size_t i = 0; i < 200; ++i)
+    {
+        std::string data(i, 'x');
+        REQUIRE(LineReader::FindNewline(data.data(), data.data() + data.size()) == data.data() + data.size());
+        data += '\n';
+        data += std::string(100, '\n');
+        REQUIRE(LineReader::FindNewline(data.data(), data.data() + data.size()) == data.data() + i);
+    }
+}
+
+TEST_CASE("Line reader records", "[CppCommon][Common]")
+{
+    File::WriteAllText("test.tmp", "id,name,value\n1,foo,10\n2,,20\n");
+
+    File file("test.tmp");
+    file.Open(true, false);
+    LineReader reader(file);
+
+    std::vector<std::string_view> fields;
+    REQUIRE(reader.ReadRecord(fields, ','));
+    REQUIRE(fields == std::vector<std::string_view>({ "id", "name", "value" }));
+    REQUIRE(reader.ReadRecord(fields, ','));
+    REQUIRE(fields == std::vector<std::string_view>({ "1", "foo", "10" }));
+    REQUIRE(reader.ReadRecord(fields, ",", true));
+    REQUIRE(fields == std::vector<std::string_view>({ "2", "20" }));
+    REQUIRE(!reader.ReadRecord(fields, ','));
+    REQUIRE(fields.empty());
+
+    file.Close();
+    File::Remove(file);
+}
@@ -1075,3 +1075,101 @@ TEST_CASE("uint256: Type cast", "[CppCommon][Common]")
     REQUIRE(static_cast<uint32_t>(val) == (uint32_t)0xAAAAAAAAull);
     REQUIRE(static_cast<uint64_t>(val) == (uint64_t)0xAAAAAAAAAAAAAAAAull);
 }
+
+TEST_CASE("uint128: Constant expressions", "[CppCommon][Common]")
+{
+    constexpr uint128_t val(0xFEDBCA9876543210ull);
+
+    static_assert(val * val == uint128_t(0xFDB8E2BACBFE7CEFull, 0x010E6CD7A44A4100ull));
+    static_assert((val * val) / val == val);
+    static_assert((val * val + 5) % val == 5);
+    static_assert((val << 70) == uint128_t(0xB6F2A61D950C8400ull, 0));
+    static_assert(((val << 64) >> 64) == val);
+    static_assert((val << 128) == 0);
+    static_assert(uint128_t(1, 0).bits() == 65);
+    static_assert(uint128_t::divmod(uint128_t(1, 0), 3).second == 1);
+    REQUIRE(true);
+}
+
+TEST_CASE("uint128: Divide and multiply identities", "[CppCommon][Common]")
+{
+    uint64_t seed = 0x9E3779B97F4A7C15ull;
+    auto next = [&seed]() { seed ^= seed << 13; seed ^= seed >> 7; seed ^= seed << 17; return seed; };
+
+    for (size_t i = 0; i < 10000; ++i)
+    {
+        // Mix values of different widths to cover all division paths
+        uint128_t x(next() >> (next() % 64), next());
+        uint128_t y((i % 3 == 0) ? next() >> (next() % 64) : 0, next() >> (next() % 64));
+        if (y == 0)
+            y = 1;
+
+        auto qr = uint128_t::divmod(x, y);
+        REQUIRE(qr.second < y);
+        REQUIRE(qr.first * y + qr.second == x);
+
+        // 128-bit product is the lower part of the 256-bit product
+        uint256_t product = uint256_t(x) * uint256_t(y);
+        REQUIRE(x * y == product.lower());
+
+        // Shifts
+        size_t shift = next() % 128;
+        REQUIRE((x << shift) == (uint256_t(x) << shift).lower());
+        REQUIRE((x >> shift) == (uint256_t(x) >> shift).lower());
+    }
+}
+
+TEST_CASE("uint256: Divide and multiply identities", "[CppCommon][Common]")
+{
+    uint64_t seed = 0x9E3779B97F4A7C15ull;
+    auto next = [&seed]() { seed ^= seed << 13; seed ^= seed >> 7; seed ^= seed << 17; return seed; };
+    auto random = [&next](size_t limbs)
+    {
+        uint64_t parts[4] = { 0, 0, 0, 0 };
+        for (size_t i = 0; i < limbs; ++i)
+            parts[i] = next() >> (next() % 64);
+        return uint256_t(parts[3], parts[2], parts[1], parts[0]);
+    };
+
+    for (size_t i = 0; i < 10000; ++i)
+    {
+        // Mix values of different widths to cover all division paths
+        uint256_t x = random(1 + (i % 4));
+        uint256_t y = random(1 + (next() % 4));
+        if (y == 0)
+            y = 1;
+
+        auto qr = uint256_t::divmod(x, y);
+        REQUIRE(qr.second < y);
+        REQUIRE(qr.first * y + qr.second == x);
+        REQUIRE(x / y == qr.first);
+        REQUIRE(x % y == qr.second);
+
+        // Multiplication is distributive over the limbs
+        REQUIRE(x * y == (x.upper() * y) * (uint256_t(1) << 128) + x.lower() * y);
+    }
+
+    // Quotient estimation corner cases of the normalized division
+    const uint256_t max(0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull);
+    const uint256_t half(0x8000000000000000ull, 0, 0, 1);
+    REQUIRE(max / half == 1);
+    REQUIRE(max % half == uint256_t(0x7FFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFEull));
+    REQUIRE(max / uint256_t(0, 1, 0, 0) == uint256_t(0, 0, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull));
+    REQUIRE(uint256_t::divmod(max, uint256_t(0, 0, 0x8000000000000000ull, 0xFFFFFFFFFFFFFFFFull)) == std::make_pair(uint256_t(0x0000000000000000ull, 0x0000000000000001ull, 0xFFFFFFFFFFFFFFFCull, 0x000000000000000Bull), uint256_t(0x0000000000000000ull, 0x0000000000000000ull, 0x7FFFFFFFFFFFFFF1ull, 0x000000000000000Aull)));
+}
+
+TEST_CASE("uint256: String of large values", "[CppCommon][Common]")
+{
+    REQUIRE(uint256_t(0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull).string() == "115792089237316195423570985008687907853269984665640564039457584007913129639935");
+    REQUIRE(uint256_t(0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull).string(16) == "ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff");
+    REQUIRE(uint256_t(0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull).string(8) == "17777777777777777777777777777777777777777777777777777777777777777777777777777777777777");
+    REQUIRE(uint256_t(0xDD15FE86AFFAD912ull, 0x49EF0EB713F39EBEull, 0xAA987B6E6FD2A000ull, 0x0000000000000000ull).string() == "100000000000000000000000000000000000000000000000000000000000000000000000000000");
+    REQUIRE(uint256_t(0xDD15FE86AFFAD912ull, 0x49EF0EB713F39EBEull, 0xAA987B6E6FD2A000ull, 0x0000000000000000ull).string(16) == "dd15fe86affad91249ef0eb713f39ebeaa987b6e6fd2a0000000000000000000");
+    REQUIRE(uint256_t(0xDD15FE86AFFAD912ull, 0x49EF0EB713F39EBEull, 0xAA987B6E6FD2A000ull, 0x0000000000000000ull).string(8) == "15642577503257765544222236741655611763475372524607555633751240000000000000000000000000");
+    REQUIRE(uint256_t(0x0000000000000100ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000003039ull).string() == "1606938044258990275541962092341162602522202993782792835313721");
+    REQUIRE(uint256_t(0x0000000000000100ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000003039ull).string(16) == "100000000000000000000000000000000000000000000003039");
+    REQUIRE(uint256_t(0x0000000000000100ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000003039ull).string(8) == "4000000000000000000000000000000000000000000000000000000000000030071");
+    REQUIRE(uint256_t(10000000000000000000ull).string() == "10000000000000000000");
+    REQUIRE(uint256_t(0).string(2, 3) == "000");
+    REQUIRE(uint256_t(1, 0).wstring() == L"340282366920938463463374607431768211456");
+}
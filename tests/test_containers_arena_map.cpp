@@ -0,0 +1,79 @@
+//
+// Created by Ivan Shynkarenka on 15.10.2026
+//
+
+#include "test.h"
+
+#include "containers/arena_map.h"
+
+#include <string>
+
+using namespace CppCommon;
+
+TEST_CASE("Arena hash map", "[CppCommon][Containers]")
+{
+    DefaultMemoryManager auxiliary;
+    ArenaMemoryManager<DefaultMemoryManager> arena(auxiliary, 1024);
+
+    // Process several requests with scratch hash maps
+    for (int request = 0; request < 10; ++request)
+    {
+        {
+            auto hashmap = MakeArenaHashMap<int, int>(arena, 16, -1);
+            for (int i = 0; i < 1000; ++i)
+                hashmap[i] = i * request;
+            REQUIRE(hashmap.size() == 1000);
+            REQUIRE(hashmap.at(999) == 999 * request);
+            REQUIRE(arena.allocations() > 0);
+
+            auto grouped = MakeArenaHashMap<int, int, FastHash<int>, std::equal_to<int>, DefaultMemoryManager, HashMapGroupProbing>(arena, 16, -1);
+            for (int i = 0; i < 1000; ++i)
+                grouped.emplace(i, i);
+            REQUIRE(grouped.size() == 1000);
+        }
+
+        // Hash maps return all memory blocks to the arena
+        REQUIRE(arena.allocated() == 0);
+        REQUIRE(arena.allocations() == 0);
+
+        // Drop the whole request memory at once
+        arena.reset();
+    }
+
+    // Warmed up arena is reset without auxiliary allocations
+    size_t allocations = auxiliary.allocations();
+    {
+        auto hashmap = MakeArenaHashMap<int, int>(arena, 16, -1);
+        for (int i = 0; i < 1000; ++i)
+            hashmap[i] = i;
+    }
+    arena.reset();
+    REQUIRE(auxiliary.allocations() == allocations);
+    REQUIRE(arena.size() == 0);
+}
+
+TEST_CASE("Arena flat map", "[CppCommon][Containers]")
+{
+    DefaultMemoryManager auxiliary;
+    ArenaMemoryManager<DefaultMemoryManager> arena(auxiliary);
+
+    for (int request = 0; request < 10; ++request)
+    {
+        ArenaScope<DefaultMemoryManager> scope(arena);
+
+        auto flatmap = MakeArenaFlatMap<int, double>(arena, 16);
+        for (int i = 100; i > 0; --i)
+            flatmap.emplace(i, i * 0.5);
+        REQUIRE(flatmap.size() == 100);
+        REQUIRE(flatmap.begin()->first == 1);
+        REQUIRE(flatmap.at(50) == 25.0);
+
+        // Not trivially destructible items are still destroyed
+        auto names = MakeArenaFlatMap<int, std::string>(arena);
+        names.emplace(1, std::string(100, 'x'));
+        REQUIRE(names.at(1).size() == 100);
+    }
+
+    REQUIRE(arena.allocated() == 0);
+    REQUIRE(arena.allocations() == 0);
+}
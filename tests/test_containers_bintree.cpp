@@ -10,6 +10,11 @@
 #include "containers/bintree_rb.h"
 #include "containers/bintree_splay.h"
 
+#include <algorithm>
+#include <iterator>
+#include <random>
+#include <vector>
+
 using namespace CppCommon;
 
 namespace {
@@ -30,6 +35,124 @@ struct MyBinTreeNode
     { return node1.value < node2.value; }
 };
 
+struct MyRankBinTreeNode
+{
+    int value;
+
+    MyRankBinTreeNode* parent;
+    MyRankBinTreeNode* left;
+    MyRankBinTreeNode* right;
+    signed char balance;
+    bool rb;
+    size_t subtree;
+
+    MyRankBinTreeNode(int v) : value(v) {}
+    friend bool operator<(const MyRankBinTreeNode& node1, const MyRankBinTreeNode& node2)
+    { return node1.value < node2.value; }
+};
+
+template <class TBinTree>
+void test_rank()
+{
+    TBinTree bintree;
+    REQUIRE(bintree.rank(0) == 0);
+    REQUIRE(bintree.select(0) == bintree.end());
+
+    const int count = 1000;
+    std::vector<MyRankBinTreeNode> items;
+    for (int i = 0; i < count; ++i)
+        items.emplace_back(i * 2);
+    std::shuffle(items.begin(), items.end(), std::default_random_engine());
+
+    for (auto& item : items)
+        REQUIRE(bintree.insert(item).second);
+
+    for (int i = 0; i < count; ++i)
+    {
+        REQUIRE(bintree.rank(i * 2) == (size_t)i);
+        REQUIRE(bintree.rank(i * 2 + 1) == (size_t)(i + 1));
+        REQUIRE(bintree.select(i)->value == i * 2);
+    }
+    REQUIRE(bintree.select(count) == bintree.end());
+
+    // Erase a half of items and check order statistics again
+    for (auto& item : items)
+        if ((item.value % 4) == 0)
+            REQUIRE(bintree.erase(item) != nullptr);
+    REQUIRE(bintree.size() == count / 2);
+    REQUIRE(bintree.root()->subtree == count / 2);
+
+    for (int i = 0; i < count / 2; ++i)
+    {
+        REQUIRE(bintree.rank(i * 4 + 2) == (size_t)i);
+        REQUIRE(bintree.select(i)->value == i * 4 + 2);
+    }
+
+    for (auto& item : items)
+        if ((item.value % 4) != 0)
+            REQUIRE(bintree.erase(item) != nullptr);
+    REQUIRE(bintree.empty());
+}
+
+template <class TBinTree>
+void test_build()
+{
+    const int count = 1000;
+    std::vector<MyRankBinTreeNode> items;
+    for (int i = 0; i < count; ++i)
+        items.emplace_back(i * 2);
+
+    TBinTree bintree;
+    bintree.build_sorted(items.begin(), items.end());
+    REQUIRE(bintree.size() == count);
+    REQUIRE(bintree.root()->parent == nullptr);
+    REQUIRE(bintree.root()->subtree == count);
+    for (int i = 0; i < count; ++i)
+        REQUIRE(bintree.select(i)->value == i * 2);
+
+    // Split the binary tree in the middle of the sort order
+    TBinTree right;
+    bintree.split(count, right);
+    REQUIRE(bintree.size() == count / 2);
+    REQUIRE(right.size() == count / 2);
+    REQUIRE(bintree.highest()->value == count - 2);
+    REQUIRE(right.lowest()->value == count);
+    for (int i = 0; i < count / 2; ++i)
+    {
+        REQUIRE(bintree.rank(i * 2) == (size_t)i);
+        REQUIRE(right.rank(count + i * 2) == (size_t)i);
+    }
+
+    // Join with partial duplicates
+    std::vector<MyRankBinTreeNode> duplicates;
+    for (int i = 0; i < count / 2; ++i)
+        duplicates.emplace_back(((i % 2) != 0) ? (i * 2) : (i * 2 + 1));
+    TBinTree other;
+    other.build_sorted(duplicates.begin(), duplicates.end());
+    bintree.join(other);
+    REQUIRE(bintree.size() == count / 2 + count / 4);
+    REQUIRE(other.size() == count / 4);
+    for (auto& item : other)
+        REQUIRE((item.value % 4) == 2);
+    bintree.join(right);
+    REQUIRE(bintree.size() == count + count / 4);
+    REQUIRE(right.empty());
+
+    // Rebuilt binary tree must stay valid for further updates
+    for (auto& item : items)
+        REQUIRE(bintree.erase(item) != nullptr);
+    REQUIRE(bintree.size() == count / 4);
+    for (auto& item : items)
+        REQUIRE(bintree.insert(item).second);
+    REQUIRE(bintree.size() == count + count / 4);
+    int previous = -1;
+    for (auto& item : bintree)
+    {
+        REQUIRE(previous < item.value);
+        previous = item.value;
+    }
+}
+
 template <class TBinTree>
 void test()
 {
@@ -203,6 +326,54 @@ void test()
     REQUIRE(bintree.empty());
 }
 
+template <class TBinTree>
+void test_prefetch()
+{
+    const int count = 1000;
+
+    std::vector<MyBinTreeNode> nodes;
+    nodes.reserve(count);
+    for (int i = 0; i < count; ++i)
+        nodes.emplace_back(i * 2);
+    std::shuffle(nodes.begin(), nodes.end(), std::default_random_engine());
+
+    TBinTree bintree;
+    for (auto& node : nodes)
+        bintree.insert(node);
+
+    // Traverse all items in order with prefetch
+    int expected = 0;
+    bintree.for_each_prefetch([&expected](MyBinTreeNode& item) { REQUIRE(item.value == expected); expected += 2; });
+    REQUIRE(expected == (count * 2));
+    expected = 0;
+    const TBinTree& constant = bintree;
+    constant.for_each_prefetch([&expected](const MyBinTreeNode& item) { REQUIRE(item.value == expected); expected += 2; });
+    REQUIRE(expected == (count * 2));
+
+    // Find present and missing items in batches
+    std::vector<MyBinTreeNode> keys;
+    for (int i = 0; i < (count * 2); ++i)
+        keys.emplace_back(i);
+    std::vector<MyBinTreeNode*> found;
+    bintree.find_batch(keys.begin(), keys.end(), std::back_inserter(found));
+    REQUIRE(found.size() == keys.size());
+    for (size_t i = 0; i < keys.size(); ++i)
+    {
+        if ((i % 2) == 0)
+            REQUIRE(((found[i] != nullptr) && (found[i]->value == (int)i)));
+        else
+            REQUIRE(found[i] == nullptr);
+    }
+
+    const MyBinTreeNode* single[1];
+    REQUIRE(constant.find_batch(keys.begin() + 10, keys.begin() + 11, single) == (single + 1));
+    REQUIRE(single[0]->value == 10);
+
+    TBinTree empty;
+    REQUIRE(empty.find_batch(keys.begin(), keys.begin() + 3, found.begin()) == (found.begin() + 3));
+    REQUIRE(found[0] == nullptr);
+}
+
 } // namespace
 
 TEST_CASE("Intrusive non balanced binary tree", "[CppCommon][Containers]")
@@ -225,7 +396,35 @@ TEST_CASE("Intrusive balanced Reb-Black binary tree", "[CppCommon][Containers]")
     test<BinTreeRB<MyBinTreeNode>>();
 }
 
+TEST_CASE("Intrusive balanced AVL binary tree with order statistics", "[CppCommon][Containers]")
+{
+    test_rank<BinTreeAVL<MyRankBinTreeNode>>();
+}
+
+TEST_CASE("Intrusive balanced Reb-Black binary tree with order statistics", "[CppCommon][Containers]")
+{
+    test_rank<BinTreeRB<MyRankBinTreeNode>>();
+}
+
+TEST_CASE("Intrusive balanced AVL binary tree with bulk build, split and join", "[CppCommon][Containers]")
+{
+    test_build<BinTreeAVL<MyRankBinTreeNode>>();
+}
+
+TEST_CASE("Intrusive balanced Reb-Black binary tree with bulk build, split and join", "[CppCommon][Containers]")
+{
+    test_build<BinTreeRB<MyRankBinTreeNode>>();
+}
+
 TEST_CASE("Intrusive balanced Splay binary tree", "[CppCommon][Containers]")
 {
     test<BinTreeSplay<MyBinTreeNode>>();
 }
+
+TEST_CASE("Intrusive binary trees with prefetch", "[CppCommon][Containers]")
+{
+    test_prefetch<BinTree<MyBinTreeNode>>();
+    test_prefetch<BinTreeAA<MyBinTreeNode>>();
+    test_prefetch<BinTreeAVL<MyBinTreeNode>>();
+    test_prefetch<BinTreeRB<MyBinTreeNode>>();
+}
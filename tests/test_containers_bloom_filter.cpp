@@ -0,0 +1,130 @@
+//
+// Created by Ivan Shynkarenka on 15.10.2026
+//
+
+#include "test.h"
+
+#include "containers/bloom_filter.h"
+#include "filesystem/filesystem.h"
+#include "filesystem/mapped_file.h"
+
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace CppCommon;
+
+TEST_CASE("Bloom filter", "[CppCommon][Containers]")
+{
+    BloomFilter filter(10000, 0.01);
+    REQUIRE(filter.empty());
+    REQUIRE(filter.blocks() > 0);
+    REQUIRE(filter.bytes() == filter.blocks() * BloomFilter::BLOCK_SIZE);
+
+    for (int i = 0; i < 10000; ++i)
+        filter.Add(i);
+    REQUIRE(filter.count() == 10000);
+
+    // No false negatives
+    for (int i = 0; i < 10000; ++i)
+        REQUIRE(filter.Contains(i));
+
+    // False positive rate is close to the requested one
+    int positives = 0;
+    for (int i = 10000; i < 110000; ++i)
+        if (filter.Contains(i))
+            ++positives;
+    REQUIRE(positives < 2000);
+
+    // String keys
+    filter.Add(std::string("key"));
+    REQUIRE(filter.Contains(std::string_view("key")));
+
+    filter.Clear();
+    REQUIRE(filter.empty());
+    REQUIRE(!filter.Contains(0));
+}
+
+TEST_CASE("Bloom filter merge", "[CppCommon][Containers]")
+{
+    BloomFilter filter1(1000);
+    BloomFilter filter2(1000);
+    BloomFilter filter3(100000);
+
+    for (int i = 0; i < 500; ++i)
+        filter1.Add(i);
+    for (int i = 500; i < 1000; ++i)
+        filter2.Add(i);
+
+    REQUIRE(!filter1.Merge(filter3));
+    REQUIRE(filter1.Merge(filter2));
+    REQUIRE(filter1.count() == 1000);
+    for (int i = 0; i < 1000; ++i)
+        REQUIRE(filter1.Contains(i));
+
+    BloomFilter copy(filter1);
+    REQUIRE(copy.count() == 1000);
+    REQUIRE(copy.Contains(999));
+
+    BloomFilter moved(std::move(copy));
+    REQUIRE(moved.Contains(999));
+    REQUIRE(copy.empty());
+}
+
+TEST_CASE("Bloom filter concurrent", "[CppCommon][Containers]")
+{
+    BloomFilter filter(40000);
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t)
+    {
+        threads.emplace_back([&filter, t]()
+        {
+            for (int i = t * 10000; i < (t + 1) * 10000; ++i)
+                filter.AddConcurrent(i);
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+
+    REQUIRE(filter.count() == 40000);
+    for (int i = 0; i < 40000; ++i)
+        REQUIRE((filter.Contains(i) && filter.ContainsConcurrent(i)));
+}
+
+TEST_CASE("Bloom filter serialization", "[CppCommon][Containers]")
+{
+    BloomFilter filter(1000);
+    for (int i = 0; i < 1000; ++i)
+        filter.Add(i);
+
+    std::vector<uint8_t> buffer = filter.Serialize();
+
+    BloomFilter restored(1);
+    REQUIRE(BloomFilter::Deserialize(buffer, restored) == buffer.size());
+    REQUIRE(restored.blocks() == filter.blocks());
+    REQUIRE(restored.count() == 1000);
+    for (int i = 0; i < 1000; ++i)
+        REQUIRE(restored.Contains(i));
+
+    // Truncated or malformed buffers are rejected
+    REQUIRE(BloomFilter::Deserialize(std::span<const uint8_t>(buffer.data(), buffer.size() - 1), restored) == 0);
+    buffer[0] = 'X';
+    REQUIRE(BloomFilter::Deserialize(buffer, restored) == 0);
+
+    // Serialize into the file and load it with the memory-mapped file
+    {
+        File file("bloom.tmp");
+        file.Create(false, true);
+        filter.Serialize(file);
+        file.Close();
+    }
+    {
+        MappedFile file("bloom.tmp");
+        BloomFilter mapped(1);
+        REQUIRE(BloomFilter::Deserialize(file.bytes(), mapped) == file.size());
+        for (int i = 0; i < 1000; ++i)
+            REQUIRE(mapped.Contains(i));
+    }
+    File::Remove("bloom.tmp");
+}
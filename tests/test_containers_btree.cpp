@@ -0,0 +1,124 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "test.h"
+
+#include "containers/btree.h"
+#include "memory/allocator.h"
+#include "memory/allocator_pool.h"
+
+#include <algorithm>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+using namespace CppCommon;
+
+namespace {
+
+template <class TBTree>
+void test(TBTree& btree)
+{
+    REQUIRE(btree.empty());
+    REQUIRE(btree.size() == 0);
+    REQUIRE(btree.height() == 0);
+    REQUIRE(btree.begin() == btree.end());
+    REQUIRE(btree.rbegin() == btree.rend());
+    REQUIRE(btree.lowest() == nullptr);
+    REQUIRE(btree.highest() == nullptr);
+
+    // Insert enough items to build several levels of the tree
+    const int count = 10000;
+    std::vector<int> values;
+    for (int i = 0; i < count; ++i)
+        values.push_back(i * 2);
+    std::shuffle(values.begin(), values.end(), std::default_random_engine());
+
+    for (auto value : values)
+    {
+        REQUIRE(btree.insert(value).second);
+        REQUIRE(!btree.insert(value).second);
+    }
+    REQUIRE(btree.size() == count);
+    REQUIRE(btree.height() > 2);
+    REQUIRE(*btree.lowest() == 0);
+    REQUIRE(*btree.highest() == (count - 1) * 2);
+
+    // Check ordered iteration in both directions
+    int expected = 0;
+    for (auto it = btree.begin(); it != btree.end(); ++it, expected += 2)
+        REQUIRE(*it == expected);
+    REQUIRE(expected == count * 2);
+    for (auto it = btree.rbegin(); it != btree.rend(); ++it)
+        REQUIRE(*it == (expected -= 2));
+    REQUIRE(expected == 0);
+
+    // Check lookups
+    REQUIRE(*btree.find(10) == 10);
+    REQUIRE(btree.find(11) == btree.end());
+    REQUIRE(*btree.lower_bound(10) == 10);
+    REQUIRE(*btree.lower_bound(11) == 12);
+    REQUIRE(*btree.upper_bound(10) == 12);
+    REQUIRE(*btree.lower_bound(-1) == 0);
+    REQUIRE(btree.lower_bound(count * 2) == btree.end());
+    REQUIRE(btree.upper_bound((count - 1) * 2) == btree.end());
+
+    // Erase by iterator
+    auto it = btree.erase(btree.find(10));
+    REQUIRE(*it == 12);
+    REQUIRE(btree.find(10) == btree.end());
+    REQUIRE(btree.size() == count - 1);
+
+    // Erase all items
+    std::shuffle(values.begin(), values.end(), std::default_random_engine());
+    for (auto value : values)
+        REQUIRE(btree.erase(value) == ((value == 10) ? 0 : 1));
+    REQUIRE(btree.empty());
+    REQUIRE(btree.height() == 0);
+    REQUIRE(btree.begin() == btree.end());
+}
+
+} // namespace
+
+TEST_CASE("B+ tree", "[CppCommon][Containers]")
+{
+    BTree<int> btree;
+    test(btree);
+}
+
+TEST_CASE("B+ tree with pool allocator", "[CppCommon][Containers]")
+{
+    DefaultMemoryManager auxiliary;
+    PoolMemoryManager<DefaultMemoryManager> manager(auxiliary);
+    PoolAllocator<int, DefaultMemoryManager> allocator(manager);
+
+    BTree<int, std::less<int>, PoolAllocator<int, DefaultMemoryManager>> btree(std::less<int>(), allocator);
+    test(btree);
+}
+
+TEST_CASE("B+ tree random operations", "[CppCommon][Containers]")
+{
+    BTree<std::string> btree;
+    std::set<std::string> set;
+
+    std::mt19937 random(1);
+    for (int i = 0; i < 100000; ++i)
+    {
+        std::string value = std::to_string(random() % 5000);
+        if ((random() % 3) == 0)
+            REQUIRE(btree.erase(value) == set.erase(value));
+        else
+            REQUIRE(btree.insert(value).second == set.insert(value).second);
+    }
+
+    REQUIRE(btree.size() == set.size());
+    REQUIRE(std::equal(btree.begin(), btree.end(), set.begin(), set.end()));
+
+    BTree<std::string> copy(btree);
+    REQUIRE(std::equal(copy.begin(), copy.end(), set.begin(), set.end()));
+    for (const auto& value : set)
+        REQUIRE(copy.erase(value) == 1);
+    REQUIRE(copy.empty());
+}
@@ -0,0 +1,154 @@
+//
+// Created by Ivan Shynkarenka on 15.10.2026
+//
+
+#include "test.h"
+
+#include "containers/circular_buffer.h"
+
+#include <algorithm>
+#include <numeric>
+#include <string>
+#include <vector>
+
+using namespace CppCommon;
+
+TEST_CASE("Circular buffer", "[CppCommon][Containers]")
+{
+    CircularBuffer<int> buffer(5);
+    REQUIRE(buffer.empty());
+    REQUIRE(buffer.size() == 0);
+    REQUIRE(buffer.capacity() == 8);
+    REQUIRE(!buffer.overwrite());
+
+    for (int i = 0; i < 8; ++i)
+        buffer.push_back(i);
+    REQUIRE(buffer.full());
+    REQUIRE(buffer.front() == 0);
+    REQUIRE(buffer.back() == 7);
+    REQUIRE_THROWS_AS(buffer.push_back(8), std::length_error);
+    REQUIRE(buffer.try_push_back(8) == nullptr);
+
+    // Slide the window over the ring end
+    for (int i = 8; i < 20; ++i)
+    {
+        buffer.pop_front();
+        buffer.push_back(i);
+    }
+    REQUIRE(buffer.size() == 8);
+    for (size_t i = 0; i < buffer.size(); ++i)
+        REQUIRE(buffer[i] == (int)(12 + i));
+    REQUIRE(buffer.at(7) == 19);
+    REQUIRE_THROWS_AS(buffer.at(8), std::out_of_range);
+
+    buffer.pop_front(3);
+    buffer.pop_back(2);
+    REQUIRE(buffer == CircularBuffer<int>({ 15, 16, 17 }));
+
+    buffer.push_front(14);
+    buffer.emplace_front(13);
+    REQUIRE(buffer == CircularBuffer<int>({ 13, 14, 15, 16, 17 }));
+    buffer.pop_back();
+    REQUIRE(buffer.back() == 16);
+
+    buffer.clear();
+    REQUIRE(buffer.empty());
+}
+
+TEST_CASE("Circular buffer overwrite mode", "[CppCommon][Containers]")
+{
+    CircularBuffer<std::string> buffer(4, true);
+    REQUIRE(buffer.overwrite());
+
+    for (int i = 0; i < 10; ++i)
+        buffer.push_back(std::to_string(i));
+    REQUIRE(buffer.size() == 4);
+    REQUIRE(buffer == CircularBuffer<std::string>({ "6", "7", "8", "9" }));
+    REQUIRE(buffer.try_push_back("10") == nullptr);
+
+    // Pushing into the front drops the back item
+    buffer.push_front("5");
+    REQUIRE(buffer == CircularBuffer<std::string>({ "5", "6", "7", "8" }));
+}
+
+TEST_CASE("Circular buffer iterators", "[CppCommon][Containers]")
+{
+    CircularBuffer<int> buffer(8);
+    for (int i = 0; i < 6; ++i)
+        buffer.push_back(i);
+    buffer.pop_front(4);
+    for (int i = 6; i < 12; ++i)
+        buffer.push_back(i);
+
+    // Random access iterators
+    REQUIRE((buffer.end() - buffer.begin()) == 8);
+    REQUIRE(*(buffer.begin() + 3) == 7);
+    REQUIRE(buffer.begin()[7] == 11);
+    REQUIRE(buffer.begin() < buffer.end());
+    REQUIRE(std::accumulate(buffer.begin(), buffer.end(), 0) == (4 + 5 + 6 + 7 + 8 + 9 + 10 + 11));
+    REQUIRE(std::vector<int>(buffer.rbegin(), buffer.rend()) == std::vector<int>({ 11, 10, 9, 8, 7, 6, 5, 4 }));
+    REQUIRE(std::lower_bound(buffer.cbegin(), buffer.cend(), 9) == (buffer.cbegin() + 5));
+
+    // Iterators stay valid while popping other items
+    auto it = buffer.begin() + 2;
+    buffer.pop_front();
+    REQUIRE(*it == 6);
+
+    std::sort(buffer.begin(), buffer.end(), std::greater<int>());
+    REQUIRE(buffer.front() == 11);
+    REQUIRE(buffer.back() == 5);
+}
+
+TEST_CASE("Circular buffer spans", "[CppCommon][Containers]")
+{
+    CircularBuffer<int> buffer(8);
+    for (int i = 0; i < 8; ++i)
+        buffer.push_back(i);
+
+    // Not wrapped items are in the single span
+    auto spans = buffer.as_spans();
+    REQUIRE(spans.first.size() == 8);
+    REQUIRE(spans.second.empty());
+
+    buffer.pop_front(5);
+    for (int i = 8; i < 12; ++i)
+        buffer.push_back(i);
+
+    // Wrapped items are split between two spans
+    const CircularBuffer<int>& cbuffer = buffer;
+    auto cspans = cbuffer.as_spans();
+    REQUIRE(cspans.first.size() == 3);
+    REQUIRE(cspans.second.size() == 4);
+    std::vector<int> items(cspans.first.begin(), cspans.first.end());
+    items.insert(items.end(), cspans.second.begin(), cspans.second.end());
+    REQUIRE(items == std::vector<int>({ 5, 6, 7, 8, 9, 10, 11 }));
+}
+
+TEST_CASE("Circular buffer copy and move", "[CppCommon][Containers]")
+{
+    CircularBuffer<std::string> buffer(4);
+    buffer.push_back("a");
+    buffer.push_back("b");
+    buffer.pop_front();
+    buffer.push_back("c");
+
+    CircularBuffer<std::string> copy(buffer);
+    REQUIRE(copy == buffer);
+    REQUIRE(copy.capacity() == 4);
+
+    CircularBuffer<std::string> moved(std::move(copy));
+    REQUIRE(moved == buffer);
+    REQUIRE(copy.empty());
+    REQUIRE(copy.capacity() == 0);
+    REQUIRE_THROWS_AS(copy.push_back("x"), std::length_error);
+
+    CircularBuffer<std::string> assigned(1);
+    assigned = buffer;
+    REQUIRE(assigned == buffer);
+    assigned = std::move(moved);
+    REQUIRE(assigned == buffer);
+
+    swap(assigned, copy);
+    REQUIRE(assigned.empty());
+    REQUIRE(copy == buffer);
+}
@@ -0,0 +1,82 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "test.h"
+
+#include "containers/concurrent_hashmap.h"
+
+#include <thread>
+#include <vector>
+
+using namespace CppCommon;
+
+template <class TLock>
+void TestConcurrentHashMap()
+{
+    ConcurrentHashMap<int, int, std::hash<int>, std::equal_to<int>, TLock> hashmap(8, 16, -1);
+    REQUIRE(hashmap.shards() == 8);
+    REQUIRE(hashmap.empty());
+
+    REQUIRE(hashmap.insert(1, 1));
+    REQUIRE(!hashmap.insert(1, 10));
+    REQUIRE(!hashmap.insert_or_assign(1, 100));
+    REQUIRE(hashmap.insert_or_assign(2, 2));
+    REQUIRE(hashmap.size() == 2);
+
+    int value = 0;
+    REQUIRE(hashmap.find(1, value));
+    REQUIRE(value == 100);
+    REQUIRE(!hashmap.find(3, value));
+    REQUIRE(hashmap.contains(2));
+
+    REQUIRE(hashmap.visit(2, [](int& item) { item = 20; }));
+    REQUIRE(!hashmap.visit(3, [](int& item) { item = 30; }));
+    REQUIRE(hashmap.find(2, value));
+    REQUIRE(value == 20);
+
+    REQUIRE(hashmap.erase(1));
+    REQUIRE(!hashmap.erase(1));
+    REQUIRE(hashmap.size() == 1);
+
+    hashmap.clear();
+    REQUIRE(hashmap.empty());
+
+    // Concurrent inserts, finds and erases of disjoint key ranges
+    const int threads_count = 4;
+    const int items = 10000;
+    std::vector<std::thread> threads;
+    for (int thread = 0; thread < threads_count; ++thread)
+    {
+        threads.emplace_back([&hashmap, thread]()
+        {
+            for (int i = thread * items; i < (thread + 1) * items; ++i)
+                hashmap.insert_or_assign(i, i);
+            for (int i = thread * items; i < (thread + 1) * items; i += 2)
+                hashmap.erase(i);
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+
+    REQUIRE(hashmap.size() == (threads_count * items) / 2);
+
+    int64_t sum = 0;
+    size_t count = 0;
+    hashmap.visit_all([&sum, &count](const int& key, const int& item) { REQUIRE(key == item); sum += item; ++count; });
+    REQUIRE(count == (threads_count * items) / 2);
+    int64_t expected = 0;
+    for (int i = 1; i < threads_count * items; i += 2)
+        expected += i;
+    REQUIRE(sum == expected);
+}
+
+TEST_CASE("Concurrent hash map with RWLock", "[CppCommon][Containers]")
+{
+    TestConcurrentHashMap<RWLock>();
+}
+
+TEST_CASE("Concurrent hash map with SpinLock", "[CppCommon][Containers]")
+{
+    TestConcurrentHashMap<SpinLock>();
+}
@@ -0,0 +1,110 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "test.h"
+
+#include "containers/concurrent_queue.h"
+
+#include <thread>
+#include <vector>
+
+using namespace CppCommon;
+
+namespace {
+
+struct MyQueueNode : public ConcurrentQueue<MyQueueNode>::Node
+{
+    int producer;
+    int value;
+
+    MyQueueNode(int p, int v) : producer(p), value(v) {}
+};
+
+} // namespace
+
+TEST_CASE("Intrusive concurrent queue", "[CppCommon][Containers]")
+{
+    ConcurrentQueue<MyQueueNode> queue;
+    REQUIRE(queue.empty());
+    REQUIRE(queue.pop() == nullptr);
+
+    MyQueueNode item1(0, 1);
+    MyQueueNode item2(0, 2);
+    MyQueueNode item3(0, 3);
+    queue.push(item1);
+    REQUIRE(!queue.empty());
+    REQUIRE(queue.pop()->value == 1);
+    REQUIRE(queue.empty());
+
+    queue.push(item1);
+    queue.push(item2);
+    REQUIRE(queue.pop()->value == 1);
+    queue.push(item3);
+    REQUIRE(queue.pop()->value == 2);
+    REQUIRE(queue.pop()->value == 3);
+    REQUIRE(queue.pop() == nullptr);
+    REQUIRE(queue.empty());
+
+    // Move items from the single-threaded queue into the concurrent one
+    Queue<MyQueueNode> local;
+    local.push(item2);
+    local.push(item3);
+    queue.push(item1);
+    queue.push(local);
+    REQUIRE(local.empty());
+    REQUIRE(queue.pop()->value == 1);
+    REQUIRE(queue.pop()->value == 2);
+    REQUIRE(queue.pop()->value == 3);
+    REQUIRE(queue.pop() == nullptr);
+}
+
+TEST_CASE("Intrusive concurrent queue with multiple threads", "[CppCommon][Containers]")
+{
+    const int producers_count = 4;
+    const int items_count = 100000;
+
+    ConcurrentQueue<MyQueueNode> queue;
+
+    std::vector<std::vector<MyQueueNode>> items(producers_count);
+    for (int producer = 0; producer < producers_count; ++producer)
+    {
+        items[producer].reserve(items_count);
+        for (int i = 0; i < items_count; ++i)
+            items[producer].emplace_back(producer, i);
+    }
+
+    std::vector<std::thread> producers;
+    for (int producer = 0; producer < producers_count; ++producer)
+    {
+        producers.emplace_back([&queue, &items, producer]()
+        {
+            for (auto& item : items[producer])
+                queue.push(item);
+        });
+    }
+
+    // Consume all items and check FIFO order of each producer
+    bool valid = true;
+    int consumed = 0;
+    std::vector<int> expected(producers_count, 0);
+    while (consumed < (producers_count * items_count))
+    {
+        MyQueueNode* item = queue.pop();
+        if (item == nullptr)
+        {
+            std::this_thread::yield();
+            continue;
+        }
+        if (item->value != expected[item->producer]++)
+            valid = false;
+        ++consumed;
+    }
+
+    for (auto& producer : producers)
+        producer.join();
+
+    REQUIRE(valid);
+    REQUIRE(queue.pop() == nullptr);
+    REQUIRE(queue.empty());
+}
@@ -0,0 +1,174 @@
+//
+// Created by Ivan Shynkarenka on 15.10.2026
+//
+
+#include "test.h"
+
+#include "containers/concurrent_skiplist.h"
+
+#include <atomic>
+#include <limits>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace CppCommon;
+
+TEST_CASE("Concurrent skip list", "[CppCommon][Containers]")
+{
+    ConcurrentSkipList<int, std::string> skiplist;
+    REQUIRE(skiplist.empty());
+
+    for (int i = 9; i >= 0; --i)
+        REQUIRE(skiplist.insert(i * 10, std::to_string(i)));
+    REQUIRE(!skiplist.insert(50, "x"));
+    REQUIRE(skiplist.size() == 10);
+
+    std::string value;
+    REQUIRE(skiplist.find(50, value));
+    REQUIRE(value == "5");
+    REQUIRE(!skiplist.find(55, value));
+    REQUIRE(skiplist.contains(90));
+    REQUIRE(!skiplist.contains(-1));
+
+    std::pair<int, std::string> item;
+    REQUIRE((skiplist.lower_bound(55, item) && (item.first == 60) && (item.second == "6")));
+    REQUIRE((skiplist.lower_bound(60, item) && (item.first == 60)));
+    REQUIRE((skiplist.lower_bound(-100, item) && (item.first == 0)));
+    REQUIRE(!skiplist.lower_bound(91, item));
+
+    // Items are visited in the key order
+    std::vector<int> keys;
+    REQUIRE(skiplist.visit_all([&keys](int key, const std::string&) { keys.push_back(key); }) == 10);
+    REQUIRE(keys == std::vector<int>({ 0, 10, 20, 30, 40, 50, 60, 70, 80, 90 }));
+
+    keys.clear();
+    REQUIRE(skiplist.visit_range(15, 50, [&keys](int key, const std::string&) { keys.push_back(key); }) == 3);
+    REQUIRE(keys == std::vector<int>({ 20, 30, 40 }));
+
+    REQUIRE(skiplist.erase(30));
+    REQUIRE(!skiplist.erase(30));
+    REQUIRE(!skiplist.contains(30));
+    REQUIRE(skiplist.size() == 9);
+    REQUIRE((skiplist.lower_bound(25, item) && (item.first == 40)));
+
+    // Erased key could be inserted again
+    REQUIRE(skiplist.insert(30, "3"));
+    REQUIRE(skiplist.visit(30, [](const std::string& found) { REQUIRE(found == "3"); }));
+
+    skiplist.clear();
+    REQUIRE(skiplist.empty());
+    REQUIRE(skiplist.visit_all([](int, const std::string&) {}) == 0);
+}
+
+TEST_CASE("Concurrent skip list destroys items", "[CppCommon][Containers]")
+{
+    auto counter = std::make_shared<int>(0);
+    {
+        ConcurrentSkipList<int, std::shared_ptr<int>> skiplist;
+        for (int i = 0; i < 100; ++i)
+            skiplist.insert(i, counter);
+        for (int i = 0; i < 100; i += 2)
+            skiplist.erase(i);
+        REQUIRE(!skiplist.insert(1, counter));
+    }
+    REQUIRE(counter.use_count() == 1);
+}
+
+TEST_CASE("Concurrent skip list threads", "[CppCommon][Containers]")
+{
+    const int threads_count = 4;
+    const int items = 20000;
+
+    ConcurrentSkipList<int, int> skiplist;
+
+    // Stable keys are never erased and must be visible to scans all the time
+    const int stable = 1000;
+    for (int i = 0; i < stable; ++i)
+        REQUIRE(skiplist.insert(-stable + i, i));
+
+    std::atomic<bool> done(false);
+    std::atomic<bool> ordered(true);
+    std::atomic<bool> complete(true);
+
+    // Start scanners threads
+    std::vector<std::thread> scanners;
+    for (int scanner = 0; scanner < 2; ++scanner)
+    {
+        scanners.emplace_back([&skiplist, &done, &ordered, &complete, stable]()
+        {
+            do
+            {
+                int last = std::numeric_limits<int>::min();
+                int found = 0;
+                skiplist.visit_all([&](int key, int)
+                {
+                    if (key <= last)
+                        ordered = false;
+                    if (key < 0)
+                        ++found;
+                    last = key;
+                });
+                if (found != stable)
+                    complete = false;
+
+                std::pair<int, int> item;
+                if (!skiplist.lower_bound(-stable, item) || (item.first != -stable))
+                    complete = false;
+            } while (!done);
+        });
+    }
+
+    // Concurrent inserts and erases of overlapping key ranges
+    std::vector<std::thread> threads;
+    std::atomic<int> inserted(0);
+    std::atomic<int> erased(0);
+    for (int thread = 0; thread < threads_count; ++thread)
+    {
+        threads.emplace_back([&skiplist, &inserted, &erased, thread]()
+        {
+            for (int i = 0; i < items; ++i)
+            {
+                int key = (i * 7 + thread) % (items / 2);
+                if (skiplist.insert(key, key))
+                    ++inserted;
+                if (((i + thread) % 3) == 0)
+                    if (skiplist.erase((key * 13) % (items / 2)))
+                        ++erased;
+            }
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+
+    done = true;
+    for (auto& scanner : scanners)
+        scanner.join();
+
+    REQUIRE(ordered);
+    REQUIRE(complete);
+
+    // Size and the content of the skip list must be consistent
+    size_t count = skiplist.visit_all([](int key, int value) { REQUIRE(((key < 0) || (key == value))); });
+    REQUIRE(count == (size_t)(stable + inserted - erased));
+    REQUIRE(skiplist.size() == count);
+
+    // Erase all items concurrently
+    threads.clear();
+    std::atomic<size_t> removed(0);
+    for (int thread = 0; thread < threads_count; ++thread)
+    {
+        threads.emplace_back([&skiplist, &removed, stable]()
+        {
+            for (int key = -stable; key < (items / 2); ++key)
+                if (skiplist.erase(key))
+                    ++removed;
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+
+    REQUIRE(removed == count);
+    REQUIRE(skiplist.empty());
+}
@@ -0,0 +1,106 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "test.h"
+
+#include "containers/concurrent_stack.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace CppCommon;
+
+namespace {
+
+struct MyStackNode : public ConcurrentStack<MyStackNode>::Node
+{
+    int value;
+
+    explicit MyStackNode(int v) : value(v) {}
+};
+
+} // namespace
+
+TEST_CASE("Intrusive concurrent stack", "[CppCommon][Containers]")
+{
+    ConcurrentStack<MyStackNode> stack;
+    REQUIRE(stack.empty());
+    REQUIRE(stack.pop() == nullptr);
+
+    MyStackNode item1(1);
+    MyStackNode item2(2);
+    MyStackNode item3(3);
+    stack.push(item1);
+    stack.push(item2);
+    stack.push(item3);
+    REQUIRE(!stack.empty());
+
+    REQUIRE(stack.pop()->value == 3);
+    REQUIRE(stack.pop()->value == 2);
+    REQUIRE(item2.next == nullptr);
+
+    // Move items between the single-threaded stack and the concurrent one
+    Stack<MyStackNode> local;
+    local.push(item3);
+    local.push(item2);
+    stack.push(local);
+    REQUIRE(local.empty());
+
+    Stack<MyStackNode> all = stack.pop_all();
+    REQUIRE(stack.empty());
+    REQUIRE(all.size() == 3);
+    REQUIRE(all.pop()->value == 2);
+    REQUIRE(all.pop()->value == 3);
+    REQUIRE(all.pop()->value == 1);
+    REQUIRE(all.empty());
+}
+
+TEST_CASE("Intrusive concurrent stack with multiple threads", "[CppCommon][Containers]")
+{
+    const int threads_count = 4;
+    const int items_count = 64;
+    const int iterations = 100000;
+
+    ConcurrentStack<MyStackNode> stack;
+
+    std::vector<MyStackNode> items;
+    items.reserve(items_count);
+    for (int i = 0; i < items_count; ++i)
+        items.emplace_back(0);
+    for (auto& item : items)
+        stack.push(item);
+
+    // Each thread pops and pushes back the same items to provoke ABA problem
+    std::vector<std::thread> threads;
+    for (int thread = 0; thread < threads_count; ++thread)
+    {
+        threads.emplace_back([&stack, thread]()
+        {
+            for (int i = 0; i < iterations; ++i)
+            {
+                MyStackNode* item = stack.pop();
+                if (item != nullptr)
+                {
+                    item->value += (thread + 1);
+                    stack.push(*item);
+                }
+            }
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+
+    // All items must stay in the stack exactly once
+    Stack<MyStackNode> all = stack.pop_all();
+    REQUIRE(all.size() == items_count);
+    std::vector<bool> found(items_count, false);
+    for (auto& item : all)
+    {
+        size_t index = &item - items.data();
+        REQUIRE(index < items.size());
+        REQUIRE(!found[index]);
+        found[index] = true;
+    }
+}
@@ -0,0 +1,150 @@
+//
+// Created by Ivan Shynkarenka on 15.10.2026
+//
+
+#include "test.h"
+
+#include "containers/cuckoo_filter.h"
+#include "filesystem/filesystem.h"
+#include "filesystem/mapped_file.h"
+
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace CppCommon;
+
+TEST_CASE("Cuckoo filter", "[CppCommon][Containers]")
+{
+    CuckooFilter filter(10000);
+    REQUIRE(filter.empty());
+    REQUIRE(filter.capacity() >= 10000);
+    REQUIRE(filter.bytes() == filter.buckets() * sizeof(uint64_t));
+
+    for (int i = 0; i < 10000; ++i)
+        REQUIRE(filter.Add(i));
+    REQUIRE(filter.size() == 10000);
+
+    // No false negatives
+    for (int i = 0; i < 10000; ++i)
+        REQUIRE(filter.Contains(i));
+
+    // False positive rate is about 0.012%
+    int positives = 0;
+    for (int i = 10000; i < 110000; ++i)
+        if (filter.Contains(i))
+            ++positives;
+    REQUIRE(positives < 100);
+
+    // Remove half of keys
+    for (int i = 0; i < 10000; i += 2)
+        REQUIRE(filter.Remove(i));
+    REQUIRE(filter.size() == 5000);
+    for (int i = 1; i < 10000; i += 2)
+        REQUIRE(filter.Contains(i));
+    positives = 0;
+    for (int i = 0; i < 10000; i += 2)
+        if (filter.Contains(i))
+            ++positives;
+    REQUIRE(positives < 10);
+
+    // String keys
+    REQUIRE(filter.Add(std::string("key")));
+    REQUIRE(filter.Contains(std::string_view("key")));
+    REQUIRE(filter.Remove(std::string_view("key")));
+
+    filter.Clear();
+    REQUIRE(filter.empty());
+    REQUIRE(!filter.Contains(1));
+}
+
+TEST_CASE("Cuckoo filter full", "[CppCommon][Containers]")
+{
+    CuckooFilter filter(1000);
+
+    // Fill the filter until the victim is kept
+    int added = 0;
+    while (filter.Add(added))
+        ++added;
+    REQUIRE(filter.load_factor() > 0.9);
+    REQUIRE(filter.size() == (size_t)added);
+    for (int i = 0; i < added; ++i)
+        REQUIRE(filter.Contains(i));
+
+    // Removing releases slots for the victim
+    for (int i = 0; i < 100; ++i)
+        REQUIRE(filter.Remove(i));
+    REQUIRE(filter.Add(added));
+    REQUIRE(filter.size() == (size_t)added - 99);
+    for (int i = 100; i <= added; ++i)
+        REQUIRE(filter.Contains(i));
+
+    CuckooFilter copy(filter);
+    REQUIRE(copy.size() == filter.size());
+    REQUIRE(copy.Contains(added));
+
+    CuckooFilter moved(std::move(copy));
+    REQUIRE(moved.Contains(added));
+    REQUIRE(copy.empty());
+}
+
+TEST_CASE("Cuckoo filter concurrent", "[CppCommon][Containers]")
+{
+    CuckooFilter filter(40000);
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t)
+    {
+        threads.emplace_back([&filter, t]()
+        {
+            for (int i = t * 10000; i < (t + 1) * 10000; ++i)
+                filter.AddConcurrent(i);
+            for (int i = t * 10000; i < (t + 1) * 10000; i += 2)
+                filter.RemoveConcurrent(i);
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+
+    REQUIRE(filter.size() == 20000);
+    for (int i = 1; i < 40000; i += 2)
+        REQUIRE(filter.ContainsConcurrent(i));
+}
+
+TEST_CASE("Cuckoo filter serialization", "[CppCommon][Containers]")
+{
+    CuckooFilter filter(1000);
+    for (int i = 0; i < 1000; ++i)
+        filter.Add(i);
+
+    std::vector<uint8_t> buffer = filter.Serialize();
+
+    CuckooFilter restored(1);
+    REQUIRE(CuckooFilter::Deserialize(buffer, restored) == buffer.size());
+    REQUIRE(restored.buckets() == filter.buckets());
+    REQUIRE(restored.size() == 1000);
+    for (int i = 0; i < 1000; ++i)
+        REQUIRE(restored.Contains(i));
+    REQUIRE(restored.Remove(0));
+
+    // Truncated or malformed buffers are rejected
+    REQUIRE(CuckooFilter::Deserialize(std::span<const uint8_t>(buffer.data(), buffer.size() - 1), restored) == 0);
+    buffer[0] = 'X';
+    REQUIRE(CuckooFilter::Deserialize(buffer, restored) == 0);
+
+    // Serialize into the file and load it with the memory-mapped file
+    {
+        File file("cuckoo.tmp");
+        file.Create(false, true);
+        filter.Serialize(file);
+        file.Close();
+    }
+    {
+        MappedFile file("cuckoo.tmp");
+        CuckooFilter mapped(1);
+        REQUIRE(CuckooFilter::Deserialize(file.bytes(), mapped) == file.size());
+        for (int i = 0; i < 1000; ++i)
+            REQUIRE(mapped.Contains(i));
+    }
+    File::Remove("cuckoo.tmp");
+}
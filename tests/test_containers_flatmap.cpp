@@ -150,3 +150,113 @@ TEST_CASE("Flat map", "[CppCommon][Containers]")
 
     REQUIRE(flatmap.empty());
 }
+
+TEST_CASE("Flat map with heterogeneous lookup", "[CppCommon][Containers]")
+{
+    FlatMap<std::string, int, std::less<>> flatmap;
+    flatmap["one"] = 1;
+    flatmap["two"] = 2;
+    flatmap["three"] = 3;
+
+    std::string_view key = "two";
+    REQUIRE(flatmap.find(key) != flatmap.end());
+    REQUIRE(flatmap.find(key)->second == 2);
+    REQUIRE(flatmap.find("three")->second == 3);
+    REQUIRE(flatmap.find(std::string_view("four")) == flatmap.end());
+    REQUIRE(flatmap.count(std::string_view("one")) == 1);
+    REQUIRE(flatmap.count("four") == 0);
+    REQUIRE(flatmap.lower_bound(std::string_view("p"))->first == "three");
+    REQUIRE(flatmap.upper_bound(std::string_view("three"))->first == "two");
+    auto range = flatmap.equal_range(key);
+    REQUIRE(std::distance(range.first, range.second) == 1);
+
+    REQUIRE(flatmap.erase(key) == 1);
+    REQUIRE(flatmap.erase(key) == 0);
+    REQUIRE(flatmap.size() == 2);
+
+    // Erase by iterator must not be treated as the compatible key
+    flatmap.erase(flatmap.find("one"));
+    REQUIRE(flatmap.size() == 1);
+}
+
+TEST_CASE("Flat map with bulk insert and merge", "[CppCommon][Containers]")
+{
+    FlatMap<int, int> flatmap;
+    flatmap.emplace(5, 50);
+    flatmap.emplace(1, 10);
+
+    std::vector<std::pair<int, int>> items = { { 4, 4 }, { 2, 2 }, { 5, 5 }, { 3, 3 }, { 2, 20 }, { 6, 6 } };
+    flatmap.insert(items.begin(), items.end());
+    REQUIRE(flatmap.size() == 6);
+    REQUIRE(std::is_sorted(flatmap.begin(), flatmap.end()));
+    REQUIRE(flatmap.at(5) == 50);
+    REQUIRE(flatmap.at(2) == 2);
+
+    std::vector<std::pair<int, int>> sorted = { { 0, 0 }, { 3, 30 }, { 7, 7 }, { 8, 8 } };
+    flatmap.insert(sorted_unique, sorted.begin(), sorted.end());
+    REQUIRE(flatmap.size() == 9);
+    REQUIRE(std::is_sorted(flatmap.begin(), flatmap.end()));
+    REQUIRE(flatmap.at(3) == 3);
+    REQUIRE(flatmap.at(8) == 8);
+
+    FlatMap<int, int> flatmap2(sorted_unique, sorted.begin(), sorted.end());
+    REQUIRE(flatmap2.size() == 4);
+
+    FlatMap<int, int> other;
+    other.emplace(8, 80);
+    other.emplace(9, 9);
+    other.emplace(-1, -1);
+    flatmap.merge(other);
+    REQUIRE(flatmap.size() == 11);
+    REQUIRE(std::is_sorted(flatmap.begin(), flatmap.end()));
+    REQUIRE(flatmap.at(8) == 8);
+    REQUIRE(flatmap.at(9) == 9);
+    REQUIRE(flatmap.at(-1) == -1);
+    REQUIRE(other.size() == 1);
+    REQUIRE(other.at(8) == 80);
+
+    flatmap2.merge(std::move(flatmap));
+    REQUIRE(flatmap2.size() == 11);
+    REQUIRE(flatmap2.at(3) == 30);
+}
+
+TEST_CASE("Flat map with frozen search", "[CppCommon][Containers]")
+{
+    FlatMap<int, int> flatmap;
+    flatmap.freeze();
+    REQUIRE(flatmap.frozen());
+    REQUIRE(flatmap.find(1) == flatmap.end());
+
+    for (int size = 1; size < 100; ++size)
+    {
+        flatmap.clear();
+        for (int i = 0; i < size; ++i)
+            flatmap.emplace(i * 2, i);
+        REQUIRE(!flatmap.frozen());
+
+        flatmap.freeze();
+        REQUIRE(flatmap.frozen());
+        for (int key = -1; key <= size * 2; ++key)
+        {
+            auto lower = std::lower_bound(flatmap.begin(), flatmap.end(), key, [](const std::pair<int, int>& item, int k) { return item.first < k; });
+            auto upper = std::upper_bound(flatmap.begin(), flatmap.end(), key, [](int k, const std::pair<int, int>& item) { return k < item.first; });
+            REQUIRE(flatmap.lower_bound(key) == lower);
+            REQUIRE(flatmap.upper_bound(key) == upper);
+            REQUIRE((flatmap.find(key) != flatmap.end()) == ((key >= 0) && (key < size * 2) && ((key % 2) == 0)));
+        }
+    }
+
+    // Updating values keeps the flat map frozen
+    flatmap[4] = 100;
+    REQUIRE(flatmap.frozen());
+    REQUIRE(flatmap.at(4) == 100);
+
+    // Updating keys thaws the flat map
+    flatmap.emplace(5, 5);
+    REQUIRE(!flatmap.frozen());
+    REQUIRE(flatmap.find(5)->second == 5);
+    flatmap.freeze();
+    flatmap.erase(5);
+    REQUIRE(!flatmap.frozen());
+    REQUIRE(flatmap.find(5) == flatmap.end());
+}
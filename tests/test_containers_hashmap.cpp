@@ -6,6 +6,8 @@
 
 #include "containers/hashmap.h"
 
+#include <vector>
+
 using namespace CppCommon;
 
 TEST_CASE("Hash map", "[CppCommon][Containers]")
@@ -100,3 +102,188 @@ TEST_CASE("Hash map", "[CppCommon][Containers]")
 
     REQUIRE(hashmap.empty());
 }
+
+TEST_CASE("Hash map with group probing", "[CppCommon][Containers]")
+{
+    HashMap<int, int, std::hash<int>, std::equal_to<int>, std::allocator<std::pair<int, int>>, HashMapGroupProbing> hashmap(16, -1);
+    REQUIRE(hashmap.empty());
+
+    // Use the same hash for many keys to build long clusters
+    for (int i = 0; i < 1000; ++i)
+        REQUIRE(hashmap.emplace(i * 64, i).second);
+    REQUIRE(hashmap.size() == 1000);
+    REQUIRE(!hashmap.emplace(0, 0).second);
+
+    for (int i = 0; i < 1000; ++i)
+    {
+        REQUIRE(hashmap.find(i * 64) != hashmap.end());
+        REQUIRE(hashmap.find(i * 64)->second == i);
+        REQUIRE(hashmap.find(i * 64 + 1) == hashmap.end());
+    }
+
+    int count = 0;
+    for (auto it = hashmap.begin(); it != hashmap.end(); ++it)
+        ++count;
+    REQUIRE(count == 1000);
+
+    for (int i = 0; i < 1000; i += 2)
+        REQUIRE(hashmap.erase(i * 64) == 1);
+    REQUIRE(hashmap.size() == 500);
+
+    for (int i = 0; i < 1000; ++i)
+        REQUIRE((hashmap.find(i * 64) != hashmap.end()) == ((i % 2) != 0));
+
+    hashmap.clear();
+    REQUIRE(hashmap.empty());
+    REQUIRE(hashmap.find(64) == hashmap.end());
+}
+
+TEST_CASE("Hash map load factor and displacement", "[CppCommon][Containers]")
+{
+    HashMap<int, int> hashmap(16, -1);
+    REQUIRE(hashmap.max_load_factor() == 0.5f);
+    REQUIRE(hashmap.max_displacement() == 0);
+    REQUIRE(hashmap.avg_displacement() == 0.0);
+
+    hashmap.max_load_factor(0.25f);
+    for (int i = 0; i < 1000; ++i)
+        hashmap[i] = i;
+    REQUIRE(hashmap.size() == 1000);
+    REQUIRE(hashmap.load_factor() <= 0.25f);
+    REQUIRE(hashmap.bucket_count() >= 4000);
+    REQUIRE(hashmap.avg_displacement() <= (double)hashmap.max_displacement());
+
+    // Colliding keys are displaced from their hash positions (identity hash keeps multiples of 16 in the same bucket)
+    HashMap<int, int, std::hash<int>> collisions(16, -1);
+    collisions[16] = 1;
+    collisions[32] = 2;
+    collisions[48] = 3;
+    REQUIRE(collisions.max_displacement() == 2);
+    REQUIRE(collisions.avg_displacement() == 1.0);
+
+    REQUIRE_THROWS_AS(hashmap.max_load_factor(1.0f), std::invalid_argument);
+
+    for (int i = 0; i < 990; ++i)
+        REQUIRE(hashmap.erase(i) == 1);
+    size_t buckets = hashmap.bucket_count();
+    hashmap.shrink_to_fit();
+    REQUIRE(hashmap.bucket_count() < buckets);
+    REQUIRE(hashmap.size() == 10);
+    REQUIRE(hashmap.load_factor() <= 0.25f);
+    for (int i = 990; i < 1000; ++i)
+        REQUIRE(hashmap.find(i)->second == i);
+}
+
+TEST_CASE("Hash map with incremental rehash", "[CppCommon][Containers]")
+{
+    HashMap<int, int> hashmap(16, -1);
+    hashmap.incremental_rehash(4);
+    REQUIRE(hashmap.incremental_rehash() == 4);
+
+    bool rehashing = false;
+    for (int i = 0; i < 10000; ++i)
+    {
+        hashmap[i] = i;
+        rehashing |= hashmap.rehashing();
+
+        // All items must be available during the incremental rehash
+        if ((i % 1000) == 0)
+            for (int j = 0; j <= i; ++j)
+                REQUIRE(hashmap.find(j)->second == j);
+    }
+    REQUIRE(rehashing);
+    REQUIRE(hashmap.size() == 10000);
+
+    int count = 0;
+    for (auto it = hashmap.begin(); it != hashmap.end(); ++it)
+    {
+        REQUIRE(it->first == it->second);
+        ++count;
+    }
+    REQUIRE(count == 10000);
+
+    for (int i = 0; i < 10000; i += 2)
+        REQUIRE(hashmap.erase(i) == 1);
+    REQUIRE(hashmap.size() == 5000);
+    for (int i = 0; i < 10000; ++i)
+        REQUIRE((hashmap.find(i) != hashmap.end()) == ((i % 2) != 0));
+
+    // Disable incremental rehash mode to complete the pending rehash
+    hashmap.incremental_rehash(0);
+    REQUIRE(!hashmap.rehashing());
+    for (int i = 1; i < 10000; i += 2)
+        REQUIRE(hashmap.find(i)->second == i);
+}
+
+TEST_CASE("Hash map batched lookup", "[CppCommon][Containers]")
+{
+    HashMap<int, int> hashmap(16, -1);
+    HashMap<int, int, std::hash<int>, std::equal_to<int>, std::allocator<std::pair<int, int>>, HashMapGroupProbing> grouped(16, -1);
+    for (int i = 0; i < 1000; i += 2)
+    {
+        hashmap.emplace(i, i * 10);
+        grouped.emplace(i, i * 10);
+    }
+
+    // Keys of several batches with found and missed ones
+    std::vector<int> keys;
+    for (int i = 0; i < 100; ++i)
+        keys.push_back((i * 37) % 1000);
+
+    std::vector<HashMap<int, int>::iterator> results(keys.size());
+    std::vector<decltype(grouped)::iterator> grouped_results(keys.size());
+    size_t found = hashmap.find_batch(keys, results);
+    REQUIRE(grouped.find_batch(keys, grouped_results) == found);
+
+    size_t expected = 0;
+    for (size_t i = 0; i < keys.size(); ++i)
+    {
+        REQUIRE(results[i] == hashmap.find(keys[i]));
+        REQUIRE(grouped_results[i] == grouped.find(keys[i]));
+        if ((keys[i] % 2) == 0)
+        {
+            REQUIRE(results[i]->second == keys[i] * 10);
+            ++expected;
+        }
+        else
+            REQUIRE(results[i] == hashmap.end());
+    }
+    REQUIRE(found == expected);
+
+    // Batched lookup must find items in old buckets during the incremental rehash
+    HashMap<int, int> rehashed(16, -1);
+    rehashed.incremental_rehash(1);
+    for (int i = 0; i < 100; ++i)
+        rehashed.emplace(i, i);
+    REQUIRE(rehashed.rehashing());
+    const auto& crehashed = rehashed;
+    std::vector<HashMap<int, int>::const_iterator> cresults(keys.size());
+    crehashed.find_batch(keys, cresults);
+    for (size_t i = 0; i < keys.size(); ++i)
+        REQUIRE(cresults[i] == crehashed.find(keys[i]));
+}
+
+TEST_CASE("Hash map with heterogeneous lookup", "[CppCommon][Containers]")
+{
+    HashMap<std::string, int, TransparentStringHash, std::equal_to<>> hashmap(16, "");
+    hashmap["one"] = 1;
+    hashmap["two"] = 2;
+    hashmap["three"] = 3;
+
+    std::string_view key = "two";
+    REQUIRE(hashmap.find(key) != hashmap.end());
+    REQUIRE(hashmap.find(key)->second == 2);
+    REQUIRE(hashmap.find("three")->second == 3);
+    REQUIRE(hashmap.find(std::string_view("four")) == hashmap.end());
+    REQUIRE(hashmap.count(std::string_view("one")) == 1);
+    REQUIRE(hashmap.count("four") == 0);
+    REQUIRE(hashmap.equal_range(key).first->second == 2);
+
+    REQUIRE(hashmap.erase(key) == 1);
+    REQUIRE(hashmap.erase(key) == 0);
+    REQUIRE(hashmap.size() == 2);
+
+    // Erase by iterator must not be treated as the compatible key
+    hashmap.erase(hashmap.find("one"));
+    REQUIRE(hashmap.size() == 1);
+}
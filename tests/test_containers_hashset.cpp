@@ -0,0 +1,163 @@
+//
+// Created by Ivan Shynkarenka on 15.10.2026
+//
+
+#include "test.h"
+
+#include "containers/hashset.h"
+#include "containers/list.h"
+
+#include <vector>
+
+using namespace CppCommon;
+
+namespace {
+
+struct MyHashSetNode : public HashSetNode<MyHashSetNode>, public List<MyHashSetNode>::Node
+{
+    int key;
+    int value;
+
+    MyHashSetNode(int k, int v) : key(k), value(v) {}
+};
+
+struct MyHashSetHash
+{
+    size_t operator()(int key) const noexcept { return (size_t)key; }
+    size_t operator()(const MyHashSetNode& node) const noexcept { return (size_t)node.key; }
+};
+
+struct MyHashSetEqual
+{
+    bool operator()(const MyHashSetNode& node, int key) const noexcept { return node.key == key; }
+    bool operator()(const MyHashSetNode& node1, const MyHashSetNode& node2) const noexcept { return node1.key == node2.key; }
+};
+
+typedef HashSet<MyHashSetNode, MyHashSetHash, MyHashSetEqual> MyHashSet;
+
+} // namespace
+
+TEST_CASE("Intrusive hash set", "[CppCommon][Containers]")
+{
+    MyHashSetNode* buckets[8];
+    MyHashSet hashset(buckets, 8);
+    REQUIRE(hashset.empty());
+    REQUIRE(hashset.size() == 0);
+    REQUIRE(hashset.bucket_count() == 8);
+    REQUIRE(hashset.begin() == hashset.end());
+
+    // Items are linked into the list and the hash set at the same time
+    std::vector<MyHashSetNode> items;
+    for (int i = 0; i < 20; ++i)
+        items.emplace_back(i, i * 10);
+    List<MyHashSetNode> list;
+    for (auto& item : items)
+    {
+        list.push_back(item);
+        REQUIRE(hashset.insert(item).second);
+    }
+    REQUIRE(hashset.size() == 20);
+    REQUIRE(list.size() == 20);
+    REQUIRE(hashset.load_factor() == 2.5);
+
+    // Duplicate key is not inserted
+    MyHashSetNode duplicate(5, 0);
+    auto result = hashset.insert(duplicate);
+    REQUIRE(!result.second);
+    REQUIRE(result.first->value == 50);
+    REQUIRE(hashset.size() == 20);
+
+    // Find by key and by item
+    REQUIRE(hashset.find(7)->value == 70);
+    REQUIRE(hashset.find(duplicate)->value == 50);
+    REQUIRE(hashset.find(100) == hashset.end());
+    REQUIRE(hashset.contains(19));
+    REQUIRE(!hashset.contains(20));
+
+    int sum = 0;
+    for (const auto& item : hashset)
+        sum += item.key;
+    REQUIRE(sum == 190);
+
+    // Erase by key
+    MyHashSetNode* node = hashset.erase(3);
+    REQUIRE(node != nullptr);
+    REQUIRE(node->key == 3);
+    REQUIRE(node->hash_next == nullptr);
+    REQUIRE(hashset.erase(3) == nullptr);
+    REQUIRE(hashset.size() == 19);
+    REQUIRE(list.size() == 20);
+
+    // Erase odd keys by iterator
+    for (auto it = hashset.begin(); it != hashset.end();)
+    {
+        if (it->key % 2 != 0)
+            it = hashset.erase(it);
+        else
+            ++it;
+    }
+    REQUIRE(hashset.size() == 10);
+    for (int i = 0; i < 20; ++i)
+        REQUIRE(hashset.contains(i) == (i % 2 == 0));
+
+    hashset.clear();
+    REQUIRE(hashset.empty());
+    REQUIRE(hashset.find(0) == hashset.end());
+}
+
+TEST_CASE("Intrusive hash set incremental resizing", "[CppCommon][Containers]")
+{
+    std::vector<MyHashSetNode*> buckets1(4);
+    std::vector<MyHashSetNode*> buckets2(64);
+    std::vector<MyHashSetNode*> buckets3(16);
+    MyHashSet hashset(buckets1.data(), buckets1.size());
+
+    std::vector<MyHashSetNode> items;
+    for (int i = 0; i < 100; ++i)
+        items.emplace_back(i, i);
+    for (int i = 0; i < 40; ++i)
+        REQUIRE(hashset.insert(items[i]).second);
+
+    // Grow the hash set: all items are still reachable during resizing
+    hashset.rehash(buckets2.data(), buckets2.size());
+    REQUIRE(hashset.resizing());
+    REQUIRE(hashset.bucket_count() == 64);
+    for (int i = 0; i < 40; ++i)
+        REQUIRE(hashset.contains(i));
+
+    // Each insert moves a few old chains
+    REQUIRE(hashset.insert(items[40]).second);
+    REQUIRE(hashset.resizing());
+    REQUIRE(hashset.insert(items[41]).second);
+    REQUIRE(!hashset.resizing());
+    REQUIRE(hashset.size() == 42);
+
+    size_t count = 0;
+    for (auto it = hashset.cbegin(); it != hashset.cend(); ++it)
+        ++count;
+    REQUIRE(count == 42);
+    for (int i = 0; i < 42; ++i)
+        REQUIRE(hashset.contains(i));
+
+    // Shrink the hash set and iterate during resizing
+    hashset.rehash(buckets3.data(), buckets3.size());
+    REQUIRE(hashset.migrate(10) == false);
+    count = 0;
+    int sum = 0;
+    for (const auto& item : hashset)
+    {
+        ++count;
+        sum += item.key;
+    }
+    REQUIRE(count == 42);
+    REQUIRE(sum == 861);
+
+    // Erase during resizing
+    REQUIRE(hashset.erase(0) != nullptr);
+    REQUIRE(hashset.erase(63) == nullptr);
+    REQUIRE(hashset.migrate());
+    REQUIRE(!hashset.resizing());
+    REQUIRE(hashset.size() == 41);
+    for (int i = 1; i < 42; ++i)
+        REQUIRE(hashset.find(i)->value == i);
+}
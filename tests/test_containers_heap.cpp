@@ -0,0 +1,175 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "test.h"
+
+#include "containers/heap.h"
+
+#include <random>
+#include <set>
+#include <utility>
+#include <vector>
+
+using namespace CppCommon;
+
+namespace {
+
+struct MyHeapNode : public Heap<MyHeapNode>::Node
+{
+    int value;
+
+    explicit MyHeapNode(int v) : value(v) {}
+    friend bool operator<(const MyHeapNode& node1, const MyHeapNode& node2)
+    { return node1.value < node2.value; }
+};
+
+template <size_t D>
+struct MyArityNode : public Heap<MyArityNode<D>, std::less<MyArityNode<D>>, D>::Node
+{
+    int value;
+
+    explicit MyArityNode(int v) : value(v) {}
+    friend bool operator<(const MyArityNode& node1, const MyArityNode& node2)
+    { return node1.value < node2.value; }
+};
+
+template <size_t D>
+void test_random()
+{
+    typedef MyArityNode<D> Node;
+
+    const int count = 1000;
+
+    std::vector<Node> nodes;
+    nodes.reserve(count);
+    for (int i = 0; i < count; ++i)
+        nodes.emplace_back(i);
+
+    Heap<Node, std::less<Node>, D> heap(count);
+    std::multiset<std::pair<int, Node*>> reference;
+
+    std::mt19937 random(D);
+    for (int i = 0; i < 100000; ++i)
+    {
+        Node& node = nodes[random() % count];
+        switch (random() % 4)
+        {
+            case 0:
+                if (!heap.contains(node))
+                {
+                    node.value = random() % 1000;
+                    REQUIRE(heap.push(node));
+                    reference.emplace(node.value, &node);
+                }
+                break;
+            case 1:
+                if (heap.contains(node))
+                {
+                    reference.erase(reference.find(std::make_pair(node.value, &node)));
+                    node.value = random() % 1000;
+                    heap.update(node);
+                    reference.emplace(node.value, &node);
+                }
+                break;
+            case 2:
+                if (heap.contains(node))
+                {
+                    REQUIRE(heap.erase(node) == &node);
+                    reference.erase(reference.find(std::make_pair(node.value, &node)));
+                }
+                else
+                    REQUIRE(heap.erase(node) == nullptr);
+                break;
+            case 3:
+            {
+                Node* top = heap.pop();
+                if (reference.empty())
+                    REQUIRE(top == nullptr);
+                else
+                {
+                    REQUIRE(top != nullptr);
+                    REQUIRE(top->value == reference.begin()->first);
+                    REQUIRE(!heap.contains(*top));
+                    reference.erase(reference.find(std::make_pair(top->value, top)));
+                }
+                break;
+            }
+        }
+        REQUIRE(heap.size() == reference.size());
+    }
+
+    // Pop all items in order
+    int previous = -1;
+    while (heap)
+    {
+        Node* top = heap.pop();
+        REQUIRE(top->value >= previous);
+        previous = top->value;
+    }
+}
+
+} // namespace
+
+TEST_CASE("Intrusive heap", "[CppCommon][Containers]")
+{
+    Heap<MyHeapNode> heap(4);
+    REQUIRE(heap.empty());
+    REQUIRE(heap.size() == 0);
+    REQUIRE(heap.capacity() == 4);
+    REQUIRE(heap.top() == nullptr);
+    REQUIRE(heap.pop() == nullptr);
+
+    MyHeapNode item1(5);
+    MyHeapNode item2(3);
+    MyHeapNode item3(8);
+    MyHeapNode item4(1);
+    MyHeapNode item5(2);
+    REQUIRE(heap.push(item1));
+    REQUIRE(heap.push(item2));
+    REQUIRE(heap.push(item3));
+    REQUIRE(heap.push(item4));
+    REQUIRE(heap.full());
+    REQUIRE(!heap.push(item5));
+    REQUIRE(!heap.contains(item5));
+    REQUIRE(heap.top()->value == 1);
+
+    // Decrease and increase keys
+    item3.value = 0;
+    heap.update(item3);
+    REQUIRE(heap.top() == &item3);
+    item3.value = 10;
+    heap.update(item3);
+    REQUIRE(heap.top() == &item4);
+
+    // Erase arbitrary items
+    REQUIRE(heap.erase(item2) == &item2);
+    REQUIRE(heap.erase(item2) == nullptr);
+    REQUIRE(heap.size() == 3);
+
+    REQUIRE(heap.pop() == &item4);
+    REQUIRE(heap.pop() == &item1);
+    REQUIRE(heap.pop() == &item3);
+    REQUIRE(heap.empty());
+    REQUIRE(item3.index == Heap<MyHeapNode>::npos);
+
+    // Move the heap with its items
+    REQUIRE(heap.push(item1));
+    REQUIRE(heap.push(item5));
+    Heap<MyHeapNode> moved(std::move(heap));
+    REQUIRE(heap.empty());
+    REQUIRE(moved.size() == 2);
+    REQUIRE(moved.top() == &item5);
+    moved.clear();
+    REQUIRE(moved.empty());
+    REQUIRE(!moved.contains(item5));
+    REQUIRE(item1.index == Heap<MyHeapNode>::npos);
+}
+
+TEST_CASE("Intrusive heap with random operations", "[CppCommon][Containers]")
+{
+    test_random<2>();
+    test_random<3>();
+    test_random<4>();
+    test_random<8>();
+}
@@ -6,6 +6,8 @@
 
 #include "containers/list.h"
 
+#include <vector>
+
 using namespace CppCommon;
 
 namespace {
@@ -76,3 +78,32 @@ TEST_CASE("Intrusive list", "[CppCommon][Containers]")
 
     REQUIRE(list.empty());
 }
+
+TEST_CASE("Intrusive list with prefetch", "[CppCommon][Containers]")
+{
+    List<MyListNode> list;
+    list.for_each_prefetch([](MyListNode&) { REQUIRE(false); });
+
+    std::vector<MyListNode> items;
+    for (int i = 0; i < 100; ++i)
+        items.emplace_back(i);
+    for (auto& item : items)
+        list.push_back(item);
+
+    // Traverse with the prefetch distance shorter and longer than the list
+    for (size_t distance : { 0, 1, 8, 1000 })
+    {
+        int expected = 0;
+        list.for_each_prefetch([&expected](MyListNode& item) { REQUIRE(item.value == expected++); }, distance);
+        REQUIRE(expected == 100);
+    }
+
+    // Popping the current item is allowed
+    list.for_each_prefetch([&list](MyListNode& item) { if ((item.value % 2) == 0) list.pop_current(item); });
+    REQUIRE(list.size() == 50);
+
+    int sum = 0;
+    const List<MyListNode>& constant = list;
+    constant.for_each_prefetch([&sum](const MyListNode& item) { sum += item.value; });
+    REQUIRE(sum == 2500);
+}
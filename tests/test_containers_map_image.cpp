@@ -0,0 +1,168 @@
+//
+// Created by Ivan Shynkarenka on 15.10.2026
+//
+
+#include "test.h"
+
+#include "containers/flatmap.h"
+#include "containers/hashmap.h"
+#include "containers/map_image.h"
+
+#include <vector>
+
+using namespace CppCommon;
+
+namespace {
+
+struct Route
+{
+    uint32_t gateway;
+    uint16_t port;
+};
+
+} // namespace
+
+TEST_CASE("Hash map image", "[CppCommon][Containers]")
+{
+    HashMap<uint64_t, Route> hashmap(128, (uint64_t)-1);
+    for (uint64_t i = 0; i < 1000; ++i)
+        hashmap.emplace(i * 7, Route{ (uint32_t)i, (uint16_t)(i % 100) });
+
+    HashMapImage<uint64_t, Route>::Save("hashmap.image", hashmap);
+
+    // Query the memory-mapped image in place
+    {
+        MappedFile file("hashmap.image");
+        REQUIRE(file.size() == HashMapImage<uint64_t, Route>::ImageSize(1000));
+
+        HashMapImage<uint64_t, Route> image(file.data(), file.size());
+        REQUIRE(image.size() == 1000);
+        REQUIRE(image.bucket_count() == 2048);
+        REQUIRE(image.image_size() == file.size());
+        for (uint64_t i = 0; i < 1000; ++i)
+        {
+            REQUIRE(image.contains(i * 7));
+            REQUIRE(image.at(i * 7).gateway == i);
+            REQUIRE(image[i * 7].port == (i % 100));
+        }
+        REQUIRE(!image.contains(1));
+        REQUIRE(image.find(1) == image.end());
+        REQUIRE(image.count(7) == 1);
+        REQUIRE(image.value(1, Route{ 5, 5 }).gateway == 5);
+        REQUIRE_THROWS_AS(image.at(1), std::out_of_range);
+
+        size_t count = 0;
+        uint64_t sum = 0;
+        for (const auto& item : image)
+        {
+            ++count;
+            sum += item.second.gateway;
+        }
+        REQUIRE(count == 1000);
+        REQUIRE(sum == 999 * 1000 / 2);
+    }
+
+    // Load the image with a single bulk read
+    HashMapImage<uint64_t, Route> loaded = HashMapImage<uint64_t, Route>::Load("hashmap.image");
+    REQUIRE(loaded.size() == 1000);
+    REQUIRE(loaded.at(700).gateway == 100);
+
+    // Move the loaded image
+    HashMapImage<uint64_t, Route> moved(std::move(loaded));
+    REQUIRE(loaded.empty());
+    REQUIRE(!loaded.contains(700));
+    REQUIRE(loaded.begin() == loaded.end());
+    REQUIRE(moved.at(700).gateway == 100);
+
+    File::Remove("hashmap.image");
+}
+
+TEST_CASE("Hash map image build", "[CppCommon][Containers]")
+{
+    std::vector<std::pair<int, int>> items = { { 1, 10 }, { 2, 20 }, { 3, 30 } };
+
+    std::vector<uint64_t> buffer(HashMapImage<int, int>::ImageSize(items.size()) / sizeof(uint64_t) + 1);
+    size_t size = HashMapImage<int, int>::Build(items.begin(), items.end(), buffer.data(), buffer.size() * sizeof(uint64_t));
+    REQUIRE(size == HashMapImage<int, int>::ImageSize(3));
+
+    HashMapImage<int, int> image(buffer.data(), size);
+    REQUIRE(image.size() == 3);
+    REQUIRE(image.at(2) == 20);
+
+    // Empty images
+    HashMapImage<int, int> empty;
+    REQUIRE(empty.empty());
+    REQUIRE(!empty.contains(1));
+    size = HashMapImage<int, int>::Build(items.begin(), items.begin(), buffer.data(), buffer.size() * sizeof(uint64_t));
+    HashMapImage<int, int> built(buffer.data(), size);
+    REQUIRE(built.empty());
+    REQUIRE(!built.contains(1));
+
+    // Duplicate keys and small buffers are rejected
+    items.emplace_back(2, 40);
+    REQUIRE_THROWS_AS((HashMapImage<int, int>::Build(items.begin(), items.end(), buffer.data(), buffer.size() * sizeof(uint64_t))), std::invalid_argument);
+    REQUIRE_THROWS_AS((HashMapImage<int, int>::Build(items.begin(), items.end(), buffer.data(), 16)), std::invalid_argument);
+
+    // Partially built image is not valid
+    REQUIRE_THROWS_AS((HashMapImage<int, int>(buffer.data(), buffer.size() * sizeof(uint64_t))), std::invalid_argument);
+
+    // Images of other item types, other containers and truncated images are rejected
+    items.pop_back();
+    size = HashMapImage<int, int>::Build(items.begin(), items.end(), buffer.data(), buffer.size() * sizeof(uint64_t));
+    REQUIRE_THROWS_AS((HashMapImage<int, uint64_t>(buffer.data(), size)), std::invalid_argument);
+    REQUIRE_THROWS_AS((FlatMapImage<int, int>(buffer.data(), size)), std::invalid_argument);
+    REQUIRE_THROWS_AS((HashMapImage<int, int>(buffer.data(), size - 1)), std::invalid_argument);
+}
+
+TEST_CASE("Flat map image", "[CppCommon][Containers]")
+{
+    FlatMap<int, double> flatmap;
+    for (int i = 0; i < 1000; ++i)
+        flatmap.emplace(i * 2, i * 0.5);
+
+    FlatMapImage<int, double>::Save("flatmap.image", flatmap);
+
+    // Query the memory-mapped image in place
+    {
+        MappedFile file("flatmap.image");
+        FlatMapImage<int, double> image(file.data(), file.size());
+        REQUIRE(image.size() == 1000);
+        REQUIRE(image.at(100) == 25.0);
+        REQUIRE(image[0] == 0.0);
+        REQUIRE(!image.contains(101));
+        REQUIRE(image.value(101, -1.0) == -1.0);
+        REQUIRE_THROWS_AS(image.at(101), std::out_of_range);
+
+        // Range queries in the key order
+        REQUIRE(image.lower_bound(101)->first == 102);
+        REQUIRE(image.upper_bound(102)->first == 104);
+        REQUIRE(image.lower_bound(5000) == image.end());
+        auto range = image.equal_range(10);
+        REQUIRE(std::distance(range.first, range.second) == 1);
+
+        int previous = -1;
+        for (const auto& item : image)
+        {
+            REQUIRE(item.first > previous);
+            previous = item.first;
+        }
+        REQUIRE(previous == 1998);
+    }
+
+    // Load the image with a single bulk read
+    FlatMapImage<int, double> loaded = FlatMapImage<int, double>::Load("flatmap.image");
+    REQUIRE(loaded.size() == 1000);
+    REQUIRE(loaded.at(1998) == 499.5);
+
+    FlatMapImage<int, double> moved;
+    moved = std::move(loaded);
+    REQUIRE(loaded.empty());
+    REQUIRE(moved.size() == 1000);
+
+    // Not sorted items are rejected
+    std::vector<std::pair<int, double>> items = { { 2, 1.0 }, { 1, 2.0 } };
+    std::vector<uint64_t> buffer(FlatMapImage<int, double>::ImageSize(items.size()) / sizeof(uint64_t));
+    REQUIRE_THROWS_AS((FlatMapImage<int, double>::Build(items.begin(), items.end(), buffer.data(), buffer.size() * sizeof(uint64_t))), std::invalid_argument);
+
+    File::Remove("flatmap.image");
+}
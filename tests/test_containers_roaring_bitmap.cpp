@@ -0,0 +1,228 @@
+//
+// Created by Ivan Shynkarenka on 15.10.2026
+//
+
+#include "test.h"
+
+#include "containers/roaring_bitmap.h"
+#include "filesystem/filesystem.h"
+#include "filesystem/mapped_file.h"
+
+#include <algorithm>
+#include <iterator>
+#include <set>
+#include <vector>
+
+using namespace CppCommon;
+
+namespace {
+
+RoaringBitmap RandomBitmap(std::set<uint64_t>& reference, uint64_t seed, uint64_t range, size_t count)
+{
+    RoaringBitmap result;
+    for (size_t i = 0; i < count; ++i)
+    {
+        seed = seed * 6364136223846793005ull + 1442695040888963407ull;
+        uint64_t value = (seed >> 20) % range;
+        REQUIRE(result.insert(value) == reference.insert(value).second);
+    }
+    return result;
+}
+
+bool Equal(const RoaringBitmap& bitmap, const std::set<uint64_t>& reference)
+{
+    return (bitmap.size() == reference.size()) && std::equal(bitmap.begin(), bitmap.end(), reference.begin(), reference.end());
+}
+
+} // namespace
+
+TEST_CASE("Roaring bitmap", "[CppCommon][Containers]")
+{
+    RoaringBitmap bitmap;
+    REQUIRE(bitmap.empty());
+    REQUIRE(!bitmap);
+    REQUIRE(bitmap.size() == 0);
+    REQUIRE(bitmap.begin() == bitmap.end());
+    REQUIRE(!bitmap.contains(0));
+
+    REQUIRE(bitmap.insert(5));
+    REQUIRE(!bitmap.insert(5));
+    REQUIRE(bitmap.insert(0x123456789ull));
+    REQUIRE(bitmap.insert(UINT64_MAX));
+    REQUIRE(bitmap.size() == 3);
+    REQUIRE(bitmap.containers() == 3);
+    REQUIRE(bitmap.min() == 5);
+    REQUIRE(bitmap.max() == UINT64_MAX);
+    REQUIRE(bitmap.contains(0x123456789ull));
+    REQUIRE(!bitmap.contains(0x123456788ull));
+
+    std::vector<uint64_t> values(bitmap.begin(), bitmap.end());
+    REQUIRE((values == std::vector<uint64_t>{ 5, 0x123456789ull, UINT64_MAX }));
+
+    REQUIRE(bitmap.erase(0x123456789ull));
+    REQUIRE(!bitmap.erase(0x123456789ull));
+    REQUIRE(bitmap.containers() == 2);
+
+    bitmap.clear();
+    REQUIRE(bitmap.empty());
+
+    RoaringBitmap list = { 3, 1, 2, 2 };
+    REQUIRE(list.size() == 3);
+    REQUIRE(list.min() == 1);
+    REQUIRE(list.max() == 3);
+}
+
+TEST_CASE("Roaring bitmap containers", "[CppCommon][Containers]")
+{
+    RoaringBitmap bitmap;
+
+    // Array container grows into the bitmap container
+    for (uint64_t i = 0; i < 2 * RoaringBitmap::ARRAY_MAX_SIZE; ++i)
+        REQUIRE(bitmap.insert(i * 8));
+    REQUIRE(bitmap.size() == 2 * RoaringBitmap::ARRAY_MAX_SIZE);
+    REQUIRE(bitmap.containers() == 1);
+    REQUIRE(bitmap.bytes() >= 8192);
+    size_t bytes = bitmap.bytes();
+    for (uint64_t i = 0; i < 65536; ++i)
+        REQUIRE(bitmap.contains(i) == ((i % 8) == 0));
+    REQUIRE(bitmap.max() == (2 * RoaringBitmap::ARRAY_MAX_SIZE - 1) * 8);
+
+    // Bitmap container shrinks into the array container
+    for (uint64_t i = 0; i < RoaringBitmap::ARRAY_MAX_SIZE + 1; ++i)
+        REQUIRE(bitmap.erase(i * 8));
+    REQUIRE(bitmap.bytes() < bytes);
+    REQUIRE(bitmap.min() == (RoaringBitmap::ARRAY_MAX_SIZE + 1) * 8);
+
+    // Consecutive values are compressed into runs
+    RoaringBitmap runs;
+    for (uint64_t i = 1000; i < 50000; ++i)
+        runs.insert(i);
+    for (uint64_t i = 100000; i < 100010; ++i)
+        runs.insert(i);
+    RoaringBitmap copy(runs);
+    bytes = runs.bytes();
+    REQUIRE(runs.optimize());
+    REQUIRE(!runs.optimize());
+    REQUIRE(runs.bytes() < bytes);
+    REQUIRE(runs == copy);
+    REQUIRE(runs.size() == 49010);
+    REQUIRE(runs.min() == 1000);
+    REQUIRE(runs.max() == 100009);
+    REQUIRE(runs.contains(1000));
+    REQUIRE(runs.contains(49999));
+    REQUIRE(!runs.contains(999));
+    REQUIRE(!runs.contains(50000));
+    REQUIRE(std::equal(runs.begin(), runs.end(), copy.begin(), copy.end()));
+
+    // Modified run containers are still correct
+    REQUIRE(runs.erase(2000));
+    REQUIRE(!runs.contains(2000));
+    REQUIRE(runs.insert(60000));
+    REQUIRE(runs.contains(60000));
+    REQUIRE(runs.size() == 49010);
+}
+
+TEST_CASE("Roaring bitmap operations", "[CppCommon][Containers]")
+{
+    const uint64_t ranges[] = { 100000, 1000000, 1ull << 40 };
+    for (uint64_t range : ranges)
+    {
+        std::set<uint64_t> reference1, reference2;
+        RoaringBitmap bitmap1 = RandomBitmap(reference1, 1, range, 50000);
+        RoaringBitmap bitmap2 = RandomBitmap(reference2, 2, range, 30000);
+        REQUIRE(Equal(bitmap1, reference1));
+        REQUIRE(Equal(bitmap2, reference2));
+
+        // Check mixed container types as well
+        for (int optimize = 0; optimize < 2; ++optimize)
+        {
+            if (optimize)
+            {
+                bitmap1.optimize();
+                RoaringBitmap dense;
+                for (uint64_t i = 0; i < 200000; ++i)
+                    if (reference2.insert(i).second)
+                        dense.insert(i);
+                bitmap2 |= dense;
+                bitmap2.optimize();
+                REQUIRE(Equal(bitmap2, reference2));
+            }
+
+            std::set<uint64_t> expected;
+            std::set_intersection(reference1.begin(), reference1.end(), reference2.begin(), reference2.end(), std::inserter(expected, expected.end()));
+            REQUIRE(Equal(bitmap1 & bitmap2, expected));
+
+            expected.clear();
+            std::set_union(reference1.begin(), reference1.end(), reference2.begin(), reference2.end(), std::inserter(expected, expected.end()));
+            REQUIRE(Equal(bitmap1 | bitmap2, expected));
+
+            expected.clear();
+            std::set_difference(reference1.begin(), reference1.end(), reference2.begin(), reference2.end(), std::inserter(expected, expected.end()));
+            REQUIRE(Equal(bitmap1 - bitmap2, expected));
+
+            expected.clear();
+            std::set_difference(reference2.begin(), reference2.end(), reference1.begin(), reference1.end(), std::inserter(expected, expected.end()));
+            RoaringBitmap difference(bitmap2);
+            difference -= bitmap1;
+            REQUIRE(Equal(difference, expected));
+        }
+    }
+
+    RoaringBitmap bitmap = { 1, 2, 3 };
+    RoaringBitmap empty;
+    REQUIRE((bitmap & empty).empty());
+    REQUIRE((bitmap | empty) == bitmap);
+    REQUIRE((bitmap - empty) == bitmap);
+    REQUIRE((bitmap - bitmap).empty());
+    REQUIRE(bitmap != empty);
+}
+
+TEST_CASE("Roaring bitmap serialization", "[CppCommon][Containers]")
+{
+    std::set<uint64_t> reference;
+    RoaringBitmap bitmap = RandomBitmap(reference, 3, 1000000, 100000);
+    for (uint64_t i = 2000000; i < 2100000; ++i)
+    {
+        bitmap.insert(i);
+        reference.insert(i);
+    }
+    bitmap.optimize();
+
+    std::vector<uint8_t> buffer = bitmap.Serialize();
+
+    RoaringBitmap restored;
+    REQUIRE(RoaringBitmap::Deserialize(buffer, restored) == buffer.size());
+    REQUIRE(restored == bitmap);
+    REQUIRE(Equal(restored, reference));
+
+    // Truncated or malformed buffers are rejected
+    REQUIRE(RoaringBitmap::Deserialize(std::span<const uint8_t>(buffer.data(), buffer.size() - 1), restored) == 0);
+    REQUIRE(RoaringBitmap::Deserialize(std::span<const uint8_t>(buffer.data(), 10), restored) == 0);
+    std::vector<uint8_t> malformed(buffer);
+    malformed[0] = 'X';
+    REQUIRE(RoaringBitmap::Deserialize(malformed, restored) == 0);
+    malformed = buffer;
+    malformed[24 + 8] = 7;
+    REQUIRE(RoaringBitmap::Deserialize(malformed, restored) == 0);
+    REQUIRE(restored == bitmap);
+
+    // Serialize into the file and load it with the memory-mapped file
+    {
+        File file("roaring.tmp");
+        file.Create(false, true);
+        bitmap.Serialize(file);
+        file.Close();
+    }
+    {
+        MappedFile file("roaring.tmp");
+        RoaringBitmap mapped;
+        REQUIRE(RoaringBitmap::Deserialize(file.bytes(), mapped) == file.size());
+        REQUIRE(mapped == bitmap);
+    }
+    File::Remove("roaring.tmp");
+
+    RoaringBitmap empty;
+    buffer = empty.Serialize();
+    REQUIRE(RoaringBitmap::Deserialize(buffer, restored) == buffer.size());
+    REQUIRE(restored.empty());
+}
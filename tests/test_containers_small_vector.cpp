@@ -0,0 +1,151 @@
+//
+// Created by Ivan Shynkarenka on 15.10.2026
+//
+
+#include "test.h"
+
+#include "containers/inplace_vector.h"
+#include "containers/small_vector.h"
+#include "memory/allocator_arena.h"
+
+#include <string>
+
+using namespace CppCommon;
+
+TEST_CASE("Small vector", "[CppCommon][Containers]")
+{
+    SmallVector<int, 4> vector;
+    REQUIRE(vector.empty());
+    REQUIRE(vector.size() == 0);
+    REQUIRE(vector.capacity() == 4);
+    REQUIRE(vector.inlined());
+
+    for (int i = 0; i < 4; ++i)
+        vector.push_back(i);
+    REQUIRE(vector.size() == 4);
+    REQUIRE(vector.inlined());
+
+    vector.push_back(4);
+    REQUIRE(vector.size() == 5);
+    REQUIRE(!vector.inlined());
+    REQUIRE(vector.capacity() >= 5);
+    for (int i = 0; i < 5; ++i)
+        REQUIRE(vector[i] == i);
+
+    vector.insert(vector.begin(), -1);
+    REQUIRE(vector.front() == -1);
+    REQUIRE(vector.back() == 4);
+    vector.erase(vector.begin());
+    REQUIRE(vector.front() == 0);
+
+    vector.insert(vector.begin() + 2, { 10, 11 });
+    REQUIRE(vector == SmallVector<int, 4>({ 0, 1, 10, 11, 2, 3, 4 }));
+    vector.erase(vector.begin() + 2, vector.begin() + 4);
+    REQUIRE(vector == SmallVector<int, 8>({ 0, 1, 2, 3, 4 }));
+
+    vector.resize(3);
+    vector.shrink_to_fit();
+    REQUIRE(vector.size() == 3);
+    REQUIRE(vector.inlined());
+    REQUIRE(vector == SmallVector<int, 4>({ 0, 1, 2 }));
+
+    REQUIRE_THROWS_AS(vector.at(3), std::out_of_range);
+    vector.clear();
+    REQUIRE(vector.empty());
+}
+
+TEST_CASE("Small vector copy and move", "[CppCommon][Containers]")
+{
+    SmallVector<std::string, 2> inlined({ "a", "b" });
+    SmallVector<std::string, 2> allocated({ "a", "b", "c", "d" });
+
+    SmallVector<std::string, 2> copy1(inlined);
+    SmallVector<std::string, 2> copy2(allocated);
+    REQUIRE(copy1 == inlined);
+    REQUIRE(copy2 == allocated);
+
+    const std::string* data = allocated.data();
+    SmallVector<std::string, 2> moved1(std::move(inlined));
+    SmallVector<std::string, 2> moved2(std::move(allocated));
+    REQUIRE(moved1.inlined());
+    REQUIRE(moved1.size() == 2);
+    REQUIRE(moved2.data() == data);
+    REQUIRE(moved2.size() == 4);
+    REQUIRE(inlined.empty());
+    REQUIRE(allocated.empty());
+
+    moved1.swap(moved2);
+    REQUIRE(moved1.size() == 4);
+    REQUIRE(moved2.size() == 2);
+    REQUIRE(moved1[3] == "d");
+    REQUIRE(moved2[1] == "b");
+
+    moved1 = moved2;
+    REQUIRE(moved1 == moved2);
+    REQUIRE(moved1 < copy2);
+
+    // Push back the item of the vector itself during the growth
+    SmallVector<std::string, 2> self({ "x", "y" });
+    self.push_back(self[0]);
+    REQUIRE(self.size() == 3);
+    REQUIRE(self[2] == "x");
+}
+
+TEST_CASE("Small vector with arena allocator", "[CppCommon][Containers]")
+{
+    DefaultMemoryManager auxiliary;
+    ArenaMemoryManager<DefaultMemoryManager> manager(auxiliary);
+    ArenaAllocator<int, DefaultMemoryManager> allocator(manager);
+
+    SmallVector<int, 8, decltype(allocator)> vector(allocator);
+    for (int i = 0; i < 8; ++i)
+        vector.push_back(i);
+    REQUIRE(vector.inlined());
+    REQUIRE(manager.allocations() == 0);
+
+    for (int i = 8; i < 100; ++i)
+        vector.push_back(i);
+    REQUIRE(!vector.inlined());
+    REQUIRE(manager.allocations() > 0);
+    for (int i = 0; i < 100; ++i)
+        REQUIRE(vector[i] == i);
+}
+
+TEST_CASE("Inplace vector", "[CppCommon][Containers]")
+{
+    InplaceVector<int, 4> vector;
+    REQUIRE(vector.empty());
+    REQUIRE(vector.capacity() == 4);
+    REQUIRE(std::is_trivially_copyable_v<InplaceVector<int, 4>>);
+    REQUIRE(!std::is_trivially_copyable_v<InplaceVector<std::string, 4>>);
+
+    vector.push_back(1);
+    vector.push_back(3);
+    vector.insert(vector.begin() + 1, 2);
+    vector.emplace_back(4);
+    REQUIRE(vector.full());
+    REQUIRE(vector == InplaceVector<int, 8>({ 1, 2, 3, 4 }));
+
+    REQUIRE_THROWS_AS(vector.push_back(5), std::length_error);
+    REQUIRE(vector.try_push_back(5) == nullptr);
+    REQUIRE(vector.size() == 4);
+
+    InplaceVector<int, 4> copy(vector);
+    REQUIRE(copy == vector);
+
+    vector.erase(vector.begin());
+    REQUIRE(vector.front() == 2);
+    REQUIRE(!(copy > vector));
+    REQUIRE(vector.try_push_back(5) != nullptr);
+    REQUIRE(vector.back() == 5);
+
+    REQUIRE_THROWS_AS((InplaceVector<int, 2>({ 1, 2, 3 })), std::length_error);
+
+    InplaceVector<std::string, 3> strings({ "a", "b" });
+    InplaceVector<std::string, 3> moved(std::move(strings));
+    REQUIRE(strings.empty());
+    REQUIRE(moved.size() == 2);
+    REQUIRE(moved[1] == "b");
+    moved.pop_back();
+    REQUIRE(moved.size() == 1);
+}
@@ -0,0 +1,83 @@
+//
+// Created by Ivan Shynkarenka on 15.10.2026
+//
+
+#include "test.h"
+
+#include "containers/static_map.h"
+
+#include <string>
+
+using namespace CppCommon;
+
+namespace {
+
+enum class Color { Red, Green, Blue, Black, White };
+
+constexpr auto methods = MakeStaticMap<std::string_view, int>({
+    { "GET", 1 }, { "HEAD", 2 }, { "POST", 3 }, { "PUT", 4 }, { "DELETE", 5 },
+    { "CONNECT", 6 }, { "OPTIONS", 7 }, { "TRACE", 8 }, { "PATCH", 9 }
+});
+
+constexpr auto colors = MakeStaticMap<Color, std::string_view>({
+    { Color::Red, "red" }, { Color::Green, "green" }, { Color::Blue, "blue" }, { Color::Black, "black" }, { Color::White, "white" }
+});
+
+constexpr std::array<std::pair<int, int>, 500> Squares()
+{
+    std::array<std::pair<int, int>, 500> result{};
+    for (int i = 0; i < 500; ++i)
+        result[i] = { i * 7, i * i };
+    return result;
+}
+
+constexpr StaticMap<int, int, 500> squares(Squares());
+
+} // namespace
+
+// Lookups are available at compile time
+static_assert(methods.at("POST") == 3);
+static_assert(!methods.contains("GETS"));
+static_assert(colors.at(Color::Blue) == "blue");
+static_assert(squares.at(7 * 499) == 499 * 499);
+
+TEST_CASE("Static map", "[CppCommon][Containers]")
+{
+    REQUIRE(methods.size() == 9);
+    REQUIRE(!methods.empty());
+    REQUIRE(methods["GET"] == 1);
+    REQUIRE(methods.at(std::string("PATCH")) == 9);
+    REQUIRE(methods.find("get") == methods.end());
+    REQUIRE(methods.count("TRACE") == 1);
+    REQUIRE(methods.value("UNKNOWN", -1) == -1);
+    REQUIRE_THROWS_AS(methods.at("UNKNOWN"), std::out_of_range);
+
+    int sum = 0;
+    for (const auto& item : methods)
+        sum += item.second;
+    REQUIRE(sum == 45);
+
+    REQUIRE(colors.size() == 5);
+    REQUIRE(colors.at(Color::Black) == "black");
+
+    for (int i = 0; i < 500; ++i)
+    {
+        REQUIRE(squares.at(i * 7) == (i * i));
+        if ((i % 7) != 0)
+            REQUIRE(!squares.contains(i));
+    }
+}
+
+TEST_CASE("Static map runtime build", "[CppCommon][Containers]")
+{
+    std::pair<std::string_view, int> items[] = { { "one", 1 }, { "two", 2 }, { "three", 3 } };
+    StaticMap<std::string_view, int, 3> numbers(items);
+    REQUIRE(numbers.at("two") == 2);
+
+    std::pair<std::string_view, int> duplicates[] = { { "one", 1 }, { "two", 2 }, { "one", 3 } };
+    REQUIRE_THROWS_AS((StaticMap<std::string_view, int, 3>(duplicates)), std::invalid_argument);
+
+    StaticMap<int, int, 0> empty(std::array<std::pair<int, int>, 0>{});
+    REQUIRE(empty.empty());
+    REQUIRE(!empty.contains(0));
+}
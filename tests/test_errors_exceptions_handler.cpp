@@ -0,0 +1,88 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "test.h"
+
+#include "errors/exceptions_handler.h"
+#include "filesystem/directory.h"
+#include "filesystem/file.h"
+
+#include <limits>
+
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+#include <csignal>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+using namespace CppCommon;
+
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+
+namespace {
+
+// Recursion limit is opaque to the compiler, so the deliberate stack overflow is not diagnosed
+volatile int overflow_limit = std::numeric_limits<int>::max();
+
+int Overflow(int depth)
+{
+    volatile char buffer[1024];
+    buffer[0] = (char)depth;
+    if (depth >= overflow_limit)
+        return buffer[0];
+    return Overflow(depth + 1) + buffer[0];
+}
+
+std::string Crash(const Path& directory, bool overflow)
+{
+    pid_t pid = fork();
+    REQUIRE(pid >= 0);
+    if (pid == 0)
+    {
+        // Crash the child process in emergency mode
+        ExceptionsHandler::SetupEmergency(directory);
+        ExceptionsHandler::SetupProcess();
+        if (overflow)
+            Overflow(0);
+        else
+            raise(SIGSEGV);
+        _exit(0);
+    }
+
+    int status;
+    REQUIRE(waitpid(pid, &status, 0) == pid);
+    REQUIRE(WIFSIGNALED(status));
+    REQUIRE(WTERMSIG(status) == SIGSEGV);
+
+    auto files = Directory(directory).GetFiles();
+    REQUIRE(files.size() == 1);
+    std::string report = File::ReadAllText(files[0]);
+    File::Remove(files[0]);
+    return report;
+}
+
+} // namespace
+
+TEST_CASE("Exceptions handler emergency mode", "[CppCommon][Errors]")
+{
+    Path directory = Directory::CreateTree(Path::temp() / Path::unique());
+
+    // Crash report of the raised signal
+    std::string report = Crash(directory, false);
+    REQUIRE(report.find("*** Crash report ***") != std::string::npos);
+    REQUIRE(report.find("(SIGSEGV) signal (11)") != std::string::npos);
+    REQUIRE(report.find("Stack trace:\n0x") != std::string::npos);
+#if defined(__linux__)
+    REQUIRE(report.find("Modules:\n") != std::string::npos);
+#endif
+
+    // Crash report of the stack overflow from the alternate signal stack
+    report = Crash(directory, true);
+    REQUIRE(report.find("(SIGSEGV) signal (11)") != std::string::npos);
+    REQUIRE(report.find("Stack trace:\n0x") != std::string::npos);
+
+    Directory::Remove(directory);
+}
+
+#endif
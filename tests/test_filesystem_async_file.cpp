@@ -0,0 +1,124 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "test.h"
+
+#include "filesystem/async_file.h"
+#include "filesystem/filesystem.h"
+
+#include <vector>
+
+using namespace CppCommon;
+
+namespace {
+
+void TestAsyncFile(AsyncFileBackend backend)
+{
+    const size_t blocks = 64;
+    const size_t block = 4096;
+
+    std::vector<uint8_t> buffer(blocks * block);
+    for (size_t i = 0; i < buffer.size(); ++i)
+        buffer[i] = (uint8_t)(i % 251);
+
+    AsyncFile file("async.tmp", 16, backend);
+    REQUIRE(file.depth() == 16);
+    REQUIRE(!file.IsFileOpened());
+    file.OpenOrCreate(true, true, true);
+    REQUIRE(file.IsFileOpened());
+    REQUIRE(file.backend() != AsyncFileBackend::AUTO);
+
+    // Write blocks in the reverse order keeping the queue depth
+    size_t written = 0;
+    size_t completed = 0;
+    for (size_t i = blocks; i-- > 0;)
+    {
+        while (!file.WriteAsync(i * block, buffer.data() + i * block, block, [&written, &completed](const AsyncFileResult& result)
+        {
+            REQUIRE(result);
+            REQUIRE(result.operation == AsyncFileOperation::WRITE);
+            written += result.size;
+            ++completed;
+        }))
+        {
+            REQUIRE(file.pending() == file.depth());
+            file.Wait();
+        }
+    }
+    REQUIRE(file.queued() > 0);
+    REQUIRE(file.Submit() > 0);
+    REQUIRE(file.queued() == 0);
+
+    // Flush all written blocks
+    if (file.pending() == file.depth())
+        file.Wait();
+    bool flushed = false;
+    REQUIRE(file.FlushAsync([&flushed](const AsyncFileResult& result)
+    {
+        REQUIRE(result);
+        REQUIRE(result.operation == AsyncFileOperation::FLUSH);
+        flushed = true;
+    }));
+    file.WaitAll();
+    REQUIRE(file.pending() == 0);
+    REQUIRE(flushed);
+    REQUIRE(completed == blocks);
+    REQUIRE(written == buffer.size());
+
+    // Read blocks back, the last read reaches the end of the file
+    std::vector<uint8_t> read(blocks * block + block, 0);
+    size_t eof = 0;
+    for (size_t i = 0; i <= blocks; ++i)
+    {
+        REQUIRE(file.ReadAsync(i * block, read.data() + i * block, block, [&eof, i](const AsyncFileResult& result)
+        {
+            REQUIRE(result);
+            REQUIRE(result.offset == i * block);
+            if (result.size < block)
+                ++eof;
+        }));
+        if (file.pending() == file.depth())
+            file.Wait(file.depth() / 2);
+    }
+    file.WaitAll();
+    REQUIRE(eof == 1);
+    REQUIRE(std::equal(buffer.begin(), buffer.end(), read.begin()));
+
+    // Callbacks could queue new operations
+    size_t chain = 0;
+    std::function<void(const AsyncFileResult&)> next;
+    next = [&file, &chain, &read, &next](const AsyncFileResult& result)
+    {
+        REQUIRE(result);
+        if (++chain < 8)
+            REQUIRE(file.ReadAsync(chain * block, read.data(), block, [&next](const AsyncFileResult& r) { next(r); }));
+    };
+    REQUIRE(file.ReadAsync(0, read.data(), block, [&next](const AsyncFileResult& r) { next(r); }));
+    file.Close();
+    REQUIRE(chain == 8);
+    REQUIRE(!file.IsFileOpened());
+
+    // Read from the write only file fails
+    file.Open(false, true);
+    int error = 0;
+    REQUIRE(file.ReadAsync(0, read.data(), block, [&error](const AsyncFileResult& result) { error = result.error; }));
+    file.WaitAll();
+    REQUIRE(error != 0);
+    file.Close();
+
+    REQUIRE(File("async.tmp").size() == buffer.size());
+    File::Remove("async.tmp");
+}
+
+} // namespace
+
+TEST_CASE("Asynchronous file", "[CppCommon][FileSystem]")
+{
+    TestAsyncFile(AsyncFileBackend::AUTO);
+    TestAsyncFile(AsyncFileBackend::THREAD);
+
+    // Missing files are not opened
+    AsyncFile file("missing.tmp");
+    REQUIRE_THROWS_AS(file.Open(true, false), FileSystemException);
+}
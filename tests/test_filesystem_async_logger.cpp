@@ -0,0 +1,192 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "test.h"
+
+#include "filesystem/filesystem.h"
+
+#include <cinttypes>
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace CppCommon;
+
+namespace {
+
+// Get the log line message after the timestamp, thread Id and level
+std::string Message(const std::string& line)
+{
+    size_t thread = line.find("] ");
+    return (thread != std::string::npos) ? line.substr(thread + 8) : line;
+}
+
+} // namespace
+
+TEST_CASE("Asynchronous logger", "[CppCommon][FileSystem]")
+{
+    Path path("async_logger.tmp");
+    {
+        AsyncLogger logger(path);
+        REQUIRE(logger.path() == path);
+        REQUIRE(logger.level() == LogLevel::DEBUG);
+
+        logger.Info("no arguments");
+        logger.Debug("{} {} {} {}", 1, -2.5, 'c', true);
+        std::string str = "string";
+        logger.Warn("{}, {}, {}", str, std::string_view("view"), "literal");
+        logger.Error("{:>6}|{:<6}|{:x}", 42, "left", 255U);
+        logger.SetLevel(LogLevel::WARN);
+        REQUIRE(!logger.IsEnabled(LogLevel::INFO));
+        logger.Info("skipped");
+        logger.Fatal("fatal {}", std::string(100, 'x'));
+        str = "changed";
+        logger.Flush();
+        REQUIRE(logger.logged() == 5);
+        REQUIRE(logger.dropped() == 0);
+    }
+
+    std::vector<std::string> lines = File::ReadAllLines(path);
+    REQUIRE(lines.size() == 5);
+    REQUIRE(lines[0].find(" INFO  ") != std::string::npos);
+    REQUIRE(Message(lines[0]) == "no arguments");
+    REQUIRE(lines[1].find(" DEBUG ") != std::string::npos);
+    REQUIRE(Message(lines[1]) == "1 -2.5 c true");
+    REQUIRE(Message(lines[2]) == "string, view, literal");
+    REQUIRE(Message(lines[3]) == "    42|left  |ff");
+    REQUIRE(lines[4].find(" FATAL ") != std::string::npos);
+    REQUIRE(Message(lines[4]) == "fatal " + std::string(100, 'x'));
+
+    // Log file is appended
+    {
+        AsyncLogger logger(path);
+        logger.Info("appended");
+    }
+    lines = File::ReadAllLines(path);
+    REQUIRE(lines.size() == 6);
+    REQUIRE(Message(lines[5]) == "appended");
+
+    File::Remove(path);
+}
+
+TEST_CASE("Asynchronous logger with multiple threads", "[CppCommon][FileSystem]")
+{
+    Path path("async_logger.tmp");
+    {
+        AsyncLogger logger(path, 0, 0, 1024 * 1024);
+
+        const size_t threads = 4;
+        const size_t messages = 10000;
+
+        std::vector<std::thread> workers;
+        for (size_t thread = 0; thread < threads; ++thread)
+        {
+            workers.emplace_back([&logger, thread]()
+            {
+                for (size_t i = 0; i < messages; ++i)
+                {
+                    logger.Info("thread {} message {}", thread, i);
+
+                    // Give the background thread a chance to drain small ring buffers
+                    if ((i % 1000) == 0)
+                        std::this_thread::yield();
+                }
+            });
+        }
+        for (auto& worker : workers)
+            worker.join();
+
+        logger.Flush();
+        REQUIRE((logger.logged() + logger.dropped()) == threads * messages);
+    }
+
+    // Messages of each thread keep their order and timestamps are not decreasing
+    std::vector<std::string> lines = File::ReadAllLines(path);
+    std::vector<int64_t> last(4, -1);
+    for (const auto& line : lines)
+    {
+        if (line.find("messages were dropped") != std::string::npos)
+            continue;
+        size_t thread;
+        int64_t index;
+        REQUIRE(std::sscanf(Message(line).c_str(), "thread %zu message %" SCNd64, &thread, &index) == 2);
+        REQUIRE(thread < last.size());
+        REQUIRE(index > last[thread]);
+        last[thread] = index;
+    }
+
+    File::Remove(path);
+}
+
+TEST_CASE("Asynchronous logger dropped messages", "[CppCommon][FileSystem]")
+{
+    Path path("async_logger.tmp");
+    {
+        // Small ring buffer could not hold huge messages
+        AsyncLogger logger(path, 0, 0, 1024);
+        logger.Info("{}", std::string(1000, 'x'));
+        logger.Info("small");
+        logger.Flush();
+        REQUIRE(logger.logged() == 1);
+        REQUIRE(logger.dropped() == 1);
+    }
+
+    std::vector<std::string> lines = File::ReadAllLines(path);
+    REQUIRE(lines.size() == 2);
+    REQUIRE(Message(lines[0]) == "small");
+    REQUIRE(lines[1].find(" WARN  ") != std::string::npos);
+    REQUIRE(Message(lines[1]) == "1 messages were dropped");
+
+    File::Remove(path);
+}
+
+TEST_CASE("Asynchronous logger flush", "[CppCommon][FileSystem]")
+{
+    Path path("async_logger.tmp");
+    {
+        // Flush waits for messages of more than one background drain pass
+        AsyncLogger logger(path, 0, 0, 64 * 1024 * 1024);
+        const size_t messages = 100000;
+        for (size_t i = 0; i < messages; ++i)
+            logger.Info("message {}", i);
+        logger.Flush();
+        REQUIRE(logger.logged() == messages);
+        REQUIRE(logger.dropped() == 0);
+    }
+
+    File::Remove(path);
+}
+
+TEST_CASE("Asynchronous logger rotation", "[CppCommon][FileSystem]")
+{
+    Path path("async_logger.tmp");
+    {
+        AsyncLogger logger(path, 1000, 2);
+        for (size_t i = 0; i < 100; ++i)
+        {
+            logger.Info("message {}", i);
+            logger.Flush();
+        }
+    }
+
+    REQUIRE(path.IsExists());
+    REQUIRE(Path("async_logger.tmp.1").IsExists());
+    REQUIRE(Path("async_logger.tmp.2").IsExists());
+    REQUIRE(!Path("async_logger.tmp.3").IsExists());
+    REQUIRE(File(path).size() <= 1000);
+    REQUIRE(File("async_logger.tmp.1").size() <= 1000);
+
+    // The last messages are in the current log file and the newest backups
+    std::vector<std::string> lines = File::ReadAllLines(path);
+    REQUIRE(!lines.empty());
+    REQUIRE(Message(lines.back()) == "message 99");
+    std::vector<std::string> backup = File::ReadAllLines("async_logger.tmp.1");
+    REQUIRE(!backup.empty());
+    REQUIRE(Message(backup.back()) == fmt::format("message {}", 99 - lines.size()));
+
+    File::Remove(path);
+    File::Remove("async_logger.tmp.1");
+    File::Remove("async_logger.tmp.2");
+}
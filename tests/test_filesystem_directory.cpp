@@ -102,3 +102,50 @@ TEST_CASE("Directory iterator", "[CppCommon][FileSystem]")
     // Remove complex directory structure
     REQUIRE(Directory::RemoveAll(test) == Path::current());
 }
+
+TEST_CASE("Directory entries", "[CppCommon][FileSystem]")
+{
+    std::string text("test");
+
+    Directory test = Directory::Create(Path::current() / "test");
+    File testtmp = test / "test.tmp";
+    REQUIRE(File::WriteAllText(testtmp, text) == text.size());
+    Directory test1 = Directory::Create(test / "test1");
+    Symlink test2 = Symlink::CreateSymlink(testtmp, test / "test2.tmp");
+
+    // Check cached entries types and status are the same as the path ones
+    size_t count = 0;
+    for (const auto& entry : test)
+    {
+        ++count;
+        REQUIRE(entry.type() == Path(entry).type());
+        REQUIRE(entry.IsExists());
+        if (entry.IsRegularFile())
+        {
+            REQUIRE(entry == testtmp);
+            REQUIRE(entry.size() == text.size());
+            REQUIRE(entry.modified() == entry.Path::modified());
+        }
+        else if (entry.IsDirectory())
+            REQUIRE(entry == test1);
+        else if (entry.IsSymlink())
+        {
+            REQUIRE(entry == test2);
+            REQUIRE(entry.size() == text.size());
+        }
+        else
+            FAIL("Unexpected directory entry type!");
+    }
+    REQUIRE(count == 3);
+
+    // Check cached status is updated on refresh
+    DirectoryEntry entry(testtmp);
+    REQUIRE(entry.IsRegularFile());
+    REQUIRE(entry.size() == text.size());
+    REQUIRE(File::WriteAllText(testtmp, text + text) == 2 * text.size());
+    REQUIRE(entry.size() == text.size());
+    entry.Refresh();
+    REQUIRE(entry.size() == 2 * text.size());
+
+    REQUIRE(Directory::RemoveAll(test) == Path::current());
+}
@@ -0,0 +1,111 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "test.h"
+
+#include "filesystem/filesystem.h"
+
+#include <algorithm>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace CppCommon;
+
+namespace {
+
+// Create the directory tree with the given fanout and depth
+size_t CreateTree(const Path& path, int fanout, int depth)
+{
+    size_t count = 0;
+    for (int i = 0; i < fanout; ++i)
+    {
+        File::WriteAllText(path / ("file" + std::to_string(i) + ".txt"), "test");
+        ++count;
+        if (depth > 0)
+        {
+            Directory child = Directory::Create(path / ("dir" + std::to_string(i)));
+            count += 1 + CreateTree(child, fanout, depth - 1);
+        }
+    }
+    return count;
+}
+
+} // namespace
+
+TEST_CASE("Directory walker", "[CppCommon][FileSystem]")
+{
+    Directory test = Directory::Create(Path::current() / "walker");
+    size_t count = CreateTree(test, 3, 3);
+    Symlink::CreateSymlink(test / "dir0", test / "link0");
+    ++count;
+
+    for (size_t threads : { 1, 4 })
+    {
+        DirectoryWalker walker(threads);
+        REQUIRE(walker.threads() == threads);
+
+        std::mutex mutex;
+        std::set<std::string> entered;
+        std::vector<std::string> left;
+        size_t files = 0;
+        size_t symlinks = 0;
+        uint64_t entries = walker.Walk(test, [&](const Path& path, FileType type)
+        {
+            std::scoped_lock locker(mutex);
+            entered.insert(path.string());
+            if (type == FileType::REGULAR)
+                ++files;
+            else if (type == FileType::SYMLINK)
+                ++symlinks;
+            return true;
+        },
+        [&](const Path& path)
+        {
+            std::scoped_lock locker(mutex);
+            // Directory is left after all its sub-directories
+            for (const auto& other : left)
+                REQUIRE(path.string().find(other + Path::separator()) != 0);
+            left.push_back(path.string());
+        });
+
+        // Symbolic links are reported, but not followed
+        REQUIRE(entries == count);
+        REQUIRE(entered.size() == count);
+        REQUIRE(files == 3 + 9 + 27 + 81);
+        REQUIRE(symlinks == 1);
+        REQUIRE(left.size() == 3 + 9 + 27);
+        for (const auto& path : left)
+            REQUIRE(entered.count(path) == 1);
+        REQUIRE(std::find(left.begin(), left.end(), test.string()) == left.end());
+    }
+
+    // Skip the content of directories
+    DirectoryWalker walker(2);
+    REQUIRE(walker.Walk(test, [](const Path&, FileType) { return false; }) == 7);
+
+    // Exceptions are rethrown from the walk
+    REQUIRE_THROWS_AS(walker.Walk(test, [](const Path&, FileType) -> bool { throw std::runtime_error("test"); }), std::runtime_error);
+    REQUIRE_THROWS_AS(walker.Walk(test / "missing", [](const Path&, FileType) { return true; }), FileSystemException);
+
+    // Copy and remove the tree with several threads
+    Path copy = Path::CopyAll(test, Path::current() / "walker-copy", false, 4);
+    REQUIRE(copy.IsDirectory());
+    REQUIRE(File::ReadAllText(copy / "dir2" / "dir1" / "dir0" / "file2.txt") == "test");
+    REQUIRE((copy / "link0").IsSymlink());
+    REQUIRE(DirectoryWalker(1).Walk(copy, [](const Path&, FileType) { return true; }) == count);
+    REQUIRE(Path::RemoveAll(copy, 4) == Path::current());
+    REQUIRE(!copy.IsExists());
+
+    // Removing the tree keeps the target of the directory symlink
+    Directory outside = Directory::Create(Path::current() / "walker-outside");
+    File::WriteAllText(outside / "keep.txt", "keep");
+    Symlink::CreateSymlink(outside, test / "outside");
+    REQUIRE(Path::RemoveAll(test, 4) == Path::current());
+    REQUIRE(!test.IsExists());
+    REQUIRE(File::ReadAllText(outside / "keep.txt") == "keep");
+    REQUIRE(Path::RemoveAll(outside) == Path::current());
+}
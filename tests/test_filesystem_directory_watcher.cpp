@@ -0,0 +1,44 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "test.h"
+
+#include "filesystem/filesystem.h"
+#include "threads/thread.h"
+
+using namespace CppCommon;
+
+#if defined(__linux__) || defined(_WIN32) || defined(_WIN64)
+TEST_CASE("Directory watcher", "[CppCommon][FileSystem]")
+{
+    Directory test = Directory::CreateTree(Path::current() / "test_watcher" / "sub");
+
+    DirectoryWatcher watcher;
+    watcher.Watch(test.parent());
+    REQUIRE(watcher.Poll().empty());
+
+    File::WriteAllText(test / "a.txt", "test");
+    File::Rename(test / "a.txt", test.parent() / "b.txt");
+
+    // Filesystem change notifications are asynchronous on some platforms
+    std::vector<DirectoryEvent> events;
+    for (int i = 0; (i < 100) && (events.size() < 3); ++i)
+    {
+        auto polled = watcher.Poll();
+        events.insert(events.end(), polled.begin(), polled.end());
+        Thread::SleepFor(Timespan::milliseconds(10));
+    }
+
+    REQUIRE(std::find_if(events.begin(), events.end(), [&test](const DirectoryEvent& event) { return (event.change == DirectoryChange::MODIFIED) && (event.path == (test / "a.txt")); }) != events.end());
+    REQUIRE(std::find_if(events.begin(), events.end(), [&test](const DirectoryEvent& event) { return (event.change == DirectoryChange::REMOVED) && (event.path == (test / "a.txt")); }) != events.end());
+    REQUIRE(std::find_if(events.begin(), events.end(), [&test](const DirectoryEvent& event) { return (event.change == DirectoryChange::MODIFIED) && (event.path == (test.parent() / "b.txt")); }) != events.end());
+    for (const auto& event : events)
+        REQUIRE(event.root == test.parent());
+
+    REQUIRE(watcher.Unwatch(test.parent()));
+    REQUIRE(!watcher.Unwatch(test.parent()));
+
+    Directory::RemoveAll(test.parent());
+}
+#endif
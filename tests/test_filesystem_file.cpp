@@ -7,6 +7,9 @@
 #include "filesystem/filesystem.h"
 #include "utility/countof.h"
 
+#include <atomic>
+#include <thread>
+
 using namespace CppCommon;
 
 TEST_CASE("File common", "[CppCommon][FileSystem]")
@@ -120,3 +123,217 @@ TEST_CASE("File read/write static methods", "[CppCommon][FileSystem]")
     REQUIRE(File::ReadAllText("test.tmp") == text);
     File::Remove("test.tmp");
 }
+
+TEST_CASE("File positional and vectored I/O", "[CppCommon][FileSystem]")
+{
+    std::string header("HEAD");
+    std::string payload("payload");
+
+    for (size_t buffer : { File::DEFAULT_BUFFER, (size_t)0 })
+    {
+        File test("test.tmp");
+        test.Create(true, true, File::DEFAULT_ATTRIBUTES, File::DEFAULT_PERMISSIONS, buffer);
+
+        // Write records of the header and the payload with one vectored write
+        for (int i = 0; i < 100; ++i)
+            REQUIRE(test.WriteV({ { header.data(), header.size() }, { nullptr, 0 }, { payload.data(), payload.size() } }) == 11);
+        test.Flush();
+        REQUIRE(test.size() == 1100);
+
+        // Positional writes do not change the file offset
+        uint64_t offset = test.offset();
+        REQUIRE(test.WriteAt(11, "head", 4) == 4);
+        REQUIRE(test.WriteAt(1100, { { "tail", 4 }, { "!", 1 } }) == 5);
+        REQUIRE(test.size() == 1105);
+        REQUIRE(test.offset() == offset);
+
+        // Positional reads
+        char data[16] = {};
+        REQUIRE(test.ReadAt(0, data, 11) == 11);
+        REQUIRE(std::string(data, 11) == "HEADpayload");
+        REQUIRE(test.ReadAt(11, data, 4) == 4);
+        REQUIRE(std::string(data, 4) == "head");
+        REQUIRE(test.ReadAt(1100, data, sizeof(data)) == 5);
+        REQUIRE(std::string(data, 5) == "tail!");
+        REQUIRE(test.ReadAt(2000, data, sizeof(data)) == 0);
+
+        // Positional scatter reads
+        char first[4];
+        char second[7];
+        REQUIRE(test.ReadAt(1089, { { first, sizeof(first) }, { second, sizeof(second) } }) == 11);
+        REQUIRE(std::string(first, 4) == "HEAD");
+        REQUIRE(std::string(second, 7) == "payload");
+        test.Close();
+
+        // Scatter reads from the current file offset
+        test.Open(true, false, false, File::DEFAULT_ATTRIBUTES, File::DEFAULT_PERMISSIONS, buffer);
+        REQUIRE(test.ReadV({ { first, sizeof(first) }, { second, sizeof(second) } }) == 11);
+        REQUIRE(std::string(first, 4) == "HEAD");
+        REQUIRE(std::string(second, 7) == "payload");
+        REQUIRE(test.ReadV({ { first, sizeof(first) } }) == 4);
+        REQUIRE(std::string(first, 4) == "head");
+        test.Seek(1100);
+        REQUIRE(test.ReadV({ { first, sizeof(first) }, { second, sizeof(second) } }) == 5);
+        REQUIRE(std::string(first, 4) == "tail");
+        REQUIRE(second[0] == '!');
+        test.Close();
+
+        File::Remove(test);
+    }
+}
+
+TEST_CASE("File concurrent positional reads", "[CppCommon][FileSystem]")
+{
+    const size_t block = 1024;
+    const size_t blocks = 64;
+
+    File test("test.tmp");
+    test.Create(true, true);
+    std::vector<uint8_t> buffer(block);
+    for (size_t i = 0; i < blocks; ++i)
+    {
+        std::fill(buffer.begin(), buffer.end(), (uint8_t)i);
+        REQUIRE(test.WriteAt(i * block, buffer.data(), buffer.size()) == block);
+    }
+
+    // Scan different parts of the file concurrently
+    std::atomic<size_t> errors(0);
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < 4; ++t)
+    {
+        threads.emplace_back([&test, &errors, t, block, blocks]()
+        {
+            std::vector<uint8_t> data(block);
+            for (size_t i = t; i < blocks; i += 4)
+            {
+                if (test.ReadAt(i * block, data.data(), data.size()) != block)
+                    ++errors;
+                for (auto byte : data)
+                    if (byte != (uint8_t)i)
+                        ++errors;
+            }
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+    REQUIRE(errors == 0);
+
+    test.Close();
+    File::Remove(test);
+}
+
+TEST_CASE("File direct I/O", "[CppCommon][FileSystem]")
+{
+    File::DirectBuffer buffer(10000);
+    REQUIRE(buffer.size() == 3 * File::DIRECT_ALIGNMENT);
+    REQUIRE(buffer.alignment() == File::DIRECT_ALIGNMENT);
+    REQUIRE(((uintptr_t)buffer.data() % File::DIRECT_ALIGNMENT) == 0);
+    REQUIRE(File::DirectBuffer::AlignSize(0) == 0);
+    REQUIRE(File::DirectBuffer::AlignSize(1) == File::DIRECT_ALIGNMENT);
+    REQUIRE(File::DirectBuffer::AlignSize(File::DIRECT_ALIGNMENT) == File::DIRECT_ALIGNMENT);
+    for (size_t i = 0; i < buffer.size(); ++i)
+        buffer.data()[i] = (uint8_t)(i % 251);
+
+    // Some filesystems (e.g. tmpfs) do not support direct I/O
+    File test("test.tmp");
+    try
+    {
+        test.Create(true, true, FileAttributes::DIRECT | FileAttributes::WRITETHROUGH);
+    }
+    catch (const FileSystemException&)
+    {
+        if (test.IsFileExists())
+            File::Remove(test);
+        return;
+    }
+
+    REQUIRE(test.WriteAt(0, buffer.data(), buffer.size()) == buffer.size());
+    REQUIRE(test.size() == buffer.size());
+
+    File::DirectBuffer data(File::DIRECT_ALIGNMENT);
+    REQUIRE(test.ReadAt(File::DIRECT_ALIGNMENT, data.data(), data.size()) == data.size());
+    REQUIRE(std::memcmp(data.data(), buffer.data() + File::DIRECT_ALIGNMENT, data.size()) == 0);
+
+    // Direct I/O file is always unbuffered
+    std::memset(data.data(), 0xFF, data.size());
+    REQUIRE(test.Write(data.data(), data.size()) == data.size());
+    REQUIRE(test.ReadAt(0, buffer.data(), data.size()) == data.size());
+    REQUIRE(std::memcmp(buffer.data(), data.data(), data.size()) == 0);
+    REQUIRE(test.size() == buffer.size());
+
+    test.Close();
+    File::Remove(test);
+}
+
+TEST_CASE("File preallocation and access advice", "[CppCommon][FileSystem]")
+{
+    File test("test.tmp");
+    test.Create(true, true);
+    REQUIRE(test.Write("test", 4) == 4);
+    test.Flush();
+
+    // Preallocation keeps the file size
+    test.Preallocate(1024 * 1024);
+    REQUIRE(test.size() == 4);
+    REQUIRE(test.Write("test", 4) == 4);
+    test.Flush();
+    REQUIRE(test.size() == 8);
+
+    test.Advise(FileAdvice::SEQUENTIAL);
+    test.Advise(FileAdvice::RANDOM, 0, 4);
+    test.Advise(FileAdvice::WILLNEED, 0, 8);
+    test.Advise(FileAdvice::DONTNEED);
+    test.Advise(FileAdvice::NORMAL);
+
+    std::vector<uint8_t> data(8);
+    REQUIRE(test.ReadAt(0, data.data(), data.size()) == 8);
+    REQUIRE(std::memcmp(data.data(), "testtest", 8) == 0);
+
+    test.Close();
+    File::Remove(test);
+}
+
+TEST_CASE("File non-throwing operations", "[CppCommon][FileSystem]")
+{
+    std::error_code ec;
+
+    // Probe the missing file
+    File missing("missing.tmp");
+    REQUIRE(missing.TryStatus(ec) == FileType::NONE);
+    REQUIRE(!ec);
+    REQUIRE(!missing.TryOpen(true, false, ec));
+    REQUIRE(ec == std::errc::no_such_file_or_directory);
+    REQUIRE(!missing.IsFileOpened());
+
+    // Probe the missing directory
+    Directory directory("test_try");
+    REQUIRE(!directory.IsDirectoryExists(ec));
+    REQUIRE(!ec);
+    REQUIRE(Directory::TryCreate(directory, ec));
+    REQUIRE(!ec);
+    REQUIRE(Directory::TryCreate(directory, ec));
+    REQUIRE(directory.IsDirectoryExists(ec));
+    REQUIRE(directory.TryStatus(ec) == FileType::DIRECTORY);
+    REQUIRE(!Directory::TryCreate(directory / "missing" / "nested", ec));
+    REQUIRE(ec == std::errc::no_such_file_or_directory);
+
+    // Open or create the file and read it back
+    File test(directory / "test.tmp");
+    REQUIRE(test.TryOpenOrCreate(false, true, ec));
+    REQUIRE(!ec);
+    REQUIRE(test.Write("test", 4) == 4);
+    uint8_t buffer[8];
+    REQUIRE(test.TryRead(buffer, sizeof(buffer), ec) == 0);
+    REQUIRE(ec == std::errc::bad_file_descriptor);
+    test.Close();
+
+    REQUIRE(test.TryOpen(true, false, ec));
+    REQUIRE(test.TryRead(buffer, sizeof(buffer), ec) == 4);
+    REQUIRE(!ec);
+    REQUIRE(std::memcmp(buffer, "test", 4) == 0);
+    REQUIRE(test.TryRead(buffer, sizeof(buffer), ec) == 0);
+    REQUIRE(!ec);
+    test.Close();
+
+    Directory::RemoveAll(directory);
+}
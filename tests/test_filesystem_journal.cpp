@@ -0,0 +1,147 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "test.h"
+
+#include "filesystem/filesystem.h"
+
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace CppCommon;
+
+TEST_CASE("Journal append and read", "[CppCommon][FileSystem]")
+{
+    REQUIRE(Journal::Read("journal.tmp", nullptr) == 0);
+
+    Journal journal("journal.tmp");
+    REQUIRE(!journal.IsOpened());
+    journal.Open();
+    REQUIRE(journal.IsOpened());
+    REQUIRE(journal.size() == 0);
+
+    REQUIRE(journal.Append("first") == 0);
+    REQUIRE(journal.Append("") == Journal::HEADER_SIZE + 5);
+    REQUIRE(journal.Append("third") == 2 * Journal::HEADER_SIZE + 5);
+    REQUIRE(journal.size() == 3 * Journal::HEADER_SIZE + 10);
+    REQUIRE(journal.records() == 3);
+    REQUIRE(journal.commits() == 3);
+
+    journal.Close();
+    REQUIRE(!journal.IsOpened());
+
+    std::vector<std::string> records;
+    uint64_t size = Journal::Read("journal.tmp", [&records](uint64_t, const uint8_t* data, size_t length)
+    {
+        records.emplace_back((const char*)data, length);
+        return true;
+    });
+    REQUIRE(size == 3 * Journal::HEADER_SIZE + 10);
+    REQUIRE(records == std::vector<std::string>({ "first", "", "third" }));
+
+    // Stop reading with the handler
+    records.clear();
+    size = Journal::Read("journal.tmp", [&records](uint64_t, const uint8_t* data, size_t length)
+    {
+        records.emplace_back((const char*)data, length);
+        return false;
+    });
+    REQUIRE(size == Journal::HEADER_SIZE + 5);
+    REQUIRE(records.size() == 1);
+
+    File::Remove("journal.tmp");
+}
+
+TEST_CASE("Journal group commit", "[CppCommon][FileSystem]")
+{
+    const int producers = 8;
+    const int count = 200;
+
+    Journal journal("journal.tmp");
+    journal.Open();
+
+    // Append records from many producer threads concurrently
+    std::vector<std::thread> threads;
+    for (int producer = 0; producer < producers; ++producer)
+    {
+        threads.emplace_back([&journal, producer, count]()
+        {
+            for (int i = 0; i < count; ++i)
+                journal.Append(std::to_string(producer) + ":" + std::to_string(i));
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+
+    REQUIRE(journal.records() == producers * count);
+    REQUIRE(journal.commits() >= 1);
+    REQUIRE(journal.commits() <= journal.records());
+    journal.Close();
+
+    // Records of each producer are read back in their append order
+    std::vector<int> next(producers, 0);
+    size_t records = 0;
+    Journal::Read("journal.tmp", [&next, &records](uint64_t, const uint8_t* data, size_t size)
+    {
+        std::string record((const char*)data, size);
+        size_t separator = record.find(':');
+        int producer = std::stoi(record.substr(0, separator));
+        int index = std::stoi(record.substr(separator + 1));
+        if (index == next[producer])
+            ++next[producer];
+        ++records;
+        return true;
+    });
+    REQUIRE(records == producers * count);
+    for (int producer = 0; producer < producers; ++producer)
+        REQUIRE(next[producer] == count);
+
+    File::Remove("journal.tmp");
+}
+
+TEST_CASE("Journal recovery", "[CppCommon][FileSystem]")
+{
+    uint64_t valid = 0;
+    {
+        Journal journal("journal.tmp");
+        journal.Open();
+        journal.Append("record1");
+        journal.Append("record2");
+        valid = journal.size();
+        journal.Close();
+    }
+
+    // Simulate the torn write of the last record
+    File file("journal.tmp");
+    file.Open(false, true);
+    uint8_t torn[] = { 100, 0, 0, 0, 1, 2, 3, 4, 'r', 'e' };
+    file.WriteAt(valid, torn, sizeof(torn));
+    file.Close();
+    REQUIRE(file.size() == valid + sizeof(torn));
+    REQUIRE(Journal::Read("journal.tmp", nullptr) == valid);
+
+    // Open truncates the torn tail and continues after the last valid record
+    Journal journal("journal.tmp");
+    journal.Open();
+    REQUIRE(journal.size() == valid);
+    REQUIRE(journal.Append("record3") == valid);
+    journal.Close();
+
+    // Corrupt the content of the last record
+    file.Open(false, true);
+    file.WriteAt(file.size() - 1, "X", 1);
+    file.Close();
+
+    std::vector<std::string> records;
+    uint64_t size = Journal::Read("journal.tmp", [&records](uint64_t, const uint8_t* data, size_t length)
+    {
+        records.emplace_back((const char*)data, length);
+        return true;
+    });
+    REQUIRE(size == valid);
+    REQUIRE(records == std::vector<std::string>({ "record1", "record2" }));
+
+    File::Remove("journal.tmp");
+}
@@ -0,0 +1,103 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "test.h"
+
+#include "filesystem/filesystem.h"
+#include "filesystem/mapped_file.h"
+
+#include <cstring>
+
+using namespace CppCommon;
+
+TEST_CASE("Memory-mapped file read-only", "[CppCommon][FileSystem]")
+{
+    File::WriteAllText("mapped.tmp", "1234567890");
+
+    MappedFile file("mapped.tmp");
+    REQUIRE(file.mode() == MappedFileMode::READ);
+    REQUIRE(!file.IsWritable());
+    REQUIRE(file.size() == 10);
+    REQUIRE(file.view() == "1234567890");
+    REQUIRE(file.mutable_data() == nullptr);
+    REQUIRE(file.bytes().size() == 10);
+    REQUIRE(file.bytes()[0] == '1');
+    REQUIRE(file.mutable_bytes().empty());
+
+    // Access pattern advices keep the mapped content
+    file.Advise(FileAdvice::SEQUENTIAL);
+    file.Advise(FileAdvice::RANDOM, 3, 5);
+    file.Advise(FileAdvice::WILLNEED, 100);
+    file.Advise(FileAdvice::DONTNEED);
+    file.Advise(FileAdvice::NORMAL);
+    REQUIRE(file.view() == "1234567890");
+
+    // Read-only mapping cannot be resized
+    REQUIRE_THROWS_AS(file.Resize(100), FileSystemException);
+
+    // Follow the growing file
+    REQUIRE(!file.Remap());
+    File::WriteAllText("mapped.tmp", "1234567890abcdef");
+    REQUIRE(file.Remap());
+    REQUIRE(file.view() == "1234567890abcdef");
+
+    // Move the mapped file
+    MappedFile moved(std::move(file));
+    REQUIRE(file.size() == 0);
+    REQUIRE(file.data() == nullptr);
+    REQUIRE(moved.view() == "1234567890abcdef");
+
+    // Empty files are not mapped
+    File::WriteEmpty("mapped.tmp");
+    REQUIRE(moved.Remap());
+    REQUIRE(moved.size() == 0);
+    REQUIRE(moved.data() == nullptr);
+
+    File::Remove("mapped.tmp");
+}
+
+TEST_CASE("Memory-mapped file read-write", "[CppCommon][FileSystem]")
+{
+    {
+        // Create the new mapped file with the initial size
+        MappedFile file("mapped.tmp", MappedFileMode::READ_WRITE, 10);
+        REQUIRE(file.IsWritable());
+        REQUIRE(file.size() == 10);
+        REQUIRE(file.mutable_data() == file.data());
+        std::memcpy(file.mutable_data(), "1234567890", 10);
+        file.Flush();
+        REQUIRE(File::ReadAllText("mapped.tmp") == "1234567890");
+
+        // Grow the mapped file with zeros keeping its content
+        file.Resize(1 << 20);
+        REQUIRE(file.size() == (1 << 20));
+        REQUIRE(file.view().substr(0, 10) == "1234567890");
+        REQUIRE(file.data()[(1 << 20) - 1] == 0);
+        file.mutable_data()[(1 << 20) - 1] = 'x';
+        file.Flush(true);
+
+        // Shrink the mapped file
+        file.Resize(5);
+        REQUIRE(file.view() == "12345");
+        REQUIRE(!file.Remap());
+        file.mutable_bytes()[4] = '0';
+
+        file.Resize(0);
+        REQUIRE(file.size() == 0);
+        REQUIRE(file.data() == nullptr);
+        file.Resize(4);
+        REQUIRE(file.view() == std::string(4, 0));
+        std::memcpy(file.mutable_data(), "abcd", 4);
+    }
+    REQUIRE(File("mapped.tmp").size() == 4);
+    REQUIRE(File::ReadAllText("mapped.tmp") == "abcd");
+
+    {
+        // Existing file is not truncated to the smaller initial size
+        MappedFile file("mapped.tmp", MappedFileMode::READ_WRITE, 2);
+        REQUIRE(file.view() == "abcd");
+    }
+
+    File::Remove("mapped.tmp");
+}
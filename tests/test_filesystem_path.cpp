@@ -6,6 +6,8 @@
 
 #include "filesystem/filesystem.h"
 
+#include <mutex>
+
 using namespace CppCommon;
 
 TEST_CASE("Path common", "[CppCommon][FileSystem]")
@@ -241,6 +243,38 @@ TEST_CASE("Path decompositions", "[CppCommon][FileSystem]")
     REQUIRE(Path("/foo.bar").extension().MakePreferred() == Path(".bar").MakePreferred());
 }
 
+TEST_CASE("Path decomposition views", "[CppCommon][FileSystem]")
+{
+    // Decomposition views must be equal to decomposed paths
+    for (const auto& value : { "", ".", "..", "/", "/.", "./", "C:", "C:/", "C:/foo/bar.txt", "\\\\?\\C:/foo", "//net/foo/bar", "///foo", "foo/bar/", "foo/.bar", "foo/bar..txt" })
+    {
+        Path path(value);
+        REQUIRE(path.root_view() == path.root().string());
+        REQUIRE(path.relative_view() == path.relative().string());
+        REQUIRE(path.parent_view() == path.parent().string());
+        REQUIRE(path.filename_view() == path.filename().string());
+        REQUIRE(path.stem_view() == path.stem().string());
+        REQUIRE(path.extension_view() == path.extension().string());
+    }
+
+    // Decomposition views refer to the path value
+    Path path("/foo/bar/test.txt");
+    REQUIRE(path.filename_view().data() == path.string().data() + 9);
+    REQUIRE(path.extension_view() == ".txt");
+    REQUIRE(path.stem_view() == "test");
+    REQUIRE(path.parent_view() == "/foo/bar");
+
+    // Append string views in place
+    Path appended;
+    appended.Reserve(64);
+    const char* data = appended.string().data();
+    appended.Append(std::string_view("foo/bar")).Append(std::string("test")).Append("test.txt");
+    REQUIRE(appended.string().data() == data);
+    REQUIRE(appended.MakePreferred() == Path("foo/bar/test/test.txt").MakePreferred());
+    REQUIRE((Path("foo") / "bar" / "test").MakePreferred() == Path("foo/bar/test").MakePreferred());
+    REQUIRE((Path("foo") + ".bar" + ".txt") == Path("foo.bar.txt"));
+}
+
 TEST_CASE("Path canonization", "[CppCommon][FileSystem]")
 {
     // Test canonical path decomposition method
@@ -588,6 +622,63 @@ TEST_CASE("Path copy & remove", "[CppCommon][FileSystem]")
     REQUIRE(Path::RemoveAll(test) == Path::current());
 }
 
+TEST_CASE("Path parallel copy with progress", "[CppCommon][FileSystem]")
+{
+    // Create the source directory tree
+    Directory test = Directory::Create(Path::current() / "parallel");
+    std::string content(100000, 'x');
+    for (int i = 0; i < 4; ++i)
+    {
+        Directory dir = Directory::Create(test / ("dir" + std::to_string(i)));
+        for (int j = 0; j < 8; ++j)
+            File::WriteAllText(dir / ("file" + std::to_string(j) + ".txt"), content);
+    }
+    File::WriteAllText(test / "root.txt", "root");
+    File::WriteAllText(test / "root.log", "log");
+    File::WriteAllText(test / "empty.txt", "");
+
+    // Copy the tree with several threads and count progress
+    std::mutex mutex;
+    size_t entries = 0;
+    uint64_t bytes = 0;
+    auto progress = [&](const Path&, const Path&, uint64_t size)
+    {
+        std::scoped_lock locker(mutex);
+        ++entries;
+        bytes += size;
+    };
+    Directory copy = Path::CopyAll(test, Path::current() / "parallel-copy", false, 4, progress);
+    REQUIRE(entries == 4 + 4 * 8 + 3);
+    REQUIRE(bytes == 4 * 8 * content.size() + 4 + 3);
+    REQUIRE(File::ReadAllText(copy / "dir3" / "file7.txt") == content);
+    REQUIRE(File::ReadAllText(copy / "root.txt") == "root");
+    REQUIRE(File::ReadAllText(copy / "empty.txt").empty());
+    REQUIRE(copy.GetFilesRecursive().size() == 4 * 8 + 3);
+
+    // Overwrite the copied tree
+    REQUIRE(Path::CopyAll(test, copy, false, 4).empty());
+    REQUIRE(Path::CopyAll(test, copy, true, 4) == copy);
+    REQUIRE(Path::RemoveAll(copy) == Path::current());
+
+    // Copy only matched entries of the source directory
+    Directory matched = Path::CopyIf(test, Path::current() / "parallel-matched", "(dir1|.*\\.txt)", false, 4);
+    REQUIRE(matched.GetDirectories().size() == 1);
+    REQUIRE(matched.GetFiles().size() == 2);
+    REQUIRE(matched.GetFilesRecursive().size() == 8 + 2);
+    REQUIRE(Path::RemoveAll(matched) == Path::current());
+
+    // Copy only entries matched to the compiled glob pattern
+    Directory globbed = Path::CopyIf(test, Path::current() / "parallel-globbed", GlobPattern("dir[12];*.txt;!*"), false, 4);
+    REQUIRE(globbed.GetDirectories().size() == 2);
+    REQUIRE(globbed.GetFiles().size() == 2);
+    REQUIRE(Path::RemoveIf(globbed, GlobPattern("*.txt")) == globbed);
+    REQUIRE(globbed.GetDirectories().size() == 2);
+    REQUIRE(globbed.GetFiles().empty());
+    REQUIRE(Path::RemoveAll(globbed) == Path::current());
+
+    REQUIRE(Path::RemoveAll(test) == Path::current());
+}
+
 TEST_CASE("Path constants of the current process", "[CppCommon][FileSystem]")
 {
     Path initial = Path::initial();
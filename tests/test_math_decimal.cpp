@@ -0,0 +1,187 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "test.h"
+
+#include "math/decimal.h"
+
+#include <sstream>
+#include <string_view>
+
+using namespace CppCommon;
+
+namespace {
+
+template <size_t Scale, typename T>
+Decimal<Scale, T> Parse(std::string_view str, RoundingMode mode = RoundingMode::HALF_EVEN)
+{
+    Decimal<Scale, T> result;
+    auto parsed = Decimal<Scale, T>::from_chars(str.data(), str.data() + str.size(), result, mode);
+    REQUIRE(parsed.ec == std::errc());
+    REQUIRE(parsed.ptr == str.data() + str.size());
+    return result;
+}
+
+template <size_t Scale, typename T>
+std::errc Error(std::string_view str)
+{
+    Decimal<Scale, T> result;
+    return Decimal<Scale, T>::from_chars(str.data(), str.data() + str.size(), result).ec;
+}
+
+} // namespace
+
+TEST_CASE("Decimal", "[CppCommon][Math]")
+{
+    typedef Decimal<8> Price;
+
+    constexpr Price price = Price::FromRaw(108250000);
+    static_assert(price.raw() == 108250000);
+    static_assert(Price(2).raw() == 200000000);
+    static_assert(price.integral() == 1);
+    static_assert(price.fraction() == 8250000);
+    static_assert(price * Price(2) == Price::FromRaw(216500000));
+    static_assert(Price(1) / Price(3) == Price::FromRaw(33333333));
+    static_assert(Price(2) / Price(3) == Price::FromRaw(66666667));
+    static_assert(-price < price);
+    static_assert(price.Rescale<4>() == Decimal<4>::FromRaw(10825));
+    static_assert(price.Rescale<10>() == Decimal<10>::FromRaw(10825000000));
+
+    REQUIRE(price.string() == "1.0825");
+    REQUIRE((-price).string() == "-1.0825");
+    REQUIRE(Price(100).string() == "100");
+    REQUIRE(Price().string() == "0");
+    REQUIRE(Price::FromRaw(1).string() == "0.00000001");
+    REQUIRE(Price::FromRaw(-1).string() == "-0.00000001");
+    REQUIRE(Price::FromRaw(INT64_MIN).string() == "-92233720368.54775808");
+    REQUIRE(Price::FromRaw(INT64_MAX).string() == "92233720368.54775807");
+    REQUIRE((price + price - Price(1)).string() == "1.165");
+    REQUIRE(price.ToDouble() == 1.0825);
+    REQUIRE(Price::FromDouble(1.0825) == price);
+    REQUIRE(Price::FromDouble(-1.0825) == -price);
+
+    std::stringstream ss;
+    ss << price << ' ' << RoundingMode::HALF_EVEN;
+    REQUIRE(ss.str() == "1.0825 HALF_EVEN");
+    REQUIRE(fmt::format("{:>8}", price) == "  1.0825");
+
+    REQUIRE_THROWS_AS(price / Price(), std::domain_error);
+
+    // Buffer is too small
+    char buffer[4];
+    REQUIRE(price.to_chars(buffer, buffer + sizeof(buffer)).ec == std::errc::value_too_large);
+}
+
+TEST_CASE("Decimal rounding", "[CppCommon][Math]")
+{
+    typedef Decimal<2> Money;
+
+    struct Case { const char* value; const char* down; const char* up; const char* floor; const char* ceiling; const char* half_up; const char* half_even; };
+    const Case cases[] =
+    {
+        { "1.125", "1.12", "1.13", "1.12", "1.13", "1.13", "1.12" },
+        { "1.135", "1.13", "1.14", "1.13", "1.14", "1.14", "1.14" },
+        { "1.1251", "1.12", "1.13", "1.12", "1.13", "1.13", "1.13" },
+        { "-1.125", "-1.12", "-1.13", "-1.13", "-1.12", "-1.13", "-1.12" },
+        { "-1.121", "-1.12", "-1.13", "-1.13", "-1.12", "-1.12", "-1.12" },
+        { "1.12", "1.12", "1.12", "1.12", "1.12", "1.12", "1.12" }
+    };
+
+    for (const auto& test : cases)
+    {
+        // Rounding of extra parsed digits
+        REQUIRE(Parse<2, int64_t>(test.value, RoundingMode::DOWN).string() == test.down);
+        REQUIRE(Parse<2, int64_t>(test.value, RoundingMode::UP).string() == test.up);
+        REQUIRE(Parse<2, int64_t>(test.value, RoundingMode::FLOOR).string() == test.floor);
+        REQUIRE(Parse<2, int64_t>(test.value, RoundingMode::CEILING).string() == test.ceiling);
+        REQUIRE(Parse<2, int64_t>(test.value, RoundingMode::HALF_UP).string() == test.half_up);
+        REQUIRE(Parse<2, int64_t>(test.value, RoundingMode::HALF_EVEN).string() == test.half_even);
+
+        // Rounding of the rescaled value
+        auto exact = Parse<4, int64_t>(test.value);
+        REQUIRE(exact.Rescale<2>(RoundingMode::DOWN).string() == test.down);
+        REQUIRE(exact.Rescale<2>(RoundingMode::HALF_UP).string() == test.half_up);
+        REQUIRE(exact.Rescale<2>(RoundingMode::HALF_EVEN).string() == test.half_even);
+        REQUIRE(exact.Round(2, RoundingMode::FLOOR).Rescale<2>().string() == test.floor);
+        REQUIRE(exact.Round(2, RoundingMode::CEILING).Rescale<2>().string() == test.ceiling);
+    }
+
+    // Rounding of the product and the quotient
+    REQUIRE(Money::Multiply(Parse<2, int64_t>("1.05"), Parse<2, int64_t>("0.5"), RoundingMode::HALF_EVEN).string() == "0.52");
+    REQUIRE(Money::Multiply(Parse<2, int64_t>("1.05"), Parse<2, int64_t>("0.5"), RoundingMode::HALF_UP).string() == "0.53");
+    REQUIRE(Money::Multiply(Parse<2, int64_t>("-1.05"), Parse<2, int64_t>("0.5"), RoundingMode::FLOOR).string() == "-0.53");
+    REQUIRE(Money::Divide(Money(-2), Money(3), RoundingMode::DOWN).string() == "-0.66");
+    REQUIRE(Money::Divide(Money(-2), Money(3), RoundingMode::CEILING).string() == "-0.66");
+    REQUIRE(Money::Divide(Money(-2), Money(3), RoundingMode::FLOOR).string() == "-0.67");
+
+    // Half-even parity of the integral digit
+    REQUIRE(Parse<0, int64_t>("2.5").string() == "2");
+    REQUIRE(Parse<0, int64_t>("3.5").string() == "4");
+    REQUIRE(Decimal<0>::FromDouble(2.5).string() == "2");
+}
+
+TEST_CASE("Decimal MulDiv", "[CppCommon][Math]")
+{
+    typedef Decimal<8> Price;
+
+    // Product of big values overflows 64 bits before the division
+    Price price = Parse<8, int64_t>("65000.12345678");
+    Price quantity = Parse<8, int64_t>("1000000");
+    REQUIRE((price * quantity).string() == "65000123456.78");
+    REQUIRE((price * -quantity).string() == "-65000123456.78");
+    REQUIRE(Price::MulDiv(price, quantity, Price(1000)).string() == "65000123.45678");
+    REQUIRE(Price::MulDiv(price, -quantity, Price(-3)).string() == "21666707818.92666667");
+    REQUIRE(((price * quantity) / quantity) == price);
+
+    // 128-bit decimal calculates 256-bit products
+    typedef Decimal<18, uint128_t> Amount;
+    Amount amount = Parse<18, uint128_t>("123456789012345678.123456789012345678");
+    REQUIRE(amount.string() == "123456789012345678.123456789012345678");
+    REQUIRE((amount * Amount(1000)).string() == "123456789012345678123.456789012345678");
+    REQUIRE((amount / Amount(1000)).string() == "123456789012345.678123456789012346");
+    REQUIRE(Amount::MulDiv(amount, Amount(7), Amount(7)) == amount);
+}
+
+TEST_CASE("Decimal parsing", "[CppCommon][Math]")
+{
+    REQUIRE(Parse<8, int64_t>("0").raw() == 0);
+    REQUIRE(Parse<8, int64_t>("-0").raw() == 0);
+    REQUIRE(Parse<8, int64_t>("12").raw() == 1200000000);
+    REQUIRE(Parse<8, int64_t>("12.").raw() == 1200000000);
+    REQUIRE(Parse<8, int64_t>(".5").raw() == 50000000);
+    REQUIRE(Parse<8, int64_t>("-.5").raw() == -50000000);
+    REQUIRE(Parse<8, int64_t>("001.00000001").raw() == 100000001);
+    REQUIRE(Parse<8, int64_t>("-92233720368.54775808").raw() == INT64_MIN);
+    REQUIRE(Parse<8, int64_t>("92233720368.54775807").raw() == INT64_MAX);
+    REQUIRE(Parse<8, uint64_t>("184467440737.09551615").raw() == UINT64_MAX);
+    REQUIRE(Parse<0, uint128_t>("340282366920938463463374607431768211455").raw() == uint128_t(0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull));
+
+    // Parsing stops at the first unknown character
+    Decimal<2> value;
+    std::string_view str = "1.25|next";
+    auto result = Decimal<2>::from_chars(str.data(), str.data() + str.size(), value);
+    REQUIRE(result.ec == std::errc());
+    REQUIRE(result.ptr == str.data() + 4);
+    REQUIRE(value.string() == "1.25");
+
+    REQUIRE(Error<8, int64_t>("") == std::errc::invalid_argument);
+    REQUIRE(Error<8, int64_t>("-") == std::errc::invalid_argument);
+    REQUIRE(Error<8, int64_t>(".") == std::errc::invalid_argument);
+    REQUIRE(Error<8, int64_t>("+1") == std::errc::invalid_argument);
+    REQUIRE(Error<8, int64_t>("abc") == std::errc::invalid_argument);
+    REQUIRE(Error<8, uint64_t>("-1") == std::errc::invalid_argument);
+    REQUIRE(Error<8, int64_t>("92233720368.54775808") == std::errc::result_out_of_range);
+    REQUIRE(Error<8, int64_t>("-92233720368.54775809") == std::errc::result_out_of_range);
+    REQUIRE(Error<8, int64_t>("92233720368.547758075") == std::errc::result_out_of_range);
+    REQUIRE(Error<8, int64_t>("100000000000") == std::errc::result_out_of_range);
+    REQUIRE(Error<0, int64_t>("99999999999999999999999") == std::errc::result_out_of_range);
+
+    // Round trip
+    const int64_t raws[] = { 0, 1, -1, 10, 123456789, -100000000, 99999999, INT64_MAX, INT64_MIN };
+    for (int64_t raw : raws)
+    {
+        std::string text = Decimal<8>::FromRaw(raw).string();
+        REQUIRE(Parse<8, int64_t>(text).raw() == raw);
+    }
+}
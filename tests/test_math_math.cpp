@@ -6,6 +6,10 @@
 
 #include "math/math.h"
 
+#include <cmath>
+#include <limits>
+#include <vector>
+
 using namespace CppCommon;
 
 TEST_CASE("Math", "[CppCommon][Math]")
@@ -40,3 +44,86 @@ TEST_CASE("Math", "[CppCommon][Math]")
     REQUIRE(((overflow == 18446744073709551612ull) || (overflow == 0xFFFFFFFFFFFFFFFFull)));
 #endif
 }
+
+TEST_CASE("Math numeric kernels", "[CppCommon][Math]")
+{
+    // Different sizes cover vectorized loops and their tails
+    for (size_t size : { 0, 1, 3, 7, 8, 9, 15, 16, 17, 31, 1000, 1003 })
+    {
+        std::vector<int64_t> integers(size);
+        std::vector<int64_t> volumes(size);
+        std::vector<double> doubles(size);
+        std::vector<double> weights(size);
+        for (size_t i = 0; i < size; ++i)
+        {
+            integers[i] = (int64_t)((i * 7919) % 1000) - 500;
+            volumes[i] = (int64_t)(i % 13) + 1;
+            doubles[i] = (double)integers[i] / 8.0;
+            weights[i] = (double)volumes[i];
+        }
+
+        int64_t sum = 0;
+        int64_t dot = 0;
+        int64_t min = std::numeric_limits<int64_t>::max();
+        int64_t max = std::numeric_limits<int64_t>::lowest();
+        int64_t total = 0;
+        for (size_t i = 0; i < size; ++i)
+        {
+            sum += integers[i];
+            dot += integers[i] * volumes[i];
+            min = std::min(min, integers[i]);
+            max = std::max(max, integers[i]);
+            total += volumes[i];
+        }
+        double mean = (size > 0) ? ((double)sum / size) : 0.0;
+        double variance = 0.0;
+        for (size_t i = 0; i < size; ++i)
+            variance += ((double)integers[i] - mean) * ((double)integers[i] - mean);
+        variance = (size > 0) ? (variance / size) : 0.0;
+
+        REQUIRE(Math::Sum(integers) == sum);
+        REQUIRE(Math::Dot(integers, volumes) == dot);
+        REQUIRE(Math::MinMax(integers) == std::make_pair(min, max));
+        REQUIRE_THAT(Math::WeightedAverage(integers, volumes), Catch::Matchers::WithinRel((total > 0) ? ((double)dot / total) : 0.0));
+        REQUIRE(Math::MeanVariance(integers).count == size);
+        REQUIRE_THAT(Math::MeanVariance(integers).mean, Catch::Matchers::WithinRel(mean));
+        REQUIRE_THAT(Math::MeanVariance(integers).variance, Catch::Matchers::WithinRel(variance));
+
+        // Doubles are integers divided by 8, so all kernels are exact
+        for (auto accumulation : { MathAccumulation::FAST, MathAccumulation::KAHAN, MathAccumulation::WELFORD })
+        {
+            REQUIRE(Math::Sum(doubles, accumulation) == (double)sum / 8.0);
+            auto moments = Math::MeanVariance(doubles, accumulation);
+            REQUIRE(moments.count == size);
+            REQUIRE_THAT(moments.mean, Catch::Matchers::WithinAbs(mean / 8.0, 1e-12));
+            REQUIRE_THAT(moments.variance, Catch::Matchers::WithinAbs(variance / 64.0, 1e-9));
+        }
+        REQUIRE(Math::Dot(doubles, weights) == (double)dot / 8.0);
+        if (size > 0)
+            REQUIRE(Math::MinMax(doubles) == std::make_pair((double)min / 8.0, (double)max / 8.0));
+        else
+            REQUIRE(Math::MinMax(doubles) == std::make_pair(std::numeric_limits<double>::max(), std::numeric_limits<double>::lowest()));
+        REQUIRE_THAT(Math::WeightedAverage(doubles, weights), Catch::Matchers::WithinRel((total > 0) ? ((double)dot / total / 8.0) : 0.0));
+    }
+
+    // Integer kernels wrap around on overflow
+    std::vector<int64_t> overflow(17, std::numeric_limits<int64_t>::max());
+    REQUIRE(Math::Sum(overflow) == (int64_t)(17ull * (uint64_t)std::numeric_limits<int64_t>::max()));
+    REQUIRE(Math::Dot(overflow, overflow) == (int64_t)(17ull * (uint64_t)std::numeric_limits<int64_t>::max() * (uint64_t)std::numeric_limits<int64_t>::max()));
+    std::vector<int64_t> negative = { -3, -1, -7, -2, -9, -4, -5, -8, -6 };
+    REQUIRE(Math::MinMax(negative) == std::make_pair((int64_t)-9, (int64_t)-1));
+    REQUIRE(Math::Dot(negative, negative) == 285);
+
+    // Kahan summation keeps small values lost by the fast summation
+    std::vector<double> values(10008, 1e-16);
+    std::fill(values.begin(), values.begin() + 8, 1.0);
+    double expected = 8.0 + 10000 * 1e-16;
+    REQUIRE(std::fabs(Math::Sum(values, MathAccumulation::KAHAN) - expected) < std::fabs(Math::Sum(values) - expected));
+    REQUIRE_THAT(Math::Sum(values, MathAccumulation::KAHAN), Catch::Matchers::WithinRel(expected, 1e-15));
+
+    // Welford is stable for values with a large offset
+    std::vector<double> offset = { 1e9 + 4, 1e9 + 7, 1e9 + 13, 1e9 + 16 };
+    REQUIRE_THAT(Math::MeanVariance(offset, MathAccumulation::WELFORD).variance, Catch::Matchers::WithinRel(22.5));
+    REQUIRE_THAT(Math::MeanVariance(offset).variance, Catch::Matchers::WithinRel(22.5));
+    REQUIRE_THAT(Math::MeanVariance(offset).sample_variance(), Catch::Matchers::WithinRel(30.0));
+}
@@ -4,15 +4,28 @@
 
 #include "test.h"
 
+#include "containers/flatmap.h"
+#include "containers/hashmap.h"
+#include "filesystem/file.h"
 #include "memory/allocator.h"
 #include "memory/allocator_arena.h"
+#include "memory/allocator_concurrent_pool.h"
 #include "memory/allocator_heap.h"
+#include "memory/allocator_hugepage.h"
 #include "memory/allocator_null.h"
 #include "memory/allocator_pool.h"
+#include "memory/allocator_profiler.h"
+#include "memory/allocator_shared_pool.h"
+#include "memory/allocator_slab.h"
 #include "memory/allocator_stack.h"
+#include "memory/allocator_trace.h"
 
+#include <atomic>
+#include <cstring>
 #include <list>
 #include <map>
+#include <memory_resource>
+#include <thread>
 #include <vector>
 #include <unordered_map>
 
@@ -64,6 +77,56 @@ TEST_CASE("Heap memory manager", "[CppCommon][Memory]")
     REQUIRE(manger.allocations() == 0);
 }
 
+TEST_CASE("Huge page memory manager", "[CppCommon][Memory]")
+{
+    HugePageMemoryManager manger;
+    REQUIRE(manger.page() == HugePageMemoryManager::HUGE_PAGE_2MB);
+    REQUIRE(manger.node() == -1);
+    REQUIRE(manger.allocated() == 0);
+    REQUIRE(manger.allocations() == 0);
+
+    // Block size is rounded up to the huge page size
+    uint8_t* ptr = (uint8_t*)manger.malloc(1);
+    REQUIRE(ptr != nullptr);
+    REQUIRE(Memory::IsAligned(ptr, 4096));
+    REQUIRE(manger.allocated() == HugePageMemoryManager::HUGE_PAGE_2MB);
+    REQUIRE(manger.allocations() == 1);
+    ptr[0] = 1;
+    ptr[HugePageMemoryManager::HUGE_PAGE_2MB - 1] = 1;
+    manger.free(ptr, 1);
+    REQUIRE(manger.allocated() == 0);
+    REQUIRE(manger.allocations() == 0);
+
+    // Without fallback allocation succeeds only with reserved huge pages
+    HugePageMemoryManager strict(HugePageMemoryManager::HUGE_PAGE_2MB, -1, false);
+    ptr = (uint8_t*)strict.malloc(3 * 1024 * 1024);
+    if (ptr != nullptr)
+    {
+        REQUIRE(strict.allocated() == 2 * HugePageMemoryManager::HUGE_PAGE_2MB);
+        strict.free(ptr, 3 * 1024 * 1024);
+    }
+    REQUIRE(strict.allocated() == 0);
+    REQUIRE(strict.fallbacks() == 0);
+}
+
+TEST_CASE("Arena memory manager with huge pages", "[CppCommon][Memory]")
+{
+    HugePageMemoryManager auxiliary(HugePageMemoryManager::HUGE_PAGE_2MB, 0);
+    ArenaMemoryManager<HugePageMemoryManager> manger(auxiliary, HugePageMemoryManager::HUGE_PAGE_2MB - 1024);
+
+    // NUMA binding to the first node might be not available
+    void* ptr = manger.malloc(1000);
+    if (ptr != nullptr)
+    {
+        REQUIRE(auxiliary.allocated() == HugePageMemoryManager::HUGE_PAGE_2MB);
+        REQUIRE(auxiliary.allocations() == 1);
+        manger.free(ptr, 1000);
+    }
+    manger.clear();
+    REQUIRE(auxiliary.allocated() == 0);
+    REQUIRE(auxiliary.allocations() == 0);
+}
+
 TEST_CASE("Null memory manager", "[CppCommon][Memory]")
 {
     NullMemoryManager manger;
@@ -248,6 +311,79 @@ TEST_CASE("Arena memory manager with a dynamic buffer", "[CppCommon][Memory]")
     REQUIRE(manger.allocations() == 0);
 }
 
+TEST_CASE("Arena memory manager with checkpoints", "[CppCommon][Memory]")
+{
+    DefaultMemoryManager auxiliary;
+    ArenaMemoryManager<DefaultMemoryManager> manger(auxiliary, 64);
+    REQUIRE(auxiliary.allocations() == 1);
+
+    void* ptr = manger.malloc(16);
+    REQUIRE(ptr != nullptr);
+    auto checkpoint = manger.checkpoint();
+
+    // Allocations after the checkpoint grow the arena with new pages
+    for (int i = 0; i < 10; ++i)
+        REQUIRE(manger.malloc(32) != nullptr);
+    REQUIRE(manger.allocated() == 336);
+    REQUIRE(manger.allocations() == 11);
+    REQUIRE(auxiliary.allocations() > 1);
+
+    // Rewind releases allocations and arena pages after the checkpoint
+    manger.rewind(checkpoint);
+    REQUIRE(manger.allocated() == 16);
+    REQUIRE(manger.allocations() == 1);
+    REQUIRE(auxiliary.allocations() == 1);
+    void* next = manger.malloc(16);
+    REQUIRE(next == ((uint8_t*)ptr + 16));
+
+    // Nested arena scopes
+    {
+        ArenaScope<DefaultMemoryManager> outer(manger);
+        REQUIRE(manger.malloc(200) != nullptr);
+        {
+            ArenaScope<DefaultMemoryManager> inner(manger);
+            REQUIRE(manger.malloc(500) != nullptr);
+            REQUIRE(manger.allocations() == 4);
+        }
+        REQUIRE(manger.allocations() == 3);
+        REQUIRE(manger.allocated() == 232);
+    }
+    REQUIRE(manger.allocated() == 32);
+    REQUIRE(manger.allocations() == 2);
+    REQUIRE(auxiliary.allocations() == 1);
+
+    manger.free(next, 16);
+    manger.free(ptr, 16);
+    manger.reset();
+    REQUIRE(manger.allocated() == 0);
+    REQUIRE(manger.allocations() == 0);
+}
+
+TEST_CASE("Arena memory manager with checkpoints in a fixed buffer", "[CppCommon][Memory]")
+{
+    DefaultMemoryManager auxiliary;
+    uint8_t buffer[64];
+    ArenaMemoryManager<DefaultMemoryManager> manger(auxiliary, buffer, 64);
+
+    void* ptr = manger.malloc(8, 1);
+    {
+        ArenaScope<DefaultMemoryManager> scope(manger);
+        REQUIRE(manger.malloc(40, 1) != nullptr);
+        REQUIRE(manger.size() == 48);
+    }
+    REQUIRE(manger.size() == 8);
+    REQUIRE(manger.allocated() == 8);
+    REQUIRE(manger.allocations() == 1);
+    void* next = manger.malloc(8, 1);
+    REQUIRE(next == ((uint8_t*)ptr + 8));
+    REQUIRE(manger.allocations() == 2);
+
+    manger.free(next, 8);
+    manger.free(ptr, 8);
+    REQUIRE(manger.allocated() == 0);
+    REQUIRE(manger.allocations() == 0);
+}
+
 TEST_CASE("Arena allocator with stl direct access containers", "[CppCommon][Memory]")
 {
     DefaultMemoryManager auxiliary;
@@ -442,3 +578,623 @@ TEST_CASE("Pool allocator with stl associative containers", "[CppCommon][Memory]
     u[2] = 20;
     u.clear();
 }
+
+TEST_CASE("Concurrent pool memory manager", "[CppCommon][Memory]")
+{
+    DefaultMemoryManager auxiliary;
+    ConcurrentPoolMemoryManager<DefaultMemoryManager> manger(auxiliary);
+    REQUIRE(manger.allocated() == 0);
+    REQUIRE(manger.allocations() == 0);
+
+    // Small blocks are aligned to the rounded up size
+    void* ptr1 = manger.malloc(24, 8);
+    REQUIRE(ptr1 != nullptr);
+    REQUIRE(Memory::IsAligned(ptr1, 32));
+    void* ptr2 = manger.malloc(4096, 4096);
+    REQUIRE(ptr2 != nullptr);
+    REQUIRE(Memory::IsAligned(ptr2, 4096));
+    REQUIRE(manger.allocated() == 4120);
+    REQUIRE(manger.allocations() == 2);
+
+    // Huge blocks are allocated from the underlying memory pool
+    void* ptr3 = manger.malloc(100000);
+    REQUIRE(ptr3 != nullptr);
+    REQUIRE(manger.allocated() == 104120);
+    REQUIRE(manger.allocations() == 3);
+
+    // Freed blocks are reused by the thread cache
+    manger.free(ptr1, 24);
+    REQUIRE(manger.malloc(32) == ptr1);
+    manger.free(ptr1, 32);
+    manger.free(ptr2, 4096);
+    manger.free(ptr3, 100000);
+    REQUIRE(manger.allocated() == 0);
+    REQUIRE(manger.allocations() == 0);
+
+    manger.reset();
+    REQUIRE(manger.allocated() == 0);
+    REQUIRE(manger.allocations() == 0);
+}
+
+TEST_CASE("Concurrent pool memory manager with multiple threads", "[CppCommon][Memory]")
+{
+    DefaultMemoryManager auxiliary;
+    ConcurrentPoolMemoryManager<DefaultMemoryManager> manger(auxiliary);
+
+    const size_t threads_count = 4;
+    const size_t items_count = 10000;
+
+    // Blocks allocated by one thread are freed by another one
+    std::vector<std::vector<void*>> blocks(threads_count);
+    std::atomic<size_t> errors(0);
+    std::vector<std::thread> threads;
+    for (size_t thread = 0; thread < threads_count; ++thread)
+    {
+        threads.emplace_back([&manger, &blocks, &errors, thread, items_count]()
+        {
+            for (size_t i = 0; i < items_count; ++i)
+            {
+                size_t size = 8 + (i % 500);
+                uint8_t* ptr = (uint8_t*)manger.malloc(size);
+                if (ptr == nullptr)
+                    ++errors;
+                else
+                {
+                    ptr[0] = ptr[size - 1] = (uint8_t)thread;
+                    blocks[thread].push_back(ptr);
+                }
+            }
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+    threads.clear();
+    REQUIRE(errors == 0);
+    REQUIRE(manger.allocations() == (threads_count * items_count));
+
+    for (size_t thread = 0; thread < threads_count; ++thread)
+    {
+        threads.emplace_back([&manger, &blocks, &errors, thread, threads_count, items_count]()
+        {
+            const size_t owner = (thread + 1) % threads_count;
+            for (size_t i = 0; i < items_count; ++i)
+            {
+                size_t size = 8 + (i % 500);
+                uint8_t* ptr = (uint8_t*)blocks[owner][i];
+                if ((ptr[0] != owner) || (ptr[size - 1] != owner))
+                    ++errors;
+                manger.free(ptr, size);
+            }
+            manger.flush();
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+    REQUIRE(errors == 0);
+    REQUIRE(manger.allocated() == 0);
+    REQUIRE(manger.allocations() == 0);
+
+    manger.clear();
+}
+
+TEST_CASE("Concurrent pool allocator with stl containers", "[CppCommon][Memory]")
+{
+    DefaultMemoryManager auxiliary;
+    ConcurrentPoolMemoryManager<DefaultMemoryManager> manger(auxiliary);
+    ConcurrentPoolAllocator<std::pair<const int, int>, DefaultMemoryManager> alloc(manger);
+
+    std::map<int, int, std::less<>, decltype(alloc)> m(alloc);
+    for (int i = 0; i < 1000; ++i)
+        m[i] = i * 10;
+    m.clear();
+
+    std::vector<int, ConcurrentPoolAllocator<int, DefaultMemoryManager>> v(alloc);
+    for (int i = 0; i < 10000; ++i)
+        v.push_back(i);
+    v.clear();
+    v.shrink_to_fit();
+
+    REQUIRE(manger.allocated() == 0);
+    REQUIRE(manger.allocations() == 0);
+}
+
+TEST_CASE("Shared memory pool manager", "[CppCommon][Memory]")
+{
+    alignas(64) static uint8_t buffer[65536];
+    SharedPoolMemoryManager& manger = SharedPoolMemoryManager::Open(buffer, sizeof(buffer), true);
+    REQUIRE(manger.capacity() == sizeof(buffer));
+    REQUIRE(manger.allocated() == 0);
+    REQUIRE(manger.allocations() == 0);
+    REQUIRE(manger.root() == nullptr);
+
+    // Blocks are aligned to the rounded up size (up to 64 bytes)
+    void* ptr1 = manger.malloc(24, 8);
+    REQUIRE(ptr1 != nullptr);
+    REQUIRE(Memory::IsAligned(ptr1, 32));
+    void* ptr2 = manger.malloc(1000, 64);
+    REQUIRE(ptr2 != nullptr);
+    REQUIRE(manger.allocated() == 1024);
+    REQUIRE(manger.allocations() == 2);
+
+    // Root object pointer is published for other processes
+    manger.root(ptr2);
+    REQUIRE(manger.root() == ptr2);
+    REQUIRE(&SharedPoolMemoryManager::Open(buffer, sizeof(buffer), false) == &manger);
+    REQUIRE(SharedPoolMemoryManager::Open(buffer, sizeof(buffer), false).root() == ptr2);
+
+    // Freed blocks are reused by the same size class
+    manger.free(ptr1, 24);
+    REQUIRE(manger.malloc(32) == ptr1);
+    manger.free(ptr1, 32);
+    manger.free(ptr2, 1000);
+    REQUIRE(manger.allocated() == 0);
+    REQUIRE(manger.allocations() == 0);
+
+    // Buffer is exhausted
+    REQUIRE(manger.malloc(65536) == nullptr);
+
+    manger.reset();
+    REQUIRE(manger.root() == nullptr);
+}
+
+TEST_CASE("Shared memory pool manager with multiple threads", "[CppCommon][Memory]")
+{
+    const size_t threads_count = 4;
+    const size_t items_count = 10000;
+
+    std::vector<uint8_t> buffer(16 * 1024 * 1024 + 64);
+    SharedPoolMemoryManager& manger = SharedPoolMemoryManager::Open(Memory::Align(buffer.data(), 64), buffer.size() - 64, true);
+
+    // Blocks are allocated and freed concurrently through the same free lists
+    std::atomic<size_t> errors(0);
+    std::vector<std::thread> threads;
+    for (size_t thread = 0; thread < threads_count; ++thread)
+    {
+        threads.emplace_back([&manger, &errors, thread, items_count]()
+        {
+            std::vector<std::pair<uint8_t*, size_t>> blocks;
+            for (size_t i = 0; i < items_count; ++i)
+            {
+                size_t size = 8 + (i % 500);
+                uint8_t* ptr = (uint8_t*)manger.malloc(size);
+                if (ptr == nullptr)
+                    ++errors;
+                else
+                {
+                    std::memset(ptr, (int)thread, size);
+                    blocks.emplace_back(ptr, size);
+                }
+
+                // Free every second block immediately to race on the free lists
+                if ((i % 2) == 1)
+                {
+                    auto [block, length] = blocks.back();
+                    blocks.pop_back();
+                    if ((block[0] != thread) || (block[length - 1] != thread))
+                        ++errors;
+                    manger.free(block, length);
+                }
+            }
+            for (auto [block, length] : blocks)
+            {
+                if ((block[0] != thread) || (block[length - 1] != thread))
+                    ++errors;
+                manger.free(block, length);
+            }
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+    REQUIRE(errors == 0);
+    REQUIRE(manger.allocated() == 0);
+    REQUIRE(manger.allocations() == 0);
+}
+
+TEST_CASE("Shared pool allocator with containers in shared memory", "[CppCommon][Memory]")
+{
+    struct Symbol
+    {
+        uint64_t id;
+        char name[16];
+    };
+
+    typedef SharedPoolAllocator<std::pair<uint64_t, Symbol>> allocator;
+    typedef HashMap<uint64_t, Symbol, std::hash<uint64_t>, std::equal_to<uint64_t>, allocator, HashMapGroupProbing> hashmap;
+    typedef FlatMap<uint64_t, uint64_t, std::less<uint64_t>, SharedPoolAllocator<std::pair<uint64_t, uint64_t>>> flatmap;
+    typedef std::vector<uint64_t, SharedPoolAllocator<uint64_t>> vector;
+
+    struct Tables
+    {
+        hashmap symbols;
+        flatmap prices;
+        vector history;
+
+        explicit Tables(SharedPoolMemoryManager& manager)
+            : symbols(16, 0, std::hash<uint64_t>(), std::equal_to<uint64_t>(), allocator(manager)),
+              prices(16, std::less<uint64_t>(), SharedPoolAllocator<std::pair<uint64_t, uint64_t>>(manager)),
+              history(SharedPoolAllocator<uint64_t>(manager))
+        {}
+    };
+
+    const char* name = "shared_allocator_test";
+    const size_t size = 4 * 1024 * 1024;
+
+    // Fill tables in the first mapping of the shared memory
+    SharedMemory shared1(name, size);
+    SharedPoolMemoryManager& manager1 = SharedPoolMemoryManager::Open(shared1);
+    REQUIRE(shared1.owner());
+    Tables* tables1 = SharedPoolAllocator<Tables>(manager1).Create(manager1);
+    for (uint64_t i = 1; i <= 1000; ++i)
+    {
+        Symbol symbol = { i, {} };
+        std::snprintf(symbol.name, sizeof(symbol.name), "SYM%llu", (unsigned long long)i);
+        tables1->symbols.emplace(i, symbol);
+        tables1->prices.emplace(i * 10, i);
+        tables1->history.push_back(i);
+    }
+    tables1->prices.freeze();
+    manager1.root(tables1);
+
+    // Read tables from the second mapping of the shared memory at the other address
+    SharedMemory shared2(name, size);
+    SharedPoolMemoryManager& manager2 = SharedPoolMemoryManager::Open(shared2);
+    REQUIRE(!shared2.owner());
+    REQUIRE(&manager2 != &manager1);
+    const Tables* tables2 = (const Tables*)manager2.root();
+    REQUIRE(tables2 != nullptr);
+    REQUIRE(tables2 != tables1);
+    REQUIRE(tables2->symbols.size() == 1000);
+    REQUIRE(tables2->prices.size() == 1000);
+    REQUIRE(tables2->history.size() == 1000);
+    for (uint64_t i = 1; i <= 1000; ++i)
+    {
+        auto symbol = tables2->symbols.find(i);
+        REQUIRE(symbol != tables2->symbols.end());
+        REQUIRE(symbol->second.id == i);
+        REQUIRE(std::strcmp(symbol->second.name, ("SYM" + std::to_string(i)).c_str()) == 0);
+        auto price = tables2->prices.find(i * 10);
+        REQUIRE(price != tables2->prices.end());
+        REQUIRE(price->second == i);
+        REQUIRE(tables2->history[i - 1] == i);
+    }
+    REQUIRE(tables2->symbols.find(1001) == tables2->symbols.end());
+
+    // Release tables back to the shared memory
+    manager1.root(nullptr);
+    SharedPoolAllocator<Tables>(manager1).Release(tables1);
+    REQUIRE(manager2.allocated() == 0);
+    REQUIRE(manager2.allocations() == 0);
+}
+
+TEST_CASE("Slab memory manager", "[CppCommon][Memory]")
+{
+    DefaultMemoryManager auxiliary;
+    SlabMemoryManager<DefaultMemoryManager> manger(auxiliary, { 24, 40, 100 }, 1024);
+    REQUIRE(manger.allocated() == 0);
+    REQUIRE(manger.allocations() == 0);
+    REQUIRE(manger.classes() == 3);
+    REQUIRE(manger.class_size(0) == 32);
+    REQUIRE(manger.class_size(1) == 48);
+    REQUIRE(manger.class_size(2) == 112);
+    REQUIRE(manger.slab() == 1024);
+    REQUIRE(manger.slabs() == 0);
+
+    // Blocks of the same size class are allocated from the same slab
+    uint8_t* ptr1 = (uint8_t*)manger.malloc(1);
+    uint8_t* ptr2 = (uint8_t*)manger.malloc(32);
+    REQUIRE(ptr2 == (ptr1 + 32));
+    REQUIRE(Memory::IsAligned(ptr1, alignof(std::max_align_t)));
+    REQUIRE(manger.allocated() == 33);
+    REQUIRE(manger.allocations() == 2);
+    REQUIRE(manger.slabs() == 1);
+
+    // Freed blocks are reused
+    manger.free(ptr1, 1);
+    REQUIRE(manger.malloc(20) == ptr1);
+
+    // Other size classes use their own slabs
+    void* ptr3 = manger.malloc(100);
+    REQUIRE(ptr3 != nullptr);
+    REQUIRE(manger.slabs() == 2);
+
+    // Huge blocks are allocated from the auxiliary memory manager
+    void* ptr4 = manger.malloc(1000);
+    REQUIRE(ptr4 != nullptr);
+    REQUIRE(manger.slabs() == 2);
+    REQUIRE(manger.allocated() == 1152);
+    REQUIRE(manger.allocations() == 4);
+
+    manger.free(ptr1, 20);
+    manger.free(ptr2, 32);
+    manger.free(ptr3, 100);
+    manger.free(ptr4, 1000);
+    REQUIRE(manger.allocated() == 0);
+    REQUIRE(manger.allocations() == 0);
+
+    // Filling several slabs
+    std::vector<void*> blocks;
+    for (int i = 0; i < 100; ++i)
+        blocks.push_back(manger.malloc(48));
+    REQUIRE(manger.slabs() == 7);
+    for (auto block : blocks)
+        manger.free(block, 48);
+    blocks.clear();
+
+    // Reset keeps slabs for reuse
+    manger.reset();
+    for (int i = 0; i < 100; ++i)
+        blocks.push_back(manger.malloc(48));
+    REQUIRE(manger.slabs() == 7);
+    for (auto block : blocks)
+        manger.free(block, 48);
+
+    manger.clear();
+    REQUIRE(manger.slabs() == 0);
+}
+
+TEST_CASE("Slab allocator with stl containers", "[CppCommon][Memory]")
+{
+    DefaultMemoryManager auxiliary;
+    SlabMemoryManager<DefaultMemoryManager> manger(auxiliary);
+    SlabAllocator<std::pair<const int, int>, DefaultMemoryManager> alloc(manger);
+
+    std::map<int, int, std::less<>, decltype(alloc)> m(alloc);
+    for (int i = 0; i < 1000; ++i)
+        m[i] = i * 10;
+    m.clear();
+
+    std::list<int, SlabAllocator<int, DefaultMemoryManager>> l(alloc);
+    for (int i = 0; i < 1000; ++i)
+        l.push_back(i);
+    l.clear();
+
+    std::vector<int, SlabAllocator<int, DefaultMemoryManager>> v(alloc);
+    for (int i = 0; i < 1000; ++i)
+        v.push_back(i);
+    v.clear();
+    v.shrink_to_fit();
+
+    REQUIRE(manger.allocated() == 0);
+    REQUIRE(manger.allocations() == 0);
+}
+
+TEST_CASE("Memory resources with pmr containers", "[CppCommon][Memory]")
+{
+    DefaultMemoryManager auxiliary;
+
+    {
+        ArenaMemoryManager<DefaultMemoryManager> manger(auxiliary);
+        ArenaMemoryResource<DefaultMemoryManager> resource(manger);
+        std::pmr::vector<int> v(&resource);
+        for (int i = 0; i < 1000; ++i)
+            v.push_back(i);
+        REQUIRE(v.size() == 1000);
+        REQUIRE(manger.allocations() > 0);
+        v.clear();
+        v.shrink_to_fit();
+        REQUIRE(manger.allocations() == 0);
+    }
+
+    {
+        PoolMemoryManager<DefaultMemoryManager> manger(auxiliary);
+        PoolMemoryResource<DefaultMemoryManager> resource(manger);
+        std::pmr::unordered_map<int, int> map(&resource);
+        for (int i = 0; i < 1000; ++i)
+            map.emplace(i, i + 1);
+        REQUIRE(map.size() == 1000);
+        REQUIRE(map[500] == 501);
+        REQUIRE(manger.allocations() > 0);
+        map.clear();
+        map.rehash(0);
+    }
+
+    {
+        SlabMemoryManager<DefaultMemoryManager> manger(auxiliary);
+        SlabMemoryResource<DefaultMemoryManager> resource(manger);
+        std::pmr::list<int> list(&resource);
+        for (int i = 0; i < 1000; ++i)
+            list.push_back(i);
+        REQUIRE(manger.allocations() == 1000);
+        list.clear();
+        REQUIRE(manger.allocations() == 0);
+    }
+
+    {
+        StackMemoryManager<1024> manger;
+        StackMemoryResource<1024> resource(manger);
+        std::pmr::vector<char> v(&resource);
+        v.reserve(100);
+        REQUIRE(manger.allocated() == 100);
+        REQUIRE(resource.is_equal(resource));
+        REQUIRE(!resource.is_equal(*std::pmr::new_delete_resource()));
+    }
+
+    {
+        // Over-aligned blocks are aligned even if the memory manager ignores alignment
+        DefaultMemoryResource resource(auxiliary);
+        for (size_t alignment : { 32, 64, 4096 })
+        {
+            void* ptr = resource.allocate(100, alignment);
+            REQUIRE(Memory::IsAligned(ptr, alignment));
+            std::memset(ptr, 0xFF, 100);
+            resource.deallocate(ptr, 100, alignment);
+        }
+    }
+
+    // Exhausted memory manager throws std::bad_alloc
+    NullMemoryManager null;
+    NullMemoryResource resource(null);
+    std::pmr::vector<int> v(&resource);
+    REQUIRE_THROWS_AS(v.reserve(10), std::bad_alloc);
+
+    REQUIRE(auxiliary.allocations() == 0);
+}
+
+namespace {
+
+void* profiled_small(ProfilerMemoryManager<DefaultMemoryManager>& manger) { return manger.malloc(16); }
+void* profiled_large(ProfilerMemoryManager<DefaultMemoryManager>& manger) { return manger.malloc(1024); }
+
+} // namespace
+
+TEST_CASE("Profiler memory manager", "[CppCommon][Memory]")
+{
+    DefaultMemoryManager auxiliary;
+    ProfilerMemoryManager<DefaultMemoryManager> manger(auxiliary, 1);
+    REQUIRE(manger.rate() == 1);
+
+    std::vector<void*> small;
+    std::vector<void*> large;
+    for (int i = 0; i < 100; ++i)
+    {
+        small.push_back(profiled_small(manger));
+        large.push_back(profiled_large(manger));
+    }
+    REQUIRE(manger.allocations() == 200);
+    REQUIRE(manger.samples() == 200);
+    REQUIRE(manger.dropped() == 0);
+
+    auto sites = manger.sites(2);
+    REQUIRE(sites.size() == 2);
+    REQUIRE(sites[0].samples == 100);
+    REQUIRE(sites[0].total == 102400);
+    REQUIRE(sites[0].live == 102400);
+    REQUIRE(sites[1].total == 1600);
+    REQUIRE(!sites[0].trace.frames().empty());
+
+    // Freed blocks are not live anymore
+    for (auto ptr : large)
+        manger.free(ptr, 1024);
+    sites = manger.sites(2, true);
+    REQUIRE(sites[0].live == 1600);
+    REQUIRE(sites[1].live == 0);
+    REQUIRE(sites[1].total == 102400);
+    REQUIRE(!manger.report().empty());
+
+    for (auto ptr : small)
+        manger.free(ptr, 16);
+    REQUIRE(manger.allocations() == 0);
+}
+
+TEST_CASE("Profiler memory manager with sampling", "[CppCommon][Memory]")
+{
+    DefaultMemoryManager auxiliary;
+    ProfilerMemoryManager<DefaultMemoryManager> manger(auxiliary, 10);
+
+    std::vector<void*> blocks;
+    for (int i = 0; i < 1000; ++i)
+        blocks.push_back(profiled_small(manger));
+    REQUIRE(manger.samples() >= 99);
+    REQUIRE(manger.samples() <= 101);
+
+    auto sites = manger.sites(1);
+    REQUIRE(sites.size() == 1);
+    REQUIRE(sites[0].allocations == (sites[0].samples * 10));
+    REQUIRE(sites[0].live == (sites[0].samples * 160));
+
+    for (auto ptr : blocks)
+        manger.free(ptr, 16);
+    REQUIRE(manger.sites(1)[0].live == 0);
+}
+
+TEST_CASE("Trace memory manager", "[CppCommon][Memory]")
+{
+    DefaultMemoryManager auxiliary;
+    AllocationTrace trace;
+    TraceMemoryManager<DefaultMemoryManager> manager(auxiliary, trace);
+
+    void* ptr1 = manager.malloc(10);
+    void* ptr2 = manager.malloc(100, 64);
+    manager.free(ptr1, 10);
+    void* ptr3 = manager.malloc(1000);
+    manager.free(ptr3, 1000);
+    manager.free(ptr2, 100);
+    REQUIRE(manager.allocations() == 0);
+
+    REQUIRE(trace.size() == 6);
+    REQUIRE(trace.allocations() == 3);
+    REQUIRE(trace.peak() == 1100);
+    REQUIRE(trace.threads() == 1);
+
+    const auto& events = trace.events();
+    REQUIRE((!events[0].free && (events[0].block == 0) && (events[0].size == 10)));
+    REQUIRE((!events[1].free && (events[1].block == 1) && (events[1].alignment == 64)));
+    REQUIRE((events[2].free && (events[2].block == 0)));
+    REQUIRE((!events[3].free && (events[3].block == 2)));
+    REQUIRE((events[4].free && (events[4].block == 2)));
+    REQUIRE((events[5].free && (events[5].block == 1)));
+
+    // Save and load the allocation trace
+    Path path("allocation.trace");
+    trace.Save(path);
+    AllocationTrace loaded;
+    loaded.Load(path);
+    REQUIRE(loaded.size() == trace.size());
+    REQUIRE(loaded.allocations() == trace.allocations());
+    REQUIRE(loaded.peak() == trace.peak());
+    for (size_t i = 0; i < loaded.size(); ++i)
+    {
+        REQUIRE(loaded.events()[i].block == events[i].block);
+        REQUIRE(loaded.events()[i].size == events[i].size);
+        REQUIRE(loaded.events()[i].free == events[i].free);
+    }
+
+    // Truncated allocation trace is rejected
+    auto buffer = File::ReadAllBytes(path);
+    File::WriteAllBytes(path, buffer.data(), buffer.size() - 1);
+    REQUIRE_THROWS_AS(loaded.Load(path), std::invalid_argument);
+    File::Remove(path);
+}
+
+TEST_CASE("Allocation trace replay", "[CppCommon][Memory]")
+{
+    DefaultMemoryManager auxiliary;
+    ConcurrentPoolMemoryManager<DefaultMemoryManager> pool(auxiliary);
+    AllocationTrace trace;
+    TraceMemoryManager<ConcurrentPoolMemoryManager<DefaultMemoryManager>> manager(pool, trace);
+
+    // Record allocations of several threads with cross-thread frees
+    std::vector<std::vector<void*>> blocks(4);
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < blocks.size(); ++t)
+    {
+        threads.emplace_back([&manager, &blocks, t]()
+        {
+            for (int i = 0; i < 1000; ++i)
+            {
+                blocks[t].push_back(manager.malloc(16 + (i % 64)));
+                if ((i % 2) == 0)
+                {
+                    manager.free(blocks[t].back(), 16 + (i % 64));
+                    blocks[t].back() = nullptr;
+                }
+            }
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+    for (auto& thread : blocks)
+        for (size_t i = 0; i < thread.size(); ++i)
+            if (thread[i] != nullptr)
+                manager.free(thread[i], 16 + (i % 64));
+    REQUIRE(trace.allocations() == 4000);
+    REQUIRE(trace.size() == 8000);
+
+    DefaultMemoryManager replay;
+    AllocationReplay result = trace.Replay(replay);
+    REQUIRE(result.events == 8000);
+    REQUIRE(result.failures == 0);
+    REQUIRE(result.peak_live == trace.peak());
+    REQUIRE(replay.allocations() == 0);
+
+    DefaultMemoryManager concurrent_auxiliary;
+    ConcurrentPoolMemoryManager<DefaultMemoryManager> concurrent(concurrent_auxiliary);
+    result = trace.Replay(concurrent, true);
+    REQUIRE(result.events == 8000);
+    REQUIRE(result.failures == 0);
+
+    // Allocation failures are counted and not replayed
+    auto stack = std::make_unique<StackMemoryManager<1024>>();
+    result = trace.Replay(*stack);
+    REQUIRE(result.failures > 0);
+}
@@ -5,6 +5,12 @@
 #include "test.h"
 
 #include "memory/memory.h"
+#include "memory/memory_pressure.h"
+
+#include <algorithm>
+#include <cstring>
+#include <thread>
+#include <vector>
 
 using namespace CppCommon;
 
@@ -12,6 +18,52 @@ TEST_CASE("Memory management", "[CppCommon][Memory]")
 {
     REQUIRE(Memory::RamTotal() > 0);
     REQUIRE(Memory::RamFree() > 0);
+
+    // Cgroup values are unknown outside of the limited cgroup
+    REQUIRE(((Memory::CgroupLimit() == -1) || (Memory::CgroupLimit() > 0)));
+    REQUIRE(Memory::CgroupUsage() >= -1);
+
+    MemoryUsage usage = MemoryUsage::Current();
+    REQUIRE(usage.limit > 0);
+    REQUIRE(usage.usage >= 0);
+    REQUIRE(usage.ratio() >= 0.0);
+}
+
+TEST_CASE("Memory pressure", "[CppCommon][Memory]")
+{
+    // Memory pressure notifier without the threshold never notifies by the usage
+    MemoryPressure relaxed(2.0, false);
+    REQUIRE(!relaxed.psi());
+    REQUIRE(!relaxed.Poll());
+
+    // Memory pressure notifier with the zero threshold always notifies
+    MemoryPressure pressure(0.0);
+    int notified1 = 0;
+    int notified2 = 0;
+    uint64_t id1 = pressure.Subscribe([&notified1](const MemoryUsage& usage) { REQUIRE(usage.limit > 0); ++notified1; });
+    uint64_t id2 = pressure.Subscribe([&notified2](const MemoryUsage&) { ++notified2; });
+    REQUIRE(id1 != id2);
+
+    REQUIRE(pressure.Poll());
+    REQUIRE(notified1 == 1);
+    REQUIRE(notified2 == 1);
+
+    REQUIRE(pressure.Unsubscribe(id1));
+    REQUIRE(!pressure.Unsubscribe(id1));
+    REQUIRE(pressure.Poll());
+    REQUIRE(notified1 == 1);
+    REQUIRE(notified2 == 2);
+    REQUIRE(pressure.notifications() == 2);
+
+    // Dedicated memory pressure thread
+    REQUIRE(pressure.Start(Timespan::milliseconds(1)));
+    REQUIRE(!pressure.Start());
+    REQUIRE(pressure.IsRunning());
+    while (pressure.notifications() < 5)
+        std::this_thread::yield();
+    REQUIRE(pressure.Stop());
+    REQUIRE(!pressure.Stop());
+    REQUIRE(!pressure.IsRunning());
 }
 
 TEST_CASE("Memory align", "[CppCommon][Memory]")
@@ -46,3 +98,109 @@ TEST_CASE("Memory align", "[CppCommon][Memory]")
     REQUIRE(Memory::Align((void*)0x7fff5ebcf47e, 32, false) == (void*)0x7fff5ebcf460);
     REQUIRE(Memory::Align((void*)0x7fff5ebcf4af, 64, false) == (void*)0x7fff5ebcf480);
 }
+
+TEST_CASE("Memory zero check", "[CppCommon][Memory]")
+{
+    std::vector<uint8_t> buffer(1024 + 64, 0);
+
+    // Check all offsets and sizes around SIMD block boundaries
+    for (size_t offset : { 0, 1, 7, 15, 31, 63 })
+    {
+        for (size_t size : { 0, 1, 7, 8, 9, 63, 64, 65, 127, 128, 129, 255, 1000, 1024 })
+        {
+            uint8_t* ptr = buffer.data() + offset;
+            REQUIRE(Memory::IsZero(ptr, size));
+            for (size_t i = 0; i < size; ++i)
+            {
+                ptr[i] = 0x80;
+                REQUIRE(!Memory::IsZero(ptr, size));
+                ptr[i] = 0;
+            }
+
+            // Bytes out of the checked range must be ignored
+            ptr[size] = 1;
+            REQUIRE(Memory::IsZero(ptr, size));
+            ptr[size] = 0;
+        }
+    }
+}
+
+TEST_CASE("Memory zero fill", "[CppCommon][Memory]")
+{
+    std::vector<uint8_t> buffer(4096 + 64);
+
+    for (size_t offset : { 0, 3, 8, 61 })
+    {
+        for (size_t size : { 1, 7, 64, 100, 4096 })
+        {
+            std::fill(buffer.begin(), buffer.end(), 0xAA);
+            Memory::ZeroFill(buffer.data() + offset, size);
+            REQUIRE(Memory::IsZero(buffer.data() + offset, size));
+            REQUIRE(std::count(buffer.begin(), buffer.end(), (uint8_t)0xAA) == (std::ptrdiff_t)(buffer.size() - size));
+        }
+    }
+}
+
+TEST_CASE("Memory stream fill and copy", "[CppCommon][Memory]")
+{
+    std::vector<uint8_t> source(4 * 1024 * 1024 + 256);
+    std::vector<uint8_t> destination(source.size());
+    for (size_t i = 0; i < source.size(); ++i)
+        source[i] = (uint8_t)(i * 31 + 7);
+
+    // Check small buffers and big buffers with unaligned heads and tails
+    for (size_t offset : { 0, 5, 64, 111 })
+    {
+        for (size_t size : { 0, 100, 4 * 1024, 4 * 1024 * 1024 + 77 })
+        {
+            std::fill(destination.begin(), destination.end(), 0);
+            Memory::StreamFill(destination.data() + offset, size, 0x5A);
+            REQUIRE(std::count(destination.begin(), destination.end(), (uint8_t)0x5A) == (std::ptrdiff_t)size);
+            REQUIRE(std::count(destination.begin() + offset, destination.begin() + offset + size, (uint8_t)0x5A) == (std::ptrdiff_t)size);
+
+            Memory::StreamFill(destination.data() + offset, size);
+            REQUIRE(Memory::IsZero(destination.data(), destination.size()));
+
+            Memory::StreamCopy(destination.data() + offset, source.data() + 3, size);
+            REQUIRE(std::memcmp(destination.data() + offset, source.data() + 3, size) == 0);
+            REQUIRE(Memory::IsZero(destination.data(), offset));
+            REQUIRE(Memory::IsZero(destination.data() + offset + size, destination.size() - offset - size));
+        }
+    }
+}
+
+TEST_CASE("Memory random fill", "[CppCommon][Memory]")
+{
+    std::vector<uint8_t> buffer1(1000 + 3, 0);
+    std::vector<uint8_t> buffer2(1000 + 3, 0);
+
+    Memory::RandomFill(buffer1.data(), buffer1.size());
+    REQUIRE(!Memory::IsZero(buffer1.data(), buffer1.size()));
+    Memory::CryptoFill(buffer2.data(), buffer2.size());
+    REQUIRE(!Memory::IsZero(buffer2.data(), buffer2.size()));
+
+    // Fast random bytes of the same seed are reproducible
+    Memory::FastRandomFill(buffer1.data(), buffer1.size(), 123);
+    Memory::FastRandomFill(buffer2.data(), buffer2.size(), 123);
+    REQUIRE(buffer1 == buffer2);
+    Memory::FastRandomFill(buffer2.data(), buffer2.size(), 321);
+    REQUIRE(buffer1 != buffer2);
+
+    // Fast random bytes of the per-thread generator are not repeated
+    Memory::FastRandomFill(buffer1.data(), buffer1.size());
+    Memory::FastRandomFill(buffer2.data(), buffer2.size());
+    REQUIRE(!Memory::IsZero(buffer1.data(), buffer1.size()));
+    REQUIRE(buffer1 != buffer2);
+
+    // Fast random bytes should be uniformly distributed
+    std::vector<uint8_t> buffer(1024 * 1024);
+    Memory::FastRandomFill(buffer.data(), buffer.size());
+    size_t counts[256] = { 0 };
+    for (uint8_t byte : buffer)
+        ++counts[byte];
+    for (size_t count : counts)
+    {
+        REQUIRE(count > 3500);
+        REQUIRE(count < 4700);
+    }
+}
@@ -0,0 +1,111 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "test.h"
+
+#include "memory/object_pool.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace CppCommon;
+
+namespace {
+
+struct Item
+{
+    static std::atomic<int> alive;
+
+    int value;
+
+    explicit Item(int v) : value(v) { ++alive; }
+    ~Item() { --alive; }
+};
+
+std::atomic<int> Item::alive(0);
+
+} // namespace
+
+TEST_CASE("Object pool", "[CppCommon][Memory]")
+{
+    DefaultMemoryManager auxiliary;
+    {
+        ObjectPool<Item> pool(auxiliary, 4, 2);
+        REQUIRE(pool.chunk() == 4);
+        REQUIRE(pool.chunks() == 0);
+        REQUIRE(pool.max_capacity() == 8);
+
+        // Objects are constructed in place
+        Item* item = pool.Create(123);
+        REQUIRE(item != nullptr);
+        REQUIRE(item->value == 123);
+        REQUIRE(Item::alive == 1);
+        REQUIRE(pool.chunks() == 1);
+
+        // Released objects are destroyed and recycled
+        pool.Release(item);
+        REQUIRE(Item::alive == 0);
+        REQUIRE(pool.Create(456) == item);
+        pool.Release(item);
+
+        // Bulk acquire is limited with the max capacity
+        std::vector<Item*> items;
+        REQUIRE(pool.Acquire(10, std::back_inserter(items), 7) == 8);
+        REQUIRE(items.size() == 8);
+        REQUIRE(Item::alive == 8);
+        REQUIRE(pool.chunks() == 2);
+        REQUIRE(pool.Create(1) == nullptr);
+        for (auto i : items)
+            REQUIRE(i->value == 7);
+
+        // Bulk release
+        pool.Release(items.begin(), items.end());
+        REQUIRE(Item::alive == 0);
+        items.clear();
+        REQUIRE(pool.Acquire(8, std::back_inserter(items), 8) == 8);
+        REQUIRE(pool.chunks() == 2);
+        pool.Release(items.begin(), items.end());
+    }
+    REQUIRE(auxiliary.allocations() == 0);
+}
+
+TEST_CASE("Object pool with multiple threads", "[CppCommon][Memory]")
+{
+    DefaultMemoryManager auxiliary;
+    ObjectPool<Item> pool(auxiliary, 64);
+
+    const int threads_count = 4;
+    const int iterations = 10000;
+
+    std::atomic<bool> valid(true);
+    std::vector<std::thread> threads;
+    for (int thread = 0; thread < threads_count; ++thread)
+    {
+        threads.emplace_back([&pool, &valid, thread]()
+        {
+            std::vector<Item*> items;
+            for (int i = 0; i < iterations; ++i)
+            {
+                items.push_back(pool.Create(i));
+                if ((i % 100) == 99)
+                {
+                    for (int j = 0; j < 100; ++j)
+                        if (items[j]->value != (i - 99 + j))
+                            valid = false;
+                    pool.Release(items.begin(), items.end());
+                    items.clear();
+                    pool.Acquire(10, std::back_inserter(items), thread);
+                    pool.Release(items.begin(), items.end());
+                    items.clear();
+                }
+            }
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+
+    REQUIRE(valid);
+    REQUIRE(Item::alive == 0);
+}
@@ -0,0 +1,84 @@
+//
+// Created by Ivan Shynkarenka on 15.10.2026
+//
+
+#include "test.h"
+
+#include "memory/scratch.h"
+
+#include <thread>
+
+using namespace CppCommon;
+
+TEST_CASE("Scratch scope", "[CppCommon][Memory]")
+{
+    auto& manager = Scratch::manager();
+    REQUIRE(Scratch::created());
+    REQUIRE(&Scratch::manager() == &manager);
+
+    size_t size = manager.size();
+    {
+        ScratchScope scope;
+
+        ScratchVector<int> numbers;
+        for (int i = 0; i < 1000; ++i)
+            numbers.push_back(i);
+        REQUIRE(numbers.size() == 1000);
+        REQUIRE(numbers[999] == 999);
+
+        ScratchString text("Scratch string which does not fit into the small string buffer");
+        text += text;
+        REQUIRE(text.size() == 124);
+        REQUIRE(manager.size() > size);
+
+        // Nested scratch scope
+        size_t outer = manager.size();
+        {
+            ScratchScope inner;
+            ScratchVector<double> values(100, 1.0);
+            REQUIRE(manager.size() > outer);
+        }
+        REQUIRE(manager.size() == outer);
+    }
+
+    // Scope pops all scratch memory at once
+    REQUIRE(manager.size() == size);
+    REQUIRE(manager.allocations() == 0);
+}
+
+TEST_CASE("Scratch overflow", "[CppCommon][Memory]")
+{
+    // Exhausted scratch stack allocates blocks from the heap
+    ScratchScope scope;
+    ScratchVector<uint8_t> large(Scratch::capacity() * 2, 1);
+    REQUIRE(large.size() == (Scratch::capacity() * 2));
+    REQUIRE(large.back() == 1);
+}
+
+TEST_CASE("Scratch threads", "[CppCommon][Memory]")
+{
+    const size_t capacity = Scratch::capacity();
+    Scratch::capacity(4096);
+
+    // Each thread creates its own scratch stack with the configured capacity
+    const ArenaMemoryManager<DefaultMemoryManager>* main = &Scratch::manager();
+    const ArenaMemoryManager<DefaultMemoryManager>* other = nullptr;
+    size_t other_capacity = 0;
+    bool created = true;
+    std::thread thread([&]()
+    {
+        created = Scratch::created();
+        ScratchScope scope;
+        ScratchVector<int> numbers(10, 0);
+        other = &Scratch::manager();
+        other_capacity = Scratch::manager().capacity();
+    });
+    thread.join();
+
+    REQUIRE(!created);
+    REQUIRE(other != main);
+    REQUIRE(other_capacity == 4096);
+
+    Scratch::capacity(capacity);
+    REQUIRE(Scratch::capacity() == capacity);
+}
@@ -0,0 +1,75 @@
+//
+// Created by Ivan Shynkarenka on 15.10.2026
+//
+
+#ifndef CPPCOMMON_TESTS_TEST_STREAMS_H
+#define CPPCOMMON_TESTS_TEST_STREAMS_H
+
+#include "common/reader.h"
+#include "common/writer.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <string>
+#include <string_view>
+
+// Reader which returns the content by small chunks
+class ChunkReader : public CppCommon::Reader
+{
+public:
+    ChunkReader(std::string_view content, size_t chunk) : reads(0), _content(content), _chunk(chunk) {}
+
+    size_t reads;
+
+    size_t Read(void* buffer, size_t size) override
+    {
+        ++reads;
+        size = std::min(std::min(size, _chunk), _content.size());
+        std::memcpy(buffer, _content.data(), size);
+        _content.remove_prefix(size);
+        return size;
+    }
+
+private:
+    std::string_view _content;
+    size_t _chunk;
+};
+
+// Writer which collects the content and accepts a limited count of bytes
+class StringWriter : public CppCommon::Writer
+{
+public:
+    explicit StringWriter(size_t chunk_size = SIZE_MAX) : writes(0), vectored(0), flushes(0), chunk(chunk_size), limit(SIZE_MAX) {}
+
+    std::string content;
+    size_t writes;
+    size_t vectored;
+    size_t flushes;
+    // Count of bytes accepted by a single write
+    size_t chunk;
+    // Count of bytes accepted in total
+    size_t limit;
+
+    using CppCommon::Writer::Write;
+    using CppCommon::Writer::WriteV;
+
+    size_t Write(const void* buffer, size_t size) override
+    {
+        ++writes;
+        size = std::min(std::min(size, chunk), limit - content.size());
+        content.append((const char*)buffer, size);
+        return size;
+    }
+
+    size_t WriteV(std::span<const WriteBuffer> buffers) override
+    {
+        ++vectored;
+        return CppCommon::Writer::WriteV(buffers);
+    }
+
+    void Flush() override { ++flushes; }
+};
+
+#endif // CPPCOMMON_TESTS_TEST_STREAMS_H
@@ -3,8 +3,12 @@
 //
 
 #include "test.h"
+#include "test_streams.h"
 
+#include "common/writer.h"
+#include "errors/exceptions.h"
 #include "string/encoding.h"
+#include "string/format.h"
 
 using namespace CppCommon;
 
@@ -12,6 +16,7 @@ namespace {
 
 void test(const std::string& utf8, const std::u16string& utf16, const std::u32string& utf32)
 {
+    REQUIRE(Encoding::IsUTF8(utf8));
     REQUIRE(Encoding::UTF8toUTF16(utf8) == utf16);
     REQUIRE(Encoding::UTF8toUTF32(utf8) == utf32);
     REQUIRE(Encoding::UTF16toUTF8(utf16) == utf8);
@@ -37,6 +42,104 @@ TEST_CASE("Encoding", "[CppCommon][String]")
     test("\xCE\xA9", u"\x03A9", U"\x000003A9");
     test("\xE2\x84\xA6", u"\x2126", U"\x00002126");
     test("\xF0\x9D\x93\x83", u"\xD835\xDCC3", U"\x0001D4C3");
+    test("\xF4\x8F\xBF\xBF", u"\xDBFF\xDFFF", U"\x0010FFFF");
+    test("", u"", U"");
+
+    // Long strings cover vectorized ASCII blocks and sequences across blocks
+    std::string utf8;
+    std::u16string utf16;
+    std::u32string utf32;
+    for (size_t i = 0; i < 200; ++i)
+    {
+        test(utf8, utf16, utf32);
+        switch (i % 7)
+        {
+            case 3:
+                utf8 += "\xCE\xA9";
+                utf16 += u"\x03A9";
+                utf32 += U"\x000003A9";
+                break;
+            case 5:
+                utf8 += "\xF0\x9D\x93\x83";
+                utf16 += u"\xD835\xDCC3";
+                utf32 += U"\x0001D4C3";
+                break;
+            default:
+                for (size_t j = 0; j < i % 37; ++j)
+                {
+                    utf8 += (char)('a' + j % 26);
+                    utf16 += (char16_t)('a' + j % 26);
+                    utf32 += (char32_t)('a' + j % 26);
+                }
+                break;
+        }
+    }
+}
+
+TEST_CASE("Encoding invalid UTF strings", "[CppCommon][String]")
+{
+    const char* invalid[] =
+    {
+        "\x80",                 // Unexpected continuation byte
+        "\xBF\x80",             // Two continuation bytes
+        "\xC0\x80",             // Overlong 2 bytes sequence
+        "\xC1\xBF",             // Overlong 2 bytes sequence
+        "\xE0\x80\x80",         // Overlong 3 bytes sequence
+        "\xF0\x80\x80\x80",     // Overlong 4 bytes sequence
+        "\xED\xA0\x80",         // Surrogate
+        "\xED\xBF\xBF",         // Surrogate
+        "\xF4\x90\x80\x80",     // Above U+10FFFF
+        "\xF5\x80\x80\x80",     // Invalid lead byte
+        "\xFF",                 // Invalid lead byte
+        "\xC2",                 // Truncated 2 bytes sequence
+        "\xE2\x84",             // Truncated 3 bytes sequence
+        "\xF0\x9D\x93",         // Truncated 4 bytes sequence
+        "\xC2\x41",             // Missing continuation byte
+        "\xE2\x84\xA6\xA6",     // Extra continuation byte
+    };
+
+    // Put invalid sequences at every position of vectorized blocks
+    for (const char* sequence : invalid)
+    {
+        for (size_t prefix = 0; prefix < 70; ++prefix)
+        {
+            std::string str = std::string(prefix, 'a') + sequence;
+            REQUIRE(!Encoding::IsUTF8(str));
+            REQUIRE(!Encoding::IsUTF8(str + "bcd"));
+            REQUIRE(!Encoding::IsUTF8(str + std::string(40, 'b')));
+            REQUIRE_THROWS_AS(Encoding::UTF8toUTF16(str), ArgumentException);
+            REQUIRE_THROWS_AS(Encoding::UTF8toUTF32(str + "bcd"), ArgumentException);
+            std::u32string buffer(str.size() + 40, 0);
+            REQUIRE(Encoding::UTF8toUTF32(str + std::string(40, 'b'), buffer.data()) == std::string::npos);
+        }
+    }
+
+    // Compare the validator with the decoder on pseudo-random mixtures of valid and invalid sequences
+    const char* fragments[] = { "a", "bcdefghijklmnopq", "\xCE\xA9", "\xE2\x84\xA6", "\xF0\x9D\x93\x83", "\xEF\xBF\xBF", "\x80", "\xC2", "\xED\xA0\x80", "\xF4\x90\x80\x80" };
+    uint32_t seed = 12345;
+    for (size_t i = 0; i < 2000; ++i)
+    {
+        std::string str;
+        size_t count = i % 40;
+        for (size_t j = 0; j < count; ++j)
+        {
+            seed = seed * 1103515245 + 12345;
+            size_t index = (seed >> 16) % ((i % 3 == 0) ? 10 : 6);
+            str += fragments[index];
+        }
+        std::u32string buffer(str.size(), 0);
+        REQUIRE(Encoding::IsUTF8(str) == (Encoding::UTF8toUTF32(str, buffer.data()) != std::string::npos));
+    }
+
+    // Unpaired surrogates and invalid code points
+    REQUIRE_THROWS_AS(Encoding::UTF16toUTF8(u"\xD835"), ArgumentException);
+    REQUIRE_THROWS_AS(Encoding::UTF16toUTF8(u"\xDCC3\xD835"), ArgumentException);
+    REQUIRE_THROWS_AS(Encoding::UTF16toUTF32(u"\xD835\x0061"), ArgumentException);
+    REQUIRE_THROWS_AS(Encoding::UTF32toUTF8(U"\x0000D800"), ArgumentException);
+    REQUIRE_THROWS_AS(Encoding::UTF32toUTF16(U"\x00110000"), ArgumentException);
+    char buffer[64];
+    REQUIRE(Encoding::UTF16toUTF8(std::u16string(20, u'a') + u"\xDC00", buffer) == std::string::npos);
+    REQUIRE(Encoding::UTF32toUTF8(std::u32string(20, U'a') + U"\x00110000", buffer) == std::string::npos);
 }
 
 TEST_CASE("Base16 Encoding", "[CppCommon][String]")
@@ -50,6 +153,31 @@ TEST_CASE("Base16 Encoding", "[CppCommon][String]")
     REQUIRE(Encoding::Base16Encode("foobar") == "666F6F626172");
     REQUIRE(Encoding::Base16Encode("Sample Base16 encoding: ~`'\"!?@#$%^&*(){}[]<>,.:;-+=_|/\\") == "53616D706C652042617365313620656E636F64696E673A207E602722213F402324255E262A28297B7D5B5D3C3E2C2E3A3B2D2B3D5F7C2F5C");
     REQUIRE(Encoding::Base16Decode("53616D706C652042617365313620656E636F64696E673A207E602722213F402324255E262A28297B7D5B5D3C3E2C2E3A3B2D2B3D5F7C2F5C") == "Sample Base16 encoding: ~`'\"!?@#$%^&*(){}[]<>,.:;-+=_|/\\");
+
+    // Encode and decode buffers of all lengths to cover vectorized blocks and tails
+    std::string bytes;
+    for (int i = 0; i < 256; ++i)
+        bytes += (char)i;
+    for (size_t size = 0; size <= bytes.size(); size += 7)
+    {
+        std::string encoded(size * 2, 0);
+        REQUIRE(Encoding::Base16Encode(bytes.data(), size, encoded.data(), true) == encoded.data() + encoded.size());
+        for (size_t i = 0; i < size; ++i)
+            REQUIRE(encoded.substr(i * 2, 2) == fmt::format("{:02x}", (uint8_t)bytes[i]));
+        std::string decoded(size, 0);
+        REQUIRE(Encoding::Base16Decode(encoded.data(), encoded.size(), decoded.data()));
+        REQUIRE(decoded == bytes.substr(0, size));
+    }
+
+    // Decode mixed case and reject invalid characters in vectorized blocks and tails
+    char buffer[32];
+    REQUIRE(Encoding::Base16Decode("00112233445566778899aAbBcCdDeEfF00112233445566778899AaBbCcDdEeFf", 64, buffer));
+    REQUIRE(std::string(buffer, 16) == std::string("\x00\x11\x22\x33\x44\x55\x66\x77\x88\x99\xAA\xBB\xCC\xDD\xEE\xFF", 16));
+    REQUIRE(!Encoding::Base16Decode("0011223344556677889gaabbccddeeff", 32, buffer));
+    REQUIRE(!Encoding::Base16Decode("00112233445566778899aabbccdd:eff", 32, buffer));
+    REQUIRE(!Encoding::Base16Decode("00112233445566778899aabbccddee\xFF\xFF", 32, buffer));
+    REQUIRE(!Encoding::Base16Decode("0g", 2, buffer));
+    REQUIRE(!Encoding::Base16Decode("000", 3, buffer));
 }
 
 TEST_CASE("Base32 Encoding", "[CppCommon][String]")
@@ -63,6 +191,29 @@ TEST_CASE("Base32 Encoding", "[CppCommon][String]")
     REQUIRE(Encoding::Base32Encode("foobar") == "MZXW6YTBOI======");
     REQUIRE(Encoding::Base32Encode("Sample Base32 encoding: ~`'\"!?@#$%^&*(){}[]<>,.:;-+=_|/\\") == "KNQW24DMMUQEEYLTMUZTEIDFNZRW6ZDJNZTTUID6MATSEIJ7IARSIJK6EYVCQKL3PVNV2PB6FQXDUOZNFM6V67BPLQ======");
     REQUIRE(Encoding::Base32Decode("KNQW24DMMUQEEYLTMUZTEIDFNZRW6ZDJNZTTUID6MATSEIJ7IARSIJK6EYVCQKL3PVNV2PB6FQXDUOZNFM6V67BPLQ======") == "Sample Base32 encoding: ~`'\"!?@#$%^&*(){}[]<>,.:;-+=_|/\\");
+
+    // Encode and decode buffers of all lengths with all padding sizes
+    std::string bytes;
+    for (int i = 0; i < 256; ++i)
+        bytes += (char)(i * 37);
+    for (size_t size = 0; size <= 64; ++size)
+    {
+        std::string encoded = Encoding::Base32Encode(bytes.substr(0, size));
+        REQUIRE(encoded.size() == ((size + 4) / 5) * 8);
+        char buffer[64];
+        REQUIRE(Encoding::Base32Decode(encoded, buffer) == size);
+        REQUIRE(std::string(buffer, size) == bytes.substr(0, size));
+    }
+
+    // Reject invalid characters and padding
+    char buffer[16];
+    REQUIRE(Encoding::Base32Decode("mzxw6ytb", buffer) == 5);
+    REQUIRE(Encoding::Base32Decode("MZXW6YT1", buffer) == std::string::npos);
+    REQUIRE(Encoding::Base32Decode("MZ=W6YTB", buffer) == std::string::npos);
+    REQUIRE(Encoding::Base32Decode("MZXW6Y==", buffer) == std::string::npos);
+    REQUIRE(Encoding::Base32Decode("MZXW6===MZXW6YTB", buffer) == std::string::npos);
+    REQUIRE(Encoding::Base32Decode("MZXW\xC6YTB", buffer) == std::string::npos);
+    REQUIRE(Encoding::Base32Decode("MZXW6YT", buffer) == std::string::npos);
 }
 
 TEST_CASE("Base64 Encoding", "[CppCommon][String]")
@@ -76,10 +227,201 @@ TEST_CASE("Base64 Encoding", "[CppCommon][String]")
     REQUIRE(Encoding::Base64Encode("foobar") == "Zm9vYmFy");
     REQUIRE(Encoding::Base64Encode("Sample Base64 encoding: ~`'\"!?@#$%^&*(){}[]<>,.:;-+=_|/\\") == "U2FtcGxlIEJhc2U2NCBlbmNvZGluZzogfmAnIiE/QCMkJV4mKigpe31bXTw+LC46Oy0rPV98L1w=");
     REQUIRE(Encoding::Base64Decode("U2FtcGxlIEJhc2U2NCBlbmNvZGluZzogfmAnIiE/QCMkJV4mKigpe31bXTw+LC46Oy0rPV98L1w=") == "Sample Base64 encoding: ~`'\"!?@#$%^&*(){}[]<>,.:;-+=_|/\\");
+
+    // Encode and decode buffers of all lengths to cover vectorized blocks and tails
+    const char base64[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    std::string bytes;
+    for (int i = 0; i < 512; ++i)
+        bytes += (char)((i * 131) ^ (i >> 3));
+    for (size_t size = 0; size <= bytes.size(); size += (size < 100) ? 1 : 13)
+    {
+        std::string input = bytes.substr(0, size);
+        std::string encoded(((size + 2) / 3) * 4, 0);
+        REQUIRE(Encoding::Base64Encode(input, encoded.data()) == encoded.size());
+
+        // Check with the bitwise reference encoding
+        for (size_t i = 0; i < (size * 8); i += 6)
+        {
+            size_t sextet = 0;
+            for (size_t j = i; j < (i + 6); ++j)
+                sextet = (sextet << 1) | ((j < (size * 8)) ? (((uint8_t)input[j / 8] >> (7 - (j % 8))) & 1) : 0);
+            REQUIRE(encoded[i / 6] == base64[sextet]);
+        }
+        REQUIRE(encoded.find('=') >= (size * 8 + 5) / 6);
+
+        std::string decoded(size, 0);
+        REQUIRE(Encoding::Base64Decode(encoded, decoded.data()) == size);
+        REQUIRE(decoded == input);
+        REQUIRE(Encoding::Base64Decode(encoded) == input);
+
+        // Reject invalid character at any position of the vectorized blocks and tails
+        if (size >= 3)
+        {
+            for (size_t i = 0; i < (encoded.size() - 4); i += 5)
+            {
+                std::string invalid = encoded;
+                invalid[i] = "=*\x80-_ "[i % 6];
+                REQUIRE(Encoding::Base64Decode(invalid, decoded.data()) == std::string::npos);
+            }
+        }
+    }
+
+    // Reject invalid length and padding
+    char buffer[16];
+    REQUIRE(Encoding::Base64Decode("", buffer) == 0);
+    REQUIRE(Encoding::Base64Decode("Zm9", buffer) == std::string::npos);
+    REQUIRE(Encoding::Base64Decode("Z===", buffer) == std::string::npos);
+    REQUIRE(Encoding::Base64Decode("Zg==Zg==", buffer) == std::string::npos);
+    REQUIRE(Encoding::Base64Decode("Zm9v!A==").empty());
 }
 
 TEST_CASE("URL Encoding", "[CppCommon][String]")
 {
     REQUIRE(Encoding::URLEncode("Sample URL encoding: ~`'\"!?@#$%^&*(){}[]<>,.:;-+=_|/\\") == "Sample+URL+encoding%3A+~%60%27%22%21%3F%40%23%24%25%5E%26%2A%28%29%7B%7D%5B%5D%3C%3E%2C.%3A%3B-%2B%3D_%7C/%5C");
     REQUIRE(Encoding::URLDecode("Sample+URL+encoding%3A+~%60%27%22%21%3F%40%23%24%25%5E%26%2A%28%29%7B%7D%5B%5D%3C%3E%2C.%3A%3B-%2B%3D_%7C/%5C") == "Sample URL encoding: ~`'\"!?@#$%^&*(){}[]<>,.:;-+=_|/\\");
+
+    // Check all characters at all positions of the vectorized blocks and tails
+    for (int ch = 0; ch < 256; ++ch)
+    {
+        bool safe = std::isalnum(ch) || (ch == '-') || (ch == '.') || (ch == '/') || (ch == '_') || (ch == '~');
+        std::string expected = safe ? std::string(1, (char)ch) : ((ch == ' ') ? "+" : fmt::format("%{:02X}", ch));
+        for (size_t position = 0; position < 40; position += 3)
+        {
+            std::string str(40, 'a');
+            str[position] = (char)ch;
+            char buffer[120];
+            size_t size = Encoding::URLEncode(str, buffer);
+            REQUIRE(std::string(buffer, size) == std::string(position, 'a') + expected + std::string(39 - position, 'a'));
+        }
+    }
+}
+
+TEST_CASE("JSON Encoding", "[CppCommon][String]")
+{
+    REQUIRE(Encoding::JsonEscape("").empty());
+    REQUIRE(Encoding::JsonEscape("plain text") == "plain text");
+    REQUIRE(Encoding::JsonEscape("\"quoted\" \\ \b\f\n\r\t \x01\x1F\x7F") == "\\\"quoted\\\" \\\\ \\b\\f\\n\\r\\t \\u0001\\u001f\x7F");
+    REQUIRE(Encoding::JsonEscape("\xD0\x9F\xD1\x80\xD0\xB8\xD0\xB2\xD0\xB5\xD1\x82") == "\xD0\x9F\xD1\x80\xD0\xB8\xD0\xB2\xD0\xB5\xD1\x82");
+
+    REQUIRE(Encoding::JsonUnescape("\\\"quoted\\\" \\\\ \\/ \\b\\f\\n\\r\\t \\u0001\\u001F") == "\"quoted\" \\ / \b\f\n\r\t \x01\x1F");
+    REQUIRE(Encoding::JsonUnescape("\\u041f\\u00e9 \\ud83d\\ude00") == "\xD0\x9F\xC3\xA9 \xF0\x9F\x98\x80");
+
+    // Reject invalid escape sequences and unpaired surrogates
+    char buffer[16];
+    REQUIRE(Encoding::JsonUnescape("abc\\", buffer) == std::string::npos);
+    REQUIRE(Encoding::JsonUnescape("\\x", buffer) == std::string::npos);
+    REQUIRE(Encoding::JsonUnescape("\\u12G4", buffer) == std::string::npos);
+    REQUIRE(Encoding::JsonUnescape("\\u123", buffer) == std::string::npos);
+    REQUIRE(Encoding::JsonUnescape("\\ud83d", buffer) == std::string::npos);
+    REQUIRE(Encoding::JsonUnescape("\\ude00", buffer) == std::string::npos);
+    REQUIRE_THROWS_AS(Encoding::JsonUnescape("\\q"), ArgumentException);
+
+    // Check all characters at all positions of the vectorized blocks and tails
+    for (int ch = 0; ch < 256; ++ch)
+    {
+        for (size_t position = 0; position < 40; position += 3)
+        {
+            std::string str(40, 'a');
+            str[position] = (char)ch;
+            std::string escaped = Encoding::JsonEscape(str);
+            bool special = (ch < 0x20) || (ch == '"') || (ch == '\\');
+            REQUIRE((escaped.size() > str.size()) == special);
+            REQUIRE(Encoding::JsonUnescape(escaped) == str);
+        }
+    }
+
+    // Escape into the writer in chunks
+    std::string large;
+    for (int i = 0; i < 10000; ++i)
+        large += "line \"" + std::to_string(i) + "\"\n";
+    StringWriter writer;
+    size_t written = Encoding::JsonEscape(large, writer);
+    REQUIRE(written == writer.content.size());
+    REQUIRE(writer.content == Encoding::JsonEscape(large));
+}
+
+TEST_CASE("HTML Encoding", "[CppCommon][String]")
+{
+    REQUIRE(Encoding::HtmlEscape("").empty());
+    REQUIRE(Encoding::HtmlEscape("<a href=\"x\">Tom & Jerry's</a>") == "&lt;a href=&quot;x&quot;&gt;Tom &amp; Jerry&#39;s&lt;/a&gt;");
+    REQUIRE(Encoding::HtmlUnescape("&lt;a href=&quot;x&quot;&gt;Tom &amp; Jerry&#39;s&apos;&lt;/a&gt;") == "<a href=\"x\">Tom & Jerry's'</a>");
+    REQUIRE(Encoding::HtmlUnescape("&#1055;&#x44F; &#X1F600;") == "\xD0\x9F\xD1\x8F \xF0\x9F\x98\x80");
+
+    // Keep unknown or malformed entities as is
+    REQUIRE(Encoding::HtmlUnescape("& &nbsp; &amp &#; &#x; &#0; &#xD800; &#x110000; &#12a; &") == "& &nbsp; &amp &#; &#x; &#0; &#xD800; &#x110000; &#12a; &");
+
+    // Check all characters at all positions of the vectorized blocks and tails
+    for (int ch = 0; ch < 256; ++ch)
+    {
+        for (size_t position = 0; position < 40; position += 3)
+        {
+            std::string str(40, 'a');
+            str[position] = (char)ch;
+            std::string escaped = Encoding::HtmlEscape(str);
+            bool special = (ch == '&') || (ch == '<') || (ch == '>') || (ch == '"') || (ch == '\'');
+            REQUIRE((escaped.size() > str.size()) == special);
+            REQUIRE(Encoding::HtmlUnescape(escaped) == str);
+        }
+    }
+
+    // Escape into the writer in chunks
+    std::string large;
+    for (int i = 0; i < 10000; ++i)
+        large += "<p>" + std::to_string(i) + "</p>";
+    StringWriter writer;
+    size_t written = Encoding::HtmlEscape(large, writer);
+    REQUIRE(written == writer.content.size());
+    REQUIRE(writer.content == Encoding::HtmlEscape(large));
+}
+
+TEST_CASE("CSV Encoding", "[CppCommon][String]")
+{
+    REQUIRE(Encoding::CsvQuote("").empty());
+    REQUIRE(Encoding::CsvQuote("plain field") == "plain field");
+    REQUIRE(Encoding::CsvQuote("a,b") == "\"a,b\"");
+    REQUIRE(Encoding::CsvQuote("a;b") == "a;b");
+    REQUIRE(Encoding::CsvQuote("a;b", ';') == "\"a;b\"");
+    REQUIRE(Encoding::CsvQuote("say \"hi\"") == "\"say \"\"hi\"\"\"");
+    REQUIRE(Encoding::CsvQuote("line\r\nbreak") == "\"line\r\nbreak\"");
+    REQUIRE(Encoding::CsvQuote("\"") == "\"\"\"\"");
+
+    REQUIRE(Encoding::CsvUnquote("plain field") == "plain field");
+    REQUIRE(Encoding::CsvUnquote("\"\"").empty());
+    REQUIRE(Encoding::CsvUnquote("\"a,b\"") == "a,b");
+    REQUIRE(Encoding::CsvUnquote("\"say \"\"hi\"\"\"") == "say \"hi\"");
+    REQUIRE(Encoding::CsvUnquote("\"\"\"\"") == "\"");
+
+    // Reject unclosed fields and not doubled quotes
+    char buffer[16];
+    REQUIRE(Encoding::CsvUnquote("\"", buffer) == std::string::npos);
+    REQUIRE(Encoding::CsvUnquote("\"abc", buffer) == std::string::npos);
+    REQUIRE(Encoding::CsvUnquote("\"a\"b\"", buffer) == std::string::npos);
+    REQUIRE(Encoding::CsvUnquote("\"ab\"\"", buffer) == std::string::npos);
+    REQUIRE_THROWS_AS(Encoding::CsvUnquote("\"a\"b\""), ArgumentException);
+
+    // Check all characters at all positions of the vectorized blocks and tails
+    for (int ch = 0; ch < 256; ++ch)
+    {
+        for (size_t position = 0; position < 40; position += 3)
+        {
+            std::string str(40, 'a');
+            str[position] = (char)ch;
+            std::string quoted = Encoding::CsvQuote(str);
+            bool special = (ch == ',') || (ch == '"') || (ch == '\r') || (ch == '\n');
+            REQUIRE((quoted.size() > str.size()) == special);
+            REQUIRE(Encoding::CsvUnquote(quoted) == str);
+        }
+    }
+
+    // Quote into the writer in chunks
+    std::string large;
+    for (int i = 0; i < 10000; ++i)
+        large += "\"" + std::to_string(i) + "\",";
+    StringWriter writer;
+    size_t written = Encoding::CsvQuote(large, writer);
+    REQUIRE(written == writer.content.size());
+    REQUIRE(writer.content == Encoding::CsvQuote(large));
+    StringWriter plain;
+    REQUIRE(Encoding::CsvQuote(std::string(10000, 'a'), plain) == 10000);
+    REQUIRE(plain.content == std::string(10000, 'a'));
 }
@@ -3,8 +3,11 @@
 //
 
 #include "test.h"
+#include "test_streams.h"
 
+#include "errors/exceptions.h"
 #include "string/format.h"
+#include "string/formatter.h"
 
 using namespace CppCommon;
 
@@ -57,3 +60,81 @@ TEST_CASE("Format", "[CppCommon][String]")
     REQUIRE(format("The date is {}", Date(2012, 12, 9)) == "The date is 2012-12-9");
     REQUIRE(format("Elapsed time: {s:.2f} seconds", "s"_a = 1.23) == "Elapsed time: 1.23 seconds");
 }
+
+TEST_CASE("Format to buffer", "[CppCommon][String]")
+{
+    fmt::memory_buffer buffer;
+    format_to(buffer, "{}-{}", 1, "two");
+    format_to(buffer, " {:.1f}", 3.14);
+    REQUIRE(std::string_view(buffer.data(), buffer.size()) == "1-two 3.1");
+    buffer.clear();
+    format_to(buffer, "The date is {}", Date(2012, 12, 9));
+    REQUIRE(std::string_view(buffer.data(), buffer.size()) == "The date is 2012-12-9");
+
+    char fixed[8];
+    REQUIRE(format_to(fixed, "{}", 42) == "42");
+    REQUIRE(format_to(fixed, "{}", "truncated string") == "truncate");
+
+    char chars[16];
+    REQUIRE(format_to_n(chars, sizeof(chars), "{}, {}", 'a', 1) == 4);
+    REQUIRE(std::string_view(chars, 4) == "a, 1");
+    REQUIRE(format_to_n(chars, 4, "{:>10}", "x") == 10);
+    REQUIRE(std::string_view(chars, 4) == "    ");
+
+    StringWriter writer;
+    print(writer, "Elapsed time: {s:.2f} seconds", "s"_a = 1.23);
+    print(writer, "; {}", std::string(600, 'x'));
+    REQUIRE(writer.content == "Elapsed time: 1.23 seconds; " + std::string(600, 'x'));
+    REQUIRE(writer.writes == 2);
+}
+
+TEST_CASE("Format with compiled pattern", "[CppCommon][String]")
+{
+    REQUIRE(format_compiled<"{}, {}, {}">('a', 'b', 'c') == "a, b, c");
+    REQUIRE(format_compiled<"{2}, {1}, {0}">('a', 'b', 'c') == "c, b, a");
+    REQUIRE(format_compiled<"{:*^30}">("centered") == "***********centered***********");
+    REQUIRE(format_compiled<"int: {0:d};  hex: {0:#x}">(42) == "int: 42;  hex: 0x2a");
+
+    fmt::memory_buffer buffer;
+    format_compiled_to<"{}-{}">(buffer, 1, "two");
+    format_compiled_to<" {:.1f}">(buffer, 3.14);
+    REQUIRE(std::string_view(buffer.data(), buffer.size()) == "1-two 3.1");
+
+    char fixed[8];
+    REQUIRE(format_compiled_to<"{}">(fixed, 42) == "42");
+    REQUIRE(format_compiled_to<"{}">(fixed, "truncated string") == "truncate");
+
+    char chars[16];
+    REQUIRE(format_compiled_to_n<"{}, {}">(chars, sizeof(chars), 'a', 1) == 4);
+    REQUIRE(std::string_view(chars, 4) == "a, 1");
+}
+
+TEST_CASE("Formatter", "[CppCommon][String]")
+{
+    Formatter formatter("[{}] {:>6} {{literal}} {:.2f}");
+    REQUIRE(formatter.fields() == 3);
+    REQUIRE(formatter.arguments() == 3);
+    REQUIRE(formatter.format("INFO", "text", 3.14159) == "[INFO]   text {literal} 3.14");
+    REQUIRE(formatter.format("WARN", 42, 1.0) == "[WARN]     42 {literal} 1.00");
+    REQUIRE(Formatter("The date is {}").format(Date(2012, 12, 9)) == "The date is 2012-12-9");
+
+    Formatter positional("{0}{1}{0}");
+    REQUIRE(positional.arguments() == 2);
+    REQUIRE(positional.format("abra", "cad") == "abracadabra");
+    REQUIRE_THROWS_AS(positional.format("abra"), fmt::format_error);
+
+    fmt::memory_buffer buffer;
+    positional.format_to(buffer, 1, 2);
+    positional.format_to(buffer, 3, 4);
+    REQUIRE(std::string_view(buffer.data(), buffer.size()) == "121343");
+
+    char fixed[8];
+    REQUIRE(positional.format_to(fixed, "truncated", "-") == "truncate");
+
+    REQUIRE(Formatter("no fields").format() == "no fields");
+    REQUIRE_THROWS_AS(Formatter("{"), ArgumentException);
+    REQUIRE_THROWS_AS(Formatter("}"), ArgumentException);
+    REQUIRE_THROWS_AS(Formatter("{name}"), ArgumentException);
+    REQUIRE_THROWS_AS(Formatter("{}{0}"), ArgumentException);
+    REQUIRE_THROWS_AS(Formatter("{:{}}"), ArgumentException);
+}
@@ -0,0 +1,75 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "test.h"
+
+#include "string/glob_pattern.h"
+
+#include <regex>
+
+using namespace CppCommon;
+
+TEST_CASE("Glob pattern", "[CppCommon][String]")
+{
+    REQUIRE(GlobPattern().Match("anything"));
+    REQUIRE(GlobPattern(";;").empty());
+
+    // Literal, prefix and suffix patterns
+    REQUIRE(GlobPattern("file.txt").Match("file.txt"));
+    REQUIRE(!GlobPattern("file.txt").Match("file.txt2"));
+    REQUIRE(GlobPattern("*.txt").Match("file.txt"));
+    REQUIRE(GlobPattern("*.txt").Match(".txt"));
+    REQUIRE(!GlobPattern("*.txt").Match("file.txt.bak"));
+    REQUIRE(GlobPattern("file*").Match("file"));
+    REQUIRE(GlobPattern("file*.txt").Match("file1.txt"));
+    REQUIRE(!GlobPattern("file*file").Match("file"));
+    REQUIRE(GlobPattern("*").Match(""));
+    REQUIRE(GlobPattern("**").Match("abc"));
+
+    // Wildcards and characters sets
+    REQUIRE(GlobPattern("a*b*c").Match("aXXbYYc"));
+    REQUIRE(GlobPattern("a*b*c").Match("abbbc"));
+    REQUIRE(!GlobPattern("a*b*c").Match("acb"));
+    REQUIRE(GlobPattern("?ile.*").Match("file.txt"));
+    REQUIRE(!GlobPattern("?ile").Match("ile"));
+    REQUIRE(GlobPattern("log[0-9][0-9].txt").Match("log42.txt"));
+    REQUIRE(!GlobPattern("log[0-9].txt").Match("logA.txt"));
+    REQUIRE(GlobPattern("log[!0-9].txt").Match("logA.txt"));
+    REQUIRE(GlobPattern("[]a]").Match("]"));
+    REQUIRE(GlobPattern("*[-_]*").Match("a-b"));
+    REQUIRE(GlobPattern("a\\*b").Match("a*b"));
+    REQUIRE(!GlobPattern("a\\*b").Match("aXb"));
+    REQUIRE(GlobPattern("a\\;b").Match("a;b"));
+
+    // Patterns list rules
+    GlobPattern accounts("Demo*;Live*");
+    REQUIRE(accounts.Match("DemoAccount"));
+    REQUIRE(accounts.Match("LiveAccount"));
+    REQUIRE(!accounts.Match("UnknownAccount"));
+    GlobPattern negative("!Demo*;!Live*");
+    REQUIRE(!negative.Match("DemoAccount"));
+    REQUIRE(!negative.Match("LiveAccount"));
+    REQUIRE(negative.Match("UnknownAccount"));
+    REQUIRE(accounts.patterns() == "Demo*;Live*");
+
+    // Invalid patterns
+    REQUIRE_THROWS(GlobPattern("abc\\"));
+    REQUIRE_THROWS(GlobPattern("[abc"));
+
+    // Check with the equivalent regular expressions
+    const char* globs[] = { "*a*b?", "?*", "*ab*ab*", "a*[bc]", "*b", "a?*?a" };
+    const char* regexes[] = { ".*a.*b.", "..*", ".*ab.*ab.*", "a.*[bc]", ".*b", "a..*.a" };
+    for (size_t i = 0; i < 6; ++i)
+    {
+        GlobPattern glob(globs[i]);
+        std::regex regex(regexes[i]);
+        for (size_t value = 0; value < 3 * 3 * 3 * 3 * 3 * 3; ++value)
+        {
+            std::string str;
+            for (size_t v = value; v > 0; v /= 3)
+                str += "abc"[v % 3];
+            REQUIRE(glob.Match(str) == std::regex_match(str, regex));
+        }
+    }
+}
@@ -0,0 +1,75 @@
+//
+// Created by Ivan Shynkarenka on 15.10.2026
+//
+
+#include "test.h"
+
+#include "string/string_interner.h"
+
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace CppCommon;
+
+TEST_CASE("String interner", "[CppCommon][String]")
+{
+    StringInterner interner;
+    REQUIRE(interner.size() == 1);
+    REQUIRE(interner.intern("") == StringInterner::EMPTY);
+    REQUIRE(interner[StringInterner::EMPTY].empty());
+
+    uint32_t id1 = interner.intern("foo");
+    uint32_t id2 = interner.intern("bar");
+    REQUIRE(id1 != id2);
+    REQUIRE(interner.size() == 3);
+    REQUIRE(interner.intern(std::string("foo")) == id1);
+    REQUIRE(interner.intern("bar") == id2);
+    REQUIRE(interner.size() == 3);
+
+    REQUIRE(interner.lookup(id1) == "foo");
+    REQUIRE(interner[id2] == "bar");
+    REQUIRE(std::string(interner[id2].data()) == "bar");
+
+    // Interned string views are stable
+    std::string_view view = interner[id1];
+    for (int i = 0; i < 10000; ++i)
+        interner.intern("item" + std::to_string(i));
+    REQUIRE(interner.size() == 10003);
+    REQUIRE(view.data() == interner[id1].data());
+
+    uint32_t id;
+    REQUIRE(interner.find("item5000", id));
+    REQUIRE(interner[id] == "item5000");
+    REQUIRE(!interner.find("missing", id));
+    REQUIRE(interner.size() == 10003);
+    REQUIRE(interner.memory() > 0);
+}
+
+TEST_CASE("String interner multithreaded", "[CppCommon][String]")
+{
+    const int threads = 4;
+    const int items = 10000;
+
+    StringInterner interner;
+    std::vector<std::vector<uint32_t>> ids(threads);
+
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; ++t)
+    {
+        workers.emplace_back([&interner, &ids, t]()
+        {
+            for (int i = 0; i < items; ++i)
+                ids[t].push_back(interner.intern("item" + std::to_string(i)));
+        });
+    }
+    for (auto& worker : workers)
+        worker.join();
+
+    // All threads must get the same identifiers for the same strings
+    REQUIRE(interner.size() == (items + 1));
+    for (int t = 1; t < threads; ++t)
+        REQUIRE(ids[t] == ids[0]);
+    for (int i = 0; i < items; ++i)
+        REQUIRE(interner[ids[0][i]] == ("item" + std::to_string(i)));
+}
@@ -0,0 +1,72 @@
+//
+// Created by Ivan Shynkarenka on 15.10.2026
+//
+
+#include "test.h"
+
+#include "containers/hashmap.h"
+#include "string/static_string.h"
+
+#include <sstream>
+
+using namespace CppCommon;
+
+TEST_CASE("Static string", "[CppCommon][String]")
+{
+    StaticString<8> str;
+    REQUIRE(str.empty());
+    REQUIRE(str.size() == 0);
+    REQUIRE(str.capacity() == 8);
+    REQUIRE(std::string(str.c_str()).empty());
+    REQUIRE(std::is_trivially_copyable_v<StaticString<8>>);
+    REQUIRE(sizeof(StaticString<8>) == 10);
+
+    str = "test";
+    REQUIRE(str.size() == 4);
+    REQUIRE(str == "test");
+    REQUIRE(std::string(str.c_str()) == "test");
+
+    str += "1234";
+    REQUIRE(str.full());
+    REQUIRE(str == "test1234");
+    REQUIRE_THROWS_AS(str.push_back('x'), std::length_error);
+    REQUIRE(!str.try_append("x"));
+    REQUIRE(str == "test1234");
+
+    str.pop_back();
+    str.push_back('5');
+    REQUIRE(str.back() == '5');
+    REQUIRE(str.front() == 't');
+
+    REQUIRE_THROWS_AS(StaticString<8>("123456789"), std::length_error);
+    REQUIRE(!str.try_assign("123456789"));
+    REQUIRE(str.try_assign("abc"));
+    REQUIRE(str < "abd");
+    REQUIRE(str > StaticString<8>("ab"));
+
+    str.resize(5, '!');
+    REQUIRE(str == "abc!!");
+    REQUIRE_THROWS_AS(str.resize(9), std::length_error);
+    REQUIRE_THROWS_AS(str.at(5), std::out_of_range);
+
+    std::stringstream ss;
+    ss << str;
+    REQUIRE(ss.str() == "abc!!");
+
+    str.clear();
+    REQUIRE(str.empty());
+    REQUIRE(str.view().empty());
+}
+
+TEST_CASE("Static string as hash map key", "[CppCommon][String]")
+{
+    HashMap<StaticString<16>, int> hashmap;
+    hashmap.emplace("one", 1);
+    hashmap.emplace("two", 2);
+    hashmap.emplace("three", 3);
+
+    REQUIRE(hashmap.size() == 3);
+    REQUIRE(hashmap.find("two")->second == 2);
+    REQUIRE(hashmap.find("four") == hashmap.end());
+    REQUIRE(std::hash<StaticString<16>>()("one") == std::hash<std::string_view>()("one"));
+}
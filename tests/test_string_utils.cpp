@@ -4,6 +4,7 @@
 
 #include "test.h"
 
+#include "containers/hashmap.h"
 #include "string/string_utils.h"
 
 using namespace CppCommon;
@@ -90,6 +91,14 @@ TEST_CASE("String utilities", "[CppCommon][String]")
     REQUIRE(CppCommon::StringUtils::Join(CppCommon::StringUtils::Split("a foo a bar a baz", ' '), '+') == "a+foo+a+bar+a+baz");
     REQUIRE(CppCommon::StringUtils::Join(CppCommon::StringUtils::Split("a foo a bar a baz", "a "), "the ") == "the foo the bar the baz");
 
+    std::vector<std::string_view> tokens;
+    REQUIRE(StringUtils::Split("a,,b,", ',', tokens) == 4);
+    REQUIRE(tokens == std::vector<std::string_view>({ "a", "", "b", "" }));
+    REQUIRE(StringUtils::Split("a,,b,", ',', tokens, true) == 2);
+    REQUIRE(tokens == std::vector<std::string_view>({ "a", "b" }));
+    REQUIRE(StringUtils::Split("a::b::::c", "::", tokens) == 4);
+    REQUIRE(tokens == std::vector<std::string_view>({ "a", "b", "", "c" }));
+
     REQUIRE(CppCommon::StringUtils::IsPatternMatch("Demo.*;Live.*", "DemoAccount"));
     REQUIRE(CppCommon::StringUtils::IsPatternMatch("Demo.*;Live.*", "LiveAccount"));
     REQUIRE(!CppCommon::StringUtils::IsPatternMatch("Demo.*;Live.*", "UnknownAccount"));
@@ -115,4 +124,156 @@ TEST_CASE("String utilities", "[CppCommon][String]")
     REQUIRE(StringUtils::FromString<uint8_t>("49") == '1');
     REQUIRE(StringUtils::FromString<int>("100") == 100);
     REQUIRE(StringUtils::FromString<double>("123.456") == 123.456);
+
+    REQUIRE(StringUtils::ToString(-100) == "-100");
+    REQUIRE(StringUtils::ToString(std::numeric_limits<uint64_t>::max()) == "18446744073709551615");
+    REQUIRE(StringUtils::ToString(0.1) == "0.1");
+    REQUIRE(StringUtils::ToString(1.5f) == "1.5");
+    REQUIRE(StringUtils::FromString<double>(StringUtils::ToString(1.0 / 3.0)) == (1.0 / 3.0));
+    REQUIRE(StringUtils::FromString<int>(" +42") == 42);
+    REQUIRE(StringUtils::FromString<int>("-42abc") == -42);
+    REQUIRE(StringUtils::FromString<int>("abc") == 0);
+    REQUIRE(StringUtils::FromString<int8_t>("-48") == -48);
+    REQUIRE(StringUtils::FromString<int16_t>("100000") == std::numeric_limits<int16_t>::max());
+    REQUIRE(StringUtils::FromString<int16_t>("-100000") == std::numeric_limits<int16_t>::min());
+    REQUIRE(StringUtils::FromString<uint64_t>("18446744073709551615") == std::numeric_limits<uint64_t>::max());
+    REQUIRE(StringUtils::FromString<float>("1.5") == 1.5f);
+    REQUIRE(StringUtils::FromString<double>("-1e-3") == -0.001);
+}
+
+TEST_CASE("String utilities vectorized kernels", "[CppCommon][String]")
+{
+    // Check all kernels against the scalar references on different lengths and alignments
+    std::string text;
+    for (size_t i = 0; i < 300; ++i)
+        text += "abXYz09 \t\xC0\xE1-"[i % 14];
+
+    for (size_t offset = 0; offset < 33; ++offset)
+    {
+        for (size_t length = 0; (offset + length) <= text.size(); length += 7)
+        {
+            std::string_view str = std::string_view(text).substr(offset, length);
+
+            // Case conversion maps only ASCII characters
+            std::string lower(str);
+            std::string upper(str);
+            StringUtils::Lower(lower);
+            StringUtils::Upper(upper);
+            for (size_t i = 0; i < str.size(); ++i)
+            {
+                char ch = str[i];
+                REQUIRE(lower[i] == (((ch >= 'A') && (ch <= 'Z')) ? (char)(ch + 32) : ch));
+                REQUIRE(upper[i] == (((ch >= 'a') && (ch <= 'z')) ? (char)(ch - 32) : ch));
+            }
+
+            // Substring search
+            for (std::string_view substr : { "z0", "Yz09", "\t\xC0\xE1-ab", "-abXYz09 \t\xC0\xE1-abX", "zz" })
+            {
+                REQUIRE(StringUtils::Find(str, substr) == str.find(substr));
+                REQUIRE(StringUtils::Find(str, substr, 5) == ((str.size() > 5) ? str.find(substr, 5) : std::string::npos));
+            }
+        }
+
+        // Blank string with the non blank character at any position
+        std::string blank(offset + 40, ' ');
+        for (size_t i = 0; i < blank.size(); ++i)
+            blank[i] = " \t\n\v\f\r"[i % 6];
+        REQUIRE(StringUtils::IsBlank(blank));
+        for (size_t i = 0; i < blank.size(); ++i)
+        {
+            std::string str = blank;
+            str[i] = (i % 2) ? 'x' : '\x85';
+            REQUIRE(!StringUtils::IsBlank(str));
+        }
+    }
+
+    REQUIRE(StringUtils::Find("abc", "") == std::string::npos);
+    REQUIRE(StringUtils::Find("abc", 'c', 3) == std::string::npos);
+    REQUIRE(StringUtils::CountAll("abc", "") == 0);
+}
+
+TEST_CASE("String utilities replace and split views", "[CppCommon][String]")
+{
+    std::string str = "a--b--c----d";
+    REQUIRE(StringUtils::ReplaceAll(str, "--", "+"));
+    REQUIRE(str == "a+b+c++d");
+    REQUIRE(StringUtils::ReplaceAll(str, "+", "<=>"));
+    REQUIRE(str == "a<=>b<=>c<=><=>d");
+    REQUIRE(StringUtils::ReplaceAll(str, "<=>", "***"));
+    REQUIRE(str == "a***b***c******d");
+    REQUIRE(!StringUtils::ReplaceAll(str, "?", "!"));
+    REQUIRE(!StringUtils::ReplaceAll(str, "", "!"));
+    str = "aaa";
+    REQUIRE(StringUtils::ReplaceAll(str, "a", "aa"));
+    REQUIRE(str == "aaaaaa");
+
+    std::vector<std::string_view> tokens;
+    for (auto token : StringUtils::Tokenize("a,b,,c,", ','))
+        tokens.push_back(token);
+    REQUIRE(tokens == std::vector<std::string_view>({ "a", "b", "", "c", "" }));
+
+    tokens.clear();
+    for (auto token : StringUtils::Tokenize(",a,b,,c,", ',', true))
+        tokens.push_back(token);
+    REQUIRE(tokens == std::vector<std::string_view>({ "a", "b", "c" }));
+
+    tokens.clear();
+    for (auto token : StringUtils::Tokenize("key: value:: other::", "::"))
+        tokens.push_back(token);
+    REQUIRE(tokens == std::vector<std::string_view>({ "key: value", " other", "" }));
+
+    REQUIRE(StringUtils::Tokenize("", ',').count() == 1);
+    REQUIRE(StringUtils::Tokenize("", ',', true).count() == 0);
+    REQUIRE(StringUtils::Tokenize(",,,", ',', true).count() == 0);
+    REQUIRE(StringUtils::Tokenize("abc", "").count() == 1);
+
+    auto view = StringUtils::Tokenize("x;y;z", ';');
+    auto it = view.begin();
+    REQUIRE(*it++ == "x");
+    REQUIRE(it->size() == 1);
+    REQUIRE(*++it == "z");
+    REQUIRE(++it == view.end());
+}
+
+TEST_CASE("String utilities case insensitive keys", "[CppCommon][String]")
+{
+    // Check comparison and hashing against the scalar references on different lengths
+    std::string text;
+    for (size_t i = 0; i < 200; ++i)
+        text += "Content-Type@[`{\xC1\xE1 z"[i % 20];
+
+    for (size_t length = 0; length <= text.size(); ++length)
+    {
+        std::string str = text.substr(0, length);
+        std::string lower = str;
+        std::string upper = str;
+        StringUtils::Lower(lower);
+        StringUtils::Upper(upper);
+        REQUIRE(StringUtils::CompareNoCase(lower, upper));
+        REQUIRE(StringUtils::HashNoCase(lower) == StringUtils::HashNoCase(upper));
+        REQUIRE(StringUtils::HashNoCase(lower) == StringUtils::HashNoCase(str));
+
+        // Different character at any position
+        for (size_t i = 0; i < length; ++i)
+        {
+            std::string other = str;
+            other[i] = (other[i] == '@') ? '`' : '@';
+            REQUIRE(!StringUtils::CompareNoCase(str, other));
+            other[i] = (char)(str[i] ^ 0x80);
+            REQUIRE(!StringUtils::CompareNoCase(str, other));
+        }
+    }
+
+    REQUIRE(!StringUtils::CompareNoCase("abc", "abcd"));
+    REQUIRE(StringUtils::HashNoCase("") != StringUtils::HashNoCase(std::string_view("\0", 1)));
+
+    // Allocation free lookup of case insensitive keys
+    HashMap<std::string, int, HashNoCase, EqualNoCase> headers(16, "");
+    headers.emplace("Content-Type", 1);
+    headers.emplace("Content-Length", 2);
+    REQUIRE(!headers.emplace("CONTENT-TYPE", 3).second);
+    REQUIRE(headers.size() == 2);
+    REQUIRE(headers.find(std::string_view("content-type"))->second == 1);
+    REQUIRE(headers.find("CONTENT-length")->second == 2);
+    REQUIRE(headers.find(std::string_view("Content-Encoding")) == headers.end());
 }
@@ -6,8 +6,21 @@
 
 #include "system/cpu.h"
 
+#include <string>
+#include <vector>
+
 using namespace CppCommon;
 
+namespace {
+
+int Scalar(int value) noexcept { return value + 1; }
+int Vector(int value) noexcept { return value + 2; }
+
+// Dispatched function is constant initialized
+constinit const CPUDispatch<int(int)> dispatch([]() { return CPU::HasSSE2() || CPU::HasNEON() ? Vector : Scalar; });
+
+} // namespace
+
 TEST_CASE("CPU management", "[CppCommon][System]")
 {
     REQUIRE(!CPU::Architecture().empty());
@@ -19,3 +32,117 @@ TEST_CASE("CPU management", "[CppCommon][System]")
     REQUIRE(CPU::ClockSpeed() > 0);
     REQUIRE((CPU::HyperThreading() || !CPU::HyperThreading()));
 }
+
+TEST_CASE("CPU features", "[CppCommon][System]")
+{
+    // Instruction set extensions imply their base instruction sets
+    if (CPU::HasAVX512())
+        REQUIRE(CPU::HasAVX2());
+    if (CPU::HasAVX2())
+        REQUIRE(CPU::HasAVX());
+    if (CPU::HasAVX())
+        REQUIRE(CPU::HasSSE42());
+    if (CPU::HasSSE42())
+        REQUIRE(CPU::HasSSE41());
+    if (CPU::HasSSE41())
+        REQUIRE(CPU::HasSSSE3());
+    REQUIRE(CPU::AVX2() == CPU::HasAVX2());
+    REQUIRE(((CPU::HasSSE2() && !CPU::HasNEON()) || !CPU::HasSSE2()));
+
+    // Features string contains all supported features
+    std::string features = CPU::Features();
+    REQUIRE((features.find("AVX2") != std::string::npos) == CPU::HasAVX2());
+    REQUIRE((features.find("CRC32") != std::string::npos) == CPU::HasCRC32());
+
+    // Dispatched function is resolved once
+    int expected = (CPU::HasSSE2() || CPU::HasNEON()) ? 3 : 2;
+    REQUIRE(dispatch(1) == expected);
+    REQUIRE(dispatch.function() == dispatch.function());
+    REQUIRE(dispatch.function()(1) == expected);
+}
+
+TEST_CASE("CPU topology", "[CppCommon][System]")
+{
+    const CPUTopology& topology = CPU::Topology();
+
+    REQUIRE(!topology.processors().empty());
+    REQUIRE(topology.cores() > 0);
+    REQUIRE(topology.cores() <= (int)topology.processors().size());
+    REQUIRE(topology.sockets() > 0);
+    REQUIRE(topology.nodes() > 0);
+    REQUIRE(topology.All().count() == topology.processors().size());
+
+    for (const auto& processor : topology.processors())
+    {
+        // Each logical processor belongs to all of its domains
+        REQUIRE(topology.Domain(processor.cpu, CPUDomain::CORE)[processor.cpu]);
+        REQUIRE(topology.Domain(processor.cpu, CPUDomain::L2)[processor.cpu]);
+        REQUIRE(topology.Domain(processor.cpu, CPUDomain::L3)[processor.cpu]);
+        REQUIRE(topology.Domain(processor.cpu, CPUDomain::SOCKET)[processor.cpu]);
+        REQUIRE(topology.Domain(processor.cpu, CPUDomain::NODE)[processor.cpu]);
+
+        // SMT siblings share the socket
+        REQUIRE(topology.Domain(processor.cpu, CPUDomain::SOCKET).contains(topology.Domain(processor.cpu, CPUDomain::CORE)));
+        REQUIRE(topology.NodeCPUs(processor.node)[processor.cpu]);
+        REQUIRE(topology.SocketCPUs(processor.socket)[processor.cpu]);
+    }
+
+    // Offline logical processor has empty domains
+    REQUIRE(topology.Domain(-1, CPUDomain::CORE).none());
+
+    // Pairs consist of different logical processors of the same domain used only once
+    CPUSet used;
+    for (const auto& pair : topology.Pairs(CPUDomain::L3))
+    {
+        REQUIRE(pair.first != pair.second);
+        REQUIRE(topology.Domain(pair.first, CPUDomain::L3)[pair.second]);
+        REQUIRE(!used[pair.first]);
+        REQUIRE(!used[pair.second]);
+        used.set(pair.first);
+        used.set(pair.second);
+    }
+
+    for (const auto& cache : topology.caches())
+    {
+        REQUIRE(cache.level > 0);
+        REQUIRE(cache.cpus.any());
+    }
+}
+
+TEST_CASE("CPU set", "[CppCommon][System]")
+{
+    CPUSet cpus;
+    REQUIRE(cpus.none());
+    REQUIRE(cpus.first() == -1);
+    REQUIRE(!cpus[1000]);
+
+    // CPU set grows beyond 64 logical processors
+    cpus.set(0).set(1).set(2).set(3).set(70).set(1000);
+    REQUIRE(cpus.count() == 6);
+    REQUIRE(cpus.size() >= 1001);
+    REQUIRE(cpus[70]);
+    REQUIRE(!cpus[69]);
+    REQUIRE(cpus.first() == 0);
+    REQUIRE(cpus.next(3) == 70);
+    REQUIRE(cpus.next(70) == 1000);
+    REQUIRE(cpus.next(1000) == -1);
+    REQUIRE(cpus.last() == 1000);
+    REQUIRE(cpus.cpus() == std::vector<int>({ 0, 1, 2, 3, 70, 1000 }));
+    REQUIRE(cpus.string() == "0-3,70,1000");
+    REQUIRE(CPUSet::Parse("0-3,70,1000") == cpus);
+    REQUIRE(cpus.mask().to_ullong() == 0xF);
+
+    // Set operations
+    CPUSet other = { 2, 3, 4, 1000 };
+    REQUIRE((cpus & other) == CPUSet({ 2, 3, 1000 }));
+    REQUIRE((cpus | other).count() == 7);
+    REQUIRE((cpus - other) == CPUSet({ 0, 1, 70 }));
+    REQUIRE(cpus.contains(CPUSet({ 1, 70 })));
+    REQUIRE(!cpus.contains(other));
+
+    // Equality ignores the CPU set size
+    cpus.reset(70).reset(1000);
+    REQUIRE(cpus == CPUSet(std::bitset<64>(0xF)));
+    cpus.clear();
+    REQUIRE(!cpus);
+}
@@ -5,6 +5,9 @@
 #include "test.h"
 
 #include "system/dll.h"
+#include "threads/thread_pool.h"
+
+#include <algorithm>
 
 // Plugins definitions
 #include "interface/interface.h"
@@ -68,3 +71,74 @@ TEST_CASE("DLL plugin interface", "[CppCommon][System]")
     REQUIRE(!plugin);
     REQUIRE(!plugin.IsLoaded());
 }
+
+namespace {
+
+struct RandomPlugin : public DLLSymbolTable
+{
+    DLLSymbol<bool (IRandom**)> create{*this, "PluginRandomCreate"};
+    DLLSymbol<bool (IRandom*)> release{*this, "PluginRandomRelease"};
+    DLLSymbol<int ()> missing{*this, "PluginRandomMissing", false};
+};
+
+struct BrokenPlugin : public DLLSymbolTable
+{
+    DLLSymbol<bool (IRandom**)> create{*this, "PluginRandomCreate"};
+    DLLSymbol<int ()> missing{*this, "PluginRandomMissing"};
+};
+
+} // namespace
+
+TEST_CASE("DLL plugin symbol table", "[CppCommon][System]")
+{
+    RandomPlugin symbols;
+    REQUIRE(symbols.size() == 3);
+    REQUIRE(!symbols);
+
+    // Load the plugin and resolve all its symbols at once
+    DLL plugin("plugin-interface", false, DLLOptions::NODELETE);
+    REQUIRE(plugin.options().isset(DLLOptions::NODELETE));
+    REQUIRE(plugin.Load(symbols));
+    REQUIRE(plugin.IsLoaded());
+    REQUIRE(plugin.load_time() > Timespan::zero());
+    REQUIRE(symbols);
+    REQUIRE(symbols.create);
+    REQUIRE(symbols.release);
+    REQUIRE(!symbols.missing);
+
+    // Call the resolved symbols
+    IRandom *pRandom = nullptr;
+    REQUIRE(symbols.create(&pRandom));
+    REQUIRE(pRandom->random() >= 0);
+    REQUIRE(symbols.release(pRandom));
+
+    plugin.Unload();
+    symbols.Reset();
+    REQUIRE(!symbols);
+    REQUIRE(!symbols.create);
+
+    // Missing required symbol fails the plugin loading
+    BrokenPlugin broken;
+    REQUIRE(!plugin.Load(broken));
+    REQUIRE(!plugin.IsLoaded());
+    REQUIRE(!broken);
+    REQUIRE(!broken.create);
+}
+
+TEST_CASE("DLL plugins directory", "[CppCommon][System]")
+{
+    ThreadPool pool(2);
+
+    // Preload all plugins of the executable directory in parallel
+    auto plugins = DLL::LoadDirectory(pool, Path::executable().parent());
+    REQUIRE(std::is_sorted(plugins.begin(), plugins.end(), [](const DLL& dll1, const DLL& dll2) { return dll1.path() < dll2.path(); }));
+
+    auto it = std::find_if(plugins.begin(), plugins.end(), [](const DLL& dll) { return dll.path().filename() == (DLL::prefix() + "plugin-function" + DLL::extension()); });
+    REQUIRE(it != plugins.end());
+    REQUIRE(it->IsLoaded());
+    REQUIRE(it->load_time() > Timespan::zero());
+
+    auto random = it->Resolve<int ()>("PluginRandom");
+    REQUIRE(random != nullptr);
+    REQUIRE(random() >= 0);
+}
@@ -33,3 +33,28 @@ TEST_CASE("Environment variables", "[CppCommon][System]")
     Environment::ClearEnvar("TestEnvar");
     REQUIRE(Environment::GetEnvar("TestEnvar") == "");
 }
+
+TEST_CASE("Environment variables snapshot", "[CppCommon][System]")
+{
+    Environment::SetEnvar("TestSnapshotEnvar", "123");
+    auto snapshot = Environment::Snapshot();
+    REQUIRE(snapshot->size() == Environment::envars().size());
+    REQUIRE(snapshot->Contains("TestSnapshotEnvar"));
+    REQUIRE(snapshot->Get("TestSnapshotEnvar") == "123");
+    REQUIRE(!snapshot->Contains("TestSnapshotMissing"));
+    REQUIRE(snapshot->Get("TestSnapshotMissing", "default") == "default");
+    for (const auto& envar : snapshot->envars())
+        REQUIRE(Environment::GetEnvar(std::string(envar.first)) == envar.second);
+
+    // Cached snapshot is shared until the invalidation
+    REQUIRE(Environment::Snapshot() == snapshot);
+    Environment::SetEnvar("TestSnapshotEnvar", "456");
+    auto updated = Environment::Snapshot();
+    REQUIRE(updated != snapshot);
+    REQUIRE(snapshot->Get("TestSnapshotEnvar") == "123");
+    REQUIRE(updated->Get("TestSnapshotEnvar") == "456");
+
+    Environment::ClearEnvar("TestSnapshotEnvar");
+    REQUIRE(!Environment::Snapshot()->Contains("TestSnapshotEnvar"));
+    REQUIRE(updated->Contains("TestSnapshotEnvar"));
+}
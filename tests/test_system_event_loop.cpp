@@ -0,0 +1,138 @@
+//
+// Created by Ivan Shynkarenka on 15.10.2026
+//
+
+#include "test.h"
+
+#include "system/event_loop.h"
+#include "time/timestamp.h"
+
+#include <atomic>
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace CppCommon;
+
+namespace {
+
+Process Exit(int result)
+{
+#if defined(_WIN32) || defined(_WIN64)
+    std::vector<std::string> arguments = { "/c", "exit", std::to_string(result) };
+    return Process::Execute("cmd.exe", &arguments);
+#else
+    std::vector<std::string> arguments = { "-c", "exit " + std::to_string(result) };
+    return Process::Execute("sh", &arguments);
+#endif
+}
+
+} // namespace
+
+TEST_CASE("Event loop timers", "[CppCommon][System]")
+{
+    EventLoop loop;
+    REQUIRE(loop.size() == 0);
+
+    std::vector<int> called;
+    uint64_t start = Timestamp::nano();
+    loop.Schedule(Timespan::milliseconds(20), [&called]() { called.push_back(2); });
+    loop.Schedule(Timespan::milliseconds(10), [&called]() { called.push_back(1); });
+    uint64_t canceled = loop.Schedule(Timespan::milliseconds(15), [&called]() { called.push_back(3); });
+    REQUIRE(loop.size() == 3);
+    REQUIRE(loop.Cancel(canceled));
+    REQUIRE(!loop.Cancel(canceled));
+
+    // Poll waits until the nearest timer deadline
+    while (called.size() < 2)
+        loop.Poll(Timespan::seconds(10));
+    REQUIRE(called == std::vector<int>({ 1, 2 }));
+    REQUIRE((Timestamp::nano() - start) >= (uint64_t)Timespan::milliseconds(20).total());
+    REQUIRE((Timestamp::nano() - start) < (uint64_t)Timespan::seconds(5).total());
+    REQUIRE(loop.size() == 0);
+}
+
+TEST_CASE("Event loop pipes", "[CppCommon][System]")
+{
+    EventLoop loop;
+    Pipe pipe;
+    pipe.SetBlocking(false);
+
+    std::string received;
+    uint64_t reader = loop.WatchRead(pipe, [&](uint64_t id)
+    {
+        char buffer[64];
+        size_t size = pipe.Read(buffer, sizeof(buffer));
+        received.append(buffer, size);
+        if (received.size() >= 10)
+            loop.Cancel(id);
+    });
+
+    // Pipe write endpoint is ready at once
+    size_t writes = 0;
+    loop.WatchWrite(pipe, [&](uint64_t id)
+    {
+        pipe.Write("01234", 5);
+        if (++writes == 2)
+            loop.Cancel(id);
+    });
+    REQUIRE(loop.size() == 2);
+
+    while (loop.size() > 0)
+        loop.Poll(Timespan::seconds(10));
+    REQUIRE(writes == 2);
+    REQUIRE(received == "0123401234");
+    REQUIRE(!loop.Cancel(reader));
+}
+
+TEST_CASE("Event loop processes", "[CppCommon][System]")
+{
+    const int processes = 8;
+
+    EventLoop loop;
+
+    std::map<uint64_t, int> expected;
+    std::map<uint64_t, int> results;
+    for (int i = 0; i < processes; ++i)
+    {
+        Process process = Exit(i);
+        expected[process.pid()] = i;
+        loop.WatchProcess(process, [&results](uint64_t pid, int result) { results[pid] = result; });
+    }
+
+    while (loop.size() > 0)
+        loop.Poll(Timespan::seconds(10));
+    REQUIRE(results == expected);
+}
+
+TEST_CASE("Event loop posted tasks", "[CppCommon][System]")
+{
+    const int threads = 4;
+    const int tasks = 1000;
+
+    EventLoop loop;
+    int called = 0;
+
+    // Post tasks from other threads and stop the loop with the last one
+    std::atomic<int> posted(0);
+    std::vector<std::thread> producers;
+    for (int i = 0; i < threads; ++i)
+    {
+        producers.emplace_back([&]()
+        {
+            for (int j = 0; j < tasks; ++j)
+            {
+                loop.Post([&]() { if (++called == (threads * tasks)) loop.Stop(); });
+                ++posted;
+            }
+        });
+    }
+
+    loop.Run();
+    for (auto& producer : producers)
+        producer.join();
+    REQUIRE(!loop.IsRunning());
+    REQUIRE(called == (threads * tasks));
+    REQUIRE(posted == (threads * tasks));
+}
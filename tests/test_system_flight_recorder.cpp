@@ -0,0 +1,84 @@
+//
+// Created by Ivan Shynkarenka on 15.10.2026
+//
+
+#include "test.h"
+
+#include "system/flight_recorder.h"
+#include "system/process.h"
+#include "threads/thread.h"
+#include "time/timestamp.h"
+
+#include <thread>
+
+using namespace CppCommon;
+
+TEST_CASE("Flight recorder", "[CppCommon][System]")
+{
+    const size_t threads = Thread::ThreadIndexCount() + 2;
+
+    FlightRecorder recorder("test_flight_recorder", threads, 3);
+    REQUIRE(recorder.threads() == threads);
+    REQUIRE(recorder.capacity() == 4);
+
+    // Record events of the current thread with the ring wrap around
+    Thread::SetName("recorder");
+    for (uint32_t i = 0; i < 10; ++i)
+        recorder.Record(i, i * 10, i * 100);
+
+    // Record events of another thread
+    std::thread([&recorder]() { recorder.Record(100, 1, 2); }).join();
+    REQUIRE(recorder.dropped() == 0);
+
+    // Read events with the reader of the same segment
+    FlightRecorderReader reader("test_flight_recorder", threads, 3);
+    REQUIRE(reader.pid() == Process::CurrentProcessId());
+    REQUIRE(reader.dropped() == 0);
+
+    auto recorded = reader.ReadThreads();
+    REQUIRE(recorded.size() == 2);
+    bool found = false;
+    for (const auto& thread : recorded)
+    {
+        if (thread.index == Thread::CurrentThreadIndex())
+        {
+            REQUIRE(thread.tid == Thread::CurrentThreadInfo().tid);
+            REQUIRE(thread.name == "recorder");
+            REQUIRE(thread.recorded == 10);
+            found = true;
+        }
+        else
+            REQUIRE(thread.recorded == 1);
+    }
+    REQUIRE(found);
+
+    // Only last four events of the current thread are kept
+    auto events = reader.ReadEvents();
+    REQUIRE(events.size() == 5);
+    for (size_t i = 0; i < 4; ++i)
+    {
+        REQUIRE(events[i].id == (6 + i));
+        REQUIRE(events[i].tid == (uint32_t)Thread::CurrentThreadInfo().tid);
+        REQUIRE(events[i].data[0] == ((6 + i) * 10));
+        REQUIRE(events[i].data[1] == ((6 + i) * 100));
+    }
+    REQUIRE(events[4].id == 100);
+    REQUIRE(events[4].tid != (uint32_t)Thread::CurrentThreadInfo().tid);
+    for (size_t i = 1; i < events.size(); ++i)
+        REQUIRE(events[i - 1].timestamp <= events[i].timestamp);
+    REQUIRE(events.back().timestamp <= Timestamp::utc());
+
+    // Reader parameters must match recorder parameters
+    REQUIRE_THROWS_AS(FlightRecorderReader("test_flight_recorder", threads, 8), SystemException);
+    REQUIRE_THROWS_AS(FlightRecorderReader("test_flight_recorder_missing"), SystemException);
+}
+
+TEST_CASE("Flight recorder dropped events", "[CppCommon][System]")
+{
+    FlightRecorder recorder("test_flight_recorder_dropped", 1, 16);
+
+    // Thread with the index beyond the count of rings is not recorded
+    recorder.Record(1);
+    uint64_t dropped = (Thread::CurrentThreadIndex() >= 1) ? 1 : 0;
+    REQUIRE(recorder.dropped() == dropped);
+}
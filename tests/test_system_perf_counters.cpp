@@ -0,0 +1,67 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "test.h"
+
+#include "system/perf_counters.h"
+
+using namespace CppCommon;
+
+TEST_CASE("Performance counters sample", "[CppCommon][System]")
+{
+    PerfSample sample1;
+    REQUIRE(sample1.cycles() == 0);
+    REQUIRE(sample1.ipc() == 0.0);
+
+    sample1[PerfEvent::CYCLES] = 100;
+    sample1[PerfEvent::INSTRUCTIONS] = 250;
+    sample1[PerfEvent::CACHE_MISSES] = 10;
+    REQUIRE(sample1.ipc() == 2.5);
+
+    PerfSample sample2;
+    sample2[PerfEvent::CYCLES] = 40;
+    sample2[PerfEvent::INSTRUCTIONS] = 50;
+    sample2[PerfEvent::CACHE_MISSES] = 20;
+
+    PerfSample sum = sample1 + sample2;
+    REQUIRE(sum.cycles() == 140);
+    REQUIRE(sum.instructions() == 300);
+    REQUIRE(sum.cache_misses() == 30);
+
+    // Difference of samples is saturated with zero
+    PerfSample difference = sample1 - sample2;
+    REQUIRE(difference.cycles() == 60);
+    REQUIRE(difference.instructions() == 200);
+    REQUIRE(difference.cache_misses() == 0);
+}
+
+TEST_CASE("Performance counters region", "[CppCommon][System]")
+{
+    PerfCounters counters;
+
+    PerfSample result;
+    volatile uint64_t crc = 0;
+    for (int i = 0; i < 10; ++i)
+    {
+        PerfRegion region(counters, result);
+        for (int j = 0; j < 100000; ++j)
+            crc = crc + j;
+    }
+
+    // Hardware performance counters could be unavailable in virtual environments
+    if (counters.IsAvailable(PerfEvent::CYCLES))
+        REQUIRE(result.cycles() > 0);
+    else
+        REQUIRE(result.cycles() == 0);
+    if (counters.IsAvailable(PerfEvent::INSTRUCTIONS))
+        REQUIRE(result.instructions() > 1000000);
+    else
+        REQUIRE(result.instructions() == 0);
+    if (!counters.IsAvailable())
+        REQUIRE(counters.Read().cycles() == 0);
+
+    counters.Reset();
+    PerfCounters moved(std::move(counters));
+    REQUIRE(moved.Read().branch_misses() <= 1000000);
+}
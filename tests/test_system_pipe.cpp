@@ -4,9 +4,12 @@
 
 #include "test.h"
 
+#include "filesystem/file.h"
 #include "system/pipe.h"
 
+#include <string>
 #include <thread>
+#include <vector>
 
 using namespace CppCommon;
 
@@ -23,6 +26,19 @@ TEST_CASE("Pipe", "[CppCommon][System]")
     }
 }
 
+TEST_CASE("Pipe vectored write", "[CppCommon][System]")
+{
+    Pipe pipe;
+
+    std::string header = "header:";
+    std::string payload = "payload";
+    REQUIRE(pipe.WriteV({ { header.data(), header.size() }, { nullptr, 0 }, { payload.data(), payload.size() } }) == 14);
+
+    char buffer[14];
+    REQUIRE(pipe.Read(buffer, sizeof(buffer)) == 14);
+    REQUIRE(std::string(buffer, sizeof(buffer)) == "header:payload");
+}
+
 TEST_CASE("Pipe threads", "[CppCommon][System]")
 {
     int items_to_produce = 10000;
@@ -61,3 +77,119 @@ TEST_CASE("Pipe threads", "[CppCommon][System]")
     // Check result
     REQUIRE(crc == result);
 }
+
+TEST_CASE("Pipe non-blocking mode", "[CppCommon][System]")
+{
+    Pipe pipe(65536);
+    REQUIRE(pipe.IsBlocking());
+#if defined(__linux__)
+    REQUIRE(pipe.capacity() >= 65536);
+    pipe.SetCapacity(131072);
+    REQUIRE(pipe.capacity() >= 131072);
+#endif
+
+    pipe.SetBlocking(false);
+    REQUIRE(!pipe.IsBlocking());
+
+    // Empty non-blocking pipe
+    int item = 0;
+    REQUIRE(!pipe.WaitRead());
+    REQUIRE(pipe.Read(&item, sizeof(item)) == 0);
+    REQUIRE(pipe.WaitWrite());
+
+    // Fill the non-blocking pipe
+    std::vector<uint8_t> buffer(4096, 0xAA);
+    size_t total = 0;
+    size_t written;
+    while ((written = pipe.Write(buffer.data(), buffer.size())) > 0)
+        total += written;
+    REQUIRE(total > 0);
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+    REQUIRE(!pipe.WaitWrite(Timespan::milliseconds(1)));
+#endif
+
+    // Drain the non-blocking pipe
+    REQUIRE(pipe.WaitRead(Timespan::milliseconds(1)));
+    size_t read;
+    while ((read = pipe.Read(buffer.data(), buffer.size())) > 0)
+        total -= read;
+    REQUIRE(total == 0);
+
+    // Closed write endpoint is ready for reading with the end of the pipe
+    pipe.CloseWrite();
+    REQUIRE(pipe.WaitRead());
+    REQUIRE(pipe.Read(&item, sizeof(item)) == 0);
+}
+
+TEST_CASE("Pipe file transfers", "[CppCommon][System]")
+{
+    std::string content;
+    for (int i = 0; i < 10000; ++i)
+        content += std::to_string(i);
+
+    File source("pipe-source.tmp");
+    File::WriteAllText(source, content);
+    File target("pipe-target.tmp");
+
+    source.Open(true, false);
+    target.Create(false, true);
+
+    // Move the file content through the pipe in the producer thread
+    Pipe pipe;
+    auto producer = std::thread([&pipe, &source, &content]()
+    {
+        uint64_t offset = 0;
+        while (offset < content.size())
+            offset += pipe.TransferFrom(source, offset, content.size() - offset);
+        pipe.CloseWrite();
+    });
+
+    uint64_t offset = 0;
+    size_t transferred;
+    while ((transferred = pipe.TransferTo(target, offset, 65536)) > 0)
+        offset += transferred;
+    producer.join();
+
+    REQUIRE(offset == content.size());
+    source.Close();
+    target.Close();
+    REQUIRE(File::ReadAllText(target) == content);
+    File::Remove(source);
+    File::Remove(target);
+
+#if defined(__linux__)
+    // Duplicate the pipe content without consuming it
+    Pipe pipe1;
+    Pipe pipe2;
+    pipe1.Write("test", 4);
+    REQUIRE(pipe1.Tee(pipe2, 4) == 4);
+    char buffer[4];
+    REQUIRE(pipe2.Read(buffer, 4) == 4);
+    REQUIRE(std::string(buffer, 4) == "test");
+    REQUIRE(pipe1.Read(buffer, 4) == 4);
+    REQUIRE(std::string(buffer, 4) == "test");
+#endif
+}
+
+TEST_CASE("Pipe non-throwing operations", "[CppCommon][System]")
+{
+    Pipe pipe;
+    pipe.SetBlocking(false);
+
+    std::error_code ec;
+    char buffer[8];
+    REQUIRE(pipe.TryRead(buffer, sizeof(buffer), ec) == 0);
+    REQUIRE(!ec);
+    REQUIRE(pipe.TryWrite("test", 4, ec) == 4);
+    REQUIRE(!ec);
+    REQUIRE(pipe.TryRead(buffer, sizeof(buffer), ec) == 4);
+    REQUIRE(!ec);
+    REQUIRE(std::string(buffer, 4) == "test");
+
+    // Closed endpoints are reported with the error code
+    pipe.Close();
+    REQUIRE(pipe.TryRead(buffer, sizeof(buffer), ec) == 0);
+    REQUIRE(ec == std::errc::bad_file_descriptor);
+    REQUIRE(pipe.TryWrite("test", 4, ec) == 0);
+    REQUIRE(ec == std::errc::bad_file_descriptor);
+}
@@ -5,6 +5,7 @@
 #include "test.h"
 
 #include "system/process.h"
+#include "threads/thread.h"
 
 using namespace CppCommon;
 
@@ -17,3 +18,27 @@ TEST_CASE("Process", "[CppCommon][System]")
     REQUIRE(Process::CurrentProcess().IsRunning());
     REQUIRE(Process::ParentProcess().IsRunning());
 }
+
+#if defined(linux) || defined(__linux) || defined(__linux__)
+TEST_CASE("Process launch options", "[CppCommon][System]")
+{
+    std::vector<std::string> arguments = { "-c", "exit 3" };
+
+    // Empty launch options spawn the process as usual
+    ProcessOptions options;
+    REQUIRE(options.empty());
+    Process process = Process::Execute("sh", &arguments, nullptr, nullptr, nullptr, nullptr, nullptr, &options);
+    REQUIRE(process.Wait() == 3);
+
+    // Pin the process to the first available CPU with the low priority
+    options.affinity = { Thread::GetAffinitySet().first() };
+    options.priority = ProcessPriority::LOW;
+    REQUIRE(!options.empty());
+    process = Process::Execute("sh", &arguments, nullptr, nullptr, nullptr, nullptr, nullptr, &options);
+    REQUIRE(process.Wait() == 3);
+
+    // Invalid cgroup fails the launch
+    options.cgroup = "/nonexistent/cgroup";
+    REQUIRE_THROWS_AS(Process::Execute("sh", &arguments, nullptr, nullptr, nullptr, nullptr, nullptr, &options), SystemException);
+}
+#endif
@@ -0,0 +1,103 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "test.h"
+
+#include "system/process_monitor.h"
+#include "threads/latch.h"
+
+#include <atomic>
+#include <map>
+#include <mutex>
+
+using namespace CppCommon;
+
+namespace {
+
+Process Exit(int result)
+{
+#if defined(_WIN32) || defined(_WIN64)
+    std::vector<std::string> arguments = { "/c", "exit", std::to_string(result) };
+    return Process::Execute("cmd.exe", &arguments);
+#else
+    std::vector<std::string> arguments = { "-c", "exit " + std::to_string(result) };
+    return Process::Execute("sh", &arguments);
+#endif
+}
+
+} // namespace
+
+TEST_CASE("Process wait", "[CppCommon][System]")
+{
+    Process process = Exit(7);
+#if defined(linux) || defined(__linux) || defined(__linux__) || defined(_WIN32) || defined(_WIN64)
+    REQUIRE(process.handle() != nullptr);
+#endif
+    REQUIRE(process.WaitFor(Timespan::seconds(30)) == 7);
+
+#if !defined(_WIN32) && !defined(_WIN64)
+    // Timed wait of the running process
+    std::vector<std::string> arguments = { "10" };
+    Process sleeping = Process::Execute("sleep", &arguments);
+    REQUIRE(sleeping.WaitFor(Timespan::milliseconds(10)) == std::numeric_limits<int>::min());
+    sleeping.Kill();
+    REQUIRE_THROWS_AS(sleeping.Wait(), SystemException);
+#endif
+}
+
+TEST_CASE("Process monitor", "[CppCommon][System]")
+{
+    const int processes = 16;
+
+    ProcessMonitor monitor;
+    REQUIRE(monitor.empty());
+
+    std::mutex lock;
+    std::map<uint64_t, int> expected;
+    std::map<uint64_t, int> results;
+
+    // Watch processes and collect their exit results with the dedicated thread
+    Latch latch(processes);
+    REQUIRE(monitor.Start());
+    REQUIRE(!monitor.Start());
+    for (int i = 0; i < processes; ++i)
+    {
+        Process process = Exit(i);
+        std::scoped_lock locker(lock);
+        expected[process.pid()] = i;
+        monitor.Watch(process, [&lock, &results, &latch](uint64_t pid, int result)
+        {
+            {
+                std::scoped_lock results_locker(lock);
+                results[pid] = result;
+            }
+            latch.CountDown();
+        });
+    }
+    latch.Wait();
+    REQUIRE(monitor.Stop());
+    REQUIRE(!monitor.Stop());
+    REQUIRE(monitor.empty());
+    REQUIRE(results == expected);
+
+    // Poll exited process from the caller thread
+    Process process = Exit(3);
+    int polled = -1;
+    monitor.Watch(process, [&polled](uint64_t, int result) { polled = result; });
+    REQUIRE(monitor.size() == 1);
+    REQUIRE_THROWS_AS(monitor.Watch(process, [](uint64_t, int) {}), SystemException);
+    size_t count = 0;
+    while (count == 0)
+        count = monitor.Poll(Timespan::seconds(1));
+    REQUIRE(count == 1);
+    REQUIRE(polled == 3);
+
+    // Unwatch the running process
+    process = Exit(0);
+    monitor.Watch(process, [](uint64_t, int) {});
+    REQUIRE(monitor.Unwatch(process.pid()));
+    REQUIRE(!monitor.Unwatch(process.pid()));
+    REQUIRE(monitor.empty());
+    REQUIRE(process.Wait() == 0);
+}
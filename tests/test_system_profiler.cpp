@@ -0,0 +1,76 @@
+//
+// Created by Ivan Shynkarenka on 15.10.2026
+//
+
+#include "test.h"
+
+#include "filesystem/file.h"
+#include "system/profiler.h"
+#include "time/timestamp.h"
+
+#include <sstream>
+#include <string>
+
+using namespace CppCommon;
+
+namespace {
+
+// Burn CPU time to be sampled by the profiler
+uint64_t Spin(uint64_t milliseconds)
+{
+    volatile uint64_t result = 0;
+    uint64_t finish = Timestamp::nano() + milliseconds * 1000000;
+    while (Timestamp::nano() < finish)
+        for (int i = 0; i < 1000; ++i)
+            result = result + i;
+    return result;
+}
+
+} // namespace
+
+TEST_CASE("Sampling CPU profiler", "[CppCommon][System]")
+{
+    if (!Profiler::IsSupported())
+    {
+        REQUIRE(!Profiler::Start());
+        return;
+    }
+
+    REQUIRE(!Profiler::IsStarted());
+    REQUIRE(!Profiler::Stop());
+
+    REQUIRE(Profiler::Start(Timespan::milliseconds(1)));
+    REQUIRE(Profiler::IsStarted());
+    REQUIRE(!Profiler::Start());
+
+    Spin(300);
+
+    REQUIRE(Profiler::Stop());
+    REQUIRE(!Profiler::IsStarted());
+    REQUIRE(Profiler::samples() > 0);
+
+    // Each folded stack line ends with its samples count
+    std::string folded = Profiler::Folded();
+    REQUIRE(!folded.empty());
+    uint64_t total = 0;
+    std::istringstream lines(folded);
+    for (std::string line; std::getline(lines, line);)
+    {
+        size_t position = line.rfind(' ');
+        REQUIRE(position != std::string::npos);
+        REQUIRE(position > 0);
+        total += std::stoull(line.substr(position + 1));
+    }
+    REQUIRE(total == Profiler::samples());
+
+    // Profile is written into the file
+    Path path = Path::temp() / Path::unique();
+    Profiler::WriteFolded(path);
+    REQUIRE(File::ReadAllText(path) == folded);
+    File::Remove(path);
+
+    // New session clears the previous profile
+    REQUIRE(Profiler::Start());
+    REQUIRE(Profiler::Stop());
+    REQUIRE(Profiler::samples() <= total);
+}
@@ -0,0 +1,75 @@
+//
+// Created by Ivan Shynkarenka on 15.10.2026
+//
+
+#include "test.h"
+
+#include "system/resource_usage.h"
+#include "threads/thread.h"
+
+#include <cstring>
+#include <vector>
+
+using namespace CppCommon;
+
+namespace {
+
+// Burn the CPU time of the current thread
+volatile uint64_t burned = 0;
+void Burn(int64_t nanoseconds)
+{
+    ResourceUsage start = ResourceUsage::CurrentThread();
+    while ((ResourceUsage::CurrentThread().cpu_time() - start.cpu_time()).total() < nanoseconds)
+        for (int i = 0; i < 1000; ++i)
+            burned = burned + i;
+}
+
+} // namespace
+
+TEST_CASE("Resource usage", "[CppCommon][System]")
+{
+    ResourceUsage process = ResourceUsage::CurrentProcess();
+    REQUIRE(process.cpu_time().total() > 0);
+    REQUIRE(process.user_time.total() >= 0);
+    REQUIRE(process.system_time.total() >= 0);
+    REQUIRE(process.rss > 0);
+    REQUIRE(process.peak_rss > 0);
+
+    ResourceUsage thread = ResourceUsage::CurrentThread();
+    REQUIRE(thread.cpu_time().total() >= 0);
+    REQUIRE(thread.cpu_time() <= ResourceUsage::CurrentProcess().cpu_time());
+    REQUIRE(thread.rss > 0);
+}
+
+TEST_CASE("Resource usage sampler", "[CppCommon][System]")
+{
+    ResourceUsageSampler sampler(true);
+    REQUIRE(sampler.thread());
+    REQUIRE(sampler.elapsed().total() == 0);
+    REQUIRE(sampler.utilization() == 0.0);
+
+    // Burn 10 milliseconds of the CPU time
+    Burn(Timespan::milliseconds(10).total());
+    const ResourceUsage& delta = sampler.Sample();
+    REQUIRE(delta.cpu_time().total() >= Timespan::milliseconds(10).total());
+    REQUIRE(sampler.elapsed().total() > 0);
+    REQUIRE(sampler.utilization() > 0.0);
+    REQUIRE(sampler.total().cpu_time() >= delta.cpu_time());
+
+    // Touch new pages to cause minor page faults
+    ResourceUsageSampler process;
+    std::vector<uint8_t> memory(16 * 1024 * 1024);
+    std::memset(memory.data(), 0xFF, memory.size());
+    process.Sample();
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(_WIN32) || defined(_WIN64)
+    REQUIRE(process.delta().minor_faults > 0);
+#endif
+    REQUIRE(process.delta().rss > 0);
+
+    // Sleep to cause voluntary context switches
+    Thread::Sleep(10);
+    sampler.Sample();
+#if defined(linux) || defined(__linux) || defined(__linux__)
+    REQUIRE(sampler.delta().voluntary_switches > 0);
+#endif
+}
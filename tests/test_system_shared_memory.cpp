@@ -31,3 +31,37 @@ TEST_CASE("Shared memory manager", "[CppCommon][System]")
     // Read from the shared memory buffer
     REQUIRE(std::memcmp(shared1.ptr(), shared2.ptr(), size) == 0);
 }
+
+TEST_CASE("Shared memory manager options", "[CppCommon][System]")
+{
+    const char* name = "shared_memory_options_test";
+    const char* message = "shared message";
+    size_t size = 4 * 1024 * 1024;
+
+    // Create pre-faulted and locked shared memory backed with huge pages if available
+    SharedMemory shared1(name, size, SharedMemoryOptions::PREFAULT | SharedMemoryOptions::LOCK | SharedMemoryOptions::HUGEPAGES);
+    REQUIRE(shared1.owner());
+    REQUIRE(shared1.ptr() != nullptr);
+
+    // Write into the end of the shared memory buffer
+    std::memcpy((uint8_t*)shared1.ptr() + size - 14, message, 14);
+
+    // Open the shared memory with the same backing
+    SharedMemory shared2(name, size, SharedMemoryOptions::HUGEPAGES);
+    REQUIRE(!shared2.owner());
+    REQUIRE(shared2.huge() == shared1.huge());
+
+    // Read from the shared memory buffer
+    const SharedMemory& shared3 = shared2;
+    REQUIRE(shared3.ptr() == shared2.ptr());
+    REQUIRE(std::memcmp((const uint8_t*)shared3.ptr() + size - 14, message, 14) == 0);
+}
+
+TEST_CASE("Shared memory manager NUMA binding", "[CppCommon][System]")
+{
+    // Bind pre-faulted shared memory to the first NUMA node
+    SharedMemory shared("shared_memory_numa_test", 65536, SharedMemoryOptions::PREFAULT, 0);
+    REQUIRE(shared.owner());
+    REQUIRE(!shared.huge());
+    std::memset(shared.ptr(), 0xFF, shared.size());
+}
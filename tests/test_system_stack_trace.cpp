@@ -8,6 +8,7 @@
 #include "system/stack_trace_manager.h"
 
 #include <thread>
+#include <vector>
 
 using namespace CppCommon;
 
@@ -73,3 +74,50 @@ TEST_CASE("Stack trace snapshot provider", "[CppCommon][System]")
 
     StackTraceManager::Cleanup();
 }
+
+TEST_CASE("Stack trace lazy resolving", "[CppCommon][System]")
+{
+    StackTraceManager::Initialize();
+
+    // Stack trace snapshot captures only frame addresses
+    auto trace = function3();
+    REQUIRE(!trace.addresses().empty());
+    REQUIRE(!trace.IsResolved());
+
+    // Copy of the unresolved stack trace snapshot is resolved independently
+    StackTrace copy(trace);
+    REQUIRE(!copy.IsResolved());
+    REQUIRE(copy.addresses() == trace.addresses());
+
+    // Stack trace frames are resolved on the first access
+    validate(trace.frames());
+    REQUIRE(trace.IsResolved());
+    REQUIRE(trace.frames().size() == trace.addresses().size());
+    for (size_t i = 0; i < trace.addresses().size(); ++i)
+        REQUIRE(trace.frames()[i].address == trace.addresses()[i]);
+
+    // Cached symbols are the same as resolved ones
+    equal(copy.frames(), trace.frames(), (int)trace.frames().size());
+    StackTrace raw(trace.addresses().data(), trace.addresses().size());
+    equal(raw.frames(), trace.frames(), (int)trace.frames().size());
+
+    // Concurrent resolving of the same stack trace snapshot
+    auto shared = function3();
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 4; ++i)
+        threads.emplace_back([&shared]() { validate(shared.frames()); });
+    for (auto& thread : threads)
+        thread.join();
+    REQUIRE(shared.IsResolved());
+
+    // Moved stack trace snapshot keeps resolved frames
+    StackTrace moved(std::move(shared));
+    REQUIRE(moved.IsResolved());
+    validate(moved.frames());
+
+    StackTraceManager::Cleanup();
+
+    // Stack trace frames are resolved again after the symbol cache cleanup
+    StackTrace again(trace.addresses().data(), trace.addresses().size());
+    equal(again.frames(), trace.frames(), (int)trace.frames().size());
+}
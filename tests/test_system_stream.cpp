@@ -0,0 +1,116 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "test.h"
+
+#include "system/pipe.h"
+#include "system/stream.h"
+
+#include <cstdio>
+#include <string>
+#include <thread>
+
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+#include <unistd.h>
+#endif
+
+using namespace CppCommon;
+
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+
+namespace {
+
+// Redirect the standard output into the pipe and collect the written data
+class Redirect
+{
+public:
+    Redirect() : _stdout(-1)
+    {
+        fflush(stdout);
+        _stdout = dup(STDOUT_FILENO);
+        dup2((int)(size_t)_pipe.writer(), STDOUT_FILENO);
+        _reader = std::thread([this]()
+        {
+            char buffer[4096];
+            size_t size;
+            while ((size = _pipe.Read(buffer, sizeof(buffer))) > 0)
+                _output.append(buffer, size);
+        });
+    }
+
+    std::string Finish()
+    {
+        fflush(stdout);
+        dup2(_stdout, STDOUT_FILENO);
+        close(_stdout);
+        _pipe.CloseWrite();
+        _reader.join();
+        return _output;
+    }
+
+private:
+    int _stdout;
+    Pipe _pipe;
+    std::thread _reader;
+    std::string _output;
+};
+
+} // namespace
+
+TEST_CASE("Buffered standard output stream", "[CppCommon][System]")
+{
+    Redirect redirect;
+    std::string expected;
+    {
+        StdStreamBuffering buffering;
+        buffering.size = 64;
+        buffering.interval = Timespan::milliseconds(1);
+        buffering.flusher = true;
+
+        StdOutput output(buffering);
+        REQUIRE(output.IsBuffered());
+
+        for (int i = 0; i < 1000; ++i)
+        {
+            std::string line = "line " + std::to_string(i) + "\n";
+            REQUIRE(output.Write(line) == line.size());
+            expected += line;
+        }
+
+        // Oversized data is written directly after the buffered one
+        std::string big(1000, 'x');
+        REQUIRE(output.Write(big) == big.size());
+        expected += big;
+        output.Flush();
+        REQUIRE(output.dropped() == 0);
+    }
+    REQUIRE(redirect.Finish() == expected);
+}
+
+TEST_CASE("Buffered standard output stream without flusher", "[CppCommon][System]")
+{
+    Redirect redirect;
+    std::string expected;
+    {
+        StdStreamBuffering buffering;
+        buffering.size = 100;
+        buffering.interval = Timespan::zero();
+        buffering.flusher = false;
+        buffering.backpressure = StdStreamBackpressure::DROP;
+
+        StdOutput output(buffering);
+
+        // Writer flushes the full buffer itself without drops
+        for (int i = 0; i < 100; ++i)
+        {
+            Writer::WriteBuffer buffers[] = { { "key=", 4 }, { "value", 5 }, { "\n", 1 } };
+            REQUIRE(output.WriteV(buffers) == 10);
+            expected += "key=value\n";
+        }
+        REQUIRE(output.dropped() == 0);
+    }
+    REQUIRE(redirect.Finish() == expected);
+}
+
+#endif
@@ -0,0 +1,100 @@
+//
+// Created by Ivan Shynkarenka on 15.10.2026
+//
+
+#include "test.h"
+
+#include "filesystem/file.h"
+#include "system/tracer.h"
+
+#include <thread>
+#include <vector>
+
+using namespace CppCommon;
+
+namespace {
+
+size_t Count(const std::string& text, const std::string& pattern)
+{
+    size_t count = 0;
+    for (size_t position = text.find(pattern); position != std::string::npos; position = text.find(pattern, position + pattern.size()))
+        ++count;
+    return count;
+}
+
+} // namespace
+
+TEST_CASE("Tracer Chrome trace", "[CppCommon][System]")
+{
+    int threads_count = 4;
+    int spans = 100;
+
+    Path path = Path::temp() / Path::unique();
+
+    // Scopes are not recorded before the tracer is started
+    REQUIRE(!Tracer::IsStarted());
+    {
+        TRACE_SCOPE("Ignored");
+    }
+
+    REQUIRE(Tracer::Start(path));
+    REQUIRE(Tracer::IsStarted());
+    REQUIRE(!Tracer::Start(path));
+
+    std::vector<std::thread> threads;
+    for (int thread = 0; thread < threads_count; ++thread)
+    {
+        threads.emplace_back([spans]()
+        {
+            for (int i = 0; i < spans; ++i)
+            {
+                TRACE_SCOPE("Outer \"span\"");
+                {
+                    TRACE_SCOPE("Inner");
+                    TRACE_SCOPE_IF(false, "Skipped");
+                }
+            }
+        });
+    }
+
+    for (auto& thread : threads)
+        thread.join();
+
+    REQUIRE(Tracer::Stop());
+    REQUIRE(!Tracer::Stop());
+    REQUIRE(Tracer::dropped() == 0);
+    REQUIRE(Tracer::written() == (uint64_t)(2 * threads_count * spans));
+
+    std::string text = File::ReadAllText(path);
+    REQUIRE(text.starts_with("{\"displayTimeUnit\":\"ns\",\"traceEvents\":["));
+    REQUIRE(text.ends_with("]}\n"));
+    REQUIRE(Count(text, "\"ph\":\"X\"") == (size_t)(2 * threads_count * spans));
+    REQUIRE(Count(text, "\"name\":\"Outer \\\"span\\\"\"") == (size_t)(threads_count * spans));
+    REQUIRE(Count(text, "Ignored") == 0);
+    REQUIRE(Count(text, "Skipped") == 0);
+
+    Path::Remove(path);
+}
+
+TEST_CASE("Tracer Perfetto trace", "[CppCommon][System]")
+{
+    int spans = 10;
+
+    Path path = Path::temp() / Path::unique();
+
+    REQUIRE(Tracer::Start(path, TraceFormat::PERFETTO));
+    for (int i = 0; i < spans; ++i)
+    {
+        TRACE_SCOPE("Perfetto");
+    }
+    REQUIRE(Tracer::Stop());
+    REQUIRE(Tracer::written() == (uint64_t)spans);
+
+    // Trace packets are length delimited fields with number 1
+    std::vector<uint8_t> bytes = File::ReadAllBytes(path);
+    REQUIRE(bytes.size() > 0);
+    REQUIRE(bytes[0] == 0x0A);
+    REQUIRE(Count(std::string(bytes.begin(), bytes.end()), "Perfetto") == (size_t)spans);
+
+    Path::Remove(path);
+}
@@ -4,7 +4,12 @@
 
 #include "test.h"
 
+#include "string/format.h"
 #include "system/uuid.h"
+#include "time/timestamp.h"
+
+#include <set>
+#include <vector>
 
 using namespace CppCommon;
 
@@ -35,3 +40,70 @@ TEST_CASE("UUID generate", "[CppCommon][System]")
     test_uuid(UUID::Random());
     test_uuid(UUID::Secure());
 }
+
+TEST_CASE("UUID random and sortable versions", "[CppCommon][System]")
+{
+    // Random UUID4 has the version and variant bits
+    std::set<UUID> unique;
+    for (int i = 0; i < 1000; ++i)
+    {
+        UUID uuid = UUID::Random();
+        REQUIRE((uuid.data()[6] >> 4) == 4);
+        REQUIRE((uuid.data()[8] & 0xC0) == 0x80);
+        unique.insert(uuid);
+    }
+    REQUIRE(unique.size() == 1000);
+
+    // Generate random UUID4 in bulk
+    std::vector<UUID> uuids(1000);
+    UUID::Random(uuids.data(), uuids.size());
+    for (const auto& uuid : uuids)
+    {
+        REQUIRE((uuid.data()[6] >> 4) == 4);
+        REQUIRE((uuid.data()[8] & 0xC0) == 0x80);
+        unique.insert(uuid);
+    }
+    REQUIRE(unique.size() == 2000);
+
+    // Sortable UUID7 is strictly increasing and starts with the current Unix timestamp in milliseconds
+    uint64_t timestamp = Timestamp::utc() / 1000000;
+    UUID previous = UUID::Sortable();
+    for (int i = 0; i < 10000; ++i)
+    {
+        UUID uuid = UUID::Sortable();
+        REQUIRE((uuid.data()[6] >> 4) == 7);
+        REQUIRE((uuid.data()[8] & 0xC0) == 0x80);
+        REQUIRE(previous < uuid);
+        previous = uuid;
+    }
+    uint64_t first = 0;
+    for (int i = 0; i < 6; ++i)
+        first = (first << 8) | previous.data()[i];
+    REQUIRE(first >= timestamp);
+    REQUIRE(first < timestamp + 60000);
+}
+
+TEST_CASE("UUID formatting and parsing", "[CppCommon][System]")
+{
+    UUID uuid("01234567-89ab-cdef-fedc-ba9876543210"_uuid);
+
+    char buffer[36];
+    REQUIRE(uuid.ToChars(buffer) == buffer + 36);
+    REQUIRE(std::string(buffer, 36) == "01234567-89ab-cdef-fedc-ba9876543210");
+    REQUIRE(fmt::format("{}", uuid) == "01234567-89ab-cdef-fedc-ba9876543210");
+
+    // Canonical strings
+    REQUIRE(UUID(std::string("01234567-89AB-CDEF-FEDC-BA9876543210")) == uuid);
+    REQUIRE(UUID(std::string("{01234567-89ab-cdef-fedc-ba9876543210}")) == uuid);
+
+    // Other strings
+    REQUIRE(UUID(std::string("0123456789abcdeffedcba9876543210")) == uuid);
+    REQUIRE_THROWS(UUID(std::string("01234567-89ab-cdef-fedc-ba987654321x")));
+
+    // Round trip of random UUIDs
+    for (int i = 0; i < 1000; ++i)
+    {
+        UUID random = UUID::Random();
+        REQUIRE(UUID(random.string()) == random);
+    }
+}
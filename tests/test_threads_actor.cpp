@@ -0,0 +1,174 @@
+//
+// Created by Ivan Shynkarenka on 15.10.2026
+//
+
+#include "test.h"
+
+#include "threads/actor.h"
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace CppCommon;
+
+namespace {
+
+struct Message
+{
+    int sender;
+    int value;
+};
+
+class Counter : public Actor<Message>
+{
+public:
+    uint64_t sum{0};
+    uint64_t count{0};
+    bool ordered{true};
+    std::vector<int> last;
+
+    Counter(ActorSystem<Message>& system, int senders) : Actor<Message>(system), last(senders, -1) {}
+
+protected:
+    void OnMessage(Message& message) override
+    {
+        // Messages of the same sender must be processed in FIFO order
+        if (message.value <= last[message.sender])
+            ordered = false;
+        last[message.sender] = message.value;
+        sum += message.value;
+        ++count;
+    }
+};
+
+class Player : public Actor<int>
+{
+public:
+    Player* partner{nullptr};
+    std::atomic<int>& finished;
+    int received{0};
+
+    Player(ActorSystem<int>& system, std::atomic<int>& done) : Actor<int>(system), finished(done) {}
+
+protected:
+    void OnMessage(int& ball) override
+    {
+        ++received;
+        if (ball > 0)
+            partner->Send(ball - 1);
+        else
+            ++finished;
+    }
+};
+
+} // namespace
+
+TEST_CASE("Actor", "[CppCommon][Threads]")
+{
+    const int actors_count = 1000;
+    const int messages = 100;
+
+    auto pool = std::make_unique<ThreadPool>(4, ThreadPoolAffinity::NONE, 1024);
+    ActorSystem<Message> system(*pool, 16, 1024);
+    REQUIRE(system.throughput() == 16);
+
+    std::vector<std::unique_ptr<Counter>> actors;
+    for (int i = 0; i < actors_count; ++i)
+        actors.emplace_back(std::make_unique<Counter>(system, 1));
+
+    // Send messages from the single thread
+    for (int i = 0; i < messages; ++i)
+        for (auto& actor : actors)
+            REQUIRE(actor->Send(Message{ 0, i }));
+
+    // Destroy the thread pool to process all messages
+    pool.reset();
+
+    for (auto& actor : actors)
+    {
+        REQUIRE(actor->pending() == 0);
+        REQUIRE(actor->count == messages);
+        REQUIRE(actor->sum == (uint64_t)messages * (messages - 1) / 2);
+        REQUIRE(actor->ordered);
+    }
+}
+
+TEST_CASE("Actor multiple producers threads", "[CppCommon][Threads]")
+{
+    const int producers_count = 4;
+    const int actors_count = 64;
+    const int messages = 10000;
+
+    auto pool = std::make_unique<ThreadPool>(4);
+    ActorSystem<Message> system(*pool);
+
+    std::vector<std::unique_ptr<Counter>> actors;
+    for (int i = 0; i < actors_count; ++i)
+        actors.emplace_back(std::make_unique<Counter>(system, producers_count));
+
+    // Start producers threads
+    std::vector<std::thread> producers;
+    for (int producer = 0; producer < producers_count; ++producer)
+    {
+        producers.emplace_back([&actors, producer, messages]()
+        {
+            for (int i = 0; i < messages; ++i)
+            {
+                Message message{ producer, i };
+                // Retry while the messages pool is exhausted
+                while (!actors[i % actors.size()]->Send(message))
+                    std::this_thread::yield();
+            }
+        });
+    }
+
+    // Wait for producers threads
+    for (auto& producer : producers)
+        producer.join();
+
+    pool.reset();
+
+    uint64_t count = 0;
+    uint64_t sum = 0;
+    for (auto& actor : actors)
+    {
+        REQUIRE(actor->pending() == 0);
+        REQUIRE(actor->ordered);
+        count += actor->count;
+        sum += actor->sum;
+    }
+    REQUIRE(count == (uint64_t)producers_count * messages);
+    REQUIRE(sum == (uint64_t)producers_count * messages * (messages - 1) / 2);
+}
+
+TEST_CASE("Actor ping-pong", "[CppCommon][Threads]")
+{
+    const int pairs = 100;
+    const int rounds = 1000;
+
+    std::atomic<int> finished(0);
+
+    auto pool = std::make_unique<ThreadPool>(4);
+    ActorSystem<int> system(*pool);
+
+    std::vector<std::unique_ptr<Player>> players;
+    for (int i = 0; i < 2 * pairs; ++i)
+        players.emplace_back(std::make_unique<Player>(system, finished));
+    for (int i = 0; i < pairs; ++i)
+    {
+        players[2 * i]->partner = players[2 * i + 1].get();
+        players[2 * i + 1]->partner = players[2 * i].get();
+    }
+
+    // Serve balls, actors send messages to each other from worker threads
+    for (int i = 0; i < pairs; ++i)
+        REQUIRE(players[2 * i]->Send(2 * rounds - 1));
+
+    pool.reset();
+
+    REQUIRE(finished == pairs);
+    for (auto& player : players)
+        REQUIRE(player->received == rounds);
+}
@@ -0,0 +1,141 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "test.h"
+
+#include "threads/adaptive_lock.h"
+
+#include <thread>
+#include <vector>
+
+using namespace CppCommon;
+
+TEST_CASE("Adaptive lock", "[CppCommon][Threads]")
+{
+    AdaptiveLock lock;
+
+    // Test IsLocked() method
+    REQUIRE(!lock.IsLocked());
+
+    // Test TryLock() method
+    REQUIRE(lock.TryLock());
+    REQUIRE(lock.IsLocked());
+    REQUIRE(!lock.TryLock());
+    lock.Unlock();
+    REQUIRE(!lock.IsLocked());
+
+    // Test TryLockSpin() method
+    for (int i = -10; i < 10; ++i)
+    {
+        REQUIRE(lock.TryLockSpin(i));
+        REQUIRE(lock.IsLocked());
+        REQUIRE(!lock.TryLockSpin(i));
+        lock.Unlock();
+        REQUIRE(!lock.IsLocked());
+    }
+
+    // Test TryLockFor() method
+    REQUIRE(lock.TryLock());
+    REQUIRE(lock.IsLocked());
+    int64_t start = Timestamp::nano();
+    REQUIRE(!lock.TryLockFor(Timespan::microseconds(100)));
+    int64_t stop = Timestamp::nano();
+    REQUIRE(((stop - start) >= 100000));
+    lock.Unlock();
+    REQUIRE(!lock.IsLocked());
+
+    // Test TryLockUntil() method
+    REQUIRE(lock.TryLock());
+    REQUIRE(lock.IsLocked());
+    start = Timestamp::nano();
+    REQUIRE(!lock.TryLockUntil(UtcTimestamp() + Timespan::microseconds(100)));
+    stop = Timestamp::nano();
+    REQUIRE(((stop - start) >= 100000));
+    lock.Unlock();
+    REQUIRE(!lock.IsLocked());
+
+    // Test Lock()/Unlock() methods
+    lock.Lock();
+    REQUIRE(lock.IsLocked());
+    lock.Unlock();
+    REQUIRE(!lock.IsLocked());
+
+    // Uncontended locks are not counted
+    REQUIRE(lock.contentions() == 0);
+    REQUIRE(lock.parks() == 0);
+}
+
+TEST_CASE("Adaptive lock calibration", "[CppCommon][Threads]")
+{
+    REQUIRE(AdaptiveLock::CalibrateSpins(Timespan::zero()) == 0);
+    REQUIRE(AdaptiveLock::CalibrateSpins(Timespan::microseconds(1)) <= AdaptiveLock::CalibrateSpins(Timespan::microseconds(100)));
+
+    AdaptiveLock lock(Timespan::zero());
+    REQUIRE(lock.spins() == 0);
+}
+
+TEST_CASE("Adaptive lock park", "[CppCommon][Threads]")
+{
+    // Lock without spin budget always parks the contended thread
+    AdaptiveLock lock(Timespan::zero());
+
+    lock.Lock();
+    std::thread thread([&lock]()
+    {
+        lock.Lock();
+        lock.Unlock();
+    });
+
+    // Wait for the thread to park
+    while (lock.parks() == 0)
+        std::this_thread::yield();
+    REQUIRE(lock.contentions() == 1);
+
+    lock.Unlock();
+    thread.join();
+
+    REQUIRE(!lock.IsLocked());
+    REQUIRE(lock.spinned() == 0);
+}
+
+TEST_CASE("Adaptive lock locker", "[CppCommon][Threads]")
+{
+    int items_to_produce = 1000000;
+    int producers_count = 4;
+    int crc = 0;
+
+    AdaptiveLock lock;
+
+    REQUIRE(!lock.IsLocked());
+
+    // Calculate result value
+    int result = 0;
+    for (int i = 0; i < items_to_produce; ++i)
+        result += i;
+
+    // Start producers threads
+    std::vector<std::thread> producers;
+    for (int producer = 0; producer < producers_count; ++producer)
+    {
+        producers.emplace_back([&lock, &crc, producer, items_to_produce, producers_count]()
+        {
+            int items = (items_to_produce / producers_count);
+            for (int i = 0; i < items; ++i)
+            {
+                Locker<AdaptiveLock> locker(lock);
+                crc += (producer * items) + i;
+            }
+        });
+    }
+
+    // Wait for all producers threads
+    for (auto& producer : producers)
+        producer.join();
+
+    // Check result
+    REQUIRE(crc == result);
+
+    REQUIRE(!lock.IsLocked());
+    REQUIRE(lock.spinned() <= lock.contentions());
+}
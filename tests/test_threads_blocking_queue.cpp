@@ -0,0 +1,143 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "test.h"
+
+#include "threads/blocking_queue.h"
+#include "threads/mpmc_ring_queue.h"
+#include "threads/mpsc_ring_queue.h"
+#include "threads/spsc_ring_queue.h"
+
+#include <thread>
+#include <vector>
+
+using namespace CppCommon;
+
+namespace {
+
+template <class TQueue>
+int produce_consume(BlockingQueue<TQueue>& queue, int items_to_produce, int producers_count)
+{
+    int crc = 0;
+
+    // Start consumer thread
+    auto consumer = std::thread([&queue, &crc]()
+    {
+        // Consume items until the queue is closed
+        int item;
+        while (queue.Dequeue(item))
+            crc += item;
+    });
+
+    // Start producers threads
+    std::vector<std::thread> producers;
+    for (int producer = 0; producer < producers_count; ++producer)
+    {
+        producers.emplace_back([&queue, producer, items_to_produce, producers_count]()
+        {
+            int items = (items_to_produce / producers_count);
+            for (int i = 0; i < items; ++i)
+                if (!queue.Enqueue((producer * items) + i))
+                    break;
+        });
+    }
+
+    // Wait for all producers threads
+    for (auto& producer : producers)
+        producer.join();
+
+    // Close the blocking queue
+    queue.Close();
+
+    // Wait for the consumer thread
+    consumer.join();
+
+    return crc;
+}
+
+} // namespace
+
+TEST_CASE("Wait strategy", "[CppCommon][Threads]")
+{
+    WaitStrategy strategy(16, 4);
+
+    REQUIRE(strategy.spins() == 16);
+    REQUIRE(strategy.yields() == 4);
+    REQUIRE(strategy.waiters() == 0);
+
+    // Notify without waiters
+    strategy.Notify();
+
+    // Satisfied condition returns immediately
+    int calls = 0;
+    strategy.Wait([&calls]() { return ++calls > 0; });
+    REQUIRE(calls == 1);
+
+    // Parked waiter is woken up by notify
+    std::atomic<bool> flag(false);
+    auto waiter = std::thread([&strategy, &flag]()
+    {
+        strategy.Wait([&flag]() { return flag.load(); });
+    });
+    while (strategy.waiters() == 0)
+        Thread::Yield();
+    flag = true;
+    strategy.Notify();
+    waiter.join();
+
+    REQUIRE(strategy.waiters() == 0);
+}
+
+TEST_CASE("Blocking queue", "[CppCommon][Threads]")
+{
+    BlockingQueue<MPMCRingQueue<int>> queue(4);
+
+    REQUIRE(!queue.closed());
+    REQUIRE(queue.capacity() == 4);
+    REQUIRE(queue.size() == 0);
+
+    int v = -1;
+
+    REQUIRE(!queue.TryDequeue(v));
+
+    REQUIRE((queue.Enqueue(0) && (queue.size() == 1)));
+    REQUIRE((queue.Enqueue(1) && (queue.size() == 2)));
+    REQUIRE((queue.TryEnqueue(2) && (queue.size() == 3)));
+    REQUIRE((queue.TryEnqueue(3) && (queue.size() == 4)));
+    REQUIRE(!queue.TryEnqueue(4));
+
+    REQUIRE(((queue.Dequeue(v) && (v == 0)) && (queue.size() == 3)));
+    REQUIRE(((queue.TryDequeue(v) && (v == 1)) && (queue.size() == 2)));
+
+    queue.Close();
+
+    REQUIRE(queue.closed());
+    REQUIRE(!queue.Enqueue(5));
+    REQUIRE(!queue.TryEnqueue(5));
+
+    // Remaining items are dequeued after close
+    REQUIRE(((queue.Dequeue(v) && (v == 2)) && (queue.size() == 1)));
+    REQUIRE(((queue.Dequeue(v) && (v == 3)) && (queue.size() == 0)));
+    REQUIRE(!queue.Dequeue(v));
+}
+
+TEST_CASE("Blocking queue threads", "[CppCommon][Threads]")
+{
+    int items_to_produce = 10000;
+    int producers_count = 4;
+
+    // Calculate result value
+    int result = 0;
+    for (int i = 0; i < items_to_produce; ++i)
+        result += i;
+
+    BlockingQueue<MPMCRingQueue<int>> mpmc(8);
+    REQUIRE(produce_consume(mpmc, items_to_produce, producers_count) == result);
+
+    BlockingQueue<MPSCRingQueue<int>> mpsc(8, producers_count);
+    REQUIRE(produce_consume(mpsc, items_to_produce, producers_count) == result);
+
+    BlockingQueue<SPSCRingQueue<int>> spsc(8);
+    REQUIRE(produce_consume(spsc, items_to_produce, 1) == result);
+}
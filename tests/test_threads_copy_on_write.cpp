@@ -0,0 +1,121 @@
+//
+// Created by Ivan Shynkarenka on 15.10.2026
+//
+
+#include "test.h"
+
+#include "containers/hashmap.h"
+#include "threads/copy_on_write.h"
+#include "threads/thread.h"
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace CppCommon;
+
+TEST_CASE("Copy-on-write base", "[CppCommon][Threads]")
+{
+    CopyOnWrite<std::string> cow("initial");
+    REQUIRE(cow.version() == 0);
+    REQUIRE(cow.Read() == "initial");
+
+    REQUIRE(cow.Write("updated") == 1);
+    REQUIRE(cow.Read() == "updated");
+
+    cow = "assigned";
+    REQUIRE(cow.version() == 2);
+    REQUIRE(cow.Read() == "assigned");
+
+    // Reader keeps the snapshot alive while new data is published
+    {
+        CopyOnWrite<std::string>::Reader reader(cow);
+        REQUIRE(reader.version() == 2);
+
+        REQUIRE(cow.Modify([](std::string& data) { data += "!"; }) == 3);
+        REQUIRE(cow.Read() == "assigned!");
+
+        REQUIRE(*reader == "assigned");
+        REQUIRE(reader->size() == 8);
+    }
+
+    REQUIRE(cow.Visit([](const std::string& data) { return data.size(); }) == 9);
+}
+
+TEST_CASE("Copy-on-write random", "[CppCommon][Threads]")
+{
+    int items_to_produce = 1000;
+    int producers_count = 2;
+    int consumers_count = 4;
+
+    // Readers check the consistency of the published hash map
+    CopyOnWrite<HashMap<int, int>> cow(16, -2);
+    cow.Modify([](HashMap<int, int>& data) { data.emplace(-1, 1); });
+
+    std::atomic<bool> done(false);
+    std::atomic<int> broken(0);
+
+    // Start producers threads
+    std::vector<std::thread> producers;
+    for (int producer = 0; producer < producers_count; ++producer)
+    {
+        producers.emplace_back([&cow, producer, items_to_produce]()
+        {
+            for (int i = 0; i < items_to_produce; ++i)
+            {
+                int key = producer * items_to_produce + i;
+                cow.Modify([key](HashMap<int, int>& data)
+                {
+                    data.emplace(key, -key);
+                    data[-1] = (int)data.size();
+                });
+
+                // Yield to another thread...
+                if ((i % 16) == 0)
+                    Thread::Yield();
+            }
+        });
+    }
+
+    // Start consumers threads
+    std::vector<std::thread> consumers;
+    for (int consumer = 0; consumer < consumers_count; ++consumer)
+    {
+        consumers.emplace_back([&cow, &done, &broken]()
+        {
+            uint64_t last = 0;
+            while (!done)
+            {
+                CopyOnWrite<HashMap<int, int>>::Reader reader(cow);
+
+                // Versions are never going back
+                if (reader.version() < last)
+                    ++broken;
+                last = reader.version();
+
+                const auto& data = *reader;
+                auto it = data.find(-1);
+                if ((it == data.end()) || (it->second != (int)data.size()))
+                    ++broken;
+                for (const auto& item : data)
+                    if ((item.first >= 0) && (item.second != -item.first))
+                        ++broken;
+            }
+        });
+    }
+
+    // Wait for all producers threads
+    for (auto& producer : producers)
+        producer.join();
+
+    done = true;
+
+    // Wait for all consumers threads
+    for (auto& consumer : consumers)
+        consumer.join();
+
+    REQUIRE(broken == 0);
+    REQUIRE(cow.version() == (uint64_t)(producers_count * items_to_produce + 1));
+    REQUIRE(cow.Visit([](const HashMap<int, int>& data) { return data.size(); }) == (size_t)(producers_count * items_to_produce + 1));
+}
@@ -0,0 +1,170 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "test.h"
+
+#include "threads/coroutine.h"
+#include "threads/latch.h"
+#include "threads/thread_pool.h"
+#include "threads/wait_batcher.h"
+#include "threads/wait_queue.h"
+#include "threads/wait_ring.h"
+
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace CppCommon;
+
+#if defined(CPPCOMMON_COROUTINES)
+
+namespace {
+
+CoroutineTask<int> Square(int value)
+{
+    co_return value * value;
+}
+
+CoroutineTask<int> Fail()
+{
+    throw std::runtime_error("error");
+    co_return 0;
+}
+
+CoroutineTask<> Compute(int& result, bool& failed)
+{
+    result = (co_await Square(3)) + (co_await Square(4));
+    try
+    {
+        co_await Fail();
+    }
+    catch (const std::runtime_error&)
+    {
+        failed = true;
+    }
+}
+
+template <class TContainer, class TScheduler>
+CoroutineTask<> Consume(TContainer& container, TScheduler& scheduler, std::atomic<uint64_t>& crc, Latch& latch)
+{
+    int item;
+    while (co_await container.DequeueAsync(item, scheduler))
+        crc += item;
+    latch.CountDown();
+}
+
+template <typename T, class TScheduler>
+CoroutineTask<> ConsumeBatches(WaitBatcher<T>& batcher, TScheduler& scheduler, std::atomic<uint64_t>& crc, Latch& latch)
+{
+    std::vector<T> items;
+    while (co_await batcher.DequeueAsync(items, scheduler))
+        for (auto& item : items)
+            crc += item;
+    latch.CountDown();
+}
+
+} // namespace
+
+TEST_CASE("Coroutine task", "[CppCommon][Threads]")
+{
+    int result = 0;
+    bool failed = false;
+
+    InlineScheduler scheduler;
+    CoroutineTask<> task = Compute(result, failed);
+    REQUIRE(task);
+    REQUIRE(!task.done());
+    task.Spawn(scheduler);
+    REQUIRE(!task);
+
+    REQUIRE(result == 25);
+    REQUIRE(failed);
+}
+
+TEST_CASE("Coroutine wait queue with inline scheduler", "[CppCommon][Threads]")
+{
+    int items_to_produce = 1000;
+    std::atomic<uint64_t> crc(0);
+    Latch latch(1);
+
+    InlineScheduler scheduler;
+    WaitQueue<int> queue;
+
+    // Consumer is suspended on the empty queue and resumed in the producer thread
+    Consume(queue, scheduler, crc, latch).Spawn(scheduler);
+    REQUIRE(!latch.TryWait());
+
+    for (int i = 0; i < items_to_produce; ++i)
+        REQUIRE(queue.Enqueue(i));
+    REQUIRE(queue.empty());
+
+    // Closing the queue resumes the consumer with 'false'
+    queue.Close();
+    REQUIRE(latch.TryWait());
+    REQUIRE(crc == (uint64_t)items_to_produce * (items_to_produce - 1) / 2);
+}
+
+TEST_CASE("Coroutine wait ring with thread pool scheduler", "[CppCommon][Threads]")
+{
+    int consumers = 1000;
+    int producers = 4;
+    int items_to_produce = 10000;
+    std::atomic<uint64_t> crc(0);
+    Latch latch(consumers);
+
+    ThreadPool pool(2);
+    WaitRing<int> ring(1024);
+
+    // Many consumers share a couple of worker threads
+    for (int consumer = 0; consumer < consumers; ++consumer)
+        Consume(ring, pool, crc, latch).Spawn(pool);
+
+    std::vector<std::thread> threads;
+    for (int producer = 0; producer < producers; ++producer)
+    {
+        threads.emplace_back([&ring, items_to_produce]()
+        {
+            for (int i = 0; i < items_to_produce; ++i)
+                ring.Enqueue(i);
+        });
+    }
+
+    for (auto& thread : threads)
+        thread.join();
+
+    // Wait until all items are consumed and close the ring
+    while (!ring.empty())
+        std::this_thread::yield();
+    ring.Close();
+    latch.Wait();
+
+    REQUIRE(crc == (uint64_t)producers * items_to_produce * (items_to_produce - 1) / 2);
+}
+
+TEST_CASE("Coroutine wait batcher with thread pool scheduler", "[CppCommon][Threads]")
+{
+    int consumers = 100;
+    int items_to_produce = 10000;
+    std::atomic<uint64_t> crc(0);
+    Latch latch(consumers);
+
+    ThreadPool pool(2);
+    WaitBatcher<int> batcher;
+
+    for (int consumer = 0; consumer < consumers; ++consumer)
+        ConsumeBatches(batcher, pool, crc, latch).Spawn(pool);
+
+    for (int i = 0; i < items_to_produce; ++i)
+        batcher.Enqueue(i);
+
+    while (!batcher.empty())
+        std::this_thread::yield();
+    batcher.Close();
+    latch.Wait();
+
+    REQUIRE(crc == (uint64_t)items_to_produce * (items_to_produce - 1) / 2);
+}
+
+#endif
@@ -0,0 +1,160 @@
+//
+// Created by Ivan Shynkarenka on 15.10.2026
+//
+
+#include "test.h"
+
+#include "threads/disruptor.h"
+
+#include <thread>
+#include <vector>
+
+using namespace CppCommon;
+
+TEST_CASE("Disruptor", "[CppCommon][Threads]")
+{
+    Disruptor<int, DisruptorProducer::SINGLE> disruptor(4);
+    auto& journaler = disruptor.AddConsumer();
+    auto& replicator = disruptor.AddConsumer();
+    auto& logic = disruptor.AddConsumer({ &journaler });
+
+    REQUIRE(!disruptor.closed());
+    REQUIRE(disruptor.capacity() == 4);
+    REQUIRE(disruptor.consumers() == 3);
+    REQUIRE(disruptor.size() == 0);
+
+    uint64_t sequence = 0;
+    REQUIRE((disruptor.TryClaim(sequence, 3) && (sequence == 0)));
+    for (int i = 0; i < 3; ++i)
+        disruptor[sequence + i] = i;
+    REQUIRE(disruptor.Available(journaler) == 0);
+    disruptor.Publish(sequence, 3);
+    REQUIRE(disruptor.size() == 3);
+
+    // Only one free slot is left until all consumers release items
+    REQUIRE(disruptor.TryClaim(sequence));
+    REQUIRE(!disruptor.TryClaim(sequence));
+    disruptor[3] = 3;
+    disruptor.Publish(3);
+
+    // Business logic is gated on the journaler
+    REQUIRE(disruptor.Available(journaler) == 4);
+    REQUIRE(disruptor.Available(replicator) == 4);
+    REQUIRE(disruptor.Available(logic) == 0);
+
+    int sum = 0;
+    REQUIRE(disruptor.Consume(journaler, [&sum](int& item, uint64_t, bool) { sum += item; }, 2) == 2);
+    REQUIRE(sum == 1);
+    REQUIRE(journaler.sequence() == 2);
+    REQUIRE(disruptor.Available(logic) == 2);
+    REQUIRE(!disruptor.TryClaim(sequence));
+
+    REQUIRE(disruptor.Consume(replicator, [](int&, uint64_t, bool) {}) == 4);
+    REQUIRE(disruptor.Consume(logic, [](int&, uint64_t, bool) {}) == 2);
+    REQUIRE(disruptor.size() == 2);
+
+    // Slots of released items are reused
+    REQUIRE((disruptor.TryClaim(sequence, 2) && (sequence == 4)));
+    disruptor.Publish(sequence, 2);
+
+    disruptor.Close();
+    REQUIRE(disruptor.closed());
+    REQUIRE(!disruptor.Enqueue(6));
+
+    // Closed disruptor is consumed until the end
+    REQUIRE(disruptor.Wait(journaler) == 4);
+    disruptor.Release(journaler, 4);
+    REQUIRE(disruptor.Wait(journaler) == 0);
+    REQUIRE(disruptor.Wait(logic) == 4);
+    disruptor.Release(logic, 4);
+    REQUIRE(disruptor.Wait(logic) == 0);
+    REQUIRE(disruptor.Wait(replicator) == 2);
+}
+
+template <DisruptorProducer sequencer>
+void DisruptorThreads(int producers_count)
+{
+    const int items_to_produce = 100000;
+
+    Disruptor<int, sequencer> disruptor(1024);
+    auto& journaler = disruptor.AddConsumer();
+    auto& replicator = disruptor.AddConsumer();
+    auto& logic = disruptor.AddConsumer({ &journaler, &replicator });
+
+    // Calculate result value
+    int64_t result = 0;
+    for (int i = 0; i < items_to_produce; ++i)
+        result += i;
+
+    int64_t crcs[3] = { 0, 0, 0 };
+    bool ordered = true;
+
+    // Start consumers threads
+    std::vector<std::thread> consumers;
+    consumers.emplace_back([&disruptor, &journaler, &crcs]()
+    {
+        while (disruptor.Consume(journaler, [&crcs](int& item, uint64_t, bool) { crcs[0] += item; }) > 0);
+    });
+    consumers.emplace_back([&disruptor, &replicator, &crcs]()
+    {
+        while (disruptor.Consume(replicator, [&crcs](int& item, uint64_t, bool) { crcs[1] += item; }) > 0);
+    });
+    consumers.emplace_back([&disruptor, &logic, &journaler, &replicator, &crcs, &ordered]()
+    {
+        while (disruptor.Consume(logic, [&](int& item, uint64_t sequence, bool)
+        {
+            // Dependencies must release the item before the business logic
+            if ((journaler.sequence() <= sequence) || (replicator.sequence() <= sequence))
+                ordered = false;
+            crcs[2] += item;
+        }) > 0);
+    });
+
+    // Start producers threads
+    std::vector<std::thread> producers;
+    for (int producer_index = 0; producer_index < producers_count; ++producer_index)
+    {
+        producers.emplace_back([&disruptor, producer_index, producers_count, items_to_produce]()
+        {
+            int items = (items_to_produce / producers_count);
+            int first = producer_index * items;
+            for (int i = 0; i < items;)
+            {
+                // Claim and publish batches of items
+                size_t count = std::min(16, items - i);
+                uint64_t sequence;
+                if (!disruptor.Claim(sequence, count))
+                    break;
+                for (size_t j = 0; j < count; ++j)
+                    disruptor[sequence + j] = first + i + (int)j;
+                disruptor.Publish(sequence, count);
+                i += (int)count;
+            }
+        });
+    }
+
+    // Wait for producers threads
+    for (auto& producer : producers)
+        producer.join();
+
+    // Close the disruptor and wait for consumers threads
+    disruptor.Close();
+    for (auto& consumer : consumers)
+        consumer.join();
+
+    REQUIRE(crcs[0] == result);
+    REQUIRE(crcs[1] == result);
+    REQUIRE(crcs[2] == result);
+    REQUIRE(ordered);
+    REQUIRE(disruptor.size() == 0);
+}
+
+TEST_CASE("Disruptor single producer threads", "[CppCommon][Threads]")
+{
+    DisruptorThreads<DisruptorProducer::SINGLE>(1);
+}
+
+TEST_CASE("Disruptor multiple producers threads", "[CppCommon][Threads]")
+{
+    DisruptorThreads<DisruptorProducer::MULTI>(4);
+}
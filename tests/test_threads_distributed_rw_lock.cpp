@@ -0,0 +1,139 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "test.h"
+
+#include "threads/distributed_rw_lock.h"
+#include "threads/thread.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace CppCommon;
+
+TEST_CASE("Distributed read/write lock", "[CppCommon][Threads]")
+{
+    DistributedRWLock lock(3);
+    REQUIRE(lock.slots() == 4);
+
+    // Test TryLockRead() method
+    REQUIRE(lock.TryLockRead());
+    REQUIRE(!lock.TryLockWrite());
+    lock.UnlockRead();
+
+    // Test TryLockWrite() method
+    REQUIRE(lock.TryLockWrite());
+    REQUIRE(!lock.TryLockRead());
+    REQUIRE(!lock.TryLockWrite());
+    lock.UnlockWrite();
+
+    // Test LockRead()/UnlockRead() methods
+    lock.LockRead();
+    REQUIRE(!lock.TryLockWrite());
+    REQUIRE(!lock.TryLockWriteFor(Timespan::microseconds(100)));
+    lock.UnlockRead();
+
+    // Test LockWrite()/UnlockWrite() methods
+    lock.LockWrite();
+    REQUIRE(!lock.TryLockRead());
+    REQUIRE(!lock.TryLockReadFor(Timespan::microseconds(100)));
+    lock.UnlockWrite();
+
+    // Test TryLockReadFor()/TryLockWriteFor() methods
+    REQUIRE(lock.TryLockReadFor(Timespan::microseconds(100)));
+    lock.UnlockRead();
+    REQUIRE(lock.TryLockWriteFor(Timespan::microseconds(100)));
+    lock.UnlockWrite();
+}
+
+TEST_CASE("Distributed read/write lock concurrent readers", "[CppCommon][Threads]")
+{
+    DistributedRWLock lock;
+    REQUIRE(lock.slots() > 0);
+
+    // Readers of different threads hold the read lock at the same time
+    bool locked = false;
+    lock.LockRead();
+    std::thread reader([&lock, &locked]()
+    {
+        locked = lock.TryLockRead();
+        if (locked)
+            lock.UnlockRead();
+    });
+    reader.join();
+    lock.UnlockRead();
+    REQUIRE(locked);
+}
+
+TEST_CASE("Distributed read/write locker", "[CppCommon][Threads]")
+{
+    int items_to_produce = 1000;
+    int consumers_count = 4;
+    int crc = 0;
+
+    // Pair of values which must be always consistent for readers
+    int value1 = 0;
+    int value2 = 0;
+    std::atomic<int> broken(0);
+    std::atomic<bool> done(false);
+
+    DistributedRWLock lock(2);
+
+    // Calculate result value
+    int result = 0;
+    for (int i = 0; i < items_to_produce; ++i)
+        result += i;
+
+    // Start producer thread
+    std::thread producer = std::thread([&]()
+    {
+        for (int i = 0; i < items_to_produce; ++i)
+        {
+            // Use a write locker to produce the item
+            {
+                WriteLocker<DistributedRWLock> locker(lock);
+                value1 = i;
+                value2 = -i;
+                crc += i;
+            }
+
+            // Yield to another thread...
+            Thread::Yield();
+        }
+        done = true;
+    });
+
+    // Start consumers threads
+    std::vector<std::thread> consumers;
+    for (int consumer = 0; consumer < consumers_count; ++consumer)
+    {
+        consumers.emplace_back([&]()
+        {
+            while (!done)
+            {
+                // Use a read locker to consume the item
+                {
+                    ReadLocker<DistributedRWLock> locker(lock);
+                    if (value1 != -value2)
+                        ++broken;
+                }
+
+                // Yield to another thread...
+                Thread::Yield();
+            }
+        });
+    }
+
+    // Wait for producer thread
+    producer.join();
+
+    // Wait for all consumers threads
+    for (auto& consumer : consumers)
+        consumer.join();
+
+    // Check result
+    REQUIRE(crc == result);
+    REQUIRE(broken == 0);
+}
@@ -0,0 +1,136 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "test.h"
+
+#include "threads/epoch_reclamation.h"
+#include "threads/thread.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace CppCommon;
+
+namespace {
+
+struct Config
+{
+    static std::atomic<int> instances;
+
+    int value;
+    int check;
+
+    explicit Config(int v) : value(v), check(-v) { ++instances; }
+    ~Config() { check = 1; --instances; }
+};
+
+std::atomic<int> Config::instances(0);
+
+} // namespace
+
+TEST_CASE("Epoch reclamation", "[CppCommon][Threads]")
+{
+    Config::instances = 0;
+    {
+        EpochReclamation domain(4, 1000);
+        REQUIRE(domain.slots() == 4);
+        REQUIRE(domain.threshold() == 1000);
+
+        int deleted = 0;
+        int value = 0;
+
+        // Retired node is not deleted while the reader is active
+        EpochReclamation::Token token = domain.Enter();
+        domain.Retire(&value, [&deleted](int*) { ++deleted; });
+        REQUIRE(domain.retired() == 1);
+        domain.Reclaim();
+        domain.Reclaim();
+        domain.Reclaim();
+        REQUIRE(deleted == 0);
+        REQUIRE(domain.pending() == 1);
+        domain.Leave(token);
+
+        // Retired node is deleted after the reader leaves
+        domain.Reclaim();
+        domain.Reclaim();
+        REQUIRE(deleted == 1);
+        REQUIRE(domain.reclaimed() == 1);
+        REQUIRE(domain.pending() == 0);
+
+        // Nested critical sections
+        {
+            EpochReclamation::Guard guard1(domain);
+            EpochReclamation::Guard guard2(domain);
+            domain.Retire(new Config(1));
+            domain.Reclaim();
+            domain.Reclaim();
+            REQUIRE(Config::instances == 1);
+        }
+        domain.Synchronize();
+        REQUIRE(Config::instances == 0);
+
+        // Not reclaimed nodes are deleted with the domain
+        domain.Retire(new Config(2));
+        REQUIRE(Config::instances == 1);
+    }
+    REQUIRE(Config::instances == 0);
+}
+
+TEST_CASE("Epoch reclamation config pointer", "[CppCommon][Threads]")
+{
+    int items_to_produce = 10000;
+    int consumers_count = 4;
+
+    Config::instances = 0;
+    {
+        EpochReclamation domain;
+        std::atomic<Config*> config(new Config(0));
+
+        std::atomic<bool> done(false);
+        std::atomic<int> broken(0);
+
+        // Start consumers threads which read the current config snapshot
+        std::vector<std::thread> consumers;
+        for (int consumer = 0; consumer < consumers_count; ++consumer)
+        {
+            consumers.emplace_back([&domain, &config, &done, &broken]()
+            {
+                while (!done)
+                {
+                    {
+                        EpochReclamation::Guard guard(domain);
+                        Config* current = config.load(std::memory_order_acquire);
+                        if (current->check != -current->value)
+                            ++broken;
+                    }
+
+                    // Yield to another thread...
+                    Thread::Yield();
+                }
+            });
+        }
+
+        // Swap config snapshots and retire the previous ones
+        for (int i = 1; i <= items_to_produce; ++i)
+        {
+            Config* previous = config.exchange(new Config(i), std::memory_order_acq_rel);
+            domain.Retire(previous);
+            if ((i % 64) == 0)
+                Thread::Yield();
+        }
+
+        done = true;
+        for (auto& consumer : consumers)
+            consumer.join();
+
+        domain.Synchronize();
+        REQUIRE(broken == 0);
+        REQUIRE(domain.pending() == 0);
+        REQUIRE(Config::instances == 1);
+
+        delete config.load();
+    }
+    REQUIRE(Config::instances == 0);
+}
@@ -38,6 +38,35 @@ TEST_CASE("File-lock", "[CppCommon][Threads]")
     lock1.UnlockWrite();
 }
 
+TEST_CASE("File-lock byte ranges", "[CppCommon][Threads]")
+{
+    FileLock lock1(".lock");
+    FileLock lock2(".lock");
+
+    // Test disjoint byte ranges
+    REQUIRE(lock1.TryLockRange(0, 100, false));
+    REQUIRE(lock2.TryLockRange(100, 100, false));
+    REQUIRE(!lock2.TryLockRange(50, 10, true));
+
+    // Test covered byte ranges
+    REQUIRE(lock1.TryLockRange(10, 10, true));
+    lock1.UnlockRange(0, 100, false);
+    REQUIRE(lock2.TryLockRange(0, 10, false));
+    REQUIRE(!lock2.TryLockRange(10, 10, false));
+    REQUIRE(lock2.TryLockRange(10, 10, true));
+    lock1.UnlockRange(10, 10, true);
+    lock2.UnlockRange(10, 10, true);
+    lock2.UnlockRange(0, 10, false);
+    lock2.UnlockRange(100, 100, false);
+
+    // Test LockRange()/UnlockRange() methods
+    lock1.LockRange(0, 0, true);
+    REQUIRE(!lock2.TryLockRange(1000, 10, false));
+    REQUIRE(lock2.TryLockRangeFor(1000, 10, true, Timespan::milliseconds(10)));
+    lock1.UnlockRange(0, 0, true);
+    lock2.UnlockRange(1000, 10, true);
+}
+
 TEST_CASE("File-locker", "[CppCommon][Threads]")
 {
     int items_to_produce = 10;
@@ -0,0 +1,42 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "test.h"
+
+#include "system/shared_type.h"
+#include "threads/futex.h"
+
+#include <thread>
+
+using namespace CppCommon;
+
+#if defined(linux) || defined(__linux) || defined(__linux__)
+
+TEST_CASE("Futex", "[CppCommon][Threads]")
+{
+    // Two mappings of the same shared memory have different addresses
+    SharedType<std::atomic<uint32_t>> master("futex_test");
+    SharedType<std::atomic<uint32_t>> slave("futex_test");
+    REQUIRE(master.ptr() != slave.ptr());
+    master->store(0);
+
+    std::thread waiter([&slave]()
+    {
+        while (slave->load() == 0)
+            Futex::Wait(*slave, 0);
+    });
+
+    master->store(1);
+    Futex::WakeAll(*master);
+    waiter.join();
+
+    // Timeout in case of the unchanged value
+    REQUIRE(!Futex::WaitFor(*master, 1, Timespan::milliseconds(10)));
+    REQUIRE(!Futex::WaitFor(*master, 1, Timespan::zero()));
+
+    // Immediate return in case of the changed value
+    REQUIRE(Futex::WaitFor(*master, 0, Timespan::seconds(10)));
+}
+
+#endif
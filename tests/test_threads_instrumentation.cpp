@@ -0,0 +1,102 @@
+//
+// Created by Ivan Shynkarenka on 15.10.2026
+//
+
+#include "test.h"
+
+#include "threads/instrumentation.h"
+#include "threads/mpmc_ring_queue.h"
+#include "threads/spin_lock.h"
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+using namespace CppCommon;
+
+namespace {
+
+InstrumentationSample Find(const std::vector<InstrumentationSample>& samples, const std::string& name, uint64_t id)
+{
+    auto it = std::find_if(samples.begin(), samples.end(), [&](const InstrumentationSample& sample) { return (sample.name == name) && (sample.id == id); });
+    return (it != samples.end()) ? *it : InstrumentationSample();
+}
+
+} // namespace
+
+TEST_CASE("Instrumentation counters", "[CppCommon][Threads]")
+{
+    int threads_count = 8;
+    uint64_t increments = 10000;
+
+    InstrumentationSample retired;
+    {
+        InstrumentationCounters counters("TestInstrumentation");
+        REQUIRE(counters.id() > 0);
+
+        std::vector<std::thread> threads;
+        for (int thread = 0; thread < threads_count; ++thread)
+        {
+            threads.emplace_back([&counters, increments]()
+            {
+                for (uint64_t i = 0; i < increments; ++i)
+                {
+                    counters.Increment(InstrumentationEvent::CONTENDED);
+                    counters.Increment(InstrumentationEvent::SPINS, 2);
+                }
+            });
+        }
+
+        for (auto& thread : threads)
+            thread.join();
+
+        InstrumentationSample sample = counters.Read();
+        REQUIRE(sample.name == "TestInstrumentation");
+        REQUIRE(sample.contended() == (threads_count * increments));
+        REQUIRE(sample.spins() == (2 * threads_count * increments));
+        REQUIRE(sample.full() == 0);
+        REQUIRE(sample.empty() == 0);
+
+        // Alive instance is registered
+        REQUIRE(Find(InstrumentationRegistry::Snapshot(), "TestInstrumentation", counters.id()).contended() == sample.contended());
+        retired = Find(InstrumentationRegistry::Snapshot(), "TestInstrumentation", 0);
+    }
+
+    // Destroyed instance is accumulated into the totals
+    InstrumentationSample totals = Find(InstrumentationRegistry::Totals(), "TestInstrumentation", 0);
+    REQUIRE(totals.contended() == (retired.contended() + (threads_count * increments)));
+    REQUIRE(totals.spins() == (retired.spins() + (2 * threads_count * increments)));
+
+    // Detached counters ignore increments
+    InstrumentationCounters detached;
+    detached.Increment(InstrumentationEvent::FULL);
+    REQUIRE(detached.id() == 0);
+    REQUIRE(detached.Read().full() == 0);
+}
+
+TEST_CASE("Instrumentation of queues and locks", "[CppCommon][Threads]")
+{
+    if (!InstrumentationRegistry::IsEnabled())
+        return;
+
+    MPMCRingQueue<int> queue(2);
+    int item;
+    REQUIRE(!queue.Dequeue(item));
+    REQUIRE(queue.Enqueue(1));
+    REQUIRE(queue.Enqueue(2));
+    REQUIRE(!queue.Enqueue(3));
+
+    InstrumentationSample sample = Find(InstrumentationRegistry::Totals(), "MPMCRingQueue", 0);
+    REQUIRE(sample.name == "MPMCRingQueue");
+    REQUIRE(sample.full() >= 1);
+    REQUIRE(sample.empty() >= 1);
+
+    SpinLock lock;
+    lock.Lock();
+    REQUIRE(!lock.TryLock());
+    lock.Unlock();
+
+    sample = Find(InstrumentationRegistry::Totals(), "SpinLock", 0);
+    REQUIRE(sample.name == "SpinLock");
+    REQUIRE(sample.contended() >= 1);
+}
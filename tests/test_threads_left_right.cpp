@@ -0,0 +1,105 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "test.h"
+
+#include "threads/left_right.h"
+#include "threads/thread.h"
+
+#include <atomic>
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace CppCommon;
+
+TEST_CASE("Left-Right base", "[CppCommon][Threads]")
+{
+    LeftRight<std::string> lock("initial");
+    REQUIRE(lock.Read() == "initial");
+
+    lock.Write("updated");
+    REQUIRE(lock.Read() == "updated");
+
+    lock = "assigned";
+    REQUIRE(lock.Read() == "assigned");
+
+    // Modification is applied to both data instances
+    lock.Modify([](std::string& data) { data += "!"; });
+    REQUIRE(lock.Read() == "assigned!");
+    lock.Write(lock.Read());
+    REQUIRE(lock.Read() == "assigned!");
+
+    size_t size = 0;
+    lock.Visit([&size](const std::string& data) { size = data.size(); });
+    REQUIRE(size == 9);
+}
+
+TEST_CASE("Left-Right random", "[CppCommon][Threads]")
+{
+    int items_to_produce = 10000;
+    int producers_count = 2;
+    int consumers_count = 4;
+
+    // Readers check the consistency of not trivially copyable data
+    LeftRight<std::map<int, int>> lock(std::map<int, int>({ { -1, 1 } }));
+
+    std::atomic<bool> done(false);
+    std::atomic<int> broken(0);
+
+    // Start producers threads
+    std::vector<std::thread> producers;
+    for (int producer = 0; producer < producers_count; ++producer)
+    {
+        producers.emplace_back([&lock, producer, items_to_produce]()
+        {
+            for (int i = 0; i < items_to_produce; ++i)
+            {
+                int key = producer * items_to_produce + i;
+                lock.Modify([key](std::map<int, int>& data)
+                {
+                    data[key] = -key;
+                    data[-1] = (int)data.size();
+                });
+
+                // Yield to another thread...
+                if ((i % 16) == 0)
+                    Thread::Yield();
+            }
+        });
+    }
+
+    // Start consumers threads
+    std::vector<std::thread> consumers;
+    for (int consumer = 0; consumer < consumers_count; ++consumer)
+    {
+        consumers.emplace_back([&lock, &done, &broken]()
+        {
+            while (!done)
+            {
+                lock.Visit([&broken](const std::map<int, int>& data)
+                {
+                    if (data.at(-1) != (int)data.size())
+                        ++broken;
+                });
+
+                // Yield to another thread...
+                Thread::Yield();
+            }
+        });
+    }
+
+    // Wait for all producers threads
+    for (auto& producer : producers)
+        producer.join();
+
+    // Wait for all consumers threads
+    done = true;
+    for (auto& consumer : consumers)
+        consumer.join();
+
+    REQUIRE(broken == 0);
+    REQUIRE(lock.Read().size() == (size_t)(producers_count * items_to_produce + 1));
+}
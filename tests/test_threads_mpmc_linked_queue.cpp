@@ -0,0 +1,190 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "test.h"
+
+#include "threads/mpmc_linked_queue.h"
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace CppCommon;
+
+TEST_CASE("Multiple producers / multiple consumers lock-free linked queue", "[CppCommon][Threads]")
+{
+    DefaultMemoryManager auxiliary;
+    MPMCLinkedQueue<int, 4> queue(auxiliary);
+
+    int v = -1;
+
+    REQUIRE(!queue.Dequeue(v));
+
+    REQUIRE(queue.Enqueue(0));
+    REQUIRE(queue.Enqueue(1));
+    REQUIRE(queue.Enqueue(2));
+
+    REQUIRE(((queue.Dequeue(v) && (v == 0))));
+    REQUIRE(((queue.Dequeue(v) && (v == 1))));
+
+    REQUIRE(queue.Enqueue(3));
+    REQUIRE(queue.Enqueue(4));
+
+    REQUIRE(((queue.Dequeue(v) && (v == 2))));
+    REQUIRE(((queue.Dequeue(v) && (v == 3))));
+    REQUIRE(((queue.Dequeue(v) && (v == 4))));
+    REQUIRE(!queue.Dequeue(v));
+
+    REQUIRE(queue.Enqueue(5));
+
+    REQUIRE((queue.Dequeue(v) && (v == 5)));
+    REQUIRE(!queue.Dequeue(v));
+}
+
+TEST_CASE("Multiple producers / multiple consumers lock-free linked queue grows over segments", "[CppCommon][Threads]")
+{
+    DefaultMemoryManager auxiliary;
+    MPMCLinkedQueue<int, 8> queue(auxiliary, 4);
+
+    // Fill many segments and keep FIFO order across them
+    for (int i = 0; i < 1000; ++i)
+        REQUIRE(queue.Enqueue(i));
+
+    int v = -1;
+    for (int i = 0; i < 1000; ++i)
+        REQUIRE((queue.Dequeue(v) && (v == i)));
+    REQUIRE(!queue.Dequeue(v));
+}
+
+TEST_CASE("Multiple producers / multiple consumers lock-free linked queue recycles segments", "[CppCommon][Threads]")
+{
+    DefaultMemoryManager auxiliary;
+    MPMCLinkedQueue<int, 16> queue(auxiliary, 4);
+
+    int v = -1;
+
+    // Bursts of the same size must be served by recycled segments
+    size_t segments = 0;
+    for (int burst = 0; burst < 100; ++burst)
+    {
+        for (int i = 0; i < 64; ++i)
+            REQUIRE(queue.Enqueue(i));
+        for (int i = 0; i < 64; ++i)
+            REQUIRE((queue.Dequeue(v) && (v == i)));
+        REQUIRE(!queue.Dequeue(v));
+
+        if (burst == 10)
+            segments = queue.segments();
+    }
+    REQUIRE(segments > 0);
+    REQUIRE(queue.segments() == segments);
+}
+
+TEST_CASE("Multiple producers / multiple consumers lock-free linked queue destroys remaining items", "[CppCommon][Threads]")
+{
+    auto item = std::make_shared<int>(0);
+    {
+        DefaultMemoryManager auxiliary;
+        MPMCLinkedQueue<std::shared_ptr<int>, 4> queue(auxiliary);
+
+        for (int i = 0; i < 10; ++i)
+            REQUIRE(queue.Enqueue(item));
+
+        std::shared_ptr<int> v;
+        REQUIRE((queue.Dequeue(v) && (v == item)));
+        v.reset();
+
+        REQUIRE(item.use_count() == 10);
+    }
+    REQUIRE(item.use_count() == 1);
+
+    DefaultMemoryManager auxiliary;
+    MPMCLinkedQueue<std::string, 2> queue(auxiliary);
+    const std::string text(100, 'x');
+    REQUIRE(queue.Enqueue(text));
+    REQUIRE(queue.Enqueue(std::string("test")));
+    std::string v;
+    REQUIRE((queue.Dequeue(v) && (v == text)));
+    REQUIRE((queue.Dequeue(v) && (v == "test")));
+}
+
+TEST_CASE("Multiple producers / multiple consumers lock-free linked queue multithreading", "[CppCommon][Threads]")
+{
+    const int producers_count = 4;
+    const int consumers_count = 4;
+    const uint64_t items_to_produce = 100000;
+
+    DefaultMemoryManager auxiliary;
+    MPMCLinkedQueue<uint64_t, 64> queue(auxiliary);
+
+    std::atomic<uint64_t> consumed(0);
+    std::atomic<uint64_t> crc(0);
+    std::atomic<bool> ordered(true);
+
+    // Start consumer threads
+    std::vector<std::thread> consumers;
+    for (int i = 0; i < consumers_count; ++i)
+    {
+        consumers.emplace_back([&]()
+        {
+            uint64_t last[producers_count];
+            for (auto& l : last)
+                l = 0;
+
+            while (consumed.load() < items_to_produce)
+            {
+                uint64_t item;
+                if (!queue.Dequeue(item))
+                {
+                    std::this_thread::yield();
+                    continue;
+                }
+
+                // Items of each producer must be dequeued in FIFO order
+                size_t producer = (size_t)(item / items_to_produce);
+                uint64_t value = (item % items_to_produce) + 1;
+                if (value <= last[producer])
+                    ordered = false;
+                last[producer] = value;
+
+                crc += item;
+                ++consumed;
+            }
+        });
+    }
+
+    // Start producer threads
+    std::vector<std::thread> producers;
+    for (int producer = 0; producer < producers_count; ++producer)
+    {
+        producers.emplace_back([&queue, producer]()
+        {
+            uint64_t items = (items_to_produce / producers_count);
+            for (uint64_t i = 0; i < items; ++i)
+            {
+                while (!queue.Enqueue(items_to_produce * producer + i))
+                    std::this_thread::yield();
+                if ((i % 64) == 0)
+                    std::this_thread::yield();
+            }
+        });
+    }
+
+    for (auto& producer : producers)
+        producer.join();
+    for (auto& consumer : consumers)
+        consumer.join();
+
+    uint64_t expected = 0;
+    uint64_t items = (items_to_produce / producers_count);
+    for (int producer = 0; producer < producers_count; ++producer)
+        for (uint64_t i = 0; i < items; ++i)
+            expected += items_to_produce * producer + i;
+
+    REQUIRE(consumed.load() == items_to_produce);
+    REQUIRE(crc.load() == expected);
+    REQUIRE(ordered.load());
+}
@@ -0,0 +1,160 @@
+//
+// Created by Ivan Shynkarenka on 15.10.2026
+//
+
+#include "test.h"
+
+#include "threads/mpmc_ring_buffer.h"
+
+#include <atomic>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+using namespace CppCommon;
+
+TEST_CASE("Multiple producers / multiple consumers lock-free ring buffer", "[CppCommon][Threads]")
+{
+    MPMCRingBuffer buffer(128);
+
+    REQUIRE(buffer.capacity() == 128);
+    REQUIRE(buffer.max_record() == 48);
+    REQUIRE(buffer.size() == 0);
+
+    char data[48];
+    size_t size;
+
+    REQUIRE(!buffer.Dequeue(data, size = sizeof(data)));
+
+    // Each record occupies its size with the header rounded up to 16 bytes
+    REQUIRE(buffer.Enqueue("a", 1));
+    REQUIRE(buffer.size() == 32);
+    REQUIRE(buffer.Enqueue("abcdefghijklmnopq", 17));
+    REQUIRE(buffer.size() == 80);
+    REQUIRE(buffer.Enqueue("", 0));
+    REQUIRE(buffer.size() == 96);
+    REQUIRE(!buffer.Enqueue("abcdefghijklmnopq", 17));
+
+    REQUIRE((buffer.Dequeue(data, size = sizeof(data)) && (size == 1) && (memcmp(data, "a", 1) == 0)));
+    REQUIRE(buffer.size() == 64);
+    REQUIRE((buffer.Dequeue(data, size = sizeof(data)) && (size == 17) && (memcmp(data, "abcdefghijklmnopq", 17) == 0)));
+    REQUIRE((buffer.Dequeue(data, size = sizeof(data)) && (size == 0)));
+    REQUIRE(buffer.size() == 0);
+    REQUIRE(!buffer.Dequeue(data, size = sizeof(data)));
+
+    // Record which does not fit into the rest of the ring buffer is placed at its beginning
+    REQUIRE(buffer.Enqueue("abcdefghijklmnopq", 17));
+    REQUIRE(buffer.size() == 32 + 48);
+    REQUIRE((buffer.Dequeue(data, size = sizeof(data)) && (size == 17) && (memcmp(data, "abcdefghijklmnopq", 17) == 0)));
+    REQUIRE(buffer.size() == 0);
+    REQUIRE(!buffer.Dequeue(data, size = sizeof(data)));
+}
+
+TEST_CASE("Multiple producers / multiple consumers lock-free ring buffer with out of order commit and release", "[CppCommon][Threads]")
+{
+    MPMCRingBuffer buffer(256);
+
+    auto reservation1 = buffer.Reserve(8);
+    auto reservation2 = buffer.Reserve(20);
+    REQUIRE(reservation1);
+    REQUIRE(reservation2);
+    REQUIRE(reservation2.position == reservation1.position + 32);
+    memcpy(reservation1.data, "first", 5);
+    memcpy(reservation2.data, "second", 6);
+
+    // Uncommitted first record holds the committed second one
+    buffer.Commit(reservation2, 6);
+    REQUIRE(!buffer.Claim());
+    buffer.Commit(reservation1, 5);
+
+    auto record1 = buffer.Claim();
+    auto record2 = buffer.Claim();
+    REQUIRE(record1);
+    REQUIRE(record2);
+    REQUIRE(!buffer.Claim());
+    REQUIRE(((record1.size == 5) && (memcmp(record1.data, "first", 5) == 0)));
+    REQUIRE(((record2.size == 6) && (memcmp(record2.data, "second", 6) == 0)));
+
+    // Space of the second record is reclaimed only with the first one
+    REQUIRE(buffer.size() == 80);
+    buffer.Release(record2);
+    REQUIRE(buffer.size() == 80);
+    buffer.Release(record1);
+    REQUIRE(buffer.size() == 0);
+
+    // Reclaimed space is reused after the end of the ring buffer
+    for (int i = 0; i < 16; ++i)
+    {
+        auto reservation = buffer.Reserve(100);
+        REQUIRE(reservation);
+        memset(reservation.data, 'a' + i, 100);
+        buffer.Commit(reservation);
+        auto record = buffer.Claim();
+        REQUIRE(((record.size == 100) && (((const char*)record.data)[99] == 'a' + i)));
+        buffer.Release(record);
+        REQUIRE(buffer.size() == 0);
+    }
+}
+
+TEST_CASE("Multiple producers / multiple consumers lock-free ring buffer threads", "[CppCommon][Threads]")
+{
+    const int producers_count = 4;
+    const int consumers_count = 4;
+    const uint64_t items_to_produce = 100000;
+
+    MPMCRingBuffer buffer(4096);
+
+    std::atomic<uint64_t> consumed(0);
+    std::atomic<uint64_t> checksum(0);
+
+    std::vector<std::thread> threads;
+    for (int producer = 0; producer < producers_count; ++producer)
+    {
+        threads.emplace_back([&buffer, producer, items_to_produce]()
+        {
+            uint8_t item[64];
+            for (uint64_t i = 0; i < items_to_produce; ++i)
+            {
+                // Variable size records filled with the item index
+                size_t size = 1 + (i + producer) % sizeof(item);
+                memset(item, (int)(i & 0xFF), size);
+                while (!buffer.Enqueue(item, size))
+                    std::this_thread::yield();
+            }
+        });
+    }
+    for (int consumer = 0; consumer < consumers_count; ++consumer)
+    {
+        threads.emplace_back([&buffer, &consumed, &checksum, items_to_produce]()
+        {
+            uint64_t sum = 0;
+            while (consumed.load() < (producers_count * items_to_produce))
+            {
+                auto record = buffer.Claim();
+                if (!record)
+                {
+                    std::this_thread::yield();
+                    continue;
+                }
+
+                const uint8_t* data = (const uint8_t*)record.data;
+                for (size_t i = 0; i < record.size; ++i)
+                    sum += data[i];
+                buffer.Release(record);
+                ++consumed;
+            }
+            checksum += sum;
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+
+    uint64_t expected = 0;
+    for (int producer = 0; producer < producers_count; ++producer)
+        for (uint64_t i = 0; i < items_to_produce; ++i)
+            expected += (1 + (i + producer) % 64) * (i & 0xFF);
+
+    REQUIRE(consumed.load() == producers_count * items_to_produce);
+    REQUIRE(checksum.load() == expected);
+    REQUIRE(buffer.size() == 0);
+}
@@ -6,6 +6,11 @@
 
 #include "threads/mpmc_ring_queue.h"
 
+#include <cstring>
+#include <iterator>
+#include <stdexcept>
+#include <vector>
+
 using namespace CppCommon;
 
 TEST_CASE("Multiple producers / multiple consumers wait-free ring queue", "[CppCommon][Threads]")
@@ -48,3 +53,143 @@ TEST_CASE("Multiple producers / multiple consumers wait-free ring queue", "[CppC
     REQUIRE(queue.capacity() == 4);
     REQUIRE(queue.size() == 0);
 }
+
+TEST_CASE("Multiple producers / multiple consumers wait-free ring queue with batches", "[CppCommon][Threads]")
+{
+    MPMCRingQueue<int> queue(4);
+
+    std::vector<int> items = { 0, 1, 2, 3, 4, 5 };
+    std::vector<int> result;
+
+    REQUIRE(queue.DequeueBulk(std::back_inserter(result), 10) == 0);
+
+    // Batch is limited with the free space in the ring queue
+    REQUIRE(queue.EnqueueBulk(items.begin(), items.end()) == 4);
+    REQUIRE(queue.size() == 4);
+    REQUIRE(queue.EnqueueBulk(items.begin(), items.end()) == 0);
+
+    REQUIRE(queue.DequeueBulk(std::back_inserter(result), 2) == 2);
+    REQUIRE(result == std::vector<int>({ 0, 1 }));
+    REQUIRE(queue.size() == 2);
+
+    // Batches wrap around the ring queue
+    REQUIRE(queue.EnqueueBulk(items.begin() + 4, items.end()) == 2);
+    result.clear();
+    REQUIRE(queue.DequeueBulk(std::back_inserter(result), 10) == 4);
+    REQUIRE(result == std::vector<int>(items.begin() + 2, items.end()));
+    REQUIRE(queue.size() == 0);
+
+    // Single items and batches are interchangeable
+    int v = -1;
+    REQUIRE(queue.EnqueueBulk(items.begin(), items.begin() + 1) == 1);
+    REQUIRE((queue.Dequeue(v) && (v == 0)));
+    REQUIRE(queue.Enqueue(7));
+    result.clear();
+    REQUIRE(queue.DequeueBulk(std::back_inserter(result), 10) == 1);
+    REQUIRE(result[0] == 7);
+}
+
+TEST_CASE("Multiple producers / multiple consumers wait-free ring queue with slot layouts", "[CppCommon][Threads]")
+{
+    MPMCRingQueue<int, MPMCRingQueueLayout::PADDED> padded(8);
+    MPMCRingQueue<int, MPMCRingQueueLayout::REMAPPED> remapped(64);
+
+    REQUIRE(padded.capacity() == 8);
+    REQUIRE(remapped.capacity() == 64);
+
+    // Fill and drain queues several times to cross the ring boundary
+    for (int round = 0; round < 3; ++round)
+    {
+        for (int i = 0; i < 8; ++i)
+            REQUIRE(padded.Enqueue(round * 100 + i));
+        REQUIRE(!padded.Enqueue(-1));
+        for (int i = 0; i < 64; ++i)
+            REQUIRE(remapped.Enqueue(round * 100 + i));
+        REQUIRE(!remapped.Enqueue(-1));
+
+        int v = -1;
+        for (int i = 0; i < 8; ++i)
+            REQUIRE(((padded.Dequeue(v) && (v == round * 100 + i))));
+        REQUIRE(!padded.Dequeue(v));
+        for (int i = 0; i < 64; ++i)
+            REQUIRE(((remapped.Dequeue(v) && (v == round * 100 + i))));
+        REQUIRE(!remapped.Dequeue(v));
+    }
+
+    // Batches over remapped slots
+    std::vector<int> items(48);
+    for (size_t i = 0; i < items.size(); ++i)
+        items[i] = (int)i;
+    REQUIRE(remapped.EnqueueBulk(items.begin(), items.end()) == 48);
+    REQUIRE(remapped.EnqueueBulk(items.begin(), items.end()) == 16);
+    std::vector<int> output;
+    REQUIRE(remapped.DequeueBulk(std::back_inserter(output), 100) == 64);
+    REQUIRE(output.size() == 64);
+    for (size_t i = 0; i < output.size(); ++i)
+        REQUIRE(output[i] == (int)(i % 48));
+}
+
+namespace {
+
+struct Order
+{
+    static int instances;
+
+    uint64_t id;
+    char payload[192];
+
+    Order(uint64_t i, char ch) : id(i) { memset(payload, ch, sizeof(payload)); ++instances; }
+    Order(const Order& order) : id(order.id) { memcpy(payload, order.payload, sizeof(payload)); ++instances; }
+    Order& operator=(const Order&) = default;
+    ~Order() { --instances; }
+};
+
+int Order::instances = 0;
+
+} // namespace
+
+TEST_CASE("Multiple producers / multiple consumers wait-free ring queue with items in place", "[CppCommon][Threads]")
+{
+    {
+        // Slots are not constructed, items are not required to be default constructible
+        MPMCRingQueue<Order> queue(4);
+        REQUIRE(Order::instances == 0);
+
+        REQUIRE(queue.Emplace(1, 'a'));
+        REQUIRE(queue.Emplace(2, 'b'));
+        REQUIRE(queue.Enqueue(Order(3, 'c')));
+        REQUIRE(queue.Emplace(4, 'd'));
+        REQUIRE(!queue.Emplace(5, 'e'));
+        REQUIRE(Order::instances == 4);
+
+        // Consume items in place of slots
+        uint64_t id = 0;
+        REQUIRE(queue.Consume([&id](Order& order) { id = order.id; REQUIRE(order.payload[191] == 'a'); }));
+        REQUIRE(id == 1);
+        REQUIRE(Order::instances == 3);
+
+        Order order(0, 'z');
+        REQUIRE((queue.Dequeue(order) && (order.id == 2) && (order.payload[0] == 'b')));
+        REQUIRE(Order::instances == 3);
+
+        // Slots are reused after the end of the ring queue
+        REQUIRE(queue.Emplace(5, 'e'));
+        REQUIRE(queue.Emplace(6, 'f'));
+        REQUIRE(!queue.Emplace(7, 'g'));
+        for (uint64_t i = 3; i <= 5; ++i)
+            REQUIRE(queue.Consume([i](Order& item) { REQUIRE(item.id == i); }));
+        REQUIRE(queue.size() == 1);
+
+        // Handler exception releases the slot
+        REQUIRE_THROWS(queue.Consume([](Order&) { throw std::runtime_error("handler"); }));
+        REQUIRE(queue.size() == 0);
+        REQUIRE(!queue.Consume([](Order&) {}));
+        REQUIRE(Order::instances == 1);
+
+        // Items left in the queue are destroyed with the queue
+        REQUIRE(queue.Emplace(8, 'h'));
+        REQUIRE(queue.Emplace(9, 'i'));
+        REQUIRE(Order::instances == 3);
+    }
+    REQUIRE(Order::instances == 0);
+}
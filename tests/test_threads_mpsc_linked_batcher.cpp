@@ -6,6 +6,8 @@
 
 #include "threads/mpsc_linked_batcher.h"
 
+#include <vector>
+
 using namespace CppCommon;
 
 TEST_CASE("Multiple producers / single consumer wait-free linked batcher", "[CppCommon][Threads]")
@@ -32,3 +34,56 @@ TEST_CASE("Multiple producers / single consumer wait-free linked batcher", "[Cpp
     REQUIRE(batcher.Dequeue());
     REQUIRE(!batcher.Dequeue());
 }
+
+TEST_CASE("Multiple producers / single consumer wait-free linked batcher handler", "[CppCommon][Threads]")
+{
+    MPSCLinkedBatcher<int> batcher;
+
+    REQUIRE(batcher.Enqueue(0));
+    REQUIRE(batcher.Enqueue(1));
+    REQUIRE(batcher.Enqueue(2));
+
+    // Items must be handled in FIFO order
+    int expected = 0;
+    REQUIRE(batcher.Dequeue([&expected](const int& item) { REQUIRE(item == expected++); }));
+    REQUIRE(expected == 3);
+    REQUIRE(!batcher.Dequeue([](const int&) {}));
+}
+
+TEST_CASE("Multiple producers / single consumer wait-free intrusive batcher", "[CppCommon][Threads]")
+{
+    struct Item : public MPSCIntrusiveBatcher<Item>::Node
+    {
+        int value;
+        explicit Item(int v) : value(v) {}
+    };
+
+    MPSCIntrusiveBatcher<Item> batcher;
+    Item items[] = { Item(0), Item(1), Item(2), Item(3), Item(4) };
+
+    REQUIRE(batcher.empty());
+    REQUIRE(!batcher.Dequeue([](Item&) {}));
+
+    batcher.Enqueue(items[0]);
+    batcher.Enqueue(items[1]);
+    batcher.Enqueue(items[2]);
+    REQUIRE(!batcher.empty());
+
+    // Items must be handled in FIFO order and could be enqueued again from the handler
+    int expected = 0;
+    REQUIRE(batcher.Dequeue([&](Item& item)
+    {
+        REQUIRE(item.value == expected++);
+        if (item.value == 1)
+            batcher.Enqueue(item);
+    }));
+    REQUIRE(expected == 3);
+
+    batcher.Enqueue(items[3]);
+    batcher.Enqueue(items[4]);
+
+    std::vector<int> values;
+    REQUIRE(batcher.Dequeue([&values](Item& item) { values.push_back(item.value); }));
+    REQUIRE(values == std::vector<int>({ 1, 3, 4 }));
+    REQUIRE(batcher.empty());
+}
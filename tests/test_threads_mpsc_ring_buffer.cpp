@@ -6,6 +6,8 @@
 
 #include "threads/mpsc_ring_buffer.h"
 
+#include <cstring>
+
 using namespace CppCommon;
 
 TEST_CASE("Multiple producers / single consumer wait-free ring buffer", "[CppCommon][Threads]")
@@ -43,3 +45,34 @@ TEST_CASE("Multiple producers / single consumer wait-free ring buffer", "[CppCom
     REQUIRE(buffer.capacity() == 3);
     REQUIRE(buffer.size() == 0);
 }
+
+TEST_CASE("Multiple producers / single consumer wait-free ring buffer with reserve and peek", "[CppCommon][Threads]")
+{
+    MPSCRingBuffer buffer(16, 2);
+
+    REQUIRE(buffer.Peek().empty());
+
+    // Write regions in place
+    for (int i = 0; i < 4; ++i)
+    {
+        auto reservation = buffer.Reserve(4);
+        REQUIRE(reservation);
+        REQUIRE(reservation.data.size() == 4);
+        memcpy(reservation.data.data(), "abcd", 4);
+        buffer.Commit(reservation, 2);
+    }
+    REQUIRE(buffer.size() == 8);
+
+    // Read regions in place
+    size_t total = 0;
+    for (auto peeked = buffer.Peek(); !peeked.empty(); peeked = buffer.Peek())
+    {
+        REQUIRE((peeked.size() % 2) == 0);
+        for (size_t i = 0; i < peeked.size(); i += 2)
+            REQUIRE(memcmp(peeked.data() + i, "ab", 2) == 0);
+        buffer.Release(peeked.size());
+        total += peeked.size();
+    }
+    REQUIRE(total == 8);
+    REQUIRE(buffer.size() == 0);
+}
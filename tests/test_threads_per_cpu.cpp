@@ -0,0 +1,87 @@
+//
+// Created by Ivan Shynkarenka on 15.10.2026
+//
+
+#include "test.h"
+
+#include "threads/per_cpu.h"
+#include "threads/sharded_counter.h"
+#include "utility/cache_aligned.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace CppCommon;
+
+TEST_CASE("Cache aligned", "[CppCommon][Threads]")
+{
+    REQUIRE(alignof(CacheAligned<int>) == CacheAligned<int>::SIZE);
+    REQUIRE(sizeof(CacheAligned<int>) == CacheAligned<int>::SIZE);
+
+    CacheAligned<int> values[2] = { CacheAligned<int>(1), CacheAligned<int>(2) };
+    REQUIRE(((size_t)&values[0] % CacheAligned<int>::SIZE) == 0);
+    REQUIRE(((size_t)&values[1] - (size_t)&values[0]) == CacheAligned<int>::SIZE);
+    REQUIRE(*values[0] == 1);
+    REQUIRE(values[1].value() == 2);
+
+    CacheAligned<std::vector<int>> vector(std::in_place, 3, 7);
+    REQUIRE(vector->size() == 3);
+    CacheAligned<std::vector<int>> copy(vector);
+    REQUIRE(copy->size() == 3);
+}
+
+TEST_CASE("Per-CPU data", "[CppCommon][Threads]")
+{
+    PerCpu<std::atomic<int>> data(3);
+    REQUIRE(data.slots() == 4);
+    REQUIRE((size_t)&data[1] - (size_t)&data[0] == CacheAligned<int>::SIZE);
+
+    // Current slot is always within slots
+    for (int i = 0; i < 100; ++i)
+        data.local().fetch_add(1);
+    int total = 0;
+    data.ForEach([&total](const std::atomic<int>& slot) { total += slot.load(); });
+    REQUIRE(total == 100);
+
+    PerCpu<int> defaults;
+    REQUIRE(defaults.slots() >= 1);
+    REQUIRE(defaults[0] == 0);
+}
+
+TEST_CASE("Sharded counter", "[CppCommon][Threads]")
+{
+    ShardedCounter counter;
+    REQUIRE(counter.shards() >= 1);
+    REQUIRE(counter.Sum() == 0);
+
+    counter.Add();
+    counter.Add(10);
+    counter.Add(-3);
+    REQUIRE(counter.Sum() == 8);
+
+    counter.Reset();
+    REQUIRE(counter.Sum() == 0);
+}
+
+TEST_CASE("Sharded counter threads", "[CppCommon][Threads]")
+{
+    const int threads_count = 8;
+    const int items_to_add = 100000;
+
+    ShardedCounter counter(4);
+
+    std::vector<std::thread> threads;
+    for (int thread = 0; thread < threads_count; ++thread)
+    {
+        threads.emplace_back([&counter]()
+        {
+            for (int i = 0; i < items_to_add; ++i)
+                counter.Add();
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+
+    REQUIRE(counter.Sum() == (int64_t)threads_count * items_to_add);
+}
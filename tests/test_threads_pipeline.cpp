@@ -0,0 +1,128 @@
+//
+// Created by Ivan Shynkarenka on 15.10.2026
+//
+
+#include "test.h"
+
+#include "threads/pipeline.h"
+
+#include <string>
+#include <vector>
+
+using namespace CppCommon;
+
+namespace {
+
+struct Message
+{
+    int id = 0;
+    std::string text;
+    int value = 0;
+    int route = -1;
+};
+
+} // namespace
+
+TEST_CASE("Staged pipeline", "[CppCommon][Threads]")
+{
+    const int items_to_produce = 100000;
+
+    int64_t routed[4] = { 0, 0, 0, 0 };
+    int64_t total = 0;
+
+    Pipeline<Message> pipeline(256, 32);
+    pipeline.AddStage("parse", [](Message& message) { message.value = std::stoi(message.text); })
+            .AddStage("filter", [](Message& message) { return (message.value % 10) != 0; })
+            .AddStage("enrich", [](Message& message) { message.route = message.value % 4; })
+            .AddStage("route", [&routed, &total](Message& message) { routed[message.route] += message.value; total += message.id; });
+    REQUIRE(pipeline.stages() == 4);
+    REQUIRE(!pipeline.started());
+
+    Message message;
+    REQUIRE(!pipeline.Enqueue(message));
+
+    // Run each stage in its own thread without pinning
+    pipeline.Start(CPUSet{ 0, 1, 2, 3 }, false);
+    REQUIRE(pipeline.started());
+    REQUIRE(pipeline.threads() == 4);
+
+    // Enqueue items one by one and in batches
+    std::vector<Message> batch;
+    for (int i = 0; i < items_to_produce; ++i)
+    {
+        Message item;
+        item.id = i;
+        item.text = std::to_string(i);
+        if (i % 2 == 0)
+            REQUIRE(pipeline.Enqueue(std::move(item)));
+        else
+            batch.push_back(item);
+        if (batch.size() == 100)
+        {
+            REQUIRE(pipeline.EnqueueBulk(batch.begin(), batch.end()));
+            batch.clear();
+        }
+    }
+    REQUIRE(pipeline.EnqueueBulk(batch.begin(), batch.end()));
+
+    // Stop drains all items
+    pipeline.Stop();
+    REQUIRE(!pipeline.started());
+    REQUIRE(pipeline.threads() == 0);
+
+    int64_t expected[4] = { 0, 0, 0, 0 };
+    int64_t expected_total = 0;
+    for (int i = 0; i < items_to_produce; ++i)
+    {
+        if ((i % 10) != 0)
+        {
+            expected[i % 4] += i;
+            expected_total += i;
+        }
+    }
+    for (int i = 0; i < 4; ++i)
+        REQUIRE(routed[i] == expected[i]);
+    REQUIRE(total == expected_total);
+
+    auto statistics = pipeline.statistics();
+    REQUIRE(statistics.size() == 4);
+    REQUIRE(statistics[0].name == "parse");
+    REQUIRE(statistics[0].items == (uint64_t)items_to_produce);
+    REQUIRE(statistics[0].dropped == 0);
+    REQUIRE(statistics[1].items == (uint64_t)items_to_produce);
+    REQUIRE(statistics[1].dropped == (uint64_t)(items_to_produce / 10));
+    REQUIRE(statistics[2].items == (uint64_t)(items_to_produce - items_to_produce / 10));
+    REQUIRE(statistics[3].items == statistics[2].items);
+    REQUIRE(statistics[0].batches > 0);
+    REQUIRE(statistics[0].latency.count() == statistics[0].items);
+    REQUIRE(statistics[0].thread == 0);
+    REQUIRE(statistics[3].thread == 3);
+    REQUIRE(statistics[0].throughput() >= 0.0);
+}
+
+TEST_CASE("Staged pipeline fused stages", "[CppCommon][Threads]")
+{
+    int64_t sum = 0;
+
+    // Five stages on two logical processors are fused into two threads
+    Pipeline<int> pipeline(4, 2);
+    for (int i = 0; i < 4; ++i)
+        pipeline.AddStage("increment", [](int& item) { ++item; });
+    pipeline.AddStage("sum", [&sum](int& item) { sum += item; });
+
+    pipeline.Start(CPUSet{ 0, 1 }, false);
+    REQUIRE(pipeline.threads() == 2);
+
+    // Small ring queues propagate the backpressure to the producer
+    for (int i = 0; i < 10000; ++i)
+        REQUIRE(pipeline.Enqueue(i));
+    pipeline.Stop();
+
+    REQUIRE(sum == (int64_t)10000 * 9999 / 2 + 4 * 10000);
+
+    auto statistics = pipeline.statistics();
+    REQUIRE(statistics[0].thread == 0);
+    REQUIRE(statistics[1].thread == 0);
+    REQUIRE(statistics[2].thread == 1);
+    REQUIRE(statistics[4].thread == 1);
+}
@@ -38,6 +38,19 @@ TEST_CASE("Semaphore", "[CppCommon][Threads]")
     lock.Unlock();
     REQUIRE(lock.TryLock());
     lock.Unlock();
+
+    // Test TryLockFor() method
+    REQUIRE(lock.TryLockFor(Timespan::milliseconds(10)));
+    lock.Lock();
+    lock.Lock();
+    lock.Lock();
+    REQUIRE(!lock.TryLockFor(Timespan::milliseconds(10)));
+    lock.Unlock();
+    REQUIRE(lock.TryLockFor(Timespan::milliseconds(10)));
+    lock.Unlock();
+    lock.Unlock();
+    lock.Unlock();
+    lock.Unlock();
 }
 
 TEST_CASE("Semaphore locker", "[CppCommon][Threads]")
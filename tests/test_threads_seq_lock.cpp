@@ -7,6 +7,7 @@
 #include "threads/seq_lock.h"
 #include "threads/thread.h"
 
+#include <atomic>
 #include <thread>
 #include <vector>
 
@@ -86,3 +87,64 @@ TEST_CASE("SeqLock random", "[CppCommon][Threads]")
     for (auto& consumer : consumers)
         consumer.join();
 }
+
+TEST_CASE("SeqLock concurrent writers", "[CppCommon][Threads]")
+{
+    int items_to_produce = 100000;
+    int producers_count = 4;
+    int consumers_count = 4;
+
+    SeqLock<Data> lock(Data{ 0, 100, 200 });
+
+    REQUIRE(lock.TryWrite(Data{ 1, 101, 201 }));
+    REQUIRE(lock.Read() == (Data{ 1, 101, 201 }));
+
+    std::atomic<bool> done(false);
+    std::atomic<int> broken(0);
+
+    // Start producers threads
+    std::vector<std::thread> producers;
+    for (int producer = 0; producer < producers_count; ++producer)
+    {
+        producers.emplace_back([&lock, producer, items_to_produce]()
+        {
+            for (int i = 0; i < items_to_produce; ++i)
+            {
+                int value = producer * items_to_produce + i;
+                if ((i % 2) == 0)
+                    lock.WriteConcurrent(Data{ value, value + 100, value + 200 });
+                else
+                    lock.TryWrite(Data{ value, value + 100, value + 200 });
+            }
+        });
+    }
+
+    // Start consumers threads
+    std::vector<std::thread> consumers;
+    for (int consumer = 0; consumer < consumers_count; ++consumer)
+    {
+        consumers.emplace_back([&lock, &done, &broken]()
+        {
+            while (!done)
+            {
+                Data data = lock.Read();
+                if ((data.b != data.a + 100) || (data.c != data.b + 100))
+                    ++broken;
+
+                // Yield to another thread...
+                Thread::Yield();
+            }
+        });
+    }
+
+    // Wait for all producers threads
+    for (auto& producer : producers)
+        producer.join();
+
+    // Wait for all consumers threads
+    done = true;
+    for (auto& consumer : consumers)
+        consumer.join();
+
+    REQUIRE(broken == 0);
+}
@@ -0,0 +1,148 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "test.h"
+
+#include "threads/shared_mpsc_ring_buffer.h"
+#include "threads/shared_spsc_ring_buffer.h"
+#include "threads/shared_spsc_ring_queue.h"
+
+#include <cstring>
+#include <thread>
+#include <vector>
+
+using namespace CppCommon;
+
+#if !defined(__APPLE__)
+
+TEST_CASE("Shared memory SPSC ring buffer", "[CppCommon][Threads]")
+{
+    // Shared memory ring buffer master and slave
+    SharedSPSCRingBuffer master("shared_spsc_ring_buffer_test", 1024);
+    SharedSPSCRingBuffer slave("shared_spsc_ring_buffer_test", 1024);
+
+    REQUIRE(master.owner());
+    REQUIRE(!slave.owner());
+    REQUIRE(master.capacity() == 1024);
+    REQUIRE(slave.capacity() == 1024);
+    REQUIRE(slave.empty());
+
+    // Mismatched capacity must be rejected
+    REQUIRE_THROWS(SharedSPSCRingBuffer("shared_spsc_ring_buffer_test", 2048));
+
+    // Enqueue in the master and dequeue in the slave
+    REQUIRE(master.Enqueue("test", 4));
+    REQUIRE(slave.size() == 4);
+
+    char data[16];
+    size_t size = sizeof(data);
+    REQUIRE(slave.Dequeue(data, size));
+    REQUIRE(size == 4);
+    REQUIRE(std::memcmp(data, "test", 4) == 0);
+    REQUIRE(slave.empty());
+
+    // Zero-copy reserve and peek
+    auto reserved = master.Reserve(8);
+    REQUIRE(reserved.size() == 8);
+    std::memcpy(reserved.data(), "zerocopy", 8);
+    master.Commit();
+
+    auto peeked = slave.Peek();
+    REQUIRE(peeked.size() == 8);
+    REQUIRE(std::memcmp(peeked.data(), "zerocopy", 8) == 0);
+    slave.Release(peeked.size());
+    REQUIRE(slave.empty());
+
+    // Wait for the data with timeout
+    REQUIRE(!slave.Wait(Timespan::milliseconds(10)));
+}
+
+TEST_CASE("Shared memory SPSC ring queue", "[CppCommon][Threads]")
+{
+    int items_to_produce = 10000;
+    uint64_t crc = 0;
+
+    // Shared memory ring queue master
+    SharedSPSCRingQueue<int> master("shared_spsc_ring_queue_test", 64);
+
+    // Mismatched item size must be rejected
+    REQUIRE_THROWS(SharedSPSCRingQueue<uint64_t>("shared_spsc_ring_queue_test", 64));
+
+    // Start consumer thread with its own mapping
+    auto consumer = std::thread([&crc, items_to_produce]()
+    {
+        SharedSPSCRingQueue<int> slave("shared_spsc_ring_queue_test", 64);
+
+        for (int i = 0; i < items_to_produce; ++i)
+        {
+            int item;
+            while (!slave.Dequeue(item))
+                slave.Wait();
+            crc += item;
+        }
+    });
+
+    // Produce items
+    for (int i = 0; i < items_to_produce; ++i)
+        while (!master.Enqueue(i))
+            std::this_thread::yield();
+
+    // Wait for the consumer thread
+    consumer.join();
+
+    REQUIRE(master.empty());
+    REQUIRE(crc == (uint64_t)items_to_produce * (items_to_produce - 1) / 2);
+}
+
+TEST_CASE("Shared memory MPSC ring buffer", "[CppCommon][Threads]")
+{
+    int producers = 4;
+    int items_to_produce = 1000;
+    uint64_t crc = 0;
+
+    // Shared memory ring buffer master
+    SharedMPSCRingBuffer master("shared_mpsc_ring_buffer_test", 1024, producers);
+    REQUIRE(master.owner());
+    REQUIRE(master.concurrency() == (size_t)producers);
+
+    // Mismatched concurrency must be rejected
+    REQUIRE_THROWS(SharedMPSCRingBuffer("shared_mpsc_ring_buffer_test", 1024, producers * 2));
+
+    // Start producer threads with their own mappings
+    std::vector<std::thread> threads;
+    for (int producer = 0; producer < producers; ++producer)
+    {
+        threads.emplace_back([producers, items_to_produce]()
+        {
+            SharedMPSCRingBuffer slave("shared_mpsc_ring_buffer_test", 1024, producers);
+
+            for (int i = 0; i < items_to_produce; ++i)
+                while (!slave.Enqueue(&i, sizeof(i)))
+                    std::this_thread::yield();
+        });
+    }
+
+    // Consume items
+    for (int i = 0; i < producers * items_to_produce; ++i)
+    {
+        int item;
+        size_t size = sizeof(item);
+        while (!master.Dequeue(&item, size))
+        {
+            master.Wait(Timespan::milliseconds(10));
+            size = sizeof(item);
+        }
+        REQUIRE(size == sizeof(item));
+        crc += item;
+    }
+
+    // Wait for the producer threads
+    for (auto& thread : threads)
+        thread.join();
+
+    REQUIRE(master.empty());
+    REQUIRE(crc == (uint64_t)producers * items_to_produce * (items_to_produce - 1) / 2);
+}
+
+#endif
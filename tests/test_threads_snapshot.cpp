@@ -0,0 +1,167 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "test.h"
+
+#include "threads/shared_seq_lock.h"
+#include "threads/shared_snapshot.h"
+#include "threads/snapshot.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace CppCommon;
+
+namespace {
+
+struct Data
+{
+    uint64_t a;
+    uint64_t b;
+    uint64_t c;
+
+    friend bool operator==(const Data& data1, const Data& data2)
+    { return ((data1.a == data2.a) && (data1.b == data2.b) && (data1.c == data2.c)); }
+};
+
+} // namespace
+
+TEST_CASE("Snapshot base", "[CppCommon][Threads]")
+{
+    Snapshot<Data> snapshot(Data{ 1, 2, 3 });
+    REQUIRE(snapshot.version() == 0);
+    REQUIRE(snapshot.Read() == (Data{ 1, 2, 3 }));
+
+    REQUIRE(snapshot.Publish(Data{ 4, 5, 6 }) == 1);
+    REQUIRE(snapshot.version() == 1);
+    REQUIRE(snapshot.Read() == (Data{ 4, 5, 6 }));
+
+    snapshot = Data{ 7, 8, 9 };
+    Data data;
+    REQUIRE(snapshot.Read(data) == 2);
+    REQUIRE(data == (Data{ 7, 8, 9 }));
+
+    // Read only newer versions
+    uint64_t version = 0;
+    REQUIRE(snapshot.TryRead(data, version));
+    REQUIRE(version == 2);
+    REQUIRE(!snapshot.TryRead(data, version));
+    snapshot.Publish(Data{ 10, 11, 12 });
+    REQUIRE(snapshot.TryRead(data, version));
+    REQUIRE(version == 3);
+    REQUIRE(data == (Data{ 10, 11, 12 }));
+}
+
+TEST_CASE("Snapshot random", "[CppCommon][Threads]")
+{
+    uint64_t items_to_produce = 1000000;
+    int consumers_count = 4;
+
+    Snapshot<Data> snapshot(Data{ 0, 100, 200 });
+
+    std::atomic<bool> done(false);
+    std::atomic<int> broken(0);
+
+    // Start consumers threads
+    std::vector<std::thread> consumers;
+    for (int consumer = 0; consumer < consumers_count; ++consumer)
+    {
+        consumers.emplace_back([&snapshot, &done, &broken]()
+        {
+            uint64_t last = 0;
+            while (!done)
+            {
+                Data data;
+                uint64_t version = snapshot.Read(data);
+
+                // Data must be consistent and versions must never go back
+                if ((data.b != data.a + 100) || (data.c != data.b + 100) || (data.a != version) || (version < last))
+                    ++broken;
+                last = version;
+            }
+        });
+    }
+
+    // Publish snapshots in the producer thread
+    for (uint64_t i = 1; i <= items_to_produce; ++i)
+        snapshot.Publish(Data{ i, i + 100, i + 200 });
+
+    // Wait for all consumers threads
+    done = true;
+    for (auto& consumer : consumers)
+        consumer.join();
+
+    REQUIRE(broken == 0);
+    REQUIRE(snapshot.version() == items_to_produce);
+}
+
+#if !defined(__APPLE__)
+
+TEST_CASE("Shared memory sequential lock", "[CppCommon][Threads]")
+{
+    // Shared memory sequential lock master and slave
+    SharedSeqLock<Data> master("shared_seq_lock_test", Data{ 1, 2, 3 });
+    SharedSeqLock<Data> slave("shared_seq_lock_test", Data{ 4, 5, 6 });
+    REQUIRE(master.owner());
+    REQUIRE(!slave.owner());
+
+    // Mismatched data type must be rejected
+    REQUIRE_THROWS(SharedSeqLock<uint64_t>("shared_seq_lock_test"));
+
+    // Initial data is emplaced by the owner only
+    REQUIRE(slave.Read() == (Data{ 1, 2, 3 }));
+
+    master.Write(Data{ 7, 8, 9 });
+    REQUIRE(slave.Read() == (Data{ 7, 8, 9 }));
+    REQUIRE(slave.TryWrite(Data{ 10, 11, 12 }));
+    REQUIRE(master.Read() == (Data{ 10, 11, 12 }));
+}
+
+TEST_CASE("Shared memory snapshot", "[CppCommon][Threads]")
+{
+    uint64_t items_to_produce = 100000;
+
+    // Shared memory snapshot publisher
+    SharedSnapshot<Data> publisher("shared_snapshot_test", Data{ 0, 100, 200 });
+    REQUIRE(publisher.owner());
+    REQUIRE(publisher.version() == 0);
+
+    std::atomic<int> broken(0);
+
+    // Start reader thread with its own mapping
+    auto reader = std::thread([&broken, items_to_produce]()
+    {
+        SharedSnapshot<Data> subscriber("shared_snapshot_test");
+
+        uint64_t version = 0;
+        Data data = subscriber.Read();
+        while (version < items_to_produce)
+        {
+            if (!subscriber.TryRead(data, version))
+            {
+                subscriber.Wait(version, Timespan::milliseconds(100));
+                continue;
+            }
+
+            if ((data.b != data.a + 100) || (data.c != data.b + 100) || (data.a != version))
+                ++broken;
+        }
+    });
+
+    // Publish snapshots
+    for (uint64_t i = 1; i <= items_to_produce; ++i)
+        publisher.Publish(Data{ i, i + 100, i + 200 });
+
+    // Wait for the reader thread
+    reader.join();
+
+    REQUIRE(broken == 0);
+    REQUIRE(publisher.Read() == (Data{ items_to_produce, items_to_produce + 100, items_to_produce + 200 }));
+
+    // Wait for the newer version with timeout
+    REQUIRE(!publisher.Wait(publisher.version(), Timespan::milliseconds(10)));
+}
+
+#endif
@@ -0,0 +1,114 @@
+//
+// Created by Ivan Shynkarenka on 15.10.2026
+//
+
+#include "test.h"
+
+#include "threads/spsc_linked_ring_queue.h"
+
+#include <memory>
+#include <string>
+#include <thread>
+
+using namespace CppCommon;
+
+TEST_CASE("Single producer / single consumer wait-free linked ring queue", "[CppCommon][Threads]")
+{
+    SPSCLinkedRingQueue<int> queue(2, 1);
+
+    REQUIRE(queue.segment() == 2);
+    REQUIRE(queue.segments() == 1);
+    REQUIRE(queue.size() == 0);
+
+    int v = -1;
+
+    REQUIRE(!queue.Dequeue(v));
+
+    // Queue grows with new segments on demand
+    for (int i = 0; i < 7; ++i)
+        REQUIRE(queue.Enqueue(i));
+    REQUIRE(queue.size() == 7);
+    REQUIRE(queue.segments() == 4);
+
+    for (int i = 0; i < 3; ++i)
+        REQUIRE(((queue.Dequeue(v) && (v == i))));
+    REQUIRE(queue.size() == 4);
+
+    // Drained segment is kept as a spare one and reused
+    REQUIRE(queue.segments() == 4);
+    REQUIRE(queue.Enqueue(7));
+    REQUIRE(queue.Enqueue(8));
+    REQUIRE(queue.segments() == 4);
+
+    for (int i = 3; i < 9; ++i)
+        REQUIRE(((queue.Dequeue(v) && (v == i))));
+    REQUIRE(!queue.Dequeue(v));
+    REQUIRE(queue.size() == 0);
+
+    // Drained segments which do not fit into spare ones are released
+    REQUIRE(queue.segments() == 2);
+
+    REQUIRE(queue.Enqueue(9));
+    REQUIRE((queue.Dequeue(v) && (v == 9)));
+    REQUIRE(!queue.Dequeue(v));
+}
+
+TEST_CASE("Single producer / single consumer wait-free linked ring queue with non-trivial items", "[CppCommon][Threads]")
+{
+    auto counter = std::make_shared<int>(0);
+    {
+        SPSCLinkedRingQueue<std::shared_ptr<int>> queue(4);
+        for (int i = 0; i < 10; ++i)
+            REQUIRE(queue.Enqueue(counter));
+        REQUIRE(counter.use_count() == 11);
+
+        std::shared_ptr<int> item;
+        for (int i = 0; i < 5; ++i)
+            REQUIRE(queue.Dequeue(item));
+        item.reset();
+        REQUIRE(counter.use_count() == 6);
+    }
+
+    // Items which were never dequeued are destroyed with the queue
+    REQUIRE(counter.use_count() == 1);
+}
+
+TEST_CASE("Single producer / single consumer wait-free linked ring queue threads", "[CppCommon][Threads]")
+{
+    const uint64_t items_to_produce = 1000000;
+
+    SPSCLinkedRingQueue<uint64_t> queue(256);
+
+    uint64_t crc = 0;
+    bool ordered = true;
+
+    // Start consumer thread
+    auto consumer = std::thread([&queue, &crc, &ordered, items_to_produce]()
+    {
+        uint64_t item;
+        for (uint64_t i = 0; i < items_to_produce; ++i)
+        {
+            while (!queue.Dequeue(item))
+                std::this_thread::yield();
+            if (item != i)
+                ordered = false;
+            crc += item;
+        }
+    });
+
+    // Produce items in bursts to grow and shrink the queue
+    for (uint64_t i = 0; i < items_to_produce; ++i)
+    {
+        REQUIRE(queue.Enqueue(i));
+        if ((i % 10000) == 0)
+            std::this_thread::yield();
+    }
+
+    // Wait for the consumer thread
+    consumer.join();
+
+    REQUIRE(ordered);
+    REQUIRE(crc == items_to_produce * (items_to_produce - 1) / 2);
+    REQUIRE(queue.size() == 0);
+    REQUIRE(queue.segments() <= 5);
+}
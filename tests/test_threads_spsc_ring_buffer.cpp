@@ -6,6 +6,8 @@
 
 #include "threads/spsc_ring_buffer.h"
 
+#include <cstring>
+
 using namespace CppCommon;
 
 TEST_CASE("Single producer / single consumer wait-free ring buffer", "[CppCommon][Threads]")
@@ -59,3 +61,66 @@ TEST_CASE("Single producer / single consumer wait-free ring buffer", "[CppCommon
     REQUIRE(buffer.capacity() == 4);
     REQUIRE(buffer.size() == 0);
 }
+
+TEST_CASE("Single producer / single consumer wait-free ring buffer with reserve and peek", "[CppCommon][Threads]")
+{
+    SPSCRingBuffer buffer(16);
+
+    size_t size;
+
+    REQUIRE(buffer.Peek().empty());
+
+    // Write and read the region in place
+    auto reserved = buffer.Reserve(6);
+    REQUIRE(reserved.size() == 6);
+    memcpy(reserved.data(), "abcdef", 6);
+    REQUIRE(buffer.size() == 0);
+    buffer.Commit(4);
+    REQUIRE(buffer.size() == 4);
+
+    auto peeked = buffer.Peek();
+    REQUIRE(peeked.size() == 4);
+    REQUIRE(memcmp(peeked.data(), "abcd", 4) == 0);
+    buffer.Release(4);
+    REQUIRE(buffer.size() == 0);
+
+    // Fill the ring buffer up to the offset 12
+    char temp[16];
+    REQUIRE(buffer.Enqueue("01234567", 8));
+    REQUIRE(buffer.Dequeue(temp, size = 8));
+
+    // Region which does not fit into the rest of the ring buffer is placed at the beginning
+    reserved = buffer.Reserve(6);
+    REQUIRE(reserved.size() == 6);
+    memcpy(reserved.data(), "ghijkl", 6);
+    buffer.Commit();
+    REQUIRE(buffer.size() == 10);
+
+    peeked = buffer.Peek();
+    REQUIRE(peeked.size() == 6);
+    REQUIRE(memcmp(peeked.data(), "ghijkl", 6) == 0);
+    REQUIRE(buffer.size() == 6);
+    buffer.Release(2);
+    peeked = buffer.Peek();
+    REQUIRE(peeked.size() == 4);
+    REQUIRE(memcmp(peeked.data(), "ijkl", 4) == 0);
+    buffer.Release(4);
+    REQUIRE(buffer.size() == 0);
+    REQUIRE(buffer.Peek().empty());
+
+    // Copy dequeue skips the padding
+    REQUIRE(buffer.Enqueue("01234567", 8));
+    REQUIRE(buffer.Dequeue(temp, size = 8));
+    reserved = buffer.Reserve(4);
+    REQUIRE(reserved.size() == 4);
+    memcpy(reserved.data(), "mnop", 4);
+    buffer.Commit();
+    REQUIRE(buffer.size() == 6);
+    REQUIRE(buffer.Enqueue("qr", 2));
+    REQUIRE(buffer.Dequeue(temp, size = 16));
+    REQUIRE(size == 6);
+    REQUIRE(memcmp(temp, "mnopqr", 6) == 0);
+
+    REQUIRE(buffer.capacity() == 16);
+    REQUIRE(buffer.size() == 0);
+}
@@ -6,6 +6,9 @@
 
 #include "threads/spsc_ring_queue.h"
 
+#include <iterator>
+#include <vector>
+
 using namespace CppCommon;
 
 TEST_CASE("Single producer / single consumer wait-free ring queue", "[CppCommon][Threads]")
@@ -44,3 +47,38 @@ TEST_CASE("Single producer / single consumer wait-free ring queue", "[CppCommon]
     REQUIRE(queue.capacity() == 3);
     REQUIRE(queue.size() == 0);
 }
+
+TEST_CASE("Single producer / single consumer wait-free ring queue with batches", "[CppCommon][Threads]")
+{
+    SPSCRingQueue<int> queue(4);
+
+    std::vector<int> items = { 0, 1, 2, 3, 4, 5 };
+    std::vector<int> result;
+
+    REQUIRE(queue.DequeueBulk(std::back_inserter(result), 10) == 0);
+
+    // Batch is limited with the free space in the ring queue
+    REQUIRE(queue.EnqueueBulk(items.begin(), items.end()) == 3);
+    REQUIRE(queue.size() == 3);
+    REQUIRE(queue.EnqueueBulk(items.begin(), items.end()) == 0);
+
+    REQUIRE(queue.DequeueBulk(std::back_inserter(result), 2) == 2);
+    REQUIRE(result == std::vector<int>({ 0, 1 }));
+    REQUIRE(queue.size() == 1);
+
+    // Batches wrap around the ring queue
+    REQUIRE(queue.EnqueueBulk(items.begin() + 3, items.end()) == 2);
+    result.clear();
+    REQUIRE(queue.DequeueBulk(std::back_inserter(result), 10) == 3);
+    REQUIRE(result == std::vector<int>(items.begin() + 2, items.begin() + 5));
+    REQUIRE(queue.size() == 0);
+
+    // Single items and batches are interchangeable
+    int v = -1;
+    REQUIRE(queue.EnqueueBulk(items.begin(), items.begin() + 1) == 1);
+    REQUIRE((queue.Dequeue(v) && (v == 0)));
+    REQUIRE(queue.Enqueue(7));
+    result.clear();
+    REQUIRE(queue.DequeueBulk(std::back_inserter(result), 10) == 1);
+    REQUIRE(result[0] == 7);
+}
@@ -7,6 +7,11 @@
 #include "threads/thread.h"
 #include "time/timestamp.h"
 
+#include <atomic>
+#include <cstring>
+#include <set>
+#include <vector>
+
 using namespace CppCommon;
 
 TEST_CASE("Thread", "[CppCommon][Threads]")
@@ -53,8 +58,103 @@ TEST_CASE("Thread", "[CppCommon][Threads]")
     // Test thread CPU affinity
     std::bitset<64> affinity = Thread::GetAffinity();
     REQUIRE(affinity.to_ullong() > 0);
+    CPUSet affinity_set = Thread::GetAffinitySet();
+    REQUIRE(affinity_set.any());
+    REQUIRE(affinity_set.count() >= affinity.count());
+    Thread::SetAffinity(affinity_set);
+    REQUIRE(Thread::GetAffinitySet() == affinity_set);
+
+    // Test thread NUMA node binding
+    int node = Thread::CurrentThreadNode();
+    REQUIRE(node >= 0);
+    Thread::BindToNode(node, false);
+    REQUIRE(Thread::GetAffinitySet() == CPU::Topology().NodeCPUs(node));
+    Thread::BindToNode(-1, false);
+    Thread::SetAffinity(affinity_set);
 
     // Test thread priority
     ThreadPriority priority = Thread::GetPriority();
     REQUIRE(priority == ThreadPriority::NORMAL);
 }
+
+TEST_CASE("Thread metadata", "[CppCommon][Threads]")
+{
+    const ThreadInfo& info = Thread::CurrentThreadInfo();
+    REQUIRE(&info == &Thread::CurrentThreadInfo());
+    REQUIRE(info.tid > 0);
+    REQUIRE(info.affinity.any());
+    REQUIRE(Thread::CurrentThreadIndex() == info.index);
+    REQUIRE(Thread::CurrentThreadIndex() < Thread::ThreadIndexCount());
+
+    // Test thread name
+    std::string name = Thread::GetName();
+    Thread::SetName("metadata-thread-name");
+    REQUIRE(Thread::GetName() == "metadata-thread");
+    REQUIRE(std::strcmp(info.name, "metadata-thread") == 0);
+    Thread::SetName(name);
+
+    // Test dense indexes of concurrent threads
+    std::vector<uint32_t> indexes(4);
+    std::vector<uint64_t> tids(4);
+    std::vector<std::thread> threads;
+    std::atomic<size_t> ready(0);
+    for (size_t i = 0; i < indexes.size(); ++i)
+    {
+        threads.emplace_back([&, i]()
+        {
+            indexes[i] = Thread::CurrentThreadIndex();
+            tids[i] = Thread::CurrentThreadInfo().tid;
+            // Keep all threads alive until all indexes are allocated
+            ++ready;
+            while (ready < indexes.size())
+                Thread::Yield();
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+
+    std::set<uint32_t> unique_indexes(indexes.begin(), indexes.end());
+    std::set<uint64_t> unique_tids(tids.begin(), tids.end());
+    REQUIRE(unique_indexes.size() == indexes.size());
+    REQUIRE(unique_tids.size() == tids.size());
+    REQUIRE(unique_indexes.count(info.index) == 0);
+    REQUIRE(unique_tids.count(info.tid) == 0);
+    for (uint32_t index : indexes)
+        REQUIRE(index < Thread::ThreadIndexCount());
+
+    // Indexes of finished threads are reused
+    uint32_t count = Thread::ThreadIndexCount();
+    std::thread([]() { Thread::CurrentThreadIndex(); }).join();
+    REQUIRE(Thread::ThreadIndexCount() == count);
+}
+
+TEST_CASE("Thread latency-critical setup", "[CppCommon][Threads]")
+{
+    std::thread([]()
+    {
+        REQUIRE(Thread::GetScheduling() == ThreadScheduling::NORMAL);
+
+        // Unprivileged parts of the latency-critical setup
+        Thread::PrefaultStack(128 * 1024);
+        Thread::SetTimerSlack(1);
+        Thread::SetScheduling(ThreadScheduling::NORMAL);
+        REQUIRE(Thread::GetScheduling() == ThreadScheduling::NORMAL);
+
+        // Real-time scheduling and memory locking might require privileges
+        ThreadLatencySetup setup;
+        setup.cpu = Thread::CurrentThreadAffinity();
+        setup.lock_memory = false;
+        try
+        {
+            Thread::SetupLatencyCritical(setup);
+            REQUIRE(Thread::GetScheduling() == ThreadScheduling::FIFO);
+            REQUIRE(Thread::GetAffinitySet() == CPUSet({ setup.cpu }));
+            Thread::SetScheduling(ThreadScheduling::NORMAL);
+        }
+        catch (const SystemException&) {}
+    }).join();
+
+    // Isolated logical processors are optional
+    CPUSet isolated = CPU::Isolated();
+    REQUIRE(((isolated.none()) || (isolated.first() >= 0)));
+}
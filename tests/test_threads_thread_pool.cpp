@@ -0,0 +1,87 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "test.h"
+
+#include "threads/latch.h"
+#include "threads/thread_pool.h"
+
+#include <atomic>
+#include <functional>
+#include <thread>
+#include <vector>
+
+using namespace CppCommon;
+
+TEST_CASE("Thread pool", "[CppCommon][Threads]")
+{
+    int tasks = 10000;
+    std::atomic<uint64_t> crc(0);
+    std::atomic<int> outsiders(0);
+
+    ThreadPool pool(4);
+    REQUIRE(pool.threads() == 4);
+    REQUIRE(pool.affinity() == ThreadPoolAffinity::NONE);
+    REQUIRE(pool.CurrentWorker() == -1);
+
+    // Submit tasks from the outside of the thread pool
+    Latch latch(tasks);
+    for (int i = 0; i < tasks; ++i)
+    {
+        pool.Submit([&crc, &outsiders, &latch, &pool, i]()
+        {
+            if (pool.CurrentWorker() < 0)
+                ++outsiders;
+            crc += i;
+            latch.CountDown();
+        });
+    }
+    latch.Wait();
+
+    REQUIRE(crc == (uint64_t)tasks * (tasks - 1) / 2);
+    REQUIRE(outsiders == (int)pool.overflows());
+}
+
+TEST_CASE("Thread pool nested tasks", "[CppCommon][Threads]")
+{
+    std::atomic<uint64_t> leaves(0);
+    std::function<void(int)> split;
+
+    {
+        ThreadPool pool(4, ThreadPoolAffinity::NONE, 64);
+
+        // Recursively split the work into nested tasks submitted from workers
+        split = [&pool, &leaves, &split](int depth)
+        {
+            if (depth == 0)
+            {
+                ++leaves;
+                return;
+            }
+            pool.Submit([&split, depth]() { split(depth - 1); });
+            pool.Submit([&split, depth]() { split(depth - 1); });
+        };
+
+        pool.Submit([&split]() { split(12); });
+
+        // Thread pool destructor executes all submitted tasks
+    }
+
+    REQUIRE(leaves == 4096);
+}
+
+TEST_CASE("Thread pool affinity", "[CppCommon][Threads]")
+{
+    std::atomic<int> count(0);
+
+    {
+        ThreadPool pool(0, ThreadPoolAffinity::PHYSICAL_CORES);
+        REQUIRE(pool.threads() > 0);
+
+        for (int i = 0; i < 100; ++i)
+            pool.Submit([&count]() { ++count; });
+    }
+
+    REQUIRE(count == 100);
+}
@@ -0,0 +1,237 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "test.h"
+
+#include "cache/memcache.h"
+#include "threads/latch.h"
+#include "threads/timer_queue.h"
+
+#include <atomic>
+#include <string>
+#include <vector>
+
+using namespace CppCommon;
+
+TEST_CASE("Timer queue", "[CppCommon][Threads]")
+{
+    TimerQueue timers(Timespan::milliseconds(1));
+    REQUIRE(timers.empty());
+    REQUIRE(timers.resolution() == Timespan::milliseconds(1));
+    REQUIRE(timers.NextDeadline() == Timestamp(0));
+
+    Timestamp start = NanoTimestamp();
+    std::vector<int> fired;
+
+    timers.Schedule(start + Timespan::milliseconds(30), [&fired]() { fired.push_back(3); });
+    timers.Schedule(start + Timespan::milliseconds(10), [&fired]() { fired.push_back(1); });
+    timers.Schedule(start + Timespan::milliseconds(20), [&fired]() { fired.push_back(2); });
+    REQUIRE(timers.size() == 3);
+    REQUIRE(timers.NextDeadline() == (start + Timespan::milliseconds(10)));
+
+    // Nothing is expired yet
+    REQUIRE(timers.Tick(start) == 0);
+    REQUIRE(fired.empty());
+
+    // Callbacks are never called before their deadlines
+    REQUIRE(timers.Tick(start + Timespan::milliseconds(10) - Timespan::nanoseconds(1)) == 0);
+    REQUIRE(timers.Tick(start + Timespan::milliseconds(10)) == 1);
+    REQUIRE(fired == std::vector<int>({ 1 }));
+
+    REQUIRE(timers.Tick(start + Timespan::milliseconds(30)) == 2);
+    REQUIRE(fired.size() == 3);
+    REQUIRE(timers.empty());
+}
+
+TEST_CASE("Timer queue cancel", "[CppCommon][Threads]")
+{
+    TimerQueue timers;
+
+    Timestamp start = NanoTimestamp();
+    int fired = 0;
+
+    TimerQueue::Handle handle1 = timers.Schedule(start + Timespan::milliseconds(5), [&fired]() { ++fired; });
+    TimerQueue::Handle handle2 = timers.Schedule(start + Timespan::milliseconds(5), [&fired]() { ++fired; });
+    TimerQueue::Handle handle3 = timers.Schedule(start + Timespan::seconds(3600), [&fired]() { ++fired; });
+    REQUIRE(handle1 != 0);
+    REQUIRE(handle1 != handle2);
+    REQUIRE(timers.size() == 3);
+
+    // Cancel timers of the first and the last levels
+    REQUIRE(timers.Cancel(handle1));
+    REQUIRE(!timers.Cancel(handle1));
+    REQUIRE(timers.Cancel(handle3));
+    REQUIRE(timers.size() == 1);
+
+    REQUIRE(timers.Tick(start + Timespan::seconds(7200)) == 1);
+    REQUIRE(fired == 1);
+
+    // Fired timer could not be cancelled
+    REQUIRE(!timers.Cancel(handle2));
+
+    // Stale handle of the reused timer node is rejected
+    TimerQueue::Handle handle4 = timers.Schedule(start, [&fired]() { ++fired; });
+    REQUIRE(handle4 != handle1);
+    REQUIRE(handle4 != handle2);
+    REQUIRE(!timers.Cancel(handle1));
+    REQUIRE(!timers.Cancel(handle2));
+    REQUIRE(!timers.Cancel(0));
+    REQUIRE(timers.Cancel(handle4));
+    REQUIRE(timers.empty());
+}
+
+TEST_CASE("Timer queue cascade", "[CppCommon][Threads]")
+{
+    TimerQueue timers(Timespan::microseconds(1));
+
+    Timestamp start = NanoTimestamp();
+    std::vector<int64_t> fired;
+
+    // Timers of all levels of the timer wheel
+    std::vector<int64_t> delays = { 1, 200, 300, 70000, 20000000, 5000000000ll };
+    for (auto i = delays.rbegin(); i != delays.rend(); ++i)
+    {
+        int64_t delay = *i;
+        timers.Schedule(start + Timespan::microseconds(delay), [&fired, delay]() { fired.push_back(delay); });
+    }
+
+    // Tick in growing steps, so far timers are cascaded
+    for (int64_t step = 1; step <= 10000000000ll; step *= 2)
+        timers.Tick(start + Timespan::microseconds(step));
+
+    REQUIRE(fired == delays);
+    REQUIRE(timers.empty());
+}
+
+TEST_CASE("Timer queue periodic", "[CppCommon][Threads]")
+{
+    TimerQueue timers;
+
+    Timestamp start = NanoTimestamp();
+    int fired = 0;
+
+    TimerQueue::Handle handle = timers.SchedulePeriodic(start + Timespan::milliseconds(10), Timespan::milliseconds(10), [&fired]() { ++fired; });
+
+    REQUIRE(timers.Tick(start + Timespan::milliseconds(10)) == 1);
+    REQUIRE(timers.Tick(start + Timespan::milliseconds(20)) == 1);
+    REQUIRE(fired == 2);
+
+    // Missed periods are skipped
+    REQUIRE(timers.Tick(start + Timespan::milliseconds(55)) == 1);
+    REQUIRE(fired == 3);
+    REQUIRE(timers.NextDeadline() == (start + Timespan::milliseconds(60)));
+
+    REQUIRE(timers.Cancel(handle));
+    REQUIRE(timers.Tick(start + Timespan::milliseconds(100)) == 0);
+    REQUIRE(fired == 3);
+    REQUIRE(timers.empty());
+}
+
+TEST_CASE("Timer queue reentrancy", "[CppCommon][Threads]")
+{
+    TimerQueue timers;
+
+    Timestamp start = NanoTimestamp();
+    int fired = 0;
+    int nested = 0;
+    TimerQueue::Handle handle = 0;
+
+    // Periodic timer cancels itself from its callback
+    handle = timers.SchedulePeriodic(start + Timespan::milliseconds(1), Timespan::milliseconds(1), [&]()
+    {
+        if (++fired == 3)
+            timers.Cancel(handle);
+    });
+    // Timer schedules another timer from its callback
+    timers.Schedule(start + Timespan::milliseconds(1), [&]()
+    {
+        timers.Schedule(start + Timespan::milliseconds(2), [&nested]() { ++nested; });
+    });
+
+    for (int i = 1; i <= 10; ++i)
+        timers.Tick(start + Timespan::milliseconds(i));
+
+    REQUIRE(fired == 3);
+    REQUIRE(nested == 1);
+    REQUIRE(timers.empty());
+}
+
+TEST_CASE("Timer queue limit", "[CppCommon][Threads]")
+{
+    TimerQueue timers;
+
+    Timestamp start = NanoTimestamp();
+    int fired = 0;
+
+    for (int i = 0; i < 10; ++i)
+        timers.Schedule(start + Timespan::milliseconds(1), [&fired]() { ++fired; });
+
+    REQUIRE(timers.Tick(start + Timespan::milliseconds(5), 4) == 4);
+    REQUIRE(timers.Tick(start + Timespan::milliseconds(5), 4) == 4);
+    REQUIRE(timers.Tick(start + Timespan::milliseconds(5), 4) == 2);
+    REQUIRE(fired == 10);
+    REQUIRE(timers.empty());
+}
+
+TEST_CASE("Timer queue thread", "[CppCommon][Threads]")
+{
+    TimerQueue timers;
+    REQUIRE(!timers.IsRunning());
+    REQUIRE(timers.Start());
+    REQUIRE(!timers.Start());
+    REQUIRE(timers.IsRunning());
+
+    int count = 100;
+    Latch latch(count);
+    std::atomic<int> early(0);
+
+    // Schedule timers from several threads with the running timer thread
+    for (int i = 0; i < count; ++i)
+    {
+        Timestamp deadline = NanoTimestamp() + Timespan::milliseconds(i % 20);
+        timers.Schedule(deadline, [deadline, &early, &latch]()
+        {
+            if (NanoTimestamp() < deadline)
+                ++early;
+            latch.CountDown();
+        });
+    }
+
+    // Earlier timer wakes up the sleeping timer thread
+    Latch first(1);
+    timers.Schedule(NanoTimestamp() + Timespan::seconds(3600), []() {});
+    timers.ScheduleAfter(Timespan::milliseconds(1), [&first]() { first.CountDown(); });
+
+    latch.Wait();
+    first.Wait();
+    REQUIRE(early == 0);
+    REQUIRE(timers.size() == 1);
+
+    REQUIRE(timers.Stop());
+    REQUIRE(!timers.Stop());
+    REQUIRE(!timers.IsRunning());
+}
+
+TEST_CASE("Timer queue memory cache watchdog", "[CppCommon][Threads]")
+{
+    MemCache<std::string, int> cache;
+    cache.insert("timeout", 1, Timespan::milliseconds(1));
+    cache.insert("forever", 2);
+    REQUIRE(cache.size() == 2);
+
+    TimerQueue timers;
+    Latch latch(1);
+    std::atomic<size_t> erased(0);
+    timers.SchedulePeriodic(Timespan::milliseconds(2), [&]()
+    {
+        if ((erased += cache.watchdog()) == 1)
+            latch.CountDown();
+    });
+    timers.Start();
+
+    latch.Wait();
+    timers.Stop();
+    REQUIRE(cache.size() == 1);
+    REQUIRE(cache.find("forever"));
+}
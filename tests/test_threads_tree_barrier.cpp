@@ -0,0 +1,107 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "test.h"
+
+#include "threads/thread.h"
+#include "threads/tree_barrier.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace CppCommon;
+
+TEST_CASE("Tree barrier single thread", "[CppCommon][Threads]")
+{
+    TreeBarrier barrier(1);
+
+    // Test Wait() method
+    REQUIRE(barrier.Wait(0));
+    REQUIRE(barrier.phase() == 1);
+
+    // Test split phase methods
+    auto token = barrier.Arrive(0);
+    REQUIRE(token.phase == 1);
+    REQUIRE(token.last);
+    REQUIRE(barrier.IsReady(token));
+    REQUIRE(barrier.Wait(token));
+}
+
+TEST_CASE("Tree barrier split phase", "[CppCommon][Threads]")
+{
+    TreeBarrier barrier(5, 2);
+
+    // Arrivals of all threads except the last one must not complete the phase
+    TreeBarrier::Token tokens[5];
+    for (int thread = 0; thread < 4; ++thread)
+    {
+        tokens[thread] = barrier.Arrive(thread);
+        REQUIRE(!tokens[thread].last);
+        REQUIRE(!barrier.IsReady(tokens[thread]));
+    }
+
+    tokens[4] = barrier.Arrive(4);
+    REQUIRE(tokens[4].last);
+    for (auto& token : tokens)
+        REQUIRE(barrier.IsReady(token));
+    REQUIRE(barrier.phase() == 1);
+
+    // Next phase is completed by another thread
+    for (int thread = 4; thread >= 0; --thread)
+        tokens[thread] = barrier.Arrive(thread);
+    REQUIRE(tokens[0].last);
+    REQUIRE(barrier.phase() == 2);
+}
+
+TEST_CASE("Tree barrier multiple threads", "[CppCommon][Threads]")
+{
+    int concurrency = 8;
+    int phases = 100;
+    std::atomic<bool> failed(false);
+    std::atomic<int> count(0);
+    std::atomic<int> last(0);
+
+    TreeBarrier barrier(concurrency, 2);
+
+    // Start some threads
+    std::vector<std::thread> threads;
+    for (int thread = 0; thread < concurrency; ++thread)
+    {
+        threads.emplace_back([&barrier, &count, &last, &failed, concurrency, phases, thread]()
+        {
+            for (int phase = 0; phase < phases; ++phase)
+            {
+                // Increment threads counter
+                ++count;
+
+                // Overlap the barrier with some independent work
+                auto token = barrier.Arrive(thread);
+                if ((thread == phase % concurrency))
+                    Thread::Yield();
+
+                // Wait for all other threads at the barrier
+                if (barrier.Wait(token))
+                    ++last;
+
+                // Check result in each thread
+                if (count < concurrency * (phase + 1))
+                    failed = true;
+
+                // Wait for all other threads to check the phase result
+                barrier.Wait(thread);
+            }
+        });
+    }
+
+    // Wait for all threads to complete
+    for (auto& thread : threads)
+        thread.join();
+
+    // Check results
+    REQUIRE(count == concurrency * phases);
+    REQUIRE(last == phases);
+    REQUIRE(barrier.phase() == (uint64_t)phases * 2);
+    REQUIRE(!failed);
+}
@@ -40,6 +40,27 @@ TEST_CASE("Multiple producers / multiple consumers wait batcher", "[CppCommon][T
     REQUIRE(batcher.size() == 0);
 }
 
+TEST_CASE("Multiple producers / multiple consumers wait batcher overflow", "[CppCommon][Threads]")
+{
+    WaitBatcher<int> batcher(0, 4);
+
+    std::vector<int> v;
+
+    for (int round = 0; round < 3; ++round)
+    {
+        for (int i = 0; i < 100; ++i)
+            REQUIRE(batcher.Enqueue(i));
+        REQUIRE(batcher.size() == 100);
+
+        REQUIRE(((batcher.Dequeue(v) && (v.size() == 100)) && (batcher.size() == 0)));
+        for (int i = 0; i < 100; ++i)
+            REQUIRE(v[i] == i);
+        REQUIRE(v.capacity() >= 100);
+    }
+
+    batcher.Close();
+}
+
 TEST_CASE("Multiple producers / multiple consumers wait batcher threads", "[CppCommon][Threads]")
 {
     int items_to_produce = 10000;
@@ -7,6 +7,7 @@
 #include "threads/wait_queue.h"
 
 #include <thread>
+#include <vector>
 
 using namespace CppCommon;
 
@@ -95,3 +96,88 @@ TEST_CASE("Multiple producers / multiple consumers wait queue threads", "[CppCom
     // Check result
     REQUIRE(crc == result);
 }
+
+TEST_CASE("Multiple producers / multiple consumers wait queue batch", "[CppCommon][Threads]")
+{
+    WaitQueue<int> queue(16);
+
+    for (int i = 0; i < 10; ++i)
+        REQUIRE(queue.Enqueue(i));
+
+    // Dequeue the limited batch of items
+    std::vector<int> items;
+    REQUIRE(queue.Dequeue(items, 4) == 4);
+    REQUIRE(items == std::vector<int>({ 0, 1, 2, 3 }));
+    REQUIRE(queue.size() == 6);
+
+    // Dequeue all available items into the output iterator
+    int buffer[16];
+    REQUIRE(queue.Dequeue(buffer, 16) == 6);
+    REQUIRE(((buffer[0] == 4) && (buffer[5] == 9)));
+    REQUIRE(queue.size() == 0);
+
+    // Fill the wait queue up to its capacity and release all producers slots at once
+    for (int i = 0; i < 16; ++i)
+        REQUIRE(queue.Enqueue(i));
+    REQUIRE(queue.Dequeue(items) == 16);
+    REQUIRE(items.size() == 16);
+    REQUIRE(items.back() == 15);
+
+    // Drain the remaining items of the closed wait queue
+    REQUIRE(queue.Enqueue(100));
+    queue.Close();
+    REQUIRE(queue.Dequeue(items) == 1);
+    REQUIRE(items == std::vector<int>({ 100 }));
+    REQUIRE(queue.Dequeue(items) == 0);
+    REQUIRE(items.empty());
+}
+
+TEST_CASE("Multiple producers / multiple consumers wait queue batch threads", "[CppCommon][Threads]")
+{
+    int items_to_produce = 10000;
+    int producers_count = 4;
+    int crc = 0;
+
+    WaitQueue<int> queue(16);
+
+    // Calculate result value
+    int result = 0;
+    for (int i = 0; i < items_to_produce; ++i)
+        result += i;
+
+    // Start consumer thread
+    auto consumer = std::thread([&queue, &crc]()
+    {
+        // Consume batches of items until the wait queue is closed
+        std::vector<int> items;
+        while (queue.Dequeue(items, 64) > 0)
+            for (int item : items)
+                crc += item;
+    });
+
+    // Start producers threads
+    std::vector<std::thread> producers;
+    for (int producer = 0; producer < producers_count; ++producer)
+    {
+        producers.emplace_back([&queue, producer, items_to_produce, producers_count]()
+        {
+            int items = (items_to_produce / producers_count);
+            for (int i = 0; i < items; ++i)
+                if (!queue.Enqueue((producer * items) + i))
+                    break;
+        });
+    }
+
+    // Wait for all producers threads
+    for (auto& producer : producers)
+        producer.join();
+
+    // Close the wait queue
+    queue.Close();
+
+    // Wait for the consumer thread
+    consumer.join();
+
+    // Check result
+    REQUIRE(crc == result);
+}
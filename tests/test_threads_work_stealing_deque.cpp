@@ -0,0 +1,109 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "test.h"
+
+#include "threads/work_stealing_deque.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace CppCommon;
+
+TEST_CASE("Work-stealing deque", "[CppCommon][Threads]")
+{
+    WorkStealingDeque<int> deque(4);
+
+    REQUIRE(deque.capacity() == 4);
+    REQUIRE(deque.empty());
+
+    int item = 0;
+    REQUIRE(!deque.Pop(item));
+    REQUIRE(!deque.Steal(item));
+
+    REQUIRE(deque.Push(0));
+    REQUIRE(deque.Push(1));
+    REQUIRE(deque.Push(2));
+    REQUIRE(deque.Push(3));
+    REQUIRE(!deque.Push(4));
+    REQUIRE(deque.size() == 4);
+
+    // Owner pops in LIFO order
+    REQUIRE((deque.Pop(item) && (item == 3)));
+    // Thieves steal in FIFO order
+    REQUIRE((deque.Steal(item) && (item == 0)));
+    REQUIRE((deque.Steal(item) && (item == 1)));
+    REQUIRE((deque.Pop(item) && (item == 2)));
+
+    REQUIRE(deque.empty());
+    REQUIRE(!deque.Pop(item));
+    REQUIRE(!deque.Steal(item));
+
+    // Wrap around the deque buffer
+    for (int i = 0; i < 10; ++i)
+    {
+        REQUIRE(deque.Push(i));
+        REQUIRE((deque.Steal(item) && (item == i)));
+    }
+    REQUIRE(deque.empty());
+}
+
+TEST_CASE("Work-stealing deque threads", "[CppCommon][Threads]")
+{
+    int items_to_produce = 100000;
+    int thieves = 4;
+
+    WorkStealingDeque<int> deque(1024);
+
+    std::atomic<bool> done(false);
+    std::atomic<uint64_t> crc(0);
+    std::atomic<int> count(0);
+
+    // Start thieves threads
+    std::vector<std::thread> threads;
+    for (int thief = 0; thief < thieves; ++thief)
+    {
+        threads.emplace_back([&deque, &done, &crc, &count]()
+        {
+            int item;
+            while (!done.load() || !deque.empty())
+            {
+                if (deque.Steal(item))
+                {
+                    crc += item;
+                    ++count;
+                }
+                else
+                    std::this_thread::yield();
+            }
+        });
+    }
+
+    // Push items and pop some of them in the owner thread
+    uint64_t owner_crc = 0;
+    int owner_count = 0;
+    for (int i = 0; i < items_to_produce; ++i)
+    {
+        while (!deque.Push(i))
+            std::this_thread::yield();
+
+        int item;
+        if (((i % 3) == 0) && deque.Pop(item))
+        {
+            owner_crc += item;
+            ++owner_count;
+        }
+    }
+
+    done = true;
+
+    // Wait for all thieves threads
+    for (auto& thread : threads)
+        thread.join();
+
+    // Each item must be taken exactly once
+    REQUIRE((count + owner_count) == items_to_produce);
+    REQUIRE((crc + owner_crc) == (uint64_t)items_to_produce * (items_to_produce - 1) / 2);
+}
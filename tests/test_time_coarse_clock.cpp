@@ -0,0 +1,50 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "test.h"
+
+#include "time/coarse_clock.h"
+
+#include <thread>
+
+using namespace CppCommon;
+
+TEST_CASE("Coarse clock", "[CppCommon][Time]")
+{
+    // Coarse system clocks
+    REQUIRE(!CoarseClock::IsStarted());
+    REQUIRE(CoarseClock::utc() > 0);
+    REQUIRE(CoarseClock::nano() > 0);
+    REQUIRE(std::abs((int64_t)(CoarseClock::utc() - Timestamp::utc())) < 100000000);
+    REQUIRE(std::abs((int64_t)(CoarseClock::nano() - Timestamp::nano())) < 100000000);
+
+    // Coarse clock ticker
+    REQUIRE(CoarseClock::Start(Timespan::milliseconds(1)));
+    REQUIRE(!CoarseClock::Start());
+    REQUIRE(CoarseClock::IsStarted());
+
+    uint64_t prev_utc = 0;
+    uint64_t prev_nano = 0;
+    for (int i = 0; i < 100; ++i)
+    {
+        uint64_t utc = CoarseClock::utc();
+        uint64_t nano = CoarseClock::nano();
+        REQUIRE(utc >= prev_utc);
+        REQUIRE(nano >= prev_nano);
+        REQUIRE(std::abs((int64_t)(utc - Timestamp::utc())) < 100000000);
+        REQUIRE(std::abs((int64_t)(nano - Timestamp::nano())) < 100000000);
+        prev_utc = utc;
+        prev_nano = nano;
+    }
+
+    // Coarse clock is updated by the ticker
+    uint64_t start = CoarseTimestamp().total();
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    REQUIRE(CoarseTimestamp().total() > start);
+
+    REQUIRE(CoarseClock::Stop());
+    REQUIRE(!CoarseClock::Stop());
+    REQUIRE(!CoarseClock::IsStarted());
+    REQUIRE(CoarseClock::utc() > 0);
+}
@@ -0,0 +1,118 @@
+//
+// Created by Ivan Shynkarenka on 15.10.2026
+//
+
+#include "test.h"
+
+#include "time/latency_histogram.h"
+
+#include <thread>
+#include <vector>
+
+using namespace CppCommon;
+
+TEST_CASE("Latency histogram", "[CppCommon][Time]")
+{
+    LatencyHistogram histogram;
+    REQUIRE(histogram.empty());
+    REQUIRE(histogram.digits() == 3);
+    REQUIRE(histogram.highest() == LatencyHistogram::DEFAULT_HIGHEST);
+    REQUIRE(histogram.p99() == 0);
+
+    for (uint64_t i = 1; i <= 10000; ++i)
+        histogram.Record(i * 1000);
+    histogram.Record(Timespan::seconds(1), 10);
+    REQUIRE(histogram.count() == 10010);
+
+    // Values are within the relative error of three significant digits
+    REQUIRE(histogram.min() == 1000);
+    REQUIRE(((histogram.max() >= 1000000000) && (histogram.max() <= 1001000000)));
+    REQUIRE(((histogram.p50() >= 5005000) && (histogram.p50() <= 5011000)));
+    REQUIRE(((histogram.p99() >= 9910000) && (histogram.p99() <= 9920000)));
+    REQUIRE(((histogram.p999() >= 10000000) && (histogram.p999() <= 10010000)));
+    REQUIRE(histogram.Percentile(99.95) >= 1000000000);
+    REQUIRE(histogram.Percentile(0.0) == histogram.HighestValue(histogram.Index(1000)));
+    REQUIRE(histogram.Percentile(100.0) == histogram.max());
+    REQUIRE(histogram.mean() > 0.0);
+    REQUIRE(histogram.stddev() > 0.0);
+
+    // Values in the first bucket are exact
+    for (uint64_t i = 0; i < 2048; ++i)
+        REQUIRE(((histogram.LowestValue(histogram.Index(i)) == i) && (histogram.HighestValue(histogram.Index(i)) == i)));
+
+    // Values above the highest trackable value are saturated
+    histogram.Record(UINT64_MAX);
+    REQUIRE(histogram.max() >= histogram.highest());
+
+    histogram.Clear();
+    REQUIRE(histogram.empty());
+    REQUIRE(histogram.max() == 0);
+}
+
+TEST_CASE("Latency histogram merge and serialization", "[CppCommon][Time]")
+{
+    LatencyHistogram histogram1(1000000000, 2);
+    LatencyHistogram histogram2(1000000000, 2);
+    LatencyHistogram histogram3(1000000000, 3);
+
+    for (uint64_t i = 0; i < 1000; ++i)
+    {
+        histogram1.Record(i * i);
+        histogram2.Record(i * 7);
+    }
+
+    REQUIRE(!histogram1.Merge(histogram3));
+    REQUIRE(histogram1.Merge(histogram2));
+    REQUIRE(histogram1.count() == 2000);
+
+    std::vector<uint8_t> buffer = histogram1.Serialize();
+    REQUIRE(buffer.size() < (histogram1.buckets() * sizeof(uint64_t)));
+
+    LatencyHistogram restored;
+    REQUIRE(LatencyHistogram::Deserialize(buffer, restored) == buffer.size());
+    REQUIRE(restored.highest() == histogram1.highest());
+    REQUIRE(restored.digits() == histogram1.digits());
+    REQUIRE(restored.count() == histogram1.count());
+    REQUIRE(restored.min() == histogram1.min());
+    REQUIRE(restored.max() == histogram1.max());
+    REQUIRE(restored.p99() == histogram1.p99());
+
+    // Truncated buffer is rejected
+    buffer.pop_back();
+    REQUIRE(LatencyHistogram::Deserialize(buffer, restored) == 0);
+    REQUIRE(restored.count() == histogram1.count());
+}
+
+TEST_CASE("Concurrent latency histogram", "[CppCommon][Time]")
+{
+    int threads_count = 8;
+    uint64_t items_to_record = 100000;
+
+    ConcurrentLatencyHistogram histogram(1000000000, 3, 4);
+    REQUIRE(histogram.shards() == 4);
+
+    std::vector<std::thread> threads;
+    for (int thread = 0; thread < threads_count; ++thread)
+    {
+        threads.emplace_back([&histogram, items_to_record]()
+        {
+            for (uint64_t i = 1; i <= items_to_record; ++i)
+                histogram.Record(i);
+        });
+    }
+
+    for (auto& thread : threads)
+        thread.join();
+
+    LatencyHistogram snapshot = histogram.Snapshot();
+    REQUIRE(snapshot.count() == (threads_count * items_to_record));
+    REQUIRE(snapshot.min() == 1);
+    REQUIRE(((snapshot.max() >= items_to_record) && (snapshot.max() <= (items_to_record + 100))));
+    REQUIRE(((snapshot.p50() >= 50000) && (snapshot.p50() <= 50100)));
+
+    LatencyHistogram other;
+    REQUIRE(!histogram.Snapshot(other));
+
+    histogram.Clear();
+    REQUIRE(histogram.Snapshot().empty());
+}
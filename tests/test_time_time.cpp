@@ -8,6 +8,8 @@
 
 #include <thread>
 
+#include <time.h>
+
 using namespace CppCommon;
 
 TEST_CASE("Time", "[CppCommon][Time]")
@@ -45,3 +47,93 @@ TEST_CASE("Time", "[CppCommon][Time]")
     UtcTime time9(std::chrono::system_clock::now() + std::chrono::milliseconds(10));
     std::this_thread::sleep_until(time9.chrono());
 }
+
+TEST_CASE("Time civil conversions", "[CppCommon][Time]")
+{
+    // Compare civil date & time conversions with the system ones
+    uint64_t seconds = 0;
+    for (int i = 0; i < 50000; ++i)
+    {
+        seconds += 86400 * (i % 7) + 3600 * (i % 5) + (i % 61) * 61 + 1;
+
+        time_t time = (time_t)seconds;
+        struct tm result;
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+        REQUIRE(gmtime_r(&time, &result) == &result);
+#elif defined(_WIN32) || defined(_WIN64)
+        REQUIRE(gmtime_s(&result, &time) == 0);
+#endif
+
+        UtcTime utctime(Timestamp(seconds * 1000000000ull + 123456789));
+        REQUIRE(utctime.year() == (result.tm_year + 1900));
+        REQUIRE(utctime.month() == (result.tm_mon + 1));
+        REQUIRE(utctime.day() == result.tm_mday);
+        REQUIRE((int)utctime.weekday() == result.tm_wday);
+        REQUIRE(utctime.hour() == result.tm_hour);
+        REQUIRE(utctime.minute() == result.tm_min);
+        REQUIRE(utctime.second() == result.tm_sec);
+        REQUIRE(utctime.millisecond() == 123);
+        REQUIRE(utctime.microsecond() == 456);
+        REQUIRE(utctime.nanosecond() == 789);
+        REQUIRE(utctime.utcstamp().total() == (seconds * 1000000000ull + 123456789));
+    }
+
+    // Day overflow is normalized like the system conversion
+    REQUIRE(Time(2016, 2, 31).utcstamp() == Time(2016, 3, 2).utcstamp());
+}
+
+TEST_CASE("Time ISO-8601", "[CppCommon][Time]")
+{
+    char buffer[ISO8601_BUFFER_SIZE];
+    Timestamp timestamp(1468408953123456789ull);
+
+    // Format ISO-8601 timestamps
+    REQUIRE(std::string(buffer, FormatISO8601(buffer, timestamp)) == "2016-07-13T11:22:33.123456789Z");
+    REQUIRE(std::string(buffer, FormatISO8601(buffer, timestamp, 0)) == "2016-07-13T11:22:33Z");
+    REQUIRE(std::string(buffer, FormatISO8601(buffer, timestamp, 1)) == "2016-07-13T11:22:33.1Z");
+    REQUIRE(std::string(buffer, FormatISO8601(buffer, timestamp, 3)) == "2016-07-13T11:22:33.123Z");
+    REQUIRE(std::string(buffer, FormatISO8601(buffer, timestamp, 6)) == "2016-07-13T11:22:33.123456Z");
+    REQUIRE(std::string(buffer, FormatISO8601(buffer, Timestamp(0))) == "1970-01-01T00:00:00.000000000Z");
+    REQUIRE(std::string(buffer, FormatISO8601(buffer, timestamp, Timespan::hours(3), 3)) == "2016-07-13T14:22:33.123+03:00");
+    REQUIRE(std::string(buffer, FormatISO8601(buffer, timestamp, -Timespan::minutes(570), 0)) == "2016-07-13T01:52:33-09:30");
+
+    // Parse ISO-8601 timestamps
+    REQUIRE(ParseISO8601("2016-07-13T11:22:33.123456789Z") == timestamp);
+    REQUIRE(ParseISO8601("2016-07-13t11:22:33.123456789z") == timestamp);
+    REQUIRE(ParseISO8601("2016-07-13 11:22:33.123456789") == timestamp);
+    REQUIRE(ParseISO8601("2016-07-13T14:22:33.123456789+03:00") == timestamp);
+    REQUIRE(ParseISO8601("2016-07-13T01:52:33.123456789-0930") == timestamp);
+    REQUIRE(ParseISO8601("2016-07-13T11:22:33.1234567891234Z") == timestamp);
+    REQUIRE(ParseISO8601("2016-07-13T11:22:33.123Z") == Timestamp(1468408953123000000ull));
+    REQUIRE(ParseISO8601("2016-07-13T11:22:33Z") == Timestamp(1468408953000000000ull));
+    REQUIRE(ParseISO8601("2016-02-29T00:00:00Z") == Time(2016, 2, 29).utcstamp());
+
+    Timestamp result;
+    REQUIRE(!ParseISO8601("", result));
+    REQUIRE(!ParseISO8601("2016-07-13", result));
+    REQUIRE(!ParseISO8601("2016-07-13T11:22", result));
+    REQUIRE(!ParseISO8601("2016-13-13T11:22:33Z", result));
+    REQUIRE(!ParseISO8601("2015-02-29T11:22:33Z", result));
+    REQUIRE(!ParseISO8601("2016-07-13T24:22:33Z", result));
+    REQUIRE(!ParseISO8601("2016-07-13T11:22:33.Z", result));
+    REQUIRE(!ParseISO8601("2016-07-13T11:22:33+3:00", result));
+    REQUIRE(!ParseISO8601("2016-07-13T11:22:33Zabc", result));
+    REQUIRE(!ParseISO8601("1969-12-31T23:59:59Z", result));
+    REQUIRE(!ParseISO8601("2600-01-01T00:00:00Z", result));
+    REQUIRE_THROWS_AS(ParseISO8601("2016-07-13T11:22:33X"), ArgumentException);
+
+    // Round trip of formatted timestamps
+    uint64_t value = 0;
+    for (int i = 0; i < 10000; ++i)
+    {
+        value += 86400123456789ull * (i % 17) + 987654321;
+        size_t size = FormatISO8601(buffer, Timestamp(value));
+        REQUIRE(ParseISO8601(std::string_view(buffer, size), result));
+        REQUIRE(result.total() == value);
+    }
+
+    // Format timestamps with fmt library
+    REQUIRE(format("{}", timestamp) == "2016-07-13T11:22:33.123456789Z");
+    REQUIRE(format("{}", UtcTimestamp(timestamp)) == "2016-07-13T11:22:33.123456789Z");
+    REQUIRE(format("{}", UtcTime(timestamp)) == "2016-07-13T11:22:33.123456789Z");
+}
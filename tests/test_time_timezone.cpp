@@ -6,6 +6,12 @@
 
 #include "time/timezone.h"
 
+#include <cstdlib>
+#include <string>
+#include <thread>
+
+#include <time.h>
+
 using namespace CppCommon;
 
 TEST_CASE("Timezone", "[CppCommon][Time]")
@@ -29,3 +35,57 @@ TEST_CASE("Timezone", "[CppCommon][Time]")
     Timezone timezone5 = Timezone::local();
     REQUIRE(std::abs((timezone4.total() - timezone5.total()).hours()) < 24);
 }
+
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+TEST_CASE("Timezone local offset", "[CppCommon][Time]")
+{
+    // Switch the process timezone to the one with daylight saving time transitions
+    const char* tz = std::getenv("TZ");
+    std::string previous = (tz != nullptr) ? tz : "";
+    setenv("TZ", "America/New_York", 1);
+    tzset();
+
+    // Local timezone cache is per thread, so check it in the new thread
+    size_t errors = 0;
+    std::thread thread([&errors]()
+    {
+        // Sequential timestamps through several daylight saving time transitions
+        uint64_t start = 1451606400;
+        for (uint64_t seconds = start; seconds < (start + 3 * 366 * 86400); seconds += 1777)
+        {
+            time_t time = (time_t)seconds;
+            struct tm local;
+            localtime_r(&time, &local);
+
+            Timestamp timestamp(seconds * 1000000000ull);
+            if (Timezone::LocalOffset(timestamp).seconds() != local.tm_gmtoff)
+                ++errors;
+
+            LocalTime localtime(timestamp);
+            if ((localtime.hour() != local.tm_hour) || (localtime.day() != local.tm_mday) || ((int)localtime.weekday() != local.tm_wday))
+                ++errors;
+
+            // Local time is ambiguous within one hour after the daylight saving time end
+            uint64_t utc = localtime.localstamp().total();
+            if ((utc != timestamp.total()) && ((utc + 3600000000000ull) != timestamp.total()) && (utc != (timestamp.total() + 3600000000000ull)))
+                ++errors;
+        }
+
+        // Daylight saving time transition instants
+        if (Timezone::LocalOffset(Timestamp(1457852399ull * 1000000000ull)) != Timespan::hours(-5))
+            ++errors;
+        if (Timezone::LocalOffset(Timestamp(1457852400ull * 1000000000ull)) != Timespan::hours(-4))
+            ++errors;
+    });
+    thread.join();
+
+    // Restore the process timezone
+    if (tz != nullptr)
+        setenv("TZ", previous.c_str(), 1);
+    else
+        unsetenv("TZ");
+    tzset();
+
+    REQUIRE(errors == 0);
+}
+#endif
@@ -0,0 +1,67 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "test.h"
+
+#include "time/tsc_clock.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace CppCommon;
+
+TEST_CASE("TSC clock", "[CppCommon][Time]")
+{
+    if (TscClock::IsInvariant())
+        REQUIRE(TscClock::frequency() > 0);
+    else
+        REQUIRE(TscClock::frequency() == 0);
+
+    // TSC clock must be close to the system UTC clock
+    for (int i = 0; i < 1000; ++i)
+    {
+        uint64_t utc1 = Timestamp::utc();
+        uint64_t tsc = TscClock::utc();
+        uint64_t utc2 = Timestamp::utc();
+        REQUIRE(tsc + 10000000 >= utc1);
+        REQUIRE(tsc <= utc2 + 10000000);
+    }
+
+    TscClock::Resync();
+    REQUIRE(TscTimestamp().total() > 0);
+    REQUIRE(std::abs((int64_t)(TscTimestamp().total() - UtcTimestamp().total())) < 10000000);
+}
+
+TEST_CASE("TSC clock resync", "[CppCommon][Time]")
+{
+    std::atomic<uint64_t> errors(0);
+
+    // Stress concurrent readers with resynchronizations
+    std::vector<std::thread> threads;
+    for (int thread = 0; thread < 4; ++thread)
+    {
+        threads.emplace_back([&errors, thread]()
+        {
+            for (int i = 0; i < 10000; ++i)
+            {
+                if ((thread == 0) && ((i % 100) == 0))
+                    TscClock::Resync();
+
+                uint64_t utc = Timestamp::utc();
+                uint64_t tsc = TscClock::utc();
+                if ((tsc + 10000000) < utc)
+                    ++errors;
+
+                if ((i % 1000) == 0)
+                    std::this_thread::yield();
+            }
+        });
+    }
+
+    for (auto& thread : threads)
+        thread.join();
+
+    REQUIRE(errors == 0);
+}
@@ -7,6 +7,9 @@
 #include "system/environment.h"
 #include "utility/endian.h"
 
+#include <cstring>
+#include <vector>
+
 using namespace CppCommon;
 
 TEST_CASE("Endian", "[CppCommon][Utility]")
@@ -15,3 +18,80 @@ TEST_CASE("Endian", "[CppCommon][Utility]")
     REQUIRE((Endian::IsBigEndian() == Environment::IsBigEndian()));
     REQUIRE((Endian::IsLittleEndian() == Environment::IsLittleEndian()));
 }
+
+TEST_CASE("Endian byte swap", "[CppCommon][Utility]")
+{
+    static_assert(Endian::ByteSwap((uint8_t)0x12) == 0x12);
+    static_assert(Endian::ByteSwap((uint16_t)0x1234) == 0x3412);
+    static_assert(Endian::ByteSwap((uint32_t)0x12345678) == 0x78563412);
+    static_assert(Endian::ByteSwap((uint64_t)0x0123456789ABCDEFull) == 0xEFCDAB8967452301ull);
+    static_assert(Endian::ByteSwap((int16_t)-2) == (int16_t)0xFEFF);
+    static_assert(Endian::ConvertBigEndian(Endian::ConvertBigEndian((uint32_t)0x12345678)) == 0x12345678);
+    static_assert(Endian::ConvertLittleEndian((uint32_t)0x12345678) == (Endian::IsLittleEndian() ? 0x12345678 : 0x78563412));
+
+    const uint8_t bytes[] = { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08 };
+
+    // Unaligned loads
+    REQUIRE(Endian::LoadBigEndian<uint16_t>(bytes + 1) == 0x0102);
+    REQUIRE(Endian::LoadBigEndian<uint32_t>(bytes + 1) == 0x01020304);
+    REQUIRE(Endian::LoadBigEndian<uint64_t>(bytes + 1) == 0x0102030405060708ull);
+    REQUIRE(Endian::LoadLittleEndian<uint16_t>(bytes + 1) == 0x0201);
+    REQUIRE(Endian::LoadLittleEndian<uint32_t>(bytes + 1) == 0x04030201);
+    REQUIRE(Endian::LoadLittleEndian<uint64_t>(bytes + 1) == 0x0807060504030201ull);
+
+    // Unaligned stores
+    uint8_t buffer[9] = { 0 };
+    Endian::StoreBigEndian(buffer + 1, (uint64_t)0x0102030405060708ull);
+    REQUIRE(std::memcmp(buffer + 1, bytes + 1, 8) == 0);
+    Endian::StoreLittleEndian(buffer + 1, (uint32_t)0x04030201);
+    REQUIRE(std::memcmp(buffer + 1, bytes + 1, 4) == 0);
+
+    // Read and write methods
+    int32_t value;
+    REQUIRE(Endian::ReadBigEndian(bytes + 1, value) == 4);
+    REQUIRE(value == 0x01020304);
+    REQUIRE(Endian::WriteLittleEndian(buffer, (int16_t)-2) == 2);
+    REQUIRE(((buffer[0] == 0xFE) && (buffer[1] == 0xFF)));
+}
+
+template <typename T>
+void TestByteSwapArray()
+{
+    // Different sizes cover vectorized blocks and scalar tails
+    for (size_t size = 0; size < 100; ++size)
+    {
+        std::vector<T> values(size);
+        for (size_t i = 0; i < size; ++i)
+            values[i] = (T)((i + 1) * 0x0102030405060708ull);
+
+        std::vector<T> swapped = values;
+        Endian::ByteSwap(std::span<T>(swapped));
+        for (size_t i = 0; i < size; ++i)
+            REQUIRE(swapped[i] == Endian::ByteSwap(values[i]));
+
+        std::vector<T> converted = values;
+        Endian::ConvertBigEndian(converted);
+        for (size_t i = 0; i < size; ++i)
+            REQUIRE(converted[i] == Endian::ConvertBigEndian(values[i]));
+
+        Endian::ConvertLittleEndian(converted);
+        for (size_t i = 0; i < size; ++i)
+            REQUIRE(converted[i] == Endian::ConvertLittleEndian(Endian::ConvertBigEndian(values[i])));
+    }
+}
+
+TEST_CASE("Endian array conversion", "[CppCommon][Utility]")
+{
+    TestByteSwapArray<uint16_t>();
+    TestByteSwapArray<uint32_t>();
+    TestByteSwapArray<uint64_t>();
+
+    // Decode big-endian wire array in bulk
+    const uint8_t bytes[] = { 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00 };
+    uint32_t values[3];
+    std::memcpy(values, bytes, sizeof(values));
+    Endian::ConvertBigEndian(values);
+    REQUIRE(values[0] == 0x00000001);
+    REQUIRE(values[1] == 0x00000100);
+    REQUIRE(values[2] == 0x00010000);
+}
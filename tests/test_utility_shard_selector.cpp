@@ -0,0 +1,37 @@
+//
+// Created by Ivan Shynkarenka on 15.10.2026
+//
+
+#include "test.h"
+
+#include "utility/shard_selector.h"
+
+#include <vector>
+
+using namespace CppCommon;
+
+TEST_CASE("Shard selector", "[CppCommon][Utility]")
+{
+    // Shards count is rounded up to the power of two
+    REQUIRE(ShardSelector(0).count() == 1);
+    REQUIRE(ShardSelector(1).count() == 1);
+    REQUIRE(ShardSelector(3).count() == 4);
+    REQUIRE(ShardSelector(16).count() == 16);
+
+    // Single shard is always selected
+    ShardSelector single(1);
+    REQUIRE(single(0) == 0);
+    REQUIRE(single((size_t)-1) == 0);
+
+    // Sequential hashes are spread over all shards
+    ShardSelector selector(16);
+    std::vector<size_t> counts(selector.count(), 0);
+    for (size_t hash = 0; hash < 1600; ++hash)
+    {
+        size_t index = selector(hash);
+        REQUIRE(index < selector.count());
+        ++counts[index];
+    }
+    for (size_t count : counts)
+        REQUIRE(count > 0);
+}